@@ -22,20 +22,41 @@
 #]]
 
 set(HEADER_FILE_NAMES
+    allocations.h
     asio.h
     auxil.h
     bytes.h
     concepts.h
     contextuallogger.h
     device.h
+    deviceserver.h
     env.h
+    error.h
+    fifoaggregator.h
+    fifodecoder.h
+    fifoshmreader.h
+    fifostream.h
+    interfaceregistry.h
     layerbase.h
     layerconfig.h
     layerfactory.h
     layerfactorymacros.h
     logger.h
+    memoryplacement.h
+    metrics.h
+    onlinehistograms.h
+    pooledbuffer.h
+    rawdatafile.h
+    readoutpipeline.h
+    scanengine.h
+    scheduler.h
+    slowcontrolarchiver.h
+    slowcontrolpoller.h
+    staticlayerfactory.h
     templatedevice.h
     templatedevicemacros.h
+    timing.h
+    tracer.h
     version.h
     HL/directdriver.h
     HL/driver.h
@@ -50,40 +71,84 @@ set(HEADER_FILE_NAMES
     RL/dummyregister.h
     RL/register.h
     RL/standardregister.h
+    RL/valueregister.h
     TL/directinterface.h
     TL/interface.h
     TL/muxedinterface.h
     TL/CommonImpl/asiohelper.h
+    TL/CommonImpl/endpointcache.h
+    TL/CommonImpl/eventlistener.h
+    TL/CommonImpl/fifofilewriter.h
+    TL/CommonImpl/fiforingbuffer.h
+    TL/CommonImpl/fifoshmwriter.h
+    TL/CommonImpl/rbcpdispatcher.h
+    TL/CommonImpl/reconnectpolicy.h
     TL/CommonImpl/serialportwrapper.h
+    TL/CommonImpl/sessionrecorder.h
+    TL/CommonImpl/socketoptions.h
     TL/CommonImpl/tcpsocketwrapper.h
     TL/CommonImpl/udpsocketwrapper.h
     TL/Direct/dummyinterface.h
     TL/Direct/serial.h
     TL/Direct/tcp.h
     TL/Direct/udp.h
+    TL/Direct/udpring.h
     TL/Muxed/dummymuxedinterface.h
+    TL/Muxed/mmio.h
+    TL/Muxed/remote.h
+    TL/Muxed/replaymuxedinterface.h
+    TL/Muxed/simmuxed.h
     TL/Muxed/sitcp.h
 )
 
 set(HEADER_FILE_NAMES_EXCLUDE_INSTALL
     TL/CommonImpl/asiohelper.h
+    TL/CommonImpl/endpointcache.h
+    TL/CommonImpl/eventlistener.h
+    TL/CommonImpl/fifofilewriter.h
+    TL/CommonImpl/fiforingbuffer.h
+    TL/CommonImpl/fifoshmwriter.h
+    TL/CommonImpl/rbcpdispatcher.h
+    TL/CommonImpl/reconnectpolicy.h
     TL/CommonImpl/serialportwrapper.h
+    TL/CommonImpl/sessionrecorder.h
+    TL/CommonImpl/socketoptions.h
     TL/CommonImpl/tcpsocketwrapper.h
     TL/CommonImpl/udpsocketwrapper.h
 )
 
 set(SOURCE_FILE_NAMES
+    allocations
     asio
     assert
     auxil
     bytes
     contextuallogger
     device
+    deviceserver
     env
+    error
+    fifoaggregator
+    fifodecoder
+    fifoshmreader
+    fifostream
+    interfaceregistry
     layerbase
     layerconfig
     layerfactory
     logger
+    memoryplacement
+    metrics
+    onlinehistograms
+    pooledbuffer
+    rawdatafile
+    readoutpipeline
+    scanengine
+    scheduler
+    slowcontrolarchiver
+    slowcontrolpoller
+    timing
+    tracer
     version
     HL/directdriver
     HL/driver
@@ -98,24 +163,58 @@ set(SOURCE_FILE_NAMES
     RL/dummyregister
     RL/register
     RL/standardregister
+    RL/valueregister
     TL/directinterface
     TL/interface
     TL/muxedinterface
     TL/CommonImpl/asiohelper
+    TL/CommonImpl/endpointcache
+    TL/CommonImpl/eventlistener
+    TL/CommonImpl/fifofilewriter
+    TL/CommonImpl/fiforingbuffer
+    TL/CommonImpl/fifoshmwriter
+    TL/CommonImpl/rbcpdispatcher
+    TL/CommonImpl/reconnectpolicy
     TL/CommonImpl/serialportwrapper
+    TL/CommonImpl/sessionrecorder
+    TL/CommonImpl/socketoptions
     TL/CommonImpl/tcpsocketwrapper
     TL/CommonImpl/udpsocketwrapper
     TL/Direct/dummyinterface
     TL/Direct/serial
     TL/Direct/tcp
     TL/Direct/udp
+    TL/Direct/udpring
     TL/Muxed/dummymuxedinterface
+    TL/Muxed/mmio
+    TL/Muxed/remote
+    TL/Muxed/replaymuxedinterface
+    TL/Muxed/simmuxed
     TL/Muxed/sitcp
 )
 
+set(OPTIONAL_COMPONENT_NAMES
+    HL/Direct/dummydriver
+    HL/Direct/scpi
+    HL/Direct/virtecho
+    HL/Muxed/dummymuxeddriver
+    HL/Muxed/gpio
+    RL/dummyregister
+    TL/Direct/dummyinterface
+    TL/Direct/serial
+    TL/Direct/tcp
+    TL/Direct/udp
+    TL/Muxed/dummymuxedinterface
+    TL/Muxed/mmio
+    TL/Muxed/remote
+    TL/Muxed/replaymuxedinterface
+    TL/Muxed/simmuxed
+)
+
 set(TESTS_FILE_NAMES
     tests.cpp
     datadirfixture.h
+    core/test_allocations/test_allocations.cpp
     core/test_asio/test_asio.cpp
     core/test_auxil/test_auxil.cpp
     core/test_bytes/test_bytes.cpp
@@ -125,6 +224,7 @@ set(TESTS_FILE_NAMES
     core/test_device/test_device.cpp
     core/test_device/rtconfdriver.cpp
     core/test_device/rtconfdriver.h
+    core/test_deviceserver/test_deviceserver.cpp
     core/test_layerbase/test_layerbase.cpp
     core/test_layerbase/layertestclass.cpp
     core/test_layerbase/layertestclass.h
@@ -139,13 +239,31 @@ set(TESTS_FILE_NAMES
     core/test_layerpolymorphism/testinterface.h
     core/test_layerpolymorphism/wrongregister.cpp
     core/test_layerpolymorphism/wrongregister.h
+    core/test_error/test_error.cpp
+    core/test_fifoaggregator/test_fifoaggregator.cpp
+    core/test_fifodecoder/test_fifodecoder.cpp
+    core/test_fifostream/test_fifostream.cpp
     core/test_logger/test_logger.cpp
+    core/test_memoryplacement/test_memoryplacement.cpp
+    core/test_metrics/test_metrics.cpp
+    core/test_onlinehistograms/test_onlinehistograms.cpp
+    core/test_pooledbuffer/test_pooledbuffer.cpp
+    core/test_rawdatafile/test_rawdatafile.cpp
+    core/test_readoutpipeline/test_readoutpipeline.cpp
+    core/test_scanengine/test_scanengine.cpp
+    core/test_scheduler/test_scheduler.cpp
+    core/test_slowcontrolarchiver/test_slowcontrolarchiver.cpp
+    core/test_slowcontrolpoller/test_slowcontrolpoller.cpp
     core/test_templatedevice/test_templatedevice.cpp
     core/test_templatedevice/exampledevice.h
     core/test_templatedevice/testdriver.cpp
     core/test_templatedevice/testdriver.h
     core/test_templatedevicemacros/test_templatedevicemacros.cpp
+    core/test_timing/test_timing.cpp
+    core/test_tracer/test_tracer.cpp
     components/HL/test_gpio/test_gpio.cpp
+    components/HL/test_gpio/gpiofakeinterface.cpp
+    components/HL/test_gpio/gpiofakeinterface.h
     components/HL/test_registerdriver/test_registerdriver.cpp
     components/HL/test_registerdriver/fakeinterface.cpp
     components/HL/test_registerdriver/fakeinterface.h
@@ -157,8 +275,68 @@ set(TESTS_FILE_NAMES
     components/RL/test_standardregister/test_standardregister.cpp
     components/RL/test_standardregister/testreadbackdriver.cpp
     components/RL/test_standardregister/testreadbackdriver.h
+    components/RL/test_valueregister/test_valueregister.cpp
+    components/TL/test_mmio/test_mmio.cpp
+    components/TL/test_replaymuxedinterface/test_replaymuxedinterface.cpp
+    components/TL/test_simmuxed/test_simmuxed.cpp
+    components/TL/test_sitcp/test_sitcp.cpp
     components/TL/test_tcp/test_tcp.cpp
     components/TL/test_udp/test_udp.cpp
+    components/TL/test_udpring/test_udpring.cpp
+)
+
+set(BENCHMARKS_FILE_NAMES
+    benchmarkreport.cpp
+    benchmarkreport.h
+    benchmarks.cpp
+    mocksitcpserver.cpp
+    mocksitcpserver.h
+)
+
+set(MICROBENCHMARKS_FILE_NAMES
+    benchmarkreport.cpp
+    benchmarkreport.h
+    benchregdriver.cpp
+    benchregdriver.h
+    memoryinterface.cpp
+    memoryinterface.h
+    microbenchmarks.cpp
+)
+
+set(STARTUPBENCHMARKS_FILE_NAMES
+    benchmarkreport.cpp
+    benchmarkreport.h
+    startupbenchmarks.cpp
+)
+
+set(SOCKETBENCHMARKS_FILE_NAMES
+    benchmarkreport.cpp
+    benchmarkreport.h
+    mockechoserver.cpp
+    mockechoserver.h
+    socketbenchmarks.cpp
+)
+
+set(RBCPSTRESSBENCHMARKS_FILE_NAMES
+    benchmarkreport.cpp
+    benchmarkreport.h
+    mocksitcpserver.cpp
+    mocksitcpserver.h
+    rbcpstressbenchmarks.cpp
+    udpimpairmentproxy.cpp
+    udpimpairmentproxy.h
+)
+
+set(BENCHCOMPARE_FILE_NAMES
+    benchcompare.cpp
+)
+
+set(COSIM_TESTS_FILE_NAMES
+    cosimfixture.h
+    simfirmware.cpp
+    simfirmware.h
+    test_fifo.cpp
+    test_gpio.cpp
 )
 
 set(SCPI_DEVICE_DESCRIPTION_FILE_NAMES
@@ -34,12 +34,16 @@ CASIL_REGISTER_DRIVER_CPP(DummyDriver)
 /*!
  * \brief Constructor.
  *
+ * Gets the optional "silent" value from \p pConfig (boolean value, default: false),
+ * which disables the debug logging of all function calls.
+ *
  * \param pName Component instance name.
  * \param pInterface %Interface instance to be used.
  * \param pConfig Component configuration.
  */
 DummyDriver::DummyDriver(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig) :
-    DirectDriver(typeName, std::move(pName), pInterface, std::move(pConfig), LayerConfig())
+    DirectDriver(typeName, std::move(pName), pInterface, std::move(pConfig), LayerConfig()),
+    silent(config.getBool("silent", false))
 {
 }
 
@@ -48,25 +52,27 @@ DummyDriver::DummyDriver(std::string pName, InterfaceBaseType& pInterface, Layer
 /*!
  * \copybrief DirectDriver::initImpl()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyDriver()).
  *
  * \return True.
  */
 bool DummyDriver::initImpl()
 {
-    logger.logDebug("initImpl() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "initImpl() was called.");
     return true;
 }
 
 /*!
  * \copybrief DirectDriver::closeImpl()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyDriver()).
  *
  * \return True.
  */
 bool DummyDriver::closeImpl()
 {
-    logger.logDebug("closeImpl() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "closeImpl() was called.");
     return true;
 }
@@ -50,6 +50,9 @@ private:
     bool initImpl() override;
     bool closeImpl() override;
 
+private:
+    const bool silent;                          ///< Suppress the debug logging of function calls.
+
     CASIL_REGISTER_DRIVER_H("DummyDriver")
 };
 
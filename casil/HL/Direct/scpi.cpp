@@ -64,13 +64,22 @@
 #include <casil/env.h>
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <charconv>
+#include <exception>
 #include <filesystem>
-#include <format>
 #include <fstream>
 #include <ios>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <span>
 #include <stdexcept>
+#include <system_error>
+#include <utility>
 
 using casil::Layers::HL::SCPI;
 
@@ -87,8 +96,17 @@ CASIL_REGISTER_DRIVER_ALIAS("scpi")
  * converting that "init.device" string to lowercase, replacing spaces by underscores and appending the ".yaml" suffix.
  * Search paths for those directories are taken from the \c CASIL_DEV_DESC_DIRS environment variable (see Env::getEnv()).
  * The device description will be loaded from the first of these directories that contains such file.
+ * The parsed device description is shared with other instances using the same (unmodified) file, see getDeviceDescription().
+ *
+ * Whether batch() may join commands into a single compound message is taken from the optional "init.compound_commands"
+ * value in \p pConfig (boolean type) and defaults to the optional "compound_commands" flag of the device description
+ * (default: false), see also parseCompoundCommands().
+ *
+ * The capacity of the value buffer of the streaming acquisition (see startStreaming()) is taken from the optional
+ * "init.stream_buffer_size" value in \p pConfig (unsigned integer type, default: 65536).
  *
  * \throws std::runtime_error If "init.device" is not defined.
+ * \throws std::runtime_error If "init.stream_buffer_size" is zero.
  * \throws std::runtime_error If the device description file can not be found or reading the file fails.
  * \throws std::runtime_error If parsing of the device description.
  *
@@ -100,11 +118,41 @@ SCPI::SCPI(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig
     DirectDriver(typeName, std::move(pName), pInterface, std::move(pConfig), LayerConfig::fromYAML(
                      "{init: {device: string}}")
                  ),
-    deviceDescription(Auxil::propertyTreeFromYAML(loadDeviceDescription(config.getStr("init.device")))),
-    writeCommands(parseWriteCommands(deviceDescription)),
-    queryCommands(parseQueryCommands(deviceDescription)),
-    deviceIdentifier(parseDeviceIdentifier(deviceDescription))
+    deviceDescription(getDeviceDescription(config.getStr("init.device"))),
+    compoundCommands(config.getBool("init.compound_commands", deviceDescription->compoundCommands)),
+    writeBuffer(),
+    writeBufferMutex(),
+    streamBufferCapacity(config.getUInt("init.stream_buffer_size", defaultStreamBufferCapacity)),
+    streamBuffer(),
+    streamBufferBegin(0),
+    streamBufferCount(0),
+    streamStatistics{.records = 0, .values = 0, .droppedValues = 0, .parseErrors = 0},
+    streamBufferMutex(),
+    streamCondVar(),
+    streamChannel(std::nullopt),
+    streamStateMutex()
 {
+    if (streamBufferCapacity == 0)
+        throw std::runtime_error("Invalid stream buffer size set for " + getSelfDescription() + ".");
+
+    writeBuffer.reserve(deviceDescription->maxWriteCommandLength + 1 + valueSlotSize);
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops a potentially active streaming acquisition (see stopStreaming()).
+ */
+SCPI::~SCPI()
+{
+    try
+    {
+        stopStreaming();
+    }
+    catch (const std::exception& exc)
+    {
+        logger.logError(std::string("Could not stop streaming acquisition: ") + exc.what());
+    }
 }
 
 //Public
@@ -119,6 +167,41 @@ std::optional<std::string> SCPI::operator()(const std::string_view pCmd, const s
     return command(pCmd, pChannel, std::move(pValue));
 }
 
+/*!
+ * \brief Execute a command (either write or query).
+ *
+ * \copydetails command(const CommandHandle&, VariantValueType) const
+ */
+std::optional<std::string> SCPI::operator()(const CommandHandle& pHandle, VariantValueType pValue) const
+{
+    return command(pHandle, std::move(pValue));
+}
+
+//
+
+/*!
+ * \brief Get a handle for a command.
+ *
+ * Looks up the (write or query) command with name \p pCmd for channel \p pChannel once and returns a handle to it,
+ * which can be passed to writeCommand(), queryCommand() or command() instead of the command name. Executing a command
+ * via its handle needs no command name lookup, such that the dispatch cost is constant (e.g. for fast voltage ramps).
+ *
+ * The handle refers to the (shared) device description of this instance and must not be used after this instance has been destroyed.
+ *
+ * \throws std::invalid_argument If \p pCmd is not available for the configured device and channel \p pChannel.
+ * \throws std::invalid_argument If \p pChannel is not available for the configured device.
+ *
+ * \param pCmd The command name.
+ * \param pChannel %Device's channel number, if applicable (no value or -1 for no channel).
+ * \return Handle for the command.
+ */
+SCPI::CommandHandle SCPI::handle(const std::string_view pCmd, const std::optional<int> pChannel) const
+{
+    const int channel = (pChannel.has_value() ? *pChannel : -1);
+
+    return findCommand(pCmd, channel, isQueryCommand(pCmd, channel));
+}
+
 //
 
 /*!
@@ -129,6 +212,9 @@ std::optional<std::string> SCPI::operator()(const std::string_view pCmd, const s
  * appended to the basic command (separated by a space) before writing the full command at once.
  * A command name is considered a setter if \p pCmd starts with "set_".
  *
+ * The full command is assembled in a buffer that is reused for all calls and has a capacity reserved for the
+ * longest write command plus a numeric value (see appendValue()), such that no heap allocation is needed here.
+ *
  * Warns if \p pCmd is not a setter (i.e. a command without argument) but \p pValue is set (\p pValue will be discarded).
  *
  * Note: The conversion between string and byte sequence (for TL::DirectInterface)
@@ -146,34 +232,14 @@ void SCPI::writeCommand(const std::string_view pCmd, const std::optional<int> pC
 {
     const int channel = (pChannel.has_value() ? *pChannel : -1);
 
-    if (std::holds_alternative<std::monostate>(pValue))
-    {
-        if (isSetter(pCmd))
-        {
-            throw std::invalid_argument("The SCPI command \"" + std::string(pCmd) + "\" is a setter and needs a value argument "
-                                        "(driver: \"" + name + "\").");
-        }
-
-        interface.write(getWriteCommand(pCmd, channel));
-    }
-    else
-    {
-        if (!isSetter(pCmd))
-            logger.logWarning("Dropping value argument because \"" + std::string(pCmd) + "\" is not a setter.");
+    const std::lock_guard<std::mutex> bufferLock(writeBufferMutex);
+    (void)bufferLock;
 
-        std::vector<std::uint8_t> cmd = getWriteCommand(pCmd, channel);
+    writeBuffer.clear();
 
-        std::vector<std::uint8_t> cmdSuffix;
+    appendWriteCommand(writeBuffer, findCommand(pCmd, channel, false), pValue);
 
-        if (std::holds_alternative<std::string>(pValue))
-            cmdSuffix = Bytes::byteVecFromStr(" " + std::move(std::get<std::string>(pValue)));
-        else
-            cmdSuffix = Bytes::byteVecFromStr(" " + getValueStr(std::move(pValue)));
-
-        cmd.insert(cmd.end(), cmdSuffix.begin(), cmdSuffix.end());
-
-        interface.write(cmd);
-    }
+    interface.write(writeBuffer);
 }
 
 /*!
@@ -198,6 +264,90 @@ std::string SCPI::queryCommand(const std::string_view pCmd, const std::optional<
     return Bytes::strFromByteVec(interface.query(getQueryCommand(pCmd, channel)));
 }
 
+/*!
+ * \brief Execute multiple query commands at once.
+ *
+ * Queries the interface using the commands with names \p pCmds for channel \p pChannel and returns the received results
+ * in the same order. All queries are sent at once before reading the responses (see TL::DirectInterface::queryMany()),
+ * such that the round trip time to the device has to be waited for only once (e.g. to obtain a full status snapshot).
+ *
+ * Note: The conversion between string and byte sequence (for TL::DirectInterface)
+ * is done via Bytes::byteVecFromStr() / Bytes::strFromByteVec(), respectively.
+ *
+ * \throws std::invalid_argument If one of \p pCmds is not available for the configured device and channel \p pChannel.
+ * \throws std::invalid_argument If \p pChannel is not available for the configured device.
+ *
+ * \param pCmds The command names.
+ * \param pChannel %Device's channel number, if applicable (no value or -1 for no channel).
+ * \return %Device's query responses.
+ */
+std::vector<std::string> SCPI::queryCommandSequence(const std::vector<std::string>& pCmds, const std::optional<int> pChannel) const
+{
+    const int channel = (pChannel.has_value() ? *pChannel : -1);
+
+    std::vector<std::vector<std::uint8_t>> queries;
+    queries.reserve(pCmds.size());
+
+    for (const std::string& cmd : pCmds)
+        queries.push_back(getQueryCommand(cmd, channel));
+
+    const std::vector<std::vector<std::uint8_t>> responses = interface.queryMany(queries);
+
+    std::vector<std::string> retVal;
+    retVal.reserve(responses.size());
+
+    for (const std::vector<std::uint8_t>& response : responses)
+        retVal.push_back(Bytes::strFromByteVec(response));
+
+    return retVal;
+}
+
+/*!
+ * \brief Execute a query command with binary block response.
+ *
+ * Queries the interface using the command with name \p pCmd for channel \p pChannel and returns the data of the
+ * received IEEE 488.2 definite-length binary block (<tt>\#\<n\>\<length\>\<data\></tt>, see TL::DirectInterface::readBlock()).
+ * In contrast to queryCommand() the response may contain arbitrary bytes, which allows binary waveform transfers.
+ *
+ * \throws std::invalid_argument If \p pCmd is not available for the configured device and channel \p pChannel.
+ * \throws std::invalid_argument If \p pChannel is not available for the configured device.
+ * \throws std::runtime_error If the query or reading the block fails (see TL::DirectInterface::queryBlock()).
+ *
+ * \param pCmd The command name.
+ * \param pChannel %Device's channel number, if applicable (no value or -1 for no channel).
+ * \return Block data of the device's query response.
+ */
+std::vector<std::uint8_t> SCPI::queryBinary(const std::string_view pCmd, const std::optional<int> pChannel) const
+{
+    const int channel = (pChannel.has_value() ? *pChannel : -1);
+
+    return interface.queryBlock(getQueryCommand(pCmd, channel));
+}
+
+/*!
+ * \brief Execute a query command with binary block response into a buffer.
+ *
+ * Like queryBinary() but reads the block data directly into \p pBuffer, such that repeated transfers
+ * with a reused buffer do not need any memory allocations (see TL::DirectInterface::queryBlockInto()).
+ * See also queryBinaryAs() for reading typed values.
+ *
+ * \throws std::invalid_argument If \p pCmd is not available for the configured device and channel \p pChannel.
+ * \throws std::invalid_argument If \p pChannel is not available for the configured device.
+ * \throws std::runtime_error If the query or reading the block fails (see TL::DirectInterface::queryBlockInto()).
+ * \throws std::runtime_error If the block data does not fit into \p pBuffer.
+ *
+ * \param pBuffer Buffer for the block data.
+ * \param pCmd The command name.
+ * \param pChannel %Device's channel number, if applicable (no value or -1 for no channel).
+ * \return Number of block data bytes written to \p pBuffer.
+ */
+std::size_t SCPI::queryBinaryInto(const std::span<std::uint8_t> pBuffer, const std::string_view pCmd, const std::optional<int> pChannel) const
+{
+    const int channel = (pChannel.has_value() ? *pChannel : -1);
+
+    return interface.queryBlockInto(getQueryCommand(pCmd, channel), pBuffer);
+}
+
 /*!
  * \brief Execute a command (either write or query).
  *
@@ -230,6 +380,377 @@ std::optional<std::string> SCPI::command(const std::string_view pCmd, const std:
     }
 }
 
+/*!
+ * \brief Execute a write command.
+ *
+ * Same as writeCommand(std::string_view, std::optional<int>, VariantValueType) const
+ * but for a command obtained via handle(), i.e. without command name lookup.
+ *
+ * \throws std::invalid_argument If \p pHandle does not belong to the device description of this instance.
+ * \throws std::invalid_argument If \p pHandle refers to a query command.
+ * \throws std::invalid_argument If \p pHandle refers to a setter but \p pValue is not set.
+ *
+ * \param pHandle Handle of the command.
+ * \param pValue The value argument for the command.
+ */
+void SCPI::writeCommand(const CommandHandle& pHandle, VariantValueType pValue) const
+{
+    checkHandle(pHandle, false);
+
+    const std::lock_guard<std::mutex> bufferLock(writeBufferMutex);
+    (void)bufferLock;
+
+    writeBuffer.clear();
+
+    appendWriteCommand(writeBuffer, pHandle, pValue);
+
+    interface.write(writeBuffer);
+}
+
+/*!
+ * \brief Execute a query command.
+ *
+ * Same as queryCommand(std::string_view, std::optional<int>) const
+ * but for a command obtained via handle(), i.e. without command name lookup.
+ *
+ * \throws std::invalid_argument If \p pHandle does not belong to the device description of this instance.
+ * \throws std::invalid_argument If \p pHandle refers to a write command.
+ *
+ * \param pHandle Handle of the command.
+ * \return %Device's query response.
+ */
+std::string SCPI::queryCommand(const CommandHandle& pHandle) const
+{
+    checkHandle(pHandle, true);
+
+    return Bytes::strFromByteVec(interface.query(*pHandle.command));
+}
+
+/*!
+ * \brief Execute a command (either write or query).
+ *
+ * Calls queryCommand(const CommandHandle&) const if \p pHandle refers to a query command and
+ * writeCommand(const CommandHandle&, VariantValueType) const if it refers to a write command (see there).
+ *
+ * Warns if \p pHandle refers to a query command but \p pValue is set (\p pValue will be discarded).
+ *
+ * \throws std::invalid_argument If queryCommand() or writeCommand() throw \c std::invalid_argument.
+ *
+ * \param pHandle Handle of the command.
+ * \param pValue The value argument for a write command.
+ * \return Return value of queryCommand() for query commands and no value for write commands.
+ */
+std::optional<std::string> SCPI::command(const CommandHandle& pHandle, VariantValueType pValue) const
+{
+    if (pHandle.query)
+    {
+        if (!std::holds_alternative<std::monostate>(pValue))
+            logger.logWarning("Dropping value argument because \"" + std::string(pHandle.name) + "\" is a query command.");
+
+        return queryCommand(pHandle);
+    }
+    else
+    {
+        writeCommand(pHandle, std::move(pValue));
+        return std::nullopt;
+    }
+}
+
+/*!
+ * \brief Execute multiple commands (write and/or query) with a single round trip.
+ *
+ * Executes the commands \p pCmds in the given order and returns one result per command: No value
+ * (\c std::monostate) for write commands and the query response converted via parseResponse() for query commands.
+ * Every command is treated as in command(), i.e. \c BatchCommand::value is used for setters (see writeCommand())
+ * and dropped for query commands. All commands are validated before anything is sent to the device.
+ *
+ * If compound commands are enabled (see SCPI()), all commands are joined with ';' into a single message. If the batch
+ * contains query commands, this message is sent as a single query and the response is split at ';' into the individual
+ * query responses. Otherwise (strict one command per message) the commands are pipelined instead: Write commands are sent
+ * directly and each run of subsequent query commands is sent at once before reading the responses (see TL::DirectInterface::queryMany()).
+ *
+ * \throws std::invalid_argument If one of \p pCmds is not available for the configured device and its channel.
+ * \throws std::invalid_argument If a channel is not available for the configured device.
+ * \throws std::invalid_argument If one of \p pCmds is a setter but has no value set.
+ * \throws std::runtime_error If the number of responses to a compound message does not match the number of query commands.
+ *
+ * \param pCmds The commands to be executed.
+ * \return Typed results for all commands in the same order as \p pCmds.
+ */
+std::vector<SCPI::VariantValueType> SCPI::batch(const std::vector<BatchCommand>& pCmds) const
+{
+    std::vector<VariantValueType> retVal(pCmds.size());
+
+    if (pCmds.empty())
+        return retVal;
+
+    std::vector<std::vector<std::uint8_t>> messages;
+    messages.reserve(pCmds.size());
+
+    std::vector<bool> isQuery;
+    isQuery.reserve(pCmds.size());
+
+    for (const BatchCommand& batchCmd : pCmds)
+    {
+        const int channel = (batchCmd.channel.has_value() ? *batchCmd.channel : -1);
+
+        if (isQueryCommand(batchCmd.cmd, channel))
+        {
+            if (!std::holds_alternative<std::monostate>(batchCmd.value))
+                logger.logWarning("Dropping value argument because \"" + batchCmd.cmd + "\" is a query command.");
+
+            messages.push_back(getQueryCommand(batchCmd.cmd, channel));
+            isQuery.push_back(true);
+        }
+        else
+        {
+            messages.emplace_back();
+            appendWriteCommand(messages.back(), findCommand(batchCmd.cmd, channel, false), batchCmd.value);
+            isQuery.push_back(false);
+        }
+    }
+
+    const std::size_t numQueries = std::count(isQuery.begin(), isQuery.end(), true);
+
+    std::vector<std::string> responses;
+    responses.reserve(numQueries);
+
+    if (compoundCommands)
+    {
+        std::vector<std::uint8_t> compoundMessage;
+
+        for (const std::vector<std::uint8_t>& message : messages)
+        {
+            if (!compoundMessage.empty())
+                compoundMessage.push_back(';');
+
+            compoundMessage.insert(compoundMessage.end(), message.begin(), message.end());
+        }
+
+        if (numQueries == 0)
+        {
+            interface.write(compoundMessage);
+            return retVal;
+        }
+
+        const std::string response = Bytes::strFromByteVec(interface.query(compoundMessage));
+
+        std::size_t start = 0;
+
+        for (std::size_t pos = response.find(';'); pos != std::string::npos; pos = response.find(';', start))
+        {
+            responses.push_back(response.substr(start, pos - start));
+            start = pos + 1;
+        }
+
+        responses.push_back(response.substr(start));
+
+        if (responses.size() != numQueries)
+        {
+            throw std::runtime_error("Number of responses to compound SCPI command (" + std::to_string(responses.size()) +
+                                     ") does not match number of queries (" + std::to_string(numQueries) + ") (driver: \"" + name + "\").");
+        }
+    }
+    else
+    {
+        std::size_t i = 0;
+
+        while (i < messages.size())
+        {
+            for (; i < messages.size() && !isQuery[i]; ++i)
+                interface.write(messages[i]);
+
+            const std::size_t firstQuery = i;
+
+            while (i < messages.size() && isQuery[i])
+                ++i;
+
+            if (i == firstQuery)
+                continue;
+
+            for (const std::vector<std::uint8_t>& response :
+                 interface.queryMany(std::span<const std::vector<std::uint8_t>>(messages.data() + firstQuery, i - firstQuery)))
+            {
+                responses.push_back(Bytes::strFromByteVec(response));
+            }
+        }
+    }
+
+    auto responseIt = responses.begin();
+
+    for (std::size_t i = 0; i < pCmds.size(); ++i)
+    {
+        if (isQuery[i])
+            retVal[i] = parseResponse(*responseIt++);
+    }
+
+    return retVal;
+}
+
+//
+
+/*!
+ * \brief Start a continuous streaming acquisition.
+ *
+ * Instead of polling readings via queryCommand(), the instrument continuously sends terminated records of readings
+ * (e.g. a DMM in continuous trigger mode), which are received in the background by the interface (see
+ * TL::DirectInterface::startRecordStream()) and parsed into a bounded ring buffer, from which they can be taken
+ * in batches via readStream(). Every record may contain multiple comma-separated readings (see parseReading()).
+ * If the buffer is full, the oldest values are overwritten (and counted, see getStreamStatistics()).
+ *
+ * Clears the buffer and resets the counters. After the interface started receiving records, the instrument is configured
+ * by executing the write command "start_stream" for channel \p pChannel (or without channel, if only defined without)
+ * if the device description defines such command (e.g. "start_stream: TRIG:COUN INF;:INIT").
+ *
+ * Note: Do not execute query commands while the streaming acquisition is active.
+ *
+ * \throws std::runtime_error If the streaming acquisition is already active.
+ * \throws std::runtime_error If the interface does not support record streaming (see TL::DirectInterface::supportsRecordStreaming()).
+ * \throws std::runtime_error If starting the record stream or executing the "start_stream" command fails.
+ * \throws std::invalid_argument If \p pChannel is not available for the configured device.
+ *
+ * \param pChannel %Device's channel number, if applicable (no value or -1 for no channel).
+ */
+void SCPI::startStreaming(const std::optional<int> pChannel)
+{
+    const int channel = (pChannel.has_value() ? *pChannel : -1);
+
+    const std::lock_guard<std::mutex> stateLock(streamStateMutex);
+    (void)stateLock;
+
+    if (streamChannel.has_value())
+        throw std::runtime_error("Streaming acquisition of SCPI driver \"" + name + "\" is already active.");
+
+    if (!interface.supportsRecordStreaming())
+        throw std::runtime_error("Cannot start streaming acquisition of SCPI driver \"" + name + "\": Interface does not support record streaming.");
+
+    (void)getWriteCommandMap(channel);  //Check the channel before starting anything
+
+    {
+        const std::lock_guard<std::mutex> bufferLock(streamBufferMutex);
+        (void)bufferLock;
+
+        streamBuffer.assign(streamBufferCapacity, 0.0);
+        streamBufferBegin = 0;
+        streamBufferCount = 0;
+        streamStatistics = {.records = 0, .values = 0, .droppedValues = 0, .parseErrors = 0};
+    }
+
+    interface.startRecordStream([this](const std::span<const std::uint8_t> pRecord){ handleStreamRecord(pRecord); });
+
+    try
+    {
+        writeStreamCommand("start_stream", channel);
+    }
+    catch (const std::exception&)
+    {
+        interface.stopRecordStream();
+        throw;
+    }
+
+    streamChannel = channel;
+}
+
+/*!
+ * \brief Stop the streaming acquisition.
+ *
+ * Executes the write command "stop_stream" (see startStreaming()) if the device description defines such command
+ * and stops receiving records. Values that are still buffered can be taken via readStream() afterwards.
+ * Does nothing if the streaming acquisition is not active.
+ *
+ * \throws std::runtime_error If executing the "stop_stream" command or stopping the record stream fails.
+ */
+void SCPI::stopStreaming()
+{
+    const std::lock_guard<std::mutex> stateLock(streamStateMutex);
+    (void)stateLock;
+
+    if (!streamChannel.has_value())
+        return;
+
+    const int channel = *streamChannel;
+
+    streamChannel.reset();
+
+    try
+    {
+        writeStreamCommand("stop_stream", channel);
+    }
+    catch (const std::exception&)
+    {
+        interface.stopRecordStream();
+        throw;
+    }
+
+    interface.stopRecordStream();
+}
+
+/*!
+ * \brief Check if the streaming acquisition is active.
+ *
+ * \return True if started via startStreaming() and not stopped yet.
+ */
+bool SCPI::isStreaming() const
+{
+    const std::lock_guard<std::mutex> stateLock(streamStateMutex);
+    (void)stateLock;
+
+    return streamChannel.has_value();
+}
+
+/*!
+ * \brief Take buffered values from the streaming acquisition.
+ *
+ * Removes up to \p pMaxValues (all if zero) of the oldest values from the stream buffer and returns them in order
+ * of arrival (see startStreaming()). If the buffer is empty, waits up to \p pTimeout for new values to arrive.
+ *
+ * \param pMaxValues Maximum number of values to take (zero for all available).
+ * \param pTimeout Maximum time to wait for values if none are available (zero for no waiting).
+ * \return Taken values (empty if none arrived within \p pTimeout).
+ */
+std::vector<double> SCPI::readStream(const std::size_t pMaxValues, const std::chrono::milliseconds pTimeout)
+{
+    std::unique_lock<std::mutex> bufferLock(streamBufferMutex);
+
+    if (streamBufferCount == 0 && pTimeout > std::chrono::milliseconds::zero())
+        streamCondVar.wait_for(bufferLock, pTimeout, [this](){ return streamBufferCount > 0; });
+
+    const std::size_t numValues = (pMaxValues == 0 ? streamBufferCount : std::min(pMaxValues, streamBufferCount));
+
+    std::vector<double> values;
+    values.reserve(numValues);
+
+    //Copy in (up to) two contiguous parts, since the values can wrap around the end of the ring buffer
+
+    const std::size_t firstPartSize = std::min(numValues, streamBuffer.size() - streamBufferBegin);
+
+    values.insert(values.end(), streamBuffer.begin() + streamBufferBegin, streamBuffer.begin() + streamBufferBegin + firstPartSize);
+    values.insert(values.end(), streamBuffer.begin(), streamBuffer.begin() + (numValues - firstPartSize));
+
+    if (numValues > 0)
+    {
+        streamBufferBegin = (streamBufferBegin + numValues) % streamBuffer.size();
+        streamBufferCount -= numValues;
+    }
+
+    return values;
+}
+
+/*!
+ * \brief Get the counters of the streaming acquisition.
+ *
+ * The counters are reset by startStreaming().
+ *
+ * \return Snapshot of the counters.
+ */
+SCPI::StreamStatistics SCPI::getStreamStatistics() const
+{
+    const std::lock_guard<std::mutex> bufferLock(streamBufferMutex);
+    (void)bufferLock;
+
+    return streamStatistics;
+}
+
 //Private
 
 /*!
@@ -255,30 +776,90 @@ bool SCPI::initImpl()
     }
     catch (const std::invalid_argument&)
     {
-        throw std::runtime_error("Could not initialize SCPI driver \"" + name + "\": " +
-                                 "No \"get_name\" query command. THIS SHOULD NEVER HAPPEN!");
+        throw std::runtime_error("Could not initialize SCPI driver \"" + name + "\": " +
+                                 "No \"get_name\" query command. THIS SHOULD NEVER HAPPEN!");
+    }
+
+    if (ident != deviceDescription->identifier)
+    {
+        logger.logError("Wrong SCPI device description configured (expected identifier: \"" + deviceDescription->identifier +
+                        "\"; actual identifier: \"" + ident + "\").");
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \copybrief DirectDriver::closeImpl()
+ *
+ * Stops a potentially active streaming acquisition (see stopStreaming()).
+ *
+ * \return True if successful.
+ */
+bool SCPI::closeImpl()
+{
+    try
+    {
+        stopStreaming();
     }
-
-    if (ident != deviceIdentifier)
+    catch (const std::exception& exc)
     {
-        logger.logError("Wrong SCPI device description configured (expected identifier: \"" + deviceIdentifier +
-                        "\"; actual identifier: \"" + ident + "\").");
+        logger.logError(std::string("Could not stop streaming acquisition: ") + exc.what());
         return false;
     }
 
     return true;
 }
 
+//
+
 /*!
- * \copybrief DirectDriver::closeImpl()
+ * \brief Estimate the component-specific heap memory usage.
  *
- * Does nothing.
+ * Reports the following categories (see also LayerBase::getMemoryUsage()):
+ * - "device_description": Parsed device description including the command tables (shared by instances of the same device type).
+ * - "write_buffer": Reusable buffer for setter commands.
+ * - "stream_buffer": Ring buffer of the streaming acquisition.
  *
- * \return True.
+ * \return Estimated numbers of allocated bytes by category.
  */
-bool SCPI::closeImpl()
+std::map<std::string, std::size_t> SCPI::getMemoryUsageImpl() const
 {
-    return true;
+    std::size_t descriptionBytes = sizeof(DeviceDescription) + Auxil::heapNodeOverhead + Auxil::estimateHeapUsage(deviceDescription->tree) +
+                                   Auxil::estimateHeapUsage(deviceDescription->identifier);
+
+    for (const std::map<int, CommandMapType>* const commands : {&deviceDescription->writeCommands, &deviceDescription->queryCommands})
+    {
+        for (const auto& [channel, commandMap] : *commands)
+        {
+            descriptionBytes += sizeof(std::pair<const int, CommandMapType>) + Auxil::heapNodeOverhead;
+
+            for (const auto& [commandName, command] : commandMap)
+                descriptionBytes += sizeof(CommandMapType::value_type) + Auxil::heapNodeOverhead + Auxil::estimateHeapUsage(commandName) +
+                                    command.capacity();
+        }
+    }
+
+    std::size_t writeBufferBytes = 0;
+
+    {
+        const std::lock_guard<std::mutex> writeBufferLock(writeBufferMutex);
+        (void)writeBufferLock;
+
+        writeBufferBytes = writeBuffer.capacity();
+    }
+
+    std::size_t streamBufferBytes = 0;
+
+    {
+        const std::lock_guard<std::mutex> streamBufferLock(streamBufferMutex);
+        (void)streamBufferLock;
+
+        streamBufferBytes = streamBuffer.capacity() * sizeof(double);
+    }
+
+    return {{"device_description", descriptionBytes}, {"write_buffer", writeBufferBytes}, {"stream_buffer", streamBufferBytes}};
 }
 
 //
@@ -349,6 +930,165 @@ const std::vector<std::uint8_t>& SCPI::getQueryCommand(const std::string_view pC
     return it->second;
 }
 
+/*!
+ * \brief Look up a write or query command.
+ *
+ * Returns a handle for the write (\p pQuery false) or query (\p pQuery true) command with name \p pCmd and channel number \p pChannel.
+ *
+ * \throws std::invalid_argument If \p pCmd is not available (as write/query command) for the configured device and channel \p pChannel.
+ * \throws std::invalid_argument If \p pChannel is not available for the configured device.
+ *
+ * \param pCmd The command name.
+ * \param pChannel The channel number (-1 for no channel).
+ * \param pQuery Look up a query command instead of a write command.
+ * \return Handle for the command.
+ */
+SCPI::CommandHandle SCPI::findCommand(const std::string_view pCmd, const int pChannel, const bool pQuery) const
+{
+    const CommandMapType& cmds = (pQuery ? getQueryCommandMap(pChannel) : getWriteCommandMap(pChannel));
+
+    const auto it = cmds.find(pCmd);
+
+    if (it == cmds.end())
+        throw std::invalid_argument("The command \"" + std::string(pCmd) + "\" is not available for SCPI driver \"" + name + "\".");
+
+    return CommandHandle(*deviceDescription, it->first, pChannel, it->second, pQuery);
+}
+
+/*!
+ * \brief Check if a handle can be used.
+ *
+ * \throws std::invalid_argument If \p pHandle does not belong to the device description of this instance.
+ * \throws std::invalid_argument If \p pHandle does not refer to a query command (\p pQuery true) or write command (\p pQuery false).
+ *
+ * \param pHandle Handle of the command.
+ * \param pQuery Require a query command instead of a write command.
+ */
+void SCPI::checkHandle(const CommandHandle& pHandle, const bool pQuery) const
+{
+    if (pHandle.owner != deviceDescription.get())
+    {
+        throw std::invalid_argument("The handle of command \"" + std::string(pHandle.name) + "\" does not belong to SCPI driver \"" +
+                                    name + "\".");
+    }
+
+    if (pHandle.query != pQuery)
+    {
+        throw std::invalid_argument("The command \"" + std::string(pHandle.name) + "\" is not available as " +
+                                    (pQuery ? "query" : "write") + " command for SCPI driver \"" + name + "\".");
+    }
+}
+
+/*!
+ * \brief Append a full write command (including value) to a buffer.
+ *
+ * Appends the write command referred to by \p pHandle to \p pBuffer. If the command is a \e setter,
+ * the value \p pValue is appended as well (separated by a space, see appendValue()).
+ *
+ * Warns if the command is not a setter (i.e. a command without argument) but \p pValue is set. The value is then
+ * nevertheless appended (it will be discarded by the device).
+ *
+ * \throws std::invalid_argument If the command is a setter but \p pValue is not set.
+ *
+ * \param pBuffer Buffer to append the command to.
+ * \param pHandle Handle of the (write) command.
+ * \param pValue The value argument for the command.
+ */
+void SCPI::appendWriteCommand(std::vector<std::uint8_t>& pBuffer, const CommandHandle& pHandle, const VariantValueType& pValue) const
+{
+    pBuffer.insert(pBuffer.end(), pHandle.command->begin(), pHandle.command->end());
+
+    if (std::holds_alternative<std::monostate>(pValue))
+    {
+        if (pHandle.setter)
+        {
+            throw std::invalid_argument("The SCPI command \"" + std::string(pHandle.name) + "\" is a setter and needs a value argument "
+                                        "(driver: \"" + name + "\").");
+        }
+    }
+    else
+    {
+        if (!pHandle.setter)
+            logger.logWarning("Dropping value argument because \"" + std::string(pHandle.name) + "\" is not a setter.");
+
+        pBuffer.push_back(' ');
+
+        appendValue(pBuffer, pValue);
+    }
+}
+
+/*!
+ * \brief Execute a stream control command if the device defines it.
+ *
+ * Executes the write command \p pCmd (see writeCommand()) for channel \p pChannel if available for that channel or,
+ * as fallback, without channel if available without channel. Does nothing if \p pCmd is not defined at all.
+ *
+ * \throws std::runtime_error If writing the command to the interface fails.
+ *
+ * \param pCmd The command name.
+ * \param pChannel The channel number (-1 for no channel).
+ */
+void SCPI::writeStreamCommand(const std::string_view pCmd, const int pChannel) const
+{
+    if (getWriteCommandMap(pChannel).contains(pCmd))
+        writeCommand(pCmd, pChannel);
+    else if (pChannel != -1 && getWriteCommandMap(-1).contains(pCmd))
+        writeCommand(pCmd, -1);
+}
+
+/*!
+ * \brief Parse a streamed record into the stream buffer.
+ *
+ * Splits \p pRecord at commas and appends every field that can be parsed as number (see parseReading()) to the
+ * stream buffer, overwriting the oldest value if the buffer is full. Wakes a reader waiting in readStream().
+ * Fields that cannot be parsed are skipped and counted (see StreamStatistics::parseErrors).
+ *
+ * Note: Called from the background thread of the interface (see startStreaming()).
+ *
+ * \param pRecord Received record (excluding the termination).
+ */
+void SCPI::handleStreamRecord(const std::span<const std::uint8_t> pRecord)
+{
+    const std::string_view record(reinterpret_cast<const char*>(pRecord.data()), pRecord.size());
+
+    {
+        const std::lock_guard<std::mutex> bufferLock(streamBufferMutex);
+        (void)bufferLock;
+
+        ++streamStatistics.records;
+
+        std::size_t fieldBegin = 0;
+
+        for (;;)
+        {
+            const std::size_t fieldEnd = std::min(record.find(',', fieldBegin), record.size());
+
+            if (const std::optional<double> value = parseReading(record.substr(fieldBegin, fieldEnd - fieldBegin)); value.has_value())
+            {
+                if (streamBufferCount == streamBuffer.size())
+                {
+                    streamBufferBegin = (streamBufferBegin + 1) % streamBuffer.size();
+                    --streamBufferCount;
+                    ++streamStatistics.droppedValues;
+                }
+
+                streamBuffer[(streamBufferBegin + streamBufferCount) % streamBuffer.size()] = *value;
+                ++streamBufferCount;
+                ++streamStatistics.values;
+            }
+            else
+                ++streamStatistics.parseErrors;
+
+            if (fieldEnd == record.size())
+                break;
+
+            fieldBegin = fieldEnd + 1;
+        }
+    }
+
+    streamCondVar.notify_one();
+}
+
 //
 
 /*!
@@ -364,9 +1104,9 @@ const std::vector<std::uint8_t>& SCPI::getQueryCommand(const std::string_view pC
  */
 const SCPI::CommandMapType& SCPI::getWriteCommandMap(const int pChannel) const
 {
-    const auto it = writeCommands.find(pChannel);
+    const auto it = deviceDescription->writeCommands.find(pChannel);
 
-    if (it == writeCommands.end())
+    if (it == deviceDescription->writeCommands.end())
         throw std::invalid_argument("Channel number " + std::to_string(pChannel) + " is not available for SCPI driver \"" + name + "\".");
 
     return it->second;
@@ -385,9 +1125,9 @@ const SCPI::CommandMapType& SCPI::getWriteCommandMap(const int pChannel) const
  */
 const SCPI::CommandMapType& SCPI::getQueryCommandMap(const int pChannel) const
 {
-    const auto it = queryCommands.find(pChannel);
+    const auto it = deviceDescription->queryCommands.find(pChannel);
 
-    if (it == queryCommands.end())
+    if (it == deviceDescription->queryCommands.end())
         throw std::invalid_argument("Channel number " + std::to_string(pChannel) + " is not available for SCPI driver \"" + name + "\".");
 
     return it->second;
@@ -396,19 +1136,90 @@ const SCPI::CommandMapType& SCPI::getQueryCommandMap(const int pChannel) const
 //
 
 /*!
- * \brief Read the device description file for some device type.
+ * \brief Get the (shared) parsed device description for some device type.
+ *
+ * Finds the device description file for \p pDeviceType (see findDeviceDescriptionFile()), loads it (see loadDeviceDescription())
+ * and parses all commands and flags from it (see parseWriteCommands(), parseQueryCommands(), parseDeviceIdentifier() and
+ * parseCompoundCommands()).
+ *
+ * Parsed device descriptions are cached process-wide with the file path and its last modification time as key and shared between all
+ * SCPI instances using the same file (as long as any of them exists), such that e.g. many identical instruments only need a single parse.
+ * A modified file is loaded and parsed again.
+ *
+ * \throws std::runtime_error If the device description file can not be found or reading the file fails.
+ * \throws std::runtime_error If parsing of the device description fails.
+ *
+ * \param pDeviceType SCPI device type as used in YAML configurations for Device.
+ * \return Parsed device description.
+ */
+std::shared_ptr<const SCPI::DeviceDescription> SCPI::getDeviceDescription(const std::string& pDeviceType)
+{
+    static std::mutex cacheMutex;
+    static std::map<std::string, std::pair<std::filesystem::file_time_type, std::weak_ptr<const DeviceDescription>>> cache;
+
+    const std::filesystem::path filePath = findDeviceDescriptionFile(pDeviceType);
+    const std::string cacheKey = filePath.string();
+
+    std::filesystem::file_time_type lastWriteTime;
+
+    try
+    {
+        lastWriteTime = std::filesystem::last_write_time(filePath);
+    }
+    catch (const std::filesystem::filesystem_error&)
+    {
+        throw std::runtime_error("Could not load SCPI device description file \"" + cacheKey +
+                                 "\" (requested device type: \"" + pDeviceType + "\").");
+    }
+
+    {
+        const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+        (void)cacheLock;
+
+        if (const auto it = cache.find(cacheKey); it != cache.end() && it->second.first == lastWriteTime)
+        {
+            if (std::shared_ptr<const DeviceDescription> description = it->second.second.lock())
+                return description;
+        }
+    }
+
+    std::shared_ptr<DeviceDescription> description = std::make_shared<DeviceDescription>();
+
+    description->tree = Auxil::propertyTreeFromYAML(loadDeviceDescription(filePath, pDeviceType));
+    description->writeCommands = parseWriteCommands(description->tree);
+    description->queryCommands = parseQueryCommands(description->tree);
+    description->identifier = parseDeviceIdentifier(description->tree);
+    description->compoundCommands = parseCompoundCommands(description->tree);
+    description->maxWriteCommandLength = getMaxCommandLength(description->writeCommands);
+
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    //Drop entries of descriptions that are no longer used by any driver
+    std::erase_if(cache, [](const auto& pEntry) { return pEntry.second.second.expired(); });
+
+    cache[cacheKey] = std::make_pair(lastWriteTime, description);
+
+    return description;
+}
+
+/*!
+ * \brief Find the device description file for some device type.
  *
  * Takes \p pDeviceType, converts it to lowercase, replaces spaces by underscores and appends ".yaml" to it.
  * This is treated as a file name for an %SCPI device description file. A file with such a name is searched
  * for in directories that are taken from the \c CASIL_DEV_DESC_DIRS environment variable (see Env::getEnv()).
- * Starting with the first of these directories, the content of the first found file is read and returned.
+ * Starting with the first of these directories, the path of the first found file is returned.
  *
- * \throws std::runtime_error If no such file can be found or reading the file fails.
+ * The lookup uses the cached directory index of Env::findFile(), i.e. the directories are only scanned once per process
+ * (see Env::invalidateFileIndex() for making newly added description files available).
+ *
+ * \throws std::runtime_error If no such file can be found.
  *
  * \param pDeviceType SCPI device type as used in YAML configurations for Device.
- * \return Loaded file contents of a found device description file for device type \p pDeviceType.
+ * \return Path of a found device description file for device type \p pDeviceType.
  */
-std::string SCPI::loadDeviceDescription(const std::string& pDeviceType)
+std::filesystem::path SCPI::findDeviceDescriptionFile(const std::string& pDeviceType)
 {
     std::string fileName = pDeviceType;
 
@@ -418,40 +1229,42 @@ std::string SCPI::loadDeviceDescription(const std::string& pDeviceType)
     std::replace(fileName.begin(), fileName.end(), ' ', '_');
     fileName += ".yaml";
 
-    const std::set<std::string>& envDirs = Env::getEnv("CASIL_DEV_DESC_DIRS");
-
-    std::filesystem::path filePath;
+    std::filesystem::path filePath = Env::findFile("CASIL_DEV_DESC_DIRS", fileName);
 
-    for (std::filesystem::path tmpPath : envDirs)
+    if (filePath.empty())
     {
-        if (!std::filesystem::exists(tmpPath) && !filePath.empty()) //Ignore this skip for still empty 'filePath' in order to have an
-            continue;                                               //actual file name to print in case that none of the paths exists
-
-        tmpPath /= fileName;
-
-        if (!std::filesystem::exists(tmpPath) && !filePath.empty()) //Ignore this skip for still empty 'filePath', see comment above
-            continue;
-
-        filePath = std::move(tmpPath);
+        const std::set<std::string>& envDirs = Env::getEnv("CASIL_DEV_DESC_DIRS");
 
-        //Use the first found existing directory
-        if (std::filesystem::exists(filePath))
-            break;
-    }
+        //Print path in first directory in order to have an actual file name to print
+        filePath = (envDirs.empty() ? std::filesystem::path(fileName) : std::filesystem::path(*envDirs.begin()) / fileName);
 
-    if (!std::filesystem::exists(filePath))
-    {
         throw std::runtime_error("Could not find SCPI device description file \"" + filePath.string() +
                                  "\" (requested device type: \"" + pDeviceType + "\").");
     }
 
+    return filePath;
+}
+
+/*!
+ * \brief Read the device description file for some device type.
+ *
+ * Reads and returns the content of the device description file \p pFilePath (see findDeviceDescriptionFile()).
+ *
+ * \throws std::runtime_error If reading the file fails.
+ *
+ * \param pFilePath Path of the device description file.
+ * \param pDeviceType SCPI device type as used in YAML configurations for Device (for error messages only).
+ * \return Loaded file contents of the device description file.
+ */
+std::string SCPI::loadDeviceDescription(const std::filesystem::path& pFilePath, const std::string& pDeviceType)
+{
     std::string devDescStr;
 
     try
     {
         std::ifstream devDescFile;
         devDescFile.exceptions(std::ios_base::badbit | std::ios_base::failbit);
-        devDescFile.open(filePath);
+        devDescFile.open(pFilePath);
 
         try
         {
@@ -468,7 +1281,7 @@ std::string SCPI::loadDeviceDescription(const std::string& pDeviceType)
     }
     catch (const std::ios_base::failure&)
     {
-        throw std::runtime_error("Could not load SCPI device description file \"" + filePath.string() +
+        throw std::runtime_error("Could not load SCPI device description file \"" + pFilePath.string() +
                                  "\" (requested device type: \"" + pDeviceType + "\").");
     }
 
@@ -599,7 +1412,7 @@ std::map<int, SCPI::CommandMapType> SCPI::parseCommands(const boost::property_tr
 
     for (const auto& [key, val] : pDeviceDescription)
     {
-        if (key == "identifier")
+        if (key == "identifier" || key == "compound_commands")
             continue;
 
         if (key.starts_with(channelPrefix))
@@ -676,30 +1489,163 @@ std::string SCPI::parseDeviceIdentifier(const boost::property_tree::ptree& pDevi
     return it->second.data();
 }
 
+/*!
+ * \brief Check if device accepts compound commands.
+ *
+ * Reads the optional "compound_commands" flag from \p pDeviceDescription, which states whether the device
+ * accepts multiple commands joined with ';' within a single message (see batch()).
+ *
+ * \throws std::runtime_error If the flag cannot be parsed as boolean.
+ *
+ * \param pDeviceDescription The device description.
+ * \return True if the device description allows compound commands and false if not or if the flag is not defined.
+ */
+bool SCPI::parseCompoundCommands(const boost::property_tree::ptree& pDeviceDescription)
+{
+    try
+    {
+        return pDeviceDescription.get<bool>("compound_commands", false);
+    }
+    catch (const boost::property_tree::ptree_bad_data&)
+    {
+        throw std::runtime_error("Could not parse compound commands flag in SCPI device description.");
+    }
+}
+
+/*!
+ * \brief Get the length of the longest command.
+ *
+ * \param pCommands Map of channel-specific command maps (see parseCommands()).
+ * \return Maximum byte sequence length of all commands in \p pCommands.
+ */
+std::size_t SCPI::getMaxCommandLength(const std::map<int, CommandMapType>& pCommands)
+{
+    std::size_t maxLength = 0;
+
+    for (const auto& [channel, cmds] : pCommands)
+    {
+        (void)channel;
+
+        for (const auto& [cmdName, cmd] : cmds)
+        {
+            (void)cmdName;
+            maxLength = std::max(maxLength, cmd.size());
+        }
+    }
+
+    return maxLength;
+}
+
 //
 
 /*!
- * \brief Convert a value to string with fixed formatting.
+ * \brief Append a value to a command with fixed formatting.
  *
- * Returns a formatted string corresponding to the value represented by the variant \p pValue:
+ * Appends the value represented by the variant \p pValue to \p pBuffer, formatted as follows:
  * - \c std::string: No formatting is performed.
- * - \c double: `{: <-#E}`
- * - \c int: `{: <-d}`
- * - \c No value (\c std::monostate ): Empty string is returned.
+ * - \c double: Scientific notation with six digits precision and upper case letters (equivalent to `{: <-#E}`).
+ * - \c int: Plain decimal number (equivalent to `{: <-d}`).
+ * - \c No value (\c std::monostate ): Nothing is appended.
+ *
+ * Numbers are formatted in place via \c std::to_chars() (no heap allocation as long as
+ * \p pBuffer has enough capacity for \ref valueSlotSize additional bytes).
  *
+ * \param pBuffer Buffer to append the formatted value to.
  * \param pValue Value to be formatted.
- * \return Formatted value.
  */
-std::string SCPI::getValueStr(VariantValueType&& pValue)
+void SCPI::appendValue(std::vector<std::uint8_t>& pBuffer, const VariantValueType& pValue)
 {
     if (std::holds_alternative<std::string>(pValue))
-        return std::move(std::get<std::string>(pValue));
-    else if (std::holds_alternative<double>(pValue))
-        return std::format("{: <-#E}", std::get<double>(pValue));
+    {
+        const std::string& str = std::get<std::string>(pValue);
+        pBuffer.insert(pBuffer.end(), str.begin(), str.end());
+        return;
+    }
+
+    std::array<char, valueSlotSize> valueChars;
+
+    std::to_chars_result result{valueChars.data(), std::errc()};
+
+    if (std::holds_alternative<double>(pValue))
+        result = std::to_chars(valueChars.data(), valueChars.data() + valueChars.size(), std::get<double>(pValue),
+                               std::chars_format::scientific, 6);
     else if (std::holds_alternative<int>(pValue))
-        return std::format("{: <-d}", std::get<int>(pValue));
-    else
-        return "";  //Fallback for std::monostate
+        result = std::to_chars(valueChars.data(), valueChars.data() + valueChars.size(), std::get<int>(pValue));
+
+    std::transform(valueChars.data(), result.ptr, std::back_inserter(pBuffer),
+                   [](const unsigned char pChar){ return static_cast<std::uint8_t>(std::toupper(pChar)); });
+}
+
+/*!
+ * \brief Convert a query response to a matching value type.
+ *
+ * Ignores leading/trailing whitespace and a leading '+' sign and tries to parse \p pResponse
+ * (in this order) as complete \c int or \c double number. Returns \p pResponse unchanged
+ * as \c std::string if it is neither.
+ *
+ * \param pResponse Query response.
+ * \return Converted value.
+ */
+SCPI::VariantValueType SCPI::parseResponse(const std::string& pResponse)
+{
+    const auto isSpace = [](const unsigned char pChar){ return std::isspace(pChar) != 0; };
+
+    const char* first = pResponse.data();
+    const char* last = pResponse.data() + pResponse.size();
+
+    while (first != last && isSpace(*first))
+        ++first;
+    while (last != first && isSpace(*(last - 1)))
+        --last;
+
+    if (first != last && *first == '+')
+        ++first;
+
+    if (first == last)
+        return pResponse;
+
+    int intValue = 0;
+
+    if (const auto [ptr, ec] = std::from_chars(first, last, intValue); ec == std::errc() && ptr == last)
+        return intValue;
+
+    double doubleValue = 0;
+
+    if (const auto [ptr, ec] = std::from_chars(first, last, doubleValue); ec == std::errc() && ptr == last)
+        return doubleValue;
+
+    return pResponse;
+}
+
+/*!
+ * \brief Parse a single streamed reading.
+ *
+ * Ignores leading/trailing whitespace and a leading '+' sign and tries to parse \p pField as complete \c double number.
+ *
+ * \param pField Single (comma-separated) field of a streamed record.
+ * \return Parsed value or no value if \p pField is not a number.
+ */
+std::optional<double> SCPI::parseReading(const std::string_view pField)
+{
+    const auto isSpace = [](const unsigned char pChar){ return std::isspace(pChar) != 0; };
+
+    const char* first = pField.data();
+    const char* last = pField.data() + pField.size();
+
+    while (first != last && isSpace(*first))
+        ++first;
+    while (last != first && isSpace(*(last - 1)))
+        --last;
+
+    if (first != last && *first == '+')
+        ++first;
+
+    double value = 0;
+
+    if (const auto [ptr, ec] = std::from_chars(first, last, value); first != last && ec == std::errc() && ptr == last)
+        return value;
+
+    return std::nullopt;
 }
 
 /*!
@@ -714,3 +1660,69 @@ bool SCPI::isSetter(const std::string_view pCmd)
 {
     return pCmd.starts_with("set_");
 }
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * \param pOwner Device description containing the command.
+ * \param pName Command name (must stay valid as long as \p pOwner).
+ * \param pChannel Channel number (-1 for no channel).
+ * \param pCommand Command byte sequence (must stay valid as long as \p pOwner).
+ * \param pQuery Command is a query command.
+ */
+SCPI::CommandHandle::CommandHandle(const DeviceDescription& pOwner, const std::string_view pName, const int pChannel,
+                                   const std::vector<std::uint8_t>& pCommand, const bool pQuery) :
+    owner(&pOwner),
+    name(pName),
+    channel(pChannel),
+    command(&pCommand),
+    query(pQuery),
+    setter(!pQuery && SCPI::isSetter(pName))
+{
+}
+
+//Public
+
+/*!
+ * \brief Get the command name.
+ *
+ * \return Command name.
+ */
+std::string_view SCPI::CommandHandle::getName() const
+{
+    return name;
+}
+
+/*!
+ * \brief Get the channel number.
+ *
+ * \return Channel number (-1 for no channel).
+ */
+int SCPI::CommandHandle::getChannel() const
+{
+    return channel;
+}
+
+/*!
+ * \brief Check if the command is a query command.
+ *
+ * \return True if query command and false if write command.
+ */
+bool SCPI::CommandHandle::isQuery() const
+{
+    return query;
+}
+
+/*!
+ * \brief Check if the command is a setter.
+ *
+ * A command is a setter if it is a write command whose name starts with "set_".
+ *
+ * \return True if setter.
+ */
+bool SCPI::CommandHandle::isSetter() const
+{
+    return setter;
+}
@@ -67,12 +67,20 @@
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -95,35 +103,142 @@ class SCPI final : public DirectDriver
 public:
     typedef std::variant<std::monostate, std::string, int, double> VariantValueType;        ///< Supported command argument types.
 
+    /*!
+     * \brief Single command as part of a batch of commands (see batch()).
+     */
+    struct BatchCommand
+    {
+        std::string cmd;                                        ///< The command name.
+        std::optional<int> channel = std::nullopt;              ///< %Device's channel number, if applicable (no value or -1 for no channel).
+        VariantValueType value = std::monostate{};              ///< The value argument for a setter.
+    };
+
+    /*!
+     * \brief Snapshot of the streaming acquisition counters (see getStreamStatistics()).
+     */
+    struct StreamStatistics
+    {
+        std::uint64_t records;          ///< Number of records received since startStreaming().
+        std::uint64_t values;           ///< Number of values parsed from the received records.
+        std::uint64_t droppedValues;    ///< Number of values overwritten in the full stream buffer before being read.
+        std::uint64_t parseErrors;      ///< Number of record fields that could not be parsed as number.
+    };
+
 private:
     typedef std::map<std::string, std::vector<std::uint8_t>, std::less<>> CommandMapType;   ///< \brief Map type for commands (as byte sequence)
                                                                                             ///  with the command names as keys.
 
+    /*!
+     * \brief Parsed device description, shared by all instances using the same device description file (see getDeviceDescription()).
+     */
+    struct DeviceDescription
+    {
+        boost::property_tree::ptree tree;               ///< YAML tree of device description file (general and channel-specific commands).
+        std::map<int, CommandMapType> writeCommands;    ///< Write commands implemented by the device with channel as key (-1: no channel).
+        std::map<int, CommandMapType> queryCommands;    ///< Query commands implemented by the device with channel as key (-1: no channel).
+        std::string identifier;                         ///< Device identifier string returned by the "*IDN?" command.
+        bool compoundCommands;                          ///< Whether the device accepts compound commands (see parseCompoundCommands()).
+        std::size_t maxWriteCommandLength;              ///< Length of the longest write command.
+    };
+
+public:
+    /*!
+     * \brief Pre-resolved command for repeated execution without command name lookup (see handle()).
+     *
+     * Refers to the command tables of the device description of the %SCPI instance that created it
+     * and must therefore not be used after that instance has been destroyed.
+     */
+    class CommandHandle
+    {
+    public:
+        std::string_view getName() const;           ///< Get the command name.
+        int getChannel() const;                     ///< Get the channel number.
+        bool isQuery() const;                       ///< Check if the command is a query command.
+        bool isSetter() const;                      ///< Check if the command is a setter.
+
+    private:
+        CommandHandle(const DeviceDescription& pOwner, std::string_view pName, int pChannel,
+                      const std::vector<std::uint8_t>& pCommand, bool pQuery);                  ///< Constructor.
+
+    private:
+        const DeviceDescription* owner;             ///< Device description containing the command.
+        std::string_view name;                      ///< Command name.
+        int channel;                                ///< Channel number (-1 for no channel).
+        const std::vector<std::uint8_t>* command;   ///< Command byte sequence.
+        bool query;                                 ///< Command is a query command.
+        bool setter;                                ///< Command is a setter.
+
+        friend class SCPI;
+    };
+
 public:
     SCPI(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig);            ///< Constructor.
-    ~SCPI() override = default;                                                             ///< Default destructor.
+    ~SCPI() override;                                                                       ///< Destructor.
     //
     std::optional<std::string> operator()(std::string_view pCmd, std::optional<int> pChannel = std::nullopt,
                                           VariantValueType pValue = std::monostate{}) const;    ///< Execute a command (either write or query).
+    std::optional<std::string> operator()(const CommandHandle& pHandle, VariantValueType pValue = std::monostate{}) const;
+                                                                                                ///< Execute a command (either write or query).
+    //
+    CommandHandle handle(std::string_view pCmd, std::optional<int> pChannel = std::nullopt) const;  ///< Get a handle for a command.
     //
     void writeCommand(std::string_view pCmd, std::optional<int> pChannel = std::nullopt, VariantValueType pValue = std::monostate{}) const;
                                                                                                             ///< Execute a write command.
     std::string queryCommand(std::string_view pCmd, std::optional<int> pChannel = std::nullopt) const;      ///< Execute a query command.
+    std::vector<std::string> queryCommandSequence(const std::vector<std::string>& pCmds, std::optional<int> pChannel = std::nullopt) const;
+                                                                                                            ///< Execute multiple query commands at once.
+    std::vector<std::uint8_t> queryBinary(std::string_view pCmd, std::optional<int> pChannel = std::nullopt) const;
+                                                                                                ///< Execute a query command with binary block response.
+    std::size_t queryBinaryInto(std::span<std::uint8_t> pBuffer, std::string_view pCmd, std::optional<int> pChannel = std::nullopt) const;
+                                                                                                ///< \brief Execute a query command with binary
+                                                                                                ///  block response into a buffer.
+    template<typename T>
+        requires std::is_arithmetic_v<T>
+    std::vector<T> queryBinaryAs(std::string_view pCmd, std::optional<int> pChannel = std::nullopt) const;
+                                                                                                ///< \brief Execute a query command with binary
+                                                                                                ///  block response of typed values.
     std::optional<std::string> command(std::string_view pCmd, std::optional<int> pChannel = std::nullopt,
                                        VariantValueType pValue = std::monostate{}) const;       ///< Execute a command (either write or query).
+    void writeCommand(const CommandHandle& pHandle, VariantValueType pValue = std::monostate{}) const;   ///< Execute a write command.
+    std::string queryCommand(const CommandHandle& pHandle) const;                                       ///< Execute a query command.
+    std::optional<std::string> command(const CommandHandle& pHandle, VariantValueType pValue = std::monostate{}) const;
+                                                                                                ///< Execute a command (either write or query).
+    std::vector<VariantValueType> batch(const std::vector<BatchCommand>& pCmds) const;          ///< \brief Execute multiple commands (write and/or
+                                                                                                ///  query) with a single round trip.
+    //
+    void startStreaming(std::optional<int> pChannel = std::nullopt);    ///< Start a continuous streaming acquisition.
+    void stopStreaming();                                               ///< Stop the streaming acquisition.
+    bool isStreaming() const;                                           ///< Check if the streaming acquisition is active.
+    std::vector<double> readStream(std::size_t pMaxValues = 0, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero());
+                                                                        ///< Take buffered values from the streaming acquisition.
+    StreamStatistics getStreamStatistics() const;                       ///< Get the counters of the streaming acquisition.
 
 private:
     bool initImpl() override;
     bool closeImpl() override;
     //
+    std::map<std::string, std::size_t> getMemoryUsageImpl() const override;
+    //
     bool isQueryCommand(std::string_view pCmd, int pChannel = -1) const;                                ///< Check if command is query command.
     const std::vector<std::uint8_t>& getWriteCommand(std::string_view pCmd, int pChannel = -1) const;   ///< Get a write command from its name.
     const std::vector<std::uint8_t>& getQueryCommand(std::string_view pCmd, int pChannel = -1) const;   ///< Get a query command from its name.
+    CommandHandle findCommand(std::string_view pCmd, int pChannel, bool pQuery) const;                 ///< Look up a write or query command.
+    void checkHandle(const CommandHandle& pHandle, bool pQuery) const;                                  ///< Check if a handle can be used.
+    void appendWriteCommand(std::vector<std::uint8_t>& pBuffer, const CommandHandle& pHandle, const VariantValueType& pValue) const;
+                                                                                                        ///< \brief Append a full write command
+                                                                                                        ///  (including value) to a buffer.
+    void writeStreamCommand(std::string_view pCmd, int pChannel) const; ///< Execute a stream control command if the device defines it.
+    void handleStreamRecord(std::span<const std::uint8_t> pRecord);     ///< Parse a streamed record into the stream buffer.
     //
     const CommandMapType& getWriteCommandMap(int pChannel = -1) const;                      ///< Get the write commands for a certain channel.
     const CommandMapType& getQueryCommandMap(int pChannel = -1) const;                      ///< Get the query commands for a certain channel.
     //
-    static std::string loadDeviceDescription(const std::string& pDeviceType);       ///< Read the device description file for some device type.
+    static std::shared_ptr<const DeviceDescription> getDeviceDescription(const std::string& pDeviceType);
+                                                                                    ///< \brief Get the (shared) parsed device description
+                                                                                    ///  for some device type.
+    static std::filesystem::path findDeviceDescriptionFile(const std::string& pDeviceType); ///< Find the device description file for some device type.
+    static std::string loadDeviceDescription(const std::filesystem::path& pFilePath, const std::string& pDeviceType);
+                                                                                    ///< Read the device description file for some device type.
     static std::map<int, CommandMapType> parseWriteCommands(const boost::property_tree::ptree& pDeviceDescription);
                                                                                     ///< \brief Generate a map of general and channel-specific
                                                                                     ///  write commands from a device description.
@@ -136,20 +251,73 @@ private:
                                                                                     ///  channel-specific commands from a device
                                                                                     ///  description (either query or write commands).
     static std::string parseDeviceIdentifier(const boost::property_tree::ptree& pDeviceDescription);    ///< Get the device identifier string.
+    static bool parseCompoundCommands(const boost::property_tree::ptree& pDeviceDescription);   ///< Check if device accepts compound commands.
+    static std::size_t getMaxCommandLength(const std::map<int, CommandMapType>& pCommands); ///< Get the length of the longest command.
     //
-    static std::string getValueStr(VariantValueType&& pValue);                      ///< Convert a value to string with fixed formatting.
+    static void appendValue(std::vector<std::uint8_t>& pBuffer, const VariantValueType& pValue);
+                                                                                    ///< Append a value to a command with fixed formatting.
+    static VariantValueType parseResponse(const std::string& pResponse);            ///< Convert a query response to a matching value type.
     static bool isSetter(std::string_view pCmd);                                    ///< Check if a command name identifies it as setter.
+    static std::optional<double> parseReading(std::string_view pField);            ///< Parse a single streamed reading.
 
 private:
-    const boost::property_tree::ptree deviceDescription;    ///< YAML tree of device description file (general and channel-specific commands).
-    const std::map<int, CommandMapType> writeCommands;      ///< Write commands implemented by the device with channel as key (-1: no channel).
-    const std::map<int, CommandMapType> queryCommands;      ///< Query commands implemented by the device with channel as key (-1: no channel).
+    const std::shared_ptr<const DeviceDescription> deviceDescription;   ///< \brief Parsed device description (shared by instances
+                                                                        ///  using the same device description file).
+    const bool compoundCommands;                            ///< Join batch() commands with ';' into a single message.
+    //
+    mutable std::vector<std::uint8_t> writeBuffer;          ///< \brief Reusable buffer for setter commands, with capacity reserved for
+                                                            ///  the longest write command plus a formatted value (see writeCommand()).
+    mutable std::mutex writeBufferMutex;                    ///< Mutex for \ref writeBuffer.
     //
-    const std::string deviceIdentifier;                     ///< Device identifier string returned by the "*IDN?" command.
+    const std::size_t streamBufferCapacity;                 ///< Maximum number of buffered values of the streaming acquisition.
+    std::vector<double> streamBuffer;                       ///< Ring buffer for the values of the streaming acquisition.
+    std::size_t streamBufferBegin;                          ///< Position of the oldest value in \ref streamBuffer.
+    std::size_t streamBufferCount;                          ///< Number of values in \ref streamBuffer.
+    StreamStatistics streamStatistics;                      ///< Counters of the streaming acquisition.
+    mutable std::mutex streamBufferMutex;                   ///< Mutex for \ref streamBuffer and \ref streamStatistics.
+    std::condition_variable streamCondVar;                  ///< Condition variable to wake readers waiting for streamed values.
+    std::optional<int> streamChannel;                       ///< Channel of the active streaming acquisition (no value if not active).
+    mutable std::mutex streamStateMutex;                    ///< Mutex for \ref streamChannel.
+
+private:
+    static constexpr std::size_t valueSlotSize = 32;        ///< Reserved number of bytes for a formatted (numeric) command value.
+    static constexpr std::size_t defaultStreamBufferCapacity = 65536;   ///< Default for \ref streamBufferCapacity.
 
     CASIL_REGISTER_DRIVER_H("SCPI")
 };
 
+/*!
+ * \brief Execute a query command with binary block response of typed values.
+ *
+ * Like queryBinary() but reads the block data directly into a sequence of values of type \p T, without
+ * intermediate byte buffer (e.g. for 16 bit waveform data). The values are interpreted in native byte order,
+ * so the instrument's transfer byte order must be configured accordingly.
+ *
+ * \throws std::invalid_argument If \p pCmd is not available for the configured device and channel \p pChannel.
+ * \throws std::invalid_argument If \p pChannel is not available for the configured device.
+ * \throws std::runtime_error If the query or reading the response fails (see TL::DirectInterface::queryBlockHeader()
+ *                            and TL::DirectInterface::readBlockData()).
+ * \throws std::runtime_error If the block length is not a multiple of the size of \p T (the block is discarded).
+ *
+ * \tparam T Arithmetic value type of the block data.
+ * \param pCmd The command name.
+ * \param pChannel %Device's channel number, if applicable (no value or -1 for no channel).
+ * \return Block data as values of type \p T.
+ */
+template<typename T>
+    requires std::is_arithmetic_v<T>
+std::vector<T> SCPI::queryBinaryAs(const std::string_view pCmd, const std::optional<int> pChannel) const
+{
+    const std::size_t length = interface.queryBlockHeader(getQueryCommand(pCmd, pChannel.has_value() ? *pChannel : -1));
+
+    //Buffer is too small for the block (causing it to be discarded) if length is not a multiple of sizeof(T)
+    std::vector<T> values(length / sizeof(T));
+
+    (void)interface.readBlockData(std::span<std::uint8_t>(reinterpret_cast<std::uint8_t*>(values.data()), values.size() * sizeof(T)), length);
+
+    return values;
+}
+
 } // namespace Layers::HL
 
 } // namespace casil
@@ -23,6 +23,13 @@
 
 #include <casil/HL/Direct/virtecho.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 using casil::Layers::HL::VirtEcho;
@@ -34,13 +41,29 @@ CASIL_REGISTER_DRIVER_CPP(VirtEcho)
 /*!
  * \brief Constructor.
  *
+ * Gets the block sizes for benchmark() from the optional "init.block_sizes" sequence in \p pConfig
+ * (unsigned integer sequence, in bytes, default: <tt>[64, 1024, 16384]</tt>) and the number of blocks
+ * per block size from the optional "init.num_blocks" value (unsigned integer type, default: 1000).
+ *
+ * \throws std::runtime_error If any of "init.block_sizes" or "init.num_blocks" is zero.
+ *
  * \param pName Component instance name.
  * \param pInterface %Interface instance to be used.
  * \param pConfig Component configuration.
  */
 VirtEcho::VirtEcho(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig) :
-    DirectDriver(typeName, std::move(pName), pInterface, std::move(pConfig), LayerConfig())
+    DirectDriver(typeName, std::move(pName), pInterface, std::move(pConfig), LayerConfig()),
+    benchmarkBlockSizes(config.getUIntSeq("init.block_sizes", {64, 1024, 16384})),
+    benchmarkNumBlocks(config.getUInt("init.num_blocks", 1000)),
+    echoBuffer(),
+    benchTxBuffer(),
+    benchRxBuffer(),
+    bufferMutex()
 {
+    if (std::find(benchmarkBlockSizes.begin(), benchmarkBlockSizes.end(), 0u) != benchmarkBlockSizes.end())
+        throw std::runtime_error("Zero benchmark block size set for " + getSelfDescription() + ".");
+    if (benchmarkNumBlocks == 0)
+        throw std::runtime_error("Zero number of benchmark blocks set for " + getSelfDescription() + ".");
 }
 
 //Public
@@ -50,11 +73,135 @@ VirtEcho::VirtEcho(std::string pName, InterfaceBaseType& pInterface, LayerConfig
  *
  * Reads via TL::DirectInterface::read() and then writes via TL::DirectInterface::write().
  *
+ * For positive \p pN the bytes are read via TL::DirectInterface::readInto() into a buffer
+ * that is reused between calls, i.e. no memory is allocated for repeated echoes.
+ *
  * \param pN Number of bytes as taken by TL::DirectInterface::read() and TL::DirectInterface::write().
  */
 void VirtEcho::operator()(const int pN) const
 {
-    interface.write(interface.read(pN));
+    if (pN <= 0)
+    {
+        interface.write(interface.read(pN));
+        return;
+    }
+
+    const std::lock_guard<std::mutex> bufferLock(bufferMutex);
+    (void)bufferLock;
+
+    echoBuffer.resize(static_cast<std::size_t>(pN));
+
+    interface.readInto(echoBuffer, pN);
+    interface.write(echoBuffer);
+}
+
+/*!
+ * \brief Measure the echo throughput and latency of the interface.
+ *
+ * Writes \p pNumBlocks blocks of \p pBlockSize bytes (a counting byte pattern) to the interface one after another
+ * and reads each block back (see TL::DirectInterface::readInto()) before sending the next one. The round trip time
+ * of every block is recorded to determine the latency percentiles and the total time gives the throughput.
+ * Send and receive buffers are reused, such that the measurement is not distorted by memory allocations.
+ *
+ * This requires a \e transparent echo peer on the other side of the interface, i.e. one that returns exactly the
+ * written bytes (e.g. a loopback plug for Serial, an echo server for TCP/UDP or another VirtEcho at the far end).
+ * Note that a configured write termination of the interface is appended to every block and hence also echoed;
+ * use an empty write termination for byte-exact block sizes.
+ *
+ * The result is also logged (see Logger::LogLevel::Info).
+ *
+ * \throws std::invalid_argument If \p pBlockSize or \p pNumBlocks is zero or \p pBlockSize exceeds the range of \c int.
+ * \throws std::runtime_error If reading or writing fails (see TL::DirectInterface::readInto() and TL::DirectInterface::write()).
+ * \throws std::runtime_error If a block is not echoed correctly.
+ *
+ * \param pBlockSize Number of bytes per block.
+ * \param pNumBlocks Number of blocks to be echoed.
+ * \return Measured throughput and latency statistics.
+ */
+VirtEcho::BenchmarkResult VirtEcho::benchmark(const std::size_t pBlockSize, const std::size_t pNumBlocks) const
+{
+    if (pBlockSize == 0 || pNumBlocks == 0)
+        throw std::invalid_argument("Block size and number of blocks for benchmark of " + getSelfDescription() + " must be non-zero.");
+    if (std::cmp_greater(pBlockSize, std::numeric_limits<int>::max()))
+        throw std::invalid_argument("Block size for benchmark of " + getSelfDescription() + " is too large.");
+
+    const std::lock_guard<std::mutex> bufferLock(bufferMutex);
+    (void)bufferLock;
+
+    benchTxBuffer.resize(pBlockSize);
+    benchRxBuffer.resize(pBlockSize);
+
+    std::vector<std::chrono::nanoseconds> roundTripTimes;
+    roundTripTimes.reserve(pNumBlocks);
+
+    for (std::size_t i = 0; i < pNumBlocks; ++i)
+    {
+        //Vary the pattern between blocks to detect stale or mixed-up echoes
+        std::iota(benchTxBuffer.begin(), benchTxBuffer.end(), static_cast<std::uint8_t>(i));
+
+        const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        interface.write(benchTxBuffer);
+        interface.readInto(benchRxBuffer, static_cast<int>(pBlockSize));
+
+        roundTripTimes.push_back(std::chrono::steady_clock::now() - startTime);
+
+        if (benchRxBuffer != benchTxBuffer)
+            throw std::runtime_error("Benchmark block " + std::to_string(i) + " was not echoed correctly to " + getSelfDescription() + ".");
+    }
+
+    const std::chrono::nanoseconds totalTime = std::accumulate(roundTripTimes.begin(), roundTripTimes.end(), std::chrono::nanoseconds::zero());
+
+    std::sort(roundTripTimes.begin(), roundTripTimes.end());
+
+    auto percentile = [&roundTripTimes](const double pFraction) -> double
+    {
+        const std::size_t idx = static_cast<std::size_t>(std::ceil(pFraction * roundTripTimes.size()));
+        return std::chrono::duration<double, std::micro>(roundTripTimes[std::clamp<std::size_t>(idx, 1, roundTripTimes.size()) - 1]).count();
+    };
+
+    BenchmarkResult result;
+
+    result.interfaceType = interface.getType();
+    result.blockSize = pBlockSize;
+    result.numBlocks = pNumBlocks;
+    result.totalSecs = std::chrono::duration<double>(totalTime).count();
+    result.throughputMBps = result.totalSecs > 0.0 ? (static_cast<double>(pBlockSize) * pNumBlocks / 1e6 / result.totalSecs) : 0.0;
+    result.latencyMinMicroSecs = std::chrono::duration<double, std::micro>(roundTripTimes.front()).count();
+    result.latencyP50MicroSecs = percentile(0.5);
+    result.latencyP90MicroSecs = percentile(0.9);
+    result.latencyP99MicroSecs = percentile(0.99);
+    result.latencyMaxMicroSecs = std::chrono::duration<double, std::micro>(roundTripTimes.back()).count();
+
+    logger.logInfo("Echo benchmark via " + result.interfaceType + " interface: " + std::to_string(pNumBlocks) + " x " +
+                   std::to_string(pBlockSize) + " B, " + std::to_string(result.throughputMBps) + " MB/s, latency [us] min/p50/p90/p99/max: " +
+                   std::to_string(result.latencyMinMicroSecs) + "/" + std::to_string(result.latencyP50MicroSecs) + "/" +
+                   std::to_string(result.latencyP90MicroSecs) + "/" + std::to_string(result.latencyP99MicroSecs) + "/" +
+                   std::to_string(result.latencyMaxMicroSecs) + ".");
+
+    return result;
+}
+
+/*!
+ * \brief Run benchmark() for all configured block sizes.
+ *
+ * Calls benchmark(std::size_t, std::size_t) const for every block size configured via "init.block_sizes"
+ * with the number of blocks configured via "init.num_blocks" (see VirtEcho()).
+ *
+ * \throws std::invalid_argument If benchmark(std::size_t, std::size_t) const throws \c std::invalid_argument.
+ * \throws std::runtime_error If benchmark(std::size_t, std::size_t) const throws \c std::runtime_error.
+ *
+ * \return Benchmark results in order of the configured block sizes.
+ */
+std::vector<VirtEcho::BenchmarkResult> VirtEcho::benchmark() const
+{
+    std::vector<BenchmarkResult> results;
+    results.reserve(benchmarkBlockSizes.size());
+
+    for (const std::uint64_t blockSize : benchmarkBlockSizes)
+        results.push_back(benchmark(static_cast<std::size_t>(blockSize), static_cast<std::size_t>(benchmarkNumBlocks)));
+
+    return results;
 }
 
 //Private
@@ -29,7 +29,11 @@
 #include <casil/layerconfig.h>
 #include <casil/layerfactorymacros.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace casil
 {
@@ -41,19 +45,52 @@ namespace Layers::HL
  * \brief Pseudo driver to write back to its interface what can be read from it.
  *
  * Reads some data \e on \e request and immediately writes it back (see operator()()).
+ *
+ * Can also be used the other way round to measure the throughput and latency of its interface
+ * by sending blocks to a transparent echo peer and reading them back (see benchmark()).
  */
 class VirtEcho final : public DirectDriver
 {
+public:
+    /*!
+     * \brief Results of a loopback benchmark run (see benchmark()).
+     */
+    struct BenchmarkResult
+    {
+        std::string interfaceType;      ///< Type name of the benchmarked interface.
+        std::size_t blockSize;          ///< Number of bytes per echoed block.
+        std::size_t numBlocks;          ///< Number of echoed blocks.
+        double totalSecs;               ///< Total duration of all round trips in seconds.
+        double throughputMBps;          ///< Achieved throughput (sent and received payload per direction) in MB/s.
+        double latencyMinMicroSecs;     ///< Minimum round trip time in microseconds.
+        double latencyP50MicroSecs;     ///< Median round trip time in microseconds.
+        double latencyP90MicroSecs;     ///< 90th percentile of the round trip time in microseconds.
+        double latencyP99MicroSecs;     ///< 99th percentile of the round trip time in microseconds.
+        double latencyMaxMicroSecs;     ///< Maximum round trip time in microseconds.
+    };
+
 public:
     VirtEcho(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig);    ///< Constructor.
     ~VirtEcho() override = default;                                                     ///< Default destructor.
     //
     void operator()(int pN) const;                                                      ///< Read and immediately write back a number of bytes.
+    //
+    BenchmarkResult benchmark(std::size_t pBlockSize, std::size_t pNumBlocks) const;    ///< Measure the echo throughput and latency of the interface.
+    std::vector<BenchmarkResult> benchmark() const;                                     ///< Run benchmark() for all configured block sizes.
 
 private:
     bool initImpl() override;
     bool closeImpl() override;
 
+private:
+    const std::vector<std::uint64_t> benchmarkBlockSizes;   ///< Configured block sizes for benchmark().
+    const std::uint64_t benchmarkNumBlocks;                 ///< Configured number of blocks per block size for benchmark().
+    //
+    mutable std::vector<std::uint8_t> echoBuffer;           ///< Reused buffer for echoed bytes (see operator()()).
+    mutable std::vector<std::uint8_t> benchTxBuffer;        ///< Reused buffer for sent benchmark blocks.
+    mutable std::vector<std::uint8_t> benchRxBuffer;        ///< Reused buffer for received benchmark blocks.
+    mutable std::mutex bufferMutex;                         ///< Mutex for the reused buffers.
+
     CASIL_REGISTER_DRIVER_H("VirtEcho")
 };
 
@@ -23,8 +23,10 @@
 
 #include <casil/HL/Muxed/dummymuxeddriver.h>
 
+#include <casil/auxil.h>
 #include <casil/bytes.h>
 
+#include <chrono>
 #include <utility>
 
 using casil::Layers::HL::DummyMuxedDriver;
@@ -36,12 +38,19 @@ CASIL_REGISTER_DRIVER_CPP(DummyMuxedDriver)
 /*!
  * \brief Constructor.
  *
+ * Gets the optional "silent" value from \p pConfig (boolean value, default: false), which disables the
+ * debug logging of all function calls, and the optional "latency" value (unsigned integer value in microseconds,
+ * default: 0), which is waited for in every data transfer call (getData(), setData(), exec()).
+ * This allows to use the %DummyMuxedDriver for profiling the overhead of the components on top of it.
+ *
  * \param pName Component instance name.
  * \param pInterface %Interface instance to be used.
  * \param pConfig Component configuration.
  */
 DummyMuxedDriver::DummyMuxedDriver(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig) :
-    MuxedDriver(typeName, std::move(pName), pInterface, std::move(pConfig), LayerConfig())
+    MuxedDriver(typeName, std::move(pName), pInterface, std::move(pConfig), LayerConfig()),
+    silent(config.getBool("silent", false)),
+    latency(config.getUInt("latency", 0))
 {
 }
 
@@ -50,7 +59,8 @@ DummyMuxedDriver::DummyMuxedDriver(std::string pName, InterfaceBaseType& pInterf
 /*!
  * \copybrief MuxedDriver::getData()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled)
+ * after waiting for the configured synthetic latency (see DummyMuxedDriver()).
  *
  * \param pSize Number of bytes to get (ignored).
  * \param pAddrOffs Data offset as number of bytes (ignored).
@@ -58,47 +68,59 @@ DummyMuxedDriver::DummyMuxedDriver(std::string pName, InterfaceBaseType& pInterf
  */
 std::vector<std::uint8_t> DummyMuxedDriver::getData(const int pSize, const std::uint32_t pAddrOffs)
 {
-    logger.logDebug(std::string("getData() was called with arguments ") +
-                    "\"pSize\" = " + std::to_string(pSize) + ", " +
-                    "\"pAddrOffs\" = " + Bytes::formatHex(pAddrOffs) + ".");
+    simulateLatency();
+
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, std::string("getData() was called with arguments ") +
+                                 "\"pSize\" = " + std::to_string(pSize) + ", " +
+                                 "\"pAddrOffs\" = " + Bytes::formatHex(pAddrOffs) + ".");
     return {};
 }
 
 /*!
  * \copybrief MuxedDriver::setData()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled)
+ * after waiting for the configured synthetic latency (see DummyMuxedDriver()).
  *
  * \param pData Data to be set as byte sequence (ignored).
  * \param pAddrOffs Data offset as number of bytes (ignored).
  */
 void DummyMuxedDriver::setData(const std::vector<std::uint8_t>& pData, const std::uint32_t pAddrOffs)
 {
-    logger.logDebug(std::string("setData() was called with arguments ") +
-                    "\"pData\" = " + Bytes::formatByteVec(pData) + ", " +
-                    "\"pAddrOffs\" = " + Bytes::formatHex(pAddrOffs) + ".");
+    simulateLatency();
+
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, std::string("setData() was called with arguments ") +
+                                 "\"pData\" = " + Bytes::formatByteVec(pData) + ", " +
+                                 "\"pAddrOffs\" = " + Bytes::formatHex(pAddrOffs) + ".");
 }
 
 /*!
  * \copybrief MuxedDriver::exec()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled)
+ * after waiting for the configured synthetic latency (see DummyMuxedDriver()).
  */
 void DummyMuxedDriver::exec()
 {
-    logger.logDebug("exec() was called.");
+    simulateLatency();
+
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "exec() was called.");
 }
 
 /*!
  * \copybrief MuxedDriver::isDone()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyMuxedDriver()).
  *
  * \return False.
  */
 bool DummyMuxedDriver::isDone()
 {
-    logger.logDebug("isDone() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "isDone() was called.");
     return false;
 }
 
@@ -107,25 +129,40 @@ bool DummyMuxedDriver::isDone()
 /*!
  * \copybrief MuxedDriver::initImpl()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyMuxedDriver()).
  *
  * \return True.
  */
 bool DummyMuxedDriver::initImpl()
 {
-    logger.logDebug("initImpl() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "initImpl() was called.");
     return true;
 }
 
 /*!
  * \copybrief MuxedDriver::closeImpl()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyMuxedDriver()).
  *
  * \return True.
  */
 bool DummyMuxedDriver::closeImpl()
 {
-    logger.logDebug("closeImpl() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "closeImpl() was called.");
     return true;
 }
+
+//
+
+/*!
+ * \brief Wait for the configured synthetic latency.
+ *
+ * Blocks for the configured "latency" (see DummyMuxedDriver()) with sub-millisecond accuracy (see Auxil::sleepUntil()).
+ */
+void DummyMuxedDriver::simulateLatency() const
+{
+    if (latency.count() > 0)
+        Auxil::sleepUntil(std::chrono::steady_clock::now() + latency);
+}
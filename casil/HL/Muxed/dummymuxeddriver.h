@@ -29,6 +29,7 @@
 #include <casil/layerconfig.h>
 #include <casil/layerfactorymacros.h>
 
+#include <chrono>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -57,6 +58,13 @@ private:
     bool initImpl() override;
     bool closeImpl() override;
 
+private:
+    void simulateLatency() const;               ///< Wait for the configured synthetic latency.
+
+private:
+    const bool silent;                          ///< Suppress the debug logging of function calls.
+    const std::chrono::microseconds latency;    ///< Synthetic latency of every data transfer call.
+
     CASIL_REGISTER_DRIVER_H("DummyMuxedDriver")
 };
 
@@ -63,8 +63,13 @@
 
 #include <boost/dynamic_bitset.hpp>
 
+#include <algorithm>
 #include <bitset>
+#include <exception>
+#include <optional>
+#include <stdexcept>
 #include <utility>
+#include <variant>
 
 using casil::Layers::HL::GPIO;
 
@@ -88,12 +93,31 @@ CASIL_REGISTER_DRIVER_ALIAS("gpio")
 GPIO::GPIO(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig) :
     RegisterDriver(typeName, std::move(pName), pInterface, pConfig, LayerConfig::fromYAML("{size: uint}"), getRegisterDescrs(pConfig)),
     size(config.getUInt("size", 8)),
-    ioBytes(((size - 1) / 8) + 1)
+    ioBytes(((size - 1) / 8) + 1),
+    outputMutex(),
+    outputImageStale(true),
+    monitorThread(),
+    monitorMutex(),
+    monitorCondVar(),
+    monitorStopRequested(false),
+    subscribersMutex(),
+    inputSubscribers(),
+    nextSubscriberId(0)
 {
     if (size == 0)
         throw std::runtime_error("Invalid IO port count set for " + getSelfDescription() + ".");
 }
 
+/*!
+ * \brief Destructor.
+ *
+ * Stops the input monitor (see stopInputMonitor()).
+ */
+GPIO::~GPIO()
+{
+    stopInputMonitor();
+}
+
 //Public
 
 /*!
@@ -120,7 +144,12 @@ std::vector<std::uint8_t> GPIO::getData(int, std::uint32_t)
  */
 void GPIO::setData(const std::vector<std::uint8_t>& pData, std::uint32_t)
 {
+    const std::lock_guard<std::mutex> outputLock(outputMutex);
+    (void)outputLock;
+
     setBytes("OUTPUT", pData);
+
+    outputImageStale = false;
 }
 
 //
@@ -205,6 +234,198 @@ std::vector<std::uint8_t> GPIO::bytesFromBitset(const boost::dynamic_bitset<>& p
     return Bytes::bytesFromBitset(pBits, ioBytes);
 }
 
+//
+
+/*!
+ * \brief Set selected output bits to given values.
+ *
+ * Sets the \c OUTPUT bits selected by \p pMask to the corresponding bits of \p pValues
+ * and leaves all other output bits unchanged. Bit \e i of the masks corresponds to IO bit \e i,
+ * i.e. only the lowest 64 IO bits can be accessed this way.
+ *
+ * The current output state is taken from the last written \c OUTPUT content, so that only a single write
+ * access is needed. The register is read back only once initially and after a reset() (unless setData() was used).
+ *
+ * \throws std::invalid_argument If \p pMask selects bits beyond min(getSize(), 64).
+ * \throws std::runtime_error If reading or writing the \c OUTPUT register fails.
+ *
+ * \param pMask Selection of the output bits to modify.
+ * \param pValues New values for the selected output bits (other bits are ignored).
+ */
+void GPIO::setBits(const std::uint64_t pMask, const std::uint64_t pValues)
+{
+    modifyOutputBits(pMask, pValues, false);
+}
+
+/*!
+ * \brief Set selected output bits to 0.
+ *
+ * Equivalent to setBits() with \p pValues = 0.
+ *
+ * \throws std::invalid_argument If \p pMask selects bits beyond min(getSize(), 64).
+ * \throws std::runtime_error If reading or writing the \c OUTPUT register fails.
+ *
+ * \param pMask Selection of the output bits to clear.
+ */
+void GPIO::clearBits(const std::uint64_t pMask)
+{
+    modifyOutputBits(pMask, 0, false);
+}
+
+/*!
+ * \brief Invert selected output bits.
+ *
+ * Inverts the \c OUTPUT bits selected by \p pMask and leaves all other output bits unchanged.
+ * See setBits() for the bit numbering and the handling of the current output state.
+ *
+ * \throws std::invalid_argument If \p pMask selects bits beyond min(getSize(), 64).
+ * \throws std::runtime_error If reading or writing the \c OUTPUT register fails.
+ *
+ * \param pMask Selection of the output bits to invert.
+ */
+void GPIO::toggleBits(const std::uint64_t pMask)
+{
+    modifyOutputBits(pMask, 0, true);
+}
+
+/*!
+ * \brief Read selected input bits.
+ *
+ * Reads the \c INPUT register and returns its lowest 64 IO bits masked with \p pMask
+ * (bit \e i of the result corresponds to IO bit \e i).
+ *
+ * \throws std::invalid_argument If \p pMask selects bits beyond min(getSize(), 64).
+ * \throws std::runtime_error If reading the \c INPUT register fails.
+ *
+ * \param pMask Selection of the input bits to read.
+ * \return Selected input states (all other bits are 0).
+ */
+std::uint64_t GPIO::readBits(const std::uint64_t pMask)
+{
+    checkBitMask(pMask);
+
+    return wordFromBytes(getBytes("INPUT")) & pMask;
+}
+
+//
+
+/*!
+ * \brief Register a callback for input edges.
+ *
+ * Registers \p pCallback to be called by the input monitor (see startInputMonitor()) whenever
+ * any of the input bits selected by \p pMask changed between two successive polls (see InputEdgeCallback).
+ * Bit \e i of \p pMask corresponds to IO bit \e i, i.e. only the lowest 64 IO bits can be monitored.
+ *
+ * All subscribers share the same \c INPUT register read of each poll. Callbacks are executed
+ * in the monitor thread and should hence return quickly. They must not call stopInputMonitor().
+ *
+ * \throws std::invalid_argument If \p pMask selects bits beyond min(getSize(), 64) or if \p pCallback is empty.
+ *
+ * \param pMask Selection of the input bits to monitor.
+ * \param pCallback Function to call on edges of the selected bits.
+ * \return Subscription ID for unsubscribeInputEdges().
+ */
+int GPIO::subscribeInputEdges(const std::uint64_t pMask, InputEdgeCallback pCallback)
+{
+    checkBitMask(pMask);
+
+    if (!pCallback)
+        throw std::invalid_argument("Empty input edge callback for GPIO driver \"" + name + "\".");
+
+    const std::lock_guard<std::mutex> subscribersLock(subscribersMutex);
+    (void)subscribersLock;
+
+    const int id = nextSubscriberId++;
+
+    inputSubscribers.emplace(id, std::make_pair(pMask, std::move(pCallback)));
+
+    return id;
+}
+
+/*!
+ * \brief Remove an input edge callback.
+ *
+ * Removes a callback registered via subscribeInputEdges(). Does nothing if \p pId is unknown.
+ *
+ * Note that a callback may still be running (or start once more) concurrently while this function returns.
+ *
+ * \param pId Subscription ID as returned by subscribeInputEdges().
+ */
+void GPIO::unsubscribeInputEdges(const int pId)
+{
+    const std::lock_guard<std::mutex> subscribersLock(subscribersMutex);
+    (void)subscribersLock;
+
+    inputSubscribers.erase(pId);
+}
+
+//
+
+/*!
+ * \brief Start polling the inputs in the background.
+ *
+ * Starts a thread that reads the \c INPUT register every \p pPeriod, compares the lowest 64 input bits to
+ * the previous poll and notifies the subscribers (see subscribeInputEdges()) about bits that changed.
+ * The first poll only records the initial state. Failed reads are logged and skipped.
+ *
+ * If the monitor is already running it is restarted with the new period.
+ *
+ * Note: The \e gpio firmware module has no edge detection or interrupt logic, hence the inputs are always polled.
+ *
+ * \throws std::invalid_argument If \p pPeriod is not positive.
+ *
+ * \param pPeriod Time between two successive \c INPUT reads.
+ */
+void GPIO::startInputMonitor(const std::chrono::milliseconds pPeriod)
+{
+    if (pPeriod <= std::chrono::milliseconds::zero())
+        throw std::invalid_argument("Input monitor period must be positive for GPIO driver \"" + name + "\".");
+
+    stopInputMonitor();
+
+    const std::lock_guard<std::mutex> monitorLock(monitorMutex);
+    (void)monitorLock;
+
+    monitorStopRequested = false;
+    monitorThread = std::thread(&GPIO::runInputMonitor, this, pPeriod);
+}
+
+/*!
+ * \brief Stop the background input polling.
+ *
+ * Stops the thread started by startInputMonitor() and waits for it to finish. Does nothing if not running.
+ */
+void GPIO::stopInputMonitor()
+{
+    std::thread thread;
+
+    {
+        const std::lock_guard<std::mutex> monitorLock(monitorMutex);
+        (void)monitorLock;
+
+        monitorStopRequested = true;
+        thread = std::move(monitorThread);
+    }
+
+    monitorCondVar.notify_all();
+
+    if (thread.joinable())
+        thread.join();
+}
+
+/*!
+ * \brief Check if the input monitor is running.
+ *
+ * \return True if the input monitor was started and not stopped yet.
+ */
+bool GPIO::inputMonitorRunning() const
+{
+    const std::lock_guard<std::mutex> monitorLock(monitorMutex);
+    (void)monitorLock;
+
+    return monitorThread.joinable();
+}
+
 //Private
 
 /*!
@@ -213,10 +434,20 @@ std::vector<std::uint8_t> GPIO::bytesFromBitset(const boost::dynamic_bitset<>& p
  * Warns if unsupported "init.output_en" is present in the component configuration
  * (direct default override via "init.OUTPUT_EN" must be used).
  *
+ * Considers the written value cache of \c OUTPUT as outdated (see \ref outputImageStale), since the module was reset
+ * (possibly by RegisterDriver::prepareGroupInit() without calling resetImpl()).
+ *
  * \return True
  */
 bool GPIO::initModule()
 {
+    {
+        const std::lock_guard<std::mutex> outputLock(outputMutex);
+        (void)outputLock;
+
+        outputImageStale = true;
+    }
+
     if (config.contains(LayerConfig::fromYAML("{init: {output_en: string}}"), true))
     {
         logger.logWarning("The \"init.output_en\" setting is unsupported but set. "
@@ -226,6 +457,20 @@ bool GPIO::initModule()
     return true;
 }
 
+/*!
+ * \copybrief RegisterDriver::closeModule()
+ *
+ * Stops the input monitor (see stopInputMonitor()).
+ *
+ * \return True.
+ */
+bool GPIO::closeModule()
+{
+    stopInputMonitor();
+
+    return true;
+}
+
 //
 
 /*!
@@ -238,6 +483,11 @@ bool GPIO::initModule()
 void GPIO::resetImpl()
 {
     setValue("RESET", 0);
+
+    const std::lock_guard<std::mutex> outputLock(outputMutex);
+    (void)outputLock;
+
+    outputImageStale = true;
 }
 
 //
@@ -268,6 +518,188 @@ std::uint8_t GPIO::getModuleFirmwareVersion()
 
 //
 
+/*!
+ * \copybrief RegisterDriver::getResetRegisterWrite()
+ *
+ * \return The \c RESET register with value 0 (see resetImpl()).
+ */
+std::optional<std::pair<std::string, std::uint64_t>> GPIO::getResetRegisterWrite() const
+{
+    return std::pair<std::string, std::uint64_t>("RESET", 0);
+}
+
+/*!
+ * \copybrief RegisterDriver::getVersionRegister()
+ *
+ * \return The \c VERSION register (see getModuleFirmwareVersion()).
+ */
+std::optional<std::string> GPIO::getVersionRegister() const
+{
+    return "VERSION";
+}
+
+//
+
+/*!
+ * \brief Read-modify-write selected \c OUTPUT bits.
+ *
+ * Takes the current output state from the written value cache of the \c OUTPUT register (or reads the register
+ * if that state may be outdated, see \ref outputImageStale), replaces (or inverts, if \p pToggle is true)
+ * the bits selected by \p pMask and writes the new state with a single register access.
+ *
+ * \throws std::invalid_argument If \p pMask selects bits beyond min(getSize(), 64).
+ * \throws std::runtime_error If reading or writing the \c OUTPUT register fails.
+ *
+ * \param pMask Selection of the output bits to modify.
+ * \param pValues New values for the selected output bits (ignored if \p pToggle is true).
+ * \param pToggle Invert the selected bits instead of setting them to \p pValues.
+ */
+void GPIO::modifyOutputBits(const std::uint64_t pMask, const std::uint64_t pValues, const bool pToggle)
+{
+    checkBitMask(pMask);
+
+    const std::lock_guard<std::mutex> outputLock(outputMutex);
+    (void)outputLock;
+
+    std::vector<std::uint8_t> image;
+
+    if (!outputImageStale)
+    {
+        RegisterDescr::VariantValueType cachedVal = getWrittenValue("OUTPUT");
+
+        if (std::holds_alternative<std::vector<std::uint8_t>>(cachedVal))
+            image = std::move(std::get<std::vector<std::uint8_t>>(cachedVal));
+    }
+
+    if (image.size() != ioBytes)
+        image = getBytes("OUTPUT");
+
+    const std::uint64_t oldWord = wordFromBytes(image);
+    const std::uint64_t newWord = pToggle ? (oldWord ^ pMask) : ((oldWord & ~pMask) | (pValues & pMask));
+
+    for (std::uint32_t i = 0; i < std::min(ioBytes, 8u); ++i)
+        image[ioBytes - 1 - i] = static_cast<std::uint8_t>(newWord >> (8 * i));
+
+    setBytes("OUTPUT", image);
+
+    outputImageStale = false;
+}
+
+//
+
+/*!
+ * \brief Polling loop of the input monitor thread.
+ *
+ * Reads the \c INPUT register every \p pPeriod until stopInputMonitor() is called
+ * and passes changed bits to dispatchInputEdges().
+ *
+ * \param pPeriod Time between two successive \c INPUT reads.
+ */
+void GPIO::runInputMonitor(const std::chrono::milliseconds pPeriod)
+{
+    std::optional<std::uint64_t> lastState;
+
+    std::unique_lock<std::mutex> monitorLock(monitorMutex);
+
+    while (!monitorStopRequested)
+    {
+        monitorLock.unlock();
+
+        try
+        {
+            const std::uint64_t state = wordFromBytes(getBytes("INPUT"));
+
+            if (lastState.has_value() && state != lastState.value())
+                dispatchInputEdges(state, state ^ lastState.value());
+
+            lastState = state;
+        }
+        catch (const std::runtime_error& exc)
+        {
+            logger.logWarning(std::string("Input monitor could not read inputs: ") + exc.what());
+        }
+
+        monitorLock.lock();
+
+        monitorCondVar.wait_for(monitorLock, pPeriod, [this]() -> bool { return monitorStopRequested; });
+    }
+}
+
+/*!
+ * \brief Notify subscribers about changed input bits.
+ *
+ * Calls every subscribed callback whose mask overlaps with \p pChanged (see subscribeInputEdges()).
+ * Exceptions thrown by callbacks are logged and otherwise ignored.
+ *
+ * \param pState New input state.
+ * \param pChanged Input bits that changed since the previous poll.
+ */
+void GPIO::dispatchInputEdges(const std::uint64_t pState, const std::uint64_t pChanged)
+{
+    std::vector<std::pair<std::uint64_t, InputEdgeCallback>> subscribers;
+
+    {
+        const std::lock_guard<std::mutex> subscribersLock(subscribersMutex);
+        (void)subscribersLock;
+
+        for (const auto& [id, subscriber] : inputSubscribers)
+        {
+            if ((subscriber.first & pChanged) != 0)
+                subscribers.push_back(subscriber);
+        }
+    }
+
+    for (const auto& [mask, callback] : subscribers)
+    {
+        const std::uint64_t changed = pChanged & mask;
+
+        try
+        {
+            callback(pState & mask, changed & pState, changed & ~pState);
+        }
+        catch (const std::exception& exc)
+        {
+            logger.logWarning(std::string("Input edge callback failed: ") + exc.what());
+        }
+    }
+}
+
+//
+
+/*!
+ * \brief Check that a bit mask only selects existing IO bits.
+ *
+ * \throws std::invalid_argument If \p pMask selects bits beyond min(getSize(), 64).
+ *
+ * \param pMask The bit mask to check.
+ */
+void GPIO::checkBitMask(const std::uint64_t pMask) const
+{
+    if (size < 64 && (pMask >> size) != 0)
+        throw std::invalid_argument("Bit mask exceeds the IO bit count of GPIO driver \"" + name + "\".");
+}
+
+/*!
+ * \brief Get the lowest 64 IO bits from register bytes.
+ *
+ * Converts the last (up to) eight bytes of \p pBytes (big endian, i.e. the last byte contains IO bits 0 to 7)
+ * to an integer such that bit \e i corresponds to IO bit \e i.
+ *
+ * \param pBytes Full IO register bytes (size equal to ((getSize() - 1) / 8) + 1).
+ * \return The lowest 64 IO bits.
+ */
+std::uint64_t GPIO::wordFromBytes(const std::vector<std::uint8_t>& pBytes) const
+{
+    std::uint64_t word = 0;
+
+    for (std::uint32_t i = 0; i < std::min(ioBytes, 8u); ++i)
+        word |= static_cast<std::uint64_t>(pBytes[ioBytes - 1 - i]) << (8 * i);
+
+    return word;
+}
+
+//
+
 /*!
  * \brief Generate the map of registers depending on the configured bit count.
  *
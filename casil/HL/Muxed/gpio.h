@@ -67,10 +67,16 @@
 
 #include <boost/dynamic_bitset_fwd.hpp>
 
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <functional>
 #include <map>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace casil
@@ -97,12 +103,23 @@ namespace Layers::HL
  * </table>
  *
  * Here \c IO_BYTES is the number of full register bytes occupied by the configured IO bits (see "size" in GPIO::GPIO()).
+ *
+ * Changes of the input states can be monitored in the background (see startInputMonitor() and subscribeInputEdges()).
  */
 class GPIO final : public RegisterDriver
 {
+public:
+    /*!
+     * \brief Callback type for input edge notifications (see subscribeInputEdges()).
+     *
+     * Arguments are the new input state, the bits with a rising edge and the bits with a falling edge,
+     * each restricted to the subscribed bit mask (bit \e i corresponds to IO bit \e i).
+     */
+    typedef std::function<void(std::uint64_t pState, std::uint64_t pRising, std::uint64_t pFalling)> InputEdgeCallback;
+
 public:
     GPIO(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig);                    ///< Constructor.
-    ~GPIO() override = default;                                                                     ///< Default destructor.
+    ~GPIO() override;                                                                               ///< Destructor.
     //
     std::vector<std::uint8_t> getData(int pSize = -1, std::uint32_t pAddrOffs = 0) override;        ///< Get the \c INPUT register.
     void setData(const std::vector<std::uint8_t>& pData, std::uint32_t pAddrOffs = 0) override;     ///< Set the \c OUTPUT register.
@@ -114,15 +131,39 @@ public:
     //
     boost::dynamic_bitset<> bitsetFromBytes(const std::vector<std::uint8_t>& pBytes) const;         ///< Convert IO register bytes to a bitset.
     std::vector<std::uint8_t> bytesFromBitset(const boost::dynamic_bitset<>& pBits) const;          ///< Convert a bitset to IO register bytes.
+    //
+    void setBits(std::uint64_t pMask, std::uint64_t pValues);                                       ///< Set selected output bits to given values.
+    void clearBits(std::uint64_t pMask);                                                            ///< Set selected output bits to 0.
+    void toggleBits(std::uint64_t pMask);                                                           ///< Invert selected output bits.
+    std::uint64_t readBits(std::uint64_t pMask);                                                    ///< Read selected input bits.
+    //
+    int subscribeInputEdges(std::uint64_t pMask, InputEdgeCallback pCallback);                      ///< Register a callback for input edges.
+    void unsubscribeInputEdges(int pId);                                                            ///< Remove an input edge callback.
+    //
+    void startInputMonitor(std::chrono::milliseconds pPeriod);                                      ///< Start polling the inputs in the background.
+    void stopInputMonitor();                                                                        ///< Stop the background input polling.
+    bool inputMonitorRunning() const;                                                               ///< Check if the input monitor is running.
 
 private:
     bool initModule() override;
+    bool closeModule() override;
     //
     void resetImpl() override;
     //
     std::uint8_t getModuleSoftwareVersion() const override;
     std::uint8_t getModuleFirmwareVersion() override;
     //
+    std::optional<std::pair<std::string, std::uint64_t>> getResetRegisterWrite() const override;
+    std::optional<std::string> getVersionRegister() const override;
+    //
+    void modifyOutputBits(std::uint64_t pMask, std::uint64_t pValues, bool pToggle);   ///< Read-modify-write selected \c OUTPUT bits.
+    //
+    void runInputMonitor(std::chrono::milliseconds pPeriod);                            ///< Polling loop of the input monitor thread.
+    void dispatchInputEdges(std::uint64_t pState, std::uint64_t pChanged);              ///< Notify subscribers about changed input bits.
+    //
+    void checkBitMask(std::uint64_t pMask) const;                                       ///< Check that a bit mask only selects existing IO bits.
+    std::uint64_t wordFromBytes(const std::vector<std::uint8_t>& pBytes) const;         ///< Get the lowest 64 IO bits from register bytes.
+    //
     static std::map<std::string, RegisterDescr, std::less<>> getRegisterDescrs(const LayerConfig& pConfig);
                                                                                                     ///< \brief Generate the map of registers
                                                                                                     ///  depending on the configured bit count.
@@ -130,6 +171,20 @@ private:
 private:
     const std::uint64_t size;                                   ///< Number of IO bits.
     const std::uint32_t ioBytes;                                ///< Number of register bytes occupied by \ref size bits.
+    //
+    std::mutex outputMutex;                                     ///< Serializes read-modify-write sequences on the \c OUTPUT register.
+    bool outputImageStale;                                      ///< \brief Whether the written value cache of \c OUTPUT may not reflect
+                                                                ///  the module state (initially and after reset).
+    //
+    std::thread monitorThread;                                  ///< Background thread polling the \c INPUT register (see startInputMonitor()).
+    mutable std::mutex monitorMutex;                            ///< Mutex for \ref monitorThread and \ref monitorStopRequested.
+    std::condition_variable monitorCondVar;                     ///< Condition variable to wake the monitor thread for stopping.
+    bool monitorStopRequested;                                  ///< Flags the monitor thread to exit.
+    //
+    std::mutex subscribersMutex;                                ///< Mutex for \ref inputSubscribers and \ref nextSubscriberId.
+    std::map<int, std::pair<std::uint64_t, InputEdgeCallback>> inputSubscribers;
+                                                                ///< Input edge callbacks with their bit masks by subscription ID.
+    int nextSubscriberId;                                       ///< ID for the next subscribeInputEdges() call.
 
 private:
     static constexpr std::uint8_t requireFirmwareVersion = 0;   ///< Compatible version of the controlled firmware module.
@@ -60,8 +60,12 @@
 #include <casil/HL/Muxed/sitcpfifo.h>
 
 #include <casil/bytes.h>
+#include <casil/pooledbuffer.h>
 #include <casil/TL/Muxed/sitcp.h>
 
+#include <algorithm>
+#include <limits>
+#include <mutex>
 #include <span>
 #include <stdexcept>
 #include <utility>
@@ -73,10 +77,23 @@ CASIL_REGISTER_DRIVER_ALIAS("sitcp_fifo")
 
 //
 
+struct SiTCPFifo::BlockPool
+{
+    std::mutex mutex;                                               ///< Mutex for \ref freeBlocks.
+    std::vector<std::unique_ptr<std::vector<std::uint32_t>>> freeBlocks;  ///< Unused blocks (keeping their capacity).
+};
+
 /*!
  * \brief Constructor.
  *
+ * Subscribes to the FIFO of \p pInterface if the configuration key "subscribe" is set (see TL::SiTCP::subscribeFifo()).
+ *
+ * The configuration key "write_chunk_size" sets the maximum number of bytes per %TCP write for setFifoData()
+ * (default \ref defaultWriteChunkSize). It must be a non-zero multiple of 4.
+ *
  * \throws std::bad_cast If \p pInterface is not TL::SiTCP.
+ * \throws std::runtime_error If "write_chunk_size" is zero or not a multiple of 4.
+ * \throws std::runtime_error If TL::SiTCP::subscribeFifo() throws \c std::runtime_error.
  *
  * \param pName Component instance name.
  * \param pInterface %Interface instance to be used.
@@ -84,8 +101,13 @@ CASIL_REGISTER_DRIVER_ALIAS("sitcp_fifo")
  */
 SiTCPFifo::SiTCPFifo(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig) :
     MuxedDriver(typeName, std::move(pName), pInterface, std::move(pConfig), LayerConfig()),
-    siTcpIntf(dynamic_cast<SiTCP&>(interface))  //Possible exception will be caught by macro-registered factory generator
+    siTcpIntf(dynamic_cast<SiTCP&>(interface)), //Possible exception will be caught by macro-registered factory generator
+    fifoSubscription(config.getBool("subscribe", false) ? siTcpIntf.subscribeFifo() : nullptr),
+    writeChunkSize(config.getUInt("write_chunk_size", defaultWriteChunkSize)),
+    blockPool(std::make_shared<BlockPool>())
 {
+    if (writeChunkSize == 0 || writeChunkSize % 4 != 0)
+        throw std::runtime_error("Invalid FIFO write chunk size set for " + getSelfDescription() + ".");
 }
 
 //Public
@@ -124,7 +146,7 @@ std::size_t SiTCPFifo::operator[](std::string_view pRegName)
 /*!
  * \brief Reset the FIFO.
  *
- * See TL::SiTCP::resetFifo().
+ * See TL::SiTCP::resetFifo() or, if subscribed to the FIFO (see SiTCPFifo()), TL::SiTCPFifoSubscription::resetFifo().
  *
  * \throws std::runtime_error If TL::SiTCP::resetFifo() throws \c std::runtime_error.
  */
@@ -132,7 +154,10 @@ void SiTCPFifo::reset()
 {
     try
     {
-        siTcpIntf.resetFifo();
+        if (fifoSubscription)
+            fifoSubscription->resetFifo();
+        else
+            siTcpIntf.resetFifo();
     }
     catch (const std::runtime_error& exc)
     {
@@ -152,17 +177,32 @@ std::uint8_t SiTCPFifo::getVersion() const
     return pseudoVersion;
 }
 
+/*!
+ * \brief Get the %SiTCP interface that provides the FIFO.
+ *
+ * Allows to read the FIFO by other means than this driver, e.g. via FifoStream.
+ *
+ * \return The used interface.
+ */
+casil::TL::SiTCP& SiTCPFifo::getSiTCPInterface() const
+{
+    return siTcpIntf;
+}
+
 //
 
 /*!
  * \brief Get the FIFO size in number of bytes.
  *
- * See TL::SiTCP::getFifoSize().
+ * See TL::SiTCP::getFifoSize() or, if subscribed to the FIFO (see SiTCPFifo()), TL::SiTCPFifoSubscription::getFifoSize().
  *
  * \return Current size of the \e %SiTCP FIFO.
  */
 std::size_t SiTCPFifo::getFifoSize() const
 {
+    if (fifoSubscription)
+        return fifoSubscription->getFifoSize();
+
     return siTcpIntf.getFifoSize();
 }
 
@@ -173,66 +213,190 @@ std::size_t SiTCPFifo::getFifoSize() const
  * from which it generates and then returns a sequence of \c N 32 bit unsigned integers,
  * assuming a little endian byte order.
  *
- * See also TL::SiTCP::getFifoData().
+ * See also TL::SiTCP::consumeFifo() and TL::SiTCPFifoSubscription::consumeFifo() (if subscribed to the FIFO, see SiTCPFifo()).
  *
- * \throws std::runtime_error If TL::SiTCP::getFifoData() or TL::SiTCP::getFifoSize() throw \c std::runtime_error.
- * \throws std::runtime_error If TL::SiTCP::getFifoData() fails to exactly return a multiple of 4 bytes (should not really happen).
+ * \throws std::runtime_error If consumeFifo() throws \c std::runtime_error.
  *
  * \return Longest sequence of 32 bit unsigned integers currently in the \e %SiTCP FIFO.
  */
 std::vector<std::uint32_t> SiTCPFifo::getFifoData() const
 {
-    std::size_t retSize;
-    std::vector<std::uint8_t> rawData;
+    std::vector<std::uint32_t> retVal;
+
     try
     {
-        retSize = siTcpIntf.getFifoSize() / 4;
-        rawData = siTcpIntf.getFifoData(retSize * 4);
+        consumeFifo([&retVal](const std::span<const std::uint32_t> pFirst, const std::span<const std::uint32_t> pSecond)
+                    {
+                        retVal.reserve(pFirst.size() + pSecond.size());
+                        retVal.insert(retVal.end(), pFirst.begin(), pFirst.end());
+                        retVal.insert(retVal.end(), pSecond.begin(), pSecond.end());
+                    });
     }
     catch (const std::runtime_error& exc)
     {
         throw std::runtime_error("SiTCP FIFO driver \"" + name + "\" could not get FIFO data: " + exc.what());
     }
 
-    if (rawData.size() != retSize * 4)
-        throw std::runtime_error("SiTCP interface returned wrong number of FIFO bytes.");
+    return retVal;
+}
 
-    std::vector<std::uint32_t> retVal;
-    retVal.reserve(retSize);
+/*!
+ * \brief Read the FIFO content into a pooled block of 32 bit words.
+ *
+ * Works like getFifoData() but returns the data in a block whose memory is taken from (and, once the last
+ * reference to it is released, given back to) a small pool of the driver. With a steady readout loop
+ * the block memory is hence allocated only once instead of for every call.
+ *
+ * \throws std::runtime_error If consumeFifo() throws \c std::runtime_error.
+ *
+ * \return Longest sequence of 32 bit unsigned integers currently in the \e %SiTCP FIFO.
+ */
+SiTCPFifo::DataBlockType SiTCPFifo::getFifoDataBlock() const
+{
+    std::unique_ptr<std::vector<std::uint32_t>> block;
+
+    {
+        const std::lock_guard<std::mutex> poolLock(blockPool->mutex);
+        (void)poolLock;
 
-    for (std::size_t i = 0; i < retSize; ++i)
-        retVal.push_back(Bytes::composeUInt32(std::span<const std::uint8_t, 4>(rawData.begin() + 4*i, 4), false));
+        if (!blockPool->freeBlocks.empty())
+        {
+            block = std::move(blockPool->freeBlocks.back());
+            blockPool->freeBlocks.pop_back();
+        }
+    }
 
-    return retVal;
+    if (!block)
+        block = std::make_unique<std::vector<std::uint32_t>>();
+
+    block->clear();
+
+    try
+    {
+        consumeFifo([&block](const std::span<const std::uint32_t> pFirst, const std::span<const std::uint32_t> pSecond)
+                    {
+                        block->reserve(pFirst.size() + pSecond.size());
+                        block->insert(block->end(), pFirst.begin(), pFirst.end());
+                        block->insert(block->end(), pSecond.begin(), pSecond.end());
+                    });
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("SiTCP FIFO driver \"" + name + "\" could not get FIFO data: " + exc.what());
+    }
+
+    return DataBlockType(block.release(), [pool = blockPool](std::vector<std::uint32_t>* pBlock)
+                                          {
+                                              std::unique_ptr<std::vector<std::uint32_t>> tBlock(pBlock);
+
+                                              const std::lock_guard<std::mutex> poolLock(pool->mutex);
+                                              (void)poolLock;
+
+                                              if (pool->freeBlocks.size() < maxPooledBlocks)
+                                                  pool->freeBlocks.push_back(std::move(tBlock));
+                                          });
+}
+
+/*!
+ * \brief Read FIFO content into a buffer of 32 bit words.
+ *
+ * Works like getFifoData() but writes the data to \p pBuffer instead of a newly allocated vector
+ * and extracts at most as many words as fit into \p pBuffer. Remaining data stays in the FIFO.
+ *
+ * \throws std::runtime_error If consumeFifo() throws \c std::runtime_error.
+ *
+ * \param pBuffer Destination for the FIFO data words.
+ * \return Number of words written to \p pBuffer.
+ */
+std::size_t SiTCPFifo::getFifoDataInto(const std::span<std::uint32_t> pBuffer) const
+{
+    if (pBuffer.empty())
+        return 0;
+
+    std::size_t numWords = 0;
+
+    try
+    {
+        consumeFifo([&pBuffer, &numWords](const std::span<const std::uint32_t> pFirst, const std::span<const std::uint32_t> pSecond)
+                    {
+                        std::copy(pFirst.begin(), pFirst.end(), pBuffer.begin());
+                        std::copy(pSecond.begin(), pSecond.end(), pBuffer.begin() + pFirst.size());
+                        numWords = pFirst.size() + pSecond.size();
+                    },
+                    static_cast<int>(std::min<std::size_t>(pBuffer.size(), std::numeric_limits<int>::max() / 4) * 4));
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("SiTCP FIFO driver \"" + name + "\" could not get FIFO data: " + exc.what());
+    }
+
+    return numWords;
 }
 
 /*!
  * \brief Write a sequence of 32 bit unsigned integers to the FIFO.
  *
+ * Same as setFifoData(std::span<const std::uint32_t>) const.
+ *
+ * \throws std::runtime_error If TL::SiTCP::writeFifoChunks() throws \c std::runtime_error.
+ *
+ * \param pData Sequence of 32 bit unsigned integers to write to the \e %SiTCP FIFO as bytes.
+ */
+void SiTCPFifo::setFifoData(const std::vector<std::uint32_t>& pData) const
+{
+    setFifoData(std::span<const std::uint32_t>(pData));
+}
+
+/*!
+ * \brief Write a sequence of 32 bit unsigned integers to the FIFO in chunks.
+ *
  * Creates a sequence of \c 4*N bytes from the \c N elements of \p pData and writes this sequence to
- * the FIFO by calling TL::SiTCP::write() using the special address TL::SiTCP::baseAddrDataLimit.
- * Each 32 bit unsigned integer will be represented as 4 bytes in little endian byte order.
+ * the FIFO by calling TL::SiTCP::writeFifoChunks() (same as TL::SiTCP::writeFrom() using the special
+ * address TL::SiTCP::baseAddrDataLimit). Each 32 bit unsigned integer will be represented as 4 bytes
+ * in little endian byte order.
+ *
+ * The data is encoded and written in chunks of at most "write_chunk_size" bytes (see SiTCPFifo()), reusing
+ * a single pooled buffer (see PooledBuffer). Since every %TCP write blocks until the chunk is sent, the next chunk
+ * is only encoded once the socket accepted the previous one, which keeps the memory usage bounded for large \p pData.
+ * The interface's %TCP write mutex is held over all chunks, so that concurrent calls (e.g. from multiple Device
+ * instances sharing the interface) or other %TCP writes to the interface cannot interleave with the data.
  *
  * See also TL::SiTCP::getFifoData().
  *
- * \throws std::runtime_error If TL::SiTCP::write() throws \c std::runtime_error.
+ * \throws std::runtime_error If TL::SiTCP::writeFifoChunks() throws \c std::runtime_error.
  *
  * \param pData Sequence of 32 bit unsigned integers to write to the \e %SiTCP FIFO as bytes.
  */
-void SiTCPFifo::setFifoData(const std::vector<std::uint32_t>& pData) const
+void SiTCPFifo::setFifoData(const std::span<const std::uint32_t> pData) const
 {
-    const std::size_t retSize = pData.size() * 4;
+    if (pData.empty())
+        return;
+
+    const std::size_t chunkWords = std::min<std::size_t>(pData.size(), writeChunkSize / 4);
+
+    PooledBuffer buffer(chunkWords * 4);
+
+    std::size_t offset = 0;
+
+    //Encodes the next chunk into the reused buffer (empty when done)
+    auto nextChunk = [&pData, chunkWords, &buffer, &offset]() -> std::span<const std::uint8_t>
+    {
+        if (offset >= pData.size())
+            return {};
+
+        const std::span<const std::uint32_t> words = pData.subspan(offset, std::min<std::size_t>(chunkWords, pData.size() - offset));
+        const std::span<std::uint8_t> bytes = buffer.span().first(words.size() * 4);
+
+        Bytes::encodeUInt32LE(words, bytes);
 
-    std::vector<std::uint8_t> bytes;
-    bytes.reserve(retSize);
+        offset += words.size();
 
-    for (std::size_t i = 0; i < pData.size(); ++i)
-        for (std::uint8_t val : Bytes::composeByteVec(false, pData[i]))
-            bytes.push_back(val);                                                                       //cppcheck-suppress useStlAlgorithm
+        return bytes;
+    };
 
     try
     {
-        siTcpIntf.write(SiTCP::baseAddrDataLimit, bytes);
+        siTcpIntf.writeFifoChunks(nextChunk);
     }
     catch (const std::runtime_error& exc)
     {
@@ -261,3 +425,25 @@ bool SiTCPFifo::closeImpl()
 {
     return true;
 }
+
+//
+
+/*!
+ * \brief Pass the FIFO content in place to a function and remove it.
+ *
+ * Calls TL::SiTCPFifoSubscription::consumeFifo() if subscribed to the FIFO (see SiTCPFifo()) and TL::SiTCP::consumeFifo() otherwise.
+ *
+ * \throws std::runtime_error If TL::SiTCP::consumeFifo() throws \c std::runtime_error.
+ *
+ * \param pConsumer Function to process the FIFO data words.
+ * \param pSize Number of FIFO bytes to pass (automatically reduced by modulo 4).
+ * \return Number of passed (and removed) bytes.
+ */
+std::size_t SiTCPFifo::consumeFifo(const std::function<void(std::span<const std::uint32_t>, std::span<const std::uint32_t>)>& pConsumer,
+                                   const int pSize) const
+{
+    if (fifoSubscription)
+        return fifoSubscription->consumeFifo(pConsumer, pSize);
+
+    return siTcpIntf.consumeFifo(pConsumer, pSize);
+}
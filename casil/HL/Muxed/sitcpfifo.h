@@ -67,6 +67,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -75,6 +78,7 @@ namespace casil
 {
 
 namespace Layers::TL { class SiTCP; }
+namespace Layers::TL { class SiTCPFifoSubscription; }
 
 namespace Layers::HL
 {
@@ -85,9 +89,26 @@ namespace Layers::HL
  * Provides access to the %SiTCP FIFO (see TL::SiTCP) in a way similar to / mimicking the register drivers
  * for the \e bram_fifo and \e sram_fifo firmware modules. Note that no firmware module is available for
  * this driver and that it \e only works in combination with the \ref casil::TL::SiTCP "SiTCP" interface.
+ *
+ * For high data rates the FIFO content can be read into reused memory instead of a newly allocated
+ * vector, either into a pooled block (see getFifoDataBlock()) or into a caller-provided buffer (see getFifoDataInto()).
+ *
+ * If the configuration key "subscribe" is set to true, the driver reads its own copy of the FIFO data stream via
+ * a FIFO subscription (see TL::SiTCP::subscribeFifo()) instead of the FIFO of the interface. This allows multiple
+ * drivers (e.g. of multiple Device instances that share the interface, see InterfaceRegistry) to receive the same
+ * data independently. reset() then only discards the data of this driver's subscription. Note that drivers without
+ * "subscribe" cannot read the FIFO of the interface while subscriptions exist (see TL::SiTCP::subscribeFifo()).
+ *
+ * Large amounts of data (e.g. for pattern playback) are written to the FIFO in chunks of configurable size
+ * (configuration key "write_chunk_size" in bytes, default \ref defaultWriteChunkSize), see setFifoData().
  */
 class SiTCPFifo final : public MuxedDriver
 {
+public:
+    using DataBlockType = std::shared_ptr<const std::vector<std::uint32_t>>;
+                                                        ///< \brief Block of FIFO data words whose memory is returned to
+                                                        ///  a pool of the driver when the last reference is released.
+
 public:
     SiTCPFifo(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig);   ///< Constructor.
     ~SiTCPFifo() override = default;                                                    ///< Default destructor.
@@ -97,21 +118,36 @@ public:
     void reset() override;                                              ///< Reset the FIFO.
     //
     std::uint8_t getVersion() const;                                    ///< Get the pseudo FIFO module version.
+    TL::SiTCP& getSiTCPInterface() const;                               ///< Get the %SiTCP interface that provides the FIFO.
     //
     std::size_t getFifoSize() const;                                    ///< Get the FIFO size in number of bytes.
     std::vector<std::uint32_t> getFifoData() const;                     ///< Read the FIFO content as sequence of 32 bit unsigned integers.
+    DataBlockType getFifoDataBlock() const;                             ///< Read the FIFO content into a pooled block of 32 bit words.
+    std::size_t getFifoDataInto(std::span<std::uint32_t> pBuffer) const;    ///< Read FIFO content into a buffer of 32 bit words.
     void setFifoData(const std::vector<std::uint32_t>& pData) const;    ///< Write a sequence of 32 bit unsigned integers to the FIFO.
+    void setFifoData(std::span<const std::uint32_t> pData) const;       ///< Write a sequence of 32 bit unsigned integers to the FIFO in chunks.
 
 private:
     bool initImpl() override;                           ///< Initialize the driver by doing nothing.
     bool closeImpl() override;                          ///< Close the driver by doing nothing.
+    //
+    std::size_t consumeFifo(const std::function<void(std::span<const std::uint32_t>, std::span<const std::uint32_t>)>& pConsumer,
+                            int pSize = -1) const;      ///< Pass the FIFO content in place to a function and remove it.
 
 private:
     using SiTCP = TL::SiTCP;                            ///< \copybrief casil::Layers::TL::SiTCP
     SiTCP& siTcpIntf;                                   ///< The \ref MuxedDriver::interface "interface" instance casted to needed SiTCP type.
+    const std::shared_ptr<TL::SiTCPFifoSubscription> fifoSubscription;  ///< FIFO subscription (if "subscribe" set, else \c nullptr).
+    const std::size_t writeChunkSize;                   ///< Maximum number of bytes per %TCP write for setFifoData().
+    //
+    struct BlockPool;                                   ///< Pool of reusable word vectors for getFifoDataBlock().
+    const std::shared_ptr<BlockPool> blockPool;         ///< \brief Shared with the deleters of returned blocks
+                                                        ///  such that blocks may outlive the driver.
 
 private:
     static constexpr std::uint8_t pseudoVersion = 0;    ///< Need to provide a fake version of the non-existent firmware module.
+    static constexpr std::size_t maxPooledBlocks = 4;   ///< Maximum number of unused blocks kept in \ref blockPool.
+    static constexpr std::uint64_t defaultWriteChunkSize = 1048576; ///< Default maximum number of bytes per %TCP write for setFifoData().
 
     CASIL_REGISTER_DRIVER_H("SiTCPFifo")
 };
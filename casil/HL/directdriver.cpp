@@ -47,6 +47,20 @@ DirectDriver::DirectDriver(std::string pType, std::string pName, InterfaceBaseTy
 {
 }
 
+//Public
+
+/*!
+ * \brief Queue a task for serialized execution on the asynchronous executor of the used interface.
+ *
+ * Forwards \p pTask to TL::Interface::postAsync() of the used interface.
+ *
+ * \param pTask Task to be executed.
+ */
+void DirectDriver::postAsync(std::function<void()> pTask) const
+{
+    interface.postAsync(std::move(pTask));
+}
+
 //Private
 
 /*!
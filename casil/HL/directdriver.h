@@ -30,6 +30,7 @@
 #include <casil/TL/directinterface.h>
 
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -60,6 +61,9 @@ public:
     DirectDriver(std::string pType, std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig, const LayerConfig& pRequiredConfig);
                                             ///< Constructor.
     ~DirectDriver() override = default;     ///< Default destructor.
+    //
+    void postAsync(std::function<void()> pTask) const override final;  ///< \brief Queue a task for serialized execution on
+                                                                        ///  the asynchronous executor of the used interface.
 
 private:
     std::vector<std::uint8_t> getData(int pSize = -1, std::uint32_t pAddrOffs = 0) override final;      ///< \brief Override not intended to
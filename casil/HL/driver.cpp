@@ -23,6 +23,9 @@
 
 #include <casil/HL/driver.h>
 
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
 #include <utility>
 
 using casil::Layers::HL::Driver;
@@ -53,3 +56,92 @@ void Driver::reset()
 {
     //(sic!)
 }
+
+/*!
+ * \brief Check if setData() supports partial writes at a byte offset.
+ *
+ * Drivers that interpret the address offset of setData() as byte offset into their data and accept byte sequences
+ * shorter than their data (i.e. partial writes) must override this to return true. This allows e.g.
+ * RL::StandardRegister::writeDirty() to only write the changed parts of a register.
+ *
+ * Returns false (override for specific drivers if needed).
+ *
+ * \return False.
+ */
+bool Driver::supportsAddressOffset() const
+{
+    return false;
+}
+
+//
+
+/*!
+ * \brief Wait for a driver-specific action to finish (default policy).
+ *
+ * Calls waitUntilDone(std::chrono::milliseconds, const WaitPolicy&) with a default-constructed WaitPolicy.
+ *
+ * \throws std::runtime_error If isDone() throws \c std::runtime_error.
+ *
+ * \param pTimeout Maximum time to wait.
+ * \return True if finished and false on timeout.
+ */
+bool Driver::waitUntilDone(const std::chrono::milliseconds pTimeout)
+{
+    return waitUntilDone(pTimeout, WaitPolicy());
+}
+
+/*!
+ * \brief Wait for a driver-specific action to finish.
+ *
+ * Repeatedly polls isDone() until it returns true or \p pTimeout has passed, in order to replace
+ * busy-loops on isDone() that unnecessarily load the bus (as isDone() typically involves a bus read).
+ *
+ * First sleeps for the expected remaining duration from \p pPolicy (but not longer than \p pTimeout).
+ * Afterwards, the delay between two polls starts at WaitPolicy::initialInterval and is multiplied
+ * by WaitPolicy::backoffFactor after each unsuccessful poll, up to WaitPolicy::maxInterval.
+ * The last poll happens at the timeout at latest.
+ *
+ * \throws std::invalid_argument If a duration in \p pPolicy is negative or WaitPolicy::backoffFactor is smaller than 1.
+ * \throws std::runtime_error If isDone() throws \c std::runtime_error.
+ *
+ * \param pTimeout Maximum time to wait.
+ * \param pPolicy Polling parameters.
+ * \return True if finished and false on timeout.
+ */
+bool Driver::waitUntilDone(const std::chrono::milliseconds pTimeout, const WaitPolicy& pPolicy)
+{
+    using std::chrono::microseconds;
+    using std::chrono::steady_clock;
+
+    if (pPolicy.initialInterval < microseconds::zero() || pPolicy.maxInterval < microseconds::zero() ||
+        pPolicy.expectedDuration < microseconds::zero() || !(pPolicy.backoffFactor >= 1.0))
+    {
+        throw std::invalid_argument("Invalid wait policy for " + getSelfDescription() + ".");
+    }
+
+    const steady_clock::time_point deadline = steady_clock::now() + pTimeout;
+
+    std::this_thread::sleep_until(std::min(steady_clock::now() + pPolicy.expectedDuration, deadline));
+
+    microseconds interval = std::min(pPolicy.initialInterval, pPolicy.maxInterval);
+
+    while (true)
+    {
+        if (isDone())
+            return true;
+
+        const steady_clock::time_point now = steady_clock::now();
+
+        if (now >= deadline)
+            return false;
+
+        std::this_thread::sleep_until(std::min(now + interval, deadline));
+
+        const double nextInterval = static_cast<double>(interval.count()) * pPolicy.backoffFactor;
+
+        if (nextInterval >= static_cast<double>(pPolicy.maxInterval.count()))
+            interval = pPolicy.maxInterval;
+        else
+            interval = std::max(microseconds(static_cast<microseconds::rep>(nextInterval)), microseconds(1));
+    }
+}
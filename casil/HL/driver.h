@@ -28,7 +28,9 @@
 
 #include <casil/layerconfig.h>
 
+#include <chrono>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -74,6 +76,18 @@ namespace HL
  */
 class Driver : public LayerBase
 {
+public:
+    /*!
+     * \brief Polling parameters for waitUntilDone().
+     */
+    struct WaitPolicy
+    {
+        std::chrono::microseconds initialInterval {100};        ///< Delay between the first two isDone() polls.
+        std::chrono::microseconds maxInterval {100000};         ///< Upper limit for the delay between two polls.
+        double backoffFactor = 2.0;                             ///< Factor to increase the delay after each unsuccessful poll (at least 1).
+        std::chrono::microseconds expectedDuration {0};         ///< Expected remaining duration of the action (delay before the first poll).
+    };
+
 public:
     Driver(std::string pType, std::string pName, LayerConfig pConfig, const LayerConfig& pRequiredConfig);  ///< Constructor.
     ~Driver() override = default;                                                                           ///< Default destructor.
@@ -95,6 +109,8 @@ public:
      * \param pAddrOffs Potentially data offset as number of bytes (implementation-defined).
      */
     virtual void setData(const std::vector<std::uint8_t>& pData, std::uint32_t pAddrOffs = 0) = 0;
+    virtual bool supportsAddressOffset() const;                                                     ///< \brief Check if setData() supports
+                                                                                                    ///  partial writes at a byte offset.
     virtual void exec() = 0;                                                                        ///< Perform a driver-specific action.
     /*!
      * \brief Check if a driver-specific action has finished.
@@ -103,6 +119,20 @@ public:
      */
     virtual bool isDone() = 0;
     //
+    bool waitUntilDone(std::chrono::milliseconds pTimeout);                                         ///< \brief Wait for a driver-specific
+                                                                                                    ///  action to finish (default policy).
+    virtual bool waitUntilDone(std::chrono::milliseconds pTimeout, const WaitPolicy& pPolicy);      ///< \brief Wait for a driver-specific
+                                                                                                    ///  action to finish.
+    //
+    /*!
+     * \brief Queue a task for serialized execution on the asynchronous executor of the used interface.
+     *
+     * See TL::Interface::postAsync().
+     *
+     * \param pTask Task to be executed.
+     */
+    void postAsync(std::function<void()> pTask) const override = 0;
+    //
     //TODO could something be added here to enable direct C++ FunctionalRegister-functionality without python wrapper in between?
 
 private:
@@ -25,6 +25,7 @@
 
 #include <casil/bytes.h>
 
+#include <chrono>
 #include <stdexcept>
 #include <utility>
 
@@ -42,6 +43,10 @@ using casil::Layers::HL::MuxedDriver;
  * the instance bus address when calling TL::MuxedInterface::read() / TL::MuxedInterface::write() / TL::MuxedInterface::query().
  * See also read() / write() / query() from this class.
  *
+ * Enables event-driven waiting (see waitUntilDone()) depending on the optional "event_wait" value in \p pConfig
+ * (boolean type, default: false). This requires an interface that receives event notifications from the module
+ * (see TL::MuxedInterface::supportsEvents()); otherwise a warning is logged and waitUntilDone() keeps polling.
+ *
  * \throws std::runtime_error If "base_addr" is not an unsigned integer (max. 64 bit).
  *
  * \param pType Registered component type name.
@@ -54,10 +59,14 @@ MuxedDriver::MuxedDriver(std::string pType, std::string pName, InterfaceBaseType
                          LayerConfig pConfig, const LayerConfig& pRequiredConfig) :
     Driver(std::move(pType), std::move(pName), std::move(pConfig), pRequiredConfig),
     interface(pInterface),
-    baseAddr(config.getUInt("base_addr", 0x0u))
+    baseAddr(config.getUInt("base_addr", 0x0u)),
+    useEventWait(config.getBool("event_wait", false))
 {
     if (!config.contains(LayerConfig::fromYAML("{base_addr: uint}"), true))
         throw std::runtime_error("Invalid or no base address (\"base_addr\") set for " + getSelfDescription() + ".");
+
+    if (useEventWait && !interface.supportsEvents())
+        logger.logWarning("Event-driven waiting requested but interface does not receive event notifications. Falling back to polling.");
 }
 
 //Public
@@ -110,6 +119,66 @@ bool MuxedDriver::isDone()
     return false;   //(sic!)
 }
 
+//
+
+/*!
+ * \copybrief Driver::waitUntilDone()
+ *
+ * If event-driven waiting is enabled (see MuxedDriver()) and supported by the interface, waits for event notifications
+ * of the module (see TL::MuxedInterface::waitForEvent()) instead of polling: isDone() is only called once initially
+ * and then once after every received notification from the module at \ref baseAddr (and a last time at the timeout),
+ * i.e. the bus is not accessed while the module is busy. The notification count is taken before each isDone() call,
+ * such that a notification arriving in between is not missed. The polling parameters of \p pPolicy are not used in this case.
+ *
+ * Otherwise calls Driver::waitUntilDone().
+ *
+ * \throws std::invalid_argument See Driver::waitUntilDone().
+ * \throws std::runtime_error If isDone() throws \c std::runtime_error.
+ *
+ * \param pTimeout Maximum time to wait.
+ * \param pPolicy Polling parameters.
+ * \return True if finished and false on timeout.
+ */
+bool MuxedDriver::waitUntilDone(const std::chrono::milliseconds pTimeout, const WaitPolicy& pPolicy)
+{
+    using std::chrono::steady_clock;
+
+    if (!useEventWait || !interface.supportsEvents())
+        return Driver::waitUntilDone(pTimeout, pPolicy);
+
+    const steady_clock::time_point deadline = steady_clock::now() + pTimeout;
+
+    while (true)
+    {
+        const std::uint64_t seenCount = interface.getEventCount(baseAddr);
+
+        if (isDone())
+            return true;
+
+        const steady_clock::time_point now = steady_clock::now();
+
+        if (now >= deadline)
+            return false;
+
+        if (!interface.waitForEvent(baseAddr, seenCount, std::chrono::ceil<std::chrono::milliseconds>(deadline - now)))
+            return isDone();
+    }
+}
+
+//
+
+/*!
+ * \brief Queue a task for serialized execution on the asynchronous executor of the used interface.
+ *
+ * Forwards \p pTask to TL::Interface::postAsync() of the used interface.
+ *
+ * \param pTask Task to be executed.
+ */
+void MuxedDriver::postAsync(std::function<void()> pTask) const
+{
+    interface.postAsync(std::move(pTask));
+}
+
 //Protected
 
 /*!
@@ -137,6 +206,110 @@ std::vector<std::uint8_t> MuxedDriver::read(const std::uint64_t pAddr, const int
     }
 }
 
+/*!
+ * \brief Read from the interface into a buffer relative to the base address.
+ *
+ * Calls TL::MuxedInterface::readInto() with \p pAddr being offset by the module instance's base address
+ * (component configuration parameter "base_addr").
+ *
+ * \throws std::runtime_error If TL::MuxedInterface::readInto() throws \c std::runtime_error.
+ *
+ * \param pAddr Module-local address.
+ * \param pBuffer Buffer for the read bytes.
+ * \return Number of bytes written to \p pBuffer.
+ */
+std::size_t MuxedDriver::readInto(const std::uint64_t pAddr, const std::span<std::uint8_t> pBuffer) const
+{
+    try
+    {
+        return interface.readInto(baseAddr + pAddr, pBuffer);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Muxed driver \"" + name + "\" failed to read from interface (address: " + Bytes::formatHex(pAddr) +
+                                 ", size: " + std::to_string(pBuffer.size()) + "): " + exc.what());
+    }
+}
+
+/*!
+ * \brief Read from the interface into a buffer relative to the base address without throwing.
+ *
+ * Calls TL::MuxedInterface::tryReadInto() with \p pAddr being offset by the module instance's base address
+ * (component configuration parameter "base_addr"). A returned error keeps its code and gets the driver
+ * context prepended to its (lazily formatted) message.
+ *
+ * \param pAddr Module-local address.
+ * \param pBuffer Buffer for the read bytes.
+ * \return Number of bytes written to \p pBuffer or the error that occurred.
+ */
+casil::Expected<std::size_t> MuxedDriver::tryReadInto(const std::uint64_t pAddr, const std::span<std::uint8_t> pBuffer) const
+{
+    Expected<std::size_t> result = interface.tryReadInto(baseAddr + pAddr, pBuffer);
+
+    if (result)
+        return result;
+
+    return Error(result.error().getCode(), [tName = name, pAddr, tSize = pBuffer.size(), tError = result.error()]() -> std::string
+                 {
+                     return "Muxed driver \"" + tName + "\" failed to read from interface (address: " + Bytes::formatHex(pAddr) +
+                            ", size: " + std::to_string(tSize) + "): " + tError.getMessage();
+                 });
+}
+
+/*!
+ * \brief Read from the interface into a small-buffer-optimized byte sequence relative to the base address.
+ *
+ * Calls TL::MuxedInterface::readSmall() with \p pAddr being offset by the module instance's base address
+ * (component configuration parameter "base_addr").
+ *
+ * \throws std::runtime_error If TL::MuxedInterface::readSmall() throws \c std::runtime_error.
+ *
+ * \param pAddr Module-local address.
+ * \param pSize Number of bytes to read.
+ * \return Read bytes.
+ */
+casil::Bytes::SmallByteVec MuxedDriver::readSmall(const std::uint64_t pAddr, const int pSize) const
+{
+    try
+    {
+        return interface.readSmall(baseAddr + pAddr, pSize);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Muxed driver \"" + name + "\" failed to read from interface (address: " + Bytes::formatHex(pAddr) +
+                                 ", size: " + std::to_string(pSize) + "): " + exc.what());
+    }
+}
+
+/*!
+ * \brief Read multiple byte sequences from the interface relative to the base address.
+ *
+ * Calls TL::MuxedInterface::readBatch() with the addresses of all operations in
+ * \p pOps being offset by the module instance's base address (component configuration parameter "base_addr").
+ *
+ * \throws std::runtime_error If TL::MuxedInterface::readBatch() throws \c std::runtime_error.
+ *
+ * \param pOps Read operations with module-local addresses.
+ * \return Read bytes of every operation (in the order of \p pOps).
+ */
+std::vector<std::vector<std::uint8_t>> MuxedDriver::readBatch(const std::span<const TL::MuxedInterface::ReadOp> pOps) const
+{
+    std::vector<TL::MuxedInterface::ReadOp> ops(pOps.begin(), pOps.end());
+
+    for (TL::MuxedInterface::ReadOp& op : ops)
+        op.addr += baseAddr;
+
+    try
+    {
+        return interface.readBatch(ops);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Muxed driver \"" + name + "\" failed to read batch of " + std::to_string(pOps.size()) +
+                                 " operations from interface: " + exc.what());
+    }
+}
+
 /*!
  * \brief Write to the interface relative to the base address.
  *
@@ -161,6 +334,86 @@ void MuxedDriver::write(const std::uint64_t pAddr, const std::vector<std::uint8_
     }
 }
 
+/*!
+ * \brief Write to the interface from a buffer relative to the base address.
+ *
+ * Calls TL::MuxedInterface::writeFrom() with \p pAddr being offset by the module instance's base address
+ * (component configuration parameter "base_addr").
+ *
+ * \throws std::runtime_error If TL::MuxedInterface::writeFrom() throws \c std::runtime_error.
+ *
+ * \param pAddr Module-local address.
+ * \param pData %Bytes to be written.
+ */
+void MuxedDriver::writeFrom(const std::uint64_t pAddr, const std::span<const std::uint8_t> pData) const
+{
+    try
+    {
+        interface.writeFrom(baseAddr + pAddr, pData);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Muxed driver \"" + name + "\" failed to write to interface (address: " + Bytes::formatHex(pAddr) +
+                                 ", data: " + Bytes::formatByteVec(std::vector<std::uint8_t>(pData.begin(), pData.end())) + "): " +
+                                 exc.what());
+    }
+}
+
+/*!
+ * \brief Write to the interface from a buffer relative to the base address without throwing.
+ *
+ * Calls TL::MuxedInterface::tryWriteFrom() with \p pAddr being offset by the module instance's base address
+ * (component configuration parameter "base_addr"). A returned error keeps its code and gets the driver
+ * context prepended to its (lazily formatted) message.
+ *
+ * Note: Other than for writeFrom() the message does not contain the data, which is not copied.
+ *
+ * \param pAddr Module-local address.
+ * \param pData %Bytes to be written.
+ * \return Nothing or the error that occurred.
+ */
+casil::Expected<void> MuxedDriver::tryWriteFrom(const std::uint64_t pAddr, const std::span<const std::uint8_t> pData) const
+{
+    Expected<void> result = interface.tryWriteFrom(baseAddr + pAddr, pData);
+
+    if (result)
+        return result;
+
+    return Error(result.error().getCode(), [tName = name, pAddr, tSize = pData.size(), tError = result.error()]() -> std::string
+                 {
+                     return "Muxed driver \"" + tName + "\" failed to write to interface (address: " + Bytes::formatHex(pAddr) +
+                            ", size: " + std::to_string(tSize) + "): " + tError.getMessage();
+                 });
+}
+
+/*!
+ * \brief Write multiple byte sequences to the interface relative to the base address.
+ *
+ * Calls TL::MuxedInterface::writeBatch() with the addresses of all operations in
+ * \p pOps being offset by the module instance's base address (component configuration parameter "base_addr").
+ *
+ * \throws std::runtime_error If TL::MuxedInterface::writeBatch() throws \c std::runtime_error.
+ *
+ * \param pOps Write operations with module-local addresses.
+ */
+void MuxedDriver::writeBatch(const std::span<const TL::MuxedInterface::WriteOp> pOps) const
+{
+    std::vector<TL::MuxedInterface::WriteOp> ops(pOps.begin(), pOps.end());
+
+    for (TL::MuxedInterface::WriteOp& op : ops)
+        op.addr += baseAddr;
+
+    try
+    {
+        interface.writeBatch(ops);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Muxed driver \"" + name + "\" failed to write batch of " + std::to_string(pOps.size()) +
+                                 " operations to interface: " + exc.what());
+    }
+}
+
 /*!
  * \brief Write a query to the interface and read the response, both relative to the base address.
  *
@@ -189,3 +442,33 @@ std::vector<std::uint8_t> MuxedDriver::query(const std::uint64_t pWriteAddr, con
                                  ", data: " + Bytes::formatByteVec(pData) + ", size: " + std::to_string(pSize) + "): " + exc.what());
     }
 }
+
+//
+
+/*!
+ * \brief Asynchronously read from the interface relative to the base address.
+ *
+ * Performs read() on the interface's asynchronous executor (see runAsync()).
+ *
+ * \param pAddr Module-local address.
+ * \param pSize Number of bytes to read.
+ * \return Future for the read bytes (\c std::future::get() rethrows the exceptions of read()).
+ */
+std::future<std::vector<std::uint8_t>> MuxedDriver::readAsync(const std::uint64_t pAddr, const int pSize) const
+{
+    return runAsync([this, pAddr, pSize]() -> std::vector<std::uint8_t> { return read(pAddr, pSize); });
+}
+
+/*!
+ * \brief Asynchronously write to the interface relative to the base address.
+ *
+ * Performs write() on the interface's asynchronous executor (see runAsync()).
+ *
+ * \param pAddr Module-local address.
+ * \param pData %Bytes to be written.
+ * \return Future for completion of the write (\c std::future::get() rethrows the exceptions of write()).
+ */
+std::future<void> MuxedDriver::writeAsync(const std::uint64_t pAddr, std::vector<std::uint8_t> pData) const
+{
+    return runAsync([this, pAddr, data = std::move(pData)]() -> void { write(pAddr, data); });
+}
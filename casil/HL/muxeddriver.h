@@ -26,10 +26,17 @@
 
 #include <casil/HL/driver.h>
 
+#include <casil/bytes.h>
+#include <casil/error.h>
 #include <casil/layerconfig.h>
 #include <casil/TL/muxedinterface.h>
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <future>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -70,14 +77,44 @@ public:
     void setData(const std::vector<std::uint8_t>& pData, std::uint32_t pAddrOffs = 0) override;
     void exec() override;
     bool isDone() override;
+    //
+    using Driver::waitUntilDone;
+    bool waitUntilDone(std::chrono::milliseconds pTimeout, const WaitPolicy& pPolicy) override;
+    //
+    void postAsync(std::function<void()> pTask) const override final;  ///< \brief Queue a task for serialized execution on
+                                                                        ///  the asynchronous executor of the used interface.
 
 protected:
     std::vector<std::uint8_t> read(std::uint64_t pAddr, int pSize = -1) const;      ///< Read from the interface relative to the base address.
+    std::size_t readInto(std::uint64_t pAddr, std::span<std::uint8_t> pBuffer) const;  ///< \brief Read from the interface into a buffer
+                                                                                        ///  relative to the base address.
+    Expected<std::size_t> tryReadInto(std::uint64_t pAddr, std::span<std::uint8_t> pBuffer) const;  ///< \brief Read from the interface
+                                                                                                    ///  into a buffer relative to the base
+                                                                                                    ///  address without throwing.
+    Bytes::SmallByteVec readSmall(std::uint64_t pAddr, int pSize = -1) const;      ///< \brief Read from the interface into a small-buffer-
+                                                                                    ///  optimized byte sequence relative to the base address.
+    std::vector<std::vector<std::uint8_t>> readBatch(std::span<const TL::MuxedInterface::ReadOp> pOps) const;
+                                                                                    ///< \brief Read multiple byte sequences from the interface
+                                                                                    ///  relative to the base address.
     void write(std::uint64_t pAddr, const std::vector<std::uint8_t>& pData) const;  ///< Write to the interface relative to the base address.
+    void writeFrom(std::uint64_t pAddr, std::span<const std::uint8_t> pData) const;    ///< \brief Write to the interface from a buffer
+                                                                                        ///  relative to the base address.
+    Expected<void> tryWriteFrom(std::uint64_t pAddr, std::span<const std::uint8_t> pData) const;   ///< \brief Write to the interface
+                                                                                                    ///  from a buffer relative to the base
+                                                                                                    ///  address without throwing.
+    void writeBatch(std::span<const TL::MuxedInterface::WriteOp> pOps) const;      ///< \brief Write multiple byte sequences to the interface
+                                                                                    ///  relative to the base address.
     std::vector<std::uint8_t> query(std::uint64_t pWriteAddr, std::uint64_t pReadAddr,
                                     const std::vector<std::uint8_t>& pData, int pSize = -1) const;  ///< \brief Write a query to the interface
                                                                                                     ///  and read the response, both relative
                                                                                                     ///  to the base address.
+    //
+    std::future<std::vector<std::uint8_t>> readAsync(std::uint64_t pAddr, int pSize = -1) const;  ///< \brief Asynchronously read from
+                                                                                                ///  the interface relative to the
+                                                                                                ///  base address.
+    std::future<void> writeAsync(std::uint64_t pAddr, std::vector<std::uint8_t> pData) const;   ///< \brief Asynchronously write to
+                                                                                                ///  the interface relative to the
+                                                                                                ///  base address.
 
 private:
     /*!
@@ -97,6 +134,9 @@ protected:
     InterfaceBaseType& interface;           ///< The interface instance to be used for required access to the transfer layer.
     //
     const std::uint64_t baseAddr;           ///< The root bus address for the controlled firmware module instance.
+
+private:
+    const bool useEventWait;                ///< Wait for event notifications of the module instead of polling (see waitUntilDone()).
 };
 
 } // namespace HL
@@ -61,17 +61,63 @@
 
 #include <casil/auxil.h>
 #include <casil/bytes.h>
+#include <casil/logger.h>
+#include <casil/timing.h>
+#include <casil/tracer.h>
 
 #include <boost/property_tree/ptree.hpp>
 
 #include <algorithm>
-#include <bitset>
 #include <cctype>
 #include <cstddef>
+#include <iterator>
 #include <span>
 #include <stdexcept>
 #include <utility>
 
+namespace
+{
+
+/*
+ * Determines the range of module-local byte addresses that are (partially) occupied by register 'pRegDescr'.
+ *
+ * Returns the first byte address and the end address (one past the last byte address).
+ */
+std::pair<std::uint32_t, std::uint32_t> coveredBytes(const casil::Layers::HL::RegisterDescr& pRegDescr)
+{
+    if (pRegDescr.type == casil::Layers::HL::RegisterDescr::DataType::ByteArray)
+        return {pRegDescr.addr, pRegDescr.addr + pRegDescr.size};
+    else
+        return {pRegDescr.addr + pRegDescr.offs / 8, pRegDescr.addr + (pRegDescr.offs + pRegDescr.size - 1) / 8 + 1};
+}
+
+/*
+ * Extracts the covered bytes (see coveredBytes()) of register 'pRegDescr' from a set of read address ranges
+ * (start address -> bytes) as returned by RegisterDriver::readMergedRanges(), which must contain the register.
+ */
+std::vector<std::uint8_t> regBytesFromRanges(const casil::Layers::HL::RegisterDescr& pRegDescr,
+                                             const std::map<std::uint32_t, std::vector<std::uint8_t>>& pRangeBytes)
+{
+    const auto [firstByte, endByte] = coveredBytes(pRegDescr);
+
+    const auto& [rangeStart, bytes] = *std::prev(pRangeBytes.upper_bound(firstByte));
+
+    return std::vector<std::uint8_t>(bytes.begin() + (firstByte - rangeStart), bytes.begin() + (endByte - rangeStart));
+}
+
+/*
+ * Estimates the heap memory used by the content of register value 'pValue' (see RegisterDriver::getMemoryUsageImpl()).
+ */
+std::size_t valueHeapUsage(const casil::Layers::HL::RegisterDescr::VariantValueType& pValue)
+{
+    if (const std::vector<std::uint8_t>* const bytes = std::get_if<std::vector<std::uint8_t>>(&pValue); bytes != nullptr)
+        return bytes->capacity();
+
+    return 0;
+}
+
+} // namespace
+
 using casil::Layers::HL::RegisterDriver;
 
 /*!
@@ -82,6 +128,18 @@ using casil::Layers::HL::RegisterDriver;
  * Gets the optional "clear_cache_after_reset" value from \p pConfig (boolean value, default: false),
  * which defines, whether to clear the cache for written register values on reset (see reset()).
  *
+ * Gets the optional "shadow_registers" value from \p pConfig (boolean value, default: false), which enables a shadow copy of
+ * the module's register address space (as spanned by \p pRegisters). All bytes written to or read from the registers are
+ * merged into this shadow memory. Writing a value register that does not cover full bytes (see setRegValue()) then takes
+ * the unchanged bits from the shadow memory instead of reading them from the module first, provided that the shadow memory
+ * already knows the covered bytes and that these bytes are only occupied by read-write registers (such that no bits
+ * of read-only or write-only registers could be written back with stale content). See also getShadow().
+ *
+ * Gets the optional "trust_shadow" value from \p pConfig (boolean value, default: false), which implies "shadow_registers"
+ * and additionally serves register \e reads from the shadow memory under the same conditions, i.e. skips the read from
+ * the module entirely for known read-write registers. Only enable this if the firmware module never changes the content
+ * of its read-write registers on its own (note that reset() always invalidates the shadow memory).
+ *
  * Configures the registers for this driver from the passed definitions in \p pRegisters and checks
  * for potentially invalid register configurations (see the documented exceptions and also RegisterDescr).
  * Also gets any optional default values "init.REG_NAME" for these registers (which override any defaults
@@ -115,13 +173,26 @@ RegisterDriver::RegisterDriver(std::string pType, std::string pName, InterfaceBa
                                std::map<std::string, RegisterDescr, std::less<>> pRegisters) :
     MuxedDriver(std::move(pType), std::move(pName), pInterface, std::move(pConfig), pRequiredConfig),
     clearRegValCacheOnReset(config.getBool("clear_cache_after_reset", false)),
-    registers(std::move(pRegisters)),
-    registerWrittenCache(),
-    initValues(),
-    registerProxies()
+    registers(std::make_move_iterator(pRegisters.begin()), std::make_move_iterator(pRegisters.end())),
+    registerWrittenCache(std::make_unique<WrittenCacheEntryType[]>(registers.size())),
+    initValues(registers.size()),
+    useShadow(config.getBool("shadow_registers", false) || config.getBool("trust_shadow", false)),
+    trustShadow(config.getBool("trust_shadow", false)),
+    shadowRMWSafe(),
+    shadowBytes(),
+    shadowValid(),
+    snapshotRanges(),
+    lastTriggerTime(),
+    learnedDuration(0),
+    preparedReset(false),
+    preparedFirmwareVersion(std::nullopt),
+    proxyMutex(),
+    registerProxies(registers.size())
 {
-    for (const auto& [regName, regDescr] : registers)
+    for (std::size_t regIdx = 0; regIdx < registers.size(); ++regIdx)
     {
+        const auto& [regName, regDescr] = registers[regIdx];
+
         //Check for invalid register settings
 
         if (!isValidRegisterName(regName))
@@ -161,14 +232,8 @@ RegisterDriver::RegisterDriver(std::string pType, std::string pName, InterfaceBa
                                      "of register driver \"" + name + "\".");
         }
 
-        //Initialize register written value cache
-        if (regDescr.mode != AccessMode::ReadOnly)
-            registerWrittenCache[regName] = std::monostate{};
-
         //Collect manually overridden default values from "init" map of configuration YAML
 
-        initValues[regName] = std::monostate{};
-
         //Cannot use init entries for read-only registers
         if (regDescr.mode == AccessMode::ReadOnly && config.contains(LayerConfig::fromYAML("{init: {" + regName + ": }}"), false))
         {
@@ -183,7 +248,7 @@ RegisterDriver::RegisterDriver(std::string pType, std::string pName, InterfaceBa
                                          "of register driver \"" + name + "\".");
             }
 
-            initValues[regName] = config.getUInt("init." + regName);
+            initValues[regIdx] = config.getUInt("init." + regName);
         }
         else if (config.contains(LayerConfig::fromYAML("{init: {" + regName + ": byteSeq}}"), true))
         {
@@ -201,16 +266,63 @@ RegisterDriver::RegisterDriver(std::string pType, std::string pName, InterfaceBa
                                          "has wrong size.");
             }
 
-            initValues[regName] = std::move(seqVec);
+            initValues[regIdx] = std::move(seqVec);
         }
         else if (config.contains(LayerConfig::fromYAML("{init: {" + regName + ": }}"), false))
         {
             //Contains an entry for the register name but with invalid value / wrong type
             throw std::runtime_error("Could not parse init value for register \"" + regName + "\" of register driver \"" + name + "\".");
         }
+    }
+
+    //Set up shadow memory for the whole register address space and find the bytes that only read-write registers occupy
+
+    if (useShadow)
+    {
+        for (const auto& [regName, regDescr] : registers)
+        {
+            const auto [firstByte, endByte] = ::coveredBytes(regDescr);
+
+            if (endByte > shadowRMWSafe.size())
+                shadowRMWSafe.resize(endByte, true);
+
+            if (regDescr.mode != AccessMode::ReadWrite)
+                std::fill(shadowRMWSafe.begin() + firstByte, shadowRMWSafe.begin() + endByte, false);
+        }
+
+        shadowBytes.resize(shadowRMWSafe.size(), 0);
+        shadowValid.resize(shadowRMWSafe.size(), false);
+    }
+
+    //Find contiguous address ranges that only read-write registers occupy (for snapshot() and restore())
+
+    std::vector<std::uint8_t> byteUsage;    //0: unused, 1: read-write registers only, 2: other registers
+
+    for (const auto& [regName, regDescr] : registers)
+    {
+        const auto [firstByte, endByte] = ::coveredBytes(regDescr);
+
+        if (endByte > byteUsage.size())
+            byteUsage.resize(endByte, 0);
+
+        for (std::uint32_t addr = firstByte; addr < endByte; ++addr)
+        {
+            if (regDescr.mode != AccessMode::ReadWrite)
+                byteUsage[addr] = 2;
+            else if (byteUsage[addr] == 0)
+                byteUsage[addr] = 1;
+        }
+    }
+
+    for (std::uint32_t addr = 0; addr < byteUsage.size(); ++addr)
+    {
+        if (byteUsage[addr] != 1)
+            continue;
 
-        //Initialize register proxies
-        registerProxies.emplace(std::piecewise_construct, std::forward_as_tuple(regName), std::forward_as_tuple(*this, regName));
+        if (!snapshotRanges.empty() && snapshotRanges.back().first + snapshotRanges.back().second == addr)
+            ++snapshotRanges.back().second;
+        else
+            snapshotRanges.emplace_back(addr, 1);
     }
 }
 
@@ -229,6 +341,8 @@ RegisterDriver::RegisterProxy& RegisterDriver::operator[](const std::string_view
 /*!
  * \brief Access a register via the proxy class.
  *
+ * The proxy instance is created on first access and kept until the driver is destroyed.
+ *
  * \throws std::invalid_argument If no register with name \p pRegName is defined.
  *
  * \param pRegName Name of the register.
@@ -236,15 +350,38 @@ RegisterDriver::RegisterProxy& RegisterDriver::operator[](const std::string_view
  */
 const RegisterDriver::RegisterProxy& RegisterDriver::operator[](const std::string_view pRegName) const
 {
-    const auto it = registerProxies.find(pRegName);
+    const auto it = findRegister(pRegName);
 
-    if (it == registerProxies.end())
+    if (it == registers.end())
     {
         throw std::invalid_argument("The register \"" + std::string(pRegName) + "\" is not available " +
                                     "for register driver \"" + name + "\".");
     }
 
-    return it->second;
+    const std::lock_guard<std::mutex> proxyLock(proxyMutex);
+    (void)proxyLock;
+
+    std::unique_ptr<RegisterProxy>& proxy = registerProxies[it - registers.begin()];
+
+    if (!proxy)
+        proxy = std::make_unique<RegisterProxy>(const_cast<RegisterDriver&>(*this), it->first);
+
+    return *proxy;
+}
+
+/*!
+ * \brief Get a precomputed access handle for a register.
+ *
+ * See RegisterHandle.
+ *
+ * \throws std::invalid_argument If no register with name \p pRegName is defined.
+ *
+ * \param pRegName Name of the register.
+ * \return Access handle for register \p pRegName.
+ */
+RegisterDriver::RegisterHandle RegisterDriver::handle(const std::string_view pRegName)
+{
+    return RegisterHandle(*this, pRegName);
 }
 
 //
@@ -256,6 +393,8 @@ const RegisterDriver::RegisterProxy& RegisterDriver::operator[](const std::strin
  *
  * \internal This logic is to be implemented by resetImpl(). \endinternal
  *
+ * Afterwards the shadow memory content (if enabled; see RegisterDriver()) is considered unknown (see invalidateShadow()).
+ *
  * Then, if "clear_cache_after_reset" was enabled in the component configuration, the
  * cache for previously written register values will be cleared (see RegisterDriver()).
  */
@@ -263,11 +402,7 @@ void RegisterDriver::reset()
 {
     resetImpl();
 
-    if (clearRegValCacheOnReset)
-    {
-        for (auto& it : registerWrittenCache)
-            it.second = std::monostate{};
-    }
+    resetDriverState();
 }
 
 //
@@ -278,20 +413,42 @@ void RegisterDriver::reset()
  * The default value/sequence will be written to every writable register that has a default, which can be either
  * from its definition (see RegisterDriver(), RegisterDescr) or from the possible "init.REG_NAME" overrides in
  * the component configuration (see RegisterDriver()). If the latter is present, it will be used, by preference.
+ *
+ * If \p pVerify is set, all written read-write registers are read back afterwards with as few bus reads
+ * as possible and compared to the written values (see verifyRegisters()).
+ *
+ * \throws std::runtime_error If a write fails.
+ * \throws std::runtime_error If \p pVerify is set and the read-back fails or does not match for any register.
+ *
+ * \param pVerify Verify the written values by reading back the registers.
  */
-void RegisterDriver::applyDefaults()
+void RegisterDriver::applyDefaults(const bool pVerify)
 {
-    for (const auto& [regName, regDescr] : registers)
+    const Timing::Scope timing = timeOperation(Timing::Operation::ApplyDefaults);
+
+    std::vector<std::string> writtenRegs;
+
+    for (std::size_t regIdx = 0; regIdx < registers.size(); ++regIdx)
     {
+        const auto& [regName, regDescr] = registers[regIdx];
+
         if (regDescr.mode == AccessMode::ReadOnly)
             continue;
 
-        if (!std::holds_alternative<std::monostate>(initValues[regName]))
+        const RegisterDescr::VariantValueType& initValue = initValues[regIdx];
+
+        if (regDescr.mode == AccessMode::ReadWrite &&
+            (!std::holds_alternative<std::monostate>(initValue) || !std::holds_alternative<std::monostate>(regDescr.defaultValue)))
         {
-            if (std::holds_alternative<std::uint64_t>(initValues[regName]))
-                setValue(regName, std::get<std::uint64_t>(initValues[regName]));
-            else if (std::holds_alternative<std::vector<std::uint8_t>>(initValues[regName]))
-                setBytes(regName, std::get<std::vector<std::uint8_t>>(initValues[regName]));
+            writtenRegs.push_back(regName);
+        }
+
+        if (!std::holds_alternative<std::monostate>(initValue))
+        {
+            if (std::holds_alternative<std::uint64_t>(initValue))
+                setValue(regName, std::get<std::uint64_t>(initValue));
+            else if (std::holds_alternative<std::vector<std::uint8_t>>(initValue))
+                setBytes(regName, std::get<std::vector<std::uint8_t>>(initValue));
         }
         else if (!std::holds_alternative<std::monostate>(regDescr.defaultValue))
         {
@@ -301,6 +458,9 @@ void RegisterDriver::applyDefaults()
                 setBytes(regName, std::get<std::vector<std::uint8_t>>(regDescr.defaultValue));
         }
     }
+
+    if (pVerify)
+        throwOnVerifyMismatch(verifyRegisters(writtenRegs), "applying defaults");
 }
 
 //
@@ -323,7 +483,7 @@ void RegisterDriver::applyDefaults()
  */
 std::vector<std::uint8_t> RegisterDriver::getBytes(const std::string_view pRegName)
 {
-    const auto it = registers.find(pRegName);
+    const auto it = findRegister(pRegName);
 
     if (it == registers.end())
     {
@@ -347,15 +507,15 @@ std::vector<std::uint8_t> RegisterDriver::getBytes(const std::string_view pRegNa
 
     try
     {
-        std::vector<std::uint8_t> retVal = getRegBytes(reg.addr, reg.size);
+        std::vector<std::uint8_t> retVal = getRegBytes(reg.addr, reg.size).toVector();
 
         if (reg.mode == AccessMode::ReadWrite)
         {
-            const auto& cachedVal = registerWrittenCache.find(pRegName)->second;
+            const std::shared_ptr<const RegisterDescr::VariantValueType> cachedVal = registerWrittenCache[it - registers.begin()].load();
 
-            if (!std::holds_alternative<std::monostate>(cachedVal))
+            if (cachedVal)
             {
-                if (retVal != std::get<std::vector<std::uint8_t>>(cachedVal))
+                if (retVal != std::get<std::vector<std::uint8_t>>(*cachedVal))
                     logger.logWarning("Byte sequence read from register \"" + std::string(pRegName) + "\" differs from cached one.");
             }
         }
@@ -391,7 +551,7 @@ std::vector<std::uint8_t> RegisterDriver::getBytes(const std::string_view pRegNa
  */
 std::vector<std::uint8_t> RegisterDriver::getBytes(const std::string_view pRegName) const
 {
-    const auto it = registers.find(pRegName);
+    const auto it = findRegister(pRegName);
 
     if (it == registers.end())
     {
@@ -426,7 +586,7 @@ std::vector<std::uint8_t> RegisterDriver::getBytes(const std::string_view pRegNa
  */
 void RegisterDriver::setBytes(const std::string_view pRegName, const std::vector<std::uint8_t>& pData)
 {
-    const auto it = registers.find(pRegName);
+    const auto it = findRegister(pRegName);
 
     if (it == registers.end())
     {
@@ -452,6 +612,9 @@ void RegisterDriver::setBytes(const std::string_view pRegName, const std::vector
                                     "of register driver \"" + name + "\".");
     }
 
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
+
     try
     {
         setRegBytes(reg.addr, pData);
@@ -462,7 +625,7 @@ void RegisterDriver::setBytes(const std::string_view pRegName, const std::vector
                                  "of register driver \"" + name + "\": " + exc.what());
     }
 
-    registerWrittenCache.find(pRegName)->second = pData;
+    registerWrittenCache[it - registers.begin()].store(std::make_shared<const RegisterDescr::VariantValueType>(pData));
 }
 
 //
@@ -485,7 +648,7 @@ void RegisterDriver::setBytes(const std::string_view pRegName, const std::vector
  */
 std::uint64_t RegisterDriver::getValue(const std::string_view pRegName)
 {
-    const auto it = registers.find(pRegName);
+    const auto it = findRegister(pRegName);
 
     if (it == registers.end())
     {
@@ -513,11 +676,11 @@ std::uint64_t RegisterDriver::getValue(const std::string_view pRegName)
 
         if (reg.mode == AccessMode::ReadWrite)
         {
-            const auto& cachedVal = registerWrittenCache.find(pRegName)->second;
+            const std::shared_ptr<const RegisterDescr::VariantValueType> cachedVal = registerWrittenCache[it - registers.begin()].load();
 
-            if (!std::holds_alternative<std::monostate>(cachedVal))
+            if (cachedVal)
             {
-                if (retVal != std::get<std::uint64_t>(cachedVal))
+                if (retVal != std::get<std::uint64_t>(*cachedVal))
                     logger.logWarning("Value read from register \"" + std::string(pRegName) + "\" differs from cached value.");
             }
         }
@@ -553,7 +716,7 @@ std::uint64_t RegisterDriver::getValue(const std::string_view pRegName)
  */
 std::uint64_t RegisterDriver::getValue(const std::string_view pRegName) const
 {
-    const auto it = registers.find(pRegName);
+    const auto it = findRegister(pRegName);
 
     if (it == registers.end())
     {
@@ -587,7 +750,7 @@ std::uint64_t RegisterDriver::getValue(const std::string_view pRegName) const
  */
 void RegisterDriver::setValue(const std::string_view pRegName, const std::uint64_t pValue)
 {
-    const auto it = registers.find(pRegName);
+    const auto it = findRegister(pRegName);
 
     if (it == registers.end())
     {
@@ -608,6 +771,9 @@ void RegisterDriver::setValue(const std::string_view pRegName, const std::uint64
                                     "of register driver \"" + name + "\".");
     }
 
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
+
     try
     {
         setRegValue(reg.addr, reg.size, reg.offs, pValue);
@@ -618,7 +784,71 @@ void RegisterDriver::setValue(const std::string_view pRegName, const std::uint64
                                  "of register driver \"" + name + "\": " + exc.what());
     }
 
-    registerWrittenCache.find(pRegName)->second = pValue;
+    registerWrittenCache[it - registers.begin()].store(std::make_shared<const RegisterDescr::VariantValueType>(pValue));
+}
+
+//
+
+/*!
+ * \brief Asynchronously read the data from a byte array register.
+ *
+ * Performs getBytes() on the interface's asynchronous executor (see LayerBase::runAsync()).
+ *
+ * Note: Do not access this driver synchronously while asynchronous accesses might still be pending.
+ *
+ * \param pRegName Name of the register.
+ * \return Future for the read byte sequence (\c std::future::get() rethrows the exceptions of getBytes()).
+ */
+std::future<std::vector<std::uint8_t>> RegisterDriver::getBytesAsync(const std::string_view pRegName)
+{
+    return runAsync([this, regName = std::string(pRegName)]() -> std::vector<std::uint8_t> { return getBytes(regName); });
+}
+
+/*!
+ * \brief Asynchronously write data to a byte array register.
+ *
+ * Performs setBytes() on the interface's asynchronous executor (see LayerBase::runAsync()).
+ *
+ * Note: Do not access this driver synchronously while asynchronous accesses might still be pending.
+ *
+ * \param pRegName Name of the register.
+ * \param pData Byte sequence to be written.
+ * \return Future for completion of the write (\c std::future::get() rethrows the exceptions of setBytes()).
+ */
+std::future<void> RegisterDriver::setBytesAsync(const std::string_view pRegName, std::vector<std::uint8_t> pData)
+{
+    return runAsync([this, regName = std::string(pRegName), data = std::move(pData)]() -> void { setBytes(regName, data); });
+}
+
+/*!
+ * \brief Asynchronously read the value from a value register.
+ *
+ * Performs getValue() on the interface's asynchronous executor (see LayerBase::runAsync()).
+ *
+ * Note: Do not access this driver synchronously while asynchronous accesses might still be pending.
+ *
+ * \param pRegName Name of the register.
+ * \return Future for the read value (\c std::future::get() rethrows the exceptions of getValue()).
+ */
+std::future<std::uint64_t> RegisterDriver::getValueAsync(const std::string_view pRegName)
+{
+    return runAsync([this, regName = std::string(pRegName)]() -> std::uint64_t { return getValue(regName); });
+}
+
+/*!
+ * \brief Asynchronously write a value to a value register.
+ *
+ * Performs setValue() on the interface's asynchronous executor (see LayerBase::runAsync()).
+ *
+ * Note: Do not access this driver synchronously while asynchronous accesses might still be pending.
+ *
+ * \param pRegName Name of the register.
+ * \param pValue Value to be written.
+ * \return Future for completion of the write (\c std::future::get() rethrows the exceptions of setValue()).
+ */
+std::future<void> RegisterDriver::setValueAsync(const std::string_view pRegName, const std::uint64_t pValue)
+{
+    return runAsync([this, regName = std::string(pRegName), pValue]() -> void { setValue(regName, pValue); });
 }
 
 //
@@ -636,7 +866,7 @@ void RegisterDriver::setValue(const std::string_view pRegName, const std::uint64
  */
 std::variant<std::uint64_t, std::vector<std::uint8_t>> RegisterDriver::get(const std::string_view pRegName)
 {
-    const auto it = registers.find(pRegName);
+    const auto it = findRegister(pRegName);
 
     if (it == registers.end())
     {
@@ -665,7 +895,7 @@ std::variant<std::uint64_t, std::vector<std::uint8_t>> RegisterDriver::get(const
  */
 std::variant<std::uint64_t, std::vector<std::uint8_t>> RegisterDriver::get(const std::string_view pRegName) const
 {
-    const auto it = registers.find(pRegName);
+    const auto it = findRegister(pRegName);
 
     if (it == registers.end())
     {
@@ -681,6 +911,76 @@ std::variant<std::uint64_t, std::vector<std::uint8_t>> RegisterDriver::get(const
         return getBytes(pRegName);
 }
 
+/*!
+ * \brief Read multiple registers with merged bus accesses.
+ *
+ * Reads the integer values or byte sequences (according to their data types) of all registers in \p pRegNames
+ * in as few bus accesses as possible: The covered byte ranges of all registers are merged into contiguous address ranges,
+ * which are then read with a single read() each (bypassing the shadow memory, which is updated with the read bytes;
+ * see RegisterDriver()).
+ *
+ * Instead of get(std::string_view), the read contents are \e not compared to the written values cache (see verifyRegisters()).
+ *
+ * \throws std::invalid_argument If no register with name of one of the entries is defined.
+ * \throws std::invalid_argument If a register is write-only.
+ * \throws std::runtime_error If a read fails or the number of received bytes is wrong.
+ *
+ * \param pRegNames Names of the registers to read.
+ * \return Integer values or byte sequences (depending on the DataType of each register), in the order of \p pRegNames.
+ */
+std::vector<std::variant<std::uint64_t, std::vector<std::uint8_t>>> RegisterDriver::getMultiple(const std::vector<std::string>& pRegNames) const
+{
+    std::vector<RegisterTableType::const_iterator> readRegs;
+    readRegs.reserve(pRegNames.size());
+
+    for (const std::string& regName : pRegNames)
+    {
+        const auto it = findRegister(regName);
+
+        if (it == registers.end())
+        {
+            throw std::invalid_argument("The register \"" + regName + "\" is not available " +
+                                        "for register driver \"" + name + "\".");
+        }
+
+        if (it->second.mode == AccessMode::WriteOnly)
+        {
+            throw std::invalid_argument("Cannot read from write-only register \"" + regName + "\" " +
+                                        "of register driver \"" + name + "\".");
+        }
+
+        readRegs.push_back(it);
+    }
+
+    RangeBytesType rangeBytes;
+
+    try
+    {
+        rangeBytes = readMergedRanges(readRegs);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not read multiple registers of register driver \"" + name + "\": " + exc.what());
+    }
+
+    std::vector<std::variant<std::uint64_t, std::vector<std::uint8_t>>> contents;
+    contents.reserve(readRegs.size());
+
+    for (const auto it : readRegs)
+    {
+        const RegisterDescr& regDescr = it->second;
+
+        std::vector<std::uint8_t> regBytes = ::regBytesFromRanges(regDescr, rangeBytes);
+
+        if (regDescr.type == DataType::ByteArray)
+            contents.emplace_back(std::move(regBytes));
+        else
+            contents.emplace_back(Bytes::extractBitField(regBytes, regDescr.offs % 8, regDescr.size));
+    }
+
+    return contents;
+}
+
 /*!
  * \brief Write a value to a value register.
  *
@@ -712,68 +1012,599 @@ void RegisterDriver::set(const std::string_view pRegName, const std::vector<std:
     setBytes(pRegName, pBytes);
 }
 
-//
-
 /*!
- * \brief "Trigger" a write-only register by writing configured default or zero.
+ * \brief Write multiple registers with merged bus accesses.
  *
- * Calls setValue() or setBytes(), depending on the data type of \p pRegName, in order to write the register's default
- * value/sequence, which can be either from its definition (see RegisterDriver(), RegisterDescr) or from the possible
- * "init.REG_NAME" override in the component configuration (see RegisterDriver()). If the latter is present, it will be
- * used, by preference. If there is none of those two, the value zero or a byte sequence consisting of zeros will be written.
+ * Writes all register values/sequences from \p pUpdates (in the given order, i.e. later entries
+ * win for overlapping registers) as a single transaction, instead of one after another.
  *
- * \throws std::invalid_argument If no register with name \p pRegName is defined.
- * \throws std::invalid_argument If AccessMode of \p pRegName is \e not \ref casil::HL::RegisterDescr::AccessMode::WriteOnly "WriteOnly".
- * \throws std::runtime_error If setValue() or setBytes() throw \c std::runtime_error.
+ * All updates are first combined into a local image of the affected register bytes. Bits of partially affected bytes
+ * (value registers not covering full bytes) are taken from the shadow memory where possible (see RegisterDriver()),
+ * otherwise the covered bytes of the concerned register are read once (see also setValue()). The combined image is
+ * then split into the minimal set of contiguous address ranges and each range is written with a single write().
  *
- * \param pRegName Name of the register.
+ * All updates are validated before anything gets read or written.
+ * Saves the new register contents in the written value cache on success.
+ *
+ * \throws std::invalid_argument If no register with name of one of the entries is defined.
+ * \throws std::invalid_argument If the data type of a register does not match the entry's data type.
+ * \throws std::invalid_argument If a register is read-only.
+ * \throws std::invalid_argument If the size of an entry's byte sequence does not match the register size.
+ * \throws std::runtime_error If a needed read fails or a write fails.
+ * \throws std::runtime_error If \p pVerify is set and the read-back fails or does not match for any register.
+ *
+ * \param pUpdates Pairs of register names and integer values or byte sequences to be written.
+ * \param pVerify Verify the written values by reading back the (read-write) registers with merged bus reads (see verifyRegisters()).
  */
-void RegisterDriver::trigger(const std::string_view pRegName)
+void RegisterDriver::set(const std::vector<std::pair<std::string, std::variant<std::uint64_t, std::vector<std::uint8_t>>>>& pUpdates,
+                         const bool pVerify)
 {
-    const auto it = registers.find(pRegName);
+    //Validate all updates first
 
-    if (it == registers.end())
+    std::vector<const RegisterDescr*> updateRegs;
+    updateRegs.reserve(pUpdates.size());
+
+    for (const auto& [regName, regContent] : pUpdates)
     {
-        throw std::invalid_argument("The register \"" + std::string(pRegName) + "\" is not available " +
-                                    "for register driver \"" + name + "\".");
+        const auto it = findRegister(regName);
+
+        if (it == registers.end())
+        {
+            throw std::invalid_argument("The register \"" + regName + "\" is not available " +
+                                        "for register driver \"" + name + "\".");
+        }
+
+        const RegisterDescr& reg = it->second;
+
+        if (reg.type == DataType::Value && !std::holds_alternative<std::uint64_t>(regContent))
+        {
+            throw std::invalid_argument("Cannot write byte sequence to value register \"" + regName + "\" " +
+                                        "of register driver \"" + name + "\".");
+        }
+        if (reg.type == DataType::ByteArray && !std::holds_alternative<std::vector<std::uint8_t>>(regContent))
+        {
+            throw std::invalid_argument("Cannot write value to byte array register \"" + regName + "\" " +
+                                        "of register driver \"" + name + "\".");
+        }
+        if (reg.mode == AccessMode::ReadOnly)
+        {
+            throw std::invalid_argument("Cannot write to read-only register \"" + regName + "\" " +
+                                        "of register driver \"" + name + "\".");
+        }
+        if (reg.type == DataType::ByteArray && std::get<std::vector<std::uint8_t>>(regContent).size() != reg.size)
+        {
+            throw std::invalid_argument("Cannot write wrong number of bytes to register \"" + regName + "\" " +
+                                        "of register driver \"" + name + "\".");
+        }
+
+        updateRegs.push_back(&reg);
     }
 
-    const RegisterDescr& reg = it->second;
+    //Combine updates into local image of affected bytes (address -> {byte, mask of defined bits})
 
-    if (reg.mode != AccessMode::WriteOnly)
+    std::map<std::uint32_t, std::pair<std::uint8_t, std::uint8_t>> image;
+
+    for (std::size_t i = 0; i < pUpdates.size(); ++i)
     {
-        throw std::invalid_argument("Cannot trigger register \"" + std::string(pRegName) + "\" of register driver \"" + name + "\": "+
-                                    "Only available for write-only registers.");
+        const RegisterDescr& reg = *updateRegs[i];
+        const auto& regContent = pUpdates[i].second;
+
+        if (reg.type == DataType::ByteArray)
+        {
+            const std::vector<std::uint8_t>& bytes = std::get<std::vector<std::uint8_t>>(regContent);
+
+            for (std::uint32_t j = 0; j < reg.size; ++j)
+                image[reg.addr + j] = {bytes[j], 0xFFu};
+        }
+        else
+        {
+            const auto [firstByte, endByte] = ::coveredBytes(reg);
+
+            std::vector<std::uint8_t> valueBytes(endByte - firstByte, 0x00u);
+            std::vector<std::uint8_t> maskBytes(endByte - firstByte, 0x00u);
+
+            Bytes::insertBitField(valueBytes, reg.offs % 8, reg.size, std::get<std::uint64_t>(regContent));
+            Bytes::insertBitField(maskBytes, reg.offs % 8, reg.size, ~std::uint64_t{0});
+
+            for (std::uint32_t j = 0; j < endByte - firstByte; ++j)
+            {
+                auto& [byte, mask] = image[firstByte + j];
+
+                byte = static_cast<std::uint8_t>((byte & ~maskBytes[j]) | (valueBytes[j] & maskBytes[j]));
+                mask |= maskBytes[j];
+            }
+        }
     }
 
-    const std::string& regName = it->first;
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
 
-    if (!std::holds_alternative<std::monostate>(initValues[regName]))
+    try
     {
-        if (std::holds_alternative<std::uint64_t>(initValues[regName]))
-            setValue(regName, std::get<std::uint64_t>(initValues[regName]));
-        else if (std::holds_alternative<std::vector<std::uint8_t>>(initValues[regName]))
-            setBytes(regName, std::get<std::vector<std::uint8_t>>(initValues[regName]));
+        //Complete partially defined bytes from shadow memory or by reading the concerned registers
+
+        for (const RegisterDescr* const regPtr : updateRegs)
+        {
+            if (regPtr->type != DataType::Value)
+                continue;
+
+            const auto [firstByte, endByte] = ::coveredBytes(*regPtr);
+
+            bool needRead = false;
+
+            for (std::uint32_t addr = firstByte; addr < endByte; ++addr)
+            {
+                auto& [byte, mask] = image.find(addr)->second;
+
+                if (mask == 0xFFu)
+                    continue;
+
+                if (shadowCovers(addr, 1))
+                {
+                    byte = static_cast<std::uint8_t>((shadowBytes[addr] & ~mask) | (byte & mask));
+                    mask = 0xFFu;
+                }
+                else
+                    needRead = true;
+            }
+
+            if (!needRead)
+                continue;
+
+            const std::vector<std::uint8_t> readBytes = read(firstByte, endByte - firstByte);
+
+            if (readBytes.size() != endByte - firstByte)
+                throw std::runtime_error("Read wrong number of bytes.");
+
+            updateShadow(firstByte, readBytes);
+
+            for (std::uint32_t addr = firstByte; addr < endByte; ++addr)
+            {
+                auto& [byte, mask] = image.find(addr)->second;
+
+                byte = static_cast<std::uint8_t>((readBytes[addr - firstByte] & ~mask) | (byte & mask));
+                mask = 0xFFu;
+            }
+        }
+
+        //Write contiguous address ranges
+
+        for (auto it = image.begin(); it != image.end();)
+        {
+            const std::uint32_t rangeAddr = it->first;
+
+            std::vector<std::uint8_t> rangeBytes;
+
+            for (std::uint32_t addr = rangeAddr; it != image.end() && it->first == addr; ++it, ++addr)
+                rangeBytes.push_back(it->second.first);
+
+            setRegBytes(rangeAddr, rangeBytes);
+        }
     }
-    else if (!std::holds_alternative<std::monostate>(reg.defaultValue))
+    catch (const std::runtime_error& exc)
     {
-        if (std::holds_alternative<std::uint64_t>(reg.defaultValue))
-            setValue(regName, std::get<std::uint64_t>(reg.defaultValue));
-        else if (std::holds_alternative<std::vector<std::uint8_t>>(reg.defaultValue))
-            setBytes(regName, std::get<std::vector<std::uint8_t>>(reg.defaultValue));
+        throw std::runtime_error("Could not write multiple registers of register driver \"" + name + "\": " + exc.what());
     }
-    else
+
+    for (const auto& [regName, regContent] : pUpdates)
     {
-        if (reg.type == DataType::Value)
-            setValue(regName, 0x0u);
+        WrittenCacheEntryType& cacheEntry = registerWrittenCache[findRegister(regName) - registers.begin()];
+
+        if (std::holds_alternative<std::uint64_t>(regContent))
+            cacheEntry.store(std::make_shared<const RegisterDescr::VariantValueType>(std::get<std::uint64_t>(regContent)));
         else
-            setBytes(regName, std::vector<std::uint8_t>(reg.size, 0));
+            cacheEntry.store(std::make_shared<const RegisterDescr::VariantValueType>(std::get<std::vector<std::uint8_t>>(regContent)));
     }
-}
 
-//
+    if (pVerify)
+    {
+        std::vector<std::string> writtenRegs;
 
-/*!
+        for (std::size_t i = 0; i < pUpdates.size(); ++i)
+        {
+            if (updateRegs[i]->mode == AccessMode::ReadWrite)
+                writtenRegs.push_back(pUpdates[i].first);
+        }
+
+        throwOnVerifyMismatch(verifyRegisters(writtenRegs), "writing multiple registers");
+    }
+}
+
+//
+
+/*!
+ * \brief Verify the content of read-write registers by reading them back.
+ *
+ * Reads back all registers in \p pRegNames and compares their contents to the last written values (see get() and set()).
+ * The covered byte ranges of all registers are merged into as few contiguous address ranges as possible, which are then read
+ * with a single read() each (bypassing the shadow memory, which is updated with the read bytes; see RegisterDriver()).
+ *
+ * Registers without a known written value (e.g. none written since the last reset()) are not compared.
+ * A warning is logged for every mismatching register.
+ *
+ * \throws std::invalid_argument If no register with name \p pRegName is defined.
+ * \throws std::invalid_argument If a register is not a read-write register.
+ * \throws std::runtime_error If a read fails or the number of received bytes is wrong.
+ *
+ * \param pRegNames Names of the registers to verify.
+ * \return Names of the registers whose read-back content differs from the written value.
+ */
+std::vector<std::string> RegisterDriver::verifyRegisters(const std::vector<std::string>& pRegNames)
+{
+    std::vector<RegisterTableType::const_iterator> verifyRegs;
+    verifyRegs.reserve(pRegNames.size());
+
+    for (const std::string& regName : pRegNames)
+    {
+        const auto it = findRegister(regName);
+
+        if (it == registers.end())
+        {
+            throw std::invalid_argument("The register \"" + regName + "\" is not available " +
+                                        "for register driver \"" + name + "\".");
+        }
+
+        if (it->second.mode != AccessMode::ReadWrite)
+        {
+            throw std::invalid_argument("Cannot verify register \"" + regName + "\" of register driver \"" + name + "\": " +
+                                        "Only available for read-write registers.");
+        }
+
+        verifyRegs.push_back(it);
+    }
+
+    //Read covered bytes of all registers with merged bus reads
+
+    RangeBytesType rangeBytes;
+
+    try
+    {
+        rangeBytes = readMergedRanges(verifyRegs);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not verify registers of register driver \"" + name + "\": " + exc.what());
+    }
+
+    //Compare read-back register contents with written values
+
+    std::vector<std::string> mismatches;
+
+    for (const auto it : verifyRegs)
+    {
+        const auto& [regName, regDescr] = *it;
+
+        const std::shared_ptr<const RegisterDescr::VariantValueType> cachedVal = registerWrittenCache[it - registers.begin()].load();
+
+        if (!cachedVal)
+            continue;
+
+        const std::vector<std::uint8_t> regBytes = ::regBytesFromRanges(regDescr, rangeBytes);
+
+        bool match;
+
+        if (regDescr.type == DataType::ByteArray)
+            match = (regBytes == std::get<std::vector<std::uint8_t>>(*cachedVal));
+        else
+            match = (Bytes::extractBitField(regBytes, regDescr.offs % 8, regDescr.size) == std::get<std::uint64_t>(*cachedVal));
+
+        if (!match)
+        {
+            logger.logWarning("Read-back verification failed for register \"" + regName + "\": Content differs from written value.");
+            mismatches.push_back(regName);
+        }
+    }
+
+    return mismatches;
+}
+
+//
+
+/*!
+ * \brief "Trigger" a write-only register by writing configured default or zero.
+ *
+ * Calls setValue() or setBytes(), depending on the data type of \p pRegName, in order to write the register's default
+ * value/sequence, which can be either from its definition (see RegisterDriver(), RegisterDescr) or from the possible
+ * "init.REG_NAME" override in the component configuration (see RegisterDriver()). If the latter is present, it will be
+ * used, by preference. If there is none of those two, the value zero or a byte sequence consisting of zeros will be written.
+ *
+ * \throws std::invalid_argument If no register with name \p pRegName is defined.
+ * \throws std::invalid_argument If AccessMode of \p pRegName is \e not \ref casil::HL::RegisterDescr::AccessMode::WriteOnly "WriteOnly".
+ * \throws std::runtime_error If setValue() or setBytes() throw \c std::runtime_error.
+ *
+ * \param pRegName Name of the register.
+ */
+void RegisterDriver::trigger(const std::string_view pRegName)
+{
+    const auto it = findRegister(pRegName);
+
+    if (it == registers.end())
+    {
+        throw std::invalid_argument("The register \"" + std::string(pRegName) + "\" is not available " +
+                                    "for register driver \"" + name + "\".");
+    }
+
+    const RegisterDescr& reg = it->second;
+
+    if (reg.mode != AccessMode::WriteOnly)
+    {
+        throw std::invalid_argument("Cannot trigger register \"" + std::string(pRegName) + "\" of register driver \"" + name + "\": "+
+                                    "Only available for write-only registers.");
+    }
+
+    const std::string& regName = it->first;
+    const RegisterDescr::VariantValueType& initValue = initValues[it - registers.begin()];
+
+    if (!std::holds_alternative<std::monostate>(initValue))
+    {
+        if (std::holds_alternative<std::uint64_t>(initValue))
+            setValue(regName, std::get<std::uint64_t>(initValue));
+        else if (std::holds_alternative<std::vector<std::uint8_t>>(initValue))
+            setBytes(regName, std::get<std::vector<std::uint8_t>>(initValue));
+    }
+    else if (!std::holds_alternative<std::monostate>(reg.defaultValue))
+    {
+        if (std::holds_alternative<std::uint64_t>(reg.defaultValue))
+            setValue(regName, std::get<std::uint64_t>(reg.defaultValue));
+        else if (std::holds_alternative<std::vector<std::uint8_t>>(reg.defaultValue))
+            setBytes(regName, std::get<std::vector<std::uint8_t>>(reg.defaultValue));
+    }
+    else
+    {
+        if (reg.type == DataType::Value)
+            setValue(regName, 0x0u);
+        else
+            setBytes(regName, std::vector<std::uint8_t>(reg.size, 0));
+    }
+
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
+
+    lastTriggerTime = std::chrono::steady_clock::now();
+}
+
+//
+
+/*!
+ * \brief Wait for the module to finish, using the learned action duration.
+ *
+ * Like Driver::waitUntilDone() but additionally uses the duration measured for the last successful wait, i.e. the time
+ * from the last trigger() call until isDone() returned true, to predict when the current action will finish. If trigger()
+ * was called since the last successful wait, the first poll of isDone() is delayed until 3/4 of the predicted duration have
+ * passed since that trigger() call (unless WaitPolicy::expectedDuration of \p pPolicy requests a longer delay), in order
+ * to avoid bus traffic from polls that would most likely return false anyway.
+ *
+ * \throws std::invalid_argument See Driver::waitUntilDone().
+ * \throws std::runtime_error See Driver::waitUntilDone().
+ *
+ * \param pTimeout Maximum time to wait.
+ * \param pPolicy Polling parameters.
+ * \return True if finished and false on timeout.
+ */
+bool RegisterDriver::waitUntilDone(const std::chrono::milliseconds pTimeout, const WaitPolicy& pPolicy)
+{
+    using std::chrono::microseconds;
+    using std::chrono::steady_clock;
+
+    WaitPolicy policy = pPolicy;
+
+    {
+        const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+        (void)accessLock;
+
+        if (lastTriggerTime.has_value())
+        {
+            const microseconds elapsed = std::chrono::duration_cast<microseconds>(steady_clock::now() - lastTriggerTime.value());
+            const microseconds predictedRemaining = learnedDuration * 3 / 4 - elapsed;
+
+            policy.expectedDuration = std::max(policy.expectedDuration, predictedRemaining);
+        }
+    }
+
+    //Do not hold the lock while waiting, so that other threads can access the module meanwhile
+    if (!MuxedDriver::waitUntilDone(pTimeout, policy))
+        return false;
+
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
+
+    if (lastTriggerTime.has_value())
+    {
+        learnedDuration = std::chrono::duration_cast<microseconds>(steady_clock::now() - lastTriggerTime.value());
+        lastTriggerTime.reset();
+    }
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Get the last known register content from the shadow memory.
+ *
+ * Returns the content of register \p pRegName as known from the shadow memory (see RegisterDriver()), i.e. as last written
+ * to or read from the module, without accessing the module. This also works for write-only registers, which cannot be read back.
+ *
+ * \throws std::invalid_argument If no register with name \p pRegName is defined.
+ * \throws std::invalid_argument If \p pRegName is read-only.
+ * \throws std::runtime_error If the shadow memory is not enabled.
+ * \throws std::runtime_error If the register content is (partially) unknown to the shadow memory.
+ *
+ * \param pRegName Name of the register.
+ * \return Integer value or byte sequence of the register, depending on its data type.
+ */
+std::variant<std::uint64_t, std::vector<std::uint8_t>> RegisterDriver::getShadow(const std::string_view pRegName) const
+{
+    const auto it = findRegister(pRegName);
+
+    if (it == registers.end())
+    {
+        throw std::invalid_argument("The register \"" + std::string(pRegName) + "\" is not available " +
+                                    "for register driver \"" + name + "\".");
+    }
+
+    const RegisterDescr& reg = it->second;
+
+    if (reg.mode == AccessMode::ReadOnly)
+    {
+        throw std::invalid_argument("Cannot get shadow content of read-only register \"" + std::string(pRegName) + "\" " +
+                                    "of register driver \"" + name + "\".");
+    }
+
+    if (!useShadow)
+        throw std::runtime_error("Shadow memory is not enabled for register driver \"" + name + "\".");
+
+    const auto [firstByte, endByte] = ::coveredBytes(reg);
+
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
+
+    if (!std::all_of(shadowValid.begin() + firstByte, shadowValid.begin() + endByte, [](const bool pValid) -> bool { return pValid; }))
+    {
+        throw std::runtime_error("Content of register \"" + std::string(pRegName) + "\" of register driver \"" + name + "\" " +
+                                 "is unknown to the shadow memory.");
+    }
+
+    const Bytes::SmallByteVec bytes = getShadowBytes(firstByte, endByte - firstByte);
+
+    if (reg.type == DataType::ByteArray)
+        return bytes.toVector();
+    else
+        return Bytes::extractBitField(bytes, reg.offs % 8, reg.size);
+}
+
+/*!
+ * \brief Mark the whole shadow memory content as unknown.
+ *
+ * Subsequent register accesses will read from the module again where needed (see RegisterDriver()).
+ * Call this whenever the module's registers might have changed without the driver's knowledge.
+ *
+ * Does nothing if the shadow memory is not enabled.
+ */
+void RegisterDriver::invalidateShadow()
+{
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
+
+    std::fill(shadowValid.begin(), shadowValid.end(), false);
+}
+
+//
+
+/*!
+ * \brief Read the content of all read-write registers as a compact binary blob.
+ *
+ * Reads all bytes that are occupied only by read-write registers, using a single read() for each contiguous
+ * address range (i.e. typically only a few large bus bursts), and concatenates them in address order.
+ * Bytes that are (also) occupied by read-only or write-only registers are skipped, since these could not be restored anyway.
+ *
+ * The returned blob is only meaningful for restore() of the same driver (or one with identical register definitions).
+ *
+ * \throws std::runtime_error If a read fails or the number of received bytes is wrong.
+ *
+ * \return Concatenated register bytes.
+ */
+std::vector<std::uint8_t> RegisterDriver::snapshot() const
+{
+    std::vector<std::uint8_t> snapshotBytes;
+
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
+
+    try
+    {
+        for (const auto& [rangeAddr, rangeSize] : snapshotRanges)
+        {
+            const Bytes::SmallByteVec rangeBytes = getRegBytes(rangeAddr, rangeSize);
+            snapshotBytes.insert(snapshotBytes.end(), rangeBytes.begin(), rangeBytes.end());
+        }
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not take register snapshot of register driver \"" + name + "\": " + exc.what());
+    }
+
+    return snapshotBytes;
+}
+
+/*!
+ * \brief Write back the content of all read-write registers from a snapshot() blob.
+ *
+ * Writes the bytes from \p pSnapshot back to the module, using a single write() for each contiguous address range (see snapshot()).
+ * Updates the written value cache of all read-write registers accordingly.
+ *
+ * \throws std::invalid_argument If the size of \p pSnapshot does not match the snapshot size of this driver.
+ * \throws std::runtime_error If a write fails.
+ *
+ * \param pSnapshot Register bytes as returned by snapshot().
+ */
+void RegisterDriver::restore(const std::vector<std::uint8_t>& pSnapshot)
+{
+    std::size_t snapshotSize = 0;
+
+    for (const auto& range : snapshotRanges)
+        snapshotSize += range.second;
+
+    if (pSnapshot.size() != snapshotSize)
+        throw std::invalid_argument("Register snapshot has wrong size for register driver \"" + name + "\".");
+
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
+
+    try
+    {
+        std::size_t pos = 0;
+
+        for (const auto& [rangeAddr, rangeSize] : snapshotRanges)
+        {
+            setRegBytes(rangeAddr, std::span<const std::uint8_t>(pSnapshot).subspan(pos, rangeSize));
+            pos += rangeSize;
+        }
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not restore register snapshot of register driver \"" + name + "\": " + exc.what());
+    }
+
+    //Update written value cache from restored bytes
+
+    for (std::size_t regIdx = 0; regIdx < registers.size(); ++regIdx)
+    {
+        const RegisterDescr& regDescr = registers[regIdx].second;
+
+        if (regDescr.mode != AccessMode::ReadWrite)
+            continue;
+
+        const auto [firstByte, endByte] = ::coveredBytes(regDescr);
+
+        std::size_t pos = 0;
+
+        for (const auto& [rangeAddr, rangeSize] : snapshotRanges)
+        {
+            if (firstByte >= rangeAddr && endByte <= rangeAddr + rangeSize)
+            {
+                pos += firstByte - rangeAddr;
+                break;
+            }
+
+            pos += rangeSize;
+        }
+
+        const std::vector<std::uint8_t> regBytes(pSnapshot.begin() + pos, pSnapshot.begin() + pos + (endByte - firstByte));
+
+        if (regDescr.type == DataType::ByteArray)
+            registerWrittenCache[regIdx].store(std::make_shared<const RegisterDescr::VariantValueType>(regBytes));
+        else
+        {
+            registerWrittenCache[regIdx].store(
+                        std::make_shared<const RegisterDescr::VariantValueType>(Bytes::extractBitField(regBytes, regDescr.offs % 8, regDescr.size)));
+        }
+    }
+}
+
+//
+
+/*!
  * \brief Check if a register exists or throw an exception else.
  *
  * \throws std::invalid_argument If no register with name \p pRegName is defined.
@@ -783,7 +1614,7 @@ void RegisterDriver::trigger(const std::string_view pRegName)
  */
 bool RegisterDriver::testRegisterName(const std::string_view pRegName) const
 {
-    if (registers.contains(pRegName))
+    if (findRegister(pRegName) != registers.end())
         return true;
     else
         throw std::invalid_argument("The register \"" + std::string(pRegName) + "\" is not available for register driver \"" + name + "\".");
@@ -809,6 +1640,196 @@ bool RegisterDriver::isValidRegisterName(const std::string_view pRegName)
     return std::find_if_not(pRegName.begin(), pRegName.end(), isValidRegNameChar) == pRegName.end();
 }
 
+//
+
+/*!
+ * \brief Reset several modules and read their firmware versions with combined bus accesses per interface for their next init().
+ *
+ * Performs the reset and firmware version read steps of init() (see initImpl()) for all \p pDrivers that are not
+ * yet initialized (or for all of them if \p pForce is set) ahead of time, but combines the bus accesses of drivers
+ * that share the same interface: The reset register writes (see getResetRegisterWrite()) of all of these drivers
+ * are written with a single TL::MuxedInterface::writeBatch() and afterwards the version registers (see getVersionRegister())
+ * are read with a single TL::MuxedInterface::readBatch(), which e.g. the %SiTCP interface pipelines. This way initializing
+ * many modules on the same board costs a few round trips instead of two per module.
+ *
+ * The next init() of each driver then uses these results instead of calling reset() and getModuleFirmwareVersion().
+ * Drivers that do not define the needed registers are skipped, as well as all drivers of an interface whose combined
+ * access failed (only logs a warning), such that their init() performs the separate accesses as usual.
+ *
+ * Use discardGroupInit() to drop the results for drivers whose init() is not called afterwards.
+ * See also Device::init().
+ *
+ * \param pDrivers Drivers to be initialized.
+ * \param pForce Also prepare drivers that are already initialized (as for init() with \p pForce set).
+ */
+void RegisterDriver::prepareGroupInit(const std::vector<std::reference_wrapper<RegisterDriver>>& pDrivers, const bool pForce)
+{
+    //Group drivers by interface in order of appearance
+    std::vector<std::pair<InterfaceBaseType*, std::vector<RegisterDriver*>>> interfaceGroups;
+
+    for (RegisterDriver& driver : pDrivers)
+    {
+        if (driver.initialized && !pForce)
+            continue;
+
+        auto it = std::find_if(interfaceGroups.begin(), interfaceGroups.end(),
+                               [&driver](const auto& pGroup) -> bool { return pGroup.first == &driver.interface; });
+
+        if (it == interfaceGroups.end())
+            it = interfaceGroups.insert(interfaceGroups.end(), {&driver.interface, {}});
+
+        it->second.push_back(&driver);
+    }
+
+    for (const auto& [interface, drivers] : interfaceGroups)
+    {
+        //Combine the reset register writes (only single full-byte value registers, no read-modify-write)
+
+        std::vector<TL::MuxedInterface::WriteOp> resetOps;
+        std::vector<RegisterDriver*> resetDrivers;
+
+        for (RegisterDriver* const driver : drivers)
+        {
+            const std::optional<std::pair<std::string, std::uint64_t>> resetWrite = driver->getResetRegisterWrite();
+
+            if (!resetWrite.has_value())
+                continue;
+
+            const auto it = driver->findRegister(resetWrite->first);
+
+            if (it == driver->registers.end() || it->second.type != DataType::Value || it->second.offs % 8 != 0 || it->second.size % 8 != 0)
+                continue;
+
+            std::vector<std::uint8_t> bytes(it->second.size / 8, 0x00u);
+            Bytes::insertBitField(bytes, 0, it->second.size, resetWrite->second);
+
+            resetOps.push_back({driver->baseAddr + it->second.addr + it->second.offs / 8, std::move(bytes)});
+            resetDrivers.push_back(driver);
+        }
+
+        if (resetOps.size() < 2)
+            continue;
+
+        try
+        {
+            interface->writeBatch(resetOps);
+        }
+        catch (const std::runtime_error& exc)
+        {
+            Logger::logWarning("Could not reset firmware modules on interface \"" + interface->getName() + "\" with combined writes: " +
+                               exc.what());
+            continue;
+        }
+
+        for (RegisterDriver* const driver : resetDrivers)
+        {
+            driver->resetDriverState();
+            driver->preparedReset = true;
+        }
+
+        //Combine the version register reads (only for drivers that were reset above, to keep the order of init())
+
+        std::vector<TL::MuxedInterface::ReadOp> versionOps;
+        std::vector<std::pair<RegisterDriver*, const RegisterDescr*>> versionDrivers;
+
+        for (RegisterDriver* const driver : resetDrivers)
+        {
+            const std::optional<std::string> versionReg = driver->getVersionRegister();
+
+            if (!versionReg.has_value())
+                continue;
+
+            const auto it = driver->findRegister(*versionReg);
+
+            if (it == driver->registers.end() || it->second.type != DataType::Value || it->second.mode == AccessMode::WriteOnly)
+                continue;
+
+            const auto [firstByte, endByte] = ::coveredBytes(it->second);
+
+            versionOps.push_back({driver->baseAddr + firstByte, static_cast<int>(endByte - firstByte)});
+            versionDrivers.emplace_back(driver, &it->second);
+        }
+
+        if (versionOps.empty())
+            continue;
+
+        std::vector<std::vector<std::uint8_t>> versionBytes;
+
+        try
+        {
+            versionBytes = interface->readBatch(versionOps);
+        }
+        catch (const std::runtime_error& exc)
+        {
+            Logger::logWarning("Could not read firmware module versions on interface \"" + interface->getName() + "\" with combined reads: " +
+                               exc.what());
+            continue;
+        }
+
+        if (versionBytes.size() != versionOps.size())
+            continue;
+
+        for (std::size_t i = 0; i < versionOps.size(); ++i)
+        {
+            const auto [driver, regDescr] = versionDrivers[i];
+
+            if (std::cmp_not_equal(versionBytes[i].size(), versionOps[i].size))
+                continue;
+
+            driver->preparedFirmwareVersion = static_cast<std::uint8_t>(Bytes::extractBitField(versionBytes[i], regDescr->offs % 8,
+                                                                                               regDescr->size));
+        }
+    }
+}
+
+/*!
+ * \brief Discard unused results of prepareGroupInit().
+ *
+ * Makes the next init() of all \p pDrivers perform the reset and firmware version read steps separately again.
+ *
+ * \param pDrivers Drivers that were passed to prepareGroupInit().
+ */
+void RegisterDriver::discardGroupInit(const std::vector<std::reference_wrapper<RegisterDriver>>& pDrivers)
+{
+    for (RegisterDriver& driver : pDrivers)
+    {
+        driver.preparedReset = false;
+        driver.preparedFirmwareVersion.reset();
+    }
+}
+
+//Protected
+
+/*!
+ * \brief Get the last written content of a register.
+ *
+ * Returns the value/sequence from the written value cache, i.e. as last written by any of the write functions
+ * (see e.g. set(), setValue(), setBytes()), without accessing the module. Note that the cache is only cleared
+ * on reset() if "clear_cache_after_reset" is enabled (see RegisterDriver()).
+ *
+ * \throws std::invalid_argument If no register with name \p pRegName is defined.
+ *
+ * \param pRegName Name of the register.
+ * \return Last written integer value or byte sequence, or \c std::monostate if unknown.
+ */
+casil::HL::RegisterDescr::VariantValueType RegisterDriver::getWrittenValue(const std::string_view pRegName) const
+{
+    const auto it = findRegister(pRegName);
+
+    if (it == registers.end())
+    {
+        throw std::invalid_argument("The register \"" + std::string(pRegName) + "\" is not available " +
+                                    "for register driver \"" + name + "\".");
+    }
+
+    const std::shared_ptr<const RegisterDescr::VariantValueType> cachedVal = registerWrittenCache[it - registers.begin()].load();
+
+    if (!cachedVal)
+        return std::monostate{};
+
+    return *cachedVal;
+}
+
 //Private
 
 /*!
@@ -817,13 +1838,20 @@ bool RegisterDriver::isValidRegisterName(const std::string_view pRegName)
  * Resets the firmware module (see reset()), checks the driver's compatibility with the module (see checkVersionRequirement()),
  * write register defaults (see applyDefaults()) and performs further module-specific initialization steps (see initModule()).
  *
+ * If the reset and/or the firmware version read were already performed by prepareGroupInit(), these results are used
+ * (once) instead of accessing the module again.
+ *
  * \return True if successful.
  */
 bool RegisterDriver::initImpl()
 {
+    const bool alreadyReset = std::exchange(preparedReset, false);
+    const std::optional<std::uint8_t> preparedVersion = std::exchange(preparedFirmwareVersion, std::nullopt);
+
     try
     {
-        reset();
+        if (!alreadyReset)
+            reset();
     }
     catch (const std::runtime_error& exc)
     {
@@ -836,7 +1864,7 @@ bool RegisterDriver::initImpl()
 
     try
     {
-        firmwareVersion = getModuleFirmwareVersion();
+        firmwareVersion = (preparedVersion.has_value() ? *preparedVersion : getModuleFirmwareVersion());
     }
     catch (const std::runtime_error& exc)
     {
@@ -936,7 +1964,7 @@ void RegisterDriver::loadRuntimeConfImpl(boost::property_tree::ptree&& pConf)
         else if (!subTree.empty() && subTree.data() != "")
             throw std::runtime_error("Node must have either non-empty data or a child node.");
 
-        const auto regIt = registers.find(key);
+        const auto regIt = findRegister(key);
 
         if (regIt == registers.end())
             throw std::runtime_error("Register \"" + key + "\" is not available.");
@@ -1033,6 +2061,64 @@ boost::property_tree::ptree RegisterDriver::dumpRuntimeConfImpl() const
 
 //
 
+/*!
+ * \brief Estimate the component-specific heap memory usage.
+ *
+ * Reports the following categories (see also LayerBase::getMemoryUsage()):
+ * - "registers": %Register table (names and definitions).
+ * - "cache": Cache of last written register values (see getWrittenValue()).
+ * - "init_values": Overridden default values from the configuration.
+ * - "shadow": Shadow copy of the register address space including its bookkeeping (see getShadow()) and the snapshot() ranges.
+ * - "proxies": Proxy class instances created on access (see operator[]()).
+ *
+ * \return Estimated numbers of allocated bytes by category.
+ */
+std::map<std::string, std::size_t> RegisterDriver::getMemoryUsageImpl() const
+{
+    std::size_t registerBytes = registers.capacity() * sizeof(RegisterTableType::value_type);
+    std::size_t cacheBytes = registers.size() * sizeof(WrittenCacheEntryType);
+    std::size_t initValueBytes = initValues.capacity() * sizeof(RegisterDescr::VariantValueType);
+
+    for (std::size_t i = 0; i < registers.size(); ++i)
+    {
+        registerBytes += Auxil::estimateHeapUsage(registers[i].first) + valueHeapUsage(registers[i].second.defaultValue);
+
+        if (const std::shared_ptr<const RegisterDescr::VariantValueType> value = registerWrittenCache[i].load(); value)
+            cacheBytes += sizeof(RegisterDescr::VariantValueType) + Auxil::heapNodeOverhead + valueHeapUsage(*value);
+
+        if (i < initValues.size())
+            initValueBytes += valueHeapUsage(initValues[i]);
+    }
+
+    std::size_t shadowBytesUsage = 0;
+
+    {
+        const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+        (void)accessLock;
+
+        shadowBytesUsage = shadowBytes.capacity() + (shadowValid.capacity() + shadowRMWSafe.capacity()) / 8 +
+                           snapshotRanges.capacity() * sizeof(std::pair<std::uint32_t, std::uint32_t>);
+    }
+
+    std::size_t proxyBytes = 0;
+
+    {
+        const std::lock_guard<std::mutex> proxyLock(proxyMutex);
+        (void)proxyLock;
+
+        proxyBytes = registerProxies.capacity() * sizeof(std::unique_ptr<RegisterProxy>);
+
+        for (std::size_t i = 0; i < registerProxies.size(); ++i)
+            if (registerProxies[i])
+                proxyBytes += sizeof(RegisterProxy) + Auxil::estimateHeapUsage(registers[i].first);
+    }
+
+    return {{"registers", registerBytes}, {"cache", cacheBytes}, {"init_values", initValueBytes}, {"shadow", shadowBytesUsage},
+            {"proxies", proxyBytes}};
+}
+
+//
+
 /*!
  * \brief Perform module-specific initialization steps.
  *
@@ -1088,245 +2174,377 @@ bool RegisterDriver::checkVersionRequirement()
 
 //
 
+/*!
+ * \brief Get the single value register write performed by resetImpl() (for combined resets).
+ *
+ * Override this if resetImpl() does nothing else on the bus than writing a value to a full-byte value register.
+ * Multiple such resets can then be combined into a single bus access by prepareGroupInit(), which
+ * calls resetDriverState() instead of resetImpl() afterwards. Hence resetImpl() must not change any
+ * other driver state that would not be set up by initModule() anyway.
+ *
+ * Returns an empty optional by default (resets cannot be combined).
+ *
+ * \return Name of the register and value written to it, if applicable.
+ */
+std::optional<std::pair<std::string, std::uint64_t>> RegisterDriver::getResetRegisterWrite() const
+{
+    return std::nullopt;
+}
+
+/*!
+ * \brief Get the value register read by getModuleFirmwareVersion() (for combined reads).
+ *
+ * Override this if getModuleFirmwareVersion() does nothing else than reading this register's value.
+ * The version registers of multiple modules can then be read with a single bus access by prepareGroupInit().
+ *
+ * Returns an empty optional by default (version reads cannot be combined).
+ *
+ * \return Name of the version register, if applicable.
+ */
+std::optional<std::string> RegisterDriver::getVersionRegister() const
+{
+    return std::nullopt;
+}
+
+//
+
+/*!
+ * \brief Invalidate the driver-side register state after a reset.
+ *
+ * Marks the shadow memory content as unknown (see invalidateShadow()) and clears the
+ * cache for previously written register values if "clear_cache_after_reset" is enabled (see RegisterDriver()).
+ */
+void RegisterDriver::resetDriverState()
+{
+    invalidateShadow();
+
+    if (clearRegValCacheOnReset)
+    {
+        for (std::size_t regIdx = 0; regIdx < registers.size(); ++regIdx)
+            registerWrittenCache[regIdx].store(nullptr);
+    }
+}
+
+//
+
+/*!
+ * \brief Throw an exception listing registers that failed the read-back verification.
+ *
+ * Does nothing if \p pMismatches is empty.
+ *
+ * \throws std::runtime_error If \p pMismatches is not empty.
+ *
+ * \param pMismatches Names of mismatching registers (see verifyRegisters()).
+ * \param pContext Description of the verified operation for the error message.
+ */
+void RegisterDriver::throwOnVerifyMismatch(const std::vector<std::string>& pMismatches, const std::string& pContext) const
+{
+    if (pMismatches.empty())
+        return;
+
+    std::string regList;
+
+    for (const std::string& regName : pMismatches)
+        regList += (regList.empty() ? "\"" : ", \"") + regName + "\"";
+
+    throw std::runtime_error("Read-back verification failed after " + pContext + " for register driver \"" + name + "\" " +
+                             "for register(s) " + regList + ".");
+}
+
+//
+
+/*!
+ * \brief Look up a register in the sorted register table.
+ *
+ * \param pRegName Name of the register.
+ * \return Iterator to the table entry of register \p pRegName or \c registers.end() if not defined.
+ */
+RegisterDriver::RegisterTableType::const_iterator RegisterDriver::findRegister(const std::string_view pRegName) const
+{
+    const auto it = std::lower_bound(registers.begin(), registers.end(), pRegName,
+                                     [](const RegisterTableType::value_type& pEntry, const std::string_view pName) -> bool
+                                     {
+                                         return pEntry.first < pName;
+                                     });
+
+    if (it != registers.end() && it->first == pRegName)
+        return it;
+
+    return registers.end();
+}
+
+//
+
 /*!
  * \brief Read a byte sequence from a register address.
  *
- * Reads \p pRegSize bytes at register address \p pRegAddr via read().
+ * Reads \p pRegSize bytes at register address \p pRegAddr via readSmall().
  *
- * \throws std::runtime_error If read() fails or the number of received bytes differs from \p pRegSize.
+ * If "trust_shadow" is enabled (see RegisterDriver()) and the shadow memory covers the
+ * requested bytes (see shadowCovers()), the bytes are taken from the shadow memory instead.
+ * Otherwise the read bytes are merged into the shadow memory (if enabled).
+ * Only actual bus reads are recorded by the Tracer (if enabled).
+ *
+ * The bytes are returned as Bytes::SmallByteVec and read via readSmall(), such that typical short registers
+ * do not need any memory allocation.
+ *
+ * \throws std::runtime_error If readSmall() fails or the number of received bytes differs from \p pRegSize.
  *
  * \param pRegAddr Module-local register address.
  * \param pRegSize Register size in bytes.
  * \return Read bytes.
  */
-std::vector<std::uint8_t> RegisterDriver::getRegBytes(const std::uint32_t pRegAddr, const std::uint32_t pRegSize) const
+casil::Bytes::SmallByteVec RegisterDriver::getRegBytes(const std::uint32_t pRegAddr, const std::uint32_t pRegSize) const
 {
-    const std::vector<std::uint8_t> readBytes = read(pRegAddr, pRegSize);
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
+
+    if (trustShadow && shadowCovers(pRegAddr, pRegSize))
+        return getShadowBytes(pRegAddr, pRegSize);
+
+    const Tracer::Scope trace(traceSource, Tracer::Event::RegisterRead, pRegAddr, pRegSize);
+
+    Bytes::SmallByteVec readBytes = readSmall(pRegAddr, static_cast<int>(pRegSize));
 
     if (readBytes.size() != pRegSize)
         throw std::runtime_error("Read wrong number of bytes.");
 
+    updateShadow(pRegAddr, readBytes);
+
     return readBytes;
 }
 
 /*!
  * \brief Write a byte sequence to a register address.
  *
- * Writes \p pData to register address \p pRegAddr via write().
+ * Writes \p pData to register address \p pRegAddr via writeFrom() and merges it into the shadow memory (if enabled; see RegisterDriver()).
  *
- * \throws std::runtime_error If write() fails.
+ * \throws std::runtime_error If writeFrom() fails.
  *
  * \param pRegAddr Module-local register address.
  * \param pData Byte sequence to be written.
  */
-void RegisterDriver::setRegBytes(const std::uint32_t pRegAddr, const std::vector<std::uint8_t>& pData) const
+void RegisterDriver::setRegBytes(const std::uint32_t pRegAddr, const std::span<const std::uint8_t> pData) const
 {
-    write(pRegAddr, pData);
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
+
+    const Tracer::Scope trace(traceSource, Tracer::Event::RegisterWrite, pRegAddr, static_cast<std::uint32_t>(pData.size()));
+
+    writeFrom(pRegAddr, pData);
+
+    updateShadow(pRegAddr, pData);
 }
 
 //
 
 /*!
- * \brief Read an integer value from a register address.
+ * \brief Read an integer value from a register address.
+ *
+ * Reads \c N full bytes at register address \p pRegAddr via getRegBytes(), with \c N such that the contained integer
+ * value at bit offset \p pRegOffs and with bit size \p pRegSize can be determined. This value will be returned.
+ *
+ * \throws std::runtime_error If getRegBytes() fails.
+ *
+ * \param pRegAddr Module-local register address (in bytes).
+ * \param pRegSize Register size in bits (i.e. bit length of stored value).
+ * \param pRegOffs Register offset in bits (i.e. bit offset of stored value with respect to \p pRegAddr).
+ * \return Read value.
+ */
+std::uint64_t RegisterDriver::getRegValue(const std::uint32_t pRegAddr, const std::uint32_t pRegSize, const std::uint32_t pRegOffs) const
+{
+    const std::uint32_t byteOffs = pRegOffs / 8;
+    const std::uint32_t bitOffs = pRegOffs % 8;
+
+    std::uint32_t readByteSize = (bitOffs + pRegSize) / 8;
+    if ((bitOffs + pRegSize) % 8 > 0)
+        ++readByteSize;
+
+    return Bytes::extractBitField(getRegBytes(pRegAddr + byteOffs, readByteSize), bitOffs, pRegSize);
+}
+
+/*!
+ * \brief Write an integer value to a register address.
  *
- * Reads \c N full bytes at register address \p pRegAddr via read(), with \c N such that the contained integer
- * value at bit offset \p pRegOffs and with bit size \p pRegSize can be determined. This value will be returned.
+ * If the register only covers \e full bytes (i.e. \p pRegSize and \p pRegOffs each a multiple of 8), writes the new value
+ * \p pValue to the register at address \p pRegAddr, with bit offset \p pRegOffs and bit size \p pRegSize using setRegBytes().
  *
- * \throws std::runtime_error If read() fails or the number of received bytes differs from \c N.
+ * Otherwise, first \e reads the \c N covered bytes using readSmall() (similar to getRegValue()),
+ * modifies only the bits in <tt>[pRegOffs, pRegOffs+pRegSize)</tt>, which represent the stored value
+ * (see Bytes::insertBitField()), and then writes back the partially modified byte sequence to \p pRegAddr using setRegBytes().
+ * If the shadow memory is enabled and covers the \c N bytes (see RegisterDriver() and shadowCovers()),
+ * the bytes are taken from the shadow memory instead, such that only a single write is needed.
+ * All byte sequences are kept in Bytes::SmallByteVec, i.e. without memory allocation.
+ *
+ * \throws std::runtime_error If the potential readSmall() fails or the number of received bytes differs from \c N.
+ * \throws std::runtime_error If writeFrom() fails.
  *
  * \param pRegAddr Module-local register address (in bytes).
  * \param pRegSize Register size in bits (i.e. bit length of stored value).
  * \param pRegOffs Register offset in bits (i.e. bit offset of stored value with respect to \p pRegAddr).
- * \return Read value.
+ * \param pValue Value to be written.
  */
-std::uint64_t RegisterDriver::getRegValue(const std::uint32_t pRegAddr, const std::uint32_t pRegSize, const std::uint32_t pRegOffs) const
+void RegisterDriver::setRegValue(const std::uint32_t pRegAddr, const std::uint32_t pRegSize,
+                                 const std::uint32_t pRegOffs, const std::uint64_t pValue) const
 {
     const std::uint32_t byteOffs = pRegOffs / 8;
     const std::uint32_t bitOffs = pRegOffs % 8;
 
-    std::uint32_t readByteSize = (bitOffs + pRegSize) / 8;
+    std::uint32_t writeByteSize = (bitOffs + pRegSize) / 8;
     if ((bitOffs + pRegSize) % 8 > 0)
-        ++readByteSize;
+        ++writeByteSize;
 
-    const std::vector<std::uint8_t> readBytes = read(pRegAddr + byteOffs, readByteSize);
+    //Keep read-modify-write sequence atomic with respect to other threads
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
 
-    if (readBytes.size() != readByteSize)
-        throw std::runtime_error("Read wrong number of bytes.");
+    Bytes::SmallByteVec writeBytes;     //Inline storage suffices for all integer registers (no allocation)
 
-    if (readByteSize > 9)
+    if (bitOffs == 0 && (pRegSize % 8) == 0)
+        writeBytes.resize(writeByteSize, 0x00u);                //Value covers full bytes, nothing to preserve
+    else if (shadowCovers(pRegAddr + byteOffs, writeByteSize))  //Can merge into shadow memory and skip the read
+        writeBytes = getShadowBytes(pRegAddr + byteOffs, writeByteSize);
+    else
     {
-        throw std::runtime_error("Read size of register exceeds 64 bits. THIS SHOULD NEVER HAPPEN!");
+        writeBytes = readSmall(pRegAddr + byteOffs, static_cast<int>(writeByteSize));
+
+        if (writeBytes.size() != writeByteSize)
+            throw std::runtime_error("Read wrong number of bytes.");
     }
-    else if (readByteSize == 9)
-    {
-        const std::uint8_t partialValLhs = readBytes[0];
-        const std::uint64_t partialValRhs = Bytes::composeUInt64(std::span<const std::uint8_t, 8>(readBytes.begin()+1, 8), true);
 
-        const std::size_t lhsBitCount = 8 - bitOffs;
+    Bytes::insertBitField(writeBytes, bitOffs, pRegSize, pValue);
 
-        const std::uint64_t intermedVal = (static_cast<std::uint64_t>(static_cast<std::uint8_t>(partialValLhs << bitOffs)) << 56) |
-                                     (static_cast<std::uint64_t>(partialValRhs >> lhsBitCount));
+    setRegBytes(pRegAddr + byteOffs, writeBytes);
+}
 
-        return static_cast<std::uint64_t>(intermedVal >> static_cast<std::size_t>(64 - pRegSize));
-    }
-    else if (readByteSize == 8)
-    {
-        const std::uint64_t tmpVal = Bytes::composeUInt64(readBytes, true);
-        return static_cast<std::uint64_t>(static_cast<std::uint64_t>(tmpVal << bitOffs) >> static_cast<std::size_t>(64 - pRegSize));
-    }
-    else if (readByteSize > 4)
-    {
-        const std::size_t paddingBytes = 8 - readByteSize;
-        const std::size_t paddedBitOffs = 8*paddingBytes + bitOffs;
+//
 
-        std::vector<std::uint8_t> readBytesPadded(8, 0);
-        std::copy(readBytes.begin(), readBytes.end(), readBytesPadded.begin()+paddingBytes);
+/*!
+ * \brief Check if the shadow memory knows a byte range that only read-write registers occupy.
+ *
+ * \param pAddr Module-local address of the first byte.
+ * \param pSize Number of bytes.
+ * \return True if the shadow memory is enabled and each of the bytes is known and only occupied by read-write registers.
+ */
+bool RegisterDriver::shadowCovers(const std::uint32_t pAddr, const std::uint32_t pSize) const
+{
+    if (!useShadow || pAddr + pSize > shadowBytes.size())
+        return false;
 
-        const std::uint64_t tmpVal = Bytes::composeUInt64(readBytesPadded, true);
-        return static_cast<std::uint64_t>(static_cast<std::uint64_t>(tmpVal << paddedBitOffs) >> static_cast<std::size_t>(64 - pRegSize));
-    }
-    else if (readByteSize == 4)
+    for (std::uint32_t i = pAddr; i < pAddr + pSize; ++i)
     {
-        const std::uint32_t tmpVal = Bytes::composeUInt32(readBytes, true);
-        return static_cast<std::uint32_t>(static_cast<std::uint32_t>(tmpVal << bitOffs) >> static_cast<std::size_t>(32 - pRegSize));
+        if (!shadowValid[i] || !shadowRMWSafe[i])
+            return false;
     }
-    else if (readByteSize == 3)
-    {
-        constexpr std::size_t paddingBytes = 1;
-        const std::size_t paddedBitOffs = 8*paddingBytes + bitOffs;
 
-        const std::vector<std::uint8_t> readBytesPadded {0, readBytes[0], readBytes[1], readBytes[2]};
+    return true;
+}
 
-        const std::uint32_t tmpVal = Bytes::composeUInt32(readBytesPadded, true);
-        return static_cast<std::uint32_t>(static_cast<std::uint32_t>(tmpVal << paddedBitOffs) >> static_cast<std::size_t>(32 - pRegSize));
-    }
-    else if (readByteSize == 2)
-    {
-        const std::uint16_t tmpVal = Bytes::composeUInt16(readBytes, true);
-        return static_cast<std::uint16_t>(static_cast<std::uint16_t>(tmpVal << bitOffs) >> static_cast<std::size_t>(16 - pRegSize));
-    }
-    else if (readByteSize == 1)
+/*!
+ * \brief Get a byte range from the shadow memory.
+ *
+ * The range must be within the shadow memory (see shadowCovers()).
+ *
+ * \param pAddr Module-local address of the first byte.
+ * \param pSize Number of bytes.
+ * \return Shadow memory bytes.
+ */
+casil::Bytes::SmallByteVec RegisterDriver::getShadowBytes(const std::uint32_t pAddr, const std::uint32_t pSize) const
+{
+    return Bytes::SmallByteVec(std::span<const std::uint8_t>(shadowBytes).subspan(pAddr, pSize));
+}
+
+/*!
+ * \brief Update a byte range of the shadow memory.
+ *
+ * Copies \p pData to the shadow memory at \p pAddr and marks the bytes as known.
+ * Bytes outside of the shadow memory (i.e. not occupied by any register) are ignored.
+ *
+ * Does nothing if the shadow memory is not enabled.
+ *
+ * \param pAddr Module-local address of the first byte.
+ * \param pData Bytes written to or read from the module.
+ */
+void RegisterDriver::updateShadow(const std::uint32_t pAddr, const std::span<const std::uint8_t> pData) const
+{
+    for (std::size_t i = 0; i < pData.size() && pAddr + i < shadowBytes.size(); ++i)
     {
-        const std::uint8_t tmpVal = readBytes[0];
-        return static_cast<std::uint8_t>(static_cast<std::uint8_t>(tmpVal << bitOffs) >> static_cast<std::size_t>(8 - pRegSize));
+        shadowBytes[pAddr + i] = pData[i];
+        shadowValid[pAddr + i] = true;
     }
-    else
-        throw std::runtime_error("Read size of register is zero. THIS SHOULD NEVER HAPPEN!");
 }
 
 /*!
- * \brief Write an integer value to a register address.
- *
- * If the register only covers \e full bytes (i.e. \p pRegSize and \p pRegOffs each a multiple of 8), writes the new value
- * \p pValue to the register at address \p pRegAddr, with bit offset \p pRegOffs and bit size \p pRegSize using write().
+ * \brief Read the covered bytes of multiple registers with merged bus reads.
  *
- * Otherwise, first \e reads the \c N covered bytes using read() (similar to getRegValue()),
- * modifies only the bits in <tt>[pRegOffs, pRegOffs+pRegSize)</tt>, which represent the stored
- * value, and then writes back the partially modified byte sequence to \p pRegAddr using write().
+ * Merges the byte ranges covered by the registers \p pRegs into as few contiguous address ranges as possible
+ * and reads all of these ranges with a single readBatch() (i.e. one read operation per range), which allows
+ * the interface to overlap the transfers (see TL::MuxedInterface::readBatch()). The shadow memory is updated with the read bytes.
  *
- * \throws std::runtime_error If the potential read() fails or the number of received bytes differs from \c N.
- * \throws std::runtime_error If write() fails.
+ * \throws std::runtime_error If a read fails or the number of received bytes is wrong.
  *
- * \param pRegAddr Module-local register address (in bytes).
- * \param pRegSize Register size in bits (i.e. bit length of stored value).
- * \param pRegOffs Register offset in bits (i.e. bit offset of stored value with respect to \p pRegAddr).
- * \param pValue Value to be written.
+ * \param pRegs Registers to read (entries of the register table).
+ * \return Read bytes of all merged address ranges (start address -> bytes).
  */
-void RegisterDriver::setRegValue(const std::uint32_t pRegAddr, const std::uint32_t pRegSize,
-                                 const std::uint32_t pRegOffs, const std::uint64_t pValue) const
+RegisterDriver::RangeBytesType RegisterDriver::readMergedRanges(const std::vector<RegisterTableType::const_iterator>& pRegs) const
 {
-    const std::uint32_t byteOffs = pRegOffs / 8;
-    const std::uint32_t bitOffs = pRegOffs % 8;
+    //Merge covered bytes into contiguous address ranges (start address -> end address)
 
-    std::uint32_t writeByteSize = (bitOffs + pRegSize) / 8;
-    if ((bitOffs + pRegSize) % 8 > 0)
-        ++writeByteSize;
+    std::map<std::uint32_t, std::uint32_t> ranges;
 
-    if (bitOffs == 0 && (pRegSize % 8) == 0)
+    for (const auto it : pRegs)
     {
-        if (writeByteSize > 8)
-        {
-            throw std::runtime_error("Write size of register without offset exceeds 8 bytes. THIS SHOULD NEVER HAPPEN!");
-        }
-        else if (writeByteSize == 8)
-        {
-            write(pRegAddr + byteOffs, Bytes::composeByteVec(true, static_cast<std::uint64_t>(pValue)));
-        }
-        else if (writeByteSize > 4)
-        {
-            const std::vector<std::uint8_t> writeBytes = Bytes::composeByteVec(true, static_cast<std::uint64_t>(pValue));
-            std::vector<std::uint8_t> writeBytesTruncated(writeByteSize, 0);
+        const auto [firstByte, endByte] = ::coveredBytes(it->second);
 
-            const std::size_t skipBytes = 8 - writeByteSize;
-            std::copy(writeBytes.begin()+skipBytes, writeBytes.end(), writeBytesTruncated.begin());
+        std::uint32_t rangeStart = firstByte;
+        std::uint32_t rangeEnd = endByte;
 
-            write(pRegAddr + byteOffs, writeBytesTruncated);
-        }
-        else if (writeByteSize == 4)
-        {
-            write(pRegAddr + byteOffs, Bytes::composeByteVec(true, static_cast<std::uint32_t>(pValue)));
-        }
-        else if (writeByteSize == 3)
-        {
-            const std::vector<std::uint8_t> writeBytes = Bytes::composeByteVec(true, static_cast<std::uint32_t>(pValue));
-            const std::vector<std::uint8_t> writeBytesTruncated {writeBytes[1], writeBytes[2], writeBytes[3]};
+        auto rangeIt = ranges.upper_bound(firstByte);
 
-            write(pRegAddr + byteOffs, writeBytesTruncated);
-        }
-        else if (writeByteSize == 2)
-        {
-            write(pRegAddr + byteOffs, Bytes::composeByteVec(true, static_cast<std::uint16_t>(pValue)));
-        }
-        else if (writeByteSize == 1)
-        {
-            write(pRegAddr + byteOffs, Bytes::composeByteVec(true, static_cast<std::uint8_t>(pValue)));
-        }
-        else
+        if (rangeIt != ranges.begin() && std::prev(rangeIt)->second >= firstByte)
+            --rangeIt;
+
+        while (rangeIt != ranges.end() && rangeIt->first <= rangeEnd)
         {
-            throw std::runtime_error("Write size of register is zero. THIS SHOULD NEVER HAPPEN!");
+            rangeStart = std::min(rangeStart, rangeIt->first);
+            rangeEnd = std::max(rangeEnd, rangeIt->second);
+            rangeIt = ranges.erase(rangeIt);
         }
+
+        ranges.emplace(rangeStart, rangeEnd);
     }
-    else
-    {
-        std::vector<std::uint8_t> readBytes = read(pRegAddr + byteOffs, writeByteSize);
 
-        if (readBytes.size() != writeByteSize)
-            throw std::runtime_error("Read wrong number of bytes.");
+    //Read all ranges
 
-        std::bitset<64> valueBitset(pValue);
+    std::vector<TL::MuxedInterface::ReadOp> readOps;
+    readOps.reserve(ranges.size());
 
-        for (std::size_t i = 0; i < writeByteSize; ++i)
-        {
-            std::bitset<8> currentByte(readBytes[i]);
+    for (const auto& [rangeStart, rangeEnd] : ranges)
+        readOps.push_back({rangeStart, static_cast<int>(rangeEnd - rangeStart)});
 
-            if (writeByteSize == 1)
-            {
-                for (std::size_t j = bitOffs; j < bitOffs + pRegSize; ++j)
-                    currentByte[7 - j] = valueBitset[pRegSize - 1 - (j - bitOffs)];
-            }
-            else if (i == 0)
-            {
-                for (std::size_t j = bitOffs; j < 8; ++j)
-                    currentByte[7 - j] = valueBitset[pRegSize - 1 - (j - bitOffs)];
-            }
-            else if (i == writeByteSize - 1)
-            {
-                const std::size_t maxJ = 8 - (8*writeByteSize - bitOffs - pRegSize);    //This is in [1, 8]
+    RangeBytesType rangeBytes;
 
-                for (std::size_t j = 0; j < maxJ; ++j)
-                    currentByte[7 - j] = valueBitset[maxJ - 1 - j];
-            }
-            else
-            {
-                for (std::size_t j = 0; j < 8; ++j)
-                    currentByte[7 - j] = valueBitset[pRegSize - 1 - (8*i - bitOffs) - j];
-            }
+    const std::lock_guard<std::recursive_mutex> accessLock(accessMutex);
+    (void)accessLock;
 
-            readBytes[i] = static_cast<std::uint8_t>(currentByte.to_ulong());
-        }
+    std::vector<std::vector<std::uint8_t>> readBytes = readBatch(readOps);
+
+    if (readBytes.size() != readOps.size())
+        throw std::runtime_error("Read wrong number of byte ranges.");
+
+    for (std::size_t i = 0; i < readOps.size(); ++i)
+    {
+        const std::uint32_t rangeStart = static_cast<std::uint32_t>(readOps[i].addr);
+
+        if (std::cmp_not_equal(readBytes[i].size(), readOps[i].size))
+            throw std::runtime_error("Read wrong number of bytes.");
+
+        updateShadow(rangeStart, readBytes[i]);
 
-        write(pRegAddr + byteOffs, readBytes);
+        rangeBytes.emplace(rangeStart, std::move(readBytes[i]));
     }
+
+    return rangeBytes;
 }
 
 //RegisterDriver::RegisterProxy
@@ -1497,3 +2715,277 @@ void RegisterProxy::trigger()
 {
     regDriver.trigger(regName);
 }
+
+//RegisterDriver::RegisterHandle
+
+using RegisterHandle = RegisterDriver::RegisterHandle;
+
+/*!
+ * \brief Constructor.
+ *
+ * Resolves the register \p pRegName of driver \p pRegDriver and precomputes its access parameters.
+ *
+ * \throws std::invalid_argument If no register with name \p pRegName is defined.
+ *
+ * \param pRegDriver The driver instance for the register to be controlled.
+ * \param pRegName Name of the register.
+ */
+RegisterHandle::RegisterHandle(RegisterDriver& pRegDriver, const std::string_view pRegName) :
+    regDriver(&pRegDriver),
+    regName(pRegName),
+    regDescr(nullptr),
+    cachedValue(nullptr),
+    byteAddr(0),
+    byteCount(0),
+    shift(0),
+    mask(0),
+    fullBytes(false)
+{
+    const auto it = regDriver->findRegister(pRegName);
+
+    if (it == regDriver->registers.end())
+    {
+        throw std::invalid_argument("The register \"" + regName + "\" is not available " +
+                                    "for register driver \"" + regDriver->name + "\".");
+    }
+
+    regDescr = &(it->second);
+    if (regDescr->mode != AccessMode::ReadOnly)
+        cachedValue = &(regDriver->registerWrittenCache[it - regDriver->registers.begin()]);
+
+    const auto [firstByte, endByte] = ::coveredBytes(*regDescr);
+
+    byteAddr = firstByte;
+    byteCount = endByte - firstByte;
+
+    if (regDescr->type == DataType::Value)
+    {
+        shift = 8*byteCount - regDescr->offs % 8 - regDescr->size;
+        mask = (regDescr->size == 64) ? ~std::uint64_t{0} : ((std::uint64_t{1} << regDescr->size) - 1);
+        fullBytes = (shift == 0 && regDescr->offs % 8 == 0);
+    }
+}
+
+//Public
+
+/*!
+ * \brief Read the value from the value register.
+ *
+ * Equivalent to RegisterDriver::getValue() but using the precomputed access parameters.
+ *
+ * \throws std::invalid_argument If the register is a \e byte \e array register.
+ * \throws std::runtime_error If the read fails.
+ *
+ * \return Read value (or zero for a write-only register, which gets triggered instead).
+ */
+std::uint64_t RegisterHandle::getValue()
+{
+    if (regDescr->type == DataType::ByteArray)
+    {
+        throw std::invalid_argument("Cannot read value from byte array register \"" + regName + "\" " +
+                                    "of register driver \"" + regDriver->name + "\".");
+    }
+
+    if (regDescr->mode == AccessMode::WriteOnly)
+    {
+        regDriver->trigger(regName);
+        return 0;
+    }
+
+    try
+    {
+        std::uint64_t retVal = 0;
+
+        if (byteCount <= 8)
+        {
+            for (const std::uint8_t byte : regDriver->getRegBytes(byteAddr, byteCount))
+                retVal = (retVal << 8) | byte;
+
+            retVal = (retVal >> shift) & mask;
+        }
+        else
+            retVal = regDriver->getRegValue(regDescr->addr, regDescr->size, regDescr->offs);
+
+        if (regDescr->mode == AccessMode::ReadWrite)
+        {
+            const std::shared_ptr<const RegisterDescr::VariantValueType> cachedVal = cachedValue->load();
+
+            if (cachedVal && retVal != std::get<std::uint64_t>(*cachedVal))
+                regDriver->logger.logWarning("Value read from register \"" + regName + "\" differs from cached value.");
+        }
+
+        return retVal;
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not read value from register \"" + regName + "\" " +
+                                 "of register driver \"" + regDriver->name + "\": " + exc.what());
+    }
+}
+
+/*!
+ * \brief Write a value to the value register.
+ *
+ * Equivalent to RegisterDriver::setValue() but using the precomputed access parameters.
+ *
+ * \throws std::invalid_argument If the register is a \e byte \e array register.
+ * \throws std::invalid_argument If the register is read-only.
+ * \throws std::runtime_error If the write (or the read for a read-modify-write) fails.
+ *
+ * \param pValue Value to be written.
+ */
+void RegisterHandle::setValue(const std::uint64_t pValue)
+{
+    if (regDescr->type == DataType::ByteArray)
+    {
+        throw std::invalid_argument("Cannot write value to byte array register \"" + regName + "\" " +
+                                    "of register driver \"" + regDriver->name + "\".");
+    }
+    if (regDescr->mode == AccessMode::ReadOnly)
+    {
+        throw std::invalid_argument("Cannot write to read-only register \"" + regName + "\" " +
+                                    "of register driver \"" + regDriver->name + "\".");
+    }
+
+    const std::lock_guard<std::recursive_mutex> accessLock(regDriver->accessMutex);
+    (void)accessLock;
+
+    try
+    {
+        if (byteCount > 8)
+            regDriver->setRegValue(regDescr->addr, regDescr->size, regDescr->offs, pValue);
+        else
+        {
+            std::uint64_t rawVal = 0;
+
+            if (fullBytes)
+                rawVal = pValue;
+            else
+            {
+                Bytes::SmallByteVec oldBytes;
+
+                if (regDriver->shadowCovers(byteAddr, byteCount))
+                    oldBytes = regDriver->getShadowBytes(byteAddr, byteCount);
+                else
+                {
+                    oldBytes = regDriver->readSmall(byteAddr, static_cast<int>(byteCount));
+
+                    if (oldBytes.size() != byteCount)
+                        throw std::runtime_error("Read wrong number of bytes.");
+                }
+
+                for (const std::uint8_t byte : oldBytes)
+                    rawVal = (rawVal << 8) | byte;
+
+                rawVal = (rawVal & ~(mask << shift)) | ((pValue & mask) << shift);
+            }
+
+            Bytes::SmallByteVec bytes(byteCount);
+
+            for (std::uint32_t i = 0; i < byteCount; ++i)
+                bytes[i] = static_cast<std::uint8_t>(rawVal >> (8*(byteCount - 1 - i)));
+
+            regDriver->setRegBytes(byteAddr, bytes);
+        }
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not write value to register \"" + regName + "\" " +
+                                 "of register driver \"" + regDriver->name + "\": " + exc.what());
+    }
+
+    cachedValue->store(std::make_shared<const RegisterDescr::VariantValueType>(pValue));
+}
+
+//
+
+/*!
+ * \brief Read the data from the byte array register.
+ *
+ * Equivalent to RegisterDriver::getBytes() but using the precomputed access parameters.
+ *
+ * \throws std::invalid_argument If the register is a \e value register.
+ * \throws std::runtime_error If the read fails.
+ *
+ * \return Read byte sequence (or empty sequence for a write-only register, which gets triggered instead).
+ */
+std::vector<std::uint8_t> RegisterHandle::getBytes()
+{
+    if (regDescr->type == DataType::Value)
+    {
+        throw std::invalid_argument("Cannot read byte sequence from value register \"" + regName + "\" " +
+                                    "of register driver \"" + regDriver->name + "\".");
+    }
+
+    if (regDescr->mode == AccessMode::WriteOnly)
+    {
+        regDriver->trigger(regName);
+        return {};
+    }
+
+    try
+    {
+        std::vector<std::uint8_t> retVal = regDriver->getRegBytes(byteAddr, byteCount).toVector();
+
+        if (regDescr->mode == AccessMode::ReadWrite)
+        {
+            const std::shared_ptr<const RegisterDescr::VariantValueType> cachedVal = cachedValue->load();
+
+            if (cachedVal && retVal != std::get<std::vector<std::uint8_t>>(*cachedVal))
+                regDriver->logger.logWarning("Byte sequence read from register \"" + regName + "\" differs from cached one.");
+        }
+
+        return retVal;
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not read byte sequence from register \"" + regName + "\" " +
+                                 "of register driver \"" + regDriver->name + "\": " + exc.what());
+    }
+}
+
+/*!
+ * \brief Write data to the byte array register.
+ *
+ * Equivalent to RegisterDriver::setBytes() but using the precomputed access parameters.
+ *
+ * \throws std::invalid_argument If the register is a \e value register.
+ * \throws std::invalid_argument If the register is read-only.
+ * \throws std::invalid_argument If size of \p pData does not match the register size.
+ * \throws std::runtime_error If the write fails.
+ *
+ * \param pData Byte sequence to be written.
+ */
+void RegisterHandle::setBytes(const std::vector<std::uint8_t>& pData)
+{
+    if (regDescr->type == DataType::Value)
+    {
+        throw std::invalid_argument("Cannot write byte sequence to value register \"" + regName + "\" " +
+                                    "of register driver \"" + regDriver->name + "\".");
+    }
+    if (regDescr->mode == AccessMode::ReadOnly)
+    {
+        throw std::invalid_argument("Cannot write to read-only register \"" + regName + "\" " +
+                                    "of register driver \"" + regDriver->name + "\".");
+    }
+    if (pData.size() != byteCount)
+    {
+        throw std::invalid_argument("Cannot write wrong number of bytes to register \"" + regName + "\" " +
+                                    "of register driver \"" + regDriver->name + "\".");
+    }
+
+    const std::lock_guard<std::recursive_mutex> accessLock(regDriver->accessMutex);
+    (void)accessLock;
+
+    try
+    {
+        regDriver->setRegBytes(byteAddr, pData);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not write byte sequence to register \"" + regName + "\" " +
+                                 "of register driver \"" + regDriver->name + "\": " + exc.what());
+    }
+
+    cachedValue->store(std::make_shared<const RegisterDescr::VariantValueType>(pData));
+}
@@ -62,15 +62,24 @@
 
 #include <casil/HL/muxeddriver.h>
 
+#include <casil/bytes.h>
 #include <casil/layerconfig.h>
 
 #include <boost/property_tree/ptree_fwd.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -131,6 +140,10 @@ struct RegisterDescr
  *
  * Consider to instead use the simpler MuxedDriver as base class if such register operations are not needed.
  *
+ * The register access functions may be called concurrently from multiple threads (e.g. a monitoring thread reading status
+ * registers while another thread configures the module): Bus accesses, read-modify-write sequences and the shadow memory
+ * are serialized by a per-driver mutex, while the written value cache is read without locking (its entries are replaced atomically).
+ *
  * Note: This class and MuxedDriver are both in contrast to DirectDriver, which should be
  * used for independent/stand-alone hardware that is connected to via a "direct" interface.
  */
@@ -143,9 +156,13 @@ protected:
     //Declaring these aliases to make definition of registers in implementations more compact
     using DataType = RegisterDescr::DataType;       ///< \copybrief casil::HL::RegisterDescr::DataType
     using AccessMode = RegisterDescr::AccessMode;   ///< \copybrief casil::HL::RegisterDescr::AccessMode
+    //
+    using RegisterTableType = std::vector<std::pair<std::string, RegisterDescr>>;  ///< Flat table of registers, sorted by name.
+    using RangeBytesType = std::map<std::uint32_t, std::vector<std::uint8_t>>;     ///< Bytes of contiguous address ranges by start address.
 
 public:
     class RegisterProxy;
+    class RegisterHandle;
 
 public:
     RegisterDriver(std::string pType, std::string pName, InterfaceBaseType& pInterface,
@@ -156,9 +173,11 @@ public:
     RegisterProxy& operator[](std::string_view pRegName);               ///< Access a register via the proxy class.
     const RegisterProxy& operator[](std::string_view pRegName) const;   ///< Access a register via the proxy class.
     //
+    RegisterHandle handle(std::string_view pRegName);                   ///< Get a precomputed access handle for a register.
+    //
     void reset() override final;                                        ///< Reset the firmware module.
     //
-    void applyDefaults();                                               ///< Write configured default values to all appropriate registers.
+    void applyDefaults(bool pVerify = false);                           ///< Write configured default values to all appropriate registers.
     //
     std::vector<std::uint8_t> getBytes(std::string_view pRegName);                          ///< Read the data from a byte array register.
     std::vector<std::uint8_t> getBytes(std::string_view pRegName) const;                    ///< Read the data from a byte array register.
@@ -168,19 +187,52 @@ public:
     std::uint64_t getValue(std::string_view pRegName) const;                                ///< Read the value from a value register.
     void setValue(std::string_view pRegName, std::uint64_t pValue);                         ///< Write a value to a value register.
     //
+    std::future<std::vector<std::uint8_t>> getBytesAsync(std::string_view pRegName);       ///< Asynchronously read the data from a byte array register.
+    std::future<void> setBytesAsync(std::string_view pRegName, std::vector<std::uint8_t> pData);
+                                                                                            ///< Asynchronously write data to a byte array register.
+    std::future<std::uint64_t> getValueAsync(std::string_view pRegName);                    ///< Asynchronously read the value from a value register.
+    std::future<void> setValueAsync(std::string_view pRegName, std::uint64_t pValue);       ///< Asynchronously write a value to a value register.
+    //
     std::variant<std::uint64_t, std::vector<std::uint8_t>> get(std::string_view pRegName);  ///< \brief Read an integer or byte sequence from
                                                                                             ///  a register, according to its data type.
     std::variant<std::uint64_t, std::vector<std::uint8_t>> get(std::string_view pRegName) const;
                                                                                             ///< \brief Read an integer or byte sequence from
                                                                                             ///  a register, according to its data type.
+    std::vector<std::variant<std::uint64_t, std::vector<std::uint8_t>>> getMultiple(const std::vector<std::string>& pRegNames) const;
+                                                                                            ///< Read multiple registers with merged bus accesses.
     void set(std::string_view pRegName, std::uint64_t pValue);                              ///< Write a value to a value register.
     void set(std::string_view pRegName, const std::vector<std::uint8_t>& pBytes);           ///< Write data to a byte array register.
+    void set(const std::vector<std::pair<std::string, std::variant<std::uint64_t, std::vector<std::uint8_t>>>>& pUpdates,
+             bool pVerify = false);                                                         ///< Write multiple registers with merged bus accesses.
+    //
+    std::vector<std::string> verifyRegisters(const std::vector<std::string>& pRegNames);   ///< \brief Verify the content of read-write
+                                                                                            ///  registers by reading them back.
     //
     void trigger(std::string_view pRegName);                        ///< "Trigger" a write-only register by writing configured default or zero.
     //
+    using Driver::waitUntilDone;
+    bool waitUntilDone(std::chrono::milliseconds pTimeout, const WaitPolicy& pPolicy) override;
+                                                                    ///< Wait for the module to finish, using the learned action duration.
+    //
+    std::variant<std::uint64_t, std::vector<std::uint8_t>> getShadow(std::string_view pRegName) const;
+                                                                    ///< Get the last known register content from the shadow memory.
+    void invalidateShadow();                                        ///< Mark the whole shadow memory content as unknown.
+    //
+    std::vector<std::uint8_t> snapshot() const;                     ///< Read the content of all read-write registers as a compact binary blob.
+    void restore(const std::vector<std::uint8_t>& pSnapshot);       ///< Write back the content of all read-write registers from a snapshot() blob.
+    //
     bool testRegisterName(std::string_view pRegName) const;         ///< Check if a register exists or throw an exception else.
     //
     static bool isValidRegisterName(std::string_view pRegName);     ///< Check if a string could be a valid register name.
+    //
+    static void prepareGroupInit(const std::vector<std::reference_wrapper<RegisterDriver>>& pDrivers, bool pForce = false);
+                                                                    ///< \brief Reset several modules and read their firmware versions
+                                                                    ///  with combined bus accesses per interface for their next init().
+    static void discardGroupInit(const std::vector<std::reference_wrapper<RegisterDriver>>& pDrivers);
+                                                                    ///< Discard unused results of prepareGroupInit().
+
+protected:
+    RegisterDescr::VariantValueType getWrittenValue(std::string_view pRegName) const;  ///< Get the last written content of a register.
 
 private:
     bool initImpl() override final;
@@ -189,6 +241,8 @@ private:
     void loadRuntimeConfImpl(boost::property_tree::ptree&& pConf) override final;
     boost::property_tree::ptree dumpRuntimeConfImpl() const override final;
     //
+    std::map<std::string, std::size_t> getMemoryUsageImpl() const override final;
+    //
     virtual bool initModule();          ///< Perform module-specific initialization steps.
     virtual bool closeModule();         ///< Perform module-specific closing steps.
     //
@@ -210,22 +264,69 @@ private:
                                                                             ///< Check if software version is compatible with firmware version.
     bool checkVersionRequirement();                                         ///< \copybrief checkVersionRequirement(std::uint8_t, std::uint8_t)
     //
-    std::vector<std::uint8_t> getRegBytes(std::uint32_t pRegAddr, std::uint32_t pRegSize) const;
-                                                                                            ///< Read a byte sequence from a register address.
-    void setRegBytes(std::uint32_t pRegAddr, const std::vector<std::uint8_t>& pData) const; ///< Write a byte sequence to a register address.
+    virtual std::optional<std::pair<std::string, std::uint64_t>> getResetRegisterWrite() const;
+                                                                            ///< \brief Get the single value register write performed
+                                                                            ///  by resetImpl() (for combined resets).
+    virtual std::optional<std::string> getVersionRegister() const;          ///< \brief Get the value register read by
+                                                                            ///  getModuleFirmwareVersion() (for combined reads).
+    //
+    void resetDriverState();                                                ///< Invalidate the driver-side register state after a reset.
+    //
+    void throwOnVerifyMismatch(const std::vector<std::string>& pMismatches, const std::string& pContext) const;
+                                                                                    ///< Throw an exception listing registers that failed verification.
+    //
+    RegisterTableType::const_iterator findRegister(std::string_view pRegName) const;       ///< Look up a register in the sorted register table.
+    //
+    Bytes::SmallByteVec getRegBytes(std::uint32_t pRegAddr, std::uint32_t pRegSize) const;  ///< Read a byte sequence from a register address.
+    void setRegBytes(std::uint32_t pRegAddr, std::span<const std::uint8_t> pData) const;   ///< Write a byte sequence to a register address.
     std::uint64_t getRegValue(std::uint32_t pRegAddr, std::uint32_t pRegSize, std::uint32_t pRegOffs) const;
                                                                                             ///< Read an integer value from a register address.
     void setRegValue(std::uint32_t pRegAddr, std::uint32_t pRegSize, std::uint32_t pRegOffs, std::uint64_t pValue) const;
                                                                                             ///< Write an integer value to a register address.
+    //
+    bool shadowCovers(std::uint32_t pAddr, std::uint32_t pSize) const;                      ///< \brief Check if the shadow memory knows
+                                                                                            ///  a byte range that only read-write
+                                                                                            ///  registers occupy.
+    Bytes::SmallByteVec getShadowBytes(std::uint32_t pAddr, std::uint32_t pSize) const;    ///< Get a byte range from the shadow memory.
+    void updateShadow(std::uint32_t pAddr, std::span<const std::uint8_t> pData) const;     ///< Update a byte range of the shadow memory.
+    //
+    RangeBytesType readMergedRanges(const std::vector<RegisterTableType::const_iterator>& pRegs) const;
+                                                                                            ///< \brief Read the covered bytes of multiple
+                                                                                            ///  registers with merged bus reads.
 
 protected:
     const bool clearRegValCacheOnReset;                                     ///< Whether to clear the register written value cache on reset().
     //
-    const std::map<std::string, RegisterDescr, std::less<>> registers;      ///< Map of all registers with their names as keys.
+    const RegisterTableType registers;                                      ///< Table of all registers with their names (sorted by name).
+
+private:
+    using WrittenCacheEntryType = std::atomic<std::shared_ptr<const RegisterDescr::VariantValueType>>;
+                                                                            ///< Atomically replaceable entry of \ref registerWrittenCache.
 
 private:
-    std::map<std::string, RegisterDescr::VariantValueType, std::less<>> registerWrittenCache;   ///< Cache of last written register values.
-    std::map<std::string, RegisterDescr::VariantValueType> initValues;      ///< Overridden default values from YAML configuration.
+    mutable std::recursive_mutex accessMutex;                               ///< \brief Mutex for bus accesses, read-modify-write sequences,
+                                                                            ///  shadow memory and trigger timing.
+    //
+    const std::unique_ptr<WrittenCacheEntryType[]> registerWrittenCache;   ///< \brief Cache of last written register values
+                                                                            ///  (indexed like \ref registers; null if unknown).
+    std::vector<RegisterDescr::VariantValueType> initValues;                ///< \brief Overridden default values from YAML configuration
+                                                                            ///  (indexed like \ref registers).
+    //
+    const bool useShadow;                           ///< Keep a shadow copy of the module's register address space.
+    const bool trustShadow;                         ///< Serve register reads from the shadow memory whenever possible.
+    std::vector<bool> shadowRMWSafe;                ///< Whether a shadow byte is only occupied by read-write registers.
+    mutable std::vector<std::uint8_t> shadowBytes;  ///< Shadow copy of the module's register address space.
+    mutable std::vector<bool> shadowValid;          ///< Whether a shadow byte's content is known.
+    //
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> snapshotRanges;    ///< \brief Contiguous address ranges {address, size} that only
+                                                                            ///  read-write registers occupy (see snapshot()).
+    //
+    std::optional<std::chrono::steady_clock::time_point> lastTriggerTime;   ///< Time of the last trigger() call not yet followed by waitUntilDone().
+    std::chrono::microseconds learnedDuration;                              ///< \brief Measured duration from trigger() until isDone()
+                                                                            ///  for the last completed waitUntilDone().
+    //
+    bool preparedReset;                                                     ///< Module was already reset by prepareGroupInit() for the next init().
+    std::optional<std::uint8_t> preparedFirmwareVersion;                    ///< Firmware version read by prepareGroupInit() for the next init().
 
 public:
     /*!
@@ -264,8 +365,43 @@ public:
         const std::string regName;      ///< Name of the register as used in the driver.
     };
 
+public:
+    /*!
+     * \brief Precomputed fast access to an individual RegisterDriver register.
+     *
+     * Resolves the register and its written value cache entry once and precomputes the covered bytes, bit shift and bit mask,
+     * such that subsequent accesses need neither register name lookups nor generic size case distinctions.
+     * Use this for frequently accessed registers in tight loops. Obtain an instance via RegisterDriver::handle().
+     *
+     * Note: The handle must not outlive the driver it was obtained from.
+     */
+    class RegisterHandle
+    {
+    public:
+        RegisterHandle(RegisterDriver& pRegDriver, std::string_view pRegName);  ///< Constructor.
+        //
+        std::uint64_t getValue();                                               ///< Read the value from the value register.
+        void setValue(std::uint64_t pValue);                                    ///< Write a value to the value register.
+        //
+        std::vector<std::uint8_t> getBytes();                                   ///< Read the data from the byte array register.
+        void setBytes(const std::vector<std::uint8_t>& pData);                  ///< Write data to the byte array register.
+
+    private:
+        RegisterDriver* regDriver;                          ///< %Driver to which the register belongs.
+        std::string regName;                                ///< Name of the register as used in the driver.
+        const RegisterDescr* regDescr;                      ///< Definition of the register.
+        WrittenCacheEntryType* cachedValue;                 ///< Written value cache entry of the register (null for read-only registers).
+        std::uint32_t byteAddr;                             ///< Module-local address of the first covered byte.
+        std::uint32_t byteCount;                            ///< Number of covered bytes.
+        std::uint32_t shift;                                ///< Right shift of the value within the covered bytes.
+        std::uint64_t mask;                                 ///< Bit mask for the (right-shifted) value.
+        bool fullBytes;                                     ///< Whether the value covers only full bytes (no read-modify-write).
+    };
+
 private:
-    std::map<std::string, RegisterProxy, std::less<>> registerProxies;          ///< Map of proxy class instances with register names as keys.
+    mutable std::mutex proxyMutex;                                              ///< Mutex for the on-demand creation of proxy class instances.
+    mutable std::vector<std::unique_ptr<RegisterProxy>> registerProxies;        ///< \brief Proxy class instances, created on first access
+                                                                                ///  (indexed like \ref registers).
 };
 
 } // namespace HL
@@ -45,3 +45,18 @@ Register::Register(std::string pType, std::string pName, HL::Driver& pDriver, La
     driver(pDriver)
 {
 }
+
+//Public
+
+/*!
+ * \brief Queue a task for serialized execution on the asynchronous executor of the used driver's interface.
+ *
+ * Forwards \p pTask to HL::Driver::postAsync() of the used driver, i.e. asynchronous operations of the register
+ * are ordered with those of the driver and all other components bound to the same interface.
+ *
+ * \param pTask Task to be executed.
+ */
+void Register::postAsync(std::function<void()> pTask) const
+{
+    driver.postAsync(std::move(pTask));
+}
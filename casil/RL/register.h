@@ -29,6 +29,7 @@
 #include <casil/layerconfig.h>
 #include <casil/HL/driver.h>
 
+#include <functional>
 #include <string>
 
 namespace casil
@@ -72,6 +73,9 @@ public:
     Register(std::string pType, std::string pName, HL::Driver& pDriver, LayerConfig pConfig, const LayerConfig& pRequiredConfig);
                                         ///< Constructor.
     ~Register() override = default;     ///< Default destructor.
+    //
+    void postAsync(std::function<void()> pTask) const override final;  ///< \brief Queue a task for serialized execution on
+                                                                        ///  the asynchronous executor of the used driver's interface.
 
 private:
     /*!
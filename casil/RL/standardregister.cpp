@@ -59,99 +59,19 @@
 
 #include <casil/RL/standardregister.h>
 
+#include <casil/auxil.h>
 #include <casil/bytes.h>
+#include <casil/timing.h>
 
 #include <algorithm>
+#include <bit>
 #include <optional>
-#include <ranges>
 #include <set>
 #include <stdexcept>
 
 namespace
 {
 
-using RegField = casil::Layers::RL::StandardRegister::RegField;
-using BoolRef = casil::Layers::RL::StandardRegister::BoolRef;
-
-/*
- * Creates and returns a 'pSize' long vector of proxy class instances for bit manipulation of a contiguous
- * range of 'pSize' bits that are stored in 'pBits' at a most significant bit offset of 'pOffs'.
- * The indexing is hence such that returnValue[(pSize-1):0] ^= pBits[pOffs:(pOffs-(pSize-1))].
- *
- * Boundaries are not checked here but used BoolRef::BoolRef() will throw std::invalid_argument if an index exceeds the referenced bitset.
- */
-std::vector<std::unique_ptr<BoolRef>> createBitRefs(boost::dynamic_bitset<>& pBits, const std::uint64_t pSize, const std::uint64_t pOffs)
-{
-    std::vector<std::unique_ptr<BoolRef>> retVal;
-    retVal.reserve(pSize);
-    for (std::size_t i = pOffs-(pSize-1); i <= pOffs; ++i)
-        retVal.push_back(std::make_unique<BoolRef>(pBits, i));
-    return retVal;
-}
-
-/*
- * Creates and returns a 'pSize' long vector of proxy class instances for bit manipulation of a contiguous range of
- * 'pSize' bits from (and in turn indirectly referenced by) 'pParent' at a most significant bit offset of 'pOffs'.
- * The indexing is hence such that returnValue[(pSize-1):0] ^= pParent[pOffs:(pOffs-(pSize-1))].
- *
- * Boundaries are not checked here but used BoolRef::BoolRef() will throw std::invalid_argument if an index exceeds the referenced field.
- */
-std::vector<std::unique_ptr<BoolRef>> createBitRefs(RegField& pParent, const std::uint64_t pSize, const std::uint64_t pOffs)
-{
-    std::vector<std::unique_ptr<BoolRef>> retVal;
-    retVal.reserve(pSize);
-    for (std::size_t i = pOffs-(pSize-1); i <= pOffs; ++i)
-        retVal.push_back(std::make_unique<BoolRef>(pParent, i));
-    return retVal;
-}
-
-/*
- * Creates and returns a 'pSize' long vector of proxy class instances for bit manipulation of a contiguous range of
- * 'pSize' bits from (and in turn indirectly referenced by) 'pParent' at a most significant bit offset of 'pOffs'.
- * The actual bit indices are permuted according to 'pBitOrder', which must be a 'pSize' long vector with unique indices between
- * 0 and 'pSize'-1. The indexing is hence such that returnValue[pBitOrder[0:(pSize-1)]] ^= pParent[pOffs:(pOffs-(pSize-1))],
- * which for regular bit ordering with pBitOrder = [(pSize-1), ..., 0] would simplify to
- * returnValue[(pSize-1):0] ^= pParent[pOffs:(pOffs-(pSize-1))] just as in
- * createBitRefs(RegField&, std::uint64_t, std::uint64_t) above.
- *
- * Boundaries and bit order conditions are not checked here but the used BoolRef::BoolRef()
- * will at least throw std::invalid_argument if an index exceeds the referenced field.
- */
-std::vector<std::unique_ptr<BoolRef>> createBitRefs(RegField& pParent, const std::uint64_t pSize, const std::uint64_t pOffs,
-                                                    const std::vector<std::uint64_t>& pBitOrder)
-{
-    std::vector<std::size_t> idxs;
-    idxs.reserve(pSize);
-    for (std::size_t i = pOffs-(pSize-1); i <= pOffs; ++i)
-        idxs.push_back(i);
-
-    std::vector<std::unique_ptr<BoolRef>> retVal;
-    retVal.reserve(pSize);
-    for (std::size_t i = 0; i < pSize; ++i)
-        retVal.push_back(std::make_unique<BoolRef>(pParent, idxs[pBitOrder[(pSize-1)-i]]));
-
-    return retVal;
-}
-
-/*
- * Creates and returns a vector of proxy class instances for bit manipulation of an arbitrarily
- * ordered set of bits (with indices 'pIdxs') from (and in turn indirectly referenced by) 'pParent'.
- * The indexing is such that returnValue[(pIdxs.size()-1):0] ^= pParent[pIdxs[0]:pIdxs[pIdxs.size()-1]].
- *
- * Boundaries are not checked here but used RegField::operator[](std::size_t)
- * will throw std::invalid_argument if an index exceeds the referenced field.
- */
-std::vector<std::unique_ptr<BoolRef>> createBitRefs(RegField& pParent, const std::vector<std::size_t>& pIdxs)
-{
-    std::vector<std::unique_ptr<BoolRef>> retVal;
-    retVal.reserve(pIdxs.size());
-    for (auto idx : (pIdxs | std::views::reverse))
-        retVal.push_back(std::make_unique<BoolRef>(pParent[idx]));                                      // cppcheck-suppress useStlAlgorithm
-    return retVal;
-}
-
-//
-
 /*
  * This is a helper function for RegField::RegField().
  *
@@ -234,6 +154,54 @@ boost::dynamic_bitset<> parseBitStr(const std::string& pBitStr, const std::uint6
     return boost::dynamic_bitset(bitSeqStr);
 }
 
+/*
+ * This is a helper function for RegField::operator=(std::uint64_t) and StandardRegister::setBitRange().
+ *
+ * Assigns the binary equivalent of 'pValue' (truncated to 'pSize' bits) to the contiguous range of 'pSize' bits
+ * in 'pBits' that starts at index 'pLsbIdx', by clearing the whole range and only setting the high bits.
+ */
+void assignBitRange(boost::dynamic_bitset<>& pBits, const std::uint64_t pLsbIdx, const std::uint64_t pSize, const std::uint64_t pValue)
+{
+    pBits.reset(pLsbIdx, pSize);
+
+    for (std::uint64_t value = (pSize < 64 ? (pValue & ((std::uint64_t{1} << pSize) - 1)) : pValue); value != 0; value &= value - 1)
+        pBits.set(pLsbIdx + static_cast<std::uint64_t>(std::countr_zero(value)));
+}
+
+/*
+ * This is a helper function for RegField::operator std::uint64_t() and StandardRegister::getBitRange().
+ *
+ * Interprets the contiguous range of 'pSize' bits in 'pBits' that starts at index 'pLsbIdx' as an unsigned integer
+ * (least significant bit first) and returns it, by only collecting the high bits of the (at most 64) least significant bits.
+ */
+std::uint64_t collectBitRange(const boost::dynamic_bitset<>& pBits, const std::uint64_t pLsbIdx, const std::uint64_t pSize)
+{
+    const std::uint64_t bitsetEnd = pLsbIdx + std::min(pSize, std::uint64_t{64});
+
+    std::uint64_t value = 0;
+
+    for (std::size_t i = (pLsbIdx == 0 ? pBits.find_first() : pBits.find_next(pLsbIdx - 1)); i < bitsetEnd; i = pBits.find_next(i))
+        value |= (std::uint64_t{1} << (i - pLsbIdx));
+
+    return value;
+}
+
+/*
+ * This is a helper function for RegField::operator=(std::uint64_t) and RegField::operator std::uint64_t().
+ *
+ * Reverses the bit order of 'pValue' by swapping successively larger bit groups (single bits, pairs, nibbles, bytes, ...),
+ * which allows to move a whole reversed field segment at once instead of bit by bit.
+ */
+std::uint64_t reverseBits64(std::uint64_t pValue)
+{
+    pValue = ((pValue >> 1) & 0x5555555555555555u) | ((pValue & 0x5555555555555555u) << 1);
+    pValue = ((pValue >> 2) & 0x3333333333333333u) | ((pValue & 0x3333333333333333u) << 2);
+    pValue = ((pValue >> 4) & 0x0F0F0F0F0F0F0F0Fu) | ((pValue & 0x0F0F0F0F0F0F0F0Fu) << 4);
+    pValue = ((pValue >> 8) & 0x00FF00FF00FF00FFu) | ((pValue & 0x00FF00FF00FF00FFu) << 8);
+    pValue = ((pValue >> 16) & 0x0000FFFF0000FFFFu) | ((pValue & 0x0000FFFF0000FFFFu) << 16);
+    return (pValue >> 32) | (pValue << 32);
+}
+
 } // namespace
 
 using casil::Layers::RL::StandardRegister;
@@ -253,6 +221,11 @@ CASIL_REGISTER_REGISTER_ALIAS("StdRegister")
  * Also gets the optional "auto_start" value from \p pConfig (boolean value, default: false), which
  * defines whether write() shall automatically call Driver::exec() (see write() for more information).
  *
+ * Also gets the optional "data_offset" value from \p pConfig (unsigned integer value, default: 0), which defines the address
+ * offset of the register data within the driver's data that is passed to Driver::setData() and Driver::getData(). This allows
+ * to map multiple registers to different parts of the same driver's data (see also writeGroup()). A non-zero offset requires
+ * a driver that supports address offsets (see Driver::supportsAddressOffset()).
+ *
  * Also gets the optional "lsb_side_padding" value from \p pConfig (boolean value, default: true), which defines
  * whether bits in byte sequences (as used in write(), read(), toBytes() and fromBytes()) shall be "left-aligned",
  * meaning that the respective \e most significant byte (first byte of vector, index 0) always immediately starts
@@ -306,9 +279,10 @@ CASIL_REGISTER_REGISTER_ALIAS("StdRegister")
  * the sequence/string length must be equal to the field length. Also note that there must not be multiple/conflicting
  * assignments for overlapping/nested fields as no guarantee is made about the order in which the fields will be set.
  *
- * \internal \sa populateFieldTree() \endinternal
+ * \internal \sa getFieldLayout(), compileFieldLayout(), populateFieldTree() \endinternal
  *
  * \throws std::runtime_error If "size" is not defined or set to zero.
+ * \throws std::runtime_error If "data_offset" is non-zero but the driver does not support address offsets.
  * \throws std::runtime_error If the "fields" sequence from \p pConfig has an overall invalid structure (see above).
  * \throws std::runtime_error If a field node or a "fields" node contains data instead of just further child nodes.
  * \throws std::runtime_error If a field node definition contains an unknown key.
@@ -337,21 +311,32 @@ CASIL_REGISTER_REGISTER_ALIAS("StdRegister")
 StandardRegister::StandardRegister(std::string pName, HL::Driver& pDriver, LayerConfig pConfig) :
     Register(typeName, std::move(pName), pDriver, std::move(pConfig), LayerConfig::fromYAML("{size: uint}")),
     size(config.getUInt("size", 0)),
+    dataOffset(static_cast<std::uint32_t>(config.getUInt("data_offset", 0))),
     autoStart(config.getBool("auto_start", false)),
     lsbSidePadding(config.getBool("lsb_side_padding", true)),
     data(size, 0),
     readData(size, 0),
+    frontData(size, 0),
+    frontDataPending(false),
+    frontDataMutex(),
+    frontDataCondition(),
+    fieldLayout(),
     fields(),
     readFields(),
-    initValues()
+    initValues(),
+    writtenBytes()
 {
     if (size == 0)
         throw std::runtime_error("Invalid register size set for " + getSelfDescription() + ".");
+    if (dataOffset != 0 && !driver.supportsAddressOffset())
+        throw std::runtime_error("Data offset set for " + getSelfDescription() + ", but its driver does not support address offsets.");
+
+    //Parse and validate field configuration (or reuse the layout of a register with identical field configuration)
+    fieldLayout = getFieldLayout(config.getRawTreeAt("fields"));
 
     //Fill property tree with register field hierarchy, starting with unnamed root field
     fields.data() = std::make_shared<RegField>(data, "", size, size-1);
-    const boost::property_tree::ptree fieldsConfig = config.getRawTreeAt("fields");
-    populateFieldTree(fields, fieldsConfig, "fields");
+    populateFieldTree(fields, *fieldLayout, 0, fieldLayout->size());
 
     //Can make root field make aware of its immediate childs
     std::map<std::string, const std::reference_wrapper<RegField>, std::less<>> childFieldRefs;
@@ -361,7 +346,7 @@ StandardRegister::StandardRegister(std::string pName, HL::Driver& pDriver, Layer
 
     //Also fill field tree for driver readback data
     readFields.data() = std::make_shared<RegField>(readData, "", size, size-1);
-    populateFieldTree(readFields, fieldsConfig, "fields");
+    populateFieldTree(readFields, *fieldLayout, 0, fieldLayout->size());
 
     //Can make readback root field make aware of its immediate childs
     std::map<std::string, const std::reference_wrapper<RegField>, std::less<>> readFieldRefs;
@@ -596,6 +581,8 @@ std::uint64_t StandardRegister::getSize() const
  */
 void StandardRegister::applyDefaults()
 {
+    const Timing::Scope timing = timeOperation(Timing::Operation::ApplyDefaults);
+
     for (auto& [fieldPath, value] : initValues)
     {
         if (std::holds_alternative<std::uint64_t>(value))
@@ -650,6 +637,69 @@ void StandardRegister::setAll(const bool pValue)
 
 //
 
+/*!
+ * \brief Assign equivalent integer value to a contiguous range of register bits.
+ *
+ * Assigns the binary equivalent of \p pValue to the \p pSize register bits from index \p pOffs down to index <tt>pOffs-(pSize-1)</tt>,
+ * in the same way as assigning to a (regular order) register field with size \p pSize and total offset \p pOffs via
+ * RegField::operator=(std::uint64_t), but without the need to look up such a field by its name.
+ *
+ * This is primarily meant for register field accessors with offsets fixed at compile time (see TmplDev::RegLayoutConf).
+ *
+ * \throws std::invalid_argument If \p pSize is zero or the bit range would exceed the register extent.
+ *
+ * \param pOffs Index of the range's most significant bit in the register.
+ * \param pSize Number of bits in the range.
+ * \param pValue Value to be assigned.
+ */
+void StandardRegister::setBitRange(const std::uint64_t pOffs, const std::uint64_t pSize, const std::uint64_t pValue)
+{
+    ::checkFieldOffset(pOffs, ::checkFieldSize(pSize), size);
+
+    ::assignBitRange(data, pOffs-(pSize-1), pSize, pValue);
+}
+
+/*!
+ * \brief Get the integer equivalent of a contiguous range of register bits.
+ *
+ * Interprets the \p pSize register bits from index \p pOffs down to index <tt>pOffs-(pSize-1)</tt> as an unsigned integer, in the
+ * same way as RegField::operator std::uint64_t() for a (regular order) register field with size \p pSize and total offset \p pOffs.
+ *
+ * This is primarily meant for register field accessors with offsets fixed at compile time (see TmplDev::RegLayoutConf).
+ *
+ * \throws std::invalid_argument If \p pSize is zero or the bit range would exceed the register extent.
+ *
+ * \param pOffs Index of the range's most significant bit in the register.
+ * \param pSize Number of bits in the range.
+ * \return Unsigned integer value represented by the bit range.
+ */
+std::uint64_t StandardRegister::getBitRange(const std::uint64_t pOffs, const std::uint64_t pSize) const
+{
+    ::checkFieldOffset(pOffs, ::checkFieldSize(pSize), size);
+
+    return ::collectBitRange(data, pOffs-(pSize-1), pSize);
+}
+
+/*!
+ * \brief Get the integer equivalent of a contiguous range of driver readback bits.
+ *
+ * Like getBitRange() but for the driver readback data (see read() and getRead()).
+ *
+ * \throws std::invalid_argument If \p pSize is zero or the bit range would exceed the register extent.
+ *
+ * \param pOffs Index of the range's most significant bit in the register.
+ * \param pSize Number of bits in the range.
+ * \return Unsigned integer value represented by the readback bit range.
+ */
+std::uint64_t StandardRegister::getReadBitRange(const std::uint64_t pOffs, const std::uint64_t pSize) const
+{
+    ::checkFieldOffset(pOffs, ::checkFieldSize(pSize), size);
+
+    return ::collectBitRange(readData, pOffs-(pSize-1), pSize);
+}
+
+//
+
 /*!
  * \brief Get the register data as raw bit sequence.
  *
@@ -680,58 +730,232 @@ const boost::dynamic_bitset<>& StandardRegister::getRead() const
  * \brief Write the register data to the driver.
  *
  * Calls Driver::setData() on the register's driver instance with the register data passed as argument (in form
- * of a byte sequence as in toBytes(), possibly truncated to a smaller length \p pNumBytes). If the "auto_start"
+ * of a byte sequence as in toBytes(), possibly truncated to a smaller length \p pNumBytes) and the configured
+ * "data_offset" as address offset (see StandardRegister()). If the "auto_start"
  * setting was enabled in the component configuration (see StandardRegister()), calls Driver::exec() afterwards.
  *
+ * The written bytes are remembered as reference for subsequent calls of writeDirty().
+ *
  * \throws std::invalid_argument If \p pNumBytes exceeds the register byte size (full byte count occupied by all register bits).
  *
  * \param pNumBytes Number of bytes of the byte sequence to actually use, or zero to use the full length.
  */
-void StandardRegister::write(std::size_t pNumBytes) const
+void StandardRegister::write(const std::size_t pNumBytes) const
 {
-    if (size % 8 > 0)
+    const std::size_t numBytes = getWriteByteCount(pNumBytes);
+
+    const Timing::Scope timing = timeOperation(Timing::Operation::Write);
+
+    writeBytes(toBytes(), numBytes);
+}
+
+/*!
+ * \brief Write only the register bytes changed since the last write to the driver.
+ *
+ * Compares the current register data (as byte sequence as in toBytes()) with the data sent to the driver by the
+ * last write() or writeDirty() call and only sends the changed byte spans, by calling Driver::setData() once for
+ * each span with the span's byte offset within the byte sequence (plus the configured "data_offset") as address offset.
+ * Changed spans that are separated by only a few unchanged bytes are combined to limit the number of driver calls.
+ * If the "auto_start" setting was enabled in the component configuration (see StandardRegister()), calls Driver::exec()
+ * afterwards if anything was written.
+ *
+ * If the register was never completely written before, this is equivalent to write() (full length).
+ *
+ * Partial writes require a driver that interprets the address offset of Driver::setData() as byte offset into the
+ * register data (see Driver::supportsAddressOffset()). For other drivers, this is equivalent to write() (full length)
+ * if anything changed and does nothing otherwise.
+ *
+ * Note that changes that were made to the driver's data by other means than this register are not detected.
+ */
+void StandardRegister::writeDirty() const
+{
+    const std::vector<std::uint8_t> allBytes = toBytes();
+
+    if (writtenBytes.size() != allBytes.size())
     {
-        if (pNumBytes > (size / 8) + 1)
-            throw std::invalid_argument("Number of bytes exceeds register byte size for " + getSelfDescription() + ".");
-        else if (pNumBytes == 0)
-            pNumBytes = (size / 8) + 1;
+        write();
+        return;
     }
-    else
+
+    if (!driver.supportsAddressOffset())
     {
-        if (pNumBytes > size / 8)
-            throw std::invalid_argument("Number of bytes exceeds register byte size for " + getSelfDescription() + ".");
-        else if (pNumBytes == 0)
-            pNumBytes = size / 8;
+        if (allBytes != writtenBytes)
+            write();
+
+        return;
     }
 
-    if (lsbSidePadding && (size % 8) > 0)   //Need to add LSB-side padding bits (as is done in basil)
+    const std::size_t numBytes = allBytes.size();
+
+    bool anyWritten = false;
+
+    std::size_t spanBegin = 0;
+
+    while (spanBegin < numBytes)
     {
-        const std::uint64_t numPadBits = 8 - size % 8;
-        boost::dynamic_bitset<> paddedData = data;
-        paddedData.resize(size + numPadBits);
-        paddedData <<= numPadBits;
-        std::vector<std::uint8_t> tBytes = Bytes::bytesFromBitset(paddedData, (size / 8) + 1);
-        tBytes.resize(pNumBytes);
-        driver.setData(tBytes);
+        //Find next changed byte
+        if (allBytes[spanBegin] == writtenBytes[spanBegin])
+        {
+            ++spanBegin;
+            continue;
+        }
+
+        //Extend span until there are more than 'dirtySpanMergeGap' unchanged bytes
+        std::size_t spanEnd = spanBegin + 1;
+        std::size_t numUnchanged = 0;
+
+        for (std::size_t i = spanEnd; i < numBytes && numUnchanged <= dirtySpanMergeGap; ++i)
+        {
+            if (allBytes[i] != writtenBytes[i])
+            {
+                spanEnd = i + 1;
+                numUnchanged = 0;
+            }
+            else
+                ++numUnchanged;
+        }
+
+        driver.setData(std::vector<std::uint8_t>(allBytes.begin() + spanBegin, allBytes.begin() + spanEnd),
+                       dataOffset + static_cast<std::uint32_t>(spanBegin));
+
+        std::copy(allBytes.begin() + spanBegin, allBytes.begin() + spanEnd, writtenBytes.begin() + spanBegin);
+
+        anyWritten = true;
+
+        spanBegin = spanEnd;
     }
-    else
+
+    if (autoStart && anyWritten)
+        driver.exec();
+}
+
+/*!
+ * \brief Write the data of several registers with combined driver calls per driver.
+ *
+ * Writes the full register data (as in write()) of all \p pRegisters, but combines the writes of registers that share the
+ * same driver: Their byte sequences (see toBytes()) are placed at their configured "data_offset" (see StandardRegister())
+ * and each contiguous run of adjacent register data is passed to a single Driver::setData() call. Afterwards, Driver::exec()
+ * is called only once per driver if the "auto_start" setting is enabled for any of the registers of that driver.
+ * This saves the per-register handshake overhead when e.g. configuring multiple registers of the same chip.
+ * Registers of drivers that do not support partial writes at a byte offset (see Driver::supportsAddressOffset())
+ * are not combined but written with one Driver::setData() call each (as in write()).
+ *
+ * The written bytes are remembered as reference for subsequent calls of writeDirty() (as in write()).
+ *
+ * \throws std::invalid_argument If the data of two registers of the same driver overlap (nothing is written then).
+ *
+ * \param pRegisters Registers to be written.
+ */
+void StandardRegister::writeGroup(const std::vector<std::reference_wrapper<const StandardRegister>>& pRegisters)
+{
+    //Group registers (and their byte sequences) by driver, keeping the order of first appearance of the drivers
+
+    struct Image
+    {
+        const StandardRegister* reg;
+        std::vector<std::uint8_t> bytes;
+    };
+
+    std::vector<std::pair<HL::Driver*, std::vector<Image>>> driverImages;
+
+    for (const StandardRegister& reg : pRegisters)
     {
-        std::vector<std::uint8_t> tBytes = Bytes::bytesFromBitset(data, ((size - 1) / 8) + 1);
-        tBytes.resize(pNumBytes);
-        driver.setData(tBytes);
+        auto it = std::find_if(driverImages.begin(), driverImages.end(),
+                               [&reg](const auto& pEntry) -> bool { return pEntry.first == &reg.driver; });
+
+        if (it == driverImages.end())
+            it = driverImages.emplace(driverImages.end(), &reg.driver, std::vector<Image>{});
+
+        it->second.push_back(Image{.reg = &reg, .bytes = reg.toBytes()});
     }
 
-    if (autoStart)
-        driver.exec();
+    //Check for overlapping register data before writing anything
+
+    for (auto& [drv, images] : driverImages)
+    {
+        std::stable_sort(images.begin(), images.end(),
+                         [](const Image& pLhs, const Image& pRhs) -> bool { return pLhs.reg->dataOffset < pRhs.reg->dataOffset; });
+
+        for (std::size_t i = 1; i < images.size(); ++i)
+        {
+            if (images[i].reg->dataOffset < images[i-1].reg->dataOffset + images[i-1].bytes.size())
+            {
+                throw std::invalid_argument("Data of " + images[i].reg->getSelfDescription() + " overlaps with data of " +
+                                            images[i-1].reg->getSelfDescription() + ".");
+            }
+        }
+    }
+
+    for (const auto& [drv, images] : driverImages)
+    {
+        bool exec = false;
+
+        std::vector<std::uint8_t> runBytes;
+        std::uint32_t runOffset = 0;
+
+        const bool combine = drv->supportsAddressOffset();
+
+        for (const Image& image : images)
+        {
+            //Flush current run if the next register data is not adjacent or runs cannot be combined
+            if (!runBytes.empty() && (!combine || image.reg->dataOffset != runOffset + runBytes.size()))
+            {
+                drv->setData(runBytes, runOffset);
+                runBytes.clear();
+            }
+
+            if (runBytes.empty())
+                runOffset = image.reg->dataOffset;
+
+            runBytes.insert(runBytes.end(), image.bytes.begin(), image.bytes.end());
+
+            image.reg->writtenBytes = image.bytes;
+
+            exec = exec || image.reg->autoStart;
+        }
+
+        if (!runBytes.empty())
+            drv->setData(runBytes, runOffset);
+
+        if (exec)
+            drv->exec();
+    }
+}
+
+/*!
+ * \brief Assign values to several register fields and write the changed bytes to the driver.
+ *
+ * Assigns each value of \p pFieldValues to the register field at the respective field path (see operator[]())
+ * and then writes the register data using writeDirty(), i.e. only the changed bytes are written if the driver
+ * supports address offsets (see Driver::supportsAddressOffset()) and the full register data otherwise.
+ *
+ * All field paths are resolved before any field is assigned, such that an invalid path leaves the register unchanged.
+ *
+ * \throws std::invalid_argument If a field path does not point to an existing register field.
+ *
+ * \param pFieldValues Pairs of field path and value to be assigned.
+ */
+void StandardRegister::update(const std::vector<std::pair<std::string, std::uint64_t>>& pFieldValues)
+{
+    std::vector<std::reference_wrapper<RegField>> regFields;
+    regFields.reserve(pFieldValues.size());
+
+    for (const auto& [fieldPath, value] : pFieldValues)
+        regFields.emplace_back(operator[](fieldPath));
+
+    for (std::size_t i = 0; i < pFieldValues.size(); ++i)
+        regFields[i].get() = pFieldValues[i].second;
+
+    writeDirty();
 }
 
 /*!
  * \brief Read from the driver and assign to the readback data.
  *
- * Calls Driver::getData() on the register's driver instance with \p pNumBytes as argument in order to get a byte sequence
- * of length \p pNumBytes (automatically set to <tt>((regBitSize - 1) / 8) + 1</tt> if zero). If \p pNumBytes is smaller
- * than <tt>((regBitSize - 1) / 8) + 1</tt>, zeros will be appended to that byte sequence to obtain a length of
- * <tt>((regBitSize - 1) / 8) + 1</tt>. The driver readback data will then be set to the bit sequence that is
+ * Calls Driver::getData() on the register's driver instance with \p pNumBytes (and the configured "data_offset") as arguments
+ * in order to get a byte sequence of length \p pNumBytes (automatically set to <tt>((regBitSize - 1) / 8) + 1</tt> if zero).
+ * If \p pNumBytes is smaller than <tt>((regBitSize - 1) / 8) + 1</tt>, zeros will be appended to that byte sequence to obtain
+ * a length of <tt>((regBitSize - 1) / 8) + 1</tt>. The driver readback data will then be set to the bit sequence that is
  * represented by the byte sequence (as is done in fromBytes() for the regular register data).
  *
  * \throws std::invalid_argument If \p pNumBytes exceeds the register byte size (full byte count occupied by all register bits).
@@ -756,113 +980,325 @@ void StandardRegister::read(std::size_t pNumBytes)
             pNumBytes = size / 8;
     }
 
-    std::vector<std::uint8_t> rawData = driver.getData(pNumBytes);
+    std::vector<std::uint8_t> rawData = driver.getData(static_cast<int>(pNumBytes), dataOffset);
 
     if (rawData.size() != pNumBytes)
         throw std::runtime_error("Driver returned wrong number of bytes for " + getSelfDescription() + ".");
 
     rawData.resize(((size - 1) / 8) + 1);
 
-    boost::dynamic_bitset<> tBits = Bytes::bitsetFromBytes(rawData, rawData.size() * 8);
-
-    if (lsbSidePadding)     //Expect raw data bytes to be left-aligned (i.e. with LSB-side zero padding, according to component configuration)
-        tBits >>= tBits.size() - size;
-
-    tBits.resize(size);
-
-    readData = tBits;
+    //Expect raw data bytes to be left-aligned (i.e. with LSB-side zero padding) or right-aligned, according to component configuration
+    Bytes::bitsetFromBytesInto(rawData, readData, lsbSidePadding ? (rawData.size() * 8 - size) : 0);
 }
 
-//
+/*!
+ * \brief Asynchronously write the register data to the driver.
+ *
+ * Performs write() on the asynchronous executor of the driver's interface (see LayerBase::runAsync()),
+ * i.e. ordered with all other asynchronous operations of components bound to the same interface.
+ *
+ * Note: Do not access this register synchronously while asynchronous accesses might still be pending.
+ *
+ * \param pNumBytes Number of bytes of the byte sequence to actually use, or zero to use the full length.
+ * \return Future for completion of the write (\c std::future::get() rethrows the exceptions of write()).
+ */
+std::future<void> StandardRegister::writeAsync(const std::size_t pNumBytes) const
+{
+    return runAsync([this, pNumBytes]() -> void { write(pNumBytes); });
+}
 
 /*!
- * \brief Convert the register data to a byte sequence.
+ * \brief Asynchronously read from the driver and assign to the readback data.
  *
- * Converts the sequence of register bits into a byte sequence in big endian byte order (i.e. least significant register
- * \c bit[0] ends up in <tt>byteSeq[byteSize-1]</tt>, which is the least significant byte). The bit alignment is made such that
- * zero-padding bits are either inserted at the front of the most significant byte or at the back of the least significant byte,
- * depending on the "lsb_side_padding" setting from the component configuration (see StandardRegister()).
+ * Performs read() on the asynchronous executor of the driver's interface (see LayerBase::runAsync()),
+ * i.e. ordered with all other asynchronous operations of components bound to the same interface.
  *
- * See also Bytes::bytesFromBitset().
+ * Note: Do not access this register synchronously while asynchronous accesses might still be pending.
  *
- * \return Register bits as (aligned) byte sequence.
+ * \param pNumBytes Number of bytes to actually get from the driver, or zero to get bytes for the full register size.
+ * \return Future for completion of the read (\c std::future::get() rethrows the exceptions of read()).
  */
-std::vector<std::uint8_t> StandardRegister::toBytes() const
+std::future<void> StandardRegister::readAsync(const std::size_t pNumBytes)
 {
-    if (size % 8 > 0)
-    {
-        if (lsbSidePadding)     //Need to add LSB-side padding bits (as is done in basil)
-        {
-            const std::uint64_t numPadBits = 8 - size % 8;
-            boost::dynamic_bitset<> paddedData = data;
-            paddedData.resize(size + numPadBits);
-            paddedData <<= numPadBits;
-            return Bytes::bytesFromBitset(paddedData, (size / 8) + 1);
-        }
-        else
-            return Bytes::bytesFromBitset(data, (size / 8) + 1);
-    }
-    else
-        return Bytes::bytesFromBitset(data, size / 8);
+    return runAsync([this, pNumBytes]() -> void { read(pNumBytes); });
 }
 
 /*!
- * \brief Load/assign the register data from a byte sequence.
+ * \brief Copy the register data to the front buffer and asynchronously write it to the driver.
  *
- * Sets the register content to the bit sequence equivalent of \p pBytes in terms of the inverse operation to toBytes().
- * This means that \p pBytes must be a byte sequence representation of the wanted register bit sequence in in big endian
- * byte order (i.e. least significant register \c bit[0] is in <tt>byteSeq[byteSize-1]</tt>, which is the least significant byte).
- * The bit alignment must be such that zero-padding bits are either at the front of the most significant byte or at the back of the
- * least significant byte, depending on the "lsb_side_padding" setting from the component configuration (see StandardRegister()).
+ * Double-buffered version of writeAsync(): Copies the current register data (the back buffer, see get()) to an internal
+ * front buffer and performs the equivalent of write() with this front buffer on the asynchronous executor of the driver's
+ * interface (see LayerBase::runAsync()). In contrast to writeAsync(), the register data may hence be changed again (e.g. to
+ * prepare the next mask step) as soon as this function returns, while the committed data is still being transferred.
+ * The back buffer keeps its content, i.e. the next data can be prepared incrementally.
  *
- * See also Bytes::bitsetFromBytes().
+ * If the previously committed data has not been taken by its asynchronous write yet, waits for this first (the front buffer
+ * is released as soon as its byte sequence was composed, i.e. before the actual transfer). The front buffer is reused for
+ * all commits, so committing does not allocate memory.
  *
- * \throws std::invalid_argument If length of \p pBytes differs from the register byte size (full byte count occupied by all register bits).
+ * Note: Apart from changing the register data, do not access this register synchronously while asynchronous accesses might
+ * still be pending (in particular write() / writeDirty(), which share the tracking of the written bytes).
  *
- * \param pBytes Desired register bits as (aligned) byte sequence.
+ * \throws std::invalid_argument If \p pNumBytes exceeds the register byte size (full byte count occupied by all register bits).
+ *
+ * \param pNumBytes Number of bytes of the byte sequence to actually use, or zero to use the full length.
+ * \return Future for completion of the write (\c std::future::get() rethrows the exceptions of the driver calls).
  */
-void StandardRegister::fromBytes(const std::vector<std::uint8_t> pBytes)
+std::future<void> StandardRegister::commitAsync(const std::size_t pNumBytes)
 {
-    if (pBytes.size() != ((size - 1) / 8) + 1)
-        throw std::invalid_argument("Byte sequence length differs from register byte size for " + getSelfDescription() + ".");
+    const std::size_t numBytes = getWriteByteCount(pNumBytes);
 
-    boost::dynamic_bitset<> tBits = Bytes::bitsetFromBytes(pBytes, pBytes.size() * 8);
+    {
+        std::unique_lock<std::mutex> frontDataLock(frontDataMutex);
 
-    if (lsbSidePadding)     //Expect raw data bytes to be left-aligned (i.e. with LSB-side zero padding, according to component configuration)
-        tBits >>= tBits.size() - size;
+        frontDataCondition.wait(frontDataLock, [this]() -> bool { return !frontDataPending; });
 
-    tBits.resize(size);
+        frontData = data;   //Reuses the allocated blocks of the front buffer
+        frontDataPending = true;
+    }
 
-    data = tBits;
-}
+    return runAsync([this, numBytes]() -> void
+                    {
+                        const Timing::Scope timing = timeOperation(Timing::Operation::Write);
 
-//Private
+                        std::vector<std::uint8_t> allBytes;
 
-/*!
- * \copybrief Register::initImpl()
- *
- * Sets the register fields to possibly configured default/init values, see applyDefaults().
- *
- * \return True.
- */
-bool StandardRegister::initImpl()
-{
-    applyDefaults();
+                        {
+                            const std::lock_guard<std::mutex> frontDataLock(frontDataMutex);
+                            (void)frontDataLock;
 
-    return true;
+                            allBytes = bitsToBytes(frontData);
+                            frontDataPending = false;
+                        }
+
+                        frontDataCondition.notify_all();
+
+                        writeBytes(allBytes, numBytes);
+                    });
 }
 
 /*!
- * \copybrief Register::closeImpl()
+ * \brief Compare the register data with the driver readback data.
  *
- * \return True.
+ * Compares the register data (see get()) with the driver readback data (see getRead(), read()) block-wise, i.e. many
+ * bits at a time (skipping runs of matching blocks with Bytes::findMismatch()), and returns all ranges of consecutive mismatching bits. Each range is given by the indices of its most and
+ * least significant bit (in this order, as in RegField::operator()(std::size_t, std::size_t)) and the ranges are sorted in
+ * ascending bit order, i.e. the range containing the least significant mismatching bit comes first.
+ *
+ * \return Ranges of mismatching bits as pairs of (most significant bit index, least significant bit index), or empty if all bits match.
  */
-bool StandardRegister::closeImpl()
+std::vector<std::pair<std::size_t, std::size_t>> StandardRegister::compareReadback() const
 {
-    return true;
-}
+    std::vector<std::pair<std::size_t, std::size_t>> mismatchRanges;
 
-//
+    if (data == readData)   //Fast path without any further copies
+        return mismatchRanges;
+
+    using Block = boost::dynamic_bitset<>::block_type;
+
+    constexpr std::size_t bitsPerBlock = boost::dynamic_bitset<>::bits_per_block;
+
+    std::vector<Block> blocks(data.num_blocks());
+    std::vector<Block> readBlocks(readData.num_blocks());
+    boost::to_block_range(data, blocks.begin());
+    boost::to_block_range(readData, readBlocks.begin());
+
+    //Index of the next block that differs, starting at 'pBlockIdx' (vectorized skipping of matching blocks)
+    auto findMismatchingBlock = [&blocks, &readBlocks](const std::size_t pBlockIdx) -> std::size_t
+    {
+        const std::span<const std::uint8_t> bytes(reinterpret_cast<const std::uint8_t*>(blocks.data() + pBlockIdx),
+                                                  (blocks.size() - pBlockIdx) * sizeof(Block));
+        const std::span<const std::uint8_t> readBytes(reinterpret_cast<const std::uint8_t*>(readBlocks.data() + pBlockIdx),
+                                                      (readBlocks.size() - pBlockIdx) * sizeof(Block));
+        return pBlockIdx + Bytes::findMismatch(bytes, readBytes) / sizeof(Block);
+    };
+
+    bool rangeOpen = false;
+    std::size_t rangeBegin = 0;
+
+    //Walk the runs of high bits of the XOR of each pair of differing blocks, where runs might continue into the next block
+    for (std::size_t blockIdx = findMismatchingBlock(0); blockIdx < blocks.size();
+         blockIdx = (rangeOpen ? (blockIdx + 1) : findMismatchingBlock(blockIdx + 1)))
+    {
+        const Block diff = blocks[blockIdx] ^ readBlocks[blockIdx];
+        const std::size_t blockBegin = blockIdx * bitsPerBlock;
+
+        std::size_t pos = 0;
+
+        while (pos < bitsPerBlock)
+        {
+            const Block remaining = diff >> pos;
+
+            if (rangeOpen)
+            {
+                pos += static_cast<std::size_t>(std::countr_one(remaining));
+
+                if (pos < bitsPerBlock)
+                {
+                    mismatchRanges.emplace_back(blockBegin + pos - 1, rangeBegin);
+                    rangeOpen = false;
+                }
+            }
+            else
+            {
+                if (remaining == 0)
+                    break;
+
+                pos += static_cast<std::size_t>(std::countr_zero(remaining));
+
+                rangeBegin = blockBegin + pos;
+                rangeOpen = true;
+            }
+        }
+    }
+
+    //Unused bits of the most significant block are zero for both bitsets, so only possible if mismatch reaches most significant bit
+    if (rangeOpen)
+        mismatchRanges.emplace_back(size - 1, rangeBegin);
+
+    return mismatchRanges;
+}
+
+//
+
+/*!
+ * \brief Convert the register data to a byte sequence.
+ *
+ * Converts the sequence of register bits into a byte sequence in big endian byte order (i.e. least significant register
+ * \c bit[0] ends up in <tt>byteSeq[byteSize-1]</tt>, which is the least significant byte). The bit alignment is made such that
+ * zero-padding bits are either inserted at the front of the most significant byte or at the back of the least significant byte,
+ * depending on the "lsb_side_padding" setting from the component configuration (see StandardRegister()).
+ *
+ * See also Bytes::bytesFromBitset().
+ *
+ * \return Register bits as (aligned) byte sequence.
+ */
+std::vector<std::uint8_t> StandardRegister::toBytes() const
+{
+    return bitsToBytes(data);
+}
+
+/*!
+ * \brief Load/assign the register data from a byte sequence.
+ *
+ * Sets the register content to the bit sequence equivalent of \p pBytes in terms of the inverse operation to toBytes().
+ * This means that \p pBytes must be a byte sequence representation of the wanted register bit sequence in in big endian
+ * byte order (i.e. least significant register \c bit[0] is in <tt>byteSeq[byteSize-1]</tt>, which is the least significant byte).
+ * The bit alignment must be such that zero-padding bits are either at the front of the most significant byte or at the back of the
+ * least significant byte, depending on the "lsb_side_padding" setting from the component configuration (see StandardRegister()).
+ *
+ * See also Bytes::bitsetFromBytes().
+ *
+ * \throws std::invalid_argument If length of \p pBytes differs from the register byte size (full byte count occupied by all register bits).
+ *
+ * \param pBytes Desired register bits as (aligned) byte sequence.
+ */
+void StandardRegister::fromBytes(const std::vector<std::uint8_t> pBytes)
+{
+    if (pBytes.size() != ((size - 1) / 8) + 1)
+        throw std::invalid_argument("Byte sequence length differs from register byte size for " + getSelfDescription() + ".");
+
+    //Expect raw data bytes to be left-aligned (i.e. with LSB-side zero padding) or right-aligned, according to component configuration
+    Bytes::bitsetFromBytesInto(pBytes, data, lsbSidePadding ? (pBytes.size() * 8 - size) : 0);
+}
+
+//Private
+
+/*!
+ * \copybrief Register::initImpl()
+ *
+ * Sets the register fields to possibly configured default/init values, see applyDefaults().
+ *
+ * \return True.
+ */
+bool StandardRegister::initImpl()
+{
+    applyDefaults();
+
+    return true;
+}
+
+/*!
+ * \copybrief Register::closeImpl()
+ *
+ * \return True.
+ */
+bool StandardRegister::closeImpl()
+{
+    return true;
+}
+
+//
+
+/*!
+ * \brief Get the number of bytes to be written by write().
+ *
+ * \throws std::invalid_argument If \p pNumBytes exceeds the register byte size (full byte count occupied by all register bits).
+ *
+ * \param pNumBytes Number of bytes of the byte sequence to actually use, or zero to use the full length.
+ * \return \p pNumBytes, or the register byte size if \p pNumBytes is zero.
+ */
+std::size_t StandardRegister::getWriteByteCount(const std::size_t pNumBytes) const
+{
+    const std::size_t byteSize = (size % 8 > 0) ? (size / 8) + 1 : size / 8;
+
+    if (pNumBytes > byteSize)
+        throw std::invalid_argument("Number of bytes exceeds register byte size for " + getSelfDescription() + ".");
+
+    return (pNumBytes == 0 ? byteSize : pNumBytes);
+}
+
+/*!
+ * \brief Convert register bits to a byte sequence.
+ *
+ * Converts \p pBits (register data or its front buffer copy, see commitAsync()) as described for toBytes().
+ *
+ * \param pBits Register bits.
+ * \return Register bits as (aligned) byte sequence.
+ */
+std::vector<std::uint8_t> StandardRegister::bitsToBytes(const boost::dynamic_bitset<>& pBits) const
+{
+    if (size % 8 > 0)
+    {
+        if (lsbSidePadding)     //Need to add LSB-side padding bits (as is done in basil)
+        {
+            const std::uint64_t numPadBits = 8 - size % 8;
+            boost::dynamic_bitset<> paddedData = pBits;
+            paddedData.resize(size + numPadBits);
+            paddedData <<= numPadBits;
+            return Bytes::bytesFromBitset(paddedData, (size / 8) + 1);
+        }
+        else
+            return Bytes::bytesFromBitset(pBits, (size / 8) + 1);
+    }
+    else
+        return Bytes::bytesFromBitset(pBits, size / 8);
+}
+
+/*!
+ * \brief Write (part of) a register byte sequence to the driver.
+ *
+ * Calls Driver::setData() with the first \p pNumBytes bytes of \p pAllBytes and the configured "data_offset",
+ * remembers the written bytes for writeDirty() and calls Driver::exec() if "auto_start" is enabled (see write()).
+ *
+ * \param pAllBytes Full register byte sequence (see toBytes()).
+ * \param pNumBytes Number of bytes to actually write (must not exceed the size of \p pAllBytes).
+ */
+void StandardRegister::writeBytes(const std::vector<std::uint8_t>& pAllBytes, const std::size_t pNumBytes) const
+{
+    driver.setData(std::vector<std::uint8_t>(pAllBytes.begin(), pAllBytes.begin() + pNumBytes), dataOffset);
+
+    //Keep track of the driver's register data
+    if (pNumBytes == pAllBytes.size())
+        writtenBytes = pAllBytes;
+    else if (writtenBytes.size() == pAllBytes.size())
+        std::copy(pAllBytes.begin(), pAllBytes.begin() + pNumBytes, writtenBytes.begin());
+
+    if (autoStart)
+        driver.exec();
+}
+
+//
 
 /*!
  * \copybrief Register::loadRuntimeConfImpl()
@@ -874,6 +1310,8 @@ bool StandardRegister::closeImpl()
  * with just one child node (to assign to a specific register field), which can in turn have another single
  * child node or a value (and so forth). The child node keys determine the path of the to be assigned register field.
  * Every value must be a string of zeros and ones with "0b" prefix as direct representation of the referred bit sequence.
+ * A value for the whole register may alternatively be a binary blob (see Auxil::encodeBinaryBlob()) of the register
+ * bytes as accepted by fromBytes(), as it is dumped by dumpRuntimeConfImpl() for large registers.
  *
  * To provide an example, \p pConf might look similar to this:
  * - \c pConf: no %data() at node
@@ -896,6 +1334,7 @@ bool StandardRegister::closeImpl()
  * \throws std::runtime_error If a node in \p pConf has \e both non-empty data and a child node.
  * \throws std::runtime_error If a node in \p pConf has multiple child nodes.
  * \throws std::runtime_error If a bit sequence string has invalid format (missing prefix, invalid characters).
+ * \throws std::runtime_error If a binary blob has invalid encoding or its length differs from the register byte size.
  * \throws std::runtime_error If the bit sequence length differs from the register or register field size.
  * \throws std::runtime_error If a register field does not exist.
  *
@@ -945,7 +1384,10 @@ void StandardRegister::loadRuntimeConfImpl(boost::property_tree::ptree&& pConf)
         {
             try
             {
-                root() = ::parseBitStr(subTree.data(), size);
+                if (Auxil::isBinaryBlob(subTree.data()))
+                    fromBytes(Auxil::decodeBinaryBlob(subTree.data()));
+                else
+                    root() = ::parseBitStr(subTree.data(), size);
             }
             catch (const std::invalid_argument& exc)
             {
@@ -978,6 +1420,9 @@ void StandardRegister::loadRuntimeConfImpl(boost::property_tree::ptree&& pConf)
  * Takes the current register content as bit sequence (see e.g. get()), converts this to a string, adds a "0b" prefix and
  * constructs a "configuration tree" with a single child (at key "#0") that has its data set to this very "bit sequence string".
  *
+ * For registers of at least \ref runtimeConfBlobMinSize bits the data is instead set to the register bytes (see toBytes())
+ * encoded as binary blob (see Auxil::encodeBinaryBlob()), which is much more compact for large registers such as pixel masks.
+ *
  * Note: According to Auxil::propertyTreeFromYAML() the returned tree is equivalent
  * to a YAML sequence with a single element, such as <tt>["0b101010101010"]</tt>.
  * See also the example in loadRuntimeConfImpl().
@@ -986,11 +1431,17 @@ void StandardRegister::loadRuntimeConfImpl(boost::property_tree::ptree&& pConf)
  */
 boost::property_tree::ptree StandardRegister::dumpRuntimeConfImpl() const
 {
-    std::string bitStr;
-    boost::to_string(root().toBits(), bitStr);
-
     boost::property_tree::ptree subTree;
-    subTree.data() = "0b" + bitStr;
+
+    if (size >= runtimeConfBlobMinSize)
+        subTree.data() = Auxil::encodeBinaryBlob(toBytes());
+    else
+    {
+        std::string bitStr;
+        boost::to_string(root().toBits(), bitStr);
+
+        subTree.data() = "0b" + bitStr;
+    }
 
     boost::property_tree::ptree confTree;
     confTree.push_back({"#0", subTree});
@@ -998,13 +1449,194 @@ boost::property_tree::ptree StandardRegister::dumpRuntimeConfImpl() const
     return confTree;
 }
 
+/*!
+ * \copybrief LayerBase::loadRuntimeSnapshotImpl()
+ *
+ * Sets the register content directly from the raw register bytes in \p pSnapshot as written by dumpRuntimeSnapshotImpl()
+ * (see fromBytes()), which avoids the bit string conversions of loadRuntimeConfImpl(). Does nothing if \p pSnapshot is empty.
+ *
+ * \throws std::runtime_error If length of \p pSnapshot differs from the register byte size.
+ *
+ * \param pSnapshot Desired runtime configuration as binary snapshot.
+ */
+void StandardRegister::loadRuntimeSnapshotImpl(const std::span<const std::uint8_t> pSnapshot)
+{
+    if (pSnapshot.empty())
+        return;
+
+    try
+    {
+        fromBytes(std::vector<std::uint8_t>(pSnapshot.begin(), pSnapshot.end()));
+    }
+    catch (const std::invalid_argument& exc)
+    {
+        throw std::runtime_error(exc.what());
+    }
+}
+
+/*!
+ * \copybrief LayerBase::dumpRuntimeSnapshotImpl()
+ *
+ * Returns the current register content as raw register bytes (see toBytes()).
+ *
+ * \return Current runtime configuration as binary snapshot.
+ */
+std::vector<std::uint8_t> StandardRegister::dumpRuntimeSnapshotImpl() const
+{
+    return toBytes();
+}
+
+//
+
+/*!
+ * \brief Estimate the component-specific heap memory usage.
+ *
+ * Reports the following categories (see also LayerBase::getMemoryUsage()):
+ * - "data": Register content, readback data and front buffer bitsets and the register bytes as of the last write.
+ * - "fields": Field trees (for register content and readback data) including the fields.
+ * - "bit_proxies": Lazily created proxy references to individual field bits (see RegField::operator[](std::size_t)).
+ * - "field_layout": Compiled field configuration (shared by registers with identical fields).
+ * - "init_values": Configured field default values.
+ *
+ * \return Estimated numbers of allocated bytes by category.
+ */
+std::map<std::string, std::size_t> StandardRegister::getMemoryUsageImpl() const
+{
+    auto bitsetBytes = [](const boost::dynamic_bitset<>& pBits) -> std::size_t
+    {
+        return pBits.num_blocks() * sizeof(boost::dynamic_bitset<>::block_type);
+    };
+
+    std::size_t dataBytes = bitsetBytes(data) + bitsetBytes(readData) + writtenBytes.capacity();
+
+    {
+        const std::lock_guard<std::mutex> frontDataLock(frontDataMutex);
+        (void)frontDataLock;
+
+        dataBytes += bitsetBytes(frontData);
+    }
+
+    std::size_t fieldBytes = 0;
+    std::size_t proxyBytes = 0;
+
+    std::function<void(const FieldTree&)> addFieldTree = [&addFieldTree, &fieldBytes, &proxyBytes](const FieldTree& pTree) -> void
+    {
+        //Every tree node allocates a child container including its header node
+        fieldBytes += 2 * Auxil::heapNodeOverhead + sizeof(FieldTree::value_type);
+
+        if (const RegField* const field = pTree.data().get(); field != nullptr)
+        {
+            fieldBytes += sizeof(RegField) + Auxil::heapNodeOverhead + Auxil::estimateHeapUsage(field->name) +
+                          field->bitSegments.capacity() * sizeof(RegField::BitSegment) +
+                          field->repetitionFields.capacity() * sizeof(std::reference_wrapper<RegField>);
+
+            for (const auto& [childName, childField] : field->childFields)
+                fieldBytes += sizeof(std::pair<const std::string, const std::reference_wrapper<RegField>>) + Auxil::heapNodeOverhead +
+                              Auxil::estimateHeapUsage(childName);
+
+            const std::lock_guard<std::mutex> bitRefsLock(field->bitRefsMutex);
+            (void)bitRefsLock;
+
+            proxyBytes += field->bitRefs.size() * (sizeof(std::pair<const std::size_t, std::unique_ptr<BoolRef>>) + sizeof(BoolRef) +
+                                                   2 * Auxil::heapNodeOverhead);
+        }
+
+        for (const auto& [key, child] : pTree)
+        {
+            fieldBytes += sizeof(FieldTree::value_type) + Auxil::heapNodeOverhead + Auxil::estimateHeapUsage(key);
+            addFieldTree(child);
+        }
+    };
+
+    addFieldTree(fields);
+    addFieldTree(readFields);
+
+    std::size_t layoutBytes = sizeof(FieldLayout) + Auxil::heapNodeOverhead + fieldLayout->capacity() * sizeof(FieldDescriptor);
+
+    for (const FieldDescriptor& descriptor : *fieldLayout)
+        layoutBytes += Auxil::estimateHeapUsage(descriptor.name) + descriptor.bitOrder.capacity() * sizeof(std::uint64_t);
+
+    std::size_t initValueBytes = 0;
+
+    for (const auto& [fieldName, value] : initValues)
+    {
+        initValueBytes += sizeof(std::pair<const std::string, VariantValueType>) + Auxil::heapNodeOverhead + Auxil::estimateHeapUsage(fieldName);
+
+        if (std::holds_alternative<boost::dynamic_bitset<>>(value))
+            initValueBytes += bitsetBytes(std::get<boost::dynamic_bitset<>>(value));
+    }
+
+    return {{"data", dataBytes}, {"fields", fieldBytes}, {"bit_proxies", proxyBytes}, {"field_layout", layoutBytes},
+            {"init_values", initValueBytes}};
+}
+
 //
 
 /*!
- * \brief Populate the register field tree by recursing through the field configuration.
+ * \brief Get the (shared) compiled layout for a field configuration.
+ *
+ * Parses and validates the register field configuration \p pFieldsConfig (the "fields" sequence of the
+ * component configuration, see StandardRegister()) via compileFieldLayout() and returns the resulting layout.
+ *
+ * Compiled layouts are shared between all StandardRegister instances with identical field configuration and register size
+ * (as long as any of them exists), such that the configuration of e.g. many identical, large registers is parsed only once.
+ *
+ * \throws std::runtime_error If compileFieldLayout() throws \c std::runtime_error.
+ *
+ * \param pFieldsConfig Configuration tree describing the register fields structure/hierarchy.
+ * \return Compiled field layout.
+ */
+std::shared_ptr<const StandardRegister::FieldLayout> StandardRegister::getFieldLayout(const boost::property_tree::ptree& pFieldsConfig) const
+{
+    static std::mutex cacheMutex;
+    static std::map<std::string, std::weak_ptr<const FieldLayout>> cache;
+
+    //Build unambiguous cache key from register size and full (nested) field configuration
+    std::string cacheKey = std::to_string(size);
+
+    std::function<void(const boost::property_tree::ptree&)> appendToKey = [&appendToKey, &cacheKey](const boost::property_tree::ptree& pTree)
+    {
+        cacheKey += std::to_string(pTree.data().size()) + ":" + pTree.data() + "{";
+        for (const auto& [key, subTree] : pTree)
+        {
+            cacheKey += std::to_string(key.size()) + ":" + key;
+            appendToKey(subTree);
+        }
+        cacheKey += "}";
+    };
+
+    appendToKey(pFieldsConfig);
+
+    {
+        const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+        (void)cacheLock;
+
+        if (const auto it = cache.find(cacheKey); it != cache.end())
+        {
+            if (std::shared_ptr<const FieldLayout> layout = it->second.lock())
+                return layout;
+        }
+    }
+
+    std::shared_ptr<FieldLayout> layout = std::make_shared<FieldLayout>();
+    compileFieldLayout(*layout, pFieldsConfig, "fields", size);
+
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    //Drop entries of layouts that are no longer used by any register
+    std::erase_if(cache, [](const auto& pEntry) { return pEntry.second.expired(); });
+
+    cache[cacheKey] = layout;
+
+    return layout;
+}
+
+/*!
+ * \brief Compile the field layout by recursing through the field configuration.
  *
- * This is a recursive helper function for StandardRegister() in order to populate the register field
- * tree \p pFieldTree according to the field configuration \p pConfTree. The field configuration describes,
+ * This is a recursive helper function for getFieldLayout() in order to parse and validate the field configuration
+ * \p pConfTree and append its fields to \p pLayout. The field configuration describes,
  * which named \e fields the register (and which nested fields one of the fields) is supposed to have.
  * It must adhere to the following structure:
  *
@@ -1036,11 +1668,10 @@ boost::property_tree::ptree StandardRegister::dumpRuntimeConfImpl() const
  * hence if a map \e is used (as in the example above) the key names have no effect because only the order matters (most significant
  * field bit index first). For more information on \p pConfTree, allowed values and their effects please refer to StandardRegister().
  *
- * This function inserts a proxy instance as child into \p pFieldTree for every field description from \p pConfTree, and for every
- * child that has a nested "fields" sequence, does that recursively for the child branch. Proxy instance here means that the fields in
- * \p pFieldTree do not actually store the data but merely refer to the bits from the respectively parent field. Hence, when initially
- * calling this function, \p pFieldTree already must have such a field proxy at the root node that does represent the whole register
- * and points to the actual register data/bits storage. \p pFieldTree is otherwise expected to be empty. See also StandardRegister().
+ * For every field description from \p pConfTree this function appends a FieldDescriptor to \p pLayout, directly followed
+ * by the descriptors of its nested fields (if it has a nested "fields" sequence), which are compiled recursively. Fields of a repeated
+ * field are described only once (relative to a single repetition). The validated layout can then be used to populate the field tree(s)
+ * of the register via populateFieldTree() without having to parse the configuration again.
  *
  * \p pParentKey must be the path in this instance's LayerConfig (see StandardRegister()) that points to \p pConfTree,
  * which is used to retrieve formatted data for each field.
@@ -1063,16 +1694,19 @@ boost::property_tree::ptree StandardRegister::dumpRuntimeConfImpl() const
  * \throws std::runtime_error If a field exceeds the parent field's extent.
  * \throws std::runtime_error Possibly/effectively if \p pParentKey is wrong (might cause one of the other exceptions).
  *
- * \param pFieldTree Tree to be filled with proxies for every register field as defined in \p pConfTree.
+ * \param pLayout Layout to append the field descriptors for all fields defined in \p pConfTree to.
  * \param pConfTree Configuration tree describing the register fields structure/hierarchy.
  * \param pParentKey Path at which \p pConfTree can be found in the layer component's LayerConfig instance.
+ * \param pParentSize Size of the parent field of the fields defined in \p pConfTree (size of a single repetition if repeated).
  */
-void StandardRegister::populateFieldTree(FieldTree& pFieldTree, const boost::property_tree::ptree& pConfTree,
-                                         const std::string& pParentKey) const
+void StandardRegister::compileFieldLayout(FieldLayout& pLayout, const boost::property_tree::ptree& pConfTree, const std::string& pParentKey,
+                                          const std::uint64_t pParentSize) const
 {
     if (pConfTree.data() != "")
         throw std::runtime_error("Invalid register fields configuration for " + getSelfDescription() + ".");
 
+    std::set<std::string> fieldNames;
+
     for (const auto& [key, field] : pConfTree)
     {
         if (field.data() != "")
@@ -1158,38 +1792,81 @@ void StandardRegister::populateFieldTree(FieldTree& pFieldTree, const boost::pro
 
         if (tName.find('.') != tName.npos || tName.starts_with('#'))
             throw std::runtime_error("Invalid name set for register field \"" + tName + "\" of " + getSelfDescription() + ".");
-        if (pFieldTree.find(tName) != pFieldTree.not_found())
+        if (!fieldNames.insert(tName).second)
             throw std::runtime_error("Field with name \"" + tName + "\" is defined multiple times for " + getSelfDescription() + ".");
 
-        RegField& parentField = *(pFieldTree.data());
-
         //Field must be fully contained within the parent field
-        if ((tSize*tReps > tOffs+1) || (tOffs >= parentField.getSize()))
+        if ((tSize*tReps > tOffs+1) || (tOffs >= pParentSize))
             throw std::runtime_error("Register field \"" + tName + "\" exceeds parent field's extent for " + getSelfDescription() + ".");
 
-        //Create new field tree branch for current field
-        FieldTree tSubTree;
+        //Add descriptor for current field and then recurse, if any sub-fields specified
+
+        const std::size_t tLayoutIdx = pLayout.size();
+
+        pLayout.push_back(FieldDescriptor{tName, tSize, tOffs, tReps, tOrder, 0});
+
+        if (field.find("fields") != field.not_found())
+            compileFieldLayout(pLayout, field.get_child("fields"), fullKey + ".fields", tSize);
+
+        pLayout[tLayoutIdx].numDescendants = pLayout.size() - tLayoutIdx - 1;
+    }
+}
+
+/*!
+ * \brief Populate the register field tree from part of a compiled field layout.
+ *
+ * This is a recursive helper function for StandardRegister() in order to populate the register field tree \p pFieldTree
+ * according to the field descriptors in the range <tt>[pBegin, pEnd)</tt> of \p pLayout (see compileFieldLayout()), which
+ * must be a sequence of sibling fields together with their descendants, e.g. the whole layout for the register's top level fields.
+ *
+ * This function inserts a proxy instance as child into \p pFieldTree for every field from the range, and for every field that has
+ * nested fields, does that recursively for the child branch (for repeated fields: for the branch of every repetition). Proxy instance
+ * here means that the fields in \p pFieldTree do not actually store the data but merely refer to the bits from the respectively parent
+ * field. Hence, when initially calling this function, \p pFieldTree already must have such a field proxy at the root node that does
+ * represent the whole register and points to the actual register data/bits storage. \p pFieldTree is otherwise expected to be empty.
+ *
+ * \param pFieldTree Tree to be filled with proxies for every register field as defined in the specified part of \p pLayout.
+ * \param pLayout Compiled (i.e. already validated) field layout.
+ * \param pBegin Index of the first field descriptor to use from \p pLayout.
+ * \param pEnd Index after the last field descriptor to use from \p pLayout.
+ */
+void StandardRegister::populateFieldTree(FieldTree& pFieldTree, const FieldLayout& pLayout, const std::size_t pBegin, const std::size_t pEnd)
+{
+    RegField& parentField = *(pFieldTree.data());
+
+    for (std::size_t idx = pBegin; idx < pEnd; idx += pLayout[idx].numDescendants + 1)
+    {
+        const FieldDescriptor& descr = pLayout[idx];
+
+        const std::size_t childsBegin = idx + 1;
+        const std::size_t childsEnd = childsBegin + descr.numDescendants;
 
-        if (tReps > 1)  //Need to (iteratively) add nested layer of fields to reflect and enable access to individual repetitions
+        //Create new field tree branch for current field directly in parent tree
+        FieldTree& tSubTree = pFieldTree.push_back(FieldTree::value_type(descr.name, FieldTree()))->second;
+
+        if (descr.reps > 1) //Need to (iteratively) add nested layer of fields to reflect and enable access to individual repetitions
         {
             //Add proxy instance for entire current field (i.e. spanning all repetitions)
-            tSubTree.data() = std::make_shared<RegField>(parentField, tName, tSize*tReps, tOffs);
+            tSubTree.data() = std::make_shared<RegField>(parentField, descr.name, descr.size*descr.reps, descr.offs);
 
             RegField& parentFieldForReps = *(tSubTree.data());
 
-            for (std::uint64_t i = 0; i < tReps; ++i)
+            std::vector<std::pair<std::string, const std::reference_wrapper<RegField>>> repFieldRefs;
+            repFieldRefs.reserve(descr.reps);
+
+            for (std::uint64_t i = 0; i < descr.reps; ++i)
             {
                 const std::string tSubName = "#" + std::to_string(i);
 
                 //Create new field tree branch for current field repetition
-                FieldTree tSubSubTree;
+                FieldTree& tSubSubTree = tSubTree.push_back(FieldTree::value_type(tSubName, FieldTree()))->second;
 
                 //Add proxy instance for current field repetition
-                tSubSubTree.data() = std::make_shared<RegField>(parentFieldForReps, tSubName, tSize, tSize*(tReps-i)-1, tOrder);
+                tSubSubTree.data() = std::make_shared<RegField>(parentFieldForReps, tSubName, descr.size, descr.size*(descr.reps-i)-1,
+                                                                descr.bitOrder);
 
-                //Recurse, if any sub-fields specified
-                if (field.find("fields") != field.not_found())
-                    populateFieldTree(tSubSubTree, field.get_child("fields"), fullKey + ".fields");
+                //Recurse for sub-fields (if any)
+                populateFieldTree(tSubSubTree, pLayout, childsBegin, childsEnd);
 
                 //Can make current field repetition make aware of its immediate childs after recursion
                 std::map<std::string, const std::reference_wrapper<RegField>, std::less<>> childFieldRefs;
@@ -1197,25 +1874,19 @@ void StandardRegister::populateFieldTree(FieldTree& pFieldTree, const boost::pro
                     childFieldRefs.emplace(subSubFieldName, *(subSubField.data()));
                 tSubSubTree.data()->setChildFields(std::move(childFieldRefs));
 
-                //Add new field tree branch for current field repetition to branch of the entire field
-                tSubTree.add_child(tSubName, tSubSubTree);
+                repFieldRefs.emplace_back(tSubName, *(tSubSubTree.data()));
             }
 
             //Can make current field make aware of its repetition-childs after iteration
-            std::vector<std::pair<std::string, const std::reference_wrapper<RegField>>> childFieldRefs;
-            childFieldRefs.reserve(tReps);
-            for (const auto& [subFieldName, subField] : tSubTree)
-                childFieldRefs.emplace_back(subFieldName, *(subField.data()));
-            tSubTree.data()->setChildFields(childFieldRefs);
+            tSubTree.data()->setChildFields(repFieldRefs);
         }
         else
         {
             //Add proxy instance for current field
-            tSubTree.data() = std::make_shared<RegField>(parentField, tName, tSize, tOffs, tOrder);
+            tSubTree.data() = std::make_shared<RegField>(parentField, descr.name, descr.size, descr.offs, descr.bitOrder);
 
-            //Recurse, if any sub-fields specified
-            if (field.find("fields") != field.not_found())
-                populateFieldTree(tSubTree, field.get_child("fields"), fullKey + ".fields");
+            //Recurse for sub-fields (if any)
+            populateFieldTree(tSubTree, pLayout, childsBegin, childsEnd);
 
             //Can make current field make aware of its immediate childs after recursion
             std::map<std::string, const std::reference_wrapper<RegField>, std::less<>> childFieldRefs;
@@ -1223,9 +1894,6 @@ void StandardRegister::populateFieldTree(FieldTree& pFieldTree, const boost::pro
                 childFieldRefs.emplace(subFieldName, *(subField.data()));
             tSubTree.data()->setChildFields(std::move(childFieldRefs));
         }
-
-        //Add new field tree branch for current field to parent/existing tree
-        pFieldTree.add_child(tName, tSubTree);
     }
 }
 
@@ -1248,7 +1916,7 @@ BoolRef::BoolRef(boost::dynamic_bitset<>& pBits, /*const */std::size_t pIdx) :
 #else
 BoolRef::BoolRef(boost::dynamic_bitset<>& pBits, const std::size_t pIdx) :
 #endif
-    dataField(pBits),
+    bits(pBits),
     idx(pIdx)
 {
     if  (pIdx >= pBits.size())
@@ -1259,6 +1927,7 @@ BoolRef::BoolRef(boost::dynamic_bitset<>& pBits, const std::size_t pIdx) :
  * \brief Constructor.
  *
  * Binds the instance's bit access/manipulation functions to the bit \p pIdx of register field \p pParent.
+ * The bit is directly referenced in the register's top level bitset, i.e. \p pParent does not need to outlive the instance.
  *
  * \throws std::invalid_argument If \p pIdx exceeds size of \p pParent.
  *
@@ -1270,11 +1939,14 @@ BoolRef::BoolRef(RegField& pParent, /*const */std::size_t pIdx) :
 #else
 BoolRef::BoolRef(RegField& pParent, const std::size_t pIdx) :
 #endif
-    dataField(pParent),
-    idx(pIdx)
+    bits(pParent.bits),
+    idx([&pParent, pIdx]() -> std::size_t
+        {
+            if  (pIdx >= pParent.getSize())
+                throw std::invalid_argument("Index exceeds size of referenced field.");
+            return pParent.bitsetIndex(pIdx);
+        }())
 {
-    if  (pIdx >= pParent.getSize())
-        throw std::invalid_argument("Index exceeds size of referenced field.");
 }
 
 //Public
@@ -1282,7 +1954,7 @@ BoolRef::BoolRef(RegField& pParent, const std::size_t pIdx) :
 /*!
  * \brief Assign a value to the referenced bit.
  *
- * Sets the referenced bit's value to \p pValue through the interface of the referenced parent.
+ * Sets the referenced bit's value to \p pValue.
  *
  * \param pValue Value to be set.
  * \return \p pValue.
@@ -1293,11 +1965,7 @@ bool BoolRef::operator=(/*const */bool pValue)
 bool BoolRef::operator=(const bool pValue)
 #endif
 {
-    if (std::holds_alternative<const BitsetRef>(dataField))
-        std::get<const BitsetRef>(dataField).get().operator[](idx) = pValue;
-    else
-        std::get<const FieldRef>(dataField).get().operator[](idx) = pValue;
-
+    bits.get()[idx] = pValue;
     return pValue;
 }
 
@@ -1306,16 +1974,13 @@ bool BoolRef::operator=(const bool pValue)
 /*!
  * \brief Get the value of the referenced bit.
  *
- * Returns the current value of the referenced bit as determined through the interface of the referenced parent.
+ * Returns the current value of the referenced bit.
  *
  * \return Current value.
  */
 BoolRef::operator bool() const
 {
-    if (std::holds_alternative<const BitsetRef>(dataField))
-        return std::as_const(std::get<const BitsetRef>(dataField).get()).operator[](idx);
-    else
-        return std::as_const(std::get<const FieldRef>(dataField).get()).operator[](idx);
+    return std::as_const(bits.get())[idx];
 }
 
 //
@@ -1368,18 +2033,27 @@ RegField::RegField(RegField& pParent, const std::vector<std::size_t>& pIdxs) :
     offs(::checkFieldOffset(*std::max_element(pIdxs.begin(), pIdxs.end()), pIdxs.size(), pParent.getSize())),
     parentSize(pParent.getSize()),
     parentTotalOffs(pParent.getTotalOffset()),
-    dataRefs(::createBitRefs(pParent, pIdxs)),
+    bits(pParent.bits),
+    bitSegments([&pParent, &pIdxs]() -> std::vector<BitSegment>
+                {
+                    std::set<std::size_t> idxSet;
+                    for (auto idx : pIdxs)
+                    {
+                        if (idxSet.contains(idx))
+                            throw std::invalid_argument("Indices must be unique.");
+                        else
+                            idxSet.insert(idx);
+                    }
+
+                    //First index is the most significant bit
+                    return mapBitSegments(pParent, std::vector<std::size_t>(pIdxs.rbegin(), pIdxs.rend()));
+                }()),
+    contiguous(isContiguous(bitSegments)),
+    bitRefsMutex(),
+    bitRefs(),
     childFields(),
-    repetitionKeys()
+    repetitionFields()
 {
-    std::set<std::size_t> idxSet;
-    for (auto idx : pIdxs)
-    {
-        if (idxSet.contains(idx))
-            throw std::invalid_argument("Indices must be unique.");
-        else
-            idxSet.insert(idx);
-    }
 }
 
 //
@@ -1408,9 +2082,13 @@ RegField::RegField(boost::dynamic_bitset<>& pBits, const std::string& pName, con
     offs(::checkFieldOffset(pOffs, pSize, pBits.size())),
     parentSize(pBits.size()),
     parentTotalOffs(pBits.size()-1),
-    dataRefs(::createBitRefs(pBits, pSize, pOffs)),
+    bits(pBits),
+    bitSegments{BitSegment{0, pOffs-(pSize-1), 1, pSize}},
+    contiguous(isContiguous(bitSegments)),
+    bitRefsMutex(),
+    bitRefs(),
     childFields(),
-    repetitionKeys()
+    repetitionFields()
 {
 }
 
@@ -1455,10 +2133,27 @@ RegField::RegField(RegField& pParent, const std::string& pName, const std::uint6
     offs(::checkFieldOffset(pOffs, pSize, pParent.getSize())),
     parentSize(pParent.getSize()),
     parentTotalOffs(pParent.getTotalOffset()),
-    dataRefs(pBitOrder.empty() ? ::createBitRefs(pParent, pSize, pOffs) :
-                                 ::createBitRefs(pParent, pSize, pOffs, ::checkBitOrder(pBitOrder, pSize))),
+    bits(pParent.bits),
+    bitSegments([&pParent, pSize, pOffs, &pBitOrder]() -> std::vector<BitSegment>
+                {
+                    if (pBitOrder.empty())
+                        return sliceBitSegments(pParent, pSize, pOffs);
+
+                    const std::vector<std::uint64_t> bitOrder = ::checkBitOrder(pBitOrder, pSize);
+
+                    //Field bit i references parent bit (pOffs-(pSize-1)) + pBitOrder[(pSize-1)-i]
+                    std::vector<std::size_t> parentIdxs;
+                    parentIdxs.reserve(pSize);
+                    for (std::size_t i = 0; i < pSize; ++i)
+                        parentIdxs.push_back(pOffs-(pSize-1) + bitOrder[(pSize-1)-i]);
+
+                    return mapBitSegments(pParent, parentIdxs);
+                }()),
+    contiguous(isContiguous(bitSegments)),
+    bitRefsMutex(),
+    bitRefs(),
     childFields(),
-    repetitionKeys()
+    repetitionFields()
 {
 }
 
@@ -1468,6 +2163,7 @@ RegField::RegField(RegField& pParent, const std::string& pName, const std::uint6
  * \brief Copy constructor.
  *
  * Constructs a copy of \p pOther (references the same bits and also child fields).
+ * Proxy references to individual bits are not copied but created again on demand.
  *
  * \param pOther Instance to be copied from.
  */
@@ -1477,15 +2173,13 @@ RegField::RegField(const RegField& pOther) :
     offs(pOther.offs),
     parentSize(pOther.parentSize),
     parentTotalOffs(pOther.parentTotalOffs),
-    dataRefs([&pOther]() -> std::vector<std::unique_ptr<BoolRef>>
-                {
-                    std::vector<std::unique_ptr<BoolRef>> vec;
-                    for (const std::unique_ptr<BoolRef>& ptr : pOther.dataRefs)
-                        vec.push_back(std::make_unique<BoolRef>(*ptr));
-                    return vec;
-                }()),
+    bits(pOther.bits),
+    bitSegments(pOther.bitSegments),
+    contiguous(pOther.contiguous),
+    bitRefsMutex(),
+    bitRefs(),
     childFields(pOther.childFields),
-    repetitionKeys(pOther.repetitionKeys)
+    repetitionFields(pOther.repetitionFields)
 {
 }
 
@@ -1509,7 +2203,7 @@ std::uint64_t RegField::operator=(/*const */std::uint64_t pValue)
 std::uint64_t RegField::operator=(const std::uint64_t pValue)
 #endif
 {
-    *this = Bytes::bitsetFromBytes(Bytes::composeByteVec(true, pValue), size);
+    assignUIntRange(0, size, pValue);
     return pValue;
 }
 
@@ -1528,8 +2222,7 @@ const boost::dynamic_bitset<>& RegField::operator=(const boost::dynamic_bitset<>
     if (pBits.size() != size)
         throw std::invalid_argument("Wrong number of bits for register field \"" + name + "\".");
 
-    for (std::size_t i = 0; i < size; ++i)
-        *(dataRefs[i]) = pBits[i];
+    assignBitsRange(0, pBits);
 
     return pBits;
 }
@@ -1575,8 +2268,7 @@ void RegField::set(const boost::dynamic_bitset<>& pBits)
  */
 void RegField::setAll(const bool pValue)
 {
-    for (std::size_t i = 0; i < size; ++i)
-        *(dataRefs[i]) = pValue;
+    setAllRange(0, size, pValue);
 }
 
 //
@@ -1593,7 +2285,7 @@ void RegField::setAll(const bool pValue)
  */
 RegField::operator std::uint64_t() const
 {
-    return Bytes::composeUInt64(Bytes::bytesFromBitset((operator boost::dynamic_bitset<>()), 8), true);
+    return collectUIntRange(0, size);
 }
 
 /*!
@@ -1605,12 +2297,7 @@ RegField::operator std::uint64_t() const
  */
 RegField::operator boost::dynamic_bitset<>() const
 {
-    boost::dynamic_bitset retVal(size);
-
-    for (std::size_t i = 0; i < size; ++i)
-        retVal[i] = std::as_const(*(dataRefs[i])).get();
-
-    return retVal;
+    return collectBitsRange(0, size);
 }
 
 //
@@ -1694,6 +2381,8 @@ BoolRef& RegField::operator[](const std::size_t pIdx)
 /*!
  * \brief Access a specific bit in the field.
  *
+ * The proxy reference is created on first access (and then kept for the lifetime of the field).
+ *
  * \throws std::invalid_argument If \p pIdx exceeds the field size.
  *
  * \param pIdx Field-local bit number, assuming least significant bit first.
@@ -1708,7 +2397,15 @@ const BoolRef& RegField::operator[](const std::size_t pIdx) const
     if (pIdx >= size)
         throw std::invalid_argument("Index " + std::to_string(pIdx) + " is out of range for register field \"" + name + "\".");
 
-    return *(dataRefs[pIdx]);
+    const std::lock_guard<std::mutex> bitRefsLock(bitRefsMutex);
+    (void)bitRefsLock;
+
+    std::unique_ptr<BoolRef>& bitRef = bitRefs[pIdx];
+
+    if (!bitRef)
+        bitRef = std::make_unique<BoolRef>(bits.get(), bitsetIndex(pIdx));
+
+    return *bitRef;
 }
 
 /*!
@@ -1719,6 +2416,8 @@ const BoolRef& RegField::operator[](const std::size_t pIdx) const
  *
  * If \p pLsbIdx is larger than \p pMsbIdx, the slice will be reversed (least significant bit first).
  *
+ * See view() for a non-allocating alternative for slices in regular bit order.
+ *
  * \note The returned field only \e references its parent field (i.e. the field this function is called on)
  *       and consequently all parents thereof and ultimately the containing StandardRegister.
  *       Hence take their scope into account when trying to access the data through it.
@@ -1808,6 +2507,35 @@ RegField RegField::operator[](const std::initializer_list<std::size_t> pIdxs)
     return operator[](std::vector<std::size_t>(pIdxs));
 }
 
+/*!
+ * \brief Access a slice of bits in the field without creating a new field.
+ *
+ * Returns a lightweight, non-allocating FieldView of the contiguous slice of bits between
+ * (and including) indices \p pMsbIdx and \p pLsbIdx. In contrast to operator()(std::size_t, std::size_t)
+ * this does not construct a new field and is therefore cheap enough to be used for slicing inside loops.
+ *
+ * \note The returned view \e references the field this function is called on (see FieldView).
+ *
+ * \throws std::invalid_argument If \p pMsbIdx exceeds the field size.
+ * \throws std::invalid_argument If \p pLsbIdx is larger than \p pMsbIdx (reversed slices require operator()(std::size_t, std::size_t)).
+ *
+ * \param pMsbIdx Field-local bit number for the \e most significant bit of the selected slice.
+ * \param pLsbIdx Field-local bit number for the \e least significant bit of the selected slice.
+ * \return View of <tt>field[pMsbIdx:pLsbIdx]</tt>.
+ */
+StandardRegister::FieldView RegField::view(const std::size_t pMsbIdx, const std::size_t pLsbIdx)
+{
+    if (pMsbIdx >= size)
+    {
+        throw std::invalid_argument("Most significant bit index " + std::to_string(pMsbIdx) +
+                                    " is out of range for register field \"" + name + "\".");
+    }
+    if (pLsbIdx > pMsbIdx)
+        throw std::invalid_argument("Reversed slices of register field \"" + name + "\" cannot be accessed as view.");
+
+    return FieldView(*this, pLsbIdx, pMsbIdx-pLsbIdx+1);
+}
+
 //
 
 /*!
@@ -1847,20 +2575,97 @@ const RegField& RegField::n(/*const */std::size_t pFieldRepIdx) const
 const RegField& RegField::n(const std::size_t pFieldRepIdx) const
 #endif
 {
-    if (pFieldRepIdx >= repetitionKeys.size())
+    if (pFieldRepIdx >= repetitionFields.size())
     {
-        if (repetitionKeys.size() == 0)
+        if (repetitionFields.size() == 0)
             throw std::runtime_error("Register field \"" + name + "\" has no repetitions.");
         else
             throw std::invalid_argument("Register field \"" + name + "\" has no repetition with index " + std::to_string(pFieldRepIdx) + ".");
     }
 
-    const auto it = childFields.find(repetitionKeys[pFieldRepIdx]);
+    return repetitionFields[pFieldRepIdx];
+}
 
-    if (it == childFields.end())
-        throw std::runtime_error("Could not find register field for given repetition index. THIS SHOULD NEVER HAPPEN!");
+//
 
-    return it->second;
+/*!
+ * \brief Assign integer values to all field repetitions.
+ *
+ * Assigns <tt>pValues[i]</tt> to the <tt>i</tt>-th field repetition (as in <tt>n(i) = pValues[i]</tt>) or, if \p pFieldName
+ * is not empty, to its immediate child field \p pFieldName (as in <tt>n(i)[pFieldName] = pValues[i]</tt>), for all repetitions
+ * at once. This avoids the repeated field lookups by name that are involved in setting each repetition individually.
+ *
+ * See also operator=(std::uint64_t).
+ *
+ * \throws std::runtime_error If the field does not have any (more than one) repetitions.
+ * \throws std::invalid_argument If the length of \p pValues differs from the repetition count.
+ * \throws std::invalid_argument If the repetitions have no sub-field \p pFieldName.
+ *
+ * \param pValues Values to be assigned, ordered by repetition number.
+ * \param pFieldName Name of the repetitions' sub-field to assign to, or empty to assign to the whole repetitions.
+ */
+#ifdef CASIL_DOXYGEN    //Workaround for Doxygen getting confused by the added const
+void RegField::setRepeated(/*const */std::span<const std::uint64_t> pValues, /*const */std::string_view pFieldName)
+#else
+void RegField::setRepeated(const std::span<const std::uint64_t> pValues, const std::string_view pFieldName)
+#endif
+{
+    if (repetitionFields.size() == 0)
+        throw std::runtime_error("Register field \"" + name + "\" has no repetitions.");
+
+    if (pValues.size() != repetitionFields.size())
+        throw std::invalid_argument("Number of values differs from repetition count of register field \"" + name + "\".");
+
+    if (pFieldName.empty())
+    {
+        for (std::size_t i = 0; i < pValues.size(); ++i)
+            repetitionFields[i].get() = pValues[i];
+    }
+    else
+    {
+        for (std::size_t i = 0; i < pValues.size(); ++i)
+            repetitionFields[i].get()[pFieldName] = pValues[i];
+    }
+}
+
+/*!
+ * \brief Get integer values of all field repetitions.
+ *
+ * Returns the integer equivalents of all field repetitions (as in <tt>n(i).toUInt()</tt>) or, if \p pFieldName is not empty,
+ * of their immediate child fields \p pFieldName (as in <tt>n(i)[pFieldName].toUInt()</tt>), ordered by repetition number.
+ *
+ * See also operator std::uint64_t().
+ *
+ * \throws std::runtime_error If the field does not have any (more than one) repetitions.
+ * \throws std::invalid_argument If the repetitions have no sub-field \p pFieldName.
+ *
+ * \param pFieldName Name of the repetitions' sub-field to read, or empty to read the whole repetitions.
+ * \return Integer values of all repetitions.
+ */
+#ifdef CASIL_DOXYGEN    //Workaround for Doxygen getting confused by the added const
+std::vector<std::uint64_t> RegField::getRepeated(/*const */std::string_view pFieldName) const
+#else
+std::vector<std::uint64_t> RegField::getRepeated(const std::string_view pFieldName) const
+#endif
+{
+    if (repetitionFields.size() == 0)
+        throw std::runtime_error("Register field \"" + name + "\" has no repetitions.");
+
+    std::vector<std::uint64_t> values;
+    values.reserve(repetitionFields.size());
+
+    if (pFieldName.empty())
+    {
+        for (const RegField& field : repetitionFields)
+            values.push_back(field.toUInt());
+    }
+    else
+    {
+        for (const RegField& field : repetitionFields)
+            values.push_back(field[pFieldName].toUInt());
+    }
+
+    return values;
 }
 
 //
@@ -1897,6 +2702,382 @@ std::uint64_t RegField::getTotalOffset() const
 
 //Private
 
+/*!
+ * \brief Get the top level bitset index of a field bit.
+ *
+ * \param pIdx Field-local bit number (must be smaller than the field size).
+ * \return Index of the field's bit \p pIdx in the register's top level bitset.
+ */
+std::uint64_t RegField::bitsetIndex(const std::uint64_t pIdx) const
+{
+    //Find last segment that starts at or before field bit 'pIdx'
+    auto it = std::upper_bound(bitSegments.begin(), bitSegments.end(), pIdx,
+                               [](const std::uint64_t pFieldIdx, const BitSegment& pSegment) { return pFieldIdx < pSegment.fieldIdx; });
+    --it;
+
+    return static_cast<std::uint64_t>(static_cast<std::int64_t>(it->bitsetIdx) + it->stride * static_cast<std::int64_t>(pIdx - it->fieldIdx));
+}
+
+/*!
+ * \brief Assign equivalent integer value to a range of field bits.
+ *
+ * Assigns the binary equivalent of \p pValue to the field bits <tt>[(pLsbIdx+pSize-1):pLsbIdx]</tt>, with the least
+ * significant bit first and the assigned sequence being truncated or zero-padded to \p pSize at the most significant bit position.
+ *
+ * Regular and reversed runs of bits (see BitSegment) are assigned as a whole, only other runs bit by bit.
+ *
+ * \param pLsbIdx Field-local bit number of the range's least significant bit.
+ * \param pSize Number of bits in the range (range must not exceed the field size).
+ * \param pValue Value to be assigned.
+ */
+void RegField::assignUIntRange(const std::uint64_t pLsbIdx, const std::uint64_t pSize, const std::uint64_t pValue)
+{
+    if (contiguous) //Fast path: clear whole range and only set the high bits
+    {
+        ::assignBitRange(bits.get(), bitSegments.front().bitsetIdx + pLsbIdx, pSize, pValue);
+        return;
+    }
+
+    boost::dynamic_bitset<>& tBits = bits.get();
+
+    //Bits beyond the 64 least significant bits are cleared
+    for (const BitSegment& fullSegment : bitSegments)
+    {
+        BitSegment segment {};
+        if (!clipBitSegment(fullSegment, pLsbIdx, pSize, segment))
+            continue;
+
+        //Number of segment bits that take a bit of the value
+        const std::uint64_t numValueBits = (segment.fieldIdx >= 64 ? 0 : std::min(segment.length, 64 - segment.fieldIdx));
+
+        if (segment.stride == 1 || segment.length == 1)    //Regular order: assign whole range at once
+        {
+            tBits.reset(segment.bitsetIdx, segment.length);
+
+            if (numValueBits != 0)
+                ::assignBitRange(tBits, segment.bitsetIdx, numValueBits, pValue >> segment.fieldIdx);
+        }
+        else if (segment.stride == -1)  //Reversed order: assign whole range at once with reversed value bits
+        {
+            tBits.reset(segment.bitsetIdx - (segment.length - 1), segment.length);
+
+            if (numValueBits != 0)
+            {
+                ::assignBitRange(tBits, segment.bitsetIdx - (numValueBits - 1), numValueBits,
+                                 ::reverseBits64(pValue >> segment.fieldIdx) >> (64 - numValueBits));
+            }
+        }
+        else
+        {
+            std::int64_t bitsetIdx = static_cast<std::int64_t>(segment.bitsetIdx);
+            for (std::uint64_t i = segment.fieldIdx; i < segment.fieldIdx + segment.length; ++i, bitsetIdx += segment.stride)
+                tBits[static_cast<std::size_t>(bitsetIdx)] = (i < 64 && ((pValue >> i) & 1u) != 0);
+        }
+    }
+}
+
+/*!
+ * \brief Assign a raw bit sequence to a range of field bits.
+ *
+ * Assigns \p pBits to the field bits such that <tt>field[(pLsbIdx+pBits.size()-1):pLsbIdx] = pBits[(pBits.size()-1):0]</tt>.
+ *
+ * \param pLsbIdx Field-local bit number of the range's least significant bit.
+ * \param pBits Bit sequence to be assigned (range must not exceed the field size).
+ */
+void RegField::assignBitsRange(const std::uint64_t pLsbIdx, const boost::dynamic_bitset<>& pBits)
+{
+    boost::dynamic_bitset<>& tBits = bits.get();
+
+    for (const BitSegment& fullSegment : bitSegments)
+    {
+        BitSegment segment {};
+        if (!clipBitSegment(fullSegment, pLsbIdx, pBits.size(), segment))
+            continue;
+
+        if (segment.stride == 1)    //Regular order: clear whole range and only copy the high bits
+        {
+            tBits.reset(segment.bitsetIdx, segment.length);
+
+            const std::uint64_t fieldEnd = segment.fieldIdx + segment.length;
+
+            for (std::size_t i = (segment.fieldIdx == 0 ? pBits.find_first() : pBits.find_next(segment.fieldIdx - 1)); i < fieldEnd;
+                 i = pBits.find_next(i))
+            {
+                tBits.set(segment.bitsetIdx + (i - segment.fieldIdx));
+            }
+        }
+        else
+        {
+            std::int64_t bitsetIdx = static_cast<std::int64_t>(segment.bitsetIdx);
+            for (std::uint64_t i = 0; i < segment.length; ++i, bitsetIdx += segment.stride)
+                tBits[static_cast<std::size_t>(bitsetIdx)] = pBits[segment.fieldIdx + i];
+        }
+    }
+}
+
+/*!
+ * \brief Set/unset a range of field bits at once.
+ *
+ * Assigns \p pValue to the field bits <tt>[(pLsbIdx+pSize-1):pLsbIdx]</tt>.
+ *
+ * \param pLsbIdx Field-local bit number of the range's least significant bit.
+ * \param pSize Number of bits in the range (range must not exceed the field size).
+ * \param pValue True for bits high (1) and false for bits low (0).
+ */
+void RegField::setAllRange(const std::uint64_t pLsbIdx, const std::uint64_t pSize, const bool pValue)
+{
+    boost::dynamic_bitset<>& tBits = bits.get();
+
+    //Bit order does not matter here, so can always set whole (reversed or regular) ranges
+    for (const BitSegment& fullSegment : bitSegments)
+    {
+        BitSegment segment {};
+        if (!clipBitSegment(fullSegment, pLsbIdx, pSize, segment))
+            continue;
+
+        if (segment.stride == 1 || segment.length == 1)
+            tBits.set(segment.bitsetIdx, segment.length, pValue);
+        else if (segment.stride == -1)
+            tBits.set(segment.bitsetIdx - (segment.length - 1), segment.length, pValue);
+        else
+        {
+            std::int64_t bitsetIdx = static_cast<std::int64_t>(segment.bitsetIdx);
+            for (std::uint64_t i = 0; i < segment.length; ++i, bitsetIdx += segment.stride)
+                tBits[static_cast<std::size_t>(bitsetIdx)] = pValue;
+        }
+    }
+}
+
+/*!
+ * \brief Get the integer equivalent of a range of field bits.
+ *
+ * Interprets the field bits <tt>[(pLsbIdx+pSize-1):pLsbIdx]</tt> as an unsigned integer with least significant bit first
+ * and returns that number (only the 64 least significant bits of the range are taken into account).
+ *
+ * Regular and reversed runs of bits (see BitSegment) are collected as a whole, only other runs bit by bit.
+ *
+ * \param pLsbIdx Field-local bit number of the range's least significant bit.
+ * \param pSize Number of bits in the range (range must not exceed the field size).
+ * \return Unsigned integer value represented by the range's bit sequence.
+ */
+std::uint64_t RegField::collectUIntRange(const std::uint64_t pLsbIdx, const std::uint64_t pSize) const
+{
+    if (contiguous) //Fast path: only collect the high bits of the (at most 64) least significant bits
+        return ::collectBitRange(bits.get(), bitSegments.front().bitsetIdx + pLsbIdx, pSize);
+
+    const boost::dynamic_bitset<>& tBits = bits.get();
+
+    std::uint64_t value = 0;
+
+    for (const BitSegment& fullSegment : bitSegments)
+    {
+        BitSegment segment {};
+        if (!clipBitSegment(fullSegment, pLsbIdx, std::min(pSize, std::uint64_t{64}), segment))
+            continue;
+
+        if (segment.stride == 1 || segment.length == 1)    //Regular order: collect whole range at once
+            value |= (::collectBitRange(tBits, segment.bitsetIdx, segment.length) << segment.fieldIdx);
+        else if (segment.stride == -1)  //Reversed order: collect whole range at once and reverse the collected bits
+        {
+            const std::uint64_t rangeValue = ::collectBitRange(tBits, segment.bitsetIdx - (segment.length - 1), segment.length);
+            value |= ((::reverseBits64(rangeValue) >> (64 - segment.length)) << segment.fieldIdx);
+        }
+        else
+        {
+            std::int64_t bitsetIdx = static_cast<std::int64_t>(segment.bitsetIdx);
+            for (std::uint64_t i = segment.fieldIdx; i < segment.fieldIdx + segment.length; ++i, bitsetIdx += segment.stride)
+            {
+                if (tBits[static_cast<std::size_t>(bitsetIdx)])
+                    value |= (std::uint64_t{1} << i);
+            }
+        }
+    }
+
+    return value;
+}
+
+/*!
+ * \brief Get a range of field bits as raw bitset.
+ *
+ * \param pLsbIdx Field-local bit number of the range's least significant bit.
+ * \param pSize Number of bits in the range (range must not exceed the field size).
+ * \return <tt>field[(pLsbIdx+pSize-1):pLsbIdx]</tt>.
+ */
+boost::dynamic_bitset<> RegField::collectBitsRange(const std::uint64_t pLsbIdx, const std::uint64_t pSize) const
+{
+    boost::dynamic_bitset retVal(pSize);
+
+    const boost::dynamic_bitset<>& tBits = bits.get();
+
+    for (const BitSegment& fullSegment : bitSegments)
+    {
+        BitSegment segment {};
+        if (!clipBitSegment(fullSegment, pLsbIdx, pSize, segment))
+            continue;
+
+        if (segment.stride == 1)    //Regular order: only copy the high bits
+        {
+            const std::uint64_t bitsetEnd = segment.bitsetIdx + segment.length;
+
+            for (std::size_t i = (segment.bitsetIdx == 0 ? tBits.find_first() : tBits.find_next(segment.bitsetIdx - 1)); i < bitsetEnd;
+                 i = tBits.find_next(i))
+            {
+                retVal.set(segment.fieldIdx + (i - segment.bitsetIdx));
+            }
+        }
+        else
+        {
+            std::int64_t bitsetIdx = static_cast<std::int64_t>(segment.bitsetIdx);
+            for (std::uint64_t i = 0; i < segment.length; ++i, bitsetIdx += segment.stride)
+                retVal[segment.fieldIdx + i] = tBits[static_cast<std::size_t>(bitsetIdx)];
+        }
+    }
+
+    return retVal;
+}
+
+//
+
+/*!
+ * \brief Clip a bit segment to a range of field bits.
+ *
+ * Determines the part of \p pSegment that lies within the field bits <tt>[(pLsbIdx+pSize-1):pLsbIdx]</tt>
+ * and writes it to \p pClipped, with its BitSegment::fieldIdx being relative to \p pLsbIdx.
+ *
+ * \param pSegment Segment of the field.
+ * \param pLsbIdx Field-local bit number of the range's least significant bit.
+ * \param pSize Number of bits in the range.
+ * \param pClipped Clipped segment (only written if the segment overlaps the range).
+ * \return True if \p pSegment overlaps the range.
+ */
+bool RegField::clipBitSegment(const BitSegment& pSegment, const std::uint64_t pLsbIdx, const std::uint64_t pSize, BitSegment& pClipped)
+{
+    const std::uint64_t overlapBegin = std::max(pSegment.fieldIdx, pLsbIdx);
+    const std::uint64_t overlapEnd = std::min(pSegment.fieldIdx + pSegment.length, pLsbIdx + pSize);
+
+    if (overlapBegin >= overlapEnd)
+        return false;
+
+    const std::int64_t bitsetIdx = static_cast<std::int64_t>(pSegment.bitsetIdx) +
+                                   pSegment.stride * static_cast<std::int64_t>(overlapBegin - pSegment.fieldIdx);
+
+    pClipped = BitSegment{overlapBegin - pLsbIdx, static_cast<std::uint64_t>(bitsetIdx), pSegment.stride, overlapEnd - overlapBegin};
+
+    return true;
+}
+
+/*!
+ * \brief Check if segments form a contiguous range in regular bit order.
+ *
+ * \param pSegments Field's bit segments.
+ * \return True if \p pSegments is a single segment with regular bit order (or a single bit).
+ */
+bool RegField::isContiguous(const std::vector<BitSegment>& pSegments)
+{
+    return (pSegments.size() == 1 && (pSegments.front().stride == 1 || pSegments.front().length == 1));
+}
+
+//
+
+/*!
+ * \brief Append a run of bits to a segment list.
+ *
+ * Appends the run of \p pLength bits starting at top level bitset index \p pBitsetIdx with an index increment
+ * of \p pStride to \p pSegments, extending the last segment instead of adding a new one where possible.
+ *
+ * \param pSegments Segment list to append to.
+ * \param pBitsetIdx Top level bitset index of the run's first bit.
+ * \param pStride Top level bitset index increment from one bit of the run to the next (ignored for \p pLength of one).
+ * \param pLength Number of bits in the run.
+ */
+void RegField::appendBitSegment(std::vector<BitSegment>& pSegments, const std::uint64_t pBitsetIdx, const std::int64_t pStride,
+                                const std::uint64_t pLength)
+{
+    if (pLength == 0)
+        return;
+
+    if (!pSegments.empty())
+    {
+        BitSegment& last = pSegments.back();
+
+        const std::int64_t distance = static_cast<std::int64_t>(pBitsetIdx) - static_cast<std::int64_t>(last.bitsetIdx);
+
+        if (last.length == 1 && (pLength == 1 || distance == pStride))
+        {
+            //Single bit can continue with any stride
+            last.stride = distance;
+            last.length += pLength;
+            return;
+        }
+        else if (last.length > 1 && (pLength == 1 || pStride == last.stride) && distance == last.stride * static_cast<std::int64_t>(last.length))
+        {
+            last.length += pLength;
+            return;
+        }
+    }
+
+    const std::uint64_t fieldIdx = (pSegments.empty() ? 0 : (pSegments.back().fieldIdx + pSegments.back().length));
+
+    pSegments.push_back(BitSegment{fieldIdx, pBitsetIdx, (pLength == 1 ? 0 : pStride), pLength});
+}
+
+/*!
+ * \brief Get segments for a contiguous parent slice.
+ *
+ * Determines the bit segments for the contiguous range of \p pSize bits of \p pParent
+ * with most significant bit offset \p pOffs, i.e. for <tt>pParent[pOffs:(pOffs-(pSize-1))]</tt>.
+ *
+ * \param pParent Parent register field.
+ * \param pSize Size of the slice in number of bits.
+ * \param pOffs Index of the slice's most significant bit in \p pParent.
+ * \return Bit segments for the slice (least significant bit first).
+ */
+std::vector<RegField::BitSegment> RegField::sliceBitSegments(const RegField& pParent, const std::uint64_t pSize, const std::uint64_t pOffs)
+{
+    const std::uint64_t sliceBegin = pOffs-(pSize-1);
+    const std::uint64_t sliceEnd = pOffs+1;
+
+    std::vector<BitSegment> segments;
+
+    for (const BitSegment& segment : pParent.bitSegments)
+    {
+        const std::uint64_t overlapBegin = std::max(sliceBegin, segment.fieldIdx);
+        const std::uint64_t overlapEnd = std::min(sliceEnd, segment.fieldIdx + segment.length);
+
+        if (overlapBegin >= overlapEnd)
+            continue;
+
+        const std::int64_t bitsetIdx = static_cast<std::int64_t>(segment.bitsetIdx) +
+                                       segment.stride * static_cast<std::int64_t>(overlapBegin - segment.fieldIdx);
+
+        appendBitSegment(segments, static_cast<std::uint64_t>(bitsetIdx), segment.stride, overlapEnd - overlapBegin);
+    }
+
+    return segments;
+}
+
+/*!
+ * \brief Get segments for a selection of parent bits.
+ *
+ * Determines the bit segments for the arbitrary sequence of bits <tt>pParent[pParentIdxs[i]]</tt>,
+ * where the \e first index in \p pParentIdxs results in the \e least significant bit.
+ *
+ * \param pParent Parent register field.
+ * \param pParentIdxs Indices of the selected bits in \p pParent (must be within the extent of \p pParent).
+ * \return Bit segments for the selection (least significant bit first).
+ */
+std::vector<RegField::BitSegment> RegField::mapBitSegments(const RegField& pParent, const std::vector<std::size_t>& pParentIdxs)
+{
+    std::vector<BitSegment> segments;
+
+    for (const std::size_t idx : pParentIdxs)
+        appendBitSegment(segments, pParent.bitsetIndex(idx), 1, 1);
+
+    return segments;
+}
+
+//
+
 /*!
  * \brief Set references to the immediate child fields.
  *
@@ -1911,7 +3092,7 @@ std::uint64_t RegField::getTotalOffset() const
 void RegField::setChildFields(std::map<std::string, const std::reference_wrapper<RegField>, std::less<>> pChildFields)
 {
     childFields.swap(pChildFields);
-    repetitionKeys.clear();     //Should not be needed in practice, just to make really sure this was not set before by the other overload
+    repetitionFields.clear();   //Should not be needed in practice, just to make really sure this was not set before by the other overload
 }
 
 /*!
@@ -1925,11 +3106,211 @@ void RegField::setChildFields(std::map<std::string, const std::reference_wrapper
 void RegField::setChildFields(const std::vector<std::pair<std::string, const std::reference_wrapper<RegField>>>& pFieldReps)
 {
     childFields.clear();
-    repetitionKeys.clear();
+    repetitionFields.clear();
 
     for (std::size_t i = 0; i < pFieldReps.size(); ++i)
     {
         childFields.insert(pFieldReps[i]);
-        repetitionKeys.push_back(pFieldReps[i].first);
+        repetitionFields.push_back(pFieldReps[i].second);
     }
 }
+
+//StandardRegister::FieldView
+
+using FieldView = StandardRegister::FieldView;
+
+/*!
+ * \brief Constructor.
+ *
+ * Views the \p pSize bits of \p pField starting at field-local bit number \p pLsbIdx (range must not exceed the field size).
+ *
+ * \param pField Viewed register field.
+ * \param pLsbIdx Field-local bit number of the slice's least significant bit.
+ * \param pSize Size of the slice in number of bits.
+ */
+FieldView::FieldView(RegField& pField, const std::uint64_t pLsbIdx, const std::uint64_t pSize) :
+    field(&pField),
+    lsbIdx(pLsbIdx),
+    size(pSize)
+{
+}
+
+//Public
+
+/*!
+ * \brief Assign equivalent integer value to the slice.
+ *
+ * Takes the binary equivalent of \p pValue and assigns it to the bits of the slice, with the least significant bit first
+ * and the assigned sequence being truncated or zero-padded to the slice's size at the most significant bit position.
+ *
+ * \param pValue Value to be assigned.
+ * \return \p pValue.
+ */
+#ifdef CASIL_DOXYGEN    //Workaround for Doxygen getting confused by the added const
+std::uint64_t FieldView::operator=(/*const */std::uint64_t pValue)
+#else
+std::uint64_t FieldView::operator=(const std::uint64_t pValue)
+#endif
+{
+    field->assignUIntRange(lsbIdx, size, pValue);
+    return pValue;
+}
+
+/*!
+ * \brief Assign a raw bit sequence to the slice.
+ *
+ * Assigns \p pBits to the bits of the slice such that <tt>slice[(size-1):0] = pBits[(size-1):0]</tt>.
+ *
+ * \throws std::invalid_argument If the size of \p pBits differs from the slice size.
+ *
+ * \param pBits Bit sequence to be assigned.
+ * \return \p pBits.
+ */
+const boost::dynamic_bitset<>& FieldView::operator=(const boost::dynamic_bitset<>& pBits)
+{
+    if (pBits.size() != size)
+        throw std::invalid_argument("Wrong number of bits for slice of register field \"" + field->name + "\".");
+
+    field->assignBitsRange(lsbIdx, pBits);
+
+    return pBits;
+}
+
+//
+
+/*!
+ * \brief Assign equivalent integer value to the slice.
+ *
+ * See operator=(std::uint64_t).
+ *
+ * \param pValue Value to be assigned.
+ */
+#ifdef CASIL_DOXYGEN    //Workaround for Doxygen getting confused by the added const
+void FieldView::set(/*const */std::uint64_t pValue)
+#else
+void FieldView::set(const std::uint64_t pValue)
+#endif
+{
+    *this = pValue;
+}
+
+/*!
+ * \brief Assign a raw bit sequence to the slice.
+ *
+ * See operator=(const boost::dynamic_bitset<>&).
+ *
+ * \throws std::invalid_argument If operator=(const boost::dynamic_bitset<>&) throws \c std::invalid_argument.
+ *
+ * \param pBits Bit sequence to be assigned.
+ */
+void FieldView::set(const boost::dynamic_bitset<>& pBits)
+{
+    *this = pBits;
+}
+
+/*!
+ * \brief Set/unset all slice bits at once.
+ *
+ * Assigns \p pValue to every bit of the slice.
+ *
+ * \param pValue True for bits high (1) and false for bits low (0).
+ */
+void FieldView::setAll(const bool pValue)
+{
+    field->setAllRange(lsbIdx, size, pValue);
+}
+
+//
+
+/*!
+ * \brief Get the integer equivalent of slice's content.
+ *
+ * Interprets the bit sequence of the slice as an unsigned integer with least significant bit first and returns that number.
+ *
+ * \return Unsigned integer value represented by the slice's bit sequence.
+ */
+FieldView::operator std::uint64_t() const
+{
+    return field->collectUIntRange(lsbIdx, size);
+}
+
+/*!
+ * \brief Get the slice's content as raw bitset.
+ *
+ * \return <tt>slice[(size-1):0]</tt>.
+ */
+FieldView::operator boost::dynamic_bitset<>() const
+{
+    return field->collectBitsRange(lsbIdx, size);
+}
+
+//
+
+/*!
+ * \brief Get the integer equivalent of slice's content.
+ *
+ * \copydetails FieldView::operator std::uint64_t
+ */
+std::uint64_t FieldView::toUInt() const
+{
+    return (operator std::uint64_t());
+}
+
+/*!
+ * \brief Get the slice's data as raw bitset.
+ *
+ * \copydetails FieldView::operator boost::dynamic_bitset<>
+ */
+boost::dynamic_bitset<> FieldView::toBits() const
+{
+    return (operator boost::dynamic_bitset<>());
+}
+
+//
+
+/*!
+ * \brief Access a sub-slice of bits in the slice.
+ *
+ * Returns a view of the same field for the bits between (and including) the slice-local indices \p pMsbIdx and \p pLsbIdx.
+ *
+ * \throws std::invalid_argument If \p pMsbIdx exceeds the slice size.
+ * \throws std::invalid_argument If \p pLsbIdx is larger than \p pMsbIdx.
+ *
+ * \param pMsbIdx Slice-local bit number for the \e most significant bit of the selected sub-slice.
+ * \param pLsbIdx Slice-local bit number for the \e least significant bit of the selected sub-slice.
+ * \return View of <tt>slice[pMsbIdx:pLsbIdx]</tt>.
+ */
+FieldView FieldView::operator()(const std::size_t pMsbIdx, const std::size_t pLsbIdx) const
+{
+    if (pMsbIdx >= size)
+    {
+        throw std::invalid_argument("Most significant bit index " + std::to_string(pMsbIdx) +
+                                    " is out of range for slice of register field \"" + field->name + "\".");
+    }
+    if (pLsbIdx > pMsbIdx)
+        throw std::invalid_argument("Reversed slices of register field \"" + field->name + "\" cannot be accessed as view.");
+
+    return FieldView(*field, lsbIdx + pLsbIdx, pMsbIdx-pLsbIdx+1);
+}
+
+//
+
+/*!
+ * \brief Get the size of the slice.
+ *
+ * \return Number of bits in the slice.
+ */
+std::uint64_t FieldView::getSize() const
+{
+    return size;
+}
+
+/*!
+ * \brief Get the slice's least significant bit index in the viewed field.
+ *
+ * \return Field-local bit number of the slice's least significant bit.
+ */
+std::uint64_t FieldView::getOffset() const
+{
+    return lsbIdx;
+}
@@ -69,12 +69,16 @@
 #include <boost/dynamic_bitset.hpp>
 #include <boost/property_tree/ptree.hpp>
 
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <initializer_list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -98,6 +102,10 @@ namespace Layers::RL
  * This data can then be "committed" to the driver by calling write() (which calls
  * MuxedDriver::setData() and optionally also MuxedDriver::exec()).
  *
+ * For overlapping the preparation of the next register data with the transfer of the current data (e.g. for mask scans),
+ * commitAsync() copies the register data to an internal front buffer that is then written asynchronously, while the
+ * register data (back buffer) can already be changed again.
+ *
  * Data to be read from the driver (see MuxedDriver::getData()) can instead be fetched
  * by calling read() and can then be accessed similar to the write data (see getRead()
  * and rootRead()). However, this "readback" data is not meant to be changed (read-only).
@@ -109,6 +117,7 @@ class StandardRegister final : public Register
 public:
     class BoolRef;
     class RegField;
+    class FieldView;
 
 public:
     StandardRegister(std::string pName, HL::Driver& pDriver, LayerConfig pConfig);  ///< Constructor.
@@ -131,11 +140,32 @@ public:
     void set(const boost::dynamic_bitset<>& pBits);                                 ///< Assign a raw bit sequence to the register.
     void setAll(bool pValue = true);                                                ///< Set/unset all register bits at once.
     //
+    void setBitRange(std::uint64_t pOffs, std::uint64_t pSize, std::uint64_t pValue);   ///< \brief Assign equivalent integer value to
+                                                                                        ///  a contiguous range of register bits.
+    std::uint64_t getBitRange(std::uint64_t pOffs, std::uint64_t pSize) const;          ///< \brief Get the integer equivalent of
+                                                                                        ///  a contiguous range of register bits.
+    std::uint64_t getReadBitRange(std::uint64_t pOffs, std::uint64_t pSize) const;      ///< \brief Get the integer equivalent of
+                                                                                        ///  a contiguous range of readback bits.
+    //
     const boost::dynamic_bitset<>& get() const;                                     ///< Get the register data as raw bit sequence.
     const boost::dynamic_bitset<>& getRead() const;                                 ///< Get the driver readback data as a bit sequence.
     //
     void write(std::size_t pNumBytes = 0) const;                                    ///< Write the register data to the driver.
+    void writeDirty() const;                                                        ///< \brief Write only the register bytes changed
+                                                                                    ///  since the last write to the driver.
+    static void writeGroup(const std::vector<std::reference_wrapper<const StandardRegister>>& pRegisters);
+                                                                                    ///< \brief Write the data of several registers with
+                                                                                    ///  combined driver calls per driver.
+    void update(const std::vector<std::pair<std::string, std::uint64_t>>& pFieldValues);
+                                                                                    ///< \brief Assign values to several register fields
+                                                                                    ///  and write the changed bytes to the driver.
     void read(std::size_t pNumBytes = 0);                                           ///< Read from the driver and assign to the readback data.
+    std::future<void> writeAsync(std::size_t pNumBytes = 0) const;                  ///< Asynchronously write the register data to the driver.
+    std::future<void> readAsync(std::size_t pNumBytes = 0);                         ///< \brief Asynchronously read from the driver and assign
+                                                                                    ///  to the readback data.
+    std::future<void> commitAsync(std::size_t pNumBytes = 0);                       ///< \brief Copy the register data to the front buffer
+                                                                                    ///  and asynchronously write it to the driver.
+    std::vector<std::pair<std::size_t, std::size_t>> compareReadback() const;       ///< Compare the register data with the driver readback data.
     //
     std::vector<std::uint8_t> toBytes() const;                                      ///< Convert the register data to a byte sequence.
     void fromBytes(std::vector<std::uint8_t> pBytes);                               ///< Load/assign the register data from a byte sequence.
@@ -144,31 +174,79 @@ private:
     bool initImpl() override;
     bool closeImpl() override;
     //
+    std::size_t getWriteByteCount(std::size_t pNumBytes) const;                     ///< Get the number of bytes to be written by write().
+    std::vector<std::uint8_t> bitsToBytes(const boost::dynamic_bitset<>& pBits) const; ///< Convert register bits to a byte sequence.
+    void writeBytes(const std::vector<std::uint8_t>& pAllBytes, std::size_t pNumBytes) const;  ///< \brief Write (part of) a register
+                                                                                                ///  byte sequence to the driver.
+    //
     void loadRuntimeConfImpl(boost::property_tree::ptree&& pConf) override;
     boost::property_tree::ptree dumpRuntimeConfImpl() const override;
     //
+    void loadRuntimeSnapshotImpl(std::span<const std::uint8_t> pSnapshot) override;
+    std::vector<std::uint8_t> dumpRuntimeSnapshotImpl() const override;
+    //
+    std::map<std::string, std::size_t> getMemoryUsageImpl() const override;
+    //
+    /*!
+     * \brief Register field definition from the field configuration, as element of a compiled FieldLayout.
+     */
+    struct FieldDescriptor
+    {
+        std::string name;                       ///< Name of the field.
+        std::uint64_t size;                     ///< Size of the field (or of a single repetition) in number of bits.
+        std::uint64_t offs;                     ///< Index of the field's most significant bit in the parent field.
+        std::uint64_t reps;                     ///< Number of repetitions of the field.
+        std::vector<std::uint64_t> bitOrder;    ///< Bit order of the field (or of each repetition), or empty for regular order.
+        std::size_t numDescendants;             ///< Number of directly following descriptors that describe (nested) sub-fields.
+    };
+    typedef std::vector<FieldDescriptor> FieldLayout;   ///< \brief Flat, validated register field configuration
+                                                        ///  (fields and their sub-fields in depth-first order).
+    //
+    std::shared_ptr<const FieldLayout> getFieldLayout(const boost::property_tree::ptree& pFieldsConfig) const;
+                                                                                                ///< \brief Get the (shared) compiled
+                                                                                                ///  layout for a field configuration.
+    void compileFieldLayout(FieldLayout& pLayout, const boost::property_tree::ptree& pConfTree, const std::string& pParentKey,
+                            std::uint64_t pParentSize) const;
+                                                                                                ///< \brief Compile the field layout by
+                                                                                                ///  recursing through the field configuration.
+    //
     typedef boost::property_tree::basic_ptree<std::string, std::shared_ptr<RegField>> FieldTree;    ///< \brief Property tree for register
                                                                                                     ///  fields that reference parts of the
                                                                                                     ///  register with the field names as keys.
-    void populateFieldTree(FieldTree& pFieldTree, const boost::property_tree::ptree& pConfTree, const std::string& pParentKey) const;
-                                                                                                ///< \brief Populate the register field tree by
-                                                                                                ///  recursing through the field configuration.
+    static void populateFieldTree(FieldTree& pFieldTree, const FieldLayout& pLayout, std::size_t pBegin, std::size_t pEnd);
+                                                                                                ///< \brief Populate the register field tree
+                                                                                                ///  from part of a compiled field layout.
 
 private:
     const std::uint64_t size;           ///< Size of the register in number of bits.
     //
+    const std::uint32_t dataOffset;     ///< Address offset of the register data within the driver data (see Driver::setData()).
     const bool autoStart;               ///< Automatically call Driver::exec() from within write().
     const bool lsbSidePadding;          ///< Use/expect left-alignment of byte vectors (i.e. with LSB-side zero padding!) as is done in basil.
     //
     boost::dynamic_bitset<> data;       ///< Register content (for writing).
     boost::dynamic_bitset<> readData;   ///< Driver readback data (like above register content but for reading).
     //
+    boost::dynamic_bitset<> frontData;              ///< Register content committed by commitAsync() for writing (front buffer).
+    bool frontDataPending;                          ///< \ref frontData was committed but not yet taken by its asynchronous write.
+    mutable std::mutex frontDataMutex;              ///< Mutex for \ref frontData and \ref frontDataPending.
+    std::condition_variable frontDataCondition;     ///< Signals that \ref frontData was taken by its asynchronous write.
+    //
+    std::shared_ptr<const FieldLayout> fieldLayout;     ///< Compiled field configuration (shared by registers with identical fields).
+    //
     FieldTree fields;                   ///< Tree representing the hierarchy of named register fields for convenient access to them.
     FieldTree readFields;               ///< Equivalent field tree that points to the driver readback data instead.
     //
     typedef std::variant<std::monostate, std::uint64_t, boost::dynamic_bitset<>> VariantValueType;
                                                             ///< Variant to optionally store the two possible register field assignment types.
     std::map<std::string, VariantValueType> initValues;     ///< Register fields' default values from YAML configuration.
+    //
+    mutable std::vector<std::uint8_t> writtenBytes;         ///< Register data as of the last write (see toBytes()), or empty if unknown.
+    //
+    static constexpr std::size_t dirtySpanMergeGap = 8;     ///< \brief Maximum number of unchanged bytes between two changed byte spans
+                                                            ///  for still writing them as a single span in writeDirty().
+    static constexpr std::uint64_t runtimeConfBlobMinSize = 256;  ///< \brief Minimum register size (in bits) for dumping the runtime
+                                                                  ///  configuration as binary blob instead of bit string.
 
     CASIL_REGISTER_REGISTER_H("StandardRegister")
 };
@@ -177,6 +255,8 @@ private:
  * \brief Proxy class for accessing an individual register bit.
  *
  * Provides convenient read/write access to a single bit of a StandardRegister instance or of a specific register field thereof.
+ *
+ * The proxy always refers directly to the bit in the register's top level bitset, also when it was created for a register field.
  */
 class StandardRegister::BoolRef
 {
@@ -197,12 +277,8 @@ public:
     bool get() const;                                           ///< Get the value of the referenced bit.
 
 private:
-    using BitsetRef = std::reference_wrapper<boost::dynamic_bitset<>>;  ///< Wrapper for reference to bitset to be held by \c std::variant.
-    using FieldRef = std::reference_wrapper<RegField>;                  ///< Wrapper for reference to RegField to be held by \c std::variant.
-
-private:
-    const std::variant<const BitsetRef, const FieldRef> dataField;  ///< Referenced dataset (either raw bitset or abstract register field).
-    const std::size_t idx;                                          ///< Index of the referenced bit in the referenced register field.
+    const std::reference_wrapper<boost::dynamic_bitset<>> bits;     ///< Bitset that holds the referenced bit.
+    const std::size_t idx;                                          ///< Index of the referenced bit in the referenced bitset.
 };
 
 /*!
@@ -210,9 +286,25 @@ private:
  *
  * Provides convenient read/write access to a certain register \e field, a subset of
  * bits from a StandardRegister instance or of another, parent register field thereof.
+ *
+ * The field's bits are described as a (usually very short) list of equidistant runs of bits in the register's top level bitset
+ * and proxy references to individual bits (see operator[](std::size_t)) are only created on first access. Hence the memory
+ * needed for a register and its (even deeply nested or repeated) fields is roughly proportional to the number of fields.
  */
 class StandardRegister::RegField
 {
+private:
+    /*!
+     * \brief Run of field bits with equidistant indices in the register's top level bitset.
+     */
+    struct BitSegment
+    {
+        std::uint64_t fieldIdx;     ///< Field-local index of the segment's first bit.
+        std::uint64_t bitsetIdx;    ///< Index of the segment's first bit in the top level bitset.
+        std::int64_t stride;        ///< Top level bitset index increment from one field bit to the next.
+        std::uint64_t length;       ///< Number of bits in the segment.
+    };
+
 private:
     RegField(RegField& pParent, const std::vector<std::size_t>& pIdxs);                                             ///< Constructor.
 
@@ -247,10 +339,16 @@ public:
     RegField operator()(std::size_t pMsbIdx, std::size_t pLsbIdx);                          ///< Access a slice of bits in the field.
     RegField operator[](const std::vector<std::size_t>& pIdxs);                             ///< Access a set of unique bits in the field.
     RegField operator[](std::initializer_list<std::size_t> pIdxs);                          ///< Access a set of unique bits in the field.
+    FieldView view(std::size_t pMsbIdx, std::size_t pLsbIdx);                               ///< \brief Access a slice of bits in the field
+                                                                                            ///  without creating a new field.
     //
     RegField& n(std::size_t pFieldRepIdx);                                                  ///< Access the n-th repetition of the field.
     const RegField& n(std::size_t pFieldRepIdx) const;                                      ///< Access the n-th repetition of the field.
     //
+    void setRepeated(std::span<const std::uint64_t> pValues, std::string_view pFieldName = "");
+                                                                                            ///< Assign integer values to all field repetitions.
+    std::vector<std::uint64_t> getRepeated(std::string_view pFieldName = "") const;         ///< Get integer values of all field repetitions.
+    //
     std::uint64_t getSize() const;                                                          ///< Get the size of the field.
     std::uint64_t getOffset() const;                                                        ///< \brief Get the field's offset
                                                                                             ///  with respect to its parent field.
@@ -258,6 +356,27 @@ public:
                                                                                             ///  with respect to the whole register.
 
 private:
+    std::uint64_t bitsetIndex(std::uint64_t pIdx) const;                                    ///< Get the top level bitset index of a field bit.
+    //
+    void assignUIntRange(std::uint64_t pLsbIdx, std::uint64_t pSize, std::uint64_t pValue); ///< Assign equivalent integer value to a range of field bits.
+    void assignBitsRange(std::uint64_t pLsbIdx, const boost::dynamic_bitset<>& pBits);      ///< Assign a raw bit sequence to a range of field bits.
+    void setAllRange(std::uint64_t pLsbIdx, std::uint64_t pSize, bool pValue);              ///< Set/unset a range of field bits at once.
+    std::uint64_t collectUIntRange(std::uint64_t pLsbIdx, std::uint64_t pSize) const;       ///< Get the integer equivalent of a range of field bits.
+    boost::dynamic_bitset<> collectBitsRange(std::uint64_t pLsbIdx, std::uint64_t pSize) const; ///< Get a range of field bits as raw bitset.
+    //
+    static bool clipBitSegment(const BitSegment& pSegment, std::uint64_t pLsbIdx, std::uint64_t pSize, BitSegment& pClipped);
+                                                                                            ///< Clip a bit segment to a range of field bits.
+    //
+    static bool isContiguous(const std::vector<BitSegment>& pSegments);                     ///< \brief Check if segments form a contiguous
+                                                                                            ///  range in regular bit order.
+    //
+    static void appendBitSegment(std::vector<BitSegment>& pSegments, std::uint64_t pBitsetIdx, std::int64_t pStride, std::uint64_t pLength);
+                                                                                            ///< Append a run of bits to a segment list.
+    static std::vector<BitSegment> sliceBitSegments(const RegField& pParent, std::uint64_t pSize, std::uint64_t pOffs);
+                                                                                            ///< Get segments for a contiguous parent slice.
+    static std::vector<BitSegment> mapBitSegments(const RegField& pParent, const std::vector<std::size_t>& pParentIdxs);
+                                                                                            ///< Get segments for a selection of parent bits.
+    //
     void setChildFields(std::map<std::string, const std::reference_wrapper<RegField>, std::less<>> pChildFields);
                                                                                             ///< Set references to the immediate child fields.
     void setChildFields(const std::vector<std::pair<std::string, const std::reference_wrapper<RegField>>>& pFieldReps);
@@ -277,7 +396,25 @@ private:
      *
      * See setChildFields() and StandardRegister::populateFieldTree().
      */
-    friend void StandardRegister::populateFieldTree(StandardRegister::FieldTree&, const boost::property_tree::ptree&, const std::string&) const;
+    friend void StandardRegister::populateFieldTree(StandardRegister::FieldTree&, const StandardRegister::FieldLayout&, std::size_t, std::size_t);
+    /*!
+     * \brief Let the enclosing StandardRegister class estimate the memory used by the field and its bit proxy references.
+     *
+     * See StandardRegister::getMemoryUsageImpl().
+     */
+    friend std::map<std::string, std::size_t> StandardRegister::getMemoryUsageImpl() const;
+    /*!
+     * \brief Let BoolRef directly reference the top level bitset.
+     *
+     * See BoolRef::BoolRef(RegField&, std::size_t).
+     */
+    friend class StandardRegister::BoolRef;
+    /*!
+     * \brief Let FieldView access the field's bits via the range functions.
+     *
+     * See e.g. assignUIntRange() and collectUIntRange().
+     */
+    friend class StandardRegister::FieldView;
     /// \endcond INTERNAL
 
 private:
@@ -289,10 +426,72 @@ private:
     const std::uint64_t parentSize;             ///< Size of the parent field in number of bits.
     const std::uint64_t parentTotalOffs;        ///< Index of the parent field's most significant bit in the register's top level bitset.
     //
-    const std::vector<std::unique_ptr<BoolRef>> dataRefs;   ///< Proxy references to all of the field's bits (least significant bit at front).
+    const std::reference_wrapper<boost::dynamic_bitset<>> bits;     ///< Register's top level bitset that holds the field's bits.
+    const std::vector<BitSegment> bitSegments;  ///< Field's bits as segments of the top level bitset (least significant bit first).
+    const bool contiguous;                      ///< Field's bits are a contiguous range of the top level bitset in regular order.
+    //
+    mutable std::mutex bitRefsMutex;            ///< Mutex for creating and looking up bit proxy references.
+    mutable std::map<std::size_t, std::unique_ptr<BoolRef>> bitRefs;           ///< Lazily created proxy references to accessed bits.
     //
     std::map<std::string, const std::reference_wrapper<RegField>, std::less<>> childFields;     ///< Map of immediate child fields.
-    std::vector<std::string> repetitionKeys;    ///< Assignment of number of field's repetition to respective key in 'childFields'.
+    std::vector<std::reference_wrapper<RegField>> repetitionFields;         ///< Field repetitions (also in 'childFields') by repetition number.
+};
+
+/*!
+ * \brief Lightweight view of a contiguous slice of a register field.
+ *
+ * Provides the same read/write access as a RegField for a slice of bits of an existing field (see RegField::view()),
+ * but only consists of a reference to that field and the slice's position and size. Hence creating, copying and
+ * slicing views (see operator()()) never allocates, which makes them suitable for slicing fields inside (tight) loops.
+ *
+ * The view refers to its field (and consequently to all parents thereof and ultimately the containing StandardRegister),
+ * which must hence outlive the view. The slice has regular bit order (for reversed slices use RegField::operator()()).
+ */
+class StandardRegister::FieldView
+{
+private:
+    FieldView(RegField& pField, std::uint64_t pLsbIdx, std::uint64_t pSize);                ///< Constructor.
+
+public:
+    FieldView(const FieldView&) = default;                                                  ///< Default copy constructor.
+    FieldView(FieldView&&) = default;                                                       ///< Default move constructor.
+    ~FieldView() = default;                                                                 ///< Default destructor.
+    //
+    FieldView& operator=(const FieldView&) = delete;                                        ///< Deleted copy assignment operator.
+    FieldView& operator=(FieldView&&) = delete;                                             ///< Deleted move assignment operator.
+    //
+    std::uint64_t operator=(std::uint64_t pValue);                                          ///< Assign equivalent integer value to the slice.
+    const boost::dynamic_bitset<>& operator=(const boost::dynamic_bitset<>& pBits);         ///< Assign a raw bit sequence to the slice.
+    //
+    void set(std::uint64_t pValue);                                                         ///< Assign equivalent integer value to the slice.
+    void set(const boost::dynamic_bitset<>& pBits);                                         ///< Assign a raw bit sequence to the slice.
+    void setAll(bool pValue = true);                                                        ///< Set/unset all slice bits at once.
+    //
+    explicit operator std::uint64_t() const;                                                ///< Get the integer equivalent of slice's content.
+    explicit operator boost::dynamic_bitset<>() const;                                      ///< Get the slice's content as raw bitset.
+    //
+    std::uint64_t toUInt() const;                                                           ///< Get the integer equivalent of slice's content.
+    boost::dynamic_bitset<> toBits() const;                                                 ///< Get the slice's data as raw bitset.
+    //
+    FieldView operator()(std::size_t pMsbIdx, std::size_t pLsbIdx) const;                   ///< Access a sub-slice of bits in the slice.
+    //
+    std::uint64_t getSize() const;                                                          ///< Get the size of the slice.
+    std::uint64_t getOffset() const;                                                        ///< \brief Get the slice's least significant bit
+                                                                                            ///  index in the viewed field.
+
+private:
+    RegField* field;            ///< Viewed register field.
+    std::uint64_t lsbIdx;       ///< Field-local bit number of the slice's least significant bit.
+    std::uint64_t size;         ///< Size of the slice in number of bits.
+    //
+    /// \cond INTERNAL
+    /*!
+     * \brief Let RegField create views of its slices.
+     *
+     * See RegField::view().
+     */
+    friend class StandardRegister::RegField;
+    /// \endcond INTERNAL
 };
 
 } // namespace Layers::RL
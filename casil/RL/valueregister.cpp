@@ -0,0 +1,354 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/RL/valueregister.h>
+
+#include <stdexcept>
+#include <utility>
+
+using casil::Layers::RL::ValueRegister;
+
+CASIL_REGISTER_REGISTER_CPP(ValueRegister)
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Wraps the value register with name given by the "register" configuration key (required)
+ * of \p pDriver, which must be a HL::RegisterDriver.
+ *
+ * The cache policy can be set via the "cache_policy" configuration key as one of "write_through" (default),
+ * "write_back" or "read_cache" (see CachePolicy). For "read_cache" the cache lifetime of read values
+ * must be set via the "ttl" configuration key (in milliseconds; otherwise ignored).
+ *
+ * \throws std::runtime_error If \p pDriver is not a HL::RegisterDriver.
+ * \throws std::runtime_error If the cache policy is invalid or the TTL is zero for "read_cache".
+ * \throws std::invalid_argument If the driver has no register with the configured name.
+ *
+ * \param pName Component instance name.
+ * \param pDriver %Driver instance to be used.
+ * \param pConfig Component configuration.
+ */
+ValueRegister::ValueRegister(std::string pName, HL::Driver& pDriver, LayerConfig pConfig) :
+    Register(typeName, std::move(pName), pDriver, std::move(pConfig), LayerConfig::fromYAML("{register: string}")),
+    regDriver(
+        [this]() -> HL::RegisterDriver&
+        {
+            HL::RegisterDriver* const tRegDriver = dynamic_cast<HL::RegisterDriver*>(&driver);
+
+            if (!tRegDriver)
+                throw std::runtime_error("The driver used by " + getSelfDescription() + " is not a register driver.");
+
+            return *tRegDriver;
+        }()),
+    regName(config.getStr("register")),
+    cachePolicy(parseCachePolicy(config.getStr("cache_policy", "write_through"))),
+    ttl(config.getUInt("ttl", 0)),
+    cacheMutex(),
+    cachedValue(0),
+    cached(false),
+    dirty(false),
+    cacheTime(),
+    cacheHits(0),
+    driverReads(0),
+    driverWrites(0)
+{
+    if (cachePolicy == CachePolicy::ReadCache && ttl.count() == 0)
+        throw std::runtime_error("Cache policy \"read_cache\" requires a non-zero \"ttl\" for " + getSelfDescription() + ".");
+
+    (void)regDriver.testRegisterName(regName);
+}
+
+//Public
+
+/*!
+ * \brief Get the register value (from the cache if possible).
+ *
+ * Returns the cached value if it is valid (see isCached()) and reads the value
+ * from the driver otherwise (see fetch()), which then updates the cache.
+ *
+ * \return The register value.
+ */
+std::uint64_t ValueRegister::get()
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    if (cacheValid())
+    {
+        ++cacheHits;
+        return cachedValue;
+    }
+
+    cachedValue = regDriver.getValue(regName);
+    cached = true;
+    cacheTime = std::chrono::steady_clock::now();
+    ++driverReads;
+
+    return cachedValue;
+}
+
+/*!
+ * \brief Read the register value from the driver and update the cache.
+ *
+ * Bypasses the cache for reading. A pending write-back value (see isDirty()) is written first.
+ *
+ * \return The register value.
+ */
+std::uint64_t ValueRegister::fetch()
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    flushImpl();
+
+    cachedValue = regDriver.getValue(regName);
+    cached = true;
+    cacheTime = std::chrono::steady_clock::now();
+    ++driverReads;
+
+    return cachedValue;
+}
+
+/*!
+ * \brief Set the register value (according to the cache policy).
+ *
+ * For CachePolicy::WriteThrough the value is written to the driver and cached.
+ * For CachePolicy::WriteBack the value is only cached and marked as pending (see flush()).
+ * For CachePolicy::ReadCache the value is written to the driver and the cache is discarded.
+ *
+ * \param pValue The new register value.
+ */
+void ValueRegister::set(const std::uint64_t pValue)
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    if (cachePolicy == CachePolicy::WriteBack)
+    {
+        cachedValue = pValue;
+        cached = true;
+        dirty = true;
+        return;
+    }
+
+    regDriver.setValue(regName, pValue);
+    ++driverWrites;
+
+    cachedValue = pValue;
+    cached = (cachePolicy == CachePolicy::WriteThrough);
+}
+
+/*!
+ * \brief Write a pending (write-back) value to the driver.
+ *
+ * Does nothing if no value is pending (see isDirty()).
+ */
+void ValueRegister::flush()
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    flushImpl();
+}
+
+/*!
+ * \brief Discard the cached value.
+ *
+ * The next get() reads from the driver. Note that a pending write-back value (see isDirty()) is discarded as well.
+ */
+void ValueRegister::invalidate()
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    cached = false;
+    dirty = false;
+}
+
+//
+
+/*!
+ * \brief Check if a valid value is cached.
+ *
+ * \return If get() would be served from the cache.
+ */
+bool ValueRegister::isCached() const
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    return cacheValid();
+}
+
+/*!
+ * \brief Check if a written value is still pending (write-back).
+ *
+ * \return If a set() value has not been written to the driver yet.
+ */
+bool ValueRegister::isDirty() const
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    return dirty;
+}
+
+//
+
+/*!
+ * \brief Get the configured cache policy.
+ *
+ * \return Cache policy.
+ */
+ValueRegister::CachePolicy ValueRegister::getCachePolicy() const
+{
+    return cachePolicy;
+}
+
+/*!
+ * \brief Get the configured cache lifetime of read values.
+ *
+ * \return TTL for CachePolicy::ReadCache (zero if not configured).
+ */
+std::chrono::milliseconds ValueRegister::getTTL() const
+{
+    return ttl;
+}
+
+/*!
+ * \brief Get the name of the wrapped driver register.
+ *
+ * \return Driver register name.
+ */
+const std::string& ValueRegister::getRegisterName() const
+{
+    return regName;
+}
+
+//
+
+/*!
+ * \brief Get the cache counters.
+ *
+ * \return Current counter values.
+ */
+ValueRegister::Statistics ValueRegister::getStatistics() const
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    return Statistics{.cacheHits = cacheHits, .driverReads = driverReads, .driverWrites = driverWrites};
+}
+
+//Private
+
+/*!
+ * \copybrief Register::initImpl()
+ *
+ * Discards the cached value (see invalidate()).
+ *
+ * \return True.
+ */
+bool ValueRegister::initImpl()
+{
+    invalidate();
+
+    return true;
+}
+
+/*!
+ * \copybrief Register::closeImpl()
+ *
+ * Writes a pending write-back value to the driver (see flush()).
+ *
+ * \return True if successful.
+ */
+bool ValueRegister::closeImpl()
+{
+    try
+    {
+        flush();
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Check if the cached value is valid (without locking).
+ *
+ * \return If a value is cached and (for CachePolicy::ReadCache) not older than the TTL.
+ */
+bool ValueRegister::cacheValid() const
+{
+    if (!cached)
+        return false;
+
+    if (cachePolicy == CachePolicy::ReadCache)
+        return std::chrono::steady_clock::now() - cacheTime < ttl;
+
+    return true;
+}
+
+/*!
+ * \brief Write a pending value to the driver (without locking).
+ */
+void ValueRegister::flushImpl()
+{
+    if (!dirty)
+        return;
+
+    regDriver.setValue(regName, cachedValue);
+    ++driverWrites;
+
+    dirty = false;
+}
+
+//
+
+/*!
+ * \brief Convert a cache policy string to CachePolicy.
+ *
+ * \throws std::runtime_error If \p pPolicy is none of "write_through", "write_back" or "read_cache".
+ *
+ * \param pPolicy Cache policy string.
+ * \return Corresponding cache policy.
+ */
+ValueRegister::CachePolicy ValueRegister::parseCachePolicy(const std::string& pPolicy)
+{
+    if (pPolicy == "write_through")
+        return CachePolicy::WriteThrough;
+    else if (pPolicy == "write_back")
+        return CachePolicy::WriteBack;
+    else if (pPolicy == "read_cache")
+        return CachePolicy::ReadCache;
+    else
+        throw std::runtime_error("Invalid register cache policy: \"" + pPolicy + "\".");
+}
@@ -0,0 +1,131 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_RL_VALUEREGISTER_H
+#define CASIL_LAYERS_RL_VALUEREGISTER_H
+
+#include <casil/RL/register.h>
+
+#include <casil/layerconfig.h>
+#include <casil/layerfactorymacros.h>
+#include <casil/HL/driver.h>
+#include <casil/HL/registerdriver.h>
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace casil
+{
+
+namespace Layers::RL
+{
+
+/*!
+ * \brief %Register that wraps a single value register of a RegisterDriver and caches its content.
+ *
+ * Provides typed (integer) access to one HL::RegisterDriver register (see HL::RegisterDriver::getValue() and
+ * HL::RegisterDriver::setValue()), but keeps the last known register value and serves reads from it
+ * according to a configurable CachePolicy, such that frequently read but slowly changing values
+ * (e.g. temperatures, DAC settings) do not need a bus access on every get().
+ *
+ * In contrast to the shadow memory of HL::RegisterDriver, which is module-wide and never expires,
+ * the cache of a %ValueRegister can expire after a configurable time (TTL) and can defer writes (write-back).
+ *
+ * See ValueRegister() for the configuration and getStatistics() for cache counters.
+ */
+class ValueRegister final : public Register
+{
+public:
+    /*!
+     * \brief Strategy for keeping the cached value and the driver register in sync.
+     */
+    enum class CachePolicy : std::uint8_t
+    {
+        WriteThrough = 0,   ///< set() writes to the driver immediately and updates the cache; cached values never expire.
+        WriteBack = 1,      ///< set() only updates the cache; flush() (or close()) writes it to the driver; cached values never expire.
+        ReadCache = 2       ///< set() writes to the driver and discards the cache; read values are only cached for the TTL.
+    };
+    /*!
+     * \brief Snapshot of the cache counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t cacheHits;    ///< Number of get() calls served from the cache.
+        std::uint64_t driverReads;  ///< Number of register reads from the driver.
+        std::uint64_t driverWrites; ///< Number of register writes to the driver.
+    };
+
+public:
+    ValueRegister(std::string pName, HL::Driver& pDriver, LayerConfig pConfig);     ///< Constructor.
+    ~ValueRegister() override = default;                                            ///< Default destructor.
+    //
+    std::uint64_t get();                                    ///< Get the register value (from the cache if possible).
+    std::uint64_t fetch();                                  ///< Read the register value from the driver and update the cache.
+    void set(std::uint64_t pValue);                         ///< Set the register value (according to the cache policy).
+    void flush();                                           ///< Write a pending (write-back) value to the driver.
+    void invalidate();                                      ///< Discard the cached value.
+    //
+    bool isCached() const;                                  ///< Check if a valid value is cached.
+    bool isDirty() const;                                   ///< Check if a written value is still pending (write-back).
+    //
+    CachePolicy getCachePolicy() const;                     ///< Get the configured cache policy.
+    std::chrono::milliseconds getTTL() const;               ///< Get the configured cache lifetime of read values.
+    const std::string& getRegisterName() const;             ///< Get the name of the wrapped driver register.
+    //
+    Statistics getStatistics() const;                       ///< Get the cache counters.
+
+private:
+    bool initImpl() override;
+    bool closeImpl() override;
+    //
+    bool cacheValid() const;                                ///< Check if the cached value is valid (without locking).
+    void flushImpl();                                       ///< Write a pending value to the driver (without locking).
+    //
+    static CachePolicy parseCachePolicy(const std::string& pPolicy);    ///< Convert a cache policy string to CachePolicy.
+
+private:
+    HL::RegisterDriver& regDriver;                          ///< The used driver as register driver.
+    const std::string regName;                              ///< Name of the wrapped driver register.
+    const CachePolicy cachePolicy;                          ///< \copybrief getCachePolicy()
+    const std::chrono::milliseconds ttl;                    ///< \copybrief getTTL()
+    //
+    mutable std::mutex cacheMutex;                          ///< Protects the cache state.
+    std::uint64_t cachedValue;                              ///< Last known register value.
+    bool cached;                                            ///< Whether \ref cachedValue is known.
+    bool dirty;                                             ///< Whether \ref cachedValue still needs to be written.
+    std::chrono::steady_clock::time_point cacheTime;        ///< Time of the last driver read (for TTL expiry).
+    //
+    std::uint64_t cacheHits;                                ///< See Statistics::cacheHits.
+    std::uint64_t driverReads;                              ///< See Statistics::driverReads.
+    std::uint64_t driverWrites;                             ///< See Statistics::driverWrites.
+
+    CASIL_REGISTER_REGISTER_H("ValueRegister")
+};
+
+} // namespace Layers::RL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_RL_VALUEREGISTER_H
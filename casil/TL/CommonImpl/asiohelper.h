@@ -24,16 +24,31 @@
 #ifndef CASIL_LAYERS_TL_COMMONIMPL_ASIOHELPER_ASIOHELPER_H
 #define CASIL_LAYERS_TL_COMMONIMPL_ASIOHELPER_ASIOHELPER_H
 
+#include <casil/asio.h>
+
+#include <utility>  //Missing include in boost/asio/awaitable.hpp of some Boost versions
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/use_future.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ip/udp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
 #include <boost/system/errc.hpp>
 #include <boost/system/error_code.hpp>
+#include <boost/system/system_error.hpp>
 
 #include <chrono>
 #include <cstddef>
 #include <concepts>
 #include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 
@@ -57,15 +72,16 @@ namespace ASIOHelper
 {
 
 /*!
- * \brief Check if type is either a Boost %ASIO %TCP socket or a Boost %ASIO %UDP socket.
+ * \brief Check if type is a Boost %ASIO %TCP socket, a Boost %ASIO %UDP socket or a Boost %ASIO local stream socket.
  *
  * \tparam SocketT Type to be checked.
  */
 template<typename SocketT>
-concept IsSocket = (std::same_as<SocketT, boost::asio::ip::tcp::socket> || std::same_as<SocketT, boost::asio::ip::udp::socket>);
+concept IsSocket = (std::same_as<SocketT, boost::asio::ip::tcp::socket> || std::same_as<SocketT, boost::asio::ip::udp::socket> ||
+                    std::same_as<SocketT, boost::asio::local::stream_protocol::socket>);
 
 /*!
- * \brief Check if a Boost %ASIO %TCP or %UDP socket has a \c cancel() function with \c void return type.
+ * \brief Check if a Boost %ASIO %TCP, %UDP or local stream socket has a \c cancel() function with \c void return type.
  *
  * \tparam SocketT Type to be checked.
  */
@@ -89,10 +105,43 @@ std::size_t getAsyncTransferredWithTimedOutCancel(std::promise<std::size_t>& pPr
                                                                             ///< \brief Wait for the promised future, get and return its value;
                                                                             ///  cancel the socket on timeout but return future's value anyway.
 
+template<typename SocketT, typename InitiationT>
+    requires IsCancellableSocket<SocketT>
+boost::asio::awaitable<std::size_t> awaitTransferredWithTimedOutCancel(InitiationT pInitiation, SocketT& pSocket,
+                                                                       std::chrono::milliseconds pTimeout,
+                                                                       std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                            ///< \brief Await a transfer operation and return the transferred
+                                                                            ///  bytes; cancel the socket on timeout but return anyway.
+
+template<typename SocketT, typename InitiationT>
+    requires IsCancellableSocket<SocketT>
+std::size_t runTransferWithTimedOutCancel(InitiationT pInitiation, SocketT& pSocket, boost::asio::io_context& pIOContext,
+                                          std::chrono::milliseconds pTimeout, std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                            ///< \brief Perform a transfer operation and return the transferred
+                                                                            ///  bytes; cancel the socket on timeout but return anyway.
+
 void readWriteHandler(const boost::system::error_code& pErrorCode, std::size_t pNumBytes, std::promise<std::size_t>& pNumBytesPromise);
                                                                             ///< \brief Handler for socket transfer operations
                                                                             ///  that does not fail when the socket gets cancelled.
 
+/*!
+ * \brief Shared state between awaitTransferredWithTimedOutCancel() and its timeout timer handler.
+ */
+struct TimedOutCancelState
+{
+    explicit TimedOutCancelState(const boost::asio::steady_timer::executor_type& pExecutor) :
+        timer(pExecutor),
+        mutex(),
+        done(false),
+        timedOut(false)
+    {}                                      ///< Constructor.
+    //
+    boost::asio::steady_timer timer;        ///< Timer for the operation timeout.
+    std::mutex mutex;                       ///< Mutex for \ref done and \ref timedOut.
+    bool done;                              ///< Operation completed (socket must not be cancelled anymore).
+    bool timedOut;                          ///< Timer expired and socket was cancelled.
+};
+
 
 //Template function definitions
 
@@ -113,7 +162,7 @@ void readWriteHandler(const boost::system::error_code& pErrorCode, std::size_t p
  * \throws boost::system::system_error If the handler throwed such an exception (other than from cancelling after timeout).
  *
  * \tparam ReturnT Return type of the handled operation (which is wrapped in \p pFuture).
- * \tparam SocketT Type of the socket (either %TCP or %UDP socket from the Boost %ASIO library).
+ * \tparam SocketT Type of the socket (%TCP, %UDP or local stream socket from the Boost %ASIO library).
  * \param pFuture The future returned from initiating the async operation.
  * \param pSocket The socket on which the operation is performed.
  * \param pTimeout The timeout for the handled operation.
@@ -178,7 +227,7 @@ ReturnT getAsyncBoostFutureWithTimedOutCancel(std::future<ReturnT>& pFuture, Soc
  *
  * \throws std::invalid_argument If \p pPromiseN has no shared state or already stores a value/exception.
  *
- * \tparam SocketT Type of the socket (either %TCP or %UDP socket from the Boost %ASIO library).
+ * \tparam SocketT Type of the socket (%TCP, %UDP or local stream socket from the Boost %ASIO library).
  * \param pPromiseN The transferred bytes promise from the handler readWriteHandler().
  * \param pSocket The socket on which the operation is performed.
  * \param pTimeout The timeout for the handled operation.
@@ -225,6 +274,145 @@ std::size_t getAsyncTransferredWithTimedOutCancel(std::promise<std::size_t>& pPr
         throw std::runtime_error("Deferred future. THIS SHOULD NEVER HAPPEN!");
 }
 
+/*!
+ * \brief Await a transfer operation and return the transferred bytes; cancel the socket on timeout but return anyway.
+ *
+ * This is the coroutine equivalent of getAsyncTransferredWithTimedOutCancel(). It initiates an asynchronous transfer operation
+ * on a socket \p pSocket by calling \p pInitiation with a \c boost::asio::use_awaitable based completion token, awaits its
+ * completion and returns the number of transferred bytes. Instead of blocking a thread on a future, a timer on the executor
+ * of the calling coroutine cancels \p pSocket after \p pTimeout (if \p pTimeout is non-zero) while the operation is still
+ * pending, in which case \p pTimedOut will be set to true (if defined). Like readWriteHandler(), a \e cancelled error code
+ * is treated as successful outcome, such that the already transferred bytes are returned after a timeout.
+ *
+ * \p pInitiation must be callable with a completion token and return the awaitable of the operation, e.g.
+ * <tt>[&](auto&& pToken) { return pSocket.async_receive(buffer, std::forward<decltype(pToken)>(pToken)); }</tt>.
+ *
+ * Note that \p pTimedOut is always set to false in the beginning, if defined.
+ *
+ * \throws boost::system::system_error If the operation failed (other than from cancelling after timeout).
+ *
+ * \tparam SocketT Type of the socket (%TCP, %UDP or local stream socket from the Boost %ASIO library).
+ * \tparam InitiationT Type of the callable that initiates the operation.
+ * \param pInitiation Callable that initiates the async operation for a given completion token.
+ * \param pSocket The socket on which the operation is performed.
+ * \param pTimeout The timeout for the handled operation.
+ * \param pTimedOut Whether \p pTimeout was reached (i.e. \p pSocket cancelled and transferred bytes maybe less than expected).
+ * \return Number of successfully transferred bytes.
+ */
+template<typename SocketT, typename InitiationT>
+    requires IsCancellableSocket<SocketT>
+boost::asio::awaitable<std::size_t> awaitTransferredWithTimedOutCancel(InitiationT pInitiation, SocketT& pSocket,
+                                                                       const std::chrono::milliseconds pTimeout,
+                                                                       const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    if (pTimedOut.has_value())
+        pTimedOut->get() = false;
+
+    boost::system::error_code errorCode;
+    std::size_t n = 0;
+
+    if (pTimeout <= std::chrono::milliseconds::zero())
+        n = co_await pInitiation(boost::asio::redirect_error(boost::asio::use_awaitable, errorCode));
+    else
+    {
+        //Timer handler may still be pending after completion of the operation; hence use a shared state and a 'done' flag
+        const std::shared_ptr<TimedOutCancelState> state = std::make_shared<TimedOutCancelState>(co_await boost::asio::this_coro::executor);
+
+        state->timer.expires_after(pTimeout);
+        state->timer.async_wait([state, &pSocket](const boost::system::error_code& pTimerErrorCode)
+                                {
+                                    if (pTimerErrorCode.value() != boost::system::errc::success)
+                                        return;
+
+                                    const std::lock_guard<std::mutex> stateLock(state->mutex);
+                                    (void)stateLock;
+
+                                    if (state->done)
+                                        return;
+
+                                    state->timedOut = true;
+
+                                    boost::system::error_code cancelErrorCode;
+                                    pSocket.cancel(cancelErrorCode);
+                                });
+
+        n = co_await pInitiation(boost::asio::redirect_error(boost::asio::use_awaitable, errorCode));
+
+        {
+            const std::lock_guard<std::mutex> stateLock(state->mutex);
+            (void)stateLock;
+
+            state->done = true;
+
+            if (state->timedOut && pTimedOut.has_value())
+                pTimedOut->get() = true;
+        }
+
+        state->timer.cancel();
+    }
+
+    if (errorCode.value() != boost::system::errc::success && errorCode.value() != boost::system::errc::operation_canceled)
+        throw boost::system::system_error(errorCode);
+
+    co_return n;
+}
+
+/*!
+ * \brief Perform a transfer operation and return the transferred bytes; cancel the socket on timeout but return anyway.
+ *
+ * Blocking equivalent of awaitTransferredWithTimedOutCancel(), which replaces the combination of readWriteHandler()
+ * and getAsyncTransferredWithTimedOutCancel(): The operation initiated by \p pInitiation (see awaitTransferredWithTimedOutCancel())
+ * is spawned as coroutine on the executor of \p pSocket and the calling thread waits until it completed. The timeout is
+ * handled by a timer on the IO context, i.e. the cancellation of \p pSocket after \p pTimeout (if \p pTimeout is non-zero)
+ * does not involve the waiting thread. If the timeout is reached, \p pTimedOut will be set to true (if defined).
+ *
+ * If no IO context threads are running (see ASIO::ioContextThreadsRunning()), the calling thread runs the IO context of
+ * \p pSocket (\p pIOContext) by itself until the operation completed, such that no extra threads are required.
+ *
+ * Note that \p pTimedOut is always set to false in the beginning, if defined.
+ *
+ * \throws boost::system::system_error If the operation failed (other than from cancelling after timeout).
+ *
+ * \tparam SocketT Type of the socket (%TCP, %UDP or local stream socket from the Boost %ASIO library).
+ * \tparam InitiationT Type of the callable that initiates the operation.
+ * \param pInitiation Callable that initiates the async operation for a given completion token.
+ * \param pSocket The socket on which the operation is performed.
+ * \param pIOContext The IO context used by \p pSocket.
+ * \param pTimeout The timeout for the handled operation.
+ * \param pTimedOut Whether \p pTimeout was reached (i.e. \p pSocket cancelled and transferred bytes maybe less than expected).
+ * \return Number of successfully transferred bytes.
+ */
+template<typename SocketT, typename InitiationT>
+    requires IsCancellableSocket<SocketT>
+std::size_t runTransferWithTimedOutCancel(InitiationT pInitiation, SocketT& pSocket, boost::asio::io_context& pIOContext,
+                                          const std::chrono::milliseconds pTimeout, const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    if (pTimedOut.has_value())
+        pTimedOut->get() = false;
+
+    std::future<std::size_t> futureN = boost::asio::co_spawn(pSocket.get_executor(),
+                                                             [&pInitiation, &pSocket, pTimeout, pTimedOut]()
+                                                             {
+                                                                 return awaitTransferredWithTimedOutCancel(pInitiation, pSocket,
+                                                                                                           pTimeout, pTimedOut);
+                                                             },
+                                                             boost::asio::use_future);
+
+    if (!ASIO::ioContextThreadsRunning())
+    {
+        if (pIOContext.stopped())
+            pIOContext.restart();
+
+        while (futureN.wait_for(std::chrono::milliseconds::zero()) != std::future_status::ready)
+        {
+            if (pIOContext.run_one() == 0)
+                throw std::runtime_error("IO context ran out of work. THIS SHOULD NEVER HAPPEN!");
+        }
+    }
+
+    return futureN.get();   //This may throw an exception
+}
+
 } // namespace ASIOHelper
 
 } // namespace CommonImpl
@@ -0,0 +1,219 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/CommonImpl/endpointcache.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <utility>
+
+/// \cond INTERNAL
+
+using casil::Layers::TL::CommonImpl::EndpointCache;
+
+namespace
+{
+
+/*
+ * Cached endpoints of one host name and port together with their expiry time.
+ */
+template<typename ProtocolT>
+struct CacheEntry
+{
+    typename ProtocolT::resolver::results_type endpoints;
+    std::chrono::steady_clock::time_point expiry;
+};
+
+using CacheKey = std::pair<std::string, int>;
+
+std::mutex cacheMutex;                                                          //Guards the caches and the time to live
+std::map<CacheKey, CacheEntry<boost::asio::ip::tcp>> tcpCache;                  //Cached TCP endpoints
+std::map<CacheKey, CacheEntry<boost::asio::ip::udp>> udpCache;                  //Cached UDP endpoints
+std::chrono::milliseconds timeToLive = EndpointCache::defaultTimeToLive;        //See EndpointCache::setTimeToLive()
+
+std::atomic_uint64_t cacheHits {0};     //See EndpointCache::Statistics::hits
+std::atomic_uint64_t cacheMisses {0};   //See EndpointCache::Statistics::misses
+
+/*
+ * Returns the non-expired endpoints for 'pHostName'/'pPort' from 'pCache' or resolves them (without holding
+ * the cache lock) and stores them in 'pCache' if the time to live is positive. Resolver exceptions are propagated.
+ */
+template<typename ProtocolT>
+typename ProtocolT::resolver::results_type resolveCached(std::map<CacheKey, CacheEntry<ProtocolT>>& pCache,
+                                                         boost::asio::io_context& pIOContext, const std::string& pHostName, const int pPort)
+{
+    const CacheKey key(pHostName, pPort);
+
+    {
+        const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+        (void)cacheLock;
+
+        const auto it = pCache.find(key);
+
+        if (it != pCache.end() && std::chrono::steady_clock::now() < it->second.expiry)
+        {
+            cacheHits.fetch_add(1, std::memory_order_relaxed);
+            return it->second.endpoints;
+        }
+    }
+
+    cacheMisses.fetch_add(1, std::memory_order_relaxed);
+
+    typename ProtocolT::resolver resolver(pIOContext);
+
+    typename ProtocolT::resolver::results_type endpoints = resolver.resolve(pHostName, std::to_string(pPort));
+
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    if (timeToLive > std::chrono::milliseconds::zero())
+        pCache.insert_or_assign(key, CacheEntry<ProtocolT>{endpoints, std::chrono::steady_clock::now() + timeToLive});
+
+    return endpoints;
+}
+
+} // namespace
+
+//Public
+
+/*!
+ * \brief Get the %TCP endpoints for a host name and port.
+ *
+ * Returns the cached endpoints if they have not expired yet. Otherwise resolves \p pHostName and \p pPort
+ * (using a resolver on \p pIOContext) and caches the result (unless the time to live is zero).
+ *
+ * \throws boost::system::system_error If resolving the host name fails.
+ *
+ * \param pIOContext IO context for the resolver.
+ * \param pHostName Host name of the remote endpoint.
+ * \param pPort Network port.
+ * \return Resolved endpoints.
+ */
+boost::asio::ip::tcp::resolver::results_type EndpointCache::resolveTCP(boost::asio::io_context& pIOContext,
+                                                                       const std::string& pHostName, const int pPort)
+{
+    return resolveCached(tcpCache, pIOContext, pHostName, pPort);
+}
+
+/*!
+ * \brief Get the %UDP endpoints for a host name and port.
+ *
+ * Returns the cached endpoints if they have not expired yet. Otherwise resolves \p pHostName and \p pPort
+ * (using a resolver on \p pIOContext) and caches the result (unless the time to live is zero).
+ *
+ * \throws boost::system::system_error If resolving the host name fails.
+ *
+ * \param pIOContext IO context for the resolver.
+ * \param pHostName Host name of the remote endpoint.
+ * \param pPort Network port.
+ * \return Resolved endpoints.
+ */
+boost::asio::ip::udp::resolver::results_type EndpointCache::resolveUDP(boost::asio::io_context& pIOContext,
+                                                                       const std::string& pHostName, const int pPort)
+{
+    return resolveCached(udpCache, pIOContext, pHostName, pPort);
+}
+
+//
+
+/*!
+ * \brief Remove the cached endpoints of a host name and port.
+ *
+ * Removes both the %TCP and the %UDP endpoints, such that the next lookup resolves the host name again.
+ *
+ * \param pHostName Host name of the remote endpoint.
+ * \param pPort Network port.
+ */
+void EndpointCache::invalidate(const std::string& pHostName, const int pPort)
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    const CacheKey key(pHostName, pPort);
+
+    tcpCache.erase(key);
+    udpCache.erase(key);
+}
+
+/*!
+ * \brief Remove all cached endpoints.
+ */
+void EndpointCache::clear()
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    tcpCache.clear();
+    udpCache.clear();
+}
+
+//
+
+/*!
+ * \brief Get the time to live of cached endpoints.
+ *
+ * \return Time after which cached endpoints are resolved again.
+ */
+std::chrono::milliseconds EndpointCache::getTimeToLive()
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    return timeToLive;
+}
+
+/*!
+ * \brief Set the time to live of cached endpoints.
+ *
+ * Applies to endpoints resolved afterwards. A non-positive value disables caching (already cached endpoints are removed).
+ *
+ * \param pTimeToLive Time after which cached endpoints are resolved again.
+ */
+void EndpointCache::setTimeToLive(const std::chrono::milliseconds pTimeToLive)
+{
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    timeToLive = pTimeToLive;
+
+    if (timeToLive <= std::chrono::milliseconds::zero())
+    {
+        tcpCache.clear();
+        udpCache.clear();
+    }
+}
+
+//
+
+/*!
+ * \brief Get the current process-wide cache counters.
+ *
+ * \return Counters of all lookups.
+ */
+EndpointCache::Statistics EndpointCache::getStatistics()
+{
+    return Statistics{.hits = cacheHits.load(std::memory_order_relaxed), .misses = cacheMisses.load(std::memory_order_relaxed)};
+}
+
+/// \endcond INTERNAL
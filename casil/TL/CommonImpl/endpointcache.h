@@ -0,0 +1,98 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_COMMONIMPL_ENDPOINTCACHE_H
+#define CASIL_LAYERS_TL_COMMONIMPL_ENDPOINTCACHE_H
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/// \cond INTERNAL
+namespace CommonImpl
+{
+
+/*!
+ * \brief Process-wide cache of resolved network endpoints.
+ *
+ * Resolving a host name synchronously can take a significant amount of time (depending on the system's resolver),
+ * which would otherwise be spent again by every socket wrapper that connects to the same host/port and on every
+ * re-initialization. Successfully resolved endpoints are therefore kept for a configurable time to live
+ * (see setTimeToLive(); default: \ref defaultTimeToLive) and returned directly by resolveTCP() / resolveUDP()
+ * until they expire. Failed resolutions are never cached.
+ *
+ * %TCP and %UDP endpoints are cached separately. All functions are thread-safe. The resolver itself is not called
+ * while holding the cache lock, such that concurrent resolutions of different host names do not block each other.
+ */
+class EndpointCache
+{
+public:
+    /*!
+     * \brief Snapshot of the process-wide cache counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t hits;     ///< Number of lookups answered from the cache.
+        std::uint64_t misses;   ///< Number of lookups that had to call the resolver.
+    };
+
+public:
+    EndpointCache() = delete;                                               ///< Deleted constructor.
+    //
+    static boost::asio::ip::tcp::resolver::results_type resolveTCP(boost::asio::io_context& pIOContext,
+                                                                   const std::string& pHostName, int pPort);
+                                                                            ///< Get the %TCP endpoints for a host name and port.
+    static boost::asio::ip::udp::resolver::results_type resolveUDP(boost::asio::io_context& pIOContext,
+                                                                   const std::string& pHostName, int pPort);
+                                                                            ///< Get the %UDP endpoints for a host name and port.
+    //
+    static void invalidate(const std::string& pHostName, int pPort);        ///< Remove the cached endpoints of a host name and port.
+    static void clear();                                                    ///< Remove all cached endpoints.
+    //
+    static std::chrono::milliseconds getTimeToLive();                       ///< Get the time to live of cached endpoints.
+    static void setTimeToLive(std::chrono::milliseconds pTimeToLive);       ///< Set the time to live of cached endpoints.
+    //
+    static Statistics getStatistics();                                      ///< Get the current process-wide cache counters.
+
+public:
+    static constexpr std::chrono::milliseconds defaultTimeToLive = std::chrono::seconds(60);   ///< Default time to live of cached endpoints.
+};
+
+} // namespace CommonImpl
+/// \endcond INTERNAL
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_COMMONIMPL_ENDPOINTCACHE_H
@@ -0,0 +1,282 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/CommonImpl/eventlistener.h>
+
+#include <casil/asio.h>
+#include <casil/logger.h>
+#include <casil/TL/CommonImpl/endpointcache.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+/// \cond INTERNAL
+
+using casil::Layers::TL::CommonImpl::EventListener;
+
+/*!
+ * \brief Constructor.
+ *
+ * Note: Initializes the socket using a new strand of \p pIOContext (see ASIO::getIOContext(int)),
+ * such that the asynchronous handlers of this socket never run concurrently.
+ *
+ * \param pHostName Host name of the remote endpoint to accept notifications from.
+ * \param pPort Local network port to listen on.
+ * \param pIOContext IO context to be used for the socket.
+ */
+EventListener::EventListener(std::string pHostName, const int pPort, boost::asio::io_context& pIOContext) :
+    hostName(std::move(pHostName)),
+    port(pPort),
+    ioContext(pIOContext),
+    socket(boost::asio::make_strand(ioContext)),
+    senderEndpoint(),
+    acceptedAddresses(),
+    receiveBuffer(maxDatagramSize, 0),
+    handler(),
+    asyncMutex(),
+    enabled(false),
+    stopped(true),
+    errorCount(0),
+    discardedCount(0)
+{
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops the reception if still active (see stop()).
+ */
+EventListener::~EventListener()
+{
+    try
+    {
+        stop();
+    }
+    catch (const std::runtime_error& exc)
+    {
+        Logger::logError(std::string("Could not stop event listener: ") + exc.what());
+    }
+}
+
+//Public
+
+/*!
+ * \brief Bind the socket and start receiving event notifications.
+ *
+ * Resolves the configured host name (via the process-wide EndpointCache) to determine the accepted sender addresses,
+ * binds the socket to the configured local port and starts a chain of asynchronous receives that passes every
+ * valid notification to \p pHandler (see EventListener). \p pHandler is called from an IO context thread and
+ * should hence return quickly. Exceptions thrown by \p pHandler are logged.
+ *
+ * The chain stops when stopped explicitly (see stop()) or as soon as the receive error count exceeds a fixed
+ * maximum threshold (see \ref maxErrorCount). Errors are logged (see Logger).
+ *
+ * \throws std::runtime_error If no IO context threads are running (see ASIO::ioContextThreadsRunning()).
+ * \throws std::runtime_error If the reception is already active.
+ * \throws std::runtime_error If resolving the host name or binding the socket fails.
+ *
+ * \param pHandler Handler for the received notifications.
+ */
+void EventListener::start(EventHandlerType pHandler)
+{
+    if (!ASIO::ioContextThreadsRunning())
+        throw std::runtime_error("Receiving event notifications requires running at least one IO context thread.");
+
+    if (!stopped.load())
+        throw std::runtime_error("Event notification reception is already active.");
+
+    const std::lock_guard<std::mutex> asyncLock(asyncMutex);
+    (void)asyncLock;
+
+    try
+    {
+        const boost::asio::ip::udp::resolver::results_type endpoints = EndpointCache::resolveUDP(ioContext, hostName, port);
+
+        if (endpoints.empty())
+            throw std::runtime_error("Could not resolve \"" + hostName + "\".");
+
+        acceptedAddresses.clear();
+
+        for (const auto& entry : endpoints)
+            acceptedAddresses.push_back(entry.endpoint().address());
+
+        const boost::asio::ip::udp::endpoint localEndpoint(endpoints.begin()->endpoint().protocol(), static_cast<unsigned short>(port));
+
+        socket.open(localEndpoint.protocol());
+        socket.bind(localEndpoint);
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        boost::system::error_code errorCode;
+        socket.close(errorCode);
+
+        throw std::runtime_error(std::string("Exception while binding event notification socket: ") + exc.what());
+    }
+
+    handler = std::move(pHandler);
+    errorCount = 0;
+
+    enabled.store(true);
+    stopped.store(false);
+
+    issueAsyncReceive();
+}
+
+/*!
+ * \brief Stop receiving event notifications and close the socket.
+ *
+ * Disables the reception started by start(), cancels the pending receive and waits until
+ * the last handler has finished. Then closes the socket. Does nothing if the reception is not active.
+ *
+ * \throws std::runtime_error If closing the socket fails.
+ */
+void EventListener::stop()
+{
+    if (stopped.load())
+        return;
+
+    {
+        const std::lock_guard<std::mutex> asyncLock(asyncMutex);
+        (void)asyncLock;
+
+        enabled.store(false);
+
+        boost::system::error_code errorCode;
+        socket.cancel(errorCode);
+    }
+
+    stopped.wait(false);
+
+    try
+    {
+        socket.close();
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        throw std::runtime_error(std::string("Exception while closing event notification socket: ") + exc.what());
+    }
+}
+
+/*!
+ * \brief Check if event notifications are being received.
+ *
+ * \return True if the reception was started (see start()) and has not stopped yet.
+ */
+bool EventListener::isActive() const
+{
+    return !stopped.load();
+}
+
+//
+
+/*!
+ * \brief Get the number of discarded datagrams.
+ *
+ * \return Number of received datagrams that were discarded because of an unknown sender or a too short length.
+ */
+std::uint64_t EventListener::getDiscardedCount() const
+{
+    return discardedCount.load();
+}
+
+//Private
+
+/*!
+ * \brief Issue the next async receive (handler is handleAsyncReceive()).
+ *
+ * Note: \ref asyncMutex must be locked by the caller.
+ */
+void EventListener::issueAsyncReceive()
+{
+    socket.async_receive_from(boost::asio::buffer(receiveBuffer), senderEndpoint,
+                              std::bind(&EventListener::handleAsyncReceive, this, std::placeholders::_1, std::placeholders::_2));
+}
+
+/*!
+ * \brief Pass a received notification to the handler and continue receiving.
+ *
+ * Decodes the source bus address from the first 4 bytes of the \p pNumBytes received bytes (big-endian) and passes
+ * it together with the remaining bytes to the handler, if the datagram was sent by the configured remote host.
+ * Otherwise the datagram is discarded. Then issues the next receive (see issueAsyncReceive()) or, if the reception
+ * was disabled (see stop()), signals the stopped reception.
+ *
+ * If \p pErrorCode signals an error (other than the socket being cancelled), the error gets logged (see Logger)
+ * and the current error count gets incremented. The reception gets disabled automatically as soon as
+ * this error count exceeds a fixed maximum threshold (see \ref maxErrorCount).
+ *
+ * \param pErrorCode Result/error code of the handled async receive.
+ * \param pNumBytes Number of received bytes.
+ */
+void EventListener::handleAsyncReceive(const boost::system::error_code& pErrorCode, const std::size_t pNumBytes)
+{
+    if (pErrorCode.value() == boost::system::errc::success)
+    {
+        if (pNumBytes < 4 || std::find(acceptedAddresses.begin(), acceptedAddresses.end(), senderEndpoint.address()) == acceptedAddresses.end())
+            ++discardedCount;
+        else
+        {
+            const std::uint32_t sourceAddr = (static_cast<std::uint32_t>(receiveBuffer[0]) << 24) |
+                                             (static_cast<std::uint32_t>(receiveBuffer[1]) << 16) |
+                                             (static_cast<std::uint32_t>(receiveBuffer[2]) << 8) |
+                                             static_cast<std::uint32_t>(receiveBuffer[3]);
+            try
+            {
+                handler(sourceAddr, std::span<const std::uint8_t>(receiveBuffer.data() + 4, pNumBytes - 4));
+            }
+            catch (const std::exception& exc)
+            {
+                Logger::logError("Exception while handling event notification from \"" + hostName + "\": " + exc.what());
+            }
+        }
+    }
+    else if (pErrorCode.value() != boost::system::errc::operation_canceled)
+    {
+        Logger::logError("Exception while receiving event notifications on port " + std::to_string(port) + ": " + pErrorCode.message());
+
+        if (++errorCount > maxErrorCount)
+        {
+            enabled.store(false);
+            Logger::logCritical("Exceeded maximum error count while receiving event notifications on port " + std::to_string(port) +
+                                ". Stopping...");
+        }
+    }
+
+    const std::lock_guard<std::mutex> asyncLock(asyncMutex);
+    (void)asyncLock;
+
+    if (!enabled.load())
+    {
+        stopped.store(true);
+        stopped.notify_all();
+    }
+    else
+        issueAsyncReceive();
+}
+
+/// \endcond INTERNAL
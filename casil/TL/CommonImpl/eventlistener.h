@@ -0,0 +1,119 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_COMMONIMPL_EVENTLISTENER_H
+#define CASIL_LAYERS_TL_COMMONIMPL_EVENTLISTENER_H
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/// \cond INTERNAL
+namespace CommonImpl
+{
+
+/*!
+ * \brief Listener for event notification datagrams sent by firmware modules via %UDP.
+ *
+ * Binds a %UDP socket to a local port and continuously receives notification datagrams asynchronously
+ * (see start()), which firmware modules may send e.g. when a sequence has finished or a FIFO threshold is reached.
+ * Each datagram starts with the bus address of the notifying module (4 bytes, big-endian), followed by an optional
+ * module-specific payload. The address and the payload of every valid datagram are passed to a handler function.
+ *
+ * Only datagrams from the configured remote host are accepted. Datagrams from other senders and datagrams
+ * shorter than the address field are discarded (see getDiscardedCount()).
+ */
+class EventListener
+{
+public:
+    using EventHandlerType = std::function<void(std::uint32_t pSourceAddr, std::span<const std::uint8_t> pPayload)>;
+                                                                ///< Function type for handling received event notifications.
+
+public:
+    EventListener(std::string pHostName, int pPort, boost::asio::io_context& pIOContext);  ///< Constructor.
+    EventListener(const EventListener&) = delete;               ///< Deleted copy constructor.
+    EventListener(EventListener&&) = delete;                    ///< Deleted move constructor.
+    ~EventListener();                                           ///< Destructor.
+    //
+    EventListener& operator=(EventListener) = delete;           ///< Deleted copy assignment operator.
+    EventListener& operator=(EventListener&&) = delete;         ///< Deleted move assignment operator.
+    //
+    void start(EventHandlerType pHandler);                      ///< Bind the socket and start receiving event notifications.
+    void stop();                                                ///< Stop receiving event notifications and close the socket.
+    bool isActive() const;                                      ///< Check if event notifications are being received.
+    //
+    std::uint64_t getDiscardedCount() const;                    ///< Get the number of discarded datagrams.
+
+private:
+    void issueAsyncReceive();                                                               ///< \brief Issue the next async receive (handler
+                                                                                            ///  is handleAsyncReceive()).
+    void handleAsyncReceive(const boost::system::error_code& pErrorCode, std::size_t pNumBytes);
+                                                                                            ///< \brief Pass a received notification to the
+                                                                                            ///  handler and continue receiving.
+
+private:
+    const std::string hostName;                             ///< Host name of the accepted remote endpoint.
+    const int port;                                         ///< Local network port to listen on.
+    //
+    boost::asio::io_context& ioContext;                     ///< IO context used by the socket.
+    boost::asio::ip::udp::socket socket;                    ///< %UDP socket (using a strand of \ref ioContext).
+    boost::asio::ip::udp::endpoint senderEndpoint;          ///< Sender of the last received datagram.
+    std::vector<boost::asio::ip::address> acceptedAddresses;   ///< Resolved addresses of the remote host.
+    std::vector<std::uint8_t> receiveBuffer;                ///< Buffer for receiving a single datagram.
+    EventHandlerType handler;                               ///< Handler for received event notifications.
+    //
+    std::mutex asyncMutex;                                  ///< Mutex for issuing async operations vs. stopping the reception.
+    std::atomic_bool enabled;                               ///< Flag to control/stop the continuous reception.
+    std::atomic_bool stopped;                               ///< Flag to signal stopped continuous reception (last handler finished).
+    std::size_t errorCount;                                 ///< Current error count of the continuous reception.
+    std::atomic_uint64_t discardedCount;                    ///< Number of discarded datagrams.
+
+private:
+    static constexpr std::size_t maxDatagramSize = 65507;   ///< Maximum %UDP payload size.
+    static constexpr std::size_t maxErrorCount = 10;        ///< Maximum error count before the reception stops itself.
+};
+
+} // namespace CommonImpl
+/// \endcond INTERNAL
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_COMMONIMPL_EVENTLISTENER_H
@@ -0,0 +1,326 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/CommonImpl/fifofilewriter.h>
+
+#include <casil/bytes.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <ios>
+#include <stdexcept>
+#include <utility>
+
+/// \cond INTERNAL
+
+using casil::Layers::TL::CommonImpl::FIFOFileWriter;
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Note: Does not open an output file yet (see open()).
+ *
+ * \throws std::invalid_argument If \p pBasePath is empty.
+ * \throws std::invalid_argument If \p pBlockSize is smaller than 4 bytes.
+ *
+ * \param pBasePath Base path of the output files (see FIFOFileWriter).
+ * \param pBlockSize Block buffer size in bytes, i.e. the maximum chunk payload length (rounded down to a multiple of 4).
+ * \param pMaxFileSize Maximum output file size in bytes before starting the next file (no limit if zero).
+ * \param pPlacement Huge page and NUMA node options for the block buffer and the write buffer.
+ */
+FIFOFileWriter::FIFOFileWriter(std::string pBasePath, const std::size_t pBlockSize, const std::uint64_t pMaxFileSize,
+                               const MemoryPlacement pPlacement) :
+    basePath(std::move(pBasePath)),
+    blockSize(pBlockSize - pBlockSize % 4),
+    maxFileSize(pMaxFileSize),
+    block(PlacedAllocator<std::uint8_t>(pPlacement)),
+    writeBuffer(PlacedAllocator<std::uint8_t>(pPlacement)),
+    file(),
+    fileSize(0),
+    nextFileIndex(0),
+    filePath()
+{
+    if (basePath == "")
+        throw std::invalid_argument("Empty base path for FIFO data files.");
+    if (blockSize == 0)
+        throw std::invalid_argument("Block size for FIFO data files must be at least 4 bytes.");
+
+    block.reserve(blockSize + 3);
+    writeBuffer.reserve(chunkHeaderSize + blockSize + writeAlignment);
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Calls close() and ignores possible errors.
+ */
+FIFOFileWriter::~FIFOFileWriter()
+{
+    try
+    {
+        close();
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+}
+
+//Public
+
+/*!
+ * \brief Start writing to a new output file.
+ *
+ * Closes the current output file (see close()) and opens the next one.
+ *
+ * \throws std::runtime_error If closing the current or opening the new output file fails.
+ */
+void FIFOFileWriter::open()
+{
+    close();
+    openNextFile();
+}
+
+/*!
+ * \brief Write the buffered complete words and close the output file.
+ *
+ * Calls flush() and closes the current output file. Does nothing if no file is open.
+ *
+ * \throws std::runtime_error If writing or closing the file fails.
+ */
+void FIFOFileWriter::close()
+{
+    if (!file.is_open())
+        return;
+
+    flush();
+
+    file.close();
+
+    if (file.fail())
+        throw std::runtime_error("Could not close FIFO data file \"" + filePath + "\".");
+}
+
+/*!
+ * \brief Check if an output file is open.
+ *
+ * \return True if open.
+ */
+bool FIFOFileWriter::isOpen() const
+{
+    return file.is_open();
+}
+
+/*!
+ * \brief Get the path of the current (or last) output file.
+ *
+ * \return File path or empty string if no file was opened yet.
+ */
+std::string FIFOFileWriter::getFilePath() const
+{
+    return filePath;
+}
+
+//
+
+/*!
+ * \brief Append a byte sequence to the block buffer.
+ *
+ * Appends \p pBytes to the block buffer. Whenever the buffer is full, appends its complete words as a chunk
+ * to the write buffer and writes the block-aligned part of the write buffer to the output file.
+ *
+ * \throws std::runtime_error If no output file is open.
+ * \throws std::runtime_error If writing a chunk fails.
+ *
+ * \param pBytes Bytes to be written.
+ */
+void FIFOFileWriter::write(std::span<const std::uint8_t> pBytes)
+{
+    if (!file.is_open())
+        throw std::runtime_error("No open FIFO data file.");
+
+    while (!pBytes.empty())
+    {
+        const std::size_t numBytes = std::min(pBytes.size(), blockSize + 3 - block.size());
+
+        block.insert(block.end(), pBytes.begin(), pBytes.begin() + numBytes);
+        pBytes = pBytes.subspan(numBytes);
+
+        if (block.size() >= blockSize)
+        {
+            appendBlock();
+            writeBuffered(false);
+        }
+    }
+}
+
+/*!
+ * \brief Write the buffered complete words as a chunk and empty the write buffer.
+ *
+ * Appends all complete words from the block buffer as a chunk (see FIFOFileWriter) to the write buffer and writes
+ * the whole write buffer to the output file, regardless of the alignment. Keeps a possibly remaining incomplete word
+ * in the block buffer. Does nothing if there is neither a complete word nor a pending write.
+ *
+ * \throws std::runtime_error If no output file is open.
+ * \throws std::runtime_error If writing to the output file fails.
+ */
+void FIFOFileWriter::flush()
+{
+    if (block.size() < 4 && writeBuffer.empty())
+        return;
+
+    if (!file.is_open())
+        throw std::runtime_error("No open FIFO data file.");
+
+    appendBlock();
+    writeBuffered(true);
+}
+
+/*!
+ * \brief Discard leftover bytes of an incomplete word.
+ *
+ * Removes the bytes from the block buffer that do not form a complete word.
+ */
+void FIFOFileWriter::discardPartialWord()
+{
+    block.resize(block.size() - block.size() % 4);
+}
+
+//Private
+
+/*!
+ * \brief Append the buffered complete words as a chunk to the write buffer.
+ *
+ * Moves all complete words from the block buffer as a chunk to the write buffer (see appendChunk())
+ * and keeps a possibly remaining incomplete word in the block buffer. Does nothing if there is no complete word.
+ *
+ * \throws std::runtime_error If switching to a new output file fails.
+ */
+void FIFOFileWriter::appendBlock()
+{
+    const std::size_t payloadSize = block.size() - block.size() % 4;
+
+    if (payloadSize == 0)
+        return;
+
+    appendChunk(std::span<const std::uint8_t>(block.data(), payloadSize));
+
+    block.erase(block.begin(), block.begin() + payloadSize);
+}
+
+/*!
+ * \brief Append a chunk with header to the write buffer.
+ *
+ * Appends the chunk header (see FIFOFileWriter) and \p pPayload to the write buffer. Calls openNextFile()
+ * before if the chunk would exceed the maximum file size (unless the file is still empty).
+ *
+ * \throws std::runtime_error If switching to a new output file fails.
+ *
+ * \param pPayload Chunk payload.
+ */
+void FIFOFileWriter::appendChunk(const std::span<const std::uint8_t> pPayload)
+{
+    const std::uint64_t chunkSize = chunkHeaderSize + pPayload.size();
+
+    if (maxFileSize > 0 && fileSize > 0 && fileSize + chunkSize > maxFileSize)
+        openNextFile();
+
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch());
+
+    const auto header = Bytes::composeByteArray(false, chunkMagic, static_cast<std::uint32_t>(pPayload.size()),
+                                                static_cast<std::uint64_t>(timestamp.count()));
+
+    writeBuffer.insert(writeBuffer.end(), header.begin(), header.end());
+    writeBuffer.insert(writeBuffer.end(), pPayload.begin(), pPayload.end());
+
+    fileSize += chunkSize;
+}
+
+/*!
+ * \brief Write the write buffer (or its aligned part) to the output file.
+ *
+ * Writes the write buffer to the output file with a single write. If \p pAll is false, only the part of the buffer
+ * up to the last file offset that is a multiple of \ref writeAlignment is written and the remainder is kept for the
+ * next write. The written part is removed from the buffer, also if the write fails.
+ *
+ * \throws std::runtime_error If writing to the output file fails.
+ *
+ * \param pAll Write the whole buffer instead of only the aligned part.
+ */
+void FIFOFileWriter::writeBuffered(const bool pAll)
+{
+    std::size_t length = writeBuffer.size();
+
+    if (!pAll)
+    {
+        const std::uint64_t bufferOffset = fileSize - writeBuffer.size();
+        const std::uint64_t alignedEnd = fileSize - fileSize % writeAlignment;
+        length = (alignedEnd > bufferOffset ? static_cast<std::size_t>(alignedEnd - bufferOffset) : 0);
+    }
+
+    if (length == 0)
+        return;
+
+    file.write(reinterpret_cast<const char*>(writeBuffer.data()), static_cast<std::streamsize>(length));
+
+    writeBuffer.erase(writeBuffer.begin(), writeBuffer.begin() + static_cast<std::ptrdiff_t>(length));
+
+    if (!file.good())
+        throw std::runtime_error("Could not write to FIFO data file \"" + filePath + "\".");
+}
+
+/*!
+ * \brief Close the current and open the next output file.
+ *
+ * Writes the whole write buffer to the current output file before closing it.
+ * The next output file is opened for unbuffered writing.
+ *
+ * \throws std::runtime_error If writing to or closing the current or opening the next output file fails.
+ */
+void FIFOFileWriter::openNextFile()
+{
+    if (file.is_open())
+    {
+        writeBuffered(true);
+
+        file.close();
+
+        if (file.fail())
+            throw std::runtime_error("Could not close FIFO data file \"" + filePath + "\".");
+    }
+
+    filePath = std::format("{}.{:04}", basePath, nextFileIndex++);
+    fileSize = 0;
+
+    file.clear();
+    file.rdbuf()->pubsetbuf(nullptr, 0);    //Write buffer is written as a whole
+    file.open(filePath, std::ios::binary | std::ios::out | std::ios::trunc);
+
+    if (!file.is_open())
+        throw std::runtime_error("Could not open FIFO data file \"" + filePath + "\".");
+}
+
+/// \endcond INTERNAL
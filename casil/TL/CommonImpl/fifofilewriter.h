@@ -0,0 +1,129 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_COMMONIMPL_FIFOFILEWRITER_H
+#define CASIL_LAYERS_TL_COMMONIMPL_FIFOFILEWRITER_H
+
+#include <casil/memoryplacement.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/// \cond INTERNAL
+namespace CommonImpl
+{
+
+/*!
+ * \brief Block-buffered writer for streaming FIFO data words to a sequence of binary files.
+ *
+ * Collects an incoming byte stream of 32 bit FIFO data words (see write()) in a block buffer and appends the buffered
+ * complete words as one "chunk" to a write buffer as soon as the block is full (or on flush()). Leftover bytes that
+ * do not yet form a complete word are held back until completed by the following bytes.
+ *
+ * The write buffer is written to the output file with single unbuffered writes that are cut such that every write ends
+ * at a multiple of \ref writeAlignment bytes in the file (the remainder is carried over to the next write), i.e. the files
+ * are written with few large, block-aligned write operations. flush(), close() and switching to the next file write the
+ * whole write buffer regardless of the alignment.
+ *
+ * Each chunk consists of a 16 byte header followed by the payload (the FIFO data bytes in their original order):
+ *
+ * \code{.unparsed}
+ *
+ * Byte 0-3:   Magic number "CFDC" (see chunkMagic)
+ * Byte 4-7:   Payload length in bytes (32 bit, little endian; always a multiple of 4)
+ * Byte 8-15:  Time of writing the chunk (nanoseconds since Unix epoch, 64 bit, little endian)
+ * Byte 16-..: Payload
+ *
+ * \endcode
+ *
+ * The output files are named "BASE_PATH.NNNN", with the configured base path and a running, four digit file index \c NNNN
+ * (starting at 0). A new file is started by open() and whenever writing a chunk would exceed the configured maximum file size.
+ *
+ * The block buffer can be placed on huge pages and/or a specific NUMA node (see MemoryPlacement).
+ *
+ * Note: The class is not thread-safe. Users must synchronize access to this class themselves.
+ */
+class FIFOFileWriter
+{
+public:
+    FIFOFileWriter(std::string pBasePath, std::size_t pBlockSize, std::uint64_t pMaxFileSize,
+                   MemoryPlacement pPlacement = MemoryPlacement{});            ///< Constructor.
+    FIFOFileWriter(const FIFOFileWriter&) = delete;             ///< Deleted copy constructor.
+    FIFOFileWriter(FIFOFileWriter&&) = delete;                  ///< Deleted move constructor.
+    ~FIFOFileWriter();                                          ///< Destructor.
+    //
+    FIFOFileWriter& operator=(FIFOFileWriter) = delete;         ///< Deleted copy assignment operator.
+    FIFOFileWriter& operator=(FIFOFileWriter&&) = delete;       ///< Deleted move assignment operator.
+    //
+    void open();                                                ///< Start writing to a new output file.
+    void close();                                               ///< Write the buffered complete words and close the output file.
+    bool isOpen() const;                                        ///< Check if an output file is open.
+    std::string getFilePath() const;                            ///< Get the path of the current (or last) output file.
+    //
+    void write(std::span<const std::uint8_t> pBytes);           ///< Append a byte sequence to the block buffer.
+    void flush();                                               ///< Write the buffered complete words as a chunk and empty the write buffer.
+    void discardPartialWord();                                  ///< Discard leftover bytes of an incomplete word.
+
+public:
+    static constexpr std::size_t chunkHeaderSize = 16;                      ///< Size of the chunk header in bytes.
+    static constexpr std::uint32_t chunkMagic = 0x43444643u;                ///< Chunk header magic number ("CFDC" in little endian).
+    static constexpr std::size_t writeAlignment = 4096;                     ///< File offset alignment of the ends of the file writes.
+
+private:
+    void appendBlock();                                         ///< Append the buffered complete words as a chunk to the write buffer.
+    void appendChunk(std::span<const std::uint8_t> pPayload);   ///< Append a chunk with header to the write buffer.
+    void writeBuffered(bool pAll);                              ///< Write the write buffer (or its aligned part) to the output file.
+    void openNextFile();                                        ///< Close the current and open the next output file.
+
+private:
+    const std::string basePath;                                 ///< Base path of the output files.
+    const std::size_t blockSize;                                ///< Block buffer size in bytes (i.e. maximum chunk payload length).
+    const std::uint64_t maxFileSize;                            ///< Maximum output file size in bytes (no limit if zero).
+    //
+    std::vector<std::uint8_t, PlacedAllocator<std::uint8_t>> block;         ///< Block buffer.
+    std::vector<std::uint8_t, PlacedAllocator<std::uint8_t>> writeBuffer;   ///< Chunks not yet written to the output file.
+    //
+    std::ofstream file;                                         ///< Current output file.
+    std::uint64_t fileSize;                                     ///< Size of the current output file including the write buffer.
+    int nextFileIndex;                                          ///< Index for the next output file name.
+    std::string filePath;                                       ///< Path of the current (or last) output file.
+};
+
+} // namespace CommonImpl
+/// \endcond INTERNAL
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_COMMONIMPL_FIFOFILEWRITER_H
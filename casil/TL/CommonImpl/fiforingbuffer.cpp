@@ -0,0 +1,540 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/CommonImpl/fiforingbuffer.h>
+
+#include <casil/bytes.h>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+/// \cond INTERNAL
+
+using casil::Layers::TL::CommonImpl::FIFORingBuffer;
+
+/*!
+ * \brief Memory-mapped file used as word storage.
+ *
+ * Creates (or truncates) the file with the requested size, maps it completely and removes it again on destruction.
+ */
+struct FIFORingBuffer::MappedFile
+{
+    MappedFile(const std::string& pPath, const std::size_t pNumWords) :
+        path(pPath),
+        mapping(),
+        region()
+    {
+        try
+        {
+            {
+                std::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+
+                if (!file.is_open())
+                    throw std::runtime_error("Could not create FIFO buffer file \"" + path + "\".");
+            }
+
+            std::filesystem::resize_file(path, pNumWords * 4);
+
+            mapping = boost::interprocess::file_mapping(path.c_str(), boost::interprocess::read_write);
+            region = boost::interprocess::mapped_region(mapping, boost::interprocess::read_write, 0, pNumWords * 4);
+        }
+        catch (const std::filesystem::filesystem_error& exc)
+        {
+            removeFile();
+            throw std::runtime_error("Could not resize FIFO buffer file \"" + path + "\": " + exc.what());
+        }
+        catch (const boost::interprocess::interprocess_exception& exc)
+        {
+            removeFile();
+            throw std::runtime_error("Could not map FIFO buffer file \"" + path + "\": " + exc.what());
+        }
+    }
+    ~MappedFile()
+    {
+        boost::interprocess::mapped_region().swap(region);
+        boost::interprocess::file_mapping().swap(mapping);
+
+        removeFile();
+    }
+    //
+    std::span<std::uint32_t> getWords() const
+    {
+        return std::span<std::uint32_t>(static_cast<std::uint32_t*>(region.get_address()), region.get_size() / 4);
+    }
+    void removeFile() const
+    {
+        std::error_code errorCode;
+        std::filesystem::remove(path, errorCode);
+    }
+    //
+    const std::string path;                         ///< Path of the file.
+    boost::interprocess::file_mapping mapping;      ///< Mapping of the file.
+    boost::interprocess::mapped_region region;      ///< Mapped region covering the whole file.
+};
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Allocates the buffer with an initial capacity of \p pCapacity words, rounded up to the next power of two.
+ *
+ * If \p pFixedCapacity is true, the capacity will never be increased and pushBytes() and popBytes() may
+ * be used concurrently from one producer and one consumer thread without locking (see class description).
+ *
+ * If \p pBackingFilePath is not empty, the file \p pBackingFilePath is created (or truncated) with the size of the
+ * rounded capacity and mapped into memory as storage instead of allocating heap memory. The capacity is fixed
+ * then (regardless of \p pFixedCapacity). The file is removed again on destruction.
+ *
+ * Otherwise the heap storage (including reallocations when growing) uses the huge page and NUMA node options \p pPlacement.
+ *
+ * \throws std::runtime_error If the backing file cannot be created, resized or mapped.
+ *
+ * \param pCapacity Initial capacity in number of 32 bit words.
+ * \param pFixedCapacity Keep the capacity fixed (lock-free single-producer/single-consumer mode).
+ * \param pBackingFilePath Path of a file to use as memory-mapped storage (empty for heap memory).
+ * \param pPlacement Huge page and NUMA node options for the heap storage.
+ */
+FIFORingBuffer::FIFORingBuffer(const std::size_t pCapacity, const bool pFixedCapacity, const std::string& pBackingFilePath,
+                               const MemoryPlacement pPlacement) :
+    fixedCapacity(pFixedCapacity || pBackingFilePath != ""),
+    heapBuffer(pBackingFilePath == "" ? std::bit_ceil(std::max(pCapacity, std::size_t{1})) : 0, PlacedAllocator<std::uint32_t>(pPlacement)),
+    mappedFile(pBackingFilePath != "" ? std::make_unique<MappedFile>(pBackingFilePath, std::bit_ceil(std::max(pCapacity, std::size_t{1})))
+                                      : nullptr),
+    buffer(mappedFile ? mappedFile->getWords() : std::span<std::uint32_t>(heapBuffer)),
+    mask(buffer.size() - 1),
+    head(0),
+    tail(0),
+    partialWord{0, 0, 0, 0},
+    partialWordSize(0),
+    highWaterMark(0),
+    wordsPushed(0),
+    wordsPopped(0)
+{
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Unmaps and removes the backing file (if used).
+ */
+FIFORingBuffer::~FIFORingBuffer() = default;
+
+//Public
+
+/*!
+ * \brief Get the number of buffered bytes.
+ *
+ * Includes the bytes of a not yet completed word.
+ *
+ * \return Buffered bytes.
+ */
+std::size_t FIFORingBuffer::getSize() const
+{
+    return getWordCount() * 4 + partialWordSize.load(std::memory_order_acquire);
+}
+
+/*!
+ * \brief Get the number of buffered complete words.
+ *
+ * \return Number of complete 32 bit words.
+ */
+std::size_t FIFORingBuffer::getWordCount() const
+{
+    const std::size_t tailPos = tail.load(std::memory_order_acquire);
+    return head.load(std::memory_order_acquire) - tailPos;
+}
+
+/*!
+ * \brief Get the current capacity in number of words.
+ *
+ * \return Capacity (always a power of two).
+ */
+std::size_t FIFORingBuffer::getCapacity() const
+{
+    return buffer.size();
+}
+
+/*!
+ * \brief Get the maximum reached fill level in number of bytes.
+ *
+ * \return Maximum of getSize() since construction.
+ */
+std::size_t FIFORingBuffer::getHighWaterMark() const
+{
+    return highWaterMark.load(std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Check if the capacity is fixed (lock-free SPSC mode).
+ *
+ * \return True if constructed with fixed capacity or moved to a file (see moveToFile()).
+ */
+bool FIFORingBuffer::hasFixedCapacity() const
+{
+    return fixedCapacity;
+}
+
+/*!
+ * \brief Check if the storage is a memory-mapped file.
+ *
+ * \return True if constructed with a backing file path or moved to a file (see moveToFile()).
+ */
+bool FIFORingBuffer::isFileBacked() const
+{
+    return static_cast<bool>(mappedFile);
+}
+
+//
+
+/*!
+ * \brief Get the total number of words ever appended.
+ *
+ * Together with getWordsPopped() this gives absolute positions in the word stream, which
+ * (unlike the internal ring buffer positions) are not affected by growing or clearing the buffer.
+ *
+ * \return Number of complete words appended since construction.
+ */
+std::uint64_t FIFORingBuffer::getWordsPushed() const
+{
+    return wordsPushed.load(std::memory_order_acquire);
+}
+
+/*!
+ * \brief Get the total number of words ever removed.
+ *
+ * Words removed by clear() are counted as well, i.e. the stream position of the first buffered word is returned.
+ * See also getWordsPushed().
+ *
+ * \return Number of complete words removed since construction.
+ */
+std::uint64_t FIFORingBuffer::getWordsPopped() const
+{
+    return wordsPopped.load(std::memory_order_acquire);
+}
+
+//
+
+/*!
+ * \brief Remove all buffered data.
+ *
+ * Also discards the bytes of a not yet completed word. Keeps the current capacity.
+ *
+ * Note: Must not be called concurrently with pushBytes() or popBytes(), also not in fixed capacity mode.
+ */
+void FIFORingBuffer::clear()
+{
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    partialWordSize.store(0, std::memory_order_release);
+    wordsPopped.store(wordsPushed.load(std::memory_order_relaxed), std::memory_order_release);
+}
+
+/*!
+ * \brief Move the buffered data to a memory-mapped file as new storage with fixed capacity.
+ *
+ * Creates (or truncates) the file \p pBackingFilePath with a capacity of \p pCapacity words (rounded up to the next
+ * power of two), maps it into memory (as for the backing file in FIFORingBuffer()), moves the buffered words to the
+ * start of the mapped file and releases the heap storage. The capacity is fixed afterwards. The file is removed
+ * again on destruction. A not yet completed word and the stream positions (see getWordsPushed()) are kept.
+ *
+ * Note: Must not be called concurrently with any other function, also not in fixed capacity mode.
+ *
+ * \throws std::runtime_error If the capacity is already fixed.
+ * \throws std::invalid_argument If the buffered words do not fit into \p pCapacity words.
+ * \throws std::runtime_error If the backing file cannot be created, resized or mapped.
+ *
+ * \param pBackingFilePath Path of the file to use as memory-mapped storage.
+ * \param pCapacity New capacity in number of 32 bit words.
+ */
+void FIFORingBuffer::moveToFile(const std::string& pBackingFilePath, const std::size_t pCapacity)
+{
+    if (fixedCapacity)
+        throw std::runtime_error("Cannot move FIFO buffer with fixed capacity to a file.");
+
+    const std::size_t wordCount = getWordCount();
+    const std::size_t capacity = std::bit_ceil(std::max(pCapacity, std::size_t{1}));
+
+    if (wordCount > capacity)
+        throw std::invalid_argument("FIFO buffer file capacity is too small for the buffered data.");
+
+    std::unique_ptr<MappedFile> newMappedFile = std::make_unique<MappedFile>(pBackingFilePath, capacity);
+    const std::span<std::uint32_t> newBuffer = newMappedFile->getWords();
+
+    const std::size_t startIdx = tail.load(std::memory_order_relaxed) & mask;
+    const std::size_t firstNumWords = std::min(wordCount, buffer.size() - startIdx);
+
+    std::copy_n(buffer.begin() + startIdx, firstNumWords, newBuffer.begin());
+    std::copy_n(buffer.begin(), wordCount - firstNumWords, newBuffer.begin() + firstNumWords);
+
+    mappedFile = std::move(newMappedFile);
+    buffer = newBuffer;
+    mask = buffer.size() - 1;
+    tail.store(0, std::memory_order_relaxed);
+    head.store(wordCount, std::memory_order_release);
+
+    decltype(heapBuffer)(heapBuffer.get_allocator()).swap(heapBuffer);
+
+    fixedCapacity = true;
+}
+
+//
+
+/*!
+ * \brief Append a byte sequence to the buffer.
+ *
+ * Completes a previously incomplete word first, then copies all complete words in bulk
+ * and finally holds back the remaining bytes (if any) as new incomplete word.
+ *
+ * By default the capacity is increased (doubled as often as needed) if \p pBytes does not fit into the buffer.
+ * In fixed capacity mode only the leading part of \p pBytes that fits into the free capacity will be appended instead.
+ *
+ * \param pBytes Bytes to append.
+ * \return Number of appended bytes from \p pBytes (always all of them if the capacity is not fixed).
+ */
+std::size_t FIFORingBuffer::pushBytes(std::span<const std::uint8_t> pBytes)
+{
+    std::size_t partialSize = partialWordSize.load(std::memory_order_relaxed);
+
+    if (fixedCapacity)
+    {
+        //Complete words must fit into free capacity; up to three additional bytes can be held back as incomplete word
+        const std::size_t freeWords = buffer.size() - (head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire));
+        const std::size_t maxBytes = freeWords * 4 + 3 - partialSize;
+
+        if (pBytes.size() > maxBytes)
+            pBytes = pBytes.first(maxBytes);
+    }
+
+    if (pBytes.empty())
+        return 0;
+
+    std::size_t pos = 0;
+
+    if (partialSize > 0)
+    {
+        pos = std::min(4 - partialSize, pBytes.size());
+
+        std::copy(pBytes.begin(), pBytes.begin() + pos, partialWord.begin() + partialSize);
+        partialSize += pos;
+
+        if (partialSize == 4)
+        {
+            pushWords(partialWord.data(), 1);
+            partialSize = 0;
+        }
+    }
+
+    const std::size_t numWords = (pBytes.size() - pos) / 4;
+
+    pushWords(pBytes.data() + pos, numWords);
+    pos += numWords * 4;
+
+    if (pos < pBytes.size())    //Can only get here with empty partial word
+    {
+        std::copy(pBytes.begin() + pos, pBytes.end(), partialWord.begin());
+        partialSize = pBytes.size() - pos;
+    }
+
+    partialWordSize.store(partialSize, std::memory_order_release);
+
+    const std::size_t size = getSize();
+
+    if (size > highWaterMark.load(std::memory_order_relaxed))
+        highWaterMark.store(size, std::memory_order_relaxed);
+
+    return pBytes.size();
+}
+
+/*!
+ * \brief Extract a number of complete words as byte sequence.
+ *
+ * Removes up to \p pNumWords complete words from the buffer and returns them as
+ * little endian byte sequence (limited by the number of available words).
+ *
+ * \param pNumWords Maximum number of words to extract.
+ * \return Extracted data with a length of four times the number of extracted words.
+ */
+std::vector<std::uint8_t> FIFORingBuffer::popBytes(const std::size_t pNumWords)
+{
+    std::vector<std::uint8_t> retVal(std::min(pNumWords, getWordCount()) * 4);
+
+    retVal.resize(popBytesInto(retVal));
+
+    return retVal;
+}
+
+/*!
+ * \brief Extract as many complete words as fit into a byte buffer.
+ *
+ * Works like popBytes() for up to <tt>pBytes.size() / 4</tt> words, but writes the extracted
+ * little endian byte sequence to \p pBytes instead of allocating a new byte sequence.
+ *
+ * \param pBytes Buffer for the extracted data.
+ * \return Number of bytes written to \p pBytes (four times the number of extracted words).
+ */
+std::size_t FIFORingBuffer::popBytesInto(const std::span<std::uint8_t> pBytes)
+{
+    const std::size_t tailPos = tail.load(std::memory_order_relaxed);
+    const std::size_t numWords = std::min(pBytes.size() / 4, head.load(std::memory_order_acquire) - tailPos);
+
+    const std::size_t startIdx = tailPos & mask;
+    const std::size_t firstNumWords = std::min(numWords, buffer.size() - startIdx);
+
+    casil::Bytes::encodeUInt32LE(std::span<const std::uint32_t>(buffer.data() + startIdx, firstNumWords), pBytes.first(firstNumWords * 4));
+    casil::Bytes::encodeUInt32LE(std::span<const std::uint32_t>(buffer.data(), numWords - firstNumWords),
+                                 pBytes.subspan(firstNumWords * 4, (numWords - firstNumWords) * 4));
+
+    wordsPopped.fetch_add(numWords, std::memory_order_release);
+    tail.store(tailPos + numWords, std::memory_order_release);
+
+    return numWords * 4;
+}
+
+/*!
+ * \brief Pass a number of complete words to a function in place and remove them.
+ *
+ * Calls \p pConsumer with (up to) \p pNumWords words from the front of the buffer (limited by the number of available words)
+ * as two contiguous views directly into the buffer memory, the second of which is empty unless the words wrap around
+ * the end of the buffer. The words are removed from the buffer after \p pConsumer returns. The views must not be used
+ * after that. If \p pConsumer throws, the words are not removed.
+ *
+ * Note: Only concurrent calls to pushBytes() are allowed during \p pConsumer (in fixed capacity mode).
+ *
+ * \param pNumWords Maximum number of words to pass.
+ * \param pConsumer Function to pass the words to.
+ * \return Number of passed (and removed) words.
+ */
+std::size_t FIFORingBuffer::consumeWords(const std::size_t pNumWords, const ConsumerFunctionType& pConsumer)
+{
+    const std::size_t tailPos = tail.load(std::memory_order_relaxed);
+    const std::size_t numWords = std::min(pNumWords, head.load(std::memory_order_acquire) - tailPos);
+
+    if (numWords == 0)
+        return 0;
+
+    const std::size_t startIdx = tailPos & mask;
+    const std::size_t firstNumWords = std::min(numWords, buffer.size() - startIdx);
+
+    pConsumer(std::span<const std::uint32_t>(buffer.data() + startIdx, firstNumWords),
+              std::span<const std::uint32_t>(buffer.data(), numWords - firstNumWords));
+
+    wordsPopped.fetch_add(numWords, std::memory_order_release);
+    tail.store(tailPos + numWords, std::memory_order_release);
+
+    return numWords;
+}
+
+/*!
+ * \brief Remove a number of complete words without reading them.
+ *
+ * Removes up to \p pNumWords words from the front of the buffer (limited by the number of available words).
+ *
+ * \param pNumWords Maximum number of words to remove.
+ * \return Number of removed words.
+ */
+std::size_t FIFORingBuffer::discardWords(const std::size_t pNumWords)
+{
+    const std::size_t tailPos = tail.load(std::memory_order_relaxed);
+    const std::size_t numWords = std::min(pNumWords, head.load(std::memory_order_acquire) - tailPos);
+
+    wordsPopped.fetch_add(numWords, std::memory_order_release);
+    tail.store(tailPos + numWords, std::memory_order_release);
+
+    return numWords;
+}
+
+//Private
+
+/*!
+ * \brief Ensure free capacity for a number of additional words.
+ *
+ * Reallocates the buffer with the next power of two capacity that fits all words
+ * if necessary. The buffered words are moved to the start of the new buffer.
+ *
+ * Note: Must not be used in fixed capacity mode.
+ *
+ * \param pNumWords Number of words that will be added.
+ */
+void FIFORingBuffer::reserveWords(const std::size_t pNumWords)
+{
+    const std::size_t wordCount = getWordCount();
+
+    if (wordCount + pNumWords <= buffer.size())
+        return;
+
+    decltype(heapBuffer) newBuffer(std::bit_ceil(wordCount + pNumWords), heapBuffer.get_allocator());
+
+    const std::size_t startIdx = tail.load(std::memory_order_relaxed) & mask;
+    const std::size_t firstNumWords = std::min(wordCount, buffer.size() - startIdx);
+
+    std::copy_n(buffer.begin() + startIdx, firstNumWords, newBuffer.begin());
+    std::copy_n(buffer.begin(), wordCount - firstNumWords, newBuffer.begin() + firstNumWords);
+
+    heapBuffer.swap(newBuffer);
+    buffer = heapBuffer;
+    mask = buffer.size() - 1;
+    tail.store(0, std::memory_order_relaxed);
+    head.store(wordCount, std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Append complete words given as bytes.
+ *
+ * Note: In fixed capacity mode the words must fit into the free capacity.
+ *
+ * \param pBytes Little endian byte representation of the words (must have a length of four times \p pNumWords).
+ * \param pNumWords Number of words to append.
+ */
+void FIFORingBuffer::pushWords(const std::uint8_t *const pBytes, const std::size_t pNumWords)
+{
+    if (pNumWords == 0)
+        return;
+
+    if (!fixedCapacity)
+        reserveWords(pNumWords);
+
+    const std::size_t headPos = head.load(std::memory_order_relaxed);
+
+    const std::size_t startIdx = headPos & mask;
+    const std::size_t firstNumWords = std::min(pNumWords, buffer.size() - startIdx);
+
+    casil::Bytes::decodeUInt32LE(std::span<const std::uint8_t>(pBytes, firstNumWords * 4),
+                                 std::span<std::uint32_t>(buffer.data() + startIdx, firstNumWords));
+    casil::Bytes::decodeUInt32LE(std::span<const std::uint8_t>(pBytes + firstNumWords * 4, (pNumWords - firstNumWords) * 4),
+                                 std::span<std::uint32_t>(buffer.data(), pNumWords - firstNumWords));
+
+    wordsPushed.fetch_add(pNumWords, std::memory_order_release);
+    head.store(headPos + pNumWords, std::memory_order_release);
+}
+
+/// \endcond INTERNAL
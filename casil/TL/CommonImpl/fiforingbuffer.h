@@ -0,0 +1,145 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_COMMONIMPL_FIFORINGBUFFER_H
+#define CASIL_LAYERS_TL_COMMONIMPL_FIFORINGBUFFER_H
+
+#include <casil/memoryplacement.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/// \cond INTERNAL
+namespace CommonImpl
+{
+
+/*!
+ * \brief Contiguous ring buffer of 32 bit words for buffering FIFO data streams.
+ *
+ * Stores a byte stream as sequence of 32 bit words (little endian byte order, as used for basil FIFO data) in a contiguous
+ * ring buffer with a power of two capacity. Incoming bytes are copied in bulk (see pushBytes()) and leftover bytes that do
+ * not yet form a complete word are held back until completed by the following bytes. Extracting data (see popBytes())
+ * also works on complete words only and hence costs at most two bulk copies. Alternatively the buffered words can be
+ * accessed in place without any copy (see consumeWords()).
+ *
+ * By default, if the incoming data does not fit into the remaining capacity, the capacity is doubled (as often as needed),
+ * i.e. no data is ever discarded. The reached maximum fill level is tracked (see getHighWaterMark()).
+ *
+ * Note: In this default mode the class is not thread-safe. Users must synchronize access to this class themselves.
+ *
+ * Alternatively the buffer can be constructed with a fixed capacity. It then works as lock-free single-producer/single-consumer
+ * queue with atomic head and tail positions: One thread may call pushBytes() while another thread concurrently calls
+ * popBytes(), getSize() or getWordCount() without any locking. Instead of growing, pushBytes() then only accepts as many
+ * bytes as fit into the free capacity and returns the accepted number of bytes (the producer has to retry the remaining
+ * bytes later). Note that clear() is not part of this concurrent interface and must not overlap with pushBytes().
+ *
+ * Instead of heap memory the buffer can also use a memory-mapped file as storage (see FIFORingBuffer()), which always
+ * implies a fixed capacity. This allows for very large buffers that the operating system can page out to disk under
+ * memory pressure. The in place access via consumeWords() then directly passes views of the mapped file.
+ * A growing heap buffer can also be moved to a memory-mapped file later on (see moveToFile()).
+ * The heap storage can be placed on huge pages and/or a specific NUMA node instead (see MemoryPlacement).
+ */
+class FIFORingBuffer
+{
+public:
+    using ConsumerFunctionType = std::function<void(std::span<const std::uint32_t>, std::span<const std::uint32_t>)>;
+                                                                ///< \brief Function type for in place access to buffered words
+                                                                ///  as two contiguous segments (see consumeWords()).
+
+public:
+    explicit FIFORingBuffer(std::size_t pCapacity, bool pFixedCapacity = false, const std::string& pBackingFilePath = "",
+                            MemoryPlacement pPlacement = MemoryPlacement{});    ///< Constructor.
+    FIFORingBuffer(const FIFORingBuffer&) = delete;             ///< Deleted copy constructor.
+    FIFORingBuffer(FIFORingBuffer&&) = delete;                  ///< Deleted move constructor.
+    ~FIFORingBuffer();                                          ///< Destructor.
+    //
+    FIFORingBuffer& operator=(FIFORingBuffer) = delete;         ///< Deleted copy assignment operator.
+    FIFORingBuffer& operator=(FIFORingBuffer&&) = delete;       ///< Deleted move assignment operator.
+    //
+    std::size_t getSize() const;                                ///< Get the number of buffered bytes.
+    std::size_t getWordCount() const;                           ///< Get the number of buffered complete words.
+    std::size_t getCapacity() const;                            ///< Get the current capacity in number of words.
+    std::size_t getHighWaterMark() const;                       ///< Get the maximum reached fill level in number of bytes.
+    bool hasFixedCapacity() const;                              ///< Check if the capacity is fixed (lock-free SPSC mode).
+    bool isFileBacked() const;                                  ///< Check if the storage is a memory-mapped file.
+    //
+    std::uint64_t getWordsPushed() const;                       ///< Get the total number of words ever appended.
+    std::uint64_t getWordsPopped() const;                       ///< Get the total number of words ever removed.
+    //
+    void clear();                                               ///< Remove all buffered data.
+    void moveToFile(const std::string& pBackingFilePath, std::size_t pCapacity);   ///< \brief Move the buffered data to a memory-mapped
+                                                                                    ///  file as new storage with fixed capacity.
+    //
+    std::size_t pushBytes(std::span<const std::uint8_t> pBytes);    ///< Append a byte sequence to the buffer.
+    std::vector<std::uint8_t> popBytes(std::size_t pNumWords);  ///< Extract a number of complete words as byte sequence.
+    std::size_t popBytesInto(std::span<std::uint8_t> pBytes);   ///< Extract as many complete words as fit into a byte buffer.
+    std::size_t consumeWords(std::size_t pNumWords, const ConsumerFunctionType& pConsumer);    ///< \brief Pass a number of complete words
+                                                                                                ///  to a function in place and remove them.
+    std::size_t discardWords(std::size_t pNumWords);            ///< Remove a number of complete words without reading them.
+
+private:
+    void reserveWords(std::size_t pNumWords);                   ///< Ensure free capacity for a number of additional words.
+    void pushWords(const std::uint8_t* pBytes, std::size_t pNumWords);  ///< Append complete words given as bytes.
+
+private:
+    struct MappedFile;                                          ///< Memory-mapped file used as word storage.
+    //
+    bool fixedCapacity;                                         ///< Never grow \ref buffer and allow lock-free concurrent push/pop.
+    //
+    std::vector<std::uint32_t, PlacedAllocator<std::uint32_t>> heapBuffer;  ///< Word storage on the heap (empty if file-backed).
+    std::unique_ptr<MappedFile> mappedFile;                     ///< Word storage in a memory-mapped file (null if heap-backed).
+    std::span<std::uint32_t> buffer;                            ///< Used word storage with power of two size.
+    std::size_t mask;                                           ///< Index mask for positions in \ref buffer (capacity - 1).
+    std::atomic<std::size_t> head;                              ///< Total number of words ever written (write position).
+    std::atomic<std::size_t> tail;                              ///< Total number of words ever read (read position).
+    //
+    std::array<std::uint8_t, 4> partialWord;                    ///< Leftover bytes of an incomplete word.
+    std::atomic<std::size_t> partialWordSize;                   ///< Number of valid bytes in \ref partialWord.
+    //
+    std::atomic<std::size_t> highWaterMark;                     ///< Maximum reached fill level in bytes.
+    //
+    std::atomic<std::uint64_t> wordsPushed;                     ///< Total number of words ever appended (not affected by growing).
+    std::atomic<std::uint64_t> wordsPopped;                     ///< Total number of words ever removed (including cleared words).
+};
+
+} // namespace CommonImpl
+/// \endcond INTERNAL
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_COMMONIMPL_FIFORINGBUFFER_H
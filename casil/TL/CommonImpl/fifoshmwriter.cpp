@@ -0,0 +1,354 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/CommonImpl/fifoshmwriter.h>
+
+#include <casil/fifoshmreader.h>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+/// \cond INTERNAL
+
+using casil::Layers::TL::CommonImpl::FIFOShmWriter;
+
+using casil::FifoShmReader;
+
+namespace
+{
+
+/*
+ * Atomically store a 64 bit value in the shared memory.
+ */
+void storeUInt64(std::uint8_t* const pAddress, const std::uint64_t pValue, const std::memory_order pOrder = std::memory_order_release)
+{
+    std::atomic_ref<std::uint64_t>(*reinterpret_cast<std::uint64_t*>(pAddress)).store(pValue, pOrder);
+}
+
+/*
+ * Atomically store a 32 bit value in the shared memory.
+ */
+void storeUInt32(std::uint8_t* const pAddress, const std::uint32_t pValue, const std::memory_order pOrder = std::memory_order_release)
+{
+    std::atomic_ref<std::uint32_t>(*reinterpret_cast<std::uint32_t*>(pAddress)).store(pValue, pOrder);
+}
+
+} // namespace
+
+/*!
+ * \brief Shared memory object and its mapping.
+ *
+ * Creates the named shared memory object with the requested size (replacing an existing one of the same name),
+ * maps it completely and removes the name again on destruction. Readers that still map the removed object keep
+ * their (then orphaned) mapping.
+ */
+struct FIFOShmWriter::SharedRing
+{
+    SharedRing(const std::string& pName, const std::size_t pSize) :
+        name(pName),
+        region()
+    {
+        try
+        {
+            //Always start with a new, zero-filled object
+            boost::interprocess::shared_memory_object::remove(name.c_str());
+
+            boost::interprocess::shared_memory_object shm(boost::interprocess::create_only, name.c_str(), boost::interprocess::read_write);
+            shm.truncate(static_cast<boost::interprocess::offset_t>(pSize));
+
+            region = boost::interprocess::mapped_region(shm, boost::interprocess::read_write);
+        }
+        catch (const boost::interprocess::interprocess_exception& exc)
+        {
+            boost::interprocess::shared_memory_object::remove(name.c_str());
+            throw std::runtime_error("Could not create shared-memory FIFO ring \"" + name + "\": " + exc.what());
+        }
+    }
+    ~SharedRing()
+    {
+        boost::interprocess::mapped_region().swap(region);
+        boost::interprocess::shared_memory_object::remove(name.c_str());
+    }
+    //
+    std::uint8_t* getAddress() const
+    {
+        return static_cast<std::uint8_t*>(region.get_address());
+    }
+    //
+    const std::string name;                         ///< Name of the shared memory object.
+    boost::interprocess::mapped_region region;      ///< Mapped region covering the whole object.
+};
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Note: Does not create the shared-memory ring yet (see open()).
+ *
+ * \throws std::invalid_argument If \p pName is empty.
+ * \throws std::invalid_argument If \p pSlotSize is smaller than 4 bytes or does not fit the 32 bit payload length.
+ * \throws std::invalid_argument If \p pNumSlots is smaller than 2.
+ *
+ * \param pName Name of the shared-memory ring (e.g. "casil_fifo"; see FifoShmReader).
+ * \param pSlotSize Slot capacity in bytes, i.e. the maximum block payload length (rounded down to a multiple of 4).
+ * \param pNumSlots Number of slots.
+ */
+FIFOShmWriter::FIFOShmWriter(std::string pName, const std::size_t pSlotSize, const std::size_t pNumSlots) :
+    name(std::move(pName)),
+    slotSize(pSlotSize - pSlotSize % 4),
+    numSlots(pNumSlots),
+    sharedRing(),
+    nextSequence(0),
+    slotBegun(false),
+    slotFill(0),
+    partialWord{0, 0, 0},
+    partialWordSize(0)
+{
+    if (name == "")
+        throw std::invalid_argument("Empty name for shared-memory FIFO ring.");
+    if (slotSize == 0 || slotSize > std::numeric_limits<std::uint32_t>::max())
+        throw std::invalid_argument("Invalid slot size for shared-memory FIFO ring.");
+    if (numSlots < 2)
+        throw std::invalid_argument("Shared-memory FIFO ring needs at least two slots.");
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Calls close().
+ */
+FIFOShmWriter::~FIFOShmWriter()
+{
+    close();
+}
+
+//Public
+
+/*!
+ * \brief Create a new shared-memory ring.
+ *
+ * Closes the current ring (see close()) and creates a new one, replacing any existing
+ * shared memory of the same name. The block sequence numbers start again at zero.
+ *
+ * \throws std::runtime_error If the shared memory cannot be created or mapped.
+ */
+void FIFOShmWriter::open()
+{
+    close();
+
+    sharedRing = std::make_unique<SharedRing>(name, FifoShmReader::ringHeaderSize + numSlots * FifoShmReader::getSlotStride(slotSize));
+
+    nextSequence = 0;
+    slotBegun = false;
+    slotFill = 0;
+    partialWordSize = 0;
+
+    std::uint8_t* const base = sharedRing->getAddress();
+
+    const std::uint32_t version = FifoShmReader::layoutVersion;
+    const std::uint64_t headerSlotSize = slotSize;
+    const std::uint64_t headerNumSlots = numSlots;
+
+    std::memcpy(base + 4, &version, sizeof(version));
+    std::memcpy(base + FifoShmReader::slotSizeOffset, &headerSlotSize, sizeof(headerSlotSize));
+    std::memcpy(base + FifoShmReader::numSlotsOffset, &headerNumSlots, sizeof(headerNumSlots));
+
+    ::storeUInt32(base + FifoShmReader::writerStateOffset, 1, std::memory_order_relaxed);
+
+    //Magic number last, such that readers only accept a completely initialized header
+    ::storeUInt32(base, FifoShmReader::ringMagic);
+}
+
+/*!
+ * \brief Publish the complete words and remove the shared-memory ring.
+ *
+ * Publishes the remaining complete words (if any), marks the writer as closed in the ring header
+ * (readers then reach their end, see FifoShmReader::atEnd()), unmaps the ring and removes its name.
+ *
+ * Does nothing if the ring is not open.
+ */
+void FIFOShmWriter::close()
+{
+    if (!sharedRing)
+        return;
+
+    if (slotBegun && slotFill >= 4)
+        publishSlot();
+
+    ::storeUInt32(sharedRing->getAddress() + FifoShmReader::writerStateOffset, 0);
+
+    sharedRing.reset();
+}
+
+/*!
+ * \brief Check if the shared-memory ring is open.
+ *
+ * \return True if open() was called and close() was not called since.
+ */
+bool FIFOShmWriter::isOpen() const
+{
+    return static_cast<bool>(sharedRing);
+}
+
+/*!
+ * \brief Get the name of the shared-memory ring.
+ *
+ * \return Name passed to FIFOShmWriter().
+ */
+const std::string& FIFOShmWriter::getName() const
+{
+    return name;
+}
+
+//
+
+/*!
+ * \brief Append a byte sequence to the ring and publish the complete words.
+ *
+ * Copies \p pBytes into the slots, publishing each full slot as a block, and finally
+ * publishes the complete words of the last (partially filled) slot as a block as well.
+ * Leftover bytes of an incomplete word are held back for the next call.
+ *
+ * \throws std::runtime_error If the ring is not open.
+ *
+ * \param pBytes FIFO data bytes.
+ */
+void FIFOShmWriter::write(std::span<const std::uint8_t> pBytes)
+{
+    if (!sharedRing)
+        throw std::runtime_error("Shared-memory FIFO ring \"" + name + "\" is not open.");
+
+    while (!pBytes.empty())
+    {
+        if (!slotBegun)
+            beginSlot();
+
+        const std::size_t numBytes = std::min(pBytes.size(), slotSize - slotFill);
+
+        std::memcpy(getSlot(nextSequence) + FifoShmReader::slotHeaderSize + slotFill, pBytes.data(), numBytes);
+
+        slotFill += numBytes;
+        pBytes = pBytes.subspan(numBytes);
+
+        if (slotFill == slotSize)
+            publishSlot();
+    }
+
+    if (slotBegun && slotFill >= 4)
+        publishSlot();
+}
+
+/*!
+ * \brief Discard leftover bytes of an incomplete word.
+ *
+ * Use this to realign the byte stream to word boundaries, e.g. after a FIFO reset.
+ */
+void FIFOShmWriter::discardPartialWord()
+{
+    partialWordSize = 0;
+
+    if (slotBegun)
+        slotFill -= slotFill % 4;
+}
+
+/*!
+ * \brief Get the number of blocks published since open().
+ *
+ * \return Sequence number of the next block.
+ */
+std::uint64_t FIFOShmWriter::getBlocksPublished() const
+{
+    return nextSequence;
+}
+
+//Private
+
+/*!
+ * \brief Mark the slot of the next block as being written.
+ *
+ * Sets the slot state to "being written" (invalidating the old block in the slot)
+ * and copies the held back bytes of an incomplete word to the start of the slot.
+ */
+void FIFOShmWriter::beginSlot()
+{
+    std::uint8_t* const slot = getSlot(nextSequence);
+
+    ::storeUInt64(slot, 2 * nextSequence + 1, std::memory_order_relaxed);
+
+    //State change must be visible before any payload change (seqlock)
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(slot + FifoShmReader::slotHeaderSize, partialWord.data(), partialWordSize);
+
+    slotFill = partialWordSize;
+    partialWordSize = 0;
+    slotBegun = true;
+}
+
+/*!
+ * \brief Publish the complete words of the current slot as a block.
+ *
+ * Sets the payload length and the slot state to "complete" and increments the number of published blocks.
+ * Leftover bytes of an incomplete word are held back for the next slot.
+ */
+void FIFOShmWriter::publishSlot()
+{
+    std::uint8_t* const slot = getSlot(nextSequence);
+
+    const std::size_t length = slotFill - slotFill % 4;
+
+    partialWordSize = slotFill % 4;
+    std::memcpy(partialWord.data(), slot + FifoShmReader::slotHeaderSize + length, partialWordSize);
+
+    ::storeUInt32(slot + FifoShmReader::payloadLengthOffset, static_cast<std::uint32_t>(length), std::memory_order_relaxed);
+    ::storeUInt64(slot, 2 * nextSequence + 2);
+
+    ++nextSequence;
+
+    ::storeUInt64(sharedRing->getAddress() + FifoShmReader::publishedOffset, nextSequence);
+
+    slotBegun = false;
+    slotFill = 0;
+}
+
+/*!
+ * \brief Get the address of the slot for a block.
+ *
+ * \param pSequence Sequence number of the block.
+ * \return Address of the slot header.
+ */
+std::uint8_t* FIFOShmWriter::getSlot(const std::uint64_t pSequence) const
+{
+    return sharedRing->getAddress() + FifoShmReader::ringHeaderSize + (pSequence % numSlots) * FifoShmReader::getSlotStride(slotSize);
+}
+
+/// \endcond INTERNAL
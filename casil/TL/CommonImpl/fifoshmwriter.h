@@ -0,0 +1,104 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_COMMONIMPL_FIFOSHMWRITER_H
+#define CASIL_LAYERS_TL_COMMONIMPL_FIFOSHMWRITER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/// \cond INTERNAL
+namespace CommonImpl
+{
+
+/*!
+ * \brief Writer for publishing FIFO data words as blocks to a named shared-memory ring.
+ *
+ * Creates a named shared-memory ring of fixed-capacity slots (see open()) and copies an incoming byte stream
+ * of 32 bit FIFO data words (see write()) directly into the slots. The complete words of a slot are published
+ * as one block as soon as the slot is full and at the end of each write() call, i.e. every call publishes its data
+ * without further delay. Leftover bytes that do not yet form a complete word are held back until completed by the
+ * following bytes. The oldest block is overwritten without waiting for readers.
+ *
+ * See FifoShmReader for the shared-memory layout and for reading the ring from other processes.
+ *
+ * Note: The class is not thread-safe. Users must synchronize access to this class themselves.
+ */
+class FIFOShmWriter
+{
+public:
+    FIFOShmWriter(std::string pName, std::size_t pSlotSize, std::size_t pNumSlots);    ///< Constructor.
+    FIFOShmWriter(const FIFOShmWriter&) = delete;               ///< Deleted copy constructor.
+    FIFOShmWriter(FIFOShmWriter&&) = delete;                    ///< Deleted move constructor.
+    ~FIFOShmWriter();                                           ///< Destructor.
+    //
+    FIFOShmWriter& operator=(FIFOShmWriter) = delete;           ///< Deleted copy assignment operator.
+    FIFOShmWriter& operator=(FIFOShmWriter&&) = delete;         ///< Deleted move assignment operator.
+    //
+    void open();                                                ///< Create a new shared-memory ring.
+    void close();                                               ///< Publish the complete words and remove the shared-memory ring.
+    bool isOpen() const;                                        ///< Check if the shared-memory ring is open.
+    const std::string& getName() const;                         ///< Get the name of the shared-memory ring.
+    //
+    void write(std::span<const std::uint8_t> pBytes);           ///< Append a byte sequence to the ring and publish the complete words.
+    void discardPartialWord();                                  ///< Discard leftover bytes of an incomplete word.
+    std::uint64_t getBlocksPublished() const;                   ///< Get the number of blocks published since open().
+
+private:
+    void beginSlot();                                           ///< Mark the slot of the next block as being written.
+    void publishSlot();                                         ///< Publish the complete words of the current slot as a block.
+    std::uint8_t* getSlot(std::uint64_t pSequence) const;       ///< Get the address of the slot for a block.
+
+private:
+    const std::string name;                                     ///< Name of the shared-memory ring.
+    const std::size_t slotSize;                                 ///< Slot capacity in bytes (i.e. maximum block payload length).
+    const std::size_t numSlots;                                 ///< Number of slots.
+    //
+    struct SharedRing;                                          ///< Shared memory object and its mapping.
+    std::unique_ptr<SharedRing> sharedRing;                     ///< Current ring (null if not open).
+    //
+    std::uint64_t nextSequence;                                 ///< Sequence number of the next block.
+    bool slotBegun;                                             ///< Slot of the next block is marked as being written.
+    std::size_t slotFill;                                       ///< Number of bytes written to the slot of the next block.
+    std::array<std::uint8_t, 3> partialWord;                    ///< Leftover bytes of an incomplete word (carried over to the next slot).
+    std::size_t partialWordSize;                                ///< Number of leftover bytes in \ref partialWord.
+};
+
+} // namespace CommonImpl
+/// \endcond INTERNAL
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_COMMONIMPL_FIFOSHMWRITER_H
@@ -0,0 +1,289 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/CommonImpl/rbcpdispatcher.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+/// \cond INTERNAL
+
+using casil::Layers::TL::CommonImpl::RBCPDispatcher;
+
+/*!
+ * \brief Constructor.
+ *
+ * Creates a ticket with a new unique number.
+ *
+ * \param pDispatcher The dispatcher to await responses from.
+ */
+RBCPDispatcher::Ticket::Ticket(RBCPDispatcher& pDispatcher) :
+    dispatcher(pDispatcher),
+    number([&pDispatcher]() -> std::uint64_t
+           {
+               const std::lock_guard<std::mutex> routingLock(pDispatcher.mutex);
+               (void)routingLock;
+
+               return pDispatcher.nextTicketNumber++;
+           }())
+{
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops awaiting all responses of this ticket (remaining or further responses will count as late duplicates).
+ */
+RBCPDispatcher::Ticket::~Ticket()
+{
+    const std::lock_guard<std::mutex> routingLock(dispatcher.mutex);
+    (void)routingLock;
+
+    for (Slot& slot : dispatcher.slots)
+        if (slot.ticket == number && (slot.state == SlotState::Pending || slot.state == SlotState::Received))
+            slot.state = SlotState::Retired;
+}
+
+//Public
+
+/*!
+ * \brief Await the response to a sent request.
+ *
+ * Registers the message ID \p pId of a request, such that its response will be written to \p pBuffer (truncated to the
+ * buffer size) and returned by wait(). The buffer must stay valid until the response was returned by wait(), until
+ * the ID was retired (see retire()) or until the ticket is destructed.
+ *
+ * Multiple IDs may be awaited at the same time, also using the same buffer (e.g. for retransmissions of a request
+ * with a new ID, where the first arriving response is used). In the latter case only one response is written to
+ * the buffer until taken by wait(); further responses for the same buffer count as late duplicates.
+ *
+ * Should the ID still be awaited by another ticket, that ticket loses its claim on the ID.
+ *
+ * \param pId RBCP message ID of the sent request.
+ * \param pBuffer Destination for the response.
+ */
+void RBCPDispatcher::Ticket::expect(const std::uint8_t pId, const std::span<std::uint8_t> pBuffer)
+{
+    const std::lock_guard<std::mutex> routingLock(dispatcher.mutex);
+    (void)routingLock;
+
+    dispatcher.slots[pId] = Slot{.state = SlotState::Pending, .ticket = number, .buffer = pBuffer, .size = 0};
+}
+
+/*!
+ * \brief Stop awaiting the response to a request.
+ *
+ * A response for \p pId that arrives later on (or that was already received but not yet taken by wait())
+ * will be treated as late duplicate. Does nothing if \p pId is not awaited by this ticket.
+ *
+ * \param pId RBCP message ID of the request.
+ */
+void RBCPDispatcher::Ticket::retire(const std::uint8_t pId)
+{
+    const std::lock_guard<std::mutex> routingLock(dispatcher.mutex);
+    (void)routingLock;
+
+    Slot& slot = dispatcher.slots[pId];
+
+    if (slot.ticket == number && (slot.state == SlotState::Pending || slot.state == SlotState::Received))
+        slot.state = SlotState::Retired;
+}
+
+/*!
+ * \brief Wait for the next response to one of the awaited requests.
+ *
+ * Returns the next routed response of this ticket or reads datagrams from the socket and routes them
+ * (also to other tickets) until a response for this ticket arrives or \p pDeadline is reached.
+ * The returned message ID is no longer awaited afterwards.
+ *
+ * \throws std::runtime_error If reading from the socket fails due to non-timeout reasons.
+ *
+ * \param pDeadline Point in time until which to wait.
+ * \return Message ID and size of the response or \c std::nullopt if \p pDeadline was reached.
+ */
+std::optional<RBCPDispatcher::Response> RBCPDispatcher::Ticket::wait(const std::chrono::steady_clock::time_point pDeadline)
+{
+    return dispatcher.waitForResponse(number, pDeadline);
+}
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * \param pSocket The %UDP socket to read from.
+ * \param pBufferSize Size of the receive buffer (should be at least one byte larger than any valid response,
+ *                    such that oversized responses can be detected).
+ * \param pUnroutedHandler Function to be called for late duplicates and unexpected datagrams (called while
+ *                         the routing state is locked, i.e. must not use the dispatcher).
+ */
+RBCPDispatcher::RBCPDispatcher(UDPSocketWrapper& pSocket, const std::size_t pBufferSize, UnroutedHandlerType pUnroutedHandler) :
+    socket(pSocket),
+    unroutedHandler(std::move(pUnroutedHandler)),
+    receiveBuffer(pBufferSize, 0),
+    slots(),
+    nextTicketNumber(1),
+    receiving(false),
+    mutex(),
+    routedCondition()
+{
+}
+
+//Public
+
+/*!
+ * \brief Check if the response to a message ID is awaited.
+ *
+ * \param pId RBCP message ID.
+ * \return True if some ticket awaits a response for \p pId.
+ */
+bool RBCPDispatcher::isPending(const std::uint8_t pId) const
+{
+    const std::lock_guard<std::mutex> routingLock(mutex);
+    (void)routingLock;
+
+    return slots[pId].state == SlotState::Pending || slots[pId].state == SlotState::Received;
+}
+
+//Private
+
+/*!
+ * \brief Wait for the next response to one of the requests of a ticket.
+ *
+ * See Ticket::wait().
+ *
+ * Only one thread reads from the socket at a time. Other threads wait until their response
+ * was routed or until the socket is free again (then one of them continues reading).
+ *
+ * \throws std::runtime_error If reading from the socket fails due to non-timeout reasons.
+ *
+ * \param pTicket Number of the ticket.
+ * \param pDeadline Point in time until which to wait.
+ * \return Message ID and size of the response or \c std::nullopt if \p pDeadline was reached.
+ */
+std::optional<RBCPDispatcher::Response> RBCPDispatcher::waitForResponse(const std::uint64_t pTicket,
+                                                                        const std::chrono::steady_clock::time_point pDeadline)
+{
+    std::unique_lock<std::mutex> routingLock(mutex);
+
+    for (;;)
+    {
+        for (std::size_t i = 0; i < slots.size(); ++i)
+        {
+            if (slots[i].state == SlotState::Received && slots[i].ticket == pTicket)
+            {
+                slots[i].state = SlotState::Retired;
+                return Response{.id = static_cast<std::uint8_t>(i), .size = slots[i].size};
+            }
+        }
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        if (now >= pDeadline)
+            return std::nullopt;
+
+        if (receiving)
+        {
+            (void)routedCondition.wait_until(routingLock, pDeadline);
+            continue;
+        }
+
+        receiving = true;
+
+        routingLock.unlock();
+
+        bool timedOut = false;
+        std::size_t size = 0;
+
+        try
+        {
+            size = socket.readInto(receiveBuffer, std::chrono::ceil<std::chrono::milliseconds>(pDeadline - now), timedOut);
+        }
+        catch (const std::runtime_error&)
+        {
+            routingLock.lock();
+            receiving = false;
+            routedCondition.notify_all();
+            throw;
+        }
+
+        routingLock.lock();
+
+        receiving = false;
+
+        if (!timedOut || size > 0)
+            route(size);
+
+        routedCondition.notify_all();
+    }
+}
+
+/*!
+ * \brief Route a received datagram to its awaiting ticket.
+ *
+ * Copies the first \p pSize bytes of the receive buffer to the buffer of the ticket awaiting the datagram's message ID.
+ * Passes the datagram to the unrouted handler (see RBCPDispatcher()) if the ID is not or no longer awaited
+ * or if the datagram is too short to contain an ID. Must be called with locked mutex.
+ *
+ * \param pSize Number of received bytes.
+ */
+void RBCPDispatcher::route(const std::size_t pSize)
+{
+    const std::span<const std::uint8_t> datagram(receiveBuffer.data(), pSize);
+
+    if (pSize < 3)
+    {
+        if (unroutedHandler)
+            unroutedHandler(datagram, false);
+
+        return;
+    }
+
+    Slot& slot = slots[datagram[2]];
+
+    if (slot.state == SlotState::Pending)
+    {
+        //Buffer may be shared with other IDs of the same ticket (retransmissions) and may hold only one response
+        const bool bufferOccupied = std::any_of(slots.begin(), slots.end(),
+                                                [&slot](const Slot& pOther) -> bool
+                                                {
+                                                    return pOther.state == SlotState::Received && pOther.ticket == slot.ticket &&
+                                                           pOther.buffer.data() == slot.buffer.data();
+                                                });
+        if (!bufferOccupied)
+        {
+            slot.size = std::min(pSize, slot.buffer.size());
+            std::copy(datagram.begin(), datagram.begin() + slot.size, slot.buffer.begin());
+            slot.state = SlotState::Received;
+            return;
+        }
+
+        slot.state = SlotState::Retired;
+    }
+
+    if (unroutedHandler)
+        unroutedHandler(datagram, slot.state != SlotState::Free);
+}
+
+/// \endcond INTERNAL
@@ -0,0 +1,168 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_COMMONIMPL_RBCPDISPATCHER_H
+#define CASIL_LAYERS_TL_COMMONIMPL_RBCPDISPATCHER_H
+
+#include <casil/TL/CommonImpl/udpsocketwrapper.h>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/// \cond INTERNAL
+namespace CommonImpl
+{
+
+/*!
+ * \brief Receive side of the RBCP protocol that routes response datagrams to their requests by message ID.
+ *
+ * Owns the receive side of the %UDP socket used for RBCP. Requests are sent by the user, who then registers
+ * the used message ID and a response buffer with a Ticket (see Ticket::expect()) and waits for the response
+ * (see Ticket::wait()). Every received datagram is routed by its message ID (third byte) to the buffer of the
+ * awaiting ticket, no matter which ticket's thread actually received it. Only one thread reads from the socket
+ * at a time while the others wait for their responses to be routed (or take over reading).
+ *
+ * Responses to message IDs that are no longer awaited (e.g. late responses to requests that were retransmitted
+ * with a new ID, see Ticket::retire()) are accounted for as late duplicates, all other datagrams as unexpected.
+ * Both are passed to a handler (see RBCPDispatcher()) and discarded. This way stray datagrams are consumed as part
+ * of the normal receive operations, i.e. the read buffer does not have to be checked/drained before or after transactions.
+ *
+ * Note: The dispatcher only reads from the socket while waiting for a response. The socket must not be read by anyone else
+ * during that time.
+ */
+class RBCPDispatcher
+{
+public:
+    /*!
+     * \brief Received response to an awaited request (see Ticket::wait()).
+     */
+    struct Response
+    {
+        std::uint8_t id;        ///< RBCP message ID.
+        std::size_t size;       ///< Number of bytes written to the buffer passed to Ticket::expect().
+    };
+
+    using UnroutedHandlerType = std::function<void(std::span<const std::uint8_t> pDatagram, bool pLate)>;
+                                                                ///< \brief Function type for handling datagrams that could not be routed
+                                                                ///  (\p pLate for late duplicates, unexpected datagrams otherwise).
+
+    /*!
+     * \brief Set of awaited responses of a single user (e.g. an RBCP transaction with retransmissions).
+     *
+     * Stops awaiting all of its responses on destruction (remaining responses will count as late duplicates).
+     */
+    class Ticket
+    {
+    public:
+        explicit Ticket(RBCPDispatcher& pDispatcher);               ///< Constructor.
+        Ticket(const Ticket&) = delete;                             ///< Deleted copy constructor.
+        Ticket(Ticket&&) = delete;                                  ///< Deleted move constructor.
+        ~Ticket();                                                  ///< Destructor.
+        //
+        Ticket& operator=(Ticket) = delete;                         ///< Deleted copy assignment operator.
+        Ticket& operator=(Ticket&&) = delete;                       ///< Deleted move assignment operator.
+        //
+        void expect(std::uint8_t pId, std::span<std::uint8_t> pBuffer);                 ///< Await the response to a sent request.
+        void retire(std::uint8_t pId);                                                   ///< Stop awaiting the response to a request.
+        std::optional<Response> wait(std::chrono::steady_clock::time_point pDeadline);  ///< \brief Wait for the next response to one
+                                                                                        ///  of the awaited requests.
+
+    private:
+        RBCPDispatcher& dispatcher;                                 ///< The dispatcher.
+        const std::uint64_t number;                                 ///< Unique ticket number.
+    };
+
+public:
+    RBCPDispatcher(UDPSocketWrapper& pSocket, std::size_t pBufferSize, UnroutedHandlerType pUnroutedHandler);  ///< Constructor.
+    RBCPDispatcher(const RBCPDispatcher&) = delete;             ///< Deleted copy constructor.
+    RBCPDispatcher(RBCPDispatcher&&) = delete;                  ///< Deleted move constructor.
+    ~RBCPDispatcher() = default;                                ///< Default destructor.
+    //
+    RBCPDispatcher& operator=(RBCPDispatcher) = delete;         ///< Deleted copy assignment operator.
+    RBCPDispatcher& operator=(RBCPDispatcher&&) = delete;       ///< Deleted move assignment operator.
+    //
+    bool isPending(std::uint8_t pId) const;                     ///< Check if the response to a message ID is awaited.
+
+private:
+    /*!
+     * \brief Routing state of a message ID.
+     */
+    enum class SlotState : std::uint8_t
+    {
+        Free = 0,       ///< Never awaited.
+        Pending = 1,    ///< Response awaited.
+        Received = 2,   ///< Response routed but not yet taken by Ticket::wait().
+        Retired = 3     ///< Response no longer awaited (taken or given up).
+    };
+
+    /*!
+     * \brief Routing entry of a message ID.
+     */
+    struct Slot
+    {
+        SlotState state = SlotState::Free;  ///< Routing state.
+        std::uint64_t ticket = 0;           ///< Number of the awaiting ticket.
+        std::span<std::uint8_t> buffer;     ///< Destination for the response.
+        std::size_t size = 0;               ///< Number of received bytes.
+    };
+
+private:
+    std::optional<Response> waitForResponse(std::uint64_t pTicket, std::chrono::steady_clock::time_point pDeadline);
+                                                                ///< Wait for the next response to one of the requests of a ticket.
+    void route(std::size_t pSize);                              ///< Route a received datagram to its awaiting ticket.
+
+private:
+    UDPSocketWrapper& socket;                                   ///< The %UDP socket to read from.
+    const UnroutedHandlerType unroutedHandler;                  ///< Handler for late duplicates and unexpected datagrams.
+    //
+    std::vector<std::uint8_t> receiveBuffer;                    ///< Buffer for receiving a datagram before routing it.
+    std::array<Slot, 256> slots;                                ///< Routing entries for all message IDs.
+    std::uint64_t nextTicketNumber;                             ///< Number for the next created ticket.
+    bool receiving;                                             ///< A thread is currently reading from the socket.
+    //
+    mutable std::mutex mutex;                                   ///< Mutex for all routing state.
+    std::condition_variable routedCondition;                    ///< Signals routed responses and the end of socket reads.
+};
+
+} // namespace CommonImpl
+/// \endcond INTERNAL
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_COMMONIMPL_RBCPDISPATCHER_H
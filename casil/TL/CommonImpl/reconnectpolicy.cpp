@@ -0,0 +1,102 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/CommonImpl/reconnectpolicy.h>
+
+#include <casil/auxil.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+/// \cond INTERNAL
+
+using casil::Layers::TL::CommonImpl::ReconnectPolicy;
+
+//Public
+
+/*!
+ * \brief Check if reconnecting is enabled.
+ *
+ * \return True if \ref maxAttempts is positive.
+ */
+bool ReconnectPolicy::enabled() const
+{
+    return maxAttempts > 0;
+}
+
+/*!
+ * \brief Get the delay after a number of failed connection attempts.
+ *
+ * Doubles \ref initialBackoff for every further failed attempt, limited by \ref maxBackoff.
+ *
+ * \param pFailedAttempts Number of failed connection attempts so far (starting at 1).
+ * \return Delay before the next connection attempt.
+ */
+std::chrono::milliseconds ReconnectPolicy::getBackoff(const int pFailedAttempts) const
+{
+    std::chrono::milliseconds backoff = initialBackoff;
+
+    for (int i = 1; i < pFailedAttempts && backoff < maxBackoff; ++i)
+        backoff *= 2;
+
+    return std::min(backoff, maxBackoff);
+}
+
+//
+
+/*!
+ * \brief Read the reconnect policy from an interface configuration.
+ *
+ * Reads the optional values "init.reconnect_attempts" (integer type, default: 0, i.e. disabled),
+ * "init.reconnect_backoff" (floating point type, in seconds, default: 0.01), "init.reconnect_max_backoff"
+ * (floating point type, in seconds, default: 1.0) and "init.reconnect_standby" (boolean type, default: false)
+ * from \p pConfig.
+ *
+ * \throws std::runtime_error If "init.reconnect_attempts" is negative.
+ * \throws std::runtime_error If "init.reconnect_backoff" or "init.reconnect_max_backoff" is negative.
+ *
+ * \param pConfig Interface configuration.
+ * \return Configured reconnect policy.
+ */
+ReconnectPolicy ReconnectPolicy::fromConfig(const LayerConfig& pConfig)
+{
+    ReconnectPolicy policy;
+
+    policy.maxAttempts = pConfig.getInt("init.reconnect_attempts", 0);
+
+    const double backoffSecs = pConfig.getDbl("init.reconnect_backoff", 0.01);
+    const double maxBackoffSecs = pConfig.getDbl("init.reconnect_max_backoff", 1.0);
+
+    if (policy.maxAttempts < 0)
+        throw std::runtime_error("Negative number of reconnect attempts.");
+    if (backoffSecs < 0 || maxBackoffSecs < 0)
+        throw std::runtime_error("Negative reconnect backoff.");
+
+    policy.initialBackoff = Auxil::getChronoMilliSecs(backoffSecs);
+    policy.maxBackoff = Auxil::getChronoMilliSecs(maxBackoffSecs);
+    policy.useStandbySocket = pConfig.getBool("init.reconnect_standby", false);
+
+    return policy;
+}
+
+/// \endcond INTERNAL
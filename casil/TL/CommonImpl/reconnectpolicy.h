@@ -0,0 +1,69 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_COMMONIMPL_RECONNECTPOLICY_H
+#define CASIL_LAYERS_TL_COMMONIMPL_RECONNECTPOLICY_H
+
+#include <casil/layerconfig.h>
+
+#include <chrono>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/// \cond INTERNAL
+namespace CommonImpl
+{
+
+/*!
+ * \brief Policy for automatically re-establishing lost connections of the %TCP socket wrapper.
+ *
+ * Collects the reconnect settings that can be configured for the %TCP based interfaces (see fromConfig()).
+ * A lost connection is re-established by up to \ref maxAttempts connection attempts, separated by an
+ * exponentially increasing backoff delay (see getBackoff()). Optionally a standby connection is kept
+ * established in advance, which can then simply replace the lost connection.
+ */
+struct ReconnectPolicy
+{
+    int maxAttempts = 0;                                                        ///< Maximum number of connection attempts (zero disables reconnecting).
+    std::chrono::milliseconds initialBackoff = std::chrono::milliseconds(10);   ///< Delay after the first failed connection attempt.
+    std::chrono::milliseconds maxBackoff = std::chrono::milliseconds(1000);     ///< Upper limit for the exponentially increasing delay.
+    bool useStandbySocket = false;                                              ///< Keep an additional connection established as standby.
+    //
+    bool enabled() const;                                                       ///< Check if reconnecting is enabled.
+    std::chrono::milliseconds getBackoff(int pFailedAttempts) const;            ///< Get the delay after a number of failed connection attempts.
+    //
+    static ReconnectPolicy fromConfig(const LayerConfig& pConfig);              ///< Read the reconnect policy from an interface configuration.
+};
+
+} // namespace CommonImpl
+/// \endcond INTERNAL
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_COMMONIMPL_RECONNECTPOLICY_H
@@ -31,15 +31,29 @@
 #include <boost/asio/completion_condition.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/read.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/asio/write.hpp>
+#include <boost/predef/os/linux.h>
 #include <boost/system/errc.hpp>
 #include <boost/system/system_error.hpp>
 
 #include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <functional>
+#include <limits>
 #include <stdexcept>
+#include <system_error>
 #include <utility>
 
+#if BOOST_OS_LINUX != 0
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#endif
+
 /// \cond INTERNAL
 
 using casil::Layers::TL::CommonImpl::SerialPortWrapper;
@@ -49,29 +63,43 @@ using casil::Layers::TL::CommonImpl::SerialPortWrapper;
 /*!
  * \brief Constructor.
  *
- * Note: Initializes the serial port using the IO context from ASIO::getIOContext().
+ * Note: Initializes the serial port using a new strand of \p pIOContext (see ASIO::getIOContext(int)),
+ * such that the asynchronous handlers of this port never run concurrently.
  *
  * \param pPort %Device name of the serial port to be used.
  * \param pReadTermination Termination sequence for non-sized read operations.
  * \param pWriteTermination Termination sequence to append for write operations.
  * \param pBaudRate Baud rate to be used for the serial connection.
+ * \param pReadChunkSize Non-zero maximum number of bytes to be transferred by a single asynchronous read operation.
+ * \param pLatencyOptions Line settings to reduce the response latency (see applyLatencyOptions()).
+ * \param pIOContext IO context to be used for the serial port.
  */
 SerialPortWrapper::SerialPortWrapper(std::string pPort, const std::string& pReadTermination, const std::string& pWriteTermination,
-                                     const int pBaudRate) :
+                                     const int pBaudRate, const std::size_t pReadChunkSize, const LatencyOptions& pLatencyOptions,
+                                     boost::asio::io_context& pIOContext) :
     port(std::move(pPort)),
     readTermination(Bytes::byteVecFromStr(pReadTermination)),
     readTerminationLength(readTermination.size()),
     writeTermination(Bytes::byteVecFromStr(pWriteTermination)),
     writeTerminationLength(writeTermination.size()),
     baudRate(pBaudRate),
-    serialPort(ASIO::getIOContext()),
+    readChunkSize(pReadChunkSize),
+    latencyOptions(pLatencyOptions),
+    serialPort(boost::asio::make_strand(pIOContext)),
     readBuffer(),
-    intermediateReadBuffer(),
+    intermediateReadBuffers{std::vector<std::uint8_t>(readChunkSize), std::vector<std::uint8_t>(readChunkSize)},
     readBufferMutex(),
     pollData(false),
     pollDataStopped(false),
-    newData(false),
+    termScanPos(0),
+    termFound(false),
+    termWaiting(false),
+    sizeWaiting(std::numeric_limits<std::size_t>::max()),
     newDataCondVar(),
+    frameHandler(),
+    frameHandlerMutex(),
+    frameDispatchBuffer(),
+    frameDispatchEnds(),
     bufferErrorCount(0)
 {
 }
@@ -114,32 +142,19 @@ std::vector<std::uint8_t> SerialPortWrapper::read(const int pSize)
     std::unique_lock<std::mutex> bufferLock(readBufferMutex);
     (void)bufferLock;
 
-    auto waitForNewData = [this, &bufferLock]() -> void
-    {
-        newData = false;
-        newDataCondVar.wait(bufferLock, [this](){ return newData; });
-    };
-
     if (pSize == -1)
     {
-        auto termPos = std::search(readBuffer.begin(), readBuffer.end(), readTermination.begin(), readTermination.end());
+        waitForReadable(bufferLock, 0);
 
-        while (termPos == readBuffer.end())
-        {
-            waitForNewData();
-            termPos = std::search(readBuffer.begin(), readBuffer.end(), readTermination.begin(), readTermination.end());
-        }
-
-        std::vector<std::uint8_t> retVal(readBuffer.begin(), termPos);
+        std::vector<std::uint8_t> retVal(readBuffer.begin(), readBuffer.begin() + termScanPos);
 
-        readBuffer.erase(readBuffer.begin(), termPos + readTerminationLength);
+        consumeReadBuffer(termScanPos + readTerminationLength);
 
         return retVal;
     }
     else if (pSize > 0)
     {
-        while (std::cmp_less(readBuffer.size(), pSize))
-            waitForNewData();
+        waitForReadable(bufferLock, static_cast<std::size_t>(pSize));
 
         if (std::cmp_equal(readBuffer.size(), pSize))
         {
@@ -147,13 +162,16 @@ std::vector<std::uint8_t> SerialPortWrapper::read(const int pSize)
 
             retVal.swap(readBuffer);
 
+            termScanPos = 0;
+            termFound = false;
+
             return retVal;
         }
         else
         {
             std::vector<std::uint8_t> retVal(readBuffer.begin(), readBuffer.begin() + pSize);
 
-            readBuffer.erase(readBuffer.begin(), readBuffer.begin() + pSize);
+            consumeReadBuffer(pSize);
 
             return retVal;
         }
@@ -177,14 +195,7 @@ std::vector<std::uint8_t> SerialPortWrapper::readMax(const int pSize)
         std::unique_lock<std::mutex> bufferLock(readBufferMutex);
         (void)bufferLock;
 
-        auto waitForNewData = [this, &bufferLock]() -> void
-        {
-            newData = false;
-            newDataCondVar.wait(bufferLock, [this](){ return newData; });
-        };
-
-        while (readBuffer.size() == 0)
-            waitForNewData();
+        waitForReadable(bufferLock, 1);
 
         std::size_t readNum = std::min(readBuffer.size(), static_cast<std::size_t>(pSize));
 
@@ -194,13 +205,16 @@ std::vector<std::uint8_t> SerialPortWrapper::readMax(const int pSize)
 
             retVal.swap(readBuffer);
 
+            termScanPos = 0;
+            termFound = false;
+
             return retVal;
         }
         else
         {
             std::vector<std::uint8_t> retVal(readBuffer.begin(), readBuffer.begin() + readNum);
 
-            readBuffer.erase(readBuffer.begin(), readBuffer.begin() + readNum);
+            consumeReadBuffer(readNum);
 
             return retVal;
         }
@@ -209,6 +223,93 @@ std::vector<std::uint8_t> SerialPortWrapper::readMax(const int pSize)
         return {};
 }
 
+/*!
+ * \brief Read an amount of bytes from the read buffer, or until read termination, into a buffer.
+ *
+ * Works like read() but writes the read bytes to \p pBuffer instead of returning a newly allocated byte sequence.
+ *
+ * If \p pSize is positive, it must not exceed the size of \p pBuffer. If \p pSize is -1, the read data (excluding
+ * the read termination) must fit into \p pBuffer; otherwise an exception is thrown and the data is kept in the read buffer.
+ *
+ * \throws std::runtime_error If \p pSize exceeds the size of \p pBuffer.
+ * \throws std::runtime_error If reading until termination and the read data does not fit into \p pBuffer.
+ *
+ * \param pBuffer Buffer for the read bytes.
+ * \param pSize Number of bytes to read or -1.
+ * \return Number of bytes written to \p pBuffer.
+ */
+std::size_t SerialPortWrapper::readInto(const std::span<std::uint8_t> pBuffer, const int pSize)
+{
+    if (std::cmp_greater(pSize, pBuffer.size()))
+        throw std::runtime_error("Exception while reading from serial port: Requested size exceeds the buffer size.");
+
+    std::unique_lock<std::mutex> bufferLock(readBufferMutex);
+    (void)bufferLock;
+
+    if (pSize == -1)
+    {
+        waitForReadable(bufferLock, 0);
+
+        const std::size_t numData = termScanPos;
+
+        if (numData > pBuffer.size())
+            throw std::runtime_error("Exception while reading from serial port: Read data does not fit into the buffer.");
+
+        std::copy(readBuffer.begin(), readBuffer.begin() + numData, pBuffer.begin());
+
+        consumeReadBuffer(numData + readTerminationLength);
+
+        return numData;
+    }
+    else if (pSize > 0)
+    {
+        waitForReadable(bufferLock, static_cast<std::size_t>(pSize));
+
+        std::copy(readBuffer.begin(), readBuffer.begin() + pSize, pBuffer.begin());
+
+        consumeReadBuffer(pSize);
+
+        return static_cast<std::size_t>(pSize);
+    }
+    else
+        return 0;
+}
+
+/*!
+ * \brief Read all currently available bytes into a buffer without waiting.
+ *
+ * Moves as many bytes from the front of the read buffer to \p pBuffer as currently available, but maximally
+ * the size of \p pBuffer. Returns immediately, also if no data is available. The read termination is not
+ * interpreted, i.e. this is intended for throughput-oriented consumers of continuous (binary) data streams.
+ *
+ * \param pBuffer Buffer for the read bytes.
+ * \return Number of bytes written to \p pBuffer.
+ */
+std::size_t SerialPortWrapper::readAvailable(const std::span<std::uint8_t> pBuffer)
+{
+    const std::lock_guard<std::mutex> bufferLock(readBufferMutex);
+    (void)bufferLock;
+
+    const std::size_t readNum = std::min(readBuffer.size(), pBuffer.size());
+
+    if (readNum == 0)
+        return 0;
+
+    std::copy(readBuffer.begin(), readBuffer.begin() + readNum, pBuffer.begin());
+
+    if (readNum == readBuffer.size())
+    {
+        readBuffer.clear();
+
+        termScanPos = 0;
+        termFound = false;
+    }
+    else
+        consumeReadBuffer(readNum);
+
+    return readNum;
+}
+
 /*!
  * \brief Write data to the port (automatically terminated).
  *
@@ -255,6 +356,44 @@ void SerialPortWrapper::clearReadBuffer()
     (void)bufferLock;
 
     readBuffer.clear();
+
+    termScanPos = 0;
+    termFound = false;
+}
+
+//
+
+/*!
+ * \brief Register a callback to be invoked for every terminated frame.
+ *
+ * If a frame handler \p pHandler is set, every frame arriving at the serial port that is completed by the configured
+ * read termination is removed from the read buffer and passed to \p pHandler (excluding the termination) instead.
+ * Non-terminated reads (see read()) will then only see data of the yet incomplete frame. Pass an empty function
+ * to remove the handler again.
+ *
+ * The handler is invoked from the (strand of the) IO context thread that polls the serial port and without holding
+ * the read buffer lock. It should return quickly, since no new data is processed while it is running.
+ * The passed sequence is only valid for the duration of the call.
+ *
+ * The handler can also be replaced or removed while read buffer polling is running. This waits until a currently running
+ * call of the previous handler has finished, i.e. the previous handler is not called anymore once this function returns.
+ * Frames that are already in the read buffer when setting a handler are passed to it with the next incoming data.
+ *
+ * Note: Must not be called from within the frame handler itself.
+ *
+ * \throws std::runtime_error If \p pHandler is non-empty and the read termination is empty.
+ *
+ * \param pHandler Callback for the terminated frames.
+ */
+void SerialPortWrapper::setFrameHandler(FrameHandler pHandler)
+{
+    if (pHandler && readTerminationLength == 0)
+        throw std::runtime_error("Cannot set frame handler for serial port without read termination.");
+
+    const std::lock_guard<std::mutex> handlerLock(frameHandlerMutex);
+    (void)handlerLock;
+
+    frameHandler = std::move(pHandler);
 }
 
 //
@@ -262,11 +401,12 @@ void SerialPortWrapper::clearReadBuffer()
 /*!
  * \brief Open the serial port and start continuous read buffer polling.
  *
- * Opens the serial port using the configured device name, sets the configured baud rate
- * and enables continuous read buffer polling and starts it by calling pollReadBuffer().
+ * Opens the serial port using the configured device name, sets the configured baud rate and latency options
+ * (see applyLatencyOptions()) and enables continuous read buffer polling and starts it by calling pollReadBuffer().
  *
  * \throws std::runtime_error If no IO context threads are running (see ASIO::ioContextThreadsRunning()).
  * \throws std::runtime_error If opening the serial port or setting the baud rate fails.
+ * \throws std::runtime_error If applyLatencyOptions() throws \c std::runtime_error.
  */
 void SerialPortWrapper::init()
 {
@@ -291,11 +431,22 @@ void SerialPortWrapper::init()
         throw std::runtime_error(std::string("Exception while setting baud rate for serial port: ") + exc.what());
     }
 
+    try
+    {
+        applyLatencyOptions();
+    }
+    catch (const std::runtime_error&)
+    {
+        boost::system::error_code errorCode;
+        serialPort.close(errorCode);
+        throw;
+    }
+
     pollData.store(true);
     pollDataStopped.store(false);
     bufferErrorCount.store(0);
 
-    pollReadBuffer();
+    pollReadBuffer(0);
 }
 
 /*!
@@ -327,39 +478,132 @@ void SerialPortWrapper::close()
 
 //Private
 
+/*!
+ * \brief Apply the configured latency options.
+ *
+ * Sets the \c VMIN and \c VTIME terminal settings of the open serial port, if configured (non-negative). As the port
+ * is read asynchronously (non-blocking), \c VMIN (with \c VTIME being zero) only defines how many received bytes make
+ * the port readable, i.e. \c VMIN = 1 and \c VTIME = 0 pass on every received byte without delay.
+ *
+ * Sets the \c ASYNC_LOW_LATENCY flag of the serial driver, if enabled, such that received data is passed on immediately.
+ *
+ * Writes the latency timer of the USB-serial adapter to its sysfs attribute, if configured (non-negative). This is the
+ * time that FTDI adapters wait for more data before sending an incomplete USB packet (16 ms by default), which otherwise
+ * dominates the duration of short queries. The attribute is found via the device name of the port (after resolving
+ * symbolic links such as "/dev/serial/by-id/...").
+ *
+ * As setting the driver flag or the latency timer is not possible for every port/adapter and may require privileges
+ * (write access to the sysfs attribute), only a warning is logged on failure (as on platforms other than Linux).
+ *
+ * \throws std::runtime_error If \c VMIN or \c VTIME exceed 255 or setting them fails.
+ */
+void SerialPortWrapper::applyLatencyOptions()
+{
+#if BOOST_OS_LINUX != 0
+    const int fd = serialPort.native_handle();
+
+    if (latencyOptions.vMin >= 0 || latencyOptions.vTime >= 0)
+    {
+        if (latencyOptions.vMin > 255 || latencyOptions.vTime > 255)
+            throw std::runtime_error("VMIN/VTIME for serial port \"" + port + "\" must not exceed 255.");
+
+        termios tios {};
+
+        if (::tcgetattr(fd, &tios) != 0)
+            throw std::runtime_error("Could not get terminal settings of serial port \"" + port + "\": " + std::strerror(errno));
+
+        if (latencyOptions.vMin >= 0)
+            tios.c_cc[VMIN] = static_cast<cc_t>(latencyOptions.vMin);
+        if (latencyOptions.vTime >= 0)
+            tios.c_cc[VTIME] = static_cast<cc_t>(latencyOptions.vTime);
+
+        if (::tcsetattr(fd, TCSANOW, &tios) != 0)
+            throw std::runtime_error("Could not set VMIN/VTIME for serial port \"" + port + "\": " + std::strerror(errno));
+    }
+
+    if (latencyOptions.lowLatency)
+    {
+        serial_struct serialInfo {};
+
+        if (::ioctl(fd, TIOCGSERIAL, &serialInfo) != 0)
+            Logger::logWarning("Could not enable low-latency mode for serial port \"" + port + "\": " + std::strerror(errno));
+        else
+        {
+            serialInfo.flags |= ASYNC_LOW_LATENCY;
+
+            if (::ioctl(fd, TIOCSSERIAL, &serialInfo) != 0)
+                Logger::logWarning("Could not enable low-latency mode for serial port \"" + port + "\": " + std::strerror(errno));
+        }
+    }
+
+    if (latencyOptions.latencyTimer >= 0)
+    {
+        std::error_code errorCode;
+        const std::filesystem::path devicePath = std::filesystem::canonical(port, errorCode);
+
+        const std::filesystem::path timerPath = std::filesystem::path("/sys/class/tty") / devicePath.filename() / "device" / "latency_timer";
+
+        std::ofstream timerFile;
+
+        if (!errorCode)
+            timerFile.open(timerPath);
+
+        if (timerFile.is_open())
+            timerFile<<latencyOptions.latencyTimer<<std::flush;
+
+        if (!timerFile.is_open() || !timerFile.good())
+            Logger::logWarning("Could not set latency timer for serial port \"" + port + "\" (adapter without latency timer or "
+                               "missing write access to \"" + timerPath.string() + "\").");
+    }
+#else
+    if (latencyOptions.lowLatency || latencyOptions.latencyTimer >= 0 || latencyOptions.vMin >= 0 || latencyOptions.vTime >= 0)
+        Logger::logWarning("Serial port latency options are not supported on this platform.");
+#endif
+}
+
+//
+
 /*!
  * \brief Issue an async read to poll the serial port (handler is handleAsyncRead()).
  *
- * Starts an asynchronous operation to read at least one byte from the serial port
- * into an intermediate buffer and process those read bytes by handleAsyncRead().
+ * Starts an asynchronous operation to read at least one and up to the configured read chunk size of bytes
+ * from the serial port into one of the two intermediate buffers and process those read bytes by handleAsyncRead().
+ *
+ * \param pBufferIdx Index (0 or 1) of the intermediate buffer to be used.
  */
-void SerialPortWrapper::pollReadBuffer()
+void SerialPortWrapper::pollReadBuffer(const std::size_t pBufferIdx)
 {
-    boost::asio::async_read(serialPort, boost::asio::dynamic_buffer(intermediateReadBuffer), boost::asio::transfer_at_least(1),
-                            std::bind(&SerialPortWrapper::handleAsyncRead, this, std::placeholders::_1 ,std::placeholders::_2));
+    serialPort.async_read_some(boost::asio::buffer(intermediateReadBuffers[pBufferIdx]),
+                               std::bind(&SerialPortWrapper::handleAsyncRead, this, pBufferIdx, std::placeholders::_1, std::placeholders::_2));
 }
 
 /*!
- * \brief Fill read buffer from single poll by pollReadBuffer() and issue next poll.
+ * \brief Issue next poll and fill read buffer from single poll by pollReadBuffer().
+ *
+ * If continuous polling is enabled (see init() / close()), first initiates the next asynchronous read into
+ * the \e other intermediate buffer by calling pollReadBuffer(), such that the port is already read again while
+ * the current chunk is processed (double-buffering). Since the handlers never run concurrently (see
+ * SerialPortWrapper()), the intermediate buffer \p pBufferIdx cannot be reused before this handler has finished.
  *
- * Appends the \p pNumBytes bytes read into the intermediate read buffer (see pollReadBuffer()) to the (actual) read buffer.
+ * Then appends the \p pNumBytes bytes read into the intermediate buffer \p pBufferIdx to the (actual) read buffer.
+ * Waiting readers (see waitForReadable()) are only woken up if their waiting condition got fulfilled by the new data,
+ * where the read termination is searched for incrementally (see scanForTermination()).
  *
- * If continuous polling is enabled (see init() / close()), initiates the next asynchronous read by calling pollReadBuffer().
+ * If a frame handler is set (see setFrameHandler()), all newly completed frames are removed from
+ * the read buffer and passed to the frame handler (see also dispatchFrames()).
  *
  * If \p pErrorCode signals an error (other than the socket being cancelled), the error gets logged (see Logger)
  * and the current polling error count gets incremented. Continuous polling gets disabled automatically
  * as soon as this error count exceeds a fixed maximum threshold (see \ref maxBufferErrorCount).
  *
+ * \param pBufferIdx Index (0 or 1) of the intermediate buffer that was read into.
  * \param pErrorCode Result/error code of the handled async read.
  * \param pNumBytes Number of successfully transferred bytes.
  */
-void SerialPortWrapper::handleAsyncRead(const boost::system::error_code& pErrorCode, const std::size_t pNumBytes)
+void SerialPortWrapper::handleAsyncRead(const std::size_t pBufferIdx, const boost::system::error_code& pErrorCode, const std::size_t pNumBytes)
 {
     if (pErrorCode.value() != boost::system::errc::success && pErrorCode.value() != boost::system::errc::operation_canceled)
     {
-        if (intermediateReadBuffer.size() > pNumBytes)
-            intermediateReadBuffer.resize(pNumBytes);
-
         Logger::logError("Exception while reading from serial port \"" + port + "\": " + pErrorCode.message());
 
         if (++bufferErrorCount > maxBufferErrorCount)
@@ -369,26 +613,180 @@ void SerialPortWrapper::handleAsyncRead(const boost::system::error_code& pErrorC
         }
     }
 
+    const bool continuePolling = pollData.load();
+
+    if (continuePolling)
+        pollReadBuffer(1 - pBufferIdx);
+
     if (pNumBytes > 0)
     {
-        const std::lock_guard<std::mutex> bufferLock(readBufferMutex);
+        const std::vector<std::uint8_t>& chunk = intermediateReadBuffers[pBufferIdx];
+
+        const std::lock_guard<std::mutex> handlerLock(frameHandlerMutex);
+        (void)handlerLock;
+
+        std::unique_lock<std::mutex> bufferLock(readBufferMutex);
         (void)bufferLock;
 
-        readBuffer.insert(readBuffer.end(), intermediateReadBuffer.begin(), intermediateReadBuffer.end());
+        readBuffer.insert(readBuffer.end(), chunk.begin(), chunk.begin() + pNumBytes);
 
-        intermediateReadBuffer.clear();
+        if (frameHandler)
+            dispatchFrames();
 
-        newData = true;
-        newDataCondVar.notify_one();
+        bool wakeReaders = false;
+
+        if (termWaiting && scanForTermination())
+        {
+            termWaiting = false;
+            wakeReaders = true;
+        }
+
+        if (readBuffer.size() >= sizeWaiting)
+        {
+            sizeWaiting = std::numeric_limits<std::size_t>::max();
+            wakeReaders = true;
+        }
+
+        bufferLock.unlock();
+
+        if (wakeReaders)
+            newDataCondVar.notify_all();
+
+        if (!frameDispatchEnds.empty())
+        {
+            std::size_t frameBegin = 0;
+
+            for (const std::size_t frameEnd : frameDispatchEnds)
+            {
+                frameHandler(std::span<const std::uint8_t>(frameDispatchBuffer.data() + frameBegin, frameEnd - frameBegin));
+                frameBegin = frameEnd;
+            }
+
+            frameDispatchBuffer.clear();
+            frameDispatchEnds.clear();
+        }
     }
 
-    if (pollData.load())
-        pollReadBuffer();
-    else
+    if (!continuePolling)
     {
         pollDataStopped.store(true);
         pollDataStopped.notify_one();
     }
 }
 
+//
+
+/*!
+ * \brief Incrementally search the read buffer for the next read termination.
+ *
+ * Continues the search from the position where the previous search stopped (see \ref termScanPos), such that every
+ * arriving byte is only scanned once (apart from the last few bytes that might belong to a partial termination).
+ *
+ * Note: The read buffer mutex must be locked by the caller.
+ *
+ * \return True if the read buffer contains a termination (which then starts at \ref termScanPos).
+ */
+bool SerialPortWrapper::scanForTermination()
+{
+    if (termFound)
+        return true;
+
+    const auto termPos = std::search(readBuffer.begin() + termScanPos, readBuffer.end(), readTermination.begin(), readTermination.end());
+
+    if (termPos != readBuffer.end())
+    {
+        termScanPos = termPos - readBuffer.begin();
+        termFound = true;
+        return true;
+    }
+
+    //Keep the (partial) termination candidate at the end for the next search
+    if (readTerminationLength > 0 && readBuffer.size() >= readTerminationLength)
+        termScanPos = std::max(termScanPos, readBuffer.size() - readTerminationLength + 1);
+
+    return false;
+}
+
+/*!
+ * \brief Remove bytes from the front of the read buffer and update the scan position.
+ *
+ * Erases the first \p pNumBytes bytes of the read buffer and shifts the termination scan position
+ * (see scanForTermination()) accordingly, or resets it if the consumed bytes overlap with the scanned region.
+ *
+ * Note: The read buffer mutex must be locked by the caller.
+ *
+ * \param pNumBytes Number of bytes to remove.
+ */
+void SerialPortWrapper::consumeReadBuffer(const std::size_t pNumBytes)
+{
+    readBuffer.erase(readBuffer.begin(), readBuffer.begin() + pNumBytes);
+
+    if (pNumBytes <= termScanPos)
+        termScanPos -= pNumBytes;
+    else
+    {
+        termScanPos = 0;
+        termFound = false;
+    }
+}
+
+/*!
+ * \brief Move all complete frames from the read buffer to the frame dispatch buffer.
+ *
+ * Moves all terminated frames (excluding the terminations) from the read buffer to the frame dispatch buffer
+ * and records their boundaries. The frames are passed to \ref frameHandler afterwards by handleAsyncRead().
+ *
+ * Note: The read buffer mutex must be locked by the caller.
+ */
+void SerialPortWrapper::dispatchFrames()
+{
+    std::size_t frameBegin = 0;
+
+    while (scanForTermination())
+    {
+        frameDispatchBuffer.insert(frameDispatchBuffer.end(), readBuffer.begin() + frameBegin, readBuffer.begin() + termScanPos);
+        frameDispatchEnds.push_back(frameDispatchBuffer.size());
+
+        frameBegin = termScanPos + readTerminationLength;
+
+        termScanPos = frameBegin;
+        termFound = false;
+    }
+
+    if (frameBegin > 0)
+        consumeReadBuffer(frameBegin);
+}
+
+/*!
+ * \brief Wait until a frame or an amount of bytes is available in the read buffer.
+ *
+ * Waits until the read buffer contains a read termination if \p pSize is zero
+ * or until the read buffer contains at least \p pSize bytes otherwise.
+ *
+ * The waiting condition is registered such that handleAsyncRead() only wakes waiting readers
+ * once the condition can be fulfilled, instead of for every single chunk of arriving data.
+ *
+ * \param pBufferLock Lock that holds the read buffer mutex.
+ * \param pSize Number of bytes to wait for or zero to wait for the read termination.
+ */
+void SerialPortWrapper::waitForReadable(std::unique_lock<std::mutex>& pBufferLock, const std::size_t pSize)
+{
+    if (pSize == 0)
+    {
+        while (!scanForTermination())
+        {
+            termWaiting = true;
+            newDataCondVar.wait(pBufferLock);
+        }
+    }
+    else
+    {
+        while (readBuffer.size() < pSize)
+        {
+            sizeWaiting = std::min(sizeWaiting, pSize);
+            newDataCondVar.wait(pBufferLock);
+        }
+    }
+}
+
 /// \endcond INTERNAL
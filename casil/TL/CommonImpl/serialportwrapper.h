@@ -24,14 +24,18 @@
 #ifndef CASIL_LAYERS_TL_COMMONIMPL_SERIALPORTWRAPPER_H
 #define CASIL_LAYERS_TL_COMMONIMPL_SERIALPORTWRAPPER_H
 
+#include <boost/asio/io_context.hpp>
 #include <boost/asio/serial_port.hpp>
 #include <boost/system/error_code.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -54,7 +58,24 @@ namespace CommonImpl
 class SerialPortWrapper
 {
 public:
-    SerialPortWrapper(std::string pPort, const std::string& pReadTermination, const std::string& pWriteTermination, int pBaudRate);
+    typedef std::function<void(std::span<const std::uint8_t>)> FrameHandler;   ///< Callback type for terminated frames (excluding termination).
+
+    /*!
+     * \brief Optional line settings to reduce the response latency (see init()).
+     *
+     * Negative values leave the respective setting unchanged.
+     */
+    struct LatencyOptions
+    {
+        bool lowLatency;        ///< Set the \c ASYNC_LOW_LATENCY flag of the serial driver (Linux only).
+        int latencyTimer;       ///< Latency timer of the USB-serial adapter in milliseconds (FTDI adapters on Linux only).
+        int vMin;               ///< Minimum number of bytes that makes the port readable (\c VMIN).
+        int vTime;              ///< Inter-byte timeout in deciseconds (\c VTIME).
+    };
+
+public:
+    SerialPortWrapper(std::string pPort, const std::string& pReadTermination, const std::string& pWriteTermination, int pBaudRate,
+                      std::size_t pReadChunkSize, const LatencyOptions& pLatencyOptions, boost::asio::io_context& pIOContext);
                                                                 ///< Constructor.
     SerialPortWrapper(const SerialPortWrapper&) = delete;       ///< Deleted copy constructor.
     SerialPortWrapper(SerialPortWrapper&&) = delete;            ///< Deleted move constructor.
@@ -65,19 +86,36 @@ public:
     //
     std::vector<std::uint8_t> read(int pSize);                  ///< Read an amount of bytes from the read buffer, or until read termination.
     std::vector<std::uint8_t> readMax(int pSize);               ///< Read maximally some amount of bytes from the read buffer.
+    std::size_t readInto(std::span<std::uint8_t> pBuffer, int pSize);  ///< \brief Read an amount of bytes from the read buffer,
+                                                                        ///  or until read termination, into a buffer.
+    std::size_t readAvailable(std::span<std::uint8_t> pBuffer);  ///< Read all currently available bytes into a buffer without waiting.
     void write(const std::vector<std::uint8_t>& pData);         ///< Write data to the port (automatically terminated).
     //
     bool readBufferEmpty() const;                               ///< Check if the read buffer is empty.
     void clearReadBuffer();                                     ///< Clear the current contents of the read buffer.
     //
+    void setFrameHandler(FrameHandler pHandler);                ///< Register a callback to be invoked for every terminated frame.
+    //
     void init();                                                ///< Open the serial port and start continuous read buffer polling.
     void close();                                               ///< Stop the continuous read buffer polling and close the serial port.
 
 private:
-    void pollReadBuffer();                                                                      ///< \brief Issue an async read to poll the
+    void applyLatencyOptions();                                                                 ///< Apply the configured latency options.
+    //
+    void pollReadBuffer(std::size_t pBufferIdx);                                                ///< \brief Issue an async read to poll the
                                                                                                 ///  serial port (handler is handleAsyncRead()).
-    void handleAsyncRead(const boost::system::error_code& pErrorCode, std::size_t pNumBytes);   ///< \brief Fill read buffer from single poll
-                                                                                                ///  by pollReadBuffer() and issue next poll.
+    void handleAsyncRead(std::size_t pBufferIdx, const boost::system::error_code& pErrorCode,
+                         std::size_t pNumBytes);                                                ///< \brief Issue next poll and fill read buffer
+                                                                                                ///  from single poll by pollReadBuffer().
+    //
+    bool scanForTermination();                                                                  ///< \brief Incrementally search the read buffer
+                                                                                                ///  for the next read termination.
+    void consumeReadBuffer(std::size_t pNumBytes);                                              ///< \brief Remove bytes from the front of the
+                                                                                                ///  read buffer and update the scan position.
+    void dispatchFrames();                                                                      ///< \brief Move all complete frames from the
+                                                                                                ///  read buffer to the frame dispatch buffer.
+    void waitForReadable(std::unique_lock<std::mutex>& pBufferLock, std::size_t pSize);         ///< \brief Wait until a frame or an amount of
+                                                                                                ///  bytes is available in the read buffer.
 
 private:
     const std::string port;                                 ///< %Serial port identifier (e.g. device file).
@@ -86,16 +124,29 @@ private:
     const std::vector<std::uint8_t> writeTermination;       ///< Write termination to append to written data.
     const std::size_t writeTerminationLength;               ///< Number of write termination bytes.
     const int baudRate;                                     ///< Baud rate setting.
+    const std::size_t readChunkSize;                        ///< Maximum number of bytes transferred by a single asynchronous read.
+    const LatencyOptions latencyOptions;                    ///< Line settings to reduce the response latency.
     //
     boost::asio::serial_port serialPort;                    ///< %Serial port.
     //
     std::vector<std::uint8_t> readBuffer;                   ///< Buffer for incoming data.
-    std::vector<std::uint8_t> intermediateReadBuffer;       ///< Intermediate read buffer to facilitate the asynchronous polling.
+    std::array<std::vector<std::uint8_t>, 2> intermediateReadBuffers;  ///< \brief Alternately used intermediate read buffers to facilitate
+                                                                        ///  the asynchronous polling (double-buffering).
     mutable std::mutex readBufferMutex;                     ///< Mutex for the read buffer (\ref readBuffer).
     std::atomic_bool pollData;                              ///< Flag to control/stop the read buffer polling.
     std::atomic_bool pollDataStopped;                       ///< Flag to signal stopped read buffer polling (last handler finished).
-    bool newData;                                           ///< New read buffer data available from polling handler.
-    std::condition_variable newDataCondVar;                 ///< Condition variable for \ref newData.
+    std::size_t termScanPos;                                ///< \brief Read buffer position up to which no termination starts or, if
+                                                            ///  \ref termFound, position of the first termination.
+    bool termFound;                                         ///< Read buffer contains a termination at \ref termScanPos.
+    bool termWaiting;                                       ///< A reader is waiting for a terminated frame.
+    std::size_t sizeWaiting;                                ///< Smallest read buffer size any sized reader is waiting for.
+    std::condition_variable newDataCondVar;                 ///< Condition variable to wake waiting readers.
+    //
+    FrameHandler frameHandler;                              ///< Callback for terminated frames (see setFrameHandler()).
+    std::mutex frameHandlerMutex;                           ///< \brief Mutex for \ref frameHandler and the frame dispatching
+                                                            ///  (lock before \ref readBufferMutex).
+    std::vector<std::uint8_t> frameDispatchBuffer;          ///< Reused buffer for (concatenated) frames passed to \ref frameHandler.
+    std::vector<std::size_t> frameDispatchEnds;             ///< End positions of the frames in \ref frameDispatchBuffer.
     std::atomic_size_t bufferErrorCount;                    ///< Current error count of the read buffer polling handler.
 
 private:
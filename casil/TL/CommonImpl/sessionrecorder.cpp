@@ -0,0 +1,237 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/CommonImpl/sessionrecorder.h>
+
+#include <casil/bytes.h>
+
+#include <algorithm>
+#include <ios>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+/// \cond INTERNAL
+
+using casil::Layers::TL::CommonImpl::SessionRecorder;
+using casil::Layers::TL::ReplayMuxedInterface;
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Note: Does not open the session file yet (see open()).
+ *
+ * \throws std::invalid_argument If \p pFilePath is empty.
+ *
+ * \param pFilePath Path of the session file.
+ */
+SessionRecorder::SessionRecorder(std::string pFilePath) :
+    filePath(std::move(pFilePath)),
+    file(),
+    sessionStartTime(),
+    entryBuffer(),
+    failed(false),
+    mutex()
+{
+    if (filePath == "")
+        throw std::invalid_argument("Empty path for session file.");
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Calls close() and ignores possible errors.
+ */
+SessionRecorder::~SessionRecorder()
+{
+    try
+    {
+        close();
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+}
+
+//Public
+
+/*!
+ * \brief Start a new session file.
+ *
+ * Closes the current session file (see close()), truncates/creates the file, writes the file header
+ * and sets the session start time (the reference for the recorded start times) to now.
+ *
+ * \throws std::runtime_error If closing the current or opening the new session file fails.
+ */
+void SessionRecorder::open()
+{
+    close();
+
+    const std::lock_guard<std::mutex> recordLock(mutex);
+    (void)recordLock;
+
+    std::vector<std::uint8_t> header(ReplayMuxedInterface::sessionFileMagic.begin(), ReplayMuxedInterface::sessionFileMagic.end());
+    Bytes::composeBytesTo(std::back_inserter(header), false, ReplayMuxedInterface::sessionFileVersion);
+
+    file.clear();
+    file.open(filePath, std::ios_base::binary | std::ios_base::trunc);
+    file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+
+    if (!file)
+    {
+        file.close();
+        throw std::runtime_error("Could not open session file \"" + filePath + "\".");
+    }
+
+    sessionStartTime = std::chrono::steady_clock::now();
+    failed = false;
+}
+
+/*!
+ * \brief Write all pending entries and close the session file.
+ *
+ * Does nothing if no file is open.
+ *
+ * \throws std::runtime_error If writing or closing the file fails.
+ */
+void SessionRecorder::close()
+{
+    const std::lock_guard<std::mutex> recordLock(mutex);
+    (void)recordLock;
+
+    if (!file.is_open())
+        return;
+
+    file.close();
+
+    if (file.fail())
+        throw std::runtime_error("Could not close session file \"" + filePath + "\".");
+}
+
+/*!
+ * \brief Check if a session file is open.
+ *
+ * \return True if open.
+ */
+bool SessionRecorder::isOpen() const
+{
+    const std::lock_guard<std::mutex> recordLock(mutex);
+    (void)recordLock;
+
+    return file.is_open();
+}
+
+/*!
+ * \brief Check if writing the session file failed.
+ *
+ * The flag is reset by open().
+ *
+ * \return True if recording stopped because of a write error.
+ */
+bool SessionRecorder::hasFailed() const
+{
+    const std::lock_guard<std::mutex> recordLock(mutex);
+    (void)recordLock;
+
+    return failed;
+}
+
+//
+
+/*!
+ * \brief Record a completed read transaction.
+ *
+ * Does nothing if no file is open.
+ *
+ * \param pStartTime Start time of the transaction (the duration is measured until now).
+ * \param pAddr Bus address.
+ * \param pSize Requested number of bytes.
+ * \param pData Read bytes.
+ */
+void SessionRecorder::recordRead(const std::chrono::steady_clock::time_point pStartTime, const std::uint64_t pAddr, const int pSize,
+                                 const std::span<const std::uint8_t> pData)
+{
+    record(pStartTime, ReplayMuxedInterface::Transaction::Type::Read, pAddr, pSize, pData);
+}
+
+/*!
+ * \brief Record a completed write transaction.
+ *
+ * Does nothing if no file is open.
+ *
+ * \param pStartTime Start time of the transaction (the duration is measured until now).
+ * \param pAddr Bus address.
+ * \param pData Written bytes.
+ */
+void SessionRecorder::recordWrite(const std::chrono::steady_clock::time_point pStartTime, const std::uint64_t pAddr,
+                                  const std::span<const std::uint8_t> pData)
+{
+    record(pStartTime, ReplayMuxedInterface::Transaction::Type::Write, pAddr, 0, pData);
+}
+
+//Private
+
+/*!
+ * \brief Append an entry to the session file.
+ *
+ * Composes the entry (see ReplayMuxedInterface for the format) and appends it to the file.
+ * Closes the file and sets the failure flag (see hasFailed()) if writing fails.
+ *
+ * \param pStartTime Start time of the transaction.
+ * \param pType Transaction type.
+ * \param pAddr Bus address.
+ * \param pSize Requested read size.
+ * \param pData Read or written bytes.
+ */
+void SessionRecorder::record(const std::chrono::steady_clock::time_point pStartTime, const ReplayMuxedInterface::Transaction::Type pType,
+                             const std::uint64_t pAddr, const int pSize, const std::span<const std::uint8_t> pData)
+{
+    const std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+
+    const std::lock_guard<std::mutex> recordLock(mutex);
+    (void)recordLock;
+
+    if (!file.is_open())
+        return;
+
+    const auto startOffset = std::chrono::duration_cast<std::chrono::nanoseconds>(std::max(pStartTime, sessionStartTime) - sessionStartTime);
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - std::max(pStartTime, sessionStartTime));
+
+    entryBuffer.clear();
+    Bytes::composeBytesTo(std::back_inserter(entryBuffer), false, static_cast<std::uint64_t>(startOffset.count()),
+                          static_cast<std::uint64_t>(duration.count()), static_cast<std::uint8_t>(pType), pAddr,
+                          static_cast<std::uint32_t>(pSize), static_cast<std::uint32_t>(pData.size()));
+
+    file.write(reinterpret_cast<const char*>(entryBuffer.data()), static_cast<std::streamsize>(entryBuffer.size()));
+    file.write(reinterpret_cast<const char*>(pData.data()), static_cast<std::streamsize>(pData.size()));
+
+    if (!file)
+    {
+        failed = true;
+        file.close();
+    }
+}
+
+/// \endcond INTERNAL
@@ -0,0 +1,101 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_COMMONIMPL_SESSIONRECORDER_H
+#define CASIL_LAYERS_TL_COMMONIMPL_SESSIONRECORDER_H
+
+#include <casil/TL/Muxed/replaymuxedinterface.h>
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/// \cond INTERNAL
+namespace CommonImpl
+{
+
+/*!
+ * \brief Thread-safe writer for recording the bus transactions of a MuxedInterface session to a binary file.
+ *
+ * Records every completed read() / write() of a MuxedInterface (including FIFO accesses) together with its
+ * start time, its duration and the transferred bytes (read response or written data), so that the session
+ * can later be played back by ReplayMuxedInterface. See ReplayMuxedInterface for the file format.
+ *
+ * Entries are appended to the (buffered) file as they are recorded, i.e. memory usage does not grow with the session length.
+ * Recording never throws, so that a failing session file cannot break the recorded transactions. Instead the file is
+ * closed on the first write error and the failure can be checked via hasFailed().
+ */
+class SessionRecorder
+{
+public:
+    explicit SessionRecorder(std::string pFilePath);                ///< Constructor.
+    SessionRecorder(const SessionRecorder&) = delete;               ///< Deleted copy constructor.
+    SessionRecorder(SessionRecorder&&) = delete;                    ///< Deleted move constructor.
+    ~SessionRecorder();                                             ///< Destructor.
+    //
+    SessionRecorder& operator=(SessionRecorder) = delete;           ///< Deleted copy assignment operator.
+    SessionRecorder& operator=(SessionRecorder&&) = delete;         ///< Deleted move assignment operator.
+    //
+    void open();                                                    ///< Start a new session file.
+    void close();                                                   ///< Write all pending entries and close the session file.
+    bool isOpen() const;                                            ///< Check if a session file is open.
+    bool hasFailed() const;                                         ///< Check if writing the session file failed.
+    //
+    void recordRead(std::chrono::steady_clock::time_point pStartTime, std::uint64_t pAddr, int pSize,
+                    std::span<const std::uint8_t> pData);           ///< Record a completed read transaction.
+    void recordWrite(std::chrono::steady_clock::time_point pStartTime, std::uint64_t pAddr,
+                     std::span<const std::uint8_t> pData);          ///< Record a completed write transaction.
+
+private:
+    void record(std::chrono::steady_clock::time_point pStartTime, ReplayMuxedInterface::Transaction::Type pType,
+                std::uint64_t pAddr, int pSize, std::span<const std::uint8_t> pData);   ///< Append an entry to the session file.
+
+private:
+    const std::string filePath;                                     ///< Path of the session file.
+    //
+    std::ofstream file;                                             ///< Session file.
+    std::chrono::steady_clock::time_point sessionStartTime;         ///< Time of open().
+    std::vector<std::uint8_t> entryBuffer;                          ///< Reused buffer for composing an entry.
+    bool failed;                                                    ///< Writing the session file failed.
+    //
+    mutable std::mutex mutex;                                       ///< Mutex for concurrent recording.
+};
+
+} // namespace CommonImpl
+/// \endcond INTERNAL
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_COMMONIMPL_SESSIONRECORDER_H
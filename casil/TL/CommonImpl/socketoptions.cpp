@@ -0,0 +1,156 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/CommonImpl/socketoptions.h>
+
+#include <casil/logger.h>
+
+#include <boost/predef/os/linux.h>
+#include <boost/asio/socket_base.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#if BOOST_OS_LINUX != 0
+#include <sys/socket.h>
+#endif
+
+/// \cond INTERNAL
+
+namespace
+{
+
+/*
+ * Applies the options from 'pOptions' that are common to TCP and UDP sockets to 'pSocket'.
+ */
+template<typename SocketT>
+void applyCommonSocketOptions(SocketT& pSocket, const casil::Layers::TL::CommonImpl::SocketOptions& pOptions)
+{
+    constexpr std::uint64_t maxValue = static_cast<std::uint64_t>(std::numeric_limits<int>::max());
+
+    if (pOptions.receiveBufferSize > maxValue || pOptions.sendBufferSize > maxValue || pOptions.busyPollMicroSecs > maxValue)
+        throw std::runtime_error("Socket option value out of range.");
+
+    if (pOptions.receiveBufferSize > 0)
+        pSocket.set_option(boost::asio::socket_base::receive_buffer_size(static_cast<int>(pOptions.receiveBufferSize)));
+
+    if (pOptions.sendBufferSize > 0)
+        pSocket.set_option(boost::asio::socket_base::send_buffer_size(static_cast<int>(pOptions.sendBufferSize)));
+
+    if (pOptions.busyPollMicroSecs > 0)
+    {
+#if BOOST_OS_LINUX != 0 && defined(SO_BUSY_POLL)
+        const int busyPoll = static_cast<int>(pOptions.busyPollMicroSecs);
+
+        if (::setsockopt(pSocket.native_handle(), SOL_SOCKET, SO_BUSY_POLL, &busyPoll, sizeof(busyPoll)) != 0)
+            casil::Logger::logWarning("Could not enable busy polling for socket (may require CAP_NET_ADMIN).");
+#else
+        casil::Logger::logWarning("Busy polling for sockets is not supported on this platform.");
+#endif
+    }
+}
+
+} // namespace
+
+namespace casil::Layers::TL::CommonImpl
+{
+
+/*!
+ * \brief Read the socket options from an interface configuration.
+ *
+ * Reads the optional values "init.recv_buffer_size", "init.send_buffer_size" (unsigned integer type, in bytes),
+ * "init.tcp_no_delay" (boolean type) and "init.busy_poll" (unsigned integer type, in microseconds)
+ * from \p pConfig. Each option defaults to zero / false, i.e. to the system default.
+ *
+ * \param pConfig Interface configuration.
+ * \return Configured socket options.
+ */
+SocketOptions SocketOptions::fromConfig(const LayerConfig& pConfig)
+{
+    SocketOptions options;
+
+    options.receiveBufferSize = pConfig.getUInt("init.recv_buffer_size", 0);
+    options.sendBufferSize = pConfig.getUInt("init.send_buffer_size", 0);
+    options.noDelay = pConfig.getBool("init.tcp_no_delay", false);
+    options.busyPollMicroSecs = pConfig.getUInt("init.busy_poll", 0);
+
+    return options;
+}
+
+//
+
+/*!
+ * \brief Apply socket options to a %TCP socket.
+ *
+ * Sets the socket options from \p pOptions that differ from the defaults on the (open) socket \p pSocket.
+ * If busy polling cannot be enabled (e.g. missing privileges or unsupported platform), a warning is logged.
+ *
+ * \throws std::runtime_error If an option value is out of range or setting an option fails.
+ *
+ * \param pSocket Open %TCP socket.
+ * \param pOptions Socket options.
+ */
+void applySocketOptions(boost::asio::ip::tcp::socket& pSocket, const SocketOptions& pOptions)
+{
+    try
+    {
+        applyCommonSocketOptions(pSocket, pOptions);
+
+        if (pOptions.noDelay)
+            pSocket.set_option(boost::asio::ip::tcp::no_delay(true));
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        throw std::runtime_error(std::string("Exception while setting TCP socket options: ") + exc.what());
+    }
+}
+
+/*!
+ * \brief Apply socket options to a %UDP socket.
+ *
+ * Sets the socket options from \p pOptions that differ from the defaults on the (open) socket \p pSocket,
+ * ignoring SocketOptions::noDelay. If busy polling cannot be enabled (e.g. missing privileges or
+ * unsupported platform), a warning is logged.
+ *
+ * \throws std::runtime_error If an option value is out of range or setting an option fails.
+ *
+ * \param pSocket Open %UDP socket.
+ * \param pOptions Socket options.
+ */
+void applySocketOptions(boost::asio::ip::udp::socket& pSocket, const SocketOptions& pOptions)
+{
+    try
+    {
+        applyCommonSocketOptions(pSocket, pOptions);
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        throw std::runtime_error(std::string("Exception while setting UDP socket options: ") + exc.what());
+    }
+}
+
+} // namespace casil::Layers::TL::CommonImpl
+
+/// \endcond INTERNAL
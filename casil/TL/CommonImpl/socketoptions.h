@@ -0,0 +1,71 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_COMMONIMPL_SOCKETOPTIONS_H
+#define CASIL_LAYERS_TL_COMMONIMPL_SOCKETOPTIONS_H
+
+#include <casil/layerconfig.h>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <cstdint>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/// \cond INTERNAL
+namespace CommonImpl
+{
+
+/*!
+ * \brief Tuning options for the %TCP/%UDP network sockets of the socket wrappers.
+ *
+ * Collects socket options that can be configured for the network interfaces (see fromConfig())
+ * and that are applied to the sockets after connecting them (see applySocketOptions()).
+ * A value of zero / false means that the respective option is left at the system default.
+ */
+struct SocketOptions
+{
+    std::uint64_t receiveBufferSize = 0;    ///< Size of the socket receive buffer in bytes (\c SO_RCVBUF).
+    std::uint64_t sendBufferSize = 0;       ///< Size of the socket send buffer in bytes (\c SO_SNDBUF).
+    bool noDelay = false;                   ///< Disable Nagle's algorithm (\c TCP_NODELAY; %TCP only).
+    std::uint64_t busyPollMicroSecs = 0;    ///< Busy polling time in microseconds for blocking receives (\c SO_BUSY_POLL; Linux only).
+    //
+    static SocketOptions fromConfig(const LayerConfig& pConfig);    ///< Read the socket options from an interface configuration.
+};
+
+void applySocketOptions(boost::asio::ip::tcp::socket& pSocket, const SocketOptions& pOptions);     ///< Apply socket options to a %TCP socket.
+void applySocketOptions(boost::asio::ip::udp::socket& pSocket, const SocketOptions& pOptions);     ///< Apply socket options to a %UDP socket.
+
+} // namespace CommonImpl
+/// \endcond INTERNAL
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_COMMONIMPL_SOCKETOPTIONS_H
@@ -25,40 +25,179 @@
 
 #include <casil/asio.h>
 #include <casil/bytes.h>
+#include <casil/logger.h>
 #include <casil/TL/CommonImpl/asiohelper.h>
+#include <casil/TL/CommonImpl/endpointcache.h>
 
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/connect.hpp>
+#include <boost/asio/error.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/read.hpp>
 #include <boost/asio/read_until.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <boost/asio/use_future.hpp>
 #include <boost/asio/write.hpp>
+#include <boost/system/errc.hpp>
 #include <boost/system/system_error.hpp>
 
 #include <future>
 #include <algorithm>
+#include <array>
+#include <exception>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <utility>
 
 /// \cond INTERNAL
 
 using casil::Layers::TL::CommonImpl::TCPSocketWrapper;
 
+namespace
+{
+
+/*
+ * Shared state of the staggered connection attempts of TCPSocketWrapper::connectSocketParallel(),
+ * kept alive by the pending handlers. All members except the constant ones are guarded by 'mutex'.
+ */
+struct ParallelConnectState
+{
+    ParallelConnectState(const boost::asio::ip::tcp::socket::executor_type& pExecutor,
+                         std::vector<boost::asio::ip::tcp::endpoint> pEndpoints, const std::chrono::milliseconds pAttemptDelay) :
+        endpoints(std::move(pEndpoints)),
+        attemptDelay(pAttemptDelay),
+        sockets(),
+        delayTimer(pExecutor),
+        mutex(),
+        nextAttempt(0),
+        failedAttempts(0),
+        done(false),
+        winner()
+    {
+        sockets.reserve(endpoints.size());
+
+        for (std::size_t i = 0; i < endpoints.size(); ++i)
+            sockets.push_back(std::make_unique<boost::asio::ip::tcp::socket>(pExecutor));
+    }
+    //
+    const std::vector<boost::asio::ip::tcp::endpoint> endpoints;
+    const std::chrono::milliseconds attemptDelay;
+    std::vector<std::unique_ptr<boost::asio::ip::tcp::socket>> sockets;
+    boost::asio::steady_timer delayTimer;
+    std::mutex mutex;
+    std::size_t nextAttempt;
+    std::size_t failedAttempts;
+    bool done;
+    std::promise<std::size_t> winner;
+};
+
+/*
+ * Closes all sockets of 'pState' except the one with index 'pKeep' and cancels the delay timer ('pState->mutex' must be locked).
+ */
+void abortParallelConnect(ParallelConnectState& pState, const std::size_t pKeep)
+{
+    pState.delayTimer.cancel();
+
+    for (std::size_t i = 0; i < pState.sockets.size(); ++i)
+    {
+        if (i == pKeep)
+            continue;
+
+        boost::system::error_code errorCode;
+        pState.sockets[i]->close(errorCode);
+    }
+}
+
+void startParallelConnectAttempt(const std::shared_ptr<ParallelConnectState>& pState);
+
+/*
+ * Handles the completion of the connection attempt with index 'pIndex': the first successful attempt wins and aborts
+ * all others; a failed attempt immediately starts the next one; if all attempts failed, the error of the last one is reported.
+ */
+void handleParallelConnectAttempt(const std::shared_ptr<ParallelConnectState>& pState, const std::size_t pIndex,
+                                  const boost::system::error_code& pErrorCode)
+{
+    const std::lock_guard<std::mutex> stateLock(pState->mutex);
+    (void)stateLock;
+
+    if (pState->done)
+        return;
+
+    if (!pErrorCode)
+    {
+        pState->done = true;
+        abortParallelConnect(*pState, pIndex);
+        pState->winner.set_value(pIndex);
+    }
+    else if (++pState->failedAttempts == pState->endpoints.size())
+    {
+        pState->done = true;
+        abortParallelConnect(*pState, pState->endpoints.size());
+        pState->winner.set_exception(std::make_exception_ptr(boost::system::system_error(pErrorCode)));
+    }
+    else if (pState->failedAttempts == pState->nextAttempt)     //No attempt in flight anymore; do not wait for the delay
+        startParallelConnectAttempt(pState);
+}
+
+/*
+ * Starts the next connection attempt of 'pState' (if any) and schedules the one after it ('pState->mutex' must be locked).
+ */
+void startParallelConnectAttempt(const std::shared_ptr<ParallelConnectState>& pState)
+{
+    if (pState->nextAttempt >= pState->endpoints.size())
+        return;
+
+    const std::size_t index = pState->nextAttempt++;
+
+    pState->sockets[index]->async_connect(pState->endpoints[index],
+                                          [pState, index](const boost::system::error_code& pErrorCode)
+                                          {
+                                              handleParallelConnectAttempt(pState, index, pErrorCode);
+                                          });
+
+    if (pState->nextAttempt >= pState->endpoints.size())
+        return;
+
+    pState->delayTimer.expires_after(pState->attemptDelay);     //Also cancels a still pending wait
+    pState->delayTimer.async_wait([pState](const boost::system::error_code& pErrorCode)
+                                  {
+                                      if (pErrorCode)
+                                          return;
+
+                                      const std::lock_guard<std::mutex> stateLock(pState->mutex);
+                                      (void)stateLock;
+
+                                      if (!pState->done)
+                                          startParallelConnectAttempt(pState);
+                                  });
+}
+
+} // namespace
+
 //
 
 /*!
  * \brief Constructor.
  *
- * Note: Initializes the socket using the IO context from ASIO::getIOContext().
+ * Note: Initializes the socket using a new strand of \p pIOContext (see ASIO::getIOContext(int)),
+ * such that the asynchronous handlers of this socket never run concurrently.
  *
  * \param pHostName Host name of the remote endpoint.
  * \param pPort Network port to be used.
  * \param pReadTermination Termination sequence for non-sized read operations.
  * \param pWriteTermination Termination sequence to append for write operations.
+ * \param pIOContext IO context to be used for the socket.
+ * \param pSocketOptions Socket options to be applied when connecting the socket (see init()).
+ * \param pReconnectPolicy Policy for re-establishing a lost connection (see reconnectIfLost()).
  */
 TCPSocketWrapper::TCPSocketWrapper(std::string pHostName, const int pPort,
-                                   std::string pReadTermination, const std::string& pWriteTermination) :
+                                   std::string pReadTermination, const std::string& pWriteTermination,
+                                   boost::asio::io_context& pIOContext, const SocketOptions& pSocketOptions,
+                                   const ReconnectPolicy& pReconnectPolicy) :
     hostName(std::move(pHostName)),
     port(pPort),
     readTerminationStr(std::move(pReadTermination)),
@@ -66,9 +205,42 @@ TCPSocketWrapper::TCPSocketWrapper(std::string pHostName, const int pPort,
     readTerminationLength(readTermination.size()),
     writeTermination(Bytes::byteVecFromStr(pWriteTermination)),
     writeTerminationLength(writeTermination.size()),
-    socket(ASIO::getIOContext()),
-    readBuffer()
+    socketOptions(pSocketOptions),
+    reconnectPolicy(pReconnectPolicy),
+    ioContext(pIOContext),
+    socket(boost::asio::make_strand(ioContext)),
+    endpoints(),
+    connectTimeout(std::chrono::milliseconds::zero()),
+    connectionLost(false),
+    reconnectMutex(),
+    standbySocket(socket.get_executor()),
+    standbyMutex(),
+    standbyConnected(false),
+    standbyConnectPending(false),
+    readBuffer(),
+    readBufferBegin(0),
+    asyncReadBuffer(),
+    asyncReadDataBegin(0),
+    asyncReadDataEnd(0),
+    asyncReadHandler(),
+    asyncRetryInterval(std::chrono::milliseconds::zero()),
+    asyncRetryTimer(socket.get_executor()),
+    asyncReadMutex(),
+    asyncReadsEnabled(false),
+    asyncReadsStopped(true),
+    asyncReadErrorCount(0),
+    asyncResetRequests()
+{
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Closes the standby socket (see ReconnectPolicy::useStandbySocket) and waits for its pending connection attempt (if any).
+ */
+TCPSocketWrapper::~TCPSocketWrapper()
 {
+    closeStandby();
 }
 
 //Public
@@ -85,7 +257,7 @@ TCPSocketWrapper::TCPSocketWrapper(std::string pHostName, const int pPort,
  * in such a case, the read termination will \e only be excluded from the returned sequence if it was \e fully
  * read into the buffer (which is unlikely but can actually happen). Otherwise \e nothing will be stripped off.
  *
- * Note: Tries to close() the socket on EOF error (\c boost::system::errc::no_such_file_or_directory),
+ * Note: Tries to close the socket (see disconnectSocket()) on EOF error (\c boost::system::errc::no_such_file_or_directory),
  * i.e. if the connection was terminated, in order to ensure proper error handling for \e successive async read calls.
  *
  * \throws std::runtime_error If reading from the socket fails.
@@ -100,116 +272,87 @@ std::vector<std::uint8_t> TCPSocketWrapper::read(const int pSize, const std::chr
 {
     if (pSize == -1)
     {
-        //Assign optional reference if was not passed by caller, because need
-        //to know whether timed out to properly handle termination below
-        bool tTimedOutFallback = false;                                     // cppcheck-suppress variableScope symbolName=tTimedOutFallback
-        if (!pTimedOut.has_value())
-            pTimedOut = std::ref(tTimedOutFallback);
-
-        std::size_t n = 0;
-
-        try
-        {
-            if (pTimeout <= std::chrono::milliseconds::zero())
-                n = boost::asio::read_until(socket, boost::asio::dynamic_buffer(readBuffer), readTerminationStr);
-            else
-            {
-                std::promise<std::size_t> promiseN;
+        const auto [numRead, numData] = readUntilTermination(pTimeout, pTimedOut);
 
-                boost::asio::async_read_until(socket, boost::asio::dynamic_buffer(readBuffer), readTerminationStr,
-                                              std::bind(&ASIOHelper::readWriteHandler,
-                                                        std::placeholders::_1, std::placeholders::_2, std::ref(promiseN)));
+        const auto dataBegin = readBuffer.begin() + readBufferBegin;
 
-                n = ASIOHelper::getAsyncTransferredWithTimedOutCancel(promiseN, socket, pTimeout, pTimedOut);
-            }
-        }
-        catch (const boost::system::system_error& exc)
-        {
-            //Workaround: always close on EOF; succeeding async read calls would apparently not fail again otherwise
-            if (exc.code().value() == boost::system::errc::no_such_file_or_directory && socket.is_open())
-            {
-                try
-                {
-                    close();
-                }
-                catch (const std::runtime_error&)
-                {
-                }
-            }
+        std::vector<std::uint8_t> retVal(dataBegin, dataBegin + numData);
 
-            throw std::runtime_error(std::string("Exception while reading from TCP socket: ") + exc.what());
-        }
-        catch (const std::runtime_error& exc)
-        {
-            throw std::runtime_error(std::string("Unexpected runtime error (THIS SHOULD NEVER HAPPEN!): ") + exc.what());
-        }
-        catch (const std::invalid_argument&)
-        {
-            throw std::runtime_error("Invalid promise argument. THIS SHOULD NEVER HAPPEN!");
-        }
+        consumeReadBuffer(numRead);
 
-        //Return the read bytes without trailing termination, if the read was complete;
-        //if termination is missing/incomplete (in case of timeout), return without stripping anything off
+        return retVal;
+    }
+    else if (pSize > 0)
+    {
+        std::vector<std::uint8_t> retVal(static_cast<std::size_t>(pSize));
 
-        if (std::search(readBuffer.begin(), readBuffer.end(), readTermination.begin(), readTermination.end()) != readBuffer.end())
-        {
-            //Buffer properly terminated: return all read bytes excluding the trailing termination
-            std::vector<std::uint8_t> retVal(readBuffer.begin(), readBuffer.begin() + n - readTerminationLength);
-            readBuffer.erase(readBuffer.begin(), readBuffer.begin() + n);
-            return retVal;
-        }
-        else    //No termination found in the buffer
-        {
-            if (!pTimedOut.has_value())
-                throw std::runtime_error("Not set optional. THIS SHOULD NEVER HAPPEN!");    //Assigned above if not passed by caller
+        retVal.resize(readInto(retVal, pSize, pTimeout, pTimedOut));
 
-            if (pTimedOut->get() == true)
-            {
-                //Return all read bytes without trying to strip off any termination fragments
-                std::vector<std::uint8_t> retVal(readBuffer.begin(), readBuffer.begin() + n);
-                readBuffer.erase(readBuffer.begin(), readBuffer.begin() + n);
-                return retVal;
-            }
-            else    //According to Boost documentation this should not even happen, but handle anyway
-            {
-                readBuffer.erase(readBuffer.begin(), readBuffer.begin() + n);
-                throw std::runtime_error("Error while reading from TCP socket: Did not read until read termination.");
-            }
-        }
+        return retVal;
     }
-    else if (pSize > 0)
+    else
+        return {};
+}
+
+/*!
+ * \brief Read maximally some amount of bytes from the socket.
+ *
+ * Reads and returns maximally \p pSize bytes from the socket. Returns an empty sequence for negative \p pSize.
+ *
+ * If the buffer already/still contains some data, no read will performed on the socket
+ * and instead maximally \p pSize bytes will be directly returned from the buffer.
+ *
+ * If \p pTimeout is non-zero and that timeout is reached, \p pTimedOut will
+ * be set to true (if defined) and the already read bytes will be returned.
+ *
+ * Note: Tries to close the socket (see disconnectSocket()) on EOF error (\c boost::system::errc::no_such_file_or_directory),
+ * i.e. if the connection was terminated, in order to ensure proper error handling for \e successive async read calls.
+ *
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pSize Maximum number of bytes to read.
+ * \param pTimeout The timeout for the read operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ * \return Maximally \p pSize bytes long byte sequence.
+ */
+std::vector<std::uint8_t> TCPSocketWrapper::readMax(const int pSize, const std::chrono::milliseconds pTimeout,
+                                                    const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    if (pSize > 0)
     {
-        if (std::cmp_less(readBuffer.size(), pSize))
+        if (getBufferedSize() == 0)
         {
-            const std::size_t oldSize = readBuffer.size();
+            std::size_t n = 0;
 
-            readBuffer.resize(pSize);
+            readBuffer.resize(pSize);   //Buffer is empty and hence not offset (see consumeReadBuffer())
 
             try
             {
                 try
                 {
                     if (pTimeout <= std::chrono::milliseconds::zero())
-                        boost::asio::read(socket, boost::asio::buffer(readBuffer.data() + oldSize, pSize - oldSize));
+                        n = boost::asio::read(socket, boost::asio::buffer(readBuffer.data(), pSize), boost::asio::transfer_at_least(1));
                     else
                     {
-                        std::promise<std::size_t> promiseN;
-
-                        boost::asio::async_read(socket, boost::asio::buffer(readBuffer.data() + oldSize, pSize - oldSize),
-                                                std::bind(&ASIOHelper::readWriteHandler,
-                                                          std::placeholders::_1, std::placeholders::_2, std::ref(promiseN)));
-
-                        (void)ASIOHelper::getAsyncTransferredWithTimedOutCancel(promiseN, socket, pTimeout, pTimedOut);
+                        n = ASIOHelper::runTransferWithTimedOutCancel(
+                                    [this, pSize](auto&& pToken)
+                                    {
+                                        return boost::asio::async_read(socket, boost::asio::buffer(readBuffer.data(), pSize),
+                                                                       boost::asio::transfer_at_least(1), std::forward<decltype(pToken)>(pToken));
+                                    },
+                                    socket, ioContext, pTimeout, pTimedOut);
                     }
                 }
                 catch (const boost::system::system_error& exc)
                 {
+                    checkConnectionLoss(exc.code());
+
                     //Workaround: always close on EOF; succeeding async read calls would apparently not fail again otherwise
                     if (exc.code().value() == boost::system::errc::no_such_file_or_directory && socket.is_open())
                     {
                         try
                         {
-                            close();
+                            disconnectSocket();
                         }
                         catch (const std::runtime_error&)
                         {
@@ -222,147 +365,173 @@ std::vector<std::uint8_t> TCPSocketWrapper::read(const int pSize, const std::chr
                 {
                     throw std::runtime_error(std::string("Unexpected runtime error (THIS SHOULD NEVER HAPPEN!): ") + exc.what());
                 }
-                catch (const std::invalid_argument&)
-                {
-                    throw std::runtime_error("Invalid promise argument. THIS SHOULD NEVER HAPPEN!");
-                }
             }
             catch (const std::runtime_error&)
             {
-                readBuffer.resize(oldSize);     //Need to restore previous size
+                readBuffer.clear();     //Need to restore zero size
                 throw;
             }
+
+            readBuffer.resize(n);
         }
 
-        if (std::cmp_equal(readBuffer.size(), pSize))
-        {
-            std::vector<std::uint8_t> retVal;
+        const std::size_t readNum = std::min(getBufferedSize(), static_cast<std::size_t>(pSize));
 
-            retVal.swap(readBuffer);
+        const auto dataBegin = readBuffer.begin() + readBufferBegin;
 
-            return retVal;
-        }
-        else
-        {
-            std::vector<std::uint8_t> retVal = std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + pSize);
+        std::vector<std::uint8_t> retVal(dataBegin, dataBegin + readNum);
 
-            readBuffer.erase(readBuffer.begin(), readBuffer.begin() + pSize);
+        consumeReadBuffer(readNum);
 
-            return retVal;
-        }
+        return retVal;
     }
     else
         return {};
 }
 
 /*!
- * \brief Read maximally some amount of bytes from the socket.
+ * \brief Read an amount of bytes from the socket, or until read termination, into a buffer.
  *
- * Reads and returns maximally \p pSize bytes from the socket. Returns an empty sequence for negative \p pSize.
- *
- * If the buffer already/still contains some data, no read will performed on the socket
- * and instead maximally \p pSize bytes will be directly returned from the buffer.
+ * Works like read() but writes the read bytes to \p pBuffer instead of returning a newly allocated byte sequence.
+ * Hence no memory is allocated for the read bytes (apart from a possible growth of the internal read buffer,
+ * which keeps its capacity for successive reads).
  *
- * If \p pTimeout is non-zero and that timeout is reached, \p pTimedOut will
- * be set to true (if defined) and the already read bytes will be returned.
- *
- * Note: Tries to close() the socket on EOF error (\c boost::system::errc::no_such_file_or_directory),
- * i.e. if the connection was terminated, in order to ensure proper error handling for \e successive async read calls.
+ * If \p pSize is positive, it must not exceed the size of \p pBuffer. If \p pSize is -1, the read data (excluding
+ * the read termination) must fit into \p pBuffer; otherwise an exception is thrown and the data is kept for the next read.
  *
+ * \throws std::runtime_error If \p pSize exceeds the size of \p pBuffer.
+ * \throws std::runtime_error If reading until termination and the read data does not fit into \p pBuffer.
  * \throws std::runtime_error If reading from the socket fails.
  *
- * \param pSize Maximum number of bytes to read.
+ * \param pBuffer Buffer for the read bytes.
+ * \param pSize Number of bytes to read or -1.
  * \param pTimeout The timeout for the read operation.
  * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
- * \return Maximally \p pSize bytes long byte sequence.
+ * \return Number of bytes written to \p pBuffer.
  */
-std::vector<std::uint8_t> TCPSocketWrapper::readMax(const int pSize, const std::chrono::milliseconds pTimeout,
-                                                    const std::optional<std::reference_wrapper<bool>> pTimedOut)
+std::size_t TCPSocketWrapper::readInto(const std::span<std::uint8_t> pBuffer, const int pSize, const std::chrono::milliseconds pTimeout,
+                                       const std::optional<std::reference_wrapper<bool>> pTimedOut)
 {
-    if (pSize > 0)
+    if (pSize == -1)
+    {
+        const auto [numRead, numData] = readUntilTermination(pTimeout, pTimedOut);
+
+        if (numData > pBuffer.size())
+            throw std::runtime_error("Exception while reading from TCP socket: Read data does not fit into the buffer.");
+
+        const auto dataBegin = readBuffer.begin() + readBufferBegin;
+
+        std::copy(dataBegin, dataBegin + numData, pBuffer.begin());
+
+        consumeReadBuffer(numRead);
+
+        return numData;
+    }
+    else if (pSize > 0)
     {
+        if (std::cmp_greater(pSize, pBuffer.size()))
+            throw std::runtime_error("Exception while reading from TCP socket: Requested size exceeds the buffer size.");
+
+        const std::size_t size = static_cast<std::size_t>(pSize);
+
+        //Take buffered bytes first and read the remaining bytes directly from the socket into the caller's buffer
+
+        const std::size_t numBuffered = std::min(getBufferedSize(), size);
+
+        std::copy(readBuffer.begin() + readBufferBegin, readBuffer.begin() + readBufferBegin + numBuffered, pBuffer.begin());
+
         std::size_t n = 0;
 
-        if (readBuffer.size() == 0)
+        if (numBuffered < size)
         {
-            readBuffer.resize(pSize);
+            const boost::asio::mutable_buffer remaining = boost::asio::buffer(pBuffer.data() + numBuffered, size - numBuffered);
 
             try
             {
-                try
+                if (pTimeout <= std::chrono::milliseconds::zero())
+                    n = boost::asio::read(socket, remaining);
+                else
                 {
-                    if (pTimeout <= std::chrono::milliseconds::zero())
-                        n = boost::asio::read(socket, boost::asio::buffer(readBuffer.data(), pSize), boost::asio::transfer_at_least(1));
-                    else
-                    {
-                        std::promise<std::size_t> promiseN;
-
-                        boost::asio::async_read(socket, boost::asio::buffer(readBuffer.data(), pSize), boost::asio::transfer_at_least(1),
-                                                std::bind(&ASIOHelper::readWriteHandler,
-                                                          std::placeholders::_1, std::placeholders::_2, std::ref(promiseN)));
-
-                        n = ASIOHelper::getAsyncTransferredWithTimedOutCancel(promiseN, socket, pTimeout, pTimedOut);
-                    }
+                    n = ASIOHelper::runTransferWithTimedOutCancel(
+                                [this, remaining](auto&& pToken)
+                                {
+                                    return boost::asio::async_read(socket, remaining, std::forward<decltype(pToken)>(pToken));
+                                },
+                                socket, ioContext, pTimeout, pTimedOut);
                 }
-                catch (const boost::system::system_error& exc)
+            }
+            catch (const boost::system::system_error& exc)
+            {
+                checkConnectionLoss(exc.code());
+
+                //Workaround: always close on EOF; succeeding async read calls would apparently not fail again otherwise
+                if (exc.code().value() == boost::system::errc::no_such_file_or_directory && socket.is_open())
                 {
-                    //Workaround: always close on EOF; succeeding async read calls would apparently not fail again otherwise
-                    if (exc.code().value() == boost::system::errc::no_such_file_or_directory && socket.is_open())
+                    try
+                    {
+                        disconnectSocket();
+                    }
+                    catch (const std::runtime_error&)
                     {
-                        try
-                        {
-                            close();
-                        }
-                        catch (const std::runtime_error&)
-                        {
-                        }
                     }
-
-                    throw std::runtime_error(std::string("Exception while reading from TCP socket: ") + exc.what());
-                }
-                catch (const std::runtime_error& exc)
-                {
-                    throw std::runtime_error(std::string("Unexpected runtime error (THIS SHOULD NEVER HAPPEN!): ") + exc.what());
-                }
-                catch (const std::invalid_argument&)
-                {
-                    throw std::runtime_error("Invalid promise argument. THIS SHOULD NEVER HAPPEN!");
                 }
+
+                throw std::runtime_error(std::string("Exception while reading from TCP socket: ") + exc.what());
             }
-            catch (const std::runtime_error&)
+            catch (const std::runtime_error& exc)
             {
-                readBuffer.clear();     //Need to restore zero size
-                throw;
+                throw std::runtime_error(std::string("Unexpected runtime error (THIS SHOULD NEVER HAPPEN!): ") + exc.what());
             }
         }
-        else
-            n = readBuffer.size();
 
-        const std::size_t readNum = std::min(n, static_cast<std::size_t>(pSize));
+        //Remove taken bytes from buffer only after successful read (previously buffered bytes are kept on failure)
+        consumeReadBuffer(numBuffered);
 
-        if (std::cmp_equal(readNum, readBuffer.size()))
-        {
-            std::vector<std::uint8_t> retVal;
+        return numBuffered + n;
+    }
+    else
+        return 0;
+}
 
-            retVal.swap(readBuffer);
+/*!
+ * \brief Read an amount of bytes from the socket, or until read termination, into a pooled buffer.
+ *
+ * Works like read() but returns the read bytes in a PooledBuffer, which avoids allocating memory for repeated reads.
+ * For positive \p pSize the bytes are read directly into the buffer (see readInto()). For \p pSize equal -1 the
+ * data up to the read termination is copied directly from the internal read buffer.
+ *
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pSize Number of bytes to read or -1.
+ * \param pTimeout The timeout for the read operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ * \return Byte sequence of requested length or up to (but excluding) termination.
+ */
+casil::PooledBuffer TCPSocketWrapper::readPooled(const int pSize, const std::chrono::milliseconds pTimeout,
+                                                 const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    if (pSize == -1)
+    {
+        const auto [numRead, numData] = readUntilTermination(pTimeout, pTimedOut);
 
-            return retVal;
-        }
-        else
-        {
-            std::vector<std::uint8_t> retVal(readBuffer.begin(), readBuffer.begin() + readNum);
+        const auto dataBegin = readBuffer.begin() + readBufferBegin;
 
-            readBuffer.erase(readBuffer.begin(), readBuffer.begin() + readNum);
+        PooledBuffer buffer(numData);
+        std::copy(dataBegin, dataBegin + numData, buffer.data());
 
-            std::size_t remainingBufferSize = n - readNum;
+        consumeReadBuffer(numRead);
 
-            readBuffer.resize(remainingBufferSize);
+        return buffer;
+    }
+    else if (pSize > 0)
+    {
+        PooledBuffer buffer(static_cast<std::size_t>(pSize));
+        buffer.resize(readInto(buffer.span(), pSize, pTimeout, pTimedOut));
 
-            return retVal;
-        }
+        return buffer;
     }
     else
-        return {};
+        return PooledBuffer();
 }
 
 /*!
@@ -382,49 +551,337 @@ std::vector<std::uint8_t> TCPSocketWrapper::readMax(const int pSize, const std::
 void TCPSocketWrapper::write(const std::vector<std::uint8_t>& pData, const std::chrono::milliseconds pTimeout,
                              const std::optional<std::reference_wrapper<bool>> pTimedOut)
 {
+    const std::span<const std::uint8_t> buffer(pData.data(), pData.size());
+
+    writeGather(std::span<const std::span<const std::uint8_t>>(&buffer, 1), pTimeout, pTimedOut);
+}
+
+/*!
+ * \brief Write multiple data buffers to the socket at once (automatically terminated).
+ *
+ * Writes the concatenation of all buffers in \p pBuffers to the socket, automatically followed by the configured
+ * write termination. In contrast to write(), all buffers (including the termination) are passed to the socket
+ * as a single buffer sequence, i.e. without copying them into a contiguous buffer first (scatter/gather).
+ * If \p pTimeout is non-zero, it is used as timeout for the write attempt.
+ * If the timeout is reached, \p pTimedOut will be set to true (if defined) and an exception is thrown.
+ *
+ * \throws std::runtime_error On timeout.
+ * \throws std::runtime_error If writing to the socket fails.
+ *
+ * \param pBuffers Data buffers to be written (excluding termination).
+ * \param pTimeout The timeout for the write operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ */
+void TCPSocketWrapper::writeGather(const std::span<const std::span<const std::uint8_t>> pBuffers, const std::chrono::milliseconds pTimeout,
+                                   const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    std::vector<boost::asio::const_buffer> bufferSequence;
+
+    bufferSequence.reserve(pBuffers.size() + 1);
+
+    for (const std::span<const std::uint8_t> buffer : pBuffers)
+        bufferSequence.emplace_back(buffer.data(), buffer.size());
+
+    bufferSequence.emplace_back(writeTermination.data(), writeTerminationLength);
+
     try
     {
         if (pTimeout <= std::chrono::milliseconds::zero())
-        {
-            boost::asio::write(socket, boost::asio::buffer(pData.data(), pData.size()));
-            boost::asio::write(socket, boost::asio::buffer(writeTermination));
-        }
+            boost::asio::write(socket, bufferSequence);
         else
         {
-            std::future<std::size_t> futureN = boost::asio::async_write(socket, boost::asio::buffer(pData.data(), pData.size()),
-                                                                        boost::asio::use_future);
-
-            const auto timeoutRefTime = std::chrono::steady_clock::now();
-
-            (void)ASIOHelper::getAsyncBoostFutureWithTimedOutCancel(futureN, socket, pTimeout, pTimedOut);
+            bool timedOut = false;
 
-            futureN = boost::asio::async_write(socket, boost::asio::buffer(writeTermination), boost::asio::use_future);
+            (void)ASIOHelper::runTransferWithTimedOutCancel(
+                        [this, &bufferSequence](auto&& pToken)
+                        {
+                            return boost::asio::async_write(socket, bufferSequence, std::forward<decltype(pToken)>(pToken));
+                        },
+                        socket, ioContext, pTimeout, std::ref(timedOut));
 
-            const auto reducedTimeout = pTimeout - std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
-                                                                                                         timeoutRefTime);
+            if (pTimedOut.has_value())
+                pTimedOut->get() = timedOut;
 
-            if (reducedTimeout <= std::chrono::milliseconds::zero())
-            {
-                if (pTimedOut.has_value())
-                    pTimedOut->get() = true;
+            if (timedOut)
                 throw std::runtime_error("Timeout.");
-            }
-
-            (void)ASIOHelper::getAsyncBoostFutureWithTimedOutCancel(futureN, socket, reducedTimeout, pTimedOut);
         }
     }
     catch (const boost::system::system_error& exc)
     {
+        checkConnectionLoss(exc.code());
         throw std::runtime_error(std::string("Exception while writing to TCP socket: ") + exc.what());
     }
     catch (const std::runtime_error& exc)
     {
         throw std::runtime_error(std::string("Exception while writing to TCP socket: ") + exc.what());
     }
-    catch (const std::invalid_argument&)
-    {
-        throw std::runtime_error("Invalid future argument. THIS SHOULD NEVER HAPPEN!");
-    }
+}
+
+//
+
+/*!
+ * \brief Read an amount of bytes from the socket, or until read termination (coroutine).
+ *
+ * Coroutine version of read() with the same behavior, which must be awaited from a coroutine (see also
+ * ASIOHelper::awaitTransferredWithTimedOutCancel()). The socket operations complete on the IO context passed to the constructor,
+ * which hence must be run by some thread (e.g. by the IO context threads or the thread that awaits the coroutine).
+ *
+ * Note: \p pTimedOut (if defined) must stay valid until the coroutine completes.
+ *
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pSize Number of bytes to read or -1.
+ * \param pTimeout The timeout for the read operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ * \return Byte sequence of requested length or up to (but excluding) termination.
+ */
+boost::asio::awaitable<std::vector<std::uint8_t>> TCPSocketWrapper::coRead(const int pSize, const std::chrono::milliseconds pTimeout,
+                                                                           const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    if (pSize == -1)
+    {
+        //Use an already buffered line if available; otherwise only the incomplete rest needs to be kept at the buffer front
+
+        if (const std::optional<std::size_t> numBufferedRead = findBufferedReadTermination(); numBufferedRead.has_value())
+        {
+            if (pTimedOut.has_value())
+                pTimedOut->get() = false;
+
+            const auto dataBegin = readBuffer.begin() + readBufferBegin;
+
+            std::vector<std::uint8_t> retVal(dataBegin, dataBegin + *numBufferedRead - readTerminationLength);
+
+            consumeReadBuffer(*numBufferedRead);
+
+            co_return retVal;
+        }
+
+        compactReadBuffer();
+
+        bool timedOut = false;
+        std::size_t n = 0;
+
+        try
+        {
+            n = co_await ASIOHelper::awaitTransferredWithTimedOutCancel(
+                        [this](auto&& pToken)
+                        {
+                            return boost::asio::async_read_until(socket, boost::asio::dynamic_buffer(readBuffer), readTerminationStr,
+                                                                 std::forward<decltype(pToken)>(pToken));
+                        },
+                        socket, pTimeout, std::ref(timedOut));
+        }
+        catch (const boost::system::system_error& exc)
+        {
+            checkConnectionLoss(exc.code());
+
+            //Workaround: always close on EOF; succeeding async read calls would apparently not fail again otherwise
+            if (exc.code().value() == boost::system::errc::no_such_file_or_directory && socket.is_open())
+            {
+                try
+                {
+                    disconnectSocket();
+                }
+                catch (const std::runtime_error&)
+                {
+                }
+            }
+
+            throw std::runtime_error(std::string("Exception while reading from TCP socket: ") + exc.what());
+        }
+
+        if (pTimedOut.has_value())
+            pTimedOut->get() = timedOut;
+
+        //Return the read bytes without trailing termination, if the read was complete;
+        //if termination is missing/incomplete (in case of timeout), return without stripping anything off
+
+        if (std::search(readBuffer.begin(), readBuffer.end(), readTermination.begin(), readTermination.end()) != readBuffer.end())
+        {
+            std::vector<std::uint8_t> retVal(readBuffer.begin(), readBuffer.begin() + n - readTerminationLength);
+            consumeReadBuffer(n);
+            co_return retVal;
+        }
+        else if (timedOut)
+        {
+            std::vector<std::uint8_t> retVal(readBuffer.begin(), readBuffer.begin() + n);
+            consumeReadBuffer(n);
+            co_return retVal;
+        }
+        else
+        {
+            consumeReadBuffer(n);
+            throw std::runtime_error("Error while reading from TCP socket: Did not read until read termination.");
+        }
+    }
+    else if (pSize > 0)
+    {
+        if (std::cmp_less(getBufferedSize(), pSize))
+        {
+            compactReadBuffer();
+
+            const std::size_t oldSize = readBuffer.size();
+
+            readBuffer.resize(pSize);
+
+            try
+            {
+                (void)co_await ASIOHelper::awaitTransferredWithTimedOutCancel(
+                            [this, oldSize, pSize](auto&& pToken)
+                            {
+                                return boost::asio::async_read(socket, boost::asio::buffer(readBuffer.data() + oldSize, pSize - oldSize),
+                                                               std::forward<decltype(pToken)>(pToken));
+                            },
+                            socket, pTimeout, pTimedOut);
+            }
+            catch (const boost::system::system_error& exc)
+            {
+                readBuffer.resize(oldSize);     //Need to restore previous size
+
+                checkConnectionLoss(exc.code());
+
+                //Workaround: always close on EOF; succeeding async read calls would apparently not fail again otherwise
+                if (exc.code().value() == boost::system::errc::no_such_file_or_directory && socket.is_open())
+                {
+                    try
+                    {
+                        disconnectSocket();
+                    }
+                    catch (const std::runtime_error&)
+                    {
+                    }
+                }
+
+                throw std::runtime_error(std::string("Exception while reading from TCP socket: ") + exc.what());
+            }
+        }
+
+        const auto dataBegin = readBuffer.begin() + readBufferBegin;
+
+        std::vector<std::uint8_t> retVal(dataBegin, dataBegin + pSize);
+
+        consumeReadBuffer(static_cast<std::size_t>(pSize));
+
+        co_return retVal;
+    }
+    else
+        co_return std::vector<std::uint8_t>{};
+}
+
+/*!
+ * \brief Read maximally some amount of bytes from the socket (coroutine).
+ *
+ * Coroutine version of readMax() with the same behavior (see also coRead()).
+ *
+ * Note: \p pTimedOut (if defined) must stay valid until the coroutine completes.
+ *
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pSize Maximum number of bytes to read.
+ * \param pTimeout The timeout for the read operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ * \return Maximally \p pSize bytes long byte sequence.
+ */
+boost::asio::awaitable<std::vector<std::uint8_t>> TCPSocketWrapper::coReadMax(const int pSize, const std::chrono::milliseconds pTimeout,
+                                                                              const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    if (pSize <= 0)
+        co_return std::vector<std::uint8_t>{};
+
+    if (getBufferedSize() == 0)
+    {
+        std::size_t n = 0;
+
+        readBuffer.resize(pSize);   //Buffer is empty and hence not offset (see consumeReadBuffer())
+
+        try
+        {
+            n = co_await ASIOHelper::awaitTransferredWithTimedOutCancel(
+                        [this, pSize](auto&& pToken)
+                        {
+                            return boost::asio::async_read(socket, boost::asio::buffer(readBuffer.data(), pSize), boost::asio::transfer_at_least(1),
+                                                           std::forward<decltype(pToken)>(pToken));
+                        },
+                        socket, pTimeout, pTimedOut);
+        }
+        catch (const boost::system::system_error& exc)
+        {
+            readBuffer.clear();     //Need to restore zero size
+
+            checkConnectionLoss(exc.code());
+
+            //Workaround: always close on EOF; succeeding async read calls would apparently not fail again otherwise
+            if (exc.code().value() == boost::system::errc::no_such_file_or_directory && socket.is_open())
+            {
+                try
+                {
+                    disconnectSocket();
+                }
+                catch (const std::runtime_error&)
+                {
+                }
+            }
+
+            throw std::runtime_error(std::string("Exception while reading from TCP socket: ") + exc.what());
+        }
+
+        readBuffer.resize(n);
+    }
+
+    const std::size_t readNum = std::min(getBufferedSize(), static_cast<std::size_t>(pSize));
+
+    const auto dataBegin = readBuffer.begin() + readBufferBegin;
+
+    std::vector<std::uint8_t> retVal(dataBegin, dataBegin + readNum);
+
+    consumeReadBuffer(readNum);
+
+    co_return retVal;
+}
+
+/*!
+ * \brief Write data to the socket (automatically terminated; coroutine).
+ *
+ * Coroutine version of write() with the same behavior (see also coRead()). The data and
+ * the write termination are passed to the socket as a single buffer sequence (see writeGather()).
+ *
+ * Note: \p pTimedOut (if defined) must stay valid until the coroutine completes.
+ *
+ * \throws std::runtime_error On timeout.
+ * \throws std::runtime_error If writing to the socket fails.
+ *
+ * \param pData Data to be written (excluding termination).
+ * \param pTimeout The timeout for the write operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ */
+boost::asio::awaitable<void> TCPSocketWrapper::coWrite(const std::vector<std::uint8_t> pData, const std::chrono::milliseconds pTimeout,
+                                                       const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    const std::array<boost::asio::const_buffer, 2> bufferSequence{boost::asio::buffer(pData.data(), pData.size()),
+                                                                  boost::asio::buffer(writeTermination)};
+
+    bool timedOut = false;
+
+    try
+    {
+        (void)co_await ASIOHelper::awaitTransferredWithTimedOutCancel(
+                    [this, &bufferSequence](auto&& pToken)
+                    {
+                        return boost::asio::async_write(socket, bufferSequence, std::forward<decltype(pToken)>(pToken));
+                    },
+                    socket, pTimeout, std::ref(timedOut));
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        checkConnectionLoss(exc.code());
+        throw std::runtime_error(std::string("Exception while writing to TCP socket: ") + exc.what());
+    }
+
+    if (pTimedOut.has_value())
+        pTimedOut->get() = timedOut;
+
+    if (timedOut)
+        throw std::runtime_error("Exception while writing to TCP socket: Timeout.");
 }
 
 //
@@ -438,7 +895,7 @@ void TCPSocketWrapper::write(const std::vector<std::uint8_t>& pData, const std::
  */
 bool TCPSocketWrapper::readBufferEmpty() const
 {
-    if (readBuffer.size() > 0)
+    if (getBufferedSize() > 0)
         return false;
 
     try
@@ -464,6 +921,8 @@ void TCPSocketWrapper::clearReadBuffer()
 {
     std::size_t dataAvail = 0;
 
+    readBufferBegin = 0;
+
     try
     {
         dataAvail = socket.available();
@@ -492,6 +951,155 @@ void TCPSocketWrapper::clearReadBuffer()
 
 //
 
+/*!
+ * \brief Start continuously reading from the socket asynchronously.
+ *
+ * Starts a chain of asynchronous reads of up to \p pBufferSize bytes each and passes the read data to \p pHandler
+ * as soon as it arrives. \p pHandler is called from the IO context threads (see ASIO) but never concurrently to itself.
+ * It returns the number of bytes it accepted from the passed data. If it did not accept everything, it is called
+ * again with the remaining data after \p pRetryInterval and the socket is not read again until all data was accepted.
+ *
+ * The chain stops when stopped explicitly (see stopAsyncReads()), when the connection was closed by the remote endpoint or
+ * as soon as the read error count exceeds a fixed maximum threshold (see \ref maxAsyncReadErrorCount). Errors are logged (see Logger).
+ *
+ * Note: Do not use the other read functions while the continuous reading is active.
+ *
+ * \throws std::runtime_error If no IO context threads are running (see ASIO::ioContextThreadsRunning()).
+ * \throws std::runtime_error If the continuous reading is already active.
+ * \throws std::runtime_error If \p pBufferSize is zero.
+ *
+ * \param pBufferSize Maximum number of bytes per single read.
+ * \param pHandler Handler for the read data.
+ * \param pRetryInterval Delay before passing data that was not accepted by \p pHandler again.
+ */
+void TCPSocketWrapper::startAsyncReads(const std::size_t pBufferSize, AsyncReadHandlerType pHandler,
+                                       const std::chrono::milliseconds pRetryInterval)
+{
+    if (!ASIO::ioContextThreadsRunning())
+        throw std::runtime_error("Continuous TCP socket reading requires running at least one IO context thread.");
+
+    if (!asyncReadsStopped.load())
+        throw std::runtime_error("Continuous TCP socket reading is already active.");
+
+    if (pBufferSize == 0)
+        throw std::runtime_error("Buffer size for continuous TCP socket reading must not be zero.");
+
+    const std::lock_guard<std::mutex> asyncLock(asyncReadMutex);
+    (void)asyncLock;
+
+    asyncReadBuffer.resize(pBufferSize);
+    asyncReadDataBegin = 0;
+    asyncReadDataEnd = 0;
+    asyncReadHandler = std::move(pHandler);
+    asyncRetryInterval = pRetryInterval;
+    asyncReadErrorCount = 0;
+
+    asyncReadsEnabled.store(true);
+    asyncReadsStopped.store(false);
+
+    issueAsyncRead();
+}
+
+/*!
+ * \brief Stop the continuous asynchronous reading and wait until it has stopped.
+ *
+ * Disables the continuous reading started by startAsyncReads(), cancels pending asynchronous operations and waits
+ * until the last handler has finished. Does nothing if the continuous reading is not active.
+ *
+ * \throws std::runtime_error If cancelling the socket operations fails.
+ */
+void TCPSocketWrapper::stopAsyncReads()
+{
+    if (asyncReadsStopped.load())
+        return;
+
+    try
+    {
+        const std::lock_guard<std::mutex> asyncLock(asyncReadMutex);
+        (void)asyncLock;
+
+        asyncReadsEnabled.store(false);
+
+        asyncRetryTimer.cancel();
+        socket.cancel();
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        asyncReadsStopped.wait(false);
+        throw std::runtime_error(std::string("Exception while stopping continuous TCP socket reading: ") + exc.what());
+    }
+
+    asyncReadsStopped.wait(false);
+}
+
+/*!
+ * \brief Check if the continuous asynchronous reading is active.
+ *
+ * \return True if the continuous reading was started (see startAsyncReads()) and has not stopped yet.
+ */
+bool TCPSocketWrapper::asyncReadsActive() const
+{
+    return !asyncReadsStopped.load();
+}
+
+/*!
+ * \brief Discard all data received so far and call a handler from within the continuous reading.
+ *
+ * If the continuous reading (see startAsyncReads()) is active, posts a reset request to the chain of asynchronous reads
+ * and wakes it up (by cancelling the pending read or retry delay) instead of stopping and restarting the reading.
+ * Before continuing with the next read, the chain then discards the not yet accepted data and the data already
+ * received by the socket and calls \p pHandler. Hence \p pHandler is never called concurrently to the data handler
+ * and all data passed to the data handler afterwards was received after the reset. Waits until \p pHandler has returned,
+ * which is bounded by the duration of a single call of the data handler.
+ *
+ * If the continuous reading is not active, clears the read buffer (see clearReadBuffer()) and calls \p pHandler directly.
+ *
+ * \throws std::runtime_error If waking up the continuous reading or discarding the received data fails.
+ * \throws std::runtime_error If clearReadBuffer() throws \c std::runtime_error.
+ * \throws std::runtime_error If \p pHandler throws \c std::runtime_error.
+ *
+ * \param pHandler Handler to be called after discarding the data.
+ */
+void TCPSocketWrapper::resetAsyncReads(const AsyncResetHandlerType& pHandler)
+{
+    std::future<void> done;
+
+    try
+    {
+        const std::lock_guard<std::mutex> asyncLock(asyncReadMutex);
+        (void)asyncLock;
+
+        if (asyncReadsEnabled.load())
+        {
+            asyncResetRequests.emplace_back(std::cref(pHandler), std::promise<void>());
+            done = asyncResetRequests.back().second.get_future();
+
+            asyncRetryTimer.cancel();
+            socket.cancel();
+        }
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        if (done.valid())
+            done.wait();    //Request was queued anyway and must not outlive pHandler
+        throw std::runtime_error(std::string("Exception while resetting continuous TCP socket reading: ") + exc.what());
+    }
+
+    if (done.valid())
+    {
+        done.get();     //Rethrows exceptions from discarding the data or from pHandler
+        return;
+    }
+
+    //Wait for a concurrently stopping chain before accessing the socket
+    asyncReadsStopped.wait(false);
+
+    clearReadBuffer();
+    pHandler();
+}
+
+//
+
 /*!
  * \brief Connect the %TCP socket.
  *
@@ -499,9 +1107,21 @@ void TCPSocketWrapper::clearReadBuffer()
  * If \p pConnectTimeout is non-zero, it is used as timeout for the connection attempt.
  * If the timeout is reached, \p pTimedOut will be set to true (if defined) and an exception is thrown.
  *
+ * The host name is resolved via the process-wide EndpointCache, i.e. only if it has not been resolved recently.
+ * If connecting fails, the cached endpoints are invalidated. If the host name resolves to multiple endpoints,
+ * these are tried in parallel with staggered starts (see connectSocket()).
+ *
+ * The socket options passed to the constructor are applied after a successful connection.
+ * If this fails, the socket is closed again.
+ *
+ * The resolved endpoints and \p pConnectTimeout are kept for re-establishing a lost connection (see reconnectIfLost()).
+ * If the reconnect policy uses a standby socket (see ReconnectPolicy::useStandbySocket), a connection
+ * of the standby socket is started asynchronously after the socket was connected successfully.
+ *
  * \throws std::runtime_error If no IO context threads are running (see ASIO::ioContextThreadsRunning()).
  * \throws std::runtime_error On timeout.
  * \throws std::runtime_error If resolving the host name or connecting the socket fails.
+ * \throws std::runtime_error If applying the configured socket options fails (see applySocketOptions()).
  *
  * \param pConnectTimeout The timeout for the connection attempt.
  * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
@@ -513,45 +1133,684 @@ void TCPSocketWrapper::init(const std::chrono::milliseconds pConnectTimeout, con
 
     try
     {
-        boost::asio::ip::tcp::resolver resolver(ASIO::getIOContext());
-
-        if (pConnectTimeout <= std::chrono::milliseconds::zero())
-            boost::asio::connect(socket, resolver.resolve(hostName, std::to_string(port)));
-        else
-        {
-            std::future<boost::asio::ip::tcp::endpoint> endpoint = boost::asio::async_connect(socket,
-                                                                                              resolver.resolve(hostName, std::to_string(port)),
-                                                                                              boost::asio::use_future);
-
-            (void)ASIOHelper::getAsyncBoostFutureWithTimedOutCancel(endpoint, socket, pConnectTimeout, pTimedOut);
-        }
+        endpoints = EndpointCache::resolveTCP(ioContext, hostName, port);
     }
     catch (const boost::system::system_error& exc)
     {
         throw std::runtime_error(std::string("Exception while connecting TCP socket: ") + exc.what());
     }
-    catch (const std::runtime_error& exc)
+
+    connectTimeout = pConnectTimeout;
+
+    try
     {
-        throw std::runtime_error(std::string("Exception while connecting TCP socket: ") + exc.what());
+        connectSocket(socket, pConnectTimeout, pTimedOut);
     }
-    catch (const std::invalid_argument&)
+    catch (const std::runtime_error&)
     {
-        throw std::runtime_error("Invalid future argument. THIS SHOULD NEVER HAPPEN!");
+        EndpointCache::invalidate(hostName, port);  //Resolve again next time in case the cached endpoints are outdated
+        throw;
     }
+
+    connectionLost.store(false);
+
+    if (reconnectPolicy.useStandbySocket)
+        startStandbyConnect();
 }
 
 /*!
  * \brief Disconnect the %TCP socket.
  *
  * Shuts down send/receive operations and closes the connection.
+ * Also closes the standby socket (see ReconnectPolicy::useStandbySocket).
  *
  * \throws std::runtime_error If shutting down or closing the socket fails.
  */
 void TCPSocketWrapper::close()
 {
-    try
-    {
-        try
+    closeStandby();
+
+    connectionLost.store(false);
+
+    disconnectSocket();
+}
+
+//
+
+/*!
+ * \brief Check if the connection was lost.
+ *
+ * \return True if a transfer failed because the connection was closed or broken (e.g. EOF, connection reset).
+ */
+bool TCPSocketWrapper::isConnectionLost() const
+{
+    return connectionLost.load();
+}
+
+/*!
+ * \brief Check if the connection was lost and can be re-established by reconnectIfLost().
+ *
+ * \return True if reconnecting is enabled (see ReconnectPolicy::enabled()) and the connection was lost (see isConnectionLost()).
+ */
+bool TCPSocketWrapper::isReconnectRequired() const
+{
+    return reconnectPolicy.enabled() && connectionLost.load();
+}
+
+/*!
+ * \brief Re-establish a lost connection according to the reconnect policy.
+ *
+ * Does nothing and returns false if reconnecting is disabled (see ReconnectPolicy::enabled())
+ * or if the connection was not lost (see isConnectionLost()).
+ *
+ * Otherwise closes the lost connection and discards the buffered read data. If a connected standby socket is
+ * available (see ReconnectPolicy::useStandbySocket), it simply replaces the lost connection and a new standby
+ * connection is started asynchronously. Else the socket is connected again to the endpoints resolved by init(),
+ * using up to ReconnectPolicy::maxAttempts attempts with exponentially increasing delays (see ReconnectPolicy::getBackoff()).
+ *
+ * Only one reconnect is in flight at any time. Concurrent callers wait for the ongoing reconnect and
+ * then return without another attempt if it succeeded.
+ *
+ * Note: Do not use the socket from other threads while reconnecting. The continuous reading (see startAsyncReads())
+ * stops on a lost connection and needs to be restarted by the caller after reconnecting.
+ *
+ * \throws std::runtime_error If all connection attempts failed.
+ *
+ * \return True if the connection was re-established.
+ */
+bool TCPSocketWrapper::reconnectIfLost()
+{
+    if (!reconnectPolicy.enabled() || !connectionLost.load())
+        return false;
+
+    const std::lock_guard<std::mutex> reconnectLock(reconnectMutex);
+    (void)reconnectLock;
+
+    if (!connectionLost.load())     //Already re-established by a concurrent caller
+        return true;
+
+    try
+    {
+        disconnectSocket();
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+
+    readBuffer.clear();
+    readBufferBegin = 0;
+
+    bool usedStandby = false;
+
+    {
+        const std::lock_guard<std::mutex> standbyLock(standbyMutex);
+        (void)standbyLock;
+
+        if (standbyConnected)
+        {
+            socket = std::move(standbySocket);
+            standbySocket = boost::asio::ip::tcp::socket(socket.get_executor());    //Moved-from socket has no executor anymore
+            standbyConnected = false;
+            usedStandby = true;
+        }
+    }
+
+    if (!usedStandby)
+    {
+        for (int attempt = 1; ; ++attempt)
+        {
+            try
+            {
+                connectSocket(socket, connectTimeout, std::nullopt);
+                break;
+            }
+            catch (const std::runtime_error& exc)
+            {
+                if (attempt >= reconnectPolicy.maxAttempts)
+                {
+                    throw std::runtime_error("Exception while reconnecting TCP socket: Giving up after " + std::to_string(attempt) +
+                                             " attempts: " + exc.what());
+                }
+
+                std::this_thread::sleep_for(reconnectPolicy.getBackoff(attempt));
+            }
+        }
+    }
+
+    connectionLost.store(false);
+
+    Logger::logInfo("Re-established connection of TCP socket for \"" + hostName + ":" + std::to_string(port) + "\"" +
+                    (usedStandby ? " using standby socket." : "."));
+
+    if (reconnectPolicy.useStandbySocket)
+        startStandbyConnect();
+
+    return true;
+}
+
+//Private
+
+/*!
+ * \brief Fill the read buffer up to and including the read termination.
+ *
+ * Reads from the socket until the read buffer contains the configured read termination (see read() for \p pSize equal -1).
+ * Returns the number of read buffer bytes up to and including the termination, which are to be consumed from the
+ * read buffer by the caller (see consumeReadBuffer()), and the number of data bytes at the front of the read buffer
+ * (i.e. starting at \ref readBufferBegin), excluding the termination.
+ *
+ * If the read buffer already contains the termination, no read is performed on the socket. Otherwise the buffer is
+ * compacted first (see compactReadBuffer()), which moves only the incomplete rest. Together with consumeReadBuffer()
+ * this keeps the effort linear in the amount of read data also when many short lines are buffered at once.
+ *
+ * If \p pTimeout is non-zero and that timeout is reached, \p pTimedOut will be set to true (if defined) and the
+ * \e already read bytes will be regarded as data bytes (without stripping off any termination fragments).
+ *
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pTimeout The timeout for the read operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ * \return Number of read bytes to be consumed from the read buffer and number of data bytes.
+ */
+std::pair<std::size_t, std::size_t> TCPSocketWrapper::readUntilTermination(const std::chrono::milliseconds pTimeout,
+                                                                           std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    //Use an already buffered line if available; otherwise only the incomplete rest needs to be kept at the buffer front
+
+    if (const std::optional<std::size_t> numBufferedRead = findBufferedReadTermination(); numBufferedRead.has_value())
+    {
+        if (pTimedOut.has_value())
+            pTimedOut->get() = false;
+
+        return {*numBufferedRead, *numBufferedRead - readTerminationLength};
+    }
+
+    compactReadBuffer();
+
+    //Assign optional reference if was not passed by caller, because need
+    //to know whether timed out to properly handle termination below
+    bool tTimedOutFallback = false;                                     // cppcheck-suppress variableScope symbolName=tTimedOutFallback
+    if (!pTimedOut.has_value())
+        pTimedOut = std::ref(tTimedOutFallback);
+
+    std::size_t n = 0;
+
+    try
+    {
+        if (pTimeout <= std::chrono::milliseconds::zero())
+            n = boost::asio::read_until(socket, boost::asio::dynamic_buffer(readBuffer), readTerminationStr);
+        else
+        {
+            n = ASIOHelper::runTransferWithTimedOutCancel(
+                        [this](auto&& pToken)
+                        {
+                            return boost::asio::async_read_until(socket, boost::asio::dynamic_buffer(readBuffer), readTerminationStr,
+                                                                 std::forward<decltype(pToken)>(pToken));
+                        },
+                        socket, ioContext, pTimeout, pTimedOut);
+        }
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        checkConnectionLoss(exc.code());
+
+        //Workaround: always close on EOF; succeeding async read calls would apparently not fail again otherwise
+        if (exc.code().value() == boost::system::errc::no_such_file_or_directory && socket.is_open())
+        {
+            try
+            {
+                disconnectSocket();
+            }
+            catch (const std::runtime_error&)
+            {
+            }
+        }
+
+        throw std::runtime_error(std::string("Exception while reading from TCP socket: ") + exc.what());
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error(std::string("Unexpected runtime error (THIS SHOULD NEVER HAPPEN!): ") + exc.what());
+    }
+
+    //Use the read bytes without trailing termination, if the read was complete;
+    //if termination is missing/incomplete (in case of timeout), return without stripping anything off
+
+    if (std::search(readBuffer.begin(), readBuffer.end(), readTermination.begin(), readTermination.end()) != readBuffer.end())
+    {
+        //Buffer properly terminated: data are all read bytes excluding the trailing termination
+        return {n, n - readTerminationLength};
+    }
+    else    //No termination found in the buffer
+    {
+        if (!pTimedOut.has_value())
+            throw std::runtime_error("Not set optional. THIS SHOULD NEVER HAPPEN!");    //Assigned above if not passed by caller
+
+        if (pTimedOut->get() == true)
+        {
+            //Data are all read bytes without trying to strip off any termination fragments
+            return {n, n};
+        }
+        else    //According to Boost documentation this should not even happen, but handle anyway
+        {
+            consumeReadBuffer(n);
+            throw std::runtime_error("Error while reading from TCP socket: Did not read until read termination.");
+        }
+    }
+}
+
+//
+
+/*!
+ * \brief Get the number of buffered but not yet consumed bytes.
+ *
+ * \return Size of the unconsumed region of \ref readBuffer.
+ */
+std::size_t TCPSocketWrapper::getBufferedSize() const
+{
+    return readBuffer.size() - readBufferBegin;
+}
+
+/*!
+ * \brief Find the read termination in the buffered data.
+ *
+ * Searches the unconsumed region of \ref readBuffer for the configured read termination.
+ *
+ * \return Number of bytes up to and including the termination, if found.
+ */
+std::optional<std::size_t> TCPSocketWrapper::findBufferedReadTermination() const
+{
+    const auto dataBegin = readBuffer.begin() + readBufferBegin;
+    const auto termPos = std::search(dataBegin, readBuffer.end(), readTermination.begin(), readTermination.end());
+
+    if (termPos == readBuffer.end())
+        return std::nullopt;
+
+    return static_cast<std::size_t>(termPos - dataBegin) + readTerminationLength;
+}
+
+/*!
+ * \brief Mark a number of buffered bytes as consumed.
+ *
+ * Advances \ref readBufferBegin by \p pNumBytes. The buffer is cleared (keeping its capacity) when all bytes are consumed
+ * and compacted (see compactReadBuffer()) as soon as the consumed region is at least as large as the remaining data,
+ * such that every byte is moved at most a constant number of times on average.
+ *
+ * \param pNumBytes Number of bytes to consume (must not exceed getBufferedSize()).
+ */
+void TCPSocketWrapper::consumeReadBuffer(const std::size_t pNumBytes)
+{
+    readBufferBegin += pNumBytes;
+
+    if (readBufferBegin == readBuffer.size())
+    {
+        readBuffer.clear();
+        readBufferBegin = 0;
+    }
+    else if (readBufferBegin >= readBuffer.size() - readBufferBegin)
+        compactReadBuffer();
+}
+
+/*!
+ * \brief Move the unconsumed data to the front of the read buffer.
+ *
+ * Removes the consumed region of \ref readBuffer and resets \ref readBufferBegin to zero.
+ */
+void TCPSocketWrapper::compactReadBuffer()
+{
+    if (readBufferBegin == 0)
+        return;
+
+    readBuffer.erase(readBuffer.begin(), readBuffer.begin() + readBufferBegin);
+    readBufferBegin = 0;
+}
+
+//
+
+/*!
+ * \brief Issue the next async read of the continuous reading (handler is handleAsyncRead()).
+ *
+ * Starts an asynchronous operation to read some bytes from the socket into \ref asyncReadBuffer
+ * and process those read bytes by handleAsyncRead().
+ *
+ * Note: \ref asyncReadMutex must be locked by the caller.
+ */
+void TCPSocketWrapper::issueAsyncRead()
+{
+    socket.async_read_some(boost::asio::buffer(asyncReadBuffer),
+                           std::bind(&TCPSocketWrapper::handleAsyncRead, this, std::placeholders::_1, std::placeholders::_2));
+}
+
+/*!
+ * \brief Pass data from a single async read to the data handler and continue reading.
+ *
+ * Passes the \p pNumBytes bytes read by issueAsyncRead() to the data handler and continues
+ * or stops the continuous reading by calling processAsyncReadData().
+ *
+ * If \p pErrorCode signals an error (other than the socket being cancelled), the error gets logged (see Logger)
+ * and the current error count gets incremented. The continuous reading gets disabled automatically as soon as
+ * this error count exceeds a fixed maximum threshold (see \ref maxAsyncReadErrorCount) or immediately if
+ * the connection was closed by the remote endpoint.
+ *
+ * \param pErrorCode Result/error code of the handled async read.
+ * \param pNumBytes Number of successfully transferred bytes.
+ */
+void TCPSocketWrapper::handleAsyncRead(const boost::system::error_code& pErrorCode, const std::size_t pNumBytes)
+{
+    asyncReadDataBegin = 0;
+    asyncReadDataEnd = pNumBytes;
+
+    if (pErrorCode.value() != boost::system::errc::success && pErrorCode.value() != boost::system::errc::operation_canceled)
+    {
+        checkConnectionLoss(pErrorCode);
+
+        if (pErrorCode == boost::asio::error::eof)
+        {
+            asyncReadsEnabled.store(false);
+            Logger::logError("Connection of TCP socket for \"" + hostName + ":" + std::to_string(port) + "\" closed by remote endpoint. "
+                             "Stopping continuous reading...");
+        }
+        else
+        {
+            Logger::logError("Exception while reading from TCP socket for \"" + hostName + ":" + std::to_string(port) + "\": " +
+                             pErrorCode.message());
+
+            if (++asyncReadErrorCount > maxAsyncReadErrorCount)
+            {
+                asyncReadsEnabled.store(false);
+                Logger::logCritical("Exceeded maximum error count while continuously reading from TCP socket for \"" +
+                                    hostName + ":" + std::to_string(port) + "\". Stopping...");
+            }
+        }
+    }
+
+    processAsyncReadData();
+}
+
+/*!
+ * \brief Retry passing not yet accepted data to the data handler and continue reading.
+ *
+ * Calls processAsyncReadData() after the delay started by processAsyncReadData().
+ *
+ * \param pErrorCode Result/error code of the handled timer wait (ignored).
+ */
+void TCPSocketWrapper::handleAsyncRetry(const boost::system::error_code& pErrorCode)
+{
+    (void)pErrorCode;
+
+    processAsyncReadData();
+}
+
+/*!
+ * \brief Pass pending data to the data handler and continue or stop the continuous reading.
+ *
+ * Passes the data in \ref asyncReadBuffer that was not accepted yet to the data handler (if any).
+ *
+ * If the continuous reading is still enabled (see startAsyncReads() / stopAsyncReads()), either issues the
+ * next read (see issueAsyncRead()) or, if the handler did not accept all data, schedules another attempt
+ * after the configured retry interval (see handleAsyncRetry()). Otherwise signals the stopped reading.
+ *
+ * Exceptions thrown by the data handler are logged and the concerned data is dropped.
+ */
+void TCPSocketWrapper::processAsyncReadData()
+{
+    processAsyncResetRequests();
+
+    if (asyncReadDataBegin < asyncReadDataEnd)
+    {
+        const std::size_t numBytes = asyncReadDataEnd - asyncReadDataBegin;
+
+        try
+        {
+            asyncReadDataBegin += std::min(asyncReadHandler(std::span<const std::uint8_t>(asyncReadBuffer.data() + asyncReadDataBegin,
+                                                                                          numBytes)), numBytes);
+        }
+        catch (const std::exception& exc)
+        {
+            asyncReadDataBegin = asyncReadDataEnd;
+            Logger::logError("Exception while handling data read from TCP socket for \"" + hostName + ":" + std::to_string(port) + "\": " +
+                             exc.what());
+        }
+    }
+
+    const std::lock_guard<std::mutex> asyncLock(asyncReadMutex);
+    (void)asyncLock;
+
+    if (!asyncResetRequests.empty())
+        boost::asio::post(socket.get_executor(), std::bind(&TCPSocketWrapper::processAsyncReadData, this));
+    else if (!asyncReadsEnabled.load())
+    {
+        asyncReadsStopped.store(true);
+        asyncReadsStopped.notify_all();
+    }
+    else if (asyncReadDataBegin < asyncReadDataEnd)
+    {
+        asyncRetryTimer.expires_after(asyncRetryInterval);
+        asyncRetryTimer.async_wait(std::bind(&TCPSocketWrapper::handleAsyncRetry, this, std::placeholders::_1));
+    }
+    else
+        issueAsyncRead();
+}
+
+/*!
+ * \brief Discard the received data and call the handlers of the pending reset requests.
+ *
+ * Does nothing if there are no pending requests (see resetAsyncReads()). Otherwise discards the data in
+ * \ref asyncReadBuffer that was not accepted yet and reads and discards all data already available on the socket.
+ * Then calls the handlers of all pending requests and completes the requests. Exceptions from discarding
+ * the data or from the handlers are passed to the waiting callers of resetAsyncReads().
+ *
+ * Note: Must only be called from processAsyncReadData().
+ */
+void TCPSocketWrapper::processAsyncResetRequests()
+{
+    decltype(asyncResetRequests) requests;
+
+    {
+        const std::lock_guard<std::mutex> asyncLock(asyncReadMutex);
+        (void)asyncLock;
+
+        requests.swap(asyncResetRequests);
+    }
+
+    if (requests.empty())
+        return;
+
+    asyncReadDataBegin = asyncReadDataEnd;
+
+    std::exception_ptr discardError = nullptr;
+
+    try
+    {
+        while (socket.available() > 0)
+            (void)socket.read_some(boost::asio::buffer(asyncReadBuffer));
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        checkConnectionLoss(exc.code());
+        discardError = std::make_exception_ptr(std::runtime_error(std::string("Exception while discarding data read from TCP socket: ") +
+                                                                  exc.what()));
+    }
+
+    for (auto& [handler, promise] : requests)
+    {
+        if (discardError)
+        {
+            promise.set_exception(discardError);
+            continue;
+        }
+
+        try
+        {
+            handler.get()();
+            promise.set_value();
+        }
+        catch (...)
+        {
+            promise.set_exception(std::current_exception());
+        }
+    }
+}
+
+
+//
+
+/*!
+ * \brief Connect a socket to the resolved endpoints and apply the socket options.
+ *
+ * Connects \p pSocket to one of the endpoints resolved by init(). If \p pConnectTimeout is non-zero,
+ * it is used as timeout for the connection attempt. If the timeout is reached, \p pTimedOut will
+ * be set to true (if defined) and an exception is thrown.
+ *
+ * If there are multiple endpoints, they are not tried one after another but in parallel with staggered starts
+ * (see connectSocketParallel()), such that an unreachable first endpoint does not delay the connection.
+ *
+ * The socket options passed to the constructor are applied after a successful connection.
+ * If this fails, the socket is closed again.
+ *
+ * \throws std::runtime_error On timeout.
+ * \throws std::runtime_error If connecting the socket fails.
+ * \throws std::runtime_error If applying the configured socket options fails (see applySocketOptions()).
+ *
+ * \param pSocket Socket to connect.
+ * \param pConnectTimeout The timeout for the connection attempt.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ */
+void TCPSocketWrapper::connectSocket(boost::asio::ip::tcp::socket& pSocket, const std::chrono::milliseconds pConnectTimeout,
+                                     const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    try
+    {
+        if (endpoints.size() > 1)
+            connectSocketParallel(pSocket, pConnectTimeout, pTimedOut);
+        else if (pConnectTimeout <= std::chrono::milliseconds::zero())
+            boost::asio::connect(pSocket, endpoints);
+        else
+        {
+            std::future<boost::asio::ip::tcp::endpoint> endpoint = boost::asio::async_connect(pSocket, endpoints, boost::asio::use_future);
+
+            (void)ASIOHelper::getAsyncBoostFutureWithTimedOutCancel(endpoint, pSocket, pConnectTimeout, pTimedOut);
+        }
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        throw std::runtime_error(std::string("Exception while connecting TCP socket: ") + exc.what());
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error(std::string("Exception while connecting TCP socket: ") + exc.what());
+    }
+    catch (const std::invalid_argument&)
+    {
+        throw std::runtime_error("Invalid future argument. THIS SHOULD NEVER HAPPEN!");
+    }
+
+    try
+    {
+        applySocketOptions(pSocket, socketOptions);
+    }
+    catch (const std::runtime_error&)
+    {
+        boost::system::error_code errorCode;
+        pSocket.close(errorCode);   //Do not keep a connection with partially applied socket options
+
+        throw;
+    }
+}
+
+/*!
+ * \brief Connect a socket to the first reachable of multiple resolved endpoints.
+ *
+ * Starts a connection attempt for the first endpoint resolved by init() and starts an attempt for the next endpoint
+ * whenever \ref connectAttemptDelay has passed or all started attempts have failed ("happy eyeballs", see RFC 8305).
+ * The endpoints are tried alternating between the address families, in the order of the first endpoint of each family.
+ * The first successful attempt wins and all other attempts are aborted. Its socket then replaces \p pSocket.
+ *
+ * If \p pConnectTimeout is non-zero, all attempts are aborted after this timeout,
+ * \p pTimedOut will be set to true (if defined) and an exception is thrown.
+ *
+ * \throws std::runtime_error On timeout.
+ * \throws boost::system::system_error If all attempts failed (error of the last failed attempt).
+ *
+ * \param pSocket Socket to be replaced by the connected socket.
+ * \param pConnectTimeout The timeout for all connection attempts together.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ */
+void TCPSocketWrapper::connectSocketParallel(boost::asio::ip::tcp::socket& pSocket, const std::chrono::milliseconds pConnectTimeout,
+                                             const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    if (pTimedOut.has_value())
+        pTimedOut->get() = false;
+
+    std::vector<boost::asio::ip::tcp::endpoint> firstFamily;
+    std::vector<boost::asio::ip::tcp::endpoint> otherFamily;
+
+    for (const boost::asio::ip::tcp::resolver::results_type::value_type& entry : endpoints)
+    {
+        if (entry.endpoint().protocol() == endpoints.begin()->endpoint().protocol())
+            firstFamily.push_back(entry.endpoint());
+        else
+            otherFamily.push_back(entry.endpoint());
+    }
+
+    std::vector<boost::asio::ip::tcp::endpoint> interleaved;
+    interleaved.reserve(firstFamily.size() + otherFamily.size());
+
+    for (std::size_t i = 0; i < std::max(firstFamily.size(), otherFamily.size()); ++i)
+    {
+        if (i < firstFamily.size())
+            interleaved.push_back(firstFamily[i]);
+        if (i < otherFamily.size())
+            interleaved.push_back(otherFamily[i]);
+    }
+
+    const std::shared_ptr<ParallelConnectState> state = std::make_shared<ParallelConnectState>(pSocket.get_executor(), std::move(interleaved),
+                                                                                               connectAttemptDelay);
+    std::future<std::size_t> winner = state->winner.get_future();
+
+    {
+        const std::lock_guard<std::mutex> stateLock(state->mutex);
+        (void)stateLock;
+
+        startParallelConnectAttempt(state);
+    }
+
+    if (pConnectTimeout > std::chrono::milliseconds::zero() && winner.wait_for(pConnectTimeout) == std::future_status::timeout)
+    {
+        const std::lock_guard<std::mutex> stateLock(state->mutex);
+        (void)stateLock;
+
+        if (!state->done)   //Otherwise finished while acquiring the lock
+        {
+            state->done = true;
+            abortParallelConnect(*state, state->sockets.size());
+
+            if (pTimedOut.has_value())
+                pTimedOut->get() = true;
+
+            throw std::runtime_error("Timeout.");
+        }
+    }
+
+    const std::size_t index = winner.get();     //This may throw an exception
+
+    const std::lock_guard<std::mutex> stateLock(state->mutex);
+    (void)stateLock;
+
+    pSocket = std::move(*state->sockets[index]);
+}
+
+/*!
+ * \brief Shut down and close the (main) socket.
+ *
+ * Shuts down send/receive operations and closes the connection of \ref socket.
+ *
+ * \throws std::runtime_error If shutting down or closing the socket fails.
+ */
+void TCPSocketWrapper::disconnectSocket()
+{
+    try
+    {
+        try
         {
             socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both);
         }
@@ -569,4 +1828,109 @@ void TCPSocketWrapper::close()
     }
 }
 
+/*!
+ * \brief Flag the connection as lost if an error code signals a broken connection.
+ *
+ * Sets the connection lost flag (see isConnectionLost()) if \p pErrorCode signals that the connection
+ * was closed by the remote endpoint, reset, aborted or that the socket is not connected (anymore).
+ *
+ * \param pErrorCode Error code of a failed transfer.
+ */
+void TCPSocketWrapper::checkConnectionLoss(const boost::system::error_code& pErrorCode)
+{
+    if (pErrorCode == boost::asio::error::eof ||
+        pErrorCode == boost::asio::error::connection_reset ||
+        pErrorCode == boost::asio::error::connection_aborted ||
+        pErrorCode == boost::asio::error::broken_pipe ||
+        pErrorCode == boost::asio::error::not_connected ||
+        pErrorCode == boost::asio::error::bad_descriptor)
+    {
+        connectionLost.store(true);
+    }
+}
+
+//
+
+/*!
+ * \brief Start connecting the standby socket (handler is handleStandbyConnect()).
+ *
+ * Starts an asynchronous connection of \ref standbySocket to the endpoints resolved by init(),
+ * unless the standby socket is already connected or a connection attempt is already in progress.
+ */
+void TCPSocketWrapper::startStandbyConnect()
+{
+    const std::lock_guard<std::mutex> standbyLock(standbyMutex);
+    (void)standbyLock;
+
+    if (standbyConnected || standbyConnectPending.load())
+        return;
+
+    standbyConnectPending.store(true);
+
+    boost::asio::async_connect(standbySocket, endpoints, std::bind(&TCPSocketWrapper::handleStandbyConnect, this, std::placeholders::_1));
+}
+
+/*!
+ * \brief Finish connecting the standby socket.
+ *
+ * Applies the socket options to the connected standby socket and marks it as ready to replace a lost connection
+ * (see reconnectIfLost()). If connecting or applying the options failed, a warning is logged (see Logger)
+ * and the standby socket stays unused until the next reconnect.
+ *
+ * \param pErrorCode Result/error code of the handled async connect.
+ */
+void TCPSocketWrapper::handleStandbyConnect(const boost::system::error_code& pErrorCode)
+{
+    {
+        const std::lock_guard<std::mutex> standbyLock(standbyMutex);
+        (void)standbyLock;
+
+        if (pErrorCode.value() == boost::system::errc::success)
+        {
+            try
+            {
+                applySocketOptions(standbySocket, socketOptions);
+                standbyConnected = true;
+            }
+            catch (const std::runtime_error& exc)
+            {
+                boost::system::error_code errorCode;
+                standbySocket.close(errorCode);
+
+                Logger::logWarning("Could not prepare standby TCP socket for \"" + hostName + ":" + std::to_string(port) + "\": " +
+                                   exc.what());
+            }
+        }
+        else if (pErrorCode.value() != boost::system::errc::operation_canceled)
+        {
+            Logger::logWarning("Could not connect standby TCP socket for \"" + hostName + ":" + std::to_string(port) + "\": " +
+                               pErrorCode.message());
+        }
+    }
+
+    standbyConnectPending.store(false);
+    standbyConnectPending.notify_all();
+}
+
+/*!
+ * \brief Close the standby socket and wait for its handler.
+ *
+ * Closes \ref standbySocket, which cancels a pending connection attempt, and waits
+ * until the handler of such an attempt (see handleStandbyConnect()) has finished.
+ */
+void TCPSocketWrapper::closeStandby()
+{
+    {
+        const std::lock_guard<std::mutex> standbyLock(standbyMutex);
+        (void)standbyLock;
+
+        boost::system::error_code errorCode;
+        standbySocket.close(errorCode);
+
+        standbyConnected = false;
+    }
+
+    standbyConnectPending.wait(true);
+}
+
 /// \endcond INTERNAL
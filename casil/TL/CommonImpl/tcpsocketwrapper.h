@@ -24,14 +24,30 @@
 #ifndef CASIL_LAYERS_TL_COMMONIMPL_TCPSOCKETWRAPPER_H
 #define CASIL_LAYERS_TL_COMMONIMPL_TCPSOCKETWRAPPER_H
 
+#include <casil/TL/CommonImpl/reconnectpolicy.h>
+#include <casil/TL/CommonImpl/socketoptions.h>
+
+#include <casil/pooledbuffer.h>
+
+#include <utility>  //Missing include in boost/asio/awaitable.hpp of some Boost versions
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/system/error_code.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
+#include <future>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace casil
@@ -49,15 +65,34 @@ namespace CommonImpl
  *
  * Wraps the %TCP socket by providing basic synchronous connect/read/write functionality with
  * the option to use timeouts (abstracting necessary internal <em>a</em>synchronous calls etc.).
+ *
+ * Alternatively incoming data can be continuously read by a chain of asynchronous reads that pass
+ * the data to a handler function as soon as it arrives (see startAsyncReads()). While this continuous reading is active,
+ * the chain owns the socket exclusively and the received data can be discarded by posting a reset request to it
+ * (see resetAsyncReads()) instead of stopping and restarting the reading.
+ *
+ * As a third option the read/write functionality is also available as C++20 coroutines (see coRead(), coReadMax(), coWrite()),
+ * which can be awaited from a coroutine without blocking a thread for each transfer (the timeouts are handled by timers).
+ *
+ * A lost connection can be re-established without re-initializing the whole wrapper via reconnectIfLost(),
+ * according to a configurable reconnect policy (see ReconnectPolicy).
  */
 class TCPSocketWrapper
 {
 public:
-    TCPSocketWrapper(std::string pHostName, int pPort, std::string pReadTermination, const std::string& pWriteTermination);
+    using AsyncReadHandlerType = std::function<std::size_t(std::span<const std::uint8_t>)>;
+                                                                ///< \brief Handler type for continuously read data
+                                                                ///  (returns the number of accepted bytes).
+    using AsyncResetHandlerType = std::function<void()>;        ///< Handler type for resetting the continuous reading (see resetAsyncReads()).
+
+public:
+    TCPSocketWrapper(std::string pHostName, int pPort, std::string pReadTermination, const std::string& pWriteTermination,
+                     boost::asio::io_context& pIOContext, const SocketOptions& pSocketOptions = SocketOptions(),
+                     const ReconnectPolicy& pReconnectPolicy = ReconnectPolicy());
                                                                 ///< Constructor.
     TCPSocketWrapper(const TCPSocketWrapper&) = delete;         ///< Deleted copy constructor.
-    TCPSocketWrapper(TCPSocketWrapper&&) = default;             ///< Default move constructor.
-    ~TCPSocketWrapper() = default;                              ///< Default destructor.
+    TCPSocketWrapper(TCPSocketWrapper&&) = delete;              ///< Deleted move constructor.
+    ~TCPSocketWrapper();                                        ///< Destructor.
     //
     TCPSocketWrapper& operator=(TCPSocketWrapper) = delete;     ///< Deleted copy assignment operator.
     TCPSocketWrapper& operator=(TCPSocketWrapper&&) = delete;   ///< Deleted move assignment operator.
@@ -69,16 +104,94 @@ public:
     std::vector<std::uint8_t> readMax(int pSize, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
                                       std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
                                                                                     ///< Read maximally some amount of bytes from the socket.
+    std::size_t readInto(std::span<std::uint8_t> pBuffer, int pSize, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                         std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                    ///< \brief Read an amount of bytes from the socket,
+                                                                                    ///  or until read termination, into a buffer.
+    PooledBuffer readPooled(int pSize, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                            std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                    ///< \brief Read an amount of bytes from the socket,
+                                                                                    ///  or until read termination, into a pooled buffer.
     void write(const std::vector<std::uint8_t>& pData, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
                std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
                                                                                     ///< Write data to the socket (automatically terminated).
+    void writeGather(std::span<const std::span<const std::uint8_t>> pBuffers,
+                     std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                     std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                    ///< \brief Write multiple data buffers to the socket
+                                                                                    ///  at once (automatically terminated).
+    //
+    boost::asio::awaitable<std::vector<std::uint8_t>> coRead(int pSize, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                                                             std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                    ///< \brief Read an amount of bytes from the socket,
+                                                                                    ///  or until read termination (coroutine).
+    boost::asio::awaitable<std::vector<std::uint8_t>> coReadMax(int pSize, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                                                                std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                    ///< \brief Read maximally some amount of bytes
+                                                                                    ///  from the socket (coroutine).
+    boost::asio::awaitable<void> coWrite(std::vector<std::uint8_t> pData, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                                         std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                    ///< \brief Write data to the socket
+                                                                                    ///  (automatically terminated; coroutine).
     //
     bool readBufferEmpty() const;                               ///< Check if the read buffer is empty (and no remaining data to be read).
     void clearReadBuffer();                                     ///< Read remaining data from the socket and then clear the read buffer contents.
     //
+    void startAsyncReads(std::size_t pBufferSize, AsyncReadHandlerType pHandler,
+                         std::chrono::milliseconds pRetryInterval = std::chrono::milliseconds(10));
+                                                                ///< Start continuously reading from the socket asynchronously.
+    void stopAsyncReads();                                      ///< Stop the continuous asynchronous reading and wait until it has stopped.
+    bool asyncReadsActive() const;                              ///< Check if the continuous asynchronous reading is active.
+    void resetAsyncReads(const AsyncResetHandlerType& pHandler);
+                                                                ///< \brief Discard all data received so far and call a handler
+                                                                ///  from within the continuous reading.
+    //
     void init(std::chrono::milliseconds pConnectTimeout = std::chrono::milliseconds::zero(),
               std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);            ///< Connect the %TCP socket.
     void close();                                                                               ///< Disconnect the %TCP socket.
+    //
+    bool isConnectionLost() const;                                                              ///< Check if the connection was lost.
+    bool isReconnectRequired() const;                                                           ///< \brief Check if the connection was lost and
+                                                                                                ///  can be re-established by reconnectIfLost().
+    bool reconnectIfLost();                                                                     ///< \brief Re-establish a lost connection
+                                                                                                ///  according to the reconnect policy.
+
+private:
+    std::pair<std::size_t, std::size_t> readUntilTermination(std::chrono::milliseconds pTimeout,
+                                                             std::optional<std::reference_wrapper<bool>> pTimedOut);
+                                                                                                ///< \brief Fill the read buffer up to and
+                                                                                                ///  including the read termination.
+    //
+    std::size_t getBufferedSize() const;                                                        ///< Get the number of buffered but not yet consumed bytes.
+    std::optional<std::size_t> findBufferedReadTermination() const;                             ///< Find the read termination in the buffered data.
+    void consumeReadBuffer(std::size_t pNumBytes);                                              ///< Mark a number of buffered bytes as consumed.
+    void compactReadBuffer();                                                                   ///< Move the unconsumed data to the front of the read buffer.
+    //
+    void issueAsyncRead();                                                                      ///< \brief Issue the next async read of the
+                                                                                                ///  continuous reading (handler is handleAsyncRead()).
+    void handleAsyncRead(const boost::system::error_code& pErrorCode, std::size_t pNumBytes);   ///< \brief Pass data from a single async read
+                                                                                                ///  to the data handler and continue reading.
+    void handleAsyncRetry(const boost::system::error_code& pErrorCode);                         ///< \brief Retry passing not yet accepted data
+                                                                                                ///  to the data handler and continue reading.
+    void processAsyncReadData();                                                                ///< \brief Pass pending data to the data handler
+                                                                                                ///  and continue or stop the continuous reading.
+    void processAsyncResetRequests();                                                           ///< \brief Discard the received data and call the
+                                                                                                ///  handlers of the pending reset requests.
+    //
+    void connectSocket(boost::asio::ip::tcp::socket& pSocket, std::chrono::milliseconds pConnectTimeout,
+                       std::optional<std::reference_wrapper<bool>> pTimedOut);                  ///< \brief Connect a socket to the resolved
+                                                                                                ///  endpoints and apply the socket options.
+    void connectSocketParallel(boost::asio::ip::tcp::socket& pSocket, std::chrono::milliseconds pConnectTimeout,
+                               std::optional<std::reference_wrapper<bool>> pTimedOut);          ///< \brief Connect a socket to the first reachable
+                                                                                                ///  of multiple resolved endpoints.
+    void disconnectSocket();                                                                    ///< Shut down and close the (main) socket.
+    void checkConnectionLoss(const boost::system::error_code& pErrorCode);                      ///< \brief Flag the connection as lost if an
+                                                                                                ///  error code signals a broken connection.
+    //
+    void startStandbyConnect();                                                                 ///< \brief Start connecting the standby socket
+                                                                                                ///  (handler is handleStandbyConnect()).
+    void handleStandbyConnect(const boost::system::error_code& pErrorCode);                     ///< \brief Finish connecting the standby socket.
+    void closeStandby();                                                                        ///< Close the standby socket and wait for its handler.
 
 private:
     const std::string hostName;                         ///< Host name of the remote endpoint.
@@ -89,9 +202,43 @@ private:
     const std::vector<std::uint8_t> writeTermination;   ///< Write termination to append to written data.
     const std::size_t writeTerminationLength;           ///< Number of read termination characters/bytes.
     //
-    boost::asio::ip::tcp::socket socket;                ///< %TCP socket.
+    const SocketOptions socketOptions;                  ///< Socket options to apply after connecting.
+    const ReconnectPolicy reconnectPolicy;              ///< Policy for re-establishing lost connections.
+    //
+    boost::asio::io_context& ioContext;                 ///< IO context used by the socket.
+    boost::asio::ip::tcp::socket socket;                ///< %TCP socket (using a strand of \ref ioContext).
+    boost::asio::ip::tcp::resolver::results_type endpoints;
+                                                        ///< Endpoints resolved for the host name by init().
+    std::chrono::milliseconds connectTimeout;           ///< Connection timeout passed to init(), also used for reconnecting.
+    //
+    std::atomic_bool connectionLost;                    ///< Flag set when a transfer failed due to a broken connection.
+    std::mutex reconnectMutex;                          ///< Mutex to allow only one reconnect in flight (see reconnectIfLost()).
+    boost::asio::ip::tcp::socket standbySocket;         ///< Pre-connected socket to replace a lost connection (same strand as \ref socket).
+    std::mutex standbyMutex;                            ///< Mutex for \ref standbySocket and \ref standbyConnected.
+    bool standbyConnected;                              ///< \ref standbySocket is connected and ready to be used.
+    std::atomic_bool standbyConnectPending;             ///< Asynchronous connect of \ref standbySocket is in progress.
     //
     std::vector<std::uint8_t> readBuffer;               ///< Buffer for incoming data.
+    std::size_t readBufferBegin;                        ///< Start of not yet consumed data in \ref readBuffer.
+    //
+    std::vector<std::uint8_t> asyncReadBuffer;          ///< Buffer for the continuous asynchronous reads.
+    std::size_t asyncReadDataBegin;                     ///< Start of data in \ref asyncReadBuffer not yet accepted by \ref asyncReadHandler.
+    std::size_t asyncReadDataEnd;                       ///< End of data in \ref asyncReadBuffer not yet accepted by \ref asyncReadHandler.
+    AsyncReadHandlerType asyncReadHandler;              ///< Handler for the continuously read data.
+    std::chrono::milliseconds asyncRetryInterval;       ///< Delay before passing not accepted data to \ref asyncReadHandler again.
+    boost::asio::steady_timer asyncRetryTimer;          ///< Timer for \ref asyncRetryInterval.
+    std::mutex asyncReadMutex;                          ///< Mutex for issuing async operations vs. stopping the continuous reading.
+    std::atomic_bool asyncReadsEnabled;                 ///< Flag to control/stop the continuous reading.
+    std::atomic_bool asyncReadsStopped;                 ///< Flag to signal stopped continuous reading (last handler finished).
+    std::size_t asyncReadErrorCount;                    ///< Current error count of the continuous reading.
+    std::deque<std::pair<std::reference_wrapper<const AsyncResetHandlerType>, std::promise<void>>> asyncResetRequests;
+                                                        ///< \brief Pending reset requests for the continuous reading
+                                                        ///  (see resetAsyncReads(); guarded by \ref asyncReadMutex).
+
+private:
+    static constexpr std::size_t maxAsyncReadErrorCount = 10;   ///< Maximum error count for the continuous reading before it stops itself.
+    static constexpr std::chrono::milliseconds connectAttemptDelay = std::chrono::milliseconds(250);
+                                                                ///< Delay before starting the next parallel connection attempt (see connectSocketParallel()).
 };
 
 } // namespace CommonImpl
@@ -25,17 +25,31 @@
 
 #include <casil/asio.h>
 #include <casil/TL/CommonImpl/asiohelper.h>
+#include <casil/TL/CommonImpl/endpointcache.h>
 
+#include <boost/predef/os/linux.h>
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/connect.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <boost/asio/use_future.hpp>
+#include <boost/system/error_code.hpp>
 #include <boost/system/system_error.hpp>
 
+#include <algorithm>
+#include <array>
 #include <future>
 #include <stdexcept>
 #include <utility>
 
+#if BOOST_OS_LINUX != 0
+#include <cerrno>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
 /// \cond INTERNAL
 
 using casil::Layers::TL::CommonImpl::UDPSocketWrapper;
@@ -45,15 +59,21 @@ using casil::Layers::TL::CommonImpl::UDPSocketWrapper;
 /*!
  * \brief Constructor.
  *
- * Note: Initializes the socket using the IO context from ASIO::getIOContext().
+ * Note: Initializes the socket using a new strand of \p pIOContext (see ASIO::getIOContext(int)),
+ * such that the asynchronous handlers of this socket never run concurrently.
  *
  * \param pHostName Host name of the remote endpoint.
  * \param pPort Network port to be used.
+ * \param pIOContext IO context to be used for the socket.
+ * \param pSocketOptions Socket options to be applied when connecting the socket (see init()).
  */
-UDPSocketWrapper::UDPSocketWrapper(std::string pHostName, const int pPort) :
+UDPSocketWrapper::UDPSocketWrapper(std::string pHostName, const int pPort, boost::asio::io_context& pIOContext,
+                                   const SocketOptions& pSocketOptions) :
     hostName(std::move(pHostName)),
     port(pPort),
-    socket(ASIO::getIOContext()),
+    socketOptions(pSocketOptions),
+    ioContext(pIOContext),
+    socket(boost::asio::make_strand(ioContext)),
     readBuffer()
 {
 }
@@ -77,34 +97,7 @@ UDPSocketWrapper::UDPSocketWrapper(std::string pHostName, const int pPort) :
 std::vector<std::uint8_t> UDPSocketWrapper::read(const std::chrono::milliseconds pTimeout,
                                                  const std::optional<std::reference_wrapper<bool>> pTimedOut)
 {
-    std::size_t n = 0;
-
-    try
-    {
-        if (pTimeout <= std::chrono::milliseconds::zero())
-            n = socket.receive(boost::asio::buffer(readBuffer, readBufferSize));
-        else
-        {
-            std::promise<std::size_t> promiseN;
-
-            socket.async_receive(boost::asio::buffer(readBuffer, readBufferSize),
-                                 std::bind(&ASIOHelper::readWriteHandler, std::placeholders::_1, std::placeholders::_2, std::ref(promiseN)));
-
-            n = ASIOHelper::getAsyncTransferredWithTimedOutCancel(promiseN, socket, pTimeout, pTimedOut);
-        }
-    }
-    catch (const boost::system::system_error& exc)
-    {
-        throw std::runtime_error(std::string("Exception while reading from UDP socket: ") + exc.what());
-    }
-    catch (const std::runtime_error& exc)
-    {
-        throw std::runtime_error(std::string("Unexpected runtime error (THIS SHOULD NEVER HAPPEN!): ") + exc.what());
-    }
-    catch (const std::invalid_argument&)
-    {
-        throw std::runtime_error("Invalid promise argument. THIS SHOULD NEVER HAPPEN!");
-    }
+    const std::size_t n = readInto(std::span<std::uint8_t>(readBuffer.data(), readBufferSize), pTimeout, pTimedOut);
 
     return std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + n);
 }
@@ -130,35 +123,9 @@ std::vector<std::uint8_t> UDPSocketWrapper::readMax(const int pSize, const std::
 {
     if (pSize > 0)
     {
-        std::size_t n = 0;
-
-        try
-        {
-            if (pTimeout <= std::chrono::milliseconds::zero())
-                n = socket.receive(boost::asio::buffer(readBuffer, static_cast<std::size_t>(pSize)));
-            else
-            {
-                std::promise<std::size_t> promiseN;
-
-                socket.async_receive(boost::asio::buffer(readBuffer, static_cast<std::size_t>(pSize)),
-                                     std::bind(&ASIOHelper::readWriteHandler,
-                                               std::placeholders::_1, std::placeholders::_2, std::ref(promiseN)));
+        const std::size_t size = std::min(static_cast<std::size_t>(pSize), readBufferSize);
 
-                n = ASIOHelper::getAsyncTransferredWithTimedOutCancel(promiseN, socket, pTimeout, pTimedOut);
-            }
-        }
-        catch (const boost::system::system_error& exc)
-        {
-            throw std::runtime_error(std::string("Exception while reading from UDP socket: ") + exc.what());
-        }
-        catch (const std::runtime_error& exc)
-        {
-            throw std::runtime_error(std::string("Unexpected runtime error (THIS SHOULD NEVER HAPPEN!): ") + exc.what());
-        }
-        catch (const std::invalid_argument&)
-        {
-            throw std::runtime_error("Invalid promise argument. THIS SHOULD NEVER HAPPEN!");
-        }
+        const std::size_t n = readInto(std::span<std::uint8_t>(readBuffer.data(), size), pTimeout, pTimedOut);
 
         return std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + n);
     }
@@ -166,6 +133,73 @@ std::vector<std::uint8_t> UDPSocketWrapper::readMax(const int pSize, const std::
         return {};
 }
 
+/*!
+ * \brief Receive a single datagram from the socket into a buffer.
+ *
+ * Reads one datagram from the socket into \p pBuffer, truncating it to the buffer size.
+ * Works like read() / readMax() but does not allocate memory for the received datagram.
+ *
+ * If \p pTimeout is non-zero and that timeout is reached, \p pTimedOut will
+ * be set to true (if defined) and the already read bytes will be returned.
+ *
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pBuffer Buffer for the datagram payload.
+ * \param pTimeout The timeout for the read operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ * \return Number of bytes written to \p pBuffer.
+ */
+std::size_t UDPSocketWrapper::readInto(const std::span<std::uint8_t> pBuffer, const std::chrono::milliseconds pTimeout,
+                                              const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    try
+    {
+        if (pTimeout <= std::chrono::milliseconds::zero())
+            return socket.receive(boost::asio::buffer(pBuffer.data(), pBuffer.size()));
+        else
+        {
+            return ASIOHelper::runTransferWithTimedOutCancel(
+                        [this, pBuffer](auto&& pToken)
+                        {
+                            return socket.async_receive(boost::asio::buffer(pBuffer.data(), pBuffer.size()), std::forward<decltype(pToken)>(pToken));
+                        },
+                        socket, ioContext, pTimeout, pTimedOut);
+        }
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        throw std::runtime_error(std::string("Exception while reading from UDP socket: ") + exc.what());
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error(std::string("Unexpected runtime error (THIS SHOULD NEVER HAPPEN!): ") + exc.what());
+    }
+}
+
+/*!
+ * \brief Receive a single datagram from the socket into a pooled buffer.
+ *
+ * Works like read() but receives the datagram directly into a PooledBuffer (i.e. without copying
+ * it from the internal read buffer), which avoids allocating memory for repeated reads.
+ *
+ * If \p pTimeout is non-zero and that timeout is reached, \p pTimedOut will
+ * be set to true (if defined) and the already read bytes will be returned.
+ *
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pTimeout The timeout for the read operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ * \return Payload byte sequence of requested datagram.
+ */
+casil::PooledBuffer UDPSocketWrapper::readPooled(const std::chrono::milliseconds pTimeout,
+                                                 const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    PooledBuffer buffer(readBufferSize);
+    buffer.resize(readInto(buffer.span(), pTimeout, pTimedOut));
+
+    return buffer;
+}
+
 /*!
  * \brief Send a single datagram over the socket.
  *
@@ -183,29 +217,201 @@ std::vector<std::uint8_t> UDPSocketWrapper::readMax(const int pSize, const std::
 void UDPSocketWrapper::write(const std::vector<std::uint8_t>& pData, const std::chrono::milliseconds pTimeout,
                              const std::optional<std::reference_wrapper<bool>> pTimedOut)
 {
-    try
+    sendDatagram(std::span<const std::uint8_t>(pData.data(), pData.size()), pTimeout, pTimedOut);
+}
+
+//
+
+/*!
+ * \brief Receive multiple datagrams from the socket into provided buffers.
+ *
+ * Waits for the first datagram like read() and then receives further datagrams that are already queued on the socket
+ * without blocking, until either all of \p pBuffers are filled (one datagram per buffer) or no more datagrams are queued.
+ * On Linux the queued datagrams are received using \c recvmmsg (i.e. one system call per up to 64 datagrams),
+ * otherwise they are received one by one. No memory is allocated for the received datagrams.
+ *
+ * The payload length of each received datagram is written to the corresponding element of \p pSizes. Datagrams larger
+ * than their buffer are truncated to the buffer size.
+ *
+ * If \p pTimeout is non-zero and that timeout is reached while waiting for the first datagram,
+ * \p pTimedOut will be set to true (if defined) and zero will be returned.
+ *
+ * \throws std::runtime_error If \p pSizes is smaller than \p pBuffers.
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pBuffers Buffers for the received datagrams.
+ * \param pSizes Gets set to the payload lengths of the received datagrams.
+ * \param pTimeout The timeout for receiving the first datagram.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ * \return Number of received datagrams (i.e. used buffers).
+ */
+std::size_t UDPSocketWrapper::readBatch(const std::span<const std::span<std::uint8_t>> pBuffers, const std::span<std::size_t> pSizes,
+                                        const std::chrono::milliseconds pTimeout, const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    if (pSizes.size() < pBuffers.size())
+        throw std::runtime_error("Exception while reading from UDP socket: Not enough elements for the datagram sizes.");
+
+    if (pTimedOut.has_value())
+        pTimedOut->get() = false;
+
+    if (pBuffers.empty())
+        return 0;
+
+    bool timedOut = false;
+
+    pSizes[0] = readInto(pBuffers[0], pTimeout, std::ref(timedOut));
+
+    if (timedOut)
     {
-        if (pTimeout <= std::chrono::milliseconds::zero())
-            socket.send(boost::asio::buffer(pData.data(), pData.size()));
-        else
-        {
-            std::future<std::size_t> futureN = socket.async_send(boost::asio::buffer(pData.data(), pData.size()), boost::asio::use_future);
+        if (pTimedOut.has_value())
+            pTimedOut->get() = true;
+
+        return 0;
+    }
+
+    return 1 + receiveQueuedDatagrams(pBuffers.subspan(1), pSizes.subspan(1));
+}
+
+/*!
+ * \brief Send multiple datagrams over the socket.
+ *
+ * Writes one datagram for each element of \p pDatagrams to the socket, in order.
+ * On Linux the datagrams are sent using \c sendmmsg (i.e. one system call per up to 64 datagrams) as long as
+ * the socket's send buffer has space, otherwise they are sent one by one. No memory is allocated for the datagrams.
+ *
+ * Whenever a datagram cannot be sent without blocking, it is sent like write() and \p pTimeout (if non-zero) is
+ * used as timeout for this send attempt. If the timeout is reached, \p pTimedOut will be set to true (if defined)
+ * and an exception is thrown (the preceding datagrams have been sent already).
+ *
+ * \throws std::runtime_error On timeout.
+ * \throws std::runtime_error If writing to the socket fails.
+ *
+ * \param pDatagrams Datagram payloads to be written.
+ * \param pTimeout The timeout for each blocking send operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ */
+void UDPSocketWrapper::writeBatch(const std::span<const std::span<const std::uint8_t>> pDatagrams, const std::chrono::milliseconds pTimeout,
+                                  const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    if (pTimedOut.has_value())
+        pTimedOut->get() = false;
 
-            (void)ASIOHelper::getAsyncBoostFutureWithTimedOutCancel(futureN, socket, pTimeout, pTimedOut);
+    std::size_t numSent = 0;
+
+    while (numSent < pDatagrams.size())
+    {
+        numSent += sendDatagramsNonBlocking(pDatagrams.subspan(numSent));
+
+        if (numSent < pDatagrams.size())
+        {
+            sendDatagram(pDatagrams[numSent], pTimeout, pTimedOut);
+            ++numSent;
         }
     }
+}
+
+//
+
+/*!
+ * \brief Receive a single datagram from the socket (coroutine).
+ *
+ * Coroutine version of read() with the same behavior, which must be awaited from a coroutine (see also
+ * ASIOHelper::awaitTransferredWithTimedOutCancel()). The socket operations complete on the IO context passed to the constructor,
+ * which hence must be run by some thread (e.g. by the IO context threads or the thread that awaits the coroutine).
+ *
+ * Note: \p pTimedOut (if defined) must stay valid until the coroutine completes.
+ *
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pTimeout The timeout for the read operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ * \return Payload byte sequence of requested datagram.
+ */
+boost::asio::awaitable<std::vector<std::uint8_t>> UDPSocketWrapper::coRead(const std::chrono::milliseconds pTimeout,
+                                                                           const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    return coReadMax(static_cast<int>(readBufferSize), pTimeout, pTimedOut);
+}
+
+/*!
+ * \brief Receive maximally some amount of bytes of a single datagram from the socket (coroutine).
+ *
+ * Coroutine version of readMax() with the same behavior (see also coRead()).
+ *
+ * Note: \p pTimedOut (if defined) must stay valid until the coroutine completes.
+ *
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pSize Maximum number of bytes to read from the datagram.
+ * \param pTimeout The timeout for the read operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ * \return Maximally \p pSize bytes of the payload of the requested datagram.
+ */
+boost::asio::awaitable<std::vector<std::uint8_t>> UDPSocketWrapper::coReadMax(const int pSize, const std::chrono::milliseconds pTimeout,
+                                                                              const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    if (pSize <= 0)
+        co_return std::vector<std::uint8_t>{};
+
+    const std::size_t size = std::min(static_cast<std::size_t>(pSize), readBufferSize);
+
+    std::size_t n = 0;
+
+    try
+    {
+        n = co_await ASIOHelper::awaitTransferredWithTimedOutCancel(
+                    [this, size](auto&& pToken)
+                    {
+                        return socket.async_receive(boost::asio::buffer(readBuffer, size), std::forward<decltype(pToken)>(pToken));
+                    },
+                    socket, pTimeout, pTimedOut);
+    }
     catch (const boost::system::system_error& exc)
     {
-        throw std::runtime_error(std::string("Exception while writing to UDP socket: ") + exc.what());
+        throw std::runtime_error(std::string("Exception while reading from UDP socket: ") + exc.what());
     }
-    catch (const std::runtime_error& exc)
+
+    co_return std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + n);
+}
+
+/*!
+ * \brief Send a single datagram over the socket (coroutine).
+ *
+ * Coroutine version of write() with the same behavior (see also coRead()).
+ *
+ * Note: \p pTimedOut (if defined) must stay valid until the coroutine completes.
+ *
+ * \throws std::runtime_error On timeout.
+ * \throws std::runtime_error If writing to the socket fails.
+ *
+ * \param pData Data to be written.
+ * \param pTimeout The timeout for the write operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ */
+boost::asio::awaitable<void> UDPSocketWrapper::coWrite(const std::vector<std::uint8_t> pData, const std::chrono::milliseconds pTimeout,
+                                                       const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{
+    bool timedOut = false;
+
+    try
     {
-        throw std::runtime_error(std::string("Exception while writing to UDP socket: ") + exc.what());
+        (void)co_await ASIOHelper::awaitTransferredWithTimedOutCancel(
+                    [this, &pData](auto&& pToken)
+                    {
+                        return socket.async_send(boost::asio::buffer(pData.data(), pData.size()), std::forward<decltype(pToken)>(pToken));
+                    },
+                    socket, pTimeout, std::ref(timedOut));
     }
-    catch (const std::invalid_argument&)
+    catch (const boost::system::system_error& exc)
     {
-        throw std::runtime_error("Invalid future argument. THIS SHOULD NEVER HAPPEN!");
+        throw std::runtime_error(std::string("Exception while writing to UDP socket: ") + exc.what());
     }
+
+    if (pTimedOut.has_value())
+        pTimedOut->get() = timedOut;
+
+    if (timedOut)
+        throw std::runtime_error("Exception while writing to UDP socket: Timeout.");
 }
 
 //
@@ -262,9 +468,15 @@ void UDPSocketWrapper::clearReadBuffer()
  * If \p pConnectTimeout is non-zero, it is used as timeout for the connection attempt.
  * If the timeout is reached, \p pTimedOut will be set to true (if defined) and an exception is thrown.
  *
+ * The host name is resolved via the process-wide EndpointCache, i.e. only if it has not been resolved recently.
+ *
+ * The socket options passed to the constructor are applied after a successful connection.
+ * If this fails, the socket is closed again.
+ *
  * \throws std::runtime_error If no IO context threads are running (see ASIO::ioContextThreadsRunning()).
  * \throws std::runtime_error On timeout.
  * \throws std::runtime_error If resolving the host name or connecting the socket fails.
+ * \throws std::runtime_error If applying the configured socket options fails (see applySocketOptions()).
  *
  * \param pConnectTimeout The timeout for the connection attempt.
  * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
@@ -276,15 +488,13 @@ void UDPSocketWrapper::init(const std::chrono::milliseconds pConnectTimeout, con
 
     try
     {
-        boost::asio::ip::udp::resolver resolver(ASIO::getIOContext());
+        const boost::asio::ip::udp::resolver::results_type endpoints = EndpointCache::resolveUDP(ioContext, hostName, port);
 
         if (pConnectTimeout <= std::chrono::milliseconds::zero())
-            boost::asio::connect(socket, resolver.resolve(hostName, std::to_string(port)));
+            boost::asio::connect(socket, endpoints);
         else
         {
-            std::future<boost::asio::ip::udp::endpoint> endpoint = boost::asio::async_connect(socket,
-                                                                                              resolver.resolve(hostName, std::to_string(port)),
-                                                                                              boost::asio::use_future);
+            std::future<boost::asio::ip::udp::endpoint> endpoint = boost::asio::async_connect(socket, endpoints, boost::asio::use_future);
 
             (void)ASIOHelper::getAsyncBoostFutureWithTimedOutCancel(endpoint, socket, pConnectTimeout, pTimedOut);
         }
@@ -301,6 +511,18 @@ void UDPSocketWrapper::init(const std::chrono::milliseconds pConnectTimeout, con
     {
         throw std::runtime_error("Invalid future argument. THIS SHOULD NEVER HAPPEN!");
     }
+
+    try
+    {
+        applySocketOptions(socket, socketOptions);
+    }
+    catch (const std::runtime_error&)
+    {
+        boost::system::error_code errorCode;
+        socket.close(errorCode);    //Do not keep a connection with partially applied socket options
+
+        throw;
+    }
 }
 
 /*!
@@ -323,4 +545,178 @@ void UDPSocketWrapper::close()
     }
 }
 
+//Private
+
+/*!
+ * \brief Send a single datagram from a buffer.
+ *
+ * See write().
+ *
+ * \throws std::runtime_error On timeout.
+ * \throws std::runtime_error If writing to the socket fails.
+ *
+ * \param pData Data to be written.
+ * \param pTimeout The timeout for the write operation.
+ * \param pTimedOut Gets set (if defined) when \p pTimeout was reached.
+ */
+void UDPSocketWrapper::sendDatagram(const std::span<const std::uint8_t> pData, const std::chrono::milliseconds pTimeout,
+                                    const std::optional<std::reference_wrapper<bool>> pTimedOut)
+{    try
+    {
+        if (pTimeout <= std::chrono::milliseconds::zero())
+            socket.send(boost::asio::buffer(pData.data(), pData.size()));
+        else
+        {
+            bool timedOut = false;
+
+            (void)ASIOHelper::runTransferWithTimedOutCancel(
+                        [this, pData](auto&& pToken)
+                        {
+                            return socket.async_send(boost::asio::buffer(pData.data(), pData.size()), std::forward<decltype(pToken)>(pToken));
+                        },
+                        socket, ioContext, pTimeout, std::ref(timedOut));
+
+            if (pTimedOut.has_value())
+                pTimedOut->get() = timedOut;
+
+            if (timedOut)
+                throw std::runtime_error("Timeout.");
+        }
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        throw std::runtime_error(std::string("Exception while writing to UDP socket: ") + exc.what());
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error(std::string("Exception while writing to UDP socket: ") + exc.what());
+    }}
+
+//
+
+/*!
+ * \brief Receive already queued datagrams without blocking.
+ *
+ * Receives datagrams into \p pBuffers (one per buffer) and writes their payload lengths to \p pSizes
+ * until all buffers are filled or no more datagrams are queued on the socket.
+ * Uses \c recvmmsg with \c MSG_DONTWAIT on Linux and otherwise receives while incoming data is available.
+ *
+ * \throws std::runtime_error If reading from the socket fails.
+ *
+ * \param pBuffers Buffers for the received datagrams.
+ * \param pSizes Gets set to the payload lengths of the received datagrams (at least as large as \p pBuffers).
+ * \return Number of received datagrams.
+ */
+std::size_t UDPSocketWrapper::receiveQueuedDatagrams(const std::span<const std::span<std::uint8_t>> pBuffers, const std::span<std::size_t> pSizes)
+{
+    std::size_t numReceived = 0;
+
+    try
+    {
+#if BOOST_OS_LINUX != 0
+        while (numReceived < pBuffers.size())
+        {
+            const std::size_t chunkSize = std::min(pBuffers.size() - numReceived, batchChunkSize);
+
+            std::array<::mmsghdr, batchChunkSize> messages {};
+            std::array<::iovec, batchChunkSize> ioVectors {};
+
+            for (std::size_t i = 0; i < chunkSize; ++i)
+            {
+                ioVectors[i].iov_base = pBuffers[numReceived + i].data();
+                ioVectors[i].iov_len = pBuffers[numReceived + i].size();
+
+                messages[i].msg_hdr.msg_iov = &ioVectors[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int ret = ::recvmmsg(socket.native_handle(), messages.data(), static_cast<unsigned int>(chunkSize), MSG_DONTWAIT, nullptr);
+
+            if (ret < 0)
+            {
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    break;
+
+                throw boost::system::system_error(boost::system::error_code(errno, boost::system::system_category()), "recvmmsg");
+            }
+
+            for (int i = 0; i < ret; ++i)
+                pSizes[numReceived + i] = std::min(static_cast<std::size_t>(messages[i].msg_len), pBuffers[numReceived + i].size());
+
+            numReceived += static_cast<std::size_t>(ret);
+
+            if (static_cast<std::size_t>(ret) < chunkSize)
+                break;
+        }
+#else
+        while (numReceived < pBuffers.size() && socket.available() > 0)
+        {
+            pSizes[numReceived] = socket.receive(boost::asio::buffer(pBuffers[numReceived].data(), pBuffers[numReceived].size()));
+            ++numReceived;
+        }
+#endif
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        throw std::runtime_error(std::string("Exception while reading from UDP socket: ") + exc.what());
+    }
+
+    return numReceived;
+}
+
+/*!
+ * \brief Send as many datagrams as possible without blocking.
+ *
+ * Sends datagrams from \p pDatagrams in order until all are sent or the socket's send buffer is full.
+ * Uses \c sendmmsg with \c MSG_DONTWAIT on Linux and otherwise sends nothing (i.e. returns zero).
+ *
+ * \throws std::runtime_error If writing to the socket fails.
+ *
+ * \param pDatagrams Datagram payloads to be written.
+ * \return Number of sent datagrams.
+ */
+std::size_t UDPSocketWrapper::sendDatagramsNonBlocking(const std::span<const std::span<const std::uint8_t>> pDatagrams)
+{
+    std::size_t numSent = 0;
+
+#if BOOST_OS_LINUX != 0
+    while (numSent < pDatagrams.size())
+    {
+        const std::size_t chunkSize = std::min(pDatagrams.size() - numSent, batchChunkSize);
+
+        std::array<::mmsghdr, batchChunkSize> messages {};
+        std::array<::iovec, batchChunkSize> ioVectors {};
+
+        for (std::size_t i = 0; i < chunkSize; ++i)
+        {
+            ioVectors[i].iov_base = const_cast<std::uint8_t*>(pDatagrams[numSent + i].data());
+            ioVectors[i].iov_len = pDatagrams[numSent + i].size();
+
+            messages[i].msg_hdr.msg_iov = &ioVectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int ret = ::sendmmsg(socket.native_handle(), messages.data(), static_cast<unsigned int>(chunkSize), MSG_DONTWAIT);
+
+        if (ret < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+
+            throw std::runtime_error(std::string("Exception while writing to UDP socket: ") +
+                                     boost::system::error_code(errno, boost::system::system_category()).message());
+        }
+
+        numSent += static_cast<std::size_t>(ret);
+
+        if (static_cast<std::size_t>(ret) < chunkSize)
+            break;
+    }
+#else
+    (void)pDatagrams;
+#endif
+
+    return numSent;
+}
+
 /// \endcond INTERNAL
@@ -24,6 +24,13 @@
 #ifndef CASIL_LAYERS_TL_COMMONIMPL_UDPSOCKETWRAPPER_H
 #define CASIL_LAYERS_TL_COMMONIMPL_UDPSOCKETWRAPPER_H
 
+#include <casil/TL/CommonImpl/socketoptions.h>
+
+#include <casil/pooledbuffer.h>
+
+#include <utility>  //Missing include in boost/asio/awaitable.hpp of some Boost versions
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/udp.hpp>
 
 #include <array>
@@ -32,6 +39,7 @@
 #include <cstdint>
 #include <functional>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -50,11 +58,18 @@ namespace CommonImpl
  *
  * Wraps the %UDP socket by providing basic synchronous connect/read/write functionality with
  * the option to use timeouts (abstracting necessary internal <em>a</em>synchronous calls etc.).
+ *
+ * The read/write functionality is also available as C++20 coroutines (see coRead(), coReadMax(), coWrite()),
+ * which can be awaited from a coroutine without blocking a thread for each transfer (the timeouts are handled by timers).
+ *
+ * For bulk transfers of many small datagrams, readBatch() and writeBatch() receive/send multiple datagrams at once
+ * using caller-provided buffers (on Linux by single \c recvmmsg / \c sendmmsg system calls for all queued datagrams).
  */
 class UDPSocketWrapper
 {
 public:
-    UDPSocketWrapper(std::string pHostName, int pPort);         ///< Constructor.
+    UDPSocketWrapper(std::string pHostName, int pPort, boost::asio::io_context& pIOContext,
+                     const SocketOptions& pSocketOptions = SocketOptions());                  ///< Constructor.
     UDPSocketWrapper(const UDPSocketWrapper&) = delete;         ///< Deleted copy constructor.
     UDPSocketWrapper(UDPSocketWrapper&&) = default;             ///< Default move constructor.
     ~UDPSocketWrapper() = default;                              ///< Default destructor.
@@ -69,9 +84,39 @@ public:
                                       std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
                                                                                                 ///< \brief Receive maximally some amount of
                                                                                                 ///  bytes of a single datagram from the socket.
+    std::size_t readInto(std::span<std::uint8_t> pBuffer, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                         std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                                ///< \brief Receive a single datagram from the
+                                                                                                ///  socket into a buffer.
+    PooledBuffer readPooled(std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                            std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                                ///< \brief Receive a single datagram from the
+                                                                                                ///  socket into a pooled buffer.
     void write(const std::vector<std::uint8_t>& pData, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
                std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);           ///< Send a single datagram over the socket.
     //
+    std::size_t readBatch(std::span<const std::span<std::uint8_t>> pBuffers, std::span<std::size_t> pSizes,
+                          std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                          std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                                ///< \brief Receive multiple datagrams from
+                                                                                                ///  the socket into provided buffers.
+    void writeBatch(std::span<const std::span<const std::uint8_t>> pDatagrams,
+                    std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                    std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);      ///< Send multiple datagrams over the socket.
+    //
+    boost::asio::awaitable<std::vector<std::uint8_t>> coRead(std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                                                             std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                                ///< \brief Receive a single datagram
+                                                                                                ///  from the socket (coroutine).
+    boost::asio::awaitable<std::vector<std::uint8_t>> coReadMax(int pSize, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                                                                std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                                ///< \brief Receive maximally some amount of bytes
+                                                                                                ///  of a single datagram from the socket (coroutine).
+    boost::asio::awaitable<void> coWrite(std::vector<std::uint8_t> pData, std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero(),
+                                         std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);
+                                                                                                ///< \brief Send a single datagram
+                                                                                                ///  over the socket (coroutine).
+    //
     bool readBufferEmpty() const;                               ///< Check if no incoming datagrams are available on the socket.
     void clearReadBuffer();                                     ///< Read remaining datagrams from the socket and discard them.
     //
@@ -79,14 +124,30 @@ public:
               std::optional<std::reference_wrapper<bool>> pTimedOut = std::nullopt);            ///< Connect the %UDP socket.
     void close();                                                                               ///< Disconnect the %UDP socket.
 
+private:
+    void sendDatagram(std::span<const std::uint8_t> pData, std::chrono::milliseconds pTimeout,
+                      std::optional<std::reference_wrapper<bool>> pTimedOut);                   ///< Send a single datagram from a buffer.
+    //
+    std::size_t receiveQueuedDatagrams(std::span<const std::span<std::uint8_t>> pBuffers, std::span<std::size_t> pSizes);
+                                                                                                ///< \brief Receive already queued datagrams
+                                                                                                ///  without blocking.
+    std::size_t sendDatagramsNonBlocking(std::span<const std::span<const std::uint8_t>> pDatagrams);
+                                                                                                ///< \brief Send as many datagrams as possible
+                                                                                                ///  without blocking.
+
 private:
     const std::string hostName;                             ///< Host name of the remote endpoint.
     const int port;                                         ///< Used network port.
     //
-    boost::asio::ip::udp::socket socket;                    ///< %UDP socket.
+    const SocketOptions socketOptions;                      ///< Socket options to apply after connecting.
+    //
+    boost::asio::io_context& ioContext;                     ///< IO context used by the socket.
+    boost::asio::ip::udp::socket socket;                    ///< %UDP socket (using a strand of \ref ioContext).
     //
     static constexpr std::size_t readBufferSize = 65527;    ///< Maximum %UDP datagram payload size.
     std::array<std::uint8_t, readBufferSize> readBuffer;    ///< Buffer for incoming datagrams.
+    //
+    static constexpr std::size_t batchChunkSize = 64;       ///< Maximum number of datagrams per \c recvmmsg / \c sendmmsg call.
 };
 
 } // namespace CommonImpl
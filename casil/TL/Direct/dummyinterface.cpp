@@ -23,8 +23,10 @@
 
 #include <casil/TL/Direct/dummyinterface.h>
 
+#include <casil/auxil.h>
 #include <casil/bytes.h>
 
+#include <chrono>
 #include <utility>
 
 using casil::Layers::TL::DummyInterface;
@@ -36,11 +38,18 @@ CASIL_REGISTER_INTERFACE_CPP(DummyInterface)
 /*!
  * \brief Constructor.
  *
+ * Gets the optional "silent" value from \p pConfig (boolean value, default: false), which disables the
+ * debug logging of all function calls, and the optional "latency" value (unsigned integer value in microseconds,
+ * default: 0), which is waited for in every data transfer call (read(), write(), query()).
+ * This allows to use the %DummyInterface for profiling the overhead of the components on top of it.
+ *
  * \param pName Component instance name.
  * \param pConfig Component configuration.
  */
 DummyInterface::DummyInterface(std::string pName, LayerConfig pConfig) :
-    DirectInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig())
+    DirectInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig()),
+    silent(config.getBool("silent", false)),
+    latency(config.getUInt("latency", 0))
 {
 }
 
@@ -49,33 +58,42 @@ DummyInterface::DummyInterface(std::string pName, LayerConfig pConfig) :
 /*!
  * \copybrief DirectInterface::read()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments (unless disabled)
+ * after waiting for the configured synthetic latency (see DummyInterface()).
  *
  * \param pSize Number of bytes to read (ignored).
  * \return Empty vector.
  */
 std::vector<std::uint8_t> DummyInterface::read(const int pSize)
 {
-    logger.logDebug("read() was called with argument \"pSize\" = " + std::to_string(pSize) + ".");
+    simulateLatency();
+
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "read() was called with argument \"pSize\" = " + std::to_string(pSize) + ".");
     return {};
 }
 
 /*!
  * \copybrief DirectInterface::write()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments (unless disabled)
+ * after waiting for the configured synthetic latency (see DummyInterface()).
  *
  * \param pData %Bytes to be written (ignored).
  */
 void DummyInterface::write(const std::vector<std::uint8_t>& pData)
 {
-    logger.logDebug("write() was called with argument \"pData\" = " + Bytes::formatByteVec(pData) + ".");
+    simulateLatency();
+
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "write() was called with argument \"pData\" = " + Bytes::formatByteVec(pData) + ".");
 }
 
 /*!
  * \copybrief DirectInterface::query()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments (unless disabled)
+ * after waiting for the configured synthetic latency (see DummyInterface()).
  *
  * \param pData Query bytes to be written (ignored).
  * \param pSize Number of response bytes to read (ignored).
@@ -83,9 +101,12 @@ void DummyInterface::write(const std::vector<std::uint8_t>& pData)
  */
 std::vector<std::uint8_t> DummyInterface::query(const std::vector<std::uint8_t>& pData, const int pSize)
 {
-    logger.logDebug(std::string("query() was called with arguments ") +
-                    "\"pData\" = " + Bytes::formatByteVec(pData) + ", " +
-                    "\"pSize\" = " + std::to_string(pSize) + ".");
+    simulateLatency();
+
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, std::string("query() was called with arguments ") +
+                                 "\"pData\" = " + Bytes::formatByteVec(pData) + ", " +
+                                 "\"pSize\" = " + std::to_string(pSize) + ".");
     return {};
 }
 
@@ -94,24 +115,26 @@ std::vector<std::uint8_t> DummyInterface::query(const std::vector<std::uint8_t>&
 /*!
  * \copybrief DirectInterface::readBufferEmpty()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyInterface()).
  *
  * \return True.
  */
 bool DummyInterface::readBufferEmpty() const
 {
-    logger.logDebug("readBufferEmpty() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "readBufferEmpty() was called.");
     return true;
 }
 
 /*!
  * \copybrief DirectInterface::clearReadBuffer()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyInterface()).
  */
 void DummyInterface::clearReadBuffer()
 {
-    logger.logDebug("clearReadBuffer() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "clearReadBuffer() was called.");
 }
 
 //Private
@@ -119,25 +142,40 @@ void DummyInterface::clearReadBuffer()
 /*!
  * \copybrief DirectInterface::initImpl()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyInterface()).
  *
  * \return True.
  */
 bool DummyInterface::initImpl()
 {
-    logger.logDebug("initImpl() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "initImpl() was called.");
     return true;
 }
 
 /*!
  * \copybrief DirectInterface::closeImpl()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyInterface()).
  *
  * \return True.
  */
 bool DummyInterface::closeImpl()
 {
-    logger.logDebug("closeImpl() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "closeImpl() was called.");
     return true;
 }
+
+//
+
+/*!
+ * \brief Wait for the configured synthetic latency.
+ *
+ * Blocks for the configured "latency" (see DummyInterface()) with sub-millisecond accuracy (see Auxil::sleepUntil()).
+ */
+void DummyInterface::simulateLatency() const
+{
+    if (latency.count() > 0)
+        Auxil::sleepUntil(std::chrono::steady_clock::now() + latency);
+}
@@ -24,13 +24,36 @@
 #include <casil/TL/Direct/serial.h>
 
 #include <casil/asio.h>
+#include <casil/timing.h>
+#include <casil/tracer.h>
 #include <casil/TL/CommonImpl/serialportwrapper.h>
 
 #include <boost/system/system_error.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 #include <utility>
 
+namespace
+{
+
+/*
+ * Reads the latency options for CommonImpl::SerialPortWrapper from the configuration 'pConfig' of a Serial interface.
+ *
+ * See Serial::Serial() for the used configuration keys and their defaults.
+ */
+casil::Layers::TL::CommonImpl::SerialPortWrapper::LatencyOptions latencyOptionsFromConfig(const casil::LayerConfig& pConfig)
+{
+    const bool lowLatency = pConfig.getBool("init.low_latency", false);
+
+    return {.lowLatency = lowLatency,
+            .latencyTimer = pConfig.getInt("init.latency_timer", (lowLatency ? 1 : -1)),
+            .vMin = pConfig.getInt("init.vmin", (lowLatency ? 1 : -1)),
+            .vTime = pConfig.getInt("init.vtime", (lowLatency ? 0 : -1))};
+}
+
+} // namespace
+
 using casil::Layers::TL::Serial;
 
 CASIL_REGISTER_INTERFACE_CPP(Serial)
@@ -49,9 +72,29 @@ CASIL_REGISTER_INTERFACE_CPP(Serial)
  * Initializes the termination sequence for write operations from the optional "init.write_termination" string in \p pConfig or,
  * if not defined, to the same sequence as the read termination.
  *
+ * Sets the maximum number of bytes transferred by a single asynchronous read of the serial port from the optional
+ * "init.read_chunk_size" value in \p pConfig (unsigned integer type, default: 4096). Larger values reduce the per-chunk
+ * processing overhead for high-throughput devices (see also CommonImpl::SerialPortWrapper).
+ *
+ * Enables an opt-in low-latency mode for instrument queries via the optional "init.low_latency" value in \p pConfig
+ * (boolean type, default: false), which sets the \c ASYNC_LOW_LATENCY flag of the serial driver (Linux only). It also
+ * changes the defaults of the following optional values, which can be used independently as well (negative: unchanged):
+ * - "init.latency_timer" (integer type, in milliseconds, default: 1 in low-latency mode, else -1): Latency timer of
+ *   FTDI USB-serial adapters (16 ms by default), which delays every short response (Linux only; requires write access
+ *   to the adapter's "latency_timer" sysfs attribute).
+ * - "init.vmin" and "init.vtime" (integer types, default: 1 and 0 in low-latency mode, else -1): \c VMIN and \c VTIME
+ *   terminal settings (\c VTIME in deciseconds).
+ *
+ * Failing to set the driver flag or the latency timer only results in a warning on init().
+ *
+ * Pins the interface to one of the IO contexts of the IO context pool (see ASIO::setIOContextPoolSize()) according to the
+ * optional "init.io_context" value in \p pConfig (integer type, default: -1, i.e. round-robin; see ASIO::getIOContext(int)).
+ *
  * \throws std::runtime_error If "init.port" is empty.
  * \throws std::runtime_error If "init.baudrate" is zero or negative.
+ * \throws std::runtime_error If "init.read_chunk_size" is zero.
  * \throws std::runtime_error If "init.read_termination" is not defined.
+ * \throws std::runtime_error If "init.io_context" exceeds the IO context pool size.
  *
  * \param pName Component instance name.
  * \param pConfig Component configuration.
@@ -64,12 +107,18 @@ Serial::Serial(std::string pName, LayerConfig pConfig) :
     readTermination(config.getStr("init.read_termination", "\r\n")),
     writeTermination(config.getStr("init.write_termination", readTermination)),
     baudRate(config.getInt("init.baudrate", 9600)),
-    serialPortWrapperPtr(std::make_unique<CommonImpl::SerialPortWrapper>(port, readTermination, writeTermination, baudRate))
+    readChunkSize(config.getUInt("init.read_chunk_size", 4096)),
+    serialPortWrapperPtr(std::make_unique<CommonImpl::SerialPortWrapper>(port, readTermination, writeTermination, baudRate, readChunkSize,
+                                                                           latencyOptionsFromConfig(config),
+                                                                           ASIO::getIOContext(config.getInt("init.io_context", -1)))),
+    recordStreamActive(false)
 {
     if (port == "")
         throw std::runtime_error("No serial port set for " + getSelfDescription() + ".");
     if (baudRate <= 0)
         throw std::runtime_error("Negative baud rate set for " + getSelfDescription() + ".");
+    if (readChunkSize == 0)
+        throw std::runtime_error("Read chunk size set to zero for " + getSelfDescription() + ".");
 }
 
 /*!
@@ -90,7 +139,67 @@ Serial::~Serial() = default;
  */
 std::vector<std::uint8_t> Serial::read(const int pSize)
 {
-    return serialPortWrapperPtr->read(pSize);
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, 0, static_cast<std::uint32_t>(std::max(pSize, 0)));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+    try
+    {
+        std::vector<std::uint8_t> data = serialPortWrapperPtr->read(pSize);
+        countRead(data.size());
+        return data;
+    }
+    catch (const std::runtime_error&)
+    {
+        countError();
+        throw;
+    }
+}
+
+/*!
+ * \copybrief DirectInterface::readInto()
+ *
+ * Reads like read() directly into \p pBuffer without allocating memory for the read bytes.
+ *
+ * \throws std::runtime_error If \p pSize exceeds the size of \p pBuffer or the read bytes do not fit into \p pBuffer.
+ *
+ * \copydetails DirectInterface::readInto()
+ */
+std::size_t Serial::readInto(const std::span<std::uint8_t> pBuffer, const int pSize)
+{
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, 0, static_cast<std::uint32_t>(std::max(pSize, 0)));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+    try
+    {
+        const std::size_t readBytes = serialPortWrapperPtr->readInto(pBuffer, pSize);
+        countRead(readBytes);
+        return readBytes;
+    }
+    catch (const std::runtime_error&)
+    {
+        countError();
+        throw;
+    }
+}
+
+/*!
+ * \brief Read all currently available bytes into a buffer without waiting.
+ *
+ * Moves up to \p pBuffer size bytes that are currently in the read buffer to \p pBuffer and returns immediately,
+ * without waiting for further data and without interpreting the read termination. Intended for throughput-oriented
+ * consumers that continuously drain a high-rate data stream in large blocks.
+ *
+ * \param pBuffer Buffer for the read bytes.
+ * \return Number of bytes written to \p pBuffer (zero if no data available).
+ */
+std::size_t Serial::readAvailable(const std::span<std::uint8_t> pBuffer)
+{
+    const std::size_t readBytes = serialPortWrapperPtr->readAvailable(pBuffer);
+
+    if (readBytes > 0)
+        countRead(readBytes);
+
+    return readBytes;
 }
 
 /*!
@@ -102,12 +211,17 @@ std::vector<std::uint8_t> Serial::read(const int pSize)
  */
 void Serial::write(const std::vector<std::uint8_t>& pData)
 {
+    const Tracer::Scope trace(traceSource, Tracer::Event::Write, 0, static_cast<std::uint32_t>(pData.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Write);
+
     try
     {
         serialPortWrapperPtr->write(pData);
+        countWrite(pData.size());
     }
     catch (const std::runtime_error& exc)
     {
+        countError();
         throw std::runtime_error("Could not write to serial port \"" + name + "\": " + exc.what());
     }
 }
@@ -119,6 +233,9 @@ void Serial::write(const std::vector<std::uint8_t>& pData)
  */
 std::vector<std::uint8_t> Serial::query(const std::vector<std::uint8_t>& pData, const int pSize)
 {
+    const Tracer::Scope trace(traceSource, Tracer::Event::Query, 0, static_cast<std::uint32_t>(pData.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Query);
+
     return DirectInterface::query(pData, pSize);
 }
 
@@ -142,6 +259,93 @@ void Serial::clearReadBuffer()
     serialPortWrapperPtr->clearReadBuffer();
 }
 
+//
+
+/*!
+ * \brief Register a callback to be invoked for every terminated incoming frame.
+ *
+ * Once the interface is initialized, every incoming frame completed by the configured read termination is passed to
+ * \p pHandler (excluding the termination) instead of being stored in the read buffer. This avoids having a thread
+ * blocked in read() for instruments that continuously send data. Pass an empty function to remove the handler again.
+ *
+ * The handler is invoked from an IO context thread (see ASIO) and must not block. The passed sequence is only valid
+ * for the duration of the call. See also CommonImpl::SerialPortWrapper::setFrameHandler().
+ *
+ * The handler can also be replaced or removed while the interface is initialized (see also startRecordStream()).
+ *
+ * \throws std::runtime_error If \p pHandler is non-empty and the read termination is empty.
+ *
+ * \param pHandler Callback for the terminated frames.
+ */
+void Serial::setFrameHandler(FrameHandler pHandler)
+{
+    try
+    {
+        serialPortWrapperPtr->setFrameHandler(std::move(pHandler));
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not set frame handler for " + getSelfDescription() + ": " + exc.what());
+    }
+}
+
+//
+
+/*!
+ * \copybrief DirectInterface::supportsRecordStreaming()
+ *
+ * Records are split at the configured read termination (see startRecordStream()).
+ *
+ * \return True if the read termination is not empty.
+ */
+bool Serial::supportsRecordStreaming() const
+{
+    return !readTermination.empty();
+}
+
+/*!
+ * \copybrief DirectInterface::startRecordStream()
+ *
+ * Clears the read buffer and sets \p pHandler as frame handler (see setFrameHandler()).
+ *
+ * Note: Do not use read(), readInto() or query() until the stream has been stopped again (see stopRecordStream()).
+ *
+ * \throws std::runtime_error If the record stream is already active.
+ * \throws std::runtime_error If \p pHandler is empty.
+ * \throws std::runtime_error If the read termination is empty.
+ *
+ * \param pHandler Callback for received records.
+ */
+void Serial::startRecordStream(RecordHandler pHandler)
+{
+    if (recordStreamActive)
+        throw std::runtime_error("Record streaming from " + getSelfDescription() + " is already active.");
+
+    if (!pHandler)
+        throw std::runtime_error("Cannot stream records from " + getSelfDescription() + " to empty record handler.");
+
+    clearReadBuffer();
+    setFrameHandler(std::move(pHandler));
+
+    recordStreamActive = true;
+}
+
+/*!
+ * \copybrief DirectInterface::stopRecordStream()
+ *
+ * Removes the frame handler (see setFrameHandler()) and waits until the last record has been passed to it.
+ * Does nothing if the stream is not active.
+ */
+void Serial::stopRecordStream()
+{
+    if (!recordStreamActive)
+        return;
+
+    recordStreamActive = false;
+
+    setFrameHandler({});
+}
+
 //Private
 
 /*!
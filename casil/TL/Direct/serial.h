@@ -29,8 +29,11 @@
 #include <casil/layerconfig.h>
 #include <casil/layerfactorymacros.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -49,16 +52,27 @@ namespace CommonImpl { class SerialPortWrapper; }
  */
 class Serial final : public DirectInterface
 {
+public:
+    typedef std::function<void(std::span<const std::uint8_t>)> FrameHandler;   ///< Callback type for terminated frames (excluding termination).
+
 public:
     Serial(std::string pName, LayerConfig pConfig);     ///< Constructor.
     ~Serial() override;                                 ///< Default destructor.
     //
     std::vector<std::uint8_t> read(int pSize = -1) override;
+    std::size_t readInto(std::span<std::uint8_t> pBuffer, int pSize = -1) override;
+    std::size_t readAvailable(std::span<std::uint8_t> pBuffer);     ///< Read all currently available bytes into a buffer without waiting.
     void write(const std::vector<std::uint8_t>& pData) override;
     std::vector<std::uint8_t> query(const std::vector<std::uint8_t>& pData, int pSize = -1) override;
     //
     bool readBufferEmpty() const override;
     void clearReadBuffer() override;
+    //
+    bool supportsRecordStreaming() const override;
+    void startRecordStream(RecordHandler pHandler) override;
+    void stopRecordStream() override;
+    //
+    void setFrameHandler(FrameHandler pHandler);    ///< Register a callback to be invoked for every terminated incoming frame.
 
 private:
     bool initImpl() override;
@@ -70,7 +84,11 @@ private:
     const std::string writeTermination;     ///< Write termination to append to written data.
     const int baudRate;                     ///< Baud rate setting for the serial communication.
     //
+    const std::uint64_t readChunkSize;      ///< Maximum number of bytes transferred by a single asynchronous read.
+    //
     const std::unique_ptr<CommonImpl::SerialPortWrapper> serialPortWrapperPtr;  ///< Detailed serial port logic wrapper.
+    //
+    bool recordStreamActive;                ///< Record streaming is active (see startRecordStream()).
 
     CASIL_REGISTER_INTERFACE_H("Serial")
 };
@@ -23,8 +23,12 @@
 
 #include <casil/TL/Direct/tcp.h>
 
+#include <casil/asio.h>
+#include <casil/timing.h>
+#include <casil/tracer.h>
 #include <casil/TL/CommonImpl/tcpsocketwrapper.h>
 
+#include <algorithm>
 #include <stdexcept>
 #include <utility>
 
@@ -47,9 +51,25 @@ CASIL_REGISTER_INTERFACE_ALIAS("Socket")
  * Initializes the termination sequence for write operations from the optional "init.write_termination" string in \p pConfig or,
  * if not defined, to the same sequence as the read termination.
  *
+ * Configures the socket tuning options (applied after connecting, see init()) from the optional values "init.recv_buffer_size"
+ * and "init.send_buffer_size" (unsigned integer type, in bytes, default: 0, i.e. system default), "init.tcp_no_delay"
+ * (boolean type, default: false; disables Nagle's algorithm) and "init.busy_poll"
+ * (unsigned integer type, in microseconds, default: 0, i.e. disabled; Linux only, may require CAP_NET_ADMIN) in \p pConfig.
+ *
+ * Configures automatic reconnecting after a lost connection (see tryReconnect()) from the optional values
+ * "init.reconnect_attempts" (integer type, default: 0, i.e. disabled), "init.reconnect_backoff" and
+ * "init.reconnect_max_backoff" (floating point type, in seconds, default: 0.01 / 1.0; the delay between
+ * failed attempts is doubled each time up to this maximum) and "init.reconnect_standby" (boolean type,
+ * default: false; keeps a second connection established in advance to replace a lost connection) in \p pConfig.
+ *
+ * Pins the interface to one of the IO contexts of the IO context pool (see ASIO::setIOContextPoolSize()) according to the
+ * optional "init.io_context" value in \p pConfig (integer type, default: -1, i.e. round-robin; see ASIO::getIOContext(int)).
+ *
  * \throws std::runtime_error If "init.address" is empty.
  * \throws std::runtime_error If "init.port" is out of range (must be in <tt>(0, 65535]</tt>).
  * \throws std::runtime_error If "init.read_termination" is not defined.
+ * \throws std::runtime_error If "init.reconnect_attempts", "init.reconnect_backoff" or "init.reconnect_max_backoff" is negative.
+ * \throws std::runtime_error If "init.io_context" exceeds the IO context pool size.
  *
  * \param pName Component instance name.
  * \param pConfig Component configuration.
@@ -62,7 +82,13 @@ TCP::TCP(std::string pName, LayerConfig pConfig) :
     port(config.getInt("init.port", 1)),
     readTermination(config.getStr("init.read_termination", "\r\n")),
     writeTermination(config.getStr("init.write_termination", readTermination)),
-    socketWrapperPtr(std::make_unique<CommonImpl::TCPSocketWrapper>(hostName, port, readTermination, writeTermination))
+    socketWrapperPtr(std::make_unique<CommonImpl::TCPSocketWrapper>(hostName, port, readTermination, writeTermination,
+                                                                    ASIO::getIOContext(config.getInt("init.io_context", -1)),
+                                                                    CommonImpl::SocketOptions::fromConfig(config),
+                                                                    CommonImpl::ReconnectPolicy::fromConfig(config))),
+    recordStreamActive(false),
+    recordHandler(),
+    recordStreamBuffer()
 {
     if (hostName == "")
         throw std::runtime_error("No address/hostname set for " + getSelfDescription() + ".");
@@ -84,18 +110,56 @@ TCP::~TCP() = default;
  * to (but excluding) the configured read termination if \p pSize is -1.
  * Other negative values return an empty sequence.
  *
+ * If the read fails due to a lost connection, the connection is re-established according to the reconnect
+ * policy (see tryReconnect()), such that following operations can succeed, and the exception is still thrown.
+ *
  * \throws std::runtime_error If the read fails.
  *
  * \copydetails DirectInterface::read()
  */
 std::vector<std::uint8_t> TCP::read(const int pSize)
 {
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, 0, static_cast<std::uint32_t>(std::max(pSize, 0)));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+    try
+    {
+        std::vector<std::uint8_t> data = socketWrapperPtr->read(pSize);
+        countRead(data.size());
+        return data;
+    }
+    catch (const std::runtime_error& exc)
+    {
+        countError();
+        (void)tryReconnect();
+        throw std::runtime_error("Could not read from TCP socket \"" + name + "\": " + exc.what());
+    }
+}
+
+/*!
+ * \copybrief DirectInterface::readInto()
+ *
+ * Reads like read() directly into \p pBuffer without allocating memory for the read bytes.
+ *
+ * \throws std::runtime_error If the read fails (includes the case that the read bytes do not fit into \p pBuffer).
+ *
+ * \copydetails DirectInterface::readInto()
+ */
+std::size_t TCP::readInto(const std::span<std::uint8_t> pBuffer, const int pSize)
+{
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, 0, static_cast<std::uint32_t>(std::max(pSize, 0)));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
     try
     {
-        return socketWrapperPtr->read(pSize);
+        const std::size_t readBytes = socketWrapperPtr->readInto(pBuffer, pSize);
+        countRead(readBytes);
+        return readBytes;
     }
     catch (const std::runtime_error& exc)
     {
+        countError();
+        (void)tryReconnect();
         throw std::runtime_error("Could not read from TCP socket \"" + name + "\": " + exc.what());
     }
 }
@@ -103,20 +167,44 @@ std::vector<std::uint8_t> TCP::read(const int pSize)
 /*!
  * \copybrief DirectInterface::write()
  *
+ * If the write fails due to a lost connection and the connection can be re-established according
+ * to the reconnect policy (see tryReconnect()), the write is repeated once on the new connection.
+ *
  * \throws std::runtime_error If the write fails.
  *
  * \copydetails DirectInterface::write()
  */
 void TCP::write(const std::vector<std::uint8_t>& pData)
 {
+    Tracer::Scope trace(traceSource, Tracer::Event::Write, 0, static_cast<std::uint32_t>(pData.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Write);
+
     try
     {
         socketWrapperPtr->write(pData);
     }
     catch (const std::runtime_error& exc)
     {
-        throw std::runtime_error("Could not write to TCP socket \"" + name + "\": " + exc.what());
+        if (!tryReconnect())
+        {
+            countError();
+            throw std::runtime_error("Could not write to TCP socket \"" + name + "\": " + exc.what());
+        }
+
+        trace.setRetries(1);
+
+        try
+        {
+            socketWrapperPtr->write(pData);
+        }
+        catch (const std::runtime_error& retryExc)
+        {
+            countError();
+            throw std::runtime_error("Could not write to TCP socket \"" + name + "\" after reconnecting: " + retryExc.what());
+        }
     }
+
+    countWrite(pData.size());
 }
 
 /*!
@@ -126,6 +214,9 @@ void TCP::write(const std::vector<std::uint8_t>& pData)
  */
 std::vector<std::uint8_t> TCP::query(const std::vector<std::uint8_t>& pData, const int pSize)
 {
+    const Tracer::Scope trace(traceSource, Tracer::Event::Query, 0, static_cast<std::uint32_t>(pData.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Query);
+
     return DirectInterface::query(pData, pSize);
 }
 
@@ -167,6 +258,94 @@ void TCP::clearReadBuffer()
     }
 }
 
+//
+
+/*!
+ * \copybrief DirectInterface::supportsRecordStreaming()
+ *
+ * Records are split at the configured read termination (see startRecordStream()).
+ *
+ * \return True if the read termination is not empty.
+ */
+bool TCP::supportsRecordStreaming() const
+{
+    return !readTermination.empty();
+}
+
+/*!
+ * \copybrief DirectInterface::startRecordStream()
+ *
+ * Clears the read buffer and then continuously reads from the socket in the background
+ * (see CommonImpl::TCPSocketWrapper::startAsyncReads()), passing every record terminated by
+ * the configured read termination to \p pHandler (called from the IO context threads, see ASIO).
+ *
+ * Note: Do not use read(), readInto() or query() until the stream has been stopped again (see stopRecordStream()).
+ *
+ * \throws std::runtime_error If the record stream is already active.
+ * \throws std::runtime_error If the read termination is empty.
+ * \throws std::runtime_error If \p pHandler is empty.
+ * \throws std::runtime_error If clearing the read buffer or starting the continuous reading fails.
+ *
+ * \param pHandler Callback for received records.
+ */
+void TCP::startRecordStream(RecordHandler pHandler)
+{
+    if (recordStreamActive)
+        throw std::runtime_error("Record streaming from TCP socket \"" + name + "\" is already active.");
+
+    if (readTermination.empty())
+        throw std::runtime_error("Cannot stream records from TCP socket \"" + name + "\" without read termination.");
+
+    if (!pHandler)
+        throw std::runtime_error("Cannot stream records from TCP socket \"" + name + "\" to empty record handler.");
+
+    clearReadBuffer();
+
+    recordHandler = std::move(pHandler);
+    recordStreamBuffer.clear();
+
+    try
+    {
+        socketWrapperPtr->startAsyncReads(streamReadSize, [this](const std::span<const std::uint8_t> pData) -> std::size_t
+                                                          {
+                                                              return handleStreamData(pData);
+                                                          });
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not start record streaming from TCP socket \"" + name + "\": " + exc.what());
+    }
+
+    recordStreamActive = true;
+}
+
+/*!
+ * \copybrief DirectInterface::stopRecordStream()
+ *
+ * Stops the continuous reading and waits until the last record has been passed to the handler (see startRecordStream()).
+ * Incomplete record data received so far is discarded. Does nothing if the stream is not active.
+ *
+ * \throws std::runtime_error If stopping the continuous reading fails.
+ */
+void TCP::stopRecordStream()
+{
+    if (!recordStreamActive)
+        return;
+
+    recordStreamActive = false;
+
+    try
+    {
+        socketWrapperPtr->stopAsyncReads();
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not stop record streaming from TCP socket \"" + name + "\": " + exc.what());
+    }
+
+    recordStreamBuffer.clear();
+}
+
 //Private
 
 /*!
@@ -196,12 +375,21 @@ bool TCP::initImpl()
 /*!
  * \copybrief DirectInterface::closeImpl()
  *
- * Disconnects the socket.
+ * Stops a potentially active record stream (see startRecordStream()) and disconnects the socket.
  *
  * \return True if successful.
  */
 bool TCP::closeImpl()
 {
+    try
+    {
+        stopRecordStream();
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(exc.what());
+    }
+
     try
     {
         socketWrapperPtr->close();
@@ -214,3 +402,82 @@ bool TCP::closeImpl()
 
     return true;
 }
+
+//
+
+/*!
+ * \brief Re-establish a lost connection according to the configured reconnect policy.
+ *
+ * Calls CommonImpl::TCPSocketWrapper::reconnectIfLost(), which does nothing if reconnecting is disabled (see TCP())
+ * or if the connection was not lost. A lost connection is re-established by using the standby connection (if enabled)
+ * or by connecting again with exponential backoff, without having to re-initialize the interface (or the whole Device).
+ *
+ * Errors are logged and not propagated.
+ *
+ * \return True if the connection was re-established.
+ */
+bool TCP::tryReconnect()
+{
+    try
+    {
+        return socketWrapperPtr->reconnectIfLost();
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(std::string("Could not reconnect socket: ") + exc.what());
+        return false;
+    }
+}
+
+//
+
+/*!
+ * \brief Split continuously read data into records for the record handler.
+ *
+ * Appends \p pData to the remaining incomplete record data from previous calls, passes every complete record
+ * (excluding the read termination) to the record handler (see startRecordStream()) and keeps the remaining
+ * incomplete record data for the next call. Exceptions thrown by the record handler are logged and not propagated.
+ *
+ * \param pData Newly read data.
+ * \return Number of accepted bytes (always all of \p pData).
+ */
+std::size_t TCP::handleStreamData(const std::span<const std::uint8_t> pData)
+{
+    recordStreamBuffer.insert(recordStreamBuffer.end(), pData.begin(), pData.end());
+
+    //Start searching where a termination could begin that was incomplete in the previous data
+
+    const std::size_t termSize = readTermination.size();
+
+    std::size_t searchBegin = recordStreamBuffer.size() - pData.size();
+    searchBegin = searchBegin >= termSize - 1 ? searchBegin - (termSize - 1) : 0;
+
+    std::size_t recordBegin = 0;
+
+    for (;;)
+    {
+        const auto termIt = std::search(recordStreamBuffer.begin() + searchBegin, recordStreamBuffer.end(),
+                                        readTermination.begin(), readTermination.end());
+
+        if (termIt == recordStreamBuffer.end())
+            break;
+
+        const std::size_t termPos = termIt - recordStreamBuffer.begin();
+
+        try
+        {
+            recordHandler(std::span<const std::uint8_t>(recordStreamBuffer.data() + recordBegin, termPos - recordBegin));
+        }
+        catch (const std::exception& exc)
+        {
+            logger.logError(std::string("Exception in record handler: ") + exc.what());
+        }
+
+        recordBegin = termPos + termSize;
+        searchBegin = recordBegin;
+    }
+
+    recordStreamBuffer.erase(recordStreamBuffer.begin(), recordStreamBuffer.begin() + recordBegin);
+
+    return pData.size();
+}
@@ -29,8 +29,10 @@
 #include <casil/layerconfig.h>
 #include <casil/layerfactorymacros.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -54,23 +56,38 @@ public:
     ~TCP() override;                                ///< Default destructor.
     //
     std::vector<std::uint8_t> read(int pSize = -1) override;
+    std::size_t readInto(std::span<std::uint8_t> pBuffer, int pSize = -1) override;
     void write(const std::vector<std::uint8_t>& pData) override;
     std::vector<std::uint8_t> query(const std::vector<std::uint8_t>& pData, int pSize = -1) override;
     //
     bool readBufferEmpty() const override;
     void clearReadBuffer() override;
+    //
+    bool supportsRecordStreaming() const override;
+    void startRecordStream(RecordHandler pHandler) override;
+    void stopRecordStream() override;
 
 private:
     bool initImpl() override;
     bool closeImpl() override;
+    //
+    bool tryReconnect();                            ///< Re-establish a lost connection according to the configured reconnect policy.
+    //
+    std::size_t handleStreamData(std::span<const std::uint8_t> pData);  ///< Split continuously read data into records for the record handler.
 
 private:
+    static constexpr std::size_t streamReadSize = 4096; ///< Maximum number of bytes per single read while streaming records.
+    //
     const std::string hostName;                     ///< Host name of the remote endpoint.
     const int port;                                 ///< Used network port.
     const std::string readTermination;              ///< Read termination to detect end of read data stream.
     const std::string writeTermination;             ///< Write termination to append to written data.
     //
     const std::unique_ptr<CommonImpl::TCPSocketWrapper> socketWrapperPtr;   ///< Detailed %TCP socket logic wrapper.
+    //
+    bool recordStreamActive;                        ///< Record streaming is active (see startRecordStream()).
+    RecordHandler recordHandler;                    ///< Callback for streamed records (see startRecordStream()).
+    std::vector<std::uint8_t> recordStreamBuffer;   ///< Incomplete record data remaining from previous continuous reads.
 
     CASIL_REGISTER_INTERFACE_H("TCP")
 };
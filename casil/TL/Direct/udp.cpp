@@ -23,6 +23,9 @@
 
 #include <casil/TL/Direct/udp.h>
 
+#include <casil/asio.h>
+#include <casil/timing.h>
+#include <casil/tracer.h>
 #include <casil/TL/CommonImpl/udpsocketwrapper.h>
 
 #include <stdexcept>
@@ -41,8 +44,16 @@ CASIL_REGISTER_INTERFACE_CPP(UDP)
  *
  * Initializes the network port for the communication from the mandatory "init.port" value (integer type) in \p pConfig.
  *
+ * Configures the socket tuning options (applied after connecting, see init()) from the optional values "init.recv_buffer_size"
+ * and "init.send_buffer_size" (unsigned integer type, in bytes, default: 0, i.e. system default), and "init.busy_poll"
+ * (unsigned integer type, in microseconds, default: 0, i.e. disabled; Linux only, may require CAP_NET_ADMIN) in \p pConfig.
+ *
+ * Pins the interface to one of the IO contexts of the IO context pool (see ASIO::setIOContextPoolSize()) according to the
+ * optional "init.io_context" value in \p pConfig (integer type, default: -1, i.e. round-robin; see ASIO::getIOContext(int)).
+ *
  * \throws std::runtime_error If "init.address" is empty.
  * \throws std::runtime_error If "init.port" is out of range (must be in <tt>(0, 65535]</tt>).
+ * \throws std::runtime_error If "init.io_context" exceeds the IO context pool size.
  *
  * \param pName Component instance name.
  * \param pConfig Component configuration.
@@ -53,7 +64,8 @@ UDP::UDP(std::string pName, LayerConfig pConfig) :
                     ),
     hostName(config.getStr("init.address", "")),
     port(config.getInt("init.port", 1)),
-    socketWrapperPtr(std::make_unique<CommonImpl::UDPSocketWrapper>(hostName, port))
+    socketWrapperPtr(std::make_unique<CommonImpl::UDPSocketWrapper>(hostName, port, ASIO::getIOContext(config.getInt("init.io_context", -1)),
+                                                                    CommonImpl::SocketOptions::fromConfig(config)))
 {
     if (hostName == "")
         throw std::runtime_error("No address/hostname set for " + getSelfDescription() + ".");
@@ -82,12 +94,50 @@ std::vector<std::uint8_t> UDP::read(const int pSize)
 {
     (void)pSize;
 
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, 0, 0);
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
     try
     {
-        return socketWrapperPtr->read();
+        std::vector<std::uint8_t> data = socketWrapperPtr->read();
+        countRead(data.size());
+        return data;
     }
     catch (const std::runtime_error& exc)
     {
+        countError();
+        throw std::runtime_error("Could not read from UDP socket \"" + name + "\": " + exc.what());
+    }
+}
+
+/*!
+ * \copybrief DirectInterface::readInto()
+ *
+ * Receives a single incoming datagram directly into \p pBuffer (truncated to the size of \p pBuffer)
+ * without allocating memory for it, ignoring \p pSize.
+ *
+ * \throws std::runtime_error If the read fails.
+ *
+ * \param pBuffer Buffer for the read bytes.
+ * \param pSize Ignored.
+ * \return Number of bytes written to \p pBuffer.
+ */
+std::size_t UDP::readInto(const std::span<std::uint8_t> pBuffer, const int pSize)
+{
+    (void)pSize;
+
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, 0, static_cast<std::uint32_t>(pBuffer.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+    try
+    {
+        const std::size_t readBytes = socketWrapperPtr->readInto(pBuffer);
+        countRead(readBytes);
+        return readBytes;
+    }
+    catch (const std::runtime_error& exc)
+    {
+        countError();
         throw std::runtime_error("Could not read from UDP socket \"" + name + "\": " + exc.what());
     }
 }
@@ -103,12 +153,17 @@ std::vector<std::uint8_t> UDP::read(const int pSize)
  */
 void UDP::write(const std::vector<std::uint8_t>& pData)
 {
+    const Tracer::Scope trace(traceSource, Tracer::Event::Write, 0, static_cast<std::uint32_t>(pData.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Write);
+
     try
     {
         socketWrapperPtr->write(pData);
+        countWrite(pData.size());
     }
     catch (const std::runtime_error& exc)
     {
+        countError();
         throw std::runtime_error("Could not write to UDP socket \"" + name + "\": " + exc.what());
     }
 }
@@ -127,6 +182,9 @@ void UDP::write(const std::vector<std::uint8_t>& pData)
  */
 std::vector<std::uint8_t> UDP::query(const std::vector<std::uint8_t>& pData, const int pSize)
 {
+    const Tracer::Scope trace(traceSource, Tracer::Event::Query, 0, static_cast<std::uint32_t>(pData.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Query);
+
     return DirectInterface::query(pData, pSize);
 }
 
@@ -29,8 +29,10 @@
 #include <casil/layerconfig.h>
 #include <casil/layerfactorymacros.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -54,6 +56,7 @@ public:
     ~UDP() override;                                ///< Default destructor.
     //
     std::vector<std::uint8_t> read(int pSize = -1) override;
+    std::size_t readInto(std::span<std::uint8_t> pBuffer, int pSize = -1) override;
     void write(const std::vector<std::uint8_t>& pData) override;
     std::vector<std::uint8_t> query(const std::vector<std::uint8_t>& pData, int pSize = -1) override;
     //
@@ -0,0 +1,671 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/Direct/udpring.h>
+
+#include <casil/timing.h>
+#include <casil/tracer.h>
+
+#include <boost/predef/os/linux.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#if BOOST_OS_LINUX != 0
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <linux/filter.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using casil::Layers::TL::UDPRing;
+
+CASIL_REGISTER_INTERFACE_CPP(UDPRing)
+
+#if BOOST_OS_LINUX != 0
+
+namespace
+{
+
+/*
+ * Returns the description of the last system error, prefixed by 'pWhat'.
+ */
+std::string systemError(const std::string& pWhat)
+{
+    return pWhat + ": " + std::strerror(errno);
+}
+
+/*
+ * Returns the payload of the IPv4/UDP packet 'pPacket' (starting at the IP header) if it is unfragmented
+ * and addressed to destination port 'pPort', or nothing otherwise.
+ */
+std::optional<std::span<const std::uint8_t>> udpPayload(const std::span<const std::uint8_t> pPacket, const std::uint16_t pPort)
+{
+    if (pPacket.size() < 20 || (pPacket[0] >> 4) != 4 || pPacket[9] != IPPROTO_UDP)
+        return std::nullopt;
+
+    const std::size_t headerLength = static_cast<std::size_t>(pPacket[0] & 0x0F) * 4;
+
+    if (headerLength < 20 || pPacket.size() < headerLength + 8)
+        return std::nullopt;
+
+    if (((pPacket[6] << 8) | pPacket[7]) & 0x3FFF)     //More-fragments flag or fragment offset set
+        return std::nullopt;
+
+    const std::span<const std::uint8_t> udp = pPacket.subspan(headerLength);
+
+    const std::uint16_t destPort = static_cast<std::uint16_t>((udp[2] << 8) | udp[3]);
+    const std::size_t udpLength = static_cast<std::size_t>((udp[4] << 8) | udp[5]);
+
+    if (destPort != pPort || udpLength < 8)
+        return std::nullopt;
+
+    return udp.subspan(8, std::min(udpLength, udp.size()) - 8);
+}
+
+} // namespace
+
+/*!
+ * \brief Packet socket with mapped receive ring.
+ *
+ * Opens an \c AF_PACKET socket (cooked mode, i.e. packets start at the IP header) bound to the network interface
+ * \p pInterface, attaches a classic BPF filter that only accepts IPv4/%UDP packets for destination port \p pPort,
+ * sets up a \c TPACKET_V3 receive ring of \p pBlockCount blocks of \p pBlockSize bytes and maps it.
+ *
+ * The ring blocks are visited in order. A block is owned by user space as long as its status has \c TP_STATUS_USER set
+ * and is handed back to the kernel once all of its packets were visited (see next()).
+ */
+struct UDPRing::Ring
+{
+    Ring(const std::string& pInterface, const std::uint16_t pPort, const std::size_t pBlockSize, const std::size_t pBlockCount,
+         const std::chrono::milliseconds pBlockTimeout) :
+        fd(-1),
+        map(nullptr),
+        mapSize(pBlockSize * pBlockCount),
+        blockSize(pBlockSize),
+        blockCount(pBlockCount),
+        port(pPort),
+        blockIdx(0),
+        blockOpen(false),
+        packetsLeft(0),
+        nextPacket(nullptr),
+        statistics{0, 0, 0}
+    {
+        const long pageSize = ::sysconf(_SC_PAGESIZE);
+
+        if (pageSize <= 0 || blockSize % static_cast<std::size_t>(pageSize) != 0)
+            throw std::runtime_error("Block size must be a multiple of the page size.");
+
+        const unsigned int ifIndex = ::if_nametoindex(pInterface.c_str());
+
+        if (ifIndex == 0)
+            throw std::runtime_error(systemError("Unknown network interface \"" + pInterface + "\""));
+
+        fd = ::socket(AF_PACKET, SOCK_DGRAM, htons(ETH_P_IP));
+
+        if (fd < 0)
+            throw std::runtime_error(systemError("Could not open packet socket"));
+
+        try
+        {
+            //Accept only unfragmented IPv4/UDP packets for the port (offsets relative to the IP header)
+            std::array<sock_filter, 9> filterCode = {{
+                {BPF_LD | BPF_B | BPF_ABS, 0, 0, 9},                    //Protocol
+                {BPF_JMP | BPF_JEQ | BPF_K, 0, 6, IPPROTO_UDP},
+                {BPF_LD | BPF_H | BPF_ABS, 0, 0, 6},                    //Flags and fragment offset
+                {BPF_JMP | BPF_JSET | BPF_K, 4, 0, 0x3FFF},
+                {BPF_LDX | BPF_B | BPF_MSH, 0, 0, 0},                   //Header length
+                {BPF_LD | BPF_H | BPF_IND, 0, 0, 2},                    //Destination port
+                {BPF_JMP | BPF_JEQ | BPF_K, 0, 1, pPort},
+                {BPF_RET | BPF_K, 0, 0, 0xFFFFFFFF},
+                {BPF_RET | BPF_K, 0, 0, 0}
+            }};
+            const sock_fprog filter{static_cast<unsigned short>(filterCode.size()), filterCode.data()};
+
+            if (::setsockopt(fd, SOL_SOCKET, SO_ATTACH_FILTER, &filter, sizeof(filter)) != 0)
+                throw std::runtime_error(systemError("Could not attach socket filter"));
+
+            //Own transmitted packets are not of interest (ignore failure on kernels not supporting it)
+            const int ignoreOutgoing = 1;
+            (void)::setsockopt(fd, SOL_PACKET, PACKET_IGNORE_OUTGOING, &ignoreOutgoing, sizeof(ignoreOutgoing));
+
+            const int version = TPACKET_V3;
+
+            if (::setsockopt(fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) != 0)
+                throw std::runtime_error(systemError("Could not select TPACKET_V3"));
+
+            tpacket_req3 request {};
+            request.tp_block_size = static_cast<unsigned int>(blockSize);
+            request.tp_block_nr = static_cast<unsigned int>(blockCount);
+            request.tp_frame_size = frameSize;
+            request.tp_frame_nr = static_cast<unsigned int>(mapSize / frameSize);
+            request.tp_retire_blk_tov = static_cast<unsigned int>(pBlockTimeout.count());
+
+            if (::setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &request, sizeof(request)) != 0)
+                throw std::runtime_error(systemError("Could not set up receive ring"));
+
+            void* const address = ::mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+            if (address == MAP_FAILED)
+                throw std::runtime_error(systemError("Could not map receive ring"));
+
+            map = static_cast<std::uint8_t*>(address);
+
+            sockaddr_ll address_ll {};
+            address_ll.sll_family = AF_PACKET;
+            address_ll.sll_protocol = htons(ETH_P_IP);
+            address_ll.sll_ifindex = static_cast<int>(ifIndex);
+
+            if (::bind(fd, reinterpret_cast<const sockaddr*>(&address_ll), sizeof(address_ll)) != 0)
+                throw std::runtime_error(systemError("Could not bind packet socket to \"" + pInterface + "\""));
+        }
+        catch (const std::runtime_error&)
+        {
+            release();
+            throw;
+        }
+    }
+    Ring(const Ring&) = delete;                         ///< Deleted copy constructor.
+    Ring(Ring&&) = delete;                              ///< Deleted move constructor.
+    ~Ring()                                             ///< Destructor. Unmaps the ring and closes the socket.
+    {
+        release();
+    }
+    //
+    Ring& operator=(Ring) = delete;                     ///< Deleted copy assignment operator.
+    Ring& operator=(Ring&&) = delete;                   ///< Deleted move assignment operator.
+    //
+    tpacket_block_desc& block(const std::size_t pIdx) const ///< Get the descriptor of a ring block.
+    {
+        return *reinterpret_cast<tpacket_block_desc*>(map + pIdx * blockSize);
+    }
+    bool blockReady(const std::size_t pIdx) const       ///< Check if a ring block was handed over to user space.
+    {
+        return (std::atomic_ref<std::uint32_t>(block(pIdx).hdr.bh1.block_status).load(std::memory_order_acquire) & TP_STATUS_USER) != 0;
+    }
+    bool empty() const                                  ///< Check if no unvisited packets are available.
+    {
+        return (!blockOpen || packetsLeft == 0) && !blockReady(blockOpen ? (blockIdx + 1) % blockCount : blockIdx);
+    }
+    std::optional<std::span<const std::uint8_t>> next() ///< \brief Get the payload of the next matching datagram, if available
+                                                        ///  (valid until the next call; hands fully visited blocks back to the kernel).
+    {
+        for (;;)
+        {
+            if (blockOpen && packetsLeft == 0)
+            {
+                std::atomic_ref<std::uint32_t>(block(blockIdx).hdr.bh1.block_status).store(TP_STATUS_KERNEL, std::memory_order_release);
+                blockOpen = false;
+                blockIdx = (blockIdx + 1) % blockCount;
+            }
+
+            if (!blockOpen)
+            {
+                if (!blockReady(blockIdx))
+                    return std::nullopt;
+
+                const tpacket_hdr_v1& header = block(blockIdx).hdr.bh1;
+
+                blockOpen = true;
+                packetsLeft = header.num_pkts;
+                nextPacket = map + blockIdx * blockSize + header.offset_to_first_pkt;
+
+                continue;
+            }
+
+            const tpacket3_hdr& packetHeader = *reinterpret_cast<const tpacket3_hdr*>(nextPacket);
+            const std::span<const std::uint8_t> packet(nextPacket + packetHeader.tp_net, packetHeader.tp_snaplen);
+
+            nextPacket += packetHeader.tp_next_offset;
+            --packetsLeft;
+
+            if (const std::optional<std::span<const std::uint8_t>> payload = udpPayload(packet, port))
+                return payload;
+        }
+    }
+    bool wait(const int pTimeoutMs) const               ///< Wait for a block to be handed over (infinitely for negative timeout).
+    {
+        pollfd pfd {fd, POLLIN | POLLERR, 0};
+
+        const int ret = ::poll(&pfd, 1, pTimeoutMs);
+
+        if (ret < 0 && errno != EINTR)
+            throw std::runtime_error(systemError("Could not poll packet socket"));
+
+        return ret > 0;
+    }
+    RingStatistics updateStatistics()                   ///< Add the kernel counters (reset on every query) to the statistics.
+    {
+        tpacket_stats_v3 kernelStats {};
+        socklen_t length = sizeof(kernelStats);
+
+        if (::getsockopt(fd, SOL_PACKET, PACKET_STATISTICS, &kernelStats, &length) != 0)
+            throw std::runtime_error(systemError("Could not get packet statistics"));
+
+        statistics.packetsReceived += kernelStats.tp_packets;
+        statistics.packetsDropped += kernelStats.tp_drops;
+        statistics.ringFreezes += kernelStats.tp_freeze_q_cnt;
+
+        return statistics;
+    }
+    void release()                                      ///< Unmap the ring and close the socket.
+    {
+        if (map)
+            ::munmap(map, mapSize);
+        if (fd >= 0)
+            ::close(fd);
+
+        map = nullptr;
+        fd = -1;
+    }
+    //
+    int fd;                                             ///< Packet socket.
+    std::uint8_t* map;                                  ///< Start of the mapped ring.
+    const std::size_t mapSize;                          ///< Size of the mapped ring in bytes.
+    const std::size_t blockSize;                        ///< Size of a ring block in bytes.
+    const std::size_t blockCount;                       ///< Number of ring blocks.
+    const std::uint16_t port;                           ///< Destination port of accepted datagrams.
+    //
+    std::size_t blockIdx;                               ///< Index of the current block.
+    bool blockOpen;                                     ///< Whether the current block is owned by user space and being visited.
+    std::uint32_t packetsLeft;                          ///< Number of unvisited packets in the current block.
+    const std::uint8_t* nextPacket;                     ///< Header of the next unvisited packet in the current block.
+    //
+    RingStatistics statistics;                          ///< Accumulated kernel packet counters.
+    //
+    static constexpr unsigned int frameSize = 2048;     ///< Nominal frame size required by the ring setup (unused by \c TPACKET_V3).
+};
+
+#else
+
+/*!
+ * \brief Packet socket with mapped receive ring (not available on this platform).
+ */
+struct UDPRing::Ring
+{
+    Ring(const std::string&, std::uint16_t, std::size_t, std::size_t, std::chrono::milliseconds)  ///< Constructor. Always throws.
+    {
+        throw std::runtime_error("Packet rings are only supported on Linux.");
+    }
+    //
+    bool empty() const { return true; }                                         ///< Check if no unvisited packets are available.
+    std::optional<std::span<const std::uint8_t>> next() { return std::nullopt; }  ///< Get the payload of the next matching datagram.
+    bool wait(int) const { return false; }                                      ///< Wait for a block to be handed over.
+    RingStatistics updateStatistics() { return RingStatistics{0, 0, 0}; }       ///< Add the kernel counters to the statistics.
+};
+
+#endif
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Sets the network interface to receive from from the required "init.network_interface" value in \p pConfig
+ * (string type, e.g. \c eth0) and the %UDP destination port of the data stream from the required "init.port"
+ * value (integer type) in \p pConfig.
+ *
+ * Configures the receive ring from the following optional values in \p pConfig:
+ * - "init.block_size": Size of a ring block (unsigned integer type, in bytes, default: 1048576).
+ *                      Must be a multiple of the page size and should hold many datagrams.
+ * - "init.block_count": Number of ring blocks (unsigned integer type, default: 64).
+ *                       The ring size (block size times block count) determines how long a burst can be buffered.
+ * - "init.block_timeout": Timeout after which a partially filled block is handed over (unsigned integer type,
+ *                         in milliseconds, default: 1), i.e. the maximum additional latency.
+ *
+ * \throws std::runtime_error If "init.network_interface" is empty.
+ * \throws std::runtime_error If "init.port" is out of range (must be in <tt>(0, 65535]</tt>).
+ * \throws std::runtime_error If "init.block_size" is zero or "init.block_count" is zero or too large.
+ * \throws std::runtime_error If "init.block_timeout" is zero.
+ *
+ * \param pName Component instance name.
+ * \param pConfig Component configuration.
+ */
+UDPRing::UDPRing(std::string pName, LayerConfig pConfig) :
+    DirectInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig::fromYAML(
+                        "{init: {network_interface: string, port: int}}")
+                    ),
+    networkInterface(config.getStr("init.network_interface", "")),
+    port(config.getInt("init.port", 0)),
+    blockSize(config.getUInt("init.block_size", 1048576)),
+    blockCount(config.getUInt("init.block_count", 64)),
+    blockTimeout(config.getUInt("init.block_timeout", 1)),
+    ring(),
+    mutex()
+{
+    if (networkInterface == "")
+        throw std::runtime_error("No network interface set for " + getSelfDescription() + ".");
+    if (port <= 0 || port > 65535)
+        throw std::runtime_error("Invalid port number set for " + getSelfDescription() + ".");
+    if (blockSize == 0 || blockSize > 0x80000000 || blockCount == 0 ||
+        blockCount > std::numeric_limits<unsigned int>::max() / (blockSize / 2048 + 1))
+        throw std::runtime_error("Invalid ring block size or block count set for " + getSelfDescription() + ".");
+    if (blockTimeout.count() == 0)
+        throw std::runtime_error("Invalid block timeout set for " + getSelfDescription() + ".");
+}
+
+/*!
+ * \brief Destructor.
+ */
+UDPRing::~UDPRing() = default;
+
+//Public
+
+/*!
+ * \copybrief DirectInterface::read()
+ *
+ * Waits for and returns the payload of a single datagram, ignoring \p pSize.
+ *
+ * \throws std::runtime_error If the interface is not initialized or waiting for packets fails.
+ *
+ * \param pSize Ignored.
+ * \return Read bytes.
+ */
+std::vector<std::uint8_t> UDPRing::read(const int pSize)
+{
+    (void)pSize;
+
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, 0, 0);
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+    const std::lock_guard<std::mutex> ringLock(mutex);
+    (void)ringLock;
+
+    const std::span<const std::uint8_t> payload = waitForDatagram();
+
+    countRead(payload.size());
+
+    return std::vector<std::uint8_t>(payload.begin(), payload.end());
+}
+
+/*!
+ * \copybrief DirectInterface::readInto()
+ *
+ * Waits for a single datagram and copies its payload into \p pBuffer (truncated to the size of \p pBuffer), ignoring \p pSize.
+ *
+ * \throws std::runtime_error If the interface is not initialized or waiting for packets fails.
+ *
+ * \param pBuffer Buffer for the read bytes.
+ * \param pSize Ignored.
+ * \return Number of bytes written to \p pBuffer.
+ */
+std::size_t UDPRing::readInto(const std::span<std::uint8_t> pBuffer, const int pSize)
+{
+    (void)pSize;
+
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, 0, static_cast<std::uint32_t>(pBuffer.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+    const std::lock_guard<std::mutex> ringLock(mutex);
+    (void)ringLock;
+
+    const std::span<const std::uint8_t> payload = waitForDatagram();
+    const std::size_t readBytes = std::min(payload.size(), pBuffer.size());
+
+    std::copy_n(payload.begin(), readBytes, pBuffer.begin());
+
+    countRead(readBytes);
+
+    return readBytes;
+}
+
+/*!
+ * \copybrief DirectInterface::write()
+ *
+ * Not supported by this receive-only interface.
+ *
+ * \throws std::runtime_error Always.
+ *
+ * \param pData Ignored.
+ */
+void UDPRing::write(const std::vector<std::uint8_t>& pData)
+{
+    (void)pData;
+
+    throw std::runtime_error("Cannot write to receive-only " + getSelfDescription() + ".");
+}
+
+/*!
+ * \copybrief DirectInterface::query()
+ *
+ * Not supported by this receive-only interface.
+ *
+ * \throws std::runtime_error Always.
+ *
+ * \param pData Ignored.
+ * \param pSize Ignored.
+ * \return Nothing.
+ */
+std::vector<std::uint8_t> UDPRing::query(const std::vector<std::uint8_t>& pData, const int pSize)
+{
+    (void)pData;
+    (void)pSize;
+
+    throw std::runtime_error("Cannot query receive-only " + getSelfDescription() + ".");
+}
+
+//
+
+/*!
+ * \copybrief DirectInterface::readBufferEmpty()
+ *
+ * Checks if no handed over ring blocks with unvisited packets are available. Note that
+ * the unvisited packets may still all be rejected (e.g. IP fragments), see UDPRing.
+ *
+ * \throws std::runtime_error If the interface is not initialized.
+ *
+ * \return True if no unvisited packets are available.
+ */
+bool UDPRing::readBufferEmpty() const
+{
+    const std::lock_guard<std::mutex> ringLock(mutex);
+    (void)ringLock;
+
+    checkOpen();
+
+    return ring->empty();
+}
+
+/*!
+ * \copybrief DirectInterface::clearReadBuffer()
+ *
+ * Discards all datagrams of the handed over ring blocks and hands the blocks back to the kernel.
+ *
+ * \throws std::runtime_error If the interface is not initialized.
+ */
+void UDPRing::clearReadBuffer()
+{
+    const std::lock_guard<std::mutex> ringLock(mutex);
+    (void)ringLock;
+
+    checkOpen();
+
+    while (ring->next())
+    {
+    }
+}
+
+//
+
+/*!
+ * \brief Pass all available datagram payloads in place to a function.
+ *
+ * Calls \p pConsumer with the payload of every datagram that is currently available in the ring, in order of arrival.
+ * The payloads are accessed directly in the mapped ring, i.e. they are not copied and only valid during the call.
+ * Ring blocks are handed back to the kernel as soon as all of their datagrams were passed.
+ *
+ * If no datagram is available, waits for at most \p pTimeout for new data before returning.
+ *
+ * Note: \p pConsumer must not access the interface itself (the ring is locked during the call).
+ *
+ * \throws std::runtime_error If the interface is not initialized or waiting for packets fails.
+ * \throws std::runtime_error If \p pConsumer throws \c std::runtime_error (the datagram counts as consumed).
+ *
+ * \param pConsumer Function to process a datagram payload.
+ * \param pTimeout Maximum time to wait for new data if none is available.
+ * \return Number of passed datagrams.
+ */
+std::size_t UDPRing::consumeDatagrams(const DatagramConsumerFunctionType& pConsumer, const std::chrono::milliseconds pTimeout)
+{
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, 0, 0);
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+    const std::lock_guard<std::mutex> ringLock(mutex);
+    (void)ringLock;
+
+    checkOpen();
+
+    std::size_t numDatagrams = 0;
+    std::size_t numBytes = 0;
+
+    const auto consumeAvailable = [this, &pConsumer, &numDatagrams, &numBytes]() -> void
+                                  {
+                                      while (const std::optional<std::span<const std::uint8_t>> payload = ring->next())
+                                      {
+                                          ++numDatagrams;
+                                          numBytes += payload->size();
+
+                                          pConsumer(*payload);
+                                      }
+                                  };
+
+    consumeAvailable();
+
+    if (numDatagrams == 0 && pTimeout > std::chrono::milliseconds::zero() && ring->wait(static_cast<int>(pTimeout.count())))
+        consumeAvailable();
+
+    countRead(numBytes);
+
+    return numDatagrams;
+}
+
+/*!
+ * \brief Get the packet counters of the ring.
+ *
+ * The counters are accumulated since init().
+ *
+ * \throws std::runtime_error If the interface is not initialized or querying the kernel counters fails.
+ *
+ * \return Current packet counters.
+ */
+UDPRing::RingStatistics UDPRing::getRingStatistics() const
+{
+    const std::lock_guard<std::mutex> ringLock(mutex);
+    (void)ringLock;
+
+    checkOpen();
+
+    return ring->updateStatistics();
+}
+
+//Private
+
+/*!
+ * \copybrief DirectInterface::initImpl()
+ *
+ * Opens the packet socket on the configured network interface and maps the receive ring (see UDPRing).
+ *
+ * \return True if successful.
+ */
+bool UDPRing::initImpl()
+{
+    const std::lock_guard<std::mutex> ringLock(mutex);
+    (void)ringLock;
+
+    try
+    {
+        ring = std::make_unique<Ring>(networkInterface, static_cast<std::uint16_t>(port), blockSize, blockCount, blockTimeout);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(std::string("Could not set up packet ring: ") + exc.what());
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \copybrief DirectInterface::closeImpl()
+ *
+ * Unmaps the receive ring and closes the packet socket.
+ *
+ * \return True.
+ */
+bool UDPRing::closeImpl()
+{
+    const std::lock_guard<std::mutex> ringLock(mutex);
+    (void)ringLock;
+
+    ring.reset();
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Check that the packet ring is set up.
+ *
+ * \throws std::runtime_error If the interface is not initialized.
+ */
+void UDPRing::checkOpen() const
+{
+    if (!ring)
+        throw std::runtime_error("Packet ring of " + getSelfDescription() + " is not set up.");
+}
+
+/*!
+ * \brief Wait for the next datagram.
+ *
+ * Note: The mutex must be locked by the caller. The returned payload is only valid until the next ring access.
+ *
+ * \throws std::runtime_error If the interface is not initialized or waiting for packets fails.
+ *
+ * \return Payload of the datagram in the mapped ring.
+ */
+std::span<const std::uint8_t> UDPRing::waitForDatagram()
+{
+    checkOpen();
+
+    for (;;)
+    {
+        if (const std::optional<std::span<const std::uint8_t>> payload = ring->next())
+            return *payload;
+
+        (void)ring->wait(-1);
+    }
+}
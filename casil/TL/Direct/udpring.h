@@ -0,0 +1,127 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_UDPRING_H
+#define CASIL_LAYERS_TL_UDPRING_H
+
+#include <casil/TL/directinterface.h>
+
+#include <casil/layerconfig.h>
+#include <casil/layerfactorymacros.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/*!
+ * \brief Receive-only %UDP interface for high-rate data streams using a memory-mapped kernel packet ring (Linux only).
+ *
+ * Use this interface instead of \ref UDP "UDP" for boards that push FIFO data as a continuous stream of %UDP datagrams
+ * at rates where one system call per datagram cannot keep up. The interface opens a packet socket on a network interface
+ * with a \c PACKET_RX_RING (\c TPACKET_V3) that is mapped into the process: The kernel places all received IPv4/%UDP packets
+ * for the configured destination port (selected by a socket filter) directly into blocks of the ring and hands over whole
+ * blocks at a time. The datagram payloads are then read from the ring in place, i.e. without copying and without
+ * any system call per datagram (see consumeDatagrams(); see also ReadoutPipeline::UDPRingSource).
+ *
+ * A block is handed over when it is full or when its retire timeout expires (see UDPRing()),
+ * i.e. datagrams become visible with a latency of at most that timeout.
+ *
+ * Notes:
+ * - The packet socket requires the \c CAP_NET_RAW capability.
+ * - Packets bypass the normal %UDP socket, i.e. no %UDP socket needs to be bound to the port (an existing one
+ *   receives its own copies). Checksums are not verified and IP fragments are ignored.
+ * - The interface cannot send: write() and query() throw.
+ */
+class UDPRing final : public DirectInterface
+{
+public:
+    using DatagramConsumerFunctionType = std::function<void(std::span<const std::uint8_t>)>;
+                                                            ///< Function type for in place access to a datagram payload (see consumeDatagrams()).
+
+    /*!
+     * \brief Packet counters of the ring (see getRingStatistics()).
+     */
+    struct RingStatistics
+    {
+        std::uint64_t packetsReceived;                      ///< Number of packets that passed the socket filter.
+        std::uint64_t packetsDropped;                       ///< Number of packets dropped by the kernel because the ring was full.
+        std::uint64_t ringFreezes;                          ///< Number of times the ring was full.
+    };
+
+public:
+    UDPRing(std::string pName, LayerConfig pConfig);        ///< Constructor.
+    ~UDPRing() override;                                    ///< Destructor.
+    //
+    std::vector<std::uint8_t> read(int pSize = -1) override;
+    std::size_t readInto(std::span<std::uint8_t> pBuffer, int pSize = -1) override;
+    void write(const std::vector<std::uint8_t>& pData) override;
+    std::vector<std::uint8_t> query(const std::vector<std::uint8_t>& pData, int pSize = -1) override;
+    //
+    bool readBufferEmpty() const override;
+    void clearReadBuffer() override;
+    //
+    std::size_t consumeDatagrams(const DatagramConsumerFunctionType& pConsumer,
+                                 std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero());
+                                                            ///< Pass all available datagram payloads in place to a function.
+    RingStatistics getRingStatistics() const;               ///< Get the packet counters of the ring.
+
+private:
+    bool initImpl() override;
+    bool closeImpl() override;
+    //
+    void checkOpen() const;                                 ///< Check that the packet ring is set up.
+    std::span<const std::uint8_t> waitForDatagram();        ///< Wait for the next datagram.
+
+private:
+    struct Ring;                                            ///< Packet socket with mapped receive ring.
+    //
+    const std::string networkInterface;                     ///< Name of the network interface to receive from.
+    const int port;                                         ///< Destination port of the received datagrams.
+    const std::size_t blockSize;                            ///< Size of a ring block in bytes.
+    const std::size_t blockCount;                           ///< Number of ring blocks.
+    const std::chrono::milliseconds blockTimeout;           ///< Timeout after which a partially filled block is handed over.
+    //
+    std::unique_ptr<Ring> ring;                             ///< The packet ring (null if closed).
+    //
+    mutable std::mutex mutex;                               ///< Mutex serializing all ring accesses.
+
+    CASIL_REGISTER_INTERFACE_H("UDPRing")
+};
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_UDPRING_H
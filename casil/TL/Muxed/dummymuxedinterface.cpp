@@ -23,8 +23,10 @@
 
 #include <casil/TL/Muxed/dummymuxedinterface.h>
 
+#include <casil/auxil.h>
 #include <casil/bytes.h>
 
+#include <chrono>
 #include <utility>
 
 using casil::Layers::TL::DummyMuxedInterface;
@@ -36,11 +38,18 @@ CASIL_REGISTER_INTERFACE_CPP(DummyMuxedInterface)
 /*!
  * \brief Constructor.
  *
+ * Gets the optional "silent" value from \p pConfig (boolean value, default: false), which disables the
+ * debug logging of all function calls, and the optional "latency" value (unsigned integer value in microseconds,
+ * default: 0), which is waited for in every data transfer call (read(), write(), query()).
+ * This allows to use the %DummyMuxedInterface for profiling the overhead of the components on top of it.
+ *
  * \param pName Component instance name.
  * \param pConfig Component configuration.
  */
 DummyMuxedInterface::DummyMuxedInterface(std::string pName, LayerConfig pConfig) :
-    MuxedInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig())
+    MuxedInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig()),
+    silent(config.getBool("silent", false)),
+    latency(config.getUInt("latency", 0))
 {
 }
 
@@ -49,7 +58,8 @@ DummyMuxedInterface::DummyMuxedInterface(std::string pName, LayerConfig pConfig)
 /*!
  * \copybrief MuxedInterface::read()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments (unless disabled)
+ * after waiting for the configured synthetic latency (see DummyMuxedInterface()).
  *
  * \param pAddr Bus address (ignored).
  * \param pSize Number of bytes to read (ignored).
@@ -57,31 +67,39 @@ DummyMuxedInterface::DummyMuxedInterface(std::string pName, LayerConfig pConfig)
  */
 std::vector<std::uint8_t> DummyMuxedInterface::read(const std::uint64_t pAddr, const int pSize)
 {
-    logger.logDebug(std::string("read() was called with arguments ") +
-                    "\"pAddr\" = " + Bytes::formatHex(pAddr) + ", " +
-                    "\"pSize\" = " + std::to_string(pSize) + ".");
+    simulateLatency();
+
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, std::string("read() was called with arguments ") +
+                                 "\"pAddr\" = " + Bytes::formatHex(pAddr) + ", " +
+                                 "\"pSize\" = " + std::to_string(pSize) + ".");
     return {};
 }
 
 /*!
  * \copybrief MuxedInterface::write()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments (unless disabled)
+ * after waiting for the configured synthetic latency (see DummyMuxedInterface()).
  *
  * \param pAddr Bus address (ignored).
  * \param pData %Bytes to be written (ignored).
  */
 void DummyMuxedInterface::write(const std::uint64_t pAddr, const std::vector<std::uint8_t>& pData)
 {
-    logger.logDebug(std::string("write() was called with arguments ") +
-                    "\"pAddr\" = " + Bytes::formatHex(pAddr) + ", " +
-                    "\"pData\" = " + Bytes::formatByteVec(pData) + ".");
+    simulateLatency();
+
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, std::string("write() was called with arguments ") +
+                                 "\"pAddr\" = " + Bytes::formatHex(pAddr) + ", " +
+                                 "\"pData\" = " + Bytes::formatByteVec(pData) + ".");
 }
 
 /*!
  * \copybrief MuxedInterface::query()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call and the passed arguments (unless disabled)
+ * after waiting for the configured synthetic latency (see DummyMuxedInterface()).
  *
  * \param pWriteAddr Bus address to write to (ignored).
  * \param pReadAddr Bus address to read from (ignored).
@@ -92,11 +110,14 @@ void DummyMuxedInterface::write(const std::uint64_t pAddr, const std::vector<std
 std::vector<std::uint8_t> DummyMuxedInterface::query(const std::uint64_t pWriteAddr, const std::uint64_t pReadAddr,
                                                      const std::vector<std::uint8_t>& pData, const int pSize)
 {
-    logger.logDebug(std::string("query() was called with arguments ") +
-                    "\"pWriteAddr\" = " + Bytes::formatHex(pWriteAddr) + ", " +
-                    "\"pReadAddr\" = " + Bytes::formatHex(pReadAddr) + ", " +
-                    "\"pData\" = " + Bytes::formatByteVec(pData) + ", " +
-                    "\"pSize\" = " + std::to_string(pSize) + ".");
+    simulateLatency();
+
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, std::string("query() was called with arguments ") +
+                                 "\"pWriteAddr\" = " + Bytes::formatHex(pWriteAddr) + ", " +
+                                 "\"pReadAddr\" = " + Bytes::formatHex(pReadAddr) + ", " +
+                                 "\"pData\" = " + Bytes::formatByteVec(pData) + ", " +
+                                 "\"pSize\" = " + std::to_string(pSize) + ".");
     return {};
 }
 
@@ -105,24 +126,26 @@ std::vector<std::uint8_t> DummyMuxedInterface::query(const std::uint64_t pWriteA
 /*!
  * \copybrief MuxedInterface::readBufferEmpty()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyMuxedInterface()).
  *
  * \return True.
  */
 bool DummyMuxedInterface::readBufferEmpty() const
 {
-    logger.logDebug("readBufferEmpty() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "readBufferEmpty() was called.");
     return true;
 }
 
 /*!
  * \copybrief MuxedInterface::clearReadBuffer()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyMuxedInterface()).
  */
 void DummyMuxedInterface::clearReadBuffer()
 {
-    logger.logDebug("clearReadBuffer() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "clearReadBuffer() was called.");
 }
 
 //Private
@@ -130,25 +153,40 @@ void DummyMuxedInterface::clearReadBuffer()
 /*!
  * \copybrief MuxedInterface::initImpl()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyMuxedInterface()).
  *
  * \return True.
  */
 bool DummyMuxedInterface::initImpl()
 {
-    logger.logDebug("initImpl() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "initImpl() was called.");
     return true;
 }
 
 /*!
  * \copybrief MuxedInterface::closeImpl()
  *
- * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call.
+ * Does nothing except \ref casil::Logger::LogLevel::Debug "Debug"-logging the function call (unless disabled, see DummyMuxedInterface()).
  *
  * \return True.
  */
 bool DummyMuxedInterface::closeImpl()
 {
-    logger.logDebug("closeImpl() was called.");
+    if (!silent)
+        CASIL_CLOG_DEBUG(logger, "closeImpl() was called.");
     return true;
 }
+
+//
+
+/*!
+ * \brief Wait for the configured synthetic latency.
+ *
+ * Blocks for the configured "latency" (see DummyMuxedInterface()) with sub-millisecond accuracy (see Auxil::sleepUntil()).
+ */
+void DummyMuxedInterface::simulateLatency() const
+{
+    if (latency.count() > 0)
+        Auxil::sleepUntil(std::chrono::steady_clock::now() + latency);
+}
@@ -0,0 +1,706 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <casil/TL/Muxed/mmio.h>
+
+#include <casil/bytes.h>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+using casil::Layers::TL::MMIO;
+
+CASIL_REGISTER_INTERFACE_CPP(MMIO)
+
+namespace
+{
+
+/*
+ * Copies 'pSize' bytes from the device memory at 'pSrc' to 'pDst', using volatile accesses of type 'T'
+ * for the part of the source range that is aligned to sizeof(T) and single-byte volatile accesses otherwise.
+ */
+template<typename T>
+void volatileRead(const volatile std::uint8_t* pSrc, std::uint8_t* pDst, std::size_t pSize)
+{
+    for (; pSize > 0 && reinterpret_cast<std::uintptr_t>(pSrc) % sizeof(T) != 0; --pSize)
+        *pDst++ = *pSrc++;
+
+    for (; pSize >= sizeof(T); pSize -= sizeof(T), pSrc += sizeof(T), pDst += sizeof(T))
+    {
+        const T value = *reinterpret_cast<const volatile T*>(pSrc);
+        std::memcpy(pDst, &value, sizeof(T));
+    }
+
+    for (; pSize > 0; --pSize)
+        *pDst++ = *pSrc++;
+}
+
+/*
+ * Copies 'pSize' bytes from 'pSrc' to the device memory at 'pDst', using volatile accesses of type 'T'
+ * for the part of the destination range that is aligned to sizeof(T) and single-byte volatile accesses otherwise.
+ */
+template<typename T>
+void volatileWrite(volatile std::uint8_t* pDst, const std::uint8_t* pSrc, std::size_t pSize)
+{
+    for (; pSize > 0 && reinterpret_cast<std::uintptr_t>(pDst) % sizeof(T) != 0; --pSize)
+        *pDst++ = *pSrc++;
+
+    for (; pSize >= sizeof(T); pSize -= sizeof(T), pSrc += sizeof(T), pDst += sizeof(T))
+    {
+        T value;
+        std::memcpy(&value, pSrc, sizeof(T));
+        *reinterpret_cast<volatile T*>(pDst) = value;
+    }
+
+    for (; pSize > 0; --pSize)
+        *pDst++ = *pSrc++;
+}
+
+} // namespace
+
+/*!
+ * \brief Mapped region of a device file.
+ *
+ * Maps \p pSize bytes (whole file if zero) starting from \p pOffset of the file \p pPath with read/write access and shared
+ * with the device (and other processes).
+ */
+struct MMIO::Region
+{
+    Region(const std::string& pPath, const std::uint64_t pOffset, const std::uint64_t pSize) :
+        mapping(),
+        region()
+    {
+        try
+        {
+            mapping = boost::interprocess::file_mapping(pPath.c_str(), boost::interprocess::read_write);
+            region = boost::interprocess::mapped_region(mapping, boost::interprocess::read_write,
+                                                        static_cast<boost::interprocess::offset_t>(pOffset), pSize);
+        }
+        catch (const boost::interprocess::interprocess_exception& exc)
+        {
+            throw std::runtime_error("Could not map \"" + pPath + "\": " + exc.what());
+        }
+    }
+    //
+    volatile std::uint8_t* data() const                 ///< Get the start address of the mapped region.
+    {
+        return static_cast<volatile std::uint8_t*>(region.get_address());
+    }
+    std::size_t size() const                            ///< Get the size of the mapped region in bytes.
+    {
+        return region.get_size();
+    }
+    //
+    boost::interprocess::file_mapping mapping;          ///< Mapping of the file.
+    boost::interprocess::mapped_region region;          ///< Mapped region.
+};
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Sets the device file that provides the bus address space from the required "init.device" value in \p pConfig
+ * (string type, e.g. \c /dev/uio0 or \c /sys/bus/pci/devices/0000:01:00.0/resource0).
+ *
+ * Configures the bus mapping from the following optional values in \p pConfig:
+ * - "init.offset": Offset of bus address zero in the device file (unsigned integer type, in bytes, default: 0).
+ *                  For UIO devices this selects the memory map (map \e N at offset <em>N * page size</em>).
+ * - "init.size": Size of the bus address space (unsigned integer type, in bytes, default: 0, i.e. the rest of the file).
+ *                Must be set for device files that do not report their size (e.g. UIO devices).
+ * - "init.access_width": Width of the bus accesses (unsigned integer type, in bytes, one of 1, 2, 4 and 8, default: 1).
+ *                        Use the data width of the bus bridge to avoid split or merged accesses.
+ *
+ * Configures an optional DMA ring FIFO (see MMIO) from the following values in \p pConfig:
+ * - "init.fifo_device": Device file that provides the ring memory (string type, default: empty, i.e. no FIFO).
+ *                       Can be the same file as "init.device".
+ * - "init.fifo_offset": Offset of the ring in its device file (unsigned integer type, in bytes, default: 0).
+ * - "init.fifo_size": Size of the ring (unsigned integer type, in bytes, required for a FIFO, must be a multiple of 4).
+ * - "init.fifo_write_pointer": Bus address of the write pointer register (unsigned integer type, required for a FIFO).
+ * - "init.fifo_read_pointer": Bus address of the read pointer register (unsigned integer type, required for a FIFO).
+ *
+ * \throws std::runtime_error If "init.device" is empty.
+ * \throws std::runtime_error If "init.access_width" is not one of 1, 2, 4 and 8.
+ * \throws std::runtime_error If a FIFO is configured and "init.fifo_size" is zero or not a multiple of 4
+ *                            or "init.fifo_offset" is not a multiple of 4.
+ * \throws std::runtime_error If a FIFO is configured and "init.fifo_write_pointer" or "init.fifo_read_pointer" is missing.
+ *
+ * \param pName Component instance name.
+ * \param pConfig Component configuration.
+ */
+MMIO::MMIO(std::string pName, LayerConfig pConfig) :
+    MuxedInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig::fromYAML("{init: {device: string}}")),
+    devicePath(config.getStr("init.device", "")),
+    mapOffset(config.getUInt("init.offset", 0)),
+    mapSize(config.getUInt("init.size", 0)),
+    accessWidth(config.getUInt("init.access_width", 1)),
+    fifoDevicePath(config.getStr("init.fifo_device", "")),
+    fifoOffset(config.getUInt("init.fifo_offset", 0)),
+    fifoRingSize(config.getUInt("init.fifo_size", 0)),
+    fifoWritePointerAddr(config.getUInt("init.fifo_write_pointer", 0)),
+    fifoReadPointerAddr(config.getUInt("init.fifo_read_pointer", 0)),
+    busRegion(),
+    fifoRegion(),
+    mutex()
+{
+    if (devicePath == "")
+        throw std::runtime_error("No device file set for " + getSelfDescription() + ".");
+
+    if (accessWidth != 1 && accessWidth != 2 && accessWidth != 4 && accessWidth != 8)
+        throw std::runtime_error("Invalid access width set for " + getSelfDescription() + ".");
+
+    if (fifoDevicePath != "")
+    {
+        if (fifoRingSize == 0 || fifoRingSize % 4 != 0 || fifoOffset % 4 != 0)
+            throw std::runtime_error("Invalid FIFO ring size or offset set for " + getSelfDescription() + ".");
+
+        if (!config.getUIntOpt("init.fifo_write_pointer") || !config.getUIntOpt("init.fifo_read_pointer"))
+            throw std::runtime_error("FIFO pointer register addresses not set for " + getSelfDescription() + ".");
+    }
+}
+
+/*!
+ * \brief Destructor.
+ */
+MMIO::~MMIO() = default;
+
+//Public
+
+/*!
+ * \copybrief MuxedInterface::read()
+ *
+ * Depending on \p pAddr this function behaves differently:
+ *
+ * - <tt>[0, \ref baseAddrDataLimit)</tt>: Reads \p pSize bytes from the mapped bus region at address \p pAddr (see MMIO).
+ * - <tt>[\ref baseAddrDataLimit, \ref baseAddrFIFOLimit)</tt>: Returns FIFO data, see getFifoData() with \p pSize as argument.
+ * - <tt>[baseAddrFIFOLimit, ...)</tt>: Returns the FIFO size (see getFifoSize()) as 4 byte long little endian sequence
+ *                                      if \p pSize is 4 and \p pSize zeros otherwise.
+ *
+ * \throws std::runtime_error For negative \p pSize, if also \p pAddr < \ref baseAddrDataLimit or \p pAddr >= \ref baseAddrFIFOLimit.
+ * \throws std::runtime_error If the interface is not initialized.
+ * \throws std::runtime_error If the address range exceeds the bus region.
+ * \throws std::runtime_error If getFifoData() or getFifoSize() throws \c std::runtime_error.
+ *
+ * \param pAddr Bus address or FIFO access address.
+ * \param pSize Number of bytes to read.
+ * \return Read bytes.
+ */
+std::vector<std::uint8_t> MMIO::read(const std::uint64_t pAddr, const int pSize)
+{
+    if (pAddr >= baseAddrDataLimit && pAddr < baseAddrFIFOLimit)
+        return getFifoData(pSize);
+
+    if (pSize < 0)
+        throw std::runtime_error("Cannot read unspecified number of bytes from " + getSelfDescription() + ".");
+
+    if (pAddr >= baseAddrFIFOLimit)
+    {
+        if (pSize == 4)
+            return Bytes::composeByteVec(false, static_cast<std::uint32_t>(getFifoSize()));
+        else
+            return std::vector<std::uint8_t>(static_cast<std::size_t>(pSize), 0);
+    }
+
+    std::vector<std::uint8_t> retVal(static_cast<std::size_t>(pSize));
+
+    readInto(pAddr, retVal);
+
+    return retVal;
+}
+
+/*!
+ * \copybrief MuxedInterface::readInto()
+ *
+ * For normal bus addresses (below \ref baseAddrDataLimit) reads as many bytes as fit into \p pBuffer from the mapped
+ * bus region directly into \p pBuffer, without allocating memory. For all other addresses MuxedInterface::readInto() is used.
+ *
+ * \throws std::runtime_error If the interface is not initialized.
+ * \throws std::runtime_error If the address range exceeds the bus region.
+ * \throws std::runtime_error If MuxedInterface::readInto() throws \c std::runtime_error.
+ *
+ * \param pAddr Bus address or FIFO access address.
+ * \param pBuffer Buffer for the read bytes.
+ * \return Number of bytes written to \p pBuffer.
+ */
+std::size_t MMIO::readInto(const std::uint64_t pAddr, const std::span<std::uint8_t> pBuffer)
+{
+    if (pAddr >= baseAddrDataLimit)
+        return MuxedInterface::readInto(pAddr, pBuffer);
+
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    checkMapped();
+    checkBusRange(pAddr, pBuffer.size());
+
+    copyFromBus(pAddr, pBuffer);
+
+    return pBuffer.size();
+}
+
+/*!
+ * \copybrief MuxedInterface::write()
+ *
+ * See writeFrom().
+ *
+ * \throws std::runtime_error If writeFrom() throws.
+ *
+ * \param pAddr Bus address.
+ * \param pData %Bytes to be written.
+ */
+void MMIO::write(const std::uint64_t pAddr, const std::vector<std::uint8_t>& pData)
+{
+    writeFrom(pAddr, pData);
+}
+
+/*!
+ * \copybrief MuxedInterface::writeFrom()
+ *
+ * Writes \p pData to the mapped bus region at address \p pAddr (see MMIO), without allocating memory.
+ *
+ * \throws std::runtime_error If \p pAddr is not a normal bus address (FIFO writes are not supported).
+ * \throws std::runtime_error If the interface is not initialized.
+ * \throws std::runtime_error If the address range exceeds the bus region.
+ *
+ * \param pAddr Bus address.
+ * \param pData %Bytes to be written.
+ */
+void MMIO::writeFrom(const std::uint64_t pAddr, const std::span<const std::uint8_t> pData)
+{
+    if (pAddr >= baseAddrDataLimit)
+        throw std::runtime_error("Writing to the FIFO is not supported by " + getSelfDescription() + ".");
+
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    checkMapped();
+    checkBusRange(pAddr, pData.size());
+
+    copyToBus(pAddr, pData);
+}
+
+/*!
+ * \copybrief MuxedInterface::query()
+ *
+ * Writes \p pData to \p pWriteAddr and then reads \p pSize bytes from \p pReadAddr (see write() and read()).
+ *
+ * \throws std::runtime_error If write() or read() throws.
+ *
+ * \param pWriteAddr Bus address to write to.
+ * \param pReadAddr Bus address to read from.
+ * \param pData Query bytes to be written.
+ * \param pSize Number of response bytes to read.
+ * \return Read response bytes.
+ */
+std::vector<std::uint8_t> MMIO::query(const std::uint64_t pWriteAddr, const std::uint64_t pReadAddr,
+                                      const std::vector<std::uint8_t>& pData, const int pSize)
+{
+    write(pWriteAddr, pData);
+    return read(pReadAddr, pSize);
+}
+
+//
+
+/*!
+ * \copybrief MuxedInterface::readBufferEmpty()
+ *
+ * There is no read buffer.
+ *
+ * \return True.
+ */
+bool MMIO::readBufferEmpty() const
+{
+    return true;
+}
+
+/*!
+ * \copybrief MuxedInterface::clearReadBuffer()
+ *
+ * There is no read buffer, hence does nothing.
+ */
+void MMIO::clearReadBuffer()
+{
+}
+
+//
+
+/*!
+ * \brief Check if a DMA ring FIFO is configured.
+ *
+ * \return True if "init.fifo_device" is set (see MMIO()).
+ */
+bool MMIO::hasFifo() const
+{
+    return fifoDevicePath != "";
+}
+
+/*!
+ * \brief Discard the current FIFO content.
+ *
+ * Sets the read pointer register to the current value of the write pointer register. Does nothing if there is no FIFO.
+ *
+ * \throws std::runtime_error If the interface is not initialized.
+ * \throws std::runtime_error If the write pointer is invalid (not a multiple of 4 or outside of the ring).
+ */
+void MMIO::resetFifo()
+{
+    if (!hasFifo())
+        return;
+
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    checkMapped();
+
+    std::uint32_t readPointer = 0;
+    const std::size_t size = getFifoSizeUnlocked(readPointer);
+
+    const std::uint32_t newReadPointer = static_cast<std::uint32_t>((readPointer + size) % fifoRingSize);
+
+    copyToBus(fifoReadPointerAddr, Bytes::composeByteArray(false, newReadPointer));
+}
+
+/*!
+ * \brief Get the FIFO size in number of bytes.
+ *
+ * \return Number of bytes between the read and write pointers (zero if there is no FIFO).
+ *
+ * \throws std::runtime_error If the interface is not initialized.
+ * \throws std::runtime_error If a FIFO pointer is invalid (not a multiple of 4 or outside of the ring).
+ */
+std::size_t MMIO::getFifoSize() const
+{
+    if (!hasFifo())
+        return 0;
+
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    checkMapped();
+
+    std::uint32_t readPointer = 0;
+    return getFifoSizeUnlocked(readPointer);
+}
+
+/*!
+ * \brief Extract the current FIFO content as sequence of bytes.
+ *
+ * Copies the data between the read and write pointers from the ring (limited to <tt>pSize / 4</tt> words
+ * if \p pSize is not negative) and advances the read pointer accordingly.
+ *
+ * \param pSize Number of FIFO bytes to get (automatically reduced by modulo 4) or -1 for all.
+ * \return Byte sequence from the FIFO in multiples of 4 bytes.
+ *
+ * \throws std::runtime_error If the interface is not initialized.
+ * \throws std::runtime_error If a FIFO pointer is invalid (not a multiple of 4 or outside of the ring).
+ */
+std::vector<std::uint8_t> MMIO::getFifoData(const int pSize)
+{
+    std::vector<std::uint8_t> retVal;
+
+    consumeFifo([&retVal](const std::span<const std::uint32_t> pFirst, const std::span<const std::uint32_t> pSecond) -> void
+                {
+                    retVal.resize((pFirst.size() + pSecond.size()) * 4);
+
+                    Bytes::encodeUInt32LE(pFirst, std::span<std::uint8_t>(retVal).first(pFirst.size() * 4));
+                    Bytes::encodeUInt32LE(pSecond, std::span<std::uint8_t>(retVal).subspan(pFirst.size() * 4));
+                },
+                pSize);
+
+    return retVal;
+}
+
+/*!
+ * \brief Pass the current FIFO content in place to a function and remove it.
+ *
+ * Works like getFifoData() but instead of copying the data to a newly allocated byte sequence, calls \p pConsumer with
+ * views directly into the mapped ring. The data is passed as 32 bit words in two contiguous segments, of which the second
+ * one is empty unless the data wraps around the end of the ring. The read pointer is only advanced when \p pConsumer
+ * returns, i.e. the hardware does not overwrite the data meanwhile. If \p pConsumer throws, the data is kept in the FIFO.
+ *
+ * Note: The interface is locked while \p pConsumer runs. Do not call any of the interface functions from within \p pConsumer.
+ *
+ * Note: The words are viewed in host byte order, i.e. this assumes a little endian host for little endian FIFO data.
+ *
+ * \param pConsumer Function to process the FIFO data words.
+ * \param pSize Number of FIFO bytes to pass (automatically reduced by modulo 4) or -1 for all.
+ * \return Number of passed (and removed) bytes.
+ *
+ * \throws std::runtime_error If the interface is not initialized.
+ * \throws std::runtime_error If a FIFO pointer is invalid (not a multiple of 4 or outside of the ring).
+ */
+std::size_t MMIO::consumeFifo(const FifoConsumerFunctionType& pConsumer, const int pSize)
+{
+    if (!hasFifo())
+        return 0;
+
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    checkMapped();
+
+    return consumeFifoUnlocked(pConsumer, pSize);
+}
+
+//Private
+
+/*!
+ * \copybrief MuxedInterface::initImpl()
+ *
+ * Maps the bus region and the FIFO ring region (if configured).
+ *
+ * \return True if successful.
+ */
+bool MMIO::initImpl()
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    try
+    {
+        busRegion = std::make_unique<Region>(devicePath, mapOffset, mapSize);
+
+        if (hasFifo())
+        {
+            fifoRegion = std::make_unique<Region>(fifoDevicePath, fifoOffset, fifoRingSize);
+
+            if (fifoWritePointerAddr > busRegion->size() || busRegion->size() - fifoWritePointerAddr < 4 ||
+                fifoReadPointerAddr > busRegion->size() || busRegion->size() - fifoReadPointerAddr < 4)
+            {
+                throw std::runtime_error("FIFO pointer registers exceed the bus region.");
+            }
+        }
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(std::string("Could not map device memory: ") + exc.what());
+
+        busRegion.reset();
+        fifoRegion.reset();
+
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \copybrief MuxedInterface::closeImpl()
+ *
+ * Unmaps all regions.
+ *
+ * \return True.
+ */
+bool MMIO::closeImpl()
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    fifoRegion.reset();
+    busRegion.reset();
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Check that the regions are mapped.
+ *
+ * \throws std::runtime_error If the interface is not initialized.
+ */
+void MMIO::checkMapped() const
+{
+    if (!busRegion)
+        throw std::runtime_error("Device memory of " + getSelfDescription() + " is not mapped.");
+}
+
+/*!
+ * \brief Check that an address range lies within the bus region.
+ *
+ * Note: The regions must be mapped.
+ *
+ * \throws std::runtime_error If the range exceeds the bus region.
+ *
+ * \param pAddr Start address.
+ * \param pSize Number of bytes.
+ */
+void MMIO::checkBusRange(const std::uint64_t pAddr, const std::size_t pSize) const
+{
+    if (pAddr > busRegion->size() || pSize > busRegion->size() - pAddr)
+        throw std::runtime_error("Address range [" + Bytes::formatHex(pAddr) + ", " + Bytes::formatHex(pAddr + pSize) + ") " +
+                                 "exceeds mapped device memory of " + getSelfDescription() + ".");
+}
+
+/*!
+ * \brief Read bytes from the bus region.
+ *
+ * Uses volatile accesses of the configured width (see MMIO()).
+ *
+ * Note: The range must have been checked.
+ *
+ * \param pAddr Start address.
+ * \param pBuffer Buffer for the read bytes.
+ */
+void MMIO::copyFromBus(const std::uint64_t pAddr, const std::span<std::uint8_t> pBuffer) const
+{
+    const volatile std::uint8_t* const src = busRegion->data() + pAddr;
+
+    switch (accessWidth)
+    {
+        case 2:
+            volatileRead<std::uint16_t>(src, pBuffer.data(), pBuffer.size());
+            break;
+        case 4:
+            volatileRead<std::uint32_t>(src, pBuffer.data(), pBuffer.size());
+            break;
+        case 8:
+            volatileRead<std::uint64_t>(src, pBuffer.data(), pBuffer.size());
+            break;
+        default:
+            volatileRead<std::uint8_t>(src, pBuffer.data(), pBuffer.size());
+            break;
+    }
+}
+
+/*!
+ * \brief Write bytes to the bus region.
+ *
+ * Uses volatile accesses of the configured width (see MMIO()).
+ *
+ * Note: The range must have been checked.
+ *
+ * \param pAddr Start address.
+ * \param pData %Bytes to be written.
+ */
+void MMIO::copyToBus(const std::uint64_t pAddr, const std::span<const std::uint8_t> pData)
+{
+    volatile std::uint8_t* const dst = busRegion->data() + pAddr;
+
+    switch (accessWidth)
+    {
+        case 2:
+            volatileWrite<std::uint16_t>(dst, pData.data(), pData.size());
+            break;
+        case 4:
+            volatileWrite<std::uint32_t>(dst, pData.data(), pData.size());
+            break;
+        case 8:
+            volatileWrite<std::uint64_t>(dst, pData.data(), pData.size());
+            break;
+        default:
+            volatileWrite<std::uint8_t>(dst, pData.data(), pData.size());
+            break;
+    }
+}
+
+/*!
+ * \brief Read a FIFO pointer register.
+ *
+ * Note: The regions must be mapped.
+ *
+ * \throws std::runtime_error If the pointer is not a multiple of 4 or outside of the ring.
+ *
+ * \param pAddr Bus address of the pointer register.
+ * \return Byte offset within the ring.
+ */
+std::uint32_t MMIO::readFifoPointer(const std::uint64_t pAddr) const
+{
+    std::array<std::uint8_t, 4> bytes {};
+    copyFromBus(pAddr, bytes);
+
+    const std::uint32_t pointer = Bytes::composeUInt32(bytes, false);
+
+    if (pointer % 4 != 0 || pointer >= fifoRingSize)
+        throw std::runtime_error("Invalid FIFO pointer " + Bytes::formatHex(pointer) + " at " + Bytes::formatHex(pAddr) + " of " +
+                                 getSelfDescription() + ".");
+
+    return pointer;
+}
+
+/*!
+ * \brief Get the FIFO size without locking the mutex.
+ *
+ * See getFifoSize().
+ *
+ * Note: \ref mutex must be locked and the regions must be mapped.
+ *
+ * \param pReadPointer Is set to the current read pointer.
+ * \return Number of bytes between the read and write pointers.
+ */
+std::size_t MMIO::getFifoSizeUnlocked(std::uint32_t& pReadPointer) const
+{
+    pReadPointer = readFifoPointer(fifoReadPointerAddr);
+    const std::uint32_t writePointer = readFifoPointer(fifoWritePointerAddr);
+
+    //Ring data written before the write pointer update must be visible before reading it
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return static_cast<std::size_t>((writePointer + fifoRingSize - pReadPointer) % fifoRingSize);
+}
+
+/*!
+ * \brief Pass FIFO data to a function without locking the mutex.
+ *
+ * See consumeFifo().
+ *
+ * Note: \ref mutex must be locked and the regions must be mapped.
+ *
+ * \param pConsumer Function to process the FIFO data words.
+ * \param pSize Number of FIFO bytes to pass (automatically reduced by modulo 4) or -1 for all.
+ * \return Number of passed (and removed) bytes.
+ */
+std::size_t MMIO::consumeFifoUnlocked(const FifoConsumerFunctionType& pConsumer, const int pSize)
+{
+    std::uint32_t readPointer = 0;
+    std::size_t size = getFifoSizeUnlocked(readPointer);
+
+    if (pSize >= 0)
+        size = std::min(size, static_cast<std::size_t>(pSize) / 4 * 4);
+
+    const std::size_t firstSize = std::min(size, static_cast<std::size_t>(fifoRingSize - readPointer));
+
+    //The ring is DMA memory that is only written by the device outside of the range between the pointers
+    const std::uint32_t* const ring = reinterpret_cast<const std::uint32_t*>(const_cast<const std::uint8_t*>(fifoRegion->data()));
+
+    pConsumer(std::span<const std::uint32_t>(ring + readPointer / 4, firstSize / 4),
+              std::span<const std::uint32_t>(ring, (size - firstSize) / 4));
+
+    //Data must be read completely before the device may overwrite it
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const std::uint32_t newReadPointer = static_cast<std::uint32_t>((readPointer + size) % fifoRingSize);
+
+    copyToBus(fifoReadPointerAddr, Bytes::composeByteArray(false, newReadPointer));
+
+    return size;
+}
@@ -0,0 +1,140 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#ifndef CASIL_LAYERS_TL_MMIO_H
+#define CASIL_LAYERS_TL_MMIO_H
+
+#include <casil/TL/muxedinterface.h>
+
+#include <casil/layerconfig.h>
+#include <casil/layerfactorymacros.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/*!
+ * \brief Memory-mapped MuxedInterface for basil buses exposed via PCIe BARs or Linux UIO (e.g. AXI on SoC FPGAs).
+ *
+ * Maps the bus address space from a device file such as \c /dev/uioN or a PCIe resource file
+ * (\c /sys/bus/pci/devices/.../resourceN) into the process and performs bus reads and writes
+ * as \c volatile memory accesses, i.e. without any protocol, packet or system call overhead.
+ * Bus address \e A is the byte at offset \e A of the mapped region (see MMIO() for all settings). The accesses
+ * use a configurable width (1, 2, 4 or 8 bytes) for the naturally aligned part of a transfer and single bytes
+ * for unaligned leading and trailing bytes.
+ *
+ * Optionally, a FIFO filled by DMA into a ring buffer in a second mapped region can be read. The hardware
+ * writes the data words to the ring and advances a \e write \e pointer register, the host consumes the
+ * data between its \e read \e pointer and the write pointer and then writes back the read pointer.
+ * Both pointers are 32 bit little endian registers on the bus that hold byte offsets within the ring.
+ * The ring is empty if both pointers are equal. The FIFO API is the same as the one of \ref SiTCP "SiTCP"
+ * (see getFifoSize(), getFifoData(), consumeFifo(), resetFifo()), including the special read() addresses.
+ *
+ * All transactions are serialized, i.e. concurrent accesses wait for each other.
+ *
+ * Note: The regions are mapped by init() and unmapped by close(). Accessing the interface while it is closed throws.
+ */
+class MMIO final : public MuxedInterface
+{
+public:
+    using FifoConsumerFunctionType = std::function<void(std::span<const std::uint32_t>, std::span<const std::uint32_t>)>;
+                                                            ///< \brief Function type for in place access to FIFO data words
+                                                            ///  as two contiguous segments (see consumeFifo()).
+
+public:
+    MMIO(std::string pName, LayerConfig pConfig);           ///< Constructor.
+    ~MMIO() override;                                       ///< Destructor.
+    //
+    std::vector<std::uint8_t> read(std::uint64_t pAddr, int pSize = -1) override;
+    std::size_t readInto(std::uint64_t pAddr, std::span<std::uint8_t> pBuffer) override;
+    void write(std::uint64_t pAddr, const std::vector<std::uint8_t>& pData) override;
+    void writeFrom(std::uint64_t pAddr, std::span<const std::uint8_t> pData) override;
+    std::vector<std::uint8_t> query(std::uint64_t pWriteAddr, std::uint64_t pReadAddr,
+                                    const std::vector<std::uint8_t>& pData, int pSize = -1) override;
+    //
+    bool readBufferEmpty() const override;
+    void clearReadBuffer() override;
+    //
+    bool hasFifo() const;                                   ///< Check if a DMA ring FIFO is configured.
+    void resetFifo();                                       ///< Discard the current FIFO content.
+    std::size_t getFifoSize() const;                        ///< Get the FIFO size in number of bytes.
+    std::vector<std::uint8_t> getFifoData(int pSize = -1);  ///< Extract the current FIFO content as sequence of bytes.
+    std::size_t consumeFifo(const FifoConsumerFunctionType& pConsumer, int pSize = -1);
+                                                            ///< Pass the current FIFO content in place to a function and remove it.
+
+private:
+    bool initImpl() override;
+    bool closeImpl() override;
+    //
+    void checkMapped() const;                               ///< Check that the regions are mapped.
+    void checkBusRange(std::uint64_t pAddr, std::size_t pSize) const;  ///< Check that an address range lies within the bus region.
+    void copyFromBus(std::uint64_t pAddr, std::span<std::uint8_t> pBuffer) const;     ///< Read bytes from the bus region.
+    void copyToBus(std::uint64_t pAddr, std::span<const std::uint8_t> pData);         ///< Write bytes to the bus region.
+    std::uint32_t readFifoPointer(std::uint64_t pAddr) const;   ///< Read a FIFO pointer register.
+    std::size_t getFifoSizeUnlocked(std::uint32_t& pReadPointer) const; ///< Get the FIFO size without locking the mutex.
+    std::size_t consumeFifoUnlocked(const FifoConsumerFunctionType& pConsumer, int pSize);
+                                                            ///< Pass FIFO data to a function without locking the mutex.
+
+private:
+    struct Region;                                          ///< Mapped region of a device file.
+    //
+    const std::string devicePath;                           ///< Device file of the bus address space.
+    const std::uint64_t mapOffset;                          ///< Offset of the bus address space in the device file.
+    const std::uint64_t mapSize;                            ///< Size of the bus address space (zero for the whole file).
+    const std::size_t accessWidth;                          ///< Width of the aligned bus accesses in bytes.
+    //
+    const std::string fifoDevicePath;                       ///< Device file of the FIFO ring (empty if no FIFO).
+    const std::uint64_t fifoOffset;                         ///< Offset of the FIFO ring in its device file.
+    const std::uint64_t fifoRingSize;                       ///< Size of the FIFO ring in bytes.
+    const std::uint64_t fifoWritePointerAddr;               ///< Bus address of the FIFO write pointer register.
+    const std::uint64_t fifoReadPointerAddr;                ///< Bus address of the FIFO read pointer register.
+    //
+    std::unique_ptr<Region> busRegion;                      ///< Mapping of the bus address space (null if closed).
+    std::unique_ptr<Region> fifoRegion;                     ///< Mapping of the FIFO ring (null if closed or no FIFO).
+    //
+    mutable std::mutex mutex;                               ///< Mutex serializing all transactions.
+
+public:
+    static constexpr std::uint64_t baseAddrDataLimit = 0x100000000; ///< Address limit below which read() / write() do normal bus access.
+    static constexpr std::uint64_t baseAddrFIFOLimit = 0x200000000; ///< Address limit for special FIFO access of read() (see there).
+
+    CASIL_REGISTER_INTERFACE_H("MMIO")
+};
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_MMIO_H
@@ -0,0 +1,499 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/Muxed/remote.h>
+
+#include <casil/asio.h>
+#include <casil/auxil.h>
+#include <casil/bytes.h>
+#include <casil/deviceserver.h>
+#include <casil/TL/CommonImpl/asiohelper.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using casil::Layers::TL::Remote;
+
+CASIL_REGISTER_INTERFACE_CPP(Remote)
+
+/*!
+ * \brief Socket connection to the server.
+ */
+struct Remote::Connection
+{
+    explicit Connection(boost::asio::io_context& pIOContext) :
+        ioContext(pIOContext),
+        socket(boost::asio::make_strand(ioContext))
+    {}                                                          ///< Constructor.
+    //
+    boost::asio::io_context& ioContext;                         ///< IO context used by the socket.
+    boost::asio::local::stream_protocol::socket socket;         ///< Socket connected to the server (using a strand of \ref ioContext).
+};
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Initializes the path of the socket file of the DeviceServer to connect to from the mandatory "init.socket" string in \p pConfig.
+ *
+ * Initializes the name of the interface to access on the server side from the mandatory "init.interface" string in \p pConfig.
+ *
+ * Initializes the timeout for each request to the server from the optional "init.timeout" value in \p pConfig (floating-point
+ * value in seconds, default: 5.0; zero disables the timeout). If a request times out, the connection is closed, since the server's
+ * response to the request would be mistaken for the response to the following request. The interface must then be initialized again.
+ *
+ * Enables serving the FIFO accesses from a shared-memory ring if the optional "init.fifo_shm_name" string in \p pConfig is set. This
+ * must be the name of the ring to which the remote \ref casil::TL::SiTCP "SiTCP" interface publishes its FIFO data (i.e. its own
+ * "init.fifo_shm_name" setting). Reads at the FIFO addresses (see \ref casil::TL::SiTCP::read() "SiTCP::read()") then return
+ * the data taken from the ring since init() (or its size, respectively) instead of forwarding the request to the server. Every
+ * client reads all data published to the ring, independently of other clients. See also FifoShmReader.
+ *
+ * \throws std::runtime_error If "init.socket" is empty.
+ * \throws std::runtime_error If "init.interface" is empty or too long (more than 65535 characters).
+ * \throws std::runtime_error If "init.timeout" is negative.
+ *
+ * \param pName Component instance name.
+ * \param pConfig Component configuration.
+ */
+Remote::Remote(std::string pName, LayerConfig pConfig) :
+    MuxedInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig::fromYAML("{init: {socket: string, interface: string}}")),
+    socketPath(config.getStr("init.socket", "")),
+    remoteName(config.getStr("init.interface", "")),
+    timeoutSecs(config.getDbl("init.timeout", 5.0)),
+    timeout(Auxil::getChronoMilliSecs(timeoutSecs)),
+    fifoShmName(config.getStr("init.fifo_shm_name", "")),
+    connection(std::make_unique<Connection>(ASIO::getIOContext())),
+    mutex(),
+    fifoReaderPtr(nullptr),
+    fifoBuffer(),
+    fifoLostBlocks(0),
+    fifoMutex()
+{
+    if (socketPath == "")
+        throw std::runtime_error("No socket path set for " + getSelfDescription() + ".");
+    if (remoteName == "" || remoteName.size() > std::numeric_limits<std::uint16_t>::max())
+        throw std::runtime_error("Invalid remote interface name set for " + getSelfDescription() + ".");
+    if (timeoutSecs < 0.0)
+        throw std::runtime_error("Invalid timeout set for " + getSelfDescription() + ".");
+}
+
+/*!
+ * \brief Destructor.
+ */
+Remote::~Remote() = default;
+
+//Public
+
+/*!
+ * \copybrief MuxedInterface::read()
+ *
+ * Reads \p pSize bytes from \p pAddr of the remote interface (see \ref casil::Layers::TL::MuxedInterface::read() "read()"
+ * of the respective interface for the meaning of \p pAddr and \p pSize).
+ *
+ * If "init.fifo_shm_name" is set (see Remote()), reads at the FIFO addresses are served from the shared-memory ring instead.
+ *
+ * \throws std::runtime_error If the request fails or the remote interface throws an exception.
+ * \throws std::runtime_error If the FIFO is read from the shared-memory ring while not initialized.
+ *
+ * \copydetails MuxedInterface::read()
+ */
+std::vector<std::uint8_t> Remote::read(const std::uint64_t pAddr, const int pSize)
+{
+    if (fifoShmName != "" && pAddr >= SiTCP::baseAddrDataLimit)
+        return readFifo(pAddr, pSize);
+
+    const auto args = Bytes::composeByteArray(false, pAddr, static_cast<std::uint32_t>(pSize));
+
+    return transact(static_cast<std::uint8_t>(DeviceServer::Opcode::Read), args, {});
+}
+
+/*!
+ * \copybrief MuxedInterface::write()
+ *
+ * Writes \p pData to \p pAddr of the remote interface.
+ *
+ * \throws std::runtime_error If the request fails or the remote interface throws an exception.
+ *
+ * \copydetails MuxedInterface::write()
+ */
+void Remote::write(const std::uint64_t pAddr, const std::vector<std::uint8_t>& pData)
+{
+    const auto args = Bytes::composeByteArray(false, pAddr);
+
+    (void)transact(static_cast<std::uint8_t>(DeviceServer::Opcode::Write), args, pData);
+}
+
+/*!
+ * \copybrief MuxedInterface::query()
+ *
+ * Performs the query on the remote interface as a single request, i.e. without other clients' requests in between.
+ *
+ * \throws std::runtime_error If the request fails or the remote interface throws an exception.
+ *
+ * \copydetails MuxedInterface::query()
+ */
+std::vector<std::uint8_t> Remote::query(const std::uint64_t pWriteAddr, const std::uint64_t pReadAddr,
+                                        const std::vector<std::uint8_t>& pData, const int pSize)
+{
+    const auto args = Bytes::composeByteArray(false, pWriteAddr, pReadAddr, static_cast<std::uint32_t>(pSize));
+
+    return transact(static_cast<std::uint8_t>(DeviceServer::Opcode::Query), args, pData);
+}
+
+//
+
+/*!
+ * \copybrief MuxedInterface::readBufferEmpty()
+ *
+ * \throws std::runtime_error If the request fails or the remote interface throws an exception.
+ *
+ * \copydetails MuxedInterface::readBufferEmpty()
+ */
+bool Remote::readBufferEmpty() const
+{
+    const std::vector<std::uint8_t> response = transact(static_cast<std::uint8_t>(DeviceServer::Opcode::ReadBufferEmpty), {}, {});
+
+    if (response.size() != 1)
+        throw std::runtime_error("Could not check read buffer of " + getSelfDescription() + ": Invalid response.");
+
+    return response[0] != 0;
+}
+
+/*!
+ * \copybrief MuxedInterface::clearReadBuffer()
+ *
+ * \throws std::runtime_error If the request fails or the remote interface throws an exception.
+ */
+void Remote::clearReadBuffer()
+{
+    (void)transact(static_cast<std::uint8_t>(DeviceServer::Opcode::ClearReadBuffer), {}, {});
+}
+
+//
+
+/*!
+ * \brief Get the metrics of the server process.
+ *
+ * Requests the output of Metrics::expose() from the DeviceServer process, i.e. the metrics
+ * of all its components (not only of the remote interface) in the OpenMetrics text format.
+ *
+ * \throws std::runtime_error If the request fails.
+ *
+ * \return Exposition text of the server process.
+ */
+std::string Remote::getServerMetrics() const
+{
+    const std::vector<std::uint8_t> response = transact(static_cast<std::uint8_t>(DeviceServer::Opcode::Metrics), {}, {});
+
+    return std::string(response.begin(), response.end());
+}
+
+//Private
+
+/*!
+ * \copybrief MuxedInterface::initImpl()
+ *
+ * Connects to the DeviceServer socket and attaches to the shared-memory FIFO ring (if "init.fifo_shm_name" is set, see Remote()).
+ *
+ * \return True if successful.
+ */
+bool Remote::initImpl()
+{
+    const std::lock_guard<std::mutex> requestLock(mutex);
+    (void)requestLock;
+
+    try
+    {
+        if (connection->socket.is_open())
+            connection->socket.close();
+
+        connection->socket.connect(boost::asio::local::stream_protocol::endpoint(socketPath));
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        logger.logError("Could not connect to device server at \"" + socketPath + "\": " + exc.what());
+        return false;
+    }
+
+    if (fifoShmName != "")
+    {
+        const std::lock_guard<std::mutex> fifoLock(fifoMutex);
+        (void)fifoLock;
+
+        fifoBuffer.clear();
+        fifoLostBlocks = 0;
+
+        try
+        {
+            fifoReaderPtr = std::make_unique<FifoShmReader>(fifoShmName);
+        }
+        catch (const std::runtime_error& exc)
+        {
+            fifoReaderPtr.reset();
+
+            boost::system::error_code ec;
+            connection->socket.close(ec);
+
+            logger.logError("Could not open shared-memory FIFO ring \"" + fifoShmName + "\": " + exc.what());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \copybrief MuxedInterface::closeImpl()
+ *
+ * Disconnects from the DeviceServer.
+ *
+ * \return True if successful.
+ */
+bool Remote::closeImpl()
+{
+    const std::lock_guard<std::mutex> requestLock(mutex);
+    (void)requestLock;
+
+    {
+        const std::lock_guard<std::mutex> fifoLock(fifoMutex);
+        (void)fifoLock;
+
+        fifoReaderPtr.reset();
+        fifoBuffer.clear();
+    }
+
+    boost::system::error_code ec;
+    connection->socket.close(ec);
+
+    if (ec)
+    {
+        logger.logError("Could not close connection to device server: " + ec.message());
+        return false;
+    }
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Send a request to the server and receive the response.
+ *
+ * Assembles the request from \p pOpcode, the remote interface name, \p pArgs and \p pData (see DeviceServer for the protocol),
+ * sends it and waits for the response. If sending or receiving fails or does not finish within the configured timeout
+ * (see Remote()), the connection is closed, since the stream is out of sync with the server's responses afterwards.
+ *
+ * \throws std::runtime_error If not connected (see init()).
+ * \throws std::runtime_error If the request is too large (see DeviceServer::maxMessageSize).
+ * \throws std::runtime_error If sending the request or receiving the response fails or times out.
+ * \throws std::runtime_error If the server reports an error (e.g. an exception thrown by the remote interface).
+ *
+ * \param pOpcode Request opcode (see DeviceServer::Opcode).
+ * \param pArgs Encoded opcode-specific arguments.
+ * \param pData Data bytes to append after the arguments.
+ * \return Returned bytes of the response.
+ */
+std::vector<std::uint8_t> Remote::transact(const std::uint8_t pOpcode, const std::span<const std::uint8_t> pArgs,
+                                           const std::span<const std::uint8_t> pData) const
+{
+    const std::size_t payloadSize = 3 + remoteName.size() + pArgs.size() + pData.size();
+
+    if (payloadSize > DeviceServer::maxMessageSize)
+        throw std::runtime_error("Could not access " + getSelfDescription() + ": Request is too large.");
+
+    std::vector<std::uint8_t> request;
+    request.reserve(4 + payloadSize);
+
+    Bytes::composeBytesTo(std::back_inserter(request), false, static_cast<std::uint32_t>(payloadSize), pOpcode,
+                          static_cast<std::uint16_t>(remoteName.size()));
+    request.insert(request.end(), remoteName.begin(), remoteName.end());
+    request.insert(request.end(), pArgs.begin(), pArgs.end());
+    request.insert(request.end(), pData.begin(), pData.end());
+
+    const std::lock_guard<std::mutex> requestLock(mutex);
+    (void)requestLock;
+
+    if (!connection->socket.is_open())
+        throw std::runtime_error("Could not access " + getSelfDescription() + ": Not connected.");
+
+    //Performs a complete transfer within the timeout
+    auto transfer = [this](auto pInitiation, const std::size_t pSize) -> void
+    {
+        bool timedOut = false;
+
+        const std::size_t n = CommonImpl::ASIOHelper::runTransferWithTimedOutCancel(pInitiation, connection->socket, connection->ioContext,
+                                                                                    timeout, std::ref(timedOut));
+        if (timedOut)
+            throw std::runtime_error("Timeout.");
+        else if (n != pSize)
+            throw std::runtime_error("Incomplete transfer.");
+    };
+
+    std::vector<std::uint8_t> response;
+
+    try
+    {
+        transfer([this, &request](auto&& pToken)
+                 {
+                     return boost::asio::async_write(connection->socket, boost::asio::buffer(request), std::forward<decltype(pToken)>(pToken));
+                 },
+                 request.size());
+
+        std::array<std::uint8_t, 4> lengthBytes {};
+
+        transfer([this, &lengthBytes](auto&& pToken)
+                 {
+                     return boost::asio::async_read(connection->socket, boost::asio::buffer(lengthBytes), std::forward<decltype(pToken)>(pToken));
+                 },
+                 lengthBytes.size());
+
+        response.resize(Bytes::composeUInt32(std::span<const std::uint8_t, 4>(lengthBytes), false));
+
+        transfer([this, &response](auto&& pToken)
+                 {
+                     return boost::asio::async_read(connection->socket, boost::asio::buffer(response), std::forward<decltype(pToken)>(pToken));
+                 },
+                 response.size());
+    }
+    catch (const std::runtime_error& exc)
+    {
+        boost::system::error_code ec;
+        connection->socket.close(ec);
+
+        throw std::runtime_error("Could not access " + getSelfDescription() + ": " + exc.what());
+    }
+
+    if (response.empty())
+        throw std::runtime_error("Could not access " + getSelfDescription() + ": Invalid response.");
+
+    if (response[0] != 0)
+        throw std::runtime_error("Could not access " + getSelfDescription() + ": " + std::string(response.begin() + 1, response.end()));
+
+    response.erase(response.begin());
+
+    return response;
+}
+
+//
+
+/*!
+ * \brief Serve a FIFO access from the shared-memory ring.
+ *
+ * Takes all newly published blocks from the ring (see fetchFifoBlocks()) and then, like \ref casil::TL::SiTCP::read()
+ * "SiTCP::read()", depending on \p pAddr:
+ * - <tt>[SiTCP::baseAddrDataLimit, SiTCP::baseAddrFIFOLimit)</tt>: Removes and returns the taken FIFO data
+ *   in multiples of 4 bytes, limited by \p pSize (all data if \p pSize is negative).
+ * - <tt>SiTCP::baseAddrFIFOLimit</tt>: Returns an empty sequence.
+ * - <tt>(SiTCP::baseAddrFIFOLimit, ...)</tt>: Returns the size of the taken FIFO data as 4 byte long little endian sequence
+ *                                        if \p pSize is 4 and \p pSize zeros otherwise.
+ *
+ * \throws std::runtime_error If not initialized (see init()).
+ *
+ * \param pAddr FIFO address (at least SiTCP::baseAddrDataLimit).
+ * \param pSize Number of bytes to read.
+ * \return Read bytes.
+ */
+std::vector<std::uint8_t> Remote::readFifo(const std::uint64_t pAddr, const int pSize)
+{
+    const std::lock_guard<std::mutex> fifoLock(fifoMutex);
+    (void)fifoLock;
+
+    if (!fifoReaderPtr)
+        throw std::runtime_error("Could not read FIFO of " + getSelfDescription() + ": Not initialized.");
+
+    fetchFifoBlocks();
+
+    if (pAddr < SiTCP::baseAddrFIFOLimit)
+    {
+        std::size_t size = fifoBuffer.size();
+
+        if (pSize >= 0)
+            size = std::min(size, static_cast<std::size_t>(pSize) / 4 * 4);
+
+        std::vector<std::uint8_t> retVal(fifoBuffer.begin(), fifoBuffer.begin() + size);
+        fifoBuffer.erase(fifoBuffer.begin(), fifoBuffer.begin() + size);
+
+        return retVal;
+    }
+    else if (pAddr == SiTCP::baseAddrFIFOLimit)
+        return {};
+    else if (pSize == 4)
+        return Bytes::composeByteVec(false, static_cast<std::uint32_t>(fifoBuffer.size()));
+    else
+        return std::vector<std::uint8_t>(std::max(pSize, 0), 0);
+}
+
+/*!
+ * \brief Append all newly published blocks of the shared-memory ring to the FIFO buffer.
+ *
+ * Copies the words of each block as little endian byte sequence and drops the block again if it was overwritten during the copy.
+ * Logs a warning if blocks were lost because this client fell behind the ring's writer.
+ *
+ * Note: Requires \ref fifoMutex to be locked and \ref fifoReaderPtr to be set.
+ */
+void Remote::fetchFifoBlocks()
+{
+    std::uint64_t droppedBlocks = 0;
+
+    while (const std::optional<FifoShmReader::Block> block = fifoReaderPtr->next())
+    {
+        const std::size_t prevSize = fifoBuffer.size();
+
+        fifoBuffer.reserve(prevSize + 4 * block->words.size());
+
+        for (const std::uint32_t word : block->words)
+            Bytes::composeBytesTo(std::back_inserter(fifoBuffer), false, word);
+
+        if (!fifoReaderPtr->isValid(block->sequence))
+        {
+            fifoBuffer.resize(prevSize);
+            ++droppedBlocks;
+        }
+    }
+
+    const std::uint64_t lostBlocks = fifoReaderPtr->getLostBlocks();
+
+    if (lostBlocks != fifoLostBlocks || droppedBlocks > 0)
+    {
+        logger.logWarning("Lost " + std::to_string(lostBlocks - fifoLostBlocks + droppedBlocks) +
+                          " FIFO data blocks of shared-memory ring \"" + fifoShmName + "\".");
+        fifoLostBlocks = lostBlocks;
+    }
+}
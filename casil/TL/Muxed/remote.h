@@ -0,0 +1,112 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_REMOTE_H
+#define CASIL_LAYERS_TL_REMOTE_H
+
+#include <casil/TL/muxedinterface.h>
+
+#include <casil/fifoshmreader.h>
+#include <casil/layerconfig.h>
+#include <casil/layerfactorymacros.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/*!
+ * \brief Client for a MuxedInterface of a Device that is shared by another process via a DeviceServer.
+ *
+ * Forwards all interface accesses to the named interface of the Device served by a DeviceServer on a local socket
+ * (see Remote() for the settings). This allows to use the hardware of a long-running process (which owns the hardware
+ * connection) from other processes, with their own drivers and registers stacked on top of this interface as usual.
+ *
+ * Every access is a synchronous round trip to the server, which fails after a configurable timeout.
+ * Accesses from multiple threads are serialized.
+ *
+ * If the remote interface is a \ref casil::TL::SiTCP "SiTCP" interface that publishes its FIFO data to a shared-memory ring
+ * (see "init.fifo_shm_name" in \ref casil::TL::SiTCP::SiTCP() "SiTCP::SiTCP()"), the FIFO accesses (see \ref casil::TL::SiTCP::read()
+ * "SiTCP::read()") can be served directly from this ring instead (see Remote()), i.e. without round trips to the server.
+ */
+class Remote final : public MuxedInterface
+{
+public:
+    Remote(std::string pName, LayerConfig pConfig);         ///< Constructor.
+    ~Remote() override;                                     ///< Destructor.
+    //
+    std::vector<std::uint8_t> read(std::uint64_t pAddr, int pSize = -1) override;
+    void write(std::uint64_t pAddr, const std::vector<std::uint8_t>& pData) override;
+    std::vector<std::uint8_t> query(std::uint64_t pWriteAddr, std::uint64_t pReadAddr,
+                                    const std::vector<std::uint8_t>& pData, int pSize = -1) override;
+    //
+    bool readBufferEmpty() const override;
+    void clearReadBuffer() override;
+    //
+    std::string getServerMetrics() const;                   ///< Get the metrics of the server process.
+
+private:
+    bool initImpl() override;
+    bool closeImpl() override;
+    //
+    std::vector<std::uint8_t> transact(std::uint8_t pOpcode, std::span<const std::uint8_t> pArgs,
+                                       std::span<const std::uint8_t> pData) const;  ///< Send a request to the server and receive the response.
+    //
+    std::vector<std::uint8_t> readFifo(std::uint64_t pAddr, int pSize);            ///< Serve a FIFO access from the shared-memory ring.
+    void fetchFifoBlocks();                                 ///< Append all newly published blocks of the shared-memory ring to the FIFO buffer.
+
+private:
+    struct Connection;                                      ///< Socket connection to the server.
+    //
+    const std::string socketPath;                           ///< Path of the server's socket file.
+    const std::string remoteName;                           ///< Name of the interface on the server side.
+    const double timeoutSecs;                               ///< Configured timeout for the server requests in seconds.
+    const std::chrono::milliseconds timeout;                ///< Rounded chrono version of \ref timeoutSecs.
+    const std::string fifoShmName;                          ///< Name of the shared-memory FIFO ring (empty if FIFO accesses are forwarded).
+    //
+    const std::unique_ptr<Connection> connection;           ///< Socket connection to the server.
+    //
+    mutable std::mutex mutex;                               ///< Mutex serializing all requests.
+    //
+    std::unique_ptr<FifoShmReader> fifoReaderPtr;           ///< Reader for the shared-memory FIFO ring (null if not initialized).
+    std::vector<std::uint8_t> fifoBuffer;                   ///< FIFO data taken from the ring but not yet read (little endian words).
+    std::uint64_t fifoLostBlocks;                           ///< Number of ring blocks skipped by \ref fifoReaderPtr that were already logged.
+    std::mutex fifoMutex;                                   ///< Mutex for \ref fifoReaderPtr, \ref fifoBuffer and \ref fifoLostBlocks.
+
+    CASIL_REGISTER_INTERFACE_H("Remote")
+};
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_REMOTE_H
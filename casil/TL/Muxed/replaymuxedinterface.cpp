@@ -0,0 +1,413 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/Muxed/replaymuxedinterface.h>
+
+#include <casil/bytes.h>
+
+#include <algorithm>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+using casil::Layers::TL::ReplayMuxedInterface;
+
+CASIL_REGISTER_INTERFACE_CPP(ReplayMuxedInterface)
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Sets the session file to be played back from the required "init.session_file" value in \p pConfig (string type).
+ * The file is (re)loaded on every init(), which also restarts the replay from the beginning.
+ *
+ * Configures the replay from the following optional values in \p pConfig:
+ * - "init.time_scale": Factor for the recorded transaction durations, i.e. every transaction is delayed to take
+ *                      at least its recorded duration times this factor (floating-point value, default: 1.0;
+ *                      zero replays without any delays).
+ * - "init.strict": Let a read() / write() fail if it does not match the next recorded transaction
+ *                  (boolean type, default: true). If disabled, mismatches are only counted (see getStatistics()).
+ * - "init.loop": Restart from the beginning when all transactions have been replayed (boolean type, default: false).
+ *                If disabled, any further transaction fails.
+ *
+ * \throws std::runtime_error If "init.session_file" is empty.
+ * \throws std::runtime_error If "init.time_scale" is negative.
+ *
+ * \param pName Component instance name.
+ * \param pConfig Component configuration.
+ */
+ReplayMuxedInterface::ReplayMuxedInterface(std::string pName, LayerConfig pConfig) :
+    MuxedInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig::fromYAML("{init: {session_file: string}}")),
+    sessionFilePath(config.getStr("init.session_file")),
+    timeScale(config.getDbl("init.time_scale", 1.0)),
+    strictMatching(config.getBool("init.strict", true)),
+    loopSession(config.getBool("init.loop", false)),
+    session(),
+    position(0),
+    statistics{},
+    mutex()
+{
+    if (sessionFilePath == "")
+        throw std::runtime_error("No session file set for " + getSelfDescription() + ".");
+    if (timeScale < 0.0)
+        throw std::runtime_error("Invalid time scale set for " + getSelfDescription() + ".");
+}
+
+//Public
+
+/*!
+ * \copybrief MuxedInterface::read()
+ *
+ * Replays the next recorded transaction, which must be a read from \p pAddr with requested size \p pSize
+ * (if strict matching is enabled, see ReplayMuxedInterface()), and returns its recorded response.
+ *
+ * \throws std::runtime_error If the session is exhausted (and looping is disabled) or no session is loaded.
+ * \throws std::runtime_error If strict matching is enabled and the call does not match the recorded transaction.
+ *
+ * \param pAddr Bus address or FIFO access address.
+ * \param pSize Number of bytes to read.
+ * \return Recorded read bytes.
+ */
+std::vector<std::uint8_t> ReplayMuxedInterface::read(const std::uint64_t pAddr, const int pSize)
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    return replayTransaction(Transaction::Type::Read, pAddr, pSize, {}).data;
+}
+
+/*!
+ * \copybrief MuxedInterface::write()
+ *
+ * Replays the next recorded transaction, which must be a write of \p pData to \p pAddr
+ * (if strict matching is enabled, see ReplayMuxedInterface()).
+ *
+ * \throws std::runtime_error If the session is exhausted (and looping is disabled) or no session is loaded.
+ * \throws std::runtime_error If strict matching is enabled and the call does not match the recorded transaction.
+ *
+ * \param pAddr Bus address.
+ * \param pData %Bytes to be written.
+ */
+void ReplayMuxedInterface::write(const std::uint64_t pAddr, const std::vector<std::uint8_t>& pData)
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    (void)replayTransaction(Transaction::Type::Write, pAddr, 0, pData);
+}
+
+/*!
+ * \copybrief MuxedInterface::query()
+ *
+ * Replays a write followed by a read, see MuxedInterface::query(), write() and read().
+ *
+ * \throws std::runtime_error If write() or read() throws.
+ *
+ * \param pWriteAddr Bus address to write to.
+ * \param pReadAddr Bus address to read from.
+ * \param pData Query bytes to be written.
+ * \param pSize Number of response bytes to read.
+ * \return Recorded response bytes.
+ */
+std::vector<std::uint8_t> ReplayMuxedInterface::query(const std::uint64_t pWriteAddr, const std::uint64_t pReadAddr,
+                                                      const std::vector<std::uint8_t>& pData, const int pSize)
+{
+    return MuxedInterface::query(pWriteAddr, pReadAddr, pData, pSize);
+}
+
+//
+
+/*!
+ * \copybrief MuxedInterface::readBufferEmpty()
+ *
+ * There is no read buffer.
+ *
+ * \return True.
+ */
+bool ReplayMuxedInterface::readBufferEmpty() const
+{
+    return true;
+}
+
+/*!
+ * \copybrief MuxedInterface::clearReadBuffer()
+ *
+ * There is no read buffer, hence does nothing.
+ */
+void ReplayMuxedInterface::clearReadBuffer()
+{
+}
+
+//
+
+/*!
+ * \brief Get the number of transactions in the loaded session.
+ *
+ * \return Session length (zero before the first init()).
+ */
+std::size_t ReplayMuxedInterface::getSessionLength() const
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    return session.size();
+}
+
+/*!
+ * \brief Get the index of the next transaction to be replayed.
+ *
+ * \return Position in the session.
+ */
+std::size_t ReplayMuxedInterface::getPosition() const
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    return position;
+}
+
+/*!
+ * \brief Check if all transactions have been replayed.
+ *
+ * Note: Never true if looping is enabled (see ReplayMuxedInterface()).
+ *
+ * \return True if the (non-looping) session is exhausted.
+ */
+bool ReplayMuxedInterface::isFinished() const
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    return !loopSession && position == session.size();
+}
+
+/*!
+ * \brief Get the current replay counters.
+ *
+ * The counters are reset by init().
+ *
+ * \return Current statistics.
+ */
+ReplayMuxedInterface::Statistics ReplayMuxedInterface::getStatistics() const
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    return statistics;
+}
+
+//
+
+/*!
+ * \brief Read all transactions from a session file.
+ *
+ * See ReplayMuxedInterface for the file format.
+ *
+ * \throws std::runtime_error If the file cannot be read, is no session file, has an unsupported version or is truncated.
+ *
+ * \param pFilePath Path of the session file.
+ * \return All recorded transactions in recording order.
+ */
+std::vector<ReplayMuxedInterface::Transaction> ReplayMuxedInterface::loadSession(const std::string& pFilePath)
+{
+    std::vector<std::uint8_t> bytes;
+
+    try
+    {
+        std::ifstream file;
+        file.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+        file.open(pFilePath, std::ios_base::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    catch (const std::ios_base::failure&)
+    {
+        throw std::runtime_error("Could not read session file \"" + pFilePath + "\".");
+    }
+
+    const std::span<const std::uint8_t> data(bytes);
+
+    if (data.size() < sessionFileHeaderSize || !std::equal(sessionFileMagic.begin(), sessionFileMagic.end(), data.begin()))
+        throw std::runtime_error("Not a session file: \"" + pFilePath + "\".");
+
+    const std::uint32_t version = Bytes::composeUInt32(data.subspan(8).first<4>(), false);
+
+    if (version != sessionFileVersion)
+        throw std::runtime_error("Unsupported session file version " + std::to_string(version) + ".");
+
+    std::vector<Transaction> transactions;
+
+    for (std::size_t pos = sessionFileHeaderSize; pos < data.size();)
+    {
+        if (data.size() - pos < sessionEntryHeaderSize)
+            throw std::runtime_error("Session file \"" + pFilePath + "\" is truncated.");
+
+        const std::span<const std::uint8_t, sessionEntryHeaderSize> entryBytes = data.subspan(pos).first<sessionEntryHeaderSize>();
+
+        const std::uint8_t type = entryBytes[16];
+        const std::uint32_t dataLength = Bytes::composeUInt32(entryBytes.subspan<29, 4>(), false);
+
+        if (type > static_cast<std::uint8_t>(Transaction::Type::Write))
+            throw std::runtime_error("Invalid transaction type in session file \"" + pFilePath + "\".");
+
+        pos += sessionEntryHeaderSize;
+
+        if (data.size() - pos < dataLength)
+            throw std::runtime_error("Session file \"" + pFilePath + "\" is truncated.");
+
+        transactions.push_back({.startTime = std::chrono::nanoseconds(Bytes::composeUInt64(entryBytes.subspan<0, 8>(), false)),
+                                .duration = std::chrono::nanoseconds(Bytes::composeUInt64(entryBytes.subspan<8, 8>(), false)),
+                                .type = static_cast<Transaction::Type>(type),
+                                .addr = Bytes::composeUInt64(entryBytes.subspan<17, 8>(), false),
+                                .size = static_cast<int>(Bytes::composeUInt32(entryBytes.subspan<25, 4>(), false)),
+                                .data = std::vector<std::uint8_t>(data.begin() + pos, data.begin() + pos + dataLength)});
+
+        pos += dataLength;
+    }
+
+    return transactions;
+}
+
+//Private
+
+/*!
+ * \copybrief MuxedInterface::initImpl()
+ *
+ * (Re)loads the session file (see ReplayMuxedInterface()), restarts the replay from the beginning and resets the counters.
+ *
+ * \return True if successful.
+ */
+bool ReplayMuxedInterface::initImpl()
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    try
+    {
+        session = loadSession(sessionFilePath);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(std::string("Could not load session: ") + exc.what());
+        return false;
+    }
+
+    position = 0;
+    statistics = {};
+
+    return true;
+}
+
+/*!
+ * \copybrief MuxedInterface::closeImpl()
+ *
+ * Logs a warning if the session was not replayed completely.
+ *
+ * \return True.
+ */
+bool ReplayMuxedInterface::closeImpl()
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    if (!loopSession && position != session.size())
+        logger.logWarning("Closing before session was replayed completely (" + std::to_string(position) + " of " +
+                          std::to_string(session.size()) + " transactions).");
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Consume and check the next transaction.
+ *
+ * Takes the next recorded transaction and compares it with the requested transaction given by the arguments.
+ * A mismatch is counted and, if strict matching is enabled (see ReplayMuxedInterface()), lets the transaction fail
+ * (without consuming the recorded transaction).
+ * Otherwise the caller is delayed until the transaction has taken its (scaled) recorded duration.
+ *
+ * Note: \ref mutex must be locked.
+ *
+ * \throws std::runtime_error If the session is exhausted (and looping is disabled) or empty.
+ * \throws std::runtime_error If strict matching is enabled and the transaction does not match.
+ *
+ * \param pType Type of the requested transaction.
+ * \param pAddr Requested bus address.
+ * \param pSize Requested read size (ignored for writes).
+ * \param pData Data to be written (ignored for reads).
+ * \return The recorded transaction.
+ */
+const ReplayMuxedInterface::Transaction& ReplayMuxedInterface::replayTransaction(const Transaction::Type pType, const std::uint64_t pAddr,
+                                                                                const int pSize, const std::vector<std::uint8_t>& pData)
+{
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    if (position == session.size())
+    {
+        if (!loopSession || session.empty())
+            throw std::runtime_error("Session of " + getSelfDescription() + " is exhausted after " + std::to_string(session.size()) +
+                                     " transactions.");
+
+        position = 0;
+        ++statistics.loops;
+    }
+
+    const Transaction& transaction = session[position];
+
+    const bool matches = (transaction.type == pType && transaction.addr == pAddr &&
+                          (pType == Transaction::Type::Read ? transaction.size == pSize : transaction.data == pData));
+
+    if (!matches)
+    {
+        ++statistics.mismatches;
+
+        if (strictMatching)
+        {
+            const std::string label = (pType == Transaction::Type::Read ? "read" : "write");
+            throw std::runtime_error("Transaction " + std::to_string(position) + " (" + label + " at " + Bytes::formatHex(pAddr) +
+                                     ") of " + getSelfDescription() + " does not match the recorded session.");
+        }
+    }
+
+    ++position;
+    ++statistics.transactions;
+
+    if (timeScale > 0.0)
+    {
+        const auto endTime = startTime + std::chrono::duration_cast<std::chrono::nanoseconds>(transaction.duration * timeScale);
+        const auto now = std::chrono::steady_clock::now();
+
+        if (endTime > now)
+        {
+            std::this_thread::sleep_until(endTime);
+            statistics.replayDelay += std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - now);
+        }
+    }
+
+    return transaction;
+}
@@ -0,0 +1,170 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_REPLAYMUXEDINTERFACE_H
+#define CASIL_LAYERS_TL_REPLAYMUXEDINTERFACE_H
+
+#include <casil/TL/muxedinterface.h>
+
+#include <casil/layerconfig.h>
+#include <casil/layerfactorymacros.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+/*!
+ * \brief MuxedInterface that plays back a recorded session of bus transactions, including responses, timings and FIFO data.
+ *
+ * Allows to benchmark and optimize driver and readout code against realistic traffic without hardware and
+ * to compare different versions deterministically. A session is recorded by a real interface (see the
+ * "record_session" setting of \ref SiTCP "SiTCP" and SimMuxed) and contains every read() / write()
+ * (FIFO accesses included) with its start time, duration, address, requested size and transferred bytes.
+ *
+ * Every call of read() / write() consumes the next recorded transaction. Reads return the recorded response.
+ * Each transaction is delayed such that it takes (at least) its recorded duration, multiplied by a configurable
+ * time scale (zero disables the delays, e.g. to measure pure driver overhead). By default, the calls must exactly
+ * match the recording (type, address, requested size and written data), otherwise the transaction fails.
+ * This also detects changed access patterns of a new driver version. See ReplayMuxedInterface() for all settings.
+ *
+ * The session file consists of a 12 byte header followed by one entry per transaction until the end of the file,
+ * all values as little endian:
+ *
+ * \code{.unparsed}
+ *
+ * Header:  8 bytes magic "CASILSES" (see sessionFileMagic), 32 bit format version (see sessionFileVersion)
+ *
+ * Entry:   Byte 0-7:    Start time (nanoseconds since start of the session, 64 bit)
+ *          Byte 8-15:   Duration (nanoseconds, 64 bit)
+ *          Byte 16:     Transaction::Type (8 bit)
+ *          Byte 17-24:  Bus address (64 bit)
+ *          Byte 25-28:  Requested read size (32 bit, two's complement; -1 if unspecified; 0 for writes)
+ *          Byte 29-32:  Data length (32 bit)
+ *          Byte 33-..:  Data (read response or written data)
+ *
+ * \endcode
+ *
+ * All transactions are serialized, i.e. concurrent accesses wait for each other. Note that the order of
+ * concurrent accesses (e.g. FIFO readout and register access from different threads) is not deterministic,
+ * hence such sessions can only be replayed with matching disabled.
+ */
+class ReplayMuxedInterface final : public MuxedInterface
+{
+public:
+    /*!
+     * \brief Single recorded bus transaction.
+     */
+    struct Transaction
+    {
+        /*!
+         * \brief Transaction type.
+         */
+        enum class Type : std::uint8_t
+        {
+            Read  = 0,  ///< Read (bus or FIFO).
+            Write = 1   ///< Write (bus or FIFO).
+        };
+
+        std::chrono::nanoseconds startTime;     ///< Start time relative to the start of the session.
+        std::chrono::nanoseconds duration;      ///< Duration of the transaction.
+        Type type;                              ///< Transaction type.
+        std::uint64_t addr;                     ///< Bus address.
+        int size;                               ///< Requested number of bytes for reads (-1 if unspecified; 0 for writes).
+        std::vector<std::uint8_t> data;         ///< Read response or written data.
+    };
+
+    /*!
+     * \brief Snapshot of the replay counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t transactions;             ///< Number of replayed transactions.
+        std::uint64_t mismatches;               ///< Number of calls that did not match the recorded transaction.
+        std::uint64_t loops;                    ///< Number of completed passes through the session (if looping).
+        std::chrono::nanoseconds replayDelay;   ///< Total delay added to reproduce the recorded durations.
+    };
+
+public:
+    ReplayMuxedInterface(std::string pName, LayerConfig pConfig);   ///< Constructor.
+    ~ReplayMuxedInterface() override = default;                     ///< Default destructor.
+    //
+    std::vector<std::uint8_t> read(std::uint64_t pAddr, int pSize = -1) override;
+    void write(std::uint64_t pAddr, const std::vector<std::uint8_t>& pData) override;
+    std::vector<std::uint8_t> query(std::uint64_t pWriteAddr, std::uint64_t pReadAddr,
+                                    const std::vector<std::uint8_t>& pData, int pSize = -1) override;
+    //
+    bool readBufferEmpty() const override;
+    void clearReadBuffer() override;
+    //
+    std::size_t getSessionLength() const;                           ///< Get the number of transactions in the loaded session.
+    std::size_t getPosition() const;                                ///< Get the index of the next transaction to be replayed.
+    bool isFinished() const;                                        ///< Check if all transactions have been replayed.
+    Statistics getStatistics() const;                               ///< Get the current replay counters.
+    //
+    static std::vector<Transaction> loadSession(const std::string& pFilePath);  ///< Read all transactions from a session file.
+
+public:
+    static constexpr std::array<std::uint8_t, 8> sessionFileMagic = {'C', 'A', 'S', 'I', 'L', 'S', 'E', 'S'};
+                                                                    ///< Magic bytes at the start of a session file.
+    static constexpr std::uint32_t sessionFileVersion = 1;          ///< Session file format version.
+    static constexpr std::size_t sessionFileHeaderSize = 12;        ///< Size of the session file header in bytes.
+    static constexpr std::size_t sessionEntryHeaderSize = 33;       ///< Size of a session file entry without its data in bytes.
+
+private:
+    bool initImpl() override;
+    bool closeImpl() override;
+    //
+    const Transaction& replayTransaction(Transaction::Type pType, std::uint64_t pAddr, int pSize,
+                                         const std::vector<std::uint8_t>& pData);   ///< Consume and check the next transaction.
+
+private:
+    const std::string sessionFilePath;                  ///< Path of the session file.
+    const double timeScale;                             ///< Factor for the recorded transaction durations.
+    const bool strictMatching;                          ///< Fail on calls that do not match the recorded transaction.
+    const bool loopSession;                             ///< Restart from the beginning when the session is exhausted.
+    //
+    std::vector<Transaction> session;                   ///< The loaded session.
+    std::size_t position;                               ///< Index of the next transaction.
+    //
+    Statistics statistics;                              ///< Current replay counters.
+    //
+    mutable std::mutex mutex;                           ///< Mutex serializing all transactions.
+
+    CASIL_REGISTER_INTERFACE_H("ReplayMuxedInterface")
+};
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_REPLAYMUXEDINTERFACE_H
@@ -0,0 +1,658 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/TL/Muxed/simmuxed.h>
+
+#include <casil/bytes.h>
+#include <casil/TL/CommonImpl/sessionrecorder.h>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+using casil::Layers::TL::SimMuxed;
+
+CASIL_REGISTER_INTERFACE_CPP(SimMuxed)
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Initializes the size of the simulated address space (bus addresses <tt>[0, mem_size)</tt>) from the optional
+ * "init.mem_size" value in \p pConfig (unsigned integer type, in bytes, default: 65536). The memory is zero-initialized.
+ *
+ * Initializes the link model from the following optional values in \p pConfig:
+ * - "init.latency": Fixed delay per transaction (floating-point value in seconds, default: 0.0).
+ * - "init.jitter": Maximum of a uniformly distributed random additional delay per transaction
+ *                  (floating-point value in seconds, default: 0.0).
+ * - "init.bandwidth": Transfer rate for the transferred data bytes, which adds a size dependent delay
+ *                     (floating-point value in bytes per second, default: 0.0, i.e. unlimited).
+ * - "init.loss_rate": Probability of losing the packet of a transaction attempt (floating-point value in <tt>[0, 1)</tt>, default: 0.0).
+ * - "init.retransmit_timeout": Additional delay per lost packet (floating-point value in seconds, default: 0.01).
+ * - "init.max_retransmits": Maximum number of retransmissions per transaction, after which the transaction fails
+ *                           (integer type, default: 3).
+ * - "init.seed": Seed for the random numbers of jitter and packet loss (unsigned integer type, default: 0).
+ *
+ * Initializes the rate at which the FIFO is filled (see read()) from the optional "init.fifo_rate" value in \p pConfig
+ * (floating-point value in words per second, default: 0.0, i.e. the FIFO stays empty).
+ *
+ * Enables recording all read() / write() / writeBatch() transactions (with responses and durations) to a session file
+ * for later playback via ReplayMuxedInterface if the optional "init.record_session" string value in \p pConfig is set
+ * to the path of that file (default: empty, i.e. no recording). The file is overwritten on every init().
+ *
+ * \throws std::runtime_error If "init.mem_size" is zero.
+ * \throws std::runtime_error If "init.latency", "init.jitter", "init.bandwidth", "init.retransmit_timeout" or "init.fifo_rate" is negative.
+ * \throws std::runtime_error If "init.loss_rate" is out of range (must be in <tt>[0, 1)</tt>).
+ * \throws std::runtime_error If "init.max_retransmits" is negative.
+ *
+ * \param pName Component instance name.
+ * \param pConfig Component configuration.
+ */
+SimMuxed::SimMuxed(std::string pName, LayerConfig pConfig) :
+    MuxedInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig()),
+    memSize(config.getUInt("init.mem_size", defaultMemSize)),
+    latencySecs(config.getDbl("init.latency", 0.0)),
+    jitterSecs(config.getDbl("init.jitter", 0.0)),
+    bandwidth(config.getDbl("init.bandwidth", 0.0)),
+    lossRate(config.getDbl("init.loss_rate", 0.0)),
+    retransmitTimeoutSecs(config.getDbl("init.retransmit_timeout", 0.01)),
+    maxRetransmits(config.getInt("init.max_retransmits", 3)),
+    fifoRate(config.getDbl("init.fifo_rate", 0.0)),
+    memory(memSize, 0),
+    rng(config.getUInt("init.seed", 0)),
+    fifoStartTime(),
+    fifoStopTime(),
+    fifoWordsRead(0),
+    statistics{},
+    sessionRecorderPtr(config.getStr("init.record_session", "") != "" ?
+                           std::make_unique<CommonImpl::SessionRecorder>(config.getStr("init.record_session", "")) : nullptr),
+    mutex()
+{
+    if (memSize == 0)
+        throw std::runtime_error("Invalid memory size set for " + getSelfDescription() + ".");
+    if (latencySecs < 0.0 || jitterSecs < 0.0 || bandwidth < 0.0 || retransmitTimeoutSecs < 0.0)
+        throw std::runtime_error("Invalid link model set for " + getSelfDescription() + ".");
+    if (lossRate < 0.0 || lossRate >= 1.0)
+        throw std::runtime_error("Invalid packet loss rate set for " + getSelfDescription() + ".");
+    if (maxRetransmits < 0)
+        throw std::runtime_error("Negative number of retransmits set for " + getSelfDescription() + ".");
+    if (fifoRate < 0.0)
+        throw std::runtime_error("Invalid FIFO rate set for " + getSelfDescription() + ".");
+}
+
+/*!
+ * \brief Destructor.
+ */
+SimMuxed::~SimMuxed() = default;
+
+//Public
+
+/*!
+ * \copybrief MuxedInterface::read()
+ *
+ * Depending on \p pAddr this function behaves differently:
+ *
+ * - <tt>[0, \ref baseAddrDataLimit)</tt>: Reads \p pSize bytes from the simulated memory at address \p pAddr (see also writeBatch()
+ *   for the link model). The address range must lie within the configured memory size (see SimMuxed()).
+ * - <tt>[\ref baseAddrDataLimit, \ref baseAddrFIFOLimit)</tt>: Returns FIFO data, see getFifoData() with \p pSize as argument.
+ * - <tt>[baseAddrFIFOLimit, ...)</tt>: Returns the FIFO size (see getFifoSize()) as 4 byte long little endian sequence
+ *                                      if \p pSize is 4 and \p pSize zeros otherwise.
+ *
+ * \throws std::runtime_error For negative \p pSize, if also \p pAddr < \ref baseAddrDataLimit or \p pAddr >= \ref baseAddrFIFOLimit.
+ * \throws std::runtime_error If the address range exceeds the simulated memory.
+ * \throws std::runtime_error If the simulated transaction fails due to packet loss.
+ *
+ * \param pAddr Bus address or FIFO access address.
+ * \param pSize Number of bytes to read.
+ * \return Read bytes.
+ */
+std::vector<std::uint8_t> SimMuxed::read(const std::uint64_t pAddr, const int pSize)
+{
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    std::vector<std::uint8_t> retVal = readUnlocked(pAddr, pSize);
+
+    if (sessionRecorderPtr)
+        sessionRecorderPtr->recordRead(startTime, pAddr, pSize, retVal);
+
+    return retVal;
+}
+
+/*!
+ * \copybrief MuxedInterface::readBatch()
+ *
+ * If all operations in \p pOps are bus reads (addresses below \ref baseAddrDataLimit), reads them from the simulated memory
+ * as a single transaction with the total data size, i.e. the fixed latency, the jitter and the packet loss apply only once
+ * (see SimMuxed()). Otherwise MuxedInterface::readBatch() is used (i.e. read() for every operation).
+ *
+ * \throws std::runtime_error For negative sizes.
+ * \throws std::runtime_error If an address range exceeds the simulated memory.
+ * \throws std::runtime_error If the simulated transaction fails due to packet loss.
+ * \throws std::runtime_error If MuxedInterface::readBatch() throws \c std::runtime_error.
+ *
+ * \param pOps Read operations to perform.
+ * \return Read bytes of every operation (in the order of \p pOps).
+ */
+std::vector<std::vector<std::uint8_t>> SimMuxed::readBatch(const std::span<const ReadOp> pOps)
+{
+    if (!std::all_of(pOps.begin(), pOps.end(), [](const ReadOp& pOp) -> bool { return pOp.addr < baseAddrDataLimit; }))
+        return MuxedInterface::readBatch(pOps);
+
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    std::size_t totalSize = 0;
+
+    for (const ReadOp& op : pOps)
+    {
+        if (op.size < 0)
+            throw std::runtime_error("Cannot read unspecified number of bytes from " + getSelfDescription() + ".");
+
+        checkBusRange(op.addr, static_cast<std::size_t>(op.size));
+
+        totalSize += static_cast<std::size_t>(op.size);
+    }
+
+    simulateTransaction(totalSize);
+
+    statistics.bytesRead += totalSize;
+
+    std::vector<std::vector<std::uint8_t>> retVal;
+    retVal.reserve(pOps.size());
+
+    for (const ReadOp& op : pOps)
+    {
+        retVal.emplace_back(memory.begin() + op.addr, memory.begin() + op.addr + op.size);
+
+        if (sessionRecorderPtr)
+            sessionRecorderPtr->recordRead(startTime, op.addr, op.size, retVal.back());
+    }
+
+    return retVal;
+}
+
+/*!
+ * \copybrief MuxedInterface::readInto()
+ *
+ * For normal bus addresses (below \ref baseAddrDataLimit) reads as many bytes as fit into \p pBuffer from the simulated memory
+ * directly into \p pBuffer (as single transaction like read()), without allocating memory.
+ * For all other addresses MuxedInterface::readInto() is used.
+ *
+ * \throws std::runtime_error If the address range exceeds the simulated memory.
+ * \throws std::runtime_error If the simulated transaction fails due to packet loss.
+ * \throws std::runtime_error If MuxedInterface::readInto() throws \c std::runtime_error.
+ *
+ * \param pAddr Bus address or FIFO access address.
+ * \param pBuffer Buffer for the read bytes.
+ * \return Number of bytes written to \p pBuffer.
+ */
+std::size_t SimMuxed::readInto(const std::uint64_t pAddr, const std::span<std::uint8_t> pBuffer)
+{
+    if (pAddr >= baseAddrDataLimit)
+        return MuxedInterface::readInto(pAddr, pBuffer);
+
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    checkBusRange(pAddr, pBuffer.size());
+    simulateTransaction(pBuffer.size());
+
+    statistics.bytesRead += pBuffer.size();
+
+    std::copy(memory.begin() + pAddr, memory.begin() + pAddr + pBuffer.size(), pBuffer.begin());
+
+    if (sessionRecorderPtr)
+        sessionRecorderPtr->recordRead(startTime, pAddr, static_cast<int>(pBuffer.size()), pBuffer);
+
+    return pBuffer.size();
+}
+
+/*!
+ * \copybrief MuxedInterface::write()
+ *
+ * Writes \p pData to the simulated memory at address \p pAddr (see also writeBatch() for the link model).
+ *
+ * See writeFrom().
+ *
+ * \throws std::runtime_error If writeFrom() throws.
+ *
+ * \param pAddr Bus address.
+ * \param pData %Bytes to be written.
+ */
+void SimMuxed::write(const std::uint64_t pAddr, const std::vector<std::uint8_t>& pData)
+{
+    writeFrom(pAddr, pData);
+}
+
+/*!
+ * \copybrief MuxedInterface::writeFrom()
+ *
+ * Writes \p pData to the simulated memory at address \p pAddr as a single transaction (see also writeBatch() for the link model),
+ * without allocating memory.
+ *
+ * \throws std::runtime_error If \p pAddr is not a normal bus address (FIFO writes are not supported).
+ * \throws std::runtime_error If the address range exceeds the simulated memory.
+ * \throws std::runtime_error If the simulated transaction fails due to packet loss.
+ *
+ * \param pAddr Bus address.
+ * \param pData %Bytes to be written.
+ */
+void SimMuxed::writeFrom(const std::uint64_t pAddr, const std::span<const std::uint8_t> pData)
+{
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    if (pAddr >= baseAddrDataLimit)
+        throw std::runtime_error("Writing to the FIFO is not supported by " + getSelfDescription() + ".");
+
+    checkBusRange(pAddr, pData.size());
+
+    simulateTransaction(pData.size());
+
+    std::copy(pData.begin(), pData.end(), memory.begin() + pAddr);
+
+    statistics.bytesWritten += pData.size();
+
+    if (sessionRecorderPtr)
+        sessionRecorderPtr->recordWrite(startTime, pAddr, pData);
+}
+
+/*!
+ * \copybrief MuxedInterface::writeBatch()
+ *
+ * Writes the data of all operations in \p pOps to the simulated memory, in order.
+ *
+ * The whole batch is simulated as a single transaction with the total data size, i.e. the fixed latency,
+ * the jitter and the packet loss apply only once (see SimMuxed()). Nothing is written if the transaction fails.
+ *
+ * \throws std::runtime_error If an address is not a normal bus address (FIFO writes are not supported).
+ * \throws std::runtime_error If an address range exceeds the simulated memory.
+ * \throws std::runtime_error If the simulated transaction fails due to packet loss.
+ *
+ * \param pOps Write operations to perform.
+ */
+void SimMuxed::writeBatch(const std::span<const WriteOp> pOps)
+{
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    std::size_t totalSize = 0;
+
+    for (const WriteOp& op : pOps)
+    {
+        if (op.addr >= baseAddrDataLimit)
+            throw std::runtime_error("Writing to the FIFO is not supported by " + getSelfDescription() + ".");
+
+        checkBusRange(op.addr, op.data.size());
+
+        totalSize += op.data.size();
+    }
+
+    simulateTransaction(totalSize);
+
+    for (const WriteOp& op : pOps)
+        std::copy(op.data.begin(), op.data.end(), memory.begin() + op.addr);
+
+    statistics.bytesWritten += totalSize;
+
+    if (sessionRecorderPtr)
+    {
+        for (const WriteOp& op : pOps)
+            sessionRecorderPtr->recordWrite(startTime, op.addr, op.data);
+    }
+}
+
+/*!
+ * \copybrief MuxedInterface::query()
+ *
+ * Writes \p pData to \p pWriteAddr and then reads \p pSize bytes from \p pReadAddr, as two transactions (see write() and read()).
+ *
+ * \throws std::runtime_error If write() or read() throws.
+ *
+ * \param pWriteAddr Bus address to write to.
+ * \param pReadAddr Bus address to read from.
+ * \param pData Query bytes to be written.
+ * \param pSize Number of response bytes to read.
+ * \return Read response bytes.
+ */
+std::vector<std::uint8_t> SimMuxed::query(const std::uint64_t pWriteAddr, const std::uint64_t pReadAddr,
+                                          const std::vector<std::uint8_t>& pData, const int pSize)
+{
+    write(pWriteAddr, pData);
+    return read(pReadAddr, pSize);
+}
+
+//
+
+/*!
+ * \copybrief MuxedInterface::readBufferEmpty()
+ *
+ * There is no read buffer.
+ *
+ * \return True.
+ */
+bool SimMuxed::readBufferEmpty() const
+{
+    return true;
+}
+
+/*!
+ * \copybrief MuxedInterface::clearReadBuffer()
+ *
+ * There is no read buffer, hence does nothing.
+ */
+void SimMuxed::clearReadBuffer()
+{
+}
+
+//
+
+/*!
+ * \brief Get the FIFO size in number of bytes.
+ *
+ * \return Number of generated but not yet read FIFO bytes.
+ */
+std::size_t SimMuxed::getFifoSize() const
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    return getFifoWordsAvailable() * 4;
+}
+
+/*!
+ * \brief Extract the current FIFO content as sequence of bytes.
+ *
+ * Removes and returns the generated FIFO words (running 32 bit counter) as little endian byte sequence,
+ * limited to <tt>pSize / 4</tt> words if \p pSize is not negative.
+ *
+ * \param pSize Number of FIFO bytes to get (automatically reduced by modulo 4) or -1 for all.
+ * \return Byte sequence from the FIFO in multiples of 4 bytes.
+ */
+std::vector<std::uint8_t> SimMuxed::getFifoData(const int pSize)
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    return extractFifoData(pSize);
+}
+
+//
+
+/*!
+ * \brief Get the current simulation counters.
+ *
+ * \return Current statistics.
+ */
+SimMuxed::Statistics SimMuxed::getStatistics() const
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    return statistics;
+}
+
+//Private
+
+/*!
+ * \copybrief MuxedInterface::initImpl()
+ *
+ * Empties the FIFO and (re)starts the FIFO data generation with a counter value of zero.
+ * Starts a new session file if recording is enabled (see SimMuxed()).
+ *
+ * \return True if successful.
+ */
+bool SimMuxed::initImpl()
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    if (sessionRecorderPtr)
+    {
+        try
+        {
+            sessionRecorderPtr->open();
+        }
+        catch (const std::runtime_error& exc)
+        {
+            logger.logError(std::string("Could not start session recording: ") + exc.what());
+            return false;
+        }
+    }
+
+    fifoStartTime = std::chrono::steady_clock::now();
+    fifoStopTime = std::chrono::steady_clock::time_point::max();
+    fifoWordsRead = 0;
+
+    return true;
+}
+
+/*!
+ * \copybrief MuxedInterface::closeImpl()
+ *
+ * Stops the FIFO data generation. Closes the session file if recording is enabled (see SimMuxed()).
+ *
+ * \return True if successful.
+ */
+bool SimMuxed::closeImpl()
+{
+    const std::lock_guard<std::mutex> transactionLock(mutex);
+    (void)transactionLock;
+
+    fifoStopTime = std::chrono::steady_clock::now();
+
+    if (sessionRecorderPtr)
+    {
+        if (sessionRecorderPtr->hasFailed())
+            logger.logError("Session recording stopped early because writing the session file failed.");
+
+        try
+        {
+            sessionRecorderPtr->close();
+        }
+        catch (const std::runtime_error& exc)
+        {
+            logger.logError(std::string("Could not finish session recording: ") + exc.what());
+            return false;
+        }
+
+        return !sessionRecorderPtr->hasFailed();
+    }
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Delay the caller according to the link model.
+ *
+ * Sleeps for the fixed latency plus a random jitter plus the transfer time of \p pNumBytes plus
+ * the retransmission timeout for every randomly lost packet (see SimMuxed()).
+ *
+ * \throws std::runtime_error If more packets are lost than retransmissions are allowed.
+ *
+ * \param pNumBytes Number of transferred data bytes.
+ */
+void SimMuxed::simulateTransaction(const std::size_t pNumBytes)
+{
+    double delaySecs = latencySecs;
+
+    if (jitterSecs > 0.0)
+        delaySecs += std::uniform_real_distribution<double>(0.0, jitterSecs)(rng);
+
+    if (bandwidth > 0.0)
+        delaySecs += static_cast<double>(pNumBytes) / bandwidth;
+
+    bool failed = false;
+
+    if (lossRate > 0.0)
+    {
+        std::bernoulli_distribution lossDistribution(lossRate);
+
+        for (int i = 0; lossDistribution(rng); ++i)
+        {
+            ++statistics.packetsLost;
+            delaySecs += retransmitTimeoutSecs;
+
+            if (i == maxRetransmits)
+            {
+                failed = true;
+                break;
+            }
+        }
+    }
+
+    const auto delay = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(delaySecs));
+
+    if (delay > std::chrono::nanoseconds::zero())
+        std::this_thread::sleep_for(delay);
+
+    statistics.simulatedDelay += delay;
+
+    if (failed)
+        throw std::runtime_error("Simulated transaction of " + getSelfDescription() + " failed after " +
+                                 std::to_string(maxRetransmits) + " retransmits.");
+
+    ++statistics.transactions;
+}
+
+/*!
+ * \brief Check that an address range lies within the memory.
+ *
+ * \throws std::runtime_error If the range exceeds the simulated memory.
+ *
+ * \param pAddr Start address.
+ * \param pSize Number of bytes.
+ */
+void SimMuxed::checkBusRange(const std::uint64_t pAddr, const std::size_t pSize) const
+{
+    if (pAddr > memSize || pSize > memSize - pAddr)
+        throw std::runtime_error("Address range [" + Bytes::formatHex(pAddr) + ", " + Bytes::formatHex(pAddr + pSize) + ") " +
+                                 "exceeds simulated memory of " + getSelfDescription() + ".");
+}
+
+/*!
+ * \brief Get the number of generated but not yet read FIFO words.
+ *
+ * \return Number of words generated at the configured rate between the last init() and now (or close()), minus the read words.
+ */
+std::uint64_t SimMuxed::getFifoWordsAvailable() const
+{
+    if (fifoRate == 0.0 || fifoStartTime == std::chrono::steady_clock::time_point())
+        return 0;
+
+    const std::chrono::steady_clock::time_point endTime = std::min(std::chrono::steady_clock::now(), fifoStopTime);
+    const double elapsedSecs = std::chrono::duration<double>(endTime - fifoStartTime).count();
+
+    return static_cast<std::uint64_t>(fifoRate * elapsedSecs) - fifoWordsRead;
+}
+
+/*!
+ * \brief Extract generated FIFO words as sequence of bytes.
+ *
+ * See getFifoData().
+ *
+ * Note: \ref mutex must be locked.
+ *
+ * \param pSize Number of FIFO bytes to get (automatically reduced by modulo 4) or -1 for all.
+ * \return Byte sequence from the FIFO in multiples of 4 bytes.
+ */
+std::vector<std::uint8_t> SimMuxed::extractFifoData(const int pSize)
+{
+    std::uint64_t numWords = getFifoWordsAvailable();
+
+    if (pSize >= 0)
+        numWords = std::min(numWords, static_cast<std::uint64_t>(pSize / 4));
+
+    std::vector<std::uint32_t> words(numWords);
+
+    for (std::uint64_t i = 0; i < numWords; ++i)
+        words[i] = static_cast<std::uint32_t>(fifoWordsRead + i);
+
+    std::vector<std::uint8_t> retVal(numWords * 4);
+    Bytes::encodeUInt32LE(words, retVal);
+
+    fifoWordsRead += numWords;
+    statistics.fifoBytesRead += retVal.size();
+
+    return retVal;
+}
+
+/*!
+ * \brief Read without locking the mutex.
+ *
+ * See read().
+ *
+ * Note: \ref mutex must be locked.
+ *
+ * \throws std::runtime_error See read().
+ *
+ * \param pAddr Bus address or FIFO access address.
+ * \param pSize Number of bytes to read.
+ * \return Read bytes.
+ */
+std::vector<std::uint8_t> SimMuxed::readUnlocked(const std::uint64_t pAddr, const int pSize)
+{
+    if (pAddr >= baseAddrDataLimit && pAddr < baseAddrFIFOLimit)
+        return extractFifoData(pSize);
+
+    if (pSize < 0)
+        throw std::runtime_error("Cannot read unspecified number of bytes from " + getSelfDescription() + ".");
+
+    if (pAddr >= baseAddrFIFOLimit)
+    {
+        if (pSize != 4)
+            return std::vector<std::uint8_t>(pSize, 0);
+
+        const std::array<std::uint32_t, 1> fifoSize = {static_cast<std::uint32_t>(getFifoWordsAvailable() * 4)};
+
+        std::vector<std::uint8_t> retVal(4);
+        Bytes::encodeUInt32LE(fifoSize, retVal);
+
+        return retVal;
+    }
+
+    const std::size_t size = static_cast<std::size_t>(pSize);
+
+    checkBusRange(pAddr, size);
+    simulateTransaction(size);
+
+    statistics.bytesRead += size;
+
+    return std::vector<std::uint8_t>(memory.begin() + pAddr, memory.begin() + pAddr + size);
+}
@@ -0,0 +1,152 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_LAYERS_TL_SIMMUXED_H
+#define CASIL_LAYERS_TL_SIMMUXED_H
+
+#include <casil/TL/muxedinterface.h>
+
+#include <casil/layerconfig.h>
+#include <casil/layerfactorymacros.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+namespace CommonImpl { class SessionRecorder; }
+
+/*!
+ * \brief Simulated MuxedInterface with memory-backed address space, generated FIFO data and a configurable link model.
+ *
+ * Allows to benchmark drivers and readout code without hardware. Bus reads and writes access a plain memory
+ * block (see SimMuxed() for all settings). Every bus transaction is delayed according to a simple link model,
+ * which consists of a fixed latency, a uniformly distributed random jitter, a transfer time given by a bandwidth
+ * and a packet loss probability (a lost packet costs a retransmission timeout; too many consecutive losses
+ * let the transaction fail). The random numbers are generated from a fixed seed, so runs are reproducible.
+ * writeBatch() and readBatch() are simulated as a single transaction with the total data size, like a pipelined/streamed link.
+ *
+ * Like for \ref SiTCP "SiTCP", addresses starting from \ref baseAddrDataLimit give access to a FIFO (see read()),
+ * which is filled at a configurable rate with a running 32 bit counter (starting from zero on every init()).
+ * FIFO access is not delayed by the link model, since the data is already buffered on the host side for a real link.
+ *
+ * All transactions are serialized, i.e. concurrent accesses wait for each other, as on a real bus.
+ *
+ * The transactions can be recorded to a session file for later playback via ReplayMuxedInterface (see SimMuxed()).
+ */
+class SimMuxed final : public MuxedInterface
+{
+public:
+    /*!
+     * \brief Snapshot of the simulation counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t transactions;     ///< Number of completed bus transactions.
+        std::uint64_t bytesRead;        ///< Number of bytes read from the bus.
+        std::uint64_t bytesWritten;     ///< Number of bytes written to the bus.
+        std::uint64_t packetsLost;      ///< Number of simulated lost packets (retransmissions).
+        std::uint64_t fifoBytesRead;    ///< Number of bytes read from the FIFO.
+        std::chrono::nanoseconds simulatedDelay;    ///< Total simulated link delay.
+    };
+
+public:
+    SimMuxed(std::string pName, LayerConfig pConfig);       ///< Constructor.
+    ~SimMuxed() override;                                   ///< Destructor.
+    //
+    std::vector<std::uint8_t> read(std::uint64_t pAddr, int pSize = -1) override;
+    std::vector<std::vector<std::uint8_t>> readBatch(std::span<const ReadOp> pOps) override;
+    std::size_t readInto(std::uint64_t pAddr, std::span<std::uint8_t> pBuffer) override;
+    void write(std::uint64_t pAddr, const std::vector<std::uint8_t>& pData) override;
+    void writeFrom(std::uint64_t pAddr, std::span<const std::uint8_t> pData) override;
+    void writeBatch(std::span<const WriteOp> pOps) override;
+    std::vector<std::uint8_t> query(std::uint64_t pWriteAddr, std::uint64_t pReadAddr,
+                                    const std::vector<std::uint8_t>& pData, int pSize = -1) override;
+    //
+    bool readBufferEmpty() const override;
+    void clearReadBuffer() override;
+    //
+    std::size_t getFifoSize() const;                        ///< Get the FIFO size in number of bytes.
+    std::vector<std::uint8_t> getFifoData(int pSize = -1);  ///< Extract the current FIFO content as sequence of bytes.
+    //
+    Statistics getStatistics() const;                       ///< Get the current simulation counters.
+
+private:
+    bool initImpl() override;
+    bool closeImpl() override;
+    //
+    void simulateTransaction(std::size_t pNumBytes);        ///< Delay the caller according to the link model.
+    void checkBusRange(std::uint64_t pAddr, std::size_t pSize) const;  ///< Check that an address range lies within the memory.
+    std::uint64_t getFifoWordsAvailable() const;            ///< Get the number of generated but not yet read FIFO words.
+    std::vector<std::uint8_t> extractFifoData(int pSize);   ///< Extract generated FIFO words as sequence of bytes.
+    std::vector<std::uint8_t> readUnlocked(std::uint64_t pAddr, int pSize);     ///< Read without locking the mutex.
+
+private:
+    const std::size_t memSize;                          ///< Size of the simulated address space in bytes.
+    const double latencySecs;                           ///< Fixed delay per transaction in seconds.
+    const double jitterSecs;                            ///< Maximum random additional delay per transaction in seconds.
+    const double bandwidth;                             ///< Transfer rate in bytes per second (zero means unlimited).
+    const double lossRate;                              ///< Probability of a lost packet.
+    const double retransmitTimeoutSecs;                 ///< Additional delay per lost packet in seconds.
+    const int maxRetransmits;                           ///< Maximum number of retransmissions per transaction.
+    const double fifoRate;                              ///< FIFO fill rate in words per second (zero means no data).
+    //
+    std::vector<std::uint8_t> memory;                   ///< The simulated address space.
+    std::mt19937_64 rng;                                ///< Random number generator for the link model.
+    //
+    std::chrono::steady_clock::time_point fifoStartTime;    ///< Start time of the FIFO data generation (see initImpl()).
+    std::chrono::steady_clock::time_point fifoStopTime;     ///< Stop time of the FIFO data generation (see closeImpl()).
+    std::uint64_t fifoWordsRead;                        ///< Number of FIFO words read since the last init().
+    //
+    Statistics statistics;                              ///< Current simulation counters.
+    //
+    const std::unique_ptr<CommonImpl::SessionRecorder> sessionRecorderPtr;  ///< Session recorder (if "record_session" set).
+    //
+    mutable std::mutex mutex;                           ///< Mutex serializing all transactions.
+
+public:
+    static constexpr std::uint64_t baseAddrDataLimit = 0x100000000; ///< Address limit below which read() / write() do normal bus access.
+    static constexpr std::uint64_t baseAddrFIFOLimit = 0x200000000; ///< Address limit for special FIFO access of read() (see there).
+
+private:
+    static constexpr std::uint64_t defaultMemSize = 65536;          ///< Default size of the simulated address space in bytes.
+
+    CASIL_REGISTER_INTERFACE_H("SimMuxed")
+};
+
+} // namespace Layers::TL
+
+} // namespace casil
+
+#endif // CASIL_LAYERS_TL_SIMMUXED_H
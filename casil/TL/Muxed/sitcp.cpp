@@ -59,20 +59,35 @@
 
 #include <casil/TL/Muxed/sitcp.h>
 
+#include <casil/asio.h>
 #include <casil/bytes.h>
+#include <casil/TL/CommonImpl/eventlistener.h>
+#include <casil/TL/CommonImpl/fifofilewriter.h>
+#include <casil/TL/CommonImpl/fiforingbuffer.h>
+#include <casil/TL/CommonImpl/fifoshmwriter.h>
+#include <casil/TL/CommonImpl/rbcpdispatcher.h>
+#include <casil/TL/CommonImpl/sessionrecorder.h>
 #include <casil/TL/CommonImpl/tcpsocketwrapper.h>
 #include <casil/TL/CommonImpl/udpsocketwrapper.h>
+#include <casil/timing.h>
+#include <casil/tracer.h>
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <bitset>
 #include <chrono>
+#include <deque>
+#include <functional>
 #include <iterator>
+#include <limits>
 #include <span>
 #include <stdexcept>
-#include <system_error>
 #include <utility>
 
 using casil::Layers::TL::SiTCP;
+using casil::Layers::TL::SiTCPFifoSubscription;
+using casil::Logger;
 
 CASIL_REGISTER_INTERFACE_CPP(SiTCP)
 CASIL_REGISTER_INTERFACE_ALIAS("SiTcp")
@@ -97,11 +112,150 @@ CASIL_REGISTER_INTERFACE_ALIAS("SiTcp")
  * Initializes the timeout for establishing a %TCP/%UDP connection (see init()) from the optional "init.connect_timeout" value
  * in \p pConfig (floating-point value in seconds, default: 5.0).
  *
+ * Initializes the initial capacity of the FIFO buffer from the optional "init.fifo_capacity" value in \p pConfig
+ * (unsigned integer type, in bytes, default: 4194304). The value is rounded up to a multiple of 4 bytes
+ * and to a power of two number of words. The buffer grows automatically if it runs full.
+ *
+ * Enables the lock-free FIFO mode depending on the optional "init.fifo_lock_free" value in \p pConfig (boolean type, default: false).
+ * In this mode the FIFO buffer works as lock-free single-producer/single-consumer queue with fixed capacity ("init.fifo_capacity"),
+ * such that the FIFO reading never has to wait for a consumer calling getFifoSize() or getFifoData(). If the FIFO
+ * runs full, the FIFO reading stops reading from the %TCP socket until there is free space again (instead of growing the buffer).
+ *
+ * Limits the FIFO size (i.e. the growth of the FIFO buffer) to the optional "init.fifo_max_size" value in \p pConfig
+ * (unsigned integer type, in bytes, default: 0, i.e. no limit). Note that the allocated buffer capacity is a power of two
+ * number of words and can hence exceed the limit by up to a factor of two. The initial capacity ("init.fifo_capacity")
+ * is reduced to the limit if necessary. The handling of received data that does not fit below the limit is set by the
+ * optional "init.fifo_overflow_policy" string in \p pConfig (default: "block"):
+ * - "block": Stop reading from the %TCP socket until there is enough free space again, i.e. apply %TCP back-pressure
+ *            to the FPGA (same as in lock-free FIFO mode). No data is lost on the host side.
+ * - "drop_oldest": Drop as many of the oldest buffered words as needed to make room for the new data.
+ *                  The dropped bytes are counted (see Statistics::fifoBytesDropped).
+ * - "spill": Move the buffered data to a memory-mapped file set by the "init.fifo_spill_file" string in \p pConfig and
+ *            continue buffering there (see isFifoSpilled()), which allows long data bursts far beyond the available memory
+ *            without back-pressure. The file is created with a fixed capacity given by the optional "init.fifo_spill_size"
+ *            value in \p pConfig (unsigned integer type, in bytes, default: 17179869184), which replaces "init.fifo_max_size"
+ *            as FIFO size limit from then on. Beyond that the "block" policy applies. The FIFO buffer stays in the file
+ *            until destruction, when the file is removed again. If the file cannot be created or mapped, an error
+ *            is logged and the "block" policy applies instead.
+ *
+ * See also getFifoFillLevel(), which allows to throttle the data taking before the limit is reached.
+ *
+ * Uses a memory-mapped file as storage for the FIFO buffer instead of heap memory if the optional "init.fifo_mmap_file"
+ * string in \p pConfig is set (default: empty). The file is created (or truncated) with the size of the FIFO buffer
+ * capacity and removed again on destruction. This allows for FIFO buffers far larger than the available memory
+ * (e.g. for long data bursts), since the operating system can page out the buffered data to the file (ideally on
+ * a fast local disk) and read it back on demand. The capacity ("init.fifo_capacity") is fixed in this mode and
+ * the FIFO reading stops reading from the %TCP socket while the FIFO is full (as in lock-free FIFO mode).
+ * In place access to the FIFO data (see consumeFifo() and consumeFifoChunks()) directly passes views of the mapped file.
+ * Can be combined with the lock-free FIFO mode.
+ *
+ * Places the heap-allocated FIFO buffer and the block buffer of the FIFO dump (see below) on huge pages and/or a specific
+ * NUMA node according to the optional values "init.fifo_huge_pages" (boolean type, default: false), "init.fifo_numa_node"
+ * (integer type, default: -1, i.e. no binding) and "init.fifo_numa_device" (string, default: empty; name of the network
+ * interface whose NUMA node to use, e.g. the one connected to the FPGA) in \p pConfig (see MemoryPlacement::fromConfig()).
+ * This reduces TLB misses and cross-socket memory traffic for large buffers at high data rates on multi-socket hosts.
+ *
+ * Initializes the number of RBCP requests to keep in flight for bus reads/writes larger than the maximum RBCP data length
+ * (see doPipelinedRBCPOperations()) from the optional "init.rbcp_window" value in \p pConfig (integer type, default: 1).
+ * The default of 1 means that every request waits for its response before the next request is sent.
+ *
+ * Enables the extended RBCP mode for firmware variants supporting it depending on the optional "init.rbcp_extended_size"
+ * value in \p pConfig (unsigned integer type, in bytes, default: 0, i.e. disabled). In this mode all RBCP messages use
+ * the extended header with a 16 bit data length field (see SiTCP) and bus reads/writes are split into chunks of up to
+ * this many bytes (instead of 255) per datagram, which requires far fewer round trips for larger bus accesses (in particular
+ * on networks supporting jumbo frames; larger datagrams get fragmented otherwise). The firmware must support this mode.
+ *
+ * Initializes the maximum number of bytes per single %TCP socket read for the FIFO data from the optional
+ * "init.tcp_read_buffer_size" value in \p pConfig (unsigned integer type, default: 262144).
+ *
+ * Enables writing the FIFO data directly to files instead of the FIFO buffer if the optional "init.fifo_dump_file" string
+ * in \p pConfig is set (default: empty). In this mode the received data words are collected in blocks and appended
+ * as timestamped chunks to a sequence of binary files named "FIFO_DUMP_FILE.NNNN" (see CommonImpl::FIFOFileWriter for
+ * the file format), such that the FIFO data never needs to be fetched via getFifoData() (the FIFO buffer stays empty).
+ * The block size (i.e. maximum chunk data length) is set by the optional "init.fifo_dump_block_size" value in \p pConfig
+ * (unsigned integer type, in bytes, default: 4194304). A new file is started when a file would exceed the size set by the
+ * optional "init.fifo_dump_max_file_size" value in \p pConfig (unsigned integer type, in bytes, default: 1073741824;
+ * zero means no limit) and on every init(). The files are written unbuffered with block-aligned writes. Data that
+ * is still buffered is written to the file on resetFifo() and close().
+ *
+ * Enables publishing the FIFO data to a named shared-memory ring instead of the FIFO buffer if the optional "init.fifo_shm_name"
+ * string in \p pConfig is set (default: empty). In this mode the received data words are copied directly into the fixed-size
+ * slots of the ring (see CommonImpl::FIFOShmWriter), from where any number of other processes on the same host can read
+ * the blocks concurrently and without further copies (see FifoShmReader), while the FIFO buffer stays empty. The slot capacity
+ * (i.e. maximum block length) is set by the optional "init.fifo_shm_slot_size" value in \p pConfig (unsigned integer type,
+ * in bytes, default: 1048576) and the number of slots by the optional "init.fifo_shm_slots" value in \p pConfig (unsigned
+ * integer type, default: 64). The ring is (re)created on every init() and removed on close(). The oldest block is
+ * overwritten without waiting for readers.
+ *
+ * Enables recording all read() / readInto() / write() / writeBatch() transactions (bus and FIFO access, with responses and
+ * durations) to a session file for later playback via ReplayMuxedInterface if the optional "init.record_session" string
+ * in \p pConfig is set to the path of that file (default: empty). The file is overwritten on every init(). Note that
+ * direct FIFO access via getFifoData(), consumeFifo() and consumeFifoChunks() (as used by HL::SiTCPFifo) is not recorded.
+ *
+ * Initializes the timeout for sending RBCP requests and receiving RBCP responses from the optional "init.rbcp_timeout"
+ * value in \p pConfig (floating-point value in seconds, default: 1.0) and the number of retry attempts after a timeout
+ * from the optional "init.rbcp_retransmits" value in \p pConfig (integer type, default: 3).
+ *
+ * Enables the adaptive RBCP response timeout depending on the optional "init.rbcp_adaptive_timeout" value in \p pConfig
+ * (boolean type, default: false). In this mode the response timeout is derived from a running estimation of the
+ * round-trip time of the RBCP transactions, as for the retransmission timeout of %TCP (see getRBCPResponseTimeout()).
+ * The timeout is then limited to the range given by "init.rbcp_timeout" and the optional "init.rbcp_min_timeout"
+ * value in \p pConfig (floating-point value in seconds, default: 0.01).
+ *
+ * Configures the socket tuning options (applied after connecting, see init()) from the optional values "init.recv_buffer_size"
+ * and "init.send_buffer_size" (unsigned integer type, in bytes, default: 0, i.e. system default), "init.tcp_no_delay"
+ * (boolean type, default: false; disables Nagle's algorithm for the %TCP connection) and "init.busy_poll"
+ * (unsigned integer type, in microseconds, default: 0, i.e. disabled; Linux only, may require CAP_NET_ADMIN) in \p pConfig.
+ *
+ * Configures automatic reconnecting after a lost %TCP connection (see tryReconnectTcp()) from the optional values
+ * "init.reconnect_attempts" (integer type, default: 0, i.e. disabled), "init.reconnect_backoff" and
+ * "init.reconnect_max_backoff" (floating point type, in seconds, default: 0.01 / 1.0; the delay between
+ * failed attempts is doubled each time up to this maximum) and "init.reconnect_standby" (boolean type,
+ * default: false; keeps a second %TCP connection established in advance to replace a lost connection) in \p pConfig.
+ *
+ * Enables receiving event notifications from the firmware modules (see MuxedInterface::subscribeEvents() and
+ * MuxedInterface::waitForEvent()) if the optional "init.event_port" value in \p pConfig (integer type, default: 0,
+ * i.e. disabled) is set to a local network port. The firmware then sends a %UDP datagram to this port for each event,
+ * containing the bus address of the notifying module (4 bytes, big-endian) followed by an optional payload.
+ * Only datagrams sent by the host "init.ip" are accepted.
+ *
+ * Pins the interface (i.e. both sockets) to one of the IO contexts of the IO context pool (see ASIO::setIOContextPoolSize()) according to the
+ * optional "init.io_context" value in \p pConfig (integer type, default: -1, i.e. round-robin; see ASIO::getIOContext(int)).
+ * Requests a number of dedicated threads for this IO context (see ASIO::requestDedicatedThreads()) for the lifetime of
+ * the interface according to the optional "init.io_threads" value in \p pConfig (unsigned integer type, default: 0).
+ *
+ * Registers the FIFO fill level and the link statistics (see getStatistics()) as callback metrics (see Metrics),
+ * such as "casil_fifo_size_bytes", "casil_rbcp_retries" and the histogram "casil_rbcp_latency_seconds".
+ *
  * \throws std::runtime_error If "init.ip" is empty.
  * \throws std::runtime_error If "init.udp_port" is out of range (must be in <tt>(0, 65535]</tt>).
  * \throws std::runtime_error If %TCP connection is enabled and "init.tcp_port" is out of range (must be in <tt>(0, 65535]</tt>).
  * \throws std::runtime_error If "init.tcp_to_bus" is enabled but %TCP connection is disabled.
+ * \throws std::runtime_error If "init.event_port" is out of range (must be in <tt>[0, 65535]</tt>).
  * \throws std::runtime_error For negative connect timeouts.
+ * \throws std::runtime_error If "init.fifo_capacity" is zero.
+ * \throws std::runtime_error If "init.tcp_read_buffer_size" is zero.
+ * \throws std::runtime_error If "init.fifo_max_size" is non-zero and smaller than "init.tcp_read_buffer_size" plus 4.
+ * \throws std::runtime_error If "init.fifo_max_size" is non-zero and lock-free FIFO mode is enabled.
+ * \throws std::runtime_error If "init.fifo_overflow_policy" is neither "block" nor "drop_oldest" nor "spill".
+ * \throws std::runtime_error If "init.fifo_overflow_policy" is "spill" and "init.fifo_max_size" is zero,
+ *                            "init.fifo_spill_file" is empty or "init.fifo_spill_size" is not larger than "init.fifo_max_size".
+ * \throws std::runtime_error If "init.fifo_overflow_policy" is "spill" and "init.fifo_mmap_file" is set.
+ * \throws std::runtime_error If "init.fifo_mmap_file" cannot be created or mapped.
+ * \throws std::runtime_error If both "init.fifo_mmap_file" and "init.fifo_dump_file" are set.
+ * \throws std::runtime_error If "init.fifo_dump_file" is set but %TCP connection is disabled.
+ * \throws std::runtime_error If "init.fifo_dump_file" is set and "init.fifo_dump_block_size" is smaller than 4.
+ * \throws std::runtime_error If "init.fifo_shm_name" is set but %TCP connection is disabled.
+ * \throws std::runtime_error If "init.fifo_shm_name" is set together with "init.fifo_dump_file" or "init.fifo_mmap_file".
+ * \throws std::runtime_error If "init.fifo_shm_name" is set and "init.fifo_shm_slot_size" is smaller than 4
+ *                            or "init.fifo_shm_slots" is smaller than 2.
+ * \throws std::runtime_error If "init.rbcp_window" is out of range (must be in <tt>[1, 128]</tt>).
+ * \throws std::runtime_error If "init.rbcp_extended_size" exceeds the maximum extended RBCP data length of 65497.
+ * \throws std::runtime_error If "init.rbcp_timeout" or "init.rbcp_min_timeout" is not positive.
+ * \throws std::runtime_error If "init.rbcp_min_timeout" exceeds "init.rbcp_timeout".
+ * \throws std::runtime_error For negative "init.rbcp_retransmits".
+ * \throws std::runtime_error If "init.reconnect_attempts", "init.reconnect_backoff" or "init.reconnect_max_backoff" is negative.
+ * \throws std::runtime_error If "init.io_context" exceeds the IO context pool size.
  *
  * \param pName Component instance name.
  * \param pConfig Component configuration.
@@ -113,19 +267,102 @@ SiTCP::SiTCP(std::string pName, LayerConfig pConfig) :
     hostName(config.getStr("init.ip", "")),
     udpPort(config.getInt("init.udp_port", 0)),
     tcpPort(config.getInt("init.tcp_port", 0)),
+    eventPort(config.getInt("init.event_port", 0)),
     useTcp(config.getBool("init.tcp_connection", false)),
     useTcpToBus(config.getBool("init.tcp_to_bus", false)),
     connectTimeoutSecs(config.getDbl("init.connect_timeout", 5.0)),
     connectTimeout(Auxil::getChronoMilliSecs(connectTimeoutSecs)),
-    udpSocketWrapperPtr(std::make_unique<CommonImpl::UDPSocketWrapper>(hostName, udpPort)),
-    tcpSocketWrapperPtr(useTcp ? std::make_unique<CommonImpl::TCPSocketWrapper>(hostName, tcpPort, "", "") : nullptr),
-    fifoThread(),
-    fifoBuffer(),
+    ioContext(ASIO::getIOContext(config.getInt("init.io_context", -1))),
+    numDedicatedIOThreads(static_cast<unsigned int>(config.getUInt("init.io_threads", 0))),
+    udpSocketWrapperPtr(std::make_unique<CommonImpl::UDPSocketWrapper>(hostName, udpPort, ioContext, CommonImpl::SocketOptions::fromConfig(config))),
+    tcpSocketWrapperPtr(useTcp ? std::make_unique<CommonImpl::TCPSocketWrapper>(hostName, tcpPort, "", "", ioContext,
+                                                                               CommonImpl::SocketOptions::fromConfig(config),
+                                                                               CommonImpl::ReconnectPolicy::fromConfig(config)) : nullptr),
+    eventListenerPtr(eventPort > 0 ? std::make_unique<CommonImpl::EventListener>(hostName, eventPort, ioContext) : nullptr),
+    fifoCapacity(config.getUInt("init.fifo_capacity", defaultFIFOCapacity)),
+    useLockFreeFifo(config.getBool("init.fifo_lock_free", false)),
+    fifoMmapFilePath(config.getStr("init.fifo_mmap_file", "")),
+    fifoMaxSize(config.getUInt("init.fifo_max_size", 0)),
+    fifoOverflowPolicy(config.getStr("init.fifo_overflow_policy", "block")),
+    fifoDropOldest(fifoOverflowPolicy == "drop_oldest"),
+    fifoSpill(fifoOverflowPolicy == "spill"),
+    fifoSpillFilePath(config.getStr("init.fifo_spill_file", "")),
+    fifoSpillSize(config.getUInt("init.fifo_spill_size", defaultFIFOSpillSize)),
+    fifoSpillFailed(false),
+    fifoPlacement(MemoryPlacement::fromConfig(config, "init.fifo_")),
+    fifoBufferPtr(std::make_unique<CommonImpl::FIFORingBuffer>(((fifoMaxSize > 0 ? std::min(fifoCapacity, fifoMaxSize) : fifoCapacity) + 3) / 4,
+                                                               useLockFreeFifo, fifoMmapFilePath, fifoPlacement)),
+    tcpReadBufferSize(config.getUInt("init.tcp_read_buffer_size", defaultTCPReadBufferSize)),
+    fifoDumpFilePath(config.getStr("init.fifo_dump_file", "")),
+    fifoDumpBlockSize(config.getUInt("init.fifo_dump_block_size", defaultFIFODumpBlockSize)),
+    fifoDumpMaxFileSize(config.getUInt("init.fifo_dump_max_file_size", defaultFIFODumpMaxFileSize)),
+    fifoFileWriterPtr((fifoDumpFilePath != "" && fifoDumpBlockSize >= 4) ?
+                          std::make_unique<CommonImpl::FIFOFileWriter>(fifoDumpFilePath, fifoDumpBlockSize, fifoDumpMaxFileSize,
+                                                                       fifoPlacement) : nullptr),
+    fifoDumpFailed(false),
+    fifoShmName(config.getStr("init.fifo_shm_name", "")),
+    fifoShmSlotSize(config.getUInt("init.fifo_shm_slot_size", defaultFIFOShmSlotSize)),
+    fifoShmNumSlots(config.getUInt("init.fifo_shm_slots", defaultFIFOShmNumSlots)),
+    fifoShmWriterPtr((fifoShmName != "" && fifoShmSlotSize >= 4 && fifoShmSlotSize <= 0xFFFFFFFFu && fifoShmNumSlots >= 2) ?
+                         std::make_unique<CommonImpl::FIFOShmWriter>(fifoShmName, fifoShmSlotSize, fifoShmNumSlots) : nullptr),
+    fifoShmFailed(false),
+    sessionRecorderPtr(config.getStr("init.record_session", "") != "" ?
+                           std::make_unique<CommonImpl::SessionRecorder>(config.getStr("init.record_session", "")) : nullptr),
     fifoMutex(),
+    fifoChunks(),
+    nextFifoChunkSeqNum(0),
+    fifoChunksMutex(),
+    fifoSubscriptions(),
+    numFifoSubscriptions(0),
+    fifoSubscriptionsMutex(),
+    fifoStreamOffset(0),
+    fifoDataNotifier(),
+    fifoDataNotifierMutex(),
     tcpSocketMutex(),
-    wantLockTCPSocket(ATOMIC_FLAG_INIT),
     pollFIFO(false),
-    rbcpId(0)
+    rbcpMutex(),
+    tcpWriteMutex(),
+    rbcpWindowSize(config.getInt("init.rbcp_window", 1)),
+    rbcpExtendedSize(config.getUInt("init.rbcp_extended_size", 0)),
+    rbcpChunkSize(rbcpExtendedSize > 0 ? std::min<std::uint64_t>(rbcpExtendedSize, rbcpExtMaxSize) : rbcpMaxSize),
+    rbcpMsgHeaderSize(rbcpExtendedSize > 0 ? rbcpExtHeaderSize : rbcpHeaderSize),
+    rbcpId(0),
+    rbcpRequestBuffer(),
+    rbcpResponseBuffer(rbcpMsgHeaderSize + rbcpChunkSize + 1, 0),
+    rbcpDispatcherPtr(std::make_unique<CommonImpl::RBCPDispatcher>(
+                          *udpSocketWrapperPtr, rbcpMsgHeaderSize + rbcpChunkSize + 1,
+                          [this](const std::span<const std::uint8_t> pDatagram, const bool pLate) -> void
+                          {
+                              if (pLate)
+                              {
+                                  ++statistics.rbcpLateResponses;
+                                  logger.logRateLimited(Logger::LogLevel::Debug, "Discarded late RBCP response. RBCP message ID: {}.",
+                                                        pDatagram[2]);
+                              }
+                              else
+                              {
+                                  ++statistics.rbcpWrongIdResponses;
+
+                                  if (pDatagram.size() >= 3)
+                                  {
+                                      logger.logRateLimited(Logger::LogLevel::Warning,
+                                                            "Found unexpected datagram on UDP socket. RBCP message ID: {} (received).",
+                                                            pDatagram[2]);
+                                  }
+                                  else
+                                      logger.logRateLimited(Logger::LogLevel::Warning, "Found unexpected datagram on UDP socket.");
+                              }
+                          })),
+    udpTimeoutSecs(config.getDbl("init.rbcp_timeout", 1.0)),
+    udpTimeout(Auxil::getChronoMilliSecs(udpTimeoutSecs)),
+    udpRetransmitCnt(config.getInt("init.rbcp_retransmits", 3)),
+    useAdaptiveRBCPTimeout(config.getBool("init.rbcp_adaptive_timeout", false)),
+    rbcpMinTimeoutSecs(config.getDbl("init.rbcp_min_timeout", 0.01)),
+    rbcpMinTimeout(Auxil::getChronoMilliSecs(rbcpMinTimeoutSecs)),
+    rbcpSRTT(std::nullopt),
+    rbcpRTTVar(0),
+    statistics(),
+    metricsCallbacks()
 {
     if (hostName == "")
         throw std::runtime_error("No address/hostname set for " + getSelfDescription() + ".");
@@ -135,19 +372,113 @@ SiTCP::SiTCP(std::string pName, LayerConfig pConfig) :
         throw std::runtime_error("Invalid TCP port number set for " + getSelfDescription() + ".");
     if (useTcpToBus && !useTcp)
         throw std::runtime_error("Contradictory TCP settings for " + getSelfDescription() + ".");
+    if (eventPort < 0 || eventPort > 65535)
+        throw std::runtime_error("Invalid event notification port number set for " + getSelfDescription() + ".");
     if (connectTimeoutSecs < 0.0)
         throw std::runtime_error("Negative connect timeout set for " + getSelfDescription() + ".");
+    if (fifoCapacity == 0)
+        throw std::runtime_error("Invalid FIFO capacity set for " + getSelfDescription() + ".");
+    if (tcpReadBufferSize == 0)
+        throw std::runtime_error("Invalid TCP read buffer size set for " + getSelfDescription() + ".");
+    if (fifoMaxSize > 0 && fifoMaxSize < tcpReadBufferSize + 4)
+        throw std::runtime_error("Invalid FIFO size limit set for " + getSelfDescription() + ".");
+    if (fifoMaxSize > 0 && useLockFreeFifo)
+        throw std::runtime_error("Contradictory FIFO size limit and lock-free FIFO settings for " + getSelfDescription() + ".");
+    if (fifoOverflowPolicy != "block" && fifoOverflowPolicy != "drop_oldest" && fifoOverflowPolicy != "spill")
+        throw std::runtime_error("Invalid FIFO overflow policy set for " + getSelfDescription() + ".");
+    if (fifoSpill && (fifoMaxSize == 0 || fifoSpillFilePath == "" || fifoSpillSize <= fifoMaxSize))
+        throw std::runtime_error("Invalid FIFO spill settings for " + getSelfDescription() + ".");
+    if (fifoSpill && fifoMmapFilePath != "")
+        throw std::runtime_error("Contradictory FIFO spill and memory-mapped FIFO settings for " + getSelfDescription() + ".");
+    if (fifoDumpFilePath != "" && !useTcp)
+        throw std::runtime_error("Contradictory FIFO file dump and TCP settings for " + getSelfDescription() + ".");
+    if (fifoDumpFilePath != "" && fifoDumpBlockSize < 4)
+        throw std::runtime_error("Invalid FIFO file dump block size set for " + getSelfDescription() + ".");
+    if (fifoDumpFilePath != "" && fifoMmapFilePath != "")
+        throw std::runtime_error("Contradictory FIFO file dump and memory-mapped FIFO settings for " + getSelfDescription() + ".");
+    if (fifoShmName != "" && !useTcp)
+        throw std::runtime_error("Contradictory shared-memory FIFO ring and TCP settings for " + getSelfDescription() + ".");
+    if (fifoShmName != "" && (fifoDumpFilePath != "" || fifoMmapFilePath != ""))
+        throw std::runtime_error("Contradictory shared-memory FIFO ring and FIFO file settings for " + getSelfDescription() + ".");
+    if (fifoShmName != "" && !fifoShmWriterPtr)
+        throw std::runtime_error("Invalid shared-memory FIFO ring size set for " + getSelfDescription() + ".");
+    if (rbcpWindowSize < 1 || rbcpWindowSize > 128)
+        throw std::runtime_error("Invalid RBCP window size set for " + getSelfDescription() + ".");
+    if (rbcpExtendedSize > rbcpExtMaxSize)
+        throw std::runtime_error("Invalid extended RBCP data length set for " + getSelfDescription() + ".");
+    if (udpTimeout <= std::chrono::milliseconds::zero() || rbcpMinTimeout <= std::chrono::milliseconds::zero())
+        throw std::runtime_error("Invalid RBCP timeout set for " + getSelfDescription() + ".");
+    if (rbcpMinTimeout > udpTimeout)
+        throw std::runtime_error("Contradictory RBCP timeout settings for " + getSelfDescription() + ".");
+    if (udpRetransmitCnt < 0)
+        throw std::runtime_error("Negative number of RBCP retransmits set for " + getSelfDescription() + ".");
+
+    rbcpRequestBuffer.reserve(rbcpMsgHeaderSize + rbcpChunkSize);
+
+    //Expose FIFO fill level and link statistics as callback metrics (no cost until exposition)
+
+    auto addMetric = [this](const std::string& pMetricName, const std::string& pHelp, const Metrics::Type pType,
+                            std::function<double()> pCallback) -> void
+    {
+        metricsCallbacks.push_back(Metrics::addCallback(pMetricName, pHelp, pType, metricsLabels, std::move(pCallback)));
+    };
+
+    addMetric("casil_fifo_size_bytes", "Current FIFO fill level in bytes.", Metrics::Type::Gauge,
+              [this]() -> double { return static_cast<double>(getFifoSize()); });
+    addMetric("casil_fifo_high_water_mark_bytes", "Maximum FIFO fill level reached so far in bytes.", Metrics::Type::Gauge,
+              [this]() -> double { return static_cast<double>(getFifoHighWaterMark()); });
+    addMetric("casil_fifo_received_bytes", "Number of bytes received and added to the FIFO.", Metrics::Type::Counter,
+              [this]() -> double { return static_cast<double>(statistics.fifoBytesReceived.load()); });
+    addMetric("casil_fifo_overflows", "Number of times received data did not fit below the FIFO size limit.", Metrics::Type::Counter,
+              [this]() -> double { return static_cast<double>(statistics.fifoOverflows.load()); });
+    addMetric("casil_fifo_dropped_bytes", "Number of buffered FIFO bytes dropped to make room for newer data.", Metrics::Type::Counter,
+              [this]() -> double { return static_cast<double>(statistics.fifoBytesDropped.load()); });
+    addMetric("casil_rbcp_transactions", "Number of successfully completed RBCP transactions.", Metrics::Type::Counter,
+              [this]() -> double { return static_cast<double>(statistics.rbcpTransactions.load()); });
+    addMetric("casil_rbcp_retries", "Number of RBCP request retransmissions and response read retries.", Metrics::Type::Counter,
+              [this]() -> double { return static_cast<double>(statistics.rbcpRetries.load()); });
+    addMetric("casil_rbcp_wrong_id_responses", "Number of received RBCP messages with wrong ID.", Metrics::Type::Counter,
+              [this]() -> double { return static_cast<double>(statistics.rbcpWrongIdResponses.load()); });
+    addMetric("casil_rbcp_late_responses", "Number of late RBCP responses to already retransmitted or completed requests.",
+              Metrics::Type::Counter, [this]() -> double { return static_cast<double>(statistics.rbcpLateResponses.load()); });
+
+    //Latency histogram bins (see Statistics) have upper bounds of 2^(i+1) us
+    std::vector<double> latencyUpperBounds;
+
+    for (std::size_t i = 0; i + 1 < rbcpLatencyHistogramBins; ++i)
+        latencyUpperBounds.push_back(static_cast<double>(std::uint64_t{2} << i) * 1e-6);
+
+    metricsCallbacks.push_back(Metrics::addHistogramCallback("casil_rbcp_latency_seconds", "Latencies of completed RBCP transactions.",
+                                                             latencyUpperBounds, metricsLabels,
+                                                             [this]() -> Metrics::HistogramSnapshot
+                                                             {
+                                                                 Metrics::HistogramSnapshot snapshot {};
+
+                                                                 for (const std::atomic_uint64_t& binCount : statistics.rbcpLatencyHistogram)
+                                                                     snapshot.bucketCounts.push_back(binCount.load());
+
+                                                                 snapshot.sum = static_cast<double>(statistics.rbcpLatencySumMicroSecs.load()) * 1e-6;
+
+                                                                 return snapshot;
+                                                             }));
+
+    if (numDedicatedIOThreads > 0)
+        ASIO::requestDedicatedThreads(ioContext, numDedicatedIOThreads);
 }
 
 /*!
  * \brief Destructor.
  *
  * Calls close() if still initialized (i.e. init() called but close() not called yet or failed).
+ * Releases the dedicated IO context threads (see SiTCP()).
  */
 SiTCP::~SiTCP()
 {
-    if (initialized)    //Not closed yet; need to stop FIFO thread
+    if (initialized)    //Not closed yet; need to stop FIFO reading
         close(true);
+
+    if (numDedicatedIOThreads > 0)
+        ASIO::releaseDedicatedThreads(ioContext, numDedicatedIOThreads);
 }
 
 //Public
@@ -171,6 +502,19 @@ SiTCP::~SiTCP()
  */
 std::vector<std::uint8_t> SiTCP::read(const std::uint64_t pAddr, const int pSize)
 {
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, pAddr, static_cast<std::uint32_t>(std::max(pSize, 0)));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    //Records the returned data to the session file (if enabled)
+    auto recorded = [this, startTime, pAddr, pSize](std::vector<std::uint8_t> pData) -> std::vector<std::uint8_t>
+    {
+        if (sessionRecorderPtr)
+            sessionRecorderPtr->recordRead(startTime, pAddr, pSize, pData);
+        return pData;
+    };
+
     if (pAddr < baseAddrDataLimit)
     {
         if (pSize < 0)
@@ -178,38 +522,32 @@ std::vector<std::uint8_t> SiTCP::read(const std::uint64_t pAddr, const int pSize
 
         try
         {
-            if (pSize <= rbcpMaxSize)
-                return readSingle(pAddr, pSize);
-            else
-            {
-                std::vector<std::uint8_t> retVal;
+            //Read the chunks directly into the already sized return value
+            std::vector<std::uint8_t> retVal(pSize);
 
-                std::uint32_t currentAddr = pAddr;
-
-                for (int i = 0; i < pSize/rbcpMaxSize; ++i)
-                {
-                    Bytes::appendToByteVec(retVal, readSingle(currentAddr, rbcpMaxSize));
+            readBus(static_cast<std::uint32_t>(pAddr), retVal);
 
-                    currentAddr += rbcpMaxSize;
-                }
-                if (pSize % rbcpMaxSize > 0)
-                    Bytes::appendToByteVec(retVal, readSingle(currentAddr, pSize % rbcpMaxSize));
+            countRead(retVal.size());
 
-                return retVal;
-            }
+            return recorded(std::move(retVal));
         }
         catch (const std::runtime_error& exc)
         {
-            throw std::runtime_error("Could not read from SiTCP socket \"" + name + "\". Call to readSingle() failed: " + exc.what());
+            countError();
+            throw std::runtime_error("Could not read from SiTCP socket \"" + name + "\". RBCP read operation failed: " + exc.what());
         }
     }
     else if (pAddr < baseAddrFIFOLimit)
     {
-        return getFifoData(pSize);
+        std::vector<std::uint8_t> retVal = getFifoData(pSize);
+
+        countRead(retVal.size());
+
+        return recorded(std::move(retVal));
     }
     else if (pAddr == baseAddrFIFOLimit)
     {
-        return {};
+        return recorded({});
         //TODO What is actually going on here?:
         //Python: return array('B', chr(sram_fifo_version))
         //This probably fakes reading VERSION register of sram_fifo module at base_addr 0x200000000, not sure about purpose of chr() though...
@@ -222,27 +560,230 @@ std::vector<std::uint8_t> SiTCP::read(const std::uint64_t pAddr, const int pSize
     else    //TODO Basil comment: "this is to fake a HL fifo. Is there better way? Definitely..."
     {
         if (pSize == 4)
-            return Bytes::composeByteVec(false, static_cast<std::uint32_t>(getFifoSize()));
+            return recorded(Bytes::composeByteVec(false, static_cast<std::uint32_t>(getFifoSize())));
         else
         {
-            return std::vector<std::uint8_t>(pSize, '\0');  //TODO Basil comment: "FIXME: workaround for SRAM module registers"
+            return recorded(std::vector<std::uint8_t>(pSize, '\0'));  //TODO Basil comment: "FIXME: workaround for SRAM module registers"
             //TODO this was commented out in basil (???): #logger.warning("SiTcp:read - Invalid address %s" % hex(addr))
         }
     }
 }
 
+/*!
+ * \copybrief MuxedInterface::readBatch()
+ *
+ * If all operations in \p pOps are bus reads (addresses below \ref baseAddrDataLimit, non-negative sizes) and
+ * RBCP pipelining is enabled ("init.rbcp_window" larger than 1), the RBCP requests of \e all operations
+ * (split into chunks as for read()) are sent as one pipelined sequence, i.e. with up to \ref rbcpWindowSize requests
+ * in flight at the same time (see doPipelinedRBCPOperations()). This way reading many small, scattered
+ * registers costs about one round-trip time per window instead of one per register.
+ *
+ * Otherwise MuxedInterface::readBatch() is used (i.e. read() for every operation).
+ *
+ * Note that the order in which the bus accesses are performed is not guaranteed in the pipelined case.
+ *
+ * \throws std::runtime_error If the RBCP read fails (invalid/wrong/non-matching RBCP response, timeout, failed %UDP socket access).
+ * \throws std::runtime_error If MuxedInterface::readBatch() throws \c std::runtime_error.
+ *
+ * \copydetails MuxedInterface::readBatch()
+ */
+std::vector<std::vector<std::uint8_t>> SiTCP::readBatch(const std::span<const ReadOp> pOps)
+{
+    const bool allBusReads = std::all_of(pOps.begin(), pOps.end(),
+                                         [](const ReadOp& pOp) -> bool { return pOp.addr < baseAddrDataLimit && pOp.size >= 0; });
+
+    if (rbcpWindowSize <= 1 || pOps.size() < 2 || !allBusReads)
+        return MuxedInterface::readBatch(pOps);
+
+    std::size_t totalSize = 0;
+    std::size_t numChunks = 0;
+
+    for (const ReadOp& op : pOps)
+    {
+        totalSize += static_cast<std::size_t>(op.size);
+        numChunks += (static_cast<std::size_t>(op.size) + rbcpChunkSize - 1) / rbcpChunkSize;
+    }
+
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, pOps.front().addr, static_cast<std::uint32_t>(totalSize));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    std::vector<std::vector<std::uint8_t>> retVal(pOps.size());
+
+    std::vector<RBCPTransaction> transactions(numChunks);
+
+    std::size_t transactionIdx = 0;
+
+    for (std::size_t i = 0; i < pOps.size(); ++i)
+    {
+        retVal[i].resize(static_cast<std::size_t>(pOps[i].size));
+
+        for (std::size_t offset = 0; offset < retVal[i].size(); offset += rbcpChunkSize, ++transactionIdx)
+        {
+            const std::uint32_t chunkAddr = static_cast<std::uint32_t>(pOps[i].addr) + static_cast<std::uint32_t>(offset);
+            const std::size_t chunkSize = std::min(rbcpChunkSize, retVal[i].size() - offset);
+
+            transactions[transactionIdx].request.reserve(rbcpMsgHeaderSize);
+            composeRBCPHeader(transactions[transactionIdx].request, true, chunkAddr, chunkSize);
+            transactions[transactionIdx].readData = std::span<std::uint8_t>(retVal[i]).subspan(offset, chunkSize);
+        }
+    }
+
+    try
+    {
+        runPipelinedRBCPTransactions(transactions);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        countError();
+        throw std::runtime_error("Could not read from SiTCP socket \"" + name + "\". RBCP batch read operation failed: " + exc.what());
+    }
+
+    countRead(totalSize);
+
+    if (sessionRecorderPtr)
+        for (std::size_t i = 0; i < pOps.size(); ++i)
+            sessionRecorderPtr->recordRead(startTime, pOps[i].addr, pOps[i].size, retVal[i]);
+
+    return retVal;
+}
+
+/*!
+ * \copybrief MuxedInterface::readInto()
+ *
+ * Works like read() with \p pSize being the size of \p pBuffer. For normal bus addresses (<tt>[0, \ref baseAddrDataLimit)</tt>)
+ * the RBCP responses are copied directly into \p pBuffer. For the FIFO address range
+ * (<tt>[\ref baseAddrDataLimit, \ref baseAddrFIFOLimit)</tt>) the FIFO data is extracted directly into \p pBuffer
+ * without allocating memory (the number of bytes is limited by the current FIFO size and reduced by modulo 4 as for getFifoData()).
+ * For all other addresses MuxedInterface::readInto() is used.
+ *
+ * \throws std::runtime_error If the size of \p pBuffer exceeds the range of \c int.
+ * \throws std::runtime_error If the RBCP read fails (invalid/wrong/non-matching RBCP response, timeout, failed %UDP socket access).
+ * \throws std::runtime_error If MuxedInterface::readInto() throws \c std::runtime_error.
+ *
+ * \copydetails MuxedInterface::readInto()
+ */
+std::size_t SiTCP::readInto(const std::uint64_t pAddr, const std::span<std::uint8_t> pBuffer)
+{
+    if (pAddr < baseAddrDataLimit)
+    {
+        if (std::cmp_greater(pBuffer.size(), std::numeric_limits<int>::max()))
+            throw std::runtime_error("Could not read from SiTCP socket \"" + name + "\": Buffer size is out of range.");
+
+        const Tracer::Scope trace(traceSource, Tracer::Event::Read, pAddr, static_cast<std::uint32_t>(pBuffer.size()));
+        const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+        const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        try
+        {
+            readBus(static_cast<std::uint32_t>(pAddr), pBuffer);
+        }
+        catch (const std::runtime_error& exc)
+        {
+            countError();
+            throw std::runtime_error("Could not read from SiTCP socket \"" + name + "\". RBCP read operation failed: " + exc.what());
+        }
+
+        countRead(pBuffer.size());
+
+        if (sessionRecorderPtr)
+            sessionRecorderPtr->recordRead(startTime, pAddr, static_cast<int>(pBuffer.size()), pBuffer);
+
+        return pBuffer.size();
+    }
+    else if (pAddr < baseAddrFIFOLimit)
+    {
+        const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        (void)tryReconnectTcp();
+
+        std::size_t readBytes = 0;
+
+        {
+            const std::lock_guard<std::mutex> bufferLock(fifoMutex);
+            (void)bufferLock;
+
+            readBytes = fifoBufferPtr->popBytesInto(pBuffer);
+        }
+
+        countRead(readBytes);
+
+        if (sessionRecorderPtr)
+            sessionRecorderPtr->recordRead(startTime, pAddr, static_cast<int>(std::min<std::size_t>(pBuffer.size(), std::numeric_limits<int>::max())),
+                                           pBuffer.first(readBytes));
+
+        return readBytes;
+    }
+    else
+        return MuxedInterface::readInto(pAddr, pBuffer);
+}
+
+/*!
+ * \copybrief MuxedInterface::tryReadInto()
+ *
+ * For normal bus addresses (<tt>[0, \ref baseAddrDataLimit)</tt>) and non-empty buffers of at most \ref rbcpChunkSize bytes
+ * this works like readInto() but performs the single RBCP read via tryDoSingleRBCPOperation(), i.e. RBCP timeouts
+ * and invalid/wrong responses are returned as Error (codes Error::Code::Timeout and Error::Code::Protocol)
+ * without throwing any exception. Failed %UDP socket accesses are reported with code Error::Code::Failure.
+ * For all other cases MuxedInterface::tryReadInto() is used.
+ *
+ * \copydetails MuxedInterface::tryReadInto()
+ */
+casil::Expected<std::size_t> SiTCP::tryReadInto(const std::uint64_t pAddr, const std::span<std::uint8_t> pBuffer)
+{
+    if (pAddr >= baseAddrDataLimit || pBuffer.empty() || pBuffer.size() > rbcpChunkSize)
+        return MuxedInterface::tryReadInto(pAddr, pBuffer);
+
+    const Tracer::Scope trace(traceSource, Tracer::Event::Read, pAddr, static_cast<std::uint32_t>(pBuffer.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Read);
+
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    Expected<void> result;
+
+    try
+    {
+        result = tryDoSingleRBCPOperation(static_cast<std::uint32_t>(pAddr), pBuffer);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        result = Error(Error::Code::Failure, [message = std::string(exc.what())]() { return message; });
+    }
+
+    if (!result)
+    {
+        countError();
+
+        return Error(result.error().getCode(), [tName = name, tError = result.error()]() -> std::string
+                     {
+                         return "Could not read from SiTCP socket \"" + tName + "\". RBCP read operation failed: " + tError.getMessage();
+                     });
+    }
+
+    countRead(pBuffer.size());
+
+    if (sessionRecorderPtr)
+        sessionRecorderPtr->recordRead(startTime, pAddr, static_cast<int>(pBuffer.size()), pBuffer);
+
+    return pBuffer.size();
+}
+
 /*!
  * \copybrief MuxedInterface::write()
  *
  * What this function does depends on the value of \p pAddr:
  * - <tt>[0, \ref baseAddrDataLimit)</tt>: Writes \p pData to the basil bus at \p pAddr (uses RBCP messages over %UDP,
- *                                         or a "tcp_to_bus" message over %TCP if "tcp_to_bus" is enabled).
+ *                                         or "tcp_to_bus" messages over %TCP if "tcp_to_bus" is enabled).
+ *                                         In the latter case, data longer than \ref tcpToBusMaxSize is split into
+ *                                         consecutive messages of maximum length (with according bus addresses),
+ *                                         which are written to the %TCP socket at once as a single buffer sequence
+ *                                         (scatter/gather, i.e. without copying the data).
  * - <tt>[\ref baseAddrDataLimit, \ref baseAddrFIFOLimit)</tt>: Writes raw \p pData to the %TCP socket (e.g. writing
  *                                                              \p pData to the %SiTCP FIFO if "tcp_to_bus" is \e not enabled).
  * - <tt>baseAddrFIFOLimit</tt>: Calls resetFifo().
  *
- * \throws std::runtime_error If "tcp_to_bus" enabled and \p pData exceeds the maximum data length for %TCP bus writes (\c 0xFFF9u ),
- *                            if also \p pAddr < \ref baseAddrDataLimit.
  * \throws std::runtime_error If \p pAddr exceeds \ref baseAddrFIFOLimit.
  * \throws std::runtime_error If writing to or clearing the FIFO but %TCP connection not enabled.
  * \throws std::runtime_error If the RBCP write fails (invalid/wrong/non-matching RBCP response, timeout, failed %UDP socket access)
@@ -253,73 +794,117 @@ std::vector<std::uint8_t> SiTCP::read(const std::uint64_t pAddr, const int pSize
  */
 void SiTCP::write(const std::uint64_t pAddr, const std::vector<std::uint8_t>& pData)
 {
+    writeFrom(pAddr, pData);
+}
+
+/*!
+ * \copybrief MuxedInterface::writeFrom()
+ *
+ * Works exactly like write() but without copying \p pData (normal RBCP bus writes do not allocate memory).
+ *
+ * \throws std::runtime_error If \p pAddr exceeds \ref baseAddrFIFOLimit.
+ * \throws std::runtime_error If writing to or clearing the FIFO but %TCP connection not enabled.
+ * \throws std::runtime_error If the RBCP write fails (invalid/wrong/non-matching RBCP response, timeout, failed %UDP socket access)
+ *                            or if writing to the %TCP socket fails.
+ * \throws std::runtime_error If resetting the FIFO fails.
+ *
+ * \copydetails MuxedInterface::writeFrom()
+ */
+void SiTCP::writeFrom(const std::uint64_t pAddr, const std::span<const std::uint8_t> pData)
+{
+    const Tracer::Scope trace(traceSource, Tracer::Event::Write, pAddr, static_cast<std::uint32_t>(pData.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Write);
+
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    //Records the written data to the session file (if enabled)
+    auto record = [this, startTime, pAddr, &pData]() -> void
+    {
+        if (sessionRecorderPtr)
+            sessionRecorderPtr->recordWrite(startTime, pAddr, pData);
+    };
+
     if (pAddr < baseAddrDataLimit)
     {
         if (useTcp && useTcpToBus)
         {
-            if (pData.size() > 0xFFF9u)
-                throw std::runtime_error("Could not write to SiTCP socket \"" + name + "\": Data length exceeds maximum RBCP data length.");
+            //Split into messages of maximum length (at least one message, also for empty data)
+            const std::size_t numMessages = std::max<std::size_t>((pData.size() + tcpToBusMaxSize - 1) / tcpToBusMaxSize, 1);
+
+            std::vector<std::array<std::uint8_t, 6>> headers(numMessages);     //"tcp_to_bus" message headers
+            std::vector<std::span<const std::uint8_t>> buffers;                 //Buffer sequence of all headers and data
 
-            std::vector<std::uint8_t> sendData;
+            buffers.reserve(2 * numMessages);
 
-            sendData.reserve(pData.size() + 6);
+            for (std::size_t i = 0; i < numMessages; ++i)
+            {
+                const std::size_t offset = i * tcpToBusMaxSize;
+                const std::size_t msgSize = std::min<std::size_t>(pData.size() - offset, tcpToBusMaxSize);
 
-            Bytes::appendToByteVec(sendData,
-                                   Bytes::composeByteVec(false, static_cast<std::uint16_t>(pData.size()), static_cast<std::uint32_t>(pAddr)));
+                headers[i] = Bytes::composeByteArray(false, static_cast<std::uint16_t>(msgSize), static_cast<std::uint32_t>(pAddr + offset));
 
-            std::copy(pData.begin(), pData.end(), std::back_inserter(sendData));
+                buffers.emplace_back(headers[i]);
+                buffers.emplace_back(pData.data() + offset, msgSize);
+            }
 
             try
             {
-                if (tcpSocketWrapperPtr)
-                    tcpSocketWrapperPtr->write(sendData);
-                else
-                    throw std::runtime_error("Undefined TCP socket. THIS SHOULD NEVER HAPPEN!");
+                writeTcp(buffers);
             }
             catch (const std::runtime_error& exc)
             {
+                countError();
                 throw std::runtime_error("Could not write to SiTCP socket \"" + name + "\": " + exc.what());
             }
         }
         else
         {
             std::uint32_t currentAddr = pAddr;
-            auto nFullWrites = pData.size()/rbcpMaxSize;
-
-            auto currentDataIt = pData.begin();
+            auto nFullWrites = pData.size()/rbcpChunkSize;
 
             try
             {
+                if (nFullWrites > 1 && rbcpWindowSize > 1)
+                {
+                    doPipelinedRBCPOperations(static_cast<std::uint32_t>(pAddr), pData);
+                    countWrite(pData.size());
+                    record();
+                    return;
+                }
+
                 for (auto i = decltype(nFullWrites){0}; i < nFullWrites; ++i)
                 {
-                    writeSingle(currentAddr, std::vector<std::uint8_t>(currentDataIt, currentDataIt+rbcpMaxSize));
+                    writeSingle(currentAddr, pData.subspan(i * rbcpChunkSize, rbcpChunkSize));
 
-                    currentAddr += rbcpMaxSize;
-                    currentDataIt += rbcpMaxSize;
+                    currentAddr += rbcpChunkSize;
                 }
 
-                if (pData.size() % rbcpMaxSize > 0)
-                    writeSingle(currentAddr, std::vector<std::uint8_t>(currentDataIt, pData.end()));
+                if (pData.size() % rbcpChunkSize > 0)
+                    writeSingle(currentAddr, pData.subspan(nFullWrites * rbcpChunkSize));
             }
             catch (const std::runtime_error& exc)
             {
-                throw std::runtime_error("Could not write to SiTCP socket \"" + name + "\". Call to writeSingle() failed: " + exc.what());
+                countError();
+                throw std::runtime_error("Could not write to SiTCP socket \"" + name + "\". RBCP write operation failed: " + exc.what());
             }
         }
+
+        countWrite(pData.size());
     }
     else if (pAddr < baseAddrFIFOLimit)
     {
         try
         {
-            if (tcpSocketWrapperPtr)
-                tcpSocketWrapperPtr->write(pData);  //TODO Basil comment: chunking?
-            else
-                throw std::runtime_error("Undefined TCP socket.");
+            //No chunking needed: raw data has no message framing and the gather write completes the whole buffer
+            writeTcp(std::span<const std::span<const std::uint8_t>>(&pData, 1));
         }
         catch (const std::runtime_error& exc)
         {
+            countError();
             throw std::runtime_error("Could not write to SiTCP socket \"" + name + "\": " + exc.what());
         }
+
+        countWrite(pData.size());
     }
     else if (pAddr == baseAddrFIFOLimit)
     {
@@ -329,665 +914,2414 @@ void SiTCP::write(const std::uint64_t pAddr, const std::vector<std::uint8_t>& pD
     {
         throw std::invalid_argument("Invalid address " + Bytes::formatHex(pAddr) + " for writing to " + getSelfDescription());
     }
+
+    record();
 }
 
 /*!
- * \copybrief MuxedInterface::query()
+ * \copybrief MuxedInterface::tryWriteFrom()
  *
- * Does nothing.
+ * For normal bus addresses (<tt>[0, \ref baseAddrDataLimit)</tt>) and non-empty data of at most \ref rbcpChunkSize bytes
+ * (and if "tcp_to_bus" is not enabled) this works like writeFrom() but performs the single RBCP write via
+ * tryDoSingleRBCPOperation(), i.e. RBCP timeouts and invalid/wrong responses are returned as Error
+ * (codes Error::Code::Timeout and Error::Code::Protocol) without throwing any exception.
+ * Failed %UDP socket accesses are reported with code Error::Code::Failure.
+ * For all other cases MuxedInterface::tryWriteFrom() is used.
  *
- * \param pWriteAddr Ignored.
- * \param pReadAddr Ignored.
- * \param pData Ignored.
- * \param pSize Ignored.
- * \return Empty vector.
+ * \copydetails MuxedInterface::tryWriteFrom()
  */
-std::vector<std::uint8_t> SiTCP::query(std::uint64_t, std::uint64_t, const std::vector<std::uint8_t>&, int)
+casil::Expected<void> SiTCP::tryWriteFrom(const std::uint64_t pAddr, const std::span<const std::uint8_t> pData)
 {
-    logger.logWarning("The query() function is not implemented for the SiTCP interface (does nothing).");
-    return {};
-}
+    if (pAddr >= baseAddrDataLimit || pData.empty() || pData.size() > rbcpChunkSize || (useTcp && useTcpToBus))
+        return MuxedInterface::tryWriteFrom(pAddr, pData);
 
-//
+    const Tracer::Scope trace(traceSource, Tracer::Event::Write, pAddr, static_cast<std::uint32_t>(pData.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Write);
+
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    Expected<void> result;
 
-/*!
- * \brief Check if the %UDP read buffer is empty.
- *
- * \throws std::runtime_error If checking the buffer size fails.
- *
- * \copydetails MuxedInterface::readBufferEmpty()
- */
-bool SiTCP::readBufferEmpty() const
-{
     try
     {
-        return udpSocketWrapperPtr->readBufferEmpty();
+        result = tryDoSingleRBCPOperation(static_cast<std::uint32_t>(pAddr), pData);
     }
     catch (const std::runtime_error& exc)
     {
-        throw std::runtime_error("Could not check UDP read buffer size of SiTCP socket \"" + name + "\": " + exc.what());
+        result = Error(Error::Code::Failure, [message = std::string(exc.what())]() { return message; });
+    }
+
+    if (!result)
+    {
+        countError();
+
+        return Error(result.error().getCode(), [tName = name, tError = result.error()]() -> std::string
+                     {
+                         return "Could not write to SiTCP socket \"" + tName + "\". RBCP write operation failed: " + tError.getMessage();
+                     });
     }
+
+    countWrite(pData.size());
+
+    if (sessionRecorderPtr)
+        sessionRecorderPtr->recordWrite(startTime, pAddr, pData);
+
+    return {};
 }
 
 /*!
- * \brief Clear the current contents of the %UDP read buffer.
+ * \copybrief MuxedInterface::writeBatch()
  *
- * \throws std::runtime_error If clearing the buffer fails.
+ * If "tcp_to_bus" is enabled (see SiTCP()), the normal bus writes in \p pOps (i.e. \c addr < \ref baseAddrDataLimit)
+ * are combined into as few "tcp_to_bus" messages as possible: Subsequent operations whose bus address ranges adjoin each
+ * other are merged into a single message, which is split into consecutive messages of maximum data length
+ * (\ref tcpToBusMaxSize, with according bus addresses) where needed (also for single operations exceeding
+ * the maximum length). All messages of such a sequence of bus writes are then written to the %TCP socket
+ * at once as a single buffer sequence (scatter/gather, i.e. without copying the data). Operations for other addresses than normal bus writes are passed
+ * to write() as usual, after writing the pending messages, such that the order of all operations is preserved.
+ *
+ * If "tcp_to_bus" is not enabled, write() is simply called for each operation (compare MuxedInterface::writeBatch()).
+ *
+ * \throws std::runtime_error If writing to the %TCP socket fails.
+ * \throws std::runtime_error If write() throws \c std::runtime_error.
+ * \throws std::invalid_argument If write() throws \c std::invalid_argument.
+ *
+ * \copydetails MuxedInterface::writeBatch()
  */
-void SiTCP::clearReadBuffer()
+void SiTCP::writeBatch(const std::span<const WriteOp> pOps)
 {
-    try
+    if (!useTcp || !useTcpToBus)
     {
-        udpSocketWrapperPtr->clearReadBuffer();
+        MuxedInterface::writeBatch(pOps);
+        return;
     }
-    catch (const std::runtime_error& exc)
+
+    std::deque<std::array<std::uint8_t, 6>> headers;    //"tcp_to_bus" message headers (deque: 'buffers' refers to the elements)
+    std::vector<std::span<const std::uint8_t>> buffers; //Buffer sequence of all headers and data
+
+    buffers.reserve(2 * pOps.size());
+
+    std::uint64_t msgAddr = 0;  //Bus address of current message
+    std::size_t msgSize = 0;    //Data length of current message
+
+    std::chrono::steady_clock::time_point msgsStartTime = std::chrono::steady_clock::now();    //Start time of pending messages
+    std::vector<const WriteOp*> msgOps;                                                         //Operations in pending messages
+
+    auto finishMessage = [&headers, &msgAddr, &msgSize]()
     {
-        throw std::runtime_error("Could not clear UDP read buffer of SiTCP socket \"" + name + "\": " + exc.what());
-    }
-}
+        if (headers.empty())
+            return;
 
-//
+        headers.back() = Bytes::composeByteArray(false, static_cast<std::uint16_t>(msgSize), static_cast<std::uint32_t>(msgAddr));
+    };
 
-/*!
- * \brief Clear the FIFO and the remaining incoming %TCP buffer.
- *
- * Clears the read buffer of the %TCP socket and clears the already read/polled bytes from the FIFO.
- *
- * \throws std::runtime_error If clearing the socket buffer fails.
- */
-void SiTCP::resetFifo()
-{
+    auto flushMessages = [this, &headers, &buffers, &finishMessage, &msgsStartTime, &msgOps]()
     {
-        //Make it easier/quicker to acquire the lock using this flag to notify FIFO thread
-        Auxil::AtomicFlagGuard flagGuard(wantLockTCPSocket);
-        (void)flagGuard;
+        if (headers.empty())
+            return;
 
-        const std::lock_guard<std::mutex> socketLock(tcpSocketMutex);
-        (void)socketLock;
+        finishMessage();
 
         try
         {
-            if (tcpSocketWrapperPtr)
-                tcpSocketWrapperPtr->clearReadBuffer();
-            else
-                throw std::runtime_error("Undefined TCP socket.");
+            writeTcp(buffers);
         }
         catch (const std::runtime_error& exc)
         {
-            throw std::runtime_error("Could not properly clear FIFO of SiTCP socket \"" + name + "\": " + exc.what());
+            countError();
+            throw std::runtime_error("Could not write to SiTCP socket \"" + name + "\": " + exc.what());
         }
-    }
+
+        std::size_t dataSize = 0;
+
+        for (const std::span<const std::uint8_t>& buffer : buffers)
+            dataSize += buffer.size();
+
+        countWrite(dataSize - headers.size() * 6);
+
+        if (sessionRecorderPtr)
+        {
+            for (const WriteOp* const op : msgOps)
+                sessionRecorderPtr->recordWrite(msgsStartTime, op->addr, op->data);
+        }
+
+        headers.clear();
+        buffers.clear();
+        msgOps.clear();
+        msgsStartTime = std::chrono::steady_clock::now();
+    };
+
+    for (const WriteOp& op : pOps)
     {
-        const std::lock_guard<std::mutex> bufferLock(fifoMutex);
-        (void)bufferLock;
+        if (op.addr >= baseAddrDataLimit)
+        {
+            flushMessages();
+            write(op.addr, op.data);
+            continue;
+        }
+
+        std::size_t offset = 0;
+
+        do
+        {
+            //Start new message unless (the rest of) the operation adjoins the current, not yet full message
+            if (headers.empty() || op.addr + offset != msgAddr + msgSize || msgSize == tcpToBusMaxSize)
+            {
+                finishMessage();
+
+                headers.emplace_back();
+                buffers.emplace_back(headers.back());
+
+                msgAddr = op.addr + offset;
+                msgSize = 0;
+            }
 
-        fifoBuffer.clear();
+            const std::size_t chunkSize = std::min<std::size_t>(op.data.size() - offset, tcpToBusMaxSize - msgSize);
+
+            buffers.emplace_back(op.data.data() + offset, chunkSize);
+            msgSize += chunkSize;
+            offset += chunkSize;
+        }
+        while (offset < op.data.size());
+
+        msgOps.push_back(&op);
     }
+
+    flushMessages();
 }
 
 /*!
- * \brief Get the FIFO size in number of bytes.
+ * \copybrief MuxedInterface::query()
  *
- * \return %SiTCP FIFO size in bytes.
- */
-std::size_t SiTCP::getFifoSize() const
-{
-    const std::lock_guard<std::mutex> bufferLock(fifoMutex);
-    (void)bufferLock;
-
-    return fifoBuffer.size();
-}
-
-/*!
- * \brief Extract the current FIFO content as sequence of bytes.
+ * For normal bus addresses (<tt>[0, \ref baseAddrDataLimit)</tt>) and non-negative \p pSize the write and the read are
+ * performed as a single pipelined RBCP transaction sequence (see runPipelinedRBCPTransactions()): The RBCP write requests
+ * for \p pData (split into chunks as for write()) are directly followed by the RBCP read requests for the response, without
+ * waiting for the write responses in between (with "init.rbcp_window" larger than 1). This way a command/response pair costs
+ * about one round-trip time instead of two. Other RBCP transactions (e.g. of other threads) cannot interleave with the query.
+ * The bus write always uses RBCP, also if "tcp_to_bus" is enabled (see SiTCP()), such that it is ordered with the read.
  *
- * The requested size \p pSize gets limited by the current FIFO size and then reduced by modulo 4 in order to
- * obtain only multiples of 4 bytes. Those multiples of 4 bytes are removed from the %SiTCP FIFO and then returned.
+ * A configured query delay ("init.query_delay", see Interface::Interface()) is applied between sending the last write
+ * request and sending the first read request. Since the %SiTCP core processes RBCP requests in order of arrival,
+ * the read is thus performed (at least) the query delay after the write.
  *
- * \param pSize Number of FIFO bytes to get (automatically reduced by modulo 4).
- * \return Byte sequence from the %SiTCP FIFO in multiples of 4 bytes, according to the smaller of \p pSize or FIFO size.
+ * If a write request had to be retransmitted (e.g. after a lost datagram), the read might have been performed before the write.
+ * In this case all read requests are sent again (after the query delay) once all writes are confirmed.
+ *
+ * For all other addresses MuxedInterface::query() is used.
+ *
+ * \throws std::runtime_error If the RBCP write or read fails (invalid/wrong/non-matching RBCP response, timeout,
+ *                            failed %UDP socket access).
+ * \throws std::runtime_error If MuxedInterface::query() throws \c std::runtime_error.
+ *
+ * \copydetails MuxedInterface::query()
  */
-std::vector<std::uint8_t> SiTCP::getFifoData(const int pSize)
+std::vector<std::uint8_t> SiTCP::query(const std::uint64_t pWriteAddr, const std::uint64_t pReadAddr,
+                                       const std::vector<std::uint8_t>& pData, const int pSize)
 {
-    if (pSize == 0)
-        return {};
+    if (pWriteAddr >= baseAddrDataLimit || pReadAddr >= baseAddrDataLimit || pSize < 0)
+        return MuxedInterface::query(pWriteAddr, pReadAddr, pData, pSize);
 
-    const std::lock_guard<std::mutex> bufferLock(fifoMutex);
-    (void)bufferLock;
+    const Tracer::Scope trace(traceSource, Tracer::Event::Query, pWriteAddr, static_cast<std::uint32_t>(pData.size()));
+    const Timing::Scope timing = timeOperation(Timing::Operation::Query);
 
-    std::size_t byteCount;
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
 
-    if (pSize < 0 || std::cmp_less(fifoBuffer.size(), pSize))
-        byteCount = fifoBuffer.size();
-    else
-        byteCount = pSize;
+    std::vector<std::uint8_t> retVal(pSize);
 
-    byteCount = byteCount - byteCount % 4;
+    std::vector<RBCPTransaction> transactions;
 
-    std::vector<std::uint8_t> retVal(fifoBuffer.begin(), fifoBuffer.begin() + byteCount);
+    prepareRBCPTransactions(transactions, static_cast<std::uint32_t>(pWriteAddr), std::span<const std::uint8_t>(pData));
 
-    fifoBuffer.erase(fifoBuffer.begin(), fifoBuffer.begin() + byteCount);
+    const std::size_t numWrites = transactions.size();
 
-    return retVal;
-}
+    prepareRBCPTransactions(transactions, static_cast<std::uint32_t>(pReadAddr), std::span<std::uint8_t>(retVal));
 
-//Private
+    //Delay the first read request relative to the last write request
+    if (numWrites > 0 && numWrites < transactions.size())
+        transactions[numWrites].sendDelay = queryDelayMicroSecs;
 
-/*!
- * \copybrief MuxedInterface::initImpl()
- *
- * Connects the %UDP socket and, if %TCP is enabled (see SiTCP()), the %TCP socket to the configured host name
- * using the respective configured ports.
- *
- * If %TCP is enabled, resets the FIFO and starts a polling thread for the incoming FIFO data (see also pollFifo()).
- * Furthermore, if also "tcp_to_bus" is enabled, configures the %SiTCP core accordingly by calling enableTcpToBus().
- *
- * Note: There must be no FIFO thread already running before starting a new one (see also close() / closeImpl()).
- *
- * \return True if successful.
- */
-bool SiTCP::initImpl()
-{
     try
     {
-        udpSocketWrapperPtr->init(connectTimeout);
+        runPipelinedRBCPTransactions(transactions);
 
-        if (useTcp)
+        //Repeat the reads if a write might have been overtaken by them (reads are only sent once all writes are confirmed)
+        const bool writeRetransmitted = std::any_of(transactions.begin(), transactions.begin() + numWrites,
+                                                    [](const RBCPTransaction& pTransaction) -> bool { return pTransaction.sendCnt > 1; });
+
+        if (writeRetransmitted && numWrites < transactions.size())
         {
-            if (tcpSocketWrapperPtr)
-                tcpSocketWrapperPtr->init(connectTimeout);
-            else
-                throw std::runtime_error("Undefined TCP socket. THIS SHOULD NEVER HAPPEN!");
+            logger.logRateLimited(Logger::LogLevel::Warning, "Query write was retransmitted. Repeating the query read...");
+
+            std::vector<RBCPTransaction> readTransactions;
+
+            waitForQueryDelay(std::chrono::steady_clock::now());
+
+            prepareRBCPTransactions(readTransactions, static_cast<std::uint32_t>(pReadAddr), std::span<std::uint8_t>(retVal));
+
+            runPipelinedRBCPTransactions(readTransactions);
         }
     }
     catch (const std::runtime_error& exc)
     {
-        logger.logError(std::string("Could not connect socket: ") + exc.what());
-        return false;
+        countError();
+        throw std::runtime_error("Could not query from SiTCP socket \"" + name + "\". RBCP query operation failed: " + exc.what());
     }
 
-    if (useTcp)
-    {
-        try
-        {
-            if (fifoThread.joinable())
-                throw std::runtime_error("FIFO thread is already running.");
-
-            resetFifo();
-
-            pollFIFO.store(true);
-
-            fifoThread = std::thread(&SiTCP::pollFifo, this);
-        }
-        catch (const std::system_error& exc)
-        {
-            logger.logError(std::string("Could not start FIFO thread: ") + exc.what());
-            return false;
-        }
-        catch (const std::runtime_error& exc)
-        {
-            logger.logError(std::string("Could not start FIFO thread: ") + exc.what());
-            return false;
-        }
+    countWrite(pData.size());
+    countRead(retVal.size());
 
-        if (useTcpToBus)
-        {
-            try
-            {
-                enableTcpToBus();
-            }
-            catch (const std::runtime_error& exc)
-            {
-                logger.logError(std::string("Could not enable \"tcp_to_bus\" feature: ") + exc.what());
-                return false;
-            }
-        }
+    if (sessionRecorderPtr)
+    {
+        sessionRecorderPtr->recordWrite(startTime, pWriteAddr, pData);
+        sessionRecorderPtr->recordRead(startTime, pReadAddr, pSize, retVal);
     }
 
-    return true;
+    return retVal;
 }
 
+//
+
 /*!
- * \copybrief MuxedInterface::closeImpl()
- *
- * If %TCP is enabled, stops the polling thread started by initImpl() and disconnects the %TCP socket.
+ * \brief Check if the %UDP read buffer is empty.
  *
- * Disconnects the %UDP socket.
+ * \throws std::runtime_error If checking the buffer size fails.
  *
- * \return True if successful.
+ * \copydetails MuxedInterface::readBufferEmpty()
  */
-bool SiTCP::closeImpl()
+bool SiTCP::readBufferEmpty() const
 {
+    const std::lock_guard<std::mutex> rbcpLock(rbcpMutex);
+    (void)rbcpLock;
+
     try
     {
-        if (useTcp)
-        {
-            pollFIFO.store(false);
-
-            try
-            {
-                if (fifoThread.joinable())
-                    fifoThread.join();
-            }
-            catch (const std::system_error& exc)
-            {
-                logger.logWarning(std::string("Could not join FIFO thread: ") + exc.what());
-            }
-        }
-
-        udpSocketWrapperPtr->close();
-
-        if (tcpSocketWrapperPtr)
-            tcpSocketWrapperPtr->close();
+        return udpSocketWrapperPtr->readBufferEmpty();
     }
     catch (const std::runtime_error& exc)
     {
-        logger.logError(std::string("Could not close socket connection: ") + exc.what());
-        return false;
+        throw std::runtime_error("Could not check UDP read buffer size of SiTCP socket \"" + name + "\": " + exc.what());
     }
-
-    return true;
 }
 
-//
-
 /*!
- * \brief Enable using %TCP protocol for normal bus writes.
- *
- * Configures the %SiTCP core for receiving normal basil bus writes via %TCP (the "tcp_to_bus" feature)
- * by writing the reset sequence <tt>{65535 * 0xFF + 6 * 0x00}</tt> (see SiTCP) to the %TCP socket.
- *
- * Returns immediately if "tcp_to_bus" is not enabled.
+ * \brief Clear the current contents of the %UDP read buffer.
  *
- * \throws std::runtime_error If writing to the %TCP socket fails.
+ * \throws std::runtime_error If clearing the buffer fails.
  */
-void SiTCP::enableTcpToBus()
+void SiTCP::clearReadBuffer()
 {
-    if (!tcpSocketWrapperPtr)
-    {
-        if (useTcpToBus)
-            throw std::runtime_error("Undefined TCP socket. THIS SHOULD NEVER HAPPEN!");
-        else
-            logger.logWarning("Cannot use \"tcp_to_bus\" feature: \"tcp_to_bus\" is not enabled.");
-
-        return;
-    }
+    const std::lock_guard<std::mutex> rbcpLock(rbcpMutex);
+    (void)rbcpLock;
 
     try
     {
-        tcpSocketWrapperPtr->write(std::vector<std::uint8_t>(65535, 255));
-        tcpSocketWrapperPtr->write(std::vector<std::uint8_t>(6, 0));
+        udpSocketWrapperPtr->clearReadBuffer();
     }
     catch (const std::runtime_error& exc)
     {
-        throw std::runtime_error(std::string("Could not write sequence to enable \"tcp_to_bus\": ") + exc.what());
+        throw std::runtime_error("Could not clear UDP read buffer of SiTCP socket \"" + name + "\": " + exc.what());
     }
 }
 
 //
 
 /*!
- * \brief Continuously poll the %TCP socket for new FIFO data (use as thread).
+ * \brief Check if the event notification listener is enabled.
  *
- * Starts a loop to iteratively poll the %SiTCP FIFO and to add new data to the FIFO buffer, if the %TCP connection
- * is enabled (see SiTCP()) and FIFO polling was enabled (see init()). Otherwise returns immediately.
+ * See SiTCP() ("init.event_port") and MuxedInterface::supportsEvents().
  *
- * The polling stops and the function returns when polling gets disabled explicitly (see close()) or automatically as soon
- * as the maximum error count (see \ref maxFIFOErrorCount) for reads from the %TCP socket is exceeded.
- *
- * Ensures a minimum time of \ref tcpReadoutInterval between subsequent read attempts.
+ * \return True if an event notification port is configured.
  */
-void SiTCP::pollFifo()
+bool SiTCP::supportsEvents() const
 {
-    if (!tcpSocketWrapperPtr)
-    {
-        logger.logError("Cannot poll FIFO: Undefined TCP socket.");
-        return;
-    }
-
-    std::vector<std::uint8_t> tmpBuffer;
+    return static_cast<bool>(eventListenerPtr);
+}
 
-    std::size_t errorCount = 0;
+//
 
-    auto lastTime = std::chrono::steady_clock::now();
+/*!
+ * \brief Clear the FIFO and the remaining incoming %TCP buffer.
+ *
+ * Discards the incoming data not yet added to the FIFO and clears the already read bytes from the FIFO.
+ *
+ * If the continuous reading of FIFO data from the %TCP socket (see initImpl()) is active, the FIFO is cleared by a
+ * reset request processed by the reading itself (see CommonImpl::TCPSocketWrapper::resetAsyncReads()), which owns
+ * the socket exclusively. Hence the reading does not need to be stopped and restarted and the reset completes within
+ * a single read cycle. Otherwise the read buffer of the %TCP socket and the FIFO are cleared directly and the
+ * continuous reading is (re)started if FIFO reading is enabled (i.e. the interface is initialized).
+ *
+ * If writing the FIFO data to files (see SiTCP()), the already read complete data words are written to the file
+ * and only a possibly remaining incomplete word is discarded.
+ *
+ * \throws std::runtime_error If clearing the socket buffer, writing to the FIFO data file or restarting the continuous reading fails.
+ */
+void SiTCP::resetFifo()
+{
+    const std::lock_guard<std::mutex> socketLock(tcpSocketMutex);
+    (void)socketLock;
 
-    while (pollFIFO.load())
+    //Called by the continuous reading (never concurrently to handleFifoData(); required for lock-free FIFO mode,
+    //where adding data does not use fifoMutex) or directly if reading is not active
+    auto clearFifo = [this]() -> void
     {
-        if (wantLockTCPSocket.test())
-            std::this_thread::yield();  //If flag temporarily set (e.g. by resetFifo()), significantly reduces time to acquire tcpSocketMutex
-
         {
-            const std::lock_guard<std::mutex> socketLock(tcpSocketMutex);
-            (void)socketLock;
+            const std::lock_guard<std::mutex> bufferLock(fifoMutex);
+            (void)bufferLock;
 
-            try
-            {
-                tmpBuffer = tcpSocketWrapperPtr->readMax(1024*8, tcpReadoutInterval);
-            }
-            catch (const std::runtime_error& exc)
-            {
-                logger.logError(std::string("Error while polling FIFO: ") + exc.what());
+            fifoBufferPtr->clear();
 
-                if (++errorCount > maxFIFOErrorCount)
-                {
-                    pollFIFO.store(false);
-                    logger.logCritical("Exceeded maximum error count while polling FIFO. Stopping...");
-                }
-            }
+            const std::lock_guard<std::mutex> chunksLock(fifoChunksMutex);
+            (void)chunksLock;
+
+            fifoChunks.clear();
         }
 
-        if (tmpBuffer.size() > 0)
         {
-            const std::lock_guard<std::mutex> bufferLock(fifoMutex);
-            (void)bufferLock;
-
-            fifoBuffer.insert(fifoBuffer.end(), tmpBuffer.begin(), tmpBuffer.end());
+            const std::lock_guard<std::mutex> subscriptionsLock(fifoSubscriptionsMutex);
+            (void)subscriptionsLock;
 
-            tmpBuffer.clear();
+            for (const std::weak_ptr<SiTCPFifoSubscription>& weakSubscription : fifoSubscriptions)
+                if (const std::shared_ptr<SiTCPFifoSubscription> subscription = weakSubscription.lock())
+                    subscription->clear();
         }
 
-        auto currentTime = std::chrono::steady_clock::now();
-        auto evolvedTime = currentTime - lastTime;
+        fifoStreamOffset = 0;
 
-        if (evolvedTime < tcpReadoutInterval)
+        if (fifoFileWriterPtr && fifoFileWriterPtr->isOpen())
         {
-            std::this_thread::sleep_for(tcpReadoutInterval - evolvedTime);
-            lastTime = std::chrono::steady_clock::now();
+            fifoFileWriterPtr->discardPartialWord();
+            fifoFileWriterPtr->flush();
         }
-        else
-            lastTime = currentTime;
+
+        if (fifoShmWriterPtr && fifoShmWriterPtr->isOpen())
+            fifoShmWriterPtr->discardPartialWord();
+    };
+
+    try
+    {
+        if (!tcpSocketWrapperPtr)
+            throw std::runtime_error("Undefined TCP socket.");
+
+        tcpSocketWrapperPtr->resetAsyncReads(clearFifo);
+
+        if (pollFIFO.load() && !tcpSocketWrapperPtr->asyncReadsActive())
+            tcpSocketWrapperPtr->startAsyncReads(tcpReadBufferSize, std::bind(&SiTCP::handleFifoData, this, std::placeholders::_1),
+                                                 fifoFullRetryInterval);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not properly clear FIFO of SiTCP socket \"" + name + "\": " + exc.what());
     }
 }
 
-//
-
 /*!
- * \brief Read from the bus with a single RBCP request/response.
- *
- * Writes a single RBCP read message (initiating a bus read) for address \p pAddr to the basil bus, requesting to read \p pSize bytes.
- * Waits for the response message, extracts the read byte sequence from it and returns the sequence.
- *
- * See doSingleRBCPOperation() in "read mode" for further details.
+ * \brief Get the FIFO size in number of bytes.
  *
- * \throws std::runtime_error If \p pSize exceeds the maximum RBCP data length.
- * \throws std::runtime_error If an invalid/wrong/non-matching RBCP response message was received.
- * \throws std::runtime_error If reading/writing from/to the %UDP socket time out too often (exceeded retry limit).
- * \throws std::runtime_error If reading/writing from/to the %UDP socket fails due to non-timeout reasons.
+ * \throws std::runtime_error If FIFO subscriptions exist (see subscribeFifo()).
  *
- * \param pAddr Bus address as source location for the return value.
- * \param pSize Length of the data to be read from bus address \p pAddr.
- * \return Data read from the bus at address \p pAddr.
+ * \return %SiTCP FIFO size in bytes.
  */
-std::vector<std::uint8_t> SiTCP::readSingle(const std::uint32_t pAddr, const std::uint8_t pSize)
+std::size_t SiTCP::getFifoSize() const
 {
-    return doSingleRBCPOperation(pAddr, pSize).value();
+    checkFifoNotSubscribed();
+
+    const std::lock_guard<std::mutex> bufferLock(fifoMutex);
+    (void)bufferLock;
+
+    return fifoBufferPtr->getSize();
 }
 
 /*!
- * \brief Write to the bus with a single RBCP request/response.
- *
- * Writes a single RBCP write message (initiating a bus write) for address \p pAddr to the basil bus, requesting to write \p pData.
- * Waits for the response message in order to check that the sent message was correctly transmitted.
+ * \brief Extract the current FIFO content as sequence of bytes.
  *
- * See doSingleRBCPOperation() in "write mode" for further details.
+ * The requested size \p pSize gets limited by the current FIFO size and then reduced by modulo 4 in order to
+ * obtain only multiples of 4 bytes. Those multiples of 4 bytes are removed from the %SiTCP FIFO and then returned.
  *
- * \throws std::runtime_error If length of \p pData exceeds the maximum RBCP data length.
- * \throws std::runtime_error If an invalid/wrong/non-matching RBCP response message was received.
- * \throws std::runtime_error If reading/writing from/to the %UDP socket time out too often (exceeded retry limit).
- * \throws std::runtime_error If reading/writing from/to the %UDP socket fails due to non-timeout reasons.
+ * \throws std::runtime_error If FIFO subscriptions exist (see subscribeFifo()).
  *
- * \param pAddr Bus address as destination for writing \p pData.
- * \param pData Data to be written to bus address \p pAddr.
+ * \param pSize Number of FIFO bytes to get (automatically reduced by modulo 4).
+ * \return Byte sequence from the %SiTCP FIFO in multiples of 4 bytes, according to the smaller of \p pSize or FIFO size.
  */
-void SiTCP::writeSingle(const std::uint32_t pAddr, const std::vector<std::uint8_t>& pData)
+std::vector<std::uint8_t> SiTCP::getFifoData(const int pSize)
 {
-    doSingleRBCPOperation(pAddr, pData);
-}
+    checkFifoNotSubscribed();
 
-//
+    if (pSize == 0)
+        return {};
+
+    (void)tryReconnectTcp();
+
+    const std::lock_guard<std::mutex> bufferLock(fifoMutex);
+    (void)bufferLock;
+
+    const std::size_t wordCount = fifoBufferPtr->getWordCount();
+
+    if (pSize < 0 || std::cmp_less(wordCount * 4, pSize))
+        return fifoBufferPtr->popBytes(wordCount);
+    else
+        return fifoBufferPtr->popBytes(static_cast<std::size_t>(pSize) / 4);
+}
 
 /*!
- * \brief Send a single RBCP read or write request to the bus and process the response message.
- *
- * Writes a single RBCP read \e or write message (depending on the type in \p pSizeOrData) to the %SiTCP core.
- * This message initiates a read/write from/to the basil bus at bus address \p pAddr, respectively.
- * In case of "read mode", \p pSizeOrData specifies the number of bytes to read.
- * In case of "write mode", \p pSizeOrData specifies the byte sequence to be written.
+ * \brief Pass the current FIFO content in place to a function and remove it.
  *
- * Waits for the response message in order to check that the sent message was correctly transmitted and, in case of "read mode",
- * to receive the data that was requested to be read. The read data will be returned, or nothing in case of "write mode".
+ * Works like getFifoData() but instead of copying the data to a newly allocated byte sequence, calls \p pConsumer with
+ * views directly into the FIFO buffer. The data is passed as 32 bit words (composed from the bytes assuming little endian
+ * byte order) in two contiguous segments, of which the second one is empty unless the data wraps around the end of the
+ * (ring) buffer. The data is removed from the FIFO when \p pConsumer returns and the views must not be used afterwards.
+ * If \p pConsumer throws, the data is kept in the FIFO.
  *
- * See SiTCP for detailed protocol information.
+ * The requested size \p pSize is limited by the current FIFO size and reduced by modulo 4 as for getFifoData().
  *
- * Note: Uses timeout \ref udpTimeout for every socket read and write
- * and retries every timed out read and write \ref udpRetransmitCnt times.
+ * Note: The FIFO is locked while \p pConsumer runs. Do not call any of the FIFO functions from within \p pConsumer.
+ * Keep \p pConsumer short, unless the lock-free FIFO mode is used (see SiTCP()), as the FIFO reading is blocked meanwhile.
  *
- * \throws std::runtime_error If either the size in or the length of the data in \p pSizeOrData exceed the maximum RBCP data length.
- * \throws std::runtime_error If an invalid/wrong/non-matching RBCP response message was received.
- * \throws std::runtime_error If reading from the %UDP socket times out more than \ref udpRetransmitCnt times.
- * \throws std::runtime_error If writing to the %UDP socket times out more than \ref udpRetransmitCnt times.
- * \throws std::runtime_error If reading/writing from/to the %UDP socket fails due to non-timeout reasons.
+ * \throws std::runtime_error If FIFO subscriptions exist (see subscribeFifo()).
  *
- * \param pAddr Bus address as source/target location for reading/writing \p pSizeOrData.
- * \param pSizeOrData Either length of the data to be read from ("read mode") or data to be written to ("write mode") bus address \p pAddr.
- * \return Nothing for "write mode" and data read from the bus at address \p pAddr for "read mode".
+ * \param pConsumer Function to process the FIFO data words.
+ * \param pSize Number of FIFO bytes to pass (automatically reduced by modulo 4).
+ * \return Number of passed (and removed) bytes.
  */
-std::optional<std::vector<std::uint8_t>> SiTCP::doSingleRBCPOperation(const std::uint32_t pAddr, const std::variant<
-                                                                 std::uint8_t,
-                                                                 std::reference_wrapper<const std::vector<std::uint8_t>>> pSizeOrData)
+std::size_t SiTCP::consumeFifo(const FifoConsumerFunctionType& pConsumer, const int pSize)
 {
-    auto extractSize = [pSizeOrData]() -> std::uint8_t
-    {
-        return std::get<std::uint8_t>(pSizeOrData);
-    };
-    auto extractData = [pSizeOrData]() -> const std::vector<std::uint8_t>&
-    {
-        return std::get<std::reference_wrapper<const std::vector<std::uint8_t>>>(pSizeOrData);
-    };
+    checkFifoNotSubscribed();
 
-    enum class RBCPOperation { Read, Write };
-    const RBCPOperation operationType = (std::holds_alternative<std::uint8_t>(pSizeOrData) ? RBCPOperation::Read : RBCPOperation::Write);
+    if (pSize == 0)
+        return 0;
 
-    if (operationType == RBCPOperation::Read && extractSize() > rbcpMaxSize)
-        throw std::runtime_error("Requested read data length exceeds maximum RBCP data length.");
-    else if (operationType == RBCPOperation::Write && extractData().size() > rbcpMaxSize)
-        throw std::runtime_error("Length of passed data exceeds maximum RBCP data length.");
+    (void)tryReconnectTcp();
 
-    const std::string functionName = ((operationType == RBCPOperation::Read) ? "readSingle()" : "writeSingle()");
+    const std::lock_guard<std::mutex> bufferLock(fifoMutex);
+    (void)bufferLock;
 
-    /*
-     * Define lambda to make sure there are no unwanted datagrams left on the UDP socket; otherwise remove and
-     * log a warning message for each of those (try to extract RBCP message ID and add it to the message);
-     * 'pWarnMsgContext' adds context to the message (i.e. when this check is executed (see usage below))
-     */
-    auto checkAndClearReadBuffer = [this, functionName](const std::string& pWarnMsgContext)
-    {
-        while (!udpSocketWrapperPtr->readBufferEmpty())
-        {
-            std::vector<std::uint8_t> tmpData = udpSocketWrapperPtr->readMax(3);    //Read just enough for the header
+    std::size_t numWords = fifoBufferPtr->getWordCount();
 
-            if (tmpData.size() == 3)
-            {
-                logger.logWarning("Found unexpected datagram " + pWarnMsgContext + " (in " + functionName + "). RBCP message ID: " +
-                                  std::to_string(rbcpId) + " (expected), " + std::to_string(tmpData[2]) + " (received).");
-            }
+    if (pSize > 0)
+        numWords = std::min(numWords, static_cast<std::size_t>(pSize) / 4);
+
+    return fifoBufferPtr->consumeWords(numWords, pConsumer) * 4;
+}
+
+/*!
+ * \brief Pass the current FIFO content in place to a function chunk by chunk, with chunk metadata, and remove it.
+ *
+ * Works like consumeFifo() but calls \p pConsumer once per received %TCP chunk, with the (steady clock) arrival time and
+ * the running sequence number of the chunk and a single contiguous view of the chunk's data words. A chunk comprises the
+ * words completed by one %TCP socket read, i.e. a word split between two reads belongs to the later chunk. If a chunk
+ * was already partially removed from the FIFO (e.g. via getFifoData() or a limited \p pSize), only its remaining words
+ * are passed. This allows to merge the data streams of multiple boards by arrival time.
+ *
+ * The requested size \p pSize is limited by the current FIFO size and reduced by modulo 4 as for getFifoData().
+ * If \p pConsumer throws, the data is kept in the FIFO (including the chunks already passed).
+ *
+ * Note: The FIFO is locked while \p pConsumer runs (see consumeFifo()). Chunks wrapping around the end of the FIFO
+ * ring buffer are copied to a temporary buffer, all other chunks are passed without copy.
+ *
+ * \throws std::runtime_error If FIFO subscriptions exist (see subscribeFifo()).
+ *
+ * \param pConsumer Function to process the chunks.
+ * \param pSize Number of FIFO bytes to pass (automatically reduced by modulo 4).
+ * \return Number of passed (and removed) bytes.
+ */
+std::size_t SiTCP::consumeFifoChunks(const FifoChunkConsumerFunctionType& pConsumer, const int pSize)
+{
+    checkFifoNotSubscribed();
+
+    if (pSize == 0)
+        return 0;
+
+    (void)tryReconnectTcp();
+
+    const std::lock_guard<std::mutex> bufferLock(fifoMutex);
+    (void)bufferLock;
+
+    const std::uint64_t firstWord = fifoBufferPtr->getWordsPopped();
+
+    std::vector<FifoChunkInfo> chunks;
+
+    {
+        const std::lock_guard<std::mutex> chunksLock(fifoChunksMutex);
+        (void)chunksLock;
+
+        while (!fifoChunks.empty() && fifoChunks.front().endWord <= firstWord)
+            fifoChunks.pop_front();
+
+        chunks.assign(fifoChunks.begin(), fifoChunks.end());
+    }
+
+    if (chunks.empty())
+        return 0;
+
+    //Words of a concurrently received chunk may already be in the buffer before the chunk was recorded (lock-free mode)
+    std::size_t numWords = std::min(fifoBufferPtr->getWordCount(), static_cast<std::size_t>(chunks.back().endWord - firstWord));
+
+    if (pSize > 0)
+        numWords = std::min(numWords, static_cast<std::size_t>(pSize) / 4);
+
+    auto passChunks = [&pConsumer, &chunks, firstWord, numWords](const std::span<const std::uint32_t> pFirst,
+                                                                 const std::span<const std::uint32_t> pSecond) -> void
+    {
+        std::vector<std::uint32_t> wrappedChunk;
+
+        std::size_t pos = 0;
+
+        for (const FifoChunkInfo& chunk : chunks)
+        {
+            if (pos >= numWords)
+                break;
+
+            const std::size_t endPos = std::min(static_cast<std::size_t>(chunk.endWord - firstWord), numWords);
+
+            std::span<const std::uint32_t> words;
+
+            if (endPos <= pFirst.size())
+                words = pFirst.subspan(pos, endPos - pos);
+            else if (pos >= pFirst.size())
+                words = pSecond.subspan(pos - pFirst.size(), endPos - pos);
             else
             {
-                logger.logWarning("Found unexpected datagram " + pWarnMsgContext + " (in " + functionName + ").");
+                wrappedChunk.assign(pFirst.begin() + pos, pFirst.end());
+                wrappedChunk.insert(wrappedChunk.end(), pSecond.begin(), pSecond.begin() + (endPos - pFirst.size()));
+                words = wrappedChunk;
             }
+
+            pConsumer(chunk.timestamp, chunk.sequenceNumber, words);
+
+            pos = endPos;
         }
     };
 
-    std::vector<std::uint8_t> request;
+    return fifoBufferPtr->consumeWords(numWords, passChunks) * 4;
+}
 
-    if (operationType == RBCPOperation::Read)
-    {
-        std::uint8_t pSize = extractSize();
+/*!
+ * \brief Get the maximum FIFO size reached so far in number of bytes.
+ *
+ * Can be used to check how close the FIFO came to the configured initial capacity ("init.fifo_capacity", see SiTCP())
+ * and hence whether the buffer had to grow. Note that resetFifo() does not reset this value.
+ *
+ * \return Maximum %SiTCP FIFO size in bytes since construction.
+ */
+std::size_t SiTCP::getFifoHighWaterMark() const
+{
+    const std::lock_guard<std::mutex> bufferLock(fifoMutex);
+    (void)bufferLock;
 
-        request = Bytes::composeByteVec(true, rbcpVerType, rbcpCmdRd, rbcpId, pSize, pAddr);
-    }
-    else // if (operationType == RBCPOperation::Write)
+    return fifoBufferPtr->getHighWaterMark();
+}
+
+/*!
+ * \brief Get the FIFO size limit in number of bytes.
+ *
+ * Returns the configured limit ("init.fifo_max_size", see SiTCP()) or, if smaller, the fixed capacity
+ * of the FIFO buffer in lock-free FIFO mode or when using a memory-mapped file. Returns the limit
+ * after spilling ("init.fifo_spill_size") instead if the FIFO buffer was spilled to file (see isFifoSpilled()).
+ *
+ * \return Maximum %SiTCP FIFO size in bytes or zero if the FIFO size is unlimited.
+ */
+std::size_t SiTCP::getFifoMaxSize() const
+{
+    if (isFifoSpilled())
+        return fifoSpillSize;
+
+    if (fifoBufferPtr->hasFixedCapacity())
     {
-        const std::vector<std::uint8_t>& pData = extractData();
+        const std::size_t fixedSize = fifoBufferPtr->getCapacity() * 4;
 
-        request = Bytes::composeByteVec(true, rbcpVerType, rbcpCmdWr, rbcpId, static_cast<std::uint8_t>(pData.size()), pAddr);
-        Bytes::appendToByteVec(request, pData);
+        return fifoMaxSize > 0 ? std::min(fixedSize, fifoMaxSize) : fixedSize;
     }
 
-    int writeAttemptCnt = 0;
+    return fifoMaxSize;
+}
 
-    for (;;)
-    {
-        std::uint8_t& currentRbcpId = request[2];
+/*!
+ * \brief Get the FIFO size as fraction of the FIFO size limit.
+ *
+ * Can be used by schedulers to throttle the data taking before the FIFO runs full and the configured
+ * overflow policy applies (see SiTCP()).
+ *
+ * Note: With a fixed FIFO buffer capacity the value can slightly exceed 1 when the FIFO is full,
+ * since up to three bytes of an incomplete word are held back in addition.
+ *
+ * \return getFifoSize() divided by getFifoMaxSize() or zero if the FIFO size is unlimited.
+ */
+double SiTCP::getFifoFillLevel() const
+{
+    const std::size_t maxSize = getFifoMaxSize();
 
-        currentRbcpId = ++rbcpId;   //Increase RBCP message ID
+    if (maxSize == 0)
+        return 0.0;
 
-        ++writeAttemptCnt;
+    return static_cast<double>(getFifoSize()) / static_cast<double>(maxSize);
+}
+
+/*!
+ * \brief Check if the FIFO buffer was moved to the spill file.
+ *
+ * See the "spill" FIFO overflow policy in SiTCP().
+ *
+ * \return True if the FIFO data is buffered in the spill file.
+ */
+bool SiTCP::isFifoSpilled() const
+{
+    if (!fifoSpill)
+        return false;
 
-        checkAndClearReadBuffer("before completing send operation");
+    const std::lock_guard<std::mutex> bufferLock(fifoMutex);
+    (void)bufferLock;
 
-        bool writeTimedOut = false;
+    return fifoBufferPtr->isFileBacked();
+}
+
+/*!
+ * \brief Set a function to be called whenever new FIFO data arrived.
+ *
+ * \p pNotifier is called from the (ASIO) thread that reads the %TCP socket, each time after new data
+ * was added to the FIFO buffer. This allows to wait for FIFO data without polling getFifoSize().
+ * The function must return quickly and must not access the FIFO itself (use it to wake another thread instead).
+ * It is not called when FIFO data is written to file or shared memory instead (see "fifo_dump_file" and "fifo_shm_name" in SiTCP()).
+ *
+ * Only one function can be set at a time. Pass an empty function to remove it. After this function returned,
+ * the previous function is guaranteed to not be called (anymore).
+ *
+ * \param pNotifier Function to be called after new FIFO data arrived.
+ */
+void SiTCP::setFifoDataNotifier(FifoDataNotifierFunctionType pNotifier)
+{
+    const std::lock_guard<std::mutex> notifierLock(fifoDataNotifierMutex);
+    (void)notifierLock;
+
+    fifoDataNotifier = std::move(pNotifier);
+}
+
+/*!
+ * \brief Write raw data chunk by chunk to the %TCP socket without interruption by other writes.
+ *
+ * Repeatedly calls \p pProducer to get the next chunk of raw data and writes it to the %TCP socket as writeFrom() does
+ * for the address \ref baseAddrDataLimit (e.g. writing the data to the %SiTCP FIFO if "tcp_to_bus" is \e not enabled),
+ * until \p pProducer returns an empty chunk. The %TCP write mutex is held over all chunks, such that other writes
+ * to the %TCP socket (e.g. of concurrent calls) cannot be interleaved with the chunks.
+ *
+ * This allows to write large amounts of data with limited memory usage: The next chunk is only requested
+ * after the previous one was written, i.e. \p pProducer can reuse the same buffer for every chunk.
+ *
+ * Note: Do not write to the %TCP socket from within \p pProducer, as this would deadlock.
+ *
+ * \throws std::runtime_error If writing to the %TCP socket fails.
+ *
+ * \param pProducer Function returning the next chunk of data (the data must stay valid until the next call).
+ */
+void SiTCP::writeFifoChunks(const FifoChunkProducerFunctionType& pProducer)
+{
+    if (!tcpSocketWrapperPtr)
+        throw std::runtime_error("Could not write to SiTCP socket \"" + name + "\": Undefined TCP socket.");
+
+    const std::lock_guard<std::mutex> writeLock(tcpWriteMutex);
+    (void)writeLock;
+
+    for (std::span<const std::uint8_t> chunk = pProducer(); !chunk.empty(); chunk = pProducer())
+    {
+        const Tracer::Scope trace(traceSource, Tracer::Event::Write, baseAddrDataLimit, static_cast<std::uint32_t>(chunk.size()));
+        const Timing::Scope timing = timeOperation(Timing::Operation::Write);
+
+        const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
 
         try
         {
-            udpSocketWrapperPtr->write(request, udpTimeout, writeTimedOut);
+            writeTcpUnlocked(std::span<const std::span<const std::uint8_t>>(&chunk, 1));
         }
-        catch (const std::runtime_error&)
+        catch (const std::runtime_error& exc)
         {
-            if (writeTimedOut && writeAttemptCnt <= udpRetransmitCnt)                       // cppcheck-suppress knownConditionTrueFalse
-            {
-                logger.logWarning("Write timeout on UDP socket (in " + functionName + "). Retry write...");
-                continue;
-            }
-            else if (writeTimedOut)                                                         // cppcheck-suppress knownConditionTrueFalse
-                throw std::runtime_error("Write timeout.");
-            else
-                throw;  //Rethrow for unknown non-timeout exceptions
+            countError();
+            throw std::runtime_error("Could not write to SiTCP socket \"" + name + "\": " + exc.what());
         }
 
-        int readAttemptCnt = 0;
+        countWrite(chunk.size());
 
-        for (;;)
-        {
-            ++readAttemptCnt;
+        if (sessionRecorderPtr)
+            sessionRecorderPtr->recordWrite(startTime, baseAddrDataLimit, chunk);
+    }
+}
+
+/*!
+ * \brief Create an independent reader of the FIFO data stream.
+ *
+ * Creates a subscription that receives a copy of all FIFO data arriving from now on (see SiTCPFifoSubscription).
+ * While at least one subscription exists, the FIFO data is passed to the subscriptions \e instead of the normal
+ * FIFO buffer of the interface. Reading the FIFO buffer (see getFifoSize(), getFifoData(), consumeFifo() and
+ * consumeFifoChunks()) throws meanwhile, such that consumers that did not subscribe cannot silently miss the data.
+ * The subscription is removed again when the last reference to it is released. resetFifo() also clears the data
+ * of all subscriptions.
+ *
+ * The FIFO data notifier (see setFifoDataNotifier()) is called for data passed to the subscriptions as well.
+ *
+ * \throws std::runtime_error If the FIFO data is written to files or shared memory instead (see SiTCP()).
+ *
+ * \return The new subscription.
+ */
+std::shared_ptr<casil::TL::SiTCPFifoSubscription> SiTCP::subscribeFifo()
+{
+    if (fifoFileWriterPtr || fifoShmWriterPtr)
+        throw std::runtime_error("Cannot subscribe to FIFO of SiTCP interface \"" + name + "\": FIFO data is written to "
+                                 "file or shared memory instead.");
 
-            const auto timeoutRefTime = std::chrono::steady_clock::now();
+    const std::size_t capacity = (fifoMaxSize > 0 ? std::min(fifoCapacity, fifoMaxSize) : fifoCapacity);
 
-            while ((std::chrono::steady_clock::now() - timeoutRefTime) < udpTimeout && udpSocketWrapperPtr->readBufferEmpty())
-                std::this_thread::yield();
+    std::shared_ptr<SiTCPFifoSubscription> subscription(new SiTCPFifoSubscription(capacity, fifoMaxSize));
 
-            if (udpSocketWrapperPtr->readBufferEmpty())
-            {
-                if (readAttemptCnt <= udpRetransmitCnt)
-                {
-                    logger.logWarning("Read timeout on UDP socket (in " + functionName + "). Retry read...");
-                    continue;
-                }
-                else if (writeAttemptCnt <= udpRetransmitCnt)
-                {
-                    logger.logWarning("Read timeout on UDP socket (in " + functionName + "). Retry write...");
-                    break;
-                }
-                else
-                    throw std::runtime_error("Read timeout.");
-            }
+    const std::lock_guard<std::mutex> subscriptionsLock(fifoSubscriptionsMutex);
+    (void)subscriptionsLock;
 
-            //Read response message
-            const std::vector<std::uint8_t> response = udpSocketWrapperPtr->read();
+    fifoSubscriptions.push_back(subscription);
+    numFifoSubscriptions.store(fifoSubscriptions.size());
 
-            //Check if responded message equals sent request
+    return subscription;
+}
 
-            if (response.size() < 8)
-                throw std::runtime_error("Received invalid RBCP message.");
+//
 
-            const auto rbcpStatus = std::span<const std::uint8_t, 8>(response.begin(), 8);
+/*!
+ * \brief Get the current link statistics counters.
+ *
+ * Returns a snapshot of the counters for the received FIFO data and the performed RBCP transactions (see Statistics).
+ * The counters are updated atomically but independently of each other, i.e. they are not necessarily consistent
+ * with each other if data is received or transactions are performed while calling this function.
+ *
+ * \return Current statistics.
+ */
+SiTCP::Statistics SiTCP::getStatistics() const
+{
+    Statistics retVal {};
 
-            //Try to read again if "just" message ID is wrong as correct response message could be still pending
-            if (rbcpStatus[2] != rbcpId)
-            {
-                if (readAttemptCnt <= udpRetransmitCnt)
-                {
-                    logger.logWarning("Received RBCP message has wrong ID (in " + functionName + "). Retry read...");
-                    continue;
-                }
-                else if (writeAttemptCnt <= udpRetransmitCnt)
-                {
-                    logger.logWarning("Received RBCP message has wrong ID (in " + functionName + "). Retry write...");
-                    break;
-                }
-                else
-                    throw std::runtime_error("Received RBCP message has wrong ID.");
-            }
+    retVal.fifoBytesReceived = statistics.fifoBytesReceived.load();
+    retVal.fifoHighWaterMark = getFifoHighWaterMark();
+    retVal.fifoOverflows = statistics.fifoOverflows.load();
+    retVal.fifoBytesDropped = statistics.fifoBytesDropped.load();
+    retVal.rbcpTransactions = statistics.rbcpTransactions.load();
+    retVal.rbcpRetries = statistics.rbcpRetries.load();
+    retVal.rbcpWrongIdResponses = statistics.rbcpWrongIdResponses.load();
+    retVal.rbcpLateResponses = statistics.rbcpLateResponses.load();
 
-            if (rbcpStatus[0] != rbcpVerType)
-                throw std::runtime_error("Received RBCP message shows invalid RBCP version.");
+    for (std::size_t i = 0; i < rbcpLatencyHistogramBins; ++i)
+        retVal.rbcpLatencyHistogram[i] = statistics.rbcpLatencyHistogram[i].load();
 
-            if ((rbcpStatus[1] & 0b10111110u) != 0b10001000u)
-                throw std::runtime_error("Received RBCP message has invalid status byte.");
+    return retVal;
+}
 
-            std::bitset<8> statusBits(rbcpStatus[1]);
+//Private
 
-            if (statusBits[0])
-                throw std::runtime_error("Received RBCP message signals RBCP bus error.");
+/*!
+ * \copybrief MuxedInterface::initImpl()
+ *
+ * Connects the %UDP socket and, if %TCP is enabled (see SiTCP()), the %TCP socket to the configured host name
+ * using the respective configured ports.
+ *
+ * If %TCP is enabled, resets the FIFO and starts continuously reading the incoming FIFO data asynchronously (see resetFifo()),
+ * such that the data is added to the FIFO as soon as it arrives (see also handleFifoData()). If writing the FIFO data to
+ * files is enabled (see SiTCP()), the next data file is opened before.
+ * Furthermore, if also "tcp_to_bus" is enabled, configures the %SiTCP core accordingly by calling enableTcpToBus().
+ *
+ * Starts a new session file if recording is enabled (see SiTCP()).
+ *
+ * Starts listening for event notifications if enabled (see SiTCP()).
+ *
+ * \return True if successful.
+ */
+bool SiTCP::initImpl()
+{
+    try
+    {
+        udpSocketWrapperPtr->init(connectTimeout);
 
-            if (statusBits[6] != (operationType == RBCPOperation::Read))
-                throw std::runtime_error("Received RBCP message R/W type does not match current operation.");
+        if (useTcp)
+        {
+            if (tcpSocketWrapperPtr)
+                tcpSocketWrapperPtr->init(connectTimeout);
+            else
+                throw std::runtime_error("Undefined TCP socket. THIS SHOULD NEVER HAPPEN!");
+        }
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(std::string("Could not connect socket: ") + exc.what());
+        return false;
+    }
 
-            if (rbcpStatus[3] != request[3])
+    if (useTcp)
+    {
+        if (fifoFileWriterPtr)
+        {
+            try
             {
-                throw std::runtime_error("Received RBCP message has size field mismatch. Size: " +
-                                         std::to_string(request[3]) + " (expected), " +
-                                         std::to_string(rbcpStatus[3]) + " (received).");
+                fifoFileWriterPtr->open();
+                fifoDumpFailed = false;
             }
-
-            if (!std::equal(rbcpStatus.begin()+4, rbcpStatus.end(), request.begin()+4, request.end()))
+            catch (const std::runtime_error& exc)
             {
-                const std::uint32_t expAddr = Bytes::composeUInt32(std::span<const std::uint8_t, 4>(request.begin()+4, 4));
-                const std::uint32_t recAddr = Bytes::composeUInt32(std::span<const std::uint8_t, 4>(rbcpStatus.begin()+4, 4));
-
-                throw std::runtime_error("Received RBCP message has address mismatch. Address: " +
-                                         Bytes::formatHex(expAddr) + " (expected), " +
-                                         Bytes::formatHex(recAddr) + " (received).");
+                logger.logError(std::string("Could not open FIFO data file: ") + exc.what());
+                return false;
             }
+        }
 
-            const std::size_t expectedSize = ((operationType == RBCPOperation::Read) ? (extractSize() + 8) : request.size());
-
-            if (response.size() != expectedSize)
+        if (fifoShmWriterPtr)
+        {
+            try
             {
-                throw std::runtime_error("Received RBCP message has invalid size. Size: " +
-                                         std::to_string(expectedSize) + " (expected), " +
-                                         std::to_string(response.size()) + " (received).");
+                fifoShmWriterPtr->open();
+                fifoShmFailed = false;
             }
-
-            const auto rbcpData = std::span<const std::uint8_t>(response.begin()+8, response.end());
-
-            if (operationType == RBCPOperation::Write)
+            catch (const std::runtime_error& exc)
             {
-                const std::vector<std::uint8_t>& pData = extractData();
-
-                if (!std::equal(rbcpData.begin(), rbcpData.end(), pData.begin(), pData.end()))
-                {
-                    std::vector<std::uint8_t> recData(rbcpData.begin(), rbcpData.end());
-
-                    throw std::runtime_error("Received RBCP message has invalid data. Data: " +
-                                             Bytes::formatByteVec(pData) + " (expected), " +
-                                             Bytes::formatByteVec(recData) + " (received).");
-                }
+                logger.logError(std::string("Could not create shared-memory FIFO ring: ") + exc.what());
+                return false;
             }
+        }
 
-            checkAndClearReadBuffer("after completing receive operation");
-
-            if (operationType == RBCPOperation::Read)
-                return std::vector<std::uint8_t>(rbcpData.begin(), rbcpData.end());
-            else
-                return std::nullopt;
+        try
+        {
+            pollFIFO.store(true);
 
-        } // read attempts loop
+            resetFifo();
+        }
+        catch (const std::runtime_error& exc)
+        {
+            pollFIFO.store(false);
+            logger.logError(std::string("Could not start FIFO reading: ") + exc.what());
+            return false;
+        }
 
-        if (writeAttemptCnt > udpRetransmitCnt)
-            throw std::runtime_error("Exceeded number of write attempts without throwing exception. THIS SHOULD NEVER HAPPEN!");
+        if (useTcpToBus)
+        {
+            try
+            {
+                enableTcpToBus();
+            }
+            catch (const std::runtime_error& exc)
+            {
+                logger.logError(std::string("Could not enable \"tcp_to_bus\" feature: ") + exc.what());
+                return false;
+            }
+        }
+    }
 
-    } // write attempts loop
+    if (sessionRecorderPtr)
+    {
+        try
+        {
+            sessionRecorderPtr->open();
+        }
+        catch (const std::runtime_error& exc)
+        {
+            logger.logError(std::string("Could not start session recording: ") + exc.what());
+            return false;
+        }
+    }
 
-    throw std::runtime_error("Reached end of function. THIS SHOULD NEVER HAPPEN!");
+    if (eventListenerPtr)
+    {
+        try
+        {
+            eventListenerPtr->start([this](const std::uint32_t pSourceAddr, const std::span<const std::uint8_t> pPayload) -> void
+                                    {
+                                        publishEvent(pSourceAddr, pPayload);
+                                    });
+        }
+        catch (const std::runtime_error& exc)
+        {
+            logger.logError(std::string("Could not start event notification listener: ") + exc.what());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \copybrief MuxedInterface::closeImpl()
+ *
+ * If %TCP is enabled, stops the continuous FIFO reading started by initImpl() and disconnects the %TCP socket.
+ * If writing the FIFO data to files is enabled (see SiTCP()), writes the remaining data and closes the data file.
+ * Closes the session file if recording is enabled (see SiTCP()).
+ *
+ * Stops listening for event notifications if enabled (see SiTCP()). Disconnects the %UDP socket.
+ *
+ * \return True if successful.
+ */
+bool SiTCP::closeImpl()
+{
+    bool fileCloseFailed = false;
+
+    try
+    {
+        if (useTcp)
+        {
+            const std::lock_guard<std::mutex> socketLock(tcpSocketMutex);
+            (void)socketLock;
+
+            pollFIFO.store(false);
+
+            try
+            {
+                if (tcpSocketWrapperPtr)
+                    tcpSocketWrapperPtr->stopAsyncReads();
+            }
+            catch (const std::runtime_error& exc)
+            {
+                logger.logWarning(std::string("Could not stop FIFO reading: ") + exc.what());
+            }
+
+            if (fifoFileWriterPtr)
+            {
+                try
+                {
+                    fifoFileWriterPtr->close();
+                }
+                catch (const std::runtime_error& exc)
+                {
+                    logger.logError(std::string("Could not close FIFO data file: ") + exc.what());
+                    fileCloseFailed = true;
+                }
+            }
+
+            if (fifoShmWriterPtr)
+                fifoShmWriterPtr->close();
+        }
+
+        if (eventListenerPtr)
+            eventListenerPtr->stop();
+
+        udpSocketWrapperPtr->close();
+
+        if (tcpSocketWrapperPtr)
+            tcpSocketWrapperPtr->close();
+
+        if (sessionRecorderPtr)
+        {
+            if (sessionRecorderPtr->hasFailed())
+            {
+                logger.logError("Session recording stopped early because writing the session file failed.");
+                fileCloseFailed = true;
+            }
+
+            try
+            {
+                sessionRecorderPtr->close();
+            }
+            catch (const std::runtime_error& exc)
+            {
+                logger.logError(std::string("Could not finish session recording: ") + exc.what());
+                fileCloseFailed = true;
+            }
+        }
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(std::string("Could not close socket connection: ") + exc.what());
+        return false;
+    }
+
+    return !fileCloseFailed;
+}
+
+//
+
+/*!
+ * \brief Estimate the component-specific heap memory usage.
+ *
+ * Reports the following categories (see also LayerBase::getMemoryUsage()):
+ * - "fifo": Word storage of the FIFO buffer (zero if using a memory-mapped file, see SiTCP()).
+ * - "fifo_chunks": Metadata of the FIFO data chunks (see consumeFifoChunks()).
+ * - "fifo_subscriptions": Buffers of the existing FIFO subscriptions (see subscribeFifo()).
+ * - "rbcp_buffers": Reusable RBCP message buffers.
+ * - "tcp_read_buffer": Buffer for reading FIFO data from the %TCP socket (zero if %TCP is not used).
+ *
+ * \return Estimated numbers of allocated bytes by category.
+ */
+std::map<std::string, std::size_t> SiTCP::getMemoryUsageImpl() const
+{
+    std::size_t fifoBytes = 0;
+
+    {
+        const std::lock_guard<std::mutex> bufferLock(fifoMutex);
+        (void)bufferLock;
+
+        if (!fifoBufferPtr->isFileBacked())
+            fifoBytes = fifoBufferPtr->getCapacity() * sizeof(std::uint32_t);
+    }
+
+    std::size_t fifoChunkBytes = 0;
+
+    {
+        const std::lock_guard<std::mutex> chunksLock(fifoChunksMutex);
+        (void)chunksLock;
+
+        fifoChunkBytes = fifoChunks.size() * sizeof(FifoChunkInfo);
+    }
+
+    std::size_t fifoSubscriptionBytes = 0;
+
+    {
+        const std::lock_guard<std::mutex> subscriptionsLock(fifoSubscriptionsMutex);
+        (void)subscriptionsLock;
+
+        for (const std::weak_ptr<SiTCPFifoSubscription>& weakSubscription : fifoSubscriptions)
+            if (const std::shared_ptr<SiTCPFifoSubscription> subscription = weakSubscription.lock())
+                fifoSubscriptionBytes += subscription->getCapacity();
+    }
+
+    std::size_t rbcpBytes = 0;
+
+    {
+        const std::lock_guard<std::mutex> rbcpLock(rbcpMutex);
+        (void)rbcpLock;
+
+        rbcpBytes = rbcpRequestBuffer.capacity() + rbcpResponseBuffer.capacity();
+    }
+
+    return {{"fifo", fifoBytes}, {"fifo_chunks", fifoChunkBytes}, {"fifo_subscriptions", fifoSubscriptionBytes}, {"rbcp_buffers", rbcpBytes},
+            {"tcp_read_buffer", (useTcp ? tcpReadBufferSize : 0)}};
+}
+
+//
+
+/*!
+ * \brief Enable using %TCP protocol for normal bus writes.
+ *
+ * Configures the %SiTCP core for receiving normal basil bus writes via %TCP (the "tcp_to_bus" feature)
+ * by writing the reset sequence <tt>{65535 * 0xFF + 6 * 0x00}</tt> (see SiTCP) to the %TCP socket.
+ *
+ * Returns immediately if "tcp_to_bus" is not enabled.
+ *
+ * \throws std::runtime_error If writing to the %TCP socket fails.
+ */
+void SiTCP::enableTcpToBus()
+{
+    if (!tcpSocketWrapperPtr)
+    {
+        if (useTcpToBus)
+            throw std::runtime_error("Undefined TCP socket. THIS SHOULD NEVER HAPPEN!");
+        else
+            logger.logWarning("Cannot use \"tcp_to_bus\" feature: \"tcp_to_bus\" is not enabled.");
+
+        return;
+    }
+
+    try
+    {
+        tcpSocketWrapperPtr->write(std::vector<std::uint8_t>(65535, 255));
+        tcpSocketWrapperPtr->write(std::vector<std::uint8_t>(6, 0));
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error(std::string("Could not write sequence to enable \"tcp_to_bus\": ") + exc.what());
+    }
+}
+
+/*!
+ * \brief Re-establish a lost %TCP connection and restart the FIFO reading.
+ *
+ * Does nothing if the %TCP connection was not lost or reconnecting is disabled (see SiTCP() and
+ * CommonImpl::TCPSocketWrapper::isReconnectRequired()). Otherwise stops the continuous FIFO reading,
+ * re-establishes the connection (see CommonImpl::TCPSocketWrapper::reconnectIfLost()) and then restarts the
+ * FIFO reading by calling resetFifo(). If "tcp_to_bus" is enabled, the %SiTCP core is configured again by
+ * calling enableTcpToBus(). Only the %TCP connection is affected; the interface stays initialized.
+ *
+ * Errors are logged and not propagated.
+ *
+ * \return True if the connection was re-established.
+ */
+bool SiTCP::tryReconnectTcp()
+{
+    if (!tcpSocketWrapperPtr || !tcpSocketWrapperPtr->isReconnectRequired())
+        return false;
+
+    try
+    {
+        {
+            const std::lock_guard<std::mutex> socketLock(tcpSocketMutex);
+            (void)socketLock;
+
+            tcpSocketWrapperPtr->stopAsyncReads();
+
+            if (!tcpSocketWrapperPtr->reconnectIfLost())
+                return false;
+        }
+
+        resetFifo();
+
+        if (useTcpToBus)
+            enableTcpToBus();
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(std::string("Could not reconnect TCP socket: ") + exc.what());
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Write to the %TCP socket, repeated once after re-establishing a lost connection.
+ *
+ * Writes the buffer sequence \p pBuffers to the %TCP socket. If this fails due to a lost connection and the
+ * connection can be re-established (see tryReconnectTcp()), the write is repeated once on the new connection.
+ *
+ * \throws std::runtime_error If the %TCP socket is undefined or the write fails.
+ *
+ * \param pBuffers Data buffers to be written.
+ */
+void SiTCP::writeTcp(const std::span<const std::span<const std::uint8_t>> pBuffers)
+{
+    if (!tcpSocketWrapperPtr)
+        throw std::runtime_error("Undefined TCP socket. THIS SHOULD NEVER HAPPEN!");
+
+    const std::lock_guard<std::mutex> writeLock(tcpWriteMutex);
+    (void)writeLock;
+
+    writeTcpUnlocked(pBuffers);
+}
+
+/*!
+ * \brief Write to the %TCP socket without locking the mutex.
+ *
+ * Works like writeTcp() but requires \ref tcpWriteMutex to be locked by the caller.
+ *
+ * \throws std::runtime_error If the write fails.
+ *
+ * \param pBuffers Data buffers to be written.
+ */
+void SiTCP::writeTcpUnlocked(const std::span<const std::span<const std::uint8_t>> pBuffers)
+{
+    try
+    {
+        tcpSocketWrapperPtr->writeGather(pBuffers);
+    }
+    catch (const std::runtime_error&)
+    {
+        if (!tryReconnectTcp())
+            throw;
+
+        tcpSocketWrapperPtr->writeGather(pBuffers);
+    }
+}
+
+//
+
+/*!
+ * \brief Add FIFO data read from the %TCP socket to the FIFO buffer.
+ *
+ * Handler for the continuous asynchronous reading of the %TCP socket (see initImpl() / resetFifo()),
+ * which appends \p pData to the FIFO buffer and then calls the FIFO data notifier (see setFifoDataNotifier()).
+ *
+ * In lock-free FIFO mode (see SiTCP()) the data is added to the FIFO buffer without locking \ref fifoMutex.
+ * Only the data fitting into the FIFO buffer is added then. The remaining data is passed again later
+ * and the socket is not read again until it was added.
+ *
+ * The same applies to the configured FIFO size limit with overflow policy "block". With policy "drop_oldest"
+ * the oldest buffered words are dropped instead as needed to stay below the limit (see SiTCP()).
+ *
+ * If FIFO subscriptions exist (see subscribeFifo()), the data is copied to those instead (see addFifoData()).
+ *
+ * If writing the FIFO data to files is enabled (see SiTCP()), the data is passed to the file writer instead.
+ * If writing fails, the data is discarded and an error is logged (only once until the next init()).
+ * The same applies to publishing the FIFO data to a shared-memory ring (see SiTCP()).
+ *
+ * \param pData New FIFO data.
+ * \return Number of bytes from \p pData that were added to the FIFO.
+ */
+std::size_t SiTCP::handleFifoData(const std::span<const std::uint8_t> pData)
+{
+    std::size_t numAdded = 0;
+
+    if (fifoFileWriterPtr)
+    {
+        try
+        {
+            fifoFileWriterPtr->write(pData);
+        }
+        catch (const std::runtime_error& exc)
+        {
+            if (!fifoDumpFailed)
+                logger.logError(std::string("Could not write FIFO data to file; discarding data: ") + exc.what());
+
+            fifoDumpFailed = true;
+        }
+
+        statistics.fifoBytesReceived += pData.size();
+
+        return pData.size();
+    }
+
+    if (fifoShmWriterPtr)
+    {
+        try
+        {
+            fifoShmWriterPtr->write(pData);
+        }
+        catch (const std::runtime_error& exc)
+        {
+            if (!fifoShmFailed)
+                logger.logError(std::string("Could not publish FIFO data to shared memory; discarding data: ") + exc.what());
+
+            fifoShmFailed = true;
+        }
+
+        statistics.fifoBytesReceived += pData.size();
+
+        return pData.size();
+    }
+
+    numAdded = addFifoData(pData);
+
+    statistics.fifoBytesReceived += numAdded;
+
+    if (numAdded > 0)
+    {
+        const std::lock_guard<std::mutex> notifierLock(fifoDataNotifierMutex);
+        (void)notifierLock;
+
+        if (fifoDataNotifier)
+            fifoDataNotifier();
+    }
+
+    return numAdded;
+}
+
+/*!
+ * \brief Add FIFO data to the FIFO buffer or to the FIFO subscriptions.
+ *
+ * Appends \p pData to the FIFO buffer as described for handleFifoData(). If FIFO subscriptions exist (see subscribeFifo()),
+ * \p pData is instead copied to every subscription (see SiTCPFifoSubscription) and the FIFO buffer is left untouched.
+ *
+ * The subscriptions are only locked if there are any (see \ref numFifoSubscriptions), so that the lock-free FIFO mode
+ * stays lock-free without subscriptions.
+ *
+ * Note: Must only be called from handleFifoData().
+ *
+ * \param pData New FIFO data.
+ * \return Number of bytes from \p pData that were added.
+ */
+std::size_t SiTCP::addFifoData(const std::span<const std::uint8_t> pData)
+{
+    const std::chrono::steady_clock::time_point timestamp = std::chrono::steady_clock::now();
+
+    if (numFifoSubscriptions.load() > 0)
+    {
+        const std::lock_guard<std::mutex> subscriptionsLock(fifoSubscriptionsMutex);
+        (void)subscriptionsLock;
+
+        std::erase_if(fifoSubscriptions, [](const std::weak_ptr<SiTCPFifoSubscription>& pSubscription) -> bool
+                                         { return pSubscription.expired(); });
+
+        numFifoSubscriptions.store(fifoSubscriptions.size());
+
+        if (!fifoSubscriptions.empty())
+        {
+            for (const std::weak_ptr<SiTCPFifoSubscription>& weakSubscription : fifoSubscriptions)
+            {
+                if (const std::shared_ptr<SiTCPFifoSubscription> subscription = weakSubscription.lock())
+                {
+                    const std::size_t numDropped = subscription->addData(pData, fifoStreamOffset);
+
+                    if (numDropped > 0)
+                    {
+                        ++statistics.fifoOverflows;
+                        statistics.fifoBytesDropped += numDropped;
+                    }
+                }
+            }
+
+            fifoStreamOffset += pData.size();
+
+            return pData.size();
+        }
+    }
+
+    std::size_t numAdded = 0;
+
+    if (useLockFreeFifo)
+    {
+        numAdded = fifoBufferPtr->pushBytes(pData);     //Single producer, hence no locking required
+        recordFifoChunk(timestamp);
+    }
+    else
+    {
+        const std::lock_guard<std::mutex> bufferLock(fifoMutex);
+        (void)bufferLock;
+
+        std::span<const std::uint8_t> data = pData;
+
+        if (fifoMaxSize > 0)
+        {
+            const std::size_t size = fifoBufferPtr->getSize();
+
+            std::size_t maxSize = fifoMaxSize;
+
+            if (fifoSpill && size + data.size() > fifoMaxSize && spillFifo())
+                maxSize = fifoSpillSize;
+
+            if (size + data.size() > maxSize)
+            {
+                ++statistics.fifoOverflows;
+
+                if (fifoDropOldest)
+                    statistics.fifoBytesDropped += 4 * fifoBufferPtr->discardWords((size + data.size() - maxSize + 3) / 4);
+                else
+                    data = data.first(maxSize - std::min(size, maxSize));
+            }
+        }
+
+        numAdded = fifoBufferPtr->pushBytes(data);
+        recordFifoChunk(timestamp);
+    }
+
+    fifoStreamOffset += numAdded;
+
+    return numAdded;
+}
+
+/*!
+ * \brief Throw if the FIFO data is passed to FIFO subscriptions.
+ *
+ * Checks if FIFO subscriptions exist (see subscribeFifo()), in which case the FIFO buffer does not receive any data.
+ *
+ * \throws std::runtime_error If FIFO subscriptions exist.
+ */
+void SiTCP::checkFifoNotSubscribed() const
+{
+    if (numFifoSubscriptions.load() == 0)
+        return;
+
+    const std::lock_guard<std::mutex> subscriptionsLock(fifoSubscriptionsMutex);
+    (void)subscriptionsLock;
+
+    if (std::any_of(fifoSubscriptions.begin(), fifoSubscriptions.end(),
+                    [](const std::weak_ptr<SiTCPFifoSubscription>& pSubscription) -> bool { return !pSubscription.expired(); }))
+    {
+        throw std::runtime_error("Could not read FIFO of SiTCP interface \"" + name + "\": FIFO data is passed to FIFO subscriptions "
+                                 "instead.");
+    }
+}
+
+/*!
+ * \brief Move the FIFO buffer to the spill file if not done yet.
+ *
+ * Moves the buffered FIFO data to the memory-mapped spill file (see "spill" FIFO overflow policy in SiTCP()).
+ * If this fails, an error is logged and no further attempt is made.
+ *
+ * Note: Must only be called from addFifoData() (with locked FIFO buffer).
+ *
+ * \return True if the FIFO buffer is (now) stored in the spill file.
+ */
+bool SiTCP::spillFifo()
+{
+    if (fifoBufferPtr->isFileBacked())
+        return true;
+
+    if (fifoSpillFailed)
+        return false;
+
+    try
+    {
+        fifoBufferPtr->moveToFile(fifoSpillFilePath, (fifoSpillSize + 3) / 4);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(std::string("Could not spill FIFO buffer to file; blocking FIFO instead: ") + exc.what());
+
+        fifoSpillFailed = true;
+
+        return false;
+    }
+
+    logger.logWarning("FIFO size limit reached; spilled FIFO buffer to file \"" + fifoSpillFilePath + "\".");
+
+    return true;
+}
+
+/*!
+ * \brief Record the metadata of newly completed FIFO words.
+ *
+ * Adds a chunk with \p pTimestamp and the next sequence number for the words that were completed in the FIFO buffer
+ * since the last recorded chunk (if any) and drops the metadata of chunks that were removed from the FIFO meanwhile.
+ * See also consumeFifoChunks().
+ *
+ * Note: Must only be called from addFifoData().
+ *
+ * \param pTimestamp Arrival time of the data.
+ */
+void SiTCP::recordFifoChunk(const std::chrono::steady_clock::time_point pTimestamp)
+{
+    const std::uint64_t endWord = fifoBufferPtr->getWordsPushed();
+
+    const std::lock_guard<std::mutex> chunksLock(fifoChunksMutex);
+    (void)chunksLock;
+
+    const std::uint64_t firstWord = fifoBufferPtr->getWordsPopped();
+
+    while (!fifoChunks.empty() && fifoChunks.front().endWord <= firstWord)
+        fifoChunks.pop_front();
+
+    if (endWord > (fifoChunks.empty() ? firstWord : fifoChunks.back().endWord))
+        fifoChunks.push_back({.timestamp = pTimestamp, .sequenceNumber = nextFifoChunkSeqNum++, .endWord = endWord});
+}
+
+//
+
+/*!
+ * \brief Read a bus range via RBCP into a buffer.
+ *
+ * Reads as many bytes as fit into \p pData from bus address \p pAddr, split into chunks of maximally \ref rbcpChunkSize bytes.
+ * Uses doPipelinedRBCPOperations() if more than one chunk is needed and RBCP pipelining is enabled
+ * ("init.rbcp_window" larger than 1) and subsequent readSingle() calls otherwise.
+ *
+ * \throws std::runtime_error If doPipelinedRBCPOperations() or readSingle() throw \c std::runtime_error.
+ *
+ * \param pAddr Bus address as source location for \p pData.
+ * \param pData Destination for the data read from bus address \p pAddr.
+ */
+void SiTCP::readBus(const std::uint32_t pAddr, const std::span<std::uint8_t> pData)
+{
+    if (pData.size() > rbcpChunkSize && rbcpWindowSize > 1)
+    {
+        doPipelinedRBCPOperations(pAddr, pData);
+        return;
+    }
+
+    std::uint32_t currentAddr = pAddr;
+
+    for (std::size_t offset = 0; offset < pData.size(); offset += rbcpChunkSize)
+    {
+        readSingle(currentAddr, pData.subspan(offset, std::min(rbcpChunkSize, pData.size() - offset)));
+
+        currentAddr += rbcpChunkSize;
+    }
+}
+
+/*!
+ * \brief Read from the bus with a single RBCP request/response.
+ *
+ * Writes a single RBCP read message (initiating a bus read) for address \p pAddr to the basil bus,
+ * requesting to read as many bytes as fit into \p pData. Waits for the response message and
+ * copies the read byte sequence from it to \p pData.
+ *
+ * See doSingleRBCPOperation() in "read mode" for further details.
+ *
+ * \throws std::runtime_error If the size of \p pData exceeds the maximum RBCP data length.
+ * \throws std::runtime_error If an invalid/wrong/non-matching RBCP response message was received.
+ * \throws std::runtime_error If reading/writing from/to the %UDP socket time out too often (exceeded retry limit).
+ * \throws std::runtime_error If reading/writing from/to the %UDP socket fails due to non-timeout reasons.
+ *
+ * \param pAddr Bus address as source location for \p pData.
+ * \param pData Destination for the data read from bus address \p pAddr.
+ */
+void SiTCP::readSingle(const std::uint32_t pAddr, const std::span<std::uint8_t> pData)
+{
+    doSingleRBCPOperation(pAddr, pData);
+}
+
+/*!
+ * \brief Write to the bus with a single RBCP request/response.
+ *
+ * Writes a single RBCP write message (initiating a bus write) for address \p pAddr to the basil bus, requesting to write \p pData.
+ * Waits for the response message in order to check that the sent message was correctly transmitted.
+ *
+ * See doSingleRBCPOperation() in "write mode" for further details.
+ *
+ * \throws std::runtime_error If length of \p pData exceeds the maximum RBCP data length.
+ * \throws std::runtime_error If an invalid/wrong/non-matching RBCP response message was received.
+ * \throws std::runtime_error If reading/writing from/to the %UDP socket time out too often (exceeded retry limit).
+ * \throws std::runtime_error If reading/writing from/to the %UDP socket fails due to non-timeout reasons.
+ *
+ * \param pAddr Bus address as destination for writing \p pData.
+ * \param pData Data to be written to bus address \p pAddr.
+ */
+void SiTCP::writeSingle(const std::uint32_t pAddr, const std::span<const std::uint8_t> pData)
+{
+    doSingleRBCPOperation(pAddr, pData);
+}
+
+//
+
+/*!
+ * \brief Send a single RBCP read or write request to the bus and process the response message.
+ *
+ * Writes a single RBCP read \e or write message (depending on the type in \p pReadOrWriteData) to the %SiTCP core.
+ * This message initiates a read/write from/to the basil bus at bus address \p pAddr, respectively.
+ * In case of "read mode", \p pReadOrWriteData is the destination for the bytes to read (its size being the number of bytes to read).
+ * In case of "write mode", \p pReadOrWriteData specifies the byte sequence to be written.
+ *
+ * Waits for the response message in order to check that the sent message was correctly transmitted and, in case of "read mode",
+ * to receive the data that was requested to be read, which will be copied to \p pReadOrWriteData.
+ *
+ * The request and response messages are composed/received in the reusable buffers \ref rbcpRequestBuffer and
+ * \ref rbcpResponseBuffer such that no memory is allocated per transaction.
+ *
+ * See SiTCP for detailed protocol information.
+ *
+ * Note: Uses timeout \ref udpTimeout for every socket write and getRBCPResponseTimeout() for every socket read
+ * and retries every timed out read and write \ref udpRetransmitCnt times.
+ *
+ * Implemented via tryDoSingleRBCPOperation(), whose returned error is thrown (see Error::raise()).
+ *
+ * \throws std::runtime_error If the size of \p pReadOrWriteData exceeds the maximum RBCP data length.
+ * \throws std::runtime_error If an invalid/wrong/non-matching RBCP response message was received.
+ * \throws std::runtime_error If reading from the %UDP socket times out more than \ref udpRetransmitCnt times.
+ * \throws std::runtime_error If writing to the %UDP socket times out more than \ref udpRetransmitCnt times.
+ * \throws std::runtime_error If reading/writing from/to the %UDP socket fails due to non-timeout reasons.
+ *
+ * \param pAddr Bus address as source/target location for reading/writing \p pReadOrWriteData.
+ * \param pReadOrWriteData Either destination for the data to be read from ("read mode") or data to be written to ("write mode")
+ *                         bus address \p pAddr.
+ */
+void SiTCP::doSingleRBCPOperation(const std::uint32_t pAddr, const std::variant<std::span<std::uint8_t>,
+                                                                                std::span<const std::uint8_t>> pReadOrWriteData)
+{
+    tryDoSingleRBCPOperation(pAddr, pReadOrWriteData).value();
+}
+
+/*!
+ * \brief Send a single RBCP read or write request and process the response without throwing.
+ *
+ * Works like doSingleRBCPOperation() but returns the expected failures as Error instead of throwing them:
+ * - Error::Code::Timeout: Reading from/writing to the %UDP socket timed out more than \ref udpRetransmitCnt times.
+ * - Error::Code::Protocol: An invalid/wrong/non-matching RBCP response message was received.
+ * - Error::Code::Failure: The size of \p pReadOrWriteData exceeds the maximum RBCP data length.
+ *
+ * The error messages are the same as the exception messages of doSingleRBCPOperation().
+ *
+ * \throws std::runtime_error If reading/writing from/to the %UDP socket fails due to non-timeout reasons.
+ *
+ * \param pAddr Bus address as source/target location for reading/writing \p pReadOrWriteData.
+ * \param pReadOrWriteData Either destination for the data to be read from ("read mode") or data to be written to ("write mode")
+ *                         bus address \p pAddr.
+ * \return Nothing or the error that occurred.
+ */
+casil::Expected<void> SiTCP::tryDoSingleRBCPOperation(const std::uint32_t pAddr,
+                                                      const std::variant<std::span<std::uint8_t>, std::span<const std::uint8_t>> pReadOrWriteData)
+{
+    enum class RBCPOperation { Read, Write };
+    const RBCPOperation operationType = (std::holds_alternative<std::span<std::uint8_t>>(pReadOrWriteData) ?
+                                             RBCPOperation::Read : RBCPOperation::Write);
+
+    const std::size_t dataSize = std::visit([](const auto& pSpan) -> std::size_t { return pSpan.size(); }, pReadOrWriteData);
+
+    if (operationType == RBCPOperation::Read && dataSize > rbcpChunkSize)
+        return Error(Error::Code::Failure, "Requested read data length exceeds maximum RBCP data length.");
+    else if (operationType == RBCPOperation::Write && dataSize > rbcpChunkSize)
+        return Error(Error::Code::Failure, "Length of passed data exceeds maximum RBCP data length.");
+
+    const std::string functionName = ((operationType == RBCPOperation::Read) ? "readSingle()" : "writeSingle()");
+
+    //Serialize transactions of concurrent callers (message ID, UDP socket and RTT estimation are shared)
+    const std::lock_guard<std::mutex> rbcpLock(rbcpMutex);
+    (void)rbcpLock;
+
+    Tracer::Scope trace(traceSource, (operationType == RBCPOperation::Read) ? Tracer::Event::RBCPRead : Tracer::Event::RBCPWrite, pAddr,
+                        static_cast<std::uint32_t>(dataSize));
+
+    //Retry counter is only modified while holding the RBCP lock, hence the difference counts this transaction's retries only
+    const std::uint64_t retriesBefore = statistics.rbcpRetries;
+
+    //Compose request in reusable buffer (capacity reserved for maximum message size in constructor, hence no allocation)
+    std::vector<std::uint8_t>& request = rbcpRequestBuffer;
+    request.clear();
+
+    if (operationType == RBCPOperation::Read)
+        composeRBCPHeader(request, true, pAddr, dataSize);
+    else // if (operationType == RBCPOperation::Write)
+    {
+        const std::span<const std::uint8_t> pData = std::get<std::span<const std::uint8_t>>(pReadOrWriteData);
+
+        composeRBCPHeader(request, false, pAddr, dataSize);
+        request.insert(request.end(), pData.begin(), pData.end());
+    }
+
+    //Responses to all sent message IDs stay awaited, i.e. a late response to an already retransmitted request is used as well
+    CommonImpl::RBCPDispatcher::Ticket ticket(*rbcpDispatcherPtr);
+
+    int writeAttemptCnt = 0;
+    int readTimeoutCnt = 0;
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    for (;;)
+    {
+        std::uint8_t& currentRbcpId = request[2];
+
+        currentRbcpId = nextRBCPId();
+
+        ++writeAttemptCnt;
+
+        ticket.expect(currentRbcpId, rbcpResponseBuffer);
+
+        bool writeTimedOut = false;
+
+        const auto requestTime = std::chrono::steady_clock::now();
+
+        try
+        {
+            udpSocketWrapperPtr->write(request, udpTimeout, writeTimedOut);
+        }
+        catch (const std::runtime_error&)
+        {
+            if (writeTimedOut && writeAttemptCnt <= udpRetransmitCnt)                       // cppcheck-suppress knownConditionTrueFalse
+            {
+                ++statistics.rbcpRetries;
+                logger.logRateLimited(Logger::LogLevel::Warning,
+                                      "Write timeout on UDP socket (in {}). Retry write...", functionName);
+                continue;
+            }
+            else if (writeTimedOut)                                                         // cppcheck-suppress knownConditionTrueFalse
+                return Error(Error::Code::Timeout, "Write timeout.");
+            else
+                throw;  //Rethrow for unknown non-timeout exceptions
+        }
+
+        int readAttemptCnt = 0;
+
+        for (;;)
+        {
+            ++readAttemptCnt;
+
+            //Wait for the response message (routed by message ID; stray datagrams are discarded by the dispatcher)
+            const std::optional<CommonImpl::RBCPDispatcher::Response> routedResponse =
+                    ticket.wait(std::chrono::steady_clock::now() + getRBCPResponseTimeout(readTimeoutCnt));
+
+            if (!routedResponse.has_value())
+            {
+                ++readTimeoutCnt;
+
+                if (readAttemptCnt <= udpRetransmitCnt)
+                {
+                    ++statistics.rbcpRetries;
+                    logger.logRateLimited(Logger::LogLevel::Warning,
+                                          "Read timeout on UDP socket (in {}). Retry read...", functionName);
+                    continue;
+                }
+                else if (writeAttemptCnt <= udpRetransmitCnt)
+                {
+                    ++statistics.rbcpRetries;
+                    logger.logRateLimited(Logger::LogLevel::Warning,
+                                          "Read timeout on UDP socket (in {}). Retry write...", functionName);
+                    break;
+                }
+                else
+                    return Error(Error::Code::Timeout, "Read timeout.");
+            }
+
+            //Buffer is one byte larger than any valid response such that oversized responses get detected by checkRBCPResponse()
+            const std::span<const std::uint8_t> response(rbcpResponseBuffer.data(), routedResponse->size);
+
+            //Check if responded message equals sent request
+
+            if (response.size() < rbcpMsgHeaderSize)
+                return Error(Error::Code::Protocol, "Received invalid RBCP message.");
+
+            try
+            {
+                checkRBCPResponse(request, response);
+            }
+            catch (const std::runtime_error& exc)
+            {
+                return Error(Error::Code::Protocol, [message = std::string(exc.what())]() { return message; });
+            }
+
+            //Only use unambiguous round-trip times without any timeouts (compare Karn's algorithm)
+            if (readTimeoutCnt == 0 && writeAttemptCnt == 1)
+                updateRBCPRoundTripTime(std::chrono::steady_clock::now() - requestTime);
+
+            recordRBCPTransaction(std::chrono::steady_clock::now() - startTime);
+
+            trace.setRetries(static_cast<int>(statistics.rbcpRetries - retriesBefore));
+            trace.setTransactionId(routedResponse->id);
+
+            if (operationType == RBCPOperation::Read)
+                std::copy(response.begin()+rbcpMsgHeaderSize, response.end(), std::get<std::span<std::uint8_t>>(pReadOrWriteData).begin());
+
+            return {};
+
+        } // read attempts loop
+
+        if (writeAttemptCnt > udpRetransmitCnt)
+            throw std::runtime_error("Exceeded number of write attempts without throwing exception. THIS SHOULD NEVER HAPPEN!");
+
+    } // write attempts loop
+
+    throw std::runtime_error("Reached end of function. THIS SHOULD NEVER HAPPEN!");
+}
+
+/*!
+ * \brief Send RBCP read or write requests for a larger bus range while keeping multiple requests in flight.
+ *
+ * Splits the read/write operation (depending on the type in \p pReadOrWriteData) starting at bus address \p pAddr into
+ * chunks of maximally \ref rbcpChunkSize bytes, like read() / write() would do for subsequent single RBCP operations
+ * (see doSingleRBCPOperation()). However, instead of waiting for each response before sending the next request,
+ * keeps up to \ref rbcpWindowSize requests in flight, using the RBCP message ID to match the responses to the
+ * requests (also out of order). Requests whose response is not received in time (see getRBCPResponseTimeout()) are retransmitted
+ * (with a new message ID), up to \ref udpRetransmitCnt times per request.
+ *
+ * Note that the order in which the bus accesses are performed is not guaranteed in case of datagram loss or reordering.
+ *
+ * See SiTCP for detailed protocol information.
+ *
+ * \throws std::runtime_error If an invalid/wrong RBCP response message was received (see checkRBCPResponse()).
+ * \throws std::runtime_error If a request was retransmitted more than \ref udpRetransmitCnt times.
+ * \throws std::runtime_error If reading/writing from/to the %UDP socket fails due to non-timeout reasons.
+ *
+ * \param pAddr Bus address as source/target location for reading/writing \p pReadOrWriteData.
+ * \param pReadOrWriteData Either buffer for the data to be read from ("read mode") or data to be written to ("write mode")
+ *                         bus address \p pAddr.
+ */
+void SiTCP::doPipelinedRBCPOperations(const std::uint32_t pAddr,
+                                      const std::variant<std::span<std::uint8_t>, std::span<const std::uint8_t>> pReadOrWriteData)
+{
+    std::vector<RBCPTransaction> transactions;
+
+    prepareRBCPTransactions(transactions, pAddr, pReadOrWriteData);
+
+    runPipelinedRBCPTransactions(transactions);
+}
+
+/*!
+ * \brief Append the chunked RBCP read or write transactions for a bus range.
+ *
+ * Splits the bus access at \p pAddr into chunks of maximally \ref rbcpChunkSize bytes and appends an RBCPTransaction
+ * with prepared request message for each chunk to \p pTransactions (to be processed by runPipelinedRBCPTransactions()).
+ * In case of "read mode", the transactions refer to (parts of) \p pReadOrWriteData as destination for the read data.
+ * In case of "write mode", the data to be written is copied to the request messages.
+ *
+ * \param pTransactions Transactions to append to.
+ * \param pAddr Bus address as source/target location for reading/writing \p pReadOrWriteData.
+ * \param pReadOrWriteData Either buffer for the data to be read from ("read mode") or data to be written to ("write mode")
+ *                         bus address \p pAddr.
+ */
+void SiTCP::prepareRBCPTransactions(std::vector<RBCPTransaction>& pTransactions, const std::uint32_t pAddr,
+                                    const std::variant<std::span<std::uint8_t>, std::span<const std::uint8_t>> pReadOrWriteData) const
+{
+    const bool readMode = std::holds_alternative<std::span<std::uint8_t>>(pReadOrWriteData);
+
+    const std::size_t totalSize = (readMode ? std::get<std::span<std::uint8_t>>(pReadOrWriteData).size() :
+                                              std::get<std::span<const std::uint8_t>>(pReadOrWriteData).size());
+
+    const std::size_t numChunks = (totalSize + rbcpChunkSize - 1) / rbcpChunkSize;
+
+    pTransactions.reserve(pTransactions.size() + numChunks);
+
+    for (std::size_t i = 0; i < numChunks; ++i)
+    {
+        const std::uint32_t chunkAddr = pAddr + static_cast<std::uint32_t>(i * rbcpChunkSize);
+        const std::size_t chunkSize = std::min(rbcpChunkSize, totalSize - i * rbcpChunkSize);
+
+        RBCPTransaction& transaction = pTransactions.emplace_back();
+
+        if (readMode)
+        {
+            transaction.request.reserve(rbcpMsgHeaderSize);
+            composeRBCPHeader(transaction.request, true, chunkAddr, chunkSize);
+            transaction.readData = std::get<std::span<std::uint8_t>>(pReadOrWriteData).subspan(i * rbcpChunkSize, chunkSize);
+        }
+        else
+        {
+            const std::span<const std::uint8_t> chunkData = std::get<std::span<const std::uint8_t>>(pReadOrWriteData).subspan(
+                                                                                                        i * rbcpChunkSize, chunkSize);
+
+            transaction.request.reserve(rbcpMsgHeaderSize + chunkSize);
+            composeRBCPHeader(transaction.request, false, chunkAddr, chunkSize);
+            transaction.request.insert(transaction.request.end(), chunkData.begin(), chunkData.end());
+        }
+    }
+}
+
+/*!
+ * \brief Process prepared RBCP transactions while keeping multiple requests in flight.
+ *
+ * Sends the requests of \p pTransactions (see RBCPTransaction) while keeping up to \ref rbcpWindowSize requests in flight,
+ * using the RBCP message ID to match the responses to the requests (also out of order). The data of read responses is copied
+ * to RBCPTransaction::readData. Requests whose response is not received in time (see getRBCPResponseTimeout()) are retransmitted
+ * (with a new message ID), up to \ref udpRetransmitCnt times per request.
+ *
+ * The requests are sent in order. A request is not sent before RBCPTransaction::sendDelay has passed since the preceding
+ * request was first sent (even if the window is not full), which allows to delay e.g. the read requests of query().
+ *
+ * See doPipelinedRBCPOperations(), readBatch() and query().
+ *
+ * \throws std::runtime_error If an invalid/wrong RBCP response message was received (see checkRBCPResponse()).
+ * \throws std::runtime_error If a request was retransmitted more than \ref udpRetransmitCnt times.
+ * \throws std::runtime_error If reading/writing from/to the %UDP socket fails due to non-timeout reasons.
+ *
+ * \param pTransactions Transactions with prepared request messages (message IDs are assigned when sending).
+ */
+void SiTCP::runPipelinedRBCPTransactions(std::vector<RBCPTransaction>& pTransactions)
+{
+    const std::string functionName = "runPipelinedRBCPTransactions()";
+
+    const std::size_t numTransactions = pTransactions.size();
+
+    //Serialize transactions of concurrent callers (message ID, UDP socket and RTT estimation are shared)
+    const std::lock_guard<std::mutex> rbcpLock(rbcpMutex);
+    (void)rbcpLock;
+
+    CommonImpl::RBCPDispatcher::Ticket ticket(*rbcpDispatcherPtr);
+
+    //Map in-flight RBCP message IDs to the transactions
+    std::array<std::optional<std::size_t>, 256> idTransactions;
+
+    //Send/retransmit the request of a transaction using a new message ID that is currently not in flight
+    auto sendRequest = [this, &pTransactions, &idTransactions, &ticket, &functionName](const std::size_t pIdx)
+    {
+        RBCPTransaction& transaction = pTransactions[pIdx];
+
+        //Late response to a retransmitted request counts as late duplicate (bounds the number of awaited IDs by the window size)
+        if (transaction.inFlight)
+        {
+            ticket.retire(transaction.request[2]);
+            idTransactions[transaction.request[2]].reset();
+        }
+        else
+        {
+            //Buffer is one byte larger than any valid response such that oversized responses get detected by checkRBCPResponse()
+            transaction.response.resize(rbcpMsgHeaderSize + getRBCPDataLength(transaction.request) + 1);
+        }
+
+        transaction.request[2] = nextRBCPId();
+
+        idTransactions[transaction.request[2]] = pIdx;
+
+        ticket.expect(transaction.request[2], transaction.response);
+
+        ++transaction.sendCnt;
+
+        bool writeTimedOut = false;
+
+        transaction.requestTime = std::chrono::steady_clock::now();
+
+        if (transaction.sendCnt == 1)
+            transaction.firstRequestTime = transaction.requestTime;
+
+        try
+        {
+            udpSocketWrapperPtr->write(transaction.request, udpTimeout, writeTimedOut);
+        }
+        catch (const std::runtime_error&)
+        {
+            if (!writeTimedOut)                                                             // cppcheck-suppress knownConditionTrueFalse
+                throw;  //Rethrow for unknown non-timeout exceptions
+
+            logger.logRateLimited(Logger::LogLevel::Warning,
+                                  "Write timeout on UDP socket (in {}). Retry write after read timeout...", functionName);
+        }
+
+        transaction.inFlight = true;
+        transaction.deadline = std::chrono::steady_clock::now() + getRBCPResponseTimeout(transaction.sendCnt - 1);
+    };
+
+    std::size_t nextIdx = 0;
+    std::size_t numInFlight = 0;
+    std::size_t numDone = 0;
+
+    while (numDone < numTransactions)
+    {
+        //Time at which the next request may be sent (if delayed relative to the preceding request)
+        auto nextSendTime = [&pTransactions, &nextIdx]() -> std::chrono::steady_clock::time_point
+        {
+            if (nextIdx == 0 || pTransactions[nextIdx].sendDelay == std::chrono::microseconds::zero())
+                return std::chrono::steady_clock::time_point::min();
+
+            return pTransactions[nextIdx - 1].firstRequestTime + pTransactions[nextIdx].sendDelay;
+        };
+
+        //Fill the window
+        for (; numInFlight < static_cast<std::size_t>(rbcpWindowSize) && nextIdx < numTransactions &&
+               nextSendTime() <= std::chrono::steady_clock::now(); ++nextIdx, ++numInFlight)
+        {
+            sendRequest(nextIdx);
+        }
+
+        //Wait for the next response, but only until the earliest response deadline (or until the next request is due)
+
+        auto earliestDeadline = std::chrono::steady_clock::time_point::max();
+
+        if (numInFlight < static_cast<std::size_t>(rbcpWindowSize) && nextIdx < numTransactions)
+            earliestDeadline = nextSendTime();
+
+        for (const RBCPTransaction& transaction : pTransactions)
+            if (transaction.inFlight && transaction.deadline < earliestDeadline)
+                earliestDeadline = transaction.deadline;
+
+        //Responses are routed by message ID (stray datagrams and late duplicates are discarded by the dispatcher)
+        const std::optional<CommonImpl::RBCPDispatcher::Response> routedResponse = ticket.wait(earliestDeadline);
+
+        if (routedResponse.has_value())
+        {
+            const std::size_t idx = idTransactions[routedResponse->id].value();
+
+            RBCPTransaction& transaction = pTransactions[idx];
+
+            const std::span<const std::uint8_t> response(transaction.response.data(), routedResponse->size);
+
+            checkRBCPResponse(transaction.request, response);
+
+            //Only use unambiguous round-trip times without retransmissions (compare Karn's algorithm)
+            if (transaction.sendCnt == 1)
+                updateRBCPRoundTripTime(std::chrono::steady_clock::now() - transaction.requestTime);
+
+            recordRBCPTransaction(std::chrono::steady_clock::now() - transaction.firstRequestTime);
+
+            if (transaction.request[1] == rbcpCmdRd)
+                std::copy(response.begin() + rbcpMsgHeaderSize, response.end(), transaction.readData.begin());
+
+            idTransactions[routedResponse->id].reset();
+            transaction.inFlight = false;
+
+            --numInFlight;
+            ++numDone;
+
+            continue;
+        }
+
+        //Retransmit requests without response
+
+        const auto now = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0; i < numTransactions; ++i)
+        {
+            if (!pTransactions[i].inFlight || pTransactions[i].deadline > now)
+                continue;
+
+            if (pTransactions[i].sendCnt > udpRetransmitCnt)
+                throw std::runtime_error("Read timeout.");
+
+            ++statistics.rbcpRetries;
+            logger.logRateLimited(Logger::LogLevel::Warning,
+                                  "Read timeout on UDP socket (in {}). Retry write...", functionName);
+
+            sendRequest(i);
+        }
+    }
+}
+
+/*!
+ * \brief Check an RBCP response message for consistency with the corresponding request message.
+ *
+ * Checks the RBCP version, the status byte (including bus error flag and R/W type), the size and
+ * address fields and the message size of \p pResponse. For write requests also checks that the
+ * responded data matches the requested data. The message IDs are \e not compared.
+ *
+ * See SiTCP for detailed protocol information.
+ *
+ * \throws std::runtime_error If \p pResponse is invalid or does not match \p pRequest.
+ *
+ * \param pRequest Sent RBCP request message.
+ * \param pResponse Received RBCP response message.
+ */
+void SiTCP::checkRBCPResponse(const std::span<const std::uint8_t> pRequest, const std::span<const std::uint8_t> pResponse) const
+{
+    const bool readMode = (pRequest[1] == rbcpCmdRd);
+
+    if (pResponse.size() < rbcpMsgHeaderSize)
+        throw std::runtime_error("Received invalid RBCP message.");
+
+    const auto rbcpStatus = pResponse.first<8>();
+
+    if (rbcpStatus[0] != pRequest[0])
+        throw std::runtime_error("Received RBCP message shows invalid RBCP version.");
+
+    if ((rbcpStatus[1] & 0b10111110u) != 0b10001000u)
+        throw std::runtime_error("Received RBCP message has invalid status byte.");
+
+    std::bitset<8> statusBits(rbcpStatus[1]);
+
+    if (statusBits[0])
+        throw std::runtime_error("Received RBCP message signals RBCP bus error.");
+
+    if (statusBits[6] != readMode)
+        throw std::runtime_error("Received RBCP message R/W type does not match current operation.");
+
+    const std::size_t requestDataLength = getRBCPDataLength(pRequest);
+    const std::size_t responseDataLength = getRBCPDataLength(pResponse);
+
+    if (rbcpStatus[3] != pRequest[3] || responseDataLength != requestDataLength)
+    {
+        throw std::runtime_error("Received RBCP message has size field mismatch. Size: " +
+                                 std::to_string(requestDataLength) + " (expected), " +
+                                 std::to_string(responseDataLength) + " (received).");
+    }
+
+    if (!std::equal(rbcpStatus.begin()+4, rbcpStatus.end(), pRequest.begin()+4, pRequest.begin()+8))
+    {
+        const std::uint32_t expAddr = Bytes::composeUInt32(std::span<const std::uint8_t, 4>(pRequest.begin()+4, 4));
+        const std::uint32_t recAddr = Bytes::composeUInt32(std::span<const std::uint8_t, 4>(rbcpStatus.begin()+4, 4));
+
+        throw std::runtime_error("Received RBCP message has address mismatch. Address: " +
+                                 Bytes::formatHex(expAddr) + " (expected), " +
+                                 Bytes::formatHex(recAddr) + " (received).");
+    }
+
+    const std::size_t expectedSize = (readMode ? (rbcpMsgHeaderSize + requestDataLength) : pRequest.size());
+
+    if (pResponse.size() != expectedSize)
+    {
+        throw std::runtime_error("Received RBCP message has invalid size. Size: " +
+                                 std::to_string(expectedSize) + " (expected), " +
+                                 std::to_string(pResponse.size()) + " (received).");
+    }
+
+    if (!readMode && !std::equal(pResponse.begin()+rbcpMsgHeaderSize, pResponse.end(),
+                                 pRequest.begin()+rbcpMsgHeaderSize, pRequest.end()))
+    {
+        const std::vector<std::uint8_t> expData(pRequest.begin()+rbcpMsgHeaderSize, pRequest.end());
+        const std::vector<std::uint8_t> recData(pResponse.begin()+rbcpMsgHeaderSize, pResponse.end());
+
+        throw std::runtime_error("Received RBCP message has invalid data. Data: " +
+                                 Bytes::formatByteVec(expData) + " (expected), " +
+                                 Bytes::formatByteVec(recData) + " (received).");
+    }
+}
+
+/*!
+ * \brief Append an RBCP request header to a message buffer.
+ *
+ * Appends the standard RBCP header (see SiTCP) or, if the extended RBCP mode is enabled (see SiTCP()),
+ * the extended RBCP header with the 16 bit data length field to \p pMessage. The message ID is set to zero.
+ *
+ * \param pMessage Message buffer to append the header to.
+ * \param pRead Compose a read request (or a write request otherwise).
+ * \param pAddr Bus address for the request.
+ * \param pSize Data length for the request (maximally \ref rbcpChunkSize).
+ */
+void SiTCP::composeRBCPHeader(std::vector<std::uint8_t>& pMessage, const bool pRead, const std::uint32_t pAddr, const std::size_t pSize) const
+{
+    const std::uint8_t cmd = (pRead ? rbcpCmdRd : rbcpCmdWr);
+
+    if (rbcpExtendedSize > 0)
+    {
+        Bytes::composeBytesTo(std::back_inserter(pMessage), true, rbcpVerTypeExt, cmd, std::uint8_t{0}, std::uint8_t{0}, pAddr,
+                              static_cast<std::uint16_t>(pSize));
+    }
+    else
+        Bytes::composeBytesTo(std::back_inserter(pMessage), true, rbcpVerType, cmd, std::uint8_t{0}, static_cast<std::uint8_t>(pSize), pAddr);
+}
+
+/*!
+ * \brief Get the data length field of an RBCP message.
+ *
+ * Depending on whether the extended RBCP mode is enabled (see SiTCP()), returns the 8 bit data length field
+ * of the standard RBCP header or the 16 bit data length field of the extended RBCP header (see SiTCP).
+ *
+ * Note: \p pMessage must be at least \ref rbcpMsgHeaderSize bytes long.
+ *
+ * \param pMessage RBCP request or response message.
+ * \return Data length field of \p pMessage.
+ */
+std::size_t SiTCP::getRBCPDataLength(const std::span<const std::uint8_t> pMessage) const
+{
+    if (rbcpExtendedSize > 0)
+        return (static_cast<std::size_t>(pMessage[8]) << 8) | pMessage[9];
+    else
+        return pMessage[3];
+}
+
+/*!
+ * \brief Get a new RBCP message ID that is currently not awaited.
+ *
+ * Increments \ref rbcpId until it is not awaited by the RBCP dispatcher (see CommonImpl::RBCPDispatcher::isPending()).
+ * Should all IDs be awaited, the next ID is reused anyway (the response to the former request with this ID will then
+ * be counted as late duplicate).
+ *
+ * \return The new message ID (also stored as \ref rbcpId).
+ */
+std::uint8_t SiTCP::nextRBCPId()
+{
+    for (int i = 0; i < 256; ++i)
+        if (!rbcpDispatcherPtr->isPending(++rbcpId))
+            return rbcpId;
+
+    return ++rbcpId;
+}
+
+//
+
+/*!
+ * \brief Get the timeout for receiving an RBCP response.
+ *
+ * Returns \ref udpTimeout if the adaptive RBCP timeout is disabled (see SiTCP()) or if no round-trip time was measured yet.
+ *
+ * Otherwise the timeout is calculated from the smoothed round-trip time \f$ SRTT \f$ and the round-trip time variation
+ * \f$ RTTVAR \f$ (see updateRBCPRoundTripTime()) as \f$ RTO = SRTT + 4 \cdot RTTVAR \f$ (as for %TCP, see RFC 6298).
+ * For each previous timeout of the same transaction (\p pTimeoutCnt) the timeout is doubled ("exponential backoff").
+ * The result is limited to the range <tt>[\ref rbcpMinTimeout, \ref udpTimeout]</tt>.
+ *
+ * \param pTimeoutCnt Number of timeouts that already occurred for the current RBCP transaction.
+ * \return Response timeout.
+ */
+std::chrono::milliseconds SiTCP::getRBCPResponseTimeout(const int pTimeoutCnt) const
+{
+    if (!useAdaptiveRBCPTimeout || !rbcpSRTT.has_value())
+        return udpTimeout;
+
+    std::chrono::milliseconds timeout = std::chrono::ceil<std::chrono::milliseconds>(rbcpSRTT.value() + 4 * rbcpRTTVar);
+
+    for (int i = 0; i < pTimeoutCnt && timeout < udpTimeout; ++i)
+        timeout *= 2;
+
+    return std::clamp(timeout, rbcpMinTimeout, udpTimeout);
+}
+
+/*!
+ * \brief Update the RBCP round-trip time estimation.
+ *
+ * Updates the smoothed round-trip time \f$ SRTT \f$ and the round-trip time variation \f$ RTTVAR \f$ with a new
+ * measurement \p pRoundTripTime (\f$ R \f$) as for the retransmission timer of %TCP (see RFC 6298), i.e.
+ * \f$ RTTVAR = 3/4 \cdot RTTVAR + 1/4 \cdot |SRTT - R| \f$ and \f$ SRTT = 7/8 \cdot SRTT + 1/8 \cdot R \f$,
+ * or \f$ SRTT = R \f$ and \f$ RTTVAR = R/2 \f$ for the first measurement.
+ *
+ * See also getRBCPResponseTimeout().
+ *
+ * \param pRoundTripTime Measured time between sending an RBCP request and receiving its response.
+ */
+void SiTCP::updateRBCPRoundTripTime(const std::chrono::steady_clock::duration pRoundTripTime)
+{
+    const auto rtt = std::chrono::duration_cast<std::chrono::microseconds>(pRoundTripTime);
+
+    if (!rbcpSRTT.has_value())
+    {
+        rbcpSRTT = rtt;
+        rbcpRTTVar = rtt / 2;
+    }
+    else
+    {
+        const auto rttDiff = (rbcpSRTT.value() > rtt) ? (rbcpSRTT.value() - rtt) : (rtt - rbcpSRTT.value());
+
+        rbcpRTTVar = (3 * rbcpRTTVar + rttDiff) / 4;
+        rbcpSRTT = (7 * rbcpSRTT.value() + rtt) / 8;
+    }
+}
+
+/*!
+ * \brief Count a completed RBCP transaction.
+ *
+ * Increments the number of completed RBCP transactions and the RBCP latency histogram bin for \p pLatency (see Statistics).
+ *
+ * \param pLatency Time between sending the first request and receiving the valid response of the transaction.
+ */
+void SiTCP::recordRBCPTransaction(const std::chrono::steady_clock::duration pLatency)
+{
+    const auto latencyMicroSecs = std::chrono::duration_cast<std::chrono::microseconds>(pLatency).count();
+
+    std::size_t bin = 0;
+
+    if (latencyMicroSecs > 0)
+        bin = std::min(static_cast<std::size_t>(std::bit_width(static_cast<std::uint64_t>(latencyMicroSecs))) - 1, rbcpLatencyHistogramBins - 1);
+
+    ++statistics.rbcpTransactions;
+    ++statistics.rbcpLatencyHistogram[bin];
+    statistics.rbcpLatencySumMicroSecs += static_cast<std::uint64_t>(std::max<std::int64_t>(latencyMicroSecs, 0));
+}
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * \param pCapacity Initial buffer capacity in number of bytes.
+ * \param pMaxSize Maximum buffered data size in number of bytes (0 means no limit).
+ */
+SiTCPFifoSubscription::SiTCPFifoSubscription(const std::size_t pCapacity, const std::size_t pMaxSize) :
+    maxSize(pMaxSize),
+    bufferPtr(std::make_unique<CommonImpl::FIFORingBuffer>((pCapacity + 3) / 4)),
+    aligned(false),
+    skipBytes(0),
+    bytesDropped(0),
+    mutex()
+{
+}
+
+/*!
+ * \brief Destructor.
+ */
+SiTCPFifoSubscription::~SiTCPFifoSubscription() = default;
+
+//Public
+
+/*!
+ * \brief Discard the buffered data of this subscription.
+ *
+ * Removes all buffered complete words. In contrast to SiTCP::resetFifo() this does not affect the interface
+ * or other subscriptions. A partially received word is kept in order to stay aligned to the data stream.
+ */
+void SiTCPFifoSubscription::resetFifo()
+{
+    const std::lock_guard<std::mutex> bufferLock(mutex);
+    (void)bufferLock;
+
+    (void)bufferPtr->discardWords(bufferPtr->getWordCount());
+}
+
+/*!
+ * \brief Get the buffered data size in number of bytes.
+ *
+ * \return Current number of buffered bytes (see SiTCP::getFifoSize()).
+ */
+std::size_t SiTCPFifoSubscription::getFifoSize() const
+{
+    const std::lock_guard<std::mutex> bufferLock(mutex);
+    (void)bufferLock;
+
+    return bufferPtr->getSize();
+}
+
+/*!
+ * \brief Extract the buffered data as sequence of bytes.
+ *
+ * Works like SiTCP::getFifoData() for the data of this subscription.
+ *
+ * \param pSize Number of bytes to get (automatically reduced by modulo 4).
+ * \return Buffered byte sequence in multiples of 4 bytes, according to the smaller of \p pSize or buffered size.
+ */
+std::vector<std::uint8_t> SiTCPFifoSubscription::getFifoData(const int pSize)
+{
+    if (pSize == 0)
+        return {};
+
+    const std::lock_guard<std::mutex> bufferLock(mutex);
+    (void)bufferLock;
+
+    const std::size_t wordCount = bufferPtr->getWordCount();
+
+    if (pSize < 0 || std::cmp_less(wordCount * 4, pSize))
+        return bufferPtr->popBytes(wordCount);
+    else
+        return bufferPtr->popBytes(static_cast<std::size_t>(pSize) / 4);
+}
+
+/*!
+ * \brief Pass the buffered data in place to a function and remove it.
+ *
+ * Works like SiTCP::consumeFifo() for the data of this subscription. Only this subscription
+ * is locked while \p pConsumer runs, i.e. the interface and other subscriptions are not blocked.
+ *
+ * \param pConsumer Function to process the data words.
+ * \param pSize Number of bytes to pass (automatically reduced by modulo 4).
+ * \return Number of passed (and removed) bytes.
+ */
+std::size_t SiTCPFifoSubscription::consumeFifo(const SiTCP::FifoConsumerFunctionType& pConsumer, const int pSize)
+{
+    if (pSize == 0)
+        return 0;
+
+    const std::lock_guard<std::mutex> bufferLock(mutex);
+    (void)bufferLock;
+
+    std::size_t numWords = bufferPtr->getWordCount();
+
+    if (pSize > 0)
+        numWords = std::min(numWords, static_cast<std::size_t>(pSize) / 4);
+
+    return bufferPtr->consumeWords(numWords, pConsumer) * 4;
+}
+
+/*!
+ * \brief Get the number of bytes dropped due to the size limit.
+ *
+ * \return Number of buffered bytes that were dropped to make room for newer data.
+ */
+std::uint64_t SiTCPFifoSubscription::getBytesDropped() const
+{
+    const std::lock_guard<std::mutex> bufferLock(mutex);
+    (void)bufferLock;
+
+    return bytesDropped;
+}
+
+//Private
+
+/*!
+ * \brief Append received FIFO data.
+ *
+ * Skips leading bytes as needed to start at a word boundary (determined from \p pStreamOffset for the first
+ * data of the subscription) and appends the remaining bytes of \p pData to the buffer. Drops the oldest buffered
+ * words as needed to stay below the size limit. If \p pData alone exceeds the limit, all buffered data is dropped
+ * and only the newest complete words of \p pData that fit into the limit are appended.
+ *
+ * \param pData New FIFO data.
+ * \param pStreamOffset Position of \p pData in the FIFO data stream (see SiTCP::addFifoData()).
+ * \return Number of buffered or new bytes that were dropped.
+ */
+std::size_t SiTCPFifoSubscription::addData(std::span<const std::uint8_t> pData, const std::uint64_t pStreamOffset)
+{
+    const std::lock_guard<std::mutex> bufferLock(mutex);
+    (void)bufferLock;
+
+    if (!aligned)
+    {
+        //Skip the remainder of a partially received word, so that the subscription starts at a word boundary
+        skipBytes = (4 - pStreamOffset % 4) % 4;
+        aligned = true;
+    }
+
+    if (skipBytes > 0)
+    {
+        const std::size_t numSkipped = std::min(skipBytes, pData.size());
+        pData = pData.subspan(numSkipped);
+        skipBytes -= numSkipped;
+    }
+
+    std::size_t numDropped = 0;
+
+    if (maxSize > 0)
+    {
+        const std::size_t size = bufferPtr->getSize();
+
+        if (size + pData.size() > maxSize)
+        {
+            //Complete words to drop from the front of the buffered and new data
+            const std::size_t numExcess = 4 * ((size + pData.size() - maxSize + 3) / 4);
+
+            if (numExcess <= size)
+                numDropped = 4 * bufferPtr->discardWords(numExcess / 4);
+            else
+            {
+                //Also the oldest words of the new data (including a buffered partial word) have to be dropped
+                bufferPtr->clear();
+                pData = pData.subspan(numExcess - size);
+                numDropped = numExcess;
+            }
+        }
+    }
+
+    (void)bufferPtr->pushBytes(pData);
+
+    bytesDropped += numDropped;
+
+    return numDropped;
+}
+
+/*!
+ * \brief Get the buffer capacity in number of bytes.
+ *
+ * \return Allocated buffer capacity.
+ */
+std::size_t SiTCPFifoSubscription::getCapacity() const
+{
+    const std::lock_guard<std::mutex> bufferLock(mutex);
+    (void)bufferLock;
+
+    return bufferPtr->getCapacity() * sizeof(std::uint32_t);
+}
+
+/*!
+ * \brief Remove all buffered data (including partial words).
+ *
+ * Used by SiTCP::resetFifo(), after which the data stream starts over at a word boundary.
+ */
+void SiTCPFifoSubscription::clear()
+{
+    const std::lock_guard<std::mutex> bufferLock(mutex);
+    (void)bufferLock;
+
+    bufferPtr->clear();
+    aligned = true;
+    skipBytes = 0;
 }
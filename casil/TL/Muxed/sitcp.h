@@ -63,31 +63,47 @@
 #include <casil/TL/muxedinterface.h>
 
 #include <casil/auxil.h>
+#include <casil/error.h>
 #include <casil/layerconfig.h>
 #include <casil/layerfactorymacros.h>
+#include <casil/memoryplacement.h>
+#include <casil/metrics.h>
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string>
-#include <thread>
 #include <variant>
 #include <vector>
 
+namespace boost { namespace asio { class io_context; } }
+
 namespace casil
 {
 
 namespace Layers::TL
 {
 
+namespace CommonImpl { class EventListener; }
+namespace CommonImpl { class FIFOFileWriter; }
+namespace CommonImpl { class FIFORingBuffer; }
+namespace CommonImpl { class FIFOShmWriter; }
+namespace CommonImpl { class RBCPDispatcher; }
+namespace CommonImpl { class SessionRecorder; }
 namespace CommonImpl { class TCPSocketWrapper; }
 namespace CommonImpl { class UDPSocketWrapper; }
 
+class SiTCPFifoSubscription;
+
 /*!
  * \brief %Interface to connect to the basil bus on an FPGA that runs the \e %SiTCP library for communication.
  *
@@ -96,6 +112,18 @@ namespace CommonImpl { class UDPSocketWrapper; }
  * connected to the bus. Different firmware modules can be controlled by different drivers from the HL by individually
  * addressing them on the bus (see also MuxedInterface).
  *
+ * Bus accesses may be issued concurrently from multiple threads (e.g. by drivers used from different threads): All RBCP
+ * transactions over %UDP are serialized per interface instance, such that message IDs and responses cannot be mixed up,
+ * and writes to the %TCP socket are serialized as well.
+ *
+ * Received RBCP responses are routed to their requests by message ID (by an internal dispatcher). A late response
+ * to a request that was already retransmitted (with a new ID) still completes the transaction, while further late
+ * responses are counted as such (see Statistics::rbcpLateResponses) and other stray datagrams as wrong-ID responses.
+ *
+ * The FIFO data stream can be distributed to multiple independent consumers (e.g. the SiTCPFifo drivers of multiple Device
+ * instances that share the interface, see InterfaceRegistry) via FIFO subscriptions (see subscribeFifo()), while the
+ * %TCP socket is still read only once. Reading the FIFO of the interface itself is rejected while subscriptions exist.
+ *
  * Below follows a brief summary of the communication protocol used for the %SiTCP library.
  * For more information on %SiTCP you may see their website: https://www.bbtech.co.jp/en/products/sitcp-library/
  *
@@ -175,6 +203,43 @@ namespace CommonImpl { class UDPSocketWrapper; }
  *
  * \endcode
  *
+ * Extended \c RBCP message over %UDP (Header + Data; optional firmware feature, see SiTCP()):
+ *
+ * \code{.unparsed}
+ *
+ * Bit 7         Bit 0
+ * +-----------------+
+ * |  0xFE (Ext.)    |
+ * +-----------------+
+ * |   CMD  |  FLAG  |
+ * +-----------------+
+ * |        ID       |
+ * +-----------------+
+ * |      0x00       |
+ * +-----------------+
+ * | Address [31:24] |
+ * +-----------------+
+ * | Address [23:16] |
+ * +-----------------+
+ * | Address [15:8]  |
+ * +-----------------+
+ * | Address [7:0]   |
+ * +-----------------+
+ * |  Length [15:8]  |
+ * +-----------------+
+ * |  Length [7:0]   |
+ * +-----------------+
+ * |      Data 0     |
+ * +-----------------+
+ * |       ...       |
+ * +-----------------+
+ * |  Data Length-1  | (Length max. 65497)
+ * +-----------------+
+ *
+ * \endcode
+ *
+ * The \c CMD and \c FLAG fields and the response handling are the same as for standard \c RBCP messages.
+ *
  * "tcp_to_bus" message (see SiTCP()) over %TCP (Header + Data):
  *
  * \code{.unparsed}
@@ -216,61 +281,272 @@ namespace CommonImpl { class UDPSocketWrapper; }
  */
 class SiTCP final : public MuxedInterface
 {
+public:
+    using FifoConsumerFunctionType = std::function<void(std::span<const std::uint32_t>, std::span<const std::uint32_t>)>;
+                                                            ///< \brief Function type for in place access to FIFO data words
+                                                            ///  as two contiguous segments (see consumeFifo()).
+    using FifoChunkConsumerFunctionType = std::function<void(std::chrono::steady_clock::time_point, std::uint64_t,
+                                                             std::span<const std::uint32_t>)>;
+                                                            ///< \brief Function type for in place access to FIFO data words
+                                                            ///  per received chunk with arrival time and sequence number
+                                                            ///  (see consumeFifoChunks()).
+    using FifoDataNotifierFunctionType = std::function<void()>; ///< Function type for FIFO data arrival notifications.
+    using FifoChunkProducerFunctionType = std::function<std::span<const std::uint8_t>()>;
+                                                            ///< \brief Function type for producing consecutive chunks of raw
+                                                            ///  data to be written to the %TCP socket (see writeFifoChunks()).
+    //
+    static constexpr std::size_t rbcpLatencyHistogramBins = 24; ///< Number of bins of the RBCP latency histogram (see Statistics).
+
+    /*!
+     * \brief Snapshot of the link statistics counters (see getStatistics()).
+     *
+     * The RBCP latency histogram counts the durations of completed RBCP transactions (including retries) in logarithmic bins:
+     * Bin \c 0 counts latencies below 2us, bin \c i counts latencies in <tt>[2^i us, 2^(i+1) us)</tt> and the
+     * last bin counts all latencies of at least <tt>2^(\ref rbcpLatencyHistogramBins - 1) us</tt>.
+     */
+    struct Statistics
+    {
+        std::uint64_t fifoBytesReceived;        ///< Number of bytes read from the %TCP socket and added to the FIFO.
+        std::size_t fifoHighWaterMark;          ///< Maximum FIFO size reached so far in number of bytes.
+        std::uint64_t fifoOverflows;            ///< Number of times received data did not fit below the FIFO size limit.
+        std::uint64_t fifoBytesDropped;         ///< Number of buffered bytes dropped to make room for newer data.
+        std::uint64_t rbcpTransactions;         ///< Number of successfully completed RBCP transactions.
+        std::uint64_t rbcpRetries;              ///< Number of RBCP request retransmissions and response read retries.
+        std::uint64_t rbcpWrongIdResponses;     ///< Number of received RBCP messages with wrong/unexpected ID.
+        std::uint64_t rbcpLateResponses;        ///< Number of late RBCP responses to requests that were already retransmitted or completed.
+        std::array<std::uint64_t, rbcpLatencyHistogramBins> rbcpLatencyHistogram;   ///< Histogram of RBCP transaction latencies.
+    };
+
 public:
     SiTCP(std::string pName, LayerConfig pConfig);          ///< Constructor.
     ~SiTCP() override;                                      ///< Destructor.
     //
     std::vector<std::uint8_t> read(std::uint64_t pAddr, int pSize = -1) override;
+    std::vector<std::vector<std::uint8_t>> readBatch(std::span<const ReadOp> pOps) override;
+    std::size_t readInto(std::uint64_t pAddr, std::span<std::uint8_t> pBuffer) override;
+    Expected<std::size_t> tryReadInto(std::uint64_t pAddr, std::span<std::uint8_t> pBuffer) override;
     void write(std::uint64_t pAddr, const std::vector<std::uint8_t>& pData) override;
+    void writeFrom(std::uint64_t pAddr, std::span<const std::uint8_t> pData) override;
+    Expected<void> tryWriteFrom(std::uint64_t pAddr, std::span<const std::uint8_t> pData) override;
+    void writeBatch(std::span<const WriteOp> pOps) override;
     std::vector<std::uint8_t> query(std::uint64_t pWriteAddr, std::uint64_t pReadAddr,
                                     const std::vector<std::uint8_t>& pData, int pSize = -1) override;
     //
     bool readBufferEmpty() const override;                  ///< Check if the %UDP read buffer is empty.
     void clearReadBuffer() override;                        ///< Clear the current contents of the %UDP read buffer.
     //
+    bool supportsEvents() const override;                   ///< Check if the event notification listener is enabled.
+    //
     void resetFifo();                                       ///< Clear the FIFO and the remaining incoming %TCP buffer.
     std::size_t getFifoSize() const;                        ///< Get the FIFO size in number of bytes.
     std::vector<std::uint8_t> getFifoData(int pSize = -1);  ///< Extract the current FIFO content as sequence of bytes.
+    std::size_t consumeFifo(const FifoConsumerFunctionType& pConsumer, int pSize = -1);
+                                                            ///< Pass the current FIFO content in place to a function and remove it.
+    std::size_t consumeFifoChunks(const FifoChunkConsumerFunctionType& pConsumer, int pSize = -1);
+                                                            ///< \brief Pass the current FIFO content in place to a function
+                                                            ///  chunk by chunk, with chunk metadata, and remove it.
+    std::size_t getFifoHighWaterMark() const;               ///< Get the maximum FIFO size reached so far in number of bytes.
+    std::size_t getFifoMaxSize() const;                     ///< Get the FIFO size limit in number of bytes.
+    double getFifoFillLevel() const;                        ///< Get the FIFO size as fraction of the FIFO size limit.
+    bool isFifoSpilled() const;                             ///< Check if the FIFO buffer was moved to the spill file.
+    void setFifoDataNotifier(FifoDataNotifierFunctionType pNotifier);
+                                                            ///< Set a function to be called whenever new FIFO data arrived.
+    void writeFifoChunks(const FifoChunkProducerFunctionType& pProducer);
+                                                            ///< \brief Write raw data chunk by chunk to the %TCP socket
+                                                            ///  without interruption by other writes.
+    std::shared_ptr<SiTCPFifoSubscription> subscribeFifo(); ///< Create an independent reader of the FIFO data stream.
+    //
+    Statistics getStatistics() const;                       ///< Get the current link statistics counters.
+
+private:
+    struct RBCPTransaction;
 
 private:
     bool initImpl() override;
     bool closeImpl() override;
     //
+    std::map<std::string, std::size_t> getMemoryUsageImpl() const override;
+    //
     void enableTcpToBus();          ///< Enable using %TCP protocol for normal bus writes.
+    bool tryReconnectTcp();         ///< Re-establish a lost %TCP connection and restart the FIFO reading.
+    void writeTcp(std::span<const std::span<const std::uint8_t>> pBuffers);    ///< \brief Write to the %TCP socket, repeated once after
+                                                                                ///  re-establishing a lost connection.
+    void writeTcpUnlocked(std::span<const std::span<const std::uint8_t>> pBuffers);    ///< Write to the %TCP socket without locking the mutex.
     //
-    void pollFifo();                ///< Continuously poll the %TCP socket for new FIFO data (use as thread).
+    std::size_t handleFifoData(std::span<const std::uint8_t> pData);    ///< Add FIFO data read from the %TCP socket to the FIFO buffer.
+    std::size_t addFifoData(std::span<const std::uint8_t> pData);       ///< Add FIFO data to the FIFO buffer or to the FIFO subscriptions.
+    void checkFifoNotSubscribed() const;                                ///< Throw if the FIFO data is passed to FIFO subscriptions.
+    void recordFifoChunk(std::chrono::steady_clock::time_point pTimestamp);  ///< Record the metadata of newly completed FIFO words.
+    bool spillFifo();                                                   ///< Move the FIFO buffer to the spill file if not done yet.
     //
-    std::vector<std::uint8_t> readSingle(std::uint32_t pAddr, std::uint8_t pSize);  ///< Read from the bus with a single RBCP request/response.
-    void writeSingle(std::uint32_t pAddr, const std::vector<std::uint8_t>& pData);  ///< Write to the bus with a single RBCP request/response.
+    void readBus(std::uint32_t pAddr, std::span<std::uint8_t> pData);              ///< Read a bus range via RBCP into a buffer.
+    void readSingle(std::uint32_t pAddr, std::span<std::uint8_t> pData);           ///< Read from the bus with a single RBCP request/response.
+    void writeSingle(std::uint32_t pAddr, std::span<const std::uint8_t> pData);    ///< Write to the bus with a single RBCP request/response.
     //
-    std::optional<std::vector<std::uint8_t>> doSingleRBCPOperation(std::uint32_t pAddr, const std::variant<
-                                                                   std::uint8_t,
-                                                                   std::reference_wrapper<const std::vector<std::uint8_t>>> pSizeOrData);
+    void doSingleRBCPOperation(std::uint32_t pAddr, std::variant<std::span<std::uint8_t>, std::span<const std::uint8_t>> pReadOrWriteData);
                                                                                     ///< \brief Send a single RBCP read or write request
                                                                                     ///  to the bus and process the response message.
+    Expected<void> tryDoSingleRBCPOperation(std::uint32_t pAddr,
+                                            std::variant<std::span<std::uint8_t>, std::span<const std::uint8_t>> pReadOrWriteData);
+                                                                                    ///< \brief Send a single RBCP read or write request
+                                                                                    ///  and process the response without throwing.
+    void doPipelinedRBCPOperations(std::uint32_t pAddr, std::variant<std::span<std::uint8_t>, std::span<const std::uint8_t>> pReadOrWriteData);
+                                                                                    ///< \brief Send RBCP read or write requests for a larger
+                                                                                    ///  bus range while keeping multiple requests in flight.
+    void prepareRBCPTransactions(std::vector<RBCPTransaction>& pTransactions, std::uint32_t pAddr,
+                                 std::variant<std::span<std::uint8_t>, std::span<const std::uint8_t>> pReadOrWriteData) const;
+                                                                                    ///< \brief Append the chunked RBCP read or write
+                                                                                    ///  transactions for a bus range.
+    void runPipelinedRBCPTransactions(std::vector<RBCPTransaction>& pTransactions); ///< \brief Process prepared RBCP transactions
+                                                                                    ///  while keeping multiple requests in flight.
+    void checkRBCPResponse(std::span<const std::uint8_t> pRequest, std::span<const std::uint8_t> pResponse) const;
+                                                                                    ///< \brief Check an RBCP response message for consistency
+                                                                                    ///  with the corresponding request message.
+    void composeRBCPHeader(std::vector<std::uint8_t>& pMessage, bool pRead, std::uint32_t pAddr, std::size_t pSize) const;
+                                                                                    ///< Append an RBCP request header to a message buffer.
+    std::size_t getRBCPDataLength(std::span<const std::uint8_t> pMessage) const;   ///< Get the data length field of an RBCP message.
+    std::uint8_t nextRBCPId();                                                      ///< Get a new RBCP message ID that is currently not awaited.
+    //
+    std::chrono::milliseconds getRBCPResponseTimeout(int pTimeoutCnt) const;       ///< Get the timeout for receiving an RBCP response.
+    void updateRBCPRoundTripTime(std::chrono::steady_clock::duration pRoundTripTime);
+                                                                                    ///< Update the RBCP round-trip time estimation.
+    void recordRBCPTransaction(std::chrono::steady_clock::duration pLatency);       ///< Count a completed RBCP transaction.
+
+private:
+    /*!
+     * \brief Atomically updated counters for the link statistics (see Statistics).
+     */
+    struct StatisticsCounters
+    {
+        std::atomic_uint64_t fifoBytesReceived {0};         ///< See Statistics::fifoBytesReceived.
+        std::atomic_uint64_t fifoOverflows {0};             ///< See Statistics::fifoOverflows.
+        std::atomic_uint64_t fifoBytesDropped {0};          ///< See Statistics::fifoBytesDropped.
+        std::atomic_uint64_t rbcpTransactions {0};          ///< See Statistics::rbcpTransactions.
+        std::atomic_uint64_t rbcpRetries {0};               ///< See Statistics::rbcpRetries.
+        std::atomic_uint64_t rbcpWrongIdResponses {0};      ///< See Statistics::rbcpWrongIdResponses.
+        std::atomic_uint64_t rbcpLateResponses {0};         ///< See Statistics::rbcpLateResponses.
+        std::array<std::atomic_uint64_t, rbcpLatencyHistogramBins> rbcpLatencyHistogram {};     ///< See Statistics::rbcpLatencyHistogram.
+        std::atomic_uint64_t rbcpLatencySumMicroSecs {0};   ///< Sum of all RBCP transaction latencies in microseconds (for Metrics).
+    };
+
+    /*!
+     * \brief State of a single RBCP request/response pair processed by runPipelinedRBCPTransactions().
+     */
+    struct RBCPTransaction
+    {
+        std::vector<std::uint8_t> request;                          ///< RBCP request message.
+        std::span<std::uint8_t> readData;                           ///< Destination of the response data (read requests only).
+        std::vector<std::uint8_t> response;                         ///< Buffer for the routed RBCP response message.
+        std::chrono::steady_clock::time_point firstRequestTime;     ///< Time of first sending the request.
+        std::chrono::steady_clock::time_point requestTime;          ///< Time of (last) sending the request.
+        std::chrono::steady_clock::time_point deadline;             ///< Timeout for receiving the response.
+        std::chrono::microseconds sendDelay {0};                    ///< \brief Minimum delay between first sending the preceding
+                                                                    ///  transaction's request and first sending this request.
+        int sendCnt = 0;                                            ///< Number of sent requests.
+        bool inFlight = false;                                      ///< Request sent and response not yet received.
+    };
+
+    /*!
+     * \brief Metadata of the FIFO words completed by one %TCP receive (see consumeFifoChunks()).
+     */
+    struct FifoChunkInfo
+    {
+        std::chrono::steady_clock::time_point timestamp;    ///< Arrival time of the chunk.
+        std::uint64_t sequenceNumber;                       ///< Running number of the chunk.
+        std::uint64_t endWord;                              ///< FIFO stream position after the last word of the chunk.
+    };
 
 private:
     const std::string hostName;     ///< Host name of the remote endpoint.
     const int udpPort;              ///< Used network port for %UDP communication.
     const int tcpPort;              ///< Used network port for %TCP communication.
+    const int eventPort;            ///< Local network port for receiving event notifications (zero if disabled).
     //
-    const bool useTcp;              ///< Connect the %TCP socket and start a FIFO polling thread.
+    const bool useTcp;              ///< Connect the %TCP socket and start reading FIFO data.
     const bool useTcpToBus;         ///< Use the %TCP protocol for normal bus writes (instead of %UDP).
     //
     const double connectTimeoutSecs;                    ///< Configured %TCP/(%UDP) connect timeout value in seconds (for init()).
     const std::chrono::milliseconds connectTimeout;     ///< Rounded chrono version of connectTimeoutSecs.
     //
+    boost::asio::io_context& ioContext;                                         ///< IO context used by the sockets.
+    const unsigned int numDedicatedIOThreads;                                   ///< Number of threads requested for \ref ioContext.
     const std::unique_ptr<CommonImpl::UDPSocketWrapper> udpSocketWrapperPtr;    ///< Detailed %UDP socket logic wrapper.
     const std::unique_ptr<CommonImpl::TCPSocketWrapper> tcpSocketWrapperPtr;    ///< Detailed %TCP socket logic wrapper.
+    const std::unique_ptr<CommonImpl::EventListener> eventListenerPtr;          ///< Event notification listener (if "event_port" set).
+    //
+    const std::size_t fifoCapacity;                                             ///< Initial FIFO buffer capacity in number of bytes.
+    const bool useLockFreeFifo;                                                 ///< Use FIFO buffer as lock-free SPSC queue with fixed capacity.
+    const std::string fifoMmapFilePath;                                         ///< Path of a memory-mapped file to use as FIFO buffer storage.
+    const std::size_t fifoMaxSize;                                              ///< Maximum FIFO size in number of bytes (0 means no limit).
+    const std::string fifoOverflowPolicy;                                       ///< Configured handling of data exceeding \ref fifoMaxSize.
+    const bool fifoDropOldest;                                                  ///< \brief Drop the oldest data instead of blocking the
+                                                                                ///  FIFO reading when reaching \ref fifoMaxSize.
+    const bool fifoSpill;                                                       ///< \brief Move the FIFO buffer to \ref fifoSpillFilePath
+                                                                                ///  when reaching \ref fifoMaxSize.
+    const std::string fifoSpillFilePath;                                        ///< Path of the memory-mapped file to spill the FIFO buffer to.
+    const std::size_t fifoSpillSize;                                            ///< FIFO size limit in number of bytes after spilling.
+    bool fifoSpillFailed;                                                       ///< Spilling the FIFO buffer to file failed.
+    const MemoryPlacement fifoPlacement;                                        ///< Huge page and NUMA node options for the FIFO buffers.
+    const std::unique_ptr<CommonImpl::FIFORingBuffer> fifoBufferPtr;            ///< FIFO buffer.
+    const std::size_t tcpReadBufferSize;                                        ///< Maximum number of bytes per %TCP socket read for FIFO data.
+    //
+    const std::string fifoDumpFilePath;                                         ///< Base path of the files to write FIFO data to directly.
+    const std::size_t fifoDumpBlockSize;                                        ///< Block size for writing FIFO data to files.
+    const std::uint64_t fifoDumpMaxFileSize;                                    ///< Maximum size of a single FIFO data file.
+    const std::unique_ptr<CommonImpl::FIFOFileWriter> fifoFileWriterPtr;        ///< FIFO data file writer (if fifoDumpFilePath set).
+    bool fifoDumpFailed;                                                        ///< Writing FIFO data to file failed since last (re)start.
+    //
+    const std::string fifoShmName;                                              ///< Name of the shared-memory ring to publish FIFO data to.
+    const std::size_t fifoShmSlotSize;                                          ///< Slot capacity of the shared-memory ring in bytes.
+    const std::size_t fifoShmNumSlots;                                          ///< Number of slots of the shared-memory ring.
+    const std::unique_ptr<CommonImpl::FIFOShmWriter> fifoShmWriterPtr;          ///< Shared-memory ring writer (if fifoShmName set).
+    bool fifoShmFailed;                                                         ///< Publishing FIFO data failed since last (re)start.
+    //
+    const std::unique_ptr<CommonImpl::SessionRecorder> sessionRecorderPtr;      ///< Session recorder (if "record_session" set).
     //
-    std::thread fifoThread;                 ///< FIFO polling thread.
-    std::deque<std::uint8_t> fifoBuffer;    ///< FIFO buffer.
     mutable std::mutex fifoMutex;           ///< Mutex for the FIFO buffer.
-    std::mutex tcpSocketMutex;              ///< Mutex for the %TCP socket (for concurrently used \e reading parts only).
-    std::atomic_flag wantLockTCPSocket;     ///< Used for triggering FIFO thread to 'yield()' to enable "fairer" access to tcpSocketMutex.
-    std::atomic_bool pollFIFO;              ///< Flag to control/stop the FIFO polling thread.
+    std::deque<FifoChunkInfo> fifoChunks;   ///< Metadata of the chunks with words still in the FIFO buffer (in stream order).
+    std::uint64_t nextFifoChunkSeqNum;      ///< Sequence number for the next recorded FIFO chunk.
+    mutable std::mutex fifoChunksMutex;     ///< Mutex for \ref fifoChunks and \ref nextFifoChunkSeqNum.
+    std::vector<std::weak_ptr<SiTCPFifoSubscription>> fifoSubscriptions;   ///< Existing FIFO subscriptions (see subscribeFifo()).
+    std::atomic<std::size_t> numFifoSubscriptions;  ///< \brief Number of entries in \ref fifoSubscriptions (including expired ones),
+                                                    ///  for checking without locking \ref fifoSubscriptionsMutex.
+    mutable std::mutex fifoSubscriptionsMutex;      ///< Mutex for \ref fifoSubscriptions.
+    std::uint64_t fifoStreamOffset;         ///< \brief Number of bytes added to the FIFO buffer or subscriptions since the last FIFO reset
+                                            ///  (only used by the continuous FIFO reading, see addFifoData()).
+    FifoDataNotifierFunctionType fifoDataNotifier;  ///< Function called after new FIFO data arrived (see setFifoDataNotifier()).
+    std::mutex fifoDataNotifierMutex;       ///< Mutex for \ref fifoDataNotifier.
+    std::mutex tcpSocketMutex;              ///< Mutex for starting/stopping the continuous %TCP socket reading.
+    std::atomic_bool pollFIFO;              ///< Flag to enable (re)starting the continuous FIFO reading.
+    //
+    mutable std::mutex rbcpMutex;           ///< \brief Mutex serializing RBCP transactions (guards the %UDP socket, \ref rbcpId,
+                                            ///  the RBCP message buffers and RTT estimation).
+    std::mutex tcpWriteMutex;               ///< Mutex serializing writes to the %TCP socket.
     //
+    const int rbcpWindowSize;               ///< Maximum number of RBCP requests in flight for larger bus reads/writes.
+    const std::uint64_t rbcpExtendedSize;   ///< Configured maximum data length of the extended RBCP mode (zero if disabled).
+    const std::size_t rbcpChunkSize;        ///< Maximum number of data bytes per RBCP message (depending on the RBCP mode).
+    const std::size_t rbcpMsgHeaderSize;    ///< Number of RBCP header bytes (depending on the RBCP mode).
     std::uint8_t rbcpId;                    ///< Last used/sent RBCP message ID.
+    std::vector<std::uint8_t> rbcpRequestBuffer;    ///< Reusable buffer for composing single RBCP request messages.
+    std::vector<std::uint8_t> rbcpResponseBuffer;   ///< Reusable buffer for receiving RBCP response messages.
+    const std::unique_ptr<CommonImpl::RBCPDispatcher> rbcpDispatcherPtr;    ///< \brief Receive side of the %UDP socket routing RBCP
+                                                                            ///  responses to their requests by message ID.
+    //
+    const double udpTimeoutSecs;                        ///< Configured RBCP timeout value in seconds.
+    const std::chrono::milliseconds udpTimeout;         ///< \brief Timeout for sending and receiving RBCP messages over %UDP
+                                                        ///  (upper limit for the adaptive timeout).
+    const int udpRetransmitCnt;                         ///< Retry attempts for sending and receiving RBCP messages over %UDP.
+    const bool useAdaptiveRBCPTimeout;                  ///< Derive the RBCP response timeout from the measured round-trip times.
+    const double rbcpMinTimeoutSecs;                    ///< Configured lower limit for the adaptive RBCP response timeout in seconds.
+    const std::chrono::milliseconds rbcpMinTimeout;     ///< Rounded chrono version of rbcpMinTimeoutSecs.
+    std::optional<std::chrono::microseconds> rbcpSRTT;  ///< Smoothed RBCP round-trip time (no value until the first measurement).
+    std::chrono::microseconds rbcpRTTVar;               ///< RBCP round-trip time variation.
+    //
+    StatisticsCounters statistics;                      ///< Link statistics counters.
+    //
+    std::vector<Metrics::CallbackHandle> metricsCallbacks;  ///< \brief Callback metrics for FIFO and RBCP statistics (declared last
+                                                            ///  such that the callbacks are removed first on destruction).
 
 public:
     static constexpr std::uint64_t baseAddrDataLimit = 0x100000000; ///< Address limit below which read() / write() do normal bus access.
@@ -281,17 +557,79 @@ private:
     static constexpr std::uint8_t rbcpCmdWr = 0x80;                 ///< Write request value of \c CMD / \c FLAG byte of RBCP header.
     static constexpr std::uint8_t rbcpCmdRd = 0xC0;                 ///< Read request value of \c CMD / \c FLAG byte of RBCP header.
     static constexpr std::uint8_t rbcpMaxSize = 255;                ///< Maximum number of data bytes.
+    static constexpr std::uint8_t rbcpHeaderSize = 8;               ///< Number of RBCP header bytes.
+    static constexpr std::uint8_t rbcpVerTypeExt = 0xFE;            ///< \c Version / \c Type byte of extended RBCP header.
+    static constexpr std::uint8_t rbcpExtHeaderSize = 10;           ///< Number of extended RBCP header bytes.
+    static constexpr std::uint16_t rbcpExtMaxSize = 65497;          ///< \brief Maximum number of data bytes of an extended RBCP message
+                                                                    ///  (limited by the maximum %UDP payload size).
+    static constexpr std::uint16_t tcpToBusMaxSize = 0xFFF9u;       ///< Maximum number of data bytes of a "tcp_to_bus" message.
     //
-    static constexpr std::chrono::milliseconds udpTimeout {1000};   ///< Timeout for sending and receiving RBCP messages over %UDP.
-    static constexpr int udpRetransmitCnt = 3;                      ///< Retry attempts for sending and receiving RBCP messages over %UDP.
-    static constexpr std::chrono::milliseconds tcpReadoutInterval = Auxil::getChronoMilliSecs(0.05);
-                                                                    ///< FIFO polling target interval between successive %TCP socket reads.
+    static constexpr std::chrono::milliseconds fifoFullRetryInterval {10};
+                                                                    ///< Delay before adding data again that did not fit into full FIFO.
     //
-    static constexpr std::size_t maxFIFOErrorCount = 10;            ///< Maximum error count of the FIFO polling thread before it stops itself.
+    static constexpr std::uint64_t defaultTCPReadBufferSize = 262144;   ///< Default maximum number of bytes per %TCP socket read.
+    static constexpr std::uint64_t defaultFIFOCapacity = 4194304;   ///< Default initial FIFO buffer capacity in number of bytes.
+    static constexpr std::uint64_t defaultFIFODumpBlockSize = 4194304;      ///< Default block size for writing FIFO data to files.
+    static constexpr std::uint64_t defaultFIFODumpMaxFileSize = 1073741824; ///< Default maximum size of a single FIFO data file.
+    static constexpr std::uint64_t defaultFIFOShmSlotSize = 1048576;        ///< Default slot capacity of the shared-memory ring.
+    static constexpr std::uint64_t defaultFIFOShmNumSlots = 64;             ///< Default number of slots of the shared-memory ring.
+    static constexpr std::uint64_t defaultFIFOSpillSize = 17179869184;      ///< Default FIFO size limit after spilling to file.
 
     CASIL_REGISTER_INTERFACE_H("SiTCP")
 };
 
+/*!
+ * \brief Independent reader of the FIFO data stream of a SiTCP interface.
+ *
+ * Obtained via SiTCP::subscribeFifo(). Receives a copy of all FIFO data that arrives while the subscription exists
+ * and buffers it independently of other subscriptions, such that multiple consumers (e.g. the SiTCPFifo drivers of
+ * multiple Device instances sharing the interface, see InterfaceRegistry) can each read and reset their own copy
+ * of the data stream. The data is always buffered as complete 32 bit words, also when subscribing mid-stream.
+ *
+ * The buffer size is limited by the "fifo_max_size" of the interface (see SiTCP::SiTCP()). Since a single slow
+ * consumer must not stall the others, the oldest buffered words are always dropped to make room for newer data
+ * (see getBytesDropped()), independent of the configured overflow policy. This includes the oldest words of
+ * a single received chunk that alone exceeds the limit.
+ *
+ * The subscription is removed from the interface when the last reference to it is released.
+ */
+class SiTCPFifoSubscription
+{
+private:
+    SiTCPFifoSubscription(std::size_t pCapacity, std::size_t pMaxSize);         ///< Constructor.
+
+public:
+    SiTCPFifoSubscription(const SiTCPFifoSubscription&) = delete;               ///< Deleted copy constructor.
+    SiTCPFifoSubscription(SiTCPFifoSubscription&&) = delete;                    ///< Deleted move constructor.
+    ~SiTCPFifoSubscription();                                                   ///< Destructor.
+    //
+    SiTCPFifoSubscription& operator=(SiTCPFifoSubscription) = delete;           ///< Deleted copy assignment operator.
+    SiTCPFifoSubscription& operator=(SiTCPFifoSubscription&&) = delete;         ///< Deleted move assignment operator.
+    //
+    void resetFifo();                                                           ///< Discard the buffered data of this subscription.
+    std::size_t getFifoSize() const;                                            ///< Get the buffered data size in number of bytes.
+    std::vector<std::uint8_t> getFifoData(int pSize = -1);                      ///< Extract the buffered data as sequence of bytes.
+    std::size_t consumeFifo(const SiTCP::FifoConsumerFunctionType& pConsumer, int pSize = -1);
+                                                                                ///< Pass the buffered data in place to a function and remove it.
+    std::uint64_t getBytesDropped() const;                                      ///< Get the number of bytes dropped due to the size limit.
+
+private:
+    std::size_t addData(std::span<const std::uint8_t> pData, std::uint64_t pStreamOffset);
+                                                                                ///< Append received FIFO data.
+    std::size_t getCapacity() const;                                            ///< Get the buffer capacity in number of bytes.
+    void clear();                                                               ///< Remove all buffered data (including partial words).
+    //
+    friend class SiTCP;
+
+private:
+    const std::size_t maxSize;                                      ///< Maximum buffered data size in number of bytes (0 means no limit).
+    const std::unique_ptr<CommonImpl::FIFORingBuffer> bufferPtr;    ///< Data buffer.
+    bool aligned;                                                   ///< Flags whether \ref skipBytes was determined from the stream offset.
+    std::size_t skipBytes;                                          ///< Number of leading bytes to skip to align to word boundaries.
+    std::uint64_t bytesDropped;                                     ///< Number of bytes dropped due to \ref maxSize.
+    mutable std::mutex mutex;                                       ///< Mutex for the buffer and counters.
+};
+
 } // namespace Layers::TL
 
 } // namespace casil
@@ -23,9 +23,13 @@
 
 #include <casil/TL/directinterface.h>
 
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <chrono>
+#include <limits>
 #include <stdexcept>
-#include <thread>
+#include <string>
 #include <utility>
 
 using casil::Layers::TL::DirectInterface;
@@ -47,6 +51,64 @@ DirectInterface::DirectInterface(std::string pType, std::string pName, LayerConf
 
 //Public
 
+/*!
+ * \brief Read from the interface into a buffer.
+ *
+ * Reads like read() with the same meaning of \p pSize, but writes the read bytes to \p pBuffer.
+ *
+ * The default implementation calls read() and copies the result into \p pBuffer. Derived classes should
+ * override this function to read directly into \p pBuffer, such that repeated reads with a reused buffer
+ * do not need any memory allocations.
+ *
+ * \throws std::runtime_error If read() throws \c std::runtime_error.
+ * \throws std::runtime_error If the read bytes do not fit into \p pBuffer.
+ *
+ * \param pBuffer Buffer for the read bytes.
+ * \param pSize Number of bytes to read.
+ * \return Number of bytes written to \p pBuffer.
+ */
+std::size_t DirectInterface::readInto(const std::span<std::uint8_t> pBuffer, const int pSize)
+{
+    const std::vector<std::uint8_t> data = read(pSize);
+
+    if (data.size() > pBuffer.size())
+        throw std::runtime_error("Could not read from " + getSelfDescription() + ": Read data does not fit into the buffer.");
+
+    std::copy(data.begin(), data.end(), pBuffer.begin());
+
+    return data.size();
+}
+
+/*!
+ * \brief Read from the interface into a pooled buffer.
+ *
+ * Reads like read() but returns the bytes in a PooledBuffer, which avoids allocating memory for repeated reads
+ * of similar size. For non-negative \p pSize the bytes are read directly into the buffer via readInto().
+ * For negative \p pSize (read until termination) the result of read() is copied into the buffer.
+ *
+ * \throws std::runtime_error If readInto() or read() throw \c std::runtime_error.
+ *
+ * \param pSize Number of bytes to read.
+ * \return Read bytes.
+ */
+casil::PooledBuffer DirectInterface::readPooled(const int pSize)
+{
+    if (pSize < 0)
+    {
+        const std::vector<std::uint8_t> data = read(pSize);
+
+        PooledBuffer buffer(data.size());
+        std::copy(data.begin(), data.end(), buffer.data());
+
+        return buffer;
+    }
+
+    PooledBuffer buffer(static_cast<std::size_t>(pSize));
+    buffer.resize(readInto(buffer.span(), pSize));
+
+    return buffer;
+}
+
 /*!
  * \brief Write a query to the interface and read the response.
  *
@@ -71,8 +133,7 @@ std::vector<std::uint8_t> DirectInterface::query(const std::vector<std::uint8_t>
 
         write(pData);
 
-        if (queryDelayMicroSecs > std::chrono::microseconds::zero())
-            std::this_thread::sleep_for(queryDelayMicroSecs);
+        waitForQueryDelay(std::chrono::steady_clock::now());
 
         return read(pSize);
     }
@@ -81,3 +142,311 @@ std::vector<std::uint8_t> DirectInterface::query(const std::vector<std::uint8_t>
         throw std::runtime_error("Could not query from " + getSelfDescription() + ": " + exc.what());
     }
 }
+
+/*!
+ * \brief Write multiple queries at once and read all responses.
+ *
+ * Clears the read buffer if not empty, writes all queries \p pQueries back-to-back, waits for a potential
+ * query delay (see Interface::Interface()) \e once and then reads the responses in the order of the queries,
+ * each of \p pSize bytes (see also write() and read()). Compared to calling query() for every single query,
+ * this way the round trip time to the device has to be waited for only once instead of for every query.
+ *
+ * Note: Requires a device that processes queued queries in order and can buffer the responses (such as SCPI instruments).
+ *
+ * \throws std::runtime_error If readBufferEmpty(), clearReadBuffer(), write() or read() throw \c std::runtime_error.
+ *
+ * \param pQueries Query byte sequences to be written.
+ * \param pSize Number of response bytes to read for each query.
+ * \return Read bytes for each query.
+ */
+std::vector<std::vector<std::uint8_t>> DirectInterface::queryMany(const std::span<const std::vector<std::uint8_t>> pQueries, const int pSize)
+{
+    if (pQueries.empty())
+        return {};
+
+    try
+    {
+        if (!readBufferEmpty())
+        {
+            logger.logWarning("Clearing not empty read buffer before sending queries.");
+            clearReadBuffer();
+        }
+
+        for (const std::vector<std::uint8_t>& queryData : pQueries)
+            write(queryData);
+
+        waitForQueryDelay(std::chrono::steady_clock::now());
+
+        std::vector<std::vector<std::uint8_t>> responses;
+        responses.reserve(pQueries.size());
+
+        for (std::size_t i = 0; i < pQueries.size(); ++i)
+            responses.push_back(read(pSize));
+
+        return responses;
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not query from " + getSelfDescription() + ": " + exc.what());
+    }
+}
+
+//
+
+/*!
+ * \brief Read an IEEE 488.2 definite-length binary block.
+ *
+ * Reads a block of the form <tt>\#\<n\>\<length\>\<data\></tt> as sent by e.g. oscilloscopes for binary waveform
+ * transfers, where \c n is a single digit giving the number of digits of \c length (see readBlockHeader()).
+ * Returns the \c length bytes of \c data and reads the following termination (see readBlockTrailer()).
+ *
+ * In contrast to read() with size -1 the block data may contain arbitrary bytes, including the read termination.
+ * The block data is read via readInto() directly into the returned sequence.
+ *
+ * \throws std::runtime_error If readBlockHeader(), readInto() or readBlockTrailer() throw \c std::runtime_error.
+ * \throws std::runtime_error If less than \c length bytes could be read.
+ *
+ * \return Block data.
+ */
+std::vector<std::uint8_t> DirectInterface::readBlock()
+{
+    const std::size_t length = readBlockHeader();
+
+    std::vector<std::uint8_t> data(length);
+
+    (void)readBlockData(data, length);
+
+    return data;
+}
+
+/*!
+ * \brief Read an IEEE 488.2 definite-length binary block into a buffer.
+ *
+ * Reads like readBlock() but writes the block data directly to \p pBuffer, such that repeated
+ * transfers with a reused (e.g. reinterpreted typed) buffer do not need any memory allocations.
+ *
+ * If the block data does not fit into \p pBuffer, the block is still read completely (and discarded) before throwing.
+ *
+ * \throws std::runtime_error If readBlockHeader(), readInto() or readBlockTrailer() throw \c std::runtime_error.
+ * \throws std::runtime_error If the block data does not fit into \p pBuffer.
+ * \throws std::runtime_error If less than the announced number of bytes could be read.
+ *
+ * \param pBuffer Buffer for the block data.
+ * \return Number of block data bytes written to \p pBuffer.
+ */
+std::size_t DirectInterface::readBlockInto(const std::span<std::uint8_t> pBuffer)
+{
+    return readBlockData(pBuffer, readBlockHeader());
+}
+
+/*!
+ * \brief Write a query to the interface and read a binary block response.
+ *
+ * Writes \p pData like query() and reads the response like readBlock().
+ *
+ * \throws std::runtime_error If queryBlockHeader() or readBlock() throw \c std::runtime_error.
+ *
+ * \param pData Query bytes to be written.
+ * \return Block data of the response.
+ */
+std::vector<std::uint8_t> DirectInterface::queryBlock(const std::vector<std::uint8_t>& pData)
+{
+    const std::size_t length = queryBlockHeader(pData);
+
+    std::vector<std::uint8_t> data(length);
+
+    (void)readBlockData(data, length);
+
+    return data;
+}
+
+/*!
+ * \brief Write a query to the interface and read a binary block response into a buffer.
+ *
+ * Writes \p pData like query() and reads the response like readBlockInto().
+ *
+ * \throws std::runtime_error If queryBlockHeader() or readBlockInto() throw \c std::runtime_error.
+ *
+ * \param pData Query bytes to be written.
+ * \param pBuffer Buffer for the block data.
+ * \return Number of block data bytes written to \p pBuffer.
+ */
+std::size_t DirectInterface::queryBlockInto(const std::vector<std::uint8_t>& pData, const std::span<std::uint8_t> pBuffer)
+{
+    return readBlockData(pBuffer, queryBlockHeader(pData));
+}
+
+/*!
+ * \brief Read the header of a binary block and get the data length.
+ *
+ * Reads the header <tt>\#\<n\>\<length\></tt> of an IEEE 488.2 definite-length binary block (see readBlock())
+ * and returns the announced data length. The caller must then read the data via readBlockData(). This allows to read the data directly into a buffer
+ * that is allocated only once the length is known (see e.g. HL::SCPI::queryBinaryAs()).
+ *
+ * Indefinite-length blocks (<tt>\#0</tt>) are not supported, since their end can only be detected by the termination.
+ *
+ * \throws std::runtime_error If readInto() throws \c std::runtime_error.
+ * \throws std::runtime_error If the header is malformed or announces an indefinite-length block.
+ *
+ * \return Number of following data bytes.
+ */
+std::size_t DirectInterface::readBlockHeader()
+{
+    std::array<std::uint8_t, 9> headerBuffer {};
+
+    if (readInto(std::span<std::uint8_t>(headerBuffer.data(), 2), 2) != 2 || headerBuffer[0] != '#')
+        throw std::runtime_error("Could not read binary block from " + getSelfDescription() + ": Invalid block header.");
+
+    if (headerBuffer[1] == '0')
+    {
+        throw std::runtime_error("Could not read binary block from " + getSelfDescription() + ": "
+                                 "Indefinite-length blocks are not supported.");
+    }
+
+    if (headerBuffer[1] < '1' || headerBuffer[1] > '9')
+        throw std::runtime_error("Could not read binary block from " + getSelfDescription() + ": Invalid block header.");
+
+    const int numDigits = headerBuffer[1] - '0';
+
+    if (readInto(std::span<std::uint8_t>(headerBuffer.data(), numDigits), numDigits) != static_cast<std::size_t>(numDigits))
+        throw std::runtime_error("Could not read binary block from " + getSelfDescription() + ": Invalid block header.");
+
+    const char* const digitsBegin = reinterpret_cast<const char*>(headerBuffer.data());
+    const char* const digitsEnd = digitsBegin + numDigits;
+
+    std::size_t length = 0;
+
+    if (const auto [ptr, ec] = std::from_chars(digitsBegin, digitsEnd, length); ec != std::errc() || ptr != digitsEnd)
+        throw std::runtime_error("Could not read binary block from " + getSelfDescription() + ": Invalid block length.");
+
+    return length;
+}
+
+/*!
+ * \brief Write a query to the interface and read the header of a binary block response.
+ *
+ * Clears the read buffer if not empty, writes \p pData, waits for a potential query delay
+ * (see Interface::Interface()) and reads the block header (see readBlockHeader()).
+ *
+ * \throws std::runtime_error If readBufferEmpty(), clearReadBuffer(), write() or readBlockHeader() throw \c std::runtime_error.
+ *
+ * \param pData Query bytes to be written.
+ * \return Number of following data bytes.
+ */
+std::size_t DirectInterface::queryBlockHeader(const std::vector<std::uint8_t>& pData)
+{
+    try
+    {
+        if (!readBufferEmpty())
+        {
+            logger.logWarning("Clearing not empty read buffer before sending query.");
+            clearReadBuffer();
+        }
+
+        write(pData);
+
+        waitForQueryDelay(std::chrono::steady_clock::now());
+
+        return readBlockHeader();
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not query from " + getSelfDescription() + ": " + exc.what());
+    }
+}
+
+/*!
+ * \brief Read binary block data and the following termination.
+ *
+ * Reads \p pLength bytes of block data into \p pBuffer (see readInto()) and then the termination (see readBlockTrailer()).
+ * Use this after readBlockHeader() / queryBlockHeader() once a buffer for the announced length is available.
+ * If \p pLength exceeds the size of \p pBuffer, the data is read and discarded instead before throwing.
+ *
+ * \throws std::runtime_error If readInto(), read() or readBlockTrailer() throw \c std::runtime_error.
+ * \throws std::runtime_error If \p pLength exceeds the size of \p pBuffer.
+ * \throws std::runtime_error If less than \p pLength bytes could be read.
+ *
+ * \param pBuffer Buffer for the block data.
+ * \param pLength Number of block data bytes (see readBlockHeader()).
+ * \return \p pLength.
+ */
+std::size_t DirectInterface::readBlockData(const std::span<std::uint8_t> pBuffer, const std::size_t pLength)
+{
+    if (pLength > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+        throw std::runtime_error("Could not read binary block from " + getSelfDescription() + ": Block too large.");
+
+    if (pLength > pBuffer.size())
+    {
+        (void)read(static_cast<int>(pLength));
+        readBlockTrailer();
+
+        throw std::runtime_error("Could not read binary block from " + getSelfDescription() + ": Block data does not fit into the buffer.");
+    }
+
+    if (pLength > 0 && readInto(pBuffer.first(pLength), static_cast<int>(pLength)) != pLength)
+        throw std::runtime_error("Could not read binary block from " + getSelfDescription() + ": Incomplete block data.");
+
+    readBlockTrailer();
+
+    return pLength;
+}
+
+//
+
+/*!
+ * \brief Check if the interface supports continuous record streaming.
+ *
+ * Returns false by default. Implementations supporting startRecordStream() and stopRecordStream() override this.
+ *
+ * \return True if record streaming is supported.
+ */
+bool DirectInterface::supportsRecordStreaming() const
+{
+    return false;
+}
+
+/*!
+ * \brief Start passing every incoming terminated record to a callback.
+ *
+ * Once started, incoming data is no longer collected for read() but instead split into records
+ * at the read termination and every complete record (excluding the termination) is passed to \p pHandler
+ * from a background thread, as soon as it arrives. Use stopRecordStream() to return to normal read() operation.
+ *
+ * Throws by default. See supportsRecordStreaming().
+ *
+ * \throws std::runtime_error If the interface does not support record streaming.
+ *
+ * \param pHandler Callback for received records.
+ */
+void DirectInterface::startRecordStream(RecordHandler pHandler)
+{
+    (void)pHandler;
+    throw std::runtime_error("The interface " + getSelfDescription() + " does not support record streaming.");
+}
+
+/*!
+ * \brief Stop passing incoming records to the callback.
+ *
+ * Does nothing by default. See startRecordStream().
+ */
+void DirectInterface::stopRecordStream()
+{
+}
+
+//Private
+
+/*!
+ * \brief Read the termination following a binary block.
+ *
+ * Reads up to and including the read termination that follows the block data (see read()).
+ * Bytes other than the termination are discarded with a warning.
+ *
+ * \throws std::runtime_error If read() throws \c std::runtime_error.
+ */
+void DirectInterface::readBlockTrailer()
+{
+    const std::vector<std::uint8_t> trailer = read(-1);
+
+    if (!trailer.empty())
+        logger.logWarning("Discarding " + std::to_string(trailer.size()) + " unexpected bytes after binary block.");
+}
@@ -27,8 +27,12 @@
 #include <casil/TL/interface.h>
 
 #include <casil/layerconfig.h>
+#include <casil/pooledbuffer.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -52,6 +56,10 @@ namespace TL
  */
 class DirectInterface : public Interface
 {
+public:
+    typedef std::function<void(std::span<const std::uint8_t>)> RecordHandler;   ///< Callback type for streamed terminated records
+                                                                                ///  (excluding termination).
+
 public:
     DirectInterface(std::string pType, std::string pName, LayerConfig pConfig, const LayerConfig& pRequiredConfig); ///< Constructor.
     ~DirectInterface() override = default;                                                                          ///< Default destructor.
@@ -63,6 +71,10 @@ public:
      * \return Read bytes.
      */
     virtual std::vector<std::uint8_t> read(int pSize = -1) = 0;
+    virtual std::size_t readInto(std::span<std::uint8_t> pBuffer, int pSize = -1);                          ///< \brief Read from the interface
+                                                                                                            ///  into a buffer.
+    PooledBuffer readPooled(int pSize = -1);                                                                ///< \brief Read from the interface
+                                                                                                            ///  into a pooled buffer.
     /*!
      * \brief Write to the interface.
      *
@@ -71,6 +83,28 @@ public:
     virtual void write(const std::vector<std::uint8_t>& pData) = 0;
     virtual std::vector<std::uint8_t> query(const std::vector<std::uint8_t>& pData, int pSize = -1) = 0;    ///< \brief Write a query to the
                                                                                                             ///  interface and read the response.
+    virtual std::vector<std::vector<std::uint8_t>> queryMany(std::span<const std::vector<std::uint8_t>> pQueries, int pSize = -1);
+                                                                                                            ///< \brief Write multiple queries at
+                                                                                                            ///  once and read all responses.
+    //
+    std::vector<std::uint8_t> readBlock();                                                  ///< Read an IEEE 488.2 definite-length binary block.
+    std::size_t readBlockInto(std::span<std::uint8_t> pBuffer);                             ///< \brief Read an IEEE 488.2 definite-length
+                                                                                            ///  binary block into a buffer.
+    std::vector<std::uint8_t> queryBlock(const std::vector<std::uint8_t>& pData);           ///< \brief Write a query to the interface and
+                                                                                            ///  read a binary block response.
+    std::size_t queryBlockInto(const std::vector<std::uint8_t>& pData, std::span<std::uint8_t> pBuffer);
+                                                                                            ///< \brief Write a query to the interface and
+                                                                                            ///  read a binary block response into a buffer.
+    std::size_t readBlockHeader();                                                          ///< \brief Read the header of a binary block
+                                                                                            ///  and get the data length.
+    std::size_t queryBlockHeader(const std::vector<std::uint8_t>& pData);                   ///< \brief Write a query to the interface and
+                                                                                            ///  read the header of a binary block response.
+    std::size_t readBlockData(std::span<std::uint8_t> pBuffer, std::size_t pLength);        ///< \brief Read binary block data and the
+                                                                                            ///  following termination.
+    //
+    virtual bool supportsRecordStreaming() const;               ///< Check if the interface supports continuous record streaming.
+    virtual void startRecordStream(RecordHandler pHandler);     ///< Start passing every incoming terminated record to a callback.
+    virtual void stopRecordStream();                            ///< Stop passing incoming records to the callback.
     //
     bool readBufferEmpty() const override = 0;
     void clearReadBuffer() override = 0;
@@ -78,6 +112,8 @@ public:
 private:
     bool initImpl() override = 0;
     bool closeImpl() override = 0;
+    //
+    void readBlockTrailer();                    ///< Read the termination following a binary block.
 };
 
 } // namespace TL
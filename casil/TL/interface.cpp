@@ -25,10 +25,24 @@
 
 #include <casil/auxil.h>
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+
 #include <utility>
 
 using casil::Layers::TL::Interface;
 
+/*!
+ * \brief Single-threaded executor for asynchronous interface access (see postAsync()).
+ *
+ * Uses its own thread (instead of the IO context threads from ASIO), since the queued
+ * tasks may block on interface operations that themselves depend on the IO context threads.
+ */
+struct Interface::AsyncExecutor
+{
+    boost::asio::thread_pool pool {1};  ///< Thread pool with a single thread such that all tasks are executed in order.
+};
+
 /*!
  * \brief Constructor.
  *
@@ -37,6 +51,10 @@ using casil::Layers::TL::Interface;
  * Gets the optional "init.query_delay" value from \p pConfig (floating-point value in milliseconds),
  * which is intended to be used by DirectInterface::query() and MuxedInterface::query().
  *
+ * Registers the interface metrics (see Metrics) "casil_interface_read_bytes", "casil_interface_written_bytes",
+ * "casil_interface_transactions" and "casil_interface_errors" with the component's labels (see LayerBase::metricsLabels),
+ * which are updated by the derived interfaces via countRead(), countWrite() and countError().
+ *
  * \throws std::runtime_error If "init.query_delay" is set to a negative value.
  *
  * \param pType Registered component type name.
@@ -47,8 +65,124 @@ using casil::Layers::TL::Interface;
 Interface::Interface(std::string pType, std::string pName, LayerConfig pConfig, const LayerConfig& pRequiredConfig) :
     LayerBase(Layer::TransferLayer, std::move(pType), std::move(pName), std::move(pConfig), pRequiredConfig),
     queryDelay(config.getDbl("init.query_delay", 0.0)),
-    queryDelayMicroSecs(Auxil::getChronoMicroSecs(queryDelay*1e-3))
+    queryDelayMicroSecs(Auxil::getChronoMicroSecs(queryDelay*1e-3)),
+    bytesReadCounter(Metrics::counter("casil_interface_read_bytes", "Number of bytes read from the interface.", metricsLabels)),
+    bytesWrittenCounter(Metrics::counter("casil_interface_written_bytes", "Number of bytes written to the interface.", metricsLabels)),
+    transactionsCounter(Metrics::counter("casil_interface_transactions", "Number of successful interface reads and writes.", metricsLabels)),
+    errorsCounter(Metrics::counter("casil_interface_errors", "Number of failed interface reads and writes.", metricsLabels))
 {
     if (queryDelay < 0.0)
         throw std::runtime_error("Negative query delay set for " + getSelfDescription() + ".");
 }
+
+/*!
+ * \brief Destructor.
+ *
+ * Waits for all queued asynchronous tasks to finish (see waitAsync()).
+ */
+Interface::~Interface()
+{
+    waitAsync();
+}
+
+//Public
+
+/*!
+ * \brief Queue a task for serialized execution on the asynchronous executor.
+ *
+ * Queues \p pTask for execution on an executor that is specific to this interface. All tasks of the same interface are executed
+ * one after another, in the order they were queued, while tasks of different interfaces can run concurrently. This allows
+ * independent hardware to be accessed concurrently, e.g. configuring the firmware modules of multiple boards at the same time.
+ *
+ * The executor and its thread are created on the first call.
+ *
+ * Drivers and registers bound to this interface queue their asynchronous operations here as well (see LayerBase::runAsync()).
+ *
+ * Note: The queued tasks are executed from a different thread. Do not access the interface synchronously
+ * from other threads while asynchronous tasks might still be pending (see also waitAsync()).
+ * Exceptions must not escape from \p pTask (wrap it e.g. in a \c std::packaged_task).
+ *
+ * \param pTask Task to be executed.
+ */
+void Interface::postAsync(std::function<void()> pTask) const
+{
+    const std::lock_guard<std::mutex> asyncExecutorLock(asyncExecutorMutex);
+
+    if (!asyncExecutor)
+        asyncExecutor = std::make_unique<AsyncExecutor>();
+
+    boost::asio::post(asyncExecutor->pool, std::move(pTask));
+}
+
+/*!
+ * \brief Wait until all queued asynchronous tasks have finished.
+ *
+ * Blocks until all tasks queued via postAsync() have been executed. Later calls to postAsync() will create a new executor.
+ */
+void Interface::waitAsync()
+{
+    std::unique_ptr<AsyncExecutor> executor;
+
+    {
+        const std::lock_guard<std::mutex> asyncExecutorLock(asyncExecutorMutex);
+        executor = std::move(asyncExecutor);
+    }
+
+    if (executor)
+        executor->pool.join();
+}
+
+//Protected
+
+/*!
+ * \brief Wait until the query delay has passed after a write.
+ *
+ * Blocks until the configured query delay (see Interface()) has elapsed since \p pWriteDone, using
+ * Auxil::sleepUntil() for accurate timing. Since the delay is measured from the passed time stamp
+ * instead of from the time of calling, any time already spent after the write (e.g. for checking
+ * the read buffer or preparing the read) is not waited for twice. Returns immediately if no
+ * query delay is configured or if the delay has already passed.
+ *
+ * \param pWriteDone Time at which the (last) write operation of the query finished.
+ */
+void Interface::waitForQueryDelay(const std::chrono::steady_clock::time_point pWriteDone) const
+{
+    if (queryDelayMicroSecs > std::chrono::microseconds::zero())
+        Auxil::sleepUntil(pWriteDone + queryDelayMicroSecs);
+}
+
+/*!
+ * \brief Count a successful read for the interface metrics.
+ *
+ * Increments the transactions metric and increases the read bytes metric by \p pBytes.
+ *
+ * \param pBytes Number of read bytes.
+ */
+void Interface::countRead(const std::size_t pBytes) const
+{
+    bytesReadCounter.increment(pBytes);
+    transactionsCounter.increment();
+}
+
+/*!
+ * \brief Count a successful write for the interface metrics.
+ *
+ * Increments the transactions metric and increases the written bytes metric by \p pBytes.
+ *
+ * \param pBytes Number of written bytes.
+ */
+void Interface::countWrite(const std::size_t pBytes) const
+{
+    bytesWrittenCounter.increment(pBytes);
+    transactionsCounter.increment();
+}
+
+/*!
+ * \brief Count a failed read/write for the interface metrics.
+ *
+ * Increments the errors metric.
+ */
+void Interface::countError() const
+{
+    errorsCounter.increment();
+}
@@ -27,8 +27,13 @@
 #include <casil/layerbase.h>
 
 #include <casil/layerconfig.h>
+#include <casil/metrics.h>
 
 #include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 
 namespace casil
@@ -68,7 +73,7 @@ class Interface : public LayerBase
 {
 public:
     Interface(std::string pType, std::string pName, LayerConfig pConfig, const LayerConfig& pRequiredConfig);   ///< Constructor.
-    ~Interface() override = default;                                                                            ///< Default destructor.
+    ~Interface() override;                                                                                      ///< Destructor.
     //
     /*!
      * \brief Check if the read buffer is empty.
@@ -77,6 +82,9 @@ public:
      */
     virtual bool readBufferEmpty() const = 0;
     virtual void clearReadBuffer() = 0;         ///< Clear the current contents of the read buffer.
+    //
+    void postAsync(std::function<void()> pTask) const override final;  ///< Queue a task for serialized execution on the asynchronous executor.
+    void waitAsync();                                       ///< Wait until all queued asynchronous tasks have finished.
 
 private:
     /*!
@@ -92,9 +100,27 @@ private:
      */
     bool closeImpl() override = 0;
 
+protected:
+    void waitForQueryDelay(std::chrono::steady_clock::time_point pWriteDone) const;    ///< Wait until the query delay has passed after a write.
+    //
+    void countRead(std::size_t pBytes) const;   ///< Count a successful read for the interface metrics.
+    void countWrite(std::size_t pBytes) const;  ///< Count a successful write for the interface metrics.
+    void countError() const;                    ///< Count a failed read/write for the interface metrics.
+
 protected:
     const double queryDelay;                    ///< Configured delay value for query operations (between write and read) in milliseconds.
     const std::chrono::microseconds queryDelayMicroSecs;    ///< Rounded chrono version of queryDelay.
+
+private:
+    Metrics::Counter& bytesReadCounter;         ///< Metric for the number of read bytes.
+    Metrics::Counter& bytesWrittenCounter;      ///< Metric for the number of written bytes.
+    Metrics::Counter& transactionsCounter;      ///< Metric for the number of successful reads/writes.
+    Metrics::Counter& errorsCounter;            ///< Metric for the number of failed reads/writes.
+    //
+    struct AsyncExecutor;                       ///< Single-threaded executor for asynchronous interface access (see postAsync()).
+    //
+    mutable std::unique_ptr<AsyncExecutor> asyncExecutor;   ///< Lazily created executor for postAsync().
+    mutable std::mutex asyncExecutorMutex;                  ///< Mutex for creation and use of \ref asyncExecutor.
 };
 
 } // namespace TL
@@ -23,9 +23,12 @@
 
 #include <casil/TL/muxedinterface.h>
 
+#include <algorithm>
 #include <chrono>
+#include <exception>
+#include <limits>
 #include <stdexcept>
-#include <thread>
+#include <tuple>
 #include <utility>
 
 using casil::Layers::TL::MuxedInterface;
@@ -41,12 +44,226 @@ using casil::Layers::TL::MuxedInterface;
  * \param pRequiredConfig Configuration required to be specified by \p pConfig.
  */
 MuxedInterface::MuxedInterface(std::string pType, std::string pName, LayerConfig pConfig, const LayerConfig& pRequiredConfig) :
-    Interface(std::move(pType), std::move(pName), std::move(pConfig), pRequiredConfig)
+    Interface(std::move(pType), std::move(pName), std::move(pConfig), pRequiredConfig),
+    eventCounts(),
+    eventSubscriptions(),
+    nextEventSubscriptionId(1),
+    eventMutex(),
+    eventCondition()
 {
 }
 
 //Public
 
+/*!
+ * \brief Read from the interface into a buffer.
+ *
+ * Reads (up to) as many bytes from \p pAddr as fit into \p pBuffer (see read()) and writes them to \p pBuffer.
+ *
+ * The default implementation calls read() and copies the result into \p pBuffer. Derived classes should
+ * override this function to read directly into \p pBuffer, such that repeated reads with a reused buffer
+ * do not need any memory allocations.
+ *
+ * \throws std::runtime_error If the size of \p pBuffer exceeds the range of \c int.
+ * \throws std::runtime_error If read() throws \c std::runtime_error.
+ * \throws std::runtime_error If the read bytes do not fit into \p pBuffer.
+ *
+ * \param pAddr Bus address.
+ * \param pBuffer Buffer for the read bytes.
+ * \return Number of bytes written to \p pBuffer.
+ */
+std::size_t MuxedInterface::readInto(const std::uint64_t pAddr, const std::span<std::uint8_t> pBuffer)
+{
+    if (std::cmp_greater(pBuffer.size(), std::numeric_limits<int>::max()))
+        throw std::runtime_error("Could not read from " + getSelfDescription() + ": Buffer size is out of range.");
+
+    const std::vector<std::uint8_t> data = read(pAddr, static_cast<int>(pBuffer.size()));
+
+    if (data.size() > pBuffer.size())
+        throw std::runtime_error("Could not read from " + getSelfDescription() + ": Read data does not fit into the buffer.");
+
+    std::copy(data.begin(), data.end(), pBuffer.begin());
+
+    return data.size();
+}
+
+/*!
+ * \brief Read from the interface into a pooled buffer.
+ *
+ * Reads like read() but returns the bytes in a PooledBuffer, which avoids allocating memory for repeated reads
+ * of similar size. For non-negative \p pSize the bytes are read directly into the buffer via readInto().
+ * For negative \p pSize (size not known in advance) the result of read() is copied into the buffer.
+ *
+ * \throws std::runtime_error If readInto() or read() throw \c std::runtime_error.
+ *
+ * \param pAddr Bus address.
+ * \param pSize Number of bytes to read.
+ * \return Read bytes.
+ */
+casil::PooledBuffer MuxedInterface::readPooled(const std::uint64_t pAddr, const int pSize)
+{
+    if (pSize < 0)
+    {
+        const std::vector<std::uint8_t> data = read(pAddr, pSize);
+
+        PooledBuffer buffer(data.size());
+        std::copy(data.begin(), data.end(), buffer.data());
+
+        return buffer;
+    }
+
+    PooledBuffer buffer(static_cast<std::size_t>(pSize));
+    buffer.resize(readInto(pAddr, buffer.span()));
+
+    return buffer;
+}
+
+/*!
+ * \brief Read from the interface into a small-buffer-optimized byte sequence.
+ *
+ * Reads like read() but returns the bytes in a Bytes::SmallByteVec, which does not allocate memory for short reads
+ * (up to Bytes::SmallByteVec::inlineCapacity bytes) such as typical register accesses. For non-negative \p pSize the bytes
+ * are read directly into the byte sequence via readInto(). For negative \p pSize (size not known in advance)
+ * the result of read() is copied.
+ *
+ * \throws std::runtime_error If readInto() or read() throw \c std::runtime_error.
+ *
+ * \param pAddr Bus address.
+ * \param pSize Number of bytes to read.
+ * \return Read bytes.
+ */
+casil::Bytes::SmallByteVec MuxedInterface::readSmall(const std::uint64_t pAddr, const int pSize)
+{
+    if (pSize < 0)
+        return Bytes::SmallByteVec(read(pAddr, pSize));
+
+    Bytes::SmallByteVec bytes(static_cast<std::size_t>(pSize));
+    bytes.resize(readInto(pAddr, bytes));
+
+    return bytes;
+}
+
+/*!
+ * \brief Read multiple byte sequences from the interface.
+ *
+ * Reads the requested number of bytes for every operation in \p pOps from its respective bus address, in the given order.
+ *
+ * The default implementation simply calls read() for each operation. Derived classes may
+ * override this function to overlap the operations' transfers, where possible.
+ *
+ * \throws std::runtime_error If read() throws \c std::runtime_error.
+ *
+ * \param pOps Read operations (bus addresses and sizes) to be performed.
+ * \return Read bytes of every operation (in the order of \p pOps).
+ */
+std::vector<std::vector<std::uint8_t>> MuxedInterface::readBatch(const std::span<const ReadOp> pOps)
+{
+    std::vector<std::vector<std::uint8_t>> retVal;
+    retVal.reserve(pOps.size());
+
+    for (const ReadOp& op : pOps)
+        retVal.push_back(read(op.addr, op.size));
+
+    return retVal;
+}
+
+/*!
+ * \brief Read from the interface into a buffer without throwing.
+ *
+ * Reads like readInto() but reports failures via the returned Expected instead of an exception,
+ * which avoids the cost of exceptions for expected failures such as timeouts in polling loops.
+ *
+ * The default implementation calls readInto() and converts a thrown \c std::invalid_argument or \c std::runtime_error
+ * into an Error with code Error::Code::InvalidArgument or Error::Code::Failure, respectively. Derived classes may override this function to avoid exceptions altogether.
+ *
+ * \param pAddr Bus address.
+ * \param pBuffer Buffer for the read bytes.
+ * \return Number of bytes written to \p pBuffer or the error that occurred.
+ */
+casil::Expected<std::size_t> MuxedInterface::tryReadInto(const std::uint64_t pAddr, const std::span<std::uint8_t> pBuffer)
+{
+    try
+    {
+        return readInto(pAddr, pBuffer);
+    }
+    catch (const std::invalid_argument& exc)
+    {
+        return Error(Error::Code::InvalidArgument, [message = std::string(exc.what())]() { return message; });
+    }
+    catch (const std::runtime_error& exc)
+    {
+        return Error(Error::Code::Failure, [message = std::string(exc.what())]() { return message; });
+    }
+}
+
+/*!
+ * \brief Write to the interface from a buffer.
+ *
+ * Writes \p pData to \p pAddr like write().
+ *
+ * The default implementation copies \p pData into a vector and calls write(). Derived classes should override
+ * this function to write directly from \p pData, such that writes of short payloads (e.g. from a Bytes::SmallByteVec)
+ * do not need any memory allocations.
+ *
+ * \throws std::runtime_error If write() throws \c std::runtime_error.
+ *
+ * \param pAddr Bus address.
+ * \param pData %Bytes to be written.
+ */
+void MuxedInterface::writeFrom(const std::uint64_t pAddr, const std::span<const std::uint8_t> pData)
+{
+    write(pAddr, std::vector<std::uint8_t>(pData.begin(), pData.end()));
+}
+
+/*!
+ * \brief Write multiple byte sequences to the interface.
+ *
+ * Writes the data of every operation in \p pOps to its respective bus address, in the given order.
+ *
+ * The default implementation simply calls write() for each operation. Derived classes may
+ * override this function to combine the operations into fewer transfers, where possible.
+ *
+ * \throws std::runtime_error If write() throws \c std::runtime_error.
+ *
+ * \param pOps Write operations (bus addresses and data) to be performed.
+ */
+void MuxedInterface::writeBatch(const std::span<const WriteOp> pOps)
+{
+    for (const WriteOp& op : pOps)
+        write(op.addr, op.data);
+}
+
+/*!
+ * \brief Write to the interface from a buffer without throwing.
+ *
+ * Writes like writeFrom() but reports failures via the returned Expected instead of an exception,
+ * which avoids the cost of exceptions for expected failures such as timeouts in polling loops.
+ *
+ * The default implementation calls writeFrom() and converts a thrown \c std::invalid_argument or \c std::runtime_error
+ * into an Error with code Error::Code::InvalidArgument or Error::Code::Failure, respectively. Derived classes may override this function to avoid exceptions altogether.
+ *
+ * \param pAddr Bus address.
+ * \param pData %Bytes to be written.
+ * \return Nothing or the error that occurred.
+ */
+casil::Expected<void> MuxedInterface::tryWriteFrom(const std::uint64_t pAddr, const std::span<const std::uint8_t> pData)
+{
+    try
+    {
+        writeFrom(pAddr, pData);
+    }
+    catch (const std::invalid_argument& exc)
+    {
+        return Error(Error::Code::InvalidArgument, [message = std::string(exc.what())]() { return message; });
+    }
+    catch (const std::runtime_error& exc)
+    {
+        return Error(Error::Code::Failure, [message = std::string(exc.what())]() { return message; });
+    }
+
+    return {};
+}
+
 /*!
  * \brief Write a query to the interface and read the response.
  *
@@ -74,8 +291,7 @@ std::vector<std::uint8_t> MuxedInterface::query(const std::uint64_t pWriteAddr,
 
         write(pWriteAddr, pData);
 
-        if (queryDelayMicroSecs > std::chrono::microseconds::zero())
-            std::this_thread::sleep_for(queryDelayMicroSecs);
+        waitForQueryDelay(std::chrono::steady_clock::now());
 
         return read(pReadAddr, pSize);
     }
@@ -84,3 +300,155 @@ std::vector<std::uint8_t> MuxedInterface::query(const std::uint64_t pWriteAddr,
         throw std::runtime_error("Could not query from " + getSelfDescription() + ": " + exc.what());
     }
 }
+
+//
+
+/*!
+ * \brief Check if the interface receives event notifications.
+ *
+ * Indicates whether the interface is configured to receive event notifications from the firmware modules
+ * and pass them to publishEvent(). If not, getEventCount() stays zero and waitForEvent() always times out.
+ *
+ * The default implementation returns false. Derived classes that receive notifications must override this function.
+ *
+ * \return False.
+ */
+bool MuxedInterface::supportsEvents() const
+{
+    return false;
+}
+
+/*!
+ * \brief Subscribe to event notifications of a module.
+ *
+ * Calls \p pHandler with the source bus address and the payload of every subsequent event notification
+ * from the module at bus address \p pSourceAddr (see publishEvent()), until unsubscribeEvents() is called
+ * with the returned subscription ID. The handler is called from the thread that received the notification
+ * (typically an IO context thread) and should hence return quickly and must not block.
+ *
+ * \param pSourceAddr Bus address of the notifying module.
+ * \param pHandler Handler for the notifications.
+ * \return Subscription ID.
+ */
+std::uint64_t MuxedInterface::subscribeEvents(const std::uint64_t pSourceAddr, EventHandlerType pHandler)
+{
+    const std::lock_guard<std::mutex> eventLock(eventMutex);
+    (void)eventLock;
+
+    const std::uint64_t id = nextEventSubscriptionId++;
+
+    eventSubscriptions.emplace(std::piecewise_construct, std::forward_as_tuple(id),
+                               std::forward_as_tuple(pSourceAddr, std::make_shared<const EventHandlerType>(std::move(pHandler))));
+
+    return id;
+}
+
+/*!
+ * \brief Cancel a subscription to event notifications.
+ *
+ * Note: The handler may still be called once by a concurrent publishEvent() that started before this call.
+ *
+ * \param pSubscriptionId Subscription ID as returned by subscribeEvents().
+ */
+void MuxedInterface::unsubscribeEvents(const std::uint64_t pSubscriptionId)
+{
+    const std::lock_guard<std::mutex> eventLock(eventMutex);
+    (void)eventLock;
+
+    eventSubscriptions.erase(pSubscriptionId);
+}
+
+/*!
+ * \brief Get the number of event notifications of a module.
+ *
+ * The count can be used as starting point for waitForEvent(): Taking the count \e before checking the module state
+ * (e.g. via HL::Driver::isDone()) and then waiting for a count change avoids missing a notification in between.
+ *
+ * \param pSourceAddr Bus address of the notifying module.
+ * \return Number of notifications received from \p pSourceAddr so far.
+ */
+std::uint64_t MuxedInterface::getEventCount(const std::uint64_t pSourceAddr) const
+{
+    const std::lock_guard<std::mutex> eventLock(eventMutex);
+    (void)eventLock;
+
+    const auto it = eventCounts.find(pSourceAddr);
+
+    return (it != eventCounts.end() ? it->second : 0);
+}
+
+/*!
+ * \brief Wait for a new event notification of a module.
+ *
+ * Blocks until the notification count of \p pSourceAddr (see getEventCount()) differs from \p pSeenCount
+ * or until \p pTimeout has passed. Returns immediately if the count already differs.
+ *
+ * \param pSourceAddr Bus address of the notifying module.
+ * \param pSeenCount Notification count already known to the caller.
+ * \param pTimeout Maximum time to wait.
+ * \return True if a new notification was received and false on timeout.
+ */
+bool MuxedInterface::waitForEvent(const std::uint64_t pSourceAddr, const std::uint64_t pSeenCount, const std::chrono::milliseconds pTimeout) const
+{
+    std::unique_lock<std::mutex> eventLock(eventMutex);
+
+    return eventCondition.wait_for(eventLock, pTimeout, [this, pSourceAddr, pSeenCount]() -> bool
+                                                   {
+                                                       const auto it = eventCounts.find(pSourceAddr);
+                                                       return (it != eventCounts.end() ? it->second : 0) != pSeenCount;
+                                                   });
+}
+
+//Protected
+
+/*!
+ * \brief Count an event notification and pass it to the subscribers.
+ *
+ * Calls the handlers of all subscriptions for \p pSourceAddr (see subscribeEvents()), then increments the notification
+ * count of \p pSourceAddr and wakes up all waitForEvent() calls, i.e. waiting threads see the effects of the handlers.
+ * The handlers are called without holding the internal lock, i.e. they may (un)subscribe themselves.
+ * Exceptions thrown by handlers are logged.
+ *
+ * To be called by derived classes whenever an event notification from a firmware module was received.
+ *
+ * \param pSourceAddr Bus address of the notifying module.
+ * \param pPayload Module-specific notification payload.
+ */
+void MuxedInterface::publishEvent(const std::uint64_t pSourceAddr, const std::span<const std::uint8_t> pPayload)
+{
+    std::vector<std::shared_ptr<const EventHandlerType>> handlers;
+
+    {
+        const std::lock_guard<std::mutex> eventLock(eventMutex);
+        (void)eventLock;
+
+        for (const auto& [id, subscription] : eventSubscriptions)
+        {
+            (void)id;
+
+            if (subscription.sourceAddr == pSourceAddr)
+                handlers.push_back(subscription.handler);
+        }
+    }
+
+    for (const std::shared_ptr<const EventHandlerType>& handler : handlers)
+    {
+        try
+        {
+            (*handler)(pSourceAddr, pPayload);
+        }
+        catch (const std::exception& exc)
+        {
+            logger.logError(std::string("Exception in event notification handler: ") + exc.what());
+        }
+    }
+
+    {
+        const std::lock_guard<std::mutex> eventLock(eventMutex);
+        (void)eventLock;
+
+        ++eventCounts[pSourceAddr];
+    }
+
+    eventCondition.notify_all();
+}
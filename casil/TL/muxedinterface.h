@@ -26,9 +26,20 @@
 
 #include <casil/TL/interface.h>
 
+#include <casil/bytes.h>
+#include <casil/error.h>
 #include <casil/layerconfig.h>
+#include <casil/pooledbuffer.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -48,11 +59,38 @@ namespace TL
  * \e addressable parts of the same hardware device. This would typically be an interface to connect to FPGA hardware based
  * on the basil bus, which allows multiple drivers to control multiple (dependent) firmware modules at different bus addresses.
  *
+ * Interfaces that can receive event notifications from the firmware modules (e.g. when a sequence has finished)
+ * pass them to publishEvent(), which counts them per source bus address and forwards them to the subscribed handlers
+ * (see subscribeEvents()). Drivers can then wait for notifications (see waitForEvent()) instead of polling the bus
+ * (see also HL::MuxedDriver::waitUntilDone()). See supportsEvents().
+ *
  * Note: This is in contrast to DirectInterface, which should be used for hardware that can work \e independently
  * of other used hardware devices and that is usually only contolled by a single HL::Driver component.
  */
 class MuxedInterface : public Interface
 {
+public:
+    /*!
+     * \brief Single bus read operation as part of a batch of read operations (see readBatch()).
+     */
+    struct ReadOp
+    {
+        std::uint64_t addr;                 ///< Bus address.
+        int size;                           ///< Number of bytes to read.
+    };
+    /*!
+     * \brief Single bus write operation as part of a batch of write operations (see writeBatch()).
+     */
+    struct WriteOp
+    {
+        std::uint64_t addr;                 ///< Bus address.
+        std::vector<std::uint8_t> data;     ///< %Bytes to be written.
+    };
+
+    using EventHandlerType = std::function<void(std::uint64_t pSourceAddr, std::span<const std::uint8_t> pPayload)>;
+                                            ///< \brief Function type for handling event notifications from firmware modules
+                                            ///  (see subscribeEvents()).
+
 public:
     MuxedInterface(std::string pType, std::string pName, LayerConfig pConfig, const LayerConfig& pRequiredConfig);  ///< Constructor.
     ~MuxedInterface() override = default;                                                                           ///< Default destructor.
@@ -65,6 +103,17 @@ public:
      * \return Read bytes.
      */
     virtual std::vector<std::uint8_t> read(std::uint64_t pAddr, int pSize = -1) = 0;
+    virtual std::size_t readInto(std::uint64_t pAddr, std::span<std::uint8_t> pBuffer);                     ///< \brief Read from the interface
+                                                                                                            ///  into a buffer.
+    PooledBuffer readPooled(std::uint64_t pAddr, int pSize = -1);                                           ///< \brief Read from the interface
+                                                                                                            ///  into a pooled buffer.
+    Bytes::SmallByteVec readSmall(std::uint64_t pAddr, int pSize = -1);                                     ///< \brief Read from the interface
+                                                                                                            ///  into a small-buffer-optimized
+                                                                                                            ///  byte sequence.
+    virtual std::vector<std::vector<std::uint8_t>> readBatch(std::span<const ReadOp> pOps);                 ///< \brief Read multiple byte
+                                                                                                            ///  sequences from the interface.
+    virtual Expected<std::size_t> tryReadInto(std::uint64_t pAddr, std::span<std::uint8_t> pBuffer);        ///< \brief Read from the interface
+                                                                                                            ///  into a buffer without throwing.
     /*!
      * \brief Write to the interface.
      *
@@ -72,16 +121,55 @@ public:
      * \param pData %Bytes to be written.
      */
     virtual void write(std::uint64_t pAddr, const std::vector<std::uint8_t>& pData) = 0;
+    virtual void writeFrom(std::uint64_t pAddr, std::span<const std::uint8_t> pData);                       ///< \brief Write to the interface
+                                                                                                            ///  from a buffer.
+    virtual void writeBatch(std::span<const WriteOp> pOps);                                                 ///< \brief Write multiple byte
+                                                                                                            ///  sequences to the interface.
+    virtual Expected<void> tryWriteFrom(std::uint64_t pAddr, std::span<const std::uint8_t> pData);          ///< \brief Write to the interface
+                                                                                                            ///  from a buffer without throwing.
     virtual std::vector<std::uint8_t> query(std::uint64_t pWriteAddr, std::uint64_t pReadAddr,
                                             const std::vector<std::uint8_t>& pData, int pSize = -1) = 0;    ///< \brief Write a query to the
                                                                                                             ///  interface and read the response.
     //
     bool readBufferEmpty() const override = 0;
     void clearReadBuffer() override = 0;
+    //
+    virtual bool supportsEvents() const;                                                                    ///< \brief Check if the interface
+                                                                                                            ///  receives event notifications.
+    std::uint64_t subscribeEvents(std::uint64_t pSourceAddr, EventHandlerType pHandler);                    ///< \brief Subscribe to event
+                                                                                                            ///  notifications of a module.
+    void unsubscribeEvents(std::uint64_t pSubscriptionId);                                                  ///< \brief Cancel a subscription
+                                                                                                            ///  to event notifications.
+    std::uint64_t getEventCount(std::uint64_t pSourceAddr) const;                                           ///< \brief Get the number of event
+                                                                                                            ///  notifications of a module.
+    bool waitForEvent(std::uint64_t pSourceAddr, std::uint64_t pSeenCount, std::chrono::milliseconds pTimeout) const;
+                                                                                                            ///< \brief Wait for a new event
+                                                                                                            ///  notification of a module.
+
+protected:
+    void publishEvent(std::uint64_t pSourceAddr, std::span<const std::uint8_t> pPayload);                  ///< \brief Count an event notification
+                                                                                                            ///  and pass it to the subscribers.
 
 private:
     bool initImpl() override = 0;
     bool closeImpl() override = 0;
+
+private:
+    /*!
+     * \brief Subscription to the event notifications of a single module (see subscribeEvents()).
+     */
+    struct EventSubscription
+    {
+        std::uint64_t sourceAddr;                               ///< Bus address of the notifying module.
+        std::shared_ptr<const EventHandlerType> handler;        ///< Handler for the notifications.
+    };
+
+private:
+    std::map<std::uint64_t, std::uint64_t> eventCounts;                 ///< Number of received event notifications per source bus address.
+    std::map<std::uint64_t, EventSubscription> eventSubscriptions;      ///< Active event subscriptions by subscription ID.
+    std::uint64_t nextEventSubscriptionId;                              ///< ID for the next event subscription.
+    mutable std::mutex eventMutex;                                      ///< Mutex for the event counts and subscriptions.
+    mutable std::condition_variable eventCondition;                     ///< Signals newly counted event notifications.
 };
 
 } // namespace TL
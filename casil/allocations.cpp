@@ -0,0 +1,247 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/allocations.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using casil::Allocations;
+
+namespace
+{
+
+thread_local Allocations::Counts threadCounts {0, 0};   //Allocations of the current thread
+
+std::atomic<std::uint64_t> processAllocations = 0;      //Allocations of all threads
+std::atomic<std::uint64_t> processBytes = 0;            //Allocated bytes of all threads
+
+#ifdef CASIL_ENABLE_ALLOCATION_COUNTING
+
+/*
+ * Allocates 'pSize' bytes with alignment 'pAlignment' (zero for default alignment) and counts the allocation.
+ * Calls the new-handler until the allocation succeeds and returns nullptr if there is none.
+ */
+void* allocate(std::size_t pSize, const std::size_t pAlignment) noexcept
+{
+    if (pSize == 0)
+        pSize = 1;
+
+    for (;;)
+    {
+        void* ptr = nullptr;
+
+        if (pAlignment == 0)
+            ptr = std::malloc(pSize);
+        else
+        {
+#ifdef _WIN32
+            ptr = _aligned_malloc(pSize, pAlignment);
+#else
+            ptr = std::aligned_alloc(pAlignment, ((pSize - 1) / pAlignment + 1) * pAlignment);
+#endif
+        }
+
+        if (ptr != nullptr)
+        {
+            Allocations::countAllocation(pSize);
+            return ptr;
+        }
+
+        const std::new_handler handler = std::get_new_handler();
+
+        if (handler == nullptr)
+            return nullptr;
+
+        try
+        {
+            handler();
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+}
+
+/*
+ * Like ::allocate() but throws std::bad_alloc on failure.
+ */
+void* allocateOrThrow(const std::size_t pSize, const std::size_t pAlignment)
+{
+    void* const ptr = ::allocate(pSize, pAlignment);
+
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+
+    return ptr;
+}
+
+/*
+ * Frees memory from ::allocate() with alignment 'pAligned'.
+ */
+void deallocate(void* const pPtr, const bool pAligned) noexcept
+{
+#ifdef _WIN32
+    if (pAligned)
+    {
+        _aligned_free(pPtr);
+        return;
+    }
+#else
+    (void)pAligned;
+#endif
+    std::free(pPtr);
+}
+
+#endif
+
+} // namespace
+
+//Allocations::Scope
+
+/*!
+ * \brief Constructor.
+ *
+ * Takes the current allocation counts of the current thread.
+ */
+Allocations::Scope::Scope() :
+    startCounts(getThreadCounts())
+{
+}
+
+//Public
+
+/*!
+ * \brief Get the allocations of the current thread since construction.
+ *
+ * \return Number of allocations and allocated bytes since construction.
+ */
+Allocations::Counts Allocations::Scope::getCounts() const
+{
+    const Counts counts = getThreadCounts();
+
+    return {counts.allocations - startCounts.allocations, counts.bytes - startCounts.bytes};
+}
+
+//Allocations
+
+//Public
+
+/*!
+ * \brief Check if allocation counting was compiled in.
+ *
+ * \return True if the library was compiled with \c CASIL_ENABLE_ALLOCATION_COUNTING.
+ */
+bool Allocations::isAvailable()
+{
+#ifdef CASIL_ENABLE_ALLOCATION_COUNTING
+    return true;
+#else
+    return false;
+#endif
+}
+
+//
+
+/*!
+ * \brief Get the allocation counts of the current thread.
+ *
+ * \return Number of allocations and allocated bytes of the current thread so far (zero if not available).
+ */
+Allocations::Counts Allocations::getThreadCounts()
+{
+    return threadCounts;
+}
+
+/*!
+ * \brief Get the allocation counts of all threads.
+ *
+ * \return Number of allocations and allocated bytes of the whole process so far (zero if not available).
+ */
+Allocations::Counts Allocations::getProcessCounts()
+{
+    return {processAllocations.load(std::memory_order_relaxed), processBytes.load(std::memory_order_relaxed)};
+}
+
+//
+
+/*!
+ * \brief Count an allocation.
+ *
+ * Called by the replaced allocation functions. Can also be used to account for allocations
+ * by other means (e.g. custom allocators) if these should be included in the counts.
+ *
+ * \param pSize Number of allocated bytes.
+ */
+void Allocations::countAllocation(const std::size_t pSize) noexcept
+{
+    ++threadCounts.allocations;
+    threadCounts.bytes += pSize;
+
+    processAllocations.fetch_add(1, std::memory_order_relaxed);
+    processBytes.fetch_add(pSize, std::memory_order_relaxed);
+}
+
+//Replaced global allocation functions
+
+#ifdef CASIL_ENABLE_ALLOCATION_COUNTING
+
+void* operator new(const std::size_t pSize) { return ::allocateOrThrow(pSize, 0); }
+void* operator new[](const std::size_t pSize) { return ::allocateOrThrow(pSize, 0); }
+void* operator new(const std::size_t pSize, const std::nothrow_t&) noexcept { return ::allocate(pSize, 0); }
+void* operator new[](const std::size_t pSize, const std::nothrow_t&) noexcept { return ::allocate(pSize, 0); }
+
+void* operator new(const std::size_t pSize, const std::align_val_t pAlign)
+{
+    return ::allocateOrThrow(pSize, static_cast<std::size_t>(pAlign));
+}
+void* operator new[](const std::size_t pSize, const std::align_val_t pAlign)
+{
+    return ::allocateOrThrow(pSize, static_cast<std::size_t>(pAlign));
+}
+void* operator new(const std::size_t pSize, const std::align_val_t pAlign, const std::nothrow_t&) noexcept
+{
+    return ::allocate(pSize, static_cast<std::size_t>(pAlign));
+}
+void* operator new[](const std::size_t pSize, const std::align_val_t pAlign, const std::nothrow_t&) noexcept
+{
+    return ::allocate(pSize, static_cast<std::size_t>(pAlign));
+}
+
+void operator delete(void* const pPtr) noexcept { ::deallocate(pPtr, false); }
+void operator delete[](void* const pPtr) noexcept { ::deallocate(pPtr, false); }
+void operator delete(void* const pPtr, std::size_t) noexcept { ::deallocate(pPtr, false); }
+void operator delete[](void* const pPtr, std::size_t) noexcept { ::deallocate(pPtr, false); }
+void operator delete(void* const pPtr, const std::nothrow_t&) noexcept { ::deallocate(pPtr, false); }
+void operator delete[](void* const pPtr, const std::nothrow_t&) noexcept { ::deallocate(pPtr, false); }
+
+void operator delete(void* const pPtr, std::align_val_t) noexcept { ::deallocate(pPtr, true); }
+void operator delete[](void* const pPtr, std::align_val_t) noexcept { ::deallocate(pPtr, true); }
+void operator delete(void* const pPtr, std::size_t, std::align_val_t) noexcept { ::deallocate(pPtr, true); }
+void operator delete[](void* const pPtr, std::size_t, std::align_val_t) noexcept { ::deallocate(pPtr, true); }
+void operator delete(void* const pPtr, std::align_val_t, const std::nothrow_t&) noexcept { ::deallocate(pPtr, true); }
+void operator delete[](void* const pPtr, std::align_val_t, const std::nothrow_t&) noexcept { ::deallocate(pPtr, true); }
+
+#endif
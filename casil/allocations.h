@@ -0,0 +1,98 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_ALLOCATIONS_H
+#define CASIL_ALLOCATIONS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace casil
+{
+
+/*!
+ * \brief Count heap allocations for finding and budgeting allocations in hot paths.
+ *
+ * If the library is compiled with \c CASIL_ENABLE_ALLOCATION_COUNTING defined (see CMake option of the same name),
+ * it replaces the global allocation functions (<tt>operator new</tt> etc.) by versions that count the number
+ * of allocations and allocated bytes, both per thread (see getThreadCounts()) and for the whole process
+ * (see getProcessCounts()). Otherwise all counts stay zero and isAvailable() returns false.
+ *
+ * The allocations of a code region on the current thread can be measured via the RAII helper Scope.
+ * Additionally, while Timing is enabled, the allocations made by timed layer component operations (see
+ * LayerBase::timeOperation(), i.e. the public read/write/query/init/close APIs of the TL, HL and RL components)
+ * are accumulated in the counters of metric families "casil_operation_allocations" and
+ * "casil_operation_allocated_bytes" (see Timing::getAllocationsCounter() and Timing::getAllocatedBytesCounter()).
+ *
+ * Note: The counting adds a thread-local and an atomic increment to every allocation and is intended
+ * for instrumentation builds only. Deallocations are not counted.
+ */
+class Allocations
+{
+public:
+    /*!
+     * \brief Number of allocations and allocated bytes.
+     */
+    struct Counts
+    {
+        std::uint64_t allocations;  ///< Number of allocations.
+        std::uint64_t bytes;        ///< Number of requested bytes of all allocations.
+    };
+
+    /*!
+     * \brief RAII helper for measuring the allocations of a code region.
+     *
+     * Takes the allocation counts of the current thread on construction. getCounts() returns
+     * the allocations of the current thread since then (i.e. the scope must not change threads).
+     */
+    class Scope
+    {
+    public:
+        Scope();                                                ///< Constructor.
+        Scope(const Scope&) = delete;                           ///< Deleted copy constructor.
+        Scope(Scope&&) = delete;                                ///< Deleted move constructor.
+        ~Scope() = default;                                     ///< Default destructor.
+        //
+        Scope& operator=(const Scope&) = delete;                ///< Deleted copy assignment operator.
+        Scope& operator=(Scope&&) = delete;                     ///< Deleted move assignment operator.
+        //
+        Counts getCounts() const;                               ///< Get the allocations of the current thread since construction.
+
+    private:
+        const Counts startCounts;                               ///< Thread allocation counts on construction.
+    };
+
+public:
+    Allocations() = delete;                                     ///< Deleted constructor.
+    //
+    static bool isAvailable();                                  ///< Check if allocation counting was compiled in.
+    //
+    static Counts getThreadCounts();                            ///< Get the allocation counts of the current thread.
+    static Counts getProcessCounts();                           ///< Get the allocation counts of all threads.
+    //
+    static void countAllocation(std::size_t pSize) noexcept;    ///< Count an allocation.
+};
+
+} // namespace casil
+
+#endif // CASIL_ALLOCATIONS_H
@@ -23,13 +23,21 @@
 
 #include <casil/asio.h>
 
+#include <casil/auxil.h>
 #include <casil/logger.h>
 
 #include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <system_error>
 
@@ -39,26 +47,115 @@ namespace
 using WorkGuard = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
 
 /*
- * Creates a static "work guard" for the IO context object (from getIOContext()) and always returns that one,
- * except if reset() was called on the work guard before; then a new work guard instance will be assigned.
+ * Thread running an IO context, with a flag to let it finish early (only used in adaptive mode, see ASIO::startRunIOContextAdaptive()).
+ */
+struct IOContextThread
+{
+    std::atomic_bool retire {false};    //Finish after the current run interval
+    std::thread thread;                 //The running thread
+};
+
+/*
+ * State of the monitor thread that scales the IO context threads in adaptive mode (see ASIO::runAdaptiveMonitor()).
+ */
+struct AdaptiveMonitor
+{
+    std::thread thread;                         //The monitor thread
+    std::condition_variable stopCondition;      //Wakes up the monitor thread for stopping
+    bool stopRequested = false;                 //Monitor thread shall finish
+};
+
+/*
+ * Handler posted to an IO context in order to measure the queueing delay of its handlers (see ASIO::runAdaptiveMonitor()).
+ */
+struct DelayProbe
+{
+    std::chrono::steady_clock::time_point postTime;                 //Time of posting the probe
+    std::atomic<std::chrono::steady_clock::rep> delay {-1};         //Measured delay in clock ticks (negative while still queued)
+};
+
+/*
+ * Creates a static pool of IO context objects (initially containing a single one) and always returns that one.
  *
- * This guard is used to keep the threads from startRunIOContext() running all the time until explicitly stopped by stopRunIOContext().
+ * A deque is used such that references to the contained IO contexts stay valid when the pool grows.
  */
-WorkGuard& getWorkGuard()
+std::deque<boost::asio::io_context>& getIOContextPool()
 {
-    static std::unique_ptr<WorkGuard> work;
+    static std::deque<boost::asio::io_context> ioContextPool(1);
+    return ioContextPool;
+}
 
-    //Create a new work guard if it was not yet created or if it was reset before
-    if (!work || !(work->owns_work()))
-    {
-        if (work)
-            work->reset();
+/*
+ * Creates a static list of "work guards" for the IO context objects from getIOContextPool() and always returns that one.
+ *
+ * These guards are used to keep the threads from startRunIOContext() running all the time until explicitly stopped by stopRunIOContext().
+ */
+std::vector<std::unique_ptr<WorkGuard>>& getWorkGuards()
+{
+    static std::vector<std::unique_ptr<WorkGuard>> workGuards;
+    return workGuards;
+}
+
+/*
+ * Creates a static list of the running threads of each IO context from getIOContextPool() and always returns that one.
+ */
+std::vector<std::list<std::unique_ptr<IOContextThread>>>& getThreads()
+{
+    static std::vector<std::list<std::unique_ptr<IOContextThread>>> threads;
+    return threads;
+}
+
+/*
+ * Creates a static list of the scheduling settings for the threads of each IO context from getIOContextPool() and always returns that one.
+ */
+std::vector<casil::Auxil::ThreadScheduling>& getThreadSchedulings()
+{
+    static std::vector<casil::Auxil::ThreadScheduling> threadSchedulings;
+    return threadSchedulings;
+}
+
+/*
+ * Creates a static list of the numbers of dedicated threads requested for each IO context from getIOContextPool()
+ * (see ASIO::requestDedicatedThreads()) and always returns that one.
+ */
+std::vector<unsigned int>& getDedicatedThreads()
+{
+    static std::vector<unsigned int> dedicatedThreads;
+    return dedicatedThreads;
+}
+
+/*
+ * Creates a static adaptive monitor state and always returns that one.
+ */
+AdaptiveMonitor& getAdaptiveMonitor()
+{
+    static AdaptiveMonitor adaptiveMonitor;
+    return adaptiveMonitor;
+}
+
+/*
+ * Returns the mutex for the thread lists, scheduling settings, dedicated thread numbers and adaptive monitor state from above.
+ */
+std::mutex& getThreadsMutex()
+{
+    static std::mutex threadsMutex;
+    return threadsMutex;
+}
+
+/*
+ * Returns the pool index of 'pIOContext' in getIOContextPool() or the pool size if it is not part of the pool.
+ */
+std::size_t findIOContextIndex(const boost::asio::io_context& pIOContext)
+{
+    const std::deque<boost::asio::io_context>& ioContextPool = getIOContextPool();
 
-        work.reset();
-        work = std::make_unique<WorkGuard>(boost::asio::make_work_guard(casil::ASIO::getIOContext()));
+    for (std::size_t i = 0; i < ioContextPool.size(); ++i)
+    {
+        if (&ioContextPool[i] == &pIOContext)
+            return i;
     }
 
-    return *work;
+    return ioContextPool.size();
 }
 
 } // namespace
@@ -66,7 +163,11 @@ WorkGuard& getWorkGuard()
 using casil::ASIO;
 
 bool ASIO::ioContextRunning = false;
-std::vector<std::thread> ASIO::ioContextThreads;
+bool ASIO::ioContextAdaptive = false;
+bool ASIO::ioContextStopping = false;
+ASIO::AdaptiveSettings ASIO::adaptiveSettings = {};
+std::size_t ASIO::ioContextPoolSize = 1;
+std::atomic<std::size_t> ASIO::nextIOContextIndex = 0;
 
 //Public
 
@@ -74,6 +175,7 @@ std::vector<std::thread> ASIO::ioContextThreads;
  * \brief Get the IO context object.
  *
  * Creates a static IO context object and always returns that one.
+ * This is the first IO context from the IO context pool (see getIOContext(int)).
  *
  * See also the \e Boost documentation for \c boost::asio::io_context.
  *
@@ -81,104 +183,218 @@ std::vector<std::thread> ASIO::ioContextThreads;
  */
 boost::asio::io_context& ASIO::getIOContext()
 {
-    static boost::asio::io_context ioContext;
-    return ioContext;
+    return getIOContextPool().front();
+}
+
+/*!
+ * \brief Get an IO context object from the IO context pool.
+ *
+ * Returns the IO context with index \p pIndex from the IO context pool (see setIOContextPoolSize()).
+ * If \p pIndex is negative, the IO contexts of the pool are returned in a round-robin fashion instead.
+ *
+ * \throws std::runtime_error If \p pIndex is not smaller than the pool size (see getIOContextPoolSize()).
+ *
+ * \param pIndex Index of the IO context in the pool, or -1.
+ * \return The selected IO context object.
+ */
+boost::asio::io_context& ASIO::getIOContext(const int pIndex)
+{
+    if (pIndex < 0)
+        return getIOContextPool()[nextIOContextIndex.fetch_add(1) % ioContextPoolSize];
+
+    if (static_cast<std::size_t>(pIndex) >= ioContextPoolSize)
+        throw std::runtime_error("IO context index " + std::to_string(pIndex) + " exceeds the IO context pool size (" +
+                                 std::to_string(ioContextPoolSize) + ").");
+
+    return getIOContextPool()[pIndex];
 }
 
 //
 
 /*!
- * \brief Start threads that continuously execute/run the IO context.
+ * \brief Set the number of IO context objects in the IO context pool.
  *
- * Starts \p pNumThreads processing threads that are responsible for executing async IO handlers for respective
- * async requests made to the Boost %ASIO library. Sets up a "work guard" to keep the threads running even if
- * no handlers are scheduled at some time. Hence stopping the threads is achieved with stopRunIOContext().
+ * Changes the number of IO contexts that are available via getIOContext(int) and run by startRunIOContext().
+ * The pool can only grow, since objects may already use the existing IO contexts.
  *
- * See also Auxil::AsyncIORunner for a RAII approach of running these threads.
+ * Note that the pool size should be set before constructing any interfaces, since these are pinned to
+ * one of the IO contexts on construction (see \ref casil::Layers::TL::Interface "TL::Interface").
  *
- * If IO context threads are already/still running (see ioContextThreadsRunning()), this function will do nothing but return false.
+ * If IO context threads are already/still running (see ioContextThreadsRunning()) or if \p pSize is zero or
+ * smaller than the current pool size, this function will do nothing but return false.
  *
- * \param pNumThreads Number of threads to start.
- * \return True if the threads were started.
+ * \param pSize New number of IO contexts.
+ * \return True if the pool size was set.
  */
-bool ASIO::startRunIOContext(const unsigned int pNumThreads)
+bool ASIO::setIOContextPoolSize(const std::size_t pSize)
 {
-    if (ioContextRunning)
+    if (ioContextRunning || ioContextStopping)
         return false;
 
-    if (pNumThreads == 0)
+    if (pSize == 0 || pSize < ioContextPoolSize)
         return false;
 
-    Logger::logInfo("Starting " + std::to_string(pNumThreads) + " IO context threads...");
+    std::deque<boost::asio::io_context>& ioContextPool = getIOContextPool();
 
-    boost::asio::io_context& ioContextRef = getIOContext();
-    ioContextRef.restart();
+    while (ioContextPool.size() < pSize)
+        ioContextPool.emplace_back();
 
-    ::getWorkGuard();   //Set up "work guard"
+    ioContextPoolSize = pSize;
+    nextIOContextIndex.store(0);
 
-    for (unsigned int i = 0; i < pNumThreads; ++i)
-    {
-        try
-        {
-            boost::asio::io_context *const ioContextPtr = &ioContextRef;    //Need to be pedantic and capture pointer by value
-
-            ioContextThreads.emplace_back(
-                        [ioContextPtr]()
-                        {
-                            std::ostringstream threadIdStrm;
-                            threadIdStrm<<std::this_thread::get_id();
+    return true;
+}
 
-                            Logger::logDebug("Started IO context thread " + threadIdStrm.str() + ".");
+/*!
+ * \brief Get the number of IO context objects in the IO context pool.
+ *
+ * \return Number of IO contexts.
+ */
+std::size_t ASIO::getIOContextPoolSize()
+{
+    return ioContextPoolSize;
+}
 
-                            ioContextPtr->run();
+//
 
-                            Logger::logDebug("Finished IO context thread " + threadIdStrm.str() + ".");
-                        });
-        }
-        catch (const std::system_error& exc)
-        {
-            Logger::logError(std::string("Exception while starting IO context threads: ") + exc.what());
-            Logger::logWarning("Stopping already started threads...");
+/*!
+ * \brief Start threads that continuously execute/run the IO context(s).
+ *
+ * Same as startRunIOContext(unsigned int, const std::vector<int>&, const Auxil::ThreadScheduling&)
+ * with default scheduling settings (i.e. only pinned to CPU cores according to \p pCPUAffinity).
+ *
+ * \param pNumThreads Number of threads to start per IO context.
+ * \param pCPUAffinity CPU cores to pin the threads of the different IO contexts to.
+ * \return True if the threads were started.
+ */
+bool ASIO::startRunIOContext(const unsigned int pNumThreads, const std::vector<int>& pCPUAffinity)
+{
+    return startRunIOContext(pNumThreads, pCPUAffinity, Auxil::ThreadScheduling{});
+}
 
-            stopRunIOContext();
+/*!
+ * \brief Start threads that continuously execute/run the IO context(s) with specific scheduling settings.
+ *
+ * Starts \p pNumThreads processing threads \e per IO context of the IO context pool (see setIOContextPoolSize()),
+ * which are responsible for executing async IO handlers for respective async requests made to the Boost %ASIO library.
+ * Sets up "work guards" to keep the threads running even if no handlers are scheduled at some time.
+ * Hence stopping the threads is achieved with stopRunIOContext().
+ *
+ * If more dedicated threads were requested for an IO context (see requestDedicatedThreads()), that many threads are started for it instead.
+ *
+ * The threads are run with the scheduling policy and priority of \p pScheduling (see Auxil::applyThreadScheduling()).
+ * If \p pCPUAffinity is not empty, the threads of the IO context with pool index \c i are pinned to the CPU core
+ * <tt>pCPUAffinity[i % pCPUAffinity.size()]</tt> (negative values mean no pinning). Otherwise all threads
+ * are pinned to the CPU core of \p pScheduling (if any). Real-time scheduling and pinning are only supported
+ * on Linux; the threads are started with default settings (and a warning is logged) on failure (e.g. missing
+ * privileges for real-time scheduling) or otherwise.
+ *
+ * See also Auxil::AsyncIORunner for a RAII approach of running these threads.
+ *
+ * If IO context threads are already/still running (see ioContextThreadsRunning()), this function will do nothing but return false.
+ *
+ * \param pNumThreads Number of threads to start per IO context.
+ * \param pCPUAffinity CPU cores to pin the threads of the different IO contexts to.
+ * \param pScheduling Scheduling settings for the threads.
+ * \return True if the threads were started.
+ */
+bool ASIO::startRunIOContext(const unsigned int pNumThreads, const std::vector<int>& pCPUAffinity,
+                             const Auxil::ThreadScheduling& pScheduling)
+{
+    AdaptiveSettings settings;
+    settings.minThreads = pNumThreads;
+    settings.maxThreads = pNumThreads;
 
-            return false;
-        }
-    }
+    return startThreads(settings, pCPUAffinity, pScheduling, false);
+}
 
-    ioContextRunning = true;
+/*!
+ * \brief Start an adaptive number of threads that run the IO context(s).
+ *
+ * Same as startRunIOContextAdaptive(const AdaptiveSettings&, const std::vector<int>&, const Auxil::ThreadScheduling&)
+ * with default scheduling settings (i.e. only pinned to CPU cores according to \p pCPUAffinity).
+ *
+ * \param pSettings Settings for scaling the number of threads.
+ * \param pCPUAffinity CPU cores to pin the threads of the different IO contexts to.
+ * \return True if the threads were started.
+ */
+bool ASIO::startRunIOContextAdaptive(const AdaptiveSettings& pSettings, const std::vector<int>& pCPUAffinity)
+{
+    return startRunIOContextAdaptive(pSettings, pCPUAffinity, Auxil::ThreadScheduling{});
+}
 
-    Logger::logSuccess("Started " + std::to_string(pNumThreads) + " IO context threads.");
+/*!
+ * \brief Start an adaptive number of threads that run the IO context(s) with specific scheduling settings.
+ *
+ * Works like startRunIOContext(unsigned int, const std::vector<int>&, const Auxil::ThreadScheduling&) but starts
+ * only AdaptiveSettings::minThreads threads per IO context (or more if dedicated threads were requested,
+ * see requestDedicatedThreads()) and additionally a monitor thread that scales the number of threads
+ * of each IO context between this minimum and AdaptiveSettings::maxThreads (see AdaptiveSettings):
+ *
+ * - If the queueing delay of a probe exceeds AdaptiveSettings::scaleUpDelay, a thread is added.
+ * - If AdaptiveSettings::scaleDownProbes successive probes are faster than AdaptiveSettings::scaleDownDelay, a thread is removed.
+ *
+ * Removed threads finish their current run interval (AdaptiveSettings::probeInterval) and current handler before they exit.
+ *
+ * If IO context threads are already/still running (see ioContextThreadsRunning()), this function will do nothing but return false.
+ * The same applies to invalid \p pSettings, i.e. if AdaptiveSettings::minThreads is zero or exceeds AdaptiveSettings::maxThreads,
+ * if AdaptiveSettings::probeInterval is not positive or if AdaptiveSettings::scaleDownDelay exceeds AdaptiveSettings::scaleUpDelay.
+ *
+ * \param pSettings Settings for scaling the number of threads.
+ * \param pCPUAffinity CPU cores to pin the threads of the different IO contexts to.
+ * \param pScheduling Scheduling settings for the threads.
+ * \return True if the threads were started.
+ */
+bool ASIO::startRunIOContextAdaptive(const AdaptiveSettings& pSettings, const std::vector<int>& pCPUAffinity,
+                                     const Auxil::ThreadScheduling& pScheduling)
+{
+    if (pSettings.maxThreads < pSettings.minThreads || pSettings.probeInterval <= std::chrono::milliseconds::zero() ||
+        pSettings.scaleDownDelay > pSettings.scaleUpDelay)
+    {
+        return false;
+    }
 
-    return true;
+    return startThreads(pSettings, pCPUAffinity, pScheduling, true);
 }
 
 /*!
  * \brief Stop all running IO context threads.
  *
- * Resets the work guard set up by and joins the threads started by startRunIOContext().
+ * Stops the adaptive monitor thread (if running, see startRunIOContextAdaptive()), resets the work guards set up by
+ * and joins the threads started by startRunIOContext() / startRunIOContextAdaptive() (including dedicated threads).
  */
 void ASIO::stopRunIOContext()
 {
     Logger::logInfo("Stopping all IO context threads...");
 
-    ::getWorkGuard().reset();
+    AdaptiveMonitor& monitor = getAdaptiveMonitor();
+    std::thread monitorThread;
 
-    for (auto& thread : ioContextThreads)
+    {
+        const std::lock_guard<std::mutex> threadsLock(getThreadsMutex());
+        (void)threadsLock;
+
+        monitor.stopRequested = true;
+        monitorThread = std::move(monitor.thread);
+    }
+
+    monitor.stopCondition.notify_all();
+
+    if (monitorThread.joinable())
     {
         try
         {
-            thread.join();
+            monitorThread.join();
         }
         catch (const std::system_error& exc)
         {
-            Logger::logWarning(std::string("Could not join an IO context thread: ") + exc.what());
+            Logger::logWarning(std::string("Could not join the IO context monitor thread: ") + exc.what());
         }
     }
 
-    ioContextThreads.clear();
+    std::unique_lock<std::mutex> threadsLock(getThreadsMutex());
 
-    ioContextRunning = false;
+    joinThreads(threadsLock);
 
     Logger::logSuccess("Stopped all IO context threads.");
 }
@@ -188,7 +404,8 @@ void ASIO::stopRunIOContext()
 /*!
  * \brief Check if any IO context threads are currently running.
  *
- * Checks whether threads were started via startRunIOContext() and not stopped via stopRunIOContext() yet.
+ * Checks whether threads were started via startRunIOContext() (or startRunIOContextAdaptive())
+ * and not stopped via stopRunIOContext() yet.
  *
  * \return True if threads are running.
  */
@@ -196,3 +413,443 @@ bool ASIO::ioContextThreadsRunning()
 {
     return ioContextRunning;
 }
+
+/*!
+ * \brief Check if the running IO context threads are scaled adaptively.
+ *
+ * Checks whether threads were started via startRunIOContextAdaptive() and not stopped via stopRunIOContext() yet.
+ *
+ * \return True if adaptive threads are running.
+ */
+bool ASIO::ioContextThreadsAdaptive()
+{
+    return ioContextAdaptive;
+}
+
+/*!
+ * \brief Get the number of running threads of one or all IO contexts.
+ *
+ * Returns the current number of threads of the IO context with pool index \p pIndex (see getIOContext(int)),
+ * or the total number of threads of all IO contexts if \p pIndex is negative. The adaptive monitor thread
+ * (see startRunIOContextAdaptive()) is not counted.
+ *
+ * \param pIndex Index of the IO context in the pool, or -1.
+ * \return Number of threads (zero if not running or if \p pIndex exceeds the pool size).
+ */
+std::size_t ASIO::getNumIOContextThreads(const int pIndex)
+{
+    const std::lock_guard<std::mutex> threadsLock(getThreadsMutex());
+    (void)threadsLock;
+
+    const std::vector<std::list<std::unique_ptr<IOContextThread>>>& threads = getThreads();
+
+    if (pIndex >= 0)
+        return (static_cast<std::size_t>(pIndex) < threads.size()) ? threads[pIndex].size() : 0;
+
+    std::size_t numThreads = 0;
+
+    for (const auto& contextThreads : threads)
+        numThreads += contextThreads.size();
+
+    return numThreads;
+}
+
+//
+
+/*!
+ * \brief Request a minimum number of threads for an IO context.
+ *
+ * Adds \p pNumThreads to the number of dedicated threads for \p pIOContext, which is the minimum number of threads
+ * to be run for this IO context (requests of different callers, e.g. different interfaces, add up).
+ * Missing threads are started immediately if IO context threads are running already (see ioContextThreadsRunning())
+ * and taken into account by the next startRunIOContext() / startRunIOContextAdaptive() otherwise.
+ * In adaptive mode the maximum number of threads of the IO context is raised accordingly as well.
+ *
+ * Note that an interface with high demands can get threads of its own by also using a separate IO context of the pool
+ * (see setIOContextPoolSize() and e.g. the "init.io_context" option of \ref casil::Layers::TL::SiTCP "TL::SiTCP").
+ *
+ * Use releaseDedicatedThreads() to release the threads again.
+ *
+ * \param pIOContext The IO context (from the IO context pool, see getIOContext(int)).
+ * \param pNumThreads Number of additional dedicated threads.
+ * \return True if \p pIOContext is part of the IO context pool (otherwise nothing is done).
+ */
+bool ASIO::requestDedicatedThreads(const boost::asio::io_context& pIOContext, const unsigned int pNumThreads)
+{
+    const std::lock_guard<std::mutex> threadsLock(getThreadsMutex());
+    (void)threadsLock;
+
+    const std::size_t index = findIOContextIndex(pIOContext);
+
+    if (index >= ioContextPoolSize)
+        return false;
+
+    std::vector<unsigned int>& dedicatedThreads = getDedicatedThreads();
+
+    if (dedicatedThreads.size() < ioContextPoolSize)
+        dedicatedThreads.resize(ioContextPoolSize, 0);
+
+    dedicatedThreads[index] += pNumThreads;
+
+    if (ioContextRunning && !ioContextStopping)
+    {
+        while (getThreads()[index].size() < dedicatedThreads[index])
+        {
+            if (!startThread(index))
+                break;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Release threads requested via requestDedicatedThreads().
+ *
+ * Subtracts \p pNumThreads from the number of dedicated threads for \p pIOContext (down to zero). Already running threads
+ * are kept until stopRunIOContext() or, in adaptive mode, until they are not needed anymore (see startRunIOContextAdaptive()).
+ *
+ * Does nothing if \p pIOContext is not part of the IO context pool.
+ *
+ * \param pIOContext The IO context (from the IO context pool, see getIOContext(int)).
+ * \param pNumThreads Number of dedicated threads to release.
+ */
+void ASIO::releaseDedicatedThreads(const boost::asio::io_context& pIOContext, const unsigned int pNumThreads)
+{
+    const std::lock_guard<std::mutex> threadsLock(getThreadsMutex());
+    (void)threadsLock;
+
+    const std::size_t index = findIOContextIndex(pIOContext);
+
+    std::vector<unsigned int>& dedicatedThreads = getDedicatedThreads();
+
+    if (index >= dedicatedThreads.size())
+        return;
+
+    dedicatedThreads[index] -= std::min(pNumThreads, dedicatedThreads[index]);
+}
+
+//Private
+
+/*!
+ * \brief Start the threads for all IO contexts.
+ *
+ * Sets up the "work guards" and starts the maximum of AdaptiveSettings::minThreads of \p pSettings and the number
+ * of dedicated threads (see requestDedicatedThreads()) per IO context, see startRunIOContext(). Also starts the
+ * monitor thread for scaling the number of threads (see runAdaptiveMonitor()) if \p pAdaptive is set.
+ *
+ * If IO context threads are already/still running (see ioContextThreadsRunning()) or if AdaptiveSettings::minThreads
+ * is zero, this function will do nothing but return false. On failure the already started threads are stopped again.
+ *
+ * \param pSettings Numbers of threads and settings for scaling them (only minimum number used if not \p pAdaptive).
+ * \param pCPUAffinity CPU cores to pin the threads of the different IO contexts to.
+ * \param pScheduling Scheduling settings for the threads.
+ * \param pAdaptive Scale the number of threads adaptively.
+ * \return True if the threads were started.
+ */
+bool ASIO::startThreads(const AdaptiveSettings& pSettings, const std::vector<int>& pCPUAffinity, const Auxil::ThreadScheduling& pScheduling,
+                        const bool pAdaptive)
+{
+    std::unique_lock<std::mutex> threadsLock(getThreadsMutex());
+
+    if (ioContextRunning || ioContextStopping)
+        return false;
+
+    if (pSettings.minThreads == 0)
+        return false;
+
+    std::deque<boost::asio::io_context>& ioContextPool = getIOContextPool();
+    std::vector<std::unique_ptr<WorkGuard>>& workGuards = getWorkGuards();
+    std::vector<unsigned int>& dedicatedThreads = getDedicatedThreads();
+    std::vector<Auxil::ThreadScheduling>& threadSchedulings = getThreadSchedulings();
+
+    getThreads().resize(ioContextPoolSize);
+
+    if (dedicatedThreads.size() < ioContextPoolSize)
+        dedicatedThreads.resize(ioContextPoolSize, 0);
+
+    threadSchedulings.assign(ioContextPoolSize, pScheduling);
+
+    if (!pCPUAffinity.empty())
+    {
+        for (std::size_t i = 0; i < ioContextPoolSize; ++i)
+            threadSchedulings[i].cpu = pCPUAffinity[i % pCPUAffinity.size()];
+    }
+
+    adaptiveSettings = pSettings;
+    ioContextAdaptive = pAdaptive;
+
+    std::size_t numThreads = 0;
+
+    for (std::size_t i = 0; i < ioContextPoolSize; ++i)
+        numThreads += std::max(pSettings.minThreads, dedicatedThreads[i]);
+
+    const std::string numThreadsStr = std::to_string(numThreads) + (pAdaptive ? " adaptive" : "");
+
+    Logger::logInfo("Starting " + numThreadsStr + " IO context threads...");
+
+    //Set up "work guards"
+    for (std::size_t i = 0; i < ioContextPoolSize; ++i)
+    {
+        ioContextPool[i].restart();
+        workGuards.push_back(std::make_unique<WorkGuard>(boost::asio::make_work_guard(ioContextPool[i])));
+    }
+
+    for (std::size_t i = 0; i < ioContextPoolSize; ++i)
+    {
+        while (getThreads()[i].size() < std::max(pSettings.minThreads, dedicatedThreads[i]))
+        {
+            if (!startThread(i))
+            {
+                Logger::logWarning("Stopping already started threads...");
+                joinThreads(threadsLock);
+                return false;
+            }
+        }
+    }
+
+    if (pAdaptive)
+    {
+        AdaptiveMonitor& monitor = getAdaptiveMonitor();
+
+        try
+        {
+            monitor.stopRequested = false;
+            monitor.thread = std::thread(&ASIO::runAdaptiveMonitor);
+        }
+        catch (const std::system_error& exc)
+        {
+            Logger::logError(std::string("Exception while starting IO context monitor thread: ") + exc.what());
+            Logger::logWarning("Stopping already started threads...");
+            joinThreads(threadsLock);
+            return false;
+        }
+    }
+
+    ioContextRunning = true;
+
+    Logger::logSuccess("Started " + numThreadsStr + " IO context threads.");
+
+    return true;
+}
+
+/*!
+ * \brief Start an additional thread for an IO context.
+ *
+ * Starts a thread that runs the IO context with pool index \p pIndex using the scheduling settings for this IO context
+ * (see startThreads()). In adaptive mode (see startRunIOContextAdaptive()) the thread runs the IO context in intervals
+ * of AdaptiveSettings::probeInterval in order to be able to finish early when not needed anymore (see runAdaptiveMonitor()).
+ *
+ * \note Requires the mutex for the thread lists to be locked by the caller.
+ *
+ * \param pIndex Index of the IO context in the pool.
+ * \return True if the thread was started.
+ */
+bool ASIO::startThread(const std::size_t pIndex)
+{
+    boost::asio::io_context *const ioContextPtr = &getIOContextPool()[pIndex];    //Need to be pedantic and capture pointer by value
+
+    std::unique_ptr<IOContextThread> thread = std::make_unique<IOContextThread>();
+    IOContextThread *const threadPtr = thread.get();
+
+    const bool adaptive = ioContextAdaptive;
+    const std::chrono::milliseconds runInterval = adaptiveSettings.probeInterval;
+
+    try
+    {
+        thread->thread = Auxil::startThread(getThreadSchedulings()[pIndex], "IO context thread",
+                    [ioContextPtr, threadPtr, adaptive, runInterval]()
+                    {
+                        std::ostringstream threadIdStrm;
+                        threadIdStrm<<std::this_thread::get_id();
+
+                        CASIL_LOG_DEBUG("Started IO context thread " + threadIdStrm.str() + ".");
+
+                        if (adaptive)
+                        {
+                            while (!threadPtr->retire.load() && !ioContextPtr->stopped())
+                                ioContextPtr->run_for(runInterval);
+                        }
+                        else
+                            ioContextPtr->run();
+
+                        CASIL_LOG_DEBUG("Finished IO context thread " + threadIdStrm.str() + ".");
+                    });
+    }
+    catch (const std::system_error& exc)
+    {
+        Logger::logError(std::string("Exception while starting IO context threads: ") + exc.what());
+        return false;
+    }
+
+    getThreads()[pIndex].push_back(std::move(thread));
+
+    return true;
+}
+
+/*!
+ * \brief Let all threads finish and join them.
+ *
+ * Flags all threads to finish, resets the work guards set up by startThreads() and joins all threads.
+ *
+ * The thread lists and work guards are moved out and \p pThreadsLock is released while joining the threads,
+ * so that handlers still running on these threads can use functions like getNumIOContextThreads() or
+ * requestDedicatedThreads() without a deadlock (no threads are started until the joining has finished).
+ *
+ * \note Requires the adaptive monitor thread to be finished.
+ *
+ * \param pThreadsLock Lock of the mutex for the thread lists, which must be owned by the caller.
+ */
+void ASIO::joinThreads(std::unique_lock<std::mutex>& pThreadsLock)
+{
+    std::vector<std::list<std::unique_ptr<IOContextThread>>> threads = std::move(getThreads());
+    std::vector<std::unique_ptr<WorkGuard>> workGuards = std::move(getWorkGuards());
+
+    getThreads().clear();
+    getWorkGuards().clear();
+
+    ioContextStopping = true;
+
+    pThreadsLock.unlock();
+
+    for (const auto& contextThreads : threads)
+        for (const auto& thread : contextThreads)
+            thread->retire.store(true);
+
+    for (const auto& workGuard : workGuards)
+        workGuard->reset();
+
+    for (const auto& contextThreads : threads)
+    {
+        for (const auto& thread : contextThreads)
+        {
+            try
+            {
+                thread->thread.join();
+            }
+            catch (const std::system_error& exc)
+            {
+                Logger::logWarning(std::string("Could not join an IO context thread: ") + exc.what());
+            }
+        }
+    }
+
+    threads.clear();
+    workGuards.clear();
+
+    pThreadsLock.lock();
+
+    ioContextRunning = false;
+    ioContextAdaptive = false;
+    ioContextStopping = false;
+}
+
+/*!
+ * \brief Periodically probe the IO contexts and scale their threads.
+ *
+ * Thread function of the monitor thread in adaptive mode (see startRunIOContextAdaptive()). Every AdaptiveSettings::probeInterval
+ * it determines the queueing delay of the previously posted probe handler of each IO context (or the time waited so far if
+ * the probe is still queued), posts a new probe and adds or removes a thread of the IO context depending on this delay
+ * (see AdaptiveSettings). Also starts missing threads if the number of dedicated threads was increased (see requestDedicatedThreads()).
+ *
+ * Returns when stopRunIOContext() requests the monitor thread to stop.
+ */
+void ASIO::runAdaptiveMonitor()
+{
+    using Clock = std::chrono::steady_clock;
+
+    AdaptiveMonitor& monitor = getAdaptiveMonitor();
+
+    std::vector<std::shared_ptr<DelayProbe>> probes(ioContextPoolSize);
+    std::vector<unsigned int> numFastProbes(ioContextPoolSize, 0);
+
+    std::unique_lock<std::mutex> threadsLock(getThreadsMutex());
+
+    while (!monitor.stopCondition.wait_for(threadsLock, adaptiveSettings.probeInterval, [&monitor]() -> bool { return monitor.stopRequested; }))
+    {
+        std::vector<std::unique_ptr<IOContextThread>> retiredThreads;
+
+        for (std::size_t i = 0; i < ioContextPoolSize; ++i)
+        {
+            Clock::duration delay = Clock::duration::zero();
+
+            if (probes[i])
+            {
+                const Clock::rep measuredDelay = probes[i]->delay.load();
+
+                if (measuredDelay >= 0)
+                {
+                    delay = Clock::duration(measuredDelay);
+                    probes[i].reset();
+                }
+                else
+                    delay = Clock::now() - probes[i]->postTime;     //Still queued
+            }
+
+            if (!probes[i])
+            {
+                probes[i] = std::make_shared<DelayProbe>();
+                probes[i]->postTime = Clock::now();
+
+                boost::asio::post(getIOContextPool()[i], [probe = probes[i]]() -> void
+                                                         {
+                                                             probe->delay.store((Clock::now() - probe->postTime).count());
+                                                         });
+            }
+
+            std::list<std::unique_ptr<IOContextThread>>& contextThreads = getThreads()[i];
+
+            const std::size_t minThreads = std::max(adaptiveSettings.minThreads, getDedicatedThreads()[i]);
+            const std::size_t maxThreads = std::max<std::size_t>(adaptiveSettings.maxThreads, minThreads);
+
+            if (contextThreads.size() < minThreads)
+            {
+                numFastProbes[i] = 0;
+
+                while (contextThreads.size() < minThreads && startThread(i))
+                    ;
+            }
+            else if (delay > adaptiveSettings.scaleUpDelay && contextThreads.size() < maxThreads)
+            {
+                numFastProbes[i] = 0;
+
+                if (startThread(i))
+                    CASIL_LOG_DEBUG("Added thread to IO context " + std::to_string(i) + " (now " + std::to_string(contextThreads.size()) + ").");
+            }
+            else if (delay < adaptiveSettings.scaleDownDelay && contextThreads.size() > minThreads)
+            {
+                if (++numFastProbes[i] >= adaptiveSettings.scaleDownProbes)
+                {
+                    numFastProbes[i] = 0;
+
+                    contextThreads.front()->retire.store(true);
+                    retiredThreads.push_back(std::move(contextThreads.front()));
+                    contextThreads.pop_front();
+
+                    CASIL_LOG_DEBUG("Removed thread from IO context " + std::to_string(i) + " (now " + std::to_string(contextThreads.size()) + ").");
+                }
+            }
+            else
+                numFastProbes[i] = 0;
+        }
+
+        if (!retiredThreads.empty())
+        {
+            threadsLock.unlock();
+
+            for (const auto& thread : retiredThreads)
+            {
+                try
+                {
+                    thread->thread.join();
+                }
+                catch (const std::system_error& exc)
+                {
+                    Logger::logWarning(std::string("Could not join an IO context thread: ") + exc.what());
+                }
+            }
+
+            threadsLock.lock();
+        }
+    }
+}
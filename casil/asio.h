@@ -24,6 +24,10 @@
 #ifndef CASIL_ASIO_H
 #define CASIL_ASIO_H
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -32,6 +36,8 @@ namespace boost { namespace asio { class io_context; } }
 namespace casil
 {
 
+namespace Auxil { struct ThreadScheduling; }
+
 /*!
  * \brief Limited interface to the used async IO back end from the Boost library.
  *
@@ -43,22 +49,86 @@ namespace casil
  * At least one processing thread must be running for some of the \ref casil::Layers::TL "TL" interfaces to function properly.
  * In these cases (or simply always) start the thread(s) \e before calling Device::init()
  * (or \ref casil::Layers::TL::Interface::init() "TL::Interface::init()").
+ *
+ * To distribute the IO load of many interfaces over multiple cores, the number of IO context objects can be increased
+ * from one to a "pool" of IO contexts (see setIOContextPoolSize()), each of which is then run by its own threads
+ * (see startRunIOContext()). Each interface is pinned to one of the contexts (see getIOContext(int)) when it is
+ * constructed, such that the pool size must be set \e before constructing the Device.
+ *
+ * Since the IO context threads also receive streamed data (e.g. the FIFO data of \ref casil::Layers::TL::SiTCP "TL::SiTCP")
+ * and poll serial ports, they can be run with real-time scheduling and pinned to CPU cores (see Auxil::ThreadScheduling)
+ * to avoid readout stalls caused by other processes.
+ *
+ * Instead of a fixed number of threads, the IO contexts can also be run by an adaptive number of threads
+ * (see startRunIOContextAdaptive()), which is scaled between a minimum and a maximum depending on how long
+ * handlers have to wait in the queue of the IO context before they get executed. Independent of the mode,
+ * interfaces can request dedicated threads for their IO context (see requestDedicatedThreads()).
  */
 class ASIO
 {
+public:
+    /*!
+     * \brief Settings for adaptively scaling the number of IO context threads (see startRunIOContextAdaptive()).
+     *
+     * Every \ref probeInterval a probe handler is posted to each IO context. Its queueing delay (i.e. the time from posting
+     * until execution, or the time waited so far if still not executed) approximates the backlog of the IO context.
+     */
+    struct AdaptiveSettings
+    {
+        unsigned int minThreads = 1;                                ///< Minimum number of threads per IO context.
+        unsigned int maxThreads = 4;                                ///< Maximum number of threads per IO context.
+        std::chrono::milliseconds probeInterval {50};               ///< Interval between two queueing delay probes.
+        std::chrono::microseconds scaleUpDelay {2000};              ///< Probe delay above which a thread is added.
+        std::chrono::microseconds scaleDownDelay {200};             ///< Probe delay below which a thread can be removed.
+        unsigned int scaleDownProbes = 20;                          ///< Number of successive fast probes needed to remove a thread.
+    };
+
 public:
     ASIO() = delete;                                                ///< Deleted constructor.
     //
     static boost::asio::io_context& getIOContext();                 ///< Get the IO context object.
+    static boost::asio::io_context& getIOContext(int pIndex);       ///< Get an IO context object from the IO context pool.
+    //
+    static bool setIOContextPoolSize(std::size_t pSize);            ///< Set the number of IO context objects in the IO context pool.
+    static std::size_t getIOContextPoolSize();                      ///< Get the number of IO context objects in the IO context pool.
     //
-    static bool startRunIOContext(unsigned int pNumThreads = 1);    ///< Start threads that continuously execute/run the IO context.
+    static bool startRunIOContext(unsigned int pNumThreads = 1, const std::vector<int>& pCPUAffinity = {});
+                                                                    ///< Start threads that continuously execute/run the IO context(s).
+    static bool startRunIOContext(unsigned int pNumThreads, const std::vector<int>& pCPUAffinity, const Auxil::ThreadScheduling& pScheduling);
+                                                                    ///< \brief Start threads that continuously execute/run the IO context(s)
+                                                                    ///  with specific scheduling settings.
+    static bool startRunIOContextAdaptive(const AdaptiveSettings& pSettings, const std::vector<int>& pCPUAffinity = {});
+                                                                    ///< Start an adaptive number of threads that run the IO context(s).
+    static bool startRunIOContextAdaptive(const AdaptiveSettings& pSettings, const std::vector<int>& pCPUAffinity,
+                                          const Auxil::ThreadScheduling& pScheduling);
+                                                                    ///< \brief Start an adaptive number of threads that run the IO context(s)
+                                                                    ///  with specific scheduling settings.
     static void stopRunIOContext();                                 ///< Stop all running IO context threads.
     //
     static bool ioContextThreadsRunning();                          ///< Check if any IO context threads are currently running.
+    static bool ioContextThreadsAdaptive();                         ///< Check if the running IO context threads are scaled adaptively.
+    static std::size_t getNumIOContextThreads(int pIndex = -1);     ///< Get the number of running threads of one or all IO contexts.
+    //
+    static bool requestDedicatedThreads(const boost::asio::io_context& pIOContext, unsigned int pNumThreads);
+                                                                    ///< Request a minimum number of threads for an IO context.
+    static void releaseDedicatedThreads(const boost::asio::io_context& pIOContext, unsigned int pNumThreads);
+                                                                    ///< Release threads requested via requestDedicatedThreads().
+
+private:
+    static bool startThreads(const AdaptiveSettings& pSettings, const std::vector<int>& pCPUAffinity,
+                             const Auxil::ThreadScheduling& pScheduling, bool pAdaptive);   ///< Start the threads for all IO contexts.
+    static bool startThread(std::size_t pIndex);                    ///< Start an additional thread for an IO context.
+    static void joinThreads(std::unique_lock<std::mutex>& pThreadsLock);
+                                                                    ///< Let all threads finish and join them.
+    static void runAdaptiveMonitor();                               ///< Periodically probe the IO contexts and scale their threads.
 
 private:
     static bool ioContextRunning;                                   ///< Flags whether IO context threads were started and not stopped yet.
-    static std::vector<std::thread> ioContextThreads;               ///< Vector of all IO context threads.
+    static bool ioContextAdaptive;                                  ///< Flags whether the running threads are scaled adaptively.
+    static bool ioContextStopping;                                  ///< Flags whether joinThreads() is currently joining the threads.
+    static AdaptiveSettings adaptiveSettings;                       ///< Settings of the adaptive mode (see startRunIOContextAdaptive()).
+    static std::size_t ioContextPoolSize;                           ///< Number of IO context objects in the IO context pool.
+    static std::atomic<std::size_t> nextIOContextIndex;             ///< Next IO context pool index for round-robin assignment.
 };
 
 } // namespace casil
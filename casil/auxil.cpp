@@ -23,22 +23,347 @@
 
 #include <casil/auxil.h>
 
+#include <casil/bytes.h>
 #include <casil/layerconfig.h>
+#include <casil/logger.h>
 
+#include <yaml-cpp/anchor.h>
+#include <yaml-cpp/emitterstyle.h>
+#include <yaml-cpp/eventhandler.h>
 #include <yaml-cpp/exceptions.h>
-#include <yaml-cpp/node/convert.h>
-#include <yaml-cpp/node/emit.h>
-#include <yaml-cpp/node/impl.h>
-#include <yaml-cpp/node/iterator.h>
-#include <yaml-cpp/node/node.h>
-#include <yaml-cpp/node/parse.h>
-#include <yaml-cpp/node/type.h>
-#include <yaml-cpp/node/detail/impl.h>
+#include <yaml-cpp/mark.h>
+#include <yaml-cpp/parser.h>
 
+#include <boost/predef/os/linux.h>
 #include <boost/property_tree/ptree.hpp>
 
+#include <algorithm>
+#include <charconv>
 #include <cstddef>
+#include <cstring>
 #include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if BOOST_OS_LINUX != 0
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace
+{
+
+using boost::property_tree::ptree;
+
+/*
+ * YAML parser event handler that directly builds a Boost Property Tree with the structure
+ * described for casil::Auxil::propertyTreeFromYAML() (without an intermediate YAML node graph).
+ */
+class PropertyTreeBuilder final : public YAML::EventHandler
+{
+public:
+    explicit PropertyTreeBuilder(ptree& pTree) :
+        tree(pTree),
+        frames(),
+        anchors()
+    {
+    }
+    //
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override {}
+    //
+    void OnNull(const YAML::Mark&, const YAML::anchor_t pAnchor) override
+    {
+        if (expectingKey())
+            frames.back().pendingKey = "null";  //Same as YAML::Node::as<std::string>() for null nodes
+        else
+            (void)addChild(ptree());
+
+        storeAnchor(pAnchor, ptree());
+    }
+    void OnAlias(const YAML::Mark& pMark, const YAML::anchor_t pAnchor) override
+    {
+        const auto it = anchors.find(pAnchor);
+
+        if (it == anchors.end())
+            throw YAML::ParserException(pMark, "Unknown anchor.");
+
+        if (expectingKey())
+        {
+            if (!it->second.empty())
+                throw YAML::ParserException(pMark, "Non-scalar map keys are not supported.");
+
+            frames.back().pendingKey = it->second.data();
+        }
+        else
+            (void)addChild(it->second);
+    }
+    void OnScalar(const YAML::Mark&, const std::string& pTag, const YAML::anchor_t pAnchor, const std::string& pValue) override
+    {
+        //Keep binary scalars as binary blob values (see casil::Auxil::encodeBinaryBlob())
+        const std::string value = (pTag == binaryTag ? std::string(casil::Auxil::binaryBlobPrefix) + pValue : pValue);
+
+        if (expectingKey())
+            frames.back().pendingKey = value;
+        else
+            (void)addChild(ptree(value));
+
+        storeAnchor(pAnchor, ptree(value));
+    }
+    //
+    void OnSequenceStart(const YAML::Mark& pMark, const std::string&, const YAML::anchor_t pAnchor, YAML::EmitterStyle::value) override
+    {
+        startContainer(pMark, pAnchor, true);
+    }
+    void OnSequenceEnd() override
+    {
+        endContainer();
+    }
+    void OnMapStart(const YAML::Mark& pMark, const std::string&, const YAML::anchor_t pAnchor, YAML::EmitterStyle::value) override
+    {
+        startContainer(pMark, pAnchor, false);
+    }
+    void OnMapEnd() override
+    {
+        endContainer();
+    }
+
+private:
+    struct Frame
+    {
+        ptree* node;                            //Tree node of the sequence/map
+        bool isSequence;                        //Node is a sequence (instead of a map)
+        std::size_t sequenceCtr;                //Index of the next sequence element
+        std::optional<std::string> pendingKey;  //Map key waiting for its value
+        YAML::anchor_t anchor;                  //Anchor of the sequence/map
+    };
+
+private:
+    bool expectingKey() const
+    {
+        return (!frames.empty() && !frames.back().isSequence && !frames.back().pendingKey.has_value());
+    }
+    ptree* addChild(const ptree& pChild)
+    {
+        if (frames.empty())     //Top node is not a sequence or map
+            return nullptr;
+
+        Frame& frame = frames.back();
+
+        std::string childKey;
+
+        if (frame.isSequence)
+            childKey = "#" + std::to_string(frame.sequenceCtr++);
+        else
+        {
+            childKey = std::move(frame.pendingKey.value());
+            frame.pendingKey.reset();
+        }
+
+        return &(frame.node->add_child(childKey, pChild));
+    }
+    void startContainer(const YAML::Mark& pMark, const YAML::anchor_t pAnchor, const bool pIsSequence)
+    {
+        if (expectingKey())
+            throw YAML::ParserException(pMark, "Non-scalar map keys are not supported.");
+
+        ptree* const node = frames.empty() ? &tree : addChild(ptree());
+
+        frames.push_back(Frame{node, pIsSequence, 0, std::nullopt, pAnchor});
+    }
+    void endContainer()
+    {
+        const Frame& frame = frames.back();
+
+        storeAnchor(frame.anchor, *frame.node);
+
+        frames.pop_back();
+    }
+    void storeAnchor(const YAML::anchor_t pAnchor, const ptree& pNode)
+    {
+        if (pAnchor != YAML::NullAnchor)
+            anchors.insert_or_assign(pAnchor, pNode);
+    }
+
+private:
+    static constexpr std::string_view binaryTag = "tag:yaml.org,2002:binary";
+
+private:
+    ptree& tree;
+    std::vector<Frame> frames;
+    std::map<YAML::anchor_t, ptree> anchors;
+};
+
+//
+
+/*
+ * Checks if the keys of the children of 'pTree' are exactly "#0", "#1", etc. (see casil::Auxil::propertyTreeToYAML()).
+ */
+bool isYAMLSequence(const ptree& pTree)
+{
+    char tKeyBuffer[24];
+    tKeyBuffer[0] = '#';
+
+    std::size_t tSequenceCtr = 0;
+
+    for (const auto& [key, val] : pTree)
+    {
+        (void)val;
+
+        const std::to_chars_result tResult = std::to_chars(tKeyBuffer + 1, tKeyBuffer + sizeof(tKeyBuffer), tSequenceCtr++);
+
+        if (std::string_view(key) != std::string_view(tKeyBuffer, tResult.ptr))
+            return false;
+    }
+
+    return true;
+}
+
+/*
+ * Appends the scalar 'pValue' to the YAML document 'pOut'. Writes binary blobs (see casil::Auxil::encodeBinaryBlob())
+ * as "!!binary" tagged scalars, values that can be represented as plain scalar without changing their meaning
+ * as plain scalars, values with control characters as double-quoted scalars and all other values as single-quoted scalars.
+ */
+void writeYAMLScalar(std::string& pOut, const std::string_view pValue)
+{
+    if (casil::Auxil::isBinaryBlob(pValue))
+    {
+        pOut.append(pValue);
+        return;
+    }
+
+    bool tPlain = !pValue.empty() && pValue.front() != ' ' && pValue.back() != ' ' && pValue.back() != ':' &&
+                  pValue != "~" && pValue != "null" && pValue != "Null" && pValue != "NULL" &&
+                  pValue.find(": ") == std::string_view::npos && pValue.find(" #") == std::string_view::npos;
+
+    if (tPlain)
+    {
+        static constexpr std::string_view indicators = "!&*{}[],#|>@`\"'%";
+
+        const char tFirst = pValue.front();
+
+        if (indicators.find(tFirst) != std::string_view::npos)
+            tPlain = false;
+        else if ((tFirst == '-' || tFirst == '?' || tFirst == ':') && (pValue.size() == 1 || pValue[1] == ' '))
+            tPlain = false;
+    }
+
+    bool tControlChars = false;
+
+    for (const char c : pValue)
+    {
+        if (static_cast<unsigned char>(c) < 0x20 || c == 0x7F)
+        {
+            tControlChars = true;
+            tPlain = false;
+            break;
+        }
+    }
+
+    if (tPlain)
+        pOut.append(pValue);
+    else if (!tControlChars)
+    {
+        pOut += '\'';
+
+        for (const char c : pValue)
+        {
+            if (c == '\'')
+                pOut += '\'';
+
+            pOut += c;
+        }
+
+        pOut += '\'';
+    }
+    else
+    {
+        static constexpr std::string_view hexDigits = "0123456789ABCDEF";
+
+        pOut += '"';
+
+        for (const char c : pValue)
+        {
+            switch (c)
+            {
+                case '"':  pOut += "\\\""; break;
+                case '\\': pOut += "\\\\"; break;
+                case '\n': pOut += "\\n"; break;
+                case '\r': pOut += "\\r"; break;
+                case '\t': pOut += "\\t"; break;
+                default:
+                {
+                    if (static_cast<unsigned char>(c) < 0x20 || c == 0x7F)
+                    {
+                        pOut += "\\x";
+                        pOut += hexDigits[static_cast<unsigned char>(c) >> 4];
+                        pOut += hexDigits[static_cast<unsigned char>(c) & 0x0Fu];
+                    }
+                    else
+                        pOut += c;
+                }
+            }
+        }
+
+        pOut += '"';
+    }
+}
+
+/*
+ * Appends the children of 'pTree' as block sequence or block map (see casil::Auxil::propertyTreeToYAML()) with indentation
+ * 'pIndent' to the YAML document 'pOut'. If 'pFirstInline' is true, the first entry continues the current line (e.g. after "- ").
+ */
+void writeYAMLContainer(std::string& pOut, const ptree& pTree, const std::size_t pIndent, const bool pFirstInline)
+{
+    const bool tIsSequence = isYAMLSequence(pTree);
+
+    bool tFirst = true;
+
+    for (const auto& [childKey, childTree] : pTree)
+    {
+        if (!(tFirst && pFirstInline))
+        {
+            pOut += '\n';
+            pOut.append(pIndent, ' ');
+        }
+
+        tFirst = false;
+
+        if (tIsSequence)
+        {
+            pOut += "- ";
+
+            if (childTree.empty())
+                writeYAMLScalar(pOut, childTree.data());
+            else
+                writeYAMLContainer(pOut, childTree, pIndent + 2, true);
+        }
+        else
+        {
+            writeYAMLScalar(pOut, childKey);
+            pOut += ':';
+
+            if (childTree.empty())
+            {
+                pOut += ' ';
+                writeYAMLScalar(pOut, childTree.data());
+            }
+            else
+                writeYAMLContainer(pOut, childTree, pIndent + 2, false);
+        }
+    }
+}
+
+} // namespace
 
 namespace casil::Auxil
 {
@@ -67,68 +392,51 @@ namespace casil::Auxil
  * \note To prevent confusion with the generated sequence keys, \e map keys starting with '#' should perhaps be avoided,
  *       especially since propertyTreeToYAML() always converts the ordered keys {"#0", "#1", ...} back to \e sequences.
  *
+ * The tree is built directly from the YAML parser events (see propertyTreeFromYAML(std::istream&)).
+ *
  * \throws std::runtime_error If parsing of the YAML document \p pYAMLString fails.
+ * \throws std::runtime_error If the document contains non-scalar map keys.
  *
  * \param pYAMLString The YAML document to be parsed.
  * \return Property Tree representing the YAML document structure/content.
  */
 boost::property_tree::ptree propertyTreeFromYAML(const std::string& pYAMLString)
 {
-    using boost::property_tree::ptree;
-
-    std::function<void(ptree&, const YAML::Node&)> fillTree = [&fillTree](ptree& pTree, const YAML::Node& pNode) -> void
-    {
-        if (pNode.Type() != YAML::NodeType::Sequence && pNode.Type() != YAML::NodeType::Map)
-            return;
-
-        std::size_t tSequenceCtr = 0;
-
-        for (const auto& it : pNode)
-        {
-            const YAML::Node& childNode = ((pNode.Type() == YAML::NodeType::Sequence) ? it : it.second);
-            const std::string childKey = ((pNode.Type() == YAML::NodeType::Sequence) ? ("#" + std::to_string(tSequenceCtr++))
-                                                                                     : it.first.as<std::string>());
-
-            ptree tSubTree;
-
-            switch (childNode.Type())
-            {
-                case YAML::NodeType::Scalar:
-                {
-                    tSubTree.put_value(childNode.as<std::string>());
-                    break;
-                }
-                case YAML::NodeType::Sequence:
-                case YAML::NodeType::Map:
-                {
-                    fillTree(tSubTree, childNode);
-                    break;
-                }
-                case YAML::NodeType::Null:
-                case YAML::NodeType::Undefined:
-                default:
-                    break;
-            }
-
-            pTree.add_child(childKey, tSubTree);
-        }
-    };
+    std::istringstream yamlStream(pYAMLString);
+    return propertyTreeFromYAML(yamlStream);
+}
 
-    YAML::Node topNode;
+/*!
+ * \brief Parse a YAML document from a stream into a Boost Property Tree.
+ *
+ * Works like propertyTreeFromYAML(const std::string&) but reads the YAML document from \p pYAMLStream.
+ *
+ * The Property Tree is built directly from the events of the YAML parser in a single pass, i.e. without
+ * building an intermediate YAML node graph, which saves time and memory especially for large documents
+ * (such as generated chip configurations). Only the first document of the stream is parsed.
+ *
+ * \throws std::runtime_error If parsing of the YAML document fails.
+ * \throws std::runtime_error If the document contains non-scalar map keys.
+ *
+ * \param pYAMLStream Stream to read the YAML document from.
+ * \return Property Tree representing the YAML document structure/content.
+ */
+boost::property_tree::ptree propertyTreeFromYAML(std::istream& pYAMLStream)
+{
+    boost::property_tree::ptree tTree;
 
     try
     {
-        topNode = YAML::Load(pYAMLString);
+        YAML::Parser parser(pYAMLStream);
+        PropertyTreeBuilder builder(tTree);
+
+        (void)parser.HandleNextDocument(builder);
     }
     catch (const YAML::ParserException&)
     {
         throw std::runtime_error("Could not successfully parse YAML document.");
     }
 
-    ptree tTree;
-
-    fillTree(tTree, topNode);
-
     return tTree;
 }
 
@@ -137,7 +445,7 @@ boost::property_tree::ptree propertyTreeFromYAML(const std::string& pYAMLString)
  *
  * Provides an inverse operation to propertyTreeFromYAML() (with some specifics/exceptions, see below).
  *
- * Note: Sub-trees within \p pTree will result into a YAML \e sequence if and only if the respective
+ * Note: Sub-trees within \p pYAMLTree will result into a YAML \e sequence if and only if the respective
  * branch keys are exactly as specified in propertyTreeFromYAML(), i.e. "#0", "#1", etc... (in that order).
  * Otherwise a YAML \e map will be generated. If a YAML \e sequence is not desired for such a numbered tree key sequence
  * (e.g. if it originally stems from a YAML \e map), then the '#' prefixes should simply be avoided altogether for map keys
@@ -152,65 +460,515 @@ boost::property_tree::ptree propertyTreeFromYAML(const std::string& pYAMLString)
  * contain periods into nested sub-trees. \e This function can of course not distinguish those
  * cases and hence will leave the tree structure as is, i.e. cannot reverse the splitting.
  *
- * \throws std::runtime_error If the conversion of the generated YAML node tree to the needed YAML document string fails.
+ * See propertyTreeToYAML(const boost::property_tree::ptree&, std::string&) for the generated format.
  *
  * \param pYAMLTree Property Tree representing the structure/content of the YAML document to be generated.
  * \return Generated YAML document.
  */
 std::string propertyTreeToYAML(const boost::property_tree::ptree& pYAMLTree)
 {
-    using boost::property_tree::ptree;
+    std::string tYAMLString;
+
+    propertyTreeToYAML(pYAMLTree, tYAMLString);
+
+    return tYAMLString;
+}
+
+/*!
+ * \brief Generate a YAML document from a Boost Property Tree into a reusable string buffer.
+ *
+ * Works like propertyTreeToYAML(const boost::property_tree::ptree&) but replaces the contents of \p pYAMLString
+ * (keeping its capacity), such that repeatedly dumping similar trees (e.g. runtime configurations after every
+ * scan step) into the same buffer does not need to allocate.
+ *
+ * The document is written directly while traversing the tree (without an intermediate YAML node graph or emitter)
+ * in block style with an indentation of two spaces and without trailing newline. Scalars are written as plain scalars
+ * where possible and as single-quoted or (if they contain control characters) double-quoted scalars otherwise.
+ * Binary blob values (see encodeBinaryBlob()) are written as Base64 scalars with the standard \c !!binary tag.
+ *
+ * \param pYAMLTree Property Tree representing the structure/content of the YAML document to be generated.
+ * \param pYAMLString Buffer for the generated YAML document.
+ */
+void propertyTreeToYAML(const boost::property_tree::ptree& pYAMLTree, std::string& pYAMLString)
+{
+    pYAMLString.clear();
+
+    ::writeYAMLContainer(pYAMLString, pYAMLTree, 0, true);
+}
+
+//
+
+/*!
+ * \brief Encode bytes as binary blob Property Tree value.
+ *
+ * Generates a value for Property Tree nodes that is written by propertyTreeToYAML() as YAML scalar with the
+ * standard \c !!binary tag, which is much more compact than e.g. a sequence of numbers or a bit string.
+ * The value consists of \ref binaryBlobPrefix followed by the Base64 encoding of \p pBytes.
+ * propertyTreeFromYAML() generates the same format for \c !!binary scalars (see also decodeBinaryBlob()).
+ *
+ * \param pBytes The bytes.
+ * \return Binary blob value.
+ */
+std::string encodeBinaryBlob(const std::span<const std::uint8_t> pBytes)
+{
+    static constexpr std::string_view alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string tValue;
+    tValue.reserve(binaryBlobPrefix.size() + 4 * ((pBytes.size() + 2) / 3));
+
+    tValue.append(binaryBlobPrefix);
+
+    for (std::size_t i = 0; i < pBytes.size(); i += 3)
+    {
+        const std::size_t tNumBytes = std::min<std::size_t>(3, pBytes.size() - i);
+
+        const std::uint32_t tGroup = (static_cast<std::uint32_t>(pBytes[i]) << 16) |
+                                     (tNumBytes > 1 ? static_cast<std::uint32_t>(pBytes[i + 1]) << 8 : 0u) |
+                                     (tNumBytes > 2 ? static_cast<std::uint32_t>(pBytes[i + 2]) : 0u);
+
+        tValue += alphabet[(tGroup >> 18) & 0x3Fu];
+        tValue += alphabet[(tGroup >> 12) & 0x3Fu];
+        tValue += (tNumBytes > 1 ? alphabet[(tGroup >> 6) & 0x3Fu] : '=');
+        tValue += (tNumBytes > 2 ? alphabet[tGroup & 0x3Fu] : '=');
+    }
+
+    return tValue;
+}
+
+/*!
+ * \brief Check if a Property Tree value is a binary blob.
+ *
+ * \param pValue Property Tree node value.
+ * \return If \p pValue starts with \ref binaryBlobPrefix (see encodeBinaryBlob()).
+ */
+bool isBinaryBlob(const std::string_view pValue)
+{
+    return pValue.starts_with(binaryBlobPrefix);
+}
+
+/*!
+ * \brief Decode the bytes of a binary blob Property Tree value.
+ *
+ * Inverse operation to encodeBinaryBlob(). Whitespace within the Base64 data is ignored.
+ *
+ * \throws std::invalid_argument If \p pValue is not a binary blob (see isBinaryBlob()) or contains invalid Base64 data.
+ *
+ * \param pValue Binary blob value.
+ * \return Decoded bytes.
+ */
+std::vector<std::uint8_t> decodeBinaryBlob(const std::string_view pValue)
+{
+    if (!isBinaryBlob(pValue))
+        throw std::invalid_argument("Value is not a binary blob.");
+
+    std::vector<std::uint8_t> tBytes;
+    tBytes.reserve(3 * (pValue.size() - binaryBlobPrefix.size()) / 4);
+
+    std::uint32_t tGroup = 0;
+    std::size_t tNumChars = 0;
+    std::size_t tNumPadding = 0;
 
-    std::function<void(YAML::Node&, const ptree&)> fillNode = [&fillNode](YAML::Node& pNode, const ptree& pTree) -> void
+    for (const char c : pValue.substr(binaryBlobPrefix.size()))
     {
-        if (pTree.empty())
+        std::uint32_t tSextet = 0;
+
+        if (c >= 'A' && c <= 'Z')
+            tSextet = static_cast<std::uint32_t>(c - 'A');
+        else if (c >= 'a' && c <= 'z')
+            tSextet = static_cast<std::uint32_t>(c - 'a') + 26;
+        else if (c >= '0' && c <= '9')
+            tSextet = static_cast<std::uint32_t>(c - '0') + 52;
+        else if (c == '+')
+            tSextet = 62;
+        else if (c == '/')
+            tSextet = 63;
+        else if (c == '=')
+            ++tNumPadding;
+        else if (c == ' ' || c == '\n' || c == '\r' || c == '\t')
+            continue;
+        else
+            throw std::invalid_argument("Binary blob contains invalid Base64 character.");
+
+        if (tNumPadding > 0 && c != '=')
+            throw std::invalid_argument("Binary blob contains Base64 data after padding.");
+
+        tGroup = (tGroup << 6) | tSextet;
+
+        if (++tNumChars % 4 == 0)
+        {
+            if (tNumPadding > 2)
+                throw std::invalid_argument("Binary blob contains invalid Base64 padding.");
+
+            tBytes.push_back(static_cast<std::uint8_t>(tGroup >> 16));
+
+            if (tNumPadding < 2)
+                tBytes.push_back(static_cast<std::uint8_t>(tGroup >> 8));
+            if (tNumPadding < 1)
+                tBytes.push_back(static_cast<std::uint8_t>(tGroup));
+
+            tGroup = 0;
+        }
+    }
+
+    if (tNumChars % 4 != 0)
+        throw std::invalid_argument("Binary blob has truncated Base64 data.");
+
+    return tBytes;
+}
+
+/*!
+ * \brief Compress bytes in the LZ4 block format.
+ *
+ * Writes \p pBytes to \p pCompressed (replacing its content) as a single block of the LZ4 block format
+ * (i.e. as raw sequences without LZ4 frame header), which can be decoded by decompressLZ4Block()
+ * or any other LZ4 implementation if the decompressed size is known.
+ *
+ * Uses a fast greedy single-pass match search (comparable to the default "fast" LZ4 level), which skips
+ * increasingly large steps through incompressible data. The compressed size is at most
+ * <tt>pBytes.size() + pBytes.size() / 255 + 16</tt>.
+ *
+ * \param pBytes Bytes to compress.
+ * \param pCompressed Output buffer for the compressed block (reusable).
+ */
+void compressLZ4Block(const std::span<const std::uint8_t> pBytes, std::vector<std::uint8_t>& pCompressed)
+{
+    static constexpr std::size_t minMatch = 4;          //Minimum match length of the format
+    static constexpr std::size_t lastLiterals = 5;      //Number of final bytes that must be literals
+    static constexpr std::size_t matchFindLimit = 12;   //Last match must start at least this many bytes before the end
+    static constexpr std::size_t maxOffset = 65535;
+    static constexpr int hashLog = 14;
+
+    //Only used as hint; matches are always verified, such that stale entries from previous calls are harmless
+    thread_local std::vector<std::uint32_t> hashTable(std::size_t{1} << hashLog, 0);
+
+    const std::uint8_t *const src = pBytes.data();
+    const std::size_t srcSize = pBytes.size();
+
+    pCompressed.clear();
+    pCompressed.reserve(srcSize + srcSize / 255 + 16);
+
+    const auto load32 = [src](const std::size_t pPos) -> std::uint32_t
+    {
+        std::uint32_t value;
+        std::memcpy(&value, src + pPos, sizeof(value));
+        return value;
+    };
+
+    const auto appendLength = [&pCompressed](std::size_t pLength) -> void
+    {
+        for (; pLength >= 255; pLength -= 255)
+            pCompressed.push_back(255);
+
+        pCompressed.push_back(static_cast<std::uint8_t>(pLength));
+    };
+
+    const auto appendSequence = [src, &pCompressed, &appendLength](const std::size_t pLiteralsBegin, const std::size_t pLiteralsEnd,
+                                                                    const std::size_t pMatchLength, const std::size_t pOffset) -> void
+    {
+        const std::size_t numLiterals = pLiteralsEnd - pLiteralsBegin;
+        const std::size_t matchCode = (pMatchLength >= minMatch ? pMatchLength - minMatch : 0);
+
+        pCompressed.push_back(static_cast<std::uint8_t>((std::min<std::size_t>(numLiterals, 15) << 4) | std::min<std::size_t>(matchCode, 15)));
+
+        if (numLiterals >= 15)
+            appendLength(numLiterals - 15);
+
+        pCompressed.insert(pCompressed.end(), src + pLiteralsBegin, src + pLiteralsEnd);
+
+        if (pMatchLength == 0)
             return;
 
-        //Determine node type for YAML node according to key names
-        bool nodeTypeIsSequence = true;
-        std::size_t tSequenceCtr = 0;
-        for (const auto& [key, val] : pTree)
+        pCompressed.push_back(static_cast<std::uint8_t>(pOffset & 0xFFu));
+        pCompressed.push_back(static_cast<std::uint8_t>(pOffset >> 8));
+
+        if (matchCode >= 15)
+            appendLength(matchCode - 15);
+    };
+
+    std::size_t anchor = 0;
+
+    if (srcSize > matchFindLimit)
+    {
+        const std::size_t matchStartLimit = srcSize - matchFindLimit;
+        const std::size_t matchEndLimit = srcSize - lastLiterals;
+
+        std::size_t pos = 0;
+
+        while (pos < matchStartLimit)
         {
-            (void)val;
-            if (key != ("#" + std::to_string(tSequenceCtr++)))
+            const std::uint32_t sequence = load32(pos);
+            const std::size_t hash = static_cast<std::uint32_t>(sequence * 2654435761u) >> (32 - hashLog);
+            const std::size_t candidate = hashTable[hash];
+
+            hashTable[hash] = static_cast<std::uint32_t>(pos);
+
+            if (candidate >= pos || pos - candidate > maxOffset || load32(candidate) != sequence)
             {
-                nodeTypeIsSequence = false;
-                break;
+                pos += 1 + ((pos - anchor) >> 6);
+                continue;
             }
+
+            std::size_t matchLength = minMatch;
+
+            while (pos + matchLength < matchEndLimit && src[candidate + matchLength] == src[pos + matchLength])
+                ++matchLength;
+
+            appendSequence(anchor, pos, matchLength, pos - candidate);
+
+            pos += matchLength;
+            anchor = pos;
         }
+    }
 
-        for (const auto& [childKey, childTree] : pTree)
+    appendSequence(anchor, srcSize, 0, 0);
+}
+
+/*!
+ * \brief Decompress an LZ4 block of known decompressed size.
+ *
+ * Decodes the LZ4 block format (see compressLZ4Block()) from \p pCompressed into \p pBytes. Decoding stops as soon as
+ * \p pBytes is completely filled, i.e. any bytes following the last sequence (e.g. padding) are ignored.
+ *
+ * \throws std::invalid_argument If \p pCompressed is truncated or malformed or does not decode to exactly \p pBytes.size() bytes.
+ *
+ * \param pCompressed Compressed block.
+ * \param pBytes Output buffer for the decompressed bytes (must have the decompressed size).
+ */
+void decompressLZ4Block(const std::span<const std::uint8_t> pCompressed, const std::span<std::uint8_t> pBytes)
+{
+    const std::size_t srcSize = pCompressed.size();
+    const std::size_t dstSize = pBytes.size();
+
+    std::size_t srcPos = 0;
+    std::size_t dstPos = 0;
+
+    const auto readLength = [&pCompressed, srcSize, &srcPos](std::size_t& pLength) -> void
+    {
+        std::uint8_t byte = 255;
+
+        while (byte == 255)
         {
-            YAML::Node tSubNode;
+            if (srcPos >= srcSize)
+                throw std::invalid_argument("Truncated LZ4 block.");
 
-            if (childTree.empty())
-                tSubNode = childTree.data();
-            else
-                fillNode(tSubNode, childTree);
+            byte = pCompressed[srcPos++];
+            pLength += byte;
+        }
+    };
 
-            if (nodeTypeIsSequence)
-                pNode.push_back(tSubNode);
-            else
-                pNode[childKey] = tSubNode;
+    while (dstPos < dstSize)
+    {
+        if (srcPos >= srcSize)
+            throw std::invalid_argument("Truncated LZ4 block.");
+
+        const std::uint8_t token = pCompressed[srcPos++];
+
+        std::size_t numLiterals = token >> 4;
+
+        if (numLiterals == 15)
+            readLength(numLiterals);
+
+        if (numLiterals > srcSize - srcPos || numLiterals > dstSize - dstPos)
+            throw std::invalid_argument("Invalid literal length in LZ4 block.");
+
+        std::copy_n(pCompressed.begin() + srcPos, numLiterals, pBytes.begin() + dstPos);
+
+        srcPos += numLiterals;
+        dstPos += numLiterals;
+
+        if (dstPos == dstSize)
+            break;
+
+        if (srcSize - srcPos < 2)
+            throw std::invalid_argument("Truncated LZ4 block.");
+
+        const std::size_t offset = pCompressed[srcPos] | (static_cast<std::size_t>(pCompressed[srcPos + 1]) << 8);
+        srcPos += 2;
+
+        if (offset == 0 || offset > dstPos)
+            throw std::invalid_argument("Invalid match offset in LZ4 block.");
+
+        std::size_t matchLength = token & 0x0Fu;
+
+        if (matchLength == 15)
+            readLength(matchLength);
+
+        matchLength += 4;
+
+        if (matchLength > dstSize - dstPos)
+            throw std::invalid_argument("Invalid match length in LZ4 block.");
+
+        //Byte-wise copy, since the match may overlap with the bytes being written
+        for (std::size_t i = 0; i < matchLength; ++i, ++dstPos)
+            pBytes[dstPos] = pBytes[dstPos - offset];
+    }
+}
+
+/*!
+ * \brief Serialize a Boost Property Tree into a compact binary format.
+ *
+ * Provides a binary alternative to propertyTreeToYAML() that can be written and parsed (see propertyTreeFromBinary())
+ * much faster, since no text formatting/parsing is involved. The tree structure is preserved exactly,
+ * i.e. also root data, duplicate keys and keys containing periods survive a round trip.
+ *
+ * Every node is encoded recursively as its data string (32 bit length prefix followed by the characters),
+ * followed by the 32 bit number of its child nodes and then for every child the key string (again
+ * length-prefixed) followed by the encoded child node. All integers are encoded as little-endian.
+ *
+ * Note: An empty (default-constructed) \p pTree will result in an empty byte sequence.
+ *
+ * \throws std::runtime_error If a string or the number of child nodes does not fit into 32 bits.
+ *
+ * \param pTree Property Tree to be serialized.
+ * \return Binary representation of \p pTree.
+ */
+std::vector<std::uint8_t> propertyTreeToBinary(const boost::property_tree::ptree& pTree)
+{
+    using boost::property_tree::ptree;
+
+    std::vector<std::uint8_t> tBytes;
+
+    if (pTree.empty() && pTree.data().empty())
+        return tBytes;
+
+    auto appendLength = [&tBytes](const std::size_t pLength) -> void
+    {
+        if (pLength > std::numeric_limits<std::uint32_t>::max())
+            throw std::runtime_error("Property tree element is too large for binary serialization.");
+
+        Bytes::composeBytesTo(std::back_inserter(tBytes), false, static_cast<std::uint32_t>(pLength));
+    };
+
+    auto appendString = [&tBytes, &appendLength](const std::string& pStr) -> void
+    {
+        appendLength(pStr.size());
+        tBytes.insert(tBytes.end(), pStr.begin(), pStr.end());
+    };
+
+    std::function<void(const ptree&)> appendNode = [&appendNode, &appendString, &appendLength](const ptree& pNode) -> void
+    {
+        appendString(pNode.data());
+        appendLength(pNode.size());
+
+        for (const auto& [childKey, childTree] : pNode)
+        {
+            appendString(childKey);
+            appendNode(childTree);
         }
     };
 
-    YAML::Node topNode;
+    appendNode(pTree);
 
-    fillNode(topNode, pYAMLTree);
+    return tBytes;
+}
 
-    std::string tYAMLString;
+/*!
+ * \brief Deserialize a Boost Property Tree from the compact binary format.
+ *
+ * Inverse operation to propertyTreeToBinary().
+ *
+ * An empty \p pBytes will result in an empty Property Tree.
+ *
+ * \throws std::runtime_error If \p pBytes is truncated or contains trailing bytes.
+ *
+ * \param pBytes Binary representation of the tree as generated by propertyTreeToBinary().
+ * \return Deserialized Property Tree.
+ */
+boost::property_tree::ptree propertyTreeFromBinary(const std::span<const std::uint8_t> pBytes)
+{
+    using boost::property_tree::ptree;
 
-    try
+    ptree tTree;
+
+    if (pBytes.empty())
+        return tTree;
+
+    std::size_t tPos = 0;
+
+    auto readLength = [pBytes, &tPos]() -> std::uint32_t
     {
-        tYAMLString = YAML::Dump(topNode);
-    }
-    catch (const YAML::ParserException&)
+        if (pBytes.size() - tPos < 4)
+            throw std::runtime_error("Binary property tree is truncated.");
+
+        const std::uint32_t tLength = Bytes::composeUInt32(pBytes.subspan(tPos).first<4>(), false);
+        tPos += 4;
+        return tLength;
+    };
+
+    auto readString = [pBytes, &tPos, &readLength]() -> std::string
+    {
+        const std::uint32_t tLength = readLength();
+
+        if (pBytes.size() - tPos < tLength)
+            throw std::runtime_error("Binary property tree is truncated.");
+
+        std::string tStr(reinterpret_cast<const char*>(pBytes.data() + tPos), tLength);
+        tPos += tLength;
+        return tStr;
+    };
+
+    std::function<void(ptree&)> readNode = [&readNode, &readString, &readLength](ptree& pNode) -> void
+    {
+        pNode.data() = readString();
+
+        const std::uint32_t tNumChildren = readLength();
+
+        for (std::uint32_t i = 0; i < tNumChildren; ++i)
+        {
+            std::string tKey = readString();
+            readNode(pNode.push_back(std::make_pair(std::move(tKey), ptree()))->second);
+        }
+    };
+
+    readNode(tTree);
+
+    if (tPos != pBytes.size())
+        throw std::runtime_error("Binary property tree has trailing bytes.");
+
+    return tTree;
+}
+
+/*!
+ * \brief Estimate the heap memory used by a string.
+ *
+ * Short strings stored inside the string object itself (small string optimization) do not use any heap memory.
+ *
+ * \param pString The string.
+ * \return Allocated number of bytes (including the terminating null character).
+ */
+std::size_t estimateHeapUsage(const std::string& pString)
+{
+    const char* const tObjectBegin = reinterpret_cast<const char*>(&pString);
+
+    if (std::less_equal<const char*>()(tObjectBegin, pString.data()) &&
+        std::less<const char*>()(pString.data(), tObjectBegin + sizeof(std::string)))
     {
-        throw std::runtime_error("Could not successfully generate YAML document.");
+        return 0;
     }
 
-    return tYAMLString;
+    return pString.capacity() + 1;
+}
+
+/*!
+ * \brief Estimate the heap memory used by a Boost Property Tree.
+ *
+ * Adds up the node allocations of the child containers (see heapNodeOverhead) and the keys and values
+ * (see estimateHeapUsage(const std::string&)) of the whole tree. The size of the \p pTree object itself is not included.
+ *
+ * \param pTree The tree.
+ * \return Estimated number of allocated bytes.
+ */
+std::size_t estimateHeapUsage(const boost::property_tree::ptree& pTree)
+{
+    using boost::property_tree::ptree;
+
+    //Every tree node allocates a child container including its header node
+    std::size_t tBytes = estimateHeapUsage(pTree.data()) + 2 * heapNodeOverhead + sizeof(ptree::value_type);
+
+    for (const auto& [key, child] : pTree)
+        tBytes += sizeof(ptree::value_type) + heapNodeOverhead + estimateHeapUsage(key) + estimateHeapUsage(child);
+
+    return tBytes;
 }
 
 /*!
@@ -255,4 +1013,164 @@ std::vector<std::uint64_t> uintSeqFromYAML(const std::string& pYAMLString)
     return valsVec;
 }
 
+//
+
+/*!
+ * \brief Block until a deadline with sub-millisecond accuracy.
+ *
+ * A plain \c std::this_thread::sleep_for() / \c sleep_until() typically oversleeps by up to the
+ * scheduler granularity (tens of microseconds up to milliseconds depending on the platform),
+ * which adds up for short delays that are waited for frequently (such as query delays).
+ * Hence this sleeps via \c sleep_until() only until shortly before \p pDeadline and then
+ * finishes the remaining time by repeatedly yielding the thread.
+ *
+ * Returns immediately if \p pDeadline has already passed.
+ *
+ * \param pDeadline Point in time to wait for.
+ */
+void sleepUntil(const std::chrono::steady_clock::time_point pDeadline)
+{
+    //Remaining time to be spent yielding instead of sleeping to compensate for the scheduler's wake-up latency
+    static constexpr std::chrono::microseconds yieldThreshold(200);
+
+    if (pDeadline - std::chrono::steady_clock::now() > yieldThreshold)
+        std::this_thread::sleep_until(pDeadline - yieldThreshold);
+
+    while (std::chrono::steady_clock::now() < pDeadline)
+        std::this_thread::yield();
+}
+
+//
+
+/*!
+ * \brief Parse scheduling settings from a configuration string.
+ *
+ * The format of \p pSpec is <tt>[policy][:priority][\@cpu]</tt>, where \c policy is one of "default", "fifo"
+ * (see Policy::FIFO) and "rr" (see Policy::RoundRobin) and \c priority and \c cpu are integers. Omitted parts keep
+ * their defaults, i.e. an empty string yields default scheduling without pinning. Examples:
+ * - "fifo:80@2": \c SCHED_FIFO with priority 80, pinned to CPU core 2.
+ * - "rr:10": \c SCHED_RR with priority 10, not pinned.
+ * - "@3": Default scheduling, pinned to CPU core 3.
+ *
+ * \throws std::invalid_argument If \p pSpec does not have the above format.
+ * \throws std::invalid_argument If a priority is given for the default policy.
+ *
+ * \param pSpec Configuration string.
+ * \return Parsed scheduling settings.
+ */
+ThreadScheduling ThreadScheduling::fromString(const std::string_view pSpec)
+{
+    const auto parseInt = [pSpec](const std::string_view pStr, int& pValue) -> void
+    {
+        const char *const end = pStr.data() + pStr.size();
+
+        if (pStr.empty() || std::from_chars(pStr.data(), end, pValue).ptr != end)
+            throw std::invalid_argument("Invalid thread scheduling specification \"" + std::string(pSpec) + "\".");
+    };
+
+    ThreadScheduling scheduling;
+
+    std::string_view policyStr = pSpec;
+
+    if (const std::size_t atPos = policyStr.find('@'); atPos != std::string_view::npos)
+    {
+        parseInt(policyStr.substr(atPos + 1), scheduling.cpu);
+        policyStr = policyStr.substr(0, atPos);
+    }
+
+    bool hasPriority = false;
+
+    if (const std::size_t colonPos = policyStr.find(':'); colonPos != std::string_view::npos)
+    {
+        parseInt(policyStr.substr(colonPos + 1), scheduling.priority);
+        policyStr = policyStr.substr(0, colonPos);
+        hasPriority = true;
+    }
+
+    if (policyStr == "fifo")
+        scheduling.policy = Policy::FIFO;
+    else if (policyStr == "rr")
+        scheduling.policy = Policy::RoundRobin;
+    else if (policyStr == "" || policyStr == "default")
+    {
+        if (hasPriority)
+            throw std::invalid_argument("Thread scheduling priority requires a real-time policy in \"" + std::string(pSpec) + "\".");
+    }
+    else
+        throw std::invalid_argument("Unknown thread scheduling policy \"" + std::string(policyStr) + "\".");
+
+    return scheduling;
+}
+
+//
+
+/*!
+ * \brief Apply scheduling settings to a running thread.
+ *
+ * Pins \p pThread to the CPU core of \p pScheduling (if not negative) and sets its scheduling policy
+ * and priority (if not the default policy). Both parts are applied independently, such that e.g.
+ * missing privileges for real-time scheduling (typically \c CAP_SYS_NICE or an \c RLIMIT_RTPRIO
+ * limit are needed) leave the thread pinned but with default scheduling. A warning (containing
+ * \p pThreadDescription) is logged for each part that could not be applied.
+ *
+ * Real-time scheduling and pinning are only supported on Linux.
+ *
+ * \param pThread Thread to be configured.
+ * \param pScheduling Scheduling settings.
+ * \param pThreadDescription Description of the thread for logged warnings (e.g. "IO context thread").
+ * \return True if all settings were applied.
+ */
+bool applyThreadScheduling(std::thread& pThread, const ThreadScheduling& pScheduling, const std::string_view pThreadDescription)
+{
+    bool success = true;
+
+#if BOOST_OS_LINUX != 0
+    if (pScheduling.cpu >= 0)
+    {
+        bool pinned = false;
+
+        if (pScheduling.cpu < CPU_SETSIZE)
+        {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(pScheduling.cpu, &cpuSet);
+
+            pinned = (pthread_setaffinity_np(pThread.native_handle(), sizeof(cpu_set_t), &cpuSet) == 0);
+        }
+
+        if (!pinned)
+        {
+            Logger::logWarning("Could not pin " + std::string(pThreadDescription) + " to CPU " + std::to_string(pScheduling.cpu) + ".");
+            success = false;
+        }
+    }
+
+    if (pScheduling.policy != ThreadScheduling::Policy::Default)
+    {
+        const bool fifo = (pScheduling.policy == ThreadScheduling::Policy::FIFO);
+
+        sched_param param {};
+        param.sched_priority = pScheduling.priority;
+
+        if (const int errNum = pthread_setschedparam(pThread.native_handle(), (fifo ? SCHED_FIFO : SCHED_RR), &param); errNum != 0)
+        {
+            Logger::logWarning("Could not set " + std::string(fifo ? "SCHED_FIFO" : "SCHED_RR") + " scheduling with priority " +
+                               std::to_string(pScheduling.priority) + " for " + std::string(pThreadDescription) + " (" +
+                               std::system_category().message(errNum) + "). Using default scheduling.");
+            success = false;
+        }
+    }
+#else
+    (void)pThread;
+
+    if (pScheduling.cpu >= 0 || pScheduling.policy != ThreadScheduling::Policy::Default)
+    {
+        Logger::logWarning("Could not apply scheduling settings to " + std::string(pThreadDescription) + ": Not supported on this platform.");
+        success = false;
+    }
+#endif
+
+    return success;
+}
+
 } // namespace casil::Auxil
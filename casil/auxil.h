@@ -31,9 +31,15 @@
 #include <atomic>
 #include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <istream>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace casil
@@ -46,7 +52,34 @@ namespace Auxil
 {
 
 boost::property_tree::ptree propertyTreeFromYAML(const std::string& pYAMLString);   ///< Parse a YAML document into a Boost Property Tree.
+boost::property_tree::ptree propertyTreeFromYAML(std::istream& pYAMLStream);       ///< Parse a YAML document from a stream into a Boost Property Tree.
 std::string propertyTreeToYAML(const boost::property_tree::ptree& pTree);           ///< Generate a YAML document from a Boost Property Tree.
+void propertyTreeToYAML(const boost::property_tree::ptree& pTree, std::string& pYAMLString);
+                                                                                    ///< \brief Generate a YAML document from a Boost Property Tree
+                                                                                    ///  into a reusable string buffer.
+//
+std::string encodeBinaryBlob(std::span<const std::uint8_t> pBytes);                ///< Encode bytes as binary blob Property Tree value.
+bool isBinaryBlob(std::string_view pValue);                                         ///< Check if a Property Tree value is a binary blob.
+std::vector<std::uint8_t> decodeBinaryBlob(std::string_view pValue);               ///< Decode the bytes of a binary blob Property Tree value.
+//
+constexpr std::string_view binaryBlobPrefix = "!!binary ";                          ///< \brief Prefix of binary blob Property Tree values
+                                                                                    ///  (see encodeBinaryBlob()).
+//
+void compressLZ4Block(std::span<const std::uint8_t> pBytes, std::vector<std::uint8_t>& pCompressed);
+                                                                                    ///< Compress bytes in the LZ4 block format.
+void decompressLZ4Block(std::span<const std::uint8_t> pCompressed, std::span<std::uint8_t> pBytes);
+                                                                                    ///< Decompress an LZ4 block of known decompressed size.
+//
+std::vector<std::uint8_t> propertyTreeToBinary(const boost::property_tree::ptree& pTree);   ///< \brief Serialize a Boost Property Tree
+                                                                                            ///  into a compact binary format.
+boost::property_tree::ptree propertyTreeFromBinary(std::span<const std::uint8_t> pBytes);  ///< \brief Deserialize a Boost Property Tree
+                                                                                            ///  from the compact binary format.
+//
+std::size_t estimateHeapUsage(const std::string& pString);                          ///< Estimate the heap memory used by a string.
+std::size_t estimateHeapUsage(const boost::property_tree::ptree& pTree);           ///< Estimate the heap memory used by a Boost Property Tree.
+//
+constexpr std::size_t heapNodeOverhead = 4 * sizeof(void*);                         ///< \brief Estimated bookkeeping bytes per allocated node
+                                                                                    ///  of node-based containers (see estimateHeapUsage()).
 
 //TODO this is now unused but maybe still useful in the future or for python; keep it?
 std::vector<std::uint64_t> uintSeqFromYAML(const std::string& pYAMLString);         ///< Parse a sequence of unsigned integers from YAML format.
@@ -79,6 +112,64 @@ constexpr std::chrono::microseconds getChronoMicroSecs(const double pSecs)
     return std::chrono::microseconds(std::lround(pSecs*1e6));
 }
 
+void sleepUntil(std::chrono::steady_clock::time_point pDeadline);   ///< Block until a deadline with sub-millisecond accuracy.
+
+//
+
+/*!
+ * \brief Scheduling settings for a worker thread (see applyThreadScheduling()).
+ *
+ * Can be parsed from a compact configuration string via fromString().
+ */
+struct ThreadScheduling
+{
+    /*!
+     * \brief Scheduling policy of the thread.
+     */
+    enum class Policy : std::uint8_t
+    {
+        Default = 0,    ///< Default (time-sharing) scheduling of the operating system.
+        FIFO = 1,       ///< Real-time first-in-first-out scheduling (\c SCHED_FIFO).
+        RoundRobin = 2  ///< Real-time round-robin scheduling (\c SCHED_RR).
+    };
+    //
+    Policy policy = Policy::Default;    ///< Scheduling policy.
+    int priority = 0;                   ///< Real-time priority (only used for real-time policies).
+    int cpu = -1;                       ///< CPU core to pin the thread to (negative for no pinning).
+    //
+    static ThreadScheduling fromString(std::string_view pSpec);     ///< Parse scheduling settings from a configuration string.
+};
+
+bool applyThreadScheduling(std::thread& pThread, const ThreadScheduling& pScheduling, std::string_view pThreadDescription);
+                                                                    ///< Apply scheduling settings to a running thread.
+
+/*!
+ * \brief Start a thread with specific scheduling settings.
+ *
+ * Constructs an \c std::thread from \p pFunc and \p pArgs and applies \p pScheduling to it (see applyThreadScheduling()).
+ * The thread is started in any case, i.e. it falls back to the remaining or default settings if \p pScheduling
+ * cannot be (fully) applied.
+ *
+ * \throws std::system_error If the thread could not be started.
+ *
+ * \tparam FuncT Type of the thread function.
+ * \tparam ArgsT Types of the thread function arguments.
+ * \param pScheduling Scheduling settings for the thread.
+ * \param pThreadDescription Description of the thread for logged warnings.
+ * \param pFunc Thread function.
+ * \param pArgs Thread function arguments.
+ * \return The started thread.
+ */
+template<typename FuncT, typename... ArgsT>
+std::thread startThread(const ThreadScheduling& pScheduling, const std::string_view pThreadDescription, FuncT&& pFunc, ArgsT&&... pArgs)
+{
+    std::thread thread(std::forward<FuncT>(pFunc), std::forward<ArgsT>(pArgs)...);
+
+    applyThreadScheduling(thread, pScheduling, pThreadDescription);
+
+    return thread;
+}
+
 //
 
 /*!
@@ -141,6 +232,21 @@ public:
         if (!ASIO::startRunIOContext(numThreads))
             throw std::runtime_error("Failed to start IO context threads.");
     }
+    /*!
+     * \brief Constructor.
+     *
+     * Starts the \p numThreads IO context threads with specific scheduling settings
+     * (see ASIO::startRunIOContext(unsigned int, const std::vector<int>&, const ThreadScheduling&)).
+     *
+     * \throw std::runtime_error If the threads could not be started.
+     *
+     * \param pScheduling Scheduling settings for the threads.
+     */
+    explicit AsyncIORunner(const ThreadScheduling& pScheduling)
+    {
+        if (!ASIO::startRunIOContext(numThreads, {}, pScheduling))
+            throw std::runtime_error("Failed to start IO context threads.");
+    }
     /*!
      * \brief Destructor.
      *
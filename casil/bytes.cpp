@@ -24,16 +24,302 @@
 #include <casil/bytes.h>
 
 #include <boost/dynamic_bitset.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/predef/architecture/x86.h>
+#include <boost/predef/hardware/simd.h>
 
-#include <bitset>
+#include <algorithm>
+#include <bit>
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <ostream>
+#include <ranges>
 #include <sstream>
+#include <stdexcept>
+#include <string_view>
 #include <type_traits>
+#include <utility>
+
+#if BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE2_VERSION
+    #define CASIL_BYTES_SSE2_KERNELS        //SSE2 is part of the x86-64 baseline and always usable
+    #include <immintrin.h>
+#endif
+#if defined(CASIL_BYTES_SSE2_KERNELS) && BOOST_ARCH_X86 != 0 && defined(__GNUC__)
+    #define CASIL_BYTES_AVX_KERNELS         //AVX2/AVX-512 kernels via target attributes, selected at runtime
+#endif
 
 namespace
 {
 
+/*
+ * Bulk byte kernels with runtime CPU dispatch.
+ *
+ * Each kernel exists as portable scalar version and, on x86, as SSE2, AVX2 and AVX-512 (BW) version. The best version
+ * supported by the executing CPU is selected once on first use (see kernels()), so that a binary built for generic
+ * x86-64 still uses AVX2/AVX-512 where available. The environment variable CASIL_SIMD_TARGET ("generic", "sse2",
+ * "avx2" or "avx512bw") can lower the selection, e.g. to compare the kernels or to work around a faulty CPU/OS.
+ */
+
+/*
+ * Writes the 'pSize' bytes from 'pSrc' in reversed order to 'pDst' (pDst[i] = pSrc[pSize-1-i]; must not overlap).
+ */
+void reverseBytesGeneric(const std::uint8_t *const pSrc, std::uint8_t *const pDst, const std::size_t pSize)
+{
+    std::reverse_copy(pSrc, pSrc + pSize, pDst);
+}
+
+/*
+ * Writes the 'pNumWords' 32 bit words from 'pSrc' with swapped byte order to 'pDst' (unaligned; may be identical to 'pSrc').
+ */
+void swapUInt32BytesGeneric(const std::uint8_t *const pSrc, std::uint8_t *const pDst, const std::size_t pNumWords)
+{
+    for (std::size_t i = 0; i < 4 * pNumWords; i += 4)
+    {
+        std::uint32_t word;
+        std::memcpy(&word, pSrc + i, 4);
+        boost::endian::endian_reverse_inplace(word);
+        std::memcpy(pDst + i, &word, 4);
+    }
+}
+
+/*
+ * Returns the index of the first byte that differs between 'pLhs' and 'pRhs' (both of size 'pSize'), or 'pSize' if all are equal.
+ */
+std::size_t findMismatchGeneric(const std::uint8_t *const pLhs, const std::uint8_t *const pRhs, const std::size_t pSize)
+{
+    return static_cast<std::size_t>(std::mismatch(pLhs, pLhs + pSize, pRhs).first - pLhs);
+}
+
+#ifdef CASIL_BYTES_SSE2_KERNELS
+
+/*
+ * Swaps the byte order of all four 32 bit words of 'pX' (no SSSE3 byte shuffle: swap 16 bit halves, then bytes of halves).
+ */
+inline __m128i swapUInt32BytesSSE2(__m128i pX)
+{
+    pX = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pX, 0xB1), 0xB1);
+    return _mm_or_si128(_mm_slli_epi16(pX, 8), _mm_srli_epi16(pX, 8));
+}
+
+/*
+ * SSE2 version of reverseBytesGeneric().
+ */
+void reverseBytesSSE2(const std::uint8_t *const pSrc, std::uint8_t *const pDst, const std::size_t pSize)
+{
+    std::size_t i = 0;
+
+    for (; i + 16 <= pSize; i += 16)
+    {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + pSize - i - 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), ::swapUInt32BytesSSE2(_mm_shuffle_epi32(x, 0x1B)));
+    }
+
+    ::reverseBytesGeneric(pSrc, pDst + i, pSize - i);
+}
+
+/*
+ * SSE2 version of swapUInt32BytesGeneric().
+ */
+void swapUInt32BytesSSE2(const std::uint8_t *const pSrc, std::uint8_t *const pDst, const std::size_t pNumWords)
+{
+    std::size_t i = 0;
+
+    for (; i + 4 <= pNumWords; i += 4)
+    {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 4 * i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 4 * i), ::swapUInt32BytesSSE2(x));
+    }
+
+    ::swapUInt32BytesGeneric(pSrc + 4 * i, pDst + 4 * i, pNumWords - i);
+}
+
+/*
+ * SSE2 version of findMismatchGeneric().
+ */
+std::size_t findMismatchSSE2(const std::uint8_t *const pLhs, const std::uint8_t *const pRhs, const std::size_t pSize)
+{
+    std::size_t i = 0;
+
+    for (; i + 16 <= pSize; i += 16)
+    {
+        const __m128i lhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pLhs + i));
+        const __m128i rhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRhs + i));
+
+        const auto equalMask = static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs)));
+
+        if (equalMask != 0xFFFFu)
+            return i + static_cast<std::size_t>(std::countr_one(equalMask));
+    }
+
+    return i + ::findMismatchGeneric(pLhs + i, pRhs + i, pSize - i);
+}
+
+#endif
+
+#ifdef CASIL_BYTES_AVX_KERNELS
+
+/*
+ * AVX2 version of reverseBytesGeneric().
+ */
+__attribute__((target("avx2")))
+void reverseBytesAVX2(const std::uint8_t *const pSrc, std::uint8_t *const pDst, const std::size_t pSize)
+{
+    const __m256i laneReverse = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                                 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    std::size_t i = 0;
+
+    for (; i + 32 <= pSize; i += 32)
+    {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + pSize - i - 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + i), _mm256_permute4x64_epi64(_mm256_shuffle_epi8(x, laneReverse), 0x4E));
+    }
+
+    ::reverseBytesSSE2(pSrc, pDst + i, pSize - i);
+}
+
+/*
+ * AVX2 version of swapUInt32BytesGeneric().
+ */
+__attribute__((target("avx2")))
+void swapUInt32BytesAVX2(const std::uint8_t *const pSrc, std::uint8_t *const pDst, const std::size_t pNumWords)
+{
+    const __m256i wordSwap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                              3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    std::size_t i = 0;
+
+    for (; i + 8 <= pNumWords; i += 8)
+    {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + 4 * i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + 4 * i), _mm256_shuffle_epi8(x, wordSwap));
+    }
+
+    ::swapUInt32BytesSSE2(pSrc + 4 * i, pDst + 4 * i, pNumWords - i);
+}
+
+/*
+ * AVX2 version of findMismatchGeneric().
+ */
+__attribute__((target("avx2")))
+std::size_t findMismatchAVX2(const std::uint8_t *const pLhs, const std::uint8_t *const pRhs, const std::size_t pSize)
+{
+    std::size_t i = 0;
+
+    for (; i + 32 <= pSize; i += 32)
+    {
+        const __m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pLhs + i));
+        const __m256i rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pRhs + i));
+
+        const auto equalMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)));
+
+        if (equalMask != 0xFFFFFFFFu)
+            return i + static_cast<std::size_t>(std::countr_one(equalMask));
+    }
+
+    return i + ::findMismatchSSE2(pLhs + i, pRhs + i, pSize - i);
+}
+
+/*
+ * AVX-512 (BW) version of reverseBytesGeneric().
+ */
+__attribute__((target("avx512f,avx512bw")))
+void reverseBytesAVX512(const std::uint8_t *const pSrc, std::uint8_t *const pDst, const std::size_t pSize)
+{
+    const __m512i laneReverse = _mm512_set4_epi32(0x00010203, 0x04050607, 0x08090A0B, 0x0C0D0E0F);     //Bytes 15...0 per lane
+    std::size_t i = 0;
+
+    for (; i + 64 <= pSize; i += 64)
+    {
+        const __m512i x = _mm512_shuffle_epi8(_mm512_loadu_si512(pSrc + pSize - i - 64), laneReverse);
+        _mm512_storeu_si512(pDst + i, _mm512_maskz_shuffle_i64x2(0xFF, x, x, 0x1B));   //Full mask; avoids GCC -Wmaybe-uninitialized
+    }
+
+    ::reverseBytesAVX2(pSrc, pDst + i, pSize - i);
+}
+
+/*
+ * AVX-512 (BW) version of swapUInt32BytesGeneric().
+ */
+__attribute__((target("avx512f,avx512bw")))
+void swapUInt32BytesAVX512(const std::uint8_t *const pSrc, std::uint8_t *const pDst, const std::size_t pNumWords)
+{
+    const __m512i wordSwap = _mm512_set4_epi32(0x0C0D0E0F, 0x08090A0B, 0x04050607, 0x00010203);        //Bytes 3...0, ..., 15...12 per lane
+    std::size_t i = 0;
+
+    for (; i + 16 <= pNumWords; i += 16)
+        _mm512_storeu_si512(pDst + 4 * i, _mm512_shuffle_epi8(_mm512_loadu_si512(pSrc + 4 * i), wordSwap));
+
+    ::swapUInt32BytesAVX2(pSrc + 4 * i, pDst + 4 * i, pNumWords - i);
+}
+
+/*
+ * AVX-512 (BW) version of findMismatchGeneric().
+ */
+__attribute__((target("avx512f,avx512bw")))
+std::size_t findMismatchAVX512(const std::uint8_t *const pLhs, const std::uint8_t *const pRhs, const std::size_t pSize)
+{
+    std::size_t i = 0;
+
+    for (; i + 64 <= pSize; i += 64)
+    {
+        const __mmask64 unequalMask = _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(pLhs + i), _mm512_loadu_si512(pRhs + i));
+
+        if (unequalMask != 0)
+            return i + static_cast<std::size_t>(std::countr_zero(static_cast<std::uint64_t>(unequalMask)));
+    }
+
+    return i + ::findMismatchAVX2(pLhs + i, pRhs + i, pSize - i);
+}
+
+#endif
+
+/*
+ * Set of kernel versions for one instruction set (see kernels()).
+ */
+struct Kernels
+{
+    std::string_view target;
+    void (*reverseBytes)(const std::uint8_t*, std::uint8_t*, std::size_t);
+    void (*swapUInt32Bytes)(const std::uint8_t*, std::uint8_t*, std::size_t);
+    std::size_t (*findMismatch)(const std::uint8_t*, const std::uint8_t*, std::size_t);
+};
+
+/*
+ * Selects the best kernel set supported by the CPU, limited by the environment variable CASIL_SIMD_TARGET (if set).
+ */
+Kernels selectKernels()
+{
+    const char *const getenvPtr = std::getenv("CASIL_SIMD_TARGET");
+    const std::string_view maxTarget = (getenvPtr ? getenvPtr : "");
+
+    //Highest allowed kernel set (3: AVX-512, 2: AVX2, 1: SSE2, 0: generic); an unknown/unset CASIL_SIMD_TARGET does not limit
+    [[maybe_unused]] const int maxLevel = (maxTarget == "generic") ? 0 : (maxTarget == "sse2") ? 1 : (maxTarget == "avx2") ? 2 : 3;
+
+#ifdef CASIL_BYTES_AVX_KERNELS
+    __builtin_cpu_init();
+
+    if (maxLevel >= 3 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+        return {"avx512bw", &::reverseBytesAVX512, &::swapUInt32BytesAVX512, &::findMismatchAVX512};
+    if (maxLevel >= 2 && __builtin_cpu_supports("avx2"))
+        return {"avx2", &::reverseBytesAVX2, &::swapUInt32BytesAVX2, &::findMismatchAVX2};
+#endif
+#ifdef CASIL_BYTES_SSE2_KERNELS
+    if (maxLevel >= 1)
+        return {"sse2", &::reverseBytesSSE2, &::swapUInt32BytesSSE2, &::findMismatchSSE2};
+#endif
+
+    return {"generic", &::reverseBytesGeneric, &::swapUInt32BytesGeneric, &::findMismatchGeneric};
+}
+
+/*
+ * Returns the kernel set selected for this CPU (selected on first call).
+ */
+const Kernels& kernels()
+{
+    static const Kernels selectedKernels = ::selectKernels();
+    return selectedKernels;
+}
+
 /*
  * Outputs 'pVec' to 'pOstream' as "{S1, S2, ..., SN}" with each Si being an integer of
  * type 'T' as formatted by formatHex() without zero-padding and where Si = pVec[i-1].
@@ -59,6 +345,68 @@ std::ostream& ostreamOperator(std::ostream& pOstream, const std::vector<T>& pVec
     return pOstream;
 }
 
+/*
+ * Returns the 'pBlockIdx'-th least significant dynamic bitset block of the big endian byte sequence 'pBytes' (zero beyond its end).
+ */
+boost::dynamic_bitset<>::block_type bitsetBlockFromBytes(const std::span<const std::uint8_t> pBytes, const std::size_t pBlockIdx)
+{
+    using Block = boost::dynamic_bitset<>::block_type;
+
+    constexpr std::size_t bytesPerBlock = sizeof(Block);
+
+    const std::uint8_t* const bytesEnd = pBytes.data() + pBytes.size();
+
+    if ((pBlockIdx + 1) * bytesPerBlock <= pBytes.size())
+    {
+        Block word;
+        std::memcpy(&word, bytesEnd - (pBlockIdx + 1) * bytesPerBlock, bytesPerBlock);
+        return boost::endian::big_to_native(word);
+    }
+
+    Block word = 0;
+
+    for (std::size_t i = pBlockIdx * bytesPerBlock; i < pBytes.size(); ++i)
+        word |= static_cast<Block>(*(bytesEnd - 1 - i)) << (8 * (i - pBlockIdx * bytesPerBlock));
+
+    return word;
+}
+
+/*
+ * Copies 'pWords.size()' words with byte order 'Endian' from byte sequence 'pBytes' to native word sequence 'pWords'.
+ */
+template<std::endian Endian>
+void decodeUInt32Words(const std::span<const std::uint8_t> pBytes, const std::span<std::uint32_t> pWords)
+{
+    if (pBytes.size() != 4 * pWords.size())
+        throw std::invalid_argument("Number of bytes must be four times the number of words.");
+
+    if (pWords.empty())
+        return;
+
+    if constexpr (Endian == std::endian::native)
+        std::memcpy(pWords.data(), pBytes.data(), pBytes.size());
+    else
+        ::kernels().swapUInt32Bytes(pBytes.data(), reinterpret_cast<std::uint8_t*>(pWords.data()), pWords.size());
+}
+
+/*
+ * Copies native word sequence 'pWords' to byte sequence 'pBytes' (of size four times 'pWords.size()') with byte order 'Endian'.
+ */
+template<std::endian Endian>
+void encodeUInt32Words(const std::span<const std::uint32_t> pWords, const std::span<std::uint8_t> pBytes)
+{
+    if (pBytes.size() != 4 * pWords.size())
+        throw std::invalid_argument("Number of bytes must be four times the number of words.");
+
+    if (pWords.empty())
+        return;
+
+    if constexpr (Endian == std::endian::native)
+        std::memcpy(pBytes.data(), pWords.data(), pBytes.size());
+    else
+        ::kernels().swapUInt32Bytes(reinterpret_cast<const std::uint8_t*>(pWords.data()), pBytes.data(), pWords.size());
+}
+
 /*
  * Returns 'pVec' as string formatted using ostreamOperator<T>().
  */
@@ -78,6 +426,74 @@ std::string formatUIntVec(const std::vector<T>& pVec)
 namespace casil::Bytes
 {
 
+/*!
+ * \brief Convert a little endian byte sequence to a sequence of 32 bit unsigned integers.
+ *
+ * Interprets each group of four bytes <tt>{pBytes[4*i], ..., pBytes[4*i+3]}</tt> as little endian
+ * representation <tt>{val[LSB], ..., val[MSB]}</tt> of the 32 bit unsigned integer \p pWords[i].
+ *
+ * On little endian hosts this is a plain memory copy, otherwise all words are byte-swapped in bulk.
+ *
+ * \throws std::invalid_argument If the size of \p pBytes is not four times the size of \p pWords.
+ *
+ * \param pBytes The byte sequence to convert.
+ * \param pWords Destination for the converted words.
+ */
+void decodeUInt32LE(const std::span<const std::uint8_t> pBytes, const std::span<std::uint32_t> pWords)
+{
+    ::decodeUInt32Words<std::endian::little>(pBytes, pWords);
+}
+
+/*!
+ * \brief Convert a big endian byte sequence to a sequence of 32 bit unsigned integers.
+ *
+ * Interprets each group of four bytes <tt>{pBytes[4*i], ..., pBytes[4*i+3]}</tt> as big endian
+ * representation <tt>{val[MSB], ..., val[LSB]}</tt> of the 32 bit unsigned integer \p pWords[i].
+ *
+ * On big endian hosts this is a plain memory copy, otherwise all words are byte-swapped in bulk.
+ *
+ * \throws std::invalid_argument If the size of \p pBytes is not four times the size of \p pWords.
+ *
+ * \param pBytes The byte sequence to convert.
+ * \param pWords Destination for the converted words.
+ */
+void decodeUInt32BE(const std::span<const std::uint8_t> pBytes, const std::span<std::uint32_t> pWords)
+{
+    ::decodeUInt32Words<std::endian::big>(pBytes, pWords);
+}
+
+/*!
+ * \brief Convert a sequence of 32 bit unsigned integers to a little endian byte sequence.
+ *
+ * Inverse of decodeUInt32LE().
+ *
+ * \throws std::invalid_argument If the size of \p pBytes is not four times the size of \p pWords.
+ *
+ * \param pWords The word sequence to convert.
+ * \param pBytes Destination for the converted bytes.
+ */
+void encodeUInt32LE(const std::span<const std::uint32_t> pWords, const std::span<std::uint8_t> pBytes)
+{
+    ::encodeUInt32Words<std::endian::little>(pWords, pBytes);
+}
+
+/*!
+ * \brief Convert a sequence of 32 bit unsigned integers to a big endian byte sequence.
+ *
+ * Inverse of decodeUInt32BE().
+ *
+ * \throws std::invalid_argument If the size of \p pBytes is not four times the size of \p pWords.
+ *
+ * \param pWords The word sequence to convert.
+ * \param pBytes Destination for the converted bytes.
+ */
+void encodeUInt32BE(const std::span<const std::uint32_t> pWords, const std::span<std::uint8_t> pBytes)
+{
+    ::encodeUInt32Words<std::endian::big>(pWords, pBytes);
+}
+
+//
+
 /*!
  * \brief Convert a sequence of bytes to a dynamic bitset.
  *
@@ -95,29 +511,91 @@ namespace casil::Bytes
  */
 boost::dynamic_bitset<> bitsetFromBytes(const std::vector<std::uint8_t>& pBytes, const std::size_t pBitSize)
 {
-    const std::size_t byteSize = pBytes.size();
+    using Block = boost::dynamic_bitset<>::block_type;
 
-    boost::dynamic_bitset bits(pBitSize);
+    constexpr std::size_t bytesPerBlock = sizeof(Block);
 
-    for (std::size_t i = 0; i < byteSize ; ++i)
-    {
-        const std::uint8_t currentByte = pBytes[byteSize-1-i];
-        const std::bitset<8> currentBitset(currentByte);
+    //Only bytes that contribute to the lower 'pBitSize' bits are needed
+    const std::size_t usedBytes = std::min(pBytes.size(), (pBitSize + 7) / 8);
+
+    std::vector<Block> blocks((usedBytes + bytesPerBlock - 1) / bytesPerBlock, 0);
+
+    const std::uint8_t* const bytesEnd = pBytes.data() + pBytes.size();
 
-        for (std::size_t j = 0; j < 8; ++j)
-        {
-            const std::size_t bitIdx = i*8 + j;
+    //Assemble all complete blocks from the least significant (last) bytes on at once
 
-            if (bitIdx >= pBitSize)
-                break;
+    std::size_t blockIdx = usedBytes / bytesPerBlock;
 
-            bits[bitIdx] = currentBitset[j];
-        }
+    if constexpr (std::endian::native == std::endian::little)   //Block storage is then the byte-reversed byte sequence
+        ::kernels().reverseBytes(bytesEnd - blockIdx * bytesPerBlock, reinterpret_cast<std::uint8_t*>(blocks.data()), blockIdx * bytesPerBlock);
+    else
+    {
+        for (std::size_t i = 0; i < blockIdx; ++i)
+            std::memcpy(&blocks[i], bytesEnd - (i + 1) * bytesPerBlock, bytesPerBlock);
     }
 
+    //Remaining bytes of a final, incomplete block
+
+    for (std::size_t i = blockIdx * bytesPerBlock; i < usedBytes; ++i)
+        blocks[blockIdx] |= static_cast<Block>(*(bytesEnd - 1 - i)) << (8 * (i - blockIdx * bytesPerBlock));
+
+    boost::dynamic_bitset<> bits(blocks.begin(), blocks.end());
+
+    //Zero-extend or cut off surplus bits of the most significant block
+    bits.resize(pBitSize);
+
     return bits;
 }
 
+/*!
+ * \brief Convert a sequence of bytes into an existing dynamic bitset.
+ *
+ * Assumes that \p pBytes represents a bit sequence (an integer number) in big endian byte order (i.e. \p pBytes[0] is the
+ * most significant byte) and assigns these bits to \p pBits, in place and without changing its size. The \p pSkipBits least
+ * significant bits from \p pBytes are skipped, i.e. <tt>pBits[0]</tt> is set to bit number \p pSkipBits of the byte sequence.
+ * Bits of \p pBits beyond the end of the byte sequence are set to zero and surplus bits of the byte sequence are ignored.
+ *
+ * For a zero \p pSkipBits this is equivalent to <tt>pBits = bitsetFromBytes(pBytes, pBits.size())</tt> ("MSB-side padding"),
+ * while e.g. an "LSB-side padding" of the byte sequence can be removed by setting \p pSkipBits to the number of padding bits.
+ *
+ * \param pBytes The byte sequence to convert.
+ * \param pBits The bitset to assign the converted bits to.
+ * \param pSkipBits Number of least significant bits of \p pBytes to skip.
+ */
+void bitsetFromBytesInto(const std::span<const std::uint8_t> pBytes, boost::dynamic_bitset<>& pBits, const std::size_t pSkipBits)
+{
+    using Block = boost::dynamic_bitset<>::block_type;
+
+    constexpr std::size_t bitsPerBlock = boost::dynamic_bitset<>::bits_per_block;
+
+    const std::size_t numBlocks = pBits.num_blocks();
+
+    const std::size_t skipBlocks = pSkipBits / bitsPerBlock;
+    const std::size_t skipShift = pSkipBits % bitsPerBlock;
+
+    //Unused bits of the most significant block must be zero (class invariant)
+    const std::size_t usedTopBits = pBits.size() % bitsPerBlock;
+    const Block topBlockMask = (usedTopBits == 0) ? ~Block{0} : ((Block{1} << usedTopBits) - 1);
+
+    //Generate the target blocks on the fly (shifted by 'pSkipBits') and copy them directly into the bitset's storage
+
+    auto blocks = std::views::iota(std::size_t{0}, numBlocks) |
+                  std::views::transform([pBytes, numBlocks, skipBlocks, skipShift, topBlockMask](const std::size_t pIdx) -> Block
+                                        {
+                                            Block word = ::bitsetBlockFromBytes(pBytes, pIdx + skipBlocks);
+
+                                            if (skipShift > 0)
+                                            {
+                                                word >>= skipShift;
+                                                word |= ::bitsetBlockFromBytes(pBytes, pIdx + skipBlocks + 1) << (bitsPerBlock - skipShift);
+                                            }
+
+                                            return (pIdx + 1 == numBlocks) ? (word & topBlockMask) : word;
+                                        });
+
+    boost::from_block_range(blocks.begin(), blocks.end(), pBits);
+}
+
 /*!
  * \brief Convert a dynamic bitset to a sequence of bytes.
  *
@@ -135,34 +613,81 @@ boost::dynamic_bitset<> bitsetFromBytes(const std::vector<std::uint8_t>& pBytes,
  */
 std::vector<std::uint8_t> bytesFromBitset(const boost::dynamic_bitset<>& pBits, const std::size_t pByteSize)
 {
-    const std::size_t bitSize = pBits.size();
+    using Block = boost::dynamic_bitset<>::block_type;
 
-    std::vector<std::uint8_t> bytes(pByteSize, 0);
+    constexpr std::size_t bytesPerBlock = sizeof(Block);
 
-    for (std::size_t i = 0; i < pByteSize ; ++i)
-    {
-        std::bitset<8> currentBitset;
+    std::vector<Block> blocks(pBits.num_blocks());
+    boost::to_block_range(pBits, blocks.begin());
 
-        for (std::size_t j = 0; j < 8; ++j)
-        {
-            const std::size_t bitIdx = i*8 + j;
+    std::vector<std::uint8_t> bytes(pByteSize, 0);
 
-            if (bitIdx >= bitSize)
-                break;
+    //Unused bits of the most significant block are always zero, so only need to cover 'pByteSize' here
+    const std::size_t usedBytes = std::min(pByteSize, blocks.size() * bytesPerBlock);
 
-            currentBitset[j] = pBits[bitIdx];
-        }
+    std::uint8_t* const bytesEnd = bytes.data() + pByteSize;
 
-        const std::uint8_t currentByte = currentBitset.to_ulong();
+    //Write all complete blocks to the least significant (last) bytes on at once
 
-        bytes[pByteSize-1-i] = currentByte;
+    std::size_t blockIdx = usedBytes / bytesPerBlock;
+
+    if constexpr (std::endian::native == std::endian::little)   //Byte sequence is then the byte-reversed block storage
+        ::kernels().reverseBytes(reinterpret_cast<const std::uint8_t*>(blocks.data()), bytesEnd - blockIdx * bytesPerBlock, blockIdx * bytesPerBlock);
+    else
+    {
+        for (std::size_t i = 0; i < blockIdx; ++i)
+            std::memcpy(bytesEnd - (i + 1) * bytesPerBlock, &blocks[i], bytesPerBlock);
     }
 
+    //Remaining bytes of a final, partially needed block
+
+    for (std::size_t i = blockIdx * bytesPerBlock; i < usedBytes; ++i)
+        *(bytesEnd - 1 - i) = static_cast<std::uint8_t>(blocks[blockIdx] >> (8 * (i - blockIdx * bytesPerBlock)));
+
     return bytes;
 }
 
 //
 
+/*!
+ * \brief Find the first differing byte of two equally long byte sequences.
+ *
+ * Compares \p pLhs and \p pRhs using the vectorized kernel for the executing CPU (see simdKernelTarget()).
+ *
+ * \throws std::invalid_argument If \p pLhs and \p pRhs differ in size.
+ *
+ * \param pLhs First byte sequence.
+ * \param pRhs Second byte sequence.
+ * \return Index of the first byte with <tt>pLhs[i] != pRhs[i]</tt>, or the size of the sequences if they are equal.
+ */
+std::size_t findMismatch(const std::span<const std::uint8_t> pLhs, const std::span<const std::uint8_t> pRhs)
+{
+    if (pLhs.size() != pRhs.size())
+        throw std::invalid_argument("Byte sequences must have equal size.");
+
+    return ::kernels().findMismatch(pLhs.data(), pRhs.data(), pLhs.size());
+}
+
+/*!
+ * \brief Get the instruction set selected at runtime for the bulk byte conversion/comparison kernels.
+ *
+ * The bulk conversions between byte sequences and bitsets or 32 bit words of the non-native byte order (e.g. bitsetFromBytes(),
+ * bytesFromBitset(), decodeUInt32BE()) and findMismatch() use vectorized kernels. On x86 the best kernel set supported by
+ * the executing CPU is selected on first use, independent of the compiler flags: "avx512bw", "avx2" or "sse2".
+ * Other architectures use the portable "generic" kernels.
+ *
+ * The selection can be limited by setting the environment variable \c CASIL_SIMD_TARGET
+ * to one of the above names (e.g. "sse2" to not use AVX2/AVX-512).
+ *
+ * \return Name of the selected kernel set.
+ */
+std::string_view simdKernelTarget()
+{
+    return ::kernels().target;
+}
+
+//
+
 /*!
  * \brief Interpret a character string as a sequence of bytes.
  *
@@ -294,3 +819,330 @@ std::string formatUInt64Vec(const std::vector<std::uint64_t>& pVec)
 }
 
 } // namespace casil::Bytes
+
+//
+
+using casil::Bytes::SmallByteVec;
+
+/*!
+ * \brief Default constructor.
+ *
+ * Constructs an empty byte sequence (no allocation).
+ */
+SmallByteVec::SmallByteVec() :
+    length(0),
+    heapCapacity(0),
+    inlineBytes{},
+    heapBytes(nullptr)
+{
+}
+
+/*!
+ * \brief Constructor.
+ *
+ * Constructs a byte sequence of \p pSize bytes with value \p pValue.
+ * Only allocates memory if \p pSize exceeds \ref inlineCapacity.
+ *
+ * \param pSize Number of bytes.
+ * \param pValue Value of all bytes.
+ */
+SmallByteVec::SmallByteVec(const std::size_t pSize, const std::uint8_t pValue) :
+    SmallByteVec()
+{
+    resize(pSize, pValue);
+}
+
+/*!
+ * \brief Constructor.
+ *
+ * Constructs a copy of the byte sequence \p pBytes.
+ * Only allocates memory if the size of \p pBytes exceeds \ref inlineCapacity.
+ *
+ * \param pBytes Bytes to be copied.
+ */
+SmallByteVec::SmallByteVec(const std::span<const std::uint8_t> pBytes) :
+    SmallByteVec()
+{
+    resize(pBytes.size());
+    std::copy(pBytes.begin(), pBytes.end(), data());
+}
+
+/*!
+ * \brief Constructor.
+ *
+ * Constructs a byte sequence from a list of bytes.
+ *
+ * \param pBytes Bytes to be copied.
+ */
+SmallByteVec::SmallByteVec(const std::initializer_list<std::uint8_t> pBytes) :
+    SmallByteVec(std::span<const std::uint8_t>(pBytes.begin(), pBytes.size()))
+{
+}
+
+/*!
+ * \brief Copy constructor.
+ *
+ * \param pOther Other byte sequence.
+ */
+SmallByteVec::SmallByteVec(const SmallByteVec& pOther) :
+    SmallByteVec(static_cast<std::span<const std::uint8_t>>(pOther))
+{
+}
+
+/*!
+ * \brief Move constructor.
+ *
+ * Takes over the heap memory of \p pOther or copies its inline bytes. \p pOther becomes empty.
+ *
+ * \param pOther Other byte sequence.
+ */
+SmallByteVec::SmallByteVec(SmallByteVec&& pOther) noexcept :
+    length(std::exchange(pOther.length, 0)),
+    heapCapacity(std::exchange(pOther.heapCapacity, 0)),
+    inlineBytes(pOther.inlineBytes),
+    heapBytes(std::move(pOther.heapBytes))
+{
+}
+
+//Public
+
+/*!
+ * \brief Copy assignment operator.
+ *
+ * Reuses the current storage if \p pOther fits into it.
+ *
+ * \param pOther Other byte sequence.
+ * \return This byte sequence.
+ */
+SmallByteVec& SmallByteVec::operator=(const SmallByteVec& pOther)
+{
+    if (this != &pOther)
+    {
+        resize(pOther.size());
+        std::copy(pOther.begin(), pOther.end(), data());
+    }
+
+    return *this;
+}
+
+/*!
+ * \brief Move assignment operator.
+ *
+ * Takes over the heap memory of \p pOther or copies its inline bytes. \p pOther becomes empty.
+ *
+ * \param pOther Other byte sequence.
+ * \return This byte sequence.
+ */
+SmallByteVec& SmallByteVec::operator=(SmallByteVec&& pOther) noexcept
+{
+    if (this != &pOther)
+    {
+        length = std::exchange(pOther.length, 0);
+        heapCapacity = std::exchange(pOther.heapCapacity, 0);
+        inlineBytes = pOther.inlineBytes;
+        heapBytes = std::move(pOther.heapBytes);
+    }
+
+    return *this;
+}
+
+//
+
+/*!
+ * \brief Get a pointer to the bytes.
+ *
+ * \return Pointer to the first byte.
+ */
+std::uint8_t* SmallByteVec::data()
+{
+    return (heapBytes ? heapBytes.get() : inlineBytes.data());
+}
+
+/*!
+ * \brief Get a pointer to the bytes.
+ *
+ * \return Pointer to the first byte.
+ */
+const std::uint8_t* SmallByteVec::data() const
+{
+    return (heapBytes ? heapBytes.get() : inlineBytes.data());
+}
+
+/*!
+ * \brief Get the number of bytes.
+ *
+ * \return Size of the byte sequence.
+ */
+std::size_t SmallByteVec::size() const
+{
+    return length;
+}
+
+/*!
+ * \brief Get the maximum size without reallocation.
+ *
+ * \return \ref inlineCapacity if stored inline and the allocated number of bytes else.
+ */
+std::size_t SmallByteVec::capacity() const
+{
+    return (heapBytes ? heapCapacity : inlineCapacity);
+}
+
+/*!
+ * \brief Check if the size is zero.
+ *
+ * \return If size() is zero.
+ */
+bool SmallByteVec::empty() const
+{
+    return length == 0;
+}
+
+/*!
+ * \brief Check if the bytes are stored inline.
+ *
+ * \return True if no heap memory is used.
+ */
+bool SmallByteVec::isInline() const
+{
+    return !heapBytes;
+}
+
+//
+
+/*!
+ * \brief Change the number of bytes.
+ *
+ * Added bytes are set to \p pValue. Moves the bytes to (larger) heap memory if \p pSize exceeds capacity().
+ * Shrinking never releases memory.
+ *
+ * \param pSize New number of bytes.
+ * \param pValue Value of added bytes.
+ */
+void SmallByteVec::resize(const std::size_t pSize, const std::uint8_t pValue)
+{
+    if (pSize > capacity())
+    {
+        const std::size_t newCapacity = std::max(pSize, 2 * capacity());
+
+        std::unique_ptr<std::uint8_t[]> newBytes = std::make_unique_for_overwrite<std::uint8_t[]>(newCapacity);
+        std::copy(begin(), end(), newBytes.get());
+
+        heapBytes = std::move(newBytes);
+        heapCapacity = newCapacity;
+    }
+
+    if (pSize > length)
+        std::fill(data() + length, data() + pSize, pValue);
+
+    length = pSize;
+}
+
+//
+
+/*!
+ * \brief Get an iterator to the first byte.
+ *
+ * \return Pointer to the first byte.
+ */
+std::uint8_t* SmallByteVec::begin()
+{
+    return data();
+}
+
+/*!
+ * \brief Get an iterator to the first byte.
+ *
+ * \return Pointer to the first byte.
+ */
+const std::uint8_t* SmallByteVec::begin() const
+{
+    return data();
+}
+
+/*!
+ * \brief Get an iterator past the last byte.
+ *
+ * \return Pointer past the last byte.
+ */
+std::uint8_t* SmallByteVec::end()
+{
+    return data() + length;
+}
+
+/*!
+ * \brief Get an iterator past the last byte.
+ *
+ * \return Pointer past the last byte.
+ */
+const std::uint8_t* SmallByteVec::end() const
+{
+    return data() + length;
+}
+
+/*!
+ * \brief Access a byte.
+ *
+ * \param pIdx Index of the byte (must be less than size()).
+ * \return Reference to the byte.
+ */
+std::uint8_t& SmallByteVec::operator[](const std::size_t pIdx)
+{
+    return data()[pIdx];
+}
+
+/*!
+ * \brief Access a byte.
+ *
+ * \param pIdx Index of the byte (must be less than size()).
+ * \return Reference to the byte.
+ */
+const std::uint8_t& SmallByteVec::operator[](const std::size_t pIdx) const
+{
+    return data()[pIdx];
+}
+
+//
+
+/*!
+ * \brief Get a view of the bytes.
+ *
+ * \return Span of size() bytes.
+ */
+SmallByteVec::operator std::span<std::uint8_t>()
+{
+    return std::span<std::uint8_t>(data(), length);
+}
+
+/*!
+ * \brief Get a view of the bytes.
+ *
+ * \return Span of size() bytes.
+ */
+SmallByteVec::operator std::span<const std::uint8_t>() const
+{
+    return std::span<const std::uint8_t>(data(), length);
+}
+
+/*!
+ * \brief Copy the bytes to a vector.
+ *
+ * \return Copy of the size() bytes.
+ */
+std::vector<std::uint8_t> SmallByteVec::toVector() const
+{
+    return std::vector<std::uint8_t>(begin(), end());
+}
+
+//
+
+/*!
+ * \brief Check if two byte sequences are equal.
+ *
+ * \param pOther Other byte sequence.
+ * \return True if both have the same size and bytes.
+ */
+bool SmallByteVec::operator==(const SmallByteVec& pOther) const
+{
+    return std::equal(begin(), end(), pOther.begin(), pOther.end());
+}
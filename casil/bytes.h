@@ -26,12 +26,18 @@
 
 #include <boost/dynamic_bitset_fwd.hpp>
 
+#include <array>
 #include <cstdint>
+#include <cstddef>
 #include <format>
+#include <initializer_list>
 #include <iosfwd>
+#include <iterator>
+#include <memory>
 #include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -62,6 +68,20 @@ template<typename... Ts>
     requires (IsUnsignedIntNType<Ts> && ...)
 constexpr std::vector<std::uint8_t> composeByteVec(bool pBigEndian, Ts... pArgs);   ///< \brief Compose a byte sequence with a certain
                                                                                     ///  endianness from a number of unsigned integers.
+template<typename... Ts>
+    requires (IsUnsignedIntNType<Ts> && ...)
+constexpr std::array<std::uint8_t, (sizeof(Ts) + ...)> composeByteArray(bool pBigEndian, Ts... pArgs);
+                                                                                    ///< \brief Compose a fixed size byte array with a certain
+                                                                                    ///  endianness from a number of unsigned integers.
+template<typename OutputIt, typename... Ts>
+    requires (std::output_iterator<OutputIt, std::uint8_t> && (IsUnsignedIntNType<Ts> && ...))
+constexpr OutputIt composeBytesTo(OutputIt pOut, bool pBigEndian, Ts... pArgs);     ///< \brief Write a byte sequence with a certain endianness
+                                                                                    ///  from a number of unsigned integers to an output iterator.
+template<typename... Ts>
+    requires (IsUnsignedIntNType<Ts> && ...)
+constexpr std::size_t composeBytesInto(std::span<std::uint8_t> pBuffer, bool pBigEndian, Ts... pArgs);
+                                                                                    ///< \brief Write a byte sequence with a certain endianness
+                                                                                    ///  from a number of unsigned integers into a buffer.
 
 constexpr std::uint16_t composeUInt16(const std::vector<std::uint8_t>& pBytes, bool pBigEndian = true);
                                                                                     ///< \brief Create a 16 bit unsigned integer from
@@ -84,13 +104,46 @@ constexpr std::uint64_t composeUInt64(std::span<const std::uint8_t, 8> pBytes, b
 
 //
 
+constexpr std::uint64_t extractBitField(std::span<const std::uint8_t> pBytes, std::size_t pBitOffs, std::size_t pBitSize);
+                                                                                    ///< \brief Extract an unsigned integer bit field
+                                                                                    ///  from a big endian byte sequence.
+constexpr void insertBitField(std::span<std::uint8_t> pBytes, std::size_t pBitOffs, std::size_t pBitSize, std::uint64_t pValue);
+                                                                                    ///< \brief Insert an unsigned integer bit field
+                                                                                    ///  into a big endian byte sequence.
+
+//
+
+void decodeUInt32LE(std::span<const std::uint8_t> pBytes, std::span<std::uint32_t> pWords);
+                                                                                    ///< \brief Convert a little endian byte sequence
+                                                                                    ///  to a sequence of 32 bit unsigned integers.
+void decodeUInt32BE(std::span<const std::uint8_t> pBytes, std::span<std::uint32_t> pWords);
+                                                                                    ///< \brief Convert a big endian byte sequence
+                                                                                    ///  to a sequence of 32 bit unsigned integers.
+void encodeUInt32LE(std::span<const std::uint32_t> pWords, std::span<std::uint8_t> pBytes);
+                                                                                    ///< \brief Convert a sequence of 32 bit unsigned integers
+                                                                                    ///  to a little endian byte sequence.
+void encodeUInt32BE(std::span<const std::uint32_t> pWords, std::span<std::uint8_t> pBytes);
+                                                                                    ///< \brief Convert a sequence of 32 bit unsigned integers
+                                                                                    ///  to a big endian byte sequence.
+
+//
+
 boost::dynamic_bitset<> bitsetFromBytes(const std::vector<std::uint8_t>& pBytes, std::size_t pBitSize);
                                                                                     ///< Convert a sequence of bytes to a dynamic bitset.
+void bitsetFromBytesInto(std::span<const std::uint8_t> pBytes, boost::dynamic_bitset<>& pBits, std::size_t pSkipBits = 0);
+                                                                                    ///< Convert a sequence of bytes into an existing dynamic bitset.
 std::vector<std::uint8_t> bytesFromBitset(const boost::dynamic_bitset<>& pBits, std::size_t pByteSize);
                                                                                     ///< Convert a dynamic bitset to a sequence of bytes.
 
 //
 
+std::size_t findMismatch(std::span<const std::uint8_t> pLhs, std::span<const std::uint8_t> pRhs);
+                                                                                    ///< Find the first differing byte of two equally long byte sequences.
+std::string_view simdKernelTarget();                                                ///< \brief Get the instruction set selected at runtime
+                                                                                    ///  for the bulk byte conversion/comparison kernels.
+
+//
+
 std::vector<std::uint8_t> byteVecFromStr(const std::string& pStr);                  ///< Interpret a character string as a sequence of bytes.
 std::string strFromByteVec(const std::vector<std::uint8_t>& pVec);                  ///< Interpret a sequence of bytes as a character string.
 
@@ -124,9 +177,101 @@ std::string formatUInt32Vec(const std::vector<std::uint32_t>& pVec);
 std::string formatUInt64Vec(const std::vector<std::uint64_t>& pVec);                ///< \brief Format a vector of 64 bit unsigned integers
                                                                                     ///  as brace-enclosed sequence of hexadecimal literals.
 
+//
+
+/*!
+ * \brief Byte sequence with inline storage for short payloads.
+ *
+ * Behaves like a minimal \c std::vector<std::uint8_t> but stores up to \ref inlineCapacity bytes inside the object itself,
+ * such that the typical short payloads of register accesses (one to a few bytes) do not need a memory allocation.
+ * Longer sequences fall back to heap memory. Converts implicitly to \c std::span, hence it can be passed directly to
+ * span-based functions such as extractBitField() / insertBitField() or TL::MuxedInterface::readInto() / TL::MuxedInterface::writeFrom().
+ */
+class SmallByteVec
+{
+public:
+    SmallByteVec();                                                         ///< Default constructor.
+    explicit SmallByteVec(std::size_t pSize, std::uint8_t pValue = 0x00u);  ///< Constructor.
+    explicit SmallByteVec(std::span<const std::uint8_t> pBytes);           ///< Constructor.
+    SmallByteVec(std::initializer_list<std::uint8_t> pBytes);               ///< Constructor.
+    SmallByteVec(const SmallByteVec& pOther);                               ///< Copy constructor.
+    SmallByteVec(SmallByteVec&& pOther) noexcept;                           ///< Move constructor.
+    ~SmallByteVec() = default;                                              ///< Default destructor.
+    //
+    SmallByteVec& operator=(const SmallByteVec& pOther);                    ///< Copy assignment operator.
+    SmallByteVec& operator=(SmallByteVec&& pOther) noexcept;                ///< Move assignment operator.
+    //
+    std::uint8_t* data();                                                   ///< Get a pointer to the bytes.
+    const std::uint8_t* data() const;                                       ///< Get a pointer to the bytes.
+    std::size_t size() const;                                               ///< Get the number of bytes.
+    std::size_t capacity() const;                                           ///< Get the maximum size without reallocation.
+    bool empty() const;                                                     ///< Check if the size is zero.
+    bool isInline() const;                                                  ///< Check if the bytes are stored inline.
+    //
+    void resize(std::size_t pSize, std::uint8_t pValue = 0x00u);            ///< Change the number of bytes.
+    //
+    std::uint8_t* begin();                                                  ///< Get an iterator to the first byte.
+    const std::uint8_t* begin() const;                                      ///< Get an iterator to the first byte.
+    std::uint8_t* end();                                                    ///< Get an iterator past the last byte.
+    const std::uint8_t* end() const;                                        ///< Get an iterator past the last byte.
+    std::uint8_t& operator[](std::size_t pIdx);                             ///< Access a byte.
+    const std::uint8_t& operator[](std::size_t pIdx) const;                 ///< Access a byte.
+    //
+    operator std::span<std::uint8_t>();                                     ///< Get a view of the bytes.
+    operator std::span<const std::uint8_t>() const;                         ///< Get a view of the bytes.
+    std::vector<std::uint8_t> toVector() const;                             ///< Copy the bytes to a vector.
+    //
+    bool operator==(const SmallByteVec& pOther) const;                      ///< Check if two byte sequences are equal.
+
+public:
+    static constexpr std::size_t inlineCapacity = 24;                       ///< Maximum number of bytes stored without allocation.
+
+private:
+    std::size_t length;                                                     ///< Number of bytes.
+    std::size_t heapCapacity;                                               ///< Capacity of \ref heapBytes (zero if stored inline).
+    std::array<std::uint8_t, inlineCapacity> inlineBytes;                   ///< Inline storage.
+    std::unique_ptr<std::uint8_t[]> heapBytes;                              ///< Heap storage for more than \ref inlineCapacity bytes.
+};
+
 //Template and constexpr function definitions
 
 
+/// \cond INTERNAL
+/*!
+ * \brief Implementation details for Bytes.
+ */
+namespace BytesImpl
+{
+
+/*!
+ * \brief Write the bytes of an unsigned integer with a certain endianness to an output iterator.
+ *
+ * \tparam T Type of the unsigned integer.
+ * \tparam OutputIt Output iterator type accepting \c std::uint8_t.
+ * \param pBigEndian Write the most significant byte first if true and the least significant byte first else.
+ * \param pValue The unsigned integer to write.
+ * \param pOut Iterator to write the <tt>sizeof(T)</tt> bytes to.
+ * \return Iterator one past the last written byte.
+ */
+template<typename T, typename OutputIt>
+    requires (IsUnsignedIntNType<T> && std::output_iterator<OutputIt, std::uint8_t>)
+constexpr OutputIt writeUIntBytes(const bool pBigEndian, const T pValue, OutputIt pOut)
+{
+    constexpr std::size_t numBytes = sizeof(T);
+
+    for (std::size_t i = 0; i < numBytes; ++i)
+    {
+        const std::size_t shift = 8 * (pBigEndian ? (numBytes - 1 - i) : i);
+        *pOut = static_cast<std::uint8_t>(pValue >> shift);
+        ++pOut;
+    }
+
+    return pOut;
+}
+
+} // namespace BytesImpl
+/// \endcond INTERNAL
+
 /*!
  * \brief Compose a byte sequence with a certain endianness from a number of unsigned integers.
  *
@@ -150,78 +295,82 @@ constexpr std::vector<std::uint8_t> composeByteVec(const bool pBigEndian, Ts...
 
     retVal.reserve((sizeof(Ts) + ...));
 
-    ([pBigEndian, pArgs, &retVal]()
-    {
-        if constexpr (std::is_same_v<Ts, std::uint8_t>)
-        {
-            retVal.push_back(pArgs);
-        }
-        else if constexpr (std::is_same_v<Ts, std::uint16_t>)
-        {
-            if (pBigEndian)
-            {
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0xFF00u) >> 8));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x00FFu)));
-            }
-            else
-            {
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x00FFu)));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0xFF00u) >> 8));
-            }
-        }
-        else if constexpr (std::is_same_v<Ts, std::uint32_t>)
-        {
-            if (pBigEndian)
-            {
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0xFF000000u) >> 24));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x00FF0000u) >> 16));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x0000FF00u) >> 8));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x000000FFu)));
-            }
-            else
-            {
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x000000FFu)));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x0000FF00u) >> 8));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x00FF0000u) >> 16));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0xFF000000u) >> 24));
-            }
-        }
-        else if constexpr (std::is_same_v<Ts, std::uint64_t>)
-        {
-            if (pBigEndian)
-            {
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0xFF00000000000000u) >> 56));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x00FF000000000000u) >> 48));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x0000FF0000000000u) >> 40));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x000000FF00000000u) >> 32));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x00000000FF000000u) >> 24));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x0000000000FF0000u) >> 16));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x000000000000FF00u) >> 8));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x00000000000000FFu)));
-            }
-            else
-            {
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x00000000000000FFu)));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x000000000000FF00u) >> 8));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x0000000000FF0000u) >> 16));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x00000000FF000000u) >> 24));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x000000FF00000000u) >> 32));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x0000FF0000000000u) >> 40));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0x00FF000000000000u) >> 48));
-                retVal.push_back(static_cast<std::uint8_t>((pArgs & 0xFF00000000000000u) >> 56));
-            }
-        }
-        else
-            static_assert(false, "This cannot happen.");
-    }(), ...);
+    composeBytesTo(std::back_inserter(retVal), pBigEndian, pArgs...);
 
     return retVal;
 }
 
-/// \cond INTERNAL
 /*!
- * \brief Implementation details for Bytes.
+ * \brief Compose a fixed size byte array with a certain endianness from a number of unsigned integers.
+ *
+ * Same as composeByteVec() but returns the byte sequence as an array of matching size, without any heap allocation.
+ *
+ * \tparam Ts Types of passed unsigned integers \p pArgs.
+ * \param pBigEndian Use big endian byte order for each number if true and little endian else.
+ * \param pArgs Unsigned integers to add to the returned sequence in the passed order.
+ * \return The composed byte sequence.
+ */
+template<typename... Ts>
+    requires (IsUnsignedIntNType<Ts> && ...)
+constexpr std::array<std::uint8_t, (sizeof(Ts) + ...)> composeByteArray(const bool pBigEndian, Ts... pArgs)
+{
+    std::array<std::uint8_t, (sizeof(Ts) + ...)> retVal {};
+
+    composeBytesTo(retVal.begin(), pBigEndian, pArgs...);
+
+    return retVal;
+}
+
+/*!
+ * \brief Write a byte sequence with a certain endianness from a number of unsigned integers to an output iterator.
+ *
+ * Writes the same byte sequence as returned by composeByteVec() to \p pOut. This can be used to e.g. append
+ * to an existing (pre-reserved) vector via \c std::back_inserter() without creating an intermediate vector.
+ *
+ * \tparam OutputIt Output iterator type accepting \c std::uint8_t.
+ * \tparam Ts Types of passed unsigned integers \p pArgs.
+ * \param pOut Iterator to write the composed byte sequence to.
+ * \param pBigEndian Use big endian byte order for each number if true and little endian else.
+ * \param pArgs Unsigned integers to write in the passed order.
+ * \return Iterator one past the last written byte.
  */
+template<typename OutputIt, typename... Ts>
+    requires (std::output_iterator<OutputIt, std::uint8_t> && (IsUnsignedIntNType<Ts> && ...))
+constexpr OutputIt composeBytesTo(OutputIt pOut, const bool pBigEndian, Ts... pArgs)
+{
+    ((pOut = BytesImpl::writeUIntBytes(pBigEndian, pArgs, std::move(pOut))), ...);
+
+    return pOut;
+}
+
+/*!
+ * \brief Write a byte sequence with a certain endianness from a number of unsigned integers into a buffer.
+ *
+ * Writes the same byte sequence as returned by composeByteVec() to the beginning of \p pBuffer.
+ *
+ * \throws std::invalid_argument If \p pBuffer is too small for the composed byte sequence.
+ *
+ * \tparam Ts Types of passed unsigned integers \p pArgs.
+ * \param pBuffer Buffer to write the composed byte sequence to.
+ * \param pBigEndian Use big endian byte order for each number if true and little endian else.
+ * \param pArgs Unsigned integers to write in the passed order.
+ * \return Number of written bytes.
+ */
+template<typename... Ts>
+    requires (IsUnsignedIntNType<Ts> && ...)
+constexpr std::size_t composeBytesInto(const std::span<std::uint8_t> pBuffer, const bool pBigEndian, Ts... pArgs)
+{
+    constexpr std::size_t numBytes = (sizeof(Ts) + ...);
+
+    if (pBuffer.size() < numBytes)
+        throw std::invalid_argument("Buffer is too small for the composed byte sequence.");
+
+    composeBytesTo(pBuffer.begin(), pBigEndian, pArgs...);
+
+    return numBytes;
+}
+
+/// \cond INTERNAL
 namespace BytesImpl
 {
 
@@ -427,6 +576,134 @@ constexpr std::uint64_t composeUInt64(const std::span<const std::uint8_t, 8> pBy
 
 //
 
+/// \cond INTERNAL
+namespace BytesImpl
+{
+
+/*!
+ * \brief Parameters for accessing a bit field in a big endian byte sequence via a 64 bit word and an optional trailing byte.
+ */
+struct BitFieldLayout
+{
+    std::size_t firstByte;      ///< Index of the first covered byte.
+    std::size_t numBytes;       ///< Number of covered bytes (1 to 9).
+    std::size_t shift;          ///< Number of bits between field LSB and end of last covered byte.
+    std::uint64_t mask;         ///< Mask for the right-aligned field value.
+};
+
+/*!
+ * \brief Determine the access parameters for a bit field (see extractBitField()).
+ *
+ * \throws std::invalid_argument If \p pBitSize is zero or exceeds 64.
+ * \throws std::invalid_argument If the bit field exceeds \p pNumBytes.
+ *
+ * \param pNumBytes Length of the byte sequence.
+ * \param pBitOffs Offset of the field MSB from the MSB of the first byte.
+ * \param pBitSize Field length in bits.
+ * \return Access parameters.
+ */
+constexpr BitFieldLayout bitFieldLayout(const std::size_t pNumBytes, const std::size_t pBitOffs, const std::size_t pBitSize)
+{
+    if (pBitSize == 0 || pBitSize > 64)
+        throw std::invalid_argument("Bit field size must be between 1 and 64.");
+
+    if (pBitOffs + pBitSize > 8 * pNumBytes)
+        throw std::invalid_argument("Bit field exceeds byte sequence.");
+
+    const std::size_t firstByte = pBitOffs / 8;
+    const std::size_t bitOffs = pBitOffs % 8;
+    const std::size_t numBytes = (bitOffs + pBitSize + 7) / 8;
+
+    return BitFieldLayout{firstByte, numBytes, 8 * numBytes - bitOffs - pBitSize,
+                          pBitSize == 64 ? ~std::uint64_t{0} : ((std::uint64_t{1} << pBitSize) - 1)};
+}
+
+} // namespace BytesImpl
+/// \endcond
+
+/*!
+ * \brief Extract an unsigned integer bit field from a big endian byte sequence.
+ *
+ * Interprets \p pBytes as one large big endian number (i.e. the MSB of \p pBytes[0] is its most significant bit) and returns the
+ * \p pBitSize bits starting at bit \p pBitOffs (counted from that most significant bit) as unsigned integer (right-aligned).
+ *
+ * Covered bytes are composed into a single 64 bit word (plus one additional byte for fields spanning nine bytes)
+ * such that the field can be obtained with a single shift and mask instead of any per-bit or per-size processing.
+ *
+ * \throws std::invalid_argument If \p pBitSize is zero or exceeds 64.
+ * \throws std::invalid_argument If the bit field exceeds \p pBytes.
+ *
+ * \param pBytes Byte sequence containing the bit field.
+ * \param pBitOffs Offset of the field's most significant bit from the most significant bit of \p pBytes.
+ * \param pBitSize Field length in bits.
+ * \return Field value.
+ */
+constexpr std::uint64_t extractBitField(const std::span<const std::uint8_t> pBytes, const std::size_t pBitOffs, const std::size_t pBitSize)
+{
+    const BytesImpl::BitFieldLayout layout = BytesImpl::bitFieldLayout(pBytes.size(), pBitOffs, pBitSize);
+
+    const std::size_t wordBytes = layout.numBytes > 8 ? 8 : layout.numBytes;
+
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < wordBytes; ++i)
+        word = (word << 8) | pBytes[layout.firstByte + i];
+
+    if (layout.numBytes <= 8)
+        return (word >> layout.shift) & layout.mask;
+
+    //Field spans nine bytes: shift is below 8 and the word holds the upper (pBitSize + shift - 8) bits
+    const std::uint8_t lastByte = pBytes[layout.firstByte + 8];
+
+    return ((word << (8 - layout.shift)) | (lastByte >> layout.shift)) & layout.mask;
+}
+
+/*!
+ * \brief Insert an unsigned integer bit field into a big endian byte sequence.
+ *
+ * Replaces the bit field described by \p pBitOffs and \p pBitSize (see extractBitField()) in \p pBytes by
+ * the \p pBitSize least significant bits of \p pValue. All other bits of \p pBytes remain unchanged.
+ *
+ * \throws std::invalid_argument If \p pBitSize is zero or exceeds 64.
+ * \throws std::invalid_argument If the bit field exceeds \p pBytes.
+ *
+ * \param pBytes Byte sequence containing the bit field.
+ * \param pBitOffs Offset of the field's most significant bit from the most significant bit of \p pBytes.
+ * \param pBitSize Field length in bits.
+ * \param pValue New field value.
+ */
+constexpr void insertBitField(const std::span<std::uint8_t> pBytes, const std::size_t pBitOffs, const std::size_t pBitSize,
+                              const std::uint64_t pValue)
+{
+    const BytesImpl::BitFieldLayout layout = BytesImpl::bitFieldLayout(pBytes.size(), pBitOffs, pBitSize);
+
+    const std::size_t wordBytes = layout.numBytes > 8 ? 8 : layout.numBytes;
+
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < wordBytes; ++i)
+        word = (word << 8) | pBytes[layout.firstByte + i];
+
+    const std::uint64_t value = pValue & layout.mask;
+
+    if (layout.numBytes <= 8)
+        word = (word & ~(layout.mask << layout.shift)) | (value << layout.shift);
+    else
+    {
+        //Field spans nine bytes: shift is below 8 and the word holds the upper (pBitSize + shift - 8) bits
+        std::uint8_t& lastByte = pBytes[layout.firstByte + 8];
+
+        const std::uint8_t lastMask = static_cast<std::uint8_t>(0xFFu << layout.shift);
+        lastByte = static_cast<std::uint8_t>((lastByte & ~lastMask) | ((value << layout.shift) & lastMask));
+
+        const std::uint64_t wordMask = layout.mask >> (8 - layout.shift);
+        word = (word & ~wordMask) | (value >> (8 - layout.shift));
+    }
+
+    for (std::size_t i = wordBytes; i > 0; --i, word >>= 8)
+        pBytes[layout.firstByte + i - 1] = static_cast<std::uint8_t>(word);
+}
+
+//
+
 /*!
  * \brief Format an unsigned integer as hexadecimal literal.
  *
@@ -25,8 +25,38 @@
 
 #include <casil/layerbase.h>
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 using casil::ContextualLogger;
 
+std::map<std::string, std::unique_ptr<std::atomic<std::uint8_t>>, std::less<>> ContextualLogger::typeLevelOverrides;
+std::mutex ContextualLogger::typeLevelOverridesMutex;
+
+/*!
+ * \brief Per-call-site state of rate-limited messages.
+ *
+ * See ContextualLogger::logRateLimited().
+ */
+struct ContextualLogger::RateLimitState
+{
+    /*!
+     * \brief State of a single call site.
+     */
+    struct CallSite
+    {
+        std::chrono::steady_clock::time_point lastPrinted;  ///< Time when the last message was printed.
+        std::uint64_t suppressedCount;                      ///< Number of suppressed messages since then.
+    };
+    //
+    std::mutex mutex;                                       ///< Mutex for accessing \ref callSites.
+    std::map<std::tuple<std::string_view, std::uint_least32_t, std::uint_least32_t>, CallSite> callSites;
+                                                            ///< Call sites by file name, line and column.
+};
+
+//
+
 /*!
  * \brief Constructor for logging from layer components.
  *
@@ -34,6 +64,8 @@ using casil::ContextualLogger;
  * 'LAYER/TYPE/"NAME": ', with \c LAYER one of \e TL, \e HL or \e RL according to LayerBase::getLayer(),
  * \c TYPE equal to LayerBase::getType() and \c NAME equal to LayerBase::getName(), each taken from \p pComponent.
  *
+ * The log level override for the type of \p pComponent (see setTypeLevelOverride()) applies to the logger.
+ *
  * \note Will \e only call the functions LayerBase::getLayer(), LayerBase::getType() and LayerBase::getName() on \p pComponent.
  *
  * \param pComponent The layer component to provide contextual logging information for.
@@ -44,27 +76,123 @@ ContextualLogger::ContextualLogger(const LayerBase& pComponent) :
                                                                     (pComponent.getLayer() == LayerBase::Layer::HardwareLayer ? "HL" :
                                                                                                                                 "RL")) +
         std::string("/") + pComponent.getType() + "/\"" + pComponent.getName() + "\": "
-        )
+        ),
+    rateLimitState(std::make_unique<RateLimitState>()),
+    levelOverride(noOverride),
+    typeLevelOverride(getTypeLevelOverrideRef(pComponent.getType()))
 {
 }
 
+/*!
+ * \brief Copy constructor.
+ *
+ * Copies the contextual information and log level override of \p pOther but starts
+ * with an empty rate limiting state (see logRateLimited()).
+ *
+ * \param pOther Logger to be copied.
+ */
+ContextualLogger::ContextualLogger(const ContextualLogger& pOther) :
+    contextPrefix(pOther.contextPrefix),
+    rateLimitState(std::make_unique<RateLimitState>()),
+    levelOverride(pOther.levelOverride.load(std::memory_order_relaxed)),
+    typeLevelOverride(pOther.typeLevelOverride)
+{
+}
+
+/*!
+ * \brief Default destructor.
+ */
+ContextualLogger::~ContextualLogger() = default;
+
 //Public
 
+/*!
+ * \brief Override the log level for this logger.
+ *
+ * Messages passed to this logger are filtered by \p pLevel instead of the global log level (see Logger::getLogLevel())
+ * or the type's log level override (see setTypeLevelOverride()). Pass \c std::nullopt to remove the override again.
+ *
+ * Note that levels that are not compiled in (see Logger::isCompiledIn()) are never logged.
+ *
+ * \param pLevel The new log level for this logger or \c std::nullopt.
+ */
+void ContextualLogger::setLevelOverride(const std::optional<LogLevel> pLevel) const
+{
+    levelOverride.store(pLevel.has_value() ? static_cast<std::uint8_t>(*pLevel) : noOverride, std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Get the log level override of this logger.
+ *
+ * See setLevelOverride().
+ *
+ * \return The overriding log level or \c std::nullopt if not overridden.
+ */
+std::optional<casil::Logger::LogLevel> ContextualLogger::getLevelOverride() const
+{
+    const std::uint8_t level = levelOverride.load(std::memory_order_relaxed);
+
+    if (level == noOverride)
+        return std::nullopt;
+
+    return static_cast<LogLevel>(level);
+}
+
+//
+
+/*!
+ * \brief Override the log level for a component type.
+ *
+ * Messages passed to the loggers of all layer components of type \p pType (existing and future ones) are filtered by
+ * \p pLevel instead of the global log level (see Logger::getLogLevel()), unless they have their own override
+ * (see setLevelOverride()). Pass \c std::nullopt to remove the override again.
+ *
+ * \param pType Name of the component type (as registered to the LayerFactory).
+ * \param pLevel The new log level for the component type or \c std::nullopt.
+ */
+void ContextualLogger::setTypeLevelOverride(const std::string& pType, const std::optional<LogLevel> pLevel)
+{
+    getTypeLevelOverrideRef(pType).store(pLevel.has_value() ? static_cast<std::uint8_t>(*pLevel) : noOverride, std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Get the log level override for a component type.
+ *
+ * See setTypeLevelOverride().
+ *
+ * \param pType Name of the component type.
+ * \return The overriding log level or \c std::nullopt if not overridden.
+ */
+std::optional<casil::Logger::LogLevel> ContextualLogger::getTypeLevelOverride(const std::string& pType)
+{
+    const std::uint8_t level = getTypeLevelOverrideRef(pType).load(std::memory_order_relaxed);
+
+    if (level == noOverride)
+        return std::nullopt;
+
+    return static_cast<LogLevel>(level);
+}
+
+//
+
 /*!
  * \brief Print a log message with contextual information.
  *
- * See Logger::log(), except that contextual information from ContextualLogger() is prepended to \p pMessage.
+ * See Logger::log(), except that contextual information from ContextualLogger() is prepended to \p pMessage
+ * and that the message is filtered by the effective log level of this logger (see includeLogLevel()).
+ *
+ * The level is checked first and the contextual information is passed to Logger separately from \p pMessage,
+ * i.e. nothing is concatenated (and nothing allocated in general) for filtered and printed messages.
  *
  * \param pMessage The message to log.
  * \param pLevel The log level of \p pMessage.
  */
-void ContextualLogger::log(const std::string& pMessage, const LogLevel pLevel) const
+void ContextualLogger::log(const std::string_view pMessage, const LogLevel pLevel) const
 {
-    //Use duplicated check as shortcut before concatenating the strings below
-    if (!Logger::includeLogLevel(pLevel))
+    if (!includeLogLevel(pLevel))
         return;
 
-    Logger::log(contextPrefix + pMessage, pLevel);
+    Logger::logMessage(contextPrefix, pMessage, pLevel);
 }
 
 //
@@ -78,7 +206,7 @@ void ContextualLogger::log(const std::string& pMessage, const LogLevel pLevel) c
  *
  * \param pMessage The message to log.
  */
-void ContextualLogger::logCritical(const std::string& pMessage) const
+void ContextualLogger::logCritical(const std::string_view pMessage) const
 {
     log(pMessage, LogLevel::Critical);
 }
@@ -92,7 +220,7 @@ void ContextualLogger::logCritical(const std::string& pMessage) const
  *
  * \param pMessage The message to log.
  */
-void ContextualLogger::logError(const std::string& pMessage) const
+void ContextualLogger::logError(const std::string_view pMessage) const
 {
     log(pMessage, LogLevel::Error);
 }
@@ -106,7 +234,7 @@ void ContextualLogger::logError(const std::string& pMessage) const
  *
  * \param pMessage The message to log.
  */
-void ContextualLogger::logWarning(const std::string& pMessage) const
+void ContextualLogger::logWarning(const std::string_view pMessage) const
 {
     log(pMessage, LogLevel::Warning);
 }
@@ -120,7 +248,7 @@ void ContextualLogger::logWarning(const std::string& pMessage) const
  *
  * \param pMessage The message to log.
  */
-void ContextualLogger::logSuccess(const std::string& pMessage) const
+void ContextualLogger::logSuccess(const std::string_view pMessage) const
 {
     log(pMessage, LogLevel::Success);
 }
@@ -134,7 +262,7 @@ void ContextualLogger::logSuccess(const std::string& pMessage) const
  *
  * \param pMessage The message to log.
  */
-void ContextualLogger::logInfo(const std::string& pMessage) const
+void ContextualLogger::logInfo(const std::string_view pMessage) const
 {
     log(pMessage, LogLevel::Info);
 }
@@ -148,7 +276,7 @@ void ContextualLogger::logInfo(const std::string& pMessage) const
  *
  * \param pMessage The message to log.
  */
-void ContextualLogger::logMore(const std::string& pMessage) const
+void ContextualLogger::logMore(const std::string_view pMessage) const
 {
     log(pMessage, LogLevel::More);
 }
@@ -162,7 +290,7 @@ void ContextualLogger::logMore(const std::string& pMessage) const
  *
  * \param pMessage The message to log.
  */
-void ContextualLogger::logVerbose(const std::string& pMessage) const
+void ContextualLogger::logVerbose(const std::string_view pMessage) const
 {
     log(pMessage, LogLevel::Verbose);
 }
@@ -176,7 +304,7 @@ void ContextualLogger::logVerbose(const std::string& pMessage) const
  *
  * \param pMessage The message to log.
  */
-void ContextualLogger::logDebug(const std::string& pMessage) const
+void ContextualLogger::logDebug(const std::string_view pMessage) const
 {
     log(pMessage, LogLevel::Debug);
 }
@@ -190,7 +318,89 @@ void ContextualLogger::logDebug(const std::string& pMessage) const
  *
  * \param pMessage The message to log.
  */
-void ContextualLogger::logDebugDebug(const std::string& pMessage) const
+void ContextualLogger::logDebugDebug(const std::string_view pMessage) const
 {
     log(pMessage, LogLevel::DebugDebug);
 }
+
+//Private
+
+/*!
+ * \brief Check if a rate-limited message from a call site may be printed now.
+ *
+ * Returns true if no message from call site \p pLocation was printed within the last \ref rateLimitInterval.
+ * In this case the number of messages from this call site that were suppressed since the last printed one
+ * is written to \p pSuppressedCount and the call site's state is reset. Otherwise the suppressed messages
+ * counter is incremented and false is returned.
+ *
+ * \param pLocation Call site of the message.
+ * \param pSuppressedCount Number of suppressed messages since the last printed one (only set if true is returned).
+ * \return If the message shall be printed.
+ */
+bool ContextualLogger::admitRateLimited(const std::source_location& pLocation, std::uint64_t& pSuppressedCount) const
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    const std::lock_guard<std::mutex> rateLimitLock(rateLimitState->mutex);
+    (void)rateLimitLock;
+
+    const auto [it, inserted] = rateLimitState->callSites.try_emplace({pLocation.file_name(), pLocation.line(), pLocation.column()},
+                                                                      RateLimitState::CallSite{now, 0});
+
+    if (inserted)
+    {
+        pSuppressedCount = 0;
+        return true;
+    }
+
+    RateLimitState::CallSite& callSite = it->second;
+
+    if (now - callSite.lastPrinted < rateLimitInterval)
+    {
+        ++callSite.suppressedCount;
+        return false;
+    }
+
+    pSuppressedCount = callSite.suppressedCount;
+
+    callSite.lastPrinted = now;
+    callSite.suppressedCount = 0;
+
+    return true;
+}
+
+/*!
+ * \brief Get the calling thread's buffer for formatting messages.
+ *
+ * The buffer is reused for all formatted messages (see e.g. log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const)
+ * of the calling thread such that its memory only needs to be allocated once.
+ *
+ * \return Reference to the buffer.
+ */
+std::string& ContextualLogger::getFormatBuffer()
+{
+    thread_local std::string formatBuffer;
+    return formatBuffer;
+}
+
+/*!
+ * \brief Get (or create) the shared level override storage for a component type.
+ *
+ * The storage is created (with no override) on first access for \p pType and then lives until the end of the program,
+ * such that loggers can keep a reference to it and check the type's override without locking.
+ *
+ * \param pType Name of the component type.
+ * \return Reference to the level override of \p pType.
+ */
+std::atomic<std::uint8_t>& ContextualLogger::getTypeLevelOverrideRef(const std::string& pType)
+{
+    const std::lock_guard<std::mutex> overridesLock(typeLevelOverridesMutex);
+    (void)overridesLock;
+
+    auto it = typeLevelOverrides.find(pType);
+
+    if (it == typeLevelOverrides.end())
+        it = typeLevelOverrides.emplace(pType, std::make_unique<std::atomic<std::uint8_t>>(noOverride)).first;
+
+    return *it->second;
+}
@@ -26,7 +26,21 @@
 
 #include <casil/logger.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <source_location>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 namespace casil
 {
@@ -38,32 +52,375 @@ class LayerBase;
  *
  * Uses Logger to provide logging identical to Logger (see there) except that
  * contextual information is automatically prepended to the passed log messages.
+ *
+ * Besides passing readily built messages, messages can also be passed as \e std::format format string and arguments,
+ * e.g. <tt>logWarning("Retry {} of {}...", i, n)</tt>, or as a callable returning the message, see logLazy().
+ * In both cases the message is only built if the log level is included (see includeLogLevel()).
+ * The contextual information is never concatenated with the message but passed separately to Logger,
+ * which copies both directly into its output buffer. Formatted messages are built in a per-thread buffer.
+ *
+ * For messages that can be emitted at high rates (e.g. on every retry of a failing transaction)
+ * there is the rate-limited variant logRateLimited(), which suppresses repetitions per call site.
+ *
+ * The log level used to filter the messages can be overridden per logger instance (i.e. per layer component) via
+ * setLevelOverride() and per component type via setTypeLevelOverride(), in this order of precedence over the global
+ * Logger::getLogLevel(). See includeLogLevel(). Checking the level requires no locking in any case.
  */
 class ContextualLogger
 {
 public:
     using LogLevel = Logger::LogLevel;  ///< \copybrief Logger::LogLevel
 
+    /*!
+     * \brief Format string for logRateLimited() that also records its call site.
+     *
+     * Implicitly constructed from the format string passed to logRateLimited(), which
+     * captures the source location of that call as default constructor argument.
+     *
+     * \tparam ArgTs Types of the format arguments.
+     */
+    template<typename... ArgTs>
+    struct LocatedFormatString
+    {
+        /*!
+         * \brief Constructor.
+         *
+         * \tparam T Type of the format string.
+         * \param pFormat The format string.
+         * \param pLocation Call site (defaults to the location of the calling expression).
+         */
+        template<typename T>
+            requires std::is_convertible_v<const T&, std::string_view>
+        consteval LocatedFormatString(const T& pFormat,                                     // cppcheck-suppress noExplicitConstructor
+                                      const std::source_location pLocation = std::source_location::current()) :
+            format(pFormat),
+            location(pLocation)
+        {
+        }
+        //
+        std::format_string<ArgTs...> format;    ///< The format string.
+        std::source_location location;          ///< The call site.
+    };
+
+    static constexpr std::chrono::seconds rateLimitInterval{1};     ///< Minimum time between two messages from the same call site.
+
 public:
     explicit ContextualLogger(const LayerBase& pComponent);                         ///< Constructor for logging from layer components.
-    ~ContextualLogger() = default;                                                  ///< Default destructor.
+    ContextualLogger(const ContextualLogger& pOther);                               ///< Copy constructor.
+    ~ContextualLogger();                                                            ///< Destructor.
+    //
+    ContextualLogger& operator=(ContextualLogger) = delete;                         ///< Deleted copy assignment operator.
+    ContextualLogger& operator=(ContextualLogger&&) = delete;                       ///< Deleted move assignment operator.
+    //
+    /*!
+     * \brief Check whether a message with a certain log level should be logged by this logger.
+     *
+     * Same as Logger::includeLogLevel() but compares \p pLevel to this logger's level override (see setLevelOverride())
+     * or, if not set, the level override for its component type (see setTypeLevelOverride()) or, if not set either,
+     * the global log level (see Logger::getLogLevel()).
+     *
+     * \param pLevel The log level of the message to potentially be logged.
+     * \return True if a message with log level \p pLevel should be logged according to the effective log level.
+     */
+    bool includeLogLevel(const LogLevel pLevel) const
+    {
+        if (pLevel == LogLevel::None || !Logger::isCompiledIn(pLevel))
+            return false;
+
+        std::uint8_t level = levelOverride.load(std::memory_order_relaxed);
+
+        if (level == noOverride)
+            level = typeLevelOverride.load(std::memory_order_relaxed);
+
+        if (level == noOverride)
+            return Logger::includeLogLevel(pLevel);
+
+        return static_cast<std::uint8_t>(pLevel) <= level;
+    }
+    //
+    void setLevelOverride(std::optional<LogLevel> pLevel) const;                    ///< Override the log level for this logger.
+    std::optional<LogLevel> getLevelOverride() const;                               ///< Get the log level override of this logger.
     //
-    void log(const std::string& pMessage, LogLevel pLevel = LogLevel::Info) const;  ///< Print a log message with contextual information.
+    static void setTypeLevelOverride(const std::string& pType, std::optional<LogLevel> pLevel);
+                                                                                    ///< Override the log level for a component type.
+    static std::optional<LogLevel> getTypeLevelOverride(const std::string& pType);  ///< Get the log level override for a component type.
     //
-    void logCritical(const std::string& pMessage) const;    ///< Print a log message with contextual information (LogLevel::Critical).
-    void logError(const std::string& pMessage) const;       ///< Print a log message with contextual information (LogLevel::Error).
-    void logWarning(const std::string& pMessage) const;     ///< Print a log message with contextual information (LogLevel::Warning).
-    void logSuccess(const std::string& pMessage) const;     ///< Print a log message with contextual information (LogLevel::Success).
-    void logInfo(const std::string& pMessage) const;        ///< Print a log message with contextual information (LogLevel::Info).
-    void logMore(const std::string& pMessage) const;        ///< Print a log message with contextual information (LogLevel::More).
-    void logVerbose(const std::string& pMessage) const;     ///< Print a log message with contextual information (LogLevel::Verbose).
-    void logDebug(const std::string& pMessage) const;       ///< Print a log message with contextual information (LogLevel::Debug).
-    void logDebugDebug(const std::string& pMessage) const;  ///< Print a log message with contextual information (LogLevel::DebugDebug).
+    void log(std::string_view pMessage, LogLevel pLevel = LogLevel::Info) const;    ///< Print a log message with contextual information.
+    //
+    void logCritical(std::string_view pMessage) const;      ///< Print a log message with contextual information (LogLevel::Critical).
+    void logError(std::string_view pMessage) const;         ///< Print a log message with contextual information (LogLevel::Error).
+    void logWarning(std::string_view pMessage) const;       ///< Print a log message with contextual information (LogLevel::Warning).
+    void logSuccess(std::string_view pMessage) const;       ///< Print a log message with contextual information (LogLevel::Success).
+    void logInfo(std::string_view pMessage) const;          ///< Print a log message with contextual information (LogLevel::Info).
+    void logMore(std::string_view pMessage) const;          ///< Print a log message with contextual information (LogLevel::More).
+    void logVerbose(std::string_view pMessage) const;       ///< Print a log message with contextual information (LogLevel::Verbose).
+    void logDebug(std::string_view pMessage) const;         ///< Print a log message with contextual information (LogLevel::Debug).
+    void logDebugDebug(std::string_view pMessage) const;    ///< Print a log message with contextual information (LogLevel::DebugDebug).
+    //
+    /*!
+     * \brief Format and print a log message with contextual information.
+     *
+     * Same as log(std::string_view, LogLevel) const with the message being generated via \e std::format from \p pFormat
+     * and \p pArgs, but only if \p pLevel is included by the effective log level (see includeLogLevel()).
+     * The message is formatted into a reused per-thread buffer (see getFormatBuffer()).
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pLevel The log level of the message.
+     * \param pFormat The message's format string.
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void log(const LogLevel pLevel, const std::format_string<ArgTs...> pFormat, ArgTs&&... pArgs) const
+    {
+        if (!includeLogLevel(pLevel))
+            return;
+
+        std::string& message = getFormatBuffer();
+
+        message.clear();
+        std::format_to(std::back_inserter(message), pFormat, std::forward<ArgTs>(pArgs)...);
+
+        Logger::logMessage(contextPrefix, message, pLevel);
+    }
+    /*!
+     * \brief Print a lazily generated log message with contextual information.
+     *
+     * Same as log(std::string_view, LogLevel) const with the message being returned by \p pMessageGenerator,
+     * which is only called if \p pLevel is included by the effective log level (see includeLogLevel()).
+     *
+     * \tparam FuncT Type of the callable generating the message.
+     * \param pLevel The log level of the message.
+     * \param pMessageGenerator Callable that returns the message.
+     */
+    template<typename FuncT>
+        requires std::is_invocable_r_v<std::string, FuncT>
+    void logLazy(const LogLevel pLevel, FuncT&& pMessageGenerator) const
+    {
+        if (!includeLogLevel(pLevel))
+            return;
+
+        Logger::logMessage(contextPrefix, std::invoke(std::forward<FuncT>(pMessageGenerator)), pLevel);
+    }
+    /*!
+     * \brief Format and print a rate-limited log message with contextual information.
+     *
+     * Same as log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const, except that from each call site at most one message
+     * per \ref rateLimitInterval is printed. Further messages from the same call site within this interval are neither formatted
+     * nor printed but counted instead, and their number is appended to the next printed message from that call site as
+     * "(N similar messages suppressed)".
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pLevel The log level of the message.
+     * \param pFormat The message's format string (including the call site).
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void logRateLimited(const LogLevel pLevel, const LocatedFormatString<std::type_identity_t<ArgTs>...> pFormat, ArgTs&&... pArgs) const
+    {
+        if (!includeLogLevel(pLevel))
+            return;
+
+        std::uint64_t suppressedCount = 0;
+
+        if (!admitRateLimited(pFormat.location, suppressedCount))
+            return;
+
+        std::string& message = getFormatBuffer();
+
+        message.clear();
+        std::format_to(std::back_inserter(message), pFormat.format, std::forward<ArgTs>(pArgs)...);
+
+        if (suppressedCount > 0)
+            std::format_to(std::back_inserter(message), " ({} similar messages suppressed)", suppressedCount);
+
+        Logger::logMessage(contextPrefix, message, pLevel);
+    }
+    //
+    /*!
+     * \brief Format and print a log message with contextual information (LogLevel::Critical).
+     *
+     * See log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const.
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pFormat The message's format string.
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void logCritical(const std::format_string<ArgTs...> pFormat, ArgTs&&... pArgs) const
+    {
+        log(LogLevel::Critical, pFormat, std::forward<ArgTs>(pArgs)...);
+    }
+    /*!
+     * \brief Format and print a log message with contextual information (LogLevel::Error).
+     *
+     * See log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const.
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pFormat The message's format string.
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void logError(const std::format_string<ArgTs...> pFormat, ArgTs&&... pArgs) const
+    {
+        log(LogLevel::Error, pFormat, std::forward<ArgTs>(pArgs)...);
+    }
+    /*!
+     * \brief Format and print a log message with contextual information (LogLevel::Warning).
+     *
+     * See log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const.
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pFormat The message's format string.
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void logWarning(const std::format_string<ArgTs...> pFormat, ArgTs&&... pArgs) const
+    {
+        log(LogLevel::Warning, pFormat, std::forward<ArgTs>(pArgs)...);
+    }
+    /*!
+     * \brief Format and print a log message with contextual information (LogLevel::Success).
+     *
+     * See log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const.
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pFormat The message's format string.
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void logSuccess(const std::format_string<ArgTs...> pFormat, ArgTs&&... pArgs) const
+    {
+        log(LogLevel::Success, pFormat, std::forward<ArgTs>(pArgs)...);
+    }
+    /*!
+     * \brief Format and print a log message with contextual information (LogLevel::Info).
+     *
+     * See log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const.
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pFormat The message's format string.
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void logInfo(const std::format_string<ArgTs...> pFormat, ArgTs&&... pArgs) const
+    {
+        log(LogLevel::Info, pFormat, std::forward<ArgTs>(pArgs)...);
+    }
+    /*!
+     * \brief Format and print a log message with contextual information (LogLevel::More).
+     *
+     * See log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const.
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pFormat The message's format string.
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void logMore(const std::format_string<ArgTs...> pFormat, ArgTs&&... pArgs) const
+    {
+        log(LogLevel::More, pFormat, std::forward<ArgTs>(pArgs)...);
+    }
+    /*!
+     * \brief Format and print a log message with contextual information (LogLevel::Verbose).
+     *
+     * See log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const.
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pFormat The message's format string.
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void logVerbose(const std::format_string<ArgTs...> pFormat, ArgTs&&... pArgs) const
+    {
+        log(LogLevel::Verbose, pFormat, std::forward<ArgTs>(pArgs)...);
+    }
+    /*!
+     * \brief Format and print a log message with contextual information (LogLevel::Debug).
+     *
+     * See log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const.
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pFormat The message's format string.
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void logDebug(const std::format_string<ArgTs...> pFormat, ArgTs&&... pArgs) const
+    {
+        log(LogLevel::Debug, pFormat, std::forward<ArgTs>(pArgs)...);
+    }
+    /*!
+     * \brief Format and print a log message with contextual information (LogLevel::DebugDebug).
+     *
+     * See log(LogLevel, std::format_string<ArgTs...>, ArgTs&&...) const.
+     *
+     * \tparam ArgTs Types of the format arguments.
+     * \param pFormat The message's format string.
+     * \param pArgs The format arguments.
+     */
+    template<typename... ArgTs>
+    void logDebugDebug(const std::format_string<ArgTs...> pFormat, ArgTs&&... pArgs) const
+    {
+        log(LogLevel::DebugDebug, pFormat, std::forward<ArgTs>(pArgs)...);
+    }
+
+private:
+    struct RateLimitState;
+
+private:
+    bool admitRateLimited(const std::source_location& pLocation, std::uint64_t& pSuppressedCount) const;
+                                                            ///< Check if a rate-limited message from a call site may be printed now.
+    //
+    static std::string& getFormatBuffer();                  ///< Get the calling thread's buffer for formatting messages.
+    static std::atomic<std::uint8_t>& getTypeLevelOverrideRef(const std::string& pType);
+                                                            ///< Get (or create) the shared level override storage for a component type.
+
+private:
+    static constexpr std::uint8_t noOverride = 0xFF;        ///< Level override value for "not overridden".
 
 private:
     const std::string contextPrefix;                        ///< Prefix for every log message that describes the contextual information.
+    //
+    const std::unique_ptr<RateLimitState> rateLimitState;   ///< Per-call-site state of rate-limited messages.
+    //
+    mutable std::atomic<std::uint8_t> levelOverride;        ///< Log level override of this logger (or \ref noOverride).
+    const std::atomic<std::uint8_t>& typeLevelOverride;     ///< Log level override for the component type (or \ref noOverride).
+    //
+    static std::map<std::string, std::unique_ptr<std::atomic<std::uint8_t>>, std::less<>> typeLevelOverrides;
+                                                            ///< Log level overrides for all component types that were used so far.
+    static std::mutex typeLevelOverridesMutex;              ///< Mutex for accessing \ref typeLevelOverrides.
 };
 
 } // namespace casil
 
+/*!
+ * \brief Print a log message via a ContextualLogger, if its log level is compiled in and included by the logger's effective log level.
+ *
+ * Same as \ref CASIL_LOG, but passes the message to ContextualLogger::log(std::string_view, LogLevel) const of \p LOGGER.
+ *
+ * \param LOGGER The ContextualLogger.
+ * \param LEVEL The log level of the message (must be a constant expression).
+ * \param MESSAGE Expression for the message to log (convertible to \e std::string_view).
+ */
+#define CASIL_CLOG(LOGGER, LEVEL, MESSAGE) \
+    do { \
+        if constexpr (casil::Logger::isCompiledIn(LEVEL)) \
+        { \
+            if ((LOGGER).includeLogLevel(LEVEL)) \
+                (LOGGER).log((MESSAGE), (LEVEL)); \
+        } \
+    } while (false)
+
+/*!
+ * \brief \ref CASIL_CLOG for LogLevel::Verbose.
+ */
+#define CASIL_CLOG_VERBOSE(LOGGER, MESSAGE) CASIL_CLOG(LOGGER, casil::Logger::LogLevel::Verbose, MESSAGE)
+/*!
+ * \brief \ref CASIL_CLOG for LogLevel::Debug.
+ */
+#define CASIL_CLOG_DEBUG(LOGGER, MESSAGE) CASIL_CLOG(LOGGER, casil::Logger::LogLevel::Debug, MESSAGE)
+/*!
+ * \brief \ref CASIL_CLOG for LogLevel::DebugDebug.
+ */
+#define CASIL_CLOG_DEBUGDEBUG(LOGGER, MESSAGE) CASIL_CLOG(LOGGER, casil::Logger::LogLevel::DebugDebug, MESSAGE)
+
 #endif // CASIL_CONTEXTUALLOGGER_H
@@ -24,15 +24,166 @@
 #include <casil/device.h>
 
 #include <casil/auxil.h>
+#include <casil/bytes.h>
 #include <casil/layerconfig.h>
 #include <casil/layerfactory.h>
 #include <casil/logger.h>
+#include <casil/HL/registerdriver.h>
+#include <casil/TL/muxedinterface.h>
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <utility>
 #include <set>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+
+/*
+ * Magic bytes and format version at the start of every runtime snapshot (see Device::dumpRuntimeSnapshot()).
+ */
+constexpr std::array<std::uint8_t, 8> snapshotMagic = {'C', 'A', 'S', 'I', 'L', 'S', 'N', 'P'};
+constexpr std::uint32_t snapshotVersion = 1;
+
+/*
+ * Appends zero bytes to 'pBytes' until its size is a multiple of 8 bytes.
+ */
+void padSnapshot(std::vector<std::uint8_t>& pBytes)
+{
+    pBytes.resize(((pBytes.size() + 7) / 8) * 8, 0);
+}
+
+/*
+ * Assembles the binary runtime snapshot format described in Device::dumpRuntimeSnapshot() from
+ * the component names and component snapshots in 'pSections' (in the given order).
+ */
+std::vector<std::uint8_t> composeSnapshot(const std::vector<std::pair<std::string_view, std::vector<std::uint8_t>>>& pSections)
+{
+    std::size_t tTotalSize = 16;
+    for (const auto& [name, payload] : pSections)
+        tTotalSize += ((4 + name.size() + 7) / 8) * 8 + 8 + ((payload.size() + 7) / 8) * 8;
+
+    std::vector<std::uint8_t> tBytes;
+    tBytes.reserve(tTotalSize);
+
+    tBytes.insert(tBytes.end(), snapshotMagic.begin(), snapshotMagic.end());
+    casil::Bytes::composeBytesTo(std::back_inserter(tBytes), false, snapshotVersion, static_cast<std::uint32_t>(pSections.size()));
+
+    for (const auto& [name, payload] : pSections)
+    {
+        casil::Bytes::composeBytesTo(std::back_inserter(tBytes), false, static_cast<std::uint32_t>(name.size()));
+        tBytes.insert(tBytes.end(), name.begin(), name.end());
+        padSnapshot(tBytes);
+
+        casil::Bytes::composeBytesTo(std::back_inserter(tBytes), false, static_cast<std::uint64_t>(payload.size()));
+        tBytes.insert(tBytes.end(), payload.begin(), payload.end());
+        padSnapshot(tBytes);
+    }
+
+    return tBytes;
+}
+
+/*
+ * Splits a binary runtime snapshot 'pSnapshot' (see Device::dumpRuntimeSnapshot()) into its sections
+ * and returns the component snapshots (referencing 'pSnapshot') with the component names as keys.
+ *
+ * Throws std::runtime_error if the snapshot is malformed (wrong magic bytes, truncated, duplicate
+ * component names) or if the format version is not supported.
+ */
+std::map<std::string, std::span<const std::uint8_t>, std::less<>> parseSnapshot(const std::span<const std::uint8_t> pSnapshot)
+{
+    auto alignedPos = [](const std::size_t pPos) -> std::size_t { return ((pPos + 7) / 8) * 8; };
+
+    if (pSnapshot.size() < 16 || !std::equal(snapshotMagic.begin(), snapshotMagic.end(), pSnapshot.begin()))
+        throw std::runtime_error("Not a runtime snapshot.");
+
+    const std::uint32_t tVersion = casil::Bytes::composeUInt32(pSnapshot.subspan(8).first<4>(), false);
+    const std::uint32_t tNumSections = casil::Bytes::composeUInt32(pSnapshot.subspan(12).first<4>(), false);
+
+    if (tVersion != snapshotVersion)
+        throw std::runtime_error("Unsupported runtime snapshot version " + std::to_string(tVersion) + ".");
+
+    std::map<std::string, std::span<const std::uint8_t>, std::less<>> tSections;
+
+    std::size_t tPos = 16;
+
+    for (std::uint32_t i = 0; i < tNumSections; ++i)
+    {
+        if (pSnapshot.size() - tPos < 4)
+            throw std::runtime_error("Runtime snapshot is truncated.");
+
+        const std::uint32_t tNameLength = casil::Bytes::composeUInt32(pSnapshot.subspan(tPos).first<4>(), false);
+        tPos += 4;
+
+        if (pSnapshot.size() - tPos < tNameLength)
+            throw std::runtime_error("Runtime snapshot is truncated.");
+
+        std::string tName(reinterpret_cast<const char*>(pSnapshot.data() + tPos), tNameLength);
+        tPos = alignedPos(tPos + tNameLength);
+
+        if (tPos > pSnapshot.size() || pSnapshot.size() - tPos < 8)
+            throw std::runtime_error("Runtime snapshot is truncated.");
+
+        const std::uint64_t tPayloadLength = casil::Bytes::composeUInt64(pSnapshot.subspan(tPos).first<8>(), false);
+        tPos += 8;
+
+        if (pSnapshot.size() - tPos < tPayloadLength)
+            throw std::runtime_error("Runtime snapshot is truncated.");
+
+        if (tSections.contains(tName))
+            throw std::runtime_error("Runtime snapshot contains duplicate component \"" + tName + "\".");
+
+        tSections.emplace(std::move(tName), pSnapshot.subspan(tPos, tPayloadLength));
+        tPos = std::min(alignedPos(tPos + tPayloadLength), pSnapshot.size());
+    }
+
+    return tSections;
+}
+
+/*
+ * Merges the property tree 'pSource' into 'pTarget': Children of map nodes are merged recursively by key (adding new keys),
+ * while all other nodes (values and sequences) replace the respective node of 'pTarget' as a whole.
+ */
+void mergePropertyTree(boost::property_tree::ptree& pTarget, const boost::property_tree::ptree& pSource)
+{
+    using boost::property_tree::ptree;
+
+    const bool sourceIsMap = !pSource.empty() && std::none_of(pSource.begin(), pSource.end(),
+                                                              [](const ptree::value_type& pChild) -> bool { return pChild.first.empty(); });
+    const bool targetIsMap = !pTarget.empty() && std::none_of(pTarget.begin(), pTarget.end(),
+                                                              [](const ptree::value_type& pChild) -> bool { return pChild.first.empty(); });
+
+    if (!sourceIsMap || !targetIsMap)
+    {
+        pTarget = pSource;
+        return;
+    }
+
+    for (const auto& [key, child] : pSource)
+    {
+        if (const auto it = pTarget.find(key); it != pTarget.not_found())
+            mergePropertyTree(it->second, child);
+        else
+            pTarget.push_back({key, child});
+    }
+}
+
+} // namespace
 
 using casil::Device;
 
@@ -47,6 +198,17 @@ using casil::RL::Register;
  * Base constructor that should be called from the other constructors.
  */
 Device::Device() :
+    interfaces(),
+    drivers(),
+    registers(),
+    driverInterfaces(),
+    registerDrivers(),
+    interfaceLeases(),
+    componentIndex(),
+    componentConfigs(),
+    lazy(false),
+    pendingComponents(),
+    lazyMutex(std::make_unique<std::mutex>()),
     initialized(false)
 {
 }
@@ -64,135 +226,141 @@ Device::Device() :
  * for \ref casil::Layers::RL "RL") are separately processed and therefore stripped from the individual configurations before
  * they are passed as LayerConfig to the LayerFactory (and eventually to the component constructors).
  *
+ * An interface can be shared with other %Device instances of the same process by setting the (top-level) configuration key
+ * "shared" of the interface to a common share key: Then the interface is obtained from the InterfaceRegistry, which constructs
+ * it only once per key, and all devices using the key access the same interface instance (the configurations must be identical).
+ * init() and close() count the initializations of a shared interface, such that it is only closed when the last device
+ * using it is closed (see InterfaceRegistry::Lease).
+ *
+ * If \p pLazy is set, the components are \e not constructed here. Their configurations are only checked for the mandatory
+ * keys, unique names and valid interface/driver references and then stored. A component will then be constructed on its
+ * first access via operator[](), interface(), driver() or reg() (or any other function that refers to the component
+ * by name, such as runParallel() or loadRuntimeConfiguration()), together with its not yet constructed interface/driver.
+ * If the %Device is initialized at that time, the newly constructed components are immediately initialized as well.
+ * Note that init() and close() only affect components that have already been constructed. This can save a lot of startup
+ * time and memory for large setups of which only a small part is actually used, but it also means that components that
+ * are never accessed are never initialized (e.g. registers will not write their initial values to the hardware).
+ *
  * \throws std::runtime_error If mandatory parts are missing from \p pConfig or construction of a component fails.
  *
  * \param pConfig %Device configuration tree as loaded from a basil YAML configuration file via Auxil::propertyTreeFromYAML().
+ * \param pLazy Defer construction of every component until its first access.
  */
-Device::Device(const boost::property_tree::ptree& pConfig) :
+Device::Device(const boost::property_tree::ptree& pConfig, const bool pLazy) :
     Device()
 {
     using boost::property_tree::ptree;
     using boost::property_tree::ptree_bad_path;
 
+    lazy = pLazy;
+
     try
     {
         const ptree& tlConf = pConfig.get_child("transfer_layer");
         const ptree& hlConf = pConfig.get_child("hw_drivers");
         const ptree& rlConf = pConfig.get_child("registers");
 
-        //Make sure that component names are unique
-        std::set<std::string> componentNames;
+        //Make sure that component names are unique (the stored configurations are also used to check references in lazy mode)
 
-        for (auto [key, intfConf] : tlConf)
+        auto addComponent = [this](std::string pName, const LayerBase::Layer pLayer, std::string pType,
+                                   std::string pParentName, ptree&& pConf) -> void
         {
-            const std::string intfName = intfConf.get_child("name").data();
-            const std::string intfType = intfConf.get_child("type").data();
+            static const std::map<LayerBase::Layer, std::string> layerComponentNames = {{LayerBase::Layer::TransferLayer, "interface"},
+                                                                                        {LayerBase::Layer::HardwareLayer, "driver"},
+                                                                                        {LayerBase::Layer::RegisterLayer, "register"}};
 
-            intfConf.erase("name");
-            intfConf.erase("type");
+            if (componentConfigs.contains(pName))
+                throw std::runtime_error("Cannot create " + layerComponentNames.at(pLayer) + " \"" + pName +
+                                         "\": The name is already used by another component.");
 
-            if (componentNames.contains(intfName))
-                throw std::runtime_error("Cannot create interface \"" + intfName + "\": The name is already used by another component.");
-            else
-                componentNames.insert(intfName);
+            const auto confIt = componentConfigs.emplace(std::move(pName), ComponentConfig{pLayer, std::move(pType), std::move(pParentName),
+                                                                                           std::make_shared<ptree>(std::move(pConf))}).first;
 
-            try
-            {
-                interfaces.emplace(intfName, LayerFactory::createInterface(intfType, intfName, LayerConfig(std::move(intfConf))));
-            }
-            catch (const std::runtime_error& exc)
+            const std::string& name = confIt->first;
+            const ComponentConfig& conf = confIt->second;
+
+            if (lazy)
             {
-                throw std::runtime_error("Could not create interface \"" + intfName + "\": " + exc.what());
-            }
-        }
+                if (pLayer != LayerBase::Layer::TransferLayer)
+                {
+                    const LayerBase::Layer parentLayer = (pLayer == LayerBase::Layer::HardwareLayer) ? LayerBase::Layer::TransferLayer :
+                                                                                                       LayerBase::Layer::HardwareLayer;
 
-        for (auto [key, drvConf] : hlConf)
-        {
-            const std::string drvName = drvConf.get_child("name").data();
-            const std::string drvType = drvConf.get_child("type").data();
-            const std::string intfName = drvConf.get_child("interface").data();
+                    const auto it = componentConfigs.find(conf.parentName);
 
-            drvConf.erase("name");
-            drvConf.erase("type");
-            drvConf.erase("interface");
+                    if (it == componentConfigs.end() || it->second.layer != parentLayer)
+                        throw std::runtime_error("No " + layerComponentNames.at(parentLayer) + " with name \"" + conf.parentName +
+                                                 "\" defined.");
+                }
 
-            if (componentNames.contains(drvName))
-                throw std::runtime_error("Cannot create driver \"" + drvName + "\": The name is already used by another component.");
+                pendingComponents.insert(name);
+            }
             else
-                componentNames.insert(drvName);
+                createComponent(name, conf);
+        };
 
-            const auto it = interfaces.find(intfName);
-
-            if (it == interfaces.end())
-                throw std::runtime_error("No interface with name \"" + intfName + "\" defined.");
-
-            try
-            {
-                Interface& intf = *(it->second);
-                drivers.emplace(drvName, LayerFactory::createDriver(drvType, drvName, intf, LayerConfig(std::move(drvConf))));
-            }
-            catch (const std::runtime_error& exc)
-            {
-                throw std::runtime_error("Could not create driver \"" + drvName + "\": " + exc.what());
-            }
-        }
+        //Copy each component configuration only once, skipping the keys that are not part of the component configuration
 
-        for (auto [key, regConf] : rlConf)
+        auto extractConf = [](const ptree& pCompConf, const std::initializer_list<std::string_view> pSkipKeys) -> ptree
         {
-            const std::string regName = regConf.get_child("name").data();
-            const std::string regType = regConf.get_child("type").data();
-            const std::string drvName = regConf.get_child("hw_driver").data();
+            ptree conf(pCompConf.data());
 
-            regConf.erase("name");
-            regConf.erase("type");
-            regConf.erase("hw_driver");
+            for (const auto& [childKey, child] : pCompConf)
+                if (std::find(pSkipKeys.begin(), pSkipKeys.end(), childKey) == pSkipKeys.end())
+                    conf.push_back({childKey, child});
 
-            if (componentNames.contains(regName))
-                throw std::runtime_error("Cannot create register \"" + regName + "\": The name is already used by another component.");
-            else
-                componentNames.insert(regName);
+            return conf;
+        };
 
-            const auto it = drivers.find(drvName);
+        for (const auto& [key, intfConf] : tlConf)
+        {
+            addComponent(intfConf.get_child("name").data(), LayerBase::Layer::TransferLayer, intfConf.get_child("type").data(), "",
+                         extractConf(intfConf, {"name", "type"}));
+        }
 
-            if (it == drivers.end())
-                throw std::runtime_error("No driver with name \"" + drvName + "\" defined.");
+        for (const auto& [key, drvConf] : hlConf)
+        {
+            addComponent(drvConf.get_child("name").data(), LayerBase::Layer::HardwareLayer, drvConf.get_child("type").data(),
+                         drvConf.get_child("interface").data(), extractConf(drvConf, {"name", "type", "interface"}));
+        }
 
-            try
-            {
-                Driver& drv = *(it->second);
-                registers.emplace(regName, LayerFactory::createRegister(regType, regName, drv, LayerConfig(std::move(regConf))));
-            }
-            catch (const std::runtime_error& exc)
-            {
-                throw std::runtime_error("Could not create register \"" + regName + "\": " + exc.what());
-            }
+        for (const auto& [key, regConf] : rlConf)
+        {
+            addComponent(regConf.get_child("name").data(), LayerBase::Layer::RegisterLayer, regConf.get_child("type").data(),
+                         regConf.get_child("hw_driver").data(), extractConf(regConf, {"name", "type", "hw_driver"}));
         }
     }
     catch (const ptree_bad_path& exc)
     {
         throw std::runtime_error("Missing essential configuration key \"" + exc.path<ptree::path_type>().dump() + "\".");
     }
+
+    buildComponentIndex();
 }
 
 /*!
  * \brief Constructor.
  *
- * Calls Device(const boost::property_tree::ptree&) with the configuration tree loaded from \p pConfig via Auxil::propertyTreeFromYAML().
+ * Calls Device(const boost::property_tree::ptree&, bool) with the configuration tree loaded from \p pConfig via Auxil::propertyTreeFromYAML().
  *
  * \param pConfig YAML document with the device configuration.
+ * \param pLazy Defer construction of every component until its first access.
  */
-Device::Device(const std::string& pConfig) :
-    Device(Auxil::propertyTreeFromYAML(pConfig))
+Device::Device(const std::string& pConfig, const bool pLazy) :
+    Device(Auxil::propertyTreeFromYAML(pConfig), pLazy)
 {
 }
 
 /*!
  * \brief Destructor.
  *
- * Calls close() if still initialized (i.e. init() called but close() not called yet or failed).
+ * Waits for pending asynchronous interface accesses to finish (see TL::Interface::waitAsync())
+ * and calls close() if still initialized (i.e. init() called but close() not called yet or failed).
  */
 Device::~Device()
 {
+    waitAsync();
+
     //Make sure everything was closed before destruction
     if (initialized)
     {
@@ -211,28 +379,22 @@ Device::~Device()
 /*!
  * \brief Access one of the components from any layer.
  *
- * Returns a reference to the first component found with configured instance name \p pName
+ * Returns a reference to the component with configured instance name \p pName
  * (same as component's "name" value from the YAML configuration tree).
- * Searches interfaces first, then drivers, then registers.
+ * Component names are unique across all layers. The lookup uses a flat index
+ * of all components that is built on construction (see buildComponentIndex()).
  *
  * \throws std::invalid_argument If no component with name \p pName was configured.
+ * \throws std::runtime_error If the component needs to be constructed (see Device(const boost::property_tree::ptree&, bool))
+ *                            and construction or initialization fails.
  *
  * \param pName Configured instance name of the requested component.
  * \return The LayerBase component with name \p pName.
  */
 LayerBase& Device::operator[](const std::string_view pName) const
 {
-    const auto intfIt = interfaces.find(pName);
-    if (intfIt != interfaces.end())
-        return *(intfIt->second);
-
-    const auto drvIt = drivers.find(pName);
-    if (drvIt != drivers.end())
-        return *(drvIt->second);
-
-    const auto regIt = registers.find(pName);
-    if (regIt != registers.end())
-        return *(regIt->second);
+    if (const ComponentEntry entry = findComponent(pName); entry.component != nullptr)
+        return *(entry.component);
 
     throw std::invalid_argument("No component with name \"" + std::string(pName) + "\".");
 }
@@ -246,15 +408,16 @@ LayerBase& Device::operator[](const std::string_view pName) const
  * (same as component's "name" value from the YAML configuration tree).
  *
  * \throws std::invalid_argument If no interface with name \p pName was configured.
+ * \throws std::runtime_error If the component needs to be constructed (see Device(const boost::property_tree::ptree&, bool))
+ *                            and construction or initialization fails.
  *
  * \param pName Configured instance name of the requested component.
  * \return The \ref casil::Layers::TL::Interface "TL::Interface" component with name \p pName.
  */
 casil::TL::Interface& Device::interface(const std::string_view pName) const
 {
-    const auto it = interfaces.find(pName);
-    if (it != interfaces.end())
-        return *(it->second);
+    if (const ComponentEntry entry = findComponent(pName); entry.interface != nullptr)
+        return *(entry.interface);
     else
         throw std::invalid_argument("No interface with name \"" + std::string(pName) + "\".");
 }
@@ -266,15 +429,16 @@ casil::TL::Interface& Device::interface(const std::string_view pName) const
  * (same as component's "name" value from the YAML configuration tree).
  *
  * \throws std::invalid_argument If no driver with name \p pName was configured.
+ * \throws std::runtime_error If the component needs to be constructed (see Device(const boost::property_tree::ptree&, bool))
+ *                            and construction or initialization fails.
  *
  * \param pName Configured instance name of the requested component.
  * \return The \ref casil::Layers::HL::Driver "HL::Driver" component with name \p pName.
  */
 casil::HL::Driver& Device::driver(const std::string_view pName) const
 {
-    const auto it = drivers.find(pName);
-    if (it != drivers.end())
-        return *(it->second);
+    if (const ComponentEntry entry = findComponent(pName); entry.driver != nullptr)
+        return *(entry.driver);
     else
         throw std::invalid_argument("No driver with name \"" + std::string(pName) + "\".");
 }
@@ -286,19 +450,39 @@ casil::HL::Driver& Device::driver(const std::string_view pName) const
  * (same as component's "name" value from the YAML configuration tree).
  *
  * \throws std::invalid_argument If no register with name \p pName was configured.
+ * \throws std::runtime_error If the component needs to be constructed (see Device(const boost::property_tree::ptree&, bool))
+ *                            and construction or initialization fails.
  *
  * \param pName Configured instance name of the requested component.
  * \return The \ref casil::Layers::RL::Register "RL::Register" component with name \p pName.
  */
 casil::RL::Register& Device::reg(const std::string_view pName) const
 {
-    const auto it = registers.find(pName);
-    if (it != registers.end())
-        return *(it->second);
+    if (const ComponentEntry entry = findComponent(pName); entry.reg != nullptr)
+        return *(entry.reg);
     else
         throw std::invalid_argument("No register with name \"" + std::string(pName) + "\".");
 }
 
+/*!
+ * \brief Check if a component has already been constructed.
+ *
+ * Always true for existing components unless lazy construction is enabled (see Device(const boost::property_tree::ptree&, bool)).
+ *
+ * \param pName Configured instance name of the component.
+ * \return True if a component with name \p pName exists and has been constructed.
+ */
+bool Device::isConstructed(const std::string_view pName) const
+{
+    if (!lazy)
+        return lookupComponent(pName).component != nullptr;
+
+    const std::lock_guard<std::mutex> lazyLock(*lazyMutex);
+    (void)lazyLock;
+
+    return lookupComponent(pName).component != nullptr;
+}
+
 //
 
 /*!
@@ -307,12 +491,18 @@ casil::RL::Register& Device::reg(const std::string_view pName) const
  * Calls LayerBase::init() for every interface, then for every driver and then for every register.
  * \p pForce is forwarded for every component.
  *
+ * Before the drivers are initialized, the module resets and firmware version reads of all register drivers
+ * are combined into few bus accesses per interface (see HL::RegisterDriver::prepareGroupInit()).
+ *
  * Immediately returns true, instead, if already initialized, unless \p pForce is set.
  *
  * Skips remaining components, resets initialized state and returns false if LayerBase::init() fails for one component.
  *
  * Remembers the initialized state on success for all components. This state can be reset via close().
  *
+ * Note: With lazy construction (see Device(const boost::property_tree::ptree&, bool)) only components that have
+ * already been constructed are initialized here; the others get initialized as soon as they are constructed.
+ *
  * \param pForce Ignore initialized state.
  * \return True if all components were/are successfully initialized.
  */
@@ -324,12 +514,25 @@ bool Device::init(const bool pForce)
     initialized = false;
 
     for (const auto& [key, intf] : interfaces)
-        if (!intf->init(pForce))
+        if (!initComponent(*intf, pForce))
             return false;
 
+    std::vector<std::reference_wrapper<HL::RegisterDriver>> groupInitDrivers;
+
+    for (const auto& [key, drv] : drivers)
+        if (HL::RegisterDriver* const registerDriver = dynamic_cast<HL::RegisterDriver*>(drv.get()))
+            groupInitDrivers.emplace_back(*registerDriver);
+
+    HL::RegisterDriver::prepareGroupInit(groupInitDrivers, pForce);
+
     for (const auto& [key, drv] : drivers)
+    {
         if (!drv->init(pForce))
+        {
+            HL::RegisterDriver::discardGroupInit(groupInitDrivers);
             return false;
+        }
+    }
 
     for (const auto& [key, regter] : registers)
         if (!regter->init(pForce))
@@ -340,10 +543,105 @@ bool Device::init(const bool pForce)
     return true;
 }
 
+/*!
+ * \brief Initialize like init() but initialize independent interfaces (with their drivers and registers) concurrently.
+ *
+ * Groups the components into one branch per interface, consisting of the interface, all drivers using this interface and
+ * all registers using one of these drivers. The branches are independent of each other and are hence initialized concurrently,
+ * each in its own thread, while the components within a branch are initialized in the same order as by init() (first the
+ * interface, then its drivers, then their registers), since a driver requires its interface and a register its driver.
+ * This way initializing e.g. many boards that are connected via separate network connections needs roughly the time of
+ * the slowest board instead of the sum of all connection setups and version checks.
+ *
+ * \p pForce is forwarded for every component. Immediately returns true, instead, if already initialized, unless \p pForce is set.
+ *
+ * If LayerBase::init() fails (or throws) for one component, the remaining components of \e all branches are skipped
+ * (components that are already being initialized are finished first). Then all components that were successfully
+ * initialized are closed again (rolled back) in the same order as by close() (registers, drivers, interfaces),
+ * the initialized state is reset and false is returned.
+ *
+ * Remembers the initialized state on success for all components. This state can be reset via close().
+ *
+ * Note: All components of different branches must be safe to be initialized concurrently (see also runParallel()).
+ *
+ * \param pForce Ignore initialized state.
+ * \return True if all components were/are successfully initialized.
+ */
+bool Device::initParallel(const bool pForce)
+{
+    if (initialized && !pForce)
+        return true;
+
+    initialized = false;
+
+    if (interfaces.empty())
+    {
+        initialized = true;
+        return true;
+    }
+
+    const std::vector<std::vector<LayerBase*>> branches = getComponentBranches();
+
+    std::atomic_bool failed(false);
+
+    auto initBranch = [this, &failed, pForce](const std::vector<LayerBase*>& pComponents) -> void
+    {
+        for (LayerBase* const component : pComponents)
+        {
+            if (failed.load())
+                return;
+
+            try
+            {
+                if (!initComponent(*component, pForce))
+                    failed.store(true);
+            }
+            catch (const std::exception& exc)
+            {
+                Logger::logError("Could not initialize component \"" + component->getName() + "\": " + exc.what());
+                failed.store(true);
+            }
+        }
+    };
+
+    //Run the first branch in the calling thread and the others in additional threads
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(branches.size());
+
+        for (auto it = std::next(branches.begin()); it != branches.end(); ++it)
+            threads.emplace_back(initBranch, std::cref(*it));
+
+        initBranch(branches.front());
+    }   //Joins the threads
+
+    if (failed.load())
+    {
+        //Roll back in close() order; only closes the components that were actually initialized
+
+        for (const auto& [key, regter] : registers)
+            (void)regter->close();
+
+        for (const auto& [key, drv] : drivers)
+            (void)drv->close();
+
+        for (const auto& [key, intf] : interfaces)
+            (void)closeComponent(*intf);
+
+        return false;
+    }
+
+    initialized = true;
+
+    return true;
+}
+
 /*!
  * \brief Close by closing all components of all layers.
  *
- * Calls LayerBase::close() for every register, then for every driver and then for every interface.
+ * Waits for pending asynchronous interface accesses to finish (see TL::Interface::waitAsync()).
+ * Then calls LayerBase::close() for every register, then for every driver and then for every interface.
  * \p pForce is forwarded for every component.
  *
  * Immediately returns true, instead, if already closed (i.e. unset initialized state), unless \p pForce is set.
@@ -360,6 +658,8 @@ bool Device::close(const bool pForce)
     if (!initialized && !pForce)
         return true;
 
+    waitAsync();
+
     for (const auto& [key, regter] : registers)
         if (!regter->close(pForce))
             return false;
@@ -369,7 +669,7 @@ bool Device::close(const bool pForce)
             return false;
 
     for (const auto& [key, intf] : interfaces)
-        if (!intf->close(pForce))
+        if (!closeComponent(*intf, pForce))
             return false;
 
     initialized = false;
@@ -377,6 +677,95 @@ bool Device::close(const bool pForce)
     return true;
 }
 
+/*!
+ * \brief Close like close() but close independent interfaces (with their drivers and registers) concurrently.
+ *
+ * Uses the same branches as initParallel() (one per interface) and closes them concurrently, each in its own thread,
+ * while the components within a branch are closed in the same order as by close() (first the registers, then the drivers,
+ * then the interface). This way closing e.g. many boards that are connected via separate network connections needs roughly
+ * the time of the slowest board instead of the sum of all disconnects.
+ *
+ * Waits for pending asynchronous interface accesses to finish first (see TL::Interface::waitAsync()).
+ * \p pForce is forwarded for every component. Immediately returns true, instead, if already closed, unless \p pForce is set.
+ *
+ * If LayerBase::close() fails (or throws) for one component, the remaining components of \e all branches are skipped
+ * (components that are already being closed are finished first) and false is returned.
+ *
+ * Unsets the initialized state (set by init()) on success for all components.
+ *
+ * Note: All components of different branches must be safe to be closed concurrently (see also runParallel()).
+ *
+ * \param pForce Ignore (not-)initialized state.
+ * \return True if all components were/are successfully closed.
+ */
+bool Device::closeParallel(const bool pForce)
+{
+    if (!initialized && !pForce)
+        return true;
+
+    waitAsync();
+
+    if (interfaces.empty())
+    {
+        initialized = false;
+        return true;
+    }
+
+    const std::vector<std::vector<LayerBase*>> branches = getComponentBranches();
+
+    std::atomic_bool failed(false);
+
+    auto closeBranch = [this, &failed, pForce](const std::vector<LayerBase*>& pComponents) -> void
+    {
+        for (auto it = pComponents.rbegin(); it != pComponents.rend(); ++it)
+        {
+            if (failed.load())
+                return;
+
+            try
+            {
+                if (!closeComponent(**it, pForce))
+                    failed.store(true);
+            }
+            catch (const std::exception& exc)
+            {
+                Logger::logError("Could not close component \"" + (*it)->getName() + "\": " + exc.what());
+                failed.store(true);
+            }
+        }
+    };
+
+    //Run the first branch in the calling thread and the others in additional threads
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(branches.size());
+
+        for (auto it = std::next(branches.begin()); it != branches.end(); ++it)
+            threads.emplace_back(closeBranch, std::cref(*it));
+
+        closeBranch(branches.front());
+    }   //Joins the threads
+
+    if (failed.load())
+        return false;
+
+    initialized = false;
+
+    return true;
+}
+
+/*!
+ * \brief Wait for pending asynchronous accesses of all interfaces.
+ *
+ * Calls TL::Interface::waitAsync() for every interface.
+ */
+void Device::waitAsync() const
+{
+    for (const auto& [key, intf] : interfaces)
+        intf->waitAsync();
+}
+
 //
 
 /*!
@@ -392,32 +781,44 @@ bool Device::close(const bool pForce)
  *
  * Elements in \p pConf that refer to non-existent components will be ignored.
  *
+ * Components referred to by \p pConf that have not been constructed yet (see Device(const boost::property_tree::ptree&, bool))
+ * will be constructed first. Returns false if this fails.
+ *
  * \param pConf Map of runtime configurations (as YAML documents) with the component names as keys.
  * \return If successful.
  */
 bool Device::loadRuntimeConfiguration(const std::map<std::string, std::string>& pConf) const
 {
-    for (const auto& [key, intf] : interfaces)
-        if (pConf.contains(key))
-            if (!intf->loadRuntimeConfiguration(pConf.at(key)))
-                return false;
-
-    for (const auto& [key, drv] : drivers)
-        if (pConf.contains(key))
-            if (!drv->loadRuntimeConfiguration(pConf.at(key)))
-                return false;
+    std::set<std::string, std::less<>> names;
+    for (const auto& it : pConf)
+        names.insert(it.first);
 
-    for (const auto& [key, regter] : registers)
-        if (pConf.contains(key))
-            if (!regter->loadRuntimeConfiguration(pConf.at(key)))
-                return false;
+    return loadComponentRuntimeConfigurations(names, [&pConf](LayerBase& pComponent, const std::string& pName) -> bool
+                                                     {
+                                                         return pComponent.loadRuntimeConfiguration(pConf.at(pName));
+                                                     });
+}
 
-    //Warn about missing components
+/*!
+ * \brief Load additional runtime configuration data/values for the components from configuration trees.
+ *
+ * Works like loadRuntimeConfiguration(const std::map<std::string, std::string>&) but takes the runtime configurations
+ * as already assembled trees (see LayerBase::loadRuntimeConfiguration(boost::property_tree::ptree)), which avoids
+ * generating and parsing YAML documents for configurations that are created programmatically.
+ *
+ * \param pConf Map of runtime configuration trees with the component names as keys.
+ * \return If successful.
+ */
+bool Device::loadRuntimeConfigurationTrees(const std::map<std::string, boost::property_tree::ptree>& pConf) const
+{
+    std::set<std::string, std::less<>> names;
     for (const auto& it : pConf)
-        if (!interfaces.contains(it.first) && !drivers.contains(it.first) && !registers.contains(it.first))
-            Logger::logWarning("Did not load runtime configuration for component \"" + it.first + "\": No such component.");
+        names.insert(it.first);
 
-    return true;
+    return loadComponentRuntimeConfigurations(names, [&pConf](LayerBase& pComponent, const std::string& pName) -> bool
+                                                     {
+                                                         return pComponent.loadRuntimeConfiguration(pConf.at(pName));
+                                                     });
 }
 
 /*!
@@ -465,3 +866,938 @@ std::map<std::string, std::string> Device::dumpRuntimeConfiguration() const
 
     return tConf;
 }
+
+/*!
+ * \brief Load runtime configuration data/values for the components from a binary snapshot.
+ *
+ * Binary counterpart of loadRuntimeConfiguration(). \p pSnapshot must be a snapshot as generated by dumpRuntimeSnapshot().
+ * The component sections of the snapshot are passed to LayerBase::loadRuntimeSnapshot() of the respective components,
+ * in the same order as for loadRuntimeConfiguration() (first every interface, then every driver and then every register).
+ *
+ * Skips remaining components and returns false if loading the snapshot fails for one component.
+ * Nothing is loaded and false is returned if \p pSnapshot is malformed or has an unsupported format version.
+ *
+ * Sections in \p pSnapshot that refer to non-existent components will be ignored.
+ * Components that have not been constructed yet will be constructed first (see loadRuntimeConfiguration()).
+ *
+ * \param pSnapshot Binary runtime configuration snapshot.
+ * \return If successful.
+ */
+bool Device::loadRuntimeSnapshot(const std::span<const std::uint8_t> pSnapshot) const
+{
+    std::map<std::string, std::span<const std::uint8_t>, std::less<>> tSections;
+
+    try
+    {
+        tSections = ::parseSnapshot(pSnapshot);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        Logger::logError(std::string("Could not load runtime snapshot: ") + exc.what());
+        return false;
+    }
+
+    for (const auto& it : tSections)
+        if (!ensureConstructed(it.first))
+            return false;
+
+    for (const auto& [key, intf] : interfaces)
+        if (const auto it = tSections.find(key); it != tSections.end())
+            if (!intf->loadRuntimeSnapshot(it->second))
+                return false;
+
+    for (const auto& [key, drv] : drivers)
+        if (const auto it = tSections.find(key); it != tSections.end())
+            if (!drv->loadRuntimeSnapshot(it->second))
+                return false;
+
+    for (const auto& [key, regter] : registers)
+        if (const auto it = tSections.find(key); it != tSections.end())
+            if (!regter->loadRuntimeSnapshot(it->second))
+                return false;
+
+    //Warn about missing components
+    for (const auto& it : tSections)
+        if (!interfaces.contains(it.first) && !drivers.contains(it.first) && !registers.contains(it.first))
+            Logger::logWarning("Did not load runtime snapshot for component \"" + it.first + "\": No such component.");
+
+    return true;
+}
+
+/*!
+ * \brief Save current runtime configuration data/values of the components as binary snapshot.
+ *
+ * Binary counterpart of dumpRuntimeConfiguration(), which is much faster for large configurations (e.g. many large registers)
+ * since no YAML documents need to be generated. Collects the components' snapshots by calling LayerBase::dumpRuntimeSnapshot()
+ * for every register, then for every driver and then for every interface. Only non-empty snapshots are included.
+ *
+ * The snapshot has the following (versioned) format, with all integers encoded as little-endian:
+ * - Header: 8 bytes magic "CASILSNP", 32 bit format version (currently 1), 32 bit number of sections.
+ * - For every component one section: 32 bit name length, name characters, zero-padding to the next multiple of 8 bytes,
+ *   64 bit payload length, payload (the component snapshot), zero-padding to the next multiple of 8 bytes.
+ *
+ * Hence every length field and every payload starts at an offset that is a multiple of 8 bytes, which allows
+ * to use the snapshot directly from a memory-mapped file. Use loadRuntimeSnapshot() to restore the snapshot.
+ *
+ * \throws std::runtime_error If LayerBase::dumpRuntimeSnapshot() throws \c std::runtime_error for one of the components.
+ *
+ * \return Binary runtime configuration snapshot.
+ */
+std::vector<std::uint8_t> Device::dumpRuntimeSnapshot() const
+{
+    std::vector<std::pair<std::string_view, std::vector<std::uint8_t>>> tSections;
+
+    for (const auto& [key, regter] : registers)
+        if (std::vector<std::uint8_t> tDump = regter->dumpRuntimeSnapshot(); !tDump.empty())
+            tSections.emplace_back(key, std::move(tDump));
+
+    for (const auto& [key, drv] : drivers)
+        if (std::vector<std::uint8_t> tDump = drv->dumpRuntimeSnapshot(); !tDump.empty())
+            tSections.emplace_back(key, std::move(tDump));
+
+    for (const auto& [key, intf] : interfaces)
+        if (std::vector<std::uint8_t> tDump = intf->dumpRuntimeSnapshot(); !tDump.empty())
+            tSections.emplace_back(key, std::move(tDump));
+
+    return ::composeSnapshot(tSections);
+}
+
+//
+
+/*!
+ * \brief Get summaries of the timed operations of all components.
+ *
+ * Collects the operation timings of all registers, drivers and interfaces via LayerBase::getTimings()
+ * (see also Timing). Components without any timed operations are omitted.
+ *
+ * \return Timing summaries by operation name (see Timing::operationToLabel()) with the component names as keys.
+ */
+std::map<std::string, std::map<std::string, casil::Timing::Summary>> Device::getTimings() const
+{
+    std::map<std::string, std::map<std::string, Timing::Summary>> timings;
+
+    auto collect = [&timings](const std::string& pName, const LayerBase& pComponent) -> void
+    {
+        std::map<std::string, Timing::Summary> componentTimings = pComponent.getTimings();
+        if (!componentTimings.empty())
+            timings[pName] = std::move(componentTimings);
+    };
+
+    for (const auto& [key, regter] : registers)
+        collect(key, *regter);
+
+    for (const auto& [key, drv] : drivers)
+        collect(key, *drv);
+
+    for (const auto& [key, intf] : interfaces)
+        collect(key, *intf);
+
+    return timings;
+}
+
+/*!
+ * \brief Estimate the heap memory used by all components.
+ *
+ * Collects the memory usage estimates of all registers, drivers and interfaces via LayerBase::getMemoryUsage().
+ *
+ * \return Estimated numbers of allocated bytes by category with the component names as keys.
+ */
+std::map<std::string, std::map<std::string, std::size_t>> Device::getMemoryReport() const
+{
+    std::map<std::string, std::map<std::string, std::size_t>> report;
+
+    for (const auto& [key, regter] : registers)
+        report[key] = regter->getMemoryUsage();
+
+    for (const auto& [key, drv] : drivers)
+        report[key] = drv->getMemoryUsage();
+
+    for (const auto& [key, intf] : interfaces)
+        report[key] = intf->getMemoryUsage();
+
+    return report;
+}
+
+/*!
+ * \brief Change the configuration of some components and rebuild only those.
+ *
+ * Allows to change the configuration of a few components without destroying the whole %Device, i.e. without closing
+ * (and reconnecting) the unaffected interfaces. \p pConfig has the same structure as the configuration passed to
+ * Device(const boost::property_tree::ptree&, bool) but every section is optional and only needs to list the components
+ * to be changed or added, each identified by its "name":
+ * - For an existing component, all other given values are merged into its stored configuration: Nested maps are merged
+ *   key by key, while values and sequences replace the previous ones (e.g. <tt>{name: reg, init: {value: 5}}</tt> only changes
+ *   "init.value"). "type" and "interface" / "hw_driver" can be changed as well. The component must be listed in its own layer's section.
+ * - A component with a new name is added and needs to specify "type" (and "interface" / "hw_driver") as usual.
+ *
+ * Components whose merged configuration does not differ from the current one are left untouched. Every changed component
+ * is rebuilt together with all components that depend on it (the drivers of a changed interface and the registers of
+ * a changed or rebuilt driver): These components are closed (if the %Device is initialized) and destroyed, and then
+ * constructed again from their (new) configuration and initialized (if the %Device is initialized). With lazy construction
+ * (see Device(const boost::property_tree::ptree&, bool)) the rebuilt components are constructed again on their next access.
+ *
+ * Note: References to rebuilt components become invalid. Their runtime configuration (see loadRuntimeConfiguration())
+ * is lost, i.e. they start over from their configuration.
+ *
+ * Note: Not thread-safe. Do not access the components while reconfiguring.
+ *
+ * \throws std::runtime_error If \p pConfig is invalid (a component without "name", listed twice or in the wrong section,
+ *                            a new component without "type", or a reference to a non-existent interface/driver).
+ *                            Nothing is changed then.
+ * \throws std::runtime_error If construction of a rebuilt component fails. The affected components are then
+ *                            rebuilt from their previous configuration and the configuration change is discarded.
+ *
+ * \param pConfig Partial %Device configuration tree with the changed and added components.
+ * \return False if initialization of a rebuilt component failed (which resets the initialized state, see init()) and true otherwise.
+ */
+bool Device::reconfigure(const boost::property_tree::ptree& pConfig)
+{
+    using boost::property_tree::ptree;
+
+    static const std::array<std::tuple<const char*, LayerBase::Layer, const char*>, 3> sections = {{
+        {"transfer_layer", LayerBase::Layer::TransferLayer, ""},
+        {"hw_drivers", LayerBase::Layer::HardwareLayer, "interface"},
+        {"registers", LayerBase::Layer::RegisterLayer, "hw_driver"}
+    }};
+
+    std::unique_lock<std::mutex> lazyLock(*lazyMutex, std::defer_lock);
+    if (lazy)
+        lazyLock.lock();
+
+    //Assemble the new configurations of all changed/added components first, without touching any component
+
+    std::map<std::string, ComponentConfig, std::less<>> changedConfigs;
+    std::set<std::string, std::less<>> listedNames;
+
+    for (const auto& [sectionName, layer, parentKey] : sections)
+    {
+        const boost::optional<const ptree&> sectionConf = pConfig.get_child_optional(sectionName);
+
+        if (!sectionConf)
+            continue;
+
+        for (const auto& [key, compConf] : *sectionConf)
+        {
+            const boost::optional<std::string> nameOpt = compConf.get_optional<std::string>("name");
+
+            if (!nameOpt || nameOpt->empty())
+                throw std::runtime_error(std::string("Cannot reconfigure component without name in \"") + sectionName + "\".");
+
+            const std::string& name = *nameOpt;
+
+            if (!listedNames.insert(name).second)
+                throw std::runtime_error("Cannot reconfigure component \"" + name + "\": The component is listed more than once.");
+
+            const auto oldIt = componentConfigs.find(name);
+
+            ComponentConfig conf{layer, "", "", std::make_shared<ptree>()};
+
+            if (oldIt != componentConfigs.end())
+            {
+                const ComponentConfig& oldConf = oldIt->second;
+
+                if (oldConf.layer != layer)
+                    throw std::runtime_error("Cannot reconfigure component \"" + name + "\": The component is not listed in \"" +
+                                             sectionName + "\".");
+
+                conf.type = oldConf.type;
+                conf.parentName = oldConf.parentName;
+                *conf.config = *oldConf.config;
+            }
+            else if (!compConf.get_child_optional("type") || (layer != LayerBase::Layer::TransferLayer && !compConf.get_child_optional(parentKey)))
+            {
+                throw std::runtime_error("Cannot add component \"" + name + "\": Missing essential configuration key \"type\"" +
+                                         (layer != LayerBase::Layer::TransferLayer ? std::string(" or \"") + parentKey + "\"." : "."));
+            }
+
+            for (const auto& [childKey, child] : compConf)
+            {
+                if (childKey == "name")
+                    continue;
+                else if (childKey == "type")
+                    conf.type = child.data();
+                else if (layer != LayerBase::Layer::TransferLayer && childKey == parentKey)
+                    conf.parentName = child.data();
+                else if (const auto it = conf.config->find(childKey); it != conf.config->not_found())
+                    ::mergePropertyTree(it->second, child);
+                else
+                    conf.config->push_back({childKey, child});
+            }
+
+            if (oldIt != componentConfigs.end() && conf.type == oldIt->second.type && conf.parentName == oldIt->second.parentName &&
+                *conf.config == *oldIt->second.config)
+            {
+                continue;
+            }
+
+            changedConfigs.emplace(name, std::move(conf));
+        }
+    }
+
+    if (changedConfigs.empty())
+        return true;
+
+    auto currentConfig = [this, &changedConfigs](const std::string_view pName) -> const ComponentConfig*
+    {
+        if (const auto it = changedConfigs.find(pName); it != changedConfigs.end())
+            return &(it->second);
+        else if (const auto it2 = componentConfigs.find(pName); it2 != componentConfigs.end())
+            return &(it2->second);
+        else
+            return nullptr;
+    };
+
+    for (const auto& [name, conf] : changedConfigs)
+    {
+        if (conf.layer == LayerBase::Layer::TransferLayer)
+            continue;
+
+        const bool isDriver = (conf.layer == LayerBase::Layer::HardwareLayer);
+        const ComponentConfig* const parentConf = currentConfig(conf.parentName);
+
+        if (parentConf == nullptr || parentConf->layer != (isDriver ? LayerBase::Layer::TransferLayer : LayerBase::Layer::HardwareLayer))
+            throw std::runtime_error("Cannot reconfigure component \"" + name + "\": No " + (isDriver ? "interface" : "driver") +
+                                     " with name \"" + conf.parentName + "\" defined.");
+    }
+
+    //Rebuild the changed components and all components depending on them (drivers first, since registers may depend on those)
+
+    std::set<std::string, std::less<>> affected;
+
+    for (const auto& [name, conf] : changedConfigs)
+        affected.insert(name);
+
+    for (const LayerBase::Layer layer : {LayerBase::Layer::HardwareLayer, LayerBase::Layer::RegisterLayer})
+        for (const auto& [name, conf] : componentConfigs)
+            if (conf.layer == layer && affected.contains(currentConfig(name)->parentName))
+                affected.insert(name);
+
+    destroyComponents(affected);
+
+    std::map<std::string, ComponentConfig, std::less<>> previousConfigs;
+
+    for (auto& [name, conf] : changedConfigs)
+    {
+        if (const auto it = componentConfigs.find(name); it != componentConfigs.end())
+        {
+            previousConfigs.emplace(name, std::move(it->second));
+            it->second = std::move(conf);
+        }
+        else
+            componentConfigs.emplace(name, std::move(conf));
+    }
+
+    try
+    {
+        return rebuildComponents(affected);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        //Restore the previous state
+
+        destroyComponents(affected);
+
+        for (const auto& [name, conf] : changedConfigs)
+        {
+            if (const auto it = previousConfigs.find(name); it != previousConfigs.end())
+            {
+                componentConfigs.at(name) = std::move(it->second);
+            }
+            else
+            {
+                componentConfigs.erase(name);
+                pendingComponents.erase(name);
+                affected.erase(name);
+            }
+        }
+
+        (void)rebuildComponents(affected);
+
+        throw std::runtime_error(std::string("Could not reconfigure device: ") + exc.what());
+    }
+}
+
+/*!
+ * \brief Change the configuration of some components and rebuild only those.
+ *
+ * Calls reconfigure(const boost::property_tree::ptree&) with the configuration tree loaded from \p pConfig via Auxil::propertyTreeFromYAML().
+ *
+ * \throws std::runtime_error If reconfigure(const boost::property_tree::ptree&) throws \c std::runtime_error.
+ *
+ * \param pConfig YAML document with the partial device configuration.
+ * \return False if initialization of a rebuilt component failed and true otherwise.
+ */
+bool Device::reconfigure(const std::string& pConfig)
+{
+    return reconfigure(Auxil::propertyTreeFromYAML(pConfig));
+}
+
+/*!
+ * \brief Run operations on multiple drivers concurrently (serialized per interface).
+ *
+ * Calls every operation in \p pOperations with the driver named by its key. Operations on drivers that use
+ * \e different interfaces are run concurrently, each group in its own thread, while operations on drivers
+ * sharing the same interface are run sequentially (in key order) in the same thread, since the interfaces
+ * cannot handle concurrent transactions. This way e.g. setting many instruments that are connected via separate
+ * serial ports or network connections needs roughly the time of the slowest instrument instead of the sum of all
+ * query delays and round trip times. Returns when all operations have finished.
+ *
+ * The threads are dedicated threads instead of the IO context threads (see ASIO), since the operations
+ * block on synchronous interface accesses, which in turn rely on the IO context threads.
+ *
+ * Exceptions thrown by the operations do not stop the other operations. They are collected and reported together afterwards.
+ *
+ * \throws std::invalid_argument If no driver is configured for a key of \p pOperations (no operation is run then).
+ * \throws std::runtime_error If one or more operations throw (after all operations have finished).
+ *
+ * \param pOperations Operations to be run with driver names as keys.
+ */
+void Device::runParallel(const std::map<std::string, DriverOperation, std::less<>>& pOperations) const
+{
+    struct Task
+    {
+        const std::string& driverName;
+        Driver& driver;
+        const DriverOperation& operation;
+    };
+
+    std::map<const Interface*, std::vector<Task>> interfaceTasks;
+
+    for (const auto& [drvName, operation] : pOperations)
+    {
+        Driver& drv = driver(drvName);
+        interfaceTasks[driverInterfaces.find(drvName)->second].push_back(Task{drvName, drv, operation});
+    }
+
+    if (interfaceTasks.empty())
+        return;
+
+    std::vector<std::string> errors;
+    std::mutex errorsMutex;
+
+    auto runTasks = [&errors, &errorsMutex](const std::vector<Task>& pTasks) -> void
+    {
+        for (const Task& task : pTasks)
+        {
+            try
+            {
+                task.operation(task.driver);
+            }
+            catch (const std::exception& exc)
+            {
+                const std::lock_guard<std::mutex> errorsLock(errorsMutex);
+                (void)errorsLock;
+
+                errors.push_back("\"" + task.driverName + "\": " + exc.what());
+            }
+        }
+    };
+
+    //Run the first group in the calling thread and the others in additional threads
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(interfaceTasks.size());
+
+        for (auto it = std::next(interfaceTasks.begin()); it != interfaceTasks.end(); ++it)
+            threads.emplace_back(runTasks, std::cref(it->second));
+
+        runTasks(interfaceTasks.begin()->second);
+    }   //Joins the threads
+
+    if (!errors.empty())
+    {
+        std::string errorList;
+
+        for (const std::string& error : errors)
+            errorList += (errorList.empty() ? "" : "; ") + error;
+
+        throw std::runtime_error("Parallel driver operations failed for " + errorList + ".");
+    }
+}
+
+//Private
+
+/*!
+ * \brief Construct a component using the LayerFactory.
+ *
+ * Constructs the component \p pName as configured by \p pComponent and adds it to the respective component map.
+ * The used interface (for a driver) or driver (for a register) must already have been constructed.
+ *
+ * Note: Does not add the component to the flat component index (see buildComponentIndex()).
+ *
+ * \throws std::runtime_error If the used interface/driver does not exist (has not been constructed).
+ * \throws std::runtime_error If the component type is unknown or construction of the component fails.
+ *
+ * \param pName Name of the component.
+ * \param pComponent Configuration of the component.
+ * \return Index entry for the new component.
+ */
+Device::ComponentEntry Device::createComponent(const std::string& pName, const ComponentConfig& pComponent) const
+{
+    switch (pComponent.layer)
+    {
+        case LayerBase::Layer::TransferLayer:
+        {
+            try
+            {
+                const std::string shareKey = pComponent.config->get<std::string>("shared", "");
+
+                std::shared_ptr<Interface> intf;
+                std::unique_ptr<InterfaceRegistry::Lease> lease;
+
+                if (shareKey.empty())
+                    intf = LayerFactory::createInterface(pComponent.type, pName, LayerConfig(pComponent.config));
+                else
+                {
+                    lease = InterfaceRegistry::acquire(shareKey, pComponent.type, pName, pComponent.config);
+                    intf = lease->getInterface();
+                }
+
+                if (!intf)
+                    throw std::runtime_error("Unknown interface type \"" + pComponent.type + "\".");
+
+                const auto it = interfaces.emplace(pName, std::move(intf)).first;
+
+                if (lease)
+                    interfaceLeases.emplace(it->second.get(), std::move(lease));
+
+                return ComponentEntry{it->first, it->second.get(), it->second.get(), nullptr, nullptr};
+            }
+            catch (const std::runtime_error& exc)
+            {
+                throw std::runtime_error("Could not create interface \"" + pName + "\": " + exc.what());
+            }
+        }
+        case LayerBase::Layer::HardwareLayer:
+        {
+            const auto intfIt = interfaces.find(pComponent.parentName);
+
+            if (intfIt == interfaces.end())
+                throw std::runtime_error("No interface with name \"" + pComponent.parentName + "\" defined.");
+
+            try
+            {
+                Interface& intf = *(intfIt->second);
+
+                std::unique_ptr<Driver> drv = LayerFactory::createDriver(pComponent.type, pName, intf, LayerConfig(pComponent.config));
+
+                if (!drv)
+                    throw std::runtime_error("Unknown driver type \"" + pComponent.type + "\".");
+
+                const auto it = drivers.emplace(pName, std::move(drv)).first;
+                driverInterfaces.emplace(pName, &intf);
+                return ComponentEntry{it->first, it->second.get(), nullptr, it->second.get(), nullptr};
+            }
+            catch (const std::runtime_error& exc)
+            {
+                throw std::runtime_error("Could not create driver \"" + pName + "\": " + exc.what());
+            }
+        }
+        case LayerBase::Layer::RegisterLayer:
+        default:
+        {
+            const auto drvIt = drivers.find(pComponent.parentName);
+
+            if (drvIt == drivers.end())
+                throw std::runtime_error("No driver with name \"" + pComponent.parentName + "\" defined.");
+
+            try
+            {
+                Driver& drv = *(drvIt->second);
+
+                std::unique_ptr<Register> regter = LayerFactory::createRegister(pComponent.type, pName, drv, LayerConfig(pComponent.config));
+
+                if (!regter)
+                    throw std::runtime_error("Unknown register type \"" + pComponent.type + "\".");
+
+                const auto it = registers.emplace(pName, std::move(regter)).first;
+                registerDrivers.emplace(pName, &drv);
+                return ComponentEntry{it->first, it->second.get(), nullptr, nullptr, it->second.get()};
+            }
+            catch (const std::runtime_error& exc)
+            {
+                throw std::runtime_error("Could not create register \"" + pName + "\": " + exc.what());
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Fill the flat component index from the component maps.
+ *
+ * Collects all (constructed) interfaces, drivers and registers in a single vector sorted by component name, together
+ * with the typed component pointers, so that lookupComponent() needs only a single binary search over
+ * contiguous memory instead of separate tree lookups in the three component maps.
+ *
+ * Note: Component names are unique across all layers (see Device(const boost::property_tree::ptree&, bool)).
+ */
+void Device::buildComponentIndex()
+{
+    componentIndex.clear();
+    componentIndex.reserve(interfaces.size() + drivers.size() + registers.size());
+
+    for (const auto& [key, intf] : interfaces)
+        componentIndex.push_back(ComponentEntry{key, intf.get(), intf.get(), nullptr, nullptr});
+
+    for (const auto& [key, drv] : drivers)
+        componentIndex.push_back(ComponentEntry{key, drv.get(), nullptr, drv.get(), nullptr});
+
+    for (const auto& [key, regter] : registers)
+        componentIndex.push_back(ComponentEntry{key, regter.get(), nullptr, nullptr, regter.get()});
+
+    std::sort(componentIndex.begin(), componentIndex.end(),
+              [](const ComponentEntry& pLhs, const ComponentEntry& pRhs) -> bool { return pLhs.name < pRhs.name; });
+}
+
+/*!
+ * \brief Look up a constructed component in the flat component index.
+ *
+ * Note: Must be called with \ref lazyMutex locked if lazy construction is enabled.
+ *
+ * \param pName Configured instance name of the requested component.
+ * \return The index entry for the component with name \p pName or an entry with all pointers
+ *         set to \c nullptr if there is no such (constructed) component.
+ */
+Device::ComponentEntry Device::lookupComponent(const std::string_view pName) const
+{
+    const auto it = std::lower_bound(componentIndex.begin(), componentIndex.end(), pName,
+                                     [](const ComponentEntry& pEntry, const std::string_view pKey) -> bool { return pEntry.name < pKey; });
+
+    if (it != componentIndex.end() && it->name == pName)
+        return *it;
+    else
+        return ComponentEntry{};
+}
+
+/*!
+ * \brief Construct a component whose construction was deferred.
+ *
+ * Constructs the pending component \p pName (see Device(const boost::property_tree::ptree&, bool)) after recursively
+ * constructing its interface/driver (if not constructed yet) and adds it to the flat component index.
+ * If the %Device is initialized, the component gets initialized as well (see LayerBase::init()).
+ *
+ * Note: Must be called with \ref lazyMutex locked.
+ *
+ * \throws std::runtime_error If construction of the component (or its interface/driver) fails.
+ * \throws std::runtime_error If initialization of the component (or its interface/driver) fails.
+ *
+ * \param pName Configured instance name of the component.
+ * \return The index entry for the new component or an entry with all pointers
+ *         set to \c nullptr if there is no pending component with name \p pName.
+ */
+Device::ComponentEntry Device::constructPendingComponent(const std::string_view pName) const
+{
+    const auto pendingIt = pendingComponents.find(pName);
+
+    if (pendingIt == pendingComponents.end())
+        return ComponentEntry{};
+
+    const auto confIt = componentConfigs.find(pName);
+
+    const std::string& name = confIt->first;
+    const ComponentConfig& conf = confIt->second;
+
+    if (conf.layer != LayerBase::Layer::TransferLayer && lookupComponent(conf.parentName).component == nullptr)
+        (void)constructPendingComponent(conf.parentName);
+
+    const ComponentEntry entry = createComponent(name, conf);
+
+    componentIndex.insert(std::lower_bound(componentIndex.begin(), componentIndex.end(), entry,
+                                           [](const ComponentEntry& pLhs, const ComponentEntry& pRhs) -> bool
+                                           { return pLhs.name < pRhs.name; }),
+                          entry);
+
+    pendingComponents.erase(pendingIt);
+
+    if (initialized && !initComponent(*entry.component))
+        throw std::runtime_error("Could not initialize lazily constructed component \"" + std::string(entry.name) + "\".");
+
+    return entry;
+}
+
+/*!
+ * \brief Look up a component and construct it first if necessary.
+ *
+ * Looks up the component \p pName in the flat component index (see lookupComponent()) and, if lazy construction
+ * is enabled and the component has not been constructed yet, constructs it (see constructPendingComponent()).
+ *
+ * \throws std::runtime_error If the component needs to be constructed and construction or initialization fails.
+ *
+ * \param pName Configured instance name of the requested component.
+ * \return The index entry for the component with name \p pName or an entry with
+ *         all pointers set to \c nullptr if there is no such component.
+ */
+Device::ComponentEntry Device::findComponent(const std::string_view pName) const
+{
+    if (!lazy)
+        return lookupComponent(pName);
+
+    const std::lock_guard<std::mutex> lazyLock(*lazyMutex);
+    (void)lazyLock;
+
+    if (const ComponentEntry entry = lookupComponent(pName); entry.component != nullptr)
+        return entry;
+
+    return constructPendingComponent(pName);
+}
+
+/*!
+ * \brief Construct a component if necessary, logging failures.
+ *
+ * Calls findComponent() and logs an error if that fails. Does nothing if lazy construction is disabled.
+ *
+ * \param pName Configured instance name of the component.
+ * \return False if construction or initialization of the component failed and true otherwise (also for non-existent components).
+ */
+bool Device::ensureConstructed(const std::string_view pName) const
+{
+    if (!lazy)
+        return true;
+
+    try
+    {
+        (void)findComponent(pName);
+        return true;
+    }
+    catch (const std::runtime_error& exc)
+    {
+        Logger::logError(exc.what());
+        return false;
+    }
+}
+
+//
+
+/*!
+ * \brief Load runtime configurations for some of the components (see loadRuntimeConfiguration() and loadRuntimeConfigurationTrees()).
+ *
+ * Constructs the components \p pNames first if necessary (see ensureConstructed()) and then calls \p pLoad
+ * for each of them in order, first for every interface, then for every driver and then for every register.
+ * Skips remaining components and returns false if construction or \p pLoad fails for one component.
+ * Logs a warning for every name in \p pNames that does not refer to a component.
+ *
+ * \param pNames Component names.
+ * \param pLoad Function that loads the runtime configuration for one component (given with its name).
+ * \return If successful.
+ */
+bool Device::loadComponentRuntimeConfigurations(const std::set<std::string, std::less<>>& pNames,
+                                                const std::function<bool(LayerBase&, const std::string&)>& pLoad) const
+{
+    for (const std::string& name : pNames)
+        if (!ensureConstructed(name))
+            return false;
+
+    for (const auto& [key, intf] : interfaces)
+        if (pNames.contains(key))
+            if (!pLoad(*intf, key))
+                return false;
+
+    for (const auto& [key, drv] : drivers)
+        if (pNames.contains(key))
+            if (!pLoad(*drv, key))
+                return false;
+
+    for (const auto& [key, regter] : registers)
+        if (pNames.contains(key))
+            if (!pLoad(*regter, key))
+                return false;
+
+    //Warn about missing components
+    for (const std::string& name : pNames)
+        if (!interfaces.contains(name) && !drivers.contains(name) && !registers.contains(name))
+            Logger::logWarning("Did not load runtime configuration for component \"" + name + "\": No such component.");
+
+    return true;
+}
+
+/*!
+ * \brief Group the components into one branch per interface (in initialization order).
+ *
+ * Each branch consists of an interface, all (constructed) drivers using this interface and all (constructed)
+ * registers using one of these drivers, in this order (see initParallel() and closeParallel()).
+ *
+ * \return Components of each branch, in the order of the interface names.
+ */
+std::vector<std::vector<LayerBase*>> Device::getComponentBranches() const
+{
+    std::vector<std::vector<LayerBase*>> branches;
+    branches.reserve(interfaces.size());
+
+    std::map<const LayerBase*, std::size_t> branchIndices;
+
+    for (const auto& [intfName, intf] : interfaces)
+    {
+        branchIndices.emplace(intf.get(), branches.size());
+        branches.push_back({intf.get()});
+    }
+
+    for (const auto& [drvName, drv] : drivers)
+    {
+        const std::size_t branchIdx = branchIndices.at(driverInterfaces.find(drvName)->second);
+        branchIndices.emplace(drv.get(), branchIdx);
+        branches[branchIdx].push_back(drv.get());
+    }
+
+    for (const auto& [regName, regter] : registers)
+        branches[branchIndices.at(registerDrivers.find(regName)->second)].push_back(regter.get());
+
+    return branches;
+}
+
+/*!
+ * \brief Initialize a component (via its lease for a shared interface).
+ *
+ * Calls InterfaceRegistry::Lease::init() if \p pComponent is an interface shared with other devices
+ * and LayerBase::init() otherwise.
+ *
+ * \param pComponent The component.
+ * \param pForce Ignore initialized state.
+ * \return If successful.
+ */
+bool Device::initComponent(LayerBase& pComponent, const bool pForce) const
+{
+    if (const auto it = interfaceLeases.find(&pComponent); it != interfaceLeases.end())
+        return it->second->init(pForce);
+
+    return pComponent.init(pForce);
+}
+
+/*!
+ * \brief Close a component (via its lease for a shared interface).
+ *
+ * Calls InterfaceRegistry::Lease::close() if \p pComponent is an interface shared with other devices
+ * and LayerBase::close() otherwise.
+ *
+ * \param pComponent The component.
+ * \param pForce Ignore (not-)initialized state.
+ * \return If successful.
+ */
+bool Device::closeComponent(LayerBase& pComponent, const bool pForce) const
+{
+    if (const auto it = interfaceLeases.find(&pComponent); it != interfaceLeases.end())
+        return it->second->close(pForce);
+
+    return pComponent.close(pForce);
+}
+
+//
+
+/*!
+ * \brief Close and destroy some of the components.
+ *
+ * Waits for pending asynchronous interface accesses to finish (see waitAsync()). Then closes (if the %Device is initialized)
+ * and destroys the constructed components from \p pNames, first the registers, then the drivers and then the interfaces,
+ * and rebuilds the flat component index. The stored configurations are kept. Names of components that have not been
+ * constructed (or do not exist) are ignored.
+ *
+ * Note: Must be called with \ref lazyMutex locked if lazy construction is enabled.
+ *
+ * \param pNames Names of the components to be destroyed.
+ */
+void Device::destroyComponents(const std::set<std::string, std::less<>>& pNames)
+{
+    waitAsync();
+
+    for (const std::string& name : pNames)
+    {
+        if (const auto it = registers.find(name); it != registers.end())
+        {
+            if (initialized)
+                (void)it->second->close();
+
+            registers.erase(it);
+            registerDrivers.erase(name);
+        }
+    }
+
+    for (const std::string& name : pNames)
+    {
+        if (const auto it = drivers.find(name); it != drivers.end())
+        {
+            if (initialized)
+                (void)it->second->close();
+
+            drivers.erase(it);
+            driverInterfaces.erase(name);
+        }
+    }
+
+    for (const std::string& name : pNames)
+    {
+        if (const auto it = interfaces.find(name); it != interfaces.end())
+        {
+            if (initialized)
+                (void)closeComponent(*it->second);
+
+            interfaceLeases.erase(it->second.get());
+            interfaces.erase(it);
+        }
+    }
+
+    buildComponentIndex();
+}
+
+/*!
+ * \brief Construct (or defer) some components from their configurations.
+ *
+ * Constructs the components from \p pNames from their stored configurations (see createComponent()), first the interfaces,
+ * then the drivers and then the registers, and rebuilds the flat component index. If the %Device is initialized,
+ * the new components are initialized afterwards in the same order (see LayerBase::init()).
+ *
+ * With lazy construction (see Device(const boost::property_tree::ptree&, bool)) the components
+ * are only marked as not constructed yet instead.
+ *
+ * Note: Must be called with \ref lazyMutex locked if lazy construction is enabled.
+ *
+ * \throws std::runtime_error If construction of a component fails (components constructed so far are kept).
+ *
+ * \param pNames Names of the components to be constructed (must not be constructed yet).
+ * \return False if initialization of a component failed (which resets the initialized state) and true otherwise.
+ */
+bool Device::rebuildComponents(const std::set<std::string, std::less<>>& pNames)
+{
+    if (lazy)
+    {
+        pendingComponents.insert(pNames.begin(), pNames.end());
+        return true;
+    }
+
+    std::vector<LayerBase*> newComponents;
+    newComponents.reserve(pNames.size());
+
+    try
+    {
+        for (const LayerBase::Layer layer : {LayerBase::Layer::TransferLayer, LayerBase::Layer::HardwareLayer, LayerBase::Layer::RegisterLayer})
+        {
+            for (const std::string& name : pNames)
+            {
+                const ComponentConfig& conf = componentConfigs.at(name);
+
+                if (conf.layer == layer)
+                    newComponents.push_back(createComponent(name, conf).component);
+            }
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        buildComponentIndex();
+        throw;
+    }
+
+    buildComponentIndex();
+
+    if (initialized)
+    {
+        for (LayerBase* const component : newComponents)
+        {
+            if (!initComponent(*component))
+            {
+                initialized = false;
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
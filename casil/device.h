@@ -24,18 +24,26 @@
 #ifndef CASIL_DEVICE_H
 #define CASIL_DEVICE_H
 
+#include <casil/interfaceregistry.h>
 #include <casil/layerbase.h>
+#include <casil/timing.h>
 #include <casil/HL/driver.h>
 #include <casil/RL/register.h>
 #include <casil/TL/interface.h>
 
 #include <boost/property_tree/ptree_fwd.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace casil
 {
@@ -50,12 +58,15 @@ namespace casil
  */
 class Device
 {
+public:
+    typedef std::function<void(HL::Driver&)> DriverOperation;      ///< Operation on a single driver (see runParallel()).
+
 private:
     Device();                                                       ///< Base constructor.
 
 public:
-    explicit Device(const boost::property_tree::ptree& pConfig);    ///< Constructor.
-    explicit Device(const std::string& pConfig);                    ///< Constructor.
+    explicit Device(const boost::property_tree::ptree& pConfig, bool pLazy = false);    ///< Constructor.
+    explicit Device(const std::string& pConfig, bool pLazy = false);                    ///< Constructor.
     Device(const Device&) = delete;                                 ///< Deleted copy constructor.
     Device(Device&&) = default;                                     ///< Default move constructor.
     virtual ~Device();                                              ///< Destructor.
@@ -69,18 +80,107 @@ public:
     HL::Driver& driver(std::string_view pName) const;               ///< Access one of the driver components from the hardware layer.
     RL::Register& reg(std::string_view pName) const;                ///< Access one of the register components from the register layer.
     //
+    bool isConstructed(std::string_view pName) const;               ///< Check if a component has already been constructed.
+    //
     bool init(bool pForce = false);                                 ///< Initialize by initializing all components of all layers.
+    bool initParallel(bool pForce = false);                         ///< \brief Initialize like init() but initialize independent
+                                                                    ///  interfaces (with their drivers and registers) concurrently.
     bool close(bool pForce = false);                                ///< Close by closing all components of all layers.
+    bool closeParallel(bool pForce = false);                        ///< \brief Close like close() but close independent
+                                                                    ///  interfaces (with their drivers and registers) concurrently.
+    //
+    void waitAsync() const;                                         ///< Wait for pending asynchronous accesses of all interfaces.
+    void runParallel(const std::map<std::string, DriverOperation, std::less<>>& pOperations) const;
+                                                                    ///< \brief Run operations on multiple drivers concurrently
+                                                                    ///  (serialized per interface).
     //
     bool loadRuntimeConfiguration(const std::map<std::string, std::string>& pConf) const;
                                                                     ///< Load additional runtime configuration data/values for the components.
+    bool loadRuntimeConfigurationTrees(const std::map<std::string, boost::property_tree::ptree>& pConf) const;
+                                                                    ///< \brief Load additional runtime configuration data/values
+                                                                    ///  for the components from configuration trees.
     std::map<std::string, std::string> dumpRuntimeConfiguration() const;
                                                                     ///< Save current runtime configuration data/values of the components.
+    bool loadRuntimeSnapshot(std::span<const std::uint8_t> pSnapshot) const;
+                                                                    ///< Load runtime configuration data/values for the components from a binary snapshot.
+    std::vector<std::uint8_t> dumpRuntimeSnapshot() const;          ///< Save current runtime configuration data/values of the components as binary snapshot.
+    //
+    std::map<std::string, std::map<std::string, Timing::Summary>> getTimings() const;
+                                                                    ///< Get summaries of the timed operations of all components.
+    std::map<std::string, std::map<std::string, std::size_t>> getMemoryReport() const;
+                                                                    ///< Estimate the heap memory used by all components.
+    //
+    bool reconfigure(const boost::property_tree::ptree& pConfig);   ///< Change the configuration of some components and rebuild only those.
+    bool reconfigure(const std::string& pConfig);                   ///< Change the configuration of some components and rebuild only those.
+
+private:
+    /*!
+     * \brief Entry of the flat component index with precomputed typed component pointers (see findComponent()).
+     */
+    struct ComponentEntry
+    {
+        std::string_view name;              ///< Component name (referring to the key in the respective component map).
+        LayerBase* component;               ///< The component or \c nullptr for an invalid entry.
+        TL::Interface* interface;           ///< The component as interface or \c nullptr if not an interface.
+        HL::Driver* driver;                 ///< The component as driver or \c nullptr if not a driver.
+        RL::Register* reg;                  ///< The component as register or \c nullptr if not a register.
+    };
+    /*!
+     * \brief Stored configuration of a component (for deferred construction and reconfiguration, see
+     *        Device(const boost::property_tree::ptree&, bool) and reconfigure()).
+     */
+    struct ComponentConfig
+    {
+        LayerBase::Layer layer;                                 ///< %Layer of the component.
+        std::string type;                                       ///< Type name of the component.
+        std::string parentName;                                 ///< Name of the used interface (for a driver) or driver (for a register).
+        std::shared_ptr<boost::property_tree::ptree> config;    ///< \brief Component configuration (without "name", "type", etc.;
+                                                                ///  shared with the component's LayerConfig, hence never modified).
+    };
 
 private:
-    std::map<std::string, const std::unique_ptr<TL::Interface>, std::less<>> interfaces;    ///< Map of all interfaces with their names as keys.
-    std::map<std::string, const std::unique_ptr<HL::Driver>, std::less<>> drivers;          ///< Map of all drivers with their names as keys.
-    std::map<std::string, const std::unique_ptr<RL::Register>, std::less<>> registers;      ///< Map of all registers with their names as keys.
+    ComponentEntry createComponent(const std::string& pName, const ComponentConfig& pComponent) const;
+                                                                    ///< Construct a component using the LayerFactory.
+    void buildComponentIndex();                                     ///< Fill the flat component index from the component maps.
+    ComponentEntry lookupComponent(std::string_view pName) const;   ///< Look up a constructed component in the flat component index.
+    ComponentEntry constructPendingComponent(std::string_view pName) const;
+                                                                    ///< Construct a component whose construction was deferred.
+    ComponentEntry findComponent(std::string_view pName) const;     ///< Look up a component and construct it first if necessary.
+    bool ensureConstructed(std::string_view pName) const;           ///< Construct a component if necessary, logging failures.
+    //
+    bool loadComponentRuntimeConfigurations(const std::set<std::string, std::less<>>& pNames,
+                                            const std::function<bool(LayerBase&, const std::string&)>& pLoad) const;
+                                                                    ///< \brief Load runtime configurations for some of the components
+                                                                    ///  (see loadRuntimeConfiguration() and loadRuntimeConfigurationTrees()).
+    //
+    std::vector<std::vector<LayerBase*>> getComponentBranches() const;
+                                                                    ///< \brief Group the components into one branch per interface
+                                                                    ///  (in initialization order).
+    bool initComponent(LayerBase& pComponent, bool pForce = false) const;  ///< Initialize a component (via its lease for a shared interface).
+    bool closeComponent(LayerBase& pComponent, bool pForce = false) const; ///< Close a component (via its lease for a shared interface).
+    //
+    void destroyComponents(const std::set<std::string, std::less<>>& pNames);      ///< Close and destroy some of the components.
+    bool rebuildComponents(const std::set<std::string, std::less<>>& pNames);      ///< Construct (or defer) some components from their configurations.
+
+private:
+    //Note: The following containers are mutable because components may be constructed lazily on (const) access
+    mutable std::map<std::string, const std::shared_ptr<TL::Interface>, std::less<>> interfaces;    ///< Map of all interfaces with their names as keys.
+    mutable std::map<std::string, const std::unique_ptr<HL::Driver>, std::less<>> drivers;          ///< Map of all drivers with their names as keys.
+    mutable std::map<std::string, const std::unique_ptr<RL::Register>, std::less<>> registers;      ///< Map of all registers with their names as keys.
+    mutable std::map<std::string, TL::Interface*, std::less<>> driverInterfaces;        ///< Interfaces used by the drivers with driver names as keys.
+    mutable std::map<std::string, HL::Driver*, std::less<>> registerDrivers;            ///< Drivers used by the registers with register names as keys.
+    mutable std::map<const LayerBase*, const std::unique_ptr<InterfaceRegistry::Lease>> interfaceLeases;
+                                                                                        ///< \brief Leases of the interfaces shared with other
+                                                                                        ///  devices (see InterfaceRegistry).
+    mutable std::vector<ComponentEntry> componentIndex;                                 ///< \brief Constructed components of all layers
+                                                                                        ///  sorted by name for fast name-based access.
+    //
+    std::map<std::string, ComponentConfig, std::less<>> componentConfigs;               ///< Configurations of all components with their names as keys.
+    //
+    bool lazy;                                                                          ///< Defer construction of components until first access.
+    mutable std::set<std::string, std::less<>> pendingComponents;                       ///< Names of the not yet constructed components.
+    std::unique_ptr<std::mutex> lazyMutex;                                              ///< \brief Mutex for lazy construction
+                                                                                        ///  (behind pointer to keep %Device movable).
     //
     bool initialized;                                                                       ///< Initialized and not closed.
 };
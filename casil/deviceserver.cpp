@@ -0,0 +1,411 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/deviceserver.h>
+
+#include <casil/bytes.h>
+#include <casil/device.h>
+#include <casil/logger.h>
+#include <casil/metrics.h>
+#include <casil/TL/muxedinterface.h>
+
+#include <utility>  //Missing include in boost/asio/awaitable.hpp of some Boost versions
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/system/error_code.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <array>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+using casil::DeviceServer;
+
+namespace
+{
+
+using boost::asio::local::stream_protocol;
+
+using RequestHandler = std::function<void(std::span<const std::uint8_t>, std::vector<std::uint8_t>&)>;
+
+/*
+ * Reads length-prefixed requests from a connected client, passes them to 'pHandler' and
+ * sends back the responses assembled by 'pHandler' until the connection is closed.
+ */
+boost::asio::awaitable<void> serveClient(stream_protocol::socket pSocket, const RequestHandler pHandler)
+{
+    std::array<std::uint8_t, 4> lengthBytes {};
+    std::vector<std::uint8_t> request;
+    std::vector<std::uint8_t> response;
+
+    try
+    {
+        for (;;)
+        {
+            co_await boost::asio::async_read(pSocket, boost::asio::buffer(lengthBytes), boost::asio::use_awaitable);
+
+            const std::uint32_t length = casil::Bytes::composeUInt32(std::span<const std::uint8_t, 4>(lengthBytes), false);
+
+            if (length > DeviceServer::maxMessageSize)
+            {
+                casil::Logger::logWarning("Device server closes client connection after too large request.");
+                co_return;
+            }
+
+            request.resize(length);
+
+            co_await boost::asio::async_read(pSocket, boost::asio::buffer(request), boost::asio::use_awaitable);
+
+            pHandler(request, response);
+
+            co_await boost::asio::async_write(pSocket, boost::asio::buffer(response), boost::asio::use_awaitable);
+        }
+    }
+    catch (const boost::system::system_error&)
+    {
+        //Connection closed by the client or failed
+    }
+}
+
+/*
+ * Accepts client connections on 'pAcceptor' and starts serveClient() for every client.
+ */
+boost::asio::awaitable<void> acceptClients(stream_protocol::acceptor pAcceptor, const RequestHandler pHandler,
+                                           const std::function<void()> pOnAccept)
+{
+    const auto executor = co_await boost::asio::this_coro::executor;
+
+    try
+    {
+        for (;;)
+        {
+            stream_protocol::socket socket = co_await pAcceptor.async_accept(boost::asio::use_awaitable);
+
+            pOnAccept();
+
+            boost::asio::co_spawn(executor, serveClient(std::move(socket), pHandler), boost::asio::detached);
+        }
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        casil::Logger::logError(std::string("Device server stopped accepting clients: ") + exc.what());
+    }
+}
+
+} // namespace
+
+/*!
+ * \brief Listening socket, IO context and thread of a running server.
+ *
+ * The listening socket and the client sockets are owned by the coroutines running on \ref ioContext
+ * and get closed when the IO context is destroyed.
+ */
+struct DeviceServer::Server
+{
+    boost::asio::io_context ioContext;  ///< IO context for all sockets of the server.
+    std::thread thread;                 ///< Thread running \ref ioContext.
+};
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Does not start the server yet (see start()).
+ *
+ * \param pDevice The device whose interfaces shall be shared.
+ * \param pSocketPath Path of the socket file to listen on.
+ */
+DeviceServer::DeviceServer(Device& pDevice, std::string pSocketPath) :
+    device(pDevice),
+    socketPath(std::move(pSocketPath)),
+    server(nullptr),
+    statistics{},
+    statisticsMutex()
+{
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops the server if running (see stop()).
+ */
+DeviceServer::~DeviceServer()
+{
+    stop();
+}
+
+//Public
+
+/*!
+ * \brief Get the path of the socket file.
+ *
+ * \return Socket file path.
+ */
+const std::string& DeviceServer::getSocketPath() const
+{
+    return socketPath;
+}
+
+//
+
+/*!
+ * \brief Start listening for clients.
+ *
+ * Creates the socket file (replacing a possibly existing, stale file at this path) and starts the server thread,
+ * which accepts clients and handles their requests (see DeviceServer). Does nothing if the server is already running.
+ *
+ * \return True if the server is running.
+ */
+bool DeviceServer::start()
+{
+    if (isRunning())
+        return true;
+
+    try
+    {
+        std::unique_ptr<Server> tServer = std::make_unique<Server>();
+
+        std::error_code ec;
+        std::filesystem::remove(socketPath, ec);
+
+        stream_protocol::acceptor acceptor(tServer->ioContext, stream_protocol::endpoint(socketPath));
+
+        boost::asio::co_spawn(tServer->ioContext,
+                              acceptClients(std::move(acceptor),
+                                            [this](const std::span<const std::uint8_t> pRequest, std::vector<std::uint8_t>& pResponse) -> void
+                                            {
+                                                handleRequest(pRequest, pResponse);
+                                            },
+                                            [this]() -> void
+                                            {
+                                                const std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+                                                (void)statisticsLock;
+
+                                                ++statistics.clientsAccepted;
+                                            }),
+                              boost::asio::detached);
+
+        tServer->thread = std::thread([&ioContext = tServer->ioContext]() -> void { ioContext.run(); });
+
+        server = std::move(tServer);
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        Logger::logError("Could not start device server on \"" + socketPath + "\": " + exc.what());
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Stop the server and disconnect all clients.
+ *
+ * Waits for a possibly running request to finish, closes all sockets and removes the socket file.
+ * Does nothing if the server is not running.
+ */
+void DeviceServer::stop()
+{
+    if (!isRunning())
+        return;
+
+    server->ioContext.stop();
+    server->thread.join();
+
+    server.reset();
+
+    std::error_code ec;
+    std::filesystem::remove(socketPath, ec);
+}
+
+/*!
+ * \brief Check if the server is running.
+ *
+ * \return True if started and not stopped.
+ */
+bool DeviceServer::isRunning() const
+{
+    return server != nullptr;
+}
+
+//
+
+/*!
+ * \brief Get the current server counters.
+ *
+ * \return Current statistics.
+ */
+DeviceServer::Statistics DeviceServer::getStatistics() const
+{
+    const std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+    (void)statisticsLock;
+
+    return statistics;
+}
+
+//Private
+
+/*!
+ * \brief Perform a single request and assemble the response.
+ *
+ * Decodes \p pRequest (see DeviceServer for the protocol), performs the requested operation on the
+ * named interface of the device (or exposes the metrics of this process) and writes the complete response
+ * message (including the length prefix) to \p pResponse. Errors (such as a malformed request, an unknown or
+ * non-muxed interface or an exception thrown by the interface) are reported to the client with the error
+ * message instead of the result.
+ *
+ * \param pRequest Request payload.
+ * \param pResponse Buffer for the response message.
+ */
+void DeviceServer::handleRequest(const std::span<const std::uint8_t> pRequest, std::vector<std::uint8_t>& pResponse)
+{
+    //Length prefix (filled in at the end) and status byte
+    pResponse.assign(5, 0);
+
+    bool success = true;
+
+    try
+    {
+        std::span<const std::uint8_t> args = pRequest;
+
+        auto takeBytes = [&args](const std::size_t pSize) -> std::span<const std::uint8_t>
+        {
+            if (args.size() < pSize)
+                throw std::invalid_argument("Malformed request.");
+
+            const std::span<const std::uint8_t> tBytes = args.first(pSize);
+            args = args.subspan(pSize);
+            return tBytes;
+        };
+
+        auto takeUInt64 = [&takeBytes]() -> std::uint64_t
+        {
+            return Bytes::composeUInt64(takeBytes(8).first<8>(), false);
+        };
+
+        auto takeInt32 = [&takeBytes]() -> int
+        {
+            return static_cast<std::int32_t>(Bytes::composeUInt32(takeBytes(4).first<4>(), false));
+        };
+
+        const Opcode opcode = static_cast<Opcode>(takeBytes(1)[0]);
+
+        const std::span<const std::uint8_t> nameBytes = takeBytes(Bytes::composeUInt16(takeBytes(2).first<2>(), false));
+        const std::string_view intfName(reinterpret_cast<const char*>(nameBytes.data()), nameBytes.size());
+
+        //Metrics requests do not refer to an interface
+        TL::MuxedInterface* intf = nullptr;
+
+        if (opcode != Opcode::Metrics)
+        {
+            intf = dynamic_cast<TL::MuxedInterface*>(&device.interface(intfName));
+
+            if (intf == nullptr)
+                throw std::invalid_argument("Interface \"" + std::string(intfName) + "\" is not a muxed interface.");
+        }
+
+        switch (opcode)
+        {
+            case Opcode::Read:
+            {
+                const std::uint64_t addr = takeUInt64();
+                const int size = takeInt32();
+
+                const std::vector<std::uint8_t> data = intf->read(addr, size);
+                pResponse.insert(pResponse.end(), data.begin(), data.end());
+                break;
+            }
+            case Opcode::Write:
+            {
+                const std::uint64_t addr = takeUInt64();
+
+                intf->write(addr, std::vector<std::uint8_t>(args.begin(), args.end()));
+                break;
+            }
+            case Opcode::Query:
+            {
+                const std::uint64_t writeAddr = takeUInt64();
+                const std::uint64_t readAddr = takeUInt64();
+                const int size = takeInt32();
+
+                const std::vector<std::uint8_t> data = intf->query(writeAddr, readAddr, std::vector<std::uint8_t>(args.begin(), args.end()), size);
+                pResponse.insert(pResponse.end(), data.begin(), data.end());
+                break;
+            }
+            case Opcode::ReadBufferEmpty:
+            {
+                pResponse.push_back(intf->readBufferEmpty() ? 1 : 0);
+                break;
+            }
+            case Opcode::ClearReadBuffer:
+            {
+                intf->clearReadBuffer();
+                break;
+            }
+            case Opcode::Metrics:
+            {
+                const std::string text = Metrics::expose();
+                pResponse.insert(pResponse.end(), text.begin(), text.end());
+                break;
+            }
+            default:
+            {
+                throw std::invalid_argument("Unknown request opcode.");
+            }
+        }
+    }
+    catch (const std::exception& exc)
+    {
+        success = false;
+
+        const std::string_view message(exc.what());
+
+        pResponse.resize(4);
+        pResponse.push_back(1);
+        pResponse.insert(pResponse.end(), message.begin(), message.end());
+    }
+
+    (void)Bytes::composeBytesInto(std::span<std::uint8_t>(pResponse).first(4), false, static_cast<std::uint32_t>(pResponse.size() - 4));
+
+    const std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+    (void)statisticsLock;
+
+    if (success)
+        ++statistics.requestsServed;
+    else
+        ++statistics.requestsFailed;
+}
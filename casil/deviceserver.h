@@ -0,0 +1,134 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_DEVICESERVER_H
+#define CASIL_DEVICESERVER_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+class Device;
+
+/*!
+ * \brief Shares the interfaces of one Device with other processes via a local (Unix domain) socket.
+ *
+ * Only one process can own e.g. a \ref casil::TL::SiTCP "SiTCP" board and constructing/initializing a large Device
+ * takes time. The device server allows a long-running process to own the Device while other processes (such as
+ * scans or monitoring) access its \ref casil::TL::MuxedInterface "TL::MuxedInterface" components through the
+ * \ref casil::TL::Remote "Remote" interface, on top of which they can build their own drivers and registers as usual.
+ *
+ * The server listens on a socket file (see DeviceServer()) and handles the requests of all connected clients from
+ * a single thread, in the order of arrival, i.e. all accesses to the shared interfaces are serialized.
+ *
+ * Messages in both directions consist of a 32 bit payload length followed by the payload (all integers little-endian).
+ * A request payload consists of the \ref Opcode "opcode" (8 bit), the interface name (16 bit length followed by the
+ * characters) and the opcode-specific arguments:
+ * - \ref Opcode::Read "Read": 64 bit address, 32 bit signed size.
+ * - \ref Opcode::Write "Write": 64 bit address, data bytes (rest of the payload).
+ * - \ref Opcode::Query "Query": 64 bit write address, 64 bit read address, 32 bit signed size, data bytes (rest of the payload).
+ * - \ref Opcode::ReadBufferEmpty "ReadBufferEmpty", \ref Opcode::ClearReadBuffer "ClearReadBuffer": No arguments.
+ * - \ref Opcode::Metrics "Metrics": No arguments (the interface name is ignored).
+ *
+ * A response payload consists of a status byte (zero on success) followed by the returned bytes (for
+ * \ref Opcode::ReadBufferEmpty "ReadBufferEmpty" a single byte with value zero or one, for \ref Opcode::Metrics "Metrics"
+ * the exposition text) or, on failure, the error message.
+ *
+ * FIFO data is not passed through the server: A served \ref casil::TL::SiTCP "SiTCP" interface can publish its FIFO data
+ * to a shared-memory ring (see "init.fifo_shm_name" in \ref casil::TL::SiTCP::SiTCP() "SiTCP::SiTCP()"), from which
+ * the \ref casil::TL::Remote "Remote" clients (with the same "init.fifo_shm_name" setting) read it directly.
+ *
+ * Note: The Device must outlive the server (or at least the server must be stopped before destroying the Device).
+ * The control functions (start(), stop()) are not thread-safe and must not be called concurrently.
+ */
+class DeviceServer
+{
+public:
+    /*!
+     * \brief Request type identifiers of the server protocol.
+     */
+    enum class Opcode : std::uint8_t
+    {
+        Read = 1,               ///< Call \ref casil::TL::MuxedInterface::read() "TL::MuxedInterface::read()".
+        Write = 2,              ///< Call \ref casil::TL::MuxedInterface::write() "TL::MuxedInterface::write()".
+        Query = 3,              ///< Call \ref casil::TL::MuxedInterface::query() "TL::MuxedInterface::query()".
+        ReadBufferEmpty = 4,    ///< Call \ref casil::TL::Interface::readBufferEmpty() "TL::Interface::readBufferEmpty()".
+        ClearReadBuffer = 5,    ///< Call \ref casil::TL::Interface::clearReadBuffer() "TL::Interface::clearReadBuffer()".
+        Metrics = 6             ///< Call Metrics::expose() (for monitoring the server process, see e.g. \c CasilTop).
+    };
+
+    /*!
+     * \brief Snapshot of the server counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t clientsAccepted;  ///< Number of accepted client connections.
+        std::uint64_t requestsServed;   ///< Number of successfully handled requests.
+        std::uint64_t requestsFailed;   ///< Number of requests that returned an error.
+    };
+
+public:
+    DeviceServer(Device& pDevice, std::string pSocketPath);         ///< Constructor.
+    DeviceServer(const DeviceServer&) = delete;                     ///< Deleted copy constructor.
+    DeviceServer(DeviceServer&&) = delete;                          ///< Deleted move constructor.
+    ~DeviceServer();                                                ///< Destructor.
+    //
+    DeviceServer& operator=(const DeviceServer&) = delete;          ///< Deleted copy assignment operator.
+    DeviceServer& operator=(DeviceServer&&) = delete;               ///< Deleted move assignment operator.
+    //
+    const std::string& getSocketPath() const;                       ///< Get the path of the socket file.
+    //
+    bool start();                                                   ///< Start listening for clients.
+    void stop();                                                    ///< Stop the server and disconnect all clients.
+    bool isRunning() const;                                         ///< Check if the server is running.
+    //
+    Statistics getStatistics() const;                               ///< Get the current server counters.
+
+private:
+    void handleRequest(std::span<const std::uint8_t> pRequest, std::vector<std::uint8_t>& pResponse);
+                                                                    ///< Perform a single request and assemble the response.
+
+private:
+    struct Server;                                                  ///< Listening socket, IO context and thread of a running server.
+    //
+    Device& device;                                                 ///< The shared device.
+    const std::string socketPath;                                   ///< Path of the socket file.
+    //
+    std::unique_ptr<Server> server;                                 ///< Running server or \c nullptr if stopped.
+    //
+    Statistics statistics;                                          ///< Current server counters.
+    mutable std::mutex statisticsMutex;                             ///< Mutex for \ref statistics.
+
+public:
+    static constexpr std::uint32_t maxMessageSize = 0x4000000;      ///< Maximum accepted message payload size (64 MiB).
+};
+
+} // namespace casil
+
+#endif // CASIL_DEVICESERVER_H
@@ -29,6 +29,11 @@
 #include <boost/algorithm/string/split.hpp>
 
 #include <cstdlib>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
 
 #define CASIL_XSTR(S) CASIL_STR(S)
 #define CASIL_STR(S) #S
@@ -83,9 +88,66 @@ std::map<std::string, std::set<std::string>, std::less<>> readEnv()
 
     env.insert({"CASIL_DEV_DESC_DIRS", combinePaths(devDescsEnv, devDescsMacro)});
 
+    //Layer component plugins
+
+    std::string pluginsMacro;
+#ifdef CASIL_PLUGIN_DIRS
+    pluginsMacro = CASIL_XSTR(CASIL_PLUGIN_DIRS);
+#endif
+
+    const char *const pluginsGetenvPtr = std::getenv("CASIL_PLUGIN_DIRS");
+    std::string pluginsEnv = (pluginsGetenvPtr ? pluginsGetenvPtr : "");
+
+    env.insert({"CASIL_PLUGIN_DIRS", combinePaths(pluginsEnv, pluginsMacro)});
+
     return env;
 }
 
+/*
+ * Existing directory of a path variable together with the names of all files contained in it (see indexDirectories()).
+ */
+struct IndexedDirectory
+{
+    std::filesystem::path path;
+    std::set<std::string, std::less<>> fileNames;
+};
+
+std::mutex fileIndexMutex;                                                          //Protects 'fileIndex'
+std::map<std::string, std::vector<IndexedDirectory>, std::less<>> fileIndex;      //Indexed directories per path variable (see findFile())
+
+/*
+ * Lists all files of every existing directory in 'pDirs', keeping the order of 'pDirs'.
+ * Non-existing/unreadable directories are skipped. Every directory is read only once and
+ * file types are taken from the directory entries, which avoids per-file status queries.
+ */
+std::vector<IndexedDirectory> indexDirectories(const std::set<std::string>& pDirs)
+{
+    std::vector<IndexedDirectory> dirs;
+
+    for (const std::string& dir : pDirs)
+    {
+        std::error_code ec;
+        std::filesystem::directory_iterator dirIt(dir, ec);
+
+        if (ec)
+            continue;
+
+        IndexedDirectory indexedDir{.path = dir, .fileNames = {}};
+
+        for (const std::filesystem::directory_entry& entry : dirIt)
+        {
+            std::error_code entryEc;
+
+            if (!entry.is_directory(entryEc))
+                indexedDir.fileNames.insert(entry.path().filename().string());
+        }
+
+        dirs.push_back(std::move(indexedDir));
+    }
+
+    return dirs;
+}
+
 } // namespace
 
 namespace casil::Env
@@ -133,4 +195,55 @@ const std::set<std::string>& getEnv(const std::string_view pVarName)
     return it->second;
 }
 
+/*!
+ * \brief Find a file in the directories of a path variable.
+ *
+ * Searches the directories listed by the path variable \p pVarName (see getEnv(std::string_view)) for a file named \p pFileName,
+ * starting with the first directory, and returns the path of the first found file.
+ *
+ * The search uses a process-wide index of the existing directories and their file names, which is
+ * built once per variable on first use, such that subsequent calls do not access the filesystem.
+ * Hence files added or removed after the index was built are only noticed after calling invalidateFileIndex().
+ *
+ * \throws std::invalid_argument If \p pVarName is not supported (see Env for a list of supported variables).
+ *
+ * \param pVarName The name of the path environment variable.
+ * \param pFileName The file name to look for.
+ * \return Path of the found file or an empty path if none of the directories contains such a file.
+ */
+std::filesystem::path findFile(const std::string_view pVarName, const std::string_view pFileName)
+{
+    const std::set<std::string>& dirs = getEnv(pVarName);
+
+    const std::lock_guard<std::mutex> fileIndexLock(::fileIndexMutex);
+    (void)fileIndexLock;
+
+    auto it = ::fileIndex.find(pVarName);
+
+    if (it == ::fileIndex.end())
+        it = ::fileIndex.emplace(std::string(pVarName), ::indexDirectories(dirs)).first;
+
+    for (const ::IndexedDirectory& dir : it->second)
+    {
+        if (dir.fileNames.contains(pFileName))
+            return dir.path / pFileName;
+    }
+
+    return std::filesystem::path();
+}
+
+/*!
+ * \brief Discard the cached directory index used by findFile().
+ *
+ * The directories are scanned again on the next call of findFile(). Note that the
+ * environment variables themselves are not reread (see getEnv()).
+ */
+void invalidateFileIndex()
+{
+    const std::lock_guard<std::mutex> fileIndexLock(::fileIndexMutex);
+    (void)fileIndexLock;
+
+    ::fileIndex.clear();
+}
+
 } // namespace casil::Env
@@ -24,6 +24,7 @@
 #ifndef CASIL_ENV_ENV_H
 #define CASIL_ENV_ENV_H
 
+#include <filesystem>
 #include <functional>
 #include <string>
 #include <string_view>
@@ -46,8 +47,14 @@ namespace casil
  *
  * See getEnv() for details on how to access specific variables.
  *
+ * Files in directories listed by path variables can be looked up via findFile(), which uses a process-wide index
+ * of the (existing) directories and their contained file names. The index is built once on first use, such that
+ * repeated lookups (e.g. for every constructed \ref Layers::HL::SCPI "SCPI" driver) do not touch the filesystem.
+ * Use invalidateFileIndex() to rescan the directories after files were added or removed.
+ *
  * List of supported variables:
  * - \c CASIL_DEV_DESC_DIRS: Directories containing \ref Layers::HL::SCPI "SCPI" device description files.
+ * - \c CASIL_PLUGIN_DIRS: Directories containing layer component plugin libraries (see LayerFactory).
  */
 namespace Env
 {
@@ -56,6 +63,10 @@ const std::map<std::string, std::set<std::string>, std::less<>>& getEnv();  ///<
 
 const std::set<std::string>& getEnv(std::string_view pVarName);             ///< Get a specific Casil environment variable.
 
+std::filesystem::path findFile(std::string_view pVarName, std::string_view pFileName);
+                                                                            ///< Find a file in the directories of a path variable.
+void invalidateFileIndex();                                                 ///< Discard the cached directory index used by findFile().
+
 } // namespace Env
 
 } // namespace casil
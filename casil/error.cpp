@@ -0,0 +1,99 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/error.h>
+
+#include <stdexcept>
+
+using casil::Error;
+
+/*!
+ * \brief Constructor.
+ *
+ * \param pCode Error code.
+ * \param pMessage Static context message (must outlive the error, e.g. a string literal).
+ */
+Error::Error(const Code pCode, const char *const pMessage) :
+    code(pCode),
+    message(pMessage),
+    messageFormatter()
+{
+}
+
+/*!
+ * \brief Constructor.
+ *
+ * \param pCode Error code.
+ * \param pMessageFormatter Function that formats the context message (called by getMessage()).
+ */
+Error::Error(const Code pCode, std::function<std::string()> pMessageFormatter) :
+    code(pCode),
+    message(nullptr),
+    messageFormatter(std::move(pMessageFormatter))
+{
+}
+
+//Public
+
+/*!
+ * \brief Get the error code.
+ *
+ * \return Error code.
+ */
+Error::Code Error::getCode() const
+{
+    return code;
+}
+
+/*!
+ * \brief Get the (formatted) context message.
+ *
+ * Calls the message formatter if the error was constructed with one.
+ *
+ * \return Context message.
+ */
+std::string Error::getMessage() const
+{
+    if (messageFormatter)
+        return messageFormatter();
+    else if (message)
+        return message;
+    else
+        return "";
+}
+
+//
+
+/*!
+ * \brief Throw the error as exception.
+ *
+ * \throws std::invalid_argument With getMessage() as message if getCode() is Code::InvalidArgument.
+ * \throws std::runtime_error With getMessage() as message otherwise.
+ */
+void Error::raise() const
+{
+    if (code == Code::InvalidArgument)
+        throw std::invalid_argument(getMessage());
+    else
+        throw std::runtime_error(getMessage());
+}
@@ -0,0 +1,157 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_ERROR_H
+#define CASIL_ERROR_H
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace casil
+{
+
+/*!
+ * \brief Compact description of a failed operation for non-throwing APIs (see Expected).
+ *
+ * Consists of an error code, which can be checked cheaply, and a context message. The context message is either
+ * a static string or is formatted \e lazily by a stored function object, i.e. only if getMessage() is actually called.
+ * This way expected failures (e.g. timeouts in polling loops) do not pay for string formatting or exceptions.
+ *
+ * Use raise() to convert the error into the exception that the corresponding throwing API would have thrown.
+ */
+class Error
+{
+public:
+    /*!
+     * \brief Category of the failure.
+     */
+    enum class Code : std::uint8_t
+    {
+        Timeout = 0,            ///< The operation timed out (also after possible retries).
+        Protocol = 1,           ///< Invalid, wrong or non-matching response from the other side.
+        InvalidArgument = 2,    ///< The operation was called with invalid arguments.
+        Failure = 3             ///< Any other failure (e.g. failed socket access).
+    };
+
+public:
+    Error(Code pCode, const char* pMessage);                            ///< Constructor.
+    Error(Code pCode, std::function<std::string()> pMessageFormatter);  ///< Constructor.
+    //
+    Code getCode() const;                                               ///< Get the error code.
+    std::string getMessage() const;                                     ///< Get the (formatted) context message.
+    //
+    [[noreturn]] void raise() const;                                    ///< Throw the error as exception.
+
+private:
+    Code code;                                                          ///< \copybrief getCode()
+    const char* message;                                                ///< Static context message (if no formatter is used).
+    std::function<std::string()> messageFormatter;                      ///< Function to format the context message on demand.
+};
+
+/*!
+ * \brief Either the result of a successful operation or an Error, as return type of non-throwing APIs.
+ *
+ * Minimal C++20 counterpart of \c std::expected<T, Error>, used by the \c try* functions of the
+ * transfer layer (see e.g. TL::MuxedInterface::tryReadInto()) and of HL::MuxedDriver.
+ *
+ * \tparam T Type of the result value.
+ */
+template<typename T>
+class Expected
+{
+public:
+    Expected(T pValue) : storage(std::in_place_index<0>, std::move(pValue)) {}     ///< Constructor for a successful result.
+    Expected(Error pError) : storage(std::in_place_index<1>, std::move(pError)) {} ///< Constructor for a failed operation.
+    //
+    bool hasValue() const { return storage.index() == 0; }                         ///< Check if the operation succeeded.
+    explicit operator bool() const { return hasValue(); }                           ///< Check if the operation succeeded.
+    //
+    T& value();                                                                     ///< Get the result value.
+    const T& value() const;                                                         ///< Get the result value.
+    const Error& error() const { return std::get<1>(storage); }                     ///< Get the error (only if the operation failed).
+
+private:
+    std::variant<T, Error> storage;                                                 ///< Result value or error.
+};
+
+/*!
+ * \brief Specialization of Expected for operations without result value.
+ */
+template<>
+class Expected<void>
+{
+public:
+    Expected() : storage() {}                                                       ///< Constructor for a successful operation.
+    Expected(Error pError) : storage(std::move(pError)) {}                          ///< Constructor for a failed operation.
+    //
+    bool hasValue() const { return !storage.has_value(); }                         ///< Check if the operation succeeded.
+    explicit operator bool() const { return hasValue(); }                           ///< Check if the operation succeeded.
+    //
+    void value() const { if (storage) storage->raise(); }                           ///< Raise the error if the operation failed.
+    const Error& error() const { return *storage; }                                 ///< Get the error (only if the operation failed).
+
+private:
+    std::optional<Error> storage;                                                   ///< Error if the operation failed.
+};
+
+/*!
+ * \brief Get the result value.
+ *
+ * \throws std::runtime_error If the operation failed (see Error::raise()).
+ * \throws std::invalid_argument If the operation failed with Error::Code::InvalidArgument.
+ *
+ * \return Result value.
+ */
+template<typename T>
+T& Expected<T>::value()
+{
+    if (!hasValue())
+        error().raise();
+
+    return std::get<0>(storage);
+}
+
+/*!
+ * \brief Get the result value.
+ *
+ * \throws std::runtime_error If the operation failed (see Error::raise()).
+ * \throws std::invalid_argument If the operation failed with Error::Code::InvalidArgument.
+ *
+ * \return Result value.
+ */
+template<typename T>
+const T& Expected<T>::value() const
+{
+    if (!hasValue())
+        error().raise();
+
+    return std::get<0>(storage);
+}
+
+} // namespace casil
+
+#endif // CASIL_ERROR_H
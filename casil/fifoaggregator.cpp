@@ -0,0 +1,370 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/fifoaggregator.h>
+
+#include <casil/logger.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using casil::FifoAggregator;
+
+/*!
+ * \brief Constructor.
+ *
+ * \throws std::invalid_argument If \p pQueueCapacity or \p pMaxBlockWords is zero.
+ *
+ * \param pQueueCapacity Maximum number of blocks in the queue.
+ * \param pMaxBlockWords Maximum number of data words read from a board before serving the next board.
+ */
+FifoAggregator::FifoAggregator(const std::size_t pQueueCapacity, const std::size_t pMaxBlockWords) :
+    queueCapacity(pQueueCapacity),
+    maxBlockWords(pMaxBlockWords),
+    boards(),
+    drainThread(),
+    stopRequested(false),
+    boardsPending(),
+    numBoardsPending(0),
+    queue(),
+    statistics{},
+    mutex(),
+    wakeCondVar(),
+    blockCondVar()
+{
+    if (queueCapacity == 0)
+        throw std::invalid_argument("Queue capacity of FIFO aggregator must be positive.");
+
+    if (maxBlockWords == 0)
+        throw std::invalid_argument("Maximum block size of FIFO aggregator must be positive.");
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops the draining thread (see stop()).
+ */
+FifoAggregator::~FifoAggregator()
+{
+    try
+    {
+        stop();
+    }
+    catch (const std::exception& exc)
+    {
+        Logger::logError(std::string("Exception while stopping FIFO aggregator: ") + exc.what());
+    }
+}
+
+//Public
+
+/*!
+ * \brief Add an interface whose FIFO shall be read.
+ *
+ * \throws std::invalid_argument If \p pInterface was already added.
+ * \throws std::runtime_error If the aggregator is running.
+ *
+ * \param pInterface The %SiTCP interface.
+ * \return Index of the board, as used for Block::board.
+ */
+std::size_t FifoAggregator::addBoard(Layers::TL::SiTCP& pInterface)
+{
+    if (isRunning())
+        throw std::runtime_error("Cannot add boards to a running FIFO aggregator.");
+
+    if (std::find(boards.begin(), boards.end(), &pInterface) != boards.end())
+        throw std::invalid_argument("Interface was already added to the FIFO aggregator.");
+
+    boards.push_back(&pInterface);
+
+    return boards.size() - 1;
+}
+
+//
+
+/*!
+ * \brief Start the draining thread.
+ *
+ * Registers a FIFO data notifier with every board (see TL::SiTCP::setFifoDataNotifier()) and starts the thread
+ * that reads the FIFOs of boards with pending data. All boards are initially considered to have pending data,
+ * so data received before starting is read as well. Does nothing if already running.
+ */
+void FifoAggregator::start()
+{
+    if (isRunning())
+        return;
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        stopRequested = false;
+        boardsPending.assign(boards.size(), true);
+        numBoardsPending = boards.size();
+    }
+
+    drainThread = std::thread(&FifoAggregator::run, this);
+
+    for (std::size_t i = 0; i < boards.size(); ++i)
+        boards[i]->setFifoDataNotifier([this, i]() -> void { notifyBoard(i); });
+}
+
+/*!
+ * \brief Stop the draining thread.
+ *
+ * Removes the FIFO data notifiers from the boards and waits for the draining thread to finish
+ * its current turn. Blocks already in the queue remain available (see getBlock()), while data not yet
+ * read from the FIFOs stays there. Does nothing if not running.
+ */
+void FifoAggregator::stop()
+{
+    if (!isRunning())
+        return;
+
+    for (Layers::TL::SiTCP* board : boards)
+        board->setFifoDataNotifier({});
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        stopRequested = true;
+    }
+
+    wakeCondVar.notify_all();
+
+    drainThread.join();
+}
+
+/*!
+ * \brief Check if the draining thread is running.
+ *
+ * \return True if running.
+ */
+bool FifoAggregator::isRunning() const
+{
+    return drainThread.joinable();
+}
+
+//
+
+/*!
+ * \brief Take the next block from the queue.
+ *
+ * Waits up to \p pTimeout for a block if the queue is empty.
+ *
+ * \param pTimeout Maximum time to wait for a block.
+ * \return The oldest queued block or nothing if the queue remained empty.
+ */
+std::optional<FifoAggregator::Block> FifoAggregator::getBlock(const std::chrono::milliseconds pTimeout)
+{
+    std::unique_lock<std::mutex> stateLock(mutex);
+
+    if (!blockCondVar.wait_for(stateLock, pTimeout, [this]() -> bool { return !queue.empty(); }))
+        return std::nullopt;
+
+    Block block = std::move(queue.front());
+    queue.pop_front();
+
+    stateLock.unlock();
+    wakeCondVar.notify_one();
+
+    return block;
+}
+
+/*!
+ * \brief Take all currently queued blocks.
+ *
+ * Does not wait for new blocks.
+ *
+ * \return All queued blocks, oldest first.
+ */
+std::vector<FifoAggregator::Block> FifoAggregator::getBlocks()
+{
+    std::vector<Block> blocks;
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        blocks.reserve(queue.size());
+        std::move(queue.begin(), queue.end(), std::back_inserter(blocks));
+        queue.clear();
+    }
+
+    wakeCondVar.notify_one();
+
+    return blocks;
+}
+
+//
+
+/*!
+ * \brief Get the current aggregator counters.
+ *
+ * The counters accumulate over all runs since construction.
+ *
+ * \return Current statistics.
+ */
+FifoAggregator::Statistics FifoAggregator::getStatistics() const
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    return statistics;
+}
+
+//Private
+
+/*!
+ * \brief Serve boards with pending data until stopped.
+ *
+ * Sleeps until a board has pending data (see notifyBoard()), then reads one block from the next pending board
+ * in round-robin order (see drainBoard()) and adds it to the queue. A board that delivered a full block
+ * is kept pending, since its FIFO may contain more data. Waits for free queue space before reading.
+ */
+void FifoAggregator::run()
+{
+    std::size_t nextBoard = 0;
+
+    std::unique_lock<std::mutex> stateLock(mutex);
+
+    while (true)
+    {
+        wakeCondVar.wait(stateLock, [this]() -> bool { return numBoardsPending > 0 || stopRequested; });
+
+        if (stopRequested)
+            break;
+
+        ++statistics.wakeUps;
+
+        while (numBoardsPending > 0 && !stopRequested)
+        {
+            if (queue.size() >= queueCapacity)
+            {
+                ++statistics.queueStalls;
+
+                wakeCondVar.wait(stateLock, [this]() -> bool { return queue.size() < queueCapacity || stopRequested; });
+
+                if (stopRequested)
+                    break;
+            }
+
+            while (!boardsPending[nextBoard])
+                nextBoard = (nextBoard + 1) % boards.size();
+
+            const std::size_t board = nextBoard;
+
+            boardsPending[board] = false;
+            --numBoardsPending;
+            nextBoard = (nextBoard + 1) % boards.size();
+
+            stateLock.unlock();
+
+            Block block;
+
+            try
+            {
+                block = drainBoard(board);
+            }
+            catch (const std::exception& exc)
+            {
+                Logger::logError(std::string("FIFO aggregator failed to read board ") + std::to_string(board) + ": " + exc.what());
+            }
+
+            stateLock.lock();
+
+            if (block.words.size() >= maxBlockWords && !boardsPending[board])
+            {
+                boardsPending[board] = true;
+                ++numBoardsPending;
+            }
+
+            if (!block.words.empty())
+            {
+                ++statistics.blocksQueued;
+                statistics.wordsQueued += block.words.size();
+
+                queue.push_back(std::move(block));
+
+                blockCondVar.notify_one();
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Read up to the maximum block size from a board's FIFO.
+ *
+ * \param pBoard Index of the board.
+ * \return Block with the read words (possibly empty).
+ */
+FifoAggregator::Block FifoAggregator::drainBoard(const std::size_t pBoard)
+{
+    Block block{.board = pBoard, .sequenceNumber = 0, .timestamp = {}, .words = {}};
+
+    auto consumer = [&block](const std::chrono::steady_clock::time_point pTimestamp, const std::uint64_t pSequenceNumber,
+                             const std::span<const std::uint32_t> pWords) -> void
+    {
+        if (block.words.empty())
+        {
+            block.sequenceNumber = pSequenceNumber;
+            block.timestamp = pTimestamp;
+        }
+
+        block.words.insert(block.words.end(), pWords.begin(), pWords.end());
+    };
+
+    boards[pBoard]->consumeFifoChunks(consumer, static_cast<int>(std::min<std::size_t>(maxBlockWords * 4, 0x7FFFFFFCu)));
+
+    return block;
+}
+
+/*!
+ * \brief Mark a board as having pending data.
+ *
+ * Called as FIFO data notifier of the board (see start()); wakes the draining thread.
+ *
+ * \param pBoard Index of the board.
+ */
+void FifoAggregator::notifyBoard(const std::size_t pBoard)
+{
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        if (boardsPending[pBoard])
+            return;
+
+        boardsPending[pBoard] = true;
+        ++numBoardsPending;
+    }
+
+    wakeCondVar.notify_one();
+}
@@ -0,0 +1,133 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_FIFOAGGREGATOR_H
+#define CASIL_FIFOAGGREGATOR_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL { class SiTCP; }
+
+/*!
+ * \brief Merged readout of the FIFOs of multiple \ref casil::TL::SiTCP "SiTCP" interfaces from a single thread.
+ *
+ * Drains the FIFOs of several %SiTCP interfaces ("boards", see addBoard()) with one thread and delivers the
+ * data as board-tagged blocks in a single queue (see getBlock() and getBlocks()). Instead of polling every FIFO,
+ * the thread sleeps until one of the interfaces signals new data (see TL::SiTCP::setFifoDataNotifier()). Boards with
+ * pending data are then served round-robin with at most a fixed number of words per turn (see FifoAggregator()),
+ * so a single busy board cannot starve the others. The %TCP sockets themselves are still read by the shared
+ * ASIO threads (see ASIO), i.e. no per-board threads are involved at all.
+ *
+ * The queue is bounded. If it is full, the draining pauses and the data accumulates in the (growing)
+ * FIFO buffers of the interfaces until blocks are taken from the queue again.
+ *
+ * Note: The interfaces must outlive the aggregator (or at least stay added only while it is stopped). While running,
+ * the FIFO data notifier of the interfaces is occupied and the FIFOs must not be read by other means.
+ *
+ * Note: The control functions (addBoard(), start(), stop()) are not thread-safe and must not be called concurrently.
+ * getBlock() and getBlocks() can be called from any thread.
+ */
+class FifoAggregator
+{
+public:
+    /*!
+     * \brief Block of FIFO data words from one board.
+     */
+    struct Block
+    {
+        std::size_t board;                                  ///< Index of the board (see addBoard()).
+        std::uint64_t sequenceNumber;                       ///< \brief Sequence number of the first contained FIFO chunk
+                                                            ///  (see TL::SiTCP::consumeFifoChunks()).
+        std::chrono::steady_clock::time_point timestamp;    ///< Arrival time of the first contained FIFO chunk.
+        std::vector<std::uint32_t> words;                   ///< The FIFO data words.
+    };
+
+    /*!
+     * \brief Snapshot of the aggregator counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t blocksQueued;     ///< Number of blocks added to the queue.
+        std::uint64_t wordsQueued;      ///< Number of data words added to the queue.
+        std::uint64_t wakeUps;          ///< Number of times the draining thread woke up to serve boards.
+        std::uint64_t queueStalls;      ///< Number of times the draining thread had to wait for a full queue.
+    };
+
+public:
+    explicit FifoAggregator(std::size_t pQueueCapacity = 64, std::size_t pMaxBlockWords = 65536);  ///< Constructor.
+    FifoAggregator(const FifoAggregator&) = delete;                 ///< Deleted copy constructor.
+    FifoAggregator(FifoAggregator&&) = delete;                      ///< Deleted move constructor.
+    ~FifoAggregator();                                              ///< Destructor.
+    //
+    FifoAggregator& operator=(FifoAggregator) = delete;             ///< Deleted copy assignment operator.
+    FifoAggregator& operator=(FifoAggregator&&) = delete;           ///< Deleted move assignment operator.
+    //
+    std::size_t addBoard(Layers::TL::SiTCP& pInterface);            ///< Add an interface whose FIFO shall be read.
+    //
+    void start();                                                   ///< Start the draining thread.
+    void stop();                                                    ///< Stop the draining thread.
+    bool isRunning() const;                                         ///< Check if the draining thread is running.
+    //
+    std::optional<Block> getBlock(std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero());
+                                                                    ///< Take the next block from the queue.
+    std::vector<Block> getBlocks();                                 ///< Take all currently queued blocks.
+    //
+    Statistics getStatistics() const;                               ///< Get the current aggregator counters.
+
+private:
+    void run();                                                     ///< Serve boards with pending data until stopped.
+    Block drainBoard(std::size_t pBoard);                           ///< Read up to the maximum block size from a board's FIFO.
+    void notifyBoard(std::size_t pBoard);                           ///< Mark a board as having pending data.
+
+private:
+    const std::size_t queueCapacity;                                ///< Maximum number of queued blocks.
+    const std::size_t maxBlockWords;                                ///< Maximum number of words read from a board per turn.
+    //
+    std::vector<Layers::TL::SiTCP*> boards;                         ///< The added interfaces.
+    //
+    std::thread drainThread;                                        ///< Thread that reads the FIFOs.
+    bool stopRequested;                                             ///< Flags the draining thread to exit.
+    std::vector<bool> boardsPending;                                ///< Flags the boards that (may) have new data.
+    std::size_t numBoardsPending;                                   ///< Number of set flags in \ref boardsPending.
+    std::deque<Block> queue;                                        ///< Queue of blocks waiting to be taken.
+    Statistics statistics;                                          ///< Current counters.
+    mutable std::mutex mutex;                                       ///< Mutex for all of the above state except \ref boards.
+    std::condition_variable wakeCondVar;                            ///< \brief Condition variable to wake the draining thread
+                                                                    ///  (pending data, free queue space or stop).
+    std::condition_variable blockCondVar;                           ///< Condition variable to wake threads waiting for blocks.
+};
+
+} // namespace casil
+
+#endif // CASIL_FIFOAGGREGATOR_H
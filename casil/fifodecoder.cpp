@@ -0,0 +1,611 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <casil/fifodecoder.h>
+
+#include <casil/layerconfig.h>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+using casil::FifoDecoder;
+
+namespace
+{
+
+constexpr std::uint8_t unmatchedRule = FifoDecoder::maxRules;   //Rule index of words that do not match any rule
+
+} // namespace
+
+/*!
+ * \brief Pool of persistent worker threads that process a set of tasks with work stealing.
+ *
+ * Each run() distributes the task indices as contiguous ranges over all workers (the calling thread being worker 0).
+ * A worker takes tasks from the front of its own range and, once that is exhausted,
+ * steals tasks from the back of the other workers' ranges until all ranges are empty.
+ */
+class FifoDecoder::WorkerPool
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * Starts \p pNumWorkers - 1 threads (the thread calling run() is the remaining worker).
+     *
+     * \param pNumWorkers Non-zero number of workers.
+     */
+    explicit WorkerPool(const std::size_t pNumWorkers) :
+        numWorkers(pNumWorkers),
+        queues(std::make_unique<TaskQueue[]>(pNumWorkers)),
+        threads(),
+        task(nullptr),
+        generation(0),
+        activeWorkers(0),
+        stopRequested(false),
+        error(),
+        blocksStolen(0),
+        mutex(),
+        startCondVar(),
+        doneCondVar()
+    {
+        threads.reserve(numWorkers - 1);
+
+        for (std::size_t i = 1; i < numWorkers; ++i)
+            threads.emplace_back(&WorkerPool::threadLoop, this, i);
+    }
+    /*!
+     * \brief Destructor.
+     *
+     * Stops and joins all threads.
+     */
+    ~WorkerPool()
+    {
+        {
+            const std::lock_guard<std::mutex> runLock(mutex);
+            (void)runLock;
+
+            stopRequested = true;
+        }
+
+        startCondVar.notify_all();
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+    //
+    /*!
+     * \brief Process tasks with all workers.
+     *
+     * Calls \p pTask for every task index from 0 to \p pNumTasks - 1 exactly once and returns when all calls finished.
+     *
+     * \param pNumTasks Number of tasks.
+     * \param pTask Function processing a task.
+     *
+     * \throws Any exception thrown by \p pTask (the first one, after all workers finished).
+     */
+    void run(const std::size_t pNumTasks, const std::function<void(std::size_t)>& pTask)
+    {
+        if (numWorkers == 1 || pNumTasks <= 1)
+        {
+            for (std::size_t i = 0; i < pNumTasks; ++i)
+                pTask(i);
+
+            return;
+        }
+
+        for (std::size_t i = 0; i < numWorkers; ++i)
+        {
+            const std::lock_guard<std::mutex> queueLock(queues[i].mutex);
+            (void)queueLock;
+
+            queues[i].begin = i * pNumTasks / numWorkers;
+            queues[i].end = (i + 1) * pNumTasks / numWorkers;
+        }
+
+        {
+            const std::lock_guard<std::mutex> runLock(mutex);
+            (void)runLock;
+
+            task = &pTask;
+            error = nullptr;
+            activeWorkers = numWorkers - 1;
+            ++generation;
+        }
+
+        startCondVar.notify_all();
+
+        work(0);
+
+        std::unique_lock<std::mutex> runLock(mutex);
+        doneCondVar.wait(runLock, [this]() -> bool { return activeWorkers == 0; });
+
+        task = nullptr;
+
+        if (error)
+            std::rethrow_exception(std::exchange(error, nullptr));
+    }
+    /*!
+     * \brief Get the number of workers.
+     *
+     * \return Number of workers including the calling thread.
+     */
+    std::size_t getNumWorkers() const
+    {
+        return numWorkers;
+    }
+    /*!
+     * \brief Get the number of stolen tasks.
+     *
+     * \return Number of tasks processed by a worker other than the initially assigned one.
+     */
+    std::uint64_t getBlocksStolen() const
+    {
+        return blocksStolen.load(std::memory_order_relaxed);
+    }
+
+private:
+    /*!
+     * \brief Range of task indices assigned to a worker.
+     */
+    struct TaskQueue
+    {
+        std::mutex mutex;       ///< Protects the range.
+        std::size_t begin = 0;  ///< First remaining task index.
+        std::size_t end = 0;    ///< Past-the-end task index.
+    };
+
+private:
+    /*!
+     * \brief Take the next task of a worker.
+     *
+     * Takes the first task of the worker's own range or otherwise the last task of another worker's range.
+     *
+     * \param pWorkerIdx Index of the worker.
+     * \return Task index or nothing if all ranges are empty.
+     */
+    std::optional<std::size_t> nextTask(const std::size_t pWorkerIdx)
+    {
+        {
+            TaskQueue& ownQueue = queues[pWorkerIdx];
+
+            const std::lock_guard<std::mutex> ownQueueLock(ownQueue.mutex);
+            (void)ownQueueLock;
+
+            if (ownQueue.begin < ownQueue.end)
+                return ownQueue.begin++;
+        }
+
+        for (std::size_t i = 1; i < numWorkers; ++i)
+        {
+            TaskQueue& otherQueue = queues[(pWorkerIdx + i) % numWorkers];
+
+            const std::lock_guard<std::mutex> otherQueueLock(otherQueue.mutex);
+            (void)otherQueueLock;
+
+            if (otherQueue.begin < otherQueue.end)
+            {
+                blocksStolen.fetch_add(1, std::memory_order_relaxed);
+                return --otherQueue.end;
+            }
+        }
+
+        return std::nullopt;
+    }
+    /*!
+     * \brief Process tasks until all ranges are empty.
+     *
+     * Stores the first exception thrown by a task and skips the remaining tasks in that case.
+     *
+     * \param pWorkerIdx Index of the worker.
+     */
+    void work(const std::size_t pWorkerIdx)
+    {
+        try
+        {
+            while (const std::optional<std::size_t> taskIdx = nextTask(pWorkerIdx))
+                (*task)(taskIdx.value());
+        }
+        catch (...)
+        {
+            const std::lock_guard<std::mutex> runLock(mutex);
+            (void)runLock;
+
+            if (!error)
+                error = std::current_exception();
+
+            //Drain all ranges to let the other workers finish quickly
+            for (std::size_t i = 0; i < numWorkers; ++i)
+            {
+                const std::lock_guard<std::mutex> queueLock(queues[i].mutex);
+                (void)queueLock;
+
+                queues[i].begin = queues[i].end;
+            }
+        }
+    }
+    /*!
+     * \brief Main function of the worker threads.
+     *
+     * Waits for run() to start a new set of tasks, processes them and reports completion, until stopped.
+     *
+     * \param pWorkerIdx Index of the worker.
+     */
+    void threadLoop(const std::size_t pWorkerIdx)
+    {
+        std::uint64_t lastGeneration = 0;
+
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> runLock(mutex);
+                startCondVar.wait(runLock, [this, lastGeneration]() -> bool { return stopRequested || generation != lastGeneration; });
+
+                if (stopRequested)
+                    return;
+
+                lastGeneration = generation;
+            }
+
+            work(pWorkerIdx);
+
+            bool lastWorker = false;
+
+            {
+                const std::lock_guard<std::mutex> runLock(mutex);
+                (void)runLock;
+
+                lastWorker = (--activeWorkers == 0);
+            }
+
+            if (lastWorker)
+                doneCondVar.notify_one();
+        }
+    }
+
+private:
+    const std::size_t numWorkers;                   ///< Number of workers including the calling thread.
+    const std::unique_ptr<TaskQueue[]> queues;      ///< Task ranges per worker.
+    std::vector<std::thread> threads;               ///< The worker threads.
+    //
+    const std::function<void(std::size_t)>* task;  ///< Task function of the current run.
+    std::uint64_t generation;                       ///< Counts the runs (signals a new run to the threads).
+    std::size_t activeWorkers;                      ///< Number of threads still working on the current run.
+    bool stopRequested;                             ///< Flags the threads to exit.
+    std::exception_ptr error;                       ///< First exception thrown by a task of the current run.
+    std::atomic_uint64_t blocksStolen;              ///< Number of stolen tasks.
+    //
+    std::mutex mutex;                               ///< Protects the run state.
+    std::condition_variable startCondVar;           ///< Signals a new run or stop request to the threads.
+    std::condition_variable doneCondVar;            ///< Signals the end of the threads' work to run().
+};
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Starts the worker threads and validates the rules.
+ *
+ * \param pRules Record type definitions (see FifoDecoder).
+ * \param pNumThreads Number of threads used for decoding (including the calling thread) or zero for one per hardware thread.
+ * \param pBlockSize Number of words per block.
+ *
+ * \throws std::invalid_argument If \p pBlockSize is zero.
+ * \throws std::invalid_argument If \p pRules contains more than \ref maxRules rules.
+ * \throws std::invalid_argument If a rule or field name is empty or used twice (per rule for fields).
+ * \throws std::invalid_argument If a rule value has bits set outside of the rule mask.
+ * \throws std::invalid_argument If a field shift exceeds 31 or a field mask is zero.
+ */
+FifoDecoder::FifoDecoder(std::vector<Rule> pRules, const std::size_t pNumThreads, const std::size_t pBlockSize) :
+    rules(std::move(pRules)),
+    blockSize(pBlockSize),
+    pool(std::make_unique<WorkerPool>(pNumThreads != 0 ? pNumThreads : std::max(1u, std::thread::hardware_concurrency()))),
+    wordRules(),
+    blockOffsets(),
+    wordsDecoded(0),
+    blocksDecoded(0),
+    decodeMutex()
+{
+    if (blockSize == 0)
+        throw std::invalid_argument("Block size of FIFO decoder must be non-zero.");
+
+    if (rules.size() > maxRules)
+        throw std::invalid_argument("Too many rules for FIFO decoder (maximum is " + std::to_string(maxRules) + ").");
+
+    std::set<std::string> ruleNames;
+
+    for (const Rule& rule : rules)
+    {
+        if (rule.name.empty() || !ruleNames.insert(rule.name).second)
+            throw std::invalid_argument("Empty or duplicate rule name \"" + rule.name + "\" for FIFO decoder.");
+
+        if ((rule.value & ~rule.mask) != 0)
+            throw std::invalid_argument("Value of FIFO decoder rule \"" + rule.name + "\" has bits outside of the mask.");
+
+        std::set<std::string> fieldNames;
+
+        for (const Field& field : rule.fields)
+        {
+            if (field.name.empty() || !fieldNames.insert(field.name).second)
+                throw std::invalid_argument("Empty or duplicate field name \"" + field.name + "\" in FIFO decoder rule \"" + rule.name + "\".");
+
+            if (field.shift > 31 || field.mask == 0)
+                throw std::invalid_argument("Invalid shift or mask of field \"" + field.name + "\" in FIFO decoder rule \"" + rule.name + "\".");
+        }
+    }
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops the worker threads.
+ */
+FifoDecoder::~FifoDecoder() = default;
+
+//Public
+
+/*!
+ * \brief Get the record type definitions.
+ *
+ * \return Rules.
+ */
+const std::vector<FifoDecoder::Rule>& FifoDecoder::getRules() const
+{
+    return rules;
+}
+
+/*!
+ * \brief Get the number of threads used for decoding.
+ *
+ * \return Number of threads including the thread calling decode().
+ */
+std::size_t FifoDecoder::getNumThreads() const
+{
+    return pool->getNumWorkers();
+}
+
+/*!
+ * \brief Get the number of words per block.
+ *
+ * \return Block size.
+ */
+std::size_t FifoDecoder::getBlockSize() const
+{
+    return blockSize;
+}
+
+//
+
+/*!
+ * \brief Decode a sequence of data words.
+ *
+ * Classifies the words of \p pWords by the rules and extracts the fields of all records (see FifoDecoder).
+ *
+ * \param pWords Data words.
+ * \return Records per rule and number of unmatched words.
+ */
+FifoDecoder::Result FifoDecoder::decode(const std::span<const std::uint32_t> pWords)
+{
+    const std::lock_guard<std::mutex> decodeLock(decodeMutex);
+    (void)decodeLock;
+
+    const std::size_t numWords = pWords.size();
+    const std::size_t numBlocks = (numWords + blockSize - 1) / blockSize;
+    const std::size_t numSlots = rules.size() + 1;  //Last slot per block counts the unmatched words
+
+    wordRules.resize(numWords);
+    blockOffsets.assign(numBlocks * numSlots, 0);
+
+    //First pass: classify words and count records per block and rule
+
+    pool->run(numBlocks, [this, pWords, numWords, numSlots](const std::size_t pBlockIdx) -> void
+    {
+        const std::size_t begin = pBlockIdx * blockSize;
+        const std::size_t end = std::min(begin + blockSize, numWords);
+
+        std::size_t* const counts = blockOffsets.data() + pBlockIdx * numSlots;
+
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const std::uint32_t word = pWords[i];
+
+            std::size_t ruleIdx = 0;
+            while (ruleIdx < rules.size() && (word & rules[ruleIdx].mask) != rules[ruleIdx].value)
+                ++ruleIdx;
+
+            wordRules[i] = (ruleIdx < rules.size() ? static_cast<std::uint8_t>(ruleIdx) : unmatchedRule);
+            ++counts[ruleIdx];
+        }
+    });
+
+    //Convert counts to output offsets per block and allocate the output arrays
+
+    Result result {.records = {}, .numUnmatched = 0};
+    result.records.reserve(rules.size());
+
+    for (std::size_t ruleIdx = 0; ruleIdx < rules.size(); ++ruleIdx)
+    {
+        std::size_t total = 0;
+
+        for (std::size_t blockIdx = 0; blockIdx < numBlocks; ++blockIdx)
+            total += std::exchange(blockOffsets[blockIdx * numSlots + ruleIdx], total);
+
+        const Rule& rule = rules[ruleIdx];
+
+        RecordArrays& records = result.records.emplace_back();
+        records.name = rule.name;
+        records.fieldNames.reserve(rule.fields.size());
+        records.columns.reserve(rule.fields.size());
+        records.positions.resize(total);
+
+        for (const Field& field : rule.fields)
+        {
+            records.fieldNames.push_back(field.name);
+            records.columns.emplace_back(total);
+        }
+    }
+
+    for (std::size_t blockIdx = 0; blockIdx < numBlocks; ++blockIdx)
+        result.numUnmatched += blockOffsets[blockIdx * numSlots + rules.size()];
+
+    //Second pass: extract the fields directly into the output arrays
+
+    pool->run(numBlocks, [this, pWords, numWords, numSlots, &result](const std::size_t pBlockIdx) -> void
+    {
+        const std::size_t begin = pBlockIdx * blockSize;
+        const std::size_t end = std::min(begin + blockSize, numWords);
+
+        std::size_t* const offsets = blockOffsets.data() + pBlockIdx * numSlots;
+
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const std::uint8_t ruleIdx = wordRules[i];
+
+            if (ruleIdx == unmatchedRule)
+                continue;
+
+            const std::uint32_t word = pWords[i];
+            const std::vector<Field>& fields = rules[ruleIdx].fields;
+
+            RecordArrays& records = result.records[ruleIdx];
+            const std::size_t pos = offsets[ruleIdx]++;
+
+            records.positions[pos] = i;
+
+            for (std::size_t fieldIdx = 0; fieldIdx < fields.size(); ++fieldIdx)
+                records.columns[fieldIdx][pos] = (word >> fields[fieldIdx].shift) & fields[fieldIdx].mask;
+        }
+    });
+
+    wordsDecoded += numWords;
+    blocksDecoded += numBlocks;
+
+    return result;
+}
+
+//
+
+/*!
+ * \brief Get the current decoder counters.
+ *
+ * \return Counters.
+ */
+FifoDecoder::Statistics FifoDecoder::getStatistics() const
+{
+    const std::lock_guard<std::mutex> decodeLock(decodeMutex);
+    (void)decodeLock;
+
+    return Statistics{.wordsDecoded = wordsDecoded, .blocksDecoded = blocksDecoded, .blocksStolen = pool->getBlocksStolen()};
+}
+
+//
+
+/*!
+ * \brief Parse record type definitions from YAML format.
+ *
+ * Expects a map with a "rules" sequence, each rule being a map with a "name", a "mask", a "value"
+ * and an optional "fields" sequence, each field being a map with a "name", a "mask" and an optional "shift" (default 0).
+ * See FifoDecoder for an example.
+ *
+ * \param pYAMLString YAML document.
+ * \return Parsed rules (not yet validated, see FifoDecoder()).
+ *
+ * \throws std::runtime_error If the document has no "rules" sequence.
+ * \throws std::runtime_error If a rule or field is missing a required value or a value cannot be converted.
+ */
+std::vector<FifoDecoder::Rule> FifoDecoder::parseRules(const std::string& pYAMLString)
+{
+    const boost::property_tree::ptree rulesTree = LayerConfig::fromYAML(pYAMLString).getRawTreeAt("rules");
+
+    if (rulesTree.empty())
+        throw std::runtime_error("FIFO decoder configuration does not define any \"rules\".");
+
+    /*
+     * Gets the unsigned integer 'pKey' from 'pConfig' as 32 bit value or 'pDefault' if not set and 'pDefault' is not std::nullopt;
+     * throws std::runtime_error if the value is missing or invalid.
+     */
+    auto getUInt32 = [](const LayerConfig& pConfig, const std::string& pKey, const std::string& pContext,
+                        const std::optional<std::uint32_t> pDefault = std::nullopt) -> std::uint32_t
+    {
+        const std::optional<std::uint64_t> value = pConfig.getUIntOpt(pKey);
+
+        if (!value && pDefault && !pConfig.getStrOpt(pKey))
+            return pDefault.value();
+
+        if (!value || value.value() > 0xFFFFFFFFu)
+            throw std::runtime_error("Missing or invalid \"" + pKey + "\" for " + pContext + " of FIFO decoder.");
+
+        return static_cast<std::uint32_t>(value.value());
+    };
+
+    std::vector<Rule> parsedRules;
+
+    for (const auto& [ruleKey, ruleTree] : rulesTree)
+    {
+        (void)ruleKey;
+
+        const LayerConfig ruleConfig(ruleTree);
+
+        Rule rule;
+
+        rule.name = ruleConfig.getStr("name");
+
+        const std::string ruleContext = "rule \"" + rule.name + "\"";
+
+        rule.mask = getUInt32(ruleConfig, "mask", ruleContext);
+        rule.value = getUInt32(ruleConfig, "value", ruleContext);
+
+        for (const auto& [fieldKey, fieldTree] : ruleConfig.getRawTreeAt("fields"))
+        {
+            (void)fieldKey;
+
+            const LayerConfig fieldConfig(fieldTree);
+
+            Field field;
+
+            field.name = fieldConfig.getStr("name");
+
+            const std::string fieldContext = "field \"" + field.name + "\" of " + ruleContext;
+
+            field.mask = getUInt32(fieldConfig, "mask", fieldContext);
+            field.shift = getUInt32(fieldConfig, "shift", fieldContext, 0);
+
+            rule.fields.push_back(std::move(field));
+        }
+
+        parsedRules.push_back(std::move(rule));
+    }
+
+    return parsedRules;
+}
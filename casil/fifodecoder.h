@@ -0,0 +1,173 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#ifndef CASIL_FIFODECODER_H
+#define CASIL_FIFODECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+/*!
+ * \brief Multi-threaded decoder that splits FIFO data words into typed records with structure-of-arrays output.
+ *
+ * Classifies every 32 bit FIFO data word by a list of \e rules and extracts the rule's \e fields from each matching
+ * word. A word matches a rule if <tt>(word & mask) == value</tt>; the first matching rule wins and words matching no rule
+ * are only counted. A field value is <tt>(word >> shift) & mask</tt>. The result is one set of arrays per rule
+ * (see RecordArrays), with one array per field and the position of each record in the input, such that
+ * the records can directly be histogrammed or handed to numpy.
+ *
+ * The rules can be defined in YAML format (see parseRules()), e.g.:
+ *
+ * \code{.yaml}
+ *
+ * rules:
+ *   - name: hit
+ *     mask: 0x80000000
+ *     value: 0x80000000
+ *     fields:
+ *       - {name: column, shift: 24, mask: 0x7F}
+ *       - {name: row, shift: 12, mask: 0xFFF}
+ *       - {name: tot, shift: 0, mask: 0xFF}
+ *   - name: trigger
+ *     mask: 0xF0000000
+ *     value: 0x10000000
+ *     fields:
+ *       - {name: number, shift: 0, mask: 0xFFFFFFF}
+ *
+ * \endcode
+ *
+ * decode() cuts the input into blocks of fixed size (see FifoDecoder()) and processes them in two parallel passes:
+ * The first pass classifies the words and counts the records per block and rule, the second pass extracts the fields
+ * directly into the final arrays at the offsets following from the counts. Hence the records keep the input order
+ * and no intermediate per-block outputs need to be merged. The blocks are processed by a persistent pool of worker
+ * threads (including the calling thread), each of which starts with an equal share of the blocks and
+ * steals blocks from the other workers when done, which balances uneven block costs (e.g. due to preemption).
+ *
+ * Note: decode() can be called from multiple threads, but the calls are serialized.
+ */
+class FifoDecoder
+{
+public:
+    /*!
+     * \brief Definition of a field extracted from the words of a record type.
+     */
+    struct Field
+    {
+        std::string name;               ///< Field name.
+        std::uint32_t mask;             ///< Mask applied after shifting.
+        std::uint32_t shift;            ///< Right shift of the word.
+    };
+
+    /*!
+     * \brief Definition of a record type.
+     */
+    struct Rule
+    {
+        std::string name;               ///< Record type name.
+        std::uint32_t mask;             ///< Mask selecting the identifying word bits.
+        std::uint32_t value;            ///< Required value of the masked word bits.
+        std::vector<Field> fields;      ///< Extracted fields.
+    };
+
+    /*!
+     * \brief Decoded records of one record type in structure-of-arrays layout.
+     */
+    struct RecordArrays
+    {
+        std::string name;                               ///< Record type name.
+        std::vector<std::string> fieldNames;            ///< Field names (same order as \ref columns).
+        std::vector<std::vector<std::uint32_t>> columns;///< Field values per field.
+        std::vector<std::uint64_t> positions;           ///< Positions of the records' words in the decoded input.
+    };
+
+    /*!
+     * \brief Output of decode().
+     */
+    struct Result
+    {
+        std::vector<RecordArrays> records;  ///< Decoded records per rule (same order as the rules).
+        std::uint64_t numUnmatched;         ///< Number of words that did not match any rule.
+    };
+
+    /*!
+     * \brief Snapshot of the decoder counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t wordsDecoded;     ///< Number of decoded words.
+        std::uint64_t blocksDecoded;    ///< Number of decoded blocks (counting each block once).
+        std::uint64_t blocksStolen;     ///< Number of blocks processed by a worker other than the initially assigned one.
+    };
+
+public:
+    explicit FifoDecoder(std::vector<Rule> pRules, std::size_t pNumThreads = 0, std::size_t pBlockSize = 65536);
+                                                                    ///< Constructor.
+    FifoDecoder(const FifoDecoder&) = delete;                       ///< Deleted copy constructor.
+    FifoDecoder(FifoDecoder&&) = delete;                            ///< Deleted move constructor.
+    ~FifoDecoder();                                                 ///< Destructor.
+    //
+    FifoDecoder& operator=(FifoDecoder) = delete;                   ///< Deleted copy assignment operator.
+    FifoDecoder& operator=(FifoDecoder&&) = delete;                 ///< Deleted move assignment operator.
+    //
+    const std::vector<Rule>& getRules() const;                      ///< Get the record type definitions.
+    std::size_t getNumThreads() const;                              ///< Get the number of threads used for decoding.
+    std::size_t getBlockSize() const;                               ///< Get the number of words per block.
+    //
+    Result decode(std::span<const std::uint32_t> pWords);           ///< Decode a sequence of data words.
+    //
+    Statistics getStatistics() const;                               ///< Get the current decoder counters.
+    //
+    static std::vector<Rule> parseRules(const std::string& pYAMLString);    ///< Parse record type definitions from YAML format.
+
+public:
+    static constexpr std::size_t maxRules = 255;                    ///< Maximum number of rules.
+
+private:
+    class WorkerPool;                                               ///< Pool of worker threads with work stealing.
+
+private:
+    const std::vector<Rule> rules;                                  ///< The record type definitions.
+    const std::size_t blockSize;                                    ///< Number of words per block.
+    const std::unique_ptr<WorkerPool> pool;                         ///< The worker threads.
+    //
+    std::vector<std::uint8_t> wordRules;                            ///< Reused buffer for the matched rule of each word.
+    std::vector<std::size_t> blockOffsets;                          ///< Reused buffer for the record counts/offsets per block and rule.
+    //
+    std::uint64_t wordsDecoded;                                     ///< See Statistics::wordsDecoded.
+    std::uint64_t blocksDecoded;                                    ///< See Statistics::blocksDecoded.
+    //
+    mutable std::mutex decodeMutex;                                 ///< Serializes decode() calls and protects the counters.
+};
+
+} // namespace casil
+
+#endif // CASIL_FIFODECODER_H
@@ -0,0 +1,307 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/fifoshmreader.h>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+using casil::FifoShmReader;
+
+namespace
+{
+
+static_assert(std::atomic_ref<std::uint64_t>::is_always_lock_free && std::atomic_ref<std::uint32_t>::is_always_lock_free,
+              "Shared-memory FIFO ring requires lock-free atomics.");
+
+/*
+ * Atomically load a 64 bit value from the read-only mapping (lock-free atomic loads do not write to the memory).
+ */
+std::uint64_t loadUInt64(const std::uint8_t* const pAddress, const std::memory_order pOrder = std::memory_order_acquire)
+{
+    return std::atomic_ref<std::uint64_t>(*reinterpret_cast<std::uint64_t*>(const_cast<std::uint8_t*>(pAddress))).load(pOrder);
+}
+
+/*
+ * Atomically load a 32 bit value from the read-only mapping (lock-free atomic loads do not write to the memory).
+ */
+std::uint32_t loadUInt32(const std::uint8_t* const pAddress, const std::memory_order pOrder = std::memory_order_acquire)
+{
+    return std::atomic_ref<std::uint32_t>(*reinterpret_cast<std::uint32_t*>(const_cast<std::uint8_t*>(pAddress))).load(pOrder);
+}
+
+} // namespace
+
+/*!
+ * \brief Read-only mapping of the shared-memory ring.
+ *
+ * Opens the named shared memory object and maps it completely.
+ */
+struct FifoShmReader::MappedRing
+{
+    explicit MappedRing(const std::string& pName) :
+        region()
+    {
+        try
+        {
+            const boost::interprocess::shared_memory_object shm(boost::interprocess::open_only, pName.c_str(), boost::interprocess::read_only);
+            region = boost::interprocess::mapped_region(shm, boost::interprocess::read_only);
+        }
+        catch (const boost::interprocess::interprocess_exception& exc)
+        {
+            throw std::runtime_error("Could not map shared-memory FIFO ring \"" + pName + "\": " + exc.what());
+        }
+    }
+    //
+    const std::uint8_t* getAddress() const
+    {
+        return static_cast<const std::uint8_t*>(region.get_address());
+    }
+    std::size_t getSize() const
+    {
+        return region.get_size();
+    }
+    //
+    boost::interprocess::mapped_region region;      ///< Mapped region covering the whole ring.
+};
+
+//Public
+
+/*!
+ * \brief Constructor.
+ *
+ * Opens and maps the shared-memory ring \p pName and checks its ring header.
+ *
+ * The reader starts with the next block to be published (i.e. skips all blocks currently in the ring)
+ * or, if \p pFromOldest is true, with the oldest block that is still in the ring.
+ *
+ * \throws std::runtime_error If the shared memory cannot be opened or mapped.
+ * \throws std::runtime_error If the shared memory is not an (initialized) FIFO ring of a supported layout version.
+ * \throws std::runtime_error If the size of the shared memory does not match the ring header.
+ *
+ * \param pName Name of the shared-memory ring.
+ * \param pFromOldest Start with the oldest available block instead of the next published block.
+ */
+FifoShmReader::FifoShmReader(const std::string& pName, const bool pFromOldest) :
+    name(pName),
+    mappedRing(std::make_unique<MappedRing>(pName)),
+    slotSize(0),
+    numSlots(0),
+    nextSequence(0),
+    lostBlocks(0)
+{
+    const std::uint8_t* const base = mappedRing->getAddress();
+
+    if (mappedRing->getSize() < ringHeaderSize || ::loadUInt32(base) != ringMagic)
+        throw std::runtime_error("Shared memory \"" + name + "\" is not an initialized FIFO ring.");
+    if (::loadUInt32(base + 4, std::memory_order_relaxed) != layoutVersion)
+        throw std::runtime_error("Unsupported layout version of shared-memory FIFO ring \"" + name + "\".");
+
+    std::uint64_t headerSlotSize = 0;
+    std::uint64_t headerNumSlots = 0;
+
+    std::memcpy(&headerSlotSize, base + slotSizeOffset, sizeof(headerSlotSize));
+    std::memcpy(&headerNumSlots, base + numSlotsOffset, sizeof(headerNumSlots));
+
+    slotSize = headerSlotSize;
+    numSlots = headerNumSlots;
+
+    if (slotSize == 0 || slotSize % 4 != 0 || numSlots == 0 ||
+            (mappedRing->getSize() - ringHeaderSize) / getSlotStride(slotSize) < numSlots)
+    {
+        throw std::runtime_error("Inconsistent size of shared-memory FIFO ring \"" + name + "\".");
+    }
+
+    const std::uint64_t published = ::loadUInt64(base + publishedOffset);
+
+    if (!pFromOldest)
+        nextSequence = published;
+    else if (published > numSlots)
+        nextSequence = published - numSlots;
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Unmaps the ring. Spans of previously returned blocks become invalid.
+ */
+FifoShmReader::~FifoShmReader() = default;
+
+//
+
+/*!
+ * \brief Get the name of the shared-memory ring.
+ *
+ * \return Name passed to FifoShmReader().
+ */
+const std::string& FifoShmReader::getName() const
+{
+    return name;
+}
+
+/*!
+ * \brief Get the slot capacity in bytes.
+ *
+ * \return Maximum payload length of a block in bytes.
+ */
+std::size_t FifoShmReader::getSlotSize() const
+{
+    return slotSize;
+}
+
+/*!
+ * \brief Get the number of slots.
+ *
+ * \return Number of blocks the ring can hold.
+ */
+std::size_t FifoShmReader::getNumSlots() const
+{
+    return numSlots;
+}
+
+//
+
+/*!
+ * \brief Get the next published block.
+ *
+ * Polls the ring (see pollInterval) until the next block is published, the writer is closed or \p pTimeout expired.
+ *
+ * If the reader fell behind such that the next blocks were overwritten already, these blocks are skipped
+ * and counted as lost (see getLostBlocks()) and the oldest block still in the ring is returned instead.
+ *
+ * The returned words are a view of the shared memory. The writer may overwrite them at any time once the reader
+ * fell behind by the number of slots. Use isValid() after processing the words to check that they were intact
+ * (or copy them and check then).
+ *
+ * \param pTimeout Maximum time to wait for a block (zero means only check once).
+ * \return The next block or \c std::nullopt on timeout or if the writer was closed and all blocks were taken (see atEnd()).
+ */
+std::optional<FifoShmReader::Block> FifoShmReader::next(const std::chrono::milliseconds pTimeout)
+{
+    const std::uint8_t* const base = mappedRing->getAddress();
+
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + pTimeout;
+
+    while (true)
+    {
+        //Load writer state first: once it is closed, the loaded number of published blocks is final
+
+        const bool writerClosed = (::loadUInt32(base + writerStateOffset) == 0);
+        const std::uint64_t published = ::loadUInt64(base + publishedOffset);
+
+        if (nextSequence < published)
+        {
+            if (published - nextSequence > numSlots)
+            {
+                lostBlocks += published - numSlots - nextSequence;
+                nextSequence = published - numSlots;
+            }
+
+            const std::uint64_t sequence = nextSequence++;
+            const std::uint8_t* const slot = base + ringHeaderSize + (sequence % numSlots) * getSlotStride(slotSize);
+
+            if (::loadUInt64(slot) == 2 * sequence + 2)
+            {
+                const std::uint32_t length = ::loadUInt32(slot + payloadLengthOffset, std::memory_order_relaxed);
+
+                //Slot must not have been reused while reading the length
+
+                if (isValid(sequence) && length <= slotSize)
+                    return Block{sequence, std::span<const std::uint32_t>(reinterpret_cast<const std::uint32_t*>(slot + slotHeaderSize),
+                                                                          length / 4)};
+            }
+
+            ++lostBlocks;
+
+            continue;
+        }
+
+        if (writerClosed || std::chrono::steady_clock::now() >= deadline)
+            return std::nullopt;
+
+        std::this_thread::sleep_for(pollInterval);
+    }
+}
+
+/*!
+ * \brief Check if a block is still complete and not overwritten.
+ *
+ * Call this after processing the words of a block returned by next() to verify that the
+ * writer did not start to overwrite them in the meantime (i.e. that the processed data was intact).
+ *
+ * \param pSequence Sequence number of the block.
+ * \return True if the slot of the block still holds the complete block.
+ */
+bool FifoShmReader::isValid(const std::uint64_t pSequence) const
+{
+    const std::uint8_t* const slot = mappedRing->getAddress() + ringHeaderSize + (pSequence % numSlots) * getSlotStride(slotSize);
+
+    //Order preceding reads of the block before the state check (seqlock)
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return (::loadUInt64(slot, std::memory_order_relaxed) == 2 * pSequence + 2);
+}
+
+/*!
+ * \brief Check if the writer was closed and all blocks were taken.
+ *
+ * \return True if no further block can be returned by next().
+ */
+bool FifoShmReader::atEnd() const
+{
+    const std::uint8_t* const base = mappedRing->getAddress();
+
+    if (::loadUInt32(base + writerStateOffset) != 0)
+        return false;
+
+    return (nextSequence >= ::loadUInt64(base + publishedOffset));
+}
+
+/*!
+ * \brief Get the number of blocks skipped because they were overwritten.
+ *
+ * \return Number of blocks the reader fell behind too far to get them.
+ */
+std::uint64_t FifoShmReader::getLostBlocks() const
+{
+    return lostBlocks;
+}
+
+//
+
+/*!
+ * \brief Get the distance of consecutive slots for a slot capacity.
+ *
+ * \param pSlotSize Slot capacity in bytes.
+ * \return Slot header size plus \p pSlotSize rounded up to a multiple of 64 bytes.
+ */
+std::size_t FifoShmReader::getSlotStride(const std::size_t pSlotSize)
+{
+    return slotHeaderSize + (pSlotSize + 63) / 64 * 64;
+}
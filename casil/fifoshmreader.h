@@ -0,0 +1,138 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_FIFOSHMREADER_H
+#define CASIL_FIFOSHMREADER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace casil
+{
+
+/*!
+ * \brief Reader for FIFO data blocks published to a named shared-memory ring by another process.
+ *
+ * A %SiTCP interface can publish its FIFO data to a named shared-memory ring instead of its FIFO buffer
+ * (see "init.fifo_shm_name" in Layers::TL::SiTCP::SiTCP()). Any number of readers (in any process
+ * on the same host) can then consume the blocks of data words concurrently, without copying them out of the ring.
+ *
+ * The ring consists of a fixed number of slots of a fixed capacity. Each slot holds one block of complete
+ * 32 bit FIFO data words (up to the slot capacity). The single writer fills the slots in turn and overwrites
+ * the oldest block without waiting for readers, i.e. a reader that falls behind by more than the number
+ * of slots loses blocks (see getLostBlocks()). Each slot carries a sequence state to detect this (see isValid()).
+ *
+ * The shared memory uses the native byte order and starts with a 64 byte ring header, followed by the slots:
+ *
+ * \code{.unparsed}
+ *
+ * Ring header:
+ *
+ * Byte 0-3:   Magic number "CFSR" (see ringMagic; written last when creating the ring)
+ * Byte 4-7:   Layout version (see layoutVersion)
+ * Byte 8-15:  Slot capacity in bytes (always a multiple of 4)
+ * Byte 16-23: Number of slots
+ * Byte 24-31: Number of published blocks (i.e. sequence number of the next block)
+ * Byte 32-35: Writer state (1 while the writer is open, 0 after it was closed)
+ * Byte 36-63: Reserved
+ *
+ * Slot for block N (at byte offset 64 + (N modulo number of slots) * slot stride;
+ * slot stride = 64 + slot capacity rounded up to a multiple of 64):
+ *
+ * Byte 0-7:   Slot state (2*N+1 while block N is being written, 2*N+2 once block N is complete)
+ * Byte 8-11:  Payload length in bytes (always a multiple of 4)
+ * Byte 12-63: Reserved
+ * Byte 64-..: Payload (the FIFO data words)
+ *
+ * \endcode
+ *
+ * The header fields at bytes 24, 32 and the slot states are accessed atomically (with release/acquire ordering).
+ * A block is complete and unchanged as long as the state of its slot equals \c 2*N+2 (seqlock protocol),
+ * hence the data of a block can be used in place and its integrity checked afterwards (see isValid()).
+ *
+ * Note: Readers only poll the ring (see next()). The class is not thread-safe. Users must synchronize access to this class themselves.
+ */
+class FifoShmReader
+{
+public:
+    /*!
+     * \brief Block of FIFO data words in the shared-memory ring.
+     */
+    struct Block
+    {
+        std::uint64_t sequence;                 ///< Sequence number of the block.
+        std::span<const std::uint32_t> words;   ///< View of the data words in the shared memory (valid while the reader exists).
+    };
+
+public:
+    explicit FifoShmReader(const std::string& pName, bool pFromOldest = false); ///< Constructor.
+    FifoShmReader(const FifoShmReader&) = delete;                   ///< Deleted copy constructor.
+    FifoShmReader(FifoShmReader&&) = delete;                        ///< Deleted move constructor.
+    ~FifoShmReader();                                               ///< Destructor.
+    //
+    FifoShmReader& operator=(FifoShmReader) = delete;               ///< Deleted copy assignment operator.
+    FifoShmReader& operator=(FifoShmReader&&) = delete;             ///< Deleted move assignment operator.
+    //
+    const std::string& getName() const;                             ///< Get the name of the shared-memory ring.
+    std::size_t getSlotSize() const;                                ///< Get the slot capacity in bytes.
+    std::size_t getNumSlots() const;                                ///< Get the number of slots.
+    //
+    std::optional<Block> next(std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero());
+                                                                    ///< Get the next published block.
+    bool isValid(std::uint64_t pSequence) const;                    ///< Check if a block is still complete and not overwritten.
+    bool atEnd() const;                                             ///< Check if the writer was closed and all blocks were taken.
+    std::uint64_t getLostBlocks() const;                            ///< Get the number of blocks skipped because they were overwritten.
+
+public:
+    static constexpr std::uint32_t ringMagic = 0x52534643u;         ///< Ring header magic number ("CFSR" in little endian).
+    static constexpr std::uint32_t layoutVersion = 1;               ///< Version of the shared-memory layout.
+    static constexpr std::size_t ringHeaderSize = 64;               ///< Size of the ring header in bytes.
+    static constexpr std::size_t slotHeaderSize = 64;               ///< Size of the slot header in bytes.
+    static constexpr std::size_t slotSizeOffset = 8;                ///< Byte offset of the slot capacity in the ring header.
+    static constexpr std::size_t numSlotsOffset = 16;               ///< Byte offset of the number of slots in the ring header.
+    static constexpr std::size_t publishedOffset = 24;              ///< Byte offset of the number of published blocks in the ring header.
+    static constexpr std::size_t writerStateOffset = 32;            ///< Byte offset of the writer state in the ring header.
+    static constexpr std::size_t payloadLengthOffset = 8;           ///< Byte offset of the payload length in the slot header.
+    static constexpr std::chrono::microseconds pollInterval {200};  ///< Interval for polling the ring while waiting for blocks.
+    //
+    static std::size_t getSlotStride(std::size_t pSlotSize);        ///< Get the distance of consecutive slots for a slot capacity.
+
+private:
+    struct MappedRing;                                              ///< Read-only mapping of the shared-memory ring.
+    //
+    const std::string name;                                         ///< Name of the shared-memory ring.
+    const std::unique_ptr<MappedRing> mappedRing;                   ///< Mapping of the ring.
+    std::size_t slotSize;                                           ///< Slot capacity in bytes.
+    std::size_t numSlots;                                           ///< Number of slots.
+    std::uint64_t nextSequence;                                     ///< Sequence number of the next block to take.
+    std::uint64_t lostBlocks;                                       ///< Number of blocks skipped because they were overwritten.
+};
+
+} // namespace casil
+
+#endif // CASIL_FIFOSHMREADER_H
@@ -0,0 +1,397 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/fifostream.h>
+
+#include <casil/logger.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <algorithm>
+#include <exception>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using casil::FifoStream;
+
+/*!
+ * \brief Pool of reusable word vectors for the blocks.
+ */
+struct FifoStream::BlockPool
+{
+    std::mutex mutex;                                                       ///< Mutex for \ref freeBlocks.
+    std::vector<std::unique_ptr<std::vector<std::uint32_t>>> freeBlocks;    ///< Unused blocks (keeping their capacity).
+};
+
+/*!
+ * \brief Constructor.
+ *
+ * \throws std::invalid_argument If \p pBlockWords or \p pQueueCapacity is zero.
+ *
+ * \param pInterface The %SiTCP interface whose FIFO shall be read.
+ * \param pBlockWords Number of data words per block.
+ * \param pQueueCapacity Maximum number of blocks in the queue.
+ */
+FifoStream::FifoStream(Layers::TL::SiTCP& pInterface, const std::size_t pBlockWords, const std::size_t pQueueCapacity) :
+    interface(pInterface),
+    blockWords(pBlockWords),
+    queueCapacity(pQueueCapacity),
+    blockPool(std::make_shared<BlockPool>()),
+    readThread(),
+    currentBlock(),
+    stopRequested(false),
+    finished(true),
+    dataPending(false),
+    queue(),
+    statistics{},
+    mutex(),
+    wakeCondVar(),
+    blockCondVar()
+{
+    if (blockWords == 0)
+        throw std::invalid_argument("Block size of FIFO stream must be positive.");
+
+    if (queueCapacity == 0)
+        throw std::invalid_argument("Queue capacity of FIFO stream must be positive.");
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops the reading thread (see stop()).
+ */
+FifoStream::~FifoStream()
+{
+    try
+    {
+        stop();
+    }
+    catch (const std::exception& exc)
+    {
+        Logger::logError(std::string("Exception while stopping FIFO stream: ") + exc.what());
+    }
+}
+
+//Public
+
+/*!
+ * \brief Get the number of words per block.
+ *
+ * \return Number of data words of every (but the final) block.
+ */
+std::size_t FifoStream::getBlockWords() const
+{
+    return blockWords;
+}
+
+//
+
+/*!
+ * \brief Start the reading thread.
+ *
+ * Registers a FIFO data notifier with the interface (see TL::SiTCP::setFifoDataNotifier()) and starts the thread
+ * that reads the FIFO into blocks. The FIFO is initially considered to have pending data,
+ * so data received before starting is read as well. Does nothing if already running.
+ */
+void FifoStream::start()
+{
+    if (isRunning())
+        return;
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        stopRequested = false;
+        finished = false;
+        dataPending = true;
+
+        if (!currentBlock)
+            currentBlock = takePooledBlock();
+    }
+
+    readThread = std::thread(&FifoStream::run, this);
+
+    interface.setFifoDataNotifier([this]() -> void { notifyData(); });
+}
+
+/*!
+ * \brief Stop the reading thread.
+ *
+ * Removes the FIFO data notifier from the interface and waits for the reading thread to finish. The words
+ * of the incomplete current block are queued as a final (smaller) block. Blocks already in the queue remain
+ * available (see getBlock()), while data not yet read from the FIFO stays there. Does nothing if not running.
+ */
+void FifoStream::stop()
+{
+    if (!isRunning())
+        return;
+
+    interface.setFifoDataNotifier({});
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        stopRequested = true;
+    }
+
+    wakeCondVar.notify_all();
+
+    readThread.join();
+}
+
+/*!
+ * \brief Check if the reading thread is running.
+ *
+ * \return True if running.
+ */
+bool FifoStream::isRunning() const
+{
+    return readThread.joinable();
+}
+
+/*!
+ * \brief Check if the stream is stopped and all blocks were taken.
+ *
+ * Can be used to distinguish the end of the stream from a timeout of getBlock().
+ *
+ * \return True if the reading thread has exited (or was not started) and the queue is empty.
+ */
+bool FifoStream::atEnd() const
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    return finished && queue.empty();
+}
+
+//
+
+/*!
+ * \brief Take the next block from the queue.
+ *
+ * Waits up to \p pTimeout for a block if the queue is empty. Returns immediately if the
+ * queue is empty and the stream is not running anymore (see atEnd()).
+ *
+ * \param pTimeout Maximum time to wait for a block.
+ * \return The oldest queued block or null if the queue remained empty.
+ */
+FifoStream::BlockType FifoStream::getBlock(const std::chrono::milliseconds pTimeout)
+{
+    std::unique_lock<std::mutex> stateLock(mutex);
+
+    if (!blockCondVar.wait_for(stateLock, pTimeout, [this]() -> bool { return !queue.empty() || finished; }) || queue.empty())
+        return nullptr;
+
+    BlockType block = std::move(queue.front());
+    queue.pop_front();
+
+    stateLock.unlock();
+    wakeCondVar.notify_one();
+
+    return block;
+}
+
+//
+
+/*!
+ * \brief Get the current stream counters.
+ *
+ * The counters accumulate over all runs since construction.
+ *
+ * \return Current statistics.
+ */
+FifoStream::Statistics FifoStream::getStatistics() const
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    return statistics;
+}
+
+//Private
+
+/*!
+ * \brief Read the FIFO into blocks until stopped.
+ *
+ * Sleeps until the FIFO has pending data (see notifyData()), then reads data into the current block (see fillBlock())
+ * and queues every completed block (see queueBlock()), until the FIFO is drained. Waits for free queue space before reading.
+ * Queues the incomplete current block (if not empty) when stopped.
+ */
+void FifoStream::run()
+{
+    std::unique_lock<std::mutex> stateLock(mutex);
+
+    while (true)
+    {
+        wakeCondVar.wait(stateLock, [this]() -> bool { return dataPending || stopRequested; });
+
+        if (stopRequested)
+            break;
+
+        ++statistics.wakeUps;
+
+        dataPending = false;
+
+        while (!stopRequested)
+        {
+            if (queue.size() >= queueCapacity)
+            {
+                ++statistics.queueStalls;
+
+                wakeCondVar.wait(stateLock, [this]() -> bool { return queue.size() < queueCapacity || stopRequested; });
+
+                if (stopRequested)
+                    break;
+            }
+
+            stateLock.unlock();
+
+            try
+            {
+                fillBlock();
+            }
+            catch (const std::exception& exc)
+            {
+                Logger::logError(std::string("FIFO stream failed to read FIFO: ") + exc.what());
+            }
+
+            stateLock.lock();
+
+            if (currentBlock->size() < blockWords)
+                break;
+
+            queueBlock();
+        }
+    }
+
+    if (!currentBlock->empty())
+        queueBlock();
+
+    finished = true;
+
+    stateLock.unlock();
+    blockCondVar.notify_all();
+}
+
+/*!
+ * \brief Read FIFO data into the current block.
+ *
+ * Reads at most as many words as missing to complete the current block.
+ */
+void FifoStream::fillBlock()
+{
+    const std::size_t missingWords = blockWords - currentBlock->size();
+
+    interface.consumeFifo([this](const std::span<const std::uint32_t> pFirst, const std::span<const std::uint32_t> pSecond) -> void
+                          {
+                              currentBlock->insert(currentBlock->end(), pFirst.begin(), pFirst.end());
+                              currentBlock->insert(currentBlock->end(), pSecond.begin(), pSecond.end());
+                          },
+                          static_cast<int>(std::min<std::size_t>(missingWords * 4, 0x7FFFFFFCu)));
+}
+
+/*!
+ * \brief Add the current block to the queue.
+ *
+ * Replaces the current block by an unused one from the pool (see takePooledBlock()).
+ *
+ * Note: \ref mutex must be locked by the caller.
+ */
+void FifoStream::queueBlock()
+{
+    ++statistics.blocksQueued;
+    statistics.wordsQueued += currentBlock->size();
+
+    queue.emplace_back(currentBlock.release(), [pool = blockPool, maxPooled = queueCapacity + 1](std::vector<std::uint32_t>* pBlock)
+                                               {
+                                                   std::unique_ptr<std::vector<std::uint32_t>> tBlock(pBlock);
+
+                                                   const std::lock_guard<std::mutex> poolLock(pool->mutex);
+                                                   (void)poolLock;
+
+                                                   if (pool->freeBlocks.size() < maxPooled)
+                                                       pool->freeBlocks.push_back(std::move(tBlock));
+                                               });
+
+    currentBlock = takePooledBlock();
+
+    blockCondVar.notify_one();
+}
+
+/*!
+ * \brief Take an unused block from the pool or allocate one.
+ *
+ * Note: \ref mutex must be locked by the caller.
+ *
+ * \return An empty block with capacity for a whole block.
+ */
+std::unique_ptr<std::vector<std::uint32_t>> FifoStream::takePooledBlock()
+{
+    std::unique_ptr<std::vector<std::uint32_t>> block;
+
+    {
+        const std::lock_guard<std::mutex> poolLock(blockPool->mutex);
+        (void)poolLock;
+
+        if (!blockPool->freeBlocks.empty())
+        {
+            block = std::move(blockPool->freeBlocks.back());
+            blockPool->freeBlocks.pop_back();
+        }
+    }
+
+    if (!block)
+    {
+        block = std::make_unique<std::vector<std::uint32_t>>();
+        block->reserve(blockWords);
+
+        ++statistics.blocksAllocated;
+    }
+
+    block->clear();
+
+    return block;
+}
+
+/*!
+ * \brief Mark the FIFO as having pending data.
+ *
+ * Called as FIFO data notifier of the interface (see start()); wakes the reading thread.
+ */
+void FifoStream::notifyData()
+{
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        if (dataPending)
+            return;
+
+        dataPending = true;
+    }
+
+    wakeCondVar.notify_one();
+}
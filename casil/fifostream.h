@@ -0,0 +1,136 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_FIFOSTREAM_H
+#define CASIL_FIFOSTREAM_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL { class SiTCP; }
+
+/*!
+ * \brief Prefetching readout of the FIFO of a \ref casil::TL::SiTCP "SiTCP" interface as a stream of fixed-size blocks.
+ *
+ * Reads the FIFO of a %SiTCP interface from a dedicated thread and delivers the data as blocks of a fixed number
+ * of words in a queue (see getBlock()). Instead of polling the FIFO, the thread sleeps until the interface signals
+ * new data (see TL::SiTCP::setFifoDataNotifier()). Consumers waiting for blocks sleep on a condition variable as well.
+ *
+ * The block memory is taken from a pool and returned to it when the last reference to a block is released,
+ * so a steady stream of blocks does not allocate. Blocks may outlive the stream.
+ *
+ * The queue is bounded. If it is full, the reading pauses and the data accumulates in the (growing)
+ * FIFO buffer of the interface until blocks are taken from the queue again.
+ *
+ * All blocks have the configured size (see FifoStream()) except for the final block queued by stop(),
+ * which contains the remaining words of the incomplete block (if any).
+ *
+ * Note: The interface must outlive the stream (or at least the running period). While running,
+ * the FIFO data notifier of the interface is occupied and the FIFO must not be read by other means.
+ *
+ * Note: The control functions (start(), stop()) are not thread-safe and must not be called concurrently.
+ * getBlock() can be called from any thread.
+ */
+class FifoStream
+{
+public:
+    using BlockType = std::shared_ptr<const std::vector<std::uint32_t>>;
+                                                                    ///< \brief Block of FIFO data words whose memory is returned to
+                                                                    ///  the pool of the stream when the last reference is released.
+
+    /*!
+     * \brief Snapshot of the stream counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t blocksQueued;     ///< Number of blocks added to the queue.
+        std::uint64_t wordsQueued;      ///< Number of data words added to the queue.
+        std::uint64_t wakeUps;          ///< Number of times the reading thread woke up to read the FIFO.
+        std::uint64_t queueStalls;      ///< Number of times the reading thread had to wait for a full queue.
+        std::uint64_t blocksAllocated;  ///< Number of blocks that had to be allocated because the pool was empty.
+    };
+
+public:
+    explicit FifoStream(Layers::TL::SiTCP& pInterface, std::size_t pBlockWords = 65536, std::size_t pQueueCapacity = 16);
+                                                                    ///< Constructor.
+    FifoStream(const FifoStream&) = delete;                         ///< Deleted copy constructor.
+    FifoStream(FifoStream&&) = delete;                              ///< Deleted move constructor.
+    ~FifoStream();                                                  ///< Destructor.
+    //
+    FifoStream& operator=(FifoStream) = delete;                     ///< Deleted copy assignment operator.
+    FifoStream& operator=(FifoStream&&) = delete;                   ///< Deleted move assignment operator.
+    //
+    std::size_t getBlockWords() const;                              ///< Get the number of words per block.
+    //
+    void start();                                                   ///< Start the reading thread.
+    void stop();                                                    ///< Stop the reading thread.
+    bool isRunning() const;                                         ///< Check if the reading thread is running.
+    bool atEnd() const;                                             ///< Check if the stream is stopped and all blocks were taken.
+    //
+    BlockType getBlock(std::chrono::milliseconds pTimeout = std::chrono::milliseconds::zero());
+                                                                    ///< Take the next block from the queue.
+    //
+    Statistics getStatistics() const;                               ///< Get the current stream counters.
+
+private:
+    void run();                                                     ///< Read the FIFO into blocks until stopped.
+    void fillBlock();                                               ///< Read FIFO data into the current block.
+    void queueBlock();                                              ///< Add the current block to the queue.
+    std::unique_ptr<std::vector<std::uint32_t>> takePooledBlock();  ///< Take an unused block from the pool or allocate one.
+    void notifyData();                                              ///< Mark the FIFO as having pending data.
+
+private:
+    Layers::TL::SiTCP& interface;                                   ///< The interface whose FIFO is read.
+    const std::size_t blockWords;                                   ///< Number of words per block.
+    const std::size_t queueCapacity;                                ///< Maximum number of queued blocks.
+    //
+    struct BlockPool;                                               ///< Pool of reusable word vectors for the blocks.
+    const std::shared_ptr<BlockPool> blockPool;                     ///< \brief Shared with the deleters of returned blocks
+                                                                    ///  such that blocks may outlive the stream.
+    //
+    std::thread readThread;                                         ///< Thread that reads the FIFO.
+    std::unique_ptr<std::vector<std::uint32_t>> currentBlock;       ///< Block currently being filled (used by reading thread only).
+    bool stopRequested;                                             ///< Flags the reading thread to exit.
+    bool finished;                                                  ///< Flags that the reading thread has exited (or was not started).
+    bool dataPending;                                               ///< Flags that the FIFO (may) have new data.
+    std::deque<BlockType> queue;                                    ///< Queue of blocks waiting to be taken.
+    Statistics statistics;                                          ///< Current counters.
+    mutable std::mutex mutex;                                       ///< Mutex for all of the above state except \ref currentBlock.
+    std::condition_variable wakeCondVar;                            ///< \brief Condition variable to wake the reading thread
+                                                                    ///  (pending data, free queue space or stop).
+    std::condition_variable blockCondVar;                           ///< Condition variable to wake threads waiting for blocks.
+};
+
+} // namespace casil
+
+#endif // CASIL_FIFOSTREAM_H
@@ -0,0 +1,303 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/interfaceregistry.h>
+
+#include <casil/layerconfig.h>
+#include <casil/layerfactory.h>
+#include <casil/TL/interface.h>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+using casil::InterfaceRegistry;
+
+/*!
+ * \brief Shared interface with its configuration and usage counters.
+ */
+struct InterfaceRegistry::Entry
+{
+    const std::string type;                                         ///< Type name of the interface.
+    const std::shared_ptr<const boost::property_tree::ptree> config;///< Configuration of the interface.
+    const std::unique_ptr<Interface> interface;                     ///< The shared interface.
+    std::size_t numLeases;                                          ///< Number of existing leases.
+    std::size_t numInitialized;                                     ///< Number of initialized leases.
+    std::mutex mutex;                                               ///< Mutex for the counters and for initializing/closing the interface.
+};
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Adds the lease to the lease count of \p pEntry. The lease is not initialized.
+ *
+ * \param pEntry The registry entry of the shared interface.
+ */
+InterfaceRegistry::Lease::Lease(std::shared_ptr<Entry> pEntry) :
+    entry(std::move(pEntry)),
+    initialized(false)
+{
+    const std::lock_guard<std::mutex> entryLock(entry->mutex);
+    (void)entryLock;
+
+    ++entry->numLeases;
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Releases the initialization of this lease (if initialized) and closes the shared interface
+ * if no other lease is initialized anymore (see close()). Errors during closing are ignored.
+ */
+InterfaceRegistry::Lease::~Lease()
+{
+    try
+    {
+        (void)close();
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+
+    const std::lock_guard<std::mutex> entryLock(entry->mutex);
+    (void)entryLock;
+
+    --entry->numLeases;
+}
+
+//Public
+
+/*!
+ * \brief Get the shared interface.
+ *
+ * The returned pointer shares ownership with the registry entry, i.e. it keeps the interface
+ * (and its entry, see InterfaceRegistry::acquire()) alive as well.
+ *
+ * \return The shared interface.
+ */
+std::shared_ptr<casil::TL::Interface> InterfaceRegistry::Lease::getInterface() const
+{
+    return std::shared_ptr<Interface>(entry, entry->interface.get());
+}
+
+//
+
+/*!
+ * \brief Initialize the shared interface unless initialized via another lease.
+ *
+ * Calls LayerBase::init() of the shared interface (forwarding \p pForce) if no \e other lease is initialized
+ * and counts this lease as initialized on success. Otherwise only counts this lease as initialized.
+ *
+ * Immediately returns true if this lease is already initialized, unless \p pForce is set.
+ *
+ * \param pForce Ignore initialized state.
+ * \return True if the shared interface is (now) initialized.
+ */
+bool InterfaceRegistry::Lease::init(const bool pForce)
+{
+    const std::lock_guard<std::mutex> entryLock(entry->mutex);
+    (void)entryLock;
+
+    if (initialized && !pForce)
+        return true;
+
+    const std::size_t numOthersInitialized = entry->numInitialized - (initialized ? 1 : 0);
+
+    if (numOthersInitialized == 0 && !entry->interface->init(pForce))
+        return false;
+
+    if (!initialized)
+    {
+        initialized = true;
+        ++entry->numInitialized;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Release the initialization of this lease and close the shared interface if no other lease is initialized.
+ *
+ * Releases the initialization of this lease (if initialized) and calls LayerBase::close() of the shared
+ * interface (forwarding \p pForce) if no other lease is initialized anymore. The interface is \e never
+ * closed while another lease is still initialized, also not if \p pForce is set.
+ *
+ * Immediately returns true if this lease is not initialized, unless \p pForce is set.
+ *
+ * \param pForce Ignore (not-)initialized state.
+ * \return True if the lease was successfully released and closing the interface (if applicable) succeeded.
+ */
+bool InterfaceRegistry::Lease::close(const bool pForce)
+{
+    const std::lock_guard<std::mutex> entryLock(entry->mutex);
+    (void)entryLock;
+
+    if (!initialized && !pForce)
+        return true;
+
+    if (initialized)
+    {
+        initialized = false;
+        --entry->numInitialized;
+    }
+
+    if (entry->numInitialized == 0)
+        return entry->interface->close(pForce);
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Get a lease of a shared interface.
+ *
+ * Returns a lease of the shared interface registered with share key \p pKey if that interface is still alive.
+ * Otherwise constructs a new interface of type \p pType with name \p pName and configuration \p pConfig using the
+ * LayerFactory, registers it with key \p pKey and returns a lease of it. The interface will be destroyed again
+ * as soon as all leases and all references obtained via Lease::getInterface() are released.
+ *
+ * \throws std::runtime_error If an interface with key \p pKey exists but has a different type or configuration.
+ * \throws std::runtime_error If \p pType is unknown or construction of the interface fails.
+ *
+ * \param pKey Share key of the interface.
+ * \param pType Type name of the interface.
+ * \param pName Name for a newly constructed interface.
+ * \param pConfig Configuration of the interface.
+ * \return New (not initialized) lease of the shared interface.
+ */
+std::unique_ptr<InterfaceRegistry::Lease> InterfaceRegistry::acquire(const std::string& pKey, const std::string& pType,
+                                                                     const std::string& pName,
+                                                                     std::shared_ptr<const boost::property_tree::ptree> pConfig)
+{
+    const std::lock_guard<std::mutex> registryLock(entriesMutex());
+    (void)registryLock;
+
+    std::erase_if(entries(), [](const auto& pKeyEntry) -> bool { return pKeyEntry.second.expired(); });
+
+    if (const auto it = entries().find(pKey); it != entries().end())
+    {
+        if (std::shared_ptr<Entry> entry = it->second.lock())
+        {
+            if (entry->type != pType || *entry->config != *pConfig)
+                throw std::runtime_error("Cannot share interface \"" + entry->interface->getName() + "\" with key \"" + pKey +
+                                         "\": The type or configuration differs.");
+
+            return std::make_unique<Lease>(std::move(entry));
+        }
+    }
+
+    std::unique_ptr<Interface> intf = LayerFactory::createInterface(pType, pName, LayerConfig(pConfig));
+
+    if (!intf)
+        throw std::runtime_error("Unknown interface type \"" + pType + "\".");
+
+    std::shared_ptr<Entry> entry(new Entry{pType, std::move(pConfig), std::move(intf), 0, 0, {}});
+
+    entries().insert_or_assign(pKey, entry);
+
+    return std::make_unique<Lease>(std::move(entry));
+}
+
+//
+
+/*!
+ * \brief Get the number of leases of a shared interface.
+ *
+ * \param pKey Share key of the interface.
+ * \return Number of existing leases (zero if no interface with key \p pKey is alive).
+ */
+std::size_t InterfaceRegistry::getNumLeases(const std::string& pKey)
+{
+    const std::lock_guard<std::mutex> registryLock(entriesMutex());
+    (void)registryLock;
+
+    const auto it = entries().find(pKey);
+
+    if (it == entries().end())
+        return 0;
+
+    const std::shared_ptr<Entry> entry = it->second.lock();
+
+    if (!entry)
+        return 0;
+
+    const std::lock_guard<std::mutex> entryLock(entry->mutex);
+    (void)entryLock;
+
+    return entry->numLeases;
+}
+
+/*!
+ * \brief Get the number of initialized leases of a shared interface.
+ *
+ * \param pKey Share key of the interface.
+ * \return Number of initialized leases (zero if no interface with key \p pKey is alive).
+ */
+std::size_t InterfaceRegistry::getNumInitialized(const std::string& pKey)
+{
+    const std::lock_guard<std::mutex> registryLock(entriesMutex());
+    (void)registryLock;
+
+    const auto it = entries().find(pKey);
+
+    if (it == entries().end())
+        return 0;
+
+    const std::shared_ptr<Entry> entry = it->second.lock();
+
+    if (!entry)
+        return 0;
+
+    const std::lock_guard<std::mutex> entryLock(entry->mutex);
+    (void)entryLock;
+
+    return entry->numInitialized;
+}
+
+//Private
+
+/*!
+ * \brief Access the map of shared interfaces with share keys as keys.
+ *
+ * \return Map of the registry entries.
+ */
+std::map<std::string, std::weak_ptr<InterfaceRegistry::Entry>>& InterfaceRegistry::entries()
+{
+    static std::map<std::string, std::weak_ptr<Entry>> sharedEntries = {};
+    return sharedEntries;
+}
+
+/*!
+ * \brief Access the mutex for entries().
+ *
+ * \return Registry mutex.
+ */
+std::mutex& InterfaceRegistry::entriesMutex()
+{
+    static std::mutex registryMutex;
+    return registryMutex;
+}
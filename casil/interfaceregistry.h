@@ -0,0 +1,111 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_INTERFACEREGISTRY_H
+#define CASIL_INTERFACEREGISTRY_H
+
+#include <boost/property_tree/ptree_fwd.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace casil
+{
+
+namespace Layers { namespace TL { class Interface; } }
+
+/*!
+ * \brief Process-wide registry of interfaces that are shared among multiple Device instances.
+ *
+ * Allows multiple Device instances of the same process to use a single instance of an interface, e.g. a single
+ * TL::SiTCP connection to a board that is controlled by separate devices (see Device(const boost::property_tree::ptree&, bool)).
+ * acquire() constructs the interface on first use of a share key and returns a Lease of it. Further acquire() calls with
+ * the same key return leases of the same interface instance as long as the interface is still alive, i.e. as long as
+ * a lease or a reference obtained via Lease::getInterface() exists.
+ *
+ * The leases count the initializations of the interface: Only the first Lease::init() actually initializes the interface
+ * and only the Lease::close() of the last initialized lease actually closes it again (see Lease).
+ *
+ * Note that the shared interface keeps the name it was constructed with by the first acquire() and that it will
+ * be accessed from all sharing devices, i.e. possibly concurrently if those are used from different threads.
+ */
+class InterfaceRegistry
+{
+private:
+    using Interface = Layers::TL::Interface;    ///< \copybrief casil::Layers::TL::Interface
+    //
+    struct Entry;                               ///< Shared interface with its configuration and usage counters.
+
+public:
+    /*!
+     * \brief Reference to a shared interface with reference-counted initialization.
+     *
+     * Keeps the shared interface alive. init() and close() replace LayerBase::init() and LayerBase::close() of
+     * the interface for the lease holder: The interface is initialized by the first initialized lease and closed
+     * when the last initialized lease gets closed (or destroyed). Closing a lease while other leases are still
+     * initialized only releases its own initialization, also if forced.
+     */
+    class Lease
+    {
+    public:
+        explicit Lease(std::shared_ptr<Entry> pEntry);      ///< Constructor.
+        Lease(const Lease&) = delete;                       ///< Deleted copy constructor.
+        Lease(Lease&&) = delete;                            ///< Deleted move constructor.
+        ~Lease();                                           ///< Destructor.
+        //
+        Lease& operator=(Lease) = delete;                   ///< Deleted copy assignment operator.
+        Lease& operator=(Lease&&) = delete;                 ///< Deleted move assignment operator.
+        //
+        std::shared_ptr<Interface> getInterface() const;    ///< Get the shared interface.
+        //
+        bool init(bool pForce = false);                     ///< Initialize the shared interface unless initialized via another lease.
+        bool close(bool pForce = false);                    ///< \brief Release the initialization of this lease and close the
+                                                            ///  shared interface if no other lease is initialized.
+
+    private:
+        const std::shared_ptr<Entry> entry;                 ///< The registry entry of the shared interface.
+        bool initialized;                                   ///< This lease holds one of the counted initializations.
+    };
+
+public:
+    InterfaceRegistry() = delete;                                                                   ///< Deleted constructor.
+    //
+    static std::unique_ptr<Lease> acquire(const std::string& pKey, const std::string& pType, const std::string& pName,
+                                          std::shared_ptr<const boost::property_tree::ptree> pConfig);
+                                                                                                    ///< Get a lease of a shared interface.
+    //
+    static std::size_t getNumLeases(const std::string& pKey);                                       ///< Get the number of leases of a shared interface.
+    static std::size_t getNumInitialized(const std::string& pKey);                                  ///< \brief Get the number of initialized
+                                                                                                    ///  leases of a shared interface.
+
+private:
+    static std::map<std::string, std::weak_ptr<Entry>>& entries();  ///< Access the map of shared interfaces with share keys as keys.
+    static std::mutex& entriesMutex();                              ///< Access the mutex for entries().
+};
+
+} // namespace casil
+
+#endif // CASIL_INTERFACEREGISTRY_H
@@ -23,16 +23,53 @@
 
 #include <casil/layerbase.h>
 
+#include <casil/allocations.h>
 #include <casil/auxil.h>
 #include <casil/logger.h>
+#include <casil/tracer.h>
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
 using casil::LayerBase;
 
+namespace
+{
+
+/*
+ * Converts the log level name 'pName' as used in the component configuration (e.g. "Debug") to the
+ * corresponding log level. Returns std::nullopt if 'pName' is not a valid log level name.
+ */
+std::optional<casil::Logger::LogLevel> logLevelFromName(const std::string& pName)
+{
+    using LogLevel = casil::Logger::LogLevel;
+
+    static const std::map<std::string, LogLevel, std::less<>> levels = {{"None", LogLevel::None},
+                                                                         {"Critical", LogLevel::Critical},
+                                                                         {"Error", LogLevel::Error},
+                                                                         {"Warning", LogLevel::Warning},
+                                                                         {"Success", LogLevel::Success},
+                                                                         {"Info", LogLevel::Info},
+                                                                         {"More", LogLevel::More},
+                                                                         {"Verbose", LogLevel::Verbose},
+                                                                         {"Debug", LogLevel::Debug},
+                                                                         {"DebugDebug", LogLevel::DebugDebug}};
+
+    if (const auto it = levels.find(pName); it != levels.end())
+        return it->second;
+
+    return std::nullopt;
+}
+
+} // namespace
+
 /*!
  * \brief Constructor.
  *
@@ -41,7 +78,11 @@ using casil::LayerBase;
  *
  * Checks that \p pRequiredConfig is "contained" in \p pConfig (see LayerConfig::contains()).
  *
+ * The optional configuration key "log_level" (e.g. <tt>log_level: Debug</tt>, using the names of Logger::LogLevel)
+ * can be used with any component type in order to override the log level for this component (see setLogLevel()).
+ *
  * \throws std::runtime_error If \p pConfig is incomplete/invalid because \p pRequiredConfig is not contained.
+ * \throws std::runtime_error If \p pConfig contains an invalid "log_level" value.
  *
  * \param pLayer %Layer that this component belongs to.
  * \param pType Name of the component type (as registered to the LayerFactory).
@@ -56,15 +97,31 @@ LayerBase::LayerBase(const Layer pLayer, std::string pType, std::string pName, L
     config(std::move(pConfig)),
     initialized(false),
     logger(*this),  //Note: needs/accesses members layer, type and name
+    traceSource(Tracer::registerSource((layer == Layer::TransferLayer ? "TL/" : (layer == Layer::HardwareLayer ? "HL/" : "RL/")) +
+                                       type + "/\"" + name + "\"")),
+    metricsLabels{{"layer", (layer == Layer::TransferLayer ? "TL" : (layer == Layer::HardwareLayer ? "HL" : "RL"))},
+                  {"type", type}, {"name", name}},
     selfDescription("\"" + type + "\"-" +
                     (layer == Layer::TransferLayer ? "interface" : (layer == Layer::HardwareLayer ? "driver" : "register")) +
-                    " instance \"" + name + "\"")
+                    " instance \"" + name + "\""),
+    timingHistograms(std::make_unique<std::array<std::atomic<Metrics::Histogram*>, Timing::numOperations>>()),
+    allocationCounters(std::make_unique<std::array<std::atomic<Metrics::Counter*>, 2 * Timing::numOperations>>())
 {
     if (!config.contains(pRequiredConfig, true))
     {
         throw std::runtime_error("Incomplete/invalid configuration for " + getSelfDescription() + ". Passed configuration:\n" +
                                  config.toString() + "Required configuration:\n" + pRequiredConfig.toString());
     }
+
+    if (const std::optional<std::string> logLevelName = config.getStrOpt("log_level"); logLevelName.has_value())
+    {
+        const std::optional<Logger::LogLevel> logLevel = ::logLevelFromName(*logLevelName);
+
+        if (!logLevel.has_value())
+            throw std::runtime_error("Invalid log level \"" + *logLevelName + "\" configured for " + getSelfDescription() + ".");
+
+        logger.setLevelOverride(logLevel);
+    }
 }
 
 //Public
@@ -122,10 +179,14 @@ bool LayerBase::init(const bool pForce)
 
     initialized = false;
 
-    Logger::logDebug("Initializing " + getSelfDescription() + "...");
+    CASIL_LOG_DEBUG("Initializing " + getSelfDescription() + "...");
 
-    if (!initImpl())
-        return false;
+    {
+        const Timing::Scope timing = timeOperation(Timing::Operation::Init);
+
+        if (!initImpl())
+            return false;
+    }
 
     initialized = true;
 
@@ -151,10 +212,14 @@ bool LayerBase::close(const bool pForce)
     if (!initialized && !pForce)
         return true;
 
-    Logger::logDebug("Closing " + getSelfDescription() + "...");
+    CASIL_LOG_DEBUG("Closing " + getSelfDescription() + "...");
 
-    if (!closeImpl())
-        return false;
+    {
+        const Timing::Scope timing = timeOperation(Timing::Operation::Close);
+
+        if (!closeImpl())
+            return false;
+    }
 
     initialized = false;
 
@@ -199,6 +264,30 @@ bool LayerBase::loadRuntimeConfiguration(const std::string& pConf)
     }
 }
 
+/*!
+ * \brief Load additional, component-specific configuration data/values from a configuration tree.
+ *
+ * Works like loadRuntimeConfiguration(const std::string&) but takes the runtime configuration as an already
+ * assembled tree (with the same structure as obtained from Auxil::propertyTreeFromYAML()), which avoids
+ * generating and parsing a YAML document for configurations that are created programmatically.
+ *
+ * \param pConf Desired runtime configuration tree.
+ * \return If successful.
+ */
+bool LayerBase::loadRuntimeConfiguration(boost::property_tree::ptree pConf)
+{
+    try
+    {
+        loadRuntimeConfImpl(std::move(pConf));
+        return true;
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(std::string("Could not load runtime configuration: ") + exc.what());
+        return false;
+    }
+}
+
 /*!
  * \brief Save current state of component-specific configuration data/values.
  *
@@ -233,6 +322,141 @@ std::string LayerBase::dumpRuntimeConfiguration() const
     }
 }
 
+/*!
+ * \brief Load component-specific configuration data/values from a binary snapshot.
+ *
+ * Binary counterpart of loadRuntimeConfiguration(), which avoids the overhead of parsing a YAML document.
+ * \p pSnapshot must have been obtained from dumpRuntimeSnapshot() of a component of the same type
+ * (the binary format is component-specific and not meant to be edited by hand).
+ *
+ * If \p pSnapshot is empty an empty runtime configuration will be applied (as for loadRuntimeConfiguration()).
+ *
+ * \internal The component-specific logic is to be implemented by loadRuntimeSnapshotImpl(). \endinternal
+ *
+ * Note: It is assumed that both functions (this one and dumpRuntimeSnapshot())
+ * are only used when the component is initialized.
+ *
+ * \param pSnapshot Desired runtime configuration as binary snapshot.
+ * \return If successful.
+ */
+bool LayerBase::loadRuntimeSnapshot(const std::span<const std::uint8_t> pSnapshot)
+{
+    try
+    {
+        loadRuntimeSnapshotImpl(pSnapshot);
+        return true;
+    }
+    catch (const std::runtime_error& exc)
+    {
+        logger.logError(std::string("Could not load runtime snapshot: ") + exc.what());
+        return false;
+    }
+}
+
+/*!
+ * \brief Save current state of component-specific configuration data/values as a binary snapshot.
+ *
+ * Binary counterpart of dumpRuntimeConfiguration(), which avoids the overhead of generating a YAML document.
+ * The snapshot can be applied to the component using the complementary function loadRuntimeSnapshot().
+ *
+ * An empty byte sequence will be returned if the component does not implement runtime
+ * configuration or if it does not currently hold such data.
+ *
+ * \internal The component-specific logic is to be implemented by dumpRuntimeSnapshotImpl(). \endinternal
+ *
+ * Note: It is assumed that both functions are only used when the component is initialized.
+ *
+ * \throws std::runtime_error If assembling the snapshot fails.
+ *
+ * \return Current runtime configuration as binary snapshot.
+ */
+std::vector<std::uint8_t> LayerBase::dumpRuntimeSnapshot() const
+{
+    try
+    {
+        return dumpRuntimeSnapshotImpl();
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not dump runtime snapshot for " + getSelfDescription() + ": " + exc.what());
+    }
+}
+
+//
+
+/*!
+ * \brief Get summaries of the timed operations of this component.
+ *
+ * Summarizes the latency histograms of all operations of this component that were timed so far (see Timing).
+ *
+ * \return Timing summaries by operation name (see Timing::operationToLabel()).
+ */
+std::map<std::string, casil::Timing::Summary> LayerBase::getTimings() const
+{
+    std::map<std::string, Timing::Summary> timings;
+
+    for (std::size_t i = 0; i < Timing::numOperations; ++i)
+    {
+        if (const Metrics::Histogram* const histogram = (*timingHistograms)[i].load(std::memory_order_acquire); histogram != nullptr)
+            timings[Timing::operationToLabel(static_cast<Timing::Operation>(i))] = Timing::getSummary(*histogram);
+    }
+
+    return timings;
+}
+
+/*!
+ * \brief Estimate the heap memory used by this component.
+ *
+ * Reports the estimated number of allocated bytes by category. Every component reports the categories "config"
+ * (see LayerConfig::getMemoryUsage()) and "strings" (names and descriptions), to which the component-specific categories
+ * are added (see the specific component). The numbers are estimates based on sizes and capacities of the used
+ * containers (see Auxil::estimateHeapUsage()), not measurements of the actual allocator usage.
+ *
+ * \internal The component-specific categories are provided by getMemoryUsageImpl(). \endinternal
+ *
+ * \return Estimated numbers of allocated bytes by category.
+ */
+std::map<std::string, std::size_t> LayerBase::getMemoryUsage() const
+{
+    std::map<std::string, std::size_t> usage = {
+        {"config", config.getMemoryUsage()},
+        {"strings", Auxil::estimateHeapUsage(type) + Auxil::estimateHeapUsage(name) + Auxil::estimateHeapUsage(selfDescription)}
+    };
+
+    for (const auto& [category, bytes] : getMemoryUsageImpl())
+        usage[category] += bytes;
+
+    return usage;
+}
+
+//
+
+/*!
+ * \brief Override the log level for this component.
+ *
+ * Log messages of this component (see \ref logger) are filtered by \p pLevel instead of the global log level
+ * (see Logger::setLogLevel()) or the component type's override (see ContextualLogger::setTypeLevelOverride()).
+ * Pass \c std::nullopt to remove the override again. See also ContextualLogger::setLevelOverride().
+ *
+ * \param pLevel The new log level for this component or \c std::nullopt.
+ */
+void LayerBase::setLogLevel(const std::optional<Logger::LogLevel> pLevel)
+{
+    logger.setLevelOverride(pLevel);
+}
+
+/*!
+ * \brief Get the log level override of this component.
+ *
+ * See setLogLevel().
+ *
+ * \return The overriding log level or \c std::nullopt if not overridden.
+ */
+std::optional<casil::Logger::LogLevel> LayerBase::getLogLevel() const
+{
+    return logger.getLevelOverride();
+}
+
 //Protected
 
 /*!
@@ -247,6 +471,57 @@ const std::string& LayerBase::getSelfDescription() const
     return selfDescription;
 }
 
+/*!
+ * \brief Start timing an operation of this component.
+ *
+ * Returns an active Timing::Scope for the component's latency histogram of \p pOperation
+ * (see Timing::getHistogram(), registered on first use) if timing is enabled (see Timing::isEnabled())
+ * and an inactive scope otherwise.
+ *
+ * If allocation counting is available (see Allocations::isAvailable()), the scope also counts the operation's allocations
+ * (see Timing::getAllocationsCounter() and Timing::getAllocatedBytesCounter(), registered on first use).
+ *
+ * \param pOperation The timed operation.
+ * \return Scope that times the operation until its destruction.
+ */
+casil::Timing::Scope LayerBase::timeOperation(const Timing::Operation pOperation) const
+{
+    if (!Timing::isEnabled())
+        return Timing::Scope(nullptr);
+
+    std::atomic<Metrics::Histogram*>& histogramPtr = (*timingHistograms)[static_cast<std::size_t>(pOperation)];
+
+    Metrics::Histogram* histogram = histogramPtr.load(std::memory_order_acquire);
+
+    if (histogram == nullptr)
+    {
+        histogram = &Timing::getHistogram(Timing::operationToLabel(pOperation), metricsLabels);
+        histogramPtr.store(histogram, std::memory_order_release);
+    }
+
+    static const bool countAllocations = Allocations::isAvailable();
+
+    if (!countAllocations)
+        return Timing::Scope(histogram);
+
+    std::atomic<Metrics::Counter*>& allocationsPtr = (*allocationCounters)[2 * static_cast<std::size_t>(pOperation)];
+    std::atomic<Metrics::Counter*>& bytesPtr = (*allocationCounters)[2 * static_cast<std::size_t>(pOperation) + 1];
+
+    Metrics::Counter* allocations = allocationsPtr.load(std::memory_order_acquire);
+    Metrics::Counter* bytes = bytesPtr.load(std::memory_order_acquire);
+
+    if (allocations == nullptr || bytes == nullptr)
+    {
+        bytes = &Timing::getAllocatedBytesCounter(Timing::operationToLabel(pOperation), metricsLabels);
+        bytesPtr.store(bytes, std::memory_order_release);
+
+        allocations = &Timing::getAllocationsCounter(Timing::operationToLabel(pOperation), metricsLabels);
+        allocationsPtr.store(allocations, std::memory_order_release);
+    }
+
+    return Timing::Scope(histogram, allocations, bytes);
+}
+
 //Private
 
 /*!
@@ -276,3 +551,50 @@ boost::property_tree::ptree LayerBase::dumpRuntimeConfImpl() const
 {
     return boost::property_tree::ptree();
 }
+
+//
+
+/*!
+ * \brief Perform component-specific loading of a runtime snapshot.
+ *
+ * Deserializes \p pSnapshot via Auxil::propertyTreeFromBinary() and passes the tree to loadRuntimeConfImpl()
+ * (override for specific components if a more direct binary representation is applicable).
+ *
+ * \throws std::runtime_error If deserializing \p pSnapshot fails.
+ * \throws std::runtime_error If loadRuntimeConfImpl() throws \c std::runtime_error.
+ *
+ * \param pSnapshot Desired runtime configuration as binary snapshot.
+ */
+void LayerBase::loadRuntimeSnapshotImpl(const std::span<const std::uint8_t> pSnapshot)
+{
+    loadRuntimeConfImpl(Auxil::propertyTreeFromBinary(pSnapshot));
+}
+
+/*!
+ * \brief Perform component-specific saving of a runtime snapshot.
+ *
+ * Serializes the tree from dumpRuntimeConfImpl() via Auxil::propertyTreeToBinary()
+ * (override for specific components if a more direct binary representation is applicable).
+ *
+ * \throws std::runtime_error If dumpRuntimeConfImpl() or the serialization throws \c std::runtime_error.
+ *
+ * \return Current runtime configuration as binary snapshot.
+ */
+std::vector<std::uint8_t> LayerBase::dumpRuntimeSnapshotImpl() const
+{
+    return Auxil::propertyTreeToBinary(dumpRuntimeConfImpl());
+}
+
+//
+
+/*!
+ * \brief Estimate the component-specific heap memory usage.
+ *
+ * Does not report anything by default (override for specific components).
+ *
+ * \return Estimated numbers of allocated bytes by category (see getMemoryUsage()).
+ */
+std::map<std::string, std::size_t> LayerBase::getMemoryUsageImpl() const
+{
+    return {};
+}
@@ -26,11 +26,26 @@
 
 #include <casil/contextuallogger.h>
 #include <casil/layerconfig.h>
+#include <casil/logger.h>
+#include <casil/metrics.h>
+#include <casil/timing.h>
 
 #include <boost/property_tree/ptree_fwd.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace casil
 {
@@ -45,6 +60,10 @@ namespace casil
  * See the classes next in the hierarchy (in the Layers namespace) for how to implement
  * components for the specific layers (transfer layer: \ref casil::Layers::TL::Interface "TL::Interface",
  * hardware layer: \ref casil::Layers::HL::Driver "HL::Driver", register layer: \ref casil::Layers::RL::Register "RL::Register").
+ *
+ * Every component can queue operations on the asynchronous executor of the interface it is ultimately bound to
+ * (see postAsync() and runAsync()). Operations of components bound to the same interface are thus executed one after another
+ * in queueing order, without further locking, while operations on different interfaces (e.g. different boards) run in parallel.
  */
 class LayerBase
 {
@@ -69,10 +88,36 @@ public:
     bool close(bool pForce = false);                            ///< Close ("uninitialize") this layer component.
     //
     bool loadRuntimeConfiguration(const std::string& pConf);    ///< Load additional, component-specific configuration data/values.
+    bool loadRuntimeConfiguration(boost::property_tree::ptree pConf);   ///< \brief Load additional, component-specific configuration
+                                                                        ///  data/values from a configuration tree.
     std::string dumpRuntimeConfiguration() const;               ///< Save current state of component-specific configuration data/values.
+    //
+    bool loadRuntimeSnapshot(std::span<const std::uint8_t> pSnapshot);  ///< Load component-specific configuration data/values from a binary snapshot.
+    std::vector<std::uint8_t> dumpRuntimeSnapshot() const;              ///< \brief Save current state of component-specific configuration
+                                                                        ///  data/values as a binary snapshot.
+    //
+    std::map<std::string, Timing::Summary> getTimings() const;  ///< Get summaries of the timed operations of this component.
+    std::map<std::string, std::size_t> getMemoryUsage() const;  ///< Estimate the heap memory used by this component.
+    //
+    void setLogLevel(std::optional<Logger::LogLevel> pLevel);   ///< Override the log level for this component.
+    std::optional<Logger::LogLevel> getLogLevel() const;        ///< Get the log level override of this component.
+    //
+    /*!
+     * \brief Queue a task for serialized execution on the asynchronous executor of the interface this component is bound to.
+     *
+     * See TL::Interface::postAsync().
+     *
+     * \param pTask Task to be executed.
+     */
+    virtual void postAsync(std::function<void()> pTask) const = 0;
+    template<typename FuncT>
+    std::future<std::invoke_result_t<FuncT&>> runAsync(FuncT pFunc) const;  ///< \brief Run a function on the asynchronous executor
+                                                                            ///  of the interface this component is bound to.
 
 protected:
     const std::string& getSelfDescription() const;              ///< Get a standard description of this layer component for logging purposes.
+    //
+    Timing::Scope timeOperation(Timing::Operation pOperation) const;    ///< Start timing an operation of this component.
 
 private:
     /*!
@@ -90,6 +135,11 @@ private:
     //
     virtual void loadRuntimeConfImpl(boost::property_tree::ptree&& pConf);  ///< Perform component-specific loading of runtime configuration.
     virtual boost::property_tree::ptree dumpRuntimeConfImpl() const;        ///< Perform component-specific saving of runtime configuration.
+    //
+    virtual void loadRuntimeSnapshotImpl(std::span<const std::uint8_t> pSnapshot); ///< Perform component-specific loading of a runtime snapshot.
+    virtual std::vector<std::uint8_t> dumpRuntimeSnapshotImpl() const;             ///< Perform component-specific saving of a runtime snapshot.
+    //
+    virtual std::map<std::string, std::size_t> getMemoryUsageImpl() const;  ///< Estimate the component-specific heap memory usage.
 
 protected:
     const Layer layer;                              ///< %Layer that this layer component belongs to.
@@ -101,9 +151,18 @@ protected:
     bool initialized;                               ///< Initialized and not closed.
     //
     const ContextualLogger logger;                  ///< Logger instance (automatically adding information about this component to each entry).
+    //
+    const std::uint32_t traceSource;                ///< Source ID of this component for transaction tracing (see Tracer).
+    const Metrics::Labels metricsLabels;            ///< Labels "layer", "type" and "name" for the metrics of this component (see Metrics).
 
 private:
     const std::string selfDescription;              ///< Standard description of the layer component for logging purposes.
+    //
+    std::unique_ptr<std::array<std::atomic<Metrics::Histogram*>, Timing::numOperations>> timingHistograms;
+                                                    ///< Lazily registered latency histograms of the timed operations (see timeOperation()).
+    std::unique_ptr<std::array<std::atomic<Metrics::Counter*>, 2 * Timing::numOperations>> allocationCounters;
+                                                    ///< \brief Lazily registered allocation and allocated bytes counters (alternating)
+                                                    ///  of the timed operations (see timeOperation()).
 
 public:
     /*!
@@ -118,6 +177,30 @@ public:
     };
 };
 
+/*!
+ * \brief Run a function on the asynchronous executor of the interface this component is bound to.
+ *
+ * Queues \p pFunc for execution via postAsync(), i.e. \p pFunc will be executed after all previously queued tasks
+ * of components bound to the same interface, possibly concurrently with tasks of other interfaces.
+ *
+ * Exceptions thrown by \p pFunc are stored in the returned future and rethrown by \c std::future::get().
+ *
+ * \tparam FuncT Type of the function object to be executed (without arguments).
+ * \param pFunc Function object to be executed.
+ * \return Future for the return value of \p pFunc.
+ */
+template<typename FuncT>
+std::future<std::invoke_result_t<FuncT&>> LayerBase::runAsync(FuncT pFunc) const
+{
+    auto task = std::make_shared<std::packaged_task<std::invoke_result_t<FuncT&>()>>(std::move(pFunc));
+
+    std::future<std::invoke_result_t<FuncT&>> future = task->get_future();
+
+    postAsync([task]() -> void { (*task)(); });
+
+    return future;
+}
+
 /*!
  * \brief Starting point for the differentiation into the three layers of the basil layer structure with their associated layer components.
  *
@@ -31,7 +31,9 @@
 #include <yaml-cpp/node/impl.h>     //Keep include order!
 
 #include <functional>
+#include <mutex>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <sstream>
 
@@ -39,68 +41,111 @@ namespace
 {
 
 using boost::property_tree::ptree;
-using boost::property_tree::ptree_bad_path;
+
+constexpr std::size_t maxCachedYAMLConfigs = 1024;  //Cache for LayerConfig::fromYAML() is cleared when reaching this size
 
 /*
- * Parses and returns the value sequence stored in the configuration tree 'pTree'
- * at branch location 'pKey' with sequence elements converted to integer type 'T'.
+ * Converts the value of the scalar node 'pNode' to type 'T' in accordance with the YAML specification.
  *
- * Returns std::nullopt if the conversion fails or if 'pKey' is not found.
+ * Returns std::nullopt if the conversion fails.
  */
 template<typename T>
-    requires std::is_integral_v<T>
-std::optional<std::vector<T>> geTSeq(const ptree& pTree, const std::string& pKey)
+std::optional<T> convertScalar(const YAML::Node& pNode)
 {
     try
     {
-        const ptree& subTree = pTree.get_child(pKey);
+        return pNode.as<T>();
+    }
+    catch (const YAML::BadConversion&)
+    {
+        return std::nullopt;
+    }
+}
 
-        if (subTree.data() != "")
-            return std::nullopt;
+/*
+ * Converts the values of the child nodes of the configuration tree 'pTree' to a sequence of integer type 'T'.
+ *
+ * Returns std::nullopt if 'pTree' has a value itself, if a child is not a non-empty scalar or if a conversion fails.
+ */
+template<typename T>
+    requires std::is_integral_v<T>
+std::optional<std::vector<T>> convertSeq(const ptree& pTree)
+{
+    if (pTree.data() != "")
+        return std::nullopt;
 
-        std::vector<T> retSeq;
-        retSeq.reserve(subTree.size());
+    std::vector<T> retSeq;
+    retSeq.reserve(pTree.size());
 
-        for (const auto& [seqKey, seqVal] : subTree)
-        {
-            (void)seqKey;
+    for (const auto& [seqKey, seqVal] : pTree)
+    {
+        (void)seqKey;
 
-            if (seqVal.data() == "" || !seqVal.empty())
-                return std::nullopt;
+        if (seqVal.data() == "" || !seqVal.empty())
+            return std::nullopt;
 
-            try
-            {
-                YAML::Node tNode(YAML::NodeType::Scalar);
-                tNode = seqVal.data();
-                retSeq.push_back(tNode.as<T>());
-            }
-            catch (const YAML::BadConversion&)
-            {
-                return std::nullopt;
-            }
-        }
+        YAML::Node tNode(YAML::NodeType::Scalar);
+        tNode = seqVal.data();
 
-        return retSeq;
-    }
-    catch (const ptree_bad_path&)
-    {
-        return std::nullopt;
+        const std::optional<T> val = convertScalar<T>(tNode);
+
+        if (!val)
+            return std::nullopt;
+
+        retSeq.push_back(val.value());
     }
+
+    return retSeq;
 }
 
 } // namespace
 
 using casil::LayerConfig;
 
+/*!
+ * \brief Default constructor.
+ *
+ * Creates an empty configuration.
+ */
+LayerConfig::LayerConfig() :
+    LayerConfig(boost::property_tree::ptree())
+{
+}
+
 /*!
  * \brief Constructor.
  *
- * Loads \p pTree as the configuration tree.
+ * Loads \p pTree as the configuration tree and pre-converts all of its values (see compileTree()).
  *
  * \param pTree Component configuration tree with format according to Auxil::propertyTreeFromYAML.
  */
 LayerConfig::LayerConfig(const boost::property_tree::ptree& pTree) :
-    tree(pTree)
+    data(makeSharedData(std::make_shared<const boost::property_tree::ptree>(pTree)))
+{
+}
+
+/*!
+ * \brief Constructor.
+ *
+ * Takes over \p pTree as the configuration tree (without copying it) and pre-converts all of its values (see compileTree()).
+ *
+ * \param pTree Component configuration tree with format according to Auxil::propertyTreeFromYAML.
+ */
+LayerConfig::LayerConfig(boost::property_tree::ptree&& pTree) :
+    data(makeSharedData(std::make_shared<const boost::property_tree::ptree>(std::move(pTree))))
+{
+}
+
+/*!
+ * \brief Constructor.
+ *
+ * Shares \p pTree as the configuration tree (without copying it) and pre-converts all of its values (see compileTree()).
+ * The tree must not be modified anymore afterwards. A null pointer is treated as empty tree.
+ *
+ * \param pTree Component configuration tree with format according to Auxil::propertyTreeFromYAML.
+ */
+LayerConfig::LayerConfig(std::shared_ptr<const boost::property_tree::ptree> pTree) :
+    data(makeSharedData(pTree ? std::move(pTree) : std::make_shared<const boost::property_tree::ptree>()))
 {
 }
 
@@ -116,7 +161,7 @@ LayerConfig::LayerConfig(const boost::property_tree::ptree& pTree) :
  */
 bool LayerConfig::operator==(const LayerConfig& pOther) const
 {
-    return (tree == pOther.tree);
+    return (data == pOther.data || *data->tree == *pOther.data->tree);
 }
 
 //
@@ -142,6 +187,11 @@ bool LayerConfig::operator==(const LayerConfig& pOther) const
  *
  * This function returns false if a branch from \p pOther is not found or if a type check fails.
  *
+ * If the paths of all tree nodes of both configurations are unique (the usual case), the check is a single flat pass
+ * over the pre-converted values of \p pOther (see containsFlat()), without walking the trees or converting any values.
+ * Since the object returned by fromYAML() is cached, a required configuration that is used for every instance
+ * of a component type is hence parsed and compiled only once.
+ *
  * Example with YAML code:
  * <tt>{init: {port: /dev/ttyUSB1, baudrate: 19200, nested: [1, 2, 3]}}</tt> contains
  * <tt>{init: {port: string, nested: byteSeq}}</tt> with type check enabled.
@@ -152,6 +202,9 @@ bool LayerConfig::operator==(const LayerConfig& pOther) const
  */
 bool LayerConfig::contains(const LayerConfig& pOther, const bool pCheckTypes) const
 {
+    if (data->pathsUnique && pOther.data->pathsUnique)
+        return containsFlat(pOther, pCheckTypes);
+
     using boost::property_tree::ptree;
 
     std::function<bool(const ptree&, const ptree&)> checkSubTree = [&checkSubTree, pCheckTypes](const ptree& pRefTree,
@@ -228,7 +281,7 @@ bool LayerConfig::contains(const LayerConfig& pOther, const bool pCheckTypes) co
         return true;
     };
 
-    return checkSubTree(pOther.tree, tree);
+    return checkSubTree(*pOther.data->tree, *data->tree);
 }
 
 //
@@ -245,16 +298,8 @@ bool LayerConfig::contains(const LayerConfig& pOther, const bool pCheckTypes) co
  */
 std::optional<bool> LayerConfig::getBoolOpt(const std::string& pKey) const
 {
-    try
-    {
-        YAML::Node tNode(YAML::NodeType::Scalar);
-        tNode = getStr(pKey, "");
-        return tNode.as<bool>();
-    }
-    catch (const YAML::BadConversion&)
-    {
-        return std::nullopt;
-    }
+    const CompiledValue* const val = findCompiled(pKey);
+    return val ? val->boolVal : std::nullopt;
 }
 
 /*!
@@ -269,16 +314,8 @@ std::optional<bool> LayerConfig::getBoolOpt(const std::string& pKey) const
  */
 std::optional<int> LayerConfig::getIntOpt(const std::string& pKey) const
 {
-    try
-    {
-        YAML::Node tNode(YAML::NodeType::Scalar);
-        tNode = getStr(pKey, "");
-        return tNode.as<int>();
-    }
-    catch (const YAML::BadConversion&)
-    {
-        return std::nullopt;
-    }
+    const CompiledValue* const val = findCompiled(pKey);
+    return val ? val->intVal : std::nullopt;
 }
 
 /*!
@@ -293,16 +330,8 @@ std::optional<int> LayerConfig::getIntOpt(const std::string& pKey) const
  */
 std::optional<std::uint64_t> LayerConfig::getUIntOpt(const std::string& pKey) const
 {
-    try
-    {
-        YAML::Node tNode(YAML::NodeType::Scalar);
-        tNode = getStr(pKey, "");
-        return tNode.as<std::uint64_t>();
-    }
-    catch (const YAML::BadConversion&)
-    {
-        return std::nullopt;
-    }
+    const CompiledValue* const val = findCompiled(pKey);
+    return val ? val->uintVal : std::nullopt;
 }
 
 /*!
@@ -317,16 +346,8 @@ std::optional<std::uint64_t> LayerConfig::getUIntOpt(const std::string& pKey) co
  */
 std::optional<double> LayerConfig::getDblOpt(const std::string& pKey) const
 {
-    try
-    {
-        YAML::Node tNode(YAML::NodeType::Scalar);
-        tNode = getStr(pKey, "");
-        return tNode.as<double>();
-    }
-    catch (const YAML::BadConversion&)
-    {
-        return std::nullopt;
-    }
+    const CompiledValue* const val = findCompiled(pKey);
+    return val ? val->dblVal : std::nullopt;
 }
 
 /*!
@@ -341,14 +362,11 @@ std::optional<double> LayerConfig::getDblOpt(const std::string& pKey) const
  */
 std::optional<std::string> LayerConfig::getStrOpt(const std::string& pKey) const
 {
-    try
-    {
-        return tree.get_child(pKey).data();
-    }
-    catch (const boost::property_tree::ptree_bad_path&)
-    {
+    const CompiledValue* const val = findCompiled(pKey);
+    if (val)
+        return val->strVal;
+    else
         return std::nullopt;
-    }
 }
 
 //
@@ -366,7 +384,8 @@ std::optional<std::string> LayerConfig::getStrOpt(const std::string& pKey) const
  */
 std::optional<std::vector<std::uint8_t>> LayerConfig::getByteSeqOpt(const std::string& pKey) const
 {
-    return ::geTSeq<std::uint8_t>(tree, pKey);
+    const CompiledValue* const val = findCompiled(pKey);
+    return val ? val->byteSeqVal : std::nullopt;
 }
 
 /*!
@@ -382,7 +401,8 @@ std::optional<std::vector<std::uint8_t>> LayerConfig::getByteSeqOpt(const std::s
  */
 std::optional<std::vector<std::uint64_t>> LayerConfig::getUIntSeqOpt(const std::string& pKey) const
 {
-    return ::geTSeq<std::uint64_t>(tree, pKey);
+    const CompiledValue* const val = findCompiled(pKey);
+    return val ? val->uintSeqVal : std::nullopt;
 }
 
 //
@@ -555,7 +575,7 @@ boost::property_tree::ptree LayerConfig::getRawTreeAt(const std::string& pPath)
 {
     try
     {
-        return tree.get_child(pPath);
+        return data->tree->get_child(pPath);
     }
     catch (const boost::property_tree::ptree_bad_path&)
     {
@@ -563,6 +583,16 @@ boost::property_tree::ptree LayerConfig::getRawTreeAt(const std::string& pPath)
     }
 }
 
+/*!
+ * \brief Get the (shared) configuration tree.
+ *
+ * \return The whole configuration tree (shared by all copies of this configuration object).
+ */
+const boost::property_tree::ptree& LayerConfig::getTree() const
+{
+    return *data->tree;
+}
+
 //
 
 /*!
@@ -595,11 +625,38 @@ std::string LayerConfig::toString() const
         }
     };
 
-    printTree(tree, 0);
+    printTree(*data->tree, 0);
 
     return ostrm.str();
 }
 
+/*!
+ * \brief Estimate the heap memory used by the (shared) configuration data.
+ *
+ * Includes the configuration tree (see Auxil::estimateHeapUsage()) and the pre-converted values.
+ * Note that this data is shared by all copies of the configuration object.
+ *
+ * \return Estimated number of allocated bytes.
+ */
+std::size_t LayerConfig::getMemoryUsage() const
+{
+    std::size_t tBytes = sizeof(SharedData) + sizeof(ptree) + 2 * Auxil::heapNodeOverhead + Auxil::estimateHeapUsage(*data->tree) +
+                         data->compiledValues.bucket_count() * sizeof(void*);
+
+    for (const auto& [key, value] : data->compiledValues)
+    {
+        tBytes += sizeof(CompiledMapType::value_type) + Auxil::heapNodeOverhead + Auxil::estimateHeapUsage(key) +
+                  Auxil::estimateHeapUsage(value.strVal);
+
+        if (value.byteSeqVal.has_value())
+            tBytes += value.byteSeqVal->capacity();
+        if (value.uintSeqVal.has_value())
+            tBytes += value.uintSeqVal->capacity() * sizeof(std::uint64_t);
+    }
+
+    return tBytes;
+}
+
 //
 
 /*!
@@ -608,10 +665,186 @@ std::string LayerConfig::toString() const
  * Constructs a LayerConfig instance from a configuration tree obtained from Auxil::propertyTreeFromYAML().
  * See also LayerConfig(const boost::property_tree::ptree&).
  *
+ * Since configuration objects are immutable, the created objects are cached by \p pYAMLString, such that repeatedly
+ * used documents (e.g. the required configurations passed to the LayerBase constructor) are parsed only once.
+ *
  * \param pYAMLString The YAML document to be parsed.
  * \return The according layer component configuration object.
  */
 LayerConfig LayerConfig::fromYAML(const std::string& pYAMLString)
 {
-    return LayerConfig(Auxil::propertyTreeFromYAML(pYAMLString));
+    static std::mutex cacheMutex;
+    static std::unordered_map<std::string, LayerConfig> cache;
+
+    {
+        const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+        (void)cacheLock;
+
+        if (const auto it = cache.find(pYAMLString); it != cache.end())
+            return it->second;
+    }
+
+    LayerConfig config(Auxil::propertyTreeFromYAML(pYAMLString));
+
+    const std::lock_guard<std::mutex> cacheLock(cacheMutex);
+    (void)cacheLock;
+
+    if (cache.size() >= maxCachedYAMLConfigs)
+        cache.clear();
+
+    cache.emplace(pYAMLString, config);
+
+    return config;
+}
+
+//Private
+
+/*!
+ * \brief Pre-convert all values of a configuration tree.
+ *
+ * Walks through all nodes of \p pTree and converts the value of each node once to every supported type (in accordance
+ * with the YAML specification, same as the type checks of contains()). Nodes without value but with only (non-empty)
+ * scalar children are additionally converted to the supported integer sequence types. The converted values are stored
+ * with the full node paths as keys (individual branch keys connected with periods ('.'), root node as empty string).
+ *
+ * For duplicate paths only the first node is stored, as found by \c boost::property_tree::ptree::get_child().
+ * Nodes whose key contains a period are skipped, since they cannot be addressed by a path anyway.
+ * \p pPathsUnique is set to false in both of these cases (and to true otherwise).
+ *
+ * \param pTree Configuration tree.
+ * \param pPathsUnique Gets set to whether every node of \p pTree was stored.
+ * \return Pre-converted values with full paths as keys.
+ */
+LayerConfig::CompiledMapType LayerConfig::compileTree(const boost::property_tree::ptree& pTree, bool& pPathsUnique)
+{
+    CompiledMapType compiled;
+
+    pPathsUnique = true;
+
+    std::function<void(const ptree&, const std::string&)> compileNode = [&compileNode, &compiled, &pPathsUnique](const ptree& pNode,
+                                                                                                                  const std::string& pPath)
+                                                                                                                        -> void
+    {
+        if (compiled.contains(pPath))
+        {
+            pPathsUnique = false;
+            return;
+        }
+
+        CompiledValue val;
+
+        val.strVal = pNode.data();
+        val.hasChildren = !pNode.empty();
+
+        if (val.strVal != "")
+        {
+            YAML::Node tNode(YAML::NodeType::Scalar);
+            tNode = val.strVal;
+
+            val.boolVal = ::convertScalar<bool>(tNode);
+            val.intVal = ::convertScalar<int>(tNode);
+            val.uintVal = ::convertScalar<std::uint64_t>(tNode);
+            val.dblVal = ::convertScalar<double>(tNode);
+        }
+        else
+        {
+            val.byteSeqVal = ::convertSeq<std::uint8_t>(pNode);
+            val.uintSeqVal = ::convertSeq<std::uint64_t>(pNode);
+        }
+
+        compiled.emplace(pPath, std::move(val));
+
+        for (const auto& [key, child] : pNode)
+        {
+            if (key.find('.') != std::string::npos)
+            {
+                pPathsUnique = false;
+                continue;
+            }
+
+            compileNode(child, pPath.empty() ? key : (pPath + "." + key));
+        }
+    };
+
+    compileNode(pTree, "");
+
+    return compiled;
+}
+
+/*!
+ * \brief Create the shared state for a configuration tree.
+ *
+ * \param pTree Configuration tree (must not be null).
+ * \return Shared state referring to \p pTree, with all values pre-converted (see compileTree()).
+ */
+std::shared_ptr<const LayerConfig::SharedData> LayerConfig::makeSharedData(std::shared_ptr<const boost::property_tree::ptree> pTree)
+{
+    bool pathsUnique = true;
+    CompiledMapType compiledValues = compileTree(*pTree, pathsUnique);
+
+    return std::make_shared<const SharedData>(SharedData{.tree = std::move(pTree), .compiledValues = std::move(compiledValues),
+                                                         .pathsUnique = pathsUnique});
+}
+
+//
+
+/*!
+ * \brief Look up the pre-converted value at a path.
+ *
+ * \param pKey Value location as individual branch keys that are connected with periods ('.').
+ * \return Pointer to the pre-converted value at \p pKey or null pointer if \p pKey is not found.
+ */
+const LayerConfig::CompiledValue* LayerConfig::findCompiled(const std::string& pKey) const
+{
+    const auto it = data->compiledValues.find(pKey);
+    return (it != data->compiledValues.end()) ? &(it->second) : nullptr;
+}
+
+/*!
+ * \brief Check the configuration tree structure (and value types) using the pre-converted values.
+ *
+ * Equivalent to contains() for configurations whose node paths are all unique: Looks up the path of every node of \p pOther
+ * in the pre-converted values of this configuration and, if \p pCheckTypes is true, checks the type descriptions
+ * of the branch tips of \p pOther against the available pre-converted values.
+ *
+ * \param pOther Reference configuration to compare to.
+ * \param pCheckTypes Check type conversion of stored values.
+ * \return True if \p pOther is fully contained in the configuration tree.
+ */
+bool LayerConfig::containsFlat(const LayerConfig& pOther, const bool pCheckTypes) const
+{
+    for (const auto& [path, refVal] : pOther.data->compiledValues)
+    {
+        const CompiledValue* const val = findCompiled(path);
+
+        if (!val)
+            return false;
+
+        if (!pCheckTypes || refVal.hasChildren || refVal.strVal == "")
+            continue;
+
+        const std::string& typeDescr = refVal.strVal;
+
+        bool typeMatches = true;
+
+        if (typeDescr == "uintSeq")
+            typeMatches = val->uintSeqVal.has_value();
+        else if (typeDescr == "byteSeq")
+            typeMatches = val->byteSeqVal.has_value();
+        else if (val->hasChildren)  //Only allowed for "uintSeq" and "byteSeq" above
+            typeMatches = false;
+        else if (typeDescr == "bool")
+            typeMatches = val->boolVal.has_value();
+        else if (typeDescr == "int")
+            typeMatches = val->intVal.has_value();
+        else if (typeDescr == "uint")
+            typeMatches = val->uintVal.has_value();
+        else if (typeDescr == "double" || typeDescr == "float")
+            typeMatches = val->dblVal.has_value();
+
+        if (!typeMatches)
+            return false;
+    }
+
+    return true;
 }
@@ -27,8 +27,10 @@
 #include <boost/property_tree/ptree.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace casil
@@ -39,12 +41,21 @@ namespace casil
  *
  * This is basically a convenience wrapper around a Boost Property Tree that represents a parsed YAML document.
  * There are getters for different types of configuration values and you can easily check the tree structure and contained value types.
+ *
+ * All values are converted to the supported types only once on construction and stored in a flat hash map
+ * keyed by their full paths, such that the getters only need to perform a single lookup.
+ *
+ * The tree and the converted values are immutable and shared (reference-counted) by all copies of a configuration object,
+ * such that copying or moving a %LayerConfig (e.g. when passing it down to the component constructors) copies nothing.
+ * The tree can also be shared with its owner directly (see LayerConfig(std::shared_ptr<const boost::property_tree::ptree>)).
  */
 class LayerConfig
 {
 public:
-    LayerConfig() = default;                                            ///< Default constructor.
+    LayerConfig();                                                      ///< Default constructor.
     explicit LayerConfig(const boost::property_tree::ptree& pTree);     ///< Constructor.
+    explicit LayerConfig(boost::property_tree::ptree&& pTree);          ///< Constructor.
+    explicit LayerConfig(std::shared_ptr<const boost::property_tree::ptree> pTree);     ///< Constructor.
     LayerConfig(const LayerConfig&) = default;                          ///< Default copy constructor.
     LayerConfig(LayerConfig&&) = default;                               ///< Default move constructor.
     ~LayerConfig() = default;                                           ///< Default destructor.
@@ -81,13 +92,56 @@ public:
                                                                                             ///  from the configuration tree.
     //
     boost::property_tree::ptree getRawTreeAt(const std::string& pPath) const;   ///< Get the raw configuration (sub-)tree at a specific path.
+    const boost::property_tree::ptree& getTree() const;                         ///< Get the (shared) configuration tree.
     //
     std::string toString() const;                                       ///< Format the configuration tree content as human-readable string.
+    std::size_t getMemoryUsage() const;                                 ///< Estimate the heap memory used by the (shared) configuration data.
     //
     static LayerConfig fromYAML(const std::string& pYAMLString);        ///< Create a configuration object from YAML format.
 
 private:
-    const boost::property_tree::ptree tree;                             ///< The configuration tree.
+    /*!
+     * \brief Pre-converted value of a single configuration tree node.
+     *
+     * Each optional is set if the node's value can be converted to the respective type.
+     */
+    struct CompiledValue
+    {
+        std::string strVal;                                     ///< Raw string value of the node.
+        bool hasChildren;                                       ///< Node has child nodes.
+        std::optional<bool> boolVal;                            ///< Value as boolean.
+        std::optional<int> intVal;                              ///< Value as (signed) integer.
+        std::optional<std::uint64_t> uintVal;                   ///< Value as unsigned integer.
+        std::optional<double> dblVal;                           ///< Value as floating point number.
+        std::optional<std::vector<std::uint8_t>> byteSeqVal;    ///< Child values as 8 bit unsigned integer sequence.
+        std::optional<std::vector<std::uint64_t>> uintSeqVal;   ///< Child values as 64 bit unsigned integer sequence.
+    };
+    //
+    typedef std::unordered_map<std::string, CompiledValue> CompiledMapType; ///< Map type for pre-converted values with full paths as keys.
+    //
+    /*!
+     * \brief Immutable state shared by all copies of a configuration object.
+     */
+    struct SharedData
+    {
+        std::shared_ptr<const boost::property_tree::ptree> tree;    ///< The configuration tree.
+        CompiledMapType compiledValues;                             ///< Pre-converted values of all tree nodes with full paths as keys.
+        bool pathsUnique;                                           ///< \brief Every tree node is stored in \ref compiledValues
+                                                                    ///  (no duplicate paths, no keys containing periods).
+    };
+
+private:
+    static CompiledMapType compileTree(const boost::property_tree::ptree& pTree, bool& pPathsUnique);
+                                                                                    ///< Pre-convert all values of a configuration tree.
+    static std::shared_ptr<const SharedData> makeSharedData(std::shared_ptr<const boost::property_tree::ptree> pTree);
+                                                                                    ///< Create the shared state for a configuration tree.
+    //
+    const CompiledValue* findCompiled(const std::string& pKey) const;               ///< Look up the pre-converted value at a path.
+    bool containsFlat(const LayerConfig& pOther, bool pCheckTypes) const;           ///< \brief Check the configuration tree structure
+                                                                                    ///  (and value types) using the pre-converted values.
+
+private:
+    const std::shared_ptr<const SharedData> data;                       ///< Configuration tree and pre-converted values (shared by all copies).
 };
 
 } // namespace casil
@@ -23,20 +23,139 @@
 
 #include <casil/layerfactory.h>
 
+#include <casil/auxil.h>
+#include <casil/env.h>
 #include <casil/layerconfig.h>
+#include <casil/logger.h>
 #include <casil/HL/driver.h>
 #include <casil/RL/register.h>
 #include <casil/TL/interface.h>
 
+#include <boost/property_tree/ptree.hpp>
+
+#include <array>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
 
 using casil::LayerFactory;
+using casil::Logger;
 
 using casil::TL::Interface;
 using casil::HL::Driver;
 using casil::RL::Register;
 
+namespace
+{
+
+constexpr std::array<std::string_view, 3> pluginLayerKeys = {"interfaces", "drivers", "registers"};   //Sections of a plugin index
+
+std::mutex pluginMutex;                                         //Protects 'pluginDirs', 'pluginIndex' and 'loadedPlugins'
+std::vector<std::filesystem::path> pluginDirs;                  //Directories added via LayerFactory::addPluginDirectory()
+std::optional<std::map<std::string, std::filesystem::path, std::less<>>> pluginIndex;
+                                                                //Library path per "<layer key>/<type>" (built on first use)
+std::set<std::filesystem::path> loadedPlugins;                  //Already loaded plugin libraries (never unloaded)
+
+/*
+ * Reads the plugin index files of the directories 'pDirs' (see LayerFactory) and returns the library paths per
+ * "<layer key>/<type>", with relative library paths resolved against the directory of the index. Earlier directories
+ * take precedence. Directories without index are skipped, invalid index files are skipped with a warning.
+ */
+std::map<std::string, std::filesystem::path, std::less<>> indexPlugins(const std::vector<std::filesystem::path>& pDirs)
+{
+    std::map<std::string, std::filesystem::path, std::less<>> index;
+
+    for (const std::filesystem::path& dir : pDirs)
+    {
+        const std::filesystem::path indexPath = dir / LayerFactory::pluginIndexFileName;
+
+        std::ifstream indexFile(indexPath);
+
+        if (!indexFile.is_open())
+            continue;
+
+        boost::property_tree::ptree indexTree;
+
+        try
+        {
+            indexTree = casil::Auxil::propertyTreeFromYAML(indexFile);
+        }
+        catch (const std::runtime_error& exc)
+        {
+            Logger::logWarning("Skipping invalid plugin index \"" + indexPath.string() + "\": " + exc.what());
+            continue;
+        }
+
+        for (const std::string_view layerKey : pluginLayerKeys)
+        {
+            const boost::optional<boost::property_tree::ptree&> layerTree = indexTree.get_child_optional(std::string(layerKey));
+
+            if (!layerTree)
+                continue;
+
+            for (const auto& [type, libTree] : *layerTree)
+            {
+                if (!libTree.data().empty())
+                    index.emplace(std::string(layerKey) + "/" + type, dir / libTree.data());
+            }
+        }
+    }
+
+    return index;
+}
+
+/*
+ * Returns a copy of the generator function for 'pType' from 'pGenerators' (or an empty function if not registered),
+ * while holding a shared lock on 'pMutex', such that the generator can be called without holding the lock.
+ */
+template<typename GeneratorT>
+GeneratorT findGenerator(const std::map<std::string, GeneratorT>& pGenerators, std::shared_mutex& pMutex, const std::string& pType)
+{
+    const std::shared_lock<std::shared_mutex> generatorsLock(pMutex);
+    (void)generatorsLock;
+
+    const auto it = pGenerators.find(pType);
+
+    return (it != pGenerators.end() ? it->second : GeneratorT());
+}
+
+/*
+ * Loads the shared library 'pPath' (which runs its static initialization) and returns
+ * an empty string on success or else a description of the error.
+ */
+std::string openLibrary(const std::filesystem::path& pPath)
+{
+#ifdef _WIN32
+    if (LoadLibraryW(pPath.c_str()) == nullptr)
+        return "Error code " + std::to_string(GetLastError()) + ".";
+#else
+    if (dlopen(pPath.c_str(), RTLD_NOW | RTLD_LOCAL) == nullptr)
+    {
+        const char* const error = dlerror();
+        return (error != nullptr ? error : "Unknown error.");
+    }
+#endif
+
+    return "";
+}
+
+} // namespace
+
+LayerFactory::TLStaticCreatorFunction LayerFactory::tlStaticCreator = nullptr;
+LayerFactory::HLStaticCreatorFunction LayerFactory::hlStaticCreator = nullptr;
+LayerFactory::RLStaticCreatorFunction LayerFactory::rlStaticCreator = nullptr;
+
 //Public
 
 /*!
@@ -45,10 +164,14 @@ using casil::RL::Register;
  * Calls the generator function for the registered type name \p pType (see registerInterfaceType(), registerInterfaceAlias()) with
  * forwarded \p pName and \p pConfig arguments and returns a pointer to the generated \ref casil::Layers::TL::Interface "TL::Interface".
  *
- * Returns \c nullptr if \p pType is not a registered interface type name.
+ * If a static registry is installed (see useStaticRegistry()), its interface types are searched first.
+ * If \p pType is not registered, the plugin library that provides it is loaded (see LayerFactory, loadPlugin()).
+ *
+ * Returns \c nullptr if \p pType is neither a registered interface type name nor provided by a plugin.
  *
  * \throws std::runtime_error If the class constructor or the generator function itself throw \c std::runtime_error
  *         (it is expcected that they always only throw this type).
+ * \throws std::runtime_error If the plugin library for \p pType cannot be loaded or does not register \p pType.
  *
  * \param pType Registered type name (or alias) of the requested interface type.
  * \param pName Instance name for the new interface component.
@@ -57,15 +180,33 @@ using casil::RL::Register;
  */
 std::unique_ptr<Interface> LayerFactory::createInterface(const std::string& pType, std::string pName, LayerConfig pConfig)
 {
-    const auto it = tlGenerators().find(pType);
+    try
+    {
+        //Static creator only moves from the arguments if it knows the type and then never returns nullptr
+        if (tlStaticCreator != nullptr)
+        {
+            std::unique_ptr<Interface> component = tlStaticCreator(pType, std::move(pName), std::move(pConfig));
 
-    if (it == tlGenerators().end())
-        return nullptr;
+            if (component)
+                return component;
+        }
 
-    const TLGeneratorFunction& genFunc = it->second;
+        //Plugin library registers its types while being loaded, hence do not hold the generators lock meanwhile
+        TLGeneratorFunction genFunc = ::findGenerator(tlGenerators(), generatorsMutex(), pType);
+
+        if (!genFunc)
+        {
+            const std::filesystem::path pluginPath = loadPlugin("interfaces", pType);
+
+            if (pluginPath.empty())
+                return nullptr;
+
+            genFunc = ::findGenerator(tlGenerators(), generatorsMutex(), pType);
+
+            if (!genFunc)
+                throw std::runtime_error("Plugin library \"" + pluginPath.string() + "\" does not provide interface type \"" + pType + "\".");
+        }
 
-    try
-    {
         return genFunc(std::move(pName), std::move(pConfig));
     }
     catch (const std::runtime_error& exc)
@@ -82,10 +223,14 @@ std::unique_ptr<Interface> LayerFactory::createInterface(const std::string& pTyp
  * Calls the generator function for the registered type name \p pType (see registerDriverType(), registerDriverAlias()) with forwarded
  * \p pName, \p pInterface and \p pConfig arguments and returns a pointer to the generated \ref casil::Layers::HL::Driver "HL::Driver".
  *
- * Returns \c nullptr if \p pType is not a registered driver type name.
+ * If a static registry is installed (see useStaticRegistry()), its driver types are searched first.
+ * If \p pType is not registered, the plugin library that provides it is loaded (see LayerFactory, loadPlugin()).
+ *
+ * Returns \c nullptr if \p pType is neither a registered driver type name nor provided by a plugin.
  *
  * \throws std::runtime_error If the class constructor or the generator function itself throw \c std::runtime_error
  *         (it is expcected that they always only throw this type).
+ * \throws std::runtime_error If the plugin library for \p pType cannot be loaded or does not register \p pType.
  *
  * \param pType Registered type name (or alias) of the requested driver type.
  * \param pName Instance name for the new driver component.
@@ -95,15 +240,33 @@ std::unique_ptr<Interface> LayerFactory::createInterface(const std::string& pTyp
  */
 std::unique_ptr<Driver> LayerFactory::createDriver(const std::string& pType, std::string pName, Interface& pInterface, LayerConfig pConfig)
 {
-    const auto it = hlGenerators().find(pType);
+    try
+    {
+        //Static creator only moves from the arguments if it knows the type and then never returns nullptr
+        if (hlStaticCreator != nullptr)
+        {
+            std::unique_ptr<Driver> component = hlStaticCreator(pType, std::move(pName), pInterface, std::move(pConfig));
 
-    if (it == hlGenerators().end())
-        return nullptr;
+            if (component)
+                return component;
+        }
 
-    const HLGeneratorFunction& genFunc = it->second;
+        //Plugin library registers its types while being loaded, hence do not hold the generators lock meanwhile
+        HLGeneratorFunction genFunc = ::findGenerator(hlGenerators(), generatorsMutex(), pType);
+
+        if (!genFunc)
+        {
+            const std::filesystem::path pluginPath = loadPlugin("drivers", pType);
+
+            if (pluginPath.empty())
+                return nullptr;
+
+            genFunc = ::findGenerator(hlGenerators(), generatorsMutex(), pType);
+
+            if (!genFunc)
+                throw std::runtime_error("Plugin library \"" + pluginPath.string() + "\" does not provide driver type \"" + pType + "\".");
+        }
 
-    try
-    {
         return genFunc(std::move(pName), pInterface, std::move(pConfig));
     }
     catch (const std::runtime_error& exc)
@@ -120,10 +283,14 @@ std::unique_ptr<Driver> LayerFactory::createDriver(const std::string& pType, std
  * Calls the generator function for the registered type name \p pType (see registerRegisterType(), registerRegisterAlias()) with forwarded
  * \p pName, \p pDriver and \p pConfig arguments and returns a pointer to the generated \ref casil::Layers::RL::Register "RL::Register".
  *
- * Returns \c nullptr if \p pType is not a registered register type name.
+ * If a static registry is installed (see useStaticRegistry()), its register types are searched first.
+ * If \p pType is not registered, the plugin library that provides it is loaded (see LayerFactory, loadPlugin()).
+ *
+ * Returns \c nullptr if \p pType is neither a registered register type name nor provided by a plugin.
  *
  * \throws std::runtime_error If the class constructor or the generator function itself throw \c std::runtime_error
  *         (it is expcected that they always only throw this type).
+ * \throws std::runtime_error If the plugin library for \p pType cannot be loaded or does not register \p pType.
  *
  * \param pType Registered type name (or alias) of the requested register type.
  * \param pName Instance name for the new register component.
@@ -133,15 +300,33 @@ std::unique_ptr<Driver> LayerFactory::createDriver(const std::string& pType, std
  */
 std::unique_ptr<Register> LayerFactory::createRegister(const std::string& pType, std::string pName, Driver& pDriver, LayerConfig pConfig)
 {
-    const auto it = rlGenerators().find(pType);
+    try
+    {
+        //Static creator only moves from the arguments if it knows the type and then never returns nullptr
+        if (rlStaticCreator != nullptr)
+        {
+            std::unique_ptr<Register> component = rlStaticCreator(pType, std::move(pName), pDriver, std::move(pConfig));
 
-    if (it == rlGenerators().end())
-        return nullptr;
+            if (component)
+                return component;
+        }
 
-    const RLGeneratorFunction& genFunc = it->second;
+        //Plugin library registers its types while being loaded, hence do not hold the generators lock meanwhile
+        RLGeneratorFunction genFunc = ::findGenerator(rlGenerators(), generatorsMutex(), pType);
+
+        if (!genFunc)
+        {
+            const std::filesystem::path pluginPath = loadPlugin("registers", pType);
+
+            if (pluginPath.empty())
+                return nullptr;
+
+            genFunc = ::findGenerator(rlGenerators(), generatorsMutex(), pType);
+
+            if (!genFunc)
+                throw std::runtime_error("Plugin library \"" + pluginPath.string() + "\" does not provide register type \"" + pType + "\".");
+        }
 
-    try
-    {
         return genFunc(std::move(pName), pDriver, std::move(pConfig));
     }
     catch (const std::runtime_error& exc)
@@ -166,6 +351,9 @@ std::unique_ptr<Register> LayerFactory::createRegister(const std::string& pType,
  */
 void LayerFactory::registerInterfaceType(std::string pType, TLGeneratorFunction pGenerator)
 {
+    const std::lock_guard<std::shared_mutex> generatorsLock(generatorsMutex());
+    (void)generatorsLock;
+
     tlGenerators().insert({std::move(pType), std::move(pGenerator)});
 }
 
@@ -182,6 +370,9 @@ void LayerFactory::registerInterfaceType(std::string pType, TLGeneratorFunction
  */
 void LayerFactory::registerDriverType(std::string pType, HLGeneratorFunction pGenerator)
 {
+    const std::lock_guard<std::shared_mutex> generatorsLock(generatorsMutex());
+    (void)generatorsLock;
+
     hlGenerators().insert({std::move(pType), std::move(pGenerator)});
 }
 
@@ -198,6 +389,9 @@ void LayerFactory::registerDriverType(std::string pType, HLGeneratorFunction pGe
  */
 void LayerFactory::registerRegisterType(std::string pType, RLGeneratorFunction pGenerator)
 {
+    const std::lock_guard<std::shared_mutex> generatorsLock(generatorsMutex());
+    (void)generatorsLock;
+
     rlGenerators().insert({std::move(pType), std::move(pGenerator)});
 }
 
@@ -214,6 +408,9 @@ void LayerFactory::registerRegisterType(std::string pType, RLGeneratorFunction p
  */
 void LayerFactory::registerInterfaceAlias(const std::string& pType, std::string pAlias)
 {
+    const std::lock_guard<std::shared_mutex> generatorsLock(generatorsMutex());
+    (void)generatorsLock;
+
     const auto it = tlGenerators().find(pType);
 
     if (it == tlGenerators().end())
@@ -235,6 +432,9 @@ void LayerFactory::registerInterfaceAlias(const std::string& pType, std::string
  */
 void LayerFactory::registerDriverAlias(const std::string& pType, std::string pAlias)
 {
+    const std::lock_guard<std::shared_mutex> generatorsLock(generatorsMutex());
+    (void)generatorsLock;
+
     const auto it = hlGenerators().find(pType);
 
     if (it == hlGenerators().end())
@@ -256,6 +456,9 @@ void LayerFactory::registerDriverAlias(const std::string& pType, std::string pAl
  */
 void LayerFactory::registerRegisterAlias(const std::string& pType, std::string pAlias)
 {
+    const std::lock_guard<std::shared_mutex> generatorsLock(generatorsMutex());
+    (void)generatorsLock;
+
     const auto it = rlGenerators().find(pType);
 
     if (it == rlGenerators().end())
@@ -266,6 +469,53 @@ void LayerFactory::registerRegisterAlias(const std::string& pType, std::string p
     rlGenerators().insert({std::move(pAlias), std::move(boundGenerator)});
 }
 
+//
+
+/*!
+ * \brief Install creator functions of a static registry.
+ *
+ * Lets createInterface() / createDriver() / createRegister() first try to construct the requested type via \p pTLCreator /
+ * \p pHLCreator / \p pRLCreator before searching the registered generators. A creator must return \c nullptr (and must not
+ * move from the passed name and configuration) if it does not know the requested type. Pass \c nullptr to remove a creator.
+ *
+ * This is typically called via \ref casil::StaticLayerFactory::install() "StaticLayerFactory::install()", which makes
+ * a compile-time list of component classes usable by \ref casil::Device "Device" without any registration at static
+ * initialization time (see \c CASIL_DISABLE_AUTO_REGISTRATION in \ref layerfactorymacros.h).
+ *
+ * \note Not thread-safe. Call this before constructing any components.
+ *
+ * \param pTLCreator Interface creator function.
+ * \param pHLCreator Driver creator function.
+ * \param pRLCreator Register creator function.
+ */
+void LayerFactory::useStaticRegistry(const TLStaticCreatorFunction pTLCreator, const HLStaticCreatorFunction pHLCreator,
+                                     const RLStaticCreatorFunction pRLCreator)
+{
+    tlStaticCreator = pTLCreator;
+    hlStaticCreator = pHLCreator;
+    rlStaticCreator = pRLCreator;
+}
+
+//
+
+/*!
+ * \brief Add a directory to search for plugin libraries.
+ *
+ * Additionally searches \p pDir for a plugin index (see LayerFactory) when looking up unknown component types.
+ * Added directories come after those listed by \c CASIL_PLUGIN_DIRS (see Env). Discards the current plugin index,
+ * such that all directories are searched again on the next lookup. Already loaded plugin libraries stay loaded.
+ *
+ * \param pDir Plugin directory.
+ */
+void LayerFactory::addPluginDirectory(std::filesystem::path pDir)
+{
+    const std::lock_guard<std::mutex> pluginLock(::pluginMutex);
+    (void)pluginLock;
+
+    ::pluginDirs.push_back(std::move(pDir));
+    ::pluginIndex.reset();
+}
+
 //Private
 
 /*!
@@ -309,3 +559,75 @@ std::map<std::string, LayerFactory::RLGeneratorFunction>& LayerFactory::rlGenera
     static std::map<std::string, RLGeneratorFunction> typeGtors = {};
     return typeGtors;
 }
+
+/*!
+ * \brief Access the mutex protecting the generator maps.
+ *
+ * Creates a static mutex and always returns a reference to that one. Like the generator maps (see e.g. tlGenerators()) it is
+ * created on first use, since types get registered during the static initialization of other translation units.
+ * Registering types and aliases takes an exclusive lock, looking up generators a shared lock.
+ *
+ * \return The mutex.
+ */
+std::shared_mutex& LayerFactory::generatorsMutex()
+{
+    static std::shared_mutex mutex;
+    return mutex;
+}
+
+//
+
+/*!
+ * \brief Load the plugin library that provides a component type.
+ *
+ * Looks up \p pType in the \p pLayerKey section ("interfaces", "drivers" or "registers") of the plugin index (see LayerFactory)
+ * and loads the listed library unless it was already loaded, which lets the library register its types. The plugin index is built
+ * from the index files of all plugin directories on first use (and after addPluginDirectory()).
+ *
+ * \throws std::runtime_error If loading the library fails.
+ *
+ * \param pLayerKey Layer section of the plugin index.
+ * \param pType Requested component type name.
+ * \return Path of the (loaded) plugin library or an empty path if no plugin provides \p pType.
+ */
+std::filesystem::path LayerFactory::loadPlugin(const std::string_view pLayerKey, const std::string_view pType)
+{
+    const std::lock_guard<std::mutex> pluginLock(::pluginMutex);
+    (void)pluginLock;
+
+    if (!::pluginIndex)
+    {
+        std::vector<std::filesystem::path> dirs;
+
+        for (const std::string& dir : Env::getEnv("CASIL_PLUGIN_DIRS"))
+        {
+            if (!dir.empty())
+                dirs.emplace_back(dir);
+        }
+
+        dirs.insert(dirs.end(), ::pluginDirs.begin(), ::pluginDirs.end());
+
+        ::pluginIndex = ::indexPlugins(dirs);
+    }
+
+    const auto it = ::pluginIndex->find(std::string(pLayerKey) + "/" + std::string(pType));
+
+    if (it == ::pluginIndex->end())
+        return std::filesystem::path();
+
+    const std::filesystem::path& libPath = it->second;
+
+    if (!::loadedPlugins.contains(libPath))
+    {
+        const std::string error = ::openLibrary(libPath);
+
+        if (!error.empty())
+            throw std::runtime_error("Could not load plugin library \"" + libPath.string() + "\": " + error);
+
+        ::loadedPlugins.insert(libPath);
+
+        Logger::logDebug("Loaded plugin library \"" + libPath.string() + "\".");
+    }
+
+    return libPath;
+}
@@ -24,10 +24,13 @@
 #ifndef CASIL_LAYERFACTORY_H
 #define CASIL_LAYERFACTORY_H
 
+#include <filesystem>
 #include <functional>
 #include <map>
 #include <memory>
+#include <shared_mutex>
 #include <string>
+#include <string_view>
 
 namespace casil
 {
@@ -49,7 +52,29 @@ namespace Layers { namespace RL { class Register; } }
  *
  * The actually recommended way to register any component classes is by using the macros defined in \ref layerfactorymacros.h.
  *
- * \note The components of this library do register themselves using the mentioned macros.
+ * Alternatively, a compile-time list of component classes can be installed as "static registry" (see useStaticRegistry()
+ * and \ref casil::StaticLayerFactory "StaticLayerFactory"), which is searched before the registered generators.
+ *
+ * Types that are neither registered nor known to the static registry can be provided by plugin libraries, which are only
+ * loaded on first use of one of their types: The directories listed by \c CASIL_PLUGIN_DIRS (see Env) and those added via
+ * addPluginDirectory() are searched for a plugin index file named \ref pluginIndexFileName, which maps the provided
+ * type names to the (relative or absolute) paths of the shared libraries, separately for each layer:
+ *
+ * \code{.yaml}
+ * interfaces: {MyInterface: libmyplugin.so}
+ * drivers: {MyDriver: libmyplugin.so, OtherDriver: libotherplugin.so}
+ * registers: {}
+ * \endcode
+ *
+ * The plugin library must register its types on loading, i.e. during its static initialization (typically by using the
+ * macros from \ref layerfactorymacros.h), and must hence be linked against the same (shared) Casil library as the application.
+ * Loaded plugin libraries are never unloaded.
+ *
+ * All functions except useStaticRegistry() are thread-safe, i.e. components can be constructed from multiple threads
+ * while other types get registered (e.g. by a plugin library that is loaded concurrently).
+ *
+ * \note The components of this library do register themselves using the mentioned macros
+ *       (unless the library was built with \c CASIL_DISABLE_AUTO_REGISTRATION, see \ref layerfactorymacros.h).
  */
 class LayerFactory
 {
@@ -65,6 +90,13 @@ public:
                                                                                     ///< Function signature required for driver generators.
     typedef std::function<std::unique_ptr<Register>(std::string, Driver&, LayerConfig)> RLGeneratorFunction;
                                                                                     ///< Function signature required for register generators.
+    //
+    typedef std::unique_ptr<Interface> (*TLStaticCreatorFunction)(std::string_view, std::string&&, LayerConfig&&);
+                                                                                    ///< Function signature required for static interface creators.
+    typedef std::unique_ptr<Driver> (*HLStaticCreatorFunction)(std::string_view, std::string&&, Interface&, LayerConfig&&);
+                                                                                    ///< Function signature required for static driver creators.
+    typedef std::unique_ptr<Register> (*RLStaticCreatorFunction)(std::string_view, std::string&&, Driver&, LayerConfig&&);
+                                                                                    ///< Function signature required for static register creators.
 
 public:
     LayerFactory() = delete;                                                                ///< Deleted constructor.
@@ -83,11 +115,27 @@ public:
     static void registerInterfaceAlias(const std::string& pType, std::string pAlias);       ///< Register an interface type name alias.
     static void registerDriverAlias(const std::string& pType, std::string pAlias);          ///< Register a driver type name alias.
     static void registerRegisterAlias(const std::string& pType, std::string pAlias);        ///< Register a register type name alias.
+    //
+    static void useStaticRegistry(TLStaticCreatorFunction pTLCreator, HLStaticCreatorFunction pHLCreator,
+                                  RLStaticCreatorFunction pRLCreator);                      ///< Install creator functions of a static registry.
+    //
+    static void addPluginDirectory(std::filesystem::path pDir);                             ///< Add a directory to search for plugin libraries.
+
+public:
+    static constexpr std::string_view pluginIndexFileName = "casil_plugins.yaml";          ///< File name of plugin directory indices.
 
 private:
     static std::map<std::string, TLGeneratorFunction>& tlGenerators();  ///< Access the map of interface generators with interface types as keys.
     static std::map<std::string, HLGeneratorFunction>& hlGenerators();  ///< Access the map of driver generators with driver types as keys.
     static std::map<std::string, RLGeneratorFunction>& rlGenerators();  ///< Access the map of register generators with register types as keys.
+    static std::shared_mutex& generatorsMutex();                        ///< Access the mutex protecting the generator maps.
+    //
+    static std::filesystem::path loadPlugin(std::string_view pLayerKey, std::string_view pType);
+                                                                        ///< Load the plugin library that provides a component type.
+    //
+    static TLStaticCreatorFunction tlStaticCreator;     ///< Installed static interface creator or \c nullptr (see useStaticRegistry()).
+    static HLStaticCreatorFunction hlStaticCreator;     ///< Installed static driver creator or \c nullptr (see useStaticRegistry()).
+    static RLStaticCreatorFunction rlStaticCreator;     ///< Installed static register creator or \c nullptr (see useStaticRegistry()).
 };
 
 } // namespace casil
@@ -46,6 +46,10 @@
  * See \ref casil::LayerFactory "LayerFactory" for detailed information about the registration of layer components.
  * These macros here can/should be used in favor of the raw \ref casil::LayerFactory "LayerFactory" functionality
  * in order to simplify and unify the registration of component classes.
+ *
+ * If \c CASIL_DISABLE_AUTO_REGISTRATION is defined (see the CMake option of the same name), the \c CASIL_REGISTER_*_CPP
+ * and \c CASIL_REGISTER_*_ALIAS macros expand to nothing, i.e. no components are registered at static initialization time.
+ * Components must then be made available via \ref casil::StaticLayerFactory "StaticLayerFactory" instead.
 */
 
 /*!
@@ -99,6 +103,8 @@ private:
 
 //
 
+#ifndef CASIL_DISABLE_AUTO_REGISTRATION
+
 /*!
  * \brief Register an interface component to the \ref casil::LayerFactory "LayerFactory".
  *
@@ -335,6 +341,17 @@ namespace RegistryImpl\
 }\
 }
 
+#else
+
+#define CASIL_REGISTER_INTERFACE_CPP(TYPE_CLASS)
+#define CASIL_REGISTER_DRIVER_CPP(TYPE_CLASS)
+#define CASIL_REGISTER_REGISTER_CPP(TYPE_CLASS)
+#define CASIL_REGISTER_INTERFACE_ALIAS(ALIAS_NAME)
+#define CASIL_REGISTER_DRIVER_ALIAS(ALIAS_NAME)
+#define CASIL_REGISTER_REGISTER_ALIAS(ALIAS_NAME)
+
+#endif // CASIL_DISABLE_AUTO_REGISTRATION
+
 //
 
 #endif // CASIL_LAYERFACTORYMACROS_H
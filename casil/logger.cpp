@@ -23,24 +23,268 @@
 
 #include <casil/logger.h>
 
-#include <chrono>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
 #include <exception>
+#include <filesystem>
 #include <fstream>
-#include <iomanip>
 #include <ios>
 #include <iostream>
+#include <optional>
 #include <ostream>
 #include <sstream>
-#include <thread>
+#include <stdexcept>
+#include <streambuf>
+#include <string_view>
+#include <system_error>
+#include <utility>
 
 using casil::Logger;
 
-Logger::LogLevel Logger::logLevel = Logger::LogLevel::None;
+/*!
+ * \brief Asynchronous backend for Logger.
+ *
+ * Log records are pushed by any number of threads into a bounded lock-free ring buffer (sequence-numbered
+ * slots, such that producers only contend on a single atomic position counter) and are popped, formatted
+ * and written in batches by a dedicated logging thread. Messages with LogLevel::Warning or more severe
+ * cause the outputs to be flushed after writing the batch (as for synchronous logging).
+ *
+ * See Logger::enableAsync().
+ */
+class Logger::AsyncBackend
+{
+public:
+    AsyncBackend(std::size_t pQueueSize, OverflowPolicy pPolicy);   ///< Constructor.
+    AsyncBackend(const AsyncBackend&) = delete;                     ///< Deleted copy constructor.
+    AsyncBackend(AsyncBackend&&) = delete;                          ///< Deleted move constructor.
+    ~AsyncBackend();                                                ///< Destructor.
+    //
+    AsyncBackend& operator=(AsyncBackend) = delete;                 ///< Deleted copy assignment operator.
+    AsyncBackend& operator=(AsyncBackend&&) = delete;               ///< Deleted move assignment operator.
+    //
+    std::uint64_t push(std::string_view pPrefix, std::string_view pMessage, LogLevel pLevel);   ///< Push a log message to the queue.
+    void waitProcessed();                                           ///< Wait until all queued messages have been written.
+    void waitProcessed(std::uint64_t pCount);                       ///< Wait until a number of queued messages have been written.
+    std::uint64_t getDroppedCount() const;                          ///< Get the number of dropped messages.
+
+private:
+    /*!
+     * \brief Log record with everything needed for deferred formatting.
+     */
+    struct Record
+    {
+        std::string message;                                        ///< The message text.
+        LogLevel level;                                             ///< Log level of the message.
+        std::chrono::system_clock::time_point time;                 ///< Time of logging.
+        std::thread::id threadId;                                   ///< ID of the logging thread.
+    };
+    /*!
+     * \brief Ring buffer slot.
+     */
+    struct Slot
+    {
+        std::atomic<std::uint64_t> sequence;                        ///< Queue position for which the slot is ready for writing/reading.
+        Record record;                                              ///< The stored record.
+    };
+
+private:
+    bool tryPush(Record& pRecord, std::uint64_t& pPos);             ///< Try to push a record to the queue.
+    bool tryPop(Record& pRecord);                                   ///< Try to pop a record from the queue.
+    void run();                                                     ///< Run the logging thread.
+
+private:
+    const OverflowPolicy policy;                                    ///< Behavior on full queue.
+    const std::size_t indexMask;                                    ///< Mask for converting queue positions to slot indices.
+    const std::unique_ptr<Slot[]> slots;                            ///< Ring buffer slots.
+    //
+    std::atomic<std::uint64_t> enqueuePos;                          ///< Next queue position to be written.
+    std::uint64_t dequeuePos;                                       ///< Next queue position to be read (logging thread only).
+    //
+    std::atomic<std::uint64_t> processedCount;                      ///< Number of written records (i.e. written queue positions).
+    std::atomic<std::uint64_t> droppedCount;                        ///< Number of records dropped due to full queue.
+    //
+    std::atomic<std::uint64_t> wakeSignal;                          ///< Incremented to wake up the logging thread.
+    std::atomic<bool> stopRequested;                                ///< Stop the logging thread once the queue is empty.
+    //
+    std::thread thread;                                             ///< The logging thread.
+};
+
+/*!
+ * \brief Block-buffered log file with size-based rotation.
+ *
+ * Log messages are collected in a large buffer and appended to the file with a single write operation whenever
+ * the buffer is full, on explicit flushes (see Logger::writeMessages()) or if buffered data is older than
+ * \ref flushInterval (checked on every write, see flushIfDue()).
+ *
+ * If writing a block would make the file exceed the configured maximum size, the block's complete lines are still
+ * appended and the file is then rotated: "FILE" is renamed to "FILE.1", "FILE.1" to "FILE.2" and so on, keeping
+ * at most the configured number of backups, and a new, empty "FILE" is started. Hence a file can exceed the maximum
+ * size by at most the buffer size and lines are never split across files.
+ *
+ * See Logger::addRotatingLogFile().
+ */
+class Logger::RotatingFile : private std::streambuf
+{
+public:
+    RotatingFile(std::string pFileName, std::uint64_t pMaxFileSize, unsigned int pMaxBackups, std::size_t pBufferSize);
+                                                                    ///< Constructor.
+    RotatingFile(const RotatingFile&) = delete;                     ///< Deleted copy constructor.
+    RotatingFile(RotatingFile&&) = delete;                          ///< Deleted move constructor.
+    ~RotatingFile() override;                                       ///< Destructor.
+    //
+    RotatingFile& operator=(RotatingFile) = delete;                 ///< Deleted copy assignment operator.
+    RotatingFile& operator=(RotatingFile&&) = delete;               ///< Deleted move assignment operator.
+    //
+    std::ostream& getStream();                                      ///< Get the output stream writing to the file.
+    void flushIfDue();                                              ///< Write the buffer if it holds data older than \ref flushInterval.
+
+public:
+    static constexpr std::chrono::seconds flushInterval{1};         ///< Maximum time that data is kept in the buffer.
+
+private:
+    int overflow(int pChar) override;                               ///< Write the full buffer and store a character.
+    int sync() override;                                            ///< Write the buffer.
+    //
+    bool writeBuffer();                                             ///< Write the buffered data to the file, rotating if needed.
+    bool writeRaw(const char* pData, std::size_t pSize);            ///< Write data to the file.
+    bool rotate();                                                  ///< Rotate the files and start a new file.
+
+private:
+    const std::string fileName;                                     ///< File name of the log file.
+    const std::uint64_t maxFileSize;                                ///< Maximum file size in bytes (no rotation if zero).
+    const unsigned int maxBackups;                                  ///< Number of rotated files to keep.
+    //
+    std::vector<char> buffer;                                       ///< Message buffer.
+    std::optional<std::chrono::steady_clock::time_point> bufferedSince;
+                                                                    ///< Time when buffered data was first noticed (see flushIfDue()).
+    //
+    std::FILE* file;                                                ///< The open file.
+    std::uint64_t fileSize;                                         ///< Current size of the file.
+    //
+    std::ostream stream;                                            ///< Output stream writing into the buffer.
+};
+
+//
+
+std::atomic<Logger::LogLevel> Logger::logLevel = Logger::LogLevel::None;
 //
 std::list<std::reference_wrapper<std::ostream>> Logger::outputStreams = {};
 std::map<std::string, std::ofstream> Logger::files = {};
+std::map<std::string, std::unique_ptr<Logger::RotatingFile>> Logger::rotatingFiles = {};
 //
 std::mutex Logger::logMutex;
+//
+std::unique_ptr<Logger::AsyncBackend> Logger::asyncBackend = nullptr;
+std::uint64_t Logger::droppedCount = 0;
+
+namespace
+{
+
+/*
+ * Writes 'pValue' as decimal number with exactly 'pWidth' digits (zero-padded, leading digits cut off) to 'pDest'.
+ */
+void writeDigits(char* const pDest, unsigned int pValue, const std::size_t pWidth)
+{
+    for (std::size_t i = pWidth; i > 0; --i)
+    {
+        pDest[i - 1] = static_cast<char>('0' + pValue % 10);
+        pValue /= 10;
+    }
+}
+
+/*
+ * Per-thread cache of the second-resolution timestamp prefix "YYYY-MM-DDThh:mm:ss" of the last formatted message.
+ */
+struct TimestampCache
+{
+    std::time_t second = -1;                                ///< Time (in seconds) of the cached prefix.
+    std::array<char, 19> prefix{};                          ///< Formatted timestamp of 'second'.
+};
+
+/*
+ * Per-thread cache of the string representation of the last formatted thread ID.
+ */
+struct ThreadIdCache
+{
+    std::thread::id threadId;                               ///< Thread ID of the cached string.
+    std::string threadIdStr;                                ///< String representation of 'threadId'.
+};
+
+thread_local TimestampCache timestampCache;
+thread_local ThreadIdCache threadIdCache;
+
+thread_local std::string lineBuffer;                        //Reused buffer for formatting messages with synchronous logging
+
+/*
+ * Appends the timestamp "YYYY-MM-DDThh:mm:ss.uuuuuuGMT" for 'pTime' to 'pStr'. The second-resolution part
+ * is only re-formatted (via gmtime) if the second changed since the last call of the calling thread.
+ */
+void appendTimestamp(std::string& pStr, const std::chrono::system_clock::time_point pTime)
+{
+    const std::time_t time = std::chrono::system_clock::to_time_t(pTime);
+
+    if (time != timestampCache.second)
+    {
+        std::tm timeParts{};
+
+#ifdef _WIN32
+        (void)gmtime_s(&timeParts, &time);
+#else
+        (void)gmtime_r(&time, &timeParts);
+#endif
+
+        char* const prefix = timestampCache.prefix.data();
+
+        writeDigits(prefix, static_cast<unsigned int>(timeParts.tm_year + 1900), 4);
+        prefix[4] = '-';
+        writeDigits(prefix + 5, static_cast<unsigned int>(timeParts.tm_mon + 1), 2);
+        prefix[7] = '-';
+        writeDigits(prefix + 8, static_cast<unsigned int>(timeParts.tm_mday), 2);
+        prefix[10] = 'T';
+        writeDigits(prefix + 11, static_cast<unsigned int>(timeParts.tm_hour), 2);
+        prefix[13] = ':';
+        writeDigits(prefix + 14, static_cast<unsigned int>(timeParts.tm_min), 2);
+        prefix[16] = ':';
+        writeDigits(prefix + 17, static_cast<unsigned int>(timeParts.tm_sec), 2);
+
+        timestampCache.second = time;
+    }
+
+    const auto microSecs = std::chrono::duration_cast<std::chrono::microseconds>(
+                               pTime - std::chrono::system_clock::from_time_t(time)).count();
+
+    std::array<char, 11> suffix = {'.', '0', '0', '0', '0', '0', '0', 'G', 'M', 'T'};
+    writeDigits(suffix.data() + 1, static_cast<unsigned int>(std::clamp<std::int64_t>(microSecs, 0, 999999)), 6);
+
+    pStr.append(timestampCache.prefix.data(), timestampCache.prefix.size());
+    pStr.append(suffix.data(), 10);
+}
+
+/*
+ * Appends the string representation of 'pThreadId' to 'pStr'. The representation
+ * is only regenerated if it differs from the last thread ID formatted by the calling thread.
+ */
+void appendThreadId(std::string& pStr, const std::thread::id pThreadId)
+{
+    if (pThreadId != threadIdCache.threadId || threadIdCache.threadIdStr.empty())
+    {
+        std::ostringstream osstr;
+        osstr<<pThreadId;
+
+        threadIdCache.threadId = pThreadId;
+        threadIdCache.threadIdStr = osstr.str();
+    }
+
+    pStr += threadIdCache.threadIdStr;
+}
+
+} // namespace
 
 //Public
 
@@ -51,7 +295,7 @@ std::mutex Logger::logMutex;
  */
 Logger::LogLevel Logger::getLogLevel()
 {
-    return logLevel;
+    return logLevel.load(std::memory_order_relaxed);
 }
 
 /*!
@@ -61,7 +305,7 @@ Logger::LogLevel Logger::getLogLevel()
  */
 void Logger::setLogLevel(const LogLevel pLevel)
 {
-    logLevel = pLevel;
+    logLevel.store(pLevel, std::memory_order_relaxed);
 }
 
 //
@@ -86,10 +330,15 @@ void Logger::addOutput(std::ostream& pStream)
  *
  * Removes \p pStream from the list of active log output sinks.
  *
+ * If the asynchronous backend is enabled, all pending messages are written first (see flush()).
+ *
  * \param pStream Output stream to be removed.
  */
 void Logger::removeOutput(const std::ostream& pStream)
 {
+    if (asyncBackend)
+        asyncBackend->waitProcessed();
+
     std::lock_guard<std::mutex> logLock(logMutex);
     (void)logLock;
 
@@ -178,7 +427,7 @@ void Logger::removeOutputClog()
  */
 bool Logger::addLogFile(const std::string& pFileName)
 {
-    if (files.contains(pFileName))
+    if (files.contains(pFileName) || rotatingFiles.contains(pFileName))
         return false;
 
     try
@@ -200,15 +449,66 @@ bool Logger::addLogFile(const std::string& pFileName)
     return true;
 }
 
+/*!
+ * \brief Add a block-buffered, size-rotated log file to log output streams.
+ *
+ * Opens (for appending) a file with file name \p pFileName and adds it as log output stream (see addOutput()).
+ * In contrast to addLogFile(), messages are collected in a buffer of \p pBufferSize bytes and written to the file
+ * in large blocks instead of line by line. The buffer is written when full, when the outputs are flushed (warnings
+ * and more severe messages, see also flush()) and when a message is logged while buffered data is older than one second.
+ *
+ * Once the file exceeds \p pMaxFileSize bytes, it is renamed to "FILE.1" (existing backups being shifted to "FILE.2"
+ * etc., keeping at most \p pMaxBackups of them) and a new file is started. Lines are never split across files,
+ * which means that files can exceed \p pMaxFileSize by up to \p pBufferSize bytes.
+ *
+ * Use removeLogFile() to remove and close the file again.
+ *
+ * \param pFileName File name of the log file.
+ * \param pMaxFileSize Maximum file size in bytes before rotating (no rotation if zero).
+ * \param pMaxBackups Number of rotated files to keep (rotated files are simply discarded if zero).
+ * \param pBufferSize Size of the write buffer in bytes.
+ * \return If successful.
+ */
+bool Logger::addRotatingLogFile(const std::string& pFileName, const std::uint64_t pMaxFileSize,
+                                const unsigned int pMaxBackups, const std::size_t pBufferSize)
+{
+    if (files.contains(pFileName) || rotatingFiles.contains(pFileName))
+        return false;
+
+    try
+    {
+        auto logFile = std::make_unique<RotatingFile>(pFileName, pMaxFileSize, pMaxBackups, pBufferSize);
+
+        addOutput(logFile->getStream());
+
+        rotatingFiles.insert({pFileName, std::move(logFile)});
+    }
+    catch (const std::runtime_error&)
+    {
+        std::cerr<<"ERROR: Could not open log file \"" + pFileName + "\"!"<<std::endl;
+        return false;
+    }
+
+    return true;
+}
+
 /*!
  * \brief Remove a log file from log output streams.
  *
- * Removes the previously added log file \p pFileName from the log output streams (see removeOutput()) and closes it.
+ * Removes the previously added log file \p pFileName (see addLogFile() and addRotatingLogFile())
+ * from the log output streams (see removeOutput()) and closes it.
  *
  * \param pFileName File name of the log file.
  */
 void Logger::removeLogFile(const std::string& pFileName)
 {
+    if (const auto rotIt = rotatingFiles.find(pFileName); rotIt != rotatingFiles.end())
+    {
+        removeOutput(rotIt->second->getStream());
+        rotatingFiles.erase(rotIt);
+        return;
+    }
+
     const auto it = files.find(pFileName);
 
     if (it == files.end())
@@ -386,15 +686,106 @@ void Logger::logDebugDebug(const std::string_view pMessage)
  * \brief Check whether a message with a certain log level should be logged.
  *
  * A message must be logged if \p pLevel is lower than or equal to the Logger's current log level (see getLogLevel()).
- * Messages with \p pLevel equal to LogLevel::None must never be printed.
+ * Messages with \p pLevel equal to LogLevel::None must never be printed. Messages with a log level
+ * that is not compiled in (see isCompiledIn()) are never printed either.
  *
  * \param pLevel The log level of the message to potentially be logged.
  * \return True if a message with log level \p pLevel should be logged according to the Logger's current log level.
  */
 bool Logger::includeLogLevel(const LogLevel pLevel)
 {
-    return ((pLevel != LogLevel::None) &&
-            (static_cast<std::uint8_t>(pLevel) <= static_cast<std::uint8_t>(logLevel)));
+    return ((pLevel != LogLevel::None) && isCompiledIn(pLevel) &&
+            (static_cast<std::uint8_t>(pLevel) <= static_cast<std::uint8_t>(logLevel.load(std::memory_order_relaxed))));
+}
+
+//
+
+/*!
+ * \brief Enable the asynchronous logging backend.
+ *
+ * After enabling, log() only pushes messages (together with their timestamp, log level and thread ID) into
+ * a bounded lock-free queue of size \p pQueueSize (rounded up to a power of two), and a dedicated logging thread
+ * formats the queued messages and writes them to the output streams in batches. The outputs are flushed after writing
+ * a batch that contains warnings or more severe messages. For LogLevel::Critical messages log() additionally waits
+ * until the message has been written and flushed. See also flush().
+ *
+ * If the queue is full, new messages are either discarded (\p pPolicy equal to OverflowPolicy::Drop; see also
+ * getDroppedCount()) or the logging thread blocks until there is enough room (OverflowPolicy::Block).
+ *
+ * If the asynchronous backend is already enabled, it is disabled first (see disableAsync()).
+ *
+ * \note Must not be called concurrently to logging from other threads.
+ *
+ * \throws std::invalid_argument If \p pQueueSize is zero.
+ *
+ * \param pQueueSize Maximum number of queued messages.
+ * \param pPolicy Behavior in case of a full queue.
+ */
+void Logger::enableAsync(const std::size_t pQueueSize, const OverflowPolicy pPolicy)
+{
+    if (pQueueSize == 0)
+        throw std::invalid_argument("Log message queue size must be larger than zero.");
+
+    disableAsync();
+
+    asyncBackend = std::make_unique<AsyncBackend>(pQueueSize, pPolicy);
+}
+
+/*!
+ * \brief Disable the asynchronous logging backend.
+ *
+ * Writes all pending messages, stops the logging thread and returns to synchronous logging.
+ * Does nothing if the asynchronous backend is not enabled.
+ *
+ * \note Must not be called concurrently to logging from other threads.
+ */
+void Logger::disableAsync()
+{
+    if (!asyncBackend)
+        return;
+
+    droppedCount += asyncBackend->getDroppedCount();
+
+    asyncBackend.reset();
+}
+
+/*!
+ * \brief Check if the asynchronous backend is enabled.
+ *
+ * See enableAsync().
+ *
+ * \return True if log messages are written asynchronously.
+ */
+bool Logger::isAsync()
+{
+    return static_cast<bool>(asyncBackend);
+}
+
+/*!
+ * \brief Write all pending messages and flush the outputs.
+ *
+ * Waits until the asynchronous backend (if enabled) has written all previously logged messages
+ * and then flushes all output streams.
+ */
+void Logger::flush()
+{
+    if (asyncBackend)
+        asyncBackend->waitProcessed();
+
+    writeMessages("", true);
+}
+
+/*!
+ * \brief Get the number of dropped messages.
+ *
+ * Returns the total number of messages that were discarded because of a full queue
+ * of the asynchronous backend (see enableAsync() and OverflowPolicy::Drop).
+ *
+ * \return Number of dropped messages.
+ */
+std::uint64_t Logger::getDroppedCount()
+{
+    return droppedCount + (asyncBackend ? asyncBackend->getDroppedCount() : 0);
 }
 
 //Private
@@ -402,54 +793,133 @@ bool Logger::includeLogLevel(const LogLevel pLevel)
 /*!
  * \brief Format and print a log message.
  *
- * Logs a formatted log message with text \p pMessage ("MESSAGE") prepended
- * by the current timestamp, \p pLevel ("LEVEL") and the thread ID ("xxxx"):
+ * Same as logMessage(std::string_view, std::string_view, LogLevel) without a prefix.
+ *
+ * \param pMessage The message to log.
+ * \param pLevel The log level of \p pMessage.
+ */
+void Logger::logMessage(const std::string_view pMessage, const LogLevel pLevel)
+{
+    logMessage(std::string_view(), pMessage, pLevel);
+}
+
+/*!
+ * \brief Format and print a log message with a prefix.
  *
- * "[YYYY-MM-DDThh:mm:ssGMT, LEVEL|xxxx] MESSAGE"
+ * Logs a formatted log message with text \p pMessage prepended by \p pPrefix, see formatMessage() for the format.
+ * Prefix and message are copied directly into the formatting buffer, i.e. there is no need to concatenate them beforehand.
+ * For synchronous logging this buffer is reused per thread, such that formatting does not allocate memory in general.
  *
  * The log output is written to all previously added output streams (including log files).
  * See also addOutput() and addLogFile().
  *
  * The logging is protected by a mutex, i.e. log messages from different threads will be displayed correctly.
  *
+ * If the asynchronous backend is enabled (see enableAsync()), the message is only queued for being formatted
+ * and written by the logging thread instead. Critical messages are still written and flushed before returning.
+ *
+ * \param pPrefix The prefix of the message.
  * \param pMessage The message to log.
  * \param pLevel The log level of \p pMessage.
  */
-void Logger::logMessage(const std::string_view pMessage, const LogLevel pLevel)
+void Logger::logMessage(const std::string_view pPrefix, const std::string_view pMessage, const LogLevel pLevel)
 {
-    auto now = std::chrono::system_clock::now();
-    std::time_t time = std::chrono::system_clock::to_time_t(now);
+    if (asyncBackend)
+    {
+        const std::uint64_t count = asyncBackend->push(pPrefix, pMessage, pLevel);
 
-    std::ostringstream osstr;
-    osstr<<"["<<std::put_time(std::gmtime(&time), "%FT%T%Z")<<", "<<std::setw(5)<<logLevelToLabel(pLevel)<<std::setw(0)
-         <<"|"<<std::this_thread::get_id()<<"] "<<pMessage<<"\n";
+        if (pLevel == LogLevel::Critical)
+            asyncBackend->waitProcessed(count);
 
-    std::string msg = osstr.str();
+        return;
+    }
 
-    //Output log message to all configured output streams
-    {
-        std::lock_guard<std::mutex> logLock(logMutex);
-        (void)logLock;
+    std::string& line = ::lineBuffer;
 
+    line.clear();
+
+    formatMessage(line, pPrefix, pMessage, pLevel, std::chrono::system_clock::now(), std::this_thread::get_id());
+
+    //Flush immediately for warnings and more severe messages
+    writeMessages(line, static_cast<std::uint8_t>(pLevel) <= static_cast<std::uint8_t>(LogLevel::Warning));
+}
+
+/*!
+ * \brief Format a log message and append it to a buffer.
+ *
+ * Prepends the message text \p pPrefix and \p pMessage ("PREFIXMESSAGE") by the timestamp \p pTime, \p pLevel ("LEVEL")
+ * and the thread ID \p pThreadId ("xxxx"), appends a newline and appends the resulting line to \p pLine:
+ *
+ * "[YYYY-MM-DDThh:mm:ss.uuuuuuGMT, LEVEL|xxxx] PREFIXMESSAGE"
+ *
+ * The second-resolution part of the timestamp and the thread ID string are cached per formatting thread,
+ * such that both only need to be regenerated when the second or the logging thread changes.
+ *
+ * \param pLine Buffer to append the formatted message line to.
+ * \param pPrefix The prefix of the message.
+ * \param pMessage The message to log.
+ * \param pLevel The log level of \p pMessage.
+ * \param pTime The time of logging.
+ * \param pThreadId The ID of the logging thread.
+ */
+void Logger::formatMessage(std::string& pLine, const std::string_view pPrefix, const std::string_view pMessage, const LogLevel pLevel,
+                           const std::chrono::system_clock::time_point pTime, const std::thread::id pThreadId)
+{
+    const std::string levelLabel = logLevelToLabel(pLevel);
+
+    pLine += '[';
+    ::appendTimestamp(pLine, pTime);
+    pLine += ", ";
+    if (levelLabel.size() < 5)
+        pLine.append(5 - levelLabel.size(), ' ');
+    pLine += levelLabel;
+    pLine += '|';
+    ::appendThreadId(pLine, pThreadId);
+    pLine += "] ";
+    pLine += pPrefix;
+    pLine += pMessage;
+    pLine += '\n';
+}
+
+/*!
+ * \brief Write formatted messages to all outputs.
+ *
+ * Writes \p pMessages to all configured output streams and flushes them afterwards if \p pFlush is true.
+ * Writing is protected by a mutex.
+ *
+ * \param pMessages One or more formatted message lines.
+ * \param pFlush Flush the output streams after writing.
+ */
+void Logger::writeMessages(const std::string& pMessages, const bool pFlush)
+{
+    std::lock_guard<std::mutex> logLock(logMutex);
+    (void)logLock;
+
+    if (!pMessages.empty())
+    {
         for (std::ostream& ostr : outputStreams)
-            ostr<<msg;
+            ostr<<pMessages;
+    }
 
-        //Flush immediately for warnings and more severe messages
-        if (static_cast<std::uint8_t>(pLevel) <= static_cast<std::uint8_t>(LogLevel::Warning))
+    if (pFlush)
+    {
+        for (std::ostream& ostr : outputStreams)
         {
-            for (std::ostream& ostr : outputStreams)
+            try
+            {
+                ostr.flush();
+            }
+            catch (const std::ios_base::failure&)
             {
-                try
-                {
-                    ostr.flush();
-                }
-                catch (const std::ios_base::failure&)
-                {
-                    std::cerr<<"ERROR: Could not flush log output stream!"<<std::endl;
-                }
+                std::cerr<<"ERROR: Could not flush log output stream!"<<std::endl;
             }
         }
     }
+    else
+    {
+        for (const auto& [fileName, rotatingFile] : rotatingFiles)
+            rotatingFile->flushIfDue();
+    }
 }
 
 //
@@ -524,3 +994,459 @@ Logger::LogLevel Logger::labelToLogLevel(const std::string& pLevel)
     else
         return LogLevel::None;
 }
+
+//Logger::RotatingFile
+
+//Public
+
+/*!
+ * \brief Constructor.
+ *
+ * Opens the file \p pFileName for appending.
+ *
+ * \throws std::runtime_error If the file cannot be opened.
+ *
+ * \param pFileName File name of the log file.
+ * \param pMaxFileSize Maximum file size in bytes before rotating (no rotation if zero).
+ * \param pMaxBackups Number of rotated files to keep.
+ * \param pBufferSize Size of the write buffer in bytes (at least 1).
+ */
+Logger::RotatingFile::RotatingFile(std::string pFileName, const std::uint64_t pMaxFileSize, const unsigned int pMaxBackups,
+                                   const std::size_t pBufferSize) :
+    fileName(std::move(pFileName)),
+    maxFileSize(pMaxFileSize),
+    maxBackups(pMaxBackups),
+    buffer(std::max<std::size_t>(pBufferSize, 1)),
+    bufferedSince(std::nullopt),
+    file(std::fopen(fileName.c_str(), "ab")),
+    fileSize(0),
+    stream(this)
+{
+    if (file == nullptr)
+        throw std::runtime_error("Could not open log file \"" + fileName + "\".");
+
+    //Data is only written in large blocks anyway
+    (void)std::setvbuf(file, nullptr, _IONBF, 0);
+
+    std::error_code errCode;
+    const std::uintmax_t existingSize = std::filesystem::file_size(fileName, errCode);
+    if (!errCode)
+        fileSize = existingSize;
+
+    setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Writes the remaining buffered data and closes the file.
+ */
+Logger::RotatingFile::~RotatingFile()
+{
+    if (!writeBuffer())
+        std::cerr<<"ERROR: Could not write to log file \"" + fileName + "\"!"<<std::endl;
+
+    if (file != nullptr)
+        (void)std::fclose(file);
+}
+
+//
+
+/*!
+ * \brief Get the output stream writing to the file.
+ *
+ * \return Stream that writes into the buffer of this file.
+ */
+std::ostream& Logger::RotatingFile::getStream()
+{
+    return stream;
+}
+
+/*!
+ * \brief Write the buffer if it holds data older than \ref flushInterval.
+ */
+void Logger::RotatingFile::flushIfDue()
+{
+    if (pptr() == pbase())
+        return;
+
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    if (!bufferedSince.has_value())
+        bufferedSince = now;
+
+    if (now - *bufferedSince < flushInterval)
+        return;
+
+    if (!writeBuffer())
+        std::cerr<<"ERROR: Could not write to log file \"" + fileName + "\"!"<<std::endl;
+}
+
+//Private
+
+/*!
+ * \brief Write the full buffer and store a character.
+ *
+ * \param pChar Character that did not fit into the buffer anymore (or EOF).
+ * \return \p pChar (or a value other than EOF if \p pChar is EOF) on success and EOF on failure.
+ */
+int Logger::RotatingFile::overflow(const int pChar)
+{
+    if (!writeBuffer())
+        return traits_type::eof();
+
+    if (traits_type::eq_int_type(pChar, traits_type::eof()))
+        return traits_type::not_eof(pChar);
+
+    *pptr() = traits_type::to_char_type(pChar);
+    pbump(1);
+
+    return pChar;
+}
+
+/*!
+ * \brief Write the buffer.
+ *
+ * \return 0 on success and -1 on failure.
+ */
+int Logger::RotatingFile::sync()
+{
+    return writeBuffer() ? 0 : -1;
+}
+
+//
+
+/*!
+ * \brief Write the buffered data to the file, rotating if needed.
+ *
+ * If the data would make the file exceed the maximum size, writes the data up to the last complete line,
+ * then rotates the files (see rotate()) and writes the remaining data to the new file.
+ *
+ * \return If successful.
+ */
+bool Logger::RotatingFile::writeBuffer()
+{
+    const char* data = pbase();
+    std::size_t size = static_cast<std::size_t>(pptr() - pbase());
+
+    if (size == 0)
+        return true;
+
+    setp(buffer.data(), buffer.data() + buffer.size());
+
+    bool success = true;
+
+    if (maxFileSize > 0 && fileSize + size > maxFileSize)
+    {
+        const std::string_view dataView(data, size);
+
+        if (const std::size_t lineEnd = dataView.rfind('\n'); lineEnd != std::string_view::npos)
+        {
+            success = writeRaw(data, lineEnd + 1);
+
+            data += lineEnd + 1;
+            size -= lineEnd + 1;
+        }
+
+        if (fileSize > 0)
+            success = rotate() && success;
+    }
+
+    success = writeRaw(data, size) && success;
+
+    bufferedSince.reset();
+
+    return success;
+}
+
+/*!
+ * \brief Write data to the file.
+ *
+ * \param pData Data to write.
+ * \param pSize Number of bytes of \p pData.
+ * \return If successful.
+ */
+bool Logger::RotatingFile::writeRaw(const char* const pData, const std::size_t pSize)
+{
+    if (pSize == 0)
+        return true;
+
+    if (file == nullptr)
+        return false;
+
+    const std::size_t written = std::fwrite(pData, 1, pSize, file);
+
+    fileSize += written;
+
+    return written == pSize;
+}
+
+/*!
+ * \brief Rotate the files and start a new file.
+ *
+ * Closes the file, shifts the existing backups "FILE.N" to "FILE.N+1" (discarding the oldest one),
+ * renames the file to "FILE.1" and opens a new, empty file.
+ *
+ * \return If successful.
+ */
+bool Logger::RotatingFile::rotate()
+{
+    if (file != nullptr)
+        (void)std::fclose(file);
+
+    std::error_code errCode;
+
+    if (maxBackups > 0)
+    {
+        std::filesystem::remove(fileName + "." + std::to_string(maxBackups), errCode);
+
+        for (unsigned int i = maxBackups - 1; i > 0; --i)
+            std::filesystem::rename(fileName + "." + std::to_string(i), fileName + "." + std::to_string(i + 1), errCode);
+
+        std::filesystem::rename(fileName, fileName + ".1", errCode);
+    }
+
+    file = std::fopen(fileName.c_str(), "wb");
+    fileSize = 0;
+
+    if (file == nullptr)
+        return false;
+
+    (void)std::setvbuf(file, nullptr, _IONBF, 0);
+
+    return true;
+}
+
+//Logger::AsyncBackend
+
+//Public
+
+/*!
+ * \brief Constructor.
+ *
+ * Allocates the message queue with at least \p pQueueSize slots (rounded up to a power of two) and starts the logging thread.
+ *
+ * \param pQueueSize Minimum number of queue slots.
+ * \param pPolicy Behavior in case of a full queue.
+ */
+Logger::AsyncBackend::AsyncBackend(const std::size_t pQueueSize, const OverflowPolicy pPolicy) :
+    policy(pPolicy),
+    indexMask(std::bit_ceil(pQueueSize) - 1),
+    slots(std::make_unique<Slot[]>(indexMask + 1)),
+    enqueuePos(0),
+    dequeuePos(0),
+    processedCount(0),
+    droppedCount(0),
+    wakeSignal(0),
+    stopRequested(false),
+    thread()
+{
+    for (std::size_t i = 0; i <= indexMask; ++i)
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+
+    thread = std::thread(&AsyncBackend::run, this);
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Lets the logging thread write all pending messages and waits for it to finish.
+ */
+Logger::AsyncBackend::~AsyncBackend()
+{
+    stopRequested.store(true, std::memory_order_release);
+
+    wakeSignal.fetch_add(1, std::memory_order_release);
+    wakeSignal.notify_one();
+
+    if (thread.joinable())
+        thread.join();
+}
+
+//
+
+/*!
+ * \brief Push a log message to the queue.
+ *
+ * Stores \p pMessage (prepended by \p pPrefix) together with \p pLevel, the current time and the calling thread's ID in the queue and wakes
+ * up the logging thread. If the queue is full, the message is either dropped or the call blocks until there is room,
+ * depending on the configured OverflowPolicy.
+ *
+ * \param pPrefix The prefix of the message.
+ * \param pMessage The message to log.
+ * \param pLevel The log level of \p pMessage.
+ * \return Number of queued messages up to and including this one (to be used for waitProcessed(std::uint64_t)),
+ *         or zero if the message was dropped.
+ */
+std::uint64_t Logger::AsyncBackend::push(const std::string_view pPrefix, const std::string_view pMessage, const LogLevel pLevel)
+{
+    Record record{std::string(), pLevel, std::chrono::system_clock::now(), std::this_thread::get_id()};
+
+    record.message.reserve(pPrefix.size() + pMessage.size());
+    record.message += pPrefix;
+    record.message += pMessage;
+
+    std::uint64_t pos = 0;
+
+    while (!tryPush(record, pos))
+    {
+        if (policy == OverflowPolicy::Drop)
+        {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return 0;
+        }
+
+        std::this_thread::yield();
+    }
+
+    wakeSignal.fetch_add(1, std::memory_order_release);
+    wakeSignal.notify_one();
+
+    return pos + 1;
+}
+
+/*!
+ * \brief Wait until all queued messages have been written.
+ *
+ * Blocks until the logging thread has written (and, if needed, flushed) all messages that were queued
+ * (or started to be queued) before the call. See also waitProcessed(std::uint64_t).
+ */
+void Logger::AsyncBackend::waitProcessed()
+{
+    waitProcessed(enqueuePos.load(std::memory_order_acquire));
+}
+
+/*!
+ * \brief Wait until a number of queued messages have been written.
+ *
+ * Blocks until the logging thread has written (and, if needed, flushed) the first \p pCount queued messages.
+ *
+ * \param pCount Number of messages, as returned by push().
+ */
+void Logger::AsyncBackend::waitProcessed(const std::uint64_t pCount)
+{
+    for (std::uint64_t processed = processedCount.load(std::memory_order_acquire); processed < pCount;
+         processed = processedCount.load(std::memory_order_acquire))
+    {
+        processedCount.wait(processed, std::memory_order_acquire);
+    }
+}
+
+/*!
+ * \brief Get the number of dropped messages.
+ *
+ * \return Number of messages that were dropped due to a full queue.
+ */
+std::uint64_t Logger::AsyncBackend::getDroppedCount() const
+{
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+//Private
+
+/*!
+ * \brief Try to push a record to the queue.
+ *
+ * Claims the next queue position and moves \p pRecord into its slot if the slot has already been read.
+ *
+ * \param pRecord Record to be moved into the queue.
+ * \param pPos Set to the claimed queue position on success.
+ * \return False if the queue is full.
+ */
+bool Logger::AsyncBackend::tryPush(Record& pRecord, std::uint64_t& pPos)
+{
+    std::uint64_t pos = enqueuePos.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        Slot& slot = slots[pos & indexMask];
+
+        const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+        if (sequence == pos)
+        {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot.record = std::move(pRecord);
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                pPos = pos;
+                return true;
+            }
+        }
+        else if (sequence < pos)
+            return false;
+        else
+            pos = enqueuePos.load(std::memory_order_relaxed);
+    }
+}
+
+/*!
+ * \brief Try to pop a record from the queue.
+ *
+ * Moves the record at the next read position into \p pRecord if it has already been written and releases its slot.
+ *
+ * \param pRecord Destination for the popped record.
+ * \return False if the queue is empty.
+ */
+bool Logger::AsyncBackend::tryPop(Record& pRecord)
+{
+    Slot& slot = slots[dequeuePos & indexMask];
+
+    if (slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1)
+        return false;
+
+    pRecord = std::move(slot.record);
+    slot.sequence.store(dequeuePos + indexMask + 1, std::memory_order_release);
+
+    ++dequeuePos;
+
+    return true;
+}
+
+/*!
+ * \brief Run the logging thread.
+ *
+ * Repeatedly pops all available records, formats them into a single batch and writes the batch to all outputs
+ * (see Logger::writeMessages()), flushing them if the batch contains warnings or more severe messages.
+ * Sleeps while the queue is empty and returns once stopping was requested and the queue has been emptied.
+ */
+void Logger::AsyncBackend::run()
+{
+    std::string batch;
+    Record record;
+
+    for (;;)
+    {
+        const std::uint64_t signal = wakeSignal.load(std::memory_order_acquire);
+
+        std::uint64_t batchCount = 0;
+        bool flushBatch = false;
+
+        batch.clear();
+
+        while (tryPop(record))
+        {
+            Logger::formatMessage(batch, std::string_view(), record.message, record.level, record.time, record.threadId);
+
+            if (static_cast<std::uint8_t>(record.level) <= static_cast<std::uint8_t>(LogLevel::Warning))
+                flushBatch = true;
+
+            ++batchCount;
+        }
+
+        if (batchCount > 0)
+        {
+            Logger::writeMessages(batch, flushBatch);
+
+            processedCount.fetch_add(batchCount, std::memory_order_release);
+            processedCount.notify_all();
+
+            continue;
+        }
+
+        if (stopRequested.load(std::memory_order_acquire))
+            break;
+
+        wakeSignal.wait(signal, std::memory_order_acquire);
+    }
+}
@@ -24,18 +24,34 @@
 #ifndef CASIL_LOGGER_H
 #define CASIL_LOGGER_H
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
 #include <list>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
+
+#ifndef CASIL_MIN_LOG_LEVEL
+/*!
+ * \brief Numeric value of the least severe log level that is compiled in (see Logger::minCompiledLogLevel).
+ *
+ * Set via the CMake option of the same name. Defaults to Logger::LogLevel::DebugDebug (i.e. nothing is stripped).
+ */
+#define CASIL_MIN_LOG_LEVEL 90
+#endif
 
 namespace casil
 {
 
+class ContextualLogger;
+
 /*!
  * \brief Print log messages.
  *
@@ -44,7 +60,8 @@ namespace casil
  * shortcuts addOutputCout(), addOutputCerr(), addOutputClog() and corresponding removers.
  *
  * Log files can be either added as ostreams (see above) or automatically opened and added
- * via the file name using addLogFile(), respectively removed and closed using removeLogFile().
+ * via the file name using addLogFile(), respectively removed and closed using removeLogFile(). For long-running
+ * applications, addRotatingLogFile() adds a log file that is written in large blocks and rotated by size.
  *
  * Logging a message can be done by calling log(). See there for details about the formatting etc.
  *
@@ -55,7 +72,16 @@ namespace casil
  * logCritical(), ..., logDebugDebug().
  *
  * Note that the writing of each log message is protected by a mutex, such that logging also works from multiple threads.
- * See also log().
+ * The log level can also be changed concurrently to logging. See also log().
+ *
+ * Log messages with levels less severe than minCompiledLogLevel (see \c CASIL_MIN_LOG_LEVEL) are never logged. Using the
+ * logging macros \ref CASIL_LOG and \ref CASIL_CLOG (and their per-level shortcuts) instead of the logging functions,
+ * such log call sites are removed at compile time including the evaluation of the message arguments. For the levels that are
+ * compiled in, the macros also skip the message evaluation if the level is excluded by the current log level at runtime.
+ *
+ * Optionally, an asynchronous backend can be enabled via enableAsync(). Then log() only pushes the message into
+ * a bounded lock-free queue and a dedicated thread formats the messages and writes them to the output streams.
+ * See enableAsync() for details.
  */
 class Logger
 {
@@ -79,6 +105,17 @@ public:
         DebugDebug = 90     ///< Log even more debug messages.
     };
 
+    /*!
+     * \brief Behavior of the asynchronous backend if its message queue is full.
+     *
+     * See enableAsync().
+     */
+    enum class OverflowPolicy : std::uint8_t
+    {
+        Drop  = 0,          ///< Discard the new message (and count it, see getDroppedCount()).
+        Block = 1           ///< Wait until the logging thread made room for the new message.
+    };
+
 public:
     Logger() = delete;                                                                  ///< Deleted constructor.
     //
@@ -96,6 +133,10 @@ public:
     static void removeOutputClog();                                                     ///< Remove std::clog from log output streams.
     //
     static bool addLogFile(const std::string& pFileName);                               ///< Add a log file to log output streams.
+    static bool addRotatingLogFile(const std::string& pFileName, std::uint64_t pMaxFileSize = 64*1024*1024,
+                                   unsigned int pMaxBackups = 5, std::size_t pBufferSize = 1024*1024);
+                                                                                        ///< \brief Add a block-buffered, size-rotated log file
+                                                                                        ///  to log output streams.
     static void removeLogFile(const std::string& pFileName);                            ///< Remove a log file from log output streams.
     //
     static void log(std::string_view pMessage, LogLevel pLevel = LogLevel::Info);       ///< Print a log message.
@@ -111,22 +152,90 @@ public:
     static void logDebugDebug(std::string_view pMessage);                               ///< Print a log message (LogLevel::DebugDebug).
     //
     static bool includeLogLevel(LogLevel pLevel);                       ///< Check whether a message with a certain log level should be logged.
+    /*!
+     * \brief Check whether logging of a certain log level is compiled in.
+     *
+     * \param pLevel The log level.
+     * \return True if \p pLevel is LogLevel::None or at least as severe as minCompiledLogLevel.
+     */
+    static constexpr bool isCompiledIn(const LogLevel pLevel)
+    {
+        return static_cast<std::uint8_t>(pLevel) <= static_cast<std::uint8_t>(minCompiledLogLevel);
+    }
+    //
+    static void enableAsync(std::size_t pQueueSize = 4096,
+                            OverflowPolicy pPolicy = OverflowPolicy::Drop);             ///< Enable the asynchronous logging backend.
+    static void disableAsync();                                                         ///< Disable the asynchronous logging backend.
+    static bool isAsync();                                                              ///< Check if the asynchronous backend is enabled.
+    static void flush();                                                                ///< Write all pending messages and flush the outputs.
+    static std::uint64_t getDroppedCount();                                             ///< Get the number of dropped messages.
+
+public:
+    static constexpr LogLevel minCompiledLogLevel = static_cast<LogLevel>(CASIL_MIN_LOG_LEVEL);
+                                                                                        ///< Least severe log level that is compiled in.
+
+private:
+    class AsyncBackend;
+    class RotatingFile;
+    //
+    friend class ContextualLogger;  //Uses logMessage() after applying its own log level check
 
 private:
     static void logMessage(std::string_view pMessage, LogLevel pLevel);                 ///< Format and print a log message.
+    static void logMessage(std::string_view pPrefix, std::string_view pMessage, LogLevel pLevel);
+                                                                                        ///< Format and print a log message with a prefix.
+    static void formatMessage(std::string& pLine, std::string_view pPrefix, std::string_view pMessage, LogLevel pLevel,
+                              std::chrono::system_clock::time_point pTime,
+                              std::thread::id pThreadId);                               ///< Format a log message and append it to a buffer.
+    static void writeMessages(const std::string& pMessages, bool pFlush);               ///< Write formatted messages to all outputs.
     //
     static std::string logLevelToLabel(LogLevel pLevel);                                ///< Get the label for a log level.
     static LogLevel labelToLogLevel(const std::string& pLevel);                         ///< Get the log level from its label.
 
 private:
-    static LogLevel logLevel;                                                           ///< Defines, which log messages are accepted.
+    static std::atomic<LogLevel> logLevel;                                              ///< Defines, which log messages are accepted.
     //
     static std::list<std::reference_wrapper<std::ostream>> outputStreams;               ///< List of used output streams.
     static std::map<std::string, std::ofstream> files;                                  ///< Map of open log files.
+    static std::map<std::string, std::unique_ptr<RotatingFile>> rotatingFiles;          ///< Map of open rotating log files.
     //
     static std::mutex logMutex;                                                         ///< Mutex to allow logging from different threads.
+    //
+    static std::unique_ptr<AsyncBackend> asyncBackend;                                  ///< Asynchronous backend (if enabled).
+    static std::uint64_t droppedCount;                                                  ///< Messages dropped by previous backends.
 };
 
 } // namespace casil
 
+/*!
+ * \brief Print a log message via Logger, if its log level is compiled in and included by the current log level.
+ *
+ * Expands to nothing if \p LEVEL is not compiled in (see Logger::isCompiledIn()). Otherwise \p MESSAGE
+ * is only evaluated and passed to Logger::log() if \p LEVEL is included by the current log level.
+ *
+ * \param LEVEL The log level of the message (must be a constant expression).
+ * \param MESSAGE Expression for the message to log (convertible to \e std::string_view).
+ */
+#define CASIL_LOG(LEVEL, MESSAGE) \
+    do { \
+        if constexpr (casil::Logger::isCompiledIn(LEVEL)) \
+        { \
+            if (casil::Logger::includeLogLevel(LEVEL)) \
+                casil::Logger::log((MESSAGE), (LEVEL)); \
+        } \
+    } while (false)
+
+/*!
+ * \brief \ref CASIL_LOG for LogLevel::Verbose.
+ */
+#define CASIL_LOG_VERBOSE(MESSAGE) CASIL_LOG(casil::Logger::LogLevel::Verbose, MESSAGE)
+/*!
+ * \brief \ref CASIL_LOG for LogLevel::Debug.
+ */
+#define CASIL_LOG_DEBUG(MESSAGE) CASIL_LOG(casil::Logger::LogLevel::Debug, MESSAGE)
+/*!
+ * \brief \ref CASIL_LOG for LogLevel::DebugDebug.
+ */
+#define CASIL_LOG_DEBUGDEBUG(MESSAGE) CASIL_LOG(casil::Logger::LogLevel::DebugDebug, MESSAGE)
+
 #endif // CASIL_LOGGER_H
@@ -0,0 +1,281 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/memoryplacement.h>
+
+#include <casil/layerconfig.h>
+#include <casil/logger.h>
+
+#include <boost/predef/os/linux.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <new>
+#include <string>
+
+#if BOOST_OS_LINUX != 0
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using casil::MemoryPlacement;
+
+namespace
+{
+
+#if BOOST_OS_LINUX != 0
+/*
+ * Rounds 'pSize' up to the size actually mapped for a placement (multiple of the huge page or the regular page size).
+ */
+std::size_t getMappedSize(const std::size_t pSize, const bool pHugePages)
+{
+    static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    const std::size_t granularity = (pHugePages ? MemoryPlacement::hugePageSize : pageSize);
+
+    return ((std::max(pSize, std::size_t{1}) + granularity - 1) / granularity) * granularity;
+}
+
+/*
+ * Maps 'pSize' bytes (multiple of the huge page size) aligned to the huge page size and advises transparent huge pages.
+ * Returns MAP_FAILED if the mapping fails or transparent huge pages are not available.
+ */
+void* mapTransparentHugePages(const std::size_t pSize)
+{
+    void* const rawPtr = mmap(nullptr, pSize + MemoryPlacement::hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (rawPtr == MAP_FAILED)
+        return MAP_FAILED;
+
+    //Trim the mapping to the aligned range
+
+    const std::uintptr_t rawAddr = reinterpret_cast<std::uintptr_t>(rawPtr);
+    const std::uintptr_t alignedAddr = ((rawAddr + MemoryPlacement::hugePageSize - 1) / MemoryPlacement::hugePageSize) *
+                                       MemoryPlacement::hugePageSize;
+
+    if (alignedAddr > rawAddr)
+        munmap(rawPtr, alignedAddr - rawAddr);
+
+    const std::size_t tailSize = MemoryPlacement::hugePageSize - (alignedAddr - rawAddr);
+
+    if (tailSize > 0)
+        munmap(reinterpret_cast<void*>(alignedAddr + pSize), tailSize);
+
+    void* const alignedPtr = reinterpret_cast<void*>(alignedAddr);
+
+    if (madvise(alignedPtr, pSize, MADV_HUGEPAGE) != 0)
+    {
+        munmap(alignedPtr, pSize);
+        return MAP_FAILED;
+    }
+
+    return alignedPtr;
+}
+
+/*
+ * Binds the mapped range to NUMA node 'pNode' with preferred policy (via the raw system call to avoid a libnuma dependency).
+ */
+bool bindToNumaNode(void* const pPtr, const std::size_t pSize, const int pNode)
+{
+    constexpr int mpolPreferred = 1;
+    constexpr int maxNodes = 64;
+
+    if (pNode >= maxNodes)
+        return false;
+
+    const unsigned long nodeMask = 1ul << pNode;
+
+    return syscall(SYS_mbind, pPtr, pSize, mpolPreferred, &nodeMask, maxNodes + 1, 0) == 0;
+}
+#endif
+
+} // namespace
+
+/*!
+ * \brief Check if this is the default heap placement.
+ *
+ * \return True if neither huge pages nor a NUMA node are requested.
+ */
+bool MemoryPlacement::isDefault() const
+{
+    return !hugePages && numaNode < 0;
+}
+
+//
+
+/*!
+ * \brief Read a placement from a component configuration.
+ *
+ * Reads the optional values "PREFIXhuge_pages" (boolean type, default: false) and "PREFIXnuma_node" (integer type,
+ * default: -1, i.e. no binding) from \p pConfig, with \p pPrefix substituted for \c PREFIX (e.g. "init.fifo_").
+ * If the optional "PREFIXnuma_device" string (default: empty) is set to the name of a network interface (e.g. "eth0"),
+ * the NUMA node of that network interface card is used instead (see getNetworkDeviceNumaNode()).
+ *
+ * \param pConfig Component configuration.
+ * \param pPrefix Common prefix of the configuration keys.
+ * \return Configured placement.
+ */
+MemoryPlacement MemoryPlacement::fromConfig(const LayerConfig& pConfig, const std::string& pPrefix)
+{
+    MemoryPlacement placement{.hugePages = pConfig.getBool(pPrefix + "huge_pages", false),
+                              .numaNode = pConfig.getInt(pPrefix + "numa_node", -1)};
+
+    const std::string numaDevice = pConfig.getStr(pPrefix + "numa_device", "");
+
+    if (numaDevice != "")
+    {
+        placement.numaNode = getNetworkDeviceNumaNode(numaDevice);
+
+        if (placement.numaNode < 0)
+            Logger::logWarning("Could not determine NUMA node of network interface \"" + numaDevice + "\".");
+    }
+
+    return placement;
+}
+
+//
+
+/*!
+ * \brief Allocate memory with a placement.
+ *
+ * Uses the heap for the default placement (see isDefault()) and on platforms other than Linux.
+ * Otherwise maps anonymous memory as described for MemoryPlacement. Logs a warning (but still succeeds)
+ * if the memory cannot be bound to the requested NUMA node.
+ *
+ * \throws std::bad_alloc If the allocation fails.
+ *
+ * \param pSize Number of bytes.
+ * \param pPlacement Placement of the memory.
+ * \return Pointer to the uninitialized memory (must be freed via deallocate() with the same size and placement).
+ */
+void* MemoryPlacement::allocate(const std::size_t pSize, const MemoryPlacement& pPlacement)
+{
+#if BOOST_OS_LINUX != 0
+    if (pPlacement.isDefault())
+        return ::operator new(pSize);
+
+    const std::size_t mappedSize = ::getMappedSize(pSize, pPlacement.hugePages);
+
+    void* ptr = MAP_FAILED;
+
+    if (pPlacement.hugePages)
+    {
+        ptr = ::mapTransparentHugePages(mappedSize);
+
+        if (ptr == MAP_FAILED)
+            ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+
+    if (ptr == MAP_FAILED)
+        ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (ptr == MAP_FAILED)
+        throw std::bad_alloc();
+
+    if (pPlacement.numaNode >= 0 && !::bindToNumaNode(ptr, mappedSize, pPlacement.numaNode))
+        Logger::logWarning("Could not bind memory to NUMA node " + std::to_string(pPlacement.numaNode) + ".");
+
+    return ptr;
+#else
+    (void)pPlacement;
+    return ::operator new(pSize);
+#endif
+}
+
+/*!
+ * \brief Free memory from allocate().
+ *
+ * \param pPtr Pointer returned by allocate() (may be null).
+ * \param pSize Number of bytes passed to allocate().
+ * \param pPlacement Placement passed to allocate().
+ */
+void MemoryPlacement::deallocate(void* const pPtr, const std::size_t pSize, const MemoryPlacement& pPlacement) noexcept
+{
+    if (pPtr == nullptr)
+        return;
+
+#if BOOST_OS_LINUX != 0
+    if (pPlacement.isDefault())
+        ::operator delete(pPtr);
+    else
+        munmap(pPtr, ::getMappedSize(pSize, pPlacement.hugePages));
+#else
+    (void)pSize;
+    (void)pPlacement;
+    ::operator delete(pPtr);
+#endif
+}
+
+//
+
+/*!
+ * \brief Get the NUMA node of a network interface card.
+ *
+ * Reads the node of the PCI device behind network interface \p pDeviceName (e.g. "eth0") from sysfs (Linux only).
+ *
+ * \param pDeviceName Name of the network interface.
+ * \return NUMA node or -1 if unknown (e.g. virtual interfaces, single-node hosts or other platforms).
+ */
+int MemoryPlacement::getNetworkDeviceNumaNode(const std::string& pDeviceName)
+{
+#if BOOST_OS_LINUX != 0
+    if (pDeviceName == "" || pDeviceName.find('/') != std::string::npos || pDeviceName == "." || pDeviceName == "..")
+        return -1;
+
+    std::ifstream file("/sys/class/net/" + pDeviceName + "/device/numa_node");
+
+    int node = -1;
+
+    if (!(file >> node))
+        return -1;
+
+    return (node >= 0 ? node : -1);
+#else
+    (void)pDeviceName;
+    return -1;
+#endif
+}
+
+/*!
+ * \brief Get the NUMA node of the calling thread's CPU.
+ *
+ * Note that the result is only meaningful for threads pinned to a CPU core or NUMA node (Linux only).
+ *
+ * \return NUMA node or -1 if unknown.
+ */
+int MemoryPlacement::getCurrentNumaNode()
+{
+#if BOOST_OS_LINUX != 0
+    unsigned int cpu = 0;
+    unsigned int node = 0;
+
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+        return -1;
+
+    return static_cast<int>(node);
+#else
+    return -1;
+#endif
+}
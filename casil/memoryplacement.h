@@ -0,0 +1,160 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_MEMORYPLACEMENT_H
+#define CASIL_MEMORYPLACEMENT_H
+
+#include <cstddef>
+#include <string>
+
+namespace casil
+{
+
+class LayerConfig;
+
+/*!
+ * \brief Huge page and NUMA node options for large, long-lived buffers (e.g. FIFO rings and file writer blocks).
+ *
+ * At sustained high data rates, buffers of many megabytes cause frequent TLB misses when backed by regular 4 kB pages
+ * and cross-socket memory traffic when located on the "wrong" NUMA node of a multi-socket host. allocate() therefore
+ * maps such buffers directly (instead of using the heap) if requested:
+ *
+ * - With \ref hugePages the mapping is aligned to and rounded up to \ref hugePageSize and advised for transparent
+ *   huge pages (\c madvise(MADV_HUGEPAGE)). If transparent huge pages are unavailable, it falls back to explicitly
+ *   reserved huge pages (\c MAP_HUGETLB, see hugetlbfs) and finally to regular pages.
+ * - With a non-negative \ref numaNode the mapping is bound to that node (preferred policy, i.e. falls back to other nodes
+ *   if the node runs out of memory). See getNetworkDeviceNumaNode() and getCurrentNumaNode() for finding the node of
+ *   the network interface card or of the consuming thread.
+ *
+ * The default placement (no huge pages, no NUMA node) simply uses the heap. Use PlacedAllocator to apply a placement
+ * to standard containers. Huge pages and NUMA binding are only supported on Linux (the heap is used otherwise).
+ */
+struct MemoryPlacement
+{
+    bool hugePages = false;                     ///< Back the memory by huge pages.
+    int numaNode = -1;                          ///< NUMA node to allocate the memory on (negative for no binding).
+    //
+    bool isDefault() const;                     ///< Check if this is the default heap placement.
+    bool operator==(const MemoryPlacement&) const = default;   ///< Default comparison.
+    //
+    static MemoryPlacement fromConfig(const LayerConfig& pConfig, const std::string& pPrefix);  ///< Read a placement from a component configuration.
+    //
+    static void* allocate(std::size_t pSize, const MemoryPlacement& pPlacement);        ///< Allocate memory with a placement.
+    static void deallocate(void* pPtr, std::size_t pSize, const MemoryPlacement& pPlacement) noexcept;
+                                                                                        ///< Free memory from allocate().
+    //
+    static int getNetworkDeviceNumaNode(const std::string& pDeviceName);    ///< Get the NUMA node of a network interface card.
+    static int getCurrentNumaNode();                                        ///< Get the NUMA node of the calling thread's CPU.
+    //
+    static constexpr std::size_t hugePageSize = 2097152;                    ///< Assumed huge page size (2 MiB).
+};
+
+/*!
+ * \brief Standard allocator that applies a MemoryPlacement.
+ *
+ * Allows to use MemoryPlacement::allocate() with standard containers such as \c std::vector.
+ * Containers with the default placement behave like with \c std::allocator.
+ *
+ * \tparam T Value type.
+ */
+template<typename T>
+class PlacedAllocator
+{
+public:
+    using value_type = T;                       ///< Value type.
+
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param pPlacement Placement of the allocated memory.
+     */
+    PlacedAllocator(const MemoryPlacement pPlacement = MemoryPlacement{}) noexcept :    // cppcheck-suppress noExplicitConstructor
+        placement(pPlacement)
+    {
+    }
+    /*!
+     * \brief Converting copy constructor.
+     *
+     * \tparam U Other value type.
+     * \param pOther Other allocator.
+     */
+    template<typename U>
+    PlacedAllocator(const PlacedAllocator<U>& pOther) noexcept :                        // cppcheck-suppress noExplicitConstructor
+        placement(pOther.getPlacement())
+    {
+    }
+    //
+    /*!
+     * \brief Allocate memory for a number of values.
+     *
+     * \throws std::bad_alloc If the allocation fails.
+     *
+     * \param pNum Number of values.
+     * \return Pointer to the uninitialized memory.
+     */
+    T* allocate(const std::size_t pNum)
+    {
+        return static_cast<T*>(MemoryPlacement::allocate(pNum * sizeof(T), placement));
+    }
+    /*!
+     * \brief Free memory from allocate().
+     *
+     * \param pPtr Pointer returned by allocate().
+     * \param pNum Number of values passed to allocate().
+     */
+    void deallocate(T* const pPtr, const std::size_t pNum) noexcept
+    {
+        MemoryPlacement::deallocate(pPtr, pNum * sizeof(T), placement);
+    }
+    //
+    /*!
+     * \brief Get the placement of the allocated memory.
+     *
+     * \return Placement.
+     */
+    MemoryPlacement getPlacement() const noexcept
+    {
+        return placement;
+    }
+    //
+    /*!
+     * \brief Compare two allocators.
+     *
+     * \tparam U Other value type.
+     * \param pOther Other allocator.
+     * \return True if memory from one allocator can be freed by the other (i.e. same placement).
+     */
+    template<typename U>
+    bool operator==(const PlacedAllocator<U>& pOther) const noexcept
+    {
+        return placement == pOther.getPlacement();
+    }
+
+private:
+    MemoryPlacement placement;                  ///< Placement of the allocated memory.
+};
+
+} // namespace casil
+
+#endif // CASIL_MEMORYPLACEMENT_H
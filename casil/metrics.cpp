@@ -0,0 +1,785 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/metrics.h>
+
+#include <casil/asio.h>
+#include <casil/logger.h>
+
+#include <utility>  //Missing include in boost/asio/awaitable.hpp of some Boost versions
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/system/error_code.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <future>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+using casil::Metrics;
+
+namespace
+{
+
+using boost::asio::ip::tcp;
+
+/*
+ * Maximum accepted size of an HTTP request header.
+ */
+constexpr std::size_t maxHttpRequestSize = 8192;
+
+/*
+ * Checks if 'pName' is a valid metric or label name (letters, digits, underscores and,
+ * for metric names only, colons; must not start with a digit).
+ */
+bool isValidName(const std::string& pName, const bool pAllowColon)
+{
+    if (pName.empty() || (pName[0] >= '0' && pName[0] <= '9'))
+        return false;
+
+    return std::all_of(pName.begin(), pName.end(), [pAllowColon](const char c) -> bool
+                                                   {
+                                                       return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                                                              (c >= '0' && c <= '9') || c == '_' || (pAllowColon && c == ':');
+                                                   });
+}
+
+/*
+ * Escapes backslashes, newlines and (if 'pEscapeQuotes') double quotes in 'pStr'.
+ */
+std::string escapeText(const std::string& pStr, const bool pEscapeQuotes)
+{
+    std::string escaped;
+    escaped.reserve(pStr.size());
+
+    for (const char c : pStr)
+    {
+        if (c == '\\')
+            escaped += "\\\\";
+        else if (c == '\n')
+            escaped += "\\n";
+        else if (c == '"' && pEscapeQuotes)
+            escaped += "\\\"";
+        else
+            escaped += c;
+    }
+
+    return escaped;
+}
+
+/*
+ * Formats a floating point value in the shortest exact representation (or as "NaN", "+Inf", "-Inf").
+ */
+std::string formatValue(const double pValue)
+{
+    if (std::isnan(pValue))
+        return "NaN";
+    else if (std::isinf(pValue))
+        return (pValue > 0 ? "+Inf" : "-Inf");
+
+    std::array<char, 32> buffer {};
+
+    const std::to_chars_result result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), pValue);
+
+    return std::string(buffer.data(), result.ptr);
+}
+
+/*
+ * Formats the label set 'pLabels', optionally extended by an additional label 'pExtraName'="pExtraValue" (if
+ * 'pExtraName' not empty), as "{name1="value1",...}" or as an empty string if there are no labels at all.
+ */
+std::string formatLabels(const Metrics::Labels& pLabels, const std::string_view pExtraName = "", const std::string& pExtraValue = "")
+{
+    if (pLabels.empty() && pExtraName.empty())
+        return "";
+
+    std::string retVal = "{";
+
+    for (const auto& [labelName, labelValue] : pLabels)
+        retVal += labelName + "=\"" + escapeText(labelValue, true) + "\",";
+
+    if (!pExtraName.empty())
+        retVal += std::string(pExtraName) + "=\"" + pExtraValue + "\",";
+
+    retVal.back() = '}';
+
+    return retVal;
+}
+
+/*
+ * Appends the samples of a histogram with family name 'pName', labels 'pLabels', upper bucket bounds 'pUpperBounds',
+ * non-cumulative bucket counts 'pBucketCounts' and sum of observed values 'pSum' to 'pText'.
+ */
+void appendHistogram(std::string& pText, const std::string& pName, const Metrics::Labels& pLabels, const std::vector<double>& pUpperBounds,
+                     const std::vector<std::uint64_t>& pBucketCounts, const double pSum)
+{
+    std::uint64_t cumulativeCount = 0;
+
+    for (std::size_t i = 0; i <= pUpperBounds.size(); ++i)
+    {
+        if (i < pBucketCounts.size())
+            cumulativeCount += pBucketCounts[i];
+
+        pText += pName + "_bucket" + formatLabels(pLabels, "le", (i < pUpperBounds.size() ? formatValue(pUpperBounds[i]) : "+Inf")) +
+                 " " + std::to_string(cumulativeCount) + "\n";
+    }
+
+    pText += pName + "_sum" + formatLabels(pLabels) + " " + formatValue(pSum) + "\n";
+    pText += pName + "_count" + formatLabels(pLabels) + " " + std::to_string(cumulativeCount) + "\n";
+}
+
+/*
+ * Reads a single HTTP request from 'pSocket', sends back the response (Metrics::expose() for "GET /" or "GET /metrics")
+ * and closes the connection.
+ */
+boost::asio::awaitable<void> serveHttpRequest(tcp::socket pSocket)
+{
+    try
+    {
+        std::string request;
+
+        co_await boost::asio::async_read_until(pSocket, boost::asio::dynamic_buffer(request, maxHttpRequestSize), "\r\n\r\n",
+                                               boost::asio::use_awaitable);
+
+        const std::string requestLine = request.substr(0, request.find("\r\n"));
+
+        std::string status = "200 OK";
+        std::string contentType = Metrics::contentType;
+        std::string body;
+
+        if (!requestLine.starts_with("GET "))
+        {
+            status = "405 Method Not Allowed";
+            contentType = "text/plain; charset=utf-8";
+            body = "Method not allowed.\n";
+        }
+        else if (const std::string path = requestLine.substr(4, requestLine.find(' ', 4) - 4); path != "/" && path != "/metrics")
+        {
+            status = "404 Not Found";
+            contentType = "text/plain; charset=utf-8";
+            body = "Not found.\n";
+        }
+        else
+            body = Metrics::expose();
+
+        const std::string response = "HTTP/1.1 " + status + "\r\n" +
+                                     "Content-Type: " + contentType + "\r\n" +
+                                     "Content-Length: " + std::to_string(body.size()) + "\r\n" +
+                                     "Connection: close\r\n\r\n" + body;
+
+        co_await boost::asio::async_write(pSocket, boost::asio::buffer(response), boost::asio::use_awaitable);
+
+        boost::system::error_code ec;
+        pSocket.shutdown(tcp::socket::shutdown_both, ec);
+    }
+    catch (const boost::system::system_error&)
+    {
+        //Connection closed by the client, failed or request too large
+    }
+}
+
+/*
+ * Accepts HTTP connections on 'pAcceptor' and starts serveHttpRequest() for every connection until the acceptor is closed.
+ */
+boost::asio::awaitable<void> acceptHttpConnections(const std::shared_ptr<tcp::acceptor> pAcceptor)
+{
+    try
+    {
+        for (;;)
+        {
+            tcp::socket socket = co_await pAcceptor->async_accept(casil::ASIO::getIOContext(), boost::asio::use_awaitable);
+
+            boost::asio::co_spawn(socket.get_executor(), serveHttpRequest(std::move(socket)), boost::asio::detached);
+        }
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        if (exc.code() != boost::asio::error::operation_aborted)
+            casil::Logger::logError(std::string("Metrics HTTP server stopped accepting connections: ") + exc.what());
+    }
+}
+
+} // namespace
+
+/*!
+ * \brief All metrics registered under the same metric family name.
+ */
+struct Metrics::Family
+{
+    std::string help;                                               ///< Help text.
+    Type type;                                                      ///< Metric type.
+    std::vector<double> upperBounds;                                ///< Histogram bucket upper bounds (histogram families only).
+    //
+    std::map<Labels, std::unique_ptr<Counter>> counters;            ///< Owned counters by labels.
+    std::map<Labels, std::unique_ptr<Gauge>> gauges;                ///< Owned gauges by labels.
+    std::map<Labels, std::unique_ptr<Histogram>> histograms;        ///< Owned histograms by labels.
+    //
+    std::map<std::uint64_t, std::pair<Labels, std::function<double()>>> callbacks;      ///< Counter/gauge callbacks by ID.
+    std::map<std::uint64_t, std::pair<Labels, std::function<HistogramSnapshot()>>> histogramCallbacks;
+                                                                                        ///< Histogram callbacks by ID.
+};
+
+/*!
+ * \brief Listening socket of a running HTTP server.
+ *
+ * The acceptor uses a strand of the IO context, such that it can be closed safely while an accept operation is pending.
+ */
+struct Metrics::HttpServer
+{
+    std::shared_ptr<tcp::acceptor> acceptor;    ///< Listening socket.
+    std::uint16_t port;                         ///< Bound port.
+};
+
+//
+
+std::mutex Metrics::metricsMutex;
+std::map<std::string, Metrics::Family> Metrics::families = {};
+std::uint64_t Metrics::nextCallbackId = 1;
+//
+std::mutex Metrics::httpServerMutex;
+std::unique_ptr<Metrics::HttpServer> Metrics::httpServer = nullptr;
+
+//Public
+
+/*!
+ * \brief Get or register a counter.
+ *
+ * \throws std::invalid_argument If \p pName or a label name in \p pLabels is invalid.
+ * \throws std::invalid_argument If \p pName was already registered with a different type.
+ *
+ * \param pName Metric family name (without "_total" suffix).
+ * \param pHelp Help text of the metric family (only used on first registration of the family).
+ * \param pLabels Labels of the counter.
+ * \return The counter registered for \p pName and \p pLabels.
+ */
+Metrics::Counter& Metrics::counter(const std::string& pName, const std::string& pHelp, const Labels& pLabels)
+{
+    const std::lock_guard<std::mutex> metricsLock(metricsMutex);
+    (void)metricsLock;
+
+    std::unique_ptr<Counter>& counterPtr = getFamily(pName, pHelp, Type::Counter, {}).counters[pLabels];
+
+    if (counterPtr == nullptr)
+        counterPtr = std::make_unique<Counter>();
+
+    return *counterPtr;
+}
+
+/*!
+ * \brief Get or register a gauge.
+ *
+ * \throws std::invalid_argument If \p pName or a label name in \p pLabels is invalid.
+ * \throws std::invalid_argument If \p pName was already registered with a different type.
+ *
+ * \param pName Metric family name.
+ * \param pHelp Help text of the metric family (only used on first registration of the family).
+ * \param pLabels Labels of the gauge.
+ * \return The gauge registered for \p pName and \p pLabels.
+ */
+Metrics::Gauge& Metrics::gauge(const std::string& pName, const std::string& pHelp, const Labels& pLabels)
+{
+    const std::lock_guard<std::mutex> metricsLock(metricsMutex);
+    (void)metricsLock;
+
+    std::unique_ptr<Gauge>& gaugePtr = getFamily(pName, pHelp, Type::Gauge, {}).gauges[pLabels];
+
+    if (gaugePtr == nullptr)
+        gaugePtr = std::make_unique<Gauge>();
+
+    return *gaugePtr;
+}
+
+/*!
+ * \brief Get or register a histogram.
+ *
+ * \throws std::invalid_argument If \p pName or a label name in \p pLabels is invalid.
+ * \throws std::invalid_argument If \p pName was already registered with a different type or different \p pUpperBounds.
+ * \throws std::invalid_argument If \p pUpperBounds is not strictly increasing.
+ *
+ * \param pName Metric family name.
+ * \param pHelp Help text of the metric family (only used on first registration of the family).
+ * \param pUpperBounds Upper bounds of the histogram buckets (see Histogram).
+ * \param pLabels Labels of the histogram.
+ * \return The histogram registered for \p pName and \p pLabels.
+ */
+Metrics::Histogram& Metrics::histogram(const std::string& pName, const std::string& pHelp, const std::vector<double>& pUpperBounds,
+                                       const Labels& pLabels)
+{
+    const std::lock_guard<std::mutex> metricsLock(metricsMutex);
+    (void)metricsLock;
+
+    std::unique_ptr<Histogram>& histogramPtr = getFamily(pName, pHelp, Type::Histogram, pUpperBounds).histograms[pLabels];
+
+    if (histogramPtr == nullptr)
+        histogramPtr = std::make_unique<Histogram>(pUpperBounds);
+
+    return *histogramPtr;
+}
+
+//
+
+/*!
+ * \brief Register a counter/gauge callback.
+ *
+ * Registers a counter or gauge (depending on \p pType) whose value is determined by calling \p pCallback on every
+ * call of expose(). The callback is removed again when the returned handle is destroyed (or reset).
+ *
+ * Note: \p pCallback is called while holding the registry lock, i.e. it must not access the Metrics registry itself.
+ * Destroying the handle waits for a running exposition, such that it is safe to destroy objects used by \p pCallback
+ * afterwards (i.e. the handle should be destroyed \e first).
+ *
+ * \throws std::invalid_argument If \p pType is Type::Histogram (see addHistogramCallback() instead).
+ * \throws std::invalid_argument If \p pName or a label name in \p pLabels is invalid.
+ * \throws std::invalid_argument If \p pName was already registered with a different type.
+ *
+ * \param pName Metric family name (without "_total" suffix for counters).
+ * \param pHelp Help text of the metric family (only used on first registration of the family).
+ * \param pType Metric type (counter or gauge).
+ * \param pLabels Labels of the metric.
+ * \param pCallback Function returning the current value.
+ * \return Handle that removes the callback on destruction.
+ */
+Metrics::CallbackHandle Metrics::addCallback(const std::string& pName, const std::string& pHelp, const Type pType, const Labels& pLabels,
+                                             std::function<double()> pCallback)
+{
+    if (pType == Type::Histogram)
+        throw std::invalid_argument("Use a histogram callback for histogram metric \"" + pName + "\".");
+
+    const std::lock_guard<std::mutex> metricsLock(metricsMutex);
+    (void)metricsLock;
+
+    Family& family = getFamily(pName, pHelp, pType, {});
+
+    const std::uint64_t id = nextCallbackId++;
+
+    family.callbacks[id] = {pLabels, std::move(pCallback)};
+
+    return CallbackHandle(id);
+}
+
+/*!
+ * \brief Register a histogram callback.
+ *
+ * Like addCallback() but for a histogram whose bucket counts and sum are determined by calling \p pCallback.
+ * The number of returned bucket counts should be the number of \p pUpperBounds plus one (missing counts are treated as zero).
+ *
+ * \throws std::invalid_argument If \p pName or a label name in \p pLabels is invalid.
+ * \throws std::invalid_argument If \p pName was already registered with a different type or different \p pUpperBounds.
+ * \throws std::invalid_argument If \p pUpperBounds is not strictly increasing.
+ *
+ * \param pName Metric family name.
+ * \param pHelp Help text of the metric family (only used on first registration of the family).
+ * \param pUpperBounds Upper bounds of the histogram buckets (see Histogram).
+ * \param pLabels Labels of the histogram.
+ * \param pCallback Function returning the current histogram values.
+ * \return Handle that removes the callback on destruction.
+ */
+Metrics::CallbackHandle Metrics::addHistogramCallback(const std::string& pName, const std::string& pHelp, const std::vector<double>& pUpperBounds,
+                                                      const Labels& pLabels, std::function<HistogramSnapshot()> pCallback)
+{
+    const std::lock_guard<std::mutex> metricsLock(metricsMutex);
+    (void)metricsLock;
+
+    Family& family = getFamily(pName, pHelp, Type::Histogram, pUpperBounds);
+
+    const std::uint64_t id = nextCallbackId++;
+
+    family.histogramCallbacks[id] = {pLabels, std::move(pCallback)};
+
+    return CallbackHandle(id);
+}
+
+//
+
+/*!
+ * \brief Get all metrics in OpenMetrics text format.
+ *
+ * Determines the current values of all registered metrics (calling all callbacks) and formats
+ * them according to the OpenMetrics text format (also accepted by Prometheus), ordered by family name.
+ * Callbacks that throw an exception are skipped.
+ *
+ * \return OpenMetrics exposition text (including the terminating "# EOF" line).
+ */
+std::string Metrics::expose()
+{
+    const std::lock_guard<std::mutex> metricsLock(metricsMutex);
+    (void)metricsLock;
+
+    std::string text;
+
+    for (const auto& [name, family] : families)
+    {
+        const std::string typeName = (family.type == Type::Counter ? "counter" : (family.type == Type::Gauge ? "gauge" : "histogram"));
+
+        text += "# TYPE " + name + " " + typeName + "\n";
+
+        if (!family.help.empty())
+            text += "# HELP " + name + " " + escapeText(family.help, false) + "\n";
+
+        const std::string sampleName = name + (family.type == Type::Counter ? "_total" : "");
+
+        for (const auto& [labels, counterPtr] : family.counters)
+            text += sampleName + formatLabels(labels) + " " + std::to_string(counterPtr->getValue()) + "\n";
+
+        for (const auto& [labels, gaugePtr] : family.gauges)
+            text += sampleName + formatLabels(labels) + " " + formatValue(gaugePtr->getValue()) + "\n";
+
+        for (const auto& [labels, histogramPtr] : family.histograms)
+            appendHistogram(text, name, labels, family.upperBounds, histogramPtr->getBucketCounts(), histogramPtr->getSum());
+
+        for (const auto& [id, callback] : family.callbacks)
+        {
+            try
+            {
+                text += sampleName + formatLabels(callback.first) + " " + formatValue(callback.second()) + "\n";
+            }
+            catch (const std::exception&)
+            {
+                //Skip failing callbacks
+            }
+        }
+
+        for (const auto& [id, callback] : family.histogramCallbacks)
+        {
+            try
+            {
+                const HistogramSnapshot snapshot = callback.second();
+                appendHistogram(text, name, callback.first, family.upperBounds, snapshot.bucketCounts, snapshot.sum);
+            }
+            catch (const std::exception&)
+            {
+                //Skip failing callbacks
+            }
+        }
+    }
+
+    text += "# EOF\n";
+
+    return text;
+}
+
+//
+
+/*!
+ * \brief Start serving expose() via HTTP.
+ *
+ * Listens on \p pAddress and \p pPort for HTTP connections and answers every "GET /metrics" (or "GET /")
+ * request with the output of expose(). Each connection is closed after a single response.
+ *
+ * The server runs on the IO context (see ASIO::getIOContext()), i.e. IO context threads must be
+ * running (see ASIO::startRunIOContext()) in order to serve requests. Does nothing if already running.
+ *
+ * \param pPort TCP port to listen on (zero to let the operating system choose a port; see getHttpPort()).
+ * \param pAddress IP address to listen on.
+ * \return True if the server is running.
+ */
+bool Metrics::startHttpServer(const std::uint16_t pPort, const std::string& pAddress)
+{
+    const std::lock_guard<std::mutex> httpServerLock(httpServerMutex);
+    (void)httpServerLock;
+
+    if (httpServer != nullptr)
+        return true;
+
+    try
+    {
+        boost::asio::io_context& ioContext = ASIO::getIOContext();
+
+        auto acceptor = std::make_shared<tcp::acceptor>(boost::asio::make_strand(ioContext),
+                                                        tcp::endpoint(boost::asio::ip::make_address(pAddress), pPort));
+
+        const std::uint16_t port = acceptor->local_endpoint().port();
+
+        boost::asio::co_spawn(acceptor->get_executor(), acceptHttpConnections(acceptor), boost::asio::detached);
+
+        httpServer = std::make_unique<HttpServer>(HttpServer{std::move(acceptor), port});
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        Logger::logError("Could not start metrics HTTP server on \"" + pAddress + "\", port " + std::to_string(pPort) + ": " + exc.what());
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Stop the HTTP server.
+ *
+ * Closes the listening socket (requests of already accepted connections are still answered).
+ * Does nothing if the server is not running.
+ */
+void Metrics::stopHttpServer()
+{
+    const std::lock_guard<std::mutex> httpServerLock(httpServerMutex);
+    (void)httpServerLock;
+
+    if (httpServer == nullptr)
+        return;
+
+    const std::shared_ptr<tcp::acceptor> acceptor = std::move(httpServer->acceptor);
+
+    httpServer.reset();
+
+    auto closeAcceptor = [acceptor]() -> void
+    {
+        boost::system::error_code ec;
+        acceptor->close(ec);
+    };
+
+    if (ASIO::ioContextThreadsRunning())
+    {
+        //Close on the acceptor's strand (pending accept operation) and wait until the port is released
+        std::promise<void> closed;
+        boost::asio::post(acceptor->get_executor(), [&closed, &closeAcceptor]() -> void { closeAcceptor(); closed.set_value(); });
+        closed.get_future().wait();
+    }
+    else
+        closeAcceptor();
+}
+
+/*!
+ * \brief Get the port of the running HTTP server.
+ *
+ * \return Bound TCP port or zero if the server is not running.
+ */
+std::uint16_t Metrics::getHttpPort()
+{
+    const std::lock_guard<std::mutex> httpServerLock(httpServerMutex);
+    (void)httpServerLock;
+
+    return (httpServer != nullptr ? httpServer->port : 0);
+}
+
+//Private
+
+/*!
+ * \brief Get or create a metric family.
+ *
+ * Must be called while holding \ref metricsMutex.
+ *
+ * \throws std::invalid_argument If \p pName is invalid.
+ * \throws std::invalid_argument If \p pName was already registered with a different type or different \p pUpperBounds.
+ * \throws std::invalid_argument If \p pUpperBounds is not strictly increasing.
+ *
+ * \param pName Metric family name.
+ * \param pHelp Help text (only used when creating the family).
+ * \param pType Metric type.
+ * \param pUpperBounds Histogram bucket upper bounds (histogram families only).
+ * \return The metric family.
+ */
+Metrics::Family& Metrics::getFamily(const std::string& pName, const std::string& pHelp, const Type pType,
+                                    const std::vector<double>& pUpperBounds)
+{
+    if (!isValidName(pName, true))
+        throw std::invalid_argument("Invalid metric name \"" + pName + "\".");
+
+    const auto it = families.find(pName);
+
+    if (it != families.end())
+    {
+        if (it->second.type != pType || it->second.upperBounds != pUpperBounds)
+            throw std::invalid_argument("Metric \"" + pName + "\" was already registered with a different type or different buckets.");
+
+        return it->second;
+    }
+
+    if (std::adjacent_find(pUpperBounds.begin(), pUpperBounds.end(), std::greater_equal<double>()) != pUpperBounds.end())
+        throw std::invalid_argument("Bucket upper bounds of histogram metric \"" + pName + "\" are not strictly increasing.");
+
+    Family& family = families[pName];
+
+    family.help = pHelp;
+    family.type = pType;
+    family.upperBounds = pUpperBounds;
+
+    return family;
+}
+
+/*!
+ * \brief Remove a callback metric.
+ *
+ * Waits for a running expose() to finish.
+ *
+ * \param pId ID of the callback metric.
+ */
+void Metrics::removeCallback(const std::uint64_t pId)
+{
+    const std::lock_guard<std::mutex> metricsLock(metricsMutex);
+    (void)metricsLock;
+
+    for (auto& [name, family] : families)
+    {
+        if (family.callbacks.erase(pId) > 0 || family.histogramCallbacks.erase(pId) > 0)
+            return;
+    }
+}
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Creates the histogram with all bucket counts set to zero.
+ *
+ * \throws std::invalid_argument If \p pUpperBounds is not strictly increasing.
+ *
+ * \param pUpperBounds Upper bounds of all but the last bucket.
+ */
+Metrics::Histogram::Histogram(std::vector<double> pUpperBounds) :
+    upperBounds(std::move(pUpperBounds)),
+    bucketCounts(std::make_unique<std::atomic_uint64_t[]>(upperBounds.size() + 1)),
+    sum(0.0)
+{
+    if (std::adjacent_find(upperBounds.begin(), upperBounds.end(), std::greater_equal<double>()) != upperBounds.end())
+        throw std::invalid_argument("Histogram bucket upper bounds are not strictly increasing.");
+}
+
+//Public
+
+/*!
+ * \brief Get the bucket upper bounds.
+ *
+ * \return Upper bounds of all but the last bucket.
+ */
+const std::vector<double>& Metrics::Histogram::getUpperBounds() const
+{
+    return upperBounds;
+}
+
+/*!
+ * \brief Get the (non-cumulative) counts of all buckets.
+ *
+ * \return Count of every bucket (number of upper bounds plus one).
+ */
+std::vector<std::uint64_t> Metrics::Histogram::getBucketCounts() const
+{
+    std::vector<std::uint64_t> counts(upperBounds.size() + 1);
+
+    for (std::size_t i = 0; i < counts.size(); ++i)
+        counts[i] = bucketCounts[i].load(std::memory_order_relaxed);
+
+    return counts;
+}
+
+/*!
+ * \brief Get the sum of all observed values.
+ *
+ * \return Sum of observed values.
+ */
+double Metrics::Histogram::getSum() const
+{
+    return sum.load(std::memory_order_relaxed);
+}
+
+//
+
+/*!
+ * \brief Default constructor.
+ *
+ * Creates a handle without callback metric.
+ */
+Metrics::CallbackHandle::CallbackHandle() :
+    id(0)
+{
+}
+
+/*!
+ * \brief Constructor.
+ *
+ * \param pId ID of the callback metric to be removed on destruction.
+ */
+Metrics::CallbackHandle::CallbackHandle(const std::uint64_t pId) :
+    id(pId)
+{
+}
+
+/*!
+ * \brief Move constructor.
+ *
+ * Takes over the callback metric of \p pOther.
+ *
+ * \param pOther Moved-from handle.
+ */
+Metrics::CallbackHandle::CallbackHandle(CallbackHandle&& pOther) noexcept :
+    id(std::exchange(pOther.id, 0))
+{
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Removes the callback metric (see reset()).
+ */
+Metrics::CallbackHandle::~CallbackHandle()
+{
+    reset();
+}
+
+/*!
+ * \brief Move assignment operator.
+ *
+ * Removes the own callback metric and takes over the callback metric of \p pOther.
+ *
+ * \param pOther Moved-from handle.
+ * \return Reference to this handle.
+ */
+Metrics::CallbackHandle& Metrics::CallbackHandle::operator=(CallbackHandle&& pOther) noexcept
+{
+    if (this != &pOther)
+    {
+        reset();
+        id = std::exchange(pOther.id, 0);
+    }
+
+    return *this;
+}
+
+//Public
+
+/*!
+ * \brief Remove the callback metric.
+ *
+ * Waits for a running Metrics::expose() to finish. Does nothing if the handle has no callback metric.
+ */
+void Metrics::CallbackHandle::reset()
+{
+    if (id == 0)
+        return;
+
+    Metrics::removeCallback(std::exchange(id, 0));
+}
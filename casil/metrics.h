@@ -0,0 +1,234 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_METRICS_H
+#define CASIL_METRICS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace casil
+{
+
+/*!
+ * \brief Registry of counters, gauges and histograms with Prometheus/OpenMetrics exposition.
+ *
+ * Metrics are identified by a metric family name (such as "casil_interface_read_bytes") and a set of labels (such as
+ * the type and name of a layer component, see LayerBase::metricsLabels). There are two kinds of registered metrics:
+ * - Owned metrics (see counter(), gauge() and histogram()), which are updated directly by the instrumented code.
+ *   Their update functions only perform relaxed atomic operations, i.e. they are cheap enough for the hot path.
+ *   Owned metrics are never removed again; registering the same family name and labels returns the same metric.
+ * - Callback metrics (see addCallback() and addHistogramCallback()), whose values are only determined on exposition
+ *   by calling a function (e.g. for reading a FIFO fill level or existing statistics counters), i.e. at zero hot path cost.
+ *   These are removed when the returned CallbackHandle is destroyed.
+ *
+ * The current values of all metrics can be obtained in the OpenMetrics text format via expose(), either directly
+ * (pull API) or via a minimal HTTP endpoint running on the IO context (see startHttpServer()).
+ *
+ * Counter families get the sample name suffix "_total", histogram families the suffixes "_bucket", "_sum" and "_count".
+ */
+class Metrics
+{
+public:
+    /*!
+     * \brief Type of a metric family.
+     */
+    enum class Type : std::uint8_t
+    {
+        Counter = 0,    ///< Monotonically increasing value.
+        Gauge = 1,      ///< Arbitrarily changing value.
+        Histogram = 2   ///< Distribution of observed values in fixed buckets.
+    };
+
+    typedef std::vector<std::pair<std::string, std::string>> Labels;    ///< Label names and values of a metric.
+
+    /*!
+     * \brief Monotonically increasing counter.
+     */
+    class Counter
+    {
+    public:
+        Counter() = default;                                    ///< Default constructor.
+        Counter(const Counter&) = delete;                       ///< Deleted copy constructor.
+        Counter(Counter&&) = delete;                            ///< Deleted move constructor.
+        ~Counter() = default;                                   ///< Default destructor.
+        //
+        Counter& operator=(Counter) = delete;                   ///< Deleted copy assignment operator.
+        Counter& operator=(Counter&&) = delete;                 ///< Deleted move assignment operator.
+        //
+        void increment(std::uint64_t pValue = 1) { value.fetch_add(pValue, std::memory_order_relaxed); }    ///< Increase the value.
+        std::uint64_t getValue() const { return value.load(std::memory_order_relaxed); }                  ///< Get the value.
+
+    private:
+        std::atomic_uint64_t value {0};                         ///< Current value.
+    };
+
+    /*!
+     * \brief Gauge with arbitrarily changing value.
+     */
+    class Gauge
+    {
+    public:
+        Gauge() = default;                                      ///< Default constructor.
+        Gauge(const Gauge&) = delete;                           ///< Deleted copy constructor.
+        Gauge(Gauge&&) = delete;                                ///< Deleted move constructor.
+        ~Gauge() = default;                                     ///< Default destructor.
+        //
+        Gauge& operator=(Gauge) = delete;                       ///< Deleted copy assignment operator.
+        Gauge& operator=(Gauge&&) = delete;                     ///< Deleted move assignment operator.
+        //
+        void set(double pValue) { value.store(pValue, std::memory_order_relaxed); }                       ///< Set the value.
+        void add(double pValue) { value.fetch_add(pValue, std::memory_order_relaxed); }                   ///< Change the value.
+        double getValue() const { return value.load(std::memory_order_relaxed); }                         ///< Get the value.
+
+    private:
+        std::atomic<double> value {0.0};                        ///< Current value.
+    };
+
+    /*!
+     * \brief Histogram with fixed buckets.
+     *
+     * Bucket \c i counts the observed values \c v with <tt>upperBounds[i-1] < v <= upperBounds[i]</tt>.
+     * An additional last bucket counts all values above the largest upper bound.
+     */
+    class Histogram
+    {
+    public:
+        explicit Histogram(std::vector<double> pUpperBounds);   ///< Constructor.
+        Histogram(const Histogram&) = delete;                   ///< Deleted copy constructor.
+        Histogram(Histogram&&) = delete;                        ///< Deleted move constructor.
+        ~Histogram() = default;                                 ///< Default destructor.
+        //
+        Histogram& operator=(Histogram) = delete;               ///< Deleted copy assignment operator.
+        Histogram& operator=(Histogram&&) = delete;             ///< Deleted move assignment operator.
+        //
+        /*!
+         * \brief Add an observed value.
+         *
+         * \param pValue The observed value.
+         */
+        void observe(double pValue)
+        {
+            const auto bucket = std::lower_bound(upperBounds.begin(), upperBounds.end(), pValue) - upperBounds.begin();
+            bucketCounts[static_cast<std::size_t>(bucket)].fetch_add(1, std::memory_order_relaxed);
+            sum.fetch_add(pValue, std::memory_order_relaxed);
+        }
+        //
+        const std::vector<double>& getUpperBounds() const;      ///< Get the bucket upper bounds.
+        std::vector<std::uint64_t> getBucketCounts() const;     ///< Get the (non-cumulative) counts of all buckets.
+        double getSum() const;                                  ///< Get the sum of all observed values.
+
+    private:
+        const std::vector<double> upperBounds;                  ///< Sorted upper bounds of all but the last bucket.
+        const std::unique_ptr<std::atomic_uint64_t[]> bucketCounts;     ///< Counts of all buckets (including the last bucket).
+        std::atomic<double> sum;                                ///< Sum of all observed values.
+    };
+
+    /*!
+     * \brief Snapshot of a histogram as returned by the function of a histogram callback (see addHistogramCallback()).
+     */
+    struct HistogramSnapshot
+    {
+        std::vector<std::uint64_t> bucketCounts;    ///< Non-cumulative bucket counts (number of upper bounds plus one, see Histogram).
+        double sum;                                 ///< Sum of all observed values.
+    };
+
+    /*!
+     * \brief Removes a callback metric on destruction (see addCallback()).
+     */
+    class CallbackHandle
+    {
+    public:
+        CallbackHandle();                                           ///< Default constructor.
+        explicit CallbackHandle(std::uint64_t pId);                 ///< Constructor.
+        CallbackHandle(const CallbackHandle&) = delete;             ///< Deleted copy constructor.
+        CallbackHandle(CallbackHandle&& pOther) noexcept;           ///< Move constructor.
+        ~CallbackHandle();                                          ///< Destructor.
+        //
+        CallbackHandle& operator=(CallbackHandle) = delete;         ///< Deleted copy assignment operator.
+        CallbackHandle& operator=(CallbackHandle&& pOther) noexcept;    ///< Move assignment operator.
+        //
+        void reset();                                               ///< Remove the callback metric.
+
+    private:
+        std::uint64_t id;                                           ///< ID of the callback metric (zero if none).
+    };
+
+public:
+    Metrics() = delete;                                                                     ///< Deleted constructor.
+    //
+    static Counter& counter(const std::string& pName, const std::string& pHelp, const Labels& pLabels = {});
+                                                                                            ///< Get or register a counter.
+    static Gauge& gauge(const std::string& pName, const std::string& pHelp, const Labels& pLabels = {});
+                                                                                            ///< Get or register a gauge.
+    static Histogram& histogram(const std::string& pName, const std::string& pHelp, const std::vector<double>& pUpperBounds,
+                                const Labels& pLabels = {});                                ///< Get or register a histogram.
+    //
+    [[nodiscard]] static CallbackHandle addCallback(const std::string& pName, const std::string& pHelp, Type pType, const Labels& pLabels,
+                                                    std::function<double()> pCallback);     ///< Register a counter/gauge callback.
+    [[nodiscard]] static CallbackHandle addHistogramCallback(const std::string& pName, const std::string& pHelp,
+                                                             const std::vector<double>& pUpperBounds, const Labels& pLabels,
+                                                             std::function<HistogramSnapshot()> pCallback);
+                                                                                            ///< Register a histogram callback.
+    //
+    static std::string expose();                                                            ///< Get all metrics in OpenMetrics text format.
+    //
+    static bool startHttpServer(std::uint16_t pPort, const std::string& pAddress = "127.0.0.1");
+                                                                                            ///< Start serving expose() via HTTP.
+    static void stopHttpServer();                                                           ///< Stop the HTTP server.
+    static std::uint16_t getHttpPort();                                                     ///< Get the port of the running HTTP server.
+
+private:
+    struct Family;
+    struct HttpServer;
+
+private:
+    static Family& getFamily(const std::string& pName, const std::string& pHelp, Type pType, const std::vector<double>& pUpperBounds);
+                                                                                            ///< Get or create a metric family.
+    static void removeCallback(std::uint64_t pId);                                          ///< Remove a callback metric.
+
+private:
+    static std::mutex metricsMutex;                                                         ///< Mutex for all registry accesses.
+    static std::map<std::string, Family> families;                                          ///< All metric families by name.
+    static std::uint64_t nextCallbackId;                                                    ///< ID for the next callback metric.
+    //
+    static std::mutex httpServerMutex;                                                      ///< Mutex for \ref httpServer.
+    static std::unique_ptr<HttpServer> httpServer;                                          ///< Running HTTP server or \c nullptr.
+
+public:
+    static constexpr const char* contentType = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+                                                                                            ///< HTTP content type of expose() output.
+};
+
+} // namespace casil
+
+#endif // CASIL_METRICS_H
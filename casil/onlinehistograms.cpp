@@ -0,0 +1,381 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <casil/onlinehistograms.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+using casil::OnlineHistograms;
+
+namespace
+{
+
+std::atomic_uint64_t nextInstanceId {0};    //Source of OnlineHistograms::instanceId
+
+/*
+ * Accumulators of the calling thread by instance ID. Entries of destroyed instances are never used again
+ * (IDs are not reused) and only cost a few bytes until the thread exits.
+ */
+thread_local std::unordered_map<std::uint64_t, void*> threadAccumulators;
+
+/*
+ * Cache line of counters. Accumulators consist of whole cache lines such that no two threads write to the same line.
+ */
+struct alignas(64) CounterLine
+{
+    std::array<std::atomic_uint64_t, 8> counters {};
+};
+
+} // namespace
+
+/*!
+ * \brief Counters (record count and bins) of a single filling thread.
+ *
+ * Only the owning thread writes the counters. As there is a single writer, incrementing is a relaxed load
+ * and store instead of a (locked) read-modify-write operation.
+ */
+struct OnlineHistograms::Accumulator
+{
+    const std::unique_ptr<CounterLine[]> lines;                 ///< Counter storage (counter 0 is the record count).
+    //
+    explicit Accumulator(const std::size_t pNumCounters) :      ///< Constructor. Zero-initializes \p pNumCounters counters.
+        lines(std::make_unique<CounterLine[]>((pNumCounters + 7) / 8))
+    {
+    }
+    //
+    std::atomic_uint64_t& counter(const std::size_t pIdx)       ///< Get a counter.
+    {
+        return lines[pIdx / 8].counters[pIdx % 8];
+    }
+    std::uint64_t load(const std::size_t pIdx) const            ///< Read a counter.
+    {
+        return lines[pIdx / 8].counters[pIdx % 8].load(std::memory_order_relaxed);
+    }
+    void increment(const std::size_t pIdx)                      ///< Increment a counter (only from the owning thread).
+    {
+        std::atomic_uint64_t& tCounter = counter(pIdx);
+        tCounter.store(tCounter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+};
+
+/*!
+ * \brief Constructor.
+ *
+ * \param pRule Definition of the record type whose fields are histogrammed.
+ * \param pDefinitions Histogram definitions, referring to fields of \p pRule.
+ *
+ * \throws std::invalid_argument If \p pRule has bits set in its value outside of its mask.
+ * \throws std::invalid_argument If a histogram name is empty or used twice.
+ * \throws std::invalid_argument If a histogram refers to a field that \p pRule does not define.
+ * \throws std::invalid_argument If the histograms have more than \ref maxBins bins altogether.
+ */
+OnlineHistograms::OnlineHistograms(FifoDecoder::Rule pRule, std::vector<Definition> pDefinitions) :
+    rule(std::move(pRule)),
+    definitions(std::move(pDefinitions)),
+    layouts(),
+    numCounters(1),
+    instanceId(nextInstanceId.fetch_add(1, std::memory_order_relaxed)),
+    accumulators(),
+    baseline(),
+    accumulatorsMutex()
+{
+    if ((rule.value & ~rule.mask) != 0)
+        throw std::invalid_argument("Value of histogrammed record type \"" + rule.name + "\" has bits outside of the mask.");
+
+    auto findField = [this](const std::string& pFieldName, const std::string& pHistName) -> std::size_t
+    {
+        const auto it = std::find_if(rule.fields.begin(), rule.fields.end(),
+                                     [&pFieldName](const FifoDecoder::Field& pField) -> bool { return pField.name == pFieldName; });
+
+        if (it == rule.fields.end())
+            throw std::invalid_argument("Histogram \"" + pHistName + "\" refers to unknown field \"" + pFieldName + "\" of record type \"" +
+                                        rule.name + "\".");
+
+        return static_cast<std::size_t>(it - rule.fields.begin());
+    };
+
+    for (const Definition& definition : definitions)
+    {
+        if (definition.name.empty() ||
+            std::count_if(definitions.begin(), definitions.end(),
+                          [&definition](const Definition& pOther) -> bool { return pOther.name == definition.name; }) != 1)
+        {
+            throw std::invalid_argument("Empty or duplicate histogram name \"" + definition.name + "\".");
+        }
+
+        Layout layout {.xFieldIdx = findField(definition.xField, definition.name), .yFieldIdx = 0,
+                       .xBins = 0, .yBins = 1, .offset = numCounters};
+
+        layout.xBins = static_cast<std::size_t>(rule.fields[layout.xFieldIdx].mask) + 1;
+
+        if (!definition.yField.empty())
+        {
+            layout.yFieldIdx = findField(definition.yField, definition.name);
+            layout.yBins = static_cast<std::size_t>(rule.fields[layout.yFieldIdx].mask) + 1;
+        }
+
+        if (layout.xBins > maxBins || layout.yBins > maxBins || layout.xBins * layout.yBins > maxBins + 1 - numCounters)
+            throw std::invalid_argument("Too many histogram bins (maximum is " + std::to_string(maxBins) + ").");
+
+        numCounters += layout.xBins * layout.yBins;
+
+        layouts.push_back(layout);
+    }
+
+    baseline.assign(numCounters, 0);
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Note: The histograms must not be filled anymore at this point.
+ */
+OnlineHistograms::~OnlineHistograms() = default;
+
+//Public
+
+/*!
+ * \brief Get the definition of the histogrammed record type.
+ *
+ * \return Record type definition.
+ */
+const casil::FifoDecoder::Rule& OnlineHistograms::getRule() const
+{
+    return rule;
+}
+
+/*!
+ * \brief Get the histogram definitions.
+ *
+ * \return Definitions (index order of all other functions).
+ */
+const std::vector<OnlineHistograms::Definition>& OnlineHistograms::getDefinitions() const
+{
+    return definitions;
+}
+
+/*!
+ * \brief Get the index of a histogram.
+ *
+ * \param pName Histogram name.
+ * \return Histogram index.
+ *
+ * \throws std::invalid_argument If there is no histogram named \p pName.
+ */
+std::size_t OnlineHistograms::findHistogram(const std::string& pName) const
+{
+    for (std::size_t i = 0; i < definitions.size(); ++i)
+        if (definitions[i].name == pName)
+            return i;
+
+    throw std::invalid_argument("Histogram \"" + pName + "\" does not exist.");
+}
+
+/*!
+ * \brief Get the numbers of bins of a histogram.
+ *
+ * \param pIdx Histogram index.
+ * \return Number of bins of the first axis and (for two-dimensional histograms) of the second axis.
+ *
+ * \throws std::invalid_argument If \p pIdx is out of range.
+ */
+std::vector<std::size_t> OnlineHistograms::getShape(const std::size_t pIdx) const
+{
+    if (pIdx >= layouts.size())
+        throw std::invalid_argument("Histogram index " + std::to_string(pIdx) + " is out of range.");
+
+    const Layout& layout = layouts[pIdx];
+
+    if (definitions[pIdx].yField.empty())
+        return {layout.xBins};
+    else
+        return {layout.xBins, layout.yBins};
+}
+
+//
+
+/*!
+ * \brief Fill the histograms with the matching data words.
+ *
+ * Extracts the fields of all words of \p pWords that match the record type (see getRule())
+ * and increments the corresponding bin of every histogram in the calling thread's accumulator.
+ * Only the first call from a thread takes a lock (to create the accumulator).
+ *
+ * The bin of a two-dimensional histogram has the index <tt>x * yBins + y</tt> (see getSnapshot()).
+ *
+ * \param pWords Data words.
+ */
+void OnlineHistograms::fill(const std::span<const std::uint32_t> pWords)
+{
+    Accumulator& accumulator = getThreadAccumulator();
+
+    const std::vector<FifoDecoder::Field>& fields = rule.fields;
+
+    for (const std::uint32_t word : pWords)
+    {
+        if ((word & rule.mask) != rule.value)
+            continue;
+
+        accumulator.increment(0);
+
+        for (const Layout& layout : layouts)
+        {
+            const FifoDecoder::Field& xField = fields[layout.xFieldIdx];
+            std::size_t binIdx = (word >> xField.shift) & xField.mask;
+
+            if (layout.yBins > 1)
+            {
+                const FifoDecoder::Field& yField = fields[layout.yFieldIdx];
+                binIdx = binIdx * layout.yBins + ((word >> yField.shift) & yField.mask);
+            }
+
+            accumulator.increment(layout.offset + binIdx);
+        }
+    }
+}
+
+//
+
+/*!
+ * \brief Get the current merged bin contents of a histogram.
+ *
+ * Sums up the bins of all accumulators and subtracts the baseline of the last reset() (see OnlineHistograms).
+ * Two-dimensional histograms are returned in row-major order with the first axis as rows
+ * (i.e. bin <tt>x * yBins + y</tt>, see getShape()).
+ *
+ * \param pIdx Histogram index.
+ * \return Bin contents.
+ *
+ * \throws std::invalid_argument If \p pIdx is out of range.
+ */
+std::vector<std::uint64_t> OnlineHistograms::getSnapshot(const std::size_t pIdx) const
+{
+    if (pIdx >= layouts.size())
+        throw std::invalid_argument("Histogram index " + std::to_string(pIdx) + " is out of range.");
+
+    const Layout& layout = layouts[pIdx];
+    const std::size_t numBins = layout.xBins * layout.yBins;
+
+    const std::lock_guard<std::mutex> accumulatorsLock(accumulatorsMutex);
+    (void)accumulatorsLock;
+
+    std::vector<std::uint64_t> bins(numBins, 0);
+
+    for (const std::unique_ptr<Accumulator>& accumulator : accumulators)
+        for (std::size_t i = 0; i < numBins; ++i)
+            bins[i] += accumulator->load(layout.offset + i);
+
+    for (std::size_t i = 0; i < numBins; ++i)
+        bins[i] -= baseline[layout.offset + i];
+
+    return bins;
+}
+
+/*!
+ * \brief Get the number of histogrammed records.
+ *
+ * \return Number of words that matched the record type since the last reset().
+ */
+std::uint64_t OnlineHistograms::getNumRecords() const
+{
+    const std::lock_guard<std::mutex> accumulatorsLock(accumulatorsMutex);
+    (void)accumulatorsLock;
+
+    return mergeCounts(0) - baseline[0];
+}
+
+/*!
+ * \brief Get the number of threads that filled the histograms.
+ *
+ * \return Number of accumulators.
+ */
+std::size_t OnlineHistograms::getNumAccumulators() const
+{
+    const std::lock_guard<std::mutex> accumulatorsLock(accumulatorsMutex);
+    (void)accumulatorsLock;
+
+    return accumulators.size();
+}
+
+/*!
+ * \brief Start counting from zero again.
+ *
+ * Stores the current merged counters as baseline for getSnapshot() and getNumRecords().
+ */
+void OnlineHistograms::reset()
+{
+    const std::lock_guard<std::mutex> accumulatorsLock(accumulatorsMutex);
+    (void)accumulatorsLock;
+
+    for (std::size_t i = 0; i < numCounters; ++i)
+        baseline[i] = mergeCounts(i);
+}
+
+//Private
+
+/*!
+ * \brief Get (or create) the accumulator of the calling thread.
+ *
+ * \return Accumulator only written by the calling thread.
+ */
+OnlineHistograms::Accumulator& OnlineHistograms::getThreadAccumulator()
+{
+    void*& threadAccumulator = threadAccumulators[instanceId];
+
+    if (!threadAccumulator)
+    {
+        auto accumulator = std::make_unique<Accumulator>(numCounters);
+
+        const std::lock_guard<std::mutex> accumulatorsLock(accumulatorsMutex);
+        (void)accumulatorsLock;
+
+        accumulators.push_back(std::move(accumulator));
+        threadAccumulator = accumulators.back().get();
+    }
+
+    return *static_cast<Accumulator*>(threadAccumulator);
+}
+
+/*!
+ * \brief Sum up a counter of all accumulators.
+ *
+ * Note: \ref accumulatorsMutex must be locked.
+ *
+ * \param pIdx Counter index.
+ * \return Sum of the counter over all accumulators.
+ */
+std::uint64_t OnlineHistograms::mergeCounts(const std::size_t pIdx) const
+{
+    std::uint64_t sum = 0;
+
+    for (const std::unique_ptr<Accumulator>& accumulator : accumulators)
+        sum += accumulator->load(pIdx);
+
+    return sum;
+}
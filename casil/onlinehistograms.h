@@ -0,0 +1,130 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#ifndef CASIL_ONLINEHISTOGRAMS_H
+#define CASIL_ONLINEHISTOGRAMS_H
+
+#include <casil/fifodecoder.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+/*!
+ * \brief Histograms of decoded FIFO record fields for live monitoring (e.g. hit maps and ToT spectra).
+ *
+ * Selects the words of one record type (see FifoDecoder::Rule) and fills one- or two-dimensional histograms of its fields
+ * (see Definition), where every possible field value is a bin (i.e. a field with mask 0xFF has 256 bins). A hit map
+ * is e.g. a histogram of the "column" and "row" fields and a ToT spectrum a histogram of the "tot" field.
+ *
+ * fill() can be called from any number of threads (e.g. from a ReadoutPipeline::HistogramSink) without locking:
+ * Every filling thread gets its own accumulator on its first call, which only this thread writes to. The bins
+ * are relaxed atomics, such that getSnapshot() can read and merge (sum up) all accumulators at any time while
+ * they are being filled, without ever blocking or slowing down the filling threads beyond their own cache lines.
+ * The accumulators are cache-line aligned to avoid false sharing between the threads.
+ *
+ * reset() does not touch the accumulators (which would race with the filling threads) but stores the current merged
+ * counts as a baseline that is subtracted from all later snapshots.
+ *
+ * Note: A snapshot taken during filling is not an atomic cut across all bins, i.e. different bins may reflect
+ * slightly different numbers of filled words.
+ */
+class OnlineHistograms
+{
+public:
+    /*!
+     * \brief Definition of a histogram.
+     */
+    struct Definition
+    {
+        std::string name;               ///< Histogram name.
+        std::string xField;             ///< Name of the field for the first axis.
+        std::string yField;             ///< Name of the field for the second axis (empty for a one-dimensional histogram).
+    };
+
+public:
+    OnlineHistograms(FifoDecoder::Rule pRule, std::vector<Definition> pDefinitions);   ///< Constructor.
+    OnlineHistograms(const OnlineHistograms&) = delete;             ///< Deleted copy constructor.
+    OnlineHistograms(OnlineHistograms&&) = delete;                  ///< Deleted move constructor.
+    ~OnlineHistograms();                                            ///< Destructor.
+    //
+    OnlineHistograms& operator=(OnlineHistograms) = delete;         ///< Deleted copy assignment operator.
+    OnlineHistograms& operator=(OnlineHistograms&&) = delete;       ///< Deleted move assignment operator.
+    //
+    const FifoDecoder::Rule& getRule() const;                       ///< Get the definition of the histogrammed record type.
+    const std::vector<Definition>& getDefinitions() const;          ///< Get the histogram definitions.
+    std::size_t findHistogram(const std::string& pName) const;      ///< Get the index of a histogram.
+    std::vector<std::size_t> getShape(std::size_t pIdx) const;      ///< Get the numbers of bins of a histogram.
+    //
+    void fill(std::span<const std::uint32_t> pWords);               ///< Fill the histograms with the matching data words.
+    //
+    std::vector<std::uint64_t> getSnapshot(std::size_t pIdx) const; ///< Get the current merged bin contents of a histogram.
+    std::uint64_t getNumRecords() const;                            ///< Get the number of histogrammed records.
+    std::size_t getNumAccumulators() const;                         ///< Get the number of threads that filled the histograms.
+    void reset();                                                   ///< Start counting from zero again.
+
+public:
+    static constexpr std::size_t maxBins = 4194304;                 ///< Maximum number of bins of all histograms together.
+
+private:
+    /*!
+     * \brief Bin layout of a histogram.
+     */
+    struct Layout
+    {
+        std::size_t xFieldIdx;          ///< Rule field index of the first axis.
+        std::size_t yFieldIdx;          ///< Rule field index of the second axis (ignored if \ref yBins is 1).
+        std::size_t xBins;              ///< Number of bins of the first axis.
+        std::size_t yBins;              ///< Number of bins of the second axis (1 for a one-dimensional histogram).
+        std::size_t offset;             ///< Index of the first bin in the accumulators.
+    };
+    //
+    struct Accumulator;                                             ///< Bins of a filling thread.
+
+private:
+    Accumulator& getThreadAccumulator();                            ///< Get (or create) the accumulator of the calling thread.
+    std::uint64_t mergeCounts(std::size_t pIdx) const;              ///< Sum up a counter of all accumulators.
+
+private:
+    const FifoDecoder::Rule rule;                                   ///< Definition of the histogrammed record type.
+    const std::vector<Definition> definitions;                      ///< Histogram definitions.
+    std::vector<Layout> layouts;                                    ///< Bin layouts of the histograms.
+    std::size_t numCounters;                                        ///< Number of counters per accumulator (record count and all bins).
+    const std::uint64_t instanceId;                                 ///< Process-wide unique ID to find the thread-local accumulators.
+    //
+    std::vector<std::unique_ptr<Accumulator>> accumulators;         ///< Accumulators of all filling threads.
+    std::vector<std::uint64_t> baseline;                            ///< Merged counters at the last reset().
+    mutable std::mutex accumulatorsMutex;                           ///< Protects the accumulator list and the baseline.
+};
+
+} // namespace casil
+
+#endif // CASIL_ONLINEHISTOGRAMS_H
@@ -0,0 +1,420 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/pooledbuffer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+using casil::PooledBuffer;
+
+namespace
+{
+
+std::atomic_uint64_t blocksAcquired {0};    //See PooledBuffer::Statistics::blocksAcquired
+std::atomic_uint64_t blocksAllocated {0};   //See PooledBuffer::Statistics::blocksAllocated
+std::atomic_uint64_t blocksRecycled {0};    //See PooledBuffer::Statistics::blocksRecycled
+
+thread_local bool threadFreeListsDestroyed = false;     //Blocks released during/after thread exit must be freed directly
+
+} // namespace
+
+/*!
+ * \brief Memory block shared by all buffers referring to it.
+ */
+struct PooledBuffer::Block
+{
+    std::atomic_size_t refCount;                ///< Number of buffers referring to the block.
+    std::size_t size;                           ///< Used number of bytes.
+    const std::size_t capacity;                 ///< Number of allocated bytes.
+    const std::size_t sizeClass;                ///< Index in \ref sizeClasses (or number of size classes for non-pooled blocks).
+    const std::unique_ptr<std::uint8_t[]> bytes;///< Allocated bytes.
+};
+
+/*!
+ * \brief Free blocks of one thread for each size class.
+ */
+struct PooledBuffer::FreeLists
+{
+    std::array<std::vector<Block*>, sizeClasses.size()> lists; ///< Free blocks by size class (capacity reserved up front).
+    //
+    FreeLists()                                                 ///< Constructor.
+    {
+        for (std::vector<Block*>& list : lists)
+            list.reserve(maxFreeBlocksPerClass);
+    }
+    FreeLists(const FreeLists&) = delete;                       ///< Deleted copy constructor.
+    FreeLists(FreeLists&&) = delete;                            ///< Deleted move constructor.
+    ~FreeLists()                                                ///< Destructor. Frees all blocks.
+    {
+        threadFreeListsDestroyed = true;
+
+        for (std::vector<Block*>& list : lists)
+            for (Block* const block : list)
+                delete block;
+    }
+    //
+    FreeLists& operator=(FreeLists) = delete;                   ///< Deleted copy assignment operator.
+    FreeLists& operator=(FreeLists&&) = delete;                 ///< Deleted move assignment operator.
+};
+
+/*!
+ * \brief Default constructor.
+ *
+ * Constructs an empty buffer without a block (no allocation).
+ */
+PooledBuffer::PooledBuffer() :
+    block(nullptr)
+{
+}
+
+/*!
+ * \brief Constructor.
+ *
+ * Takes a block of the smallest fitting size class from the calling thread's pool (or allocates one)
+ * and sets the buffer size to \p pSize. The buffer bytes are \e not initialized.
+ *
+ * \param pSize Buffer size in number of bytes.
+ */
+PooledBuffer::PooledBuffer(const std::size_t pSize) :
+    block(acquireBlock(pSize))
+{
+}
+
+/*!
+ * \brief Copy constructor.
+ *
+ * Shares the block of \p pOther.
+ *
+ * \param pOther Other buffer.
+ */
+PooledBuffer::PooledBuffer(const PooledBuffer& pOther) :
+    block(pOther.block)
+{
+    if (block)
+        block->refCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Move constructor.
+ *
+ * Takes over the block of \p pOther, which becomes empty.
+ *
+ * \param pOther Other buffer.
+ */
+PooledBuffer::PooledBuffer(PooledBuffer&& pOther) noexcept :
+    block(std::exchange(pOther.block, nullptr))
+{
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Returns the block to the calling thread's pool if this was the last reference (see releaseBlock()).
+ */
+PooledBuffer::~PooledBuffer()
+{
+    releaseBlock(block);
+}
+
+//Public
+
+/*!
+ * \brief Copy assignment operator.
+ *
+ * Releases the current block (see releaseBlock()) and shares the block of \p pOther.
+ *
+ * \param pOther Other buffer.
+ * \return This buffer.
+ */
+PooledBuffer& PooledBuffer::operator=(const PooledBuffer& pOther)
+{
+    if (pOther.block)
+        pOther.block->refCount.fetch_add(1, std::memory_order_relaxed);
+
+    releaseBlock(std::exchange(block, pOther.block));
+
+    return *this;
+}
+
+/*!
+ * \brief Move assignment operator.
+ *
+ * Releases the current block (see releaseBlock()) and takes over the block of \p pOther, which becomes empty.
+ *
+ * \param pOther Other buffer.
+ * \return This buffer.
+ */
+PooledBuffer& PooledBuffer::operator=(PooledBuffer&& pOther) noexcept
+{
+    if (this != &pOther)
+        releaseBlock(std::exchange(block, std::exchange(pOther.block, nullptr)));
+
+    return *this;
+}
+
+//
+
+/*!
+ * \brief Get a pointer to the buffer bytes.
+ *
+ * \return Pointer to the first byte (null for a buffer without block).
+ */
+std::uint8_t* PooledBuffer::data()
+{
+    return (block ? block->bytes.get() : nullptr);
+}
+
+/*!
+ * \brief Get a pointer to the buffer bytes.
+ *
+ * \return Pointer to the first byte (null for a buffer without block).
+ */
+const std::uint8_t* PooledBuffer::data() const
+{
+    return (block ? block->bytes.get() : nullptr);
+}
+
+/*!
+ * \brief Get the buffer size in number of bytes.
+ *
+ * \return Buffer size.
+ */
+std::size_t PooledBuffer::size() const
+{
+    return (block ? block->size : 0);
+}
+
+/*!
+ * \brief Get the maximum size without changing the block.
+ *
+ * \return Block capacity in number of bytes.
+ */
+std::size_t PooledBuffer::capacity() const
+{
+    return (block ? block->capacity : 0);
+}
+
+/*!
+ * \brief Check if the buffer size is zero.
+ *
+ * \return If size() is zero.
+ */
+bool PooledBuffer::empty() const
+{
+    return size() == 0;
+}
+
+/*!
+ * \brief Get the number of buffers sharing the block.
+ *
+ * \return Reference count of the block (zero for a buffer without block).
+ */
+std::size_t PooledBuffer::useCount() const
+{
+    return (block ? block->refCount.load(std::memory_order_relaxed) : 0);
+}
+
+//
+
+/*!
+ * \brief Change the buffer size.
+ *
+ * Only changes the size if \p pSize fits into the current block (see capacity()), which affects all buffers sharing
+ * the block. Otherwise takes a new block of fitting size class (see PooledBuffer(std::size_t)), copies the current bytes
+ * and releases the old block, i.e. this buffer no longer shares its bytes with other buffers afterwards.
+ * Added bytes are \e not initialized.
+ *
+ * \param pSize New buffer size in number of bytes.
+ */
+void PooledBuffer::resize(const std::size_t pSize)
+{
+    if (block && pSize <= block->capacity)
+    {
+        block->size = pSize;
+        return;
+    }
+
+    Block* const newBlock = acquireBlock(pSize);
+
+    if (block)
+        std::copy(block->bytes.get(), block->bytes.get() + block->size, newBlock->bytes.get());
+
+    releaseBlock(std::exchange(block, newBlock));
+}
+
+//
+
+/*!
+ * \brief Get a view of the buffer bytes.
+ *
+ * \return Span of size() bytes.
+ */
+std::span<std::uint8_t> PooledBuffer::span()
+{
+    return std::span<std::uint8_t>(data(), size());
+}
+
+/*!
+ * \brief Get a view of the buffer bytes.
+ *
+ * \return Span of size() bytes.
+ */
+std::span<const std::uint8_t> PooledBuffer::span() const
+{
+    return std::span<const std::uint8_t>(data(), size());
+}
+
+/*!
+ * \brief Copy the buffer bytes to a vector.
+ *
+ * \return Copy of the size() bytes.
+ */
+std::vector<std::uint8_t> PooledBuffer::toVector() const
+{
+    return std::vector<std::uint8_t>(data(), data() + size());
+}
+
+//
+
+/*!
+ * \brief Get the current process-wide pool counters.
+ *
+ * \return Counters of all threads.
+ */
+PooledBuffer::Statistics PooledBuffer::getStatistics()
+{
+    return Statistics{.blocksAcquired = blocksAcquired.load(std::memory_order_relaxed),
+                      .blocksAllocated = blocksAllocated.load(std::memory_order_relaxed),
+                      .blocksRecycled = blocksRecycled.load(std::memory_order_relaxed)};
+}
+
+/*!
+ * \brief Free all pooled blocks of the calling thread.
+ *
+ * Blocks still referenced by buffers are not affected.
+ */
+void PooledBuffer::clearThreadPool()
+{
+    FreeLists* const freeLists = getThreadFreeLists();
+
+    if (!freeLists)
+        return;
+
+    for (std::vector<Block*>& list : freeLists->lists)
+    {
+        for (Block* const tBlock : list)
+            delete tBlock;
+
+        list.clear();
+    }
+}
+
+//Private
+
+/*!
+ * \brief Take a block from the calling thread's pool or allocate one.
+ *
+ * Uses the smallest size class that fits \p pSize. Allocates a dedicated (non-pooled)
+ * block of exactly \p pSize bytes if \p pSize exceeds the largest size class.
+ *
+ * \param pSize Required number of bytes.
+ * \return Block with reference count one and size \p pSize.
+ */
+PooledBuffer::Block* PooledBuffer::acquireBlock(const std::size_t pSize)
+{
+    blocksAcquired.fetch_add(1, std::memory_order_relaxed);
+
+    const std::size_t sizeClass = static_cast<std::size_t>(std::lower_bound(sizeClasses.begin(), sizeClasses.end(), pSize) -
+                                                           sizeClasses.begin());
+
+    if (sizeClass < sizeClasses.size())
+    {
+        FreeLists* const freeLists = getThreadFreeLists();
+
+        if (freeLists && !freeLists->lists[sizeClass].empty())
+        {
+            Block* const tBlock = freeLists->lists[sizeClass].back();
+            freeLists->lists[sizeClass].pop_back();
+
+            tBlock->refCount.store(1, std::memory_order_relaxed);
+            tBlock->size = pSize;
+
+            return tBlock;
+        }
+    }
+
+    blocksAllocated.fetch_add(1, std::memory_order_relaxed);
+
+    const std::size_t capacity = (sizeClass < sizeClasses.size() ? sizeClasses[sizeClass] : pSize);
+
+    return new Block{.refCount {1}, .size = pSize, .capacity = capacity, .sizeClass = sizeClass,
+                     .bytes = std::make_unique_for_overwrite<std::uint8_t[]>(capacity)};
+}
+
+/*!
+ * \brief Drop a reference to a block and pool or free it when unused.
+ *
+ * If this was the last reference, puts \p pBlock into the calling thread's free list of its size class,
+ * unless the list is full, the block is not pooled (too large) or the calling thread is exiting (then frees it).
+ *
+ * \param pBlock The block (may be null).
+ */
+void PooledBuffer::releaseBlock(Block* const pBlock)
+{
+    if (!pBlock || pBlock->refCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    if (pBlock->sizeClass < sizeClasses.size())
+    {
+        FreeLists* const freeLists = getThreadFreeLists();
+
+        if (freeLists && freeLists->lists[pBlock->sizeClass].size() < maxFreeBlocksPerClass)
+        {
+            freeLists->lists[pBlock->sizeClass].push_back(pBlock);
+            blocksRecycled.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    delete pBlock;
+}
+
+/*!
+ * \brief Get the calling thread's free lists.
+ *
+ * Creates the lists on first use by the calling thread.
+ *
+ * \return Free lists of the calling thread or null if they were already destroyed (during thread exit).
+ */
+PooledBuffer::FreeLists* PooledBuffer::getThreadFreeLists()
+{
+    if (threadFreeListsDestroyed)
+        return nullptr;
+
+    thread_local FreeLists freeLists;
+
+    return &freeLists;
+}
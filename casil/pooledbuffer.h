@@ -0,0 +1,111 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_POOLEDBUFFER_H
+#define CASIL_POOLEDBUFFER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace casil
+{
+
+/*!
+ * \brief Reference-counted byte buffer whose memory is taken from and returned to a thread-local pool.
+ *
+ * Interface reads that would otherwise return a freshly allocated \c std::vector<std::uint8_t> can return
+ * a %PooledBuffer instead (see e.g. TL::MuxedInterface::readPooled()). The buffer memory is a \e block of one of
+ * a few fixed size classes (see sizeClasses). Blocks are kept in free lists per size class and per thread when
+ * the last reference is released, such that a steady stream of similarly sized reads does not allocate.
+ * Requests larger than the largest size class are served by a dedicated block that is freed instead of pooled.
+ *
+ * Copying a %PooledBuffer only shares the block (like \c std::shared_ptr) and moving it between
+ * layers or threads neither copies nor allocates. Note that copies hence refer to the same bytes (and size).
+ * The reference count is atomic, but the buffer contents are not synchronized.
+ *
+ * Blocks are returned to the pool of the thread that releases the last reference.
+ * Each free list keeps at most \ref maxFreeBlocksPerClass blocks.
+ */
+class PooledBuffer
+{
+public:
+    /*!
+     * \brief Snapshot of the process-wide pool counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t blocksAcquired;   ///< Number of blocks handed out for new buffers.
+        std::uint64_t blocksAllocated;  ///< Number of blocks that had to be allocated because the free list was empty.
+        std::uint64_t blocksRecycled;   ///< Number of released blocks that were put back into a free list.
+    };
+
+public:
+    PooledBuffer();                                                 ///< Default constructor.
+    explicit PooledBuffer(std::size_t pSize);                       ///< Constructor.
+    PooledBuffer(const PooledBuffer& pOther);                       ///< Copy constructor.
+    PooledBuffer(PooledBuffer&& pOther) noexcept;                   ///< Move constructor.
+    ~PooledBuffer();                                                ///< Destructor.
+    //
+    PooledBuffer& operator=(const PooledBuffer& pOther);            ///< Copy assignment operator.
+    PooledBuffer& operator=(PooledBuffer&& pOther) noexcept;        ///< Move assignment operator.
+    //
+    std::uint8_t* data();                                           ///< Get a pointer to the buffer bytes.
+    const std::uint8_t* data() const;                               ///< Get a pointer to the buffer bytes.
+    std::size_t size() const;                                       ///< Get the buffer size in number of bytes.
+    std::size_t capacity() const;                                   ///< Get the maximum size without changing the block.
+    bool empty() const;                                             ///< Check if the buffer size is zero.
+    std::size_t useCount() const;                                   ///< Get the number of buffers sharing the block.
+    //
+    void resize(std::size_t pSize);                                 ///< Change the buffer size.
+    //
+    std::span<std::uint8_t> span();                                 ///< Get a view of the buffer bytes.
+    std::span<const std::uint8_t> span() const;                     ///< Get a view of the buffer bytes.
+    std::vector<std::uint8_t> toVector() const;                     ///< Copy the buffer bytes to a vector.
+    //
+    static Statistics getStatistics();                              ///< Get the current process-wide pool counters.
+    static void clearThreadPool();                                  ///< Free all pooled blocks of the calling thread.
+
+public:
+    static constexpr std::array<std::size_t, 5> sizeClasses = {64, 512, 4096, 65536, 1048576};
+                                                                    ///< Block capacities of the pooled size classes.
+    static constexpr std::size_t maxFreeBlocksPerClass = 8;         ///< Maximum number of free blocks per size class and thread.
+
+private:
+    struct Block;
+    struct FreeLists;
+
+private:
+    static Block* acquireBlock(std::size_t pSize);                  ///< Take a block from the calling thread's pool or allocate one.
+    static void releaseBlock(Block* pBlock);                        ///< Drop a reference to a block and pool or free it when unused.
+    static FreeLists* getThreadFreeLists();                         ///< Get the calling thread's free lists.
+
+private:
+    Block* block;                                                   ///< Shared block (null for an empty default-constructed buffer).
+};
+
+} // namespace casil
+
+#endif // CASIL_POOLEDBUFFER_H
@@ -0,0 +1,1177 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <casil/rawdatafile.h>
+
+#include <casil/auxil.h>
+#include <casil/bytes.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <filesystem>
+#include <ios>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+using casil::RawDataReader;
+using casil::RawDataReceiver;
+using casil::RawDataWriter;
+
+namespace
+{
+
+constexpr std::uint64_t maxLZ4Expansion = 255;  //Upper bound of the ratio of decompressed and compressed size of an LZ4 block
+
+/*
+ * Get a little endian 16 bit value from a byte sequence.
+ */
+std::uint16_t loadUInt16(const std::span<const std::uint8_t> pBytes, const std::size_t pOffs)
+{
+    return casil::Bytes::composeUInt16(pBytes.subspan(pOffs).first<2>(), false);
+}
+
+/*
+ * Get a little endian 32 bit value from a byte sequence.
+ */
+std::uint32_t loadUInt32(const std::span<const std::uint8_t> pBytes, const std::size_t pOffs)
+{
+    return casil::Bytes::composeUInt32(pBytes.subspan(pOffs).first<4>(), false);
+}
+
+/*
+ * Get a little endian 64 bit value from a byte sequence.
+ */
+std::uint64_t loadUInt64(const std::span<const std::uint8_t> pBytes, const std::size_t pOffs)
+{
+    return casil::Bytes::composeUInt64(pBytes.subspan(pOffs).first<8>(), false);
+}
+
+/*
+ * Get the current time in nanoseconds since Unix epoch.
+ */
+std::uint64_t currentTimestamp()
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+/*
+ * Parse the chunk header 'pHeader' located at byte offset 'pOffset' of a file/stream described by 'pSourceDesc'.
+ * Throws std::runtime_error if the header is invalid, including word counts that an (LZ4-compressed) payload
+ * of the stated length cannot hold, such that the word count can be trusted for allocating the decoded data.
+ */
+RawDataReader::ChunkInfo parseChunkHeader(const std::span<const std::uint8_t> pHeader, const std::uint64_t pOffset,
+                                          const std::string& pSourceDesc)
+{
+    using Compression = RawDataReader::Compression;
+
+    const RawDataReader::ChunkInfo info {.boardId = ::loadUInt32(pHeader, 4),
+                                         .sequence = ::loadUInt64(pHeader, 8),
+                                         .timestamp = ::loadUInt64(pHeader, 16),
+                                         .numWords = ::loadUInt32(pHeader, 24),
+                                         .payloadSize = ::loadUInt32(pHeader, 28),
+                                         .compression = static_cast<Compression>(::loadUInt16(pHeader, 32)),
+                                         .offset = pOffset};
+
+    if (::loadUInt32(pHeader, 0) != RawDataReader::chunkMagic || info.payloadSize % 4 != 0 ||
+        (info.compression == Compression::None && info.payloadSize != 4 * static_cast<std::uint64_t>(info.numWords)) ||
+        (info.compression == Compression::LZ4 && 4 * static_cast<std::uint64_t>(info.numWords) > maxLZ4Expansion * info.payloadSize))
+    {
+        throw std::runtime_error("Invalid chunk header at byte offset " + std::to_string(pOffset) + " of " + pSourceDesc + ".");
+    }
+
+    return info;
+}
+
+/*
+ * Decode the stored payload 'pPayload' of a chunk described by 'pInfo' into 'pWords' (resized to the number of data words).
+ * Throws std::runtime_error if the compression is not supported or the payload cannot be decompressed.
+ */
+void decodeChunkPayload(const RawDataReader::ChunkInfo& pInfo, const std::span<const std::uint8_t> pPayload, std::vector<std::uint32_t>& pWords)
+{
+    using Compression = RawDataReader::Compression;
+
+    pWords.resize(pInfo.numWords);
+
+    std::vector<std::uint8_t> bytes(4 * static_cast<std::size_t>(pInfo.numWords));
+
+    if (pInfo.compression == Compression::None)
+        std::copy(pPayload.begin(), pPayload.end(), bytes.begin());
+    else if (pInfo.compression == Compression::LZ4)
+    {
+        try
+        {
+            casil::Auxil::decompressLZ4Block(pPayload, bytes);
+        }
+        catch (const std::invalid_argument& exc)
+        {
+            throw std::runtime_error("Could not decompress chunk payload: " + std::string(exc.what()));
+        }
+    }
+    else
+        throw std::runtime_error("Unsupported compression " + std::to_string(static_cast<std::uint16_t>(pInfo.compression)) +
+                                 " of chunk payload.");
+
+    casil::Bytes::decodeUInt32LE(bytes, pWords);
+}
+
+} // namespace
+
+/*!
+ * \brief Read-only mapping of the file.
+ *
+ * Opens the file and maps it completely.
+ */
+struct RawDataReader::MappedFile
+{
+    explicit MappedFile(const std::string& pFilePath) :
+        mapping(),
+        region()
+    {
+        try
+        {
+            mapping = boost::interprocess::file_mapping(pFilePath.c_str(), boost::interprocess::read_only);
+            region = boost::interprocess::mapped_region(mapping, boost::interprocess::read_only);
+        }
+        catch (const boost::interprocess::interprocess_exception& exc)
+        {
+            throw std::runtime_error("Could not map raw data file \"" + pFilePath + "\": " + exc.what());
+        }
+    }
+    //
+    std::span<const std::uint8_t> bytes() const
+    {
+        return std::span<const std::uint8_t>(static_cast<const std::uint8_t*>(region.get_address()), region.get_size());
+    }
+    //
+    boost::interprocess::file_mapping mapping;      ///< Mapping of the file.
+    boost::interprocess::mapped_region region;      ///< Mapped region covering the whole file.
+};
+
+/*!
+ * \brief Constructor.
+ *
+ * Maps the file at \p pFilePath, validates the file header and indexes all complete chunks.
+ * An incomplete chunk at the end of the file is ignored (see isTruncated()).
+ *
+ * \throws std::runtime_error If the file cannot be mapped (e.g. if it does not exist or is empty).
+ * \throws std::runtime_error If the file header is invalid or the format version is not supported.
+ * \throws std::runtime_error If a chunk header is invalid.
+ *
+ * \param pFilePath Path of the file.
+ */
+RawDataReader::RawDataReader(const std::string& pFilePath) :
+    filePath(pFilePath),
+    mappedFile(std::make_unique<MappedFile>(pFilePath)),
+    creationTime(0),
+    validSize(0),
+    truncated(false),
+    numWords(0),
+    index()
+{
+    const std::span<const std::uint8_t> bytes = mappedFile->bytes();
+
+    if (bytes.size() < fileHeaderSize || ::loadUInt32(bytes, 0) != fileMagic)
+        throw std::runtime_error("Invalid header of raw data file \"" + filePath + "\".");
+
+    if (::loadUInt32(bytes, 4) != formatVersion)
+        throw std::runtime_error("Unsupported format version " + std::to_string(::loadUInt32(bytes, 4)) + " of raw data file \"" +
+                                 filePath + "\".");
+
+    creationTime = ::loadUInt64(bytes, 8);
+
+    std::size_t offset = fileHeaderSize;
+
+    while (offset < bytes.size())
+    {
+        if (bytes.size() - offset < chunkHeaderSize)
+        {
+            truncated = true;
+            break;
+        }
+
+        const ChunkInfo info = ::parseChunkHeader(bytes.subspan(offset, chunkHeaderSize), offset, "raw data file \"" + filePath + "\"");
+
+        if (bytes.size() - offset - chunkHeaderSize < info.payloadSize)
+        {
+            truncated = true;
+            break;
+        }
+
+        index.push_back(info);
+        numWords += info.numWords;
+
+        offset += chunkHeaderSize + info.payloadSize;
+    }
+
+    validSize = offset;
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Unmaps the file.
+ */
+RawDataReader::~RawDataReader() = default;
+
+//Public
+
+/*!
+ * \brief Get the path of the file.
+ *
+ * \return Path of the file.
+ */
+const std::string& RawDataReader::getFilePath() const
+{
+    return filePath;
+}
+
+/*!
+ * \brief Get the creation time of the file.
+ *
+ * \return Creation time from the file header (nanoseconds since Unix epoch).
+ */
+std::uint64_t RawDataReader::getCreationTime() const
+{
+    return creationTime;
+}
+
+/*!
+ * \brief Get the file size covered by the header and complete chunks.
+ *
+ * \return Byte offset behind the last complete chunk.
+ */
+std::uint64_t RawDataReader::getValidSize() const
+{
+    return validSize;
+}
+
+/*!
+ * \brief Check if the file ends with an incomplete chunk.
+ *
+ * \return True if the file contains more bytes than covered by the complete chunks (see getValidSize()).
+ */
+bool RawDataReader::isTruncated() const
+{
+    return truncated;
+}
+
+//
+
+/*!
+ * \brief Get the number of complete chunks.
+ *
+ * \return Number of indexed chunks.
+ */
+std::size_t RawDataReader::getNumChunks() const
+{
+    return index.size();
+}
+
+/*!
+ * \brief Get the total number of data words of all chunks.
+ *
+ * \return Sum of the word counts of all indexed chunks.
+ */
+std::uint64_t RawDataReader::getNumWords() const
+{
+    return numWords;
+}
+
+/*!
+ * \brief Get the index of all complete chunks.
+ *
+ * \return Index entries in file order.
+ */
+const std::vector<RawDataReader::ChunkInfo>& RawDataReader::getIndex() const
+{
+    return index;
+}
+
+/*!
+ * \brief Get the index entry of a chunk.
+ *
+ * \throws std::invalid_argument If \p pIdx is not less than getNumChunks().
+ *
+ * \param pIdx Position of the chunk in the file.
+ * \return Index entry of the chunk.
+ */
+const RawDataReader::ChunkInfo& RawDataReader::getChunkInfo(const std::size_t pIdx) const
+{
+    if (pIdx >= index.size())
+        throw std::invalid_argument("Chunk " + std::to_string(pIdx) + " does not exist in raw data file \"" + filePath + "\".");
+
+    return index[pIdx];
+}
+
+/*!
+ * \brief Find the chunk with a certain board ID and sequence number.
+ *
+ * \param pBoardId Board ID.
+ * \param pSequence Sequence number.
+ * \return Position of the first matching chunk in the file or \ref npos if there is none.
+ */
+std::size_t RawDataReader::findSequence(const std::uint32_t pBoardId, const std::uint64_t pSequence) const
+{
+    const auto it = std::find_if(index.begin(), index.end(),
+                                 [pBoardId, pSequence](const ChunkInfo& pInfo) -> bool
+                                 {
+                                     return pInfo.boardId == pBoardId && pInfo.sequence == pSequence;
+                                 });
+
+    return (it == index.end() ? npos : static_cast<std::size_t>(it - index.begin()));
+}
+
+/*!
+ * \brief Find the first chunk written at or after a certain time.
+ *
+ * \param pTimestamp Time in nanoseconds since Unix epoch.
+ * \return Position of the first chunk in the file whose timestamp is not before \p pTimestamp or \ref npos if there is none.
+ */
+std::size_t RawDataReader::findTime(const std::uint64_t pTimestamp) const
+{
+    const auto it = std::find_if(index.begin(), index.end(),
+                                 [pTimestamp](const ChunkInfo& pInfo) -> bool { return pInfo.timestamp >= pTimestamp; });
+
+    return (it == index.end() ? npos : static_cast<std::size_t>(it - index.begin()));
+}
+
+//
+
+/*!
+ * \brief Get a view of the stored payload of a chunk.
+ *
+ * \throws std::invalid_argument If \p pIdx is not less than getNumChunks().
+ *
+ * \param pIdx Position of the chunk in the file.
+ * \return View of the payload bytes in the mapping (valid while the reader exists).
+ */
+std::span<const std::uint8_t> RawDataReader::getPayload(const std::size_t pIdx) const
+{
+    const ChunkInfo& info = getChunkInfo(pIdx);
+
+    return mappedFile->bytes().subspan(info.offset + chunkHeaderSize, info.payloadSize);
+}
+
+/*!
+ * \brief Get a view of the data words of an uncompressed chunk.
+ *
+ * Reinterprets the payload (see getPayload()) as data words, which is possible without copying on little endian hosts.
+ *
+ * \throws std::invalid_argument If \p pIdx is not less than getNumChunks().
+ * \throws std::runtime_error If the chunk payload is compressed.
+ * \throws std::runtime_error If the host byte order is not little endian.
+ *
+ * \param pIdx Position of the chunk in the file.
+ * \return View of the data words in the mapping (valid while the reader exists).
+ */
+std::span<const std::uint32_t> RawDataReader::getWords(const std::size_t pIdx) const
+{
+    const ChunkInfo& info = getChunkInfo(pIdx);
+
+    if (info.compression != Compression::None)
+        throw std::runtime_error("Cannot decode compressed chunk " + std::to_string(pIdx) + " of raw data file \"" + filePath + "\".");
+
+    if constexpr (std::endian::native != std::endian::little)
+        throw std::runtime_error("Data words of raw data files can only be viewed in place on little endian hosts.");
+
+    const std::span<const std::uint8_t> payload = getPayload(pIdx);
+
+    return std::span<const std::uint32_t>(reinterpret_cast<const std::uint32_t*>(payload.data()), info.numWords);
+}
+
+/*!
+ * \brief Get a copy of the (decompressed) data words of a chunk.
+ *
+ * Other than getWords(), this also supports LZ4-compressed chunks and big endian hosts.
+ *
+ * \throws std::invalid_argument If \p pIdx is not less than getNumChunks().
+ * \throws std::runtime_error If the compression of the chunk is not supported or the payload cannot be decompressed.
+ *
+ * \param pIdx Position of the chunk in the file.
+ * \return Data words of the chunk.
+ */
+std::vector<std::uint32_t> RawDataReader::decodeWords(const std::size_t pIdx) const
+{
+    std::vector<std::uint32_t> words;
+
+    try
+    {
+        ::decodeChunkPayload(getChunkInfo(pIdx), getPayload(pIdx), words);
+    }
+    catch (const std::runtime_error& exc)
+    {
+        throw std::runtime_error("Could not decode chunk " + std::to_string(pIdx) + " of raw data file \"" + filePath + "\": " + exc.what());
+    }
+
+    return words;
+}
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Opens the file at \p pFilePath for appending and starts the background thread. A new file (or an existing empty file)
+ * starts with a file header. An existing file is validated and continued (see RawDataWriter): An incomplete
+ * last chunk is cut off and the sequence numbers continue after the last chunk with board ID \p pBoardId.
+ *
+ * All \p pNumBuffers buffers are allocated up front with a capacity of \p pBufferSize plus \ref writeAlignment bytes.
+ *
+ * \throws std::invalid_argument If \p pFilePath is empty.
+ * \throws std::invalid_argument If \p pBufferSize is smaller than \ref writeAlignment.
+ * \throws std::invalid_argument If \p pNumBuffers is smaller than 2.
+ * \throws std::runtime_error If an existing file is not a valid raw data file or cannot be truncated.
+ * \throws std::runtime_error If the file cannot be opened.
+ *
+ * \param pFilePath Path of the file.
+ * \param pBoardId Board ID to write to the chunks.
+ * \param pBufferSize Buffer fill level in bytes that triggers writing the buffer.
+ * \param pNumBuffers Number of buffers (i.e. one being filled plus up to \p pNumBuffers - 1 waiting to be written).
+ */
+RawDataWriter::RawDataWriter(std::string pFilePath, const std::uint32_t pBoardId, const std::size_t pBufferSize, const std::size_t pNumBuffers) :
+    filePath(std::move(pFilePath)),
+    boardId(pBoardId),
+    bufferSize(pBufferSize),
+    file(),
+    open(false),
+    nextSequence(0),
+    fileOffset(0),
+    currentBuffer(),
+    writeThread(),
+    pendingBuffers(),
+    freeBuffers(),
+    writing(false),
+    stopRequested(false),
+    writeError(),
+    statistics{.chunksWritten = 0, .wordsWritten = 0, .bytesWritten = 0, .fileWrites = 0, .bufferStalls = 0},
+    mutex(),
+    writeCondVar(),
+    doneCondVar()
+{
+    if (filePath == "")
+        throw std::invalid_argument("Empty path for raw data file.");
+    if (bufferSize < writeAlignment)
+        throw std::invalid_argument("Buffer size for raw data file must be at least " + std::to_string(writeAlignment) + " bytes.");
+    if (pNumBuffers < 2)
+        throw std::invalid_argument("At least two buffers are required for writing raw data file.");
+
+    std::error_code errorCode;
+    const bool continueFile = std::filesystem::file_size(filePath, errorCode) > 0 && !errorCode;
+
+    if (continueFile)
+    {
+        try
+        {
+            {
+                const RawDataReader reader(filePath);
+
+                fileOffset = reader.getValidSize();
+
+                for (const RawDataReader::ChunkInfo& info : reader.getIndex())
+                    if (info.boardId == boardId)
+                        nextSequence = std::max(nextSequence, info.sequence + 1);
+            }
+
+            std::filesystem::resize_file(filePath, fileOffset);
+        }
+        catch (const std::runtime_error& exc)
+        {
+            throw std::runtime_error("Could not continue raw data file \"" + filePath + "\": " + exc.what());
+        }
+    }
+
+    file.rdbuf()->pubsetbuf(nullptr, 0);    //Buffers are written as a whole
+    file.open(filePath, std::ios::binary | std::ios::app);
+
+    if (!file.is_open())
+        throw std::runtime_error("Could not open raw data file \"" + filePath + "\".");
+
+    currentBuffer.reserve(bufferSize + writeAlignment);
+
+    freeBuffers.reserve(pNumBuffers);
+    for (std::size_t i = 1; i < pNumBuffers; ++i)
+        freeBuffers.emplace_back().reserve(bufferSize + writeAlignment);
+
+    if (!continueFile)
+    {
+        Bytes::composeBytesTo(std::back_inserter(currentBuffer), false, RawDataReader::fileMagic, RawDataReader::formatVersion, ::currentTimestamp(),
+                              std::uint64_t{0}, std::uint64_t{0});
+    }
+
+    open = true;
+
+    writeThread = std::thread(&RawDataWriter::run, this);
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Calls close() and ignores possible errors.
+ */
+RawDataWriter::~RawDataWriter()
+{
+    try
+    {
+        close();
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+}
+
+//Public
+
+/*!
+ * \brief Get the path of the file.
+ *
+ * \return Path of the file.
+ */
+const std::string& RawDataWriter::getFilePath() const
+{
+    return filePath;
+}
+
+/*!
+ * \brief Get the board ID written to the chunks.
+ *
+ * \return Board ID.
+ */
+std::uint32_t RawDataWriter::getBoardId() const
+{
+    return boardId;
+}
+
+/*!
+ * \brief Get the sequence number of the next chunk.
+ *
+ * \return Sequence number for the next writeChunk().
+ */
+std::uint64_t RawDataWriter::getNextSequence() const
+{
+    return nextSequence;
+}
+
+/*!
+ * \brief Check if the file is open.
+ *
+ * \return True until close() is called.
+ */
+bool RawDataWriter::isOpen() const
+{
+    return open;
+}
+
+//
+
+/*!
+ * \brief Append a chunk of data words.
+ *
+ * Appends a chunk with the data words \p pWords, the configured board ID, the next sequence number and the current time
+ * to the current buffer. Hands the buffer over to the background thread if it is full (see RawDataWriter),
+ * which waits for a free buffer if all buffers are in use.
+ *
+ * \throws std::runtime_error If the file is closed.
+ * \throws std::runtime_error If the background thread failed to write to the file.
+ * \throws std::invalid_argument If \p pWords exceeds the maximum chunk size.
+ *
+ * \param pWords Data words.
+ */
+void RawDataWriter::writeChunk(const std::span<const std::uint32_t> pWords)
+{
+    if (pWords.size() > std::numeric_limits<std::uint32_t>::max() / 4)
+        throw std::invalid_argument("Too many data words for a chunk of raw data file \"" + filePath + "\".");
+
+    appendChunkHeader(pWords.size());
+
+    const std::size_t payloadOffs = currentBuffer.size();
+    currentBuffer.resize(payloadOffs + 4 * pWords.size());
+
+    Bytes::encodeUInt32LE(pWords, std::span<std::uint8_t>(currentBuffer).subspan(payloadOffs));
+
+    finishChunk(pWords.size());
+}
+
+/*!
+ * \brief Append a chunk of data words given as little endian bytes.
+ *
+ * Like writeChunk(std::span<const std::uint32_t>) but takes the data words as byte sequence
+ * (e.g. as returned by \ref Layers::TL::SiTCP::getFifoData() "SiTCP::getFifoData()").
+ *
+ * \throws std::runtime_error If the file is closed.
+ * \throws std::runtime_error If the background thread failed to write to the file.
+ * \throws std::invalid_argument If the size of \p pBytes is not a multiple of 4 or exceeds the maximum chunk size.
+ *
+ * \param pBytes Data words as little endian byte sequence.
+ */
+void RawDataWriter::writeChunk(const std::span<const std::uint8_t> pBytes)
+{
+    if (pBytes.size() % 4 != 0)
+        throw std::invalid_argument("Size of raw data chunk must be a multiple of 4 bytes.");
+    if (pBytes.size() > std::numeric_limits<std::uint32_t>::max())
+        throw std::invalid_argument("Too many data words for a chunk of raw data file \"" + filePath + "\".");
+
+    appendChunkHeader(pBytes.size() / 4);
+
+    currentBuffer.insert(currentBuffer.end(), pBytes.begin(), pBytes.end());
+
+    finishChunk(pBytes.size() / 4);
+}
+
+/*!
+ * \brief Write all appended chunks to the file.
+ *
+ * Hands over the current buffer (regardless of the alignment) and waits until the background thread has written all buffers.
+ * Does nothing if the file is closed.
+ *
+ * \throws std::runtime_error If the background thread failed to write to the file.
+ */
+void RawDataWriter::flush()
+{
+    if (!open)
+        return;
+
+    handOverBuffer(true);
+
+    std::unique_lock<std::mutex> stateLock(mutex);
+
+    doneCondVar.wait(stateLock, [this]() -> bool { return pendingBuffers.empty() && !writing; });
+
+    throwOnWriteError();
+}
+
+/*!
+ * \brief Write all appended chunks and close the file.
+ *
+ * Hands over the current buffer, stops the background thread after it has written all buffers and closes the file.
+ * Does nothing if the file is already closed.
+ *
+ * \throws std::runtime_error If the background thread failed to write to the file.
+ * \throws std::runtime_error If closing the file fails.
+ */
+void RawDataWriter::close()
+{
+    if (!open)
+        return;
+
+    open = false;
+
+    handOverBuffer(true);
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        stopRequested = true;
+    }
+
+    writeCondVar.notify_one();
+    writeThread.join();
+
+    file.close();
+
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    throwOnWriteError();
+
+    if (file.fail())
+        throw std::runtime_error("Could not close raw data file \"" + filePath + "\".");
+}
+
+//
+
+/*!
+ * \brief Get the current writer counters.
+ *
+ * \return Snapshot of the counters.
+ */
+RawDataWriter::Statistics RawDataWriter::getStatistics() const
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    return statistics;
+}
+
+//Private
+
+/*!
+ * \brief Append a chunk header to the current buffer.
+ *
+ * Uses the configured board ID, the next sequence number and the current time.
+ *
+ * \throws std::runtime_error If the file is closed.
+ * \throws std::runtime_error If the background thread failed to write to the file.
+ *
+ * \param pNumWords Number of data words of the chunk.
+ */
+void RawDataWriter::appendChunkHeader(const std::size_t pNumWords)
+{
+    if (!open)
+        throw std::runtime_error("Could not write to raw data file \"" + filePath + "\": File is closed.");
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        throwOnWriteError();
+    }
+
+    Bytes::composeBytesTo(std::back_inserter(currentBuffer), false, RawDataReader::chunkMagic, boardId, nextSequence, ::currentTimestamp(),
+                          static_cast<std::uint32_t>(pNumWords), static_cast<std::uint32_t>(4 * pNumWords),
+                          static_cast<std::uint16_t>(RawDataReader::Compression::None), std::uint16_t{0}, std::uint32_t{0});
+}
+
+/*!
+ * \brief Update the counters and hand over the buffer if full.
+ *
+ * \param pNumWords Number of data words of the appended chunk.
+ */
+void RawDataWriter::finishChunk(const std::size_t pNumWords)
+{
+    ++nextSequence;
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        ++statistics.chunksWritten;
+        statistics.wordsWritten += pNumWords;
+    }
+
+    if (currentBuffer.size() >= bufferSize)
+        handOverBuffer(false);
+}
+
+/*!
+ * \brief Pass the current buffer to the background thread.
+ *
+ * Queues the current buffer for writing and continues with a free buffer (waits if there is none).
+ *
+ * If \p pAll is false, only the part of the buffer up to the last file offset that is a multiple of \ref writeAlignment
+ * is queued and the remaining bytes are moved to the new buffer. Otherwise the whole buffer is queued.
+ *
+ * \param pAll Queue the whole buffer instead of only the aligned part.
+ */
+void RawDataWriter::handOverBuffer(const bool pAll)
+{
+    std::size_t length = currentBuffer.size();
+
+    if (!pAll)
+    {
+        const std::uint64_t alignedEnd = (fileOffset + length) - (fileOffset + length) % writeAlignment;
+        length = (alignedEnd > fileOffset ? static_cast<std::size_t>(alignedEnd - fileOffset) : 0);
+    }
+
+    if (length == 0)
+        return;
+
+    std::unique_lock<std::mutex> stateLock(mutex);
+
+    if (freeBuffers.empty())
+    {
+        ++statistics.bufferStalls;
+        doneCondVar.wait(stateLock, [this]() -> bool { return !freeBuffers.empty(); });
+    }
+
+    std::vector<std::uint8_t> nextBuffer = std::move(freeBuffers.back());
+    freeBuffers.pop_back();
+
+    nextBuffer.assign(currentBuffer.begin() + length, currentBuffer.end());
+    currentBuffer.resize(length);
+
+    pendingBuffers.push_back(std::move(currentBuffer));
+    currentBuffer = std::move(nextBuffer);
+
+    fileOffset += length;
+
+    writeCondVar.notify_one();
+}
+
+/*!
+ * \brief Throw if the background thread failed to write.
+ *
+ * Note: \ref mutex must be locked.
+ *
+ * \throws std::runtime_error If a write of the background thread failed.
+ */
+void RawDataWriter::throwOnWriteError() const
+{
+    if (writeError != "")
+        throw std::runtime_error(writeError);
+}
+
+/*!
+ * \brief Write handed over buffers until stopped.
+ *
+ * Writes each queued buffer to the file with a single write and returns it to the free buffers.
+ * After a failed write the remaining buffers are discarded. Exits when stopped and all buffers are processed.
+ */
+void RawDataWriter::run()
+{
+    std::unique_lock<std::mutex> stateLock(mutex);
+
+    while (true)
+    {
+        writeCondVar.wait(stateLock, [this]() -> bool { return !pendingBuffers.empty() || stopRequested; });
+
+        if (pendingBuffers.empty())
+            return;
+
+        std::vector<std::uint8_t> buffer = std::move(pendingBuffers.front());
+        pendingBuffers.pop_front();
+
+        const bool failedBefore = (writeError != "");
+
+        writing = true;
+
+        stateLock.unlock();
+
+        if (!failedBefore)
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+        stateLock.lock();
+
+        writing = false;
+
+        if (!failedBefore)
+        {
+            if (file.good())
+            {
+                statistics.bytesWritten += buffer.size();
+                ++statistics.fileWrites;
+            }
+            else
+                writeError = "Could not write to raw data file \"" + filePath + "\".";
+        }
+
+        buffer.clear();
+        freeBuffers.push_back(std::move(buffer));
+
+        doneCondVar.notify_all();
+    }
+}
+
+//
+
+/*!
+ * \brief Listening %TCP socket.
+ */
+struct RawDataReceiver::Acceptor
+{
+    Acceptor(const std::uint16_t pPort, const std::string& pAddress) :
+        ioContext(1),
+        acceptor(ioContext, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address(pAddress), pPort))
+    {
+    }
+    //
+    boost::asio::io_context ioContext;          ///< Private IO context for the blocking socket operations.
+    boost::asio::ip::tcp::acceptor acceptor;    ///< The listening socket.
+};
+
+/*!
+ * \brief Constructor.
+ *
+ * Starts listening for %TCP connections on \p pAddress and \p pPort.
+ *
+ * Received chunks whose decompressed data or stored payload is larger than \p pMaxChunkSize bytes are rejected
+ * (see receive()), such that a malformed or malicious stream cannot make the receiver allocate arbitrary amounts of memory.
+ *
+ * \throws std::invalid_argument If \p pMaxChunkSize is zero.
+ * \throws std::runtime_error If \p pAddress is invalid or listening on it fails.
+ *
+ * \param pPort Port to listen on (zero to let the system choose a free port; see getPort()).
+ * \param pAddress Local address to listen on.
+ * \param pMaxChunkSize Maximum size of a received chunk in bytes.
+ */
+RawDataReceiver::RawDataReceiver(const std::uint16_t pPort, const std::string& pAddress, const std::size_t pMaxChunkSize) :
+    maxChunkSize(pMaxChunkSize),
+    acceptor(
+        [pPort, &pAddress]() -> std::unique_ptr<Acceptor>
+        {
+            try
+            {
+                return std::make_unique<Acceptor>(pPort, pAddress);
+            }
+            catch (const boost::system::system_error& exc)
+            {
+                throw std::runtime_error("Could not listen for raw data streams on " + pAddress + ":" + std::to_string(pPort) + ": " +
+                                         exc.what());
+            }
+        }())
+{
+    if (maxChunkSize == 0)
+        throw std::invalid_argument("Maximum chunk size must not be zero.");
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops listening.
+ */
+RawDataReceiver::~RawDataReceiver() = default;
+
+//Public
+
+/*!
+ * \brief Get the listening port.
+ *
+ * \return Local port of the listening socket.
+ */
+std::uint16_t RawDataReceiver::getPort() const
+{
+    return acceptor->acceptor.local_endpoint().port();
+}
+
+//
+
+/*!
+ * \brief Receive a stream and pass its chunks to a function.
+ *
+ * Waits for a sender to connect and calls \p pHandler for every received chunk, with the index entry of the chunk
+ * in the stream (see RawDataReader::ChunkInfo; the offset refers to the stream) and its decompressed data words,
+ * until the sender closes the connection.
+ *
+ * \throws std::runtime_error If accepting the connection or receiving fails.
+ * \throws std::runtime_error If the stream is invalid (see RawDataReader for the format).
+ * \throws std::runtime_error If a chunk exceeds the maximum chunk size (see RawDataReceiver()).
+ * \throws std::runtime_error If a chunk payload cannot be decompressed.
+ *
+ * \param pHandler Function to call for every chunk.
+ * \return Counters of the received stream.
+ */
+RawDataReceiver::Statistics RawDataReceiver::receive(const ChunkHandlerType& pHandler)
+{
+    return receiveStream([](std::uint64_t) -> void {}, pHandler);
+}
+
+/*!
+ * \brief Receive a stream and write it to a raw data file.
+ *
+ * Like receive() but writes the received stream to a new raw data file at \p pFilePath (an existing file is overwritten),
+ * which contains the same chunks (board IDs, sequence numbers, timestamps and data words) and creation time
+ * as the stream but with uncompressed payloads (see RawDataReader). The file is created as soon as the stream header
+ * was received.
+ *
+ * \throws std::runtime_error If the file cannot be created or written.
+ * \throws std::runtime_error If receiving fails (see receive()).
+ *
+ * \param pFilePath Path of the file.
+ * \return Counters of the received stream.
+ */
+RawDataReceiver::Statistics RawDataReceiver::receiveToFile(const std::string& pFilePath)
+{
+    std::ofstream file;
+    std::vector<std::uint8_t> buffer;
+
+    const auto writeBuffer = [&file, &buffer, &pFilePath]() -> void
+    {
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+        if (!file.good())
+            throw std::runtime_error("Could not write to raw data file \"" + pFilePath + "\".");
+
+        buffer.clear();
+    };
+
+    const Statistics statistics = receiveStream(
+                [&file, &buffer, &pFilePath, &writeBuffer](const std::uint64_t pCreationTime) -> void
+                {
+                    file.open(pFilePath, std::ios_base::binary | std::ios_base::out | std::ios_base::trunc);
+
+                    if (!file.is_open())
+                        throw std::runtime_error("Could not create raw data file \"" + pFilePath + "\".");
+
+                    Bytes::composeBytesTo(std::back_inserter(buffer), false, RawDataReader::fileMagic, RawDataReader::formatVersion,
+                                          pCreationTime, std::uint64_t{0}, std::uint64_t{0});
+                    writeBuffer();
+                },
+                [&buffer, &writeBuffer](const RawDataReader::ChunkInfo& pInfo, const std::span<const std::uint32_t> pWords) -> void
+                {
+                    Bytes::composeBytesTo(std::back_inserter(buffer), false, RawDataReader::chunkMagic, pInfo.boardId, pInfo.sequence,
+                                          pInfo.timestamp, pInfo.numWords, static_cast<std::uint32_t>(4 * pWords.size()),
+                                          static_cast<std::uint16_t>(RawDataReader::Compression::None), std::uint16_t{0}, std::uint32_t{0});
+
+                    const std::size_t headerSize = buffer.size();
+
+                    buffer.resize(headerSize + 4 * pWords.size());
+                    Bytes::encodeUInt32LE(pWords, std::span(buffer).subspan(headerSize));
+
+                    writeBuffer();
+                });
+
+    if (file.is_open())
+    {
+        file.close();
+
+        if (file.fail())
+            throw std::runtime_error("Could not close raw data file \"" + pFilePath + "\".");
+    }
+
+    return statistics;
+}
+
+//Private
+
+/*!
+ * \brief Accept a connection and process the received stream.
+ *
+ * Waits for a sender to connect, calls \p pHeaderHandler with the creation time from the stream header and then
+ * \p pChunkHandler for every received (and decompressed) chunk until the sender closes the connection.
+ * The stream is read through a large buffer, while large payloads are read directly.
+ *
+ * \throws std::runtime_error If accepting the connection or receiving fails.
+ * \throws std::runtime_error If the stream is invalid or ends within a header or chunk.
+ * \throws std::runtime_error If a chunk exceeds the maximum chunk size (see RawDataReceiver()).
+ * \throws std::runtime_error If a chunk payload cannot be decompressed.
+ *
+ * \param pHeaderHandler Function to call with the creation time of the stream.
+ * \param pChunkHandler Function to call for every chunk.
+ * \return Counters of the received stream.
+ */
+RawDataReceiver::Statistics RawDataReceiver::receiveStream(const std::function<void(std::uint64_t)>& pHeaderHandler,
+                                                           const ChunkHandlerType& pChunkHandler)
+{
+    static constexpr std::size_t readBufferSize = 262144;
+
+    boost::asio::ip::tcp::socket socket(acceptor->ioContext);
+
+    try
+    {
+        acceptor->acceptor.accept(socket);
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        throw std::runtime_error("Could not accept raw data stream connection: " + std::string(exc.what()));
+    }
+
+    std::vector<std::uint8_t> readBuffer(readBufferSize);
+    std::size_t readBufferBegin = 0;
+    std::size_t readBufferEnd = 0;
+
+    //Fill 'pBytes' from the stream; returns false if the stream ended before the first byte (if 'pEndAllowed')
+    const auto readExactly = [&socket, &readBuffer, &readBufferBegin, &readBufferEnd](const std::span<std::uint8_t> pBytes,
+                                                                                         const bool pEndAllowed) -> bool
+    {
+        std::size_t numRead = 0;
+
+        while (numRead < pBytes.size())
+        {
+            if (readBufferBegin == readBufferEnd)
+            {
+                boost::system::error_code errorCode;
+
+                if (pBytes.size() - numRead >= readBuffer.size())
+                {
+                    numRead += boost::asio::read(socket, boost::asio::buffer(pBytes.subspan(numRead).data(), pBytes.size() - numRead),
+                                                 errorCode);
+                }
+                else
+                {
+                    readBufferBegin = 0;
+                    readBufferEnd = socket.read_some(boost::asio::buffer(readBuffer), errorCode);
+                }
+
+                if (errorCode == boost::asio::error::eof && numRead == 0 && pEndAllowed)
+                    return false;
+                else if (errorCode == boost::asio::error::eof)
+                    throw std::runtime_error("Raw data stream ended within a header or chunk.");
+                else if (errorCode)
+                    throw std::runtime_error("Could not receive raw data stream: " + errorCode.message());
+
+                continue;
+            }
+
+            const std::size_t numCopied = std::min(readBufferEnd - readBufferBegin, pBytes.size() - numRead);
+
+            std::copy_n(readBuffer.begin() + readBufferBegin, numCopied, pBytes.begin() + numRead);
+
+            readBufferBegin += numCopied;
+            numRead += numCopied;
+        }
+
+        return true;
+    };
+
+    Statistics statistics {.chunksReceived = 0, .wordsReceived = 0, .bytesReceived = 0, .compressedChunks = 0};
+
+    std::array<std::uint8_t, RawDataReader::fileHeaderSize> fileHeader {};
+
+    if (!readExactly(fileHeader, true))
+        return statistics;
+
+    if (::loadUInt32(fileHeader, 0) != RawDataReader::fileMagic || ::loadUInt32(fileHeader, 4) != RawDataReader::formatVersion)
+        throw std::runtime_error("Invalid raw data stream header or unsupported format version.");
+
+    pHeaderHandler(::loadUInt64(fileHeader, 8));
+
+    statistics.bytesReceived = fileHeader.size();
+
+    std::array<std::uint8_t, RawDataReader::chunkHeaderSize> chunkHeader {};
+    std::vector<std::uint8_t> payload;
+    std::vector<std::uint32_t> words;
+
+    while (readExactly(chunkHeader, true))
+    {
+        const RawDataReader::ChunkInfo info = ::parseChunkHeader(chunkHeader, statistics.bytesReceived, "raw data stream");
+
+        if (std::max(4 * static_cast<std::uint64_t>(info.numWords), static_cast<std::uint64_t>(info.payloadSize)) > maxChunkSize)
+        {
+            throw std::runtime_error("Chunk at byte offset " + std::to_string(statistics.bytesReceived) + " of raw data stream "
+                                     "exceeds the maximum chunk size.");
+        }
+
+        payload.resize(info.payloadSize);
+        readExactly(payload, false);
+
+        ::decodeChunkPayload(info, payload, words);
+
+        pChunkHandler(info, words);
+
+        ++statistics.chunksReceived;
+        statistics.wordsReceived += info.numWords;
+        statistics.bytesReceived += chunkHeader.size() + info.payloadSize;
+
+        if (info.compression != RawDataReader::Compression::None)
+            ++statistics.compressedChunks;
+    }
+
+    return statistics;
+}
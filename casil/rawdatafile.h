@@ -0,0 +1,303 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#ifndef CASIL_RAWDATAFILE_H
+#define CASIL_RAWDATAFILE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace casil
+{
+
+/*!
+ * \brief Memory-mapped reader with chunk index for raw FIFO data files written by RawDataWriter.
+ *
+ * A raw data file is an append-only sequence of \e chunks of 32 bit FIFO data words, preceded by a file header.
+ * Each chunk carries the board ID of the data source, a sequence number, a timestamp and its word count.
+ * All fields use little endian byte order, the payload words as well (i.e. the byte order of the FIFO data):
+ *
+ * \code{.unparsed}
+ *
+ * File header:
+ *
+ * Byte 0-3:   Magic number "CRDF" (see fileMagic)
+ * Byte 4-7:   Format version (see formatVersion)
+ * Byte 8-15:  Creation time of the file (nanoseconds since Unix epoch)
+ * Byte 16-31: Reserved
+ *
+ * Chunk:
+ *
+ * Byte 0-3:   Magic number "CRDC" (see chunkMagic)
+ * Byte 4-7:   Board ID
+ * Byte 8-15:  Sequence number (counts the chunks of a board ID)
+ * Byte 16-23: Time of writing the chunk (nanoseconds since Unix epoch)
+ * Byte 24-27: Number of data words
+ * Byte 28-31: Stored payload length in bytes (always a multiple of 4)
+ * Byte 32-33: Compression of the payload (see Compression)
+ * Byte 34-39: Reserved
+ * Byte 40-..: Payload
+ *
+ * \endcode
+ *
+ * As all header sizes and payload lengths are multiples of 4, the payloads of uncompressed chunks can be used in place
+ * as data words (see getWords()). The reader maps the whole file read-only and builds an index of all complete chunks
+ * on construction, such that analysis code can directly seek to chunks by position, sequence number or time
+ * (see findSequence(), findTime()) and several processes reading the same file share the page cache.
+ * An incomplete last chunk (e.g. after a crash of the writing process) is ignored (see isTruncated()).
+ *
+ * Note: The mapping covers the file size at construction, i.e. chunks appended later are not visible.
+ */
+class RawDataReader
+{
+public:
+    /*!
+     * \brief Compression of a chunk payload.
+     *
+     * RawDataWriter does not compress payloads. LZ4 payloads are only produced by ReadoutPipeline::NetworkSink
+     * and can be decoded via decodeWords(). For compressed payloads the stored payload length is padded with zeros
+     * to a multiple of 4 (the padding is ignored by the decompression). Other codecs are not supported.
+     */
+    enum class Compression : std::uint16_t
+    {
+        None = 0,   ///< Uncompressed data words.
+        LZ4 = 1     ///< LZ4 block (see Auxil::compressLZ4Block()).
+    };
+
+    /*!
+     * \brief Index entry of a chunk.
+     */
+    struct ChunkInfo
+    {
+        std::uint32_t boardId;          ///< Board ID of the data source.
+        std::uint64_t sequence;         ///< Sequence number.
+        std::uint64_t timestamp;        ///< Time of writing the chunk (nanoseconds since Unix epoch).
+        std::uint32_t numWords;         ///< Number of data words.
+        std::uint32_t payloadSize;      ///< Stored payload length in bytes.
+        Compression compression;        ///< Compression of the payload.
+        std::uint64_t offset;           ///< Byte offset of the chunk header in the file.
+    };
+
+public:
+    explicit RawDataReader(const std::string& pFilePath);           ///< Constructor.
+    RawDataReader(const RawDataReader&) = delete;                   ///< Deleted copy constructor.
+    RawDataReader(RawDataReader&&) = delete;                        ///< Deleted move constructor.
+    ~RawDataReader();                                               ///< Destructor.
+    //
+    RawDataReader& operator=(RawDataReader) = delete;               ///< Deleted copy assignment operator.
+    RawDataReader& operator=(RawDataReader&&) = delete;             ///< Deleted move assignment operator.
+    //
+    const std::string& getFilePath() const;                         ///< Get the path of the file.
+    std::uint64_t getCreationTime() const;                          ///< Get the creation time of the file.
+    std::uint64_t getValidSize() const;                             ///< Get the file size covered by the header and complete chunks.
+    bool isTruncated() const;                                       ///< Check if the file ends with an incomplete chunk.
+    //
+    std::size_t getNumChunks() const;                               ///< Get the number of complete chunks.
+    std::uint64_t getNumWords() const;                              ///< Get the total number of data words of all chunks.
+    const std::vector<ChunkInfo>& getIndex() const;                 ///< Get the index of all complete chunks.
+    const ChunkInfo& getChunkInfo(std::size_t pIdx) const;          ///< Get the index entry of a chunk.
+    std::size_t findSequence(std::uint32_t pBoardId, std::uint64_t pSequence) const;
+                                                                    ///< Find the chunk with a certain board ID and sequence number.
+    std::size_t findTime(std::uint64_t pTimestamp) const;           ///< Find the first chunk written at or after a certain time.
+    //
+    std::span<const std::uint8_t> getPayload(std::size_t pIdx) const;  ///< Get a view of the stored payload of a chunk.
+    std::span<const std::uint32_t> getWords(std::size_t pIdx) const;   ///< Get a view of the data words of an uncompressed chunk.
+    std::vector<std::uint32_t> decodeWords(std::size_t pIdx) const;    ///< Get a copy of the (decompressed) data words of a chunk.
+
+public:
+    static constexpr std::uint32_t fileMagic = 0x46445243u;         ///< File header magic number ("CRDF" in little endian).
+    static constexpr std::uint32_t chunkMagic = 0x43445243u;        ///< Chunk header magic number ("CRDC" in little endian).
+    static constexpr std::uint32_t formatVersion = 1;               ///< Version of the file format.
+    static constexpr std::size_t fileHeaderSize = 32;               ///< Size of the file header in bytes.
+    static constexpr std::size_t chunkHeaderSize = 40;              ///< Size of the chunk header in bytes.
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);  ///< Chunk index returned if no chunk was found.
+
+private:
+    struct MappedFile;                                              ///< Read-only mapping of the file.
+    //
+    const std::string filePath;                                     ///< Path of the file.
+    const std::unique_ptr<MappedFile> mappedFile;                   ///< Mapping of the file.
+    std::uint64_t creationTime;                                     ///< Creation time from the file header.
+    std::uint64_t validSize;                                        ///< File size covered by the header and complete chunks.
+    bool truncated;                                                 ///< Flags an incomplete chunk at the end.
+    std::uint64_t numWords;                                         ///< Total number of data words.
+    std::vector<ChunkInfo> index;                                   ///< Index of the complete chunks.
+};
+
+/*!
+ * \brief High-throughput writer for raw FIFO data files (see RawDataReader for the format).
+ *
+ * Appends chunks of FIFO data words to a raw data file (see writeChunk()). The chunks are collected in a write buffer
+ * that is handed over to a background thread whenever it is full, such that the calling (readout) thread never waits
+ * for the disk unless all buffers are in use. The background thread writes each buffer with a single unbuffered write,
+ * cut such that every write ends at a multiple of \ref writeAlignment bytes in the file (the remainder is carried over
+ * to the next buffer), i.e. the file is written with large, block-aligned writes. The buffers are reused.
+ *
+ * An existing file is continued: its header is validated, an incomplete last chunk is cut off and the sequence numbers
+ * continue after the last chunk of the same board ID.
+ *
+ * Errors of the background thread are reported by the next call of writeChunk(), flush() or close().
+ *
+ * Note: The writing functions are not thread-safe and must not be called concurrently. getStatistics() can be called from any thread.
+ */
+class RawDataWriter
+{
+public:
+    /*!
+     * \brief Snapshot of the writer counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t chunksWritten;    ///< Number of chunks passed to writeChunk().
+        std::uint64_t wordsWritten;     ///< Number of data words passed to writeChunk().
+        std::uint64_t bytesWritten;     ///< Number of bytes written to the file by the background thread.
+        std::uint64_t fileWrites;       ///< Number of write operations of the background thread.
+        std::uint64_t bufferStalls;     ///< Number of times writeChunk() had to wait for a free buffer.
+    };
+
+public:
+    RawDataWriter(std::string pFilePath, std::uint32_t pBoardId, std::size_t pBufferSize = 4194304, std::size_t pNumBuffers = 4);
+                                                                    ///< Constructor.
+    RawDataWriter(const RawDataWriter&) = delete;                   ///< Deleted copy constructor.
+    RawDataWriter(RawDataWriter&&) = delete;                        ///< Deleted move constructor.
+    ~RawDataWriter();                                               ///< Destructor.
+    //
+    RawDataWriter& operator=(RawDataWriter) = delete;               ///< Deleted copy assignment operator.
+    RawDataWriter& operator=(RawDataWriter&&) = delete;             ///< Deleted move assignment operator.
+    //
+    const std::string& getFilePath() const;                         ///< Get the path of the file.
+    std::uint32_t getBoardId() const;                               ///< Get the board ID written to the chunks.
+    std::uint64_t getNextSequence() const;                          ///< Get the sequence number of the next chunk.
+    bool isOpen() const;                                            ///< Check if the file is open.
+    //
+    void writeChunk(std::span<const std::uint32_t> pWords);         ///< Append a chunk of data words.
+    void writeChunk(std::span<const std::uint8_t> pBytes);          ///< Append a chunk of data words given as little endian bytes.
+    void flush();                                                   ///< Write all appended chunks to the file.
+    void close();                                                   ///< Write all appended chunks and close the file.
+    //
+    Statistics getStatistics() const;                               ///< Get the current writer counters.
+
+public:
+    static constexpr std::size_t writeAlignment = 4096;             ///< File offset alignment of the ends of the buffer writes.
+
+private:
+    void appendChunkHeader(std::size_t pNumWords);                  ///< Append a chunk header to the current buffer.
+    void finishChunk(std::size_t pNumWords);                        ///< Update the counters and hand over the buffer if full.
+    void handOverBuffer(bool pAll);                                 ///< Pass the current buffer to the background thread.
+    void throwOnWriteError() const;                                 ///< Throw if the background thread failed to write.
+    void run();                                                     ///< Write handed over buffers until stopped.
+
+private:
+    const std::string filePath;                                     ///< Path of the file.
+    const std::uint32_t boardId;                                    ///< Board ID written to the chunks.
+    const std::size_t bufferSize;                                   ///< Buffer fill level that triggers the hand-over.
+    //
+    std::ofstream file;                                             ///< The file (used by the background thread while open).
+    bool open;                                                      ///< Flags that the file is open.
+    std::uint64_t nextSequence;                                     ///< Sequence number of the next chunk.
+    std::uint64_t fileOffset;                                       ///< File size including all handed over buffers.
+    std::vector<std::uint8_t> currentBuffer;                        ///< Buffer currently being filled.
+    //
+    std::thread writeThread;                                        ///< Thread that writes the buffers.
+    std::deque<std::vector<std::uint8_t>> pendingBuffers;           ///< Buffers waiting to be written.
+    std::vector<std::vector<std::uint8_t>> freeBuffers;             ///< Buffers available for reuse.
+    bool writing;                                                   ///< Flags that the background thread is writing a buffer.
+    bool stopRequested;                                             ///< Flags the background thread to exit.
+    std::string writeError;                                         ///< Error message of a failed write (empty if none).
+    Statistics statistics;                                          ///< Current counters.
+    mutable std::mutex mutex;                                       ///< Mutex for the state shared with the background thread.
+    std::condition_variable writeCondVar;                           ///< Condition variable to wake the background thread.
+    std::condition_variable doneCondVar;                            ///< Condition variable to wake threads waiting for written buffers.
+};
+
+/*!
+ * \brief Receiver for raw FIFO data streams forwarded via %TCP by ReadoutPipeline::NetworkSink.
+ *
+ * A raw data stream uses the format of raw data files (see RawDataReader), i.e. a file header followed by chunks,
+ * whose payloads may be LZ4-compressed (see RawDataReader::Compression). The receiver starts listening for connections
+ * on construction. Each call of receive() or receiveToFile() accepts one connection and processes the stream until the
+ * sender closes the connection. The chunks are decompressed and keep their board ID, sequence number and timestamp,
+ * i.e. receiveToFile() reconstructs the raw data file that a RawDataWriter on the sending side would have written.
+ *
+ * Note: The receiving functions block and are not thread-safe.
+ */
+class RawDataReceiver
+{
+public:
+    using ChunkHandlerType = std::function<void(const RawDataReader::ChunkInfo&, std::span<const std::uint32_t>)>;
+                                                                    ///< Function type for received chunks (stream index entry and data words).
+
+    /*!
+     * \brief Counters of a received stream (see receive()).
+     */
+    struct Statistics
+    {
+        std::uint64_t chunksReceived;   ///< Number of received chunks.
+        std::uint64_t wordsReceived;    ///< Number of received (decompressed) data words.
+        std::uint64_t bytesReceived;    ///< Number of received stream bytes (including headers and compressed payloads).
+        std::uint64_t compressedChunks; ///< Number of received chunks with compressed payload.
+    };
+
+public:
+    explicit RawDataReceiver(std::uint16_t pPort, const std::string& pAddress = "0.0.0.0",
+                             std::size_t pMaxChunkSize = defaultMaxChunkSize);  ///< Constructor.
+    RawDataReceiver(const RawDataReceiver&) = delete;               ///< Deleted copy constructor.
+    RawDataReceiver(RawDataReceiver&&) = delete;                    ///< Deleted move constructor.
+    ~RawDataReceiver();                                             ///< Destructor.
+    //
+    RawDataReceiver& operator=(RawDataReceiver) = delete;           ///< Deleted copy assignment operator.
+    RawDataReceiver& operator=(RawDataReceiver&&) = delete;         ///< Deleted move assignment operator.
+    //
+    std::uint16_t getPort() const;                                  ///< Get the listening port.
+    //
+    Statistics receive(const ChunkHandlerType& pHandler);           ///< Receive a stream and pass its chunks to a function.
+    Statistics receiveToFile(const std::string& pFilePath);         ///< Receive a stream and write it to a raw data file.
+
+public:
+    static constexpr std::size_t defaultMaxChunkSize = 268435456;   ///< Default maximum size of a received chunk in bytes (see RawDataReceiver()).
+
+private:
+    Statistics receiveStream(const std::function<void(std::uint64_t)>& pHeaderHandler, const ChunkHandlerType& pChunkHandler);
+                                                                    ///< Accept a connection and process the received stream.
+
+private:
+    const std::size_t maxChunkSize;                                 ///< Maximum size of a received chunk in bytes.
+    //
+    struct Acceptor;                                                ///< Listening %TCP socket.
+    const std::unique_ptr<Acceptor> acceptor;                       ///< The listening socket.
+};
+
+} // namespace casil
+
+#endif // CASIL_RAWDATAFILE_H
@@ -0,0 +1,980 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/readoutpipeline.h>
+
+#include <casil/auxil.h>
+#include <casil/bytes.h>
+#include <casil/logger.h>
+#include <casil/onlinehistograms.h>
+#include <casil/rawdatafile.h>
+#include <casil/HL/Muxed/sitcpfifo.h>
+#include <casil/TL/Direct/udpring.h>
+#include <casil/TL/CommonImpl/fifofilewriter.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/write.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+using casil::ReadoutPipeline;
+
+namespace
+{
+
+/*
+ * Block of a source, as passed between the stages.
+ */
+struct QueueItem
+{
+    std::size_t sourceIndex;
+    ReadoutPipeline::BlockType block;
+};
+
+/*
+ * Blocking FIFO queue with fixed capacity. Once closed, push() fails and pop() fails as soon as the queue is empty.
+ */
+class BoundedQueue
+{
+public:
+    explicit BoundedQueue(const std::size_t pCapacity) :
+        capacity(pCapacity),
+        closed(false)
+    {
+    }
+    //
+    bool push(QueueItem pItem, std::atomic<std::uint64_t> *const pStallCounter)
+    {
+        std::unique_lock<std::mutex> queueLock(mutex);
+
+        if (items.size() >= capacity && !closed)
+        {
+            if (pStallCounter != nullptr)
+                ++(*pStallCounter);
+
+            notFullCondVar.wait(queueLock, [this]() -> bool { return items.size() < capacity || closed; });
+        }
+
+        if (closed)
+            return false;
+
+        items.push_back(std::move(pItem));
+
+        queueLock.unlock();
+        notEmptyCondVar.notify_one();
+
+        return true;
+    }
+    std::optional<QueueItem> pop()
+    {
+        std::unique_lock<std::mutex> queueLock(mutex);
+
+        notEmptyCondVar.wait(queueLock, [this]() -> bool { return !items.empty() || closed; });
+
+        if (items.empty())
+            return std::nullopt;
+
+        QueueItem item = std::move(items.front());
+        items.pop_front();
+
+        queueLock.unlock();
+        notFullCondVar.notify_one();
+
+        return item;
+    }
+    void close()
+    {
+        {
+            const std::lock_guard<std::mutex> queueLock(mutex);
+            (void)queueLock;
+
+            closed = true;
+        }
+
+        notEmptyCondVar.notify_all();
+        notFullCondVar.notify_all();
+    }
+
+private:
+    const std::size_t capacity;
+    std::deque<QueueItem> items;
+    bool closed;
+    std::mutex mutex;
+    std::condition_variable notEmptyCondVar;
+    std::condition_variable notFullCondVar;
+};
+
+} // namespace
+
+//
+
+/*!
+ * \brief Queues, threads and counters of a running pipeline.
+ */
+struct ReadoutPipeline::Runtime
+{
+    Runtime(const std::size_t pQueueCapacity, const std::size_t pNumSinks) :
+        decoderQueue(pQueueCapacity),
+        stopSources(false),
+        blocksRead(0),
+        wordsRead(0),
+        blocksDropped(0),
+        sourceStalls(0),
+        stageErrors(0)
+    {
+        for (std::size_t i = 0; i < pNumSinks; ++i)
+            sinkQueues.push_back(std::make_unique<BoundedQueue>(pQueueCapacity));
+    }
+    //
+    Statistics getStatistics() const
+    {
+        return {.blocksRead = blocksRead.load(), .wordsRead = wordsRead.load(), .blocksDropped = blocksDropped.load(),
+                .sourceStalls = sourceStalls.load(), .stageErrors = stageErrors.load()};
+    }
+    //
+    BoundedQueue decoderQueue;                                  ///< Queue from the sources to the decoder.
+    std::vector<std::unique_ptr<BoundedQueue>> sinkQueues;      ///< Queues from the decoder to the sinks.
+    //
+    std::atomic_bool stopSources;                               ///< Flags the source threads to exit.
+    std::mutex stopMutex;                                       ///< Mutex for \ref stopCondVar.
+    std::condition_variable stopCondVar;                        ///< Condition variable to wake idle source threads for stopping.
+    //
+    std::vector<std::thread> sourceThreads;                     ///< Threads running the sources.
+    std::thread decoderThread;                                  ///< Thread running the decoder.
+    std::vector<std::thread> sinkThreads;                       ///< Threads running the sinks.
+    //
+    std::atomic<std::uint64_t> blocksRead;                      ///< \copydoc Statistics::blocksRead
+    std::atomic<std::uint64_t> wordsRead;                       ///< \copydoc Statistics::wordsRead
+    std::atomic<std::uint64_t> blocksDropped;                   ///< \copydoc Statistics::blocksDropped
+    std::atomic<std::uint64_t> sourceStalls;                    ///< \copydoc Statistics::sourceStalls
+    std::atomic<std::uint64_t> stageErrors;                     ///< \copydoc Statistics::stageErrors
+};
+
+/*!
+ * \brief Wrapper around the used file writer implementation.
+ */
+struct ReadoutPipeline::RawFileSink::Writer
+{
+    Writer(std::string pBasePath, const std::size_t pBlockSize, const std::uint64_t pMaxFileSize, const MemoryPlacement pPlacement) :
+        fileWriter(std::move(pBasePath), pBlockSize, pMaxFileSize, pPlacement)
+    {
+    }
+    //
+    Layers::TL::CommonImpl::FIFOFileWriter fileWriter;          ///< Block-buffered chunk file writer.
+};
+
+/*!
+ * \brief %TCP connection to the receiver.
+ */
+struct ReadoutPipeline::NetworkSink::Connection
+{
+    Connection() :
+        ioContext(1),
+        socket(ioContext)
+    {
+    }
+    //
+    boost::asio::io_context ioContext;              ///< Private IO context for the blocking socket operations.
+    boost::asio::ip::tcp::socket socket;            ///< The connected socket.
+};
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * \throws std::invalid_argument If \p pQueueCapacity is zero or \p pPollInterval is not positive.
+ *
+ * \param pQueueCapacity Maximum number of blocks in each of the queues between the stages.
+ * \param pPollInterval Time a source waits before reading again after it returned no data.
+ */
+ReadoutPipeline::ReadoutPipeline(const std::size_t pQueueCapacity, const std::chrono::microseconds pPollInterval) :
+    queueCapacity(pQueueCapacity),
+    pollInterval(pPollInterval),
+    sources(),
+    decoder(),
+    sinks(),
+    runtime(),
+    lastStatistics{}
+{
+    if (queueCapacity == 0)
+        throw std::invalid_argument("Queue capacity of readout pipeline must be positive.");
+
+    if (pollInterval <= std::chrono::microseconds::zero())
+        throw std::invalid_argument("Poll interval of readout pipeline must be positive.");
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops the pipeline (see stop()).
+ */
+ReadoutPipeline::~ReadoutPipeline()
+{
+    try
+    {
+        stop();
+    }
+    catch (const std::exception& exc)
+    {
+        Logger::logError(std::string("Exception while stopping readout pipeline: ") + exc.what());
+    }
+}
+
+//Public
+
+/*!
+ * \brief Add a data source.
+ *
+ * \throws std::invalid_argument If \p pSource is null.
+ * \throws std::runtime_error If the pipeline is running.
+ *
+ * \param pSource The source.
+ * \return Index of the source, as passed to Decoder::decode() and Sink::consume().
+ */
+std::size_t ReadoutPipeline::addSource(std::unique_ptr<Source> pSource)
+{
+    if (!pSource)
+        throw std::invalid_argument("Cannot add null source to readout pipeline.");
+
+    if (isRunning())
+        throw std::runtime_error("Cannot add source to running readout pipeline.");
+
+    sources.push_back(std::move(pSource));
+
+    return sources.size() - 1;
+}
+
+/*!
+ * \brief Set the decoder stage.
+ *
+ * Without decoder (the default) the source blocks are passed to the sinks unchanged.
+ *
+ * \throws std::runtime_error If the pipeline is running.
+ *
+ * \param pDecoder The decoder (or null to remove the decoder).
+ */
+void ReadoutPipeline::setDecoder(std::unique_ptr<Decoder> pDecoder)
+{
+    if (isRunning())
+        throw std::runtime_error("Cannot set decoder of running readout pipeline.");
+
+    decoder = std::move(pDecoder);
+}
+
+/*!
+ * \brief Add a data sink.
+ *
+ * \throws std::invalid_argument If \p pSink is null.
+ * \throws std::runtime_error If the pipeline is running.
+ *
+ * \param pSink The sink.
+ */
+void ReadoutPipeline::addSink(std::unique_ptr<Sink> pSink)
+{
+    if (!pSink)
+        throw std::invalid_argument("Cannot add null sink to readout pipeline.");
+
+    if (isRunning())
+        throw std::runtime_error("Cannot add sink to running readout pipeline.");
+
+    sinks.push_back(std::move(pSink));
+}
+
+//
+
+/*!
+ * \brief Start the stage threads.
+ *
+ * Opens all sinks (see Sink::open()) and starts one thread for every source, one for the decoder and one for every sink.
+ * Resets the counters (see getStatistics()). Does nothing if already running.
+ *
+ * Exceptions thrown by the stages while running are logged and counted (see Statistics::stageErrors);
+ * a block for which the decoder throws is dropped.
+ *
+ * \throws std::runtime_error If there are no sources or no sinks.
+ * \throws std::runtime_error If opening a sink throws \c std::runtime_error.
+ */
+void ReadoutPipeline::start()
+{
+    if (isRunning())
+        return;
+
+    if (sources.empty() || sinks.empty())
+        throw std::runtime_error("Readout pipeline needs at least one source and one sink.");
+
+    for (std::size_t i = 0; i < sinks.size(); ++i)
+    {
+        try
+        {
+            sinks[i]->open();
+        }
+        catch (const std::runtime_error& exc)
+        {
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                try { sinks[j]->close(); }
+                catch (const std::runtime_error&) {}
+            }
+
+            throw std::runtime_error(std::string("Could not open sink of readout pipeline: ") + exc.what());
+        }
+    }
+
+    runtime = std::make_unique<Runtime>(queueCapacity, sinks.size());
+
+    Runtime& rt = *runtime;
+
+    for (std::size_t i = 0; i < sinks.size(); ++i)
+    {
+        rt.sinkThreads.emplace_back([&rt, &sink = *sinks[i], &queue = *rt.sinkQueues[i]]() -> void
+                                    {
+                                        while (std::optional<QueueItem> item = queue.pop())
+                                        {
+                                            try
+                                            {
+                                                sink.consume(item->sourceIndex, *item->block);
+                                            }
+                                            catch (const std::exception& exc)
+                                            {
+                                                ++rt.stageErrors;
+                                                Logger::logError(std::string("Readout pipeline sink failed: ") + exc.what());
+                                            }
+                                        }
+                                    });
+    }
+
+    rt.decoderThread = std::thread([&rt, tDecoder = decoder.get()]() -> void
+                                   {
+                                       while (std::optional<QueueItem> item = rt.decoderQueue.pop())
+                                       {
+                                           BlockType block = std::move(item->block);
+
+                                           if (tDecoder != nullptr)
+                                           {
+                                               try
+                                               {
+                                                   block = tDecoder->decode(item->sourceIndex, std::move(block));
+                                               }
+                                               catch (const std::exception& exc)
+                                               {
+                                                   ++rt.stageErrors;
+                                                   Logger::logError(std::string("Readout pipeline decoder failed: ") + exc.what());
+                                                   block.reset();
+                                               }
+                                           }
+
+                                           if (!block || block->empty())
+                                           {
+                                               ++rt.blocksDropped;
+                                               continue;
+                                           }
+
+                                           for (const std::unique_ptr<BoundedQueue>& queue : rt.sinkQueues)
+                                               (void)queue->push({item->sourceIndex, block}, nullptr);
+                                       }
+
+                                       for (const std::unique_ptr<BoundedQueue>& queue : rt.sinkQueues)
+                                           queue->close();
+                                   });
+
+    for (std::size_t i = 0; i < sources.size(); ++i)
+    {
+        rt.sourceThreads.emplace_back([&rt, &source = *sources[i], i, tPollInterval = pollInterval]() -> void
+                                      {
+                                          while (!rt.stopSources.load())
+                                          {
+                                              BlockType block;
+
+                                              try
+                                              {
+                                                  block = source.read();
+                                              }
+                                              catch (const std::exception& exc)
+                                              {
+                                                  ++rt.stageErrors;
+                                                  Logger::logError(std::string("Readout pipeline source failed: ") + exc.what());
+                                              }
+
+                                              if (!block || block->empty())
+                                              {
+                                                  std::unique_lock<std::mutex> stopLock(rt.stopMutex);
+                                                  rt.stopCondVar.wait_for(stopLock, tPollInterval,
+                                                                          [&rt]() -> bool { return rt.stopSources.load(); });
+                                                  continue;
+                                              }
+
+                                              ++rt.blocksRead;
+                                              rt.wordsRead += block->size();
+
+                                              (void)rt.decoderQueue.push({i, std::move(block)}, &rt.sourceStalls);
+                                          }
+                                      });
+    }
+}
+
+/*!
+ * \brief Stop reading, drain all queues and stop the stage threads.
+ *
+ * Stops the sources, waits until all blocks read so far have passed the decoder and all sinks,
+ * joins all threads and closes all sinks (see Sink::close()). Does nothing if not running.
+ *
+ * \throws std::runtime_error If closing a sink throws \c std::runtime_error (after all sinks were closed).
+ */
+void ReadoutPipeline::stop()
+{
+    if (!isRunning())
+        return;
+
+    Runtime& rt = *runtime;
+
+    {
+        const std::lock_guard<std::mutex> stopLock(rt.stopMutex);
+        (void)stopLock;
+
+        rt.stopSources.store(true);
+    }
+
+    rt.stopCondVar.notify_all();
+
+    for (std::thread& thread : rt.sourceThreads)
+        thread.join();
+
+    rt.decoderQueue.close();
+    rt.decoderThread.join();
+
+    for (std::thread& thread : rt.sinkThreads)
+        thread.join();
+
+    lastStatistics = rt.getStatistics();
+    runtime.reset();
+
+    std::string closeErrors;
+
+    for (const std::unique_ptr<Sink>& sink : sinks)
+    {
+        try
+        {
+            sink->close();
+        }
+        catch (const std::runtime_error& exc)
+        {
+            closeErrors += (closeErrors.empty() ? "" : "; ") + std::string(exc.what());
+        }
+    }
+
+    if (!closeErrors.empty())
+        throw std::runtime_error("Could not close sink(s) of readout pipeline: " + closeErrors);
+}
+
+/*!
+ * \brief Check if the pipeline is running.
+ *
+ * \return True if started and not stopped yet.
+ */
+bool ReadoutPipeline::isRunning() const
+{
+    return static_cast<bool>(runtime);
+}
+
+//
+
+/*!
+ * \brief Get the current pipeline counters.
+ *
+ * Returns the counters of the current run or, if not running, the final counters of the last run.
+ * While running, the counters are updated atomically but independently of each other.
+ *
+ * \return Current statistics.
+ */
+ReadoutPipeline::Statistics ReadoutPipeline::getStatistics() const
+{
+    if (runtime)
+        return runtime->getStatistics();
+    else
+        return lastStatistics;
+}
+
+//
+
+/*!
+ * \brief Prepare for a pipeline run (called by start()).
+ *
+ * Does nothing (override for specific sinks if needed).
+ *
+ * \throws std::runtime_error May be thrown by derived sinks to abort start().
+ */
+void ReadoutPipeline::Sink::open()
+{
+}
+
+/*!
+ * \brief Finish a pipeline run (called by stop()).
+ *
+ * Does nothing (override for specific sinks if needed).
+ *
+ * \throws std::runtime_error May be thrown by derived sinks.
+ */
+void ReadoutPipeline::Sink::close()
+{
+}
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * \param pFifo The FIFO driver to read from.
+ */
+ReadoutPipeline::SiTCPFifoSource::SiTCPFifoSource(Layers::HL::SiTCPFifo& pFifo) :
+    fifo(pFifo)
+{
+}
+
+/*!
+ * \brief Read the current FIFO content.
+ *
+ * \throws std::runtime_error If HL::SiTCPFifo::getFifoDataBlock() throws \c std::runtime_error.
+ *
+ * \return Current FIFO data words (see HL::SiTCPFifo::getFifoDataBlock()).
+ */
+ReadoutPipeline::BlockType ReadoutPipeline::SiTCPFifoSource::read()
+{
+    return fifo.getFifoDataBlock();
+}
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * \param pInterface The packet ring interface to read from.
+ */
+ReadoutPipeline::UDPRingSource::UDPRingSource(Layers::TL::UDPRing& pInterface) :
+    ringInterface(pInterface),
+    partialWord{},
+    partialWordSize(0)
+{
+}
+
+/*!
+ * \brief Read all available datagrams.
+ *
+ * Waits briefly (10ms) for new datagrams if none are available, such that the source thread is
+ * woken up by incoming data rather than by the poll interval (see ReadoutPipeline()).
+ *
+ * \throws std::runtime_error If TL::UDPRing::consumeDatagrams() throws \c std::runtime_error.
+ *
+ * \return Data words of all available datagram payloads (null if none).
+ */
+ReadoutPipeline::BlockType ReadoutPipeline::UDPRingSource::read()
+{
+    std::vector<std::uint32_t> words;
+
+    const auto appendPayload = [this, &words](std::span<const std::uint8_t> pPayload) -> void
+                               {
+                                   if (partialWordSize > 0)
+                                   {
+                                       const std::size_t numBytes = std::min(4 - partialWordSize, pPayload.size());
+
+                                       std::copy_n(pPayload.begin(), numBytes, partialWord.begin() + partialWordSize);
+                                       partialWordSize += numBytes;
+                                       pPayload = pPayload.subspan(numBytes);
+
+                                       if (partialWordSize < 4)
+                                           return;
+
+                                       words.push_back(0);
+                                       Bytes::decodeUInt32LE(partialWord, std::span<std::uint32_t>(&words.back(), 1));
+                                       partialWordSize = 0;
+                                   }
+
+                                   const std::size_t numWords = pPayload.size() / 4;
+                                   const std::size_t oldSize = words.size();
+
+                                   words.resize(oldSize + numWords);
+                                   Bytes::decodeUInt32LE(pPayload.first(numWords * 4), std::span<std::uint32_t>(words).subspan(oldSize));
+
+                                   partialWordSize = pPayload.size() - numWords * 4;
+                                   std::copy_n(pPayload.begin() + numWords * 4, partialWordSize, partialWord.begin());
+                               };
+
+    if (ringInterface.consumeDatagrams(appendPayload, std::chrono::milliseconds(10)) == 0 || words.empty())
+        return nullptr;
+
+    return std::make_shared<const std::vector<std::uint32_t>>(std::move(words));
+}
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * See also \ref casil::TL::SiTCP::SiTCP() "SiTCP::SiTCP()" for the meaning of the file parameters.
+ *
+ * \throws std::invalid_argument If \p pBasePath is empty.
+ * \throws std::invalid_argument If \p pBlockSize is smaller than 4 bytes.
+ *
+ * \param pBasePath Base path of the output files (will be suffixed by a running file index).
+ * \param pBlockSize Buffer size in bytes, i.e. payload length of the written file chunks.
+ * \param pMaxFileSize Maximum size of an output file in bytes (no limit if zero).
+ * \param pSourceIndex Only write blocks from the source with this index (all sources if negative).
+ * \param pPlacement Huge page and NUMA node options for the block buffer (e.g. the node of the CPU running the pipeline).
+ */
+ReadoutPipeline::RawFileSink::RawFileSink(std::string pBasePath, const std::size_t pBlockSize, const std::uint64_t pMaxFileSize,
+                                          const int pSourceIndex, const MemoryPlacement pPlacement) :
+    writer(std::make_unique<Writer>(std::move(pBasePath), pBlockSize, pMaxFileSize, pPlacement)),
+    sourceIndex(pSourceIndex),
+    byteBuffer()
+{
+}
+
+/*!
+ * \brief Destructor.
+ */
+ReadoutPipeline::RawFileSink::~RawFileSink() = default;
+
+/*!
+ * \brief Open a new output file.
+ *
+ * \throws std::runtime_error If opening the file fails.
+ */
+void ReadoutPipeline::RawFileSink::open()
+{
+    writer->fileWriter.open();
+}
+
+/*!
+ * \brief Write the data words to the file.
+ *
+ * Writes \p pWords in little endian byte order (if \p pSourceIndex matches the configured source index).
+ *
+ * \throws std::runtime_error If writing to the file fails.
+ *
+ * \param pSourceIndex Index of the source of \p pWords.
+ * \param pWords Data words to write.
+ */
+void ReadoutPipeline::RawFileSink::consume(const std::size_t pSourceIndex, const std::span<const std::uint32_t> pWords)
+{
+    if (sourceIndex >= 0 && pSourceIndex != static_cast<std::size_t>(sourceIndex))
+        return;
+
+    byteBuffer.resize(pWords.size() * 4);
+
+    Bytes::encodeUInt32LE(pWords, byteBuffer);
+
+    writer->fileWriter.write(byteBuffer);
+}
+
+/*!
+ * \brief Flush and close the output file.
+ *
+ * \throws std::runtime_error If writing or closing the file fails.
+ */
+void ReadoutPipeline::RawFileSink::close()
+{
+    writer->fileWriter.close();
+}
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * \throws std::invalid_argument If \p pHost is empty or \p pPort is zero.
+ *
+ * \param pHost Host name or address of the receiver.
+ * \param pPort Port of the receiver.
+ * \param pCompress Compress the payloads with LZ4.
+ * \param pBatchSize Minimum number of bytes to collect before sending (zero to send every block immediately).
+ * \param pSourceIndex Only send blocks from the source with this index (all sources if negative).
+ */
+ReadoutPipeline::NetworkSink::NetworkSink(std::string pHost, const std::uint16_t pPort, const bool pCompress, const std::size_t pBatchSize,
+                                          const int pSourceIndex) :
+    connection(std::make_unique<Connection>()),
+    host(std::move(pHost)),
+    port(pPort),
+    compress(pCompress),
+    batchSize(pBatchSize),
+    sourceIndex(pSourceIndex),
+    nextSequences(),
+    batchBuffer(),
+    byteBuffer(),
+    compressedBuffer()
+{
+    if (host == "")
+        throw std::invalid_argument("Empty host name for readout pipeline network sink.");
+
+    if (port == 0)
+        throw std::invalid_argument("Invalid port for readout pipeline network sink.");
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Closes the connection without sending the remaining batched chunks (see close()).
+ */
+ReadoutPipeline::NetworkSink::~NetworkSink() = default;
+
+/*!
+ * \brief Connect to the receiver and start a new stream.
+ *
+ * Closes a remaining previous connection, connects to the receiver and resets the sequence numbers.
+ * The stream header is sent together with the first batch.
+ *
+ * \throws std::runtime_error If connecting fails.
+ */
+void ReadoutPipeline::NetworkSink::open()
+{
+    boost::system::error_code errorCode;
+    connection->socket.close(errorCode);
+
+    try
+    {
+        boost::asio::ip::tcp::resolver resolver(connection->ioContext);
+        boost::asio::connect(connection->socket, resolver.resolve(host, std::to_string(port)));
+
+        //Batching is done here already
+        connection->socket.set_option(boost::asio::ip::tcp::no_delay(true));
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        connection->socket.close(errorCode);
+        throw std::runtime_error("Could not connect readout pipeline network sink to " + host + ":" + std::to_string(port) + ": " + exc.what());
+    }
+
+    nextSequences.clear();
+    batchBuffer.clear();
+
+    const std::uint64_t creationTime = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                                      std::chrono::system_clock::now().time_since_epoch()).count());
+
+    Bytes::composeBytesTo(std::back_inserter(batchBuffer), false, RawDataReader::fileMagic, RawDataReader::formatVersion, creationTime,
+                          std::uint64_t{0}, std::uint64_t{0});
+}
+
+/*!
+ * \brief Send the data words as chunk.
+ *
+ * Creates a chunk from \p pWords (if \p pSourceIndex matches the configured source index), with LZ4-compressed payload if
+ * enabled and smaller than the uncompressed payload. Appends the chunk to the batch buffer or sends it together
+ * with the batch buffer if the batch size is reached (see NetworkSink).
+ *
+ * \throws std::runtime_error If not connected (see open()) or sending fails.
+ *
+ * \param pSourceIndex Index of the source of \p pWords.
+ * \param pWords Data words to send.
+ */
+void ReadoutPipeline::NetworkSink::consume(const std::size_t pSourceIndex, const std::span<const std::uint32_t> pWords)
+{
+    if (sourceIndex >= 0 && pSourceIndex != static_cast<std::size_t>(sourceIndex))
+        return;
+
+    if (pWords.empty())
+        return;
+
+    if (!connection->socket.is_open())
+        throw std::runtime_error("Readout pipeline network sink is not connected.");
+
+    std::span<const std::uint8_t> rawBytes;
+
+    if constexpr (std::endian::native == std::endian::little)
+        rawBytes = std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(pWords.data()), 4 * pWords.size());
+    else
+    {
+        byteBuffer.resize(4 * pWords.size());
+        Bytes::encodeUInt32LE(pWords, byteBuffer);
+        rawBytes = byteBuffer;
+    }
+
+    std::span<const std::uint8_t> payload = rawBytes;
+    RawDataReader::Compression compression = RawDataReader::Compression::None;
+
+    if (compress)
+    {
+        Auxil::compressLZ4Block(rawBytes, compressedBuffer);
+
+        //Pad to a multiple of 4 as required by the format
+        compressedBuffer.resize((compressedBuffer.size() + 3) & ~std::size_t{3}, 0);
+
+        if (compressedBuffer.size() < rawBytes.size())
+        {
+            payload = compressedBuffer;
+            compression = RawDataReader::Compression::LZ4;
+        }
+    }
+
+    if (pSourceIndex >= nextSequences.size())
+        nextSequences.resize(pSourceIndex + 1, 0);
+
+    const std::uint64_t timestamp = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                                   std::chrono::system_clock::now().time_since_epoch()).count());
+
+    std::array<std::uint8_t, RawDataReader::chunkHeaderSize> chunkHeader {};
+
+    Bytes::composeBytesTo(chunkHeader.begin(), false, RawDataReader::chunkMagic, static_cast<std::uint32_t>(pSourceIndex),
+                          nextSequences[pSourceIndex]++, timestamp, static_cast<std::uint32_t>(pWords.size()),
+                          static_cast<std::uint32_t>(payload.size()), static_cast<std::uint16_t>(compression), std::uint16_t{0},
+                          std::uint32_t{0});
+
+    if (batchBuffer.size() + chunkHeader.size() + payload.size() < batchSize)
+    {
+        batchBuffer.insert(batchBuffer.end(), chunkHeader.begin(), chunkHeader.end());
+        batchBuffer.insert(batchBuffer.end(), payload.begin(), payload.end());
+        return;
+    }
+
+    sendBatch(chunkHeader, payload);
+}
+
+/*!
+ * \brief Send the remaining batched chunks and close the connection.
+ *
+ * \throws std::runtime_error If sending fails (the connection is closed anyway).
+ */
+void ReadoutPipeline::NetworkSink::close()
+{
+    if (!connection->socket.is_open())
+        return;
+
+    boost::system::error_code errorCode;
+
+    try
+    {
+        if (!batchBuffer.empty())
+            sendBatch({}, {});
+    }
+    catch (const std::runtime_error&)
+    {
+        connection->socket.close(errorCode);
+        throw;
+    }
+
+    connection->socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, errorCode);
+    connection->socket.close(errorCode);
+}
+
+/*!
+ * \brief Send the batch buffer followed by a chunk header and payload.
+ *
+ * Sends all three parts by a single gathered write and clears the batch buffer.
+ *
+ * \throws std::runtime_error If sending fails.
+ *
+ * \param pChunkHeader Chunk header to send after the batch buffer (can be empty).
+ * \param pPayload Chunk payload to send after the chunk header (can be empty).
+ */
+void ReadoutPipeline::NetworkSink::sendBatch(const std::span<const std::uint8_t> pChunkHeader, const std::span<const std::uint8_t> pPayload)
+{
+    const std::array<boost::asio::const_buffer, 3> buffers {boost::asio::buffer(batchBuffer),
+                                                            boost::asio::buffer(pChunkHeader.data(), pChunkHeader.size()),
+                                                            boost::asio::buffer(pPayload.data(), pPayload.size())};
+
+    try
+    {
+        boost::asio::write(connection->socket, buffers);
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        throw std::runtime_error("Could not send data of readout pipeline network sink to " + host + ":" + std::to_string(port) + ": " +
+                                 exc.what());
+    }
+
+    batchBuffer.clear();
+}
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * \throws std::invalid_argument If \p pCallback is empty.
+ *
+ * \param pCallback Function to call for every block with the source index and the data words.
+ */
+ReadoutPipeline::CallbackSink::CallbackSink(CallbackType pCallback) :
+    callback(std::move(pCallback))
+{
+    if (!callback)
+        throw std::invalid_argument("Empty callback for readout pipeline sink.");
+}
+
+/*!
+ * \brief Call the function with the data words.
+ *
+ * \param pSourceIndex Index of the source of \p pWords.
+ * \param pWords Data words.
+ */
+void ReadoutPipeline::CallbackSink::consume(const std::size_t pSourceIndex, const std::span<const std::uint32_t> pWords)
+{
+    callback(pSourceIndex, pWords);
+}
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * \throws std::invalid_argument If \p pHistograms is null.
+ *
+ * \param pHistograms Histograms to fill.
+ * \param pSourceIndex Only fill blocks from the source with this index (all sources if negative).
+ */
+ReadoutPipeline::HistogramSink::HistogramSink(std::shared_ptr<OnlineHistograms> pHistograms, const int pSourceIndex) :
+    histograms(std::move(pHistograms)),
+    sourceIndex(pSourceIndex)
+{
+    if (!histograms)
+        throw std::invalid_argument("No histograms for readout pipeline sink.");
+}
+
+/*!
+ * \brief Fill the histograms with the data words.
+ *
+ * Calls OnlineHistograms::fill() with \p pWords (if \p pSourceIndex matches the configured source index).
+ *
+ * \param pSourceIndex Index of the source of \p pWords.
+ * \param pWords Data words.
+ */
+void ReadoutPipeline::HistogramSink::consume(const std::size_t pSourceIndex, const std::span<const std::uint32_t> pWords)
+{
+    if (sourceIndex >= 0 && pSourceIndex != static_cast<std::size_t>(sourceIndex))
+        return;
+
+    histograms->fill(pWords);
+}
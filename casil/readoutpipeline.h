@@ -0,0 +1,311 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_READOUTPIPELINE_H
+#define CASIL_READOUTPIPELINE_H
+
+#include <casil/memoryplacement.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::HL { class SiTCPFifo; }
+namespace Layers::TL { class UDPRing; }
+class OnlineHistograms;
+
+/*!
+ * \brief Multi-threaded readout chain from FIFO sources via an optional decoder to data sinks.
+ *
+ * Moves blocks of 32 bit FIFO data words from one or more sources (see Source, e.g. SiTCPFifoSource and UDPRingSource) through
+ * an optional Decoder to one or more sinks (see Sink, e.g. RawFileSink, NetworkSink, HistogramSink and CallbackSink), without involving
+ * the caller:
+ *
+ * \code{.unparsed}
+ *
+ * Source 0 ──┐                             ┌── queue ──> Sink 0
+ *            ├── queue ──> Decoder ────────┤
+ * Source N ──┘                             └── queue ──> Sink M
+ *
+ * \endcode
+ *
+ * Every source, the decoder and every sink run in their own thread (see start()). The stages are connected by
+ * bounded queues (see ReadoutPipeline()) that provide back-pressure: If a sink cannot keep up, its queue fills up,
+ * which blocks the decoder, which in turn blocks the sources. Blocked sources simply stop reading, i.e. the data
+ * accumulates in the (growing) FIFO buffer of the source until the sinks catch up again. Blocks are passed by
+ * reference-counted pointers, so multiple sinks share the same block and source blocks can stem from a pool
+ * (see HL::SiTCPFifo::getFifoDataBlock()).
+ *
+ * Sources, decoder and sinks can only be added while the pipeline is stopped. stop() drains all
+ * queues, i.e. every block read from a source before stopping still reaches all sinks.
+ *
+ * Note: The control functions (adding stages, start(), stop()) are not thread-safe
+ * and must not be called concurrently or from within the stages.
+ */
+class ReadoutPipeline
+{
+public:
+    using BlockType = std::shared_ptr<const std::vector<std::uint32_t>>;    ///< Block of FIFO data words.
+
+    /*!
+     * \brief Interface for pipeline stages that produce data blocks.
+     *
+     * read() is called repeatedly by the source's own thread while the pipeline is running.
+     */
+    class Source
+    {
+    public:
+        virtual ~Source() = default;                        ///< Default destructor.
+        //
+        virtual BlockType read() = 0;                       ///< \brief Read the currently available data
+                                                            ///  (return null or empty block if none available).
+    };
+
+    /*!
+     * \brief Interface for the pipeline stage that transforms blocks between sources and sinks.
+     *
+     * decode() is called for every source block, in order per source, always from the same thread.
+     */
+    class Decoder
+    {
+    public:
+        virtual ~Decoder() = default;                       ///< Default destructor.
+        //
+        virtual BlockType decode(std::size_t pSourceIndex, BlockType pBlock) = 0;
+                                                            ///< \brief Transform a block from a source
+                                                            ///  (return null or empty block to drop it).
+    };
+
+    /*!
+     * \brief Interface for pipeline stages that consume data blocks.
+     *
+     * All functions are called from the sink's own thread.
+     */
+    class Sink
+    {
+    public:
+        virtual ~Sink() = default;                          ///< Default destructor.
+        //
+        virtual void open();                                ///< Prepare for a pipeline run (called by start()).
+        virtual void consume(std::size_t pSourceIndex, std::span<const std::uint32_t> pWords) = 0;
+                                                            ///< Process a block of data words from a source.
+        virtual void close();                               ///< Finish a pipeline run (called by stop()).
+    };
+
+    /*!
+     * \brief Source that reads the \ref casil::TL::SiTCP "SiTCP" FIFO via an HL::SiTCPFifo driver.
+     *
+     * Uses the pooled blocks from HL::SiTCPFifo::getFifoDataBlock(). The driver must outlive the source.
+     */
+    class SiTCPFifoSource final : public Source
+    {
+    public:
+        explicit SiTCPFifoSource(Layers::HL::SiTCPFifo& pFifo);  ///< Constructor.
+        //
+        BlockType read() override;                          ///< Read the current FIFO content.
+
+    private:
+        Layers::HL::SiTCPFifo& fifo;                        ///< The used FIFO driver.
+    };
+
+    /*!
+     * \brief Source that reads a %UDP data stream from the packet ring of a \ref casil::TL::UDPRing "UDPRing" interface.
+     *
+     * Concatenates the payloads of all available datagrams (see TL::UDPRing::consumeDatagrams()) to little endian
+     * 32 bit data words. Bytes of an incomplete trailing word are kept for the next block. The interface must outlive the source.
+     */
+    class UDPRingSource final : public Source
+    {
+    public:
+        explicit UDPRingSource(Layers::TL::UDPRing& pInterface);    ///< Constructor.
+        //
+        BlockType read() override;                          ///< Read all available datagrams.
+
+    private:
+        Layers::TL::UDPRing& ringInterface;                 ///< The used interface.
+        std::array<std::uint8_t, 4> partialWord;            ///< Leftover bytes of an incomplete data word.
+        std::size_t partialWordSize;                        ///< Number of leftover bytes in \ref partialWord.
+    };
+
+    /*!
+     * \brief Sink that writes the raw data words to a sequence of chunked binary files.
+     *
+     * Uses the same block-buffered file format as the FIFO dump of \ref casil::TL::SiTCP "SiTCP"
+     * (see "fifo_dump_file" in \ref casil::TL::SiTCP::SiTCP() "SiTCP::SiTCP()"). A new file is started on every open().
+     */
+    class RawFileSink final : public Sink
+    {
+    public:
+        RawFileSink(std::string pBasePath, std::size_t pBlockSize, std::uint64_t pMaxFileSize, int pSourceIndex = -1,
+                    MemoryPlacement pPlacement = MemoryPlacement{}); ///< Constructor.
+        ~RawFileSink() override;                            ///< Destructor.
+        //
+        void open() override;                               ///< Open a new output file.
+        void consume(std::size_t pSourceIndex, std::span<const std::uint32_t> pWords) override;
+                                                            ///< Write the data words to the file.
+        void close() override;                              ///< Flush and close the output file.
+
+    private:
+        struct Writer;                                      ///< Wrapper around the used file writer implementation.
+        const std::unique_ptr<Writer> writer;               ///< The file writer.
+        const int sourceIndex;                              ///< Only write blocks from this source (all sources if negative).
+        std::vector<std::uint8_t> byteBuffer;               ///< Reused buffer for the little endian byte representation.
+    };
+
+    /*!
+     * \brief Sink that forwards the data words via %TCP to a remote RawDataReceiver.
+     *
+     * Sends a raw data stream in the chunk format of raw data files (see RawDataReader), i.e. a header followed by one
+     * chunk per block, with the source index as board ID and a sequence number per source. The payloads can optionally be
+     * LZ4-compressed (see Auxil::compressLZ4Block()), which is only used for blocks that actually become smaller.
+     *
+     * To limit the number of system calls, chunks are collected in a batch buffer until the batch size is reached.
+     * The batch is then sent together with the current chunk header and payload by a single gathered write, i.e.
+     * the (uncompressed) payload of the block that fills up the batch is sent directly from the pipeline block without copying.
+     *
+     * A new connection is established on every open() (and must be accepted by RawDataReceiver::receive() or
+     * RawDataReceiver::receiveToFile()) and closed by close(), which also sends the remaining batched chunks.
+     */
+    class NetworkSink final : public Sink
+    {
+    public:
+        NetworkSink(std::string pHost, std::uint16_t pPort, bool pCompress = false, std::size_t pBatchSize = 262144,
+                    int pSourceIndex = -1);                 ///< Constructor.
+        ~NetworkSink() override;                            ///< Destructor.
+        //
+        void open() override;                               ///< Connect to the receiver and start a new stream.
+        void consume(std::size_t pSourceIndex, std::span<const std::uint32_t> pWords) override;
+                                                            ///< Send the data words as chunk.
+        void close() override;                              ///< Send the remaining batched chunks and close the connection.
+
+    private:
+        void sendBatch(std::span<const std::uint8_t> pChunkHeader, std::span<const std::uint8_t> pPayload);
+                                                            ///< Send the batch buffer followed by a chunk header and payload.
+
+    private:
+        struct Connection;                                  ///< %TCP connection to the receiver.
+        const std::unique_ptr<Connection> connection;       ///< The connection.
+        const std::string host;                             ///< Host name or address of the receiver.
+        const std::uint16_t port;                           ///< Port of the receiver.
+        const bool compress;                                ///< Compress the payloads.
+        const std::size_t batchSize;                        ///< Batch buffer fill level that triggers sending.
+        const int sourceIndex;                              ///< Only send blocks from this source (all sources if negative).
+        std::vector<std::uint64_t> nextSequences;           ///< Sequence numbers of the next chunks by source index.
+        std::vector<std::uint8_t> batchBuffer;              ///< Collected chunks not sent yet.
+        std::vector<std::uint8_t> byteBuffer;               ///< Reused buffer for the little endian byte representation (big endian hosts).
+        std::vector<std::uint8_t> compressedBuffer;         ///< Reused buffer for the compressed payload.
+    };
+
+    /*!
+     * \brief Sink that passes the data words to a function.
+     */
+    class CallbackSink final : public Sink
+    {
+    public:
+        using CallbackType = std::function<void(std::size_t, std::span<const std::uint32_t>)>;
+                                                            ///< Function type for consume() forwarding.
+        //
+        explicit CallbackSink(CallbackType pCallback);      ///< Constructor.
+        //
+        void consume(std::size_t pSourceIndex, std::span<const std::uint32_t> pWords) override;
+                                                            ///< Call the function with the data words.
+
+    private:
+        const CallbackType callback;                        ///< The called function.
+    };
+
+    /*!
+     * \brief Sink that fills online monitoring histograms (see OnlineHistograms).
+     *
+     * The histograms are shared, such that they can be read (and filled by other sinks) while the pipeline is running.
+     */
+    class HistogramSink final : public Sink
+    {
+    public:
+        explicit HistogramSink(std::shared_ptr<OnlineHistograms> pHistograms, int pSourceIndex = -1);   ///< Constructor.
+        //
+        void consume(std::size_t pSourceIndex, std::span<const std::uint32_t> pWords) override;
+                                                            ///< Fill the histograms with the data words.
+
+    private:
+        const std::shared_ptr<OnlineHistograms> histograms; ///< The filled histograms.
+        const int sourceIndex;                              ///< Only fill blocks from this source (all sources if negative).
+    };
+
+    /*!
+     * \brief Snapshot of the pipeline counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t blocksRead;       ///< Number of non-empty blocks read from all sources.
+        std::uint64_t wordsRead;        ///< Number of data words read from all sources.
+        std::uint64_t blocksDropped;    ///< Number of blocks dropped by the decoder.
+        std::uint64_t sourceStalls;     ///< Number of times a source had to wait for a full queue (back-pressure).
+        std::uint64_t stageErrors;      ///< Number of exceptions thrown (and logged) by sources, decoder and sinks.
+    };
+
+public:
+    explicit ReadoutPipeline(std::size_t pQueueCapacity = 16,
+                             std::chrono::microseconds pPollInterval = std::chrono::microseconds(1000));   ///< Constructor.
+    ReadoutPipeline(const ReadoutPipeline&) = delete;               ///< Deleted copy constructor.
+    ReadoutPipeline(ReadoutPipeline&&) = delete;                    ///< Deleted move constructor.
+    ~ReadoutPipeline();                                             ///< Destructor.
+    //
+    ReadoutPipeline& operator=(ReadoutPipeline) = delete;           ///< Deleted copy assignment operator.
+    ReadoutPipeline& operator=(ReadoutPipeline&&) = delete;         ///< Deleted move assignment operator.
+    //
+    std::size_t addSource(std::unique_ptr<Source> pSource);         ///< Add a data source.
+    void setDecoder(std::unique_ptr<Decoder> pDecoder);             ///< Set the decoder stage.
+    void addSink(std::unique_ptr<Sink> pSink);                      ///< Add a data sink.
+    //
+    void start();                                                   ///< Start the stage threads.
+    void stop();                                                    ///< Stop reading, drain all queues and stop the stage threads.
+    bool isRunning() const;                                         ///< Check if the pipeline is running.
+    //
+    Statistics getStatistics() const;                               ///< Get the current pipeline counters.
+
+private:
+    const std::size_t queueCapacity;                                ///< Maximum number of blocks per queue.
+    const std::chrono::microseconds pollInterval;                   ///< Wait time of a source after reading no data.
+    //
+    std::vector<std::unique_ptr<Source>> sources;                   ///< Data sources.
+    std::unique_ptr<Decoder> decoder;                               ///< Decoder stage (pass through if null).
+    std::vector<std::unique_ptr<Sink>> sinks;                       ///< Data sinks.
+    //
+    struct Runtime;                                                 ///< Queues, threads and counters of a running pipeline.
+    std::unique_ptr<Runtime> runtime;                               ///< State of the running pipeline (null if stopped).
+    Statistics lastStatistics;                                      ///< Final counters of the last run (see getStatistics()).
+};
+
+} // namespace casil
+
+#endif // CASIL_READOUTPIPELINE_H
@@ -0,0 +1,433 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/scanengine.h>
+
+#include <casil/device.h>
+#include <casil/layerconfig.h>
+#include <casil/HL/driver.h>
+#include <casil/HL/registerdriver.h>
+#include <casil/HL/Muxed/sitcpfifo.h>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+using casil::ScanEngine;
+
+/*!
+ * \brief Compiled (merged) program operation.
+ *
+ * Consecutive "set" steps and consecutive "read" steps for the same driver are merged into a single operation each.
+ */
+struct ScanEngine::Operation
+{
+    Action action;                                                              ///< Kind of operation.
+    HL::Driver* driver;                                                         ///< Used driver (null for Action::Sleep).
+    HL::RegisterDriver* regDriver;                                              ///< \p driver as register driver (if needed).
+    HL::SiTCPFifo* fifo;                                                        ///< \p driver as FIFO driver (for Action::ReadFifo).
+    std::string driverName;                                                     ///< Driver name (for error messages).
+    std::string reg;                                                            ///< Register name (for Action::Trigger).
+    std::vector<std::pair<std::string, std::variant<std::uint64_t, std::vector<std::uint8_t>>>> updates;
+                                                                                ///< Merged register updates (for Action::Set).
+    std::vector<std::size_t> parameterUpdates;                                  ///< Indices of \p updates that take the scan parameter.
+    std::vector<std::string> readRegs;                                          ///< Merged read registers (for Action::Read).
+    std::chrono::milliseconds duration;                                         ///< Timeout or pause (for Action::Wait / Action::Sleep).
+    std::size_t numSteps;                                                       ///< Number of merged program steps.
+};
+
+/*!
+ * \brief Constructor.
+ *
+ * Resolves the drivers of all steps of \p pProgram in \p pDevice, checks the register names
+ * and compiles the steps into operations by merging consecutive "set" or "read" steps for the same driver.
+ *
+ * \throws std::invalid_argument If a driver does not exist in \p pDevice or has the wrong type for its step
+ *                               (HL::RegisterDriver for Action::Set, Action::Trigger and Action::Read,
+ *                               HL::SiTCPFifo for Action::ReadFifo).
+ * \throws std::invalid_argument If a register does not exist.
+ *
+ * \param pDevice %Device providing the drivers.
+ * \param pProgram Program definition.
+ */
+ScanEngine::ScanEngine(const Device& pDevice, Program pProgram) :
+    program(std::move(pProgram)),
+    fifoBuffer(),
+    abortRequested(false),
+    pointsExecuted(0),
+    stepsExecuted(0),
+    batchesExecuted(0)
+{
+    for (const Step& step : program.steps)
+    {
+        Operation operation{.action = step.action, .driver = nullptr, .regDriver = nullptr, .fifo = nullptr, .driverName = step.driver,
+                            .reg = {}, .updates = {}, .parameterUpdates = {}, .readRegs = {}, .duration = step.duration, .numSteps = 1};
+
+        if (step.action != Action::Sleep)
+            operation.driver = &pDevice.driver(step.driver);
+
+        if (step.action == Action::Set || step.action == Action::Trigger || step.action == Action::Read)
+        {
+            operation.regDriver = dynamic_cast<HL::RegisterDriver*>(operation.driver);
+
+            if (operation.regDriver == nullptr)
+                throw std::invalid_argument("Scan step needs a register driver, but driver \"" + step.driver + "\" is not.");
+
+            (void)operation.regDriver->testRegisterName(step.reg);
+        }
+        else if (step.action == Action::ReadFifo)
+        {
+            operation.fifo = dynamic_cast<HL::SiTCPFifo*>(operation.driver);
+
+            if (operation.fifo == nullptr)
+                throw std::invalid_argument("Scan step needs a FIFO driver, but driver \"" + step.driver + "\" is not.");
+
+            fifoBuffer.resize(fifoChunkWords);
+        }
+
+        //Merge into the previous operation if possible
+
+        const bool merge = (step.action == Action::Set || step.action == Action::Read) && !operations.empty() &&
+                           operations.back().action == step.action && operations.back().driver == operation.driver;
+
+        if (merge)
+            ++operations.back().numSteps;
+        else
+            operations.push_back(std::move(operation));
+
+        Operation& target = operations.back();
+
+        if (step.action == Action::Set)
+        {
+            if (std::holds_alternative<std::monostate>(step.value))
+            {
+                target.parameterUpdates.push_back(target.updates.size());
+                target.updates.emplace_back(step.reg, std::uint64_t{0});
+            }
+            else if (std::holds_alternative<std::uint64_t>(step.value))
+                target.updates.emplace_back(step.reg, std::get<std::uint64_t>(step.value));
+            else
+                target.updates.emplace_back(step.reg, std::get<std::vector<std::uint8_t>>(step.value));
+        }
+        else if (step.action == Action::Trigger)
+            target.reg = step.reg;
+        else if (step.action == Action::Read)
+        {
+            target.readRegs.push_back(step.reg);
+            readNames.push_back(step.driver + "." + step.reg);
+        }
+    }
+}
+
+/*!
+ * \brief Destructor.
+ */
+ScanEngine::~ScanEngine() = default;
+
+//Public
+
+/*!
+ * \brief Get the program definition.
+ *
+ * \return The program.
+ */
+const ScanEngine::Program& ScanEngine::getProgram() const
+{
+    return program;
+}
+
+/*!
+ * \brief Get the number of (merged) operations per parameter value.
+ *
+ * \return Number of program steps after merging consecutive "set" or "read" steps for the same driver.
+ */
+std::size_t ScanEngine::getNumOperations() const
+{
+    return operations.size();
+}
+
+//
+
+/*!
+ * \brief Execute the scan.
+ *
+ * Runs all operations once for each scan parameter value (or once with value zero if the program has no parameter),
+ * inserting the current value into all "set" steps with value "$scan". Results of "read" steps are collected per
+ * parameter value and FIFO data drained by "read_fifo" steps is passed to \p pFifoSink (if set) and counted.
+ *
+ * The scan stops before the next parameter value if abort() was called (see also Result::aborted).
+ *
+ * \throws std::invalid_argument If a register access is invalid (e.g. the scan parameter is written to a byte array register).
+ * \throws std::runtime_error If a register access or FIFO read fails or if a "wait" step times out.
+ *
+ * \param pFifoSink Callback for drained FIFO data (ignored if empty).
+ * \return Aggregated results for all completed parameter values.
+ */
+ScanEngine::Result ScanEngine::run(const FifoSinkType& pFifoSink)
+{
+    const std::lock_guard<std::mutex> runLock(runMutex);
+    (void)runLock;
+
+    abortRequested.store(false);
+
+    const std::vector<std::uint64_t> parameterValues = (program.parameterValues.empty() ? std::vector<std::uint64_t>{0} :
+                                                                                          program.parameterValues);
+
+    Result result{.parameterName = program.parameterName, .readNames = readNames, .points = {}, .aborted = false};
+
+    result.points.reserve(parameterValues.size());
+
+    for (std::size_t pointIdx = 0; pointIdx < parameterValues.size(); ++pointIdx)
+    {
+        if (abortRequested.load())
+        {
+            result.aborted = true;
+            break;
+        }
+
+        const std::uint64_t parameter = parameterValues[pointIdx];
+
+        Point point{.parameter = parameter, .readValues = {}, .fifoWords = 0};
+
+        point.readValues.reserve(readNames.size());
+
+        try
+        {
+            for (Operation& operation : operations)
+            {
+                switch (operation.action)
+                {
+                    case Action::Set:
+                    {
+                        for (const std::size_t updateIdx : operation.parameterUpdates)
+                            operation.updates[updateIdx].second = parameter;
+
+                        operation.regDriver->set(operation.updates);
+                        break;
+                    }
+                    case Action::Trigger:
+                    {
+                        operation.regDriver->trigger(operation.reg);
+                        break;
+                    }
+                    case Action::Wait:
+                    {
+                        if (!operation.driver->waitUntilDone(operation.duration))
+                            throw std::runtime_error("Timeout while waiting for driver \"" + operation.driverName + "\".");
+                        break;
+                    }
+                    case Action::Sleep:
+                    {
+                        std::this_thread::sleep_for(operation.duration);
+                        break;
+                    }
+                    case Action::Read:
+                    {
+                        for (auto& value : operation.regDriver->getMultiple(operation.readRegs))
+                            point.readValues.push_back(std::move(value));
+                        break;
+                    }
+                    case Action::ReadFifo:
+                    {
+                        for (;;)
+                        {
+                            const std::size_t numWords = operation.fifo->getFifoDataInto(fifoBuffer);
+
+                            if (numWords == 0)
+                                break;
+
+                            point.fifoWords += numWords;
+
+                            if (pFifoSink)
+                                pFifoSink(pointIdx, std::span<const std::uint32_t>(fifoBuffer.data(), numWords));
+
+                            if (numWords < fifoBuffer.size())
+                                break;
+                        }
+                        break;
+                    }
+                }
+
+                stepsExecuted.fetch_add(operation.numSteps);
+                batchesExecuted.fetch_add(1);
+            }
+        }
+        catch (const std::runtime_error& exc)
+        {
+            throw std::runtime_error("Scan failed at parameter value " + std::to_string(parameter) + ": " + exc.what());
+        }
+
+        result.points.push_back(std::move(point));
+
+        pointsExecuted.fetch_add(1);
+    }
+
+    return result;
+}
+
+/*!
+ * \brief Request a running scan to stop after the current parameter value.
+ *
+ * Has no effect on later run() calls.
+ */
+void ScanEngine::abort()
+{
+    abortRequested.store(true);
+}
+
+//
+
+/*!
+ * \brief Get the current engine counters.
+ *
+ * \return Counters accumulated over all run() calls.
+ */
+ScanEngine::Statistics ScanEngine::getStatistics() const
+{
+    return Statistics{.pointsExecuted = pointsExecuted.load(), .stepsExecuted = stepsExecuted.load(), .batchesExecuted = batchesExecuted.load()};
+}
+
+//
+
+/*!
+ * \brief Parse a program definition from YAML format.
+ *
+ * The optional "parameter" entry defines the scan parameter by a "name" and either a list of "values"
+ * or a range ("start", "stop" and optional "step", default 1), which excludes "stop" (like in Python).
+ * Each entry of "steps" needs an "action" out of
+ * - "set" with "driver", "register" and "value" (integer, byte sequence or "$scan" for the parameter value),
+ * - "trigger" with "driver" and "register",
+ * - "wait" with "driver" and optional "timeout" in milliseconds (default 1000),
+ * - "sleep" with "duration" in milliseconds,
+ * - "read" with "driver" and "register",
+ * - "read_fifo" with "driver".
+ *
+ * See also ScanEngine.
+ *
+ * \throws std::runtime_error If the definition is incomplete or invalid.
+ *
+ * \param pYAMLString YAML definition.
+ * \return The program.
+ */
+ScanEngine::Program ScanEngine::parseProgram(const std::string& pYAMLString)
+{
+    const LayerConfig config = LayerConfig::fromYAML(pYAMLString);
+
+    Program parsedProgram;
+
+    if (const boost::property_tree::ptree parameterTree = config.getRawTreeAt("parameter"); !parameterTree.empty())
+    {
+        const LayerConfig parameterConfig(parameterTree);
+
+        parsedProgram.parameterName = parameterConfig.getStr("name");
+
+        if (const std::optional<std::vector<std::uint64_t>> values = parameterConfig.getUIntSeqOpt("values"); values)
+            parsedProgram.parameterValues = values.value();
+        else
+        {
+            const std::optional<std::uint64_t> start = parameterConfig.getUIntOpt("start");
+            const std::optional<std::uint64_t> stop = parameterConfig.getUIntOpt("stop");
+            const std::uint64_t step = parameterConfig.getUInt("step", 1);
+
+            if (!start || !stop || step == 0)
+                throw std::runtime_error("Missing or invalid \"values\" or \"start\"/\"stop\"/\"step\" for scan parameter.");
+
+            for (std::uint64_t value = start.value(); value < stop.value(); value += step)
+            {
+                parsedProgram.parameterValues.push_back(value);
+
+                if (stop.value() - value <= step)
+                    break;
+            }
+        }
+
+        if (parsedProgram.parameterValues.empty())
+            throw std::runtime_error("Scan parameter \"" + parsedProgram.parameterName + "\" does not have any values.");
+    }
+
+    const boost::property_tree::ptree stepsTree = config.getRawTreeAt("steps");
+
+    if (stepsTree.empty())
+        throw std::runtime_error("Scan program does not define any \"steps\".");
+
+    for (const auto& [stepKey, stepTree] : stepsTree)
+    {
+        (void)stepKey;
+
+        const LayerConfig stepConfig(stepTree);
+
+        const std::string actionName = stepConfig.getStr("action");
+        const std::string context = "\"" + actionName + "\" step " + std::to_string(parsedProgram.steps.size());
+
+        Step step{.action = Action::Sleep, .driver = stepConfig.getStr("driver"), .reg = stepConfig.getStr("register"),
+                  .value = std::monostate{}, .duration = std::chrono::milliseconds::zero()};
+
+        if (actionName == "set")
+        {
+            step.action = Action::Set;
+
+            if (const std::optional<std::uint64_t> value = stepConfig.getUIntOpt("value"); value)
+                step.value = value.value();
+            else if (const std::optional<std::vector<std::uint8_t>> bytes = stepConfig.getByteSeqOpt("value"); bytes)
+                step.value = bytes.value();
+            else if (stepConfig.getStr("value") != "$scan")
+                throw std::runtime_error("Missing or invalid \"value\" for " + context + " of scan program.");
+        }
+        else if (actionName == "trigger")
+            step.action = Action::Trigger;
+        else if (actionName == "wait")
+        {
+            step.action = Action::Wait;
+            step.duration = std::chrono::milliseconds(stepConfig.getUInt("timeout", 1000));
+        }
+        else if (actionName == "sleep")
+        {
+            const std::optional<std::uint64_t> duration = stepConfig.getUIntOpt("duration");
+
+            if (!duration)
+                throw std::runtime_error("Missing or invalid \"duration\" for " + context + " of scan program.");
+
+            step.duration = std::chrono::milliseconds(duration.value());
+        }
+        else if (actionName == "read")
+            step.action = Action::Read;
+        else if (actionName == "read_fifo")
+            step.action = Action::ReadFifo;
+        else
+            throw std::runtime_error("Unknown action \"" + actionName + "\" for step " + std::to_string(parsedProgram.steps.size()) +
+                                     " of scan program.");
+
+        if (step.action != Action::Sleep && step.driver.empty())
+            throw std::runtime_error("Missing \"driver\" for " + context + " of scan program.");
+
+        if ((step.action == Action::Set || step.action == Action::Trigger || step.action == Action::Read) && step.reg.empty())
+            throw std::runtime_error("Missing \"register\" for " + context + " of scan program.");
+
+        parsedProgram.steps.push_back(std::move(step));
+    }
+
+    return parsedProgram;
+}
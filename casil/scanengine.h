@@ -0,0 +1,197 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_SCANENGINE_H
+#define CASIL_SCANENGINE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace casil
+{
+
+class Device;
+
+/*!
+ * \brief Executes declarative register programs ("scans") on a Device with batched bus accesses.
+ *
+ * A scan \e program consists of a list of \e steps that is executed once for each value of an optional scan \e parameter.
+ * The steps write registers (possibly the current parameter value), trigger write-only registers, wait for a driver
+ * to finish, sleep, read registers and drain a FIFO. The whole scan runs in C++ and only the aggregated results
+ * (one Point per parameter value) are returned, such that e.g. Python code needs a single call for the complete scan.
+ *
+ * The program can be defined in YAML format (see parseProgram()), e.g.:
+ *
+ * \code{.yaml}
+ *
+ * parameter: {name: threshold, start: 0, stop: 100, step: 10}
+ * steps:
+ *   - {action: set, driver: dac, register: VALUE, value: $scan}
+ *   - {action: set, driver: dac, register: ENABLE, value: 1}
+ *   - {action: trigger, driver: seq, register: START}
+ *   - {action: wait, driver: seq, timeout: 100}
+ *   - {action: read, driver: seq, register: HIT_COUNT}
+ *   - {action: read_fifo, driver: fifo}
+ *
+ * \endcode
+ *
+ * Before running, consecutive "set" steps and consecutive "read" steps for the same driver are merged, respectively,
+ * and executed as a single (multi-register) HL::RegisterDriver::set()
+ * or HL::RegisterDriver::getMultiple() call, which merges the register accesses into as few bus transfers as possible.
+ * All register names and driver types are resolved when constructing the engine.
+ *
+ * Note: run() can be called from multiple threads, but the calls are serialized.
+ */
+class ScanEngine
+{
+public:
+    /*!
+     * \brief Kind of a program step.
+     */
+    enum class Action : std::uint8_t
+    {
+        Set = 0,        ///< Write a value or byte sequence to a register (RegisterDriver::set()).
+        Trigger = 1,    ///< Trigger a write-only register (RegisterDriver::trigger()).
+        Wait = 2,       ///< Wait for a driver to finish (HL::Driver::waitUntilDone()).
+        Sleep = 3,      ///< Pause for a fixed duration.
+        Read = 4,       ///< Read a register (RegisterDriver::getMultiple()).
+        ReadFifo = 5    ///< Drain the FIFO of an HL::SiTCPFifo driver.
+    };
+
+    /*!
+     * \brief Register content of a "set" step: the scan parameter (\c std::monostate), an integer or a byte sequence.
+     */
+    using ValueType = std::variant<std::monostate, std::uint64_t, std::vector<std::uint8_t>>;
+
+    /*!
+     * \brief Definition of a program step.
+     */
+    struct Step
+    {
+        Action action;                          ///< Kind of step.
+        std::string driver;                     ///< Driver name (unused for Action::Sleep).
+        std::string reg;                        ///< Register name (for Action::Set, Action::Trigger and Action::Read).
+        ValueType value;                        ///< Written content (for Action::Set).
+        std::chrono::milliseconds duration;     ///< Timeout (for Action::Wait) or pause (for Action::Sleep).
+    };
+
+    /*!
+     * \brief Definition of a complete scan.
+     */
+    struct Program
+    {
+        std::string parameterName;                  ///< Scan parameter name (informational).
+        std::vector<std::uint64_t> parameterValues; ///< Scan parameter values (steps run once with value 0 if empty).
+        std::vector<Step> steps;                    ///< Steps executed for each parameter value.
+    };
+
+    /*!
+     * \brief Aggregated results for one scan parameter value.
+     */
+    struct Point
+    {
+        std::uint64_t parameter;                                                ///< Scan parameter value.
+        std::vector<std::variant<std::uint64_t, std::vector<std::uint8_t>>> readValues; ///< \brief Read register contents
+                                                                                        ///  (same order as Result::readNames).
+        std::uint64_t fifoWords;                                                ///< Number of FIFO words drained by "read_fifo" steps.
+    };
+
+    /*!
+     * \brief Output of run().
+     */
+    struct Result
+    {
+        std::string parameterName;          ///< Scan parameter name.
+        std::vector<std::string> readNames; ///< Names ("driver.register") of the read registers in the order of the "read" steps.
+        std::vector<Point> points;          ///< Results per completed parameter value.
+        bool aborted;                       ///< Whether the scan was stopped early by abort().
+    };
+
+    /*!
+     * \brief Snapshot of the engine counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t pointsExecuted;   ///< Number of completed parameter values.
+        std::uint64_t stepsExecuted;    ///< Number of executed program steps.
+        std::uint64_t batchesExecuted;  ///< Number of executed merged operations (each merged set/read counts once).
+    };
+
+    /*!
+     * \brief Callback for FIFO data drained by "read_fifo" steps.
+     *
+     * Arguments are the index of the current parameter value and the drained words.
+     */
+    using FifoSinkType = std::function<void(std::size_t, std::span<const std::uint32_t>)>;
+
+public:
+    ScanEngine(const Device& pDevice, Program pProgram);            ///< Constructor.
+    ScanEngine(const ScanEngine&) = delete;                         ///< Deleted copy constructor.
+    ScanEngine(ScanEngine&&) = delete;                              ///< Deleted move constructor.
+    ~ScanEngine();                                                  ///< Destructor.
+    //
+    ScanEngine& operator=(ScanEngine) = delete;                     ///< Deleted copy assignment operator.
+    ScanEngine& operator=(ScanEngine&&) = delete;                   ///< Deleted move assignment operator.
+    //
+    const Program& getProgram() const;                              ///< Get the program definition.
+    std::size_t getNumOperations() const;                           ///< Get the number of (merged) operations per parameter value.
+    //
+    Result run(const FifoSinkType& pFifoSink = {});                 ///< Execute the scan.
+    void abort();                                                   ///< Request a running scan to stop after the current parameter value.
+    //
+    Statistics getStatistics() const;                               ///< Get the current engine counters.
+    //
+    static Program parseProgram(const std::string& pYAMLString);    ///< Parse a program definition from YAML format.
+
+public:
+    static constexpr std::size_t fifoChunkWords = 65536;            ///< Number of words drained per FIFO read.
+
+private:
+    struct Operation;                                               ///< Compiled (merged) program operation.
+
+private:
+    const Program program;                                          ///< The program definition.
+    std::vector<Operation> operations;                              ///< The compiled operations.
+    std::vector<std::string> readNames;                             ///< See Result::readNames.
+    std::vector<std::uint32_t> fifoBuffer;                          ///< Reused buffer for "read_fifo" steps.
+    //
+    std::atomic_bool abortRequested;                                ///< Set by abort(), reset by run().
+    //
+    std::atomic_uint64_t pointsExecuted;                            ///< See Statistics::pointsExecuted.
+    std::atomic_uint64_t stepsExecuted;                             ///< See Statistics::stepsExecuted.
+    std::atomic_uint64_t batchesExecuted;                           ///< See Statistics::batchesExecuted.
+    //
+    std::mutex runMutex;                                            ///< Serializes run() calls.
+};
+
+} // namespace casil
+
+#endif // CASIL_SCANENGINE_H
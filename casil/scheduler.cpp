@@ -0,0 +1,385 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/scheduler.h>
+
+#include <casil/auxil.h>
+#include <casil/logger.h>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using casil::Scheduler;
+
+/*!
+ * \brief State of a scheduled action.
+ *
+ * The timer and the deadline are only accessed by the scheduler thread.
+ */
+struct Scheduler::Entry
+{
+    const ActionId id;                                      ///< Action ID.
+    const ActionType action;                                ///< The action.
+    const std::chrono::nanoseconds period;                  ///< Period (zero for one-shot actions).
+    std::chrono::steady_clock::time_point deadline;         ///< Next execution deadline.
+    boost::asio::steady_timer timer;                        ///< Timer for the next deadline (minus the spin margin).
+    std::atomic_bool cancelled;                             ///< Set by cancel().
+    //
+    std::atomic_uint64_t executions;                        ///< See ActionStatistics::executions.
+    std::atomic_uint64_t overruns;                          ///< See ActionStatistics::overruns.
+    std::atomic_uint64_t failures;                          ///< See ActionStatistics::failures.
+    std::atomic_int64_t maxLatenessNs;                      ///< See ActionStatistics::maxLateness.
+    std::atomic_int64_t totalLatenessNs;                    ///< Sum of all execution start delays.
+};
+
+/*!
+ * \brief Constructor.
+ *
+ * Starts the scheduler thread and tries to pin it to CPU core \p pCPU (only supported on Linux; see isPinned()).
+ *
+ * \throws std::invalid_argument If \p pSpinMargin is negative.
+ *
+ * \param pSpinMargin Duration to busy-spin before each deadline (zero disables spinning).
+ * \param pCPU CPU core for the scheduler thread (negative to not pin the thread).
+ */
+Scheduler::Scheduler(const std::chrono::nanoseconds pSpinMargin, const int pCPU) :
+    spinMargin(pSpinMargin),
+    ioContext(std::make_unique<boost::asio::io_context>(1)),
+    entries(),
+    nextId(0),
+    pinned(false),
+    thread()
+{
+    if (spinMargin < std::chrono::nanoseconds::zero())
+        throw std::invalid_argument("Spin margin of scheduler must not be negative.");
+
+    thread = std::thread([this]() -> void
+                         {
+                             const auto workGuard = boost::asio::make_work_guard(*ioContext);
+                             (void)workGuard;
+
+                             ioContext->run();
+                         });
+
+    if (pCPU >= 0)
+        pinned = Auxil::applyThreadScheduling(thread, Auxil::ThreadScheduling{.cpu = pCPU}, "scheduler thread");
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops the scheduler thread. Actions that are currently executed are finished, no further actions are started.
+ */
+Scheduler::~Scheduler()
+{
+    ioContext->stop();
+
+    if (thread.joinable())
+        thread.join();
+
+    //Release the pending timer handlers (and their entries) before the IO context and the entries get destroyed
+
+    const std::lock_guard<std::mutex> entriesLock(entriesMutex);
+    (void)entriesLock;
+
+    for (const auto& [id, entry] : entries)
+    {
+        (void)id;
+        entry->cancelled.store(true);
+        entry->timer.cancel();
+    }
+
+    ioContext->restart();
+    ioContext->poll();
+
+    entries.clear();
+}
+
+//Public
+
+/*!
+ * \brief Execute an action periodically.
+ *
+ * Executes \p pAction first after \p pInitialDelay and then every \p pPeriod (relative to the first deadline; see Scheduler).
+ *
+ * \throws std::invalid_argument If \p pPeriod is not positive or \p pInitialDelay is negative.
+ *
+ * \param pAction The action.
+ * \param pPeriod Period between the execution deadlines.
+ * \param pInitialDelay Delay of the first execution.
+ * \return ID of the action (see cancel() and getStatistics()).
+ */
+Scheduler::ActionId Scheduler::schedulePeriodic(ActionType pAction, const std::chrono::nanoseconds pPeriod,
+                                                const std::chrono::nanoseconds pInitialDelay)
+{
+    if (pPeriod <= std::chrono::nanoseconds::zero())
+        throw std::invalid_argument("Period of scheduled action must be positive.");
+
+    return addEntry(std::move(pAction), pPeriod, pInitialDelay);
+}
+
+/*!
+ * \brief Execute an action once after a delay.
+ *
+ * \throws std::invalid_argument If \p pDelay is negative.
+ *
+ * \param pAction The action.
+ * \param pDelay Delay of the execution.
+ * \return ID of the action (see cancel() and getStatistics()).
+ */
+Scheduler::ActionId Scheduler::scheduleOnce(ActionType pAction, const std::chrono::nanoseconds pDelay)
+{
+    return addEntry(std::move(pAction), std::chrono::nanoseconds::zero(), pDelay);
+}
+
+/*!
+ * \brief Stop executing an action.
+ *
+ * An execution of the action that is currently running is finished.
+ *
+ * \param pId ID of the action.
+ * \return True if the action was scheduled (i.e. not already cancelled or completed as one-shot action).
+ */
+bool Scheduler::cancel(const ActionId pId)
+{
+    std::shared_ptr<Entry> entry;
+
+    {
+        const std::lock_guard<std::mutex> entriesLock(entriesMutex);
+        (void)entriesLock;
+
+        const auto it = entries.find(pId);
+
+        if (it == entries.end())
+            return false;
+
+        entry = std::move(it->second);
+        entries.erase(it);
+    }
+
+    entry->cancelled.store(true);
+
+    boost::asio::post(*ioContext, [entry]() -> void { entry->timer.cancel(); });
+
+    return true;
+}
+
+/*!
+ * \brief Check if an action is still scheduled.
+ *
+ * \param pId ID of the action.
+ * \return True if the action was neither cancelled nor completed as one-shot action.
+ */
+bool Scheduler::isScheduled(const ActionId pId) const
+{
+    const std::lock_guard<std::mutex> entriesLock(entriesMutex);
+    (void)entriesLock;
+
+    return entries.contains(pId);
+}
+
+//
+
+/*!
+ * \brief Get the current counters of an action.
+ *
+ * \throws std::invalid_argument If the action is not scheduled (see isScheduled()).
+ *
+ * \param pId ID of the action.
+ * \return Counters of the action.
+ */
+Scheduler::ActionStatistics Scheduler::getStatistics(const ActionId pId) const
+{
+    std::shared_ptr<Entry> entry;
+
+    {
+        const std::lock_guard<std::mutex> entriesLock(entriesMutex);
+        (void)entriesLock;
+
+        const auto it = entries.find(pId);
+
+        if (it == entries.end())
+            throw std::invalid_argument("No scheduled action with ID " + std::to_string(pId) + ".");
+
+        entry = it->second;
+    }
+
+    const std::uint64_t executions = entry->executions.load();
+
+    return ActionStatistics{.executions = executions, .overruns = entry->overruns.load(), .failures = entry->failures.load(),
+                            .maxLateness = std::chrono::nanoseconds(entry->maxLatenessNs.load()),
+                            .meanLateness = std::chrono::nanoseconds(executions == 0 ? 0 :
+                                                                     entry->totalLatenessNs.load() / static_cast<std::int64_t>(executions))};
+}
+
+//
+
+/*!
+ * \brief Get the busy-spin duration before each deadline.
+ *
+ * \return The spin margin.
+ */
+std::chrono::nanoseconds Scheduler::getSpinMargin() const
+{
+    return spinMargin;
+}
+
+/*!
+ * \brief Check if the scheduler thread was pinned to the requested CPU core.
+ *
+ * \return True if a CPU core was requested (see Scheduler()) and pinning succeeded.
+ */
+bool Scheduler::isPinned() const
+{
+    return pinned;
+}
+
+//Private
+
+/*!
+ * \brief Register an action and arm its timer.
+ *
+ * \throws std::invalid_argument If \p pDelay is negative.
+ *
+ * \param pAction The action.
+ * \param pPeriod Period between the execution deadlines (zero for a one-shot action).
+ * \param pDelay Delay of the first execution.
+ * \return ID of the action.
+ */
+Scheduler::ActionId Scheduler::addEntry(ActionType pAction, const std::chrono::nanoseconds pPeriod, const std::chrono::nanoseconds pDelay)
+{
+    if (pDelay < std::chrono::nanoseconds::zero())
+        throw std::invalid_argument("Delay of scheduled action must not be negative.");
+
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + pDelay;
+
+    std::shared_ptr<Entry> entry;
+
+    {
+        const std::lock_guard<std::mutex> entriesLock(entriesMutex);
+        (void)entriesLock;
+
+        entry = std::shared_ptr<Entry>(new Entry{.id = nextId++, .action = std::move(pAction), .period = pPeriod, .deadline = deadline,
+                                                 .timer = boost::asio::steady_timer(*ioContext), .cancelled {false},
+                                                 .executions {0}, .overruns {0}, .failures {0}, .maxLatenessNs {0}, .totalLatenessNs {0}});
+
+        entries.emplace(entry->id, entry);
+    }
+
+    boost::asio::post(*ioContext, [this, entry]() -> void { armEntry(entry); });
+
+    return entry->id;
+}
+
+/*!
+ * \brief Wait for the next deadline of an action.
+ *
+ * Sets the timer of \p pEntry to expire the spin margin before the deadline and then calls executeEntry().
+ * Must be called from the scheduler thread.
+ *
+ * \param pEntry The action.
+ */
+void Scheduler::armEntry(const std::shared_ptr<Entry>& pEntry)
+{
+    if (pEntry->cancelled.load())
+        return;
+
+    pEntry->timer.expires_at(pEntry->deadline - spinMargin);
+    pEntry->timer.async_wait([this, pEntry](const boost::system::error_code& pError) -> void
+                             {
+                                 if (!pError)
+                                     executeEntry(pEntry);
+                             });
+}
+
+/*!
+ * \brief Spin until the deadline, execute an action and re-arm it.
+ *
+ * Busy-spins until the deadline of \p pEntry, executes the action and updates the counters. For periodic actions,
+ * advances the deadline by one period (or several periods, counting overruns, if it already passed) and calls armEntry().
+ * Removes one-shot actions. Must be called from the scheduler thread.
+ *
+ * \param pEntry The action.
+ */
+void Scheduler::executeEntry(const std::shared_ptr<Entry>& pEntry)
+{
+    if (pEntry->cancelled.load())
+        return;
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    while (now < pEntry->deadline)
+        now = std::chrono::steady_clock::now();
+
+    const std::int64_t latenessNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now - pEntry->deadline).count();
+
+    pEntry->totalLatenessNs.fetch_add(latenessNs);
+
+    if (latenessNs > pEntry->maxLatenessNs.load())
+        pEntry->maxLatenessNs.store(latenessNs);
+
+    try
+    {
+        pEntry->action();
+    }
+    catch (const std::exception& exc)
+    {
+        pEntry->failures.fetch_add(1);
+        Logger::logError("Scheduled action " + std::to_string(pEntry->id) + " failed: " + exc.what());
+    }
+
+    pEntry->executions.fetch_add(1);
+
+    if (pEntry->period == std::chrono::nanoseconds::zero())
+    {
+        const std::lock_guard<std::mutex> entriesLock(entriesMutex);
+        (void)entriesLock;
+
+        entries.erase(pEntry->id);
+
+        return;
+    }
+
+    pEntry->deadline += pEntry->period;
+
+    now = std::chrono::steady_clock::now();
+
+    if (pEntry->deadline <= now)
+    {
+        const std::int64_t missedPeriods = (now - pEntry->deadline) / pEntry->period + 1;
+
+        pEntry->overruns.fetch_add(static_cast<std::uint64_t>(missedPeriods));
+        pEntry->deadline += missedPeriods * pEntry->period;
+    }
+
+    armEntry(pEntry);
+}
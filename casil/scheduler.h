@@ -0,0 +1,120 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_SCHEDULER_H
+#define CASIL_SCHEDULER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace boost { namespace asio { class io_context; } }
+
+namespace casil
+{
+
+/*!
+ * \brief Low-jitter scheduler for periodic and one-shot actions (e.g. pulsing a driver or polling a FIFO at a fixed rate).
+ *
+ * Actions are executed by a single dedicated thread that runs a private Boost %ASIO IO context (see ASIO for the
+ * shared IO contexts used by the interfaces), optionally pinned to a CPU core (see Scheduler()). Each action waits on
+ * a \c steady_timer that expires shortly (the "spin margin") \e before its deadline and then busy-spins until the
+ * exact deadline, which avoids the wake-up latency of the timer for the final microseconds.
+ *
+ * Periodic deadlines are computed from the initial deadline (<tt>start + n * period</tt>), i.e. there is no drift.
+ * If an execution ends after one or more following deadlines have already passed, these periods are skipped
+ * and counted as overruns (see ActionStatistics). Exceptions thrown by actions are logged and counted.
+ *
+ * All actions share the thread, such that a long-running action delays the others.
+ * The functions of this class are thread-safe, but must not be called from within actions,
+ * except for cancel() and getStatistics().
+ */
+class Scheduler
+{
+public:
+    using ActionType = std::function<void()>;                       ///< Scheduled action.
+    using ActionId = std::uint64_t;                                 ///< Identifier of a scheduled action.
+
+    /*!
+     * \brief Snapshot of the counters of a scheduled action (see getStatistics()).
+     */
+    struct ActionStatistics
+    {
+        std::uint64_t executions;           ///< Number of executions.
+        std::uint64_t overruns;             ///< Number of skipped periods because an execution took too long.
+        std::uint64_t failures;             ///< Number of executions that threw an exception.
+        std::chrono::nanoseconds maxLateness;   ///< Largest delay of an execution start with respect to its deadline.
+        std::chrono::nanoseconds meanLateness;  ///< Mean delay of the execution starts with respect to their deadlines.
+    };
+
+public:
+    explicit Scheduler(std::chrono::nanoseconds pSpinMargin = std::chrono::microseconds(200), int pCPU = -1);
+                                                                    ///< Constructor.
+    Scheduler(const Scheduler&) = delete;                           ///< Deleted copy constructor.
+    Scheduler(Scheduler&&) = delete;                                ///< Deleted move constructor.
+    ~Scheduler();                                                   ///< Destructor.
+    //
+    Scheduler& operator=(Scheduler) = delete;                       ///< Deleted copy assignment operator.
+    Scheduler& operator=(Scheduler&&) = delete;                     ///< Deleted move assignment operator.
+    //
+    ActionId schedulePeriodic(ActionType pAction, std::chrono::nanoseconds pPeriod,
+                              std::chrono::nanoseconds pInitialDelay = std::chrono::nanoseconds::zero());
+                                                                    ///< Execute an action periodically.
+    ActionId scheduleOnce(ActionType pAction, std::chrono::nanoseconds pDelay);    ///< Execute an action once after a delay.
+    bool cancel(ActionId pId);                                      ///< Stop executing an action.
+    bool isScheduled(ActionId pId) const;                           ///< Check if an action is still scheduled.
+    //
+    ActionStatistics getStatistics(ActionId pId) const;             ///< Get the current counters of an action.
+    //
+    std::chrono::nanoseconds getSpinMargin() const;                 ///< Get the busy-spin duration before each deadline.
+    bool isPinned() const;                                          ///< Check if the scheduler thread was pinned to the requested CPU core.
+
+private:
+    struct Entry;                                                   ///< State of a scheduled action.
+
+private:
+    ActionId addEntry(ActionType pAction, std::chrono::nanoseconds pPeriod, std::chrono::nanoseconds pDelay);
+                                                                    ///< Register an action and arm its timer.
+    void armEntry(const std::shared_ptr<Entry>& pEntry);            ///< Wait for the next deadline of an action.
+    void executeEntry(const std::shared_ptr<Entry>& pEntry);        ///< Spin until the deadline, execute an action and re-arm it.
+
+private:
+    const std::chrono::nanoseconds spinMargin;                      ///< Busy-spin duration before each deadline.
+    const std::unique_ptr<boost::asio::io_context> ioContext;       ///< Private IO context for the action timers.
+    //
+    std::map<ActionId, std::shared_ptr<Entry>> entries;             ///< Scheduled actions by ID.
+    ActionId nextId;                                                ///< ID for the next scheduled action.
+    mutable std::mutex entriesMutex;                                ///< Protects \ref entries and \ref nextId.
+    //
+    bool pinned;                                                    ///< Whether the thread was pinned to the requested CPU core.
+    std::thread thread;                                             ///< Thread running \ref ioContext.
+};
+
+} // namespace casil
+
+#endif // CASIL_SCHEDULER_H
@@ -0,0 +1,529 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/slowcontrolarchiver.h>
+
+#include <casil/logger.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+using casil::SlowControlArchiver;
+
+namespace
+{
+
+/*
+ * Appends 'pText' to 'pOut', escaping each character contained in 'pSpecialChars' with a backslash.
+ */
+void appendEscaped(std::string& pOut, const std::string_view pText, const std::string_view pSpecialChars)
+{
+    for (const char c : pText)
+    {
+        if (pSpecialChars.find(c) != std::string_view::npos)
+            pOut += '\\';
+
+        pOut += c;
+    }
+}
+
+/*
+ * Appends the decimal (or, for floating-point types, shortest round-trip) representation of 'pValue' to 'pOut'.
+ */
+template<typename T>
+void appendNumber(std::string& pOut, const T pValue)
+{
+    char buffer[32];
+
+    const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), pValue);
+
+    pOut.append(buffer, result.ptr);
+}
+
+/*
+ * Splits 'pTarget' of the form "HOST:PORT" into host and port. Throws std::invalid_argument if malformed.
+ */
+std::pair<std::string, std::string> splitHostPort(const std::string& pTarget)
+{
+    const std::size_t colonPos = pTarget.rfind(':');
+
+    if (colonPos == std::string::npos || colonPos == 0 || colonPos + 1 == pTarget.size())
+        throw std::invalid_argument("Invalid archiver target \"" + pTarget + "\" (expected \"HOST:PORT\").");
+
+    return {pTarget.substr(0, colonPos), pTarget.substr(colonPos + 1)};
+}
+
+} // namespace
+
+/*!
+ * \brief Backend socket or file.
+ */
+struct SlowControlArchiver::Connection
+{
+    boost::asio::io_context ioContext;                              ///< IO context for the synchronous socket operations.
+    boost::asio::ip::udp::socket udpSocket;                         ///< UDP socket (for Backend::UDP).
+    boost::asio::ip::udp::endpoint udpEndpoint;                     ///< UDP destination (for Backend::UDP).
+    boost::asio::ip::tcp::socket tcpSocket;                         ///< TCP socket (for Backend::TCP).
+    boost::asio::ip::tcp::resolver::results_type tcpEndpoints;      ///< Resolved TCP destinations (for Backend::TCP).
+    std::ofstream file;                                             ///< Archive file (for Backend::File).
+    //
+    Connection() : ioContext(), udpSocket(ioContext), udpEndpoint(), tcpSocket(ioContext), tcpEndpoints(), file() {}
+                                                                    ///< Constructor.
+};
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * Resolves the address \p pTarget (for Backend::UDP and Backend::TCP) or opens the file \p pTarget for appending
+ * (for Backend::File), registers the archiver as sink of \p pPoller and starts flushing every \p pFlushPeriod.
+ * The TCP connection is only established by the first flush (and re-established after errors).
+ *
+ * \throws std::invalid_argument If \p pFlushPeriod or \p pBlockSize is not positive or \p pMeasurement is empty.
+ * \throws std::invalid_argument If \p pTarget is not of the form "HOST:PORT" (for Backend::UDP and Backend::TCP).
+ * \throws std::runtime_error If \p pTarget cannot be resolved or the file cannot be opened.
+ *
+ * \param pPoller The poller whose values are archived.
+ * \param pBackend Destination of the archived samples.
+ * \param pTarget Backend address ("HOST:PORT") or file path.
+ * \param pFlushPeriod Period of the flushes.
+ * \param pMeasurement Measurement name of the written lines.
+ * \param pBlockSize Maximum number of samples collected between two flushes.
+ */
+SlowControlArchiver::SlowControlArchiver(SlowControlPoller& pPoller, const Backend pBackend, std::string pTarget,
+                                         const std::chrono::milliseconds pFlushPeriod, std::string pMeasurement, const std::size_t pBlockSize) :
+    poller(pPoller),
+    backend(pBackend),
+    target(std::move(pTarget)),
+    measurement([&pMeasurement]() -> std::string
+                {
+                    std::string escaped;
+                    appendEscaped(escaped, pMeasurement, ", ");
+                    return escaped;
+                }()),
+    blockSize(pBlockSize),
+    activeBlock(),
+    channelIds(),
+    newChannelKeys(),
+    flushPending(false),
+    statistics{.samples = 0, .samplesWritten = 0, .samplesDropped = 0, .flushes = 0, .bytesWritten = 0, .failures = 0},
+    mutex(),
+    flushBlock(),
+    channelKeys(),
+    lineBuffer(),
+    connection(std::make_unique<Connection>()),
+    flushMutex(),
+    sinkId(0),
+    scheduler(std::chrono::nanoseconds::zero())
+{
+    if (pFlushPeriod <= std::chrono::milliseconds::zero())
+        throw std::invalid_argument("Flush period of slow-control archiver must be positive.");
+    if (blockSize == 0)
+        throw std::invalid_argument("Block size of slow-control archiver must be positive.");
+    if (measurement.empty())
+        throw std::invalid_argument("Measurement name of slow-control archiver must not be empty.");
+
+    if (backend == Backend::File)
+    {
+        connection->file.open(target, std::ios::binary | std::ios::app);
+
+        if (!connection->file.is_open())
+            throw std::runtime_error("Could not open archive file \"" + target + "\".");
+    }
+    else
+    {
+        const auto [host, port] = splitHostPort(target);
+
+        try
+        {
+            if (backend == Backend::UDP)
+            {
+                connection->udpEndpoint = *boost::asio::ip::udp::resolver(connection->ioContext).resolve(host, port).begin();
+                connection->udpSocket.open(connection->udpEndpoint.protocol());
+            }
+            else
+                connection->tcpEndpoints = boost::asio::ip::tcp::resolver(connection->ioContext).resolve(host, port);
+        }
+        catch (const boost::system::system_error& exc)
+        {
+            throw std::runtime_error("Could not resolve archiver target \"" + target + "\": " + exc.what());
+        }
+    }
+
+    for (Block* const block : {&activeBlock, &flushBlock})
+    {
+        block->channels.reserve(blockSize);
+        block->times.reserve(blockSize);
+        block->values.reserve(blockSize);
+    }
+
+    sinkId = poller.addSink([this](const std::vector<SlowControlPoller::UpdateType>& pUpdates) -> void { append(pUpdates); });
+
+    scheduler.schedulePeriodic([this]() -> void { (void)flush(); }, pFlushPeriod, pFlushPeriod);
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Removes the poller sink and flushes the remaining samples.
+ */
+SlowControlArchiver::~SlowControlArchiver()
+{
+    (void)poller.removeSink(sinkId);
+
+    (void)flush();
+}
+
+//Public
+
+/*!
+ * \brief Write all collected samples to the backend.
+ *
+ * Swaps the active block with the (empty) flushed block, such that new samples can be collected meanwhile, and writes
+ * the samples as line protocol to the backend (see also the class description). Errors are logged and counted.
+ *
+ * \return True if the samples were written (or there were none).
+ */
+bool SlowControlArchiver::flush()
+{
+    const std::lock_guard<std::mutex> flushLock(flushMutex);
+    (void)flushLock;
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        std::swap(activeBlock, flushBlock);
+
+        for (std::string& channelKey : newChannelKeys)
+            channelKeys.push_back(std::move(channelKey));
+
+        newChannelKeys.clear();
+
+        flushPending = false;
+    }
+
+    const std::size_t numSamples = flushBlock.channels.size();
+
+    if (numSamples == 0)
+        return true;
+
+    const std::size_t numLines = formatBlock();
+
+    flushBlock.channels.clear();
+    flushBlock.times.clear();
+    flushBlock.values.clear();
+
+    bool success = true;
+
+    try
+    {
+        write();
+    }
+    catch (const std::runtime_error& exc)
+    {
+        Logger::logError(std::string("Slow-control archiver could not write ") + std::to_string(numLines) + " samples to \"" +
+                         target + "\": " + exc.what());
+        success = false;
+    }
+
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    if (success)
+    {
+        ++statistics.flushes;
+        statistics.samplesWritten += numLines;
+        statistics.samplesDropped += numSamples - numLines;
+        statistics.bytesWritten += lineBuffer.size();
+    }
+    else
+    {
+        ++statistics.failures;
+        statistics.samplesDropped += numSamples;
+    }
+
+    return success;
+}
+
+//
+
+/*!
+ * \brief Get the destination of the archived samples.
+ *
+ * \return Backend.
+ */
+SlowControlArchiver::Backend SlowControlArchiver::getBackend() const
+{
+    return backend;
+}
+
+/*!
+ * \brief Get the backend target address or file path.
+ *
+ * \return Target ("HOST:PORT" or file path).
+ */
+const std::string& SlowControlArchiver::getTarget() const
+{
+    return target;
+}
+
+/*!
+ * \brief Get the number of samples waiting for the next flush.
+ *
+ * \return Number of samples in the active block.
+ */
+std::size_t SlowControlArchiver::getPendingSamples() const
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    return activeBlock.channels.size();
+}
+
+/*!
+ * \brief Get the current counters.
+ *
+ * \return Counters since construction.
+ */
+SlowControlArchiver::Statistics SlowControlArchiver::getStatistics() const
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    return statistics;
+}
+
+//Private
+
+/*!
+ * \brief Add new item values to the active block.
+ *
+ * Maps new item paths to channel indices and appends the samples to the active block. Drops samples that do not
+ * fit into the block anymore and schedules an immediate flush when the block becomes full.
+ *
+ * \param pUpdates Item paths and new samples (see SlowControlPoller::addSink()).
+ */
+void SlowControlArchiver::append(const std::vector<SlowControlPoller::UpdateType>& pUpdates)
+{
+    bool startFlush = false;
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        for (const auto& [path, sample] : pUpdates)
+        {
+            ++statistics.samples;
+
+            if (activeBlock.channels.size() >= blockSize)
+            {
+                ++statistics.samplesDropped;
+                continue;
+            }
+
+            auto channelIt = channelIds.find(path);
+
+            if (channelIt == channelIds.end())
+            {
+                channelIt = channelIds.emplace(path, static_cast<std::uint32_t>(channelIds.size())).first;
+
+                std::string channelKey = measurement + ",channel=";
+                appendEscaped(channelKey, path, ",= ");
+
+                newChannelKeys.push_back(std::move(channelKey));
+            }
+
+            activeBlock.channels.push_back(channelIt->second);
+            activeBlock.times.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(sample->time.time_since_epoch()).count());
+            activeBlock.values.push_back(sample->value);
+        }
+
+        if (activeBlock.channels.size() >= blockSize && !flushPending)
+        {
+            flushPending = true;
+            startFlush = true;
+        }
+    }
+
+    if (startFlush)
+        (void)scheduler.scheduleOnce([this]() -> void { (void)flush(); }, std::chrono::nanoseconds::zero());
+}
+
+/*!
+ * \brief Format the flushed block as line protocol.
+ *
+ * Replaces the contents of \ref lineBuffer with one line per sample of \ref flushBlock.
+ * Skips empty and non-finite values. Must be called with \ref flushMutex locked.
+ *
+ * \return Number of formatted lines.
+ */
+std::size_t SlowControlArchiver::formatBlock()
+{
+    lineBuffer.clear();
+
+    std::size_t numLines = 0;
+
+    for (std::size_t i = 0; i < flushBlock.channels.size(); ++i)
+    {
+        const SlowControlPoller::ValueType& value = flushBlock.values[i];
+
+        if (std::holds_alternative<std::monostate>(value) ||
+            (std::holds_alternative<double>(value) && !std::isfinite(std::get<double>(value))))
+        {
+            continue;
+        }
+
+        lineBuffer += channelKeys[flushBlock.channels[i]];
+        lineBuffer += " value=";
+
+        if (const std::string* const text = std::get_if<std::string>(&value))
+        {
+            lineBuffer += '"';
+            appendEscaped(lineBuffer, *text, "\"\\");
+            lineBuffer += '"';
+        }
+        else if (const int* const intValue = std::get_if<int>(&value))
+        {
+            appendNumber(lineBuffer, *intValue);
+            lineBuffer += 'i';
+        }
+        else if (const double* const dblValue = std::get_if<double>(&value))
+            appendNumber(lineBuffer, *dblValue);
+        else if (const std::uint64_t* const uintValue = std::get_if<std::uint64_t>(&value))
+        {
+            appendNumber(lineBuffer, *uintValue);
+            lineBuffer += 'u';
+        }
+        else
+        {
+            static constexpr std::string_view hexDigits = "0123456789abcdef";
+
+            lineBuffer += '"';
+
+            for (const std::uint8_t byte : std::get<std::vector<std::uint8_t>>(value))
+            {
+                lineBuffer += hexDigits[byte >> 4];
+                lineBuffer += hexDigits[byte & 0x0Fu];
+            }
+
+            lineBuffer += '"';
+        }
+
+        lineBuffer += ' ';
+        appendNumber(lineBuffer, flushBlock.times[i]);
+        lineBuffer += '\n';
+
+        ++numLines;
+    }
+
+    return numLines;
+}
+
+/*!
+ * \brief Write the formatted lines to the backend.
+ *
+ * Writes \ref lineBuffer to the backend (see the class description). Closes the TCP connection after
+ * an error (to re-connect on the next flush). Must be called with \ref flushMutex locked.
+ *
+ * \throws std::runtime_error If writing fails.
+ */
+void SlowControlArchiver::write()
+{
+    if (lineBuffer.empty())
+        return;
+
+    try
+    {
+        switch (backend)
+        {
+            case Backend::UDP:
+            {
+                for (std::size_t pos = 0; pos < lineBuffer.size();)
+                {
+                    std::size_t end = pos + maxDatagramSize;
+
+                    if (end >= lineBuffer.size())
+                        end = lineBuffer.size();
+                    else if (const std::size_t newlinePos = lineBuffer.rfind('\n', end - 1); newlinePos != std::string::npos && newlinePos >= pos)
+                        end = newlinePos + 1;
+                    else
+                        end = lineBuffer.find('\n', pos) + 1;   //Single line longer than a datagram
+
+                    connection->udpSocket.send_to(boost::asio::buffer(lineBuffer.data() + pos, end - pos), connection->udpEndpoint);
+
+                    pos = end;
+                }
+                break;
+            }
+            case Backend::TCP:
+            {
+                if (!connection->tcpSocket.is_open())
+                    boost::asio::connect(connection->tcpSocket, connection->tcpEndpoints);
+
+                boost::asio::write(connection->tcpSocket, boost::asio::buffer(lineBuffer));
+                break;
+            }
+            case Backend::File:
+            {
+                connection->file.write(lineBuffer.data(), static_cast<std::streamsize>(lineBuffer.size()));
+                connection->file.flush();
+
+                if (!connection->file.good())
+                {
+                    connection->file.clear();
+                    throw std::runtime_error("Could not write to archive file.");
+                }
+                break;
+            }
+            default:
+            {
+                throw std::runtime_error("Unknown archiver backend.");
+            }
+        }
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        if (backend == Backend::TCP)
+        {
+            boost::system::error_code ec;
+            connection->tcpSocket.close(ec);
+        }
+
+        throw std::runtime_error(exc.what());
+    }
+}
@@ -0,0 +1,156 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_SLOWCONTROLARCHIVER_H
+#define CASIL_SLOWCONTROLARCHIVER_H
+
+#include <casil/scheduler.h>
+#include <casil/slowcontrolpoller.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace casil
+{
+
+/*!
+ * \brief Sink for SlowControlPoller that archives all polled values with batched time-series writes.
+ *
+ * Registers itself as sink of a SlowControlPoller (see SlowControlPoller::addSink()) and collects every new item value
+ * in a columnar \e block (channel indices, timestamps and values in separate, pre-allocated arrays; each item path is
+ * mapped to a channel index once). The block is flushed periodically by an own Scheduler (see SlowControlArchiver()),
+ * i.e. the poller thread only appends to the block and never waits for the backend.
+ *
+ * A flush swaps the active block with a second one, formats all samples into a single text buffer in the
+ * InfluxDB line protocol (one line <tt>MEASUREMENT,channel=PATH value=VALUE TIMESTAMP</tt> per sample, nanosecond
+ * timestamps; SCPI strings and register byte sequences (as hexadecimal string) are written as string fields, integers
+ * as integer fields) and writes it to the configured Backend with as few writes as possible:
+ * - \ref Backend::UDP "UDP": Datagrams of at most \ref maxDatagramSize bytes, split at line boundaries.
+ * - \ref Backend::TCP "TCP": One write per flush over a persistent connection (re-connected on the next flush after an error).
+ * - \ref Backend::File "File": One write per flush appended to a local file.
+ *
+ * Since the blocks and the text buffer are reused, archiving a steady number of numeric channels does not allocate.
+ * If the active block is full, a flush is started immediately and samples arriving meanwhile are dropped.
+ * Samples of a failed flush are dropped as well. Both are counted (see Statistics). Non-finite floating-point
+ * values and empty values are skipped (not representable in the line protocol).
+ *
+ * The poller must outlive the archiver. The functions of this class are thread-safe.
+ */
+class SlowControlArchiver
+{
+public:
+    /*!
+     * \brief Destination of the archived samples.
+     */
+    enum class Backend
+    {
+        UDP,    ///< Line protocol over UDP (target "HOST:PORT").
+        TCP,    ///< Line protocol over TCP (target "HOST:PORT").
+        File    ///< Line protocol appended to a local file (target is the file path).
+    };
+
+    /*!
+     * \brief Snapshot of the archiver counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t samples;          ///< Number of samples received from the poller.
+        std::uint64_t samplesWritten;   ///< Number of samples written to the backend.
+        std::uint64_t samplesDropped;   ///< Number of samples dropped because the block was full or the flush failed.
+        std::uint64_t flushes;          ///< Number of flushes that wrote samples.
+        std::uint64_t bytesWritten;     ///< Number of bytes written to the backend.
+        std::uint64_t failures;         ///< Number of failed flushes.
+    };
+
+public:
+    SlowControlArchiver(SlowControlPoller& pPoller, Backend pBackend, std::string pTarget,
+                        std::chrono::milliseconds pFlushPeriod = std::chrono::milliseconds(1000), std::string pMeasurement = "casil",
+                        std::size_t pBlockSize = 65536);    ///< Constructor.
+    SlowControlArchiver(const SlowControlArchiver&) = delete;       ///< Deleted copy constructor.
+    SlowControlArchiver(SlowControlArchiver&&) = delete;            ///< Deleted move constructor.
+    ~SlowControlArchiver();                                         ///< Destructor.
+    //
+    SlowControlArchiver& operator=(SlowControlArchiver) = delete;   ///< Deleted copy assignment operator.
+    SlowControlArchiver& operator=(SlowControlArchiver&&) = delete; ///< Deleted move assignment operator.
+    //
+    bool flush();                                                   ///< Write all collected samples to the backend.
+    //
+    Backend getBackend() const;                                     ///< Get the destination of the archived samples.
+    const std::string& getTarget() const;                           ///< Get the backend target address or file path.
+    std::size_t getPendingSamples() const;                          ///< Get the number of samples waiting for the next flush.
+    Statistics getStatistics() const;                               ///< Get the current counters.
+
+public:
+    static constexpr std::size_t maxDatagramSize = 1472;            ///< Maximum UDP payload (fits into a 1500 byte Ethernet MTU).
+
+private:
+    /*!
+     * \brief Columnar block of samples.
+     */
+    struct Block
+    {
+        std::vector<std::uint32_t> channels;                        ///< Channel indices (see \ref channelIds).
+        std::vector<std::int64_t> times;                            ///< Sample times (nanoseconds since Unix epoch).
+        std::vector<SlowControlPoller::ValueType> values;           ///< Sample values.
+    };
+    //
+    struct Connection;                                              ///< Backend socket or file.
+
+private:
+    void append(const std::vector<SlowControlPoller::UpdateType>& pUpdates);   ///< Add new item values to the active block.
+    std::size_t formatBlock();                                      ///< Format the flushed block as line protocol.
+    void write();                                                   ///< Write the formatted lines to the backend.
+
+private:
+    SlowControlPoller& poller;                                      ///< The poller.
+    const Backend backend;                                          ///< Destination of the archived samples.
+    const std::string target;                                       ///< Backend address or file path.
+    const std::string measurement;                                  ///< Line protocol measurement name (escaped).
+    const std::size_t blockSize;                                    ///< Maximum number of samples per block.
+    //
+    Block activeBlock;                                              ///< Block receiving new samples.
+    std::unordered_map<std::string, std::uint32_t> channelIds;      ///< Channel indices by item path.
+    std::vector<std::string> newChannelKeys;                        ///< Series keys of channels added since the last flush.
+    bool flushPending;                                              ///< Whether an immediate flush was scheduled for a full block.
+    Statistics statistics;                                          ///< Current counters.
+    mutable std::mutex mutex;                                       ///< Protects all of the above members except the constant ones.
+    //
+    Block flushBlock;                                               ///< Block being flushed.
+    std::vector<std::string> channelKeys;                           ///< Series keys (measurement and channel tag) by channel index.
+    std::string lineBuffer;                                         ///< Formatted lines of \ref flushBlock.
+    const std::unique_ptr<Connection> connection;                   ///< Backend socket or file.
+    std::mutex flushMutex;                                          ///< Protects all of the above members except the constant ones.
+    //
+    SlowControlPoller::SinkId sinkId;                               ///< ID of the poller sink.
+    Scheduler scheduler;                                            ///< Scheduler for the periodic flushes.
+};
+
+} // namespace casil
+
+#endif // CASIL_SLOWCONTROLARCHIVER_H
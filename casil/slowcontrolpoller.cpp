@@ -0,0 +1,617 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/slowcontrolpoller.h>
+
+#include <casil/logger.h>
+#include <casil/HL/registerdriver.h>
+#include <casil/HL/Direct/scpi.h>
+
+#include <algorithm>
+#include <exception>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+
+using casil::SlowControlPoller;
+
+/*!
+ * \brief Constructor.
+ *
+ * Starts polling with period \p pTick (items are only read once subscriptions exist).
+ *
+ * \throws std::invalid_argument If \p pTick is not positive.
+ *
+ * \param pTick Tick to which all subscription periods are aligned.
+ */
+SlowControlPoller::SlowControlPoller(const std::chrono::milliseconds pTick) :
+    tick(pTick),
+    startTime(std::chrono::steady_clock::now()),
+    sources(),
+    subscriptions(),
+    nextId(0),
+    sinks(),
+    nextSinkId(0),
+    statistics{.batches = 0, .itemReads = 0, .deliveries = 0, .failures = 0},
+    mutex(),
+    sinkMutex(),
+    cache(std::make_shared<const CacheMapType>()),
+    scheduler(std::chrono::nanoseconds::zero())
+{
+    if (tick <= std::chrono::milliseconds::zero())
+        throw std::invalid_argument("Tick of slow-control poller must be positive.");
+
+    scheduler.schedulePeriodic([this]() -> void { poll(); }, tick);
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Stops polling. A poll that is currently executed (including its callbacks) is finished.
+ */
+SlowControlPoller::~SlowControlPoller() = default;
+
+//Public
+
+/*!
+ * \brief Subscribe to periodic readings of an SCPI query command.
+ *
+ * Merges the subscription with all other subscriptions of the same command and channel of \p pSCPI.
+ * See also the class description for the period alignment.
+ *
+ * \throws std::invalid_argument If \p pCmd is not a query command of \p pSCPI (for \p pChannel).
+ * \throws std::invalid_argument If \p pPeriod is not positive.
+ *
+ * \param pSCPI The SCPI driver.
+ * \param pCmd Name of the query command.
+ * \param pChannel Device's channel number, if applicable (no value or -1 for no channel).
+ * \param pPeriod Requested notification period (rounded to a multiple of the tick).
+ * \param pCallback Callback for new values.
+ * \return ID of the subscription.
+ */
+SlowControlPoller::SubscriptionId SlowControlPoller::subscribe(const HL::SCPI& pSCPI, const std::string& pCmd,
+                                                               const std::optional<int> pChannel, const std::chrono::milliseconds pPeriod,
+                                                               CallbackType pCallback)
+{
+    if (!pSCPI.handle(pCmd, pChannel).isQuery())
+        throw std::invalid_argument("Cannot poll \"" + pCmd + "\" because it is not a query command.");
+
+    return addSubscription(&pSCPI, &pSCPI, ItemKey{.name = pCmd, .channel = (pChannel.has_value() ? *pChannel : -1)},
+                           pPeriod, std::move(pCallback));
+}
+
+/*!
+ * \brief Subscribe to periodic readings of a register.
+ *
+ * Merges the subscription with all other subscriptions of the same register of \p pDriver.
+ * See also the class description for the period alignment.
+ *
+ * \throws std::invalid_argument If \p pRegName is not a register of \p pDriver (see HL::RegisterDriver::testRegisterName()).
+ * \throws std::invalid_argument If \p pPeriod is not positive.
+ *
+ * \param pDriver The register driver.
+ * \param pRegName Name of the register.
+ * \param pPeriod Requested notification period (rounded to a multiple of the tick).
+ * \param pCallback Callback for new values.
+ * \return ID of the subscription.
+ */
+SlowControlPoller::SubscriptionId SlowControlPoller::subscribe(const HL::RegisterDriver& pDriver, const std::string& pRegName,
+                                                               const std::chrono::milliseconds pPeriod, CallbackType pCallback)
+{
+    pDriver.testRegisterName(pRegName);
+
+    return addSubscription(&pDriver, &pDriver, ItemKey{.name = pRegName, .channel = -1}, pPeriod, std::move(pCallback));
+}
+
+/*!
+ * \brief Remove a subscription.
+ *
+ * Stops polling the subscription's item if this was its last subscription. A callback that is
+ * currently executed for the subscription is finished (i.e. it may still run after this returns).
+ *
+ * \param pId ID of the subscription.
+ * \return True if the subscription existed.
+ */
+bool SlowControlPoller::unsubscribe(const SubscriptionId pId)
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    const auto subIt = subscriptions.find(pId);
+
+    if (subIt == subscriptions.end())
+        return false;
+
+    const auto& [driverKey, itemKey] = subIt->second;
+
+    Source& source = sources.at(driverKey);
+    Item& item = source.items.at(itemKey);
+
+    item.subscribers.erase(pId);
+
+    if (item.subscribers.empty())
+    {
+        updateCacheMap(item.path, nullptr);
+        source.items.erase(itemKey);
+    }
+    else
+        item.periodTicks = computePeriodTicks(item.subscribers);
+
+    if (source.items.empty())
+        sources.erase(driverKey);
+
+    subscriptions.erase(subIt);
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Add a sink for all new item values.
+ *
+ * After each successful batched read of a driver, \p pSink is called with the paths and new samples of all items
+ * read by the batch (in the format of getLatest() and getPaths()), regardless of the subscription periods.
+ *
+ * \param pSink Sink for the new item values.
+ * \return ID of the sink.
+ */
+SlowControlPoller::SinkId SlowControlPoller::addSink(SinkType pSink)
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    const SinkId id = nextSinkId++;
+
+    sinks.emplace(id, std::make_shared<const SinkType>(std::move(pSink)));
+
+    return id;
+}
+
+/*!
+ * \brief Remove a sink.
+ *
+ * Waits for a currently executed call of the sink to finish, i.e. the sink is not called anymore after this returns.
+ *
+ * \param pId ID of the sink.
+ * \return True if the sink existed.
+ */
+bool SlowControlPoller::removeSink(const SinkId pId)
+{
+    const std::lock_guard<std::mutex> sinkLock(sinkMutex);
+    (void)sinkLock;
+
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    return sinks.erase(pId) > 0;
+}
+
+//
+
+/*!
+ * \brief Get the last polled value of a subscription's item.
+ *
+ * \param pId ID of the subscription.
+ * \return Cached value (\c std::monostate if the subscription does not exist or its item was not read yet).
+ */
+SlowControlPoller::ValueType SlowControlPoller::getCachedValue(const SubscriptionId pId) const
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    const auto subIt = subscriptions.find(pId);
+
+    if (subIt == subscriptions.end())
+        return std::monostate{};
+
+    const std::shared_ptr<const Sample> sample = sources.at(subIt->second.first).items.at(subIt->second.second).cacheSlot->sample.load();
+
+    if (!sample)
+        return std::monostate{};
+
+    return sample->value;
+}
+
+/*!
+ * \brief Get the latest published value of an item without locking.
+ *
+ * Only atomically loads the current cache and the item's current Sample (see also the class description),
+ * i.e. this never waits for the poller or for other readers. The returned sample is immutable and remains
+ * valid even if the item is updated or removed meanwhile.
+ *
+ * See the class description for the format of \p pPath (see also getPaths()).
+ *
+ * \param pPath Path of the item.
+ * \return Latest sample or null if the item is not polled or was not read yet.
+ */
+std::shared_ptr<const SlowControlPoller::Sample> SlowControlPoller::getLatest(const std::string_view pPath) const
+{
+    const std::shared_ptr<const CacheMapType> cacheMap = cache.load(std::memory_order_acquire);
+
+    const auto it = cacheMap->find(pPath);
+
+    if (it == cacheMap->end())
+        return nullptr;
+
+    return it->second->sample.load(std::memory_order_acquire);
+}
+
+/*!
+ * \brief Get the paths of all polled items.
+ *
+ * See getLatest().
+ *
+ * \return Item paths in lexicographical order.
+ */
+std::vector<std::string> SlowControlPoller::getPaths() const
+{
+    const std::shared_ptr<const CacheMapType> cacheMap = cache.load(std::memory_order_acquire);
+
+    std::vector<std::string> paths;
+    paths.reserve(cacheMap->size());
+
+    for (const auto& it : *cacheMap)
+        paths.push_back(it.first);
+
+    return paths;
+}
+
+/*!
+ * \brief Get the number of distinct polled items.
+ *
+ * Subscriptions of the same reading count as a single item.
+ *
+ * \return Number of items of all drivers.
+ */
+std::size_t SlowControlPoller::getItemCount() const
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    std::size_t count = 0;
+
+    for (const auto& it : sources)
+        count += it.second.items.size();
+
+    return count;
+}
+
+/*!
+ * \brief Get the current counters.
+ *
+ * \return Counters since construction.
+ */
+SlowControlPoller::Statistics SlowControlPoller::getStatistics() const
+{
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    return statistics;
+}
+
+/*!
+ * \brief Get the tick to which all periods are aligned.
+ *
+ * \return Tick duration.
+ */
+std::chrono::milliseconds SlowControlPoller::getTick() const
+{
+    return tick;
+}
+
+//Private
+
+/*!
+ * \brief Register a subscriber for an item.
+ *
+ * Creates the item if it is not polled yet and updates its polling period.
+ *
+ * \throws std::invalid_argument If \p pPeriod is not positive.
+ *
+ * \param pDriverKey Driver identity used to merge items.
+ * \param pDriver The driver.
+ * \param pItemKey The item.
+ * \param pPeriod Requested notification period.
+ * \param pCallback Callback for new values.
+ * \return ID of the subscription.
+ */
+SlowControlPoller::SubscriptionId SlowControlPoller::addSubscription(const HL::Driver* const pDriverKey, const DriverType pDriver,
+                                                                     ItemKey pItemKey, const std::chrono::milliseconds pPeriod,
+                                                                     CallbackType pCallback)
+{
+    if (pPeriod <= std::chrono::milliseconds::zero())
+        throw std::invalid_argument("Polling period must be positive.");
+
+    const std::uint64_t periodTicks = std::max<std::uint64_t>(1, (pPeriod + tick / 2) / tick);
+
+    const std::lock_guard<std::mutex> stateLock(mutex);
+    (void)stateLock;
+
+    const SubscriptionId id = nextId++;
+
+    Source& source = sources.try_emplace(pDriverKey, Source{.driver = pDriver, .items = {}}).first->second;
+
+    auto itemIt = source.items.find(pItemKey);
+
+    if (itemIt == source.items.end())
+    {
+        std::string path = pDriverKey->getName() + "." + pItemKey.name;
+
+        if (pItemKey.channel != -1)
+            path += "[" + std::to_string(pItemKey.channel) + "]";
+
+        auto cacheSlot = std::make_shared<CacheSlot>();
+
+        updateCacheMap(path, cacheSlot);
+
+        itemIt = source.items.emplace(pItemKey, Item{.subscribers = {}, .periodTicks = periodTicks, .path = std::move(path),
+                                                     .cacheSlot = std::move(cacheSlot)}).first;
+    }
+
+    Item& item = itemIt->second;
+
+    item.subscribers.emplace(id, Subscriber{.callback = std::make_shared<const CallbackType>(std::move(pCallback)),
+                                            .periodTicks = periodTicks});
+    item.periodTicks = computePeriodTicks(item.subscribers);
+
+    subscriptions.emplace(id, std::make_pair(pDriverKey, std::move(pItemKey)));
+
+    return id;
+}
+
+/*!
+ * \brief Publish a copy of the cache with an added/removed entry.
+ *
+ * Replaces \ref cache as a whole (copy-on-write), such that concurrent readers keep using the previous (immutable) map.
+ * Must be called with \ref mutex locked.
+ *
+ * \param pPath Item path.
+ * \param pSlot New cache entry for \p pPath or null to remove the entry.
+ */
+void SlowControlPoller::updateCacheMap(const std::string& pPath, std::shared_ptr<CacheSlot> pSlot)
+{
+    auto cacheMap = std::make_shared<CacheMapType>(*cache.load(std::memory_order_acquire));
+
+    if (pSlot)
+        (*cacheMap)[pPath] = std::move(pSlot);
+    else
+        cacheMap->erase(pPath);
+
+    cache.store(std::move(cacheMap), std::memory_order_release);
+}
+
+/*!
+ * \brief Read all items due at the current tick and notify subscribers.
+ *
+ * Determines the tick index from the elapsed time since construction, reads the due items of each driver with a single
+ * batched call (without holding the lock), publishes the new values to the cache and then calls the callbacks of all due subscribers
+ * and all sinks.
+ */
+void SlowControlPoller::poll()
+{
+    const std::uint64_t tickIdx = (std::chrono::steady_clock::now() - startTime + tick / 2) / tick;
+
+    std::vector<std::tuple<const HL::Driver*, DriverType, std::vector<ItemKey>>> dueItems;
+
+    {
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        for (const auto& [driverKey, source] : sources)
+        {
+            std::vector<ItemKey> itemKeys;
+
+            for (const auto& [itemKey, item] : source.items)
+                if (tickIdx % item.periodTicks == 0)
+                    itemKeys.push_back(itemKey);
+
+            if (!itemKeys.empty())
+                dueItems.emplace_back(driverKey, source.driver, std::move(itemKeys));
+        }
+    }
+
+    for (const auto& [driverKey, driver, itemKeys] : dueItems)
+    {
+        std::vector<ValueType> values;
+
+        try
+        {
+            values = readItems(driver, itemKeys);
+        }
+        catch (const std::exception& exc)
+        {
+            Logger::logError(std::string("Slow-control poller could not read ") + std::to_string(itemKeys.size()) + " items: " + exc.what());
+
+            const std::lock_guard<std::mutex> stateLock(mutex);
+            (void)stateLock;
+
+            ++statistics.failures;
+
+            continue;
+        }
+
+        const std::chrono::system_clock::time_point readTime = std::chrono::system_clock::now();
+
+        std::vector<std::pair<std::shared_ptr<const CallbackType>, std::shared_ptr<const Sample>>> deliveries;
+        std::vector<UpdateType> updates;
+        bool hasSinks = false;
+
+        {
+            const std::lock_guard<std::mutex> stateLock(mutex);
+            (void)stateLock;
+
+            ++statistics.batches;
+            statistics.itemReads += itemKeys.size();
+
+            const auto sourceIt = sources.find(driverKey);
+
+            if (sourceIt == sources.end())
+                continue;
+
+            hasSinks = !sinks.empty();
+
+            if (hasSinks)
+                updates.reserve(itemKeys.size());
+
+            for (std::size_t i = 0; i < itemKeys.size(); ++i)
+            {
+                const auto itemIt = sourceIt->second.items.find(itemKeys[i]);
+
+                if (itemIt == sourceIt->second.items.end())
+                    continue;
+
+                CacheSlot& cacheSlot = *itemIt->second.cacheSlot;
+
+                const std::shared_ptr<const Sample> prevSample = cacheSlot.sample.load(std::memory_order_relaxed);
+
+                auto sample = std::make_shared<const Sample>(Sample{.value = std::move(values[i]), .time = readTime,
+                                                                    .sequence = (prevSample ? prevSample->sequence + 1 : 1)});
+
+                cacheSlot.sample.store(sample, std::memory_order_release);
+
+                if (hasSinks)
+                    updates.emplace_back(itemIt->second.path, sample);
+
+                for (const auto& it : itemIt->second.subscribers)
+                    if (tickIdx % it.second.periodTicks == 0)
+                        deliveries.emplace_back(it.second.callback, sample);
+            }
+        }
+
+        std::uint64_t delivered = 0;
+        std::uint64_t failed = 0;
+
+        for (const auto& [callback, sample] : deliveries)
+        {
+            try
+            {
+                (*callback)(sample->value);
+                ++delivered;
+            }
+            catch (const std::exception& exc)
+            {
+                Logger::logError(std::string("Slow-control poller subscriber callback failed: ") + exc.what());
+                ++failed;
+            }
+        }
+
+        if (hasSinks)
+        {
+            //Get the sinks only after locking the sink mutex, such that removed sinks are never called
+
+            const std::lock_guard<std::mutex> sinkLock(sinkMutex);
+            (void)sinkLock;
+
+            std::vector<std::shared_ptr<const SinkType>> currentSinks;
+
+            {
+                const std::lock_guard<std::mutex> stateLock(mutex);
+                (void)stateLock;
+
+                for (const auto& it : sinks)
+                    currentSinks.push_back(it.second);
+            }
+
+            for (const std::shared_ptr<const SinkType>& sink : currentSinks)
+            {
+                try
+                {
+                    (*sink)(updates);
+                }
+                catch (const std::exception& exc)
+                {
+                    Logger::logError(std::string("Slow-control poller sink failed: ") + exc.what());
+                    ++failed;
+                }
+            }
+        }
+
+        const std::lock_guard<std::mutex> stateLock(mutex);
+        (void)stateLock;
+
+        statistics.deliveries += delivered;
+        statistics.failures += failed;
+    }
+}
+
+//
+
+/*!
+ * \brief Read multiple items of a driver with a single batched call.
+ *
+ * Uses HL::SCPI::batch() for SCPI drivers and HL::RegisterDriver::getMultiple() for register drivers.
+ *
+ * \throws std::runtime_error If the batched read fails.
+ * \throws std::invalid_argument If an item cannot be read.
+ *
+ * \param pDriver The driver.
+ * \param pItemKeys The items.
+ * \return Values in order of \p pItemKeys.
+ */
+std::vector<SlowControlPoller::ValueType> SlowControlPoller::readItems(const DriverType& pDriver, const std::vector<ItemKey>& pItemKeys)
+{
+    std::vector<ValueType> values;
+    values.reserve(pItemKeys.size());
+
+    if (std::holds_alternative<const HL::SCPI*>(pDriver))
+    {
+        std::vector<HL::SCPI::BatchCommand> cmds;
+        cmds.reserve(pItemKeys.size());
+
+        for (const ItemKey& itemKey : pItemKeys)
+            cmds.push_back(HL::SCPI::BatchCommand{.cmd = itemKey.name, .channel = itemKey.channel, .value = std::monostate{}});
+
+        for (const HL::SCPI::VariantValueType& response : std::get<const HL::SCPI*>(pDriver)->batch(cmds))
+            values.push_back(std::visit([](const auto& pValue) -> ValueType { return pValue; }, response));
+    }
+    else
+    {
+        std::vector<std::string> regNames;
+        regNames.reserve(pItemKeys.size());
+
+        for (const ItemKey& itemKey : pItemKeys)
+            regNames.push_back(itemKey.name);
+
+        for (auto& content : std::get<const HL::RegisterDriver*>(pDriver)->getMultiple(regNames))
+            values.push_back(std::visit([](auto&& pValue) -> ValueType { return std::move(pValue); }, std::move(content)));
+    }
+
+    return values;
+}
+
+/*!
+ * \brief Get the GCD of the subscribers' periods.
+ *
+ * \param pSubscribers The subscribers.
+ * \return Polling period of an item in ticks.
+ */
+std::uint64_t SlowControlPoller::computePeriodTicks(const std::map<SubscriptionId, Subscriber>& pSubscribers)
+{
+    std::uint64_t periodTicks = 0;
+
+    for (const auto& it : pSubscribers)
+        periodTicks = std::gcd(periodTicks, it.second.periodTicks);
+
+    return periodTicks;
+}
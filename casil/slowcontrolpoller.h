@@ -0,0 +1,219 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_SLOWCONTROLPOLLER_H
+#define CASIL_SLOWCONTROLPOLLER_H
+
+#include <casil/scheduler.h>
+
+#include <atomic>
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::HL { class Driver; class RegisterDriver; class SCPI; }
+
+/*!
+ * \brief Shared polling service for slow-control readings (SCPI queries and RegisterDriver registers).
+ *
+ * Components subscribe to a reading (an SCPI query command or a register) with a polling period and a callback.
+ * Identical readings of different subscribers are merged into a single polled \e item, such that each reading is
+ * transferred only once per period regardless of the number of subscribers. The cached value of an item is
+ * distributed to all of its subscribers.
+ *
+ * Polling happens on a fixed \e tick grid (see SlowControlPoller()) driven by an own Scheduler. Subscription periods
+ * are rounded to a multiple of the tick and an item is polled at every tick index that is a multiple of the
+ * greatest common divisor of its subscribers' periods (in ticks). A subscriber is notified at every tick index that is
+ * a multiple of its own period. Since the periods are aligned to the same grid, all items of the same driver that are
+ * due at a tick are read with a single batched call (see HL::SCPI::batch() and HL::RegisterDriver::getMultiple()).
+ *
+ * Independent of the callbacks, the latest value of each item is published to a snapshot cache keyed by its \e path
+ * (<tt>DRIVER.COMMAND</tt> or <tt>DRIVER.COMMAND[CHANNEL]</tt> for SCPI channels, <tt>DRIVER.REGISTER</tt> for registers;
+ * see getLatest()). The cache is updated RCU-style: the poller atomically replaces an immutable Sample and readers only
+ * atomically load the current one, such that any number of reader threads never block the poller or each other.
+ *
+ * In addition, \e sinks (see addSink()) receive all new item values of each batched read together with the item paths,
+ * independent of the subscription periods (e.g. for archiving all polled values, see SlowControlArchiver).
+ *
+ * Callbacks and sinks are executed by the scheduler thread, without holding internal locks (except that sinks are
+ * serialized with removeSink()). Failed reads and throwing callbacks/sinks are logged and counted (see Statistics).
+ * The polled drivers must outlive their subscriptions. The functions of this class are thread-safe, but must not be
+ * called from within callbacks or sinks, except for unsubscribe(), getCachedValue(), getLatest(), getPaths() and getStatistics().
+ */
+class SlowControlPoller
+{
+public:
+    using ValueType = std::variant<std::monostate, std::string, int, double, std::uint64_t, std::vector<std::uint8_t>>;
+                                                                    ///< \brief Polled value (SCPI response: string/int/double,
+                                                                    ///  register: integer or byte sequence).
+    using CallbackType = std::function<void(const ValueType&)>;     ///< Subscriber callback for a new value.
+    using SubscriptionId = std::uint64_t;                           ///< Identifier of a subscription.
+    using SinkId = std::uint64_t;                                   ///< Identifier of a sink.
+
+    /*!
+     * \brief Snapshot of the poller counters (see getStatistics()).
+     */
+    struct Statistics
+    {
+        std::uint64_t batches;          ///< Number of batched driver reads.
+        std::uint64_t itemReads;        ///< Number of item values read by all batches.
+        std::uint64_t deliveries;       ///< Number of values passed to subscriber callbacks.
+        std::uint64_t failures;         ///< Number of failed batched reads plus number of throwing callbacks and sinks.
+    };
+
+    /*!
+     * \brief Immutable published value of an item (see getLatest()).
+     */
+    struct Sample
+    {
+        ValueType value;                                ///< Polled value.
+        std::chrono::system_clock::time_point time;     ///< Time when the value was read.
+        std::uint64_t sequence;                         ///< Number of the item's update (starts at one; changes with every new value).
+    };
+
+    using UpdateType = std::pair<std::string, std::shared_ptr<const Sample>>;   ///< New value of an item (item path and sample).
+    using SinkType = std::function<void(const std::vector<UpdateType>&)>;       ///< Sink for the new item values of a batched read.
+
+public:
+    explicit SlowControlPoller(std::chrono::milliseconds pTick = std::chrono::milliseconds(100));   ///< Constructor.
+    SlowControlPoller(const SlowControlPoller&) = delete;           ///< Deleted copy constructor.
+    SlowControlPoller(SlowControlPoller&&) = delete;                ///< Deleted move constructor.
+    ~SlowControlPoller();                                           ///< Destructor.
+    //
+    SlowControlPoller& operator=(SlowControlPoller) = delete;       ///< Deleted copy assignment operator.
+    SlowControlPoller& operator=(SlowControlPoller&&) = delete;     ///< Deleted move assignment operator.
+    //
+    SubscriptionId subscribe(const Layers::HL::SCPI& pSCPI, const std::string& pCmd, std::optional<int> pChannel,
+                             std::chrono::milliseconds pPeriod, CallbackType pCallback);
+                                                                    ///< Subscribe to periodic readings of an SCPI query command.
+    SubscriptionId subscribe(const Layers::HL::RegisterDriver& pDriver, const std::string& pRegName,
+                             std::chrono::milliseconds pPeriod, CallbackType pCallback);
+                                                                    ///< Subscribe to periodic readings of a register.
+    bool unsubscribe(SubscriptionId pId);                           ///< Remove a subscription.
+    //
+    SinkId addSink(SinkType pSink);                                 ///< Add a sink for all new item values.
+    bool removeSink(SinkId pId);                                    ///< Remove a sink.
+    //
+    ValueType getCachedValue(SubscriptionId pId) const;             ///< Get the last polled value of a subscription's item.
+    std::shared_ptr<const Sample> getLatest(std::string_view pPath) const;  ///< Get the latest published value of an item without locking.
+    std::vector<std::string> getPaths() const;                      ///< Get the paths of all polled items.
+    std::size_t getItemCount() const;                               ///< Get the number of distinct polled items.
+    Statistics getStatistics() const;                               ///< Get the current counters.
+    std::chrono::milliseconds getTick() const;                      ///< Get the tick to which all periods are aligned.
+
+private:
+    using DriverType = std::variant<const Layers::HL::SCPI*, const Layers::HL::RegisterDriver*>;   ///< Polled driver.
+
+    /*!
+     * \brief Identifies a reading of a driver (command/register name and channel).
+     */
+    struct ItemKey
+    {
+        std::string name;                                           ///< SCPI command or register name.
+        int channel;                                                ///< SCPI channel (-1 for no channel or for registers).
+        //
+        auto operator<=>(const ItemKey&) const = default;           ///< Default comparison.
+    };
+    /*!
+     * \brief Snapshot cache entry of an item.
+     */
+    struct CacheSlot
+    {
+        std::atomic<std::shared_ptr<const Sample>> sample;          ///< Latest value (null if not read yet).
+    };
+    //
+    using CacheMapType = std::map<std::string, std::shared_ptr<CacheSlot>, std::less<>>;   ///< Cache entries by item path.
+    //
+    /*!
+     * \brief Subscriber of an item.
+     */
+    struct Subscriber
+    {
+        std::shared_ptr<const CallbackType> callback;               ///< Callback for new values.
+        std::uint64_t periodTicks;                                  ///< Notification period in ticks.
+    };
+    /*!
+     * \brief Merged reading of all subscribers of the same item.
+     */
+    struct Item
+    {
+        std::map<SubscriptionId, Subscriber> subscribers;           ///< Subscribers by subscription ID.
+        std::uint64_t periodTicks;                                  ///< Polling period in ticks (GCD of the subscribers' periods).
+        std::string path;                                           ///< Item path in \ref cache.
+        std::shared_ptr<CacheSlot> cacheSlot;                       ///< Entry in \ref cache (holds the last polled value).
+    };
+    /*!
+     * \brief All polled items of a driver.
+     */
+    struct Source
+    {
+        DriverType driver;                                          ///< The driver.
+        std::map<ItemKey, Item> items;                              ///< Items by key.
+    };
+
+private:
+    SubscriptionId addSubscription(const Layers::HL::Driver* pDriverKey, DriverType pDriver, ItemKey pItemKey,
+                                   std::chrono::milliseconds pPeriod, CallbackType pCallback);  ///< Register a subscriber for an item.
+    void updateCacheMap(const std::string& pPath, std::shared_ptr<CacheSlot> pSlot);   ///< Publish a copy of the cache with an added/removed entry.
+    void poll();                                                    ///< Read all items due at the current tick and notify subscribers.
+    //
+    static std::vector<ValueType> readItems(const DriverType& pDriver, const std::vector<ItemKey>& pItemKeys);
+                                                                    ///< Read multiple items of a driver with a single batched call.
+    static std::uint64_t computePeriodTicks(const std::map<SubscriptionId, Subscriber>& pSubscribers);
+                                                                    ///< Get the GCD of the subscribers' periods.
+
+private:
+    const std::chrono::milliseconds tick;                           ///< Tick to which all periods are aligned.
+    const std::chrono::steady_clock::time_point startTime;          ///< Time of tick index zero.
+    //
+    std::map<const Layers::HL::Driver*, Source> sources;            ///< Polled drivers.
+    std::map<SubscriptionId, std::pair<const Layers::HL::Driver*, ItemKey>> subscriptions;    ///< Items of the subscriptions.
+    SubscriptionId nextId;                                          ///< ID for the next subscription.
+    std::map<SinkId, std::shared_ptr<const SinkType>> sinks;        ///< Sinks by ID.
+    SinkId nextSinkId;                                              ///< ID for the next sink.
+    Statistics statistics;                                          ///< Current counters.
+    mutable std::mutex mutex;                                       ///< Protects all of the above members except the constant ones.
+    std::mutex sinkMutex;                                           ///< Serializes sink executions with removeSink().
+    //
+    std::atomic<std::shared_ptr<const CacheMapType>> cache;         ///< \brief Snapshot cache of the latest item values
+                                                                    ///  (replaced as a whole under \ref mutex when items change).
+    //
+    Scheduler scheduler;                                            ///< Scheduler for the polling ticks.
+};
+
+} // namespace casil
+
+#endif // CASIL_SLOWCONTROLPOLLER_H
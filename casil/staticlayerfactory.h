@@ -0,0 +1,332 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_STATICLAYERFACTORY_H
+#define CASIL_STATICLAYERFACTORY_H
+
+#include <casil/concepts.h>
+#include <casil/layerconfig.h>
+#include <casil/layerfactory.h>
+#include <casil/HL/driver.h>
+#include <casil/RL/register.h>
+#include <casil/TL/interface.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace casil
+{
+
+/// \cond INTERNAL
+/*!
+ * \brief Implementation details for StaticLayerFactory.
+ */
+namespace StaticLayerFactoryImpl
+{
+
+/*!
+ * \brief Calculate the 64 bit FNV-1a hash of a component type name.
+ *
+ * \param pTypeName The type name.
+ * \return The hash value.
+ */
+constexpr std::uint64_t hashTypeName(const std::string_view pTypeName)
+{
+    std::uint64_t hash = 0xCBF29CE484222325;
+
+    for (const char c : pTypeName)
+    {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x100000001B3;
+    }
+
+    return hash;
+}
+
+/*!
+ * \brief Check if the type name hashes of all components of one layer are distinct.
+ *
+ * \tparam BaseT Layer base class (\ref casil::Layers::TL::Interface "TL::Interface", \ref casil::Layers::HL::Driver "HL::Driver"
+ *               or \ref casil::Layers::RL::Register "RL::Register").
+ * \tparam ComponentTs Component classes.
+ * \return True if no two components derived from \p BaseT have the same type name hash.
+ */
+template<typename BaseT, typename... ComponentTs>
+consteval bool typeNameHashesUnique()
+{
+    constexpr std::array<bool, sizeof...(ComponentTs)> inLayer = {std::is_base_of_v<BaseT, ComponentTs>...};
+    constexpr std::array<std::uint64_t, sizeof...(ComponentTs)> hashes = {hashTypeName(ComponentTs::typeName)...};
+
+    for (std::size_t i = 0; i < hashes.size(); ++i)
+        for (std::size_t j = i + 1; j < hashes.size(); ++j)
+            if (inLayer[i] && inLayer[j] && hashes[i] == hashes[j])
+                return false;
+
+    return true;
+}
+
+} // namespace StaticLayerFactoryImpl
+/// \endcond INTERNAL
+
+/*!
+ * \brief Compile-time registry of layer components as alternative to the static-initialization-time registration of the LayerFactory.
+ *
+ * The component classes \p ComponentTs (interfaces, drivers and registers in any order) are fixed at compile time.
+ * createInterface() / createDriver() / createRegister() select the class to construct by comparing the hash of the requested
+ * type name against the type name hashes of the listed classes (see \ref CASIL_REGISTER_INTERFACE_H etc.), which are computed
+ * at compile time, such that the dispatch compiles to a chain of integer comparisons instead of map lookups. Aliases
+ * (see e.g. \ref CASIL_REGISTER_INTERFACE_ALIAS) are not known to this registry, only the primary type names.
+ *
+ * Use install() to let LayerFactory (and thereby \ref casil::Device "Device") construct the listed components.
+ * Together with building the library with \c CASIL_DISABLE_AUTO_REGISTRATION (see \ref layerfactorymacros.h) this
+ * avoids any registration work at static initialization time and, when linking statically, unused components
+ * are not even pulled into the binary, since they are only referenced by the instantiated registry:
+ *
+ * \code{.cpp}
+ * using Registry = casil::StaticLayerFactory<casil::TL::SiTCP, casil::HL::GPIO, casil::RL::StandardRegister>;
+ * Registry::install();
+ * casil::Device device(yamlConfig);
+ * \endcode
+ *
+ * \tparam ComponentTs Component classes (with registered type names) to be constructible via the registry.
+ */
+template<typename... ComponentTs>
+    requires ((Concepts::HasRegisteredTypeName<ComponentTs> &&
+               (Concepts::IsInterface<ComponentTs> || Concepts::IsDriver<ComponentTs> || Concepts::IsRegister<ComponentTs>)) && ...)
+class StaticLayerFactory
+{
+private:
+    using Interface = Layers::TL::Interface;    ///< \copybrief casil::Layers::TL::Interface
+    using Driver = Layers::HL::Driver;          ///< \copybrief casil::Layers::HL::Driver
+    using Register = Layers::RL::Register;      ///< \copybrief casil::Layers::RL::Register
+
+    static_assert(StaticLayerFactoryImpl::typeNameHashesUnique<Interface, ComponentTs...>(), "Interface type names are not unique.");
+    static_assert(StaticLayerFactoryImpl::typeNameHashesUnique<Driver, ComponentTs...>(), "Driver type names are not unique.");
+    static_assert(StaticLayerFactoryImpl::typeNameHashesUnique<Register, ComponentTs...>(), "Register type names are not unique.");
+
+public:
+    StaticLayerFactory() = delete;                                                          ///< Deleted constructor.
+    //
+    static std::unique_ptr<Interface> createInterface(std::string_view pType, std::string&& pName, LayerConfig&& pConfig);
+                                                                                            ///< Construct a listed interface type.
+    static std::unique_ptr<Driver> createDriver(std::string_view pType, std::string&& pName, Interface& pInterface, LayerConfig&& pConfig);
+                                                                                            ///< Construct a listed driver type.
+    static std::unique_ptr<Register> createRegister(std::string_view pType, std::string&& pName, Driver& pDriver, LayerConfig&& pConfig);
+                                                                                            ///< Construct a listed register type.
+    //
+    static void install();                                                                  ///< Install the registry to the LayerFactory.
+
+private:
+    template<typename BaseT, typename ComponentT, typename... ArgTs>
+    static bool tryCreate(std::uint64_t pHash, std::string_view pType, std::unique_ptr<BaseT>& pComponent, ArgTs&... pArgs);
+                                                                                            ///< Construct a component if the type name matches.
+};
+
+//Public
+
+/*!
+ * \brief Construct a listed interface type.
+ *
+ * Constructs the interface class from \p ComponentTs whose type name equals \p pType with moved \p pName and \p pConfig.
+ * Returns \c nullptr (without moving from \p pName and \p pConfig) if there is no such interface class.
+ *
+ * \throws std::runtime_error If the class constructor throws \c std::runtime_error.
+ *
+ * \param pType Type name of the requested interface type.
+ * \param pName Instance name for the new interface component.
+ * \param pConfig Configuration for the new interface component.
+ * \return Pointer to the created \ref casil::Layers::TL::Interface "TL::Interface".
+ */
+template<typename... ComponentTs>
+    requires ((Concepts::HasRegisteredTypeName<ComponentTs> &&
+               (Concepts::IsInterface<ComponentTs> || Concepts::IsDriver<ComponentTs> || Concepts::IsRegister<ComponentTs>)) && ...)
+std::unique_ptr<Layers::TL::Interface> StaticLayerFactory<ComponentTs...>::createInterface(const std::string_view pType,
+                                                                                          std::string&& pName, LayerConfig&& pConfig)
+{
+    const std::uint64_t hash = StaticLayerFactoryImpl::hashTypeName(pType);
+
+    std::unique_ptr<Interface> component;
+    (void)(tryCreate<Interface, ComponentTs>(hash, pType, component, pName, pConfig) || ...);
+
+    return component;
+}
+
+/*!
+ * \brief Construct a listed driver type.
+ *
+ * Constructs the driver class from \p ComponentTs whose type name equals \p pType with moved \p pName and \p pConfig
+ * and with \p pInterface. Returns \c nullptr (without moving from \p pName and \p pConfig) if there is no such driver class.
+ *
+ * \throws std::runtime_error If the class constructor throws \c std::runtime_error.
+ * \throws std::runtime_error If \p pInterface has a wrong base type for the driver (direct vs. muxed).
+ *
+ * \param pType Type name of the requested driver type.
+ * \param pName Instance name for the new driver component.
+ * \param pInterface The interface instance for accessing the \ref casil::Layers::TL "TL".
+ * \param pConfig Configuration for the new driver component.
+ * \return Pointer to the created \ref casil::Layers::HL::Driver "HL::Driver".
+ */
+template<typename... ComponentTs>
+    requires ((Concepts::HasRegisteredTypeName<ComponentTs> &&
+               (Concepts::IsInterface<ComponentTs> || Concepts::IsDriver<ComponentTs> || Concepts::IsRegister<ComponentTs>)) && ...)
+std::unique_ptr<Layers::HL::Driver> StaticLayerFactory<ComponentTs...>::createDriver(const std::string_view pType, std::string&& pName,
+                                                                                    Interface& pInterface, LayerConfig&& pConfig)
+{
+    const std::uint64_t hash = StaticLayerFactoryImpl::hashTypeName(pType);
+
+    std::unique_ptr<Driver> component;
+    (void)(tryCreate<Driver, ComponentTs>(hash, pType, component, pName, pInterface, pConfig) || ...);
+
+    return component;
+}
+
+/*!
+ * \brief Construct a listed register type.
+ *
+ * Constructs the register class from \p ComponentTs whose type name equals \p pType with moved \p pName and \p pConfig
+ * and with \p pDriver. Returns \c nullptr (without moving from \p pName and \p pConfig) if there is no such register class.
+ *
+ * \throws std::runtime_error If the class constructor throws \c std::runtime_error.
+ *
+ * \param pType Type name of the requested register type.
+ * \param pName Instance name for the new register component.
+ * \param pDriver The driver instance for accessing the \ref casil::Layers::HL "HL".
+ * \param pConfig Configuration for the new register component.
+ * \return Pointer to the created \ref casil::Layers::RL::Register "RL::Register".
+ */
+template<typename... ComponentTs>
+    requires ((Concepts::HasRegisteredTypeName<ComponentTs> &&
+               (Concepts::IsInterface<ComponentTs> || Concepts::IsDriver<ComponentTs> || Concepts::IsRegister<ComponentTs>)) && ...)
+std::unique_ptr<Layers::RL::Register> StaticLayerFactory<ComponentTs...>::createRegister(const std::string_view pType, std::string&& pName,
+                                                                                        Driver& pDriver, LayerConfig&& pConfig)
+{
+    const std::uint64_t hash = StaticLayerFactoryImpl::hashTypeName(pType);
+
+    std::unique_ptr<Register> component;
+    (void)(tryCreate<Register, ComponentTs>(hash, pType, component, pName, pDriver, pConfig) || ...);
+
+    return component;
+}
+
+//
+
+/*!
+ * \brief Install the registry to the LayerFactory.
+ *
+ * Passes createInterface(), createDriver() and createRegister() to LayerFactory::useStaticRegistry(),
+ * such that LayerFactory (and thereby \ref casil::Device "Device") can construct all classes of \p ComponentTs.
+ *
+ * \note Not thread-safe. Call this before constructing any components.
+ */
+template<typename... ComponentTs>
+    requires ((Concepts::HasRegisteredTypeName<ComponentTs> &&
+               (Concepts::IsInterface<ComponentTs> || Concepts::IsDriver<ComponentTs> || Concepts::IsRegister<ComponentTs>)) && ...)
+void StaticLayerFactory<ComponentTs...>::install()
+{
+    LayerFactory::useStaticRegistry(&createInterface, &createDriver, &createRegister);
+}
+
+//Private
+
+/*!
+ * \brief Construct a component if the type name matches.
+ *
+ * Constructs \p ComponentT from \p pArgs (moving the name and configuration) and assigns it to \p pComponent if \p ComponentT
+ * is derived from \p BaseT and its type name equals \p pType. The type name hash comparison with the compile-time constant
+ * hash of \p ComponentT rejects almost all mismatches before the actual string comparison.
+ *
+ * For drivers, \c std::bad_cast exceptions (i.e. a wrong interface base type) are converted to \c std::runtime_error
+ * (like \ref CASIL_REGISTER_DRIVER_CPP does).
+ *
+ * \throws std::runtime_error If the class constructor throws \c std::runtime_error.
+ * \throws std::runtime_error If the interface passed to a driver has a wrong base type.
+ *
+ * \tparam BaseT Layer base class of the requested component.
+ * \tparam ComponentT Candidate component class.
+ * \tparam ArgTs Constructor argument types.
+ * \param pHash Type name hash of \p pType.
+ * \param pType Requested type name.
+ * \param pComponent Destination for the constructed component.
+ * \param pArgs Constructor arguments.
+ * \return True if \p ComponentT was constructed.
+ */
+template<typename... ComponentTs>
+    requires ((Concepts::HasRegisteredTypeName<ComponentTs> &&
+               (Concepts::IsInterface<ComponentTs> || Concepts::IsDriver<ComponentTs> || Concepts::IsRegister<ComponentTs>)) && ...)
+template<typename BaseT, typename ComponentT, typename... ArgTs>
+bool StaticLayerFactory<ComponentTs...>::tryCreate(const std::uint64_t pHash, const std::string_view pType,
+                                                   std::unique_ptr<BaseT>& pComponent, ArgTs&... pArgs)
+{
+    if constexpr (!std::is_base_of_v<BaseT, ComponentT>)
+    {
+        return false;
+    }
+    else
+    {
+        constexpr std::uint64_t typeHash = StaticLayerFactoryImpl::hashTypeName(ComponentT::typeName);
+
+        if (pHash != typeHash || pType != ComponentT::typeName)
+            return false;
+
+        if constexpr (std::is_same_v<BaseT, Driver>)
+        {
+            auto&& [name, interface, config] = std::forward_as_tuple(pArgs...);
+
+            try
+            {
+                pComponent = std::make_unique<ComponentT>(std::move(name), dynamic_cast<typename ComponentT::InterfaceBaseType&>(interface),
+                                                          std::move(config));
+            }
+            catch (const std::bad_cast&)
+            {
+                throw std::runtime_error("Incompatible interface type \"" + interface.getType() + "\" for use with \"" +
+                                         ComponentT::typeName + "\".");
+            }
+        }
+        else if constexpr (std::is_same_v<BaseT, Register>)
+        {
+            auto&& [name, driver, config] = std::forward_as_tuple(pArgs...);
+            pComponent = std::make_unique<ComponentT>(std::move(name), driver, std::move(config));
+        }
+        else
+        {
+            auto&& [name, config] = std::forward_as_tuple(pArgs...);
+            pComponent = std::make_unique<ComponentT>(std::move(name), std::move(config));
+        }
+
+        return true;
+    }
+}
+
+} // namespace casil
+
+#endif // CASIL_STATICLAYERFACTORY_H
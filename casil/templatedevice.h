@@ -32,8 +32,12 @@
 
 #include <boost/property_tree/ptree_fwd.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 
@@ -88,6 +92,19 @@ namespace TmplDevImpl
      */
     struct RegisterConfBase : public ComponentConfBase {};
 
+    /*!
+     * \brief Trivial differentiation of ComponentConfBase for register field layout descriptors.
+     *
+     * Used as base class for TmplDev::RegFieldConf.
+     */
+    struct RegFieldConfBase : public ComponentConfBase {};
+    /*!
+     * \brief Trivial differentiation of ComponentConfBase for register layout descriptors.
+     *
+     * Used as base class for TmplDev::RegLayoutConf.
+     */
+    struct RegLayoutConfBase : public ComponentConfBase {};
+
 } // namespace TmplDevImpl
 /// \endcond INTERNAL
 
@@ -151,7 +168,12 @@ struct DriverConf : public TmplDevImpl::DriverConfBase
  * - <tt>static constexpr char driver[] = "instance_name_of_the_used_driver"</tt>
  * - <tt>static constexpr char conf[] = "register: specific, yaml: configuration"</tt>
  *
- * \note Such a struct can be more easily defined via the \ref CASIL_DEFINE_REGISTER macro from \ref templatedevicemacros.h.
+ * For a \ref Layers::RL::StandardRegister "RL::StandardRegister" the derived struct can additionally declare a compile-time
+ * register layout as <tt>typedef RegLayoutConf<...> Layout</tt>. The "size" and "fields" configuration values are then
+ * generated from this layout and must hence not be part of \c conf.
+ *
+ * \note Such a struct can be more easily defined via the \ref CASIL_DEFINE_REGISTER macro from \ref templatedevicemacros.h
+ *       (or \ref CASIL_DEFINE_REGISTER_WITH_LAYOUT).
  *
  * \tparam T Registered register class implementing \ref Layers::RL::Register "RL::Register".
  */
@@ -166,6 +188,249 @@ struct RegisterConf : public TmplDevImpl::RegisterConfBase
 
 //
 
+/*!
+ * \brief String literal wrapper for using register field names as template arguments.
+ *
+ * Allows to pass a field name such as \c "FIELD_A" directly as (class type) non-type template argument
+ * of RegFieldConf or RegLayoutConf::Field, with the template argument \p N being deduced from the literal.
+ *
+ * \tparam N Size of the wrapped character array (including the terminating null character).
+ */
+template<std::size_t N>
+struct FieldName
+{
+    /*!
+     * \brief Constructor.
+     *
+     * Copies the string literal \p pName.
+     *
+     * \param pName Field name.
+     */
+    constexpr FieldName(const char (&pName)[N]) { std::copy_n(pName, N, str); }     // cppcheck-suppress noExplicitConstructor
+    /*!
+     * \brief Get the field name.
+     *
+     * \return The field name without terminating null character.
+     */
+    constexpr std::string_view view() const { return std::string_view(str, N-1); }
+    //
+    char str[N];    ///< Null-terminated field name.
+};
+
+/*!
+ * \brief Compile-time register field definition for RegLayoutConf.
+ *
+ * Describes a named register field with size \p fieldSize and offset \p fieldOffs (index of the field's most significant bit in
+ * the parent field) and its optional sub-fields \p SubFieldConfTs, equivalent to a field map of the "fields" sequence in the YAML
+ * configuration of \ref Layers::RL::StandardRegister "RL::StandardRegister" (see \ref Layers::RL::StandardRegister::StandardRegister()
+ * "StandardRegister::StandardRegister()"). Field repetitions and custom bit orders are not supported by compile-time layouts.
+ *
+ * Each sub-field must be fully contained within the field, which is checked at compile time.
+ *
+ * \tparam fieldName Name of the field.
+ * \tparam fieldSize Size of the field in number of bits.
+ * \tparam fieldOffs Index of the field's most significant bit in the parent field.
+ * \tparam SubFieldConfTs Sub-field definitions (each being a RegFieldConf).
+ */
+template<FieldName fieldName, std::uint64_t fieldSize, std::uint64_t fieldOffs, typename... SubFieldConfTs>
+struct RegFieldConf : public TmplDevImpl::RegFieldConfBase
+{
+    static_assert(fieldSize > 0, "Register field size must be larger than zero.");
+    static_assert(fieldOffs + 1 >= fieldSize, "Register field must not extend below the parent field's least significant bit.");
+    static_assert((std::is_base_of_v<TmplDevImpl::RegFieldConfBase, SubFieldConfTs> && ...),
+                  "Each sub-field must be specified by RegFieldConf.");
+    static_assert(((SubFieldConfTs::offs < fieldSize) && ...), "Register sub-field exceeds the extent of its parent field.");
+
+    static constexpr std::string_view name = fieldName.view();  ///< Name of the field.
+    static constexpr std::uint64_t size = fieldSize;            ///< Size of the field in number of bits.
+    static constexpr std::uint64_t offs = fieldOffs;            ///< Index of the field's most significant bit in the parent field.
+
+    typedef std::tuple<SubFieldConfTs...> SubFieldConfs;        ///< The sub-field definitions.
+
+    /*!
+     * \brief Generate the YAML field map for this field.
+     *
+     * \return YAML map with the "name", "size" and "offset" values and a "fields" sequence for the sub-fields.
+     */
+    static std::string toYAML()
+    {
+        std::string yamlMap = std::string("{name: ") + std::string(name) + ", size: " + std::to_string(size) +
+                              ", offset: " + std::to_string(offs);
+
+        if constexpr (sizeof...(SubFieldConfTs) > 0)
+        {
+            yamlMap += ", fields: [";
+            ((yamlMap += SubFieldConfTs::toYAML() + ", "), ...);
+            yamlMap.resize(yamlMap.size() - 2);
+            yamlMap += "]";
+        }
+
+        return yamlMap + "}";
+    }
+};
+
+/*!
+ * \brief Constant-offset accessor for a register field resolved from a RegLayoutConf.
+ *
+ * Accesses the field's bits through StandardRegister::setBitRange(), StandardRegister::getBitRange() and
+ * StandardRegister::getReadBitRange() with the field's total offset and size being compile-time constants,
+ * i.e. without any field name lookup (as for \ref Layers::RL::StandardRegister::operator[](const std::string&)
+ * "StandardRegister::operator[]()") and independent of the field tree.
+ *
+ * \tparam fieldTotalOffs Index of the field's most significant bit in the register.
+ * \tparam fieldSize Size of the field in number of bits.
+ */
+template<std::uint64_t fieldTotalOffs, std::uint64_t fieldSize>
+struct RegFieldAccess
+{
+    RegFieldAccess() = delete;  ///< Deleted constructor.
+
+    static constexpr std::uint64_t totalOffs = fieldTotalOffs;  ///< Index of the field's most significant bit in the register.
+    static constexpr std::uint64_t size = fieldSize;            ///< Size of the field in number of bits.
+
+    /*!
+     * \brief Assign equivalent integer value to the field.
+     *
+     * \tparam RegT Register type (\ref Layers::RL::StandardRegister "RL::StandardRegister").
+     * \param pReg Register to be modified.
+     * \param pValue Value to be assigned.
+     */
+    template<typename RegT>
+    static void set(RegT& pReg, const std::uint64_t pValue) { pReg.setBitRange(totalOffs, size, pValue); }
+    /*!
+     * \brief Get the integer equivalent of the field's content.
+     *
+     * \tparam RegT Register type (\ref Layers::RL::StandardRegister "RL::StandardRegister").
+     * \param pReg Register to be accessed.
+     * \return Unsigned integer value represented by the field's bits.
+     */
+    template<typename RegT>
+    static std::uint64_t get(const RegT& pReg) { return pReg.getBitRange(totalOffs, size); }
+    /*!
+     * \brief Get the integer equivalent of the field's driver readback content.
+     *
+     * \tparam RegT Register type (\ref Layers::RL::StandardRegister "RL::StandardRegister").
+     * \param pReg Register to be accessed.
+     * \return Unsigned integer value represented by the field's readback bits.
+     */
+    template<typename RegT>
+    static std::uint64_t getRead(const RegT& pReg) { return pReg.getReadBitRange(totalOffs, size); }
+};
+
+/// \cond INTERNAL
+namespace TmplDevImpl
+{
+    /*!
+     * \brief Find a field definition by name.
+     *
+     * \tparam fieldName Name of the field.
+     * \tparam FieldConfTs Field definitions (each being a RegFieldConf).
+     * \return Index of the field named \p fieldName in \p FieldConfTs or \c sizeof...(FieldConfTs) if there is no such field.
+     */
+    template<FieldName fieldName, typename... FieldConfTs>
+    constexpr std::size_t findRegField()
+    {
+        constexpr std::array<std::string_view, sizeof...(FieldConfTs)> names{FieldConfTs::name...};
+
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            if (names[i] == fieldName.view())
+                return i;
+        }
+
+        return sizeof...(FieldConfTs);
+    }
+
+    /*!
+     * \brief Resolve a field path to the field's total offset and size.
+     *
+     * Descends into \p FieldConfsT along \p fieldPath, where \p lsbIdx and \p size are the register bit index of
+     * the least significant bit and the size of the current (parent) field. Defines \c Type as the resolved RegFieldAccess.
+     *
+     * \tparam lsbIdx Index of the current field's least significant bit in the register.
+     * \tparam size Size of the current field.
+     * \tparam FieldConfsT Tuple of the current field's sub-field definitions.
+     * \tparam fieldPath Remaining field names along the path.
+     */
+    template<std::uint64_t lsbIdx, std::uint64_t size, typename FieldConfsT, FieldName... fieldPath>
+    struct ResolveRegField
+    {
+        typedef RegFieldAccess<lsbIdx + size - 1, size> Type;   ///< Accessor for the resolved field.
+    };
+
+    /*!
+     * \copydoc ResolveRegField
+     */
+    template<std::uint64_t lsbIdx, std::uint64_t size, typename... FieldConfTs, FieldName fieldName, FieldName... fieldPath>
+    struct ResolveRegField<lsbIdx, size, std::tuple<FieldConfTs...>, fieldName, fieldPath...>
+    {
+        static constexpr std::size_t idx = findRegField<fieldName, FieldConfTs...>();   ///< Index of the next field on the path.
+
+        static_assert(idx < sizeof...(FieldConfTs), "Register layout does not have the requested field.");
+
+        typedef std::tuple_element_t<idx, std::tuple<FieldConfTs...>> FieldConfT;       ///< Definition of the next field on the path.
+
+        typedef typename ResolveRegField<lsbIdx + FieldConfT::offs - (FieldConfT::size - 1), FieldConfT::size,
+                                         typename FieldConfT::SubFieldConfs, fieldPath...>::Type Type;  ///< Accessor for the resolved field.
+    };
+
+} // namespace TmplDevImpl
+/// \endcond INTERNAL
+
+/*!
+ * \brief Compile-time register layout for \ref Layers::RL::StandardRegister "RL::StandardRegister" configurations.
+ *
+ * Describes the register size and the (nested) register fields \p FieldConfTs at compile time. It can be added
+ * to a register configuration wrapper (see RegisterConf) as \c Layout typedef, from which the "size" and "fields" part of
+ * the register configuration is then generated, and it allows to resolve field paths to constant offsets via Field, e.g.
+ * <tt>Layout::Field<"A", "B">::set(reg, 5)</tt> instead of <tt>reg["A.B"] = 5</tt>, which avoids any name lookups.
+ *
+ * Each field must be fully contained within the register, which is checked at compile time.
+ *
+ * \tparam regSize Size of the register in number of bits.
+ * \tparam FieldConfTs Top level field definitions (each being a RegFieldConf).
+ */
+template<std::uint64_t regSize, typename... FieldConfTs>
+struct RegLayoutConf : public TmplDevImpl::RegLayoutConfBase
+{
+    static_assert(regSize > 0, "Register size must be larger than zero.");
+    static_assert((std::is_base_of_v<TmplDevImpl::RegFieldConfBase, FieldConfTs> && ...), "Each field must be specified by RegFieldConf.");
+    static_assert(((FieldConfTs::offs < regSize) && ...), "Register field exceeds the extent of the register.");
+
+    static constexpr std::uint64_t size = regSize;  ///< Size of the register in number of bits.
+
+    /*!
+     * \brief Constant-offset accessor for the field at a certain path.
+     *
+     * Resolves the field path \p fieldPath (field names from top level to the desired field) at compile time.
+     * An empty path refers to the whole register.
+     *
+     * \tparam fieldPath Field names along the path.
+     */
+    template<FieldName... fieldPath>
+    using Field = typename TmplDevImpl::ResolveRegField<0, regSize, std::tuple<FieldConfTs...>, fieldPath...>::Type;
+
+    /*!
+     * \brief Generate the YAML register size and field configuration.
+     *
+     * \return YAML map entries "size" and "fields" for the register configuration (without enclosing braces).
+     */
+    static std::string toYAML()
+    {
+        std::string yamlEntries = "size: " + std::to_string(size) + ", fields: [";
+
+        if constexpr (sizeof...(FieldConfTs) > 0)
+        {
+            ((yamlEntries += FieldConfTs::toYAML() + ", "), ...);
+            yamlEntries.resize(yamlEntries.size() - 2);
+        }
+
+        return yamlEntries + "]";
+    }
+};
+
+//
+
 /// \cond INTERNAL
 namespace TmplDevImpl
 {
@@ -183,6 +448,27 @@ namespace TmplDevImpl
                                     std::is_base_of_v<U<typename T::Type>, T> &&
                                     !std::is_same_v<U<typename T::Type>, T>;
 
+    /*!
+     * \brief Find a component configuration wrapper in a set of wrappers.
+     *
+     * \tparam T Component configuration wrapper to be found.
+     * \tparam ConfTs Set of component configuration wrappers to search in.
+     * \return Index of the first occurrence of \p T in \p ConfTs or \c sizeof...(ConfTs) if \p T is not contained in \p ConfTs.
+     */
+    template<typename T, typename... ConfTs>
+    constexpr std::size_t findComponentConf()
+    {
+        constexpr std::array<bool, sizeof...(ConfTs)> matches{std::is_same_v<T, ConfTs>...};
+
+        for (std::size_t i = 0; i < matches.size(); ++i)
+        {
+            if (matches[i])
+                return i;
+        }
+
+        return sizeof...(ConfTs);
+    }
+
     /*!
      * \brief Check if type properly implements a component configuration wrapper.
      *
@@ -250,7 +536,7 @@ concept ImplementsRegisterConf = TmplDevImpl::ImplementsConfStruct<T, RegisterCo
     T::driver;
     requires Concepts::IsConstCharArr<decltype(T::driver)>;
     typename Concepts::TestConstexpr<T::driver[0]>;
-};
+} && (!requires { typename T::Layout; } || std::is_base_of_v<TmplDevImpl::RegLayoutConfBase, typename T::Layout>);
 
 //
 
@@ -304,7 +590,8 @@ struct RegistersConf
                   "Each register must be specified by deriving from RegisterConf and defining "
                   "'static constexpr char name[] = \"name_of_register\";' and "
                   "'static constexpr char driver[] = \"name_of_used_hw_driver\";' and "
-                  "'static constexpr char conf[] = \"possibly: empty, rest: of, yaml: configuration\";'.");
+                  "'static constexpr char conf[] = \"possibly: empty, rest: of, yaml: configuration\";' and "
+                  "optionally 'typedef RegLayoutConf<...> Layout;'.");
 };
 
 } // namespace TmplDev
@@ -350,9 +637,14 @@ public:
      * "transfer_layer" / "hw_drivers" / "registers" sections of a usual YAML configuration document for Device.
      *
      * See Device::Device(const boost::property_tree::ptree&) for details on the further processing.
+     *
+     * Afterwards resolves all components once to typed pointers, which are used by interface(), driver() and reg().
      */
     TemplateDevice() :
-        Device(generateConfig())
+        Device(generateConfig()),
+        interfaces(&dynamic_cast<typename InterfaceConfTs::Type&>(Device::interface(InterfaceConfTs::name))...),
+        drivers(&dynamic_cast<typename DriverConfTs::Type&>(Device::driver(DriverConfTs::name))...),
+        registers(&dynamic_cast<typename RegisterConfTs::Type&>(Device::reg(RegisterConfTs::name))...)
     {
     }
     /*!
@@ -361,6 +653,18 @@ public:
      * See Device::~Device().
      */
     ~TemplateDevice() override = default;
+    //
+    /*!
+     * \brief Deleted reconfiguration.
+     *
+     * The configuration of a TemplateDevice is fixed at compile time and the typed component pointers
+     * used by interface(), driver() and reg() would be invalidated by rebuilding components.
+     */
+    bool reconfigure(const boost::property_tree::ptree&) = delete;
+    /*!
+     * \copydoc reconfigure(const boost::property_tree::ptree&)
+     */
+    bool reconfigure(const std::string&) = delete;
 
 public:
     /*!
@@ -369,6 +673,7 @@ public:
      * Returns a reference to the interface component configured by \p T, which is equivalent to
      * Device::interface() being called with the configured instance name \c T::name, except that here
      * the return type is the specific interface type (\c T::Type ) instead of the base type \ref Layers::TL::Interface "TL::Interface".
+     * The component is resolved at compile time via its index in \p InterfaceConfTs, i.e. without any name lookup or cast.
      *
      * \tparam T An interface configuration out of \p InterfaceConfTs.
      * \return The interface component configured by \p T, casted to the specific interface type.
@@ -377,9 +682,11 @@ public:
         requires TmplDev::ImplementsInterfaceConf<T>
     typename T::Type& interface()
     {
-        static_assert((std::is_same_v<T, InterfaceConfTs> || ...), "Device does not have the requested interface.");
+        constexpr std::size_t idx = TmplDev::TmplDevImpl::findComponentConf<T, InterfaceConfTs...>();
 
-        return dynamic_cast<typename T::Type&>(Device::interface(T::name));
+        static_assert(idx < sizeof...(InterfaceConfTs), "Device does not have the requested interface.");
+
+        return *std::get<idx>(interfaces);
     }
     /*!
      * \brief Access one of the driver components from the hardware layer.
@@ -387,6 +694,7 @@ public:
      * Returns a reference to the driver component configured by \p T, which is equivalent to
      * Device::driver() being called with the configured instance name \c T::name, except that here
      * the return type is the specific driver type (\c T::Type ) instead of the base type \ref Layers::HL::Driver "HL::Driver".
+     * The component is resolved at compile time via its index in \p DriverConfTs, i.e. without any name lookup or cast.
      *
      * \tparam T A driver configuration out of \p DriverConfTs.
      * \return The driver component configured by \p T, casted to the specific driver type.
@@ -395,9 +703,11 @@ public:
         requires TmplDev::ImplementsDriverConf<T>
     typename T::Type& driver()
     {
-        static_assert((std::is_same_v<T, DriverConfTs> || ...), "Device does not have the requested driver.");
+        constexpr std::size_t idx = TmplDev::TmplDevImpl::findComponentConf<T, DriverConfTs...>();
+
+        static_assert(idx < sizeof...(DriverConfTs), "Device does not have the requested driver.");
 
-        return dynamic_cast<typename T::Type&>(Device::driver(T::name));
+        return *std::get<idx>(drivers);
     }
     /*!
      * \brief Access one of the register components from the register layer.
@@ -405,6 +715,7 @@ public:
      * Returns a reference to the register component configured by \p T, which is equivalent to Device::reg() being
      * called with the configured instance name \c T::name, except that here the return type is the specific
      * register type (\c T::Type ) instead of the base type \ref Layers::RL::Register "RL::Register".
+     * The component is resolved at compile time via its index in \p RegisterConfTs, i.e. without any name lookup or cast.
      *
      * \tparam T A register configuration out of \p RegisterConfTs.
      * \return The register component configured by \p T, casted to the specific register type.
@@ -413,9 +724,11 @@ public:
         requires TmplDev::ImplementsRegisterConf<T>
     typename T::Type& reg()
     {
-        static_assert((std::is_same_v<T, RegisterConfTs> || ...), "Device does not have the requested register.");
+        constexpr std::size_t idx = TmplDev::TmplDevImpl::findComponentConf<T, RegisterConfTs...>();
 
-        return dynamic_cast<typename T::Type&>(Device::reg(T::name));
+        static_assert(idx < sizeof...(RegisterConfTs), "Device does not have the requested register.");
+
+        return *std::get<idx>(registers);
     }
 
 private:
@@ -454,7 +767,8 @@ private:
      * \brief Recursively generate the YAML sequence for the components of a certain layer.
      *
      * Generates and adds the YAML code (a map) for the <tt>N</tt>-th component configuration out of \p ComponentConfTs
-     * to the layer configuration sequence \p pYAMLLayerSeq, assuming that \p ComponentConfTs are from layer \p layer,
+     * to the layer configuration sequence \p pYAMLLayerSeq, assuming that \p ComponentConfTs are from layer \p layer
+     * (including the register size and fields generated from a compile-time register layout, if defined; see TmplDev::RegLayoutConf),
      * and recursively calls the function itself for the next component <tt>N+1</tt> until the last element of \p ComponentConfTs.
      *
      * For the first and last components (i.e. if \p N equals 0 or <tt>sizeof...(ComponentConfTs)-1</tt>) opening and
@@ -482,8 +796,13 @@ private:
         if constexpr (layer == LayerBase::Layer::HardwareLayer)
             tElementMap += std::string(", interface: ") + CurrentElementT::interface;
         else if constexpr (layer == LayerBase::Layer::RegisterLayer)
+        {
             tElementMap += std::string(", hw_driver: ") + CurrentElementT::driver;
 
+            if constexpr (requires { typename CurrentElementT::Layout; })
+                tElementMap += ", " + CurrentElementT::Layout::toYAML();
+        }
+
         tElementMap += std::string(", ") + CurrentElementT::conf + "}";
 
         pYAMLLayerSeq += tElementMap;
@@ -493,6 +812,11 @@ private:
         else
             pYAMLLayerSeq += "]";
     }
+
+private:
+    const std::tuple<typename InterfaceConfTs::Type*...> interfaces;    ///< Typed pointers to the interface components.
+    const std::tuple<typename DriverConfTs::Type*...> drivers;          ///< Typed pointers to the driver components.
+    const std::tuple<typename RegisterConfTs::Type*...> registers;      ///< Typed pointers to the register components.
 };
 
 } // namespace casil
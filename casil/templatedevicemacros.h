@@ -102,6 +102,30 @@ struct STRUCT_NAME : public casil::TmplDev::RegisterConf<REG_CLASS>\
     static constexpr char conf[] = CONF;\
 };
 
+/*!
+ * \brief Define a register configuration struct with a compile-time register layout for use with \ref TemplateDeviceSpecialization
+ *        "TemplateDevice".
+ *
+ * Like \ref CASIL_DEFINE_REGISTER but additionally declares the compile-time register layout \c STRUCT_NAME::Layout
+ * (see \ref casil::TmplDev::RegLayoutConf "TmplDev::RegLayoutConf"), from which the register's "size" and "fields"
+ * configuration values are generated. Hence \p CONF must not contain these values.
+ *
+ * \param REG_CLASS The registered \ref casil::Layers::RL::Register "RL::Register" class type to use as component type.
+ * \param STRUCT_NAME The desired struct name of the configuration wrapper to be declared.
+ * \param REG_NAME Component instance name (as string literal).
+ * \param DRIVER Configured instance name of the driver component to be used (as string literal).
+ * \param CONF Remaining component configuration YAML code (as string literal).
+ * \param ... The register layout type (a \ref casil::TmplDev::RegLayoutConf "TmplDev::RegLayoutConf"; may contain commas).
+ */
+#define CASIL_DEFINE_REGISTER_WITH_LAYOUT(REG_CLASS, STRUCT_NAME, REG_NAME, DRIVER, CONF, ...) \
+struct STRUCT_NAME : public casil::TmplDev::RegisterConf<REG_CLASS>\
+{\
+    static constexpr char name[] = REG_NAME;\
+    static constexpr char driver[] = DRIVER;\
+    static constexpr char conf[] = CONF;\
+    typedef __VA_ARGS__ Layout;\
+};
+
 //
 
 #endif // CASIL_TEMPLATEDEVICEMACROS_H
@@ -0,0 +1,178 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/timing.h>
+
+#include <cstdint>
+#include <numeric>
+
+using casil::Timing;
+
+std::atomic<bool> Timing::enabled = false;
+
+//Public
+
+/*!
+ * \brief Enable timing of operations.
+ *
+ * Does nothing if the library was compiled with \c CASIL_DISABLE_TIMING.
+ */
+void Timing::enable()
+{
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Disable timing of operations.
+ *
+ * Already recorded timings are kept.
+ */
+void Timing::disable()
+{
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+//
+
+/*!
+ * \brief Get the latency histogram of an operation.
+ *
+ * Gets (or registers) the histogram of metric family "casil_operation_duration_seconds" for labels
+ * \p pLabels extended by label "operation" with value \p pOperation (see Metrics::histogram()).
+ * This can also be used to time custom code sections ("spans") via Scope.
+ *
+ * \throws std::invalid_argument If a label name in \p pLabels is invalid.
+ *
+ * \param pOperation Name of the operation.
+ * \param pLabels Additional labels (e.g. LayerBase::metricsLabels of a component).
+ * \return The latency histogram.
+ */
+casil::Metrics::Histogram& Timing::getHistogram(const std::string& pOperation, const Metrics::Labels& pLabels)
+{
+    Metrics::Labels labels = pLabels;
+    labels.emplace_back("operation", pOperation);
+
+    return Metrics::histogram("casil_operation_duration_seconds", "Durations of timed operations.", getBucketUpperBounds(), labels);
+}
+
+/*!
+ * \brief Get the allocation counter of an operation.
+ *
+ * Gets (or registers) the counter of metric family "casil_operation_allocations" for labels
+ * \p pLabels extended by label "operation" with value \p pOperation (see Metrics::counter()).
+ * Only counts anything if the library is compiled with allocation counting (see Allocations).
+ *
+ * \throws std::invalid_argument If a label name in \p pLabels is invalid.
+ *
+ * \param pOperation Name of the operation.
+ * \param pLabels Additional labels (e.g. LayerBase::metricsLabels of a component).
+ * \return The allocation counter.
+ */
+casil::Metrics::Counter& Timing::getAllocationsCounter(const std::string& pOperation, const Metrics::Labels& pLabels)
+{
+    Metrics::Labels labels = pLabels;
+    labels.emplace_back("operation", pOperation);
+
+    return Metrics::counter("casil_operation_allocations", "Heap allocations of timed operations.", labels);
+}
+
+/*!
+ * \brief Get the allocated bytes counter of an operation.
+ *
+ * Gets (or registers) the counter of metric family "casil_operation_allocated_bytes" for labels
+ * \p pLabels extended by label "operation" with value \p pOperation (see Metrics::counter()).
+ * Only counts anything if the library is compiled with allocation counting (see Allocations).
+ *
+ * \throws std::invalid_argument If a label name in \p pLabels is invalid.
+ *
+ * \param pOperation Name of the operation.
+ * \param pLabels Additional labels (e.g. LayerBase::metricsLabels of a component).
+ * \return The allocated bytes counter.
+ */
+casil::Metrics::Counter& Timing::getAllocatedBytesCounter(const std::string& pOperation, const Metrics::Labels& pLabels)
+{
+    Metrics::Labels labels = pLabels;
+    labels.emplace_back("operation", pOperation);
+
+    return Metrics::counter("casil_operation_allocated_bytes", "Heap-allocated bytes of timed operations.", labels);
+}
+
+/*!
+ * \brief Get the histogram bucket upper bounds.
+ *
+ * The buckets range from one microsecond to ten seconds in steps of 1-2-5.
+ *
+ * \return Upper bounds of all but the last histogram bucket in seconds.
+ */
+const std::vector<double>& Timing::getBucketUpperBounds()
+{
+    static const std::vector<double> upperBounds = {1e-6, 2e-6, 5e-6, 1e-5, 2e-5, 5e-5, 1e-4, 2e-4, 5e-4,
+                                                    1e-3, 2e-3, 5e-3, 1e-2, 2e-2, 5e-2, 0.1, 0.2, 0.5, 1.0, 2.0, 5.0, 10.0};
+    return upperBounds;
+}
+
+/*!
+ * \brief Summarize a latency histogram.
+ *
+ * \param pHistogram The histogram.
+ * \return Number of observations, their sum and the bucket counts.
+ */
+Timing::Summary Timing::getSummary(const Metrics::Histogram& pHistogram)
+{
+    Summary summary {};
+
+    summary.bucketCounts = pHistogram.getBucketCounts();
+    summary.count = std::accumulate(summary.bucketCounts.begin(), summary.bucketCounts.end(), std::uint64_t{0});
+    summary.totalSeconds = pHistogram.getSum();
+
+    return summary;
+}
+
+//
+
+/*!
+ * \brief Get the label for an operation.
+ *
+ * \param pOperation The operation.
+ * \return Name of \p pOperation as used for the "operation" label (e.g. "apply_defaults"), or "unknown" for invalid values.
+ */
+std::string Timing::operationToLabel(const Operation pOperation)
+{
+    switch (pOperation)
+    {
+        case Operation::Init:
+            return "init";
+        case Operation::Close:
+            return "close";
+        case Operation::ApplyDefaults:
+            return "apply_defaults";
+        case Operation::Read:
+            return "read";
+        case Operation::Write:
+            return "write";
+        case Operation::Query:
+            return "query";
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,183 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_TIMING_H
+#define CASIL_TIMING_H
+
+#include <casil/allocations.h>
+#include <casil/metrics.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+/*!
+ * \brief Scoped timing of layer component operations in latency histograms.
+ *
+ * When enabled (see enable()), the durations of component operations such as LayerBase::init() / LayerBase::close(),
+ * applying register defaults, register writes and interface reads/writes are observed in histograms (see Metrics) of the
+ * metric family "casil_operation_duration_seconds", labeled with the component's labels (see LayerBase::metricsLabels)
+ * and the operation name (label "operation"; see operationToLabel()). Operations are timed via the RAII helper Scope,
+ * which layer components obtain from LayerBase::timeOperation(). Arbitrary code sections ("spans") can be timed
+ * the same way with a histogram from getHistogram(). A summary of the timings of all components of a
+ * Device can be obtained via Device::getTimings().
+ *
+ * If the library is compiled with allocation counting (see Allocations), the heap allocations made during the timed
+ * operations are additionally accumulated in the counters of metric families "casil_operation_allocations" and
+ * "casil_operation_allocated_bytes" with the same labels (see getAllocationsCounter() and getAllocatedBytesCounter()).
+ *
+ * When disabled, starting a scope costs a single relaxed atomic load. If the library is compiled with
+ * \c CASIL_DISABLE_TIMING defined (see CMake option of the same name), isEnabled() is a compile-time
+ * constant \c false and Scope does nothing at all, such that the timing code is optimized away.
+ */
+class Timing
+{
+public:
+    /*!
+     * \brief Timed layer component operation.
+     */
+    enum class Operation : std::uint8_t
+    {
+        Init = 0,           ///< LayerBase::init().
+        Close = 1,          ///< LayerBase::close().
+        ApplyDefaults = 2,  ///< Writing the configured default register values.
+        Read = 3,           ///< Interface read.
+        Write = 4,          ///< Interface write or register write.
+        Query = 5           ///< Interface query.
+    };
+
+    static constexpr std::size_t numOperations = 6;     ///< Number of Operation values.
+
+    /*!
+     * \brief RAII helper for timing an operation.
+     *
+     * Takes the start time on construction and adds the elapsed time (in seconds) to
+     * the histogram passed to the constructor on destruction. Does nothing for a \c nullptr histogram.
+     * Likewise adds the number of allocations and allocated bytes of the current thread
+     * (see Allocations::Scope) to the counters passed to the constructor, unless these are \c nullptr.
+     */
+    class Scope
+    {
+    public:
+#ifndef CASIL_DISABLE_TIMING
+        /*!
+         * \brief Constructor.
+         *
+         * \param pHistogram Histogram for the duration or \c nullptr to not time anything.
+         * \param pAllocations Counter for the number of allocations or \c nullptr to not count allocations.
+         * \param pAllocatedBytes Counter for the number of allocated bytes (ignored if \p pAllocations is \c nullptr).
+         */
+        explicit Scope(Metrics::Histogram* const pHistogram, Metrics::Counter* const pAllocations = nullptr,
+                       Metrics::Counter* const pAllocatedBytes = nullptr) :
+            histogram(pHistogram),
+            allocations(pAllocations),
+            allocatedBytes(pAllocatedBytes),
+            startAllocations(pAllocations != nullptr ? Allocations::getThreadCounts() : Allocations::Counts{0, 0}),
+            startTime(pHistogram != nullptr ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+        {
+        }
+        /*!
+         * \brief Destructor.
+         *
+         * Adds the elapsed time to the histogram (if any) and the allocation counts to the counters (if any).
+         */
+        ~Scope()
+        {
+            if (histogram != nullptr)
+                histogram->observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count());
+
+            if (allocations != nullptr)
+            {
+                const Allocations::Counts counts = Allocations::getThreadCounts();
+
+                allocations->increment(counts.allocations - startAllocations.allocations);
+
+                if (allocatedBytes != nullptr)
+                    allocatedBytes->increment(counts.bytes - startAllocations.bytes);
+            }
+        }
+#else
+        explicit Scope(Metrics::Histogram*, Metrics::Counter* = nullptr, Metrics::Counter* = nullptr) {}   ///< Constructor.
+        ~Scope() = default;                                     ///< Default destructor.
+#endif
+        Scope(const Scope&) = delete;                           ///< Deleted copy constructor.
+        Scope(Scope&&) = delete;                                ///< Deleted move constructor.
+        //
+        Scope& operator=(const Scope&) = delete;               ///< Deleted copy assignment operator.
+        Scope& operator=(Scope&&) = delete;                     ///< Deleted move assignment operator.
+
+#ifndef CASIL_DISABLE_TIMING
+    private:
+        Metrics::Histogram* const histogram;                    ///< Histogram for the duration (or \c nullptr).
+        Metrics::Counter* const allocations;                    ///< Counter for the number of allocations (or \c nullptr).
+        Metrics::Counter* const allocatedBytes;                 ///< Counter for the number of allocated bytes (or \c nullptr).
+        const Allocations::Counts startAllocations;             ///< Allocation counts of the thread on construction.
+        const std::chrono::steady_clock::time_point startTime;  ///< Start time of the operation.
+#endif
+    };
+
+    /*!
+     * \brief Summary of the timings of one operation (see getSummary()).
+     */
+    struct Summary
+    {
+        std::uint64_t count;                    ///< Number of timed operations.
+        double totalSeconds;                    ///< Total duration of all timed operations in seconds.
+        std::vector<std::uint64_t> bucketCounts;    ///< Non-cumulative histogram bucket counts (see getBucketUpperBounds()).
+    };
+
+public:
+    Timing() = delete;                                                                      ///< Deleted constructor.
+    //
+    static void enable();                                                                   ///< Enable timing of operations.
+    static void disable();                                                                  ///< Disable timing of operations.
+#ifndef CASIL_DISABLE_TIMING
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }             ///< Check if timing is enabled.
+#else
+    static constexpr bool isEnabled() { return false; }                                     ///< Check if timing is enabled.
+#endif
+    //
+    static Metrics::Histogram& getHistogram(const std::string& pOperation, const Metrics::Labels& pLabels);
+                                                                                            ///< Get the latency histogram of an operation.
+    static Metrics::Counter& getAllocationsCounter(const std::string& pOperation, const Metrics::Labels& pLabels);
+                                                                                            ///< Get the allocation counter of an operation.
+    static Metrics::Counter& getAllocatedBytesCounter(const std::string& pOperation, const Metrics::Labels& pLabels);
+                                                                                            ///< Get the allocated bytes counter of an operation.
+    static const std::vector<double>& getBucketUpperBounds();                               ///< Get the histogram bucket upper bounds.
+    static Summary getSummary(const Metrics::Histogram& pHistogram);                        ///< Summarize a latency histogram.
+    //
+    static std::string operationToLabel(Operation pOperation);                              ///< Get the label for an operation.
+
+private:
+    static std::atomic<bool> enabled;                                                       ///< Timing is enabled.
+};
+
+} // namespace casil
+
+#endif // CASIL_TIMING_H
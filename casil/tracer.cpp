@@ -0,0 +1,567 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/tracer.h>
+
+#include <casil/bytes.h>
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+using casil::Tracer;
+
+namespace
+{
+
+/*
+ * Magic bytes and format version at the start of every binary trace file (see Tracer::dump()).
+ */
+constexpr std::array<std::uint8_t, 8> traceMagic = {'C', 'A', 'S', 'I', 'L', 'T', 'R', 'C'};
+constexpr std::uint32_t traceVersion = 1;
+constexpr std::size_t traceRecordSize = 40;
+
+/*
+ * Formats a nanoseconds value as microseconds with three decimal places.
+ */
+std::string formatMicroSecs(const std::uint64_t pNanoSecs)
+{
+    const std::string fraction = std::to_string(pNanoSecs % 1000);
+
+    return std::to_string(pNanoSecs / 1000) + "." + std::string(3 - fraction.size(), '0') + fraction;
+}
+
+/*
+ * Escapes 'pStr' for use as JSON string (without enclosing quotes).
+ */
+std::string escapeJSON(const std::string& pStr)
+{
+    std::string escaped;
+    escaped.reserve(pStr.size());
+
+    for (const char c : pStr)
+    {
+        if (c == '"' || c == '\\')
+            escaped += std::string("\\") + c;
+        else if (static_cast<unsigned char>(c) < 0x20)
+            escaped += "\\u00" + casil::Bytes::formatHex(static_cast<std::uint8_t>(c)).substr(2);
+        else
+            escaped += c;
+    }
+
+    return escaped;
+}
+
+} // namespace
+
+/*!
+ * \brief Ring buffer of a single recording thread.
+ *
+ * Only written by its owning thread. The mutex is practically uncontended and only needed
+ * for consistent reading by collect() or clear() from other threads.
+ */
+struct Tracer::ThreadBuffer
+{
+    std::mutex mutex;               ///< Mutex for accessing the buffer.
+    std::vector<Record> records;    ///< The ring buffer.
+    std::uint64_t recordCount;      ///< Total number of stored records (ring buffer write position).
+    std::uint32_t threadIndex;      ///< Index of the owning thread.
+};
+
+//
+
+std::atomic<bool> Tracer::enabled = false;
+std::atomic<std::size_t> Tracer::recordsPerThread = 65536;
+//
+std::mutex Tracer::tracerMutex;
+std::vector<std::string> Tracer::sources = {};
+std::vector<std::shared_ptr<Tracer::ThreadBuffer>> Tracer::threadBuffers = {};
+
+//Public
+
+/*!
+ * \brief Enable recording of transactions.
+ *
+ * Discards all previously stored records and starts recording with a ring buffer size of \p pRecordsPerThread records per thread.
+ *
+ * \throws std::invalid_argument If \p pRecordsPerThread is zero.
+ *
+ * \param pRecordsPerThread Maximum number of stored records per thread.
+ */
+void Tracer::enable(const std::size_t pRecordsPerThread)
+{
+    if (pRecordsPerThread == 0)
+        throw std::invalid_argument("Trace buffer size must be larger than zero.");
+
+    enabled.store(false, std::memory_order_relaxed);
+
+    recordsPerThread.store(pRecordsPerThread, std::memory_order_relaxed);
+
+    clear();
+
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Disable recording of transactions.
+ *
+ * Stored records are kept and can still be collected or dumped.
+ */
+void Tracer::disable()
+{
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Check if recording is enabled.
+ *
+ * \return True if transactions are being recorded.
+ */
+bool Tracer::isEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+//
+
+/*!
+ * \brief Register a trace source name.
+ *
+ * \param pName Name of the source (e.g. a component description).
+ * \return Source ID to be used for Record::source.
+ */
+std::uint32_t Tracer::registerSource(std::string pName)
+{
+    const std::lock_guard<std::mutex> tracerLock(tracerMutex);
+    (void)tracerLock;
+
+    sources.push_back(std::move(pName));
+
+    return static_cast<std::uint32_t>(sources.size() - 1);
+}
+
+/*!
+ * \brief Get the name of a trace source.
+ *
+ * \param pSource Source ID as returned by registerSource().
+ * \return Registered name of the source or an empty string if \p pSource is unknown.
+ */
+std::string Tracer::getSourceName(const std::uint32_t pSource)
+{
+    const std::lock_guard<std::mutex> tracerLock(tracerMutex);
+    (void)tracerLock;
+
+    return (pSource < sources.size() ? sources[pSource] : std::string());
+}
+
+//
+
+/*!
+ * \brief Store a trace record.
+ *
+ * Stores \p pRecord in the calling thread's ring buffer (overwriting the oldest record if full)
+ * and sets its Record::thread to the index of the calling thread. Does nothing if recording is disabled.
+ *
+ * \param pRecord Record to be stored.
+ */
+void Tracer::record(Record pRecord)
+{
+    if (!isEnabled())
+        return;
+
+    ThreadBuffer& buffer = getThreadBuffer();
+
+    const std::lock_guard<std::mutex> bufferLock(buffer.mutex);
+    (void)bufferLock;
+
+    if (buffer.records.empty())
+        buffer.records.resize(recordsPerThread.load(std::memory_order_relaxed));
+
+    pRecord.thread = buffer.threadIndex;
+
+    buffer.records[buffer.recordCount % buffer.records.size()] = pRecord;
+    ++buffer.recordCount;
+}
+
+//
+
+/*!
+ * \brief Get all stored records of all threads.
+ *
+ * \return Stored records of all threads, sorted by Record::timestamp.
+ */
+std::vector<Tracer::Record> Tracer::collect()
+{
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+    {
+        const std::lock_guard<std::mutex> tracerLock(tracerMutex);
+        (void)tracerLock;
+
+        buffers = threadBuffers;
+    }
+
+    std::vector<Record> records;
+
+    for (const std::shared_ptr<ThreadBuffer>& buffer : buffers)
+    {
+        const std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        (void)bufferLock;
+
+        const std::size_t capacity = buffer->records.size();
+        const std::uint64_t numRecords = std::min<std::uint64_t>(buffer->recordCount, capacity);
+
+        for (std::uint64_t i = buffer->recordCount - numRecords; i < buffer->recordCount; ++i)
+            records.push_back(buffer->records[i % capacity]);
+    }
+
+    std::stable_sort(records.begin(), records.end(), [](const Record& pLhs, const Record& pRhs) -> bool
+                                                     {
+                                                         return pLhs.timestamp < pRhs.timestamp;
+                                                     });
+
+    return records;
+}
+
+/*!
+ * \brief Discard all stored records.
+ *
+ * Also applies the currently configured ring buffer size (see enable()) to all threads.
+ */
+void Tracer::clear()
+{
+    const std::lock_guard<std::mutex> tracerLock(tracerMutex);
+    (void)tracerLock;
+
+    for (const std::shared_ptr<ThreadBuffer>& buffer : threadBuffers)
+    {
+        const std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        (void)bufferLock;
+
+        buffer->records.clear();
+        buffer->records.shrink_to_fit();
+        buffer->recordCount = 0;
+    }
+}
+
+//
+
+/*!
+ * \brief Write all stored records to a binary trace file.
+ *
+ * Writes the source names and all records from collect() to file \p pFileName, all values as little endian:
+ *
+ * - Header: 8 bytes magic "CASILTRC", 32 bit format version (currently 1), 32 bit number of source names.
+ * - For each source (ordered by source ID): 32 bit name length followed by the name.
+ * - 64 bit number of records.
+ * - For each record: 40 bytes with the members of Record in declaration order
+ *   (three 64 bit values, three 32 bit values, four 8 bit values).
+ *
+ * See convertToChromeTrace() for converting the file.
+ *
+ * \throws std::runtime_error If the file cannot be written.
+ *
+ * \param pFileName Name of the trace file.
+ */
+void Tracer::dump(const std::string& pFileName)
+{
+    const std::vector<Record> records = collect();
+
+    std::vector<std::string> sourceNames;
+
+    {
+        const std::lock_guard<std::mutex> tracerLock(tracerMutex);
+        (void)tracerLock;
+
+        sourceNames = sources;
+    }
+
+    std::vector<std::uint8_t> bytes(traceMagic.begin(), traceMagic.end());
+    Bytes::composeBytesTo(std::back_inserter(bytes), false, traceVersion, static_cast<std::uint32_t>(sourceNames.size()));
+
+    for (const std::string& name : sourceNames)
+    {
+        Bytes::composeBytesTo(std::back_inserter(bytes), false, static_cast<std::uint32_t>(name.size()));
+        bytes.insert(bytes.end(), name.begin(), name.end());
+    }
+
+    bytes.reserve(bytes.size() + 8 + records.size() * traceRecordSize);
+
+    Bytes::composeBytesTo(std::back_inserter(bytes), false, static_cast<std::uint64_t>(records.size()));
+
+    for (const Record& record : records)
+    {
+        Bytes::composeBytesTo(std::back_inserter(bytes), false, record.timestamp, record.duration, record.address,
+                              record.size, record.source, record.thread, static_cast<std::uint8_t>(record.event),
+                              record.retries, record.transactionId, record.failed);
+    }
+
+    try
+    {
+        std::ofstream file;
+        file.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+        file.open(pFileName, std::ios_base::binary);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+    catch (const std::ios_base::failure&)
+    {
+        throw std::runtime_error("Could not write trace file \"" + pFileName + "\".");
+    }
+}
+
+/*!
+ * \brief Convert a binary trace file to Chrome's JSON format.
+ *
+ * Reads the binary trace file \p pTraceFileName (see dump()) and writes its records as complete ("X") events
+ * of the Chrome trace event format to \p pJSONFileName. Each event is named after its Event (see eventToLabel()),
+ * uses the source name as category and the recording thread's index as thread ID, and lists address, size,
+ * retries, transaction ID and failure state as arguments. Timestamps and durations are given in microseconds.
+ *
+ * \throws std::runtime_error If \p pTraceFileName cannot be read or is malformed.
+ * \throws std::runtime_error If \p pJSONFileName cannot be written.
+ *
+ * \param pTraceFileName Name of the binary trace file.
+ * \param pJSONFileName Name of the JSON file to be written.
+ */
+void Tracer::convertToChromeTrace(const std::string& pTraceFileName, const std::string& pJSONFileName)
+{
+    std::vector<std::uint8_t> bytes;
+
+    try
+    {
+        std::ifstream file;
+        file.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+        file.open(pTraceFileName, std::ios_base::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    catch (const std::ios_base::failure&)
+    {
+        throw std::runtime_error("Could not read trace file \"" + pTraceFileName + "\".");
+    }
+
+    const std::span<const std::uint8_t> data(bytes);
+
+    auto requireBytes = [&data](const std::size_t pPos, const std::size_t pCount) -> void
+    {
+        if (data.size() < pPos || data.size() - pPos < pCount)
+            throw std::runtime_error("Trace file is truncated.");
+    };
+
+    if (data.size() < 16 || !std::equal(traceMagic.begin(), traceMagic.end(), data.begin()))
+        throw std::runtime_error("Not a trace file.");
+
+    const std::uint32_t version = Bytes::composeUInt32(data.subspan(8).first<4>(), false);
+    const std::uint32_t numSources = Bytes::composeUInt32(data.subspan(12).first<4>(), false);
+
+    if (version != traceVersion)
+        throw std::runtime_error("Unsupported trace file version " + std::to_string(version) + ".");
+
+    std::vector<std::string> sourceNames;
+    std::size_t pos = 16;
+
+    for (std::uint32_t i = 0; i < numSources; ++i)
+    {
+        requireBytes(pos, 4);
+        const std::uint32_t nameLength = Bytes::composeUInt32(data.subspan(pos).first<4>(), false);
+        pos += 4;
+
+        requireBytes(pos, nameLength);
+        sourceNames.emplace_back(reinterpret_cast<const char*>(data.data() + pos), nameLength);
+        pos += nameLength;
+    }
+
+    requireBytes(pos, 8);
+    const std::uint64_t numRecords = Bytes::composeUInt64(data.subspan(pos).first<8>(), false);
+    pos += 8;
+
+    if ((data.size() - pos) / traceRecordSize < numRecords)
+        throw std::runtime_error("Trace file is truncated.");
+
+    std::string json = "{\"traceEvents\": [";
+
+    for (std::uint64_t i = 0; i < numRecords; ++i, pos += traceRecordSize)
+    {
+        const std::span<const std::uint8_t, traceRecordSize> recordBytes = data.subspan(pos).first<traceRecordSize>();
+
+        const std::uint64_t timestamp = Bytes::composeUInt64(recordBytes.subspan<0, 8>(), false);
+        const std::uint64_t duration = Bytes::composeUInt64(recordBytes.subspan<8, 8>(), false);
+        const std::uint64_t address = Bytes::composeUInt64(recordBytes.subspan<16, 8>(), false);
+        const std::uint32_t size = Bytes::composeUInt32(recordBytes.subspan<24, 4>(), false);
+        const std::uint32_t source = Bytes::composeUInt32(recordBytes.subspan<28, 4>(), false);
+        const std::uint32_t thread = Bytes::composeUInt32(recordBytes.subspan<32, 4>(), false);
+
+        const std::string sourceName = (source < sourceNames.size() ? sourceNames[source] : std::to_string(source));
+
+        json += (i == 0 ? "\n" : ",\n");
+        json += "{\"name\": \"" + eventToLabel(static_cast<Event>(recordBytes[36])) + "\", " +
+                "\"cat\": \"" + escapeJSON(sourceName) + "\", \"ph\": \"X\", " +
+                "\"ts\": " + formatMicroSecs(timestamp) + ", \"dur\": " + formatMicroSecs(duration) + ", " +
+                "\"pid\": 1, \"tid\": " + std::to_string(thread) + ", " +
+                "\"args\": {\"address\": \"" + Bytes::formatHex(address) + "\", \"size\": " + std::to_string(size) + ", " +
+                "\"retries\": " + std::to_string(recordBytes[37]) + ", \"id\": " + std::to_string(recordBytes[38]) + ", " +
+                "\"failed\": " + (recordBytes[39] != 0 ? "true" : "false") + "}}";
+    }
+
+    json += "\n], \"displayTimeUnit\": \"ns\"}\n";
+
+    try
+    {
+        std::ofstream file;
+        file.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+        file.open(pJSONFileName);
+        file<<json;
+    }
+    catch (const std::ios_base::failure&)
+    {
+        throw std::runtime_error("Could not write JSON file \"" + pJSONFileName + "\".");
+    }
+}
+
+/*!
+ * \brief Get the label for an event type.
+ *
+ * \param pEvent The event type.
+ * \return Name of \p pEvent (e.g. "RBCPRead"), or "Unknown" for invalid values.
+ */
+std::string Tracer::eventToLabel(const Event pEvent)
+{
+    switch (pEvent)
+    {
+        case Event::Read:
+            return "Read";
+        case Event::Write:
+            return "Write";
+        case Event::Query:
+            return "Query";
+        case Event::RBCPRead:
+            return "RBCPRead";
+        case Event::RBCPWrite:
+            return "RBCPWrite";
+        case Event::RegisterRead:
+            return "RegisterRead";
+        case Event::RegisterWrite:
+            return "RegisterWrite";
+        default:
+            return "Unknown";
+    }
+}
+
+//Private
+
+/*!
+ * \brief Get the calling thread's ring buffer.
+ *
+ * Creates and registers the buffer on first use by the calling thread.
+ * Buffers are kept after their thread exited, such that their records can still be collected.
+ *
+ * \return Ring buffer of the calling thread.
+ */
+Tracer::ThreadBuffer& Tracer::getThreadBuffer()
+{
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+
+    if (!buffer)
+    {
+        buffer = std::make_shared<ThreadBuffer>();
+
+        const std::lock_guard<std::mutex> tracerLock(tracerMutex);
+        (void)tracerLock;
+
+        buffer->recordCount = 0;
+        buffer->threadIndex = static_cast<std::uint32_t>(threadBuffers.size());
+
+        threadBuffers.push_back(buffer);
+    }
+
+    return *buffer;
+}
+
+//Tracer::Scope
+
+//Public
+
+/*!
+ * \brief Constructor.
+ *
+ * Takes the start time of the transaction if recording is enabled.
+ *
+ * \param pSource Source ID of the recording component (see Tracer::registerSource()).
+ * \param pEvent Type of the transaction.
+ * \param pAddress Bus/register address of the transaction.
+ * \param pSize Number of transferred bytes.
+ */
+Tracer::Scope::Scope(const std::uint32_t pSource, const Event pEvent, const std::uint64_t pAddress, const std::uint32_t pSize) :
+    active(Tracer::isEnabled()),
+    uncaughtExceptions(active ? std::uncaught_exceptions() : 0),
+    startTime(active ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point()),
+    record{0, 0, pAddress, pSize, pSource, 0, pEvent, 0, 0, 0}
+{
+}
+
+/*!
+ * \brief Destructor.
+ *
+ * Records the transaction with its duration (see Tracer::record()) if recording was enabled on construction.
+ * The transaction is marked as failed if the scope is left because of an exception.
+ */
+Tracer::Scope::~Scope()
+{
+    if (!active)
+        return;
+
+    const auto endTime = std::chrono::steady_clock::now();
+
+    record.timestamp = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(startTime.time_since_epoch()).count());
+    record.duration = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count());
+    record.failed = (std::uncaught_exceptions() > uncaughtExceptions ? 1 : 0);
+
+    Tracer::record(record);
+}
+
+//
+
+/*!
+ * \brief Set the number of retries.
+ *
+ * \param pRetries Number of retries needed for the transaction (saturated at 255).
+ */
+void Tracer::Scope::setRetries(const int pRetries)
+{
+    record.retries = static_cast<std::uint8_t>(std::clamp(pRetries, 0, 255));
+}
+
+/*!
+ * \brief Set the transaction ID.
+ *
+ * \param pId Protocol-specific transaction ID.
+ */
+void Tracer::Scope::setTransactionId(const std::uint8_t pId)
+{
+    record.transactionId = pId;
+}
@@ -0,0 +1,154 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASIL_TRACER_H
+#define CASIL_TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+/*!
+ * \brief Record bus transactions into a low-overhead binary trace.
+ *
+ * When enabled (see enable()), instrumented components (the interfaces TCP, UDP, Serial and SiTCP as well as
+ * RegisterDriver) record every transaction as a fixed-size Record (start time, duration, address, size, retries etc.).
+ * Each recording thread writes to its own ring buffer, i.e. only the newest records are kept if the buffer overflows.
+ * When disabled, recording costs only a single relaxed atomic load (see isEnabled()).
+ *
+ * The records of all threads can be collected via collect() or written to a binary trace file via dump(),
+ * which can in turn be converted to a JSON file in Chrome's trace event format via convertToChromeTrace()
+ * (to be viewed e.g. in Perfetto or chrome://tracing).
+ *
+ * Components are identified by a numeric source ID that maps to a source name (see registerSource()).
+ * Every layer component registers itself on construction (see LayerBase::traceSource).
+ *
+ * Transactions are usually recorded via the RAII helper Scope.
+ */
+class Tracer
+{
+public:
+    /*!
+     * \brief Type of a traced transaction.
+     */
+    enum class Event : std::uint8_t
+    {
+        Read          = 0,  ///< Interface read.
+        Write         = 1,  ///< Interface write.
+        Query         = 2,  ///< Interface query (write followed by read).
+        RBCPRead      = 3,  ///< Single %SiTCP RBCP read transaction.
+        RBCPWrite     = 4,  ///< Single %SiTCP RBCP write transaction.
+        RegisterRead  = 5,  ///< Register driver read of a register address.
+        RegisterWrite = 6   ///< Register driver write to a register address.
+    };
+
+    /*!
+     * \brief Fixed-size trace record of a single transaction.
+     */
+    struct Record
+    {
+        std::uint64_t timestamp;        ///< Start time in nanoseconds (epoch of \e std::chrono::steady_clock).
+        std::uint64_t duration;         ///< Duration in nanoseconds.
+        std::uint64_t address;          ///< Bus/register address (zero for direct interfaces).
+        std::uint32_t size;             ///< Number of transferred bytes (requested bytes for reads).
+        std::uint32_t source;           ///< Source ID of the recording component (see registerSource()).
+        std::uint32_t thread;           ///< Index of the recording thread.
+        Event event;                    ///< Transaction type.
+        std::uint8_t retries;           ///< Number of retries needed for the transaction.
+        std::uint8_t transactionId;     ///< Protocol-specific transaction ID (e.g. last RBCP message ID).
+        std::uint8_t failed;            ///< Transaction failed (threw an exception).
+    };
+
+    /*!
+     * \brief RAII helper for recording a transaction.
+     *
+     * Takes the start time on construction and records the transaction with its duration on destruction,
+     * marking it as failed if the scope is left via an exception. Does nothing if tracing is disabled on construction.
+     */
+    class Scope
+    {
+    public:
+        Scope(std::uint32_t pSource, Event pEvent, std::uint64_t pAddress, std::uint32_t pSize);   ///< Constructor.
+        Scope(const Scope&) = delete;                                                           ///< Deleted copy constructor.
+        Scope(Scope&&) = delete;                                                                ///< Deleted move constructor.
+        ~Scope();                                                                               ///< Destructor.
+        //
+        Scope& operator=(Scope) = delete;                                                       ///< Deleted copy assignment operator.
+        Scope& operator=(Scope&&) = delete;                                                     ///< Deleted move assignment operator.
+        //
+        void setRetries(int pRetries);                                                          ///< Set the number of retries.
+        void setTransactionId(std::uint8_t pId);                                                ///< Set the transaction ID.
+
+    private:
+        const bool active;                                      ///< Tracing was enabled on construction.
+        const int uncaughtExceptions;                           ///< Number of uncaught exceptions on construction.
+        const std::chrono::steady_clock::time_point startTime;  ///< Start time of the transaction.
+        Record record;                                          ///< Record to be completed and stored on destruction.
+    };
+
+public:
+    Tracer() = delete;                                                                  ///< Deleted constructor.
+    //
+    static void enable(std::size_t pRecordsPerThread = 65536);                          ///< Enable recording of transactions.
+    static void disable();                                                              ///< Disable recording of transactions.
+    static bool isEnabled();                                                            ///< Check if recording is enabled.
+    //
+    static std::uint32_t registerSource(std::string pName);                             ///< Register a trace source name.
+    static std::string getSourceName(std::uint32_t pSource);                            ///< Get the name of a trace source.
+    //
+    static void record(Record pRecord);                                                 ///< Store a trace record.
+    //
+    static std::vector<Record> collect();                                               ///< Get all stored records of all threads.
+    static void clear();                                                                ///< Discard all stored records.
+    //
+    static void dump(const std::string& pFileName);                                     ///< Write all stored records to a binary trace file.
+    static void convertToChromeTrace(const std::string& pTraceFileName, const std::string& pJSONFileName);
+                                                                                        ///< Convert a binary trace file to Chrome's JSON format.
+    static std::string eventToLabel(Event pEvent);                                      ///< Get the label for an event type.
+
+private:
+    struct ThreadBuffer;
+
+private:
+    static ThreadBuffer& getThreadBuffer();                                             ///< Get the calling thread's ring buffer.
+
+private:
+    static std::atomic<bool> enabled;                                                   ///< Recording is enabled.
+    static std::atomic<std::size_t> recordsPerThread;                                   ///< Ring buffer size per thread.
+    //
+    static std::mutex tracerMutex;                                                      ///< Mutex for sources and thread buffers.
+    static std::vector<std::string> sources;                                            ///< Registered source names by source ID.
+    static std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;                    ///< Ring buffers of all recording threads.
+};
+
+} // namespace casil
+
+#endif // CASIL_TRACER_H
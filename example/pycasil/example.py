@@ -45,7 +45,7 @@ with pcs.Auxil.AsyncIORunner(2):
 
     d.init()
 
-    d.interface("intf").write([0x30, 0x31, 0x32, 0x33, 0x34, ord('A')])
+    d.interface("intf").write(b"01234A")
     d.interface("intf").write([0x35])
 
     d.driver("echo")(1)
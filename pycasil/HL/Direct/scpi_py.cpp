@@ -22,20 +22,47 @@
 */
 
 #include <pycasil/pycasil.h>
+#include <pycasil/pycasil_asyncio.h>
 
 #include <casil/HL/Direct/scpi.h>
 
+#include <pybind11/chrono.h>
+
+#include <chrono>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <variant>
+#include <vector>
 
 using casil::HL::SCPI;
 
 void bindHL_SCPI(py::module& pM)
 {
-    py::class_<SCPI, casil::HL::DirectDriver>(pM, "SCPI", "Driver for Standard Commands for Programmable Instruments (SCPI) devices.")
+    py::class_<SCPI, casil::HL::DirectDriver> scpi(pM, "SCPI", "Driver for Standard Commands for Programmable Instruments (SCPI) devices.");
+
+    py::class_<SCPI::BatchCommand>(scpi, "BatchCommand", "Single command as part of a batch of commands.")
+            .def(py::init<std::string, std::optional<int>, SCPI::VariantValueType>(), "Constructor.",
+                 py::arg("cmd"), py::arg("channel") = std::optional<int>{}, py::arg("value") = std::monostate{})
+            .def_readwrite("cmd", &SCPI::BatchCommand::cmd, "The command name.")
+            .def_readwrite("channel", &SCPI::BatchCommand::channel, "Device's channel number, if applicable.")
+            .def_readwrite("value", &SCPI::BatchCommand::value, "The value argument for a setter.");
+
+    py::class_<SCPI::StreamStatistics>(scpi, "StreamStatistics", "Snapshot of the streaming acquisition counters.")
+            .def_readonly("records", &SCPI::StreamStatistics::records, "Number of records received since startStreaming().")
+            .def_readonly("values", &SCPI::StreamStatistics::values, "Number of values parsed from the received records.")
+            .def_readonly("droppedValues", &SCPI::StreamStatistics::droppedValues,
+                          "Number of values overwritten in the full stream buffer before being read.")
+            .def_readonly("parseErrors", &SCPI::StreamStatistics::parseErrors, "Number of record fields that could not be parsed as number.");
+
+    py::class_<SCPI::CommandHandle>(scpi, "CommandHandle", "Pre-resolved command for repeated execution without command name lookup.")
+            .def("getName", &SCPI::CommandHandle::getName, "Get the command name.")
+            .def("getChannel", &SCPI::CommandHandle::getChannel, "Get the channel number.")
+            .def("isQuery", &SCPI::CommandHandle::isQuery, "Check if the command is a query command.")
+            .def("isSetter", &SCPI::CommandHandle::isSetter, "Check if the command is a setter.");
+
+    scpi
             .def(py::init<std::string, SCPI::InterfaceBaseType&, casil::LayerConfig>(), "Constructor.",
                  py::arg("name"), py::arg("interface"), py::arg("config"))
             .def("__getattr__", [](const SCPI& pThis, const std::string_view pAttr) -> py::cpp_function
@@ -45,15 +72,63 @@ void bindHL_SCPI(py::module& pM)
                                         [tThis, pAttr](const std::optional<int> pChannel, SCPI::VariantValueType pValue)
                                             -> std::optional<std::string>
                                         { return tThis->operator()(pAttr, pChannel, std::move(pValue)); },
-                                        py::arg("channel") = std::optional<int>{}, py::arg("value") = std::monostate{});
+                                        py::arg("channel") = std::optional<int>{}, py::arg("value") = std::monostate{},
+                                        py::call_guard<py::gil_scoped_release>());
                                 },
                  "Get a function to execute a command (either write or query; according return type).", py::arg("attr"), py::is_operator())
-            .def("__call__", &SCPI::operator(), "Execute a command (either write or query).",
-                 py::arg("cmd"), py::arg("channel") = std::nullopt, py::arg("value") = std::monostate{}, py::is_operator())
-            .def("writeCommand", &SCPI::writeCommand, "Execute a write command.",
+            .def("__call__",
+                 static_cast<std::optional<std::string> (SCPI::*)(std::string_view, std::optional<int>, SCPI::VariantValueType) const>(&SCPI::operator()),
+                 "Execute a command (either write or query).",
+                 py::arg("cmd"), py::arg("channel") = std::nullopt, py::arg("value") = std::monostate{}, py::is_operator(),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("__call__",
+                 static_cast<std::optional<std::string> (SCPI::*)(const SCPI::CommandHandle&, SCPI::VariantValueType) const>(&SCPI::operator()),
+                 "Execute a command (either write or query).", py::arg("handle"), py::arg("value") = std::monostate{}, py::is_operator(),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("handle", &SCPI::handle, "Get a handle for a command.",
+                 py::arg("cmd"), py::arg("channel") = std::nullopt, py::keep_alive<0, 1>())
+            .def("writeCommand",
+                 static_cast<void (SCPI::*)(std::string_view, std::optional<int>, SCPI::VariantValueType) const>(&SCPI::writeCommand),
+                 "Execute a write command.", py::arg("cmd"), py::arg("channel") = std::nullopt, py::arg("value") = std::monostate{},
+                 py::call_guard<py::gil_scoped_release>())
+            .def("writeCommand",
+                 static_cast<void (SCPI::*)(const SCPI::CommandHandle&, SCPI::VariantValueType) const>(&SCPI::writeCommand),
+                 "Execute a write command.", py::arg("handle"), py::arg("value") = std::monostate{},
+                 py::call_guard<py::gil_scoped_release>())
+            .def("queryCommand",
+                 static_cast<std::string (SCPI::*)(std::string_view, std::optional<int>) const>(&SCPI::queryCommand),
+                 "Execute a query command.", py::arg("cmd"), py::arg("channel") = std::nullopt, py::call_guard<py::gil_scoped_release>())
+            .def("queryCommand",
+                 static_cast<std::string (SCPI::*)(const SCPI::CommandHandle&) const>(&SCPI::queryCommand),
+                 "Execute a query command.", py::arg("handle"), py::call_guard<py::gil_scoped_release>())
+            .def("queryCommandSequence", &SCPI::queryCommandSequence, "Execute multiple query commands at once.",
+                 py::arg("cmds"), py::arg("channel") = std::nullopt, py::call_guard<py::gil_scoped_release>())
+            .def("queryBinary", &SCPI::queryBinary, "Execute a query command with binary block response.",
+                 py::arg("cmd"), py::arg("channel") = std::nullopt, py::call_guard<py::gil_scoped_release>())
+            .def("command",
+                 static_cast<std::optional<std::string> (SCPI::*)(std::string_view, std::optional<int>, SCPI::VariantValueType) const>(&SCPI::command),
+                 "Execute a command (either write or query).",
+                 py::arg("cmd"), py::arg("channel") = std::nullopt, py::arg("value") = std::monostate{},
+                 py::call_guard<py::gil_scoped_release>())
+            .def("command",
+                 static_cast<std::optional<std::string> (SCPI::*)(const SCPI::CommandHandle&, SCPI::VariantValueType) const>(&SCPI::command),
+                 "Execute a command (either write or query).", py::arg("handle"), py::arg("value") = std::monostate{},
+                 py::call_guard<py::gil_scoped_release>())
+            .def("commandAsync", [](const SCPI& pThis, std::string pCmd, const std::optional<int> pChannel, SCPI::VariantValueType pValue)
+                                    -> py::object
+                                 {
+                                     return PyCasilUtils::awaitAsync(pThis, [&pThis, cmd = std::move(pCmd), pChannel, value = std::move(pValue)]()
+                                                                            { return pThis.command(cmd, pChannel, value); });
+                                 },
+                 "Execute a command (either write or query; awaitable version for asyncio).",
                  py::arg("cmd"), py::arg("channel") = std::nullopt, py::arg("value") = std::monostate{})
-            .def("queryCommand", &SCPI::queryCommand, "Execute a query command.",
-                 py::arg("cmd"), py::arg("channel") = std::nullopt)
-            .def("command", &SCPI::command, "Execute a command (either write or query).",
-                 py::arg("cmd"), py::arg("channel") = std::nullopt, py::arg("value") = std::monostate{});
+            .def("batch", &SCPI::batch, "Execute multiple commands (write and/or query) with a single round trip.", py::arg("cmds"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("startStreaming", &SCPI::startStreaming, "Start a continuous streaming acquisition.", py::arg("channel") = std::nullopt,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("stopStreaming", &SCPI::stopStreaming, "Stop the streaming acquisition.", py::call_guard<py::gil_scoped_release>())
+            .def("isStreaming", &SCPI::isStreaming, "Check if the streaming acquisition is active.")
+            .def("readStream", &SCPI::readStream, "Take buffered values from the streaming acquisition.",
+                 py::arg("maxValues") = 0, py::arg("timeout") = std::chrono::milliseconds::zero(), py::call_guard<py::gil_scoped_release>())
+            .def("getStreamStatistics", &SCPI::getStreamStatistics, "Get the counters of the streaming acquisition.");
 }
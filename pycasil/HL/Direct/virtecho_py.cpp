@@ -29,8 +29,30 @@ using casil::HL::VirtEcho;
 
 void bindHL_VirtEcho(py::module& pM)
 {
-    py::class_<VirtEcho, casil::HL::DirectDriver>(pM, "VirtEcho", "Pseudo driver to write back to its interface what can be read from it.")
+    py::class_<VirtEcho, casil::HL::DirectDriver> virtEcho(pM, "VirtEcho", "Pseudo driver to write back to its interface what can be read from it.");
+
+    py::class_<VirtEcho::BenchmarkResult>(virtEcho, "BenchmarkResult", "Results of a loopback benchmark run.")
+            .def_readonly("interfaceType", &VirtEcho::BenchmarkResult::interfaceType, "Type name of the benchmarked interface.")
+            .def_readonly("blockSize", &VirtEcho::BenchmarkResult::blockSize, "Number of bytes per echoed block.")
+            .def_readonly("numBlocks", &VirtEcho::BenchmarkResult::numBlocks, "Number of echoed blocks.")
+            .def_readonly("totalSecs", &VirtEcho::BenchmarkResult::totalSecs, "Total duration of all round trips in seconds.")
+            .def_readonly("throughputMBps", &VirtEcho::BenchmarkResult::throughputMBps, "Achieved throughput in MB/s.")
+            .def_readonly("latencyMinMicroSecs", &VirtEcho::BenchmarkResult::latencyMinMicroSecs, "Minimum round trip time in microseconds.")
+            .def_readonly("latencyP50MicroSecs", &VirtEcho::BenchmarkResult::latencyP50MicroSecs, "Median round trip time in microseconds.")
+            .def_readonly("latencyP90MicroSecs", &VirtEcho::BenchmarkResult::latencyP90MicroSecs,
+                          "90th percentile of the round trip time in microseconds.")
+            .def_readonly("latencyP99MicroSecs", &VirtEcho::BenchmarkResult::latencyP99MicroSecs,
+                          "99th percentile of the round trip time in microseconds.")
+            .def_readonly("latencyMaxMicroSecs", &VirtEcho::BenchmarkResult::latencyMaxMicroSecs, "Maximum round trip time in microseconds.");
+
+    virtEcho
             .def(py::init<std::string, VirtEcho::InterfaceBaseType&, casil::LayerConfig>(), "Constructor.",
                  py::arg("name"), py::arg("interface"), py::arg("config"))
-            .def("__call__", &VirtEcho::operator(), "Read and immediately write back a number of bytes.", py::arg("n"), py::is_operator());
+            .def("__call__", &VirtEcho::operator(), "Read and immediately write back a number of bytes.", py::arg("n"), py::is_operator(),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("benchmark", static_cast<VirtEcho::BenchmarkResult (VirtEcho::*)(std::size_t, std::size_t) const>(&VirtEcho::benchmark),
+                 "Measure the echo throughput and latency of the interface.", py::arg("blockSize"), py::arg("numBlocks"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("benchmark", static_cast<std::vector<VirtEcho::BenchmarkResult> (VirtEcho::*)() const>(&VirtEcho::benchmark),
+                 "Run benchmark() for all configured block sizes.", py::call_guard<py::gil_scoped_release>());
 }
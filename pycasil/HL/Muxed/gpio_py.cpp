@@ -25,6 +25,8 @@
 
 #include <casil/HL/Muxed/gpio.h>
 
+#include <pybind11/chrono.h>
+
 #include <boost/dynamic_bitset.hpp>
 
 #include <cstddef>
@@ -38,15 +40,31 @@ void bindHL_GPIO(py::module& pM)
     py::class_<GPIO, casil::HL::RegisterDriver>(pM, "GPIO", "Driver for the gpio firmware module.")
             .def(py::init<std::string, GPIO::InterfaceBaseType&, casil::LayerConfig>(), "Constructor.",
                  py::arg("name"), py::arg("interface"), py::arg("config"))
-            .def("getData", &GPIO::getData, "Get the INPUT register.", py::arg("size") = -1, py::arg("addrOffs") = 0u)
-            .def("setData", &GPIO::setData, "Set the OUTPUT register.", py::arg("data"), py::arg("addrOffs") = 0u)
+            .def("getData", &GPIO::getData, "Get the INPUT register.", py::arg("size") = -1, py::arg("addrOffs") = 0u,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("setData", &GPIO::setData, "Set the OUTPUT register.", py::arg("data"), py::arg("addrOffs") = 0u,
+                 py::call_guard<py::gil_scoped_release>())
             .def("getSize", &GPIO::getSize, "Get the number of IO bits.")
-            .def("getOutputEn", &GPIO::getOutputEn, "Get the OUTPUT_EN register.")
-            .def("setOutputEn", &GPIO::setOutputEn, "Set the OUTPUT_EN register.", py::arg("enable"))
+            .def("getOutputEn", &GPIO::getOutputEn, "Get the OUTPUT_EN register.", py::call_guard<py::gil_scoped_release>())
+            .def("setOutputEn", &GPIO::setOutputEn, "Set the OUTPUT_EN register.", py::arg("enable"),
+                 py::call_guard<py::gil_scoped_release>())
             .def("bitsetFromBytes", [](const GPIO& pThis, const std::vector<std::uint8_t>& pBytes) -> std::vector<bool>
                                     { return PyCasilUtils::boolVecFromBitset(pThis.bitsetFromBytes(pBytes)); },
                                     "Convert IO register bytes to a bitset.", py::arg("bytes"))
             .def("bytesFromBitset", [](const GPIO& pThis, const std::vector<bool>& pBits) -> std::vector<std::uint8_t>
                                     { return pThis.bytesFromBitset(PyCasilUtils::bitsetFromBoolVec(pBits)); },
-                                    "Convert a bitset to IO register bytes.", py::arg("bits"));
+                                    "Convert a bitset to IO register bytes.", py::arg("bits"))
+            .def("setBits", &GPIO::setBits, "Set selected output bits to given values.", py::arg("mask"), py::arg("values"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("clearBits", &GPIO::clearBits, "Set selected output bits to 0.", py::arg("mask"), py::call_guard<py::gil_scoped_release>())
+            .def("toggleBits", &GPIO::toggleBits, "Invert selected output bits.", py::arg("mask"), py::call_guard<py::gil_scoped_release>())
+            .def("readBits", &GPIO::readBits, "Read selected input bits.", py::arg("mask"), py::call_guard<py::gil_scoped_release>())
+            .def("subscribeInputEdges", &GPIO::subscribeInputEdges, "Register a callback for input edges.",
+                 py::arg("mask"), py::arg("callback"))
+            .def("unsubscribeInputEdges", &GPIO::unsubscribeInputEdges, "Remove an input edge callback.", py::arg("id"))
+            .def("startInputMonitor", &GPIO::startInputMonitor, "Start polling the inputs in the background.", py::arg("period"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("stopInputMonitor", &GPIO::stopInputMonitor, "Stop the background input polling.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("inputMonitorRunning", &GPIO::inputMonitorRunning, "Check if the input monitor is running.");
 }
@@ -24,9 +24,14 @@
 #include <pycasil/pycasil.h>
 
 #include <casil/HL/Muxed/sitcpfifo.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <pybind11/numpy.h>
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -75,9 +80,9 @@ void bindHL_SiTCPFifo(py::module& pM)
                                     {
                                         SiTCPFifo *const tThis = &pThis;    //Need to be pedantic and capture pointer by value
                                         return py::cpp_function(
-                                            [tThis, pAttr]() -> std::size_t
+                                            [tThis, item = std::string(pAttr.substr(4))]() -> std::size_t
                                             {
-                                                return tThis->operator[](pAttr.substr(4));
+                                                return tThis->operator[](item);
                                             }
                                         );
                                     }
@@ -109,35 +114,87 @@ void bindHL_SiTCPFifo(py::module& pM)
                                 },
                  "Get a getter function for RESET/VERSION/FIFO_SIZE, a setter function for RESET or access these register-like attributes "
                  "as with __getitem__.", py::arg("attr"), py::is_operator())
-            .def("__setattr__", [](SiTCPFifo& pThis, const std::string_view pAttr, const std::uint8_t pValue) -> void
+            .def("__setattr__", [](const py::handle pSelf, const py::str& pAttr, const py::handle pValue) -> void
                                 {
-                                    if (pAttr == "RESET")
-                                        pThis.reset();
-                                    else
-                                    {
-                                        py::type selfType = py::type::of<SiTCPFifo>();
-                                        py::object selfObj = py::cast(pThis);
+                                    //Single binding that dispatches itself to avoid overload resolution for every attribute access
 
-                                        py::module::import("builtins").attr("super")(selfType, selfObj).attr("__setattr__")(pAttr, pValue);
+                                    if (pAttr.cast<std::string_view>() != "RESET")
+                                    {
+                                        //Equivalent to forwarding to super().__setattr__() but without the lookup
+                                        if (PyObject_GenericSetAttr(pSelf.ptr(), pAttr.ptr(), pValue.ptr()) != 0)
+                                            throw py::error_already_set();
+                                        return;
                                     }
+
+                                    py::detail::make_caster<std::uint8_t> valueCaster;
+
+                                    if (!valueCaster.load(pValue, true))
+                                        throw py::type_error("Invalid assignment.");
+
+                                    SiTCPFifo& self = pSelf.cast<SiTCPFifo&>();
+
+                                    const py::gil_scoped_release gilRelease;
+                                    (void)gilRelease;
+
+                                    self.reset();
                                 },
                  "Reset the FIFO via \"RESET\" or set a non-register attribute.", py::arg("attr"), py::arg("value"), py::is_operator())
-            .def("__setattr__", [](SiTCPFifo& pThis, const std::string_view pAttr, const py::object pArg)   //Catchall forward to super
-                                    -> void
-                                {
-                                    if (pAttr == "RESET")
-                                        throw py::type_error("Invalid assignment.");
-                                    else
+            .def("reset", &SiTCPFifo::reset, "Reset the FIFO.", py::call_guard<py::gil_scoped_release>())
+            .def("getVersion", &SiTCPFifo::getVersion, "Get the pseudo FIFO module version.", py::call_guard<py::gil_scoped_release>())
+            .def("getSiTCPInterface", &SiTCPFifo::getSiTCPInterface, "Get the SiTCP interface that provides the FIFO.",
+                 py::return_value_policy::reference)
+            .def("getFifoSize", &SiTCPFifo::getFifoSize, "Get the FIFO size in number of bytes.", py::call_guard<py::gil_scoped_release>())
+            .def("getFifoData", &SiTCPFifo::getFifoData, "Read the FIFO content as sequence of 32 bit unsigned integers.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("getFifoDataBlock", [](const SiTCPFifo& pThis) -> py::array_t<std::uint32_t>
+                                     {
+                                         //Expose the pooled block without copying; the capsule keeps the block alive as long as the array
+                                         std::unique_ptr<SiTCPFifo::DataBlockType> block;
+                                         {
+                                             const py::gil_scoped_release gilRelease;
+                                             (void)gilRelease;
+                                             block = std::make_unique<SiTCPFifo::DataBlockType>(pThis.getFifoDataBlock());
+                                         }
+                                         const SiTCPFifo::DataBlockType::element_type& words = **block;
+
+                                         py::capsule owner(block.get(), [](void* pBlock)
+                                                                        { delete static_cast<SiTCPFifo::DataBlockType*>(pBlock); });
+                                         (void)block.release();
+
+                                         py::array_t<std::uint32_t> array(static_cast<py::ssize_t>(words.size()), words.data(), owner);
+                                         array.attr("setflags")(py::arg("write") = false);
+
+                                         return array;
+                                     },
+                 "Read the FIFO content into a pooled block of 32 bit words (read-only numpy array without copy).")
+            .def("getFifoDataInto", [](const SiTCPFifo& pThis, py::array_t<std::uint32_t, py::array::c_style>& pArray) -> std::size_t
                                     {
-                                        py::type selfType = py::type::of<SiTCPFifo>();
-                                        py::object selfObj = py::cast(pThis);
+                                        if (pArray.ndim() != 1)
+                                            throw py::value_error("Array must be one-dimensional.");
 
-                                        py::module::import("builtins").attr("super")(selfType, selfObj).attr("__setattr__")(pAttr, pArg);
-                                    }
-                                }, "Set a non-register attribute.", py::arg("attr"), py::arg("arg"), py::is_operator())
-            .def("reset", &SiTCPFifo::reset, "Reset the FIFO.")
-            .def("getVersion", &SiTCPFifo::getVersion, "Get the pseudo FIFO module version.")
-            .def("getFifoSize", &SiTCPFifo::getFifoSize, "Get the FIFO size in number of bytes.")
-            .def("getFifoData", &SiTCPFifo::getFifoData, "Read the FIFO content as sequence of 32 bit unsigned integers.")
-            .def("setFifoData", &SiTCPFifo::setFifoData, "Write a sequence of 32 bit unsigned integers to the FIFO.", py::arg("data"));
+                                        const std::span<std::uint32_t> words(pArray.mutable_data(), static_cast<std::size_t>(pArray.size()));
+
+                                        const py::gil_scoped_release gilRelease;
+                                        (void)gilRelease;
+
+                                        return pThis.getFifoDataInto(words);
+                                    },
+                 "Read FIFO content into a preallocated numpy array of 32 bit words (uint32, C-contiguous).",
+                 py::arg("array").noconvert())
+            .def("setFifoData", [](const SiTCPFifo& pThis, const py::array_t<std::uint32_t, py::array::c_style>& pArray) -> void
+                                {
+                                    if (pArray.ndim() != 1)
+                                        throw py::value_error("Array must be one-dimensional.");
+
+                                    const std::span<const std::uint32_t> words(pArray.data(), static_cast<std::size_t>(pArray.size()));
+
+                                    const py::gil_scoped_release gilRelease;
+                                    (void)gilRelease;
+
+                                    pThis.setFifoData(words);
+                                },
+                 "Write a numpy array of 32 bit words (uint32, C-contiguous) to the FIFO in chunks.", py::arg("array").noconvert())
+            .def("setFifoData", py::overload_cast<const std::vector<std::uint32_t>&>(&SiTCPFifo::setFifoData, py::const_),
+                 "Write a sequence of 32 bit unsigned integers to the FIFO.", py::arg("data"),
+                 py::call_guard<py::gil_scoped_release>());
 }
@@ -22,17 +22,68 @@
 */
 
 #include <pycasil/pycasil.h>
+#include <pycasil/pycasil_asyncio.h>
 
 #include <casil/HL/driver.h>
 
+#include <pybind11/chrono.h>
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 using casil::HL::Driver;
 
 void bindHL_Driver(py::module& pM)
 {
-    py::class_<Driver, casil::LayerBase>(pM, "Driver", "Common base class for all driver components in the hardware layer (HL).")
-            .def("reset", &Driver::reset, "Reset the controlled device/module.")
-            .def("getData", &Driver::getData, "Get driver-specific special data.", py::arg("size") = -1, py::arg("addrOffs") = 0u)
-            .def("setData", &Driver::setData, "Set driver-specific special data.", py::arg("data"), py::arg("addrOffs") = 0u)
-            .def("exec", &Driver::exec, "Perform a driver-specific action.")
-            .def("isDone", &Driver::isDone, "Check if a driver-specific action has finished.");
+    py::class_<Driver, casil::LayerBase> driver(pM, "Driver", "Common base class for all driver components in the hardware layer (HL).");
+
+    py::class_<Driver::WaitPolicy>(driver, "WaitPolicy", "Polling parameters for waitUntilDone().")
+            .def(py::init<>(), "Constructor.")
+            .def_readwrite("initialInterval", &Driver::WaitPolicy::initialInterval, "Delay between the first two isDone() polls.")
+            .def_readwrite("maxInterval", &Driver::WaitPolicy::maxInterval, "Upper limit for the delay between two polls.")
+            .def_readwrite("backoffFactor", &Driver::WaitPolicy::backoffFactor,
+                           "Factor to increase the delay after each unsuccessful poll (at least 1).")
+            .def_readwrite("expectedDuration", &Driver::WaitPolicy::expectedDuration,
+                           "Expected remaining duration of the action (delay before the first poll).");
+
+    driver
+            .def("reset", &Driver::reset, "Reset the controlled device/module.", py::call_guard<py::gil_scoped_release>())
+            .def("getData", &Driver::getData, "Get driver-specific special data.", py::arg("size") = -1, py::arg("addrOffs") = 0u,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("setData", &Driver::setData, "Set driver-specific special data.", py::arg("data"), py::arg("addrOffs") = 0u,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("supportsAddressOffset", &Driver::supportsAddressOffset, "Check if setData() supports partial writes at a byte offset.")
+            .def("exec", &Driver::exec, "Perform a driver-specific action.", py::call_guard<py::gil_scoped_release>())
+            .def("isDone", &Driver::isDone, "Check if a driver-specific action has finished.", py::call_guard<py::gil_scoped_release>())
+            .def("waitUntilDone", static_cast<bool (Driver::*)(std::chrono::milliseconds, const Driver::WaitPolicy&)>(&Driver::waitUntilDone),
+                 "Wait for a driver-specific action to finish.", py::arg("timeout"), py::arg("policy") = Driver::WaitPolicy(),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("resetAsync", [](Driver& pThis) -> py::object { return PyCasilUtils::awaitAsync(pThis, [&pThis]() { pThis.reset(); }); },
+                 "Reset the controlled device/module (awaitable version for asyncio).")
+            .def("getDataAsync", [](Driver& pThis, const int pSize, const std::uint32_t pAddrOffs) -> py::object
+                                 {
+                                     return PyCasilUtils::awaitAsync(pThis, [&pThis, pSize, pAddrOffs]()
+                                                                            { return pThis.getData(pSize, pAddrOffs); });
+                                 },
+                 "Get driver-specific special data (awaitable version for asyncio).", py::arg("size") = -1, py::arg("addrOffs") = 0u)
+            .def("setDataAsync", [](Driver& pThis, std::vector<std::uint8_t> pData, const std::uint32_t pAddrOffs) -> py::object
+                                 {
+                                     return PyCasilUtils::awaitAsync(pThis, [&pThis, data = std::move(pData), pAddrOffs]()
+                                                                            { pThis.setData(data, pAddrOffs); });
+                                 },
+                 "Set driver-specific special data (awaitable version for asyncio).", py::arg("data"), py::arg("addrOffs") = 0u)
+            .def("execAsync", [](Driver& pThis) -> py::object { return PyCasilUtils::awaitAsync(pThis, [&pThis]() { pThis.exec(); }); },
+                 "Perform a driver-specific action (awaitable version for asyncio).")
+            .def("isDoneAsync", [](Driver& pThis) -> py::object
+                                { return PyCasilUtils::awaitAsync(pThis, [&pThis]() { return pThis.isDone(); }); },
+                 "Check if a driver-specific action has finished (awaitable version for asyncio).")
+            .def("waitUntilDoneAsync", [](Driver& pThis, const std::chrono::milliseconds pTimeout, const Driver::WaitPolicy& pPolicy) -> py::object
+                                       {
+                                           return PyCasilUtils::awaitAsync(pThis, [&pThis, pTimeout, pPolicy]()
+                                                                                  { return pThis.waitUntilDone(pTimeout, pPolicy); });
+                                       },
+                 "Wait for a driver-specific action to finish (awaitable version for asyncio).",
+                 py::arg("timeout"), py::arg("policy") = Driver::WaitPolicy());
 }
@@ -30,12 +30,22 @@ extern void bindHL_MuxedDriver(py::module&);
 
 extern void bindHL_RegisterDriver(py::module&);
 
+#ifndef PYCASIL_EXCLUDE_HL_DIRECT_DUMMYDRIVER
 extern void bindHL_DummyDriver(py::module&);
+#endif
+#ifndef PYCASIL_EXCLUDE_HL_DIRECT_SCPI
 extern void bindHL_SCPI(py::module&);
+#endif
+#ifndef PYCASIL_EXCLUDE_HL_DIRECT_VIRTECHO
 extern void bindHL_VirtEcho(py::module&);
+#endif
 
+#ifndef PYCASIL_EXCLUDE_HL_MUXED_DUMMYMUXEDDRIVER
 extern void bindHL_DummyMuxedDriver(py::module&);
+#endif
+#ifndef PYCASIL_EXCLUDE_HL_MUXED_GPIO
 extern void bindHL_GPIO(py::module&);
+#endif
 extern void bindHL_SiTCPFifo(py::module&);
 
 void bindHL(py::module& pM)
@@ -47,11 +57,21 @@ void bindHL(py::module& pM)
 
     bindHL_RegisterDriver(pM);
 
+#ifndef PYCASIL_EXCLUDE_HL_DIRECT_DUMMYDRIVER
     bindHL_DummyDriver(pM);
+#endif
+#ifndef PYCASIL_EXCLUDE_HL_DIRECT_SCPI
     bindHL_SCPI(pM);
+#endif
+#ifndef PYCASIL_EXCLUDE_HL_DIRECT_VIRTECHO
     bindHL_VirtEcho(pM);
+#endif
 
+#ifndef PYCASIL_EXCLUDE_HL_MUXED_DUMMYMUXEDDRIVER
     bindHL_DummyMuxedDriver(pM);
+#endif
+#ifndef PYCASIL_EXCLUDE_HL_MUXED_GPIO
     bindHL_GPIO(pM);
+#endif
     bindHL_SiTCPFifo(pM);
 }
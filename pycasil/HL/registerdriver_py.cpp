@@ -22,13 +22,16 @@
 */
 
 #include <pycasil/pycasil.h>
+#include <pycasil/pycasil_asyncio.h>
 
 #include <casil/HL/registerdriver.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -42,13 +45,13 @@ void bindHL_RegisterDriver(py::module& pM)
                                                                                                            std::vector<std::uint8_t>>
                                 { return pThis.get(pRegName); },
                                 "Read an integer or byte sequence from a register, according to its data type.",
-                                py::arg("regName"), py::is_operator())
+                                py::arg("regName"), py::is_operator(), py::call_guard<py::gil_scoped_release>())
             .def("__setitem__", [](RegisterDriver& pThis, const std::string_view pRegName, const std::uint64_t pValue) -> void
                                 { pThis.setValue(pRegName, pValue); }, "Write a value to a value register.",
-                 py::arg("regName"), py::arg("value"), py::is_operator())
+                 py::arg("regName"), py::arg("value"), py::is_operator(), py::call_guard<py::gil_scoped_release>())
             .def("__setitem__", [](RegisterDriver& pThis, const std::string_view pRegName, const std::vector<std::uint8_t>& pBytes) -> void
                                 { pThis.setBytes(pRegName, pBytes); }, "Write data to a byte array register.",
-                 py::arg("regName"), py::arg("bytes"), py::is_operator())
+                 py::arg("regName"), py::arg("bytes"), py::is_operator(), py::call_guard<py::gil_scoped_release>())
             .def("__setitem__", [](const RegisterDriver& pThis, const std::string_view pRegName, py::object) -> void
                                 {
                                     try
@@ -70,8 +73,10 @@ void bindHL_RegisterDriver(py::module& pM)
                                     {
                                         RegisterDriver *const tThis = &pThis;   //Need to be pedantic and capture pointer by value
                                         return py::cpp_function(
-                                            [tThis, pAttr]() -> std::variant<std::uint64_t, std::vector<std::uint8_t>>
-                                            { return tThis->get(pAttr.substr(4)); }
+                                            [tThis, regName = std::string(pAttr.substr(4))]() -> std::variant<std::uint64_t,
+                                                                                                              std::vector<std::uint8_t>>
+                                            { return tThis->get(regName); },
+                                            py::call_guard<py::gil_scoped_release>()
                                         );
                                     }
                                     else if (pAttr.starts_with("set_") && pAttr.length() >= 5 &&
@@ -79,21 +84,27 @@ void bindHL_RegisterDriver(py::module& pM)
                                     {
                                         RegisterDriver *const tThis = &pThis;   //Need to be pedantic and capture pointer by value
                                         return py::cpp_function(
-                                            [tThis, pAttr](const std::variant<std::uint64_t, std::vector<std::uint8_t>> pValue)
-                                                -> void
+                                            [tThis, regName = std::string(pAttr.substr(4))](
+                                                    const std::variant<std::uint64_t, std::vector<std::uint8_t>> pValue) -> void
                                             {
                                                 if (std::holds_alternative<std::uint64_t>(pValue))
-                                                    tThis->set(pAttr.substr(4), std::get<std::uint64_t>(pValue));
+                                                    tThis->set(regName, std::get<std::uint64_t>(pValue));
                                                 else
-                                                    tThis->set(pAttr.substr(4), std::get<std::vector<std::uint8_t>>(pValue));
-                                            }
+                                                    tThis->set(regName, std::get<std::vector<std::uint8_t>>(pValue));
+                                            },
+                                            py::call_guard<py::gil_scoped_release>()
                                         );
                                     }
                                     else if (RegisterDriver::isValidRegisterName(pAttr))
                                     {
                                         try
                                         {
-                                            std::variant<std::uint64_t, std::vector<std::uint8_t>> regVal = pThis.get(pAttr);
+                                            std::variant<std::uint64_t, std::vector<std::uint8_t>> regVal;
+                                            {
+                                                const py::gil_scoped_release gilRelease;
+                                                (void)gilRelease;
+                                                regVal = pThis.get(pAttr);
+                                            }
 
                                             if (std::holds_alternative<std::uint64_t>(regVal))
                                                 return std::get<std::uint64_t>(regVal);
@@ -111,94 +122,134 @@ void bindHL_RegisterDriver(py::module& pM)
                                 },
                  "Read from a register (return type according to its data type) or get a register getter/setter function.",
                  py::arg("attr"), py::is_operator())
-            .def("__setattr__", [](RegisterDriver& pThis, const std::string_view pAttr, const std::uint64_t pValue) -> void
+            .def("__setattr__", [](const py::handle pSelf, const py::str& pAttr, const py::handle pValue) -> void
                                 {
-                                    if (RegisterDriver::isValidRegisterName(pAttr))
-                                    {
-                                        try
-                                        {
-                                            pThis.setValue(pAttr, pValue);
-                                            return;
-                                        }
-                                        catch (const std::invalid_argument&)
-                                        {
-                                            throw;
-                                        }
-                                    }
-                                    else
-                                    {
-                                        py::type selfType = py::type::of<RegisterDriver>();
-                                        py::object selfObj = py::cast(pThis);
+                                    //Single binding dispatching on the value type to avoid overload resolution on every access
 
-                                        py::module::import("builtins").attr("super")(selfType, selfObj).attr("__setattr__")(pAttr, pValue);
-                                    }
-                                },
-                 "Write a value to a value register or set a non-register attribute.", py::arg("attr"), py::arg("value"), py::is_operator())
-            .def("__setattr__", [](RegisterDriver& pThis, const std::string_view pAttr, const std::vector<std::uint8_t>& pBytes) -> void
-                                {
-                                    if (RegisterDriver::isValidRegisterName(pAttr))
+                                    const auto attr = pAttr.cast<std::string_view>();
+
+                                    if (!RegisterDriver::isValidRegisterName(attr))
                                     {
-                                        try
-                                        {
-                                            pThis.setBytes(pAttr, pBytes);
-                                            return;
-                                        }
-                                        catch (const std::invalid_argument&)
-                                        {
-                                            throw;
-                                        }
+                                        //Equivalent to forwarding to super().__setattr__() but without the lookup
+                                        if (PyObject_GenericSetAttr(pSelf.ptr(), pAttr.ptr(), pValue.ptr()) != 0)
+                                            throw py::error_already_set();
+                                        return;
                                     }
-                                    else
-                                    {
-                                        py::type selfType = py::type::of<RegisterDriver>();
-                                        py::object selfObj = py::cast(pThis);
 
-                                        py::module::import("builtins").attr("super")(selfType, selfObj).attr("__setattr__")(pAttr, pBytes);
-                                    }
-                                },
-                 "Write data to a byte array register or set a non-register attribute.", py::arg("attr"), py::arg("bytes"), py::is_operator())
-            .def("__setattr__", [](RegisterDriver& pThis, const std::string_view pAttr, const py::object pArg)      //Catchall forward to super
-                                    -> void
-                                {
-                                    if (RegisterDriver::isValidRegisterName(pAttr))
+                                    RegisterDriver& self = pSelf.cast<RegisterDriver&>();
+
+                                    py::detail::make_caster<std::uint64_t> valueCaster;
+                                    py::detail::make_caster<std::vector<std::uint8_t>> bytesCaster;
+
+                                    if (valueCaster.load(pValue, true))
                                     {
-                                        try
-                                        {
-                                            if (pThis.testRegisterName(pAttr))
-                                                throw py::type_error("Invalid assignment.");
-                                        }
-                                        catch (const std::invalid_argument&)
-                                        {
-                                            throw;
-                                        }
+                                        const auto value = py::detail::cast_op<std::uint64_t>(valueCaster);
+
+                                        const py::gil_scoped_release gilRelease;
+                                        (void)gilRelease;
+
+                                        self.setValue(attr, value);
                                     }
-                                    else
+                                    else if (bytesCaster.load(pValue, true))
                                     {
-                                        py::type selfType = py::type::of<RegisterDriver>();
-                                        py::object selfObj = py::cast(pThis);
+                                        const py::gil_scoped_release gilRelease;
+                                        (void)gilRelease;
 
-                                        py::module::import("builtins").attr("super")(selfType, selfObj).attr("__setattr__")(pAttr, pArg);
+                                        self.setBytes(attr, py::detail::cast_op<const std::vector<std::uint8_t>&>(bytesCaster));
                                     }
+                                    else if (self.testRegisterName(attr))
+                                        throw py::type_error("Invalid assignment.");
                                 },
-                 "Write something else to a register (will fail) or set a non-register attribute.",
-                 py::arg("attr"), py::arg("arg"), py::is_operator())
-            .def("reset", &RegisterDriver::reset, "Reset the firmware module.")
-            .def("applyDefaults", &RegisterDriver::applyDefaults, "Write configured default values to all appropriate registers.")
+                 "Write a value or data to a register (according to the assigned type) or set a non-register attribute.",
+                 py::arg("attr"), py::arg("value"), py::is_operator())
+            .def("reset", &RegisterDriver::reset, "Reset the firmware module.", py::call_guard<py::gil_scoped_release>())
+            .def("applyDefaults", &RegisterDriver::applyDefaults, "Write configured default values to all appropriate registers.",
+                 py::arg("verify") = false, py::call_guard<py::gil_scoped_release>())
             .def("getBytes", [](RegisterDriver& pThis, const std::string_view pRegName) -> std::vector<std::uint8_t>
-                             { return pThis.getBytes(pRegName); }, "Read the data from a byte array register.", py::arg("regName"))
-            .def("setBytes", &RegisterDriver::setBytes, "Write data to a byte array register.", py::arg("regName"), py::arg("data"))
+                             { return pThis.getBytes(pRegName); }, "Read the data from a byte array register.", py::arg("regName"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("setBytes", &RegisterDriver::setBytes, "Write data to a byte array register.", py::arg("regName"), py::arg("data"),
+                 py::call_guard<py::gil_scoped_release>())
             .def("getValue", [](RegisterDriver& pThis, const std::string_view pRegName) -> std::uint64_t
-                             { return pThis.getValue(pRegName); }, "Read the value from a value register.", py::arg("regName"))
-            .def("setValue", &RegisterDriver::setValue, "Write a value to a value register.", py::arg("regName"), py::arg("value"))
+                             { return pThis.getValue(pRegName); }, "Read the value from a value register.", py::arg("regName"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("setValue", &RegisterDriver::setValue, "Write a value to a value register.", py::arg("regName"), py::arg("value"),
+                 py::call_guard<py::gil_scoped_release>())
             .def("get", [](RegisterDriver& pThis, const std::string_view pRegName) -> std::variant<std::uint64_t, std::vector<std::uint8_t>>
                         { return pThis.get(pRegName); },
-                        "Read an integer or byte sequence from a register, according to its data type.", py::arg("regName"))
+                        "Read an integer or byte sequence from a register, according to its data type.", py::arg("regName"),
+                 py::call_guard<py::gil_scoped_release>())
             .def("set", [](RegisterDriver& pThis, const std::string_view pRegName, const std::uint64_t pValue) -> void
-                        { pThis.setValue(pRegName, pValue); }, "Write a value to a value register.", py::arg("regName"), py::arg("value"))
+                        { pThis.setValue(pRegName, pValue); }, "Write a value to a value register.", py::arg("regName"), py::arg("value"),
+                 py::call_guard<py::gil_scoped_release>())
             .def("set", [](RegisterDriver& pThis, const std::string_view pRegName, const std::vector<std::uint8_t>& pBytes) -> void
-                        { pThis.setBytes(pRegName, pBytes); }, "Write data to a byte array register.", py::arg("regName"), py::arg("bytes"))
+                        { pThis.setBytes(pRegName, pBytes); }, "Write data to a byte array register.", py::arg("regName"), py::arg("bytes"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("set", py::overload_cast<const std::vector<std::pair<std::string, std::variant<std::uint64_t, std::vector<std::uint8_t>>>>&,
+                                          bool>(&RegisterDriver::set), "Write multiple registers with merged bus accesses.",
+                 py::arg("updates"), py::arg("verify") = false, py::call_guard<py::gil_scoped_release>())
+            .def("set", [](RegisterDriver& pThis, const py::dict& pUpdates, const bool pVerify) -> void
+                        {
+                            std::vector<std::pair<std::string, std::variant<std::uint64_t, std::vector<std::uint8_t>>>> updates;
+                            updates.reserve(pUpdates.size());
+
+                            for (const auto& [regName, regContent] : pUpdates)
+                            {
+                                updates.emplace_back(py::cast<std::string>(regName),
+                                                     py::cast<std::variant<std::uint64_t, std::vector<std::uint8_t>>>(regContent));
+                            }
+
+                            const py::gil_scoped_release gilRelease;
+                            (void)gilRelease;
+
+                            pThis.set(updates, pVerify);
+                        },
+                 "Write multiple registers (given as dict) with merged bus accesses.", py::arg("updates"), py::arg("verify") = false)
+            .def("getMultiple", &RegisterDriver::getMultiple, "Read multiple registers with merged bus accesses.", py::arg("regNames"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("getDict", [](const RegisterDriver& pThis, const std::vector<std::string>& pRegNames) -> py::dict
+                            {
+                                std::vector<std::variant<std::uint64_t, std::vector<std::uint8_t>>> contents;
+                                {
+                                    const py::gil_scoped_release gilRelease;
+                                    (void)gilRelease;
+                                    contents = pThis.getMultiple(pRegNames);
+                                }
+
+                                py::dict retVal;
+                                for (std::size_t i = 0; i < pRegNames.size(); ++i)
+                                    retVal[py::str(pRegNames[i])] = py::cast(std::move(contents[i]));
+                                return retVal;
+                            },
+                 "Read multiple registers with merged bus accesses and return a dict of register names and contents.", py::arg("regNames"))
+            .def("getAsync", [](RegisterDriver& pThis, std::string pRegName) -> py::object
+                             {
+                                 return PyCasilUtils::awaitAsync(pThis, [&pThis, regName = std::move(pRegName)]()
+                                                                        { return pThis.get(regName); });
+                             },
+                 "Read an integer or byte sequence from a register (awaitable version for asyncio).", py::arg("regName"))
+            .def("setAsync", [](RegisterDriver& pThis, std::string pRegName,
+                                std::variant<std::uint64_t, std::vector<std::uint8_t>> pValue) -> py::object
+                             {
+                                 return PyCasilUtils::awaitAsync(pThis, [&pThis, regName = std::move(pRegName), value = std::move(pValue)]()
+                                                                        {
+                                                                            if (std::holds_alternative<std::uint64_t>(value))
+                                                                                pThis.setValue(regName, std::get<std::uint64_t>(value));
+                                                                            else
+                                                                                pThis.setBytes(regName, std::get<std::vector<std::uint8_t>>(value));
+                                                                        });
+                             },
+                 "Write a value or byte sequence to a register (awaitable version for asyncio).", py::arg("regName"), py::arg("value"))
+            .def("verifyRegisters", &RegisterDriver::verifyRegisters, "Verify the content of read-write registers by reading them back.",
+                 py::arg("regNames"), py::call_guard<py::gil_scoped_release>())
             .def("trigger", &RegisterDriver::trigger, "\"Trigger\" a write-only register by writing configured default or zero.",
-                 py::arg("regName"))
+                 py::arg("regName"), py::call_guard<py::gil_scoped_release>())
+            .def("getShadow", &RegisterDriver::getShadow, "Get the last known register content from the shadow memory.", py::arg("regName"))
+            .def("invalidateShadow", &RegisterDriver::invalidateShadow, "Mark the whole shadow memory content as unknown.")
+            .def("snapshot", &RegisterDriver::snapshot, "Read the content of all read-write registers as a compact binary blob.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("restore", &RegisterDriver::restore, "Write back the content of all read-write registers from a snapshot() blob.",
+                 py::arg("snapshot"), py::call_guard<py::gil_scoped_release>())
             .def("testRegisterName", &RegisterDriver::testRegisterName, "Check if a register exists or raise an exception else.",
                  py::arg("regName"))
             .def_static("isValidRegisterName", &RegisterDriver::isValidRegisterName, "Check if a string could be a valid register name.",
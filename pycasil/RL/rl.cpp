@@ -25,13 +25,19 @@
 
 extern void bindRL_Register(py::module&);
 
+#ifndef PYCASIL_EXCLUDE_RL_DUMMYREGISTER
 extern void bindRL_DummyRegister(py::module&);
+#endif
 extern void bindRL_StandardRegister(py::module&);
+extern void bindRL_ValueRegister(py::module&);
 
 void bindRL(py::module& pM)
 {
     bindRL_Register(pM);
 
+#ifndef PYCASIL_EXCLUDE_RL_DUMMYREGISTER
     bindRL_DummyRegister(pM);
+#endif
     bindRL_StandardRegister(pM);
+    bindRL_ValueRegister(pM);
 }
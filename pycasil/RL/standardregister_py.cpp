@@ -22,57 +22,124 @@
 */
 
 #include <pycasil/pycasil.h>
+#include <pycasil/pycasil_asyncio.h>
+
+#include <pybind11/numpy.h>
 
 #include <casil/RL/standardregister.h>
 
 #include <boost/dynamic_bitset.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <optional>
+#include <functional>
+#include <future>
+#include <memory>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 using casil::RL::StandardRegister;
 using RegField = StandardRegister::RegField;
+using FieldView = StandardRegister::FieldView;
+
+namespace
+{
+
+using BoolArray = py::array_t<bool, py::array::c_style | py::array::forcecast>;
+
+/*
+ * Create a numpy bool array from a bitset (same bit order as PyCasilUtils::boolVecFromBitset()).
+ */
+py::array_t<bool> boolArrayFromBitset(const boost::dynamic_bitset<>& pBits)
+{
+    py::array_t<bool> array(static_cast<py::ssize_t>(pBits.size()));
+    PyCasilUtils::boolRangeFromBitset(pBits, std::span<bool>(array.mutable_data(), pBits.size()));
+    return array;
+}
+
+/*
+ * Create a bitset from a one-dimensional numpy bool array (same bit order as PyCasilUtils::bitsetFromBoolVec()).
+ */
+boost::dynamic_bitset<> bitsetFromBoolArray(const BoolArray& pArray)
+{
+    if (pArray.ndim() != 1)
+        throw std::invalid_argument("Bits array must be one-dimensional.");
+    return PyCasilUtils::bitsetFromBoolRange(std::span<const bool>(pArray.data(), static_cast<std::size_t>(pArray.size())));
+}
+
+/*
+ * Resolve a field path like "FIELD.SUB_FIELD.#3.BIT" by walking the (read-only) field tree from its root field.
+ */
+const RegField& resolveFieldPath(const RegField& pRoot, const std::string_view pFieldPath)
+{
+    const RegField* field = &pRoot;
+
+    std::size_t begin = 0;
+    while (begin <= pFieldPath.size())
+    {
+        const std::size_t end = std::min(pFieldPath.find('.', begin), pFieldPath.size());
+        field = &(field->operator[](pFieldPath.substr(begin, end - begin)));
+        begin = end + 1;
+    }
+
+    return *field;
+}
+
+} // namespace
 
 /*
  * This is a wrapper for read-only RegField access as pybind11 mapping breaks constness of returned 'const T&'.
+ *
+ * Fields that only exist as temporaries (slices, bit selections) are kept alive by a shared owner, such that
+ * copying/moving the (lightweight) wrapper never copies the field itself and sub-field wrappers stay valid.
  */
 class PyConstRegField
 {
 public:
-    PyConstRegField(const RegField& pRegField, const bool pCopy) :
-        consumedRegField(pCopy ? std::make_optional(pRegField) : std::nullopt),
-        regField(pCopy ? consumedRegField.value() : pRegField) {}
-    PyConstRegField(const PyConstRegField& pOther) = default;
-    PyConstRegField(PyConstRegField&&) = delete;
+    PyConstRegField(const RegField& pRegField, std::shared_ptr<const RegField> pOwner) :
+        owner(std::move(pOwner)),
+        regField(&pRegField) {}
+    PyConstRegField(const PyConstRegField&) = default;
+    PyConstRegField(PyConstRegField&&) = default;
     ~PyConstRegField() = default;
     //
     PyConstRegField& operator=(const PyConstRegField&) = delete;
     PyConstRegField& operator=(PyConstRegField&&) = delete;
     //
-    std::uint64_t toUInt() const { return regField.toUInt(); }
-    boost::dynamic_bitset<> toBits() const { return regField.toBits(); }
+    std::uint64_t toUInt() const { return regField->toUInt(); }
+    boost::dynamic_bitset<> toBits() const { return regField->toBits(); }
     //
-    PyConstRegField operator[](const std::string_view pFieldName) const { return PyConstRegField(regField.operator[](pFieldName), false); }
-    bool operator[](const std::size_t pIdx) const { return regField.operator[](pIdx).get(); }
+    PyConstRegField operator[](const std::string_view pFieldName) const { return PyConstRegField(regField->operator[](pFieldName), owner); }
+    bool operator[](const std::size_t pIdx) const { return regField->operator[](pIdx).get(); }
     PyConstRegField operator()(const std::size_t pMsbIdx, const std::size_t pLsbIdx) const
-        { return PyConstRegField(const_cast<RegField&>(regField).operator()(pMsbIdx, pLsbIdx), true); }
+        { return consume(const_cast<RegField&>(*regField).operator()(pMsbIdx, pLsbIdx)); }
     PyConstRegField operator[](const std::vector<std::size_t>& pIdxs) const
-        { return PyConstRegField(const_cast<RegField&>(regField).operator[](pIdxs), true); }
+        { return consume(const_cast<RegField&>(*regField).operator[](pIdxs)); }
+    //
+    PyConstRegField n(const std::size_t pFieldRepIdx) const { return PyConstRegField(regField->n(pFieldRepIdx), owner); }
     //
-    PyConstRegField n(const std::size_t pFieldRepIdx) const { return PyConstRegField(regField.n(pFieldRepIdx), false); }
+    std::vector<std::uint64_t> getRepeated(const std::string_view pFieldName) const { return regField->getRepeated(pFieldName); }
     //
-    std::uint64_t getSize() const { return regField.getSize(); }
-    std::uint64_t getOffset() const { return regField.getOffset(); }
-    std::uint64_t getTotalOffset() const { return regField.getTotalOffset(); }
+    std::uint64_t getSize() const { return regField->getSize(); }
+    std::uint64_t getOffset() const { return regField->getOffset(); }
+    std::uint64_t getTotalOffset() const { return regField->getTotalOffset(); }
 
 private:
-    const std::optional<RegField> consumedRegField;
-    const RegField& regField;
+    static PyConstRegField consume(const RegField& pTempRegField)
+    {
+        std::shared_ptr<const RegField> tOwner = std::make_shared<const RegField>(pTempRegField);
+        const RegField& tRegField = *tOwner;
+        return PyConstRegField(tRegField, std::move(tOwner));
+    }
+
+private:
+    std::shared_ptr<const RegField> owner;
+    const RegField* regField;
 };
 
 void bindRL_StandardRegister(py::module& pM)
@@ -137,7 +204,10 @@ void bindRL_StandardRegister(py::module& pM)
                                     const std::size_t lsbIdx = pSlice.attr("stop").cast<std::size_t>();
                                     if (!pSlice.attr("step").is_none())
                                         throw std::invalid_argument("Step size definition for slices is unsupported.");
-                                    pThis.operator()(msbIdx, lsbIdx) = pValue;
+                                    if (msbIdx >= lsbIdx)
+                                        pThis.view(msbIdx, lsbIdx) = pValue;   //Avoid creating a temporary field
+                                    else
+                                        pThis.operator()(msbIdx, lsbIdx) = pValue;
                                 }, "Assign an integer value to a slice of bits in the field.",
                                 py::arg("idxSlice"), py::arg("value"), py::is_operator())
             .def("__setitem__", [](RegField& pThis, const py::slice& pSlice, const std::vector<bool>& pBits)
@@ -147,7 +217,10 @@ void bindRL_StandardRegister(py::module& pM)
                                     const std::size_t lsbIdx = pSlice.attr("stop").cast<std::size_t>();
                                     if (!pSlice.attr("step").is_none())
                                         throw std::invalid_argument("Step size definition for slices is unsupported.");
-                                    pThis.operator()(msbIdx, lsbIdx) = PyCasilUtils::bitsetFromBoolVec(pBits);
+                                    if (msbIdx >= lsbIdx)
+                                        pThis.view(msbIdx, lsbIdx) = PyCasilUtils::bitsetFromBoolVec(pBits);   //Avoid creating a temporary field
+                                    else
+                                        pThis.operator()(msbIdx, lsbIdx) = PyCasilUtils::bitsetFromBoolVec(pBits);
                                 }, "Assign a bit sequence to a slice of bits in the field.",
                                 py::arg("idxSlice"), py::arg("bits"), py::is_operator())
             .def("__setitem__", [](RegField& pThis, const py::slice& pSlice, py::object) -> void
@@ -196,12 +269,52 @@ void bindRL_StandardRegister(py::module& pM)
             .def("toUInt", &RegField::toUInt, "Get the integer equivalent of field's content.")
             .def("toBits", [](const RegField& pThis) -> std::vector<bool>
                            { return PyCasilUtils::boolVecFromBitset(pThis.toBits()); }, "Get the field's data as raw bitset.")
+            .def("setArray", [](RegField& pThis, const BoolArray& pBits) -> void { pThis.set(::bitsetFromBoolArray(pBits)); },
+                 "Assign a raw bit sequence from a numpy bool array to the field.", py::arg("bits"))
+            .def("toArray", [](const RegField& pThis) -> py::array_t<bool> { return ::boolArrayFromBitset(pThis.toBits()); },
+                 "Get the field's data as numpy bool array.")
             .def("n", [](RegField& pThis, const std::size_t pFieldRepIdx) -> RegField& { return pThis.n(pFieldRepIdx); },
                  "Access the n-th repetition of the field.", py::arg("fieldRepIdx"), py::return_value_policy::reference)
+            .def("setRepeated", [](RegField& pThis, const py::array_t<std::uint64_t, py::array::c_style | py::array::forcecast>& pValues,
+                                   const std::string_view pFieldName) -> void
+                                {
+                                    if (pValues.ndim() != 1)
+                                        throw std::invalid_argument("Values array must be one-dimensional.");
+                                    pThis.setRepeated(std::span<const std::uint64_t>(pValues.data(), static_cast<std::size_t>(pValues.size())),
+                                                      pFieldName);
+                                }, "Assign integer values to all field repetitions.", py::arg("values"), py::arg("fieldName") = "")
+            .def("getRepeated", [](const RegField& pThis, const std::string_view pFieldName) -> py::array_t<std::uint64_t>
+                                {
+                                    const std::vector<std::uint64_t> values = pThis.getRepeated(pFieldName);
+                                    return py::array_t<std::uint64_t>(static_cast<py::ssize_t>(values.size()), values.data());
+                                }, "Get integer values of all field repetitions.", py::arg("fieldName") = "")
             .def("getSize", &RegField::getSize, "Get the size of the field.")
             .def("__len__", &RegField::getSize, "Get the size of the field.", py::is_operator())
             .def("getOffset", &RegField::getOffset, "Get the field's offset with respect to its parent field.")
-            .def("getTotalOffset", &RegField::getTotalOffset, "Get the field's total offset with respect to the whole register.");
+            .def("getTotalOffset", &RegField::getTotalOffset, "Get the field's total offset with respect to the whole register.")
+            .def("view", &RegField::view, "Access a slice of bits in the field without creating a new field.",
+                 py::arg("msbIdx"), py::arg("lsbIdx"), py::keep_alive<0, 1>());
+
+    py::class_<FieldView>(pM, "FieldView", "Lightweight view of a contiguous slice of a register field.")
+            .def("__getitem__", [](const FieldView& pThis, const py::slice& pSlice) -> FieldView
+                                {
+                                    const std::size_t msbIdx = pSlice.attr("start").cast<std::size_t>();
+                                    const std::size_t lsbIdx = pSlice.attr("stop").cast<std::size_t>();
+                                    if (!pSlice.attr("step").is_none())
+                                        throw std::invalid_argument("Step size definition for slices is unsupported.");
+                                    return pThis.operator()(msbIdx, lsbIdx);
+                                }, "Access a sub-slice of bits in the slice.", py::arg("idxSlice"), py::keep_alive<0, 1>(), py::is_operator())
+            .def("set", [](FieldView& pThis, const std::uint64_t pValue) -> void
+                        { pThis.set(pValue); }, "Assign equivalent integer value to the slice.", py::arg("value"))
+            .def("set", [](FieldView& pThis, const std::vector<bool>& pBits) -> void
+                        { pThis.set(PyCasilUtils::bitsetFromBoolVec(pBits)); }, "Assign a raw bit sequence to the slice.", py::arg("bits"))
+            .def("setAll", &FieldView::setAll, "Set/unset all slice bits at once.", py::arg("value") = true)
+            .def("toUInt", &FieldView::toUInt, "Get the integer equivalent of slice's content.")
+            .def("toBits", [](const FieldView& pThis) -> std::vector<bool>
+                           { return PyCasilUtils::boolVecFromBitset(pThis.toBits()); }, "Get the slice's data as raw bitset.")
+            .def("getSize", &FieldView::getSize, "Get the size of the slice.")
+            .def("__len__", &FieldView::getSize, "Get the size of the slice.", py::is_operator())
+            .def("getOffset", &FieldView::getOffset, "Get the slice's least significant bit index in the viewed field.");
 
     py::class_<PyConstRegField>(pM, "PyConstRegField", "Proxy class for accessing an individual register field (read-only field tree).")
             .def("__getitem__", [](const PyConstRegField& pThis, const std::size_t pIdx) -> bool
@@ -223,8 +336,15 @@ void bindRL_StandardRegister(py::module& pM)
             .def("toUInt", &PyConstRegField::toUInt, "Get the integer equivalent of field's content.")
             .def("toBits", [](const PyConstRegField& pThis) -> std::vector<bool>
                            { return PyCasilUtils::boolVecFromBitset(pThis.toBits()); }, "Get the field's data as raw bitset.")
+            .def("toArray", [](const PyConstRegField& pThis) -> py::array_t<bool> { return ::boolArrayFromBitset(pThis.toBits()); },
+                 "Get the field's data as numpy bool array.")
             .def("n", [](const PyConstRegField& pThis, const std::size_t pFieldRepIdx) -> PyConstRegField
                       { return pThis.n(pFieldRepIdx); }, "Access the n-th repetition of the field.", py::arg("fieldRepIdx"))
+            .def("getRepeated", [](const PyConstRegField& pThis, const std::string_view pFieldName) -> py::array_t<std::uint64_t>
+                                {
+                                    const std::vector<std::uint64_t> values = pThis.getRepeated(pFieldName);
+                                    return py::array_t<std::uint64_t>(static_cast<py::ssize_t>(values.size()), values.data());
+                                }, "Get integer values of all field repetitions.", py::arg("fieldName") = "")
             .def("getSize", &PyConstRegField::getSize, "Get the size of the field.")
             .def("__len__", &PyConstRegField::getSize, "Get the size of the field.", py::is_operator())
             .def("getOffset", &PyConstRegField::getOffset, "Get the field's offset with respect to its parent field.")
@@ -277,22 +397,99 @@ void bindRL_StandardRegister(py::module& pM)
                                 py::arg("fieldPath"), py::arg("arg"), py::is_operator())
             .def("root", [](StandardRegister& pThis) -> RegField& { return pThis.root(); }, "Get the root field node.",
                  py::return_value_policy::reference)
-            .def("rootRead", [](const StandardRegister& pThis) -> PyConstRegField { return PyConstRegField(pThis.rootRead(), false); },
+            .def("rootRead", [](const StandardRegister& pThis) -> PyConstRegField { return PyConstRegField(pThis.rootRead(), nullptr); },
                  "Get the root field node for driver readback data.")
+            .def("field", [](StandardRegister& pThis, const std::string& pFieldPath) -> RegField& { return pThis.operator[](pFieldPath); },
+                 "Access a specific register field (same as __getitem__).", py::arg("fieldPath"), py::return_value_policy::reference)
+            .def("readField", [](const StandardRegister& pThis, const std::string_view pFieldPath) -> PyConstRegField
+                              { return PyConstRegField(::resolveFieldPath(pThis.rootRead(), pFieldPath), nullptr); },
+                 "Access a specific register field of the driver readback data.", py::arg("fieldPath"))
+            .def("getFields", [](const StandardRegister& pThis, const std::vector<std::string>& pFieldPaths) -> std::vector<std::uint64_t>
+                              {
+                                  std::vector<std::uint64_t> values;
+                                  values.reserve(pFieldPaths.size());
+                                  for (const std::string& fieldPath : pFieldPaths)
+                                      values.push_back(pThis.operator[](fieldPath).toUInt());
+                                  return values;
+                              },
+                 "Get the integer values of multiple register fields at once.", py::arg("fieldPaths"))
+            .def("getReadFields", [](const StandardRegister& pThis, const std::vector<std::string>& pFieldPaths) -> std::vector<std::uint64_t>
+                                  {
+                                      std::vector<std::uint64_t> values;
+                                      values.reserve(pFieldPaths.size());
+                                      for (const std::string& fieldPath : pFieldPaths)
+                                          values.push_back(::resolveFieldPath(pThis.rootRead(), fieldPath).toUInt());
+                                      return values;
+                                  },
+                 "Get the integer values of multiple readback data fields at once.", py::arg("fieldPaths"))
+            .def("setFields", [](StandardRegister& pThis, const std::vector<std::pair<std::string, std::uint64_t>>& pValues) -> void
+                              {
+                                  for (const auto& [fieldPath, value] : pValues)
+                                      pThis.operator[](fieldPath) = value;
+                              },
+                 "Assign integer values to multiple register fields at once.", py::arg("values"))
             .def("getSize", &StandardRegister::getSize, "Get the size of the register.")
             .def("__len__", &StandardRegister::getSize, "Get the size of the register.", py::is_operator())
-            .def("applyDefaults", &StandardRegister::applyDefaults, "Set register fields to configured default/init values.")
+            .def("applyDefaults", &StandardRegister::applyDefaults, "Set register fields to configured default/init values.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("set", [](StandardRegister& pThis, const std::uint64_t pValue) -> void
                         { pThis.set(pValue); }, "Assign equivalent integer value to the register.", py::arg("value"))
             .def("set", [](StandardRegister& pThis, const std::vector<bool>& pBits) -> void
                         { pThis.set(PyCasilUtils::bitsetFromBoolVec(pBits)); }, "Assign a raw bit sequence to the register.", py::arg("bits"))
             .def("setAll", &StandardRegister::setAll, "Set/unset all register bits at once.", py::arg("value") = true)
+            .def("setBitRange", &StandardRegister::setBitRange, "Assign equivalent integer value to a contiguous range of register bits.",
+                 py::arg("offs"), py::arg("size"), py::arg("value"))
+            .def("getBitRange", &StandardRegister::getBitRange, "Get the integer equivalent of a contiguous range of register bits.",
+                 py::arg("offs"), py::arg("size"))
+            .def("getReadBitRange", &StandardRegister::getReadBitRange, "Get the integer equivalent of a contiguous range of readback bits.",
+                 py::arg("offs"), py::arg("size"))
             .def("get", [](const StandardRegister& pThis) -> std::vector<bool>
                         { return PyCasilUtils::boolVecFromBitset(pThis.get()); }, "Get the register data as raw bit sequence.")
             .def("getRead", [](const StandardRegister& pThis) -> std::vector<bool>
                             { return PyCasilUtils::boolVecFromBitset(pThis.getRead()); }, "Get the driver readback data as a bit sequence.")
-            .def("write", &StandardRegister::write, "Write the register data to the driver.", py::arg("numBytes") = 0)
-            .def("read", &StandardRegister::read, "Read from the driver and assign to the readback data.", py::arg("numBytes") = 0)
+            .def("setArray", [](StandardRegister& pThis, const BoolArray& pBits) -> void { pThis.set(::bitsetFromBoolArray(pBits)); },
+                 "Assign a raw bit sequence from a numpy bool array to the register.", py::arg("bits"))
+            .def("getArray", [](const StandardRegister& pThis) -> py::array_t<bool> { return ::boolArrayFromBitset(pThis.get()); },
+                 "Get the register data as numpy bool array.")
+            .def("getReadArray", [](const StandardRegister& pThis) -> py::array_t<bool> { return ::boolArrayFromBitset(pThis.getRead()); },
+                 "Get the driver readback data as numpy bool array.")
+            .def("write", &StandardRegister::write, "Write the register data to the driver.", py::arg("numBytes") = 0,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("writeDirty", &StandardRegister::writeDirty, "Write only the register bytes changed since the last write to the driver.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def_static("writeGroup", &StandardRegister::writeGroup, "Write the data of several registers with combined driver calls per driver.",
+                        py::arg("registers"), py::call_guard<py::gil_scoped_release>())
+            .def("update", &StandardRegister::update, "Assign values to several register fields and write the changed bytes to the driver.",
+                 py::arg("fieldValues"), py::call_guard<py::gil_scoped_release>())
+            .def("read", &StandardRegister::read, "Read from the driver and assign to the readback data.", py::arg("numBytes") = 0,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("writeAsync", [](StandardRegister& pThis, const std::size_t pNumBytes) -> py::object
+                               {
+                                   return PyCasilUtils::awaitAsync(pThis, [&pThis, pNumBytes]() { pThis.write(pNumBytes); });
+                               },
+                 "Write the register data to the driver (awaitable version for asyncio).", py::arg("numBytes") = 0)
+            .def("readAsync", [](StandardRegister& pThis, const std::size_t pNumBytes) -> py::object
+                              {
+                                  return PyCasilUtils::awaitAsync(pThis, [&pThis, pNumBytes]() { pThis.read(pNumBytes); });
+                              },
+                 "Read from the driver and assign to the readback data (awaitable version for asyncio).", py::arg("numBytes") = 0)
+            .def("commitAsync", [](StandardRegister& pThis, const std::size_t pNumBytes) -> py::object
+                                {
+                                    std::shared_future<void> written;
+
+                                    {
+                                        const py::gil_scoped_release gilRelease;
+                                        (void)gilRelease;
+
+                                        written = pThis.commitAsync(pNumBytes).share();
+                                    }
+
+                                    //Queued behind the committed write on the same executor, hence does not block
+                                    return PyCasilUtils::awaitAsync(pThis, [written]() { written.get(); });
+                                },
+                 "Copy the register data to the front buffer and write it to the driver (awaitable version for asyncio).",
+                 py::arg("numBytes") = 0)
+            .def("compareReadback", &StandardRegister::compareReadback, "Compare the register data with the driver readback data.")
             .def("toBytes", &StandardRegister::toBytes, "Convert the register data to a byte sequence.")
             .def("fromBytes", &StandardRegister::fromBytes, "Load/assign the register data from a byte sequence.", py::arg("bytes"));
 }
@@ -0,0 +1,71 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/RL/valueregister.h>
+
+#include <pybind11/chrono.h>
+
+#include <string>
+
+using casil::RL::ValueRegister;
+
+void bindRL_ValueRegister(py::module& pM)
+{
+    py::class_<ValueRegister, casil::RL::Register> valueRegister(pM, "ValueRegister",
+                                                                  "Register that wraps a single value register of a RegisterDriver "
+                                                                  "and caches its content.");
+
+    py::enum_<ValueRegister::CachePolicy>(valueRegister, "CachePolicy", "Strategy for keeping the cached value and the driver register in sync.")
+            .value("WriteThrough", ValueRegister::CachePolicy::WriteThrough,
+                   "set() writes to the driver immediately and updates the cache; cached values never expire.")
+            .value("WriteBack", ValueRegister::CachePolicy::WriteBack,
+                   "set() only updates the cache; flush() (or close()) writes it to the driver; cached values never expire.")
+            .value("ReadCache", ValueRegister::CachePolicy::ReadCache,
+                   "set() writes to the driver and discards the cache; read values are only cached for the TTL.");
+
+    py::class_<ValueRegister::Statistics>(valueRegister, "Statistics", "Snapshot of the cache counters.")
+            .def_readonly("cacheHits", &ValueRegister::Statistics::cacheHits, "Number of get() calls served from the cache.")
+            .def_readonly("driverReads", &ValueRegister::Statistics::driverReads, "Number of register reads from the driver.")
+            .def_readonly("driverWrites", &ValueRegister::Statistics::driverWrites, "Number of register writes to the driver.");
+
+    valueRegister
+            .def(py::init<std::string, casil::HL::Driver&, casil::LayerConfig>(), "Constructor.",
+                 py::arg("name"), py::arg("driver"), py::arg("config"))
+            .def("get", &ValueRegister::get, "Get the register value (from the cache if possible).",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("fetch", &ValueRegister::fetch, "Read the register value from the driver and update the cache.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("set", &ValueRegister::set, "Set the register value (according to the cache policy).", py::arg("value"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("flush", &ValueRegister::flush, "Write a pending (write-back) value to the driver.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("invalidate", &ValueRegister::invalidate, "Discard the cached value.")
+            .def("isCached", &ValueRegister::isCached, "Check if a valid value is cached.")
+            .def("isDirty", &ValueRegister::isDirty, "Check if a written value is still pending (write-back).")
+            .def("getCachePolicy", &ValueRegister::getCachePolicy, "Get the configured cache policy.")
+            .def("getTTL", &ValueRegister::getTTL, "Get the configured cache lifetime of read values.")
+            .def("getRegisterName", &ValueRegister::getRegisterName, "Get the name of the wrapped driver register.")
+            .def("getStatistics", &ValueRegister::getStatistics, "Get the cache counters.");
+}
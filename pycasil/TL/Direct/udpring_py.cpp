@@ -0,0 +1,73 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <pycasil/pycasil.h>
+
+#include <casil/TL/Direct/udpring.h>
+
+#include <pybind11/chrono.h>
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using casil::TL::UDPRing;
+
+void bindTL_UDPRing(py::module& pM)
+{
+    py::class_<UDPRing, casil::TL::DirectInterface> udpRing(pM, "UDPRing", "Receive-only UDP interface for high-rate data streams "
+                                                                           "using a memory-mapped kernel packet ring (Linux only).");
+
+    py::class_<UDPRing::RingStatistics>(udpRing, "RingStatistics", "Packet counters of the ring.")
+            .def_readonly("packetsReceived", &UDPRing::RingStatistics::packetsReceived, "Number of packets that passed the socket filter.")
+            .def_readonly("packetsDropped", &UDPRing::RingStatistics::packetsDropped,
+                          "Number of packets dropped by the kernel because the ring was full.")
+            .def_readonly("ringFreezes", &UDPRing::RingStatistics::ringFreezes, "Number of times the ring was full.");
+
+    udpRing
+            .def(py::init<std::string, casil::LayerConfig>(), "Constructor.", py::arg("name"), py::arg("config"))
+            .def("getDatagrams", [](UDPRing& pSelf, const std::chrono::milliseconds pTimeout) -> std::vector<py::bytes>
+                 {
+                     std::vector<std::vector<std::uint8_t>> payloads;
+
+                     {
+                         const py::gil_scoped_release release;
+                         (void)release;
+
+                         (void)pSelf.consumeDatagrams([&payloads](const std::span<const std::uint8_t> pPayload)
+                                                      { payloads.emplace_back(pPayload.begin(), pPayload.end()); }, pTimeout);
+                     }
+
+                     std::vector<py::bytes> retVal;
+                     retVal.reserve(payloads.size());
+
+                     for (const std::vector<std::uint8_t>& payload : payloads)
+                         retVal.emplace_back(reinterpret_cast<const char*>(payload.data()), payload.size());
+
+                     return retVal;
+                 },
+                 "Extract the payloads of all available datagrams.", py::arg("timeout") = std::chrono::milliseconds::zero())
+            .def("getRingStatistics", &UDPRing::getRingStatistics, "Get the packet counters of the ring.");
+}
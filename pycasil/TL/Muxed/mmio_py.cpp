@@ -0,0 +1,70 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <pycasil/pycasil.h>
+
+#include <casil/TL/Muxed/mmio.h>
+
+#include <pybind11/numpy.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using casil::TL::MMIO;
+
+void bindTL_MMIO(py::module& pM)
+{
+    py::class_<MMIO, casil::TL::MuxedInterface>(pM, "MMIO", "Memory-mapped MuxedInterface for basil buses exposed via PCIe BARs "
+                                                             "or Linux UIO (e.g. AXI on SoC FPGAs).")
+            .def(py::init<std::string, casil::LayerConfig>(), "Constructor.", py::arg("name"), py::arg("config"))
+            .def("hasFifo", &MMIO::hasFifo, "Check if a DMA ring FIFO is configured.")
+            .def("resetFifo", &MMIO::resetFifo, "Discard the current FIFO content.", py::call_guard<py::gil_scoped_release>())
+            .def("getFifoSize", &MMIO::getFifoSize, "Get the FIFO size in number of bytes.")
+            .def("getFifoData", &MMIO::getFifoData, "Extract the current FIFO content as sequence of bytes.", py::arg("size") = -1,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("getFifoWords", [](MMIO& pSelf, const int pSize) -> py::array_t<std::uint32_t>
+                 {
+                     std::vector<std::uint32_t> words;
+
+                     {
+                         const py::gil_scoped_release release;
+                         (void)release;
+
+                         pSelf.consumeFifo([&words](const std::span<const std::uint32_t> pFirst, const std::span<const std::uint32_t> pSecond)
+                                           {
+                                               words.reserve(pFirst.size() + pSecond.size());
+                                               words.insert(words.end(), pFirst.begin(), pFirst.end());
+                                               words.insert(words.end(), pSecond.begin(), pSecond.end());
+                                           }, pSize);
+                     }
+
+                     return py::array_t<std::uint32_t>(static_cast<py::ssize_t>(words.size()), words.data());
+                 },
+                 "Extract the current FIFO content as numpy array of data words.", py::arg("size") = -1)
+            .def_readonly_static("baseAddrDataLimit", &MMIO::baseAddrDataLimit,
+                                 "Address limit below which read() / write() do normal bus access.")
+            .def_readonly_static("baseAddrFIFOLimit", &MMIO::baseAddrFIFOLimit,
+                                 "Address limit for special FIFO access of read().");
+}
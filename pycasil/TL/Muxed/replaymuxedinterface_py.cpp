@@ -0,0 +1,70 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/TL/Muxed/replaymuxedinterface.h>
+
+#include <pybind11/chrono.h>
+
+using casil::TL::ReplayMuxedInterface;
+
+void bindTL_ReplayMuxedInterface(py::module& pM)
+{
+    py::class_<ReplayMuxedInterface, casil::TL::MuxedInterface> replayMuxedInterface(pM, "ReplayMuxedInterface",
+                                                                                     "MuxedInterface that plays back a recorded session of bus "
+                                                                                     "transactions, including responses, timings and FIFO data.");
+
+    py::class_<ReplayMuxedInterface::Transaction> transaction(replayMuxedInterface, "Transaction", "Single recorded bus transaction.");
+
+    py::enum_<ReplayMuxedInterface::Transaction::Type>(transaction, "Type", "Transaction type.")
+            .value("Read", ReplayMuxedInterface::Transaction::Type::Read, "Read (bus or FIFO).")
+            .value("Write", ReplayMuxedInterface::Transaction::Type::Write, "Write (bus or FIFO).");
+
+    transaction
+            .def_readonly("startTime", &ReplayMuxedInterface::Transaction::startTime, "Start time relative to the start of the session.")
+            .def_readonly("duration", &ReplayMuxedInterface::Transaction::duration, "Duration of the transaction.")
+            .def_readonly("type", &ReplayMuxedInterface::Transaction::type, "Transaction type.")
+            .def_readonly("addr", &ReplayMuxedInterface::Transaction::addr, "Bus address.")
+            .def_readonly("size", &ReplayMuxedInterface::Transaction::size,
+                          "Requested number of bytes for reads (-1 if unspecified; 0 for writes).")
+            .def_readonly("data", &ReplayMuxedInterface::Transaction::data, "Read response or written data.");
+
+    py::class_<ReplayMuxedInterface::Statistics>(replayMuxedInterface, "Statistics", "Snapshot of the replay counters.")
+            .def_readonly("transactions", &ReplayMuxedInterface::Statistics::transactions, "Number of replayed transactions.")
+            .def_readonly("mismatches", &ReplayMuxedInterface::Statistics::mismatches,
+                          "Number of calls that did not match the recorded transaction.")
+            .def_readonly("loops", &ReplayMuxedInterface::Statistics::loops,
+                          "Number of completed passes through the session (if looping).")
+            .def_readonly("replayDelay", &ReplayMuxedInterface::Statistics::replayDelay,
+                          "Total delay added to reproduce the recorded durations.");
+
+    replayMuxedInterface
+            .def(py::init<std::string, casil::LayerConfig>(), "Constructor.", py::arg("name"), py::arg("config"))
+            .def("getSessionLength", &ReplayMuxedInterface::getSessionLength, "Get the number of transactions in the loaded session.")
+            .def("getPosition", &ReplayMuxedInterface::getPosition, "Get the index of the next transaction to be replayed.")
+            .def("isFinished", &ReplayMuxedInterface::isFinished, "Check if all transactions have been replayed.")
+            .def("getStatistics", &ReplayMuxedInterface::getStatistics, "Get the current replay counters.")
+            .def_static("loadSession", &ReplayMuxedInterface::loadSession, "Read all transactions from a session file.",
+                        py::arg("filePath"));
+}
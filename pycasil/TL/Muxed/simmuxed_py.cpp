@@ -0,0 +1,55 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/TL/Muxed/simmuxed.h>
+
+#include <pybind11/chrono.h>
+
+using casil::TL::SimMuxed;
+
+void bindTL_SimMuxed(py::module& pM)
+{
+    py::class_<SimMuxed, casil::TL::MuxedInterface> simMuxed(pM, "SimMuxed", "Simulated MuxedInterface with memory-backed address space, "
+                                                                             "generated FIFO data and a configurable link model.");
+
+    py::class_<SimMuxed::Statistics>(simMuxed, "Statistics", "Snapshot of the simulation counters.")
+            .def_readonly("transactions", &SimMuxed::Statistics::transactions, "Number of completed bus transactions.")
+            .def_readonly("bytesRead", &SimMuxed::Statistics::bytesRead, "Number of bytes read from the bus.")
+            .def_readonly("bytesWritten", &SimMuxed::Statistics::bytesWritten, "Number of bytes written to the bus.")
+            .def_readonly("packetsLost", &SimMuxed::Statistics::packetsLost, "Number of simulated lost packets (retransmissions).")
+            .def_readonly("fifoBytesRead", &SimMuxed::Statistics::fifoBytesRead, "Number of bytes read from the FIFO.")
+            .def_readonly("simulatedDelay", &SimMuxed::Statistics::simulatedDelay, "Total simulated link delay.");
+
+    simMuxed
+            .def(py::init<std::string, casil::LayerConfig>(), "Constructor.", py::arg("name"), py::arg("config"))
+            .def("getFifoSize", &SimMuxed::getFifoSize, "Get the FIFO size in number of bytes.")
+            .def("getFifoData", &SimMuxed::getFifoData, "Extract the current FIFO content as sequence of bytes.", py::arg("size") = -1,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("getStatistics", &SimMuxed::getStatistics, "Get the current simulation counters.")
+            .def_readonly_static("baseAddrDataLimit", &SimMuxed::baseAddrDataLimit,
+                                 "Address limit below which read() / write() do normal bus access.")
+            .def_readonly_static("baseAddrFIFOLimit", &SimMuxed::baseAddrFIFOLimit,
+                                 "Address limit for special FIFO access of read().");
+}
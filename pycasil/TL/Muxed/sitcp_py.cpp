@@ -25,20 +25,85 @@
 
 #include <casil/TL/Muxed/sitcp.h>
 
+#include <pybind11/chrono.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <vector>
+
 using casil::TL::SiTCP;
+using casil::TL::SiTCPFifoSubscription;
 
 void bindTL_SiTCP(py::module& pM)
 {
-    py::class_<SiTCP, casil::TL::MuxedInterface>(pM, "SiTCP", "Interface to connect to the basil bus on an FPGA "
-                                                              "that runs the SiTCP library for communication.")
+    py::class_<SiTCP, casil::TL::MuxedInterface> siTCP(pM, "SiTCP", "Interface to connect to the basil bus on an FPGA "
+                                                                    "that runs the SiTCP library for communication.");
+
+    py::class_<SiTCP::Statistics>(siTCP, "Statistics", "Snapshot of the link statistics counters.")
+            .def_readonly("fifoBytesReceived", &SiTCP::Statistics::fifoBytesReceived,
+                          "Number of bytes read from the TCP socket and added to the FIFO.")
+            .def_readonly("fifoHighWaterMark", &SiTCP::Statistics::fifoHighWaterMark, "Maximum FIFO size reached so far in number of bytes.")
+            .def_readonly("fifoOverflows", &SiTCP::Statistics::fifoOverflows,
+                          "Number of times received data did not fit below the FIFO size limit.")
+            .def_readonly("fifoBytesDropped", &SiTCP::Statistics::fifoBytesDropped,
+                          "Number of buffered bytes dropped to make room for newer data.")
+            .def_readonly("rbcpTransactions", &SiTCP::Statistics::rbcpTransactions, "Number of successfully completed RBCP transactions.")
+            .def_readonly("rbcpRetries", &SiTCP::Statistics::rbcpRetries, "Number of RBCP request retransmissions and response read retries.")
+            .def_readonly("rbcpWrongIdResponses", &SiTCP::Statistics::rbcpWrongIdResponses,
+                          "Number of received RBCP messages with wrong/unexpected ID.")
+            .def_readonly("rbcpLateResponses", &SiTCP::Statistics::rbcpLateResponses,
+                          "Number of late RBCP responses to requests that were already retransmitted or completed.")
+            .def_readonly("rbcpLatencyHistogram", &SiTCP::Statistics::rbcpLatencyHistogram,
+                          "Histogram of RBCP transaction latencies (logarithmic bins in microseconds).");
+
+    siTCP
             .def(py::init<std::string, casil::LayerConfig>(), "Constructor.", py::arg("name"), py::arg("config"))
-            .def("readBufferEmpty", &SiTCP::readBufferEmpty, "Check if the UDP read buffer is empty.")
-            .def("clearReadBuffer", &SiTCP::clearReadBuffer, "Clear the current contents of the UDP read buffer.")
-            .def("resetFifo", &SiTCP::resetFifo, "Clear the FIFO and the remaining incoming %TCP buffer.")
+            .def("readBufferEmpty", &SiTCP::readBufferEmpty, "Check if the UDP read buffer is empty.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("clearReadBuffer", &SiTCP::clearReadBuffer, "Clear the current contents of the UDP read buffer.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("resetFifo", &SiTCP::resetFifo, "Clear the FIFO and the remaining incoming %TCP buffer.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("getFifoSize", &SiTCP::getFifoSize, "Get the FIFO size in number of bytes.")
-            .def("getFifoData", &SiTCP::getFifoData, "Extract the current FIFO content as sequence of bytes.", py::arg("size") = -1)
+            .def("getFifoData", &SiTCP::getFifoData, "Extract the current FIFO content as sequence of bytes.", py::arg("size") = -1,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("getFifoChunks",
+                 [](SiTCP& pSelf, const int pSize)
+                 {
+                     std::vector<std::tuple<std::chrono::steady_clock::time_point, std::uint64_t, std::vector<std::uint32_t>>> chunks;
+
+                     pSelf.consumeFifoChunks([&chunks](const std::chrono::steady_clock::time_point pTimestamp,
+                                                       const std::uint64_t pSequenceNumber, const std::span<const std::uint32_t> pWords)
+                                             {
+                                                 chunks.emplace_back(pTimestamp, pSequenceNumber,
+                                                                     std::vector<std::uint32_t>(pWords.begin(), pWords.end()));
+                                             }, pSize);
+
+                     return chunks;
+                 },
+                 "Extract the current FIFO content as list of (arrival time, sequence number, data words) chunks.", py::arg("size") = -1,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("getFifoHighWaterMark", &SiTCP::getFifoHighWaterMark, "Get the maximum FIFO size reached so far in number of bytes.")
+            .def("getFifoMaxSize", &SiTCP::getFifoMaxSize, "Get the FIFO size limit in number of bytes.")
+            .def("getFifoFillLevel", &SiTCP::getFifoFillLevel, "Get the FIFO size as fraction of the FIFO size limit.")
+            .def("isFifoSpilled", &SiTCP::isFifoSpilled, "Check if the FIFO buffer was moved to the spill file.")
+            .def("subscribeFifo", &SiTCP::subscribeFifo, "Create an independent reader of the FIFO data stream.")
+            .def("getStatistics", &SiTCP::getStatistics, "Get the current link statistics counters.")
+            .def_readonly_static("rbcpLatencyHistogramBins", &SiTCP::rbcpLatencyHistogramBins, "Number of bins of the RBCP latency histogram.")
             .def_readonly_static("baseAddrDataLimit", &SiTCP::baseAddrDataLimit,
                                  "Address limit below which read() / write() do normal bus access.")
             .def_readonly_static("baseAddrFIFOLimit", &SiTCP::baseAddrFIFOLimit,
                                  "Address limit for special FIFO access of read() / write().");
+
+    py::class_<SiTCPFifoSubscription, std::shared_ptr<SiTCPFifoSubscription>>(pM, "SiTCPFifoSubscription",
+                                                                             "Independent reader of the FIFO data stream of a SiTCP interface.")
+            .def("resetFifo", &SiTCPFifoSubscription::resetFifo, "Discard the buffered data of this subscription.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("getFifoSize", &SiTCPFifoSubscription::getFifoSize, "Get the buffered data size in number of bytes.")
+            .def("getFifoData", &SiTCPFifoSubscription::getFifoData, "Extract the buffered data as sequence of bytes.", py::arg("size") = -1,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("getBytesDropped", &SiTCPFifoSubscription::getBytesDropped, "Get the number of bytes dropped due to the size limit.");
 }
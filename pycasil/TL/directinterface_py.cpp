@@ -22,17 +22,51 @@
 */
 
 #include <pycasil/pycasil.h>
+#include <pycasil/pycasil_asyncio.h>
 
 #include <casil/TL/directinterface.h>
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 using casil::TL::DirectInterface;
 
 void bindTL_DirectInterface(py::module& pM)
 {
     py::class_<DirectInterface, casil::TL::Interface>(pM, "DirectInterface", "Base class to derive from for interface components "
                                                                              "that directly connect to an independent hardware device.")
-            .def("read", &DirectInterface::read, "Read from the interface.", py::arg("size") = -1)
-            .def("write", &DirectInterface::write, "Write to the interface.", py::arg("data"))
+            .def("read", &DirectInterface::read, "Read from the interface.", py::arg("size") = -1, py::call_guard<py::gil_scoped_release>())
+            .def("readPooled", &DirectInterface::readPooled, "Read from the interface into a pooled buffer.", py::arg("size") = -1,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("write", &DirectInterface::write, "Write to the interface.", py::arg("data"), py::call_guard<py::gil_scoped_release>())
             .def("query", &DirectInterface::query, "Write a query to the interface and read the response.",
-                 py::arg("data"), py::arg("size") = -1);
+                 py::arg("data"), py::arg("size") = -1, py::call_guard<py::gil_scoped_release>())
+            .def("queryMany",
+                 [](DirectInterface& pThis, const std::vector<std::vector<std::uint8_t>>& pQueries, const int pSize)
+                    -> std::vector<std::vector<std::uint8_t>>
+                 { return pThis.queryMany(pQueries, pSize); },
+                 "Write multiple queries at once and read all responses.", py::arg("queries"), py::arg("size") = -1,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("readBlock", &DirectInterface::readBlock, "Read an IEEE 488.2 definite-length binary block.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("queryBlock", &DirectInterface::queryBlock, "Write a query to the interface and read a binary block response.", py::arg("data"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("readAsync", [](DirectInterface& pThis, const int pSize) -> py::object
+                              { return PyCasilUtils::awaitAsync(pThis, [&pThis, pSize]() { return pThis.read(pSize); }); },
+                 "Read from the interface (awaitable version for asyncio).", py::arg("size") = -1)
+            .def("writeAsync", [](DirectInterface& pThis, std::vector<std::uint8_t> pData) -> py::object
+                               {
+                                   return PyCasilUtils::awaitAsync(pThis, [&pThis, data = std::move(pData)]() { pThis.write(data); });
+                               },
+                 "Write to the interface (awaitable version for asyncio).", py::arg("data"))
+            .def("queryAsync", [](DirectInterface& pThis, std::vector<std::uint8_t> pData, const int pSize) -> py::object
+                               {
+                                   return PyCasilUtils::awaitAsync(pThis, [&pThis, data = std::move(pData), pSize]()
+                                                                          { return pThis.query(data, pSize); });
+                               },
+                 "Write a query to the interface and read the response (awaitable version for asyncio).",
+                 py::arg("data"), py::arg("size") = -1)
+            .def("supportsRecordStreaming", &DirectInterface::supportsRecordStreaming,
+                 "Check if the interface supports continuous record streaming.");
 }
@@ -30,6 +30,8 @@ using casil::TL::Interface;
 void bindTL_Interface(py::module& pM)
 {
     py::class_<Interface, casil::LayerBase>(pM, "Interface", "Common base class for all interface components in the transfer layer (TL).")
-            .def("readBufferEmpty", &Interface::readBufferEmpty, "Check if the read buffer is empty.")
-            .def("clearReadBuffer", &Interface::clearReadBuffer, "Clear the current contents of the read buffer.");
+            .def("readBufferEmpty", &Interface::readBufferEmpty, "Check if the read buffer is empty.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("clearReadBuffer", &Interface::clearReadBuffer, "Clear the current contents of the read buffer.",
+                 py::call_guard<py::gil_scoped_release>());
 }
@@ -22,17 +22,104 @@
 */
 
 #include <pycasil/pycasil.h>
+#include <pycasil/pycasil_asyncio.h>
 
 #include <casil/TL/muxedinterface.h>
 
+#include <pybind11/chrono.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
 using casil::TL::MuxedInterface;
 
+namespace
+{
+
+/*
+ * Wraps a Python callable as event notification handler. The handler and the callable's
+ * destruction acquire the GIL, since both happen on threads that do not hold it.
+ */
+MuxedInterface::EventHandlerType makePythonEventHandler(py::function pCallable)
+{
+    std::shared_ptr<py::function> callable(new py::function(std::move(pCallable)), [](py::function* const pFunction) -> void
+                                           {
+                                               const py::gil_scoped_acquire gilLock;
+                                               (void)gilLock;
+
+                                               delete pFunction;
+                                           });
+
+    return [callable](const std::uint64_t pSourceAddr, const std::span<const std::uint8_t> pPayload) -> void
+           {
+               const py::gil_scoped_acquire gilLock;
+               (void)gilLock;
+
+               (*callable)(pSourceAddr, std::vector<std::uint8_t>(pPayload.begin(), pPayload.end()));
+           };
+}
+
+} // namespace
+
 void bindTL_MuxedInterface(py::module& pM)
 {
-    py::class_<MuxedInterface, casil::TL::Interface>(pM, "MuxedInterface", "Base class to derive from for interface components that connect "
-                                                                           "to an FPGA endpoint running the basil bus and firmware modules.")
-            .def("read", &MuxedInterface::read, "Read from the interface.", py::arg("addr"), py::arg("size") = -1)
-            .def("write", &MuxedInterface::write, "Write to the interface.", py::arg("addr"), py::arg("data"))
+    py::class_<MuxedInterface, casil::TL::Interface> muxedInterface(pM, "MuxedInterface", "Base class to derive from for interface components "
+                                                                                          "that connect to an FPGA endpoint running the basil "
+                                                                                          "bus and firmware modules.");
+
+    py::class_<MuxedInterface::ReadOp>(muxedInterface, "ReadOp", "Single bus read operation as part of a batch of read operations.")
+            .def(py::init<std::uint64_t, int>(), "Constructor.", py::arg("addr"), py::arg("size"))
+            .def_readwrite("addr", &MuxedInterface::ReadOp::addr, "Bus address.")
+            .def_readwrite("size", &MuxedInterface::ReadOp::size, "Number of bytes to read.");
+
+    py::class_<MuxedInterface::WriteOp>(muxedInterface, "WriteOp", "Single bus write operation as part of a batch of write operations.")
+            .def(py::init<std::uint64_t, std::vector<std::uint8_t>>(), "Constructor.", py::arg("addr"), py::arg("data"))
+            .def_readwrite("addr", &MuxedInterface::WriteOp::addr, "Bus address.")
+            .def_readwrite("data", &MuxedInterface::WriteOp::data, "Bytes to be written.");
+
+    muxedInterface
+            .def("read", &MuxedInterface::read, "Read from the interface.", py::arg("addr"), py::arg("size") = -1,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("readPooled", &MuxedInterface::readPooled, "Read from the interface into a pooled buffer.",
+                 py::arg("addr"), py::arg("size") = -1, py::call_guard<py::gil_scoped_release>())
+            .def("readBatch", [](MuxedInterface& pSelf, const std::vector<MuxedInterface::ReadOp>& pOps) { return pSelf.readBatch(pOps); },
+                 "Read multiple byte sequences from the interface.", py::arg("ops"), py::call_guard<py::gil_scoped_release>())
+            .def("write", &MuxedInterface::write, "Write to the interface.", py::arg("addr"), py::arg("data"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("writeBatch", [](MuxedInterface& pSelf, const std::vector<MuxedInterface::WriteOp>& pOps) { pSelf.writeBatch(pOps); },
+                 "Write multiple byte sequences to the interface.", py::arg("ops"), py::call_guard<py::gil_scoped_release>())
             .def("query", &MuxedInterface::query, "Write a query to the interface and read the response.",
-                 py::arg("writeAddr"), py::arg("readAddr"), py::arg("data"), py::arg("size") = -1);
+                 py::arg("writeAddr"), py::arg("readAddr"), py::arg("data"), py::arg("size") = -1,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("readAsync", [](MuxedInterface& pThis, const std::uint64_t pAddr, const int pSize) -> py::object
+                              { return PyCasilUtils::awaitAsync(pThis, [&pThis, pAddr, pSize]() { return pThis.read(pAddr, pSize); }); },
+                 "Read from the interface (awaitable version for asyncio).", py::arg("addr"), py::arg("size") = -1)
+            .def("writeAsync", [](MuxedInterface& pThis, const std::uint64_t pAddr, std::vector<std::uint8_t> pData) -> py::object
+                               {
+                                   return PyCasilUtils::awaitAsync(pThis, [&pThis, pAddr, data = std::move(pData)]()
+                                                                          { pThis.write(pAddr, data); });
+                               },
+                 "Write to the interface (awaitable version for asyncio).", py::arg("addr"), py::arg("data"))
+            .def("queryAsync", [](MuxedInterface& pThis, const std::uint64_t pWriteAddr, const std::uint64_t pReadAddr,
+                                  std::vector<std::uint8_t> pData, const int pSize) -> py::object
+                               {
+                                   return PyCasilUtils::awaitAsync(pThis, [&pThis, pWriteAddr, pReadAddr, data = std::move(pData), pSize]()
+                                                                          { return pThis.query(pWriteAddr, pReadAddr, data, pSize); });
+                               },
+                 "Write a query to the interface and read the response (awaitable version for asyncio).",
+                 py::arg("writeAddr"), py::arg("readAddr"), py::arg("data"), py::arg("size") = -1)
+            .def("supportsEvents", &MuxedInterface::supportsEvents, "Check if the interface receives event notifications.")
+            .def("subscribeEvents", [](MuxedInterface& pSelf, const std::uint64_t pSourceAddr, py::function pHandler) -> std::uint64_t
+                                    { return pSelf.subscribeEvents(pSourceAddr, makePythonEventHandler(std::move(pHandler))); },
+                 "Subscribe to event notifications of a module.", py::arg("sourceAddr"), py::arg("handler"))
+            .def("unsubscribeEvents", &MuxedInterface::unsubscribeEvents, "Cancel a subscription to event notifications.",
+                 py::arg("subscriptionId"), py::call_guard<py::gil_scoped_release>())
+            .def("getEventCount", &MuxedInterface::getEventCount, "Get the number of event notifications of a module.",
+                 py::arg("sourceAddr"))
+            .def("waitForEvent", &MuxedInterface::waitForEvent, "Wait for a new event notification of a module.",
+                 py::arg("sourceAddr"), py::arg("seenCount"), py::arg("timeout"), py::call_guard<py::gil_scoped_release>());
 }
@@ -28,12 +28,35 @@ extern void bindTL_Interface(py::module&);
 extern void bindTL_DirectInterface(py::module&);
 extern void bindTL_MuxedInterface(py::module&);
 
+#ifndef PYCASIL_EXCLUDE_TL_DIRECT_DUMMYINTERFACE
 extern void bindTL_DummyInterface(py::module&);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_DIRECT_SERIAL
 extern void bindTL_Serial(py::module&);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_DIRECT_TCP
 extern void bindTL_TCP(py::module&);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_DIRECT_UDP
 extern void bindTL_UDP(py::module&);
+#endif
+extern void bindTL_UDPRing(py::module&);
 
+#ifndef PYCASIL_EXCLUDE_TL_MUXED_DUMMYMUXEDINTERFACE
 extern void bindTL_DummyMuxedInterface(py::module&);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_MUXED_MMIO
+extern void bindTL_MMIO(py::module&);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_MUXED_REMOTE
+extern void bindTL_Remote(py::module&);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_MUXED_REPLAYMUXEDINTERFACE
+extern void bindTL_ReplayMuxedInterface(py::module&);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_MUXED_SIMMUXED
+extern void bindTL_SimMuxed(py::module&);
+#endif
 extern void bindTL_SiTCP(py::module&);
 
 void bindTL(py::module& pM)
@@ -43,11 +66,34 @@ void bindTL(py::module& pM)
     bindTL_DirectInterface(pM);
     bindTL_MuxedInterface(pM);
 
+#ifndef PYCASIL_EXCLUDE_TL_DIRECT_DUMMYINTERFACE
     bindTL_DummyInterface(pM);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_DIRECT_SERIAL
     bindTL_Serial(pM);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_DIRECT_TCP
     bindTL_TCP(pM);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_DIRECT_UDP
     bindTL_UDP(pM);
+#endif
+    bindTL_UDPRing(pM);
 
+#ifndef PYCASIL_EXCLUDE_TL_MUXED_DUMMYMUXEDINTERFACE
     bindTL_DummyMuxedInterface(pM);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_MUXED_MMIO
+    bindTL_MMIO(pM);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_MUXED_REMOTE
+    bindTL_Remote(pM);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_MUXED_REPLAYMUXEDINTERFACE
+    bindTL_ReplayMuxedInterface(pM);
+#endif
+#ifndef PYCASIL_EXCLUDE_TL_MUXED_SIMMUXED
+    bindTL_SimMuxed(pM);
+#endif
     bindTL_SiTCP(pM);
 }
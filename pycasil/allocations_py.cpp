@@ -0,0 +1,41 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/allocations.h>
+
+using casil::Allocations;
+
+void bind_Allocations(py::module& pM)
+{
+    py::class_<Allocations> allocations(pM, "Allocations", "Count heap allocations for finding and budgeting allocations in hot paths.");
+
+    py::class_<Allocations::Counts>(allocations, "Counts", "Number of allocations and allocated bytes.")
+            .def_readonly("allocations", &Allocations::Counts::allocations, "Number of allocations.")
+            .def_readonly("bytes", &Allocations::Counts::bytes, "Number of requested bytes of all allocations.");
+
+    allocations.def_static("isAvailable", &Allocations::isAvailable, "Check if allocation counting was compiled in.")
+            .def_static("getThreadCounts", &Allocations::getThreadCounts, "Get the allocation counts of the current thread.")
+            .def_static("getProcessCounts", &Allocations::getProcessCounts, "Get the allocation counts of all threads.");
+}
@@ -23,15 +23,64 @@
 
 #include <pycasil/pycasil.h>
 
+#include <pybind11/chrono.h>
+
 #include <casil/asio.h>
+#include <casil/auxil.h>
+
+#include <boost/asio/io_context.hpp>
 
 using casil::ASIO;
 
 void bind_ASIO(py::module& pM)
 {
-    py::class_<ASIO>(pM, "ASIO", "Limited interface to the used async IO back end from the Boost library.")
-            .def_static("startRunIOContext", &ASIO::startRunIOContext, "Start threads that continuously execute/run the IO context.",
-                        py::arg("numThreads") = 1)
+    py::class_<ASIO> asio(pM, "ASIO", "Limited interface to the used async IO back end from the Boost library.");
+
+    py::class_<ASIO::AdaptiveSettings>(asio, "AdaptiveSettings", "Settings for adaptively scaling the number of IO context threads.")
+            .def(py::init<>(), "Constructor.")
+            .def_readwrite("minThreads", &ASIO::AdaptiveSettings::minThreads, "Minimum number of threads per IO context.")
+            .def_readwrite("maxThreads", &ASIO::AdaptiveSettings::maxThreads, "Maximum number of threads per IO context.")
+            .def_readwrite("probeInterval", &ASIO::AdaptiveSettings::probeInterval, "Interval between two queueing delay probes.")
+            .def_readwrite("scaleUpDelay", &ASIO::AdaptiveSettings::scaleUpDelay, "Probe delay above which a thread is added.")
+            .def_readwrite("scaleDownDelay", &ASIO::AdaptiveSettings::scaleDownDelay, "Probe delay below which a thread can be removed.")
+            .def_readwrite("scaleDownProbes", &ASIO::AdaptiveSettings::scaleDownProbes,
+                           "Number of successive fast probes needed to remove a thread.");
+
+    asio
+            .def_static("setIOContextPoolSize", &ASIO::setIOContextPoolSize, "Set the number of IO context objects in the IO context pool.",
+                        py::arg("size"))
+            .def_static("getIOContextPoolSize", &ASIO::getIOContextPoolSize, "Get the number of IO context objects in the IO context pool.")
+            .def_static("startRunIOContext", py::overload_cast<unsigned int, const std::vector<int>&>(&ASIO::startRunIOContext),
+                        "Start threads that continuously execute/run the IO context(s).",
+                        py::arg("numThreads") = 1, py::arg("cpuAffinity") = std::vector<int>{})
+            .def_static("startRunIOContext",
+                        py::overload_cast<unsigned int, const std::vector<int>&, const casil::Auxil::ThreadScheduling&>(
+                            &ASIO::startRunIOContext),
+                        "Start threads that continuously execute/run the IO context(s) with specific scheduling settings.",
+                        py::arg("numThreads"), py::arg("cpuAffinity"), py::arg("scheduling"))
+            .def_static("startRunIOContextAdaptive",
+                        py::overload_cast<const ASIO::AdaptiveSettings&, const std::vector<int>&>(&ASIO::startRunIOContextAdaptive),
+                        "Start an adaptive number of threads that run the IO context(s).",
+                        py::arg("settings"), py::arg("cpuAffinity") = std::vector<int>{})
+            .def_static("startRunIOContextAdaptive",
+                        py::overload_cast<const ASIO::AdaptiveSettings&, const std::vector<int>&, const casil::Auxil::ThreadScheduling&>(
+                            &ASIO::startRunIOContextAdaptive),
+                        "Start an adaptive number of threads that run the IO context(s) with specific scheduling settings.",
+                        py::arg("settings"), py::arg("cpuAffinity"), py::arg("scheduling"))
             .def_static("stopRunIOContext", &ASIO::stopRunIOContext, "Stop all running IO context threads.")
-            .def_static("ioContextThreadsRunning", &ASIO::ioContextThreadsRunning, "Check if any IO context threads are currently running.");
+            .def_static("ioContextThreadsRunning", &ASIO::ioContextThreadsRunning, "Check if any IO context threads are currently running.")
+            .def_static("ioContextThreadsAdaptive", &ASIO::ioContextThreadsAdaptive,
+                        "Check if the running IO context threads are scaled adaptively.")
+            .def_static("getNumIOContextThreads", &ASIO::getNumIOContextThreads, "Get the number of running threads of one or all IO contexts.",
+                        py::arg("index") = -1)
+            .def_static("requestDedicatedThreads", [](const int pIndex, const unsigned int pNumThreads) -> bool
+                                                   {
+                                                       return ASIO::requestDedicatedThreads(ASIO::getIOContext(pIndex), pNumThreads);
+                                                   },
+                        "Request a minimum number of threads for the IO context with a pool index.", py::arg("index"), py::arg("numThreads"))
+            .def_static("releaseDedicatedThreads", [](const int pIndex, const unsigned int pNumThreads) -> void
+                                                   {
+                                                       ASIO::releaseDedicatedThreads(ASIO::getIOContext(pIndex), pNumThreads);
+                                                   },
+                        "Release threads requested via requestDedicatedThreads().", py::arg("index"), py::arg("numThreads"));
 }
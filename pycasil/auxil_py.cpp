@@ -33,29 +33,47 @@ namespace Auxil = casil::Auxil;
 class PyAsyncIORunner
 {
 public:
-    explicit PyAsyncIORunner(unsigned int pNumThreads = 1);
+    explicit PyAsyncIORunner(unsigned int pNumThreads = 1, const Auxil::ThreadScheduling& pScheduling = {});
     ~PyAsyncIORunner();
     void enter();
     void exit(const std::optional<py::type>&, const std::optional<py::object>&, const std::optional<py::object>&);
 
 private:
     const unsigned int numThreads;
+    const Auxil::ThreadScheduling scheduling;
 };
 
 void bindAuxil(py::module& pM)
 {
     pM.def("uintSeqFromYAML", &Auxil::uintSeqFromYAML, "Parse a sequence of unsigned integers from YAML format.", py::arg("yamlString"));
 
+    py::class_<Auxil::ThreadScheduling> threadScheduling(pM, "ThreadScheduling", "Scheduling settings for a worker thread.");
+
+    py::enum_<Auxil::ThreadScheduling::Policy>(threadScheduling, "Policy", "Scheduling policy of the thread.")
+            .value("Default", Auxil::ThreadScheduling::Policy::Default, "Default (time-sharing) scheduling of the operating system.")
+            .value("FIFO", Auxil::ThreadScheduling::Policy::FIFO, "Real-time first-in-first-out scheduling (SCHED_FIFO).")
+            .value("RoundRobin", Auxil::ThreadScheduling::Policy::RoundRobin, "Real-time round-robin scheduling (SCHED_RR).");
+
+    threadScheduling
+            .def(py::init<>(), "Constructor.")
+            .def_readwrite("policy", &Auxil::ThreadScheduling::policy, "Scheduling policy.")
+            .def_readwrite("priority", &Auxil::ThreadScheduling::priority, "Real-time priority (only used for real-time policies).")
+            .def_readwrite("cpu", &Auxil::ThreadScheduling::cpu, "CPU core to pin the thread to (negative for no pinning).")
+            .def_static("fromString", &Auxil::ThreadScheduling::fromString, "Parse scheduling settings from a configuration string.",
+                        py::arg("spec"));
+
     py::class_<PyAsyncIORunner>(pM, "AsyncIORunner", "Context manager to run IO context threads for ASIO functionality.")
-            .def(py::init<unsigned int>(), "Constructor.", py::arg("numThreads") = 1)
+            .def(py::init<unsigned int, const Auxil::ThreadScheduling&>(), "Constructor.", py::arg("numThreads") = 1,
+                 py::arg("scheduling") = Auxil::ThreadScheduling{})
             .def("__enter__", &PyAsyncIORunner::enter, "Start the numThreads IO context threads.", py::is_operator())
             .def("__exit__", &PyAsyncIORunner::exit, "Stop the IO context threads.", py::is_operator());
 }
 
 //Function definitions for AsyncIORunner wrapper class
 
-PyAsyncIORunner::PyAsyncIORunner(const unsigned int pNumThreads) :
-    numThreads(pNumThreads)
+PyAsyncIORunner::PyAsyncIORunner(const unsigned int pNumThreads, const Auxil::ThreadScheduling& pScheduling) :
+    numThreads(pNumThreads),
+    scheduling(pScheduling)
 {
     if (numThreads == 0)
         throw std::runtime_error("Number of threads must be non-zero.");
@@ -69,7 +87,7 @@ PyAsyncIORunner::~PyAsyncIORunner()
 
 void PyAsyncIORunner::enter()
 {
-    if (!casil::ASIO::startRunIOContext(numThreads))
+    if (!casil::ASIO::startRunIOContext(numThreads, {}, scheduling))
         throw std::runtime_error("Failed to start IO context threads.");
 }
 
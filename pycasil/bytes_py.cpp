@@ -23,12 +23,16 @@
 
 #include <pycasil/pycasil.h>
 
+#include <pybind11/numpy.h>
+
 #include <casil/bytes.h>
 
 #include <boost/dynamic_bitset.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 namespace Bytes = casil::Bytes;
@@ -54,6 +58,69 @@ void bindBytes(py::module& pM)
     pM.def("bytesFromBitset", [](const std::vector<bool>& pBits, const std::size_t pByteSize) -> std::vector<std::uint8_t>
                               { return Bytes::bytesFromBitset(PyCasilUtils::bitsetFromBoolVec(pBits), pByteSize); },
                               "Convert a dynamic bitset to a sequence of bytes.", py::arg("bits"), py::arg("byteSize"));
+    pM.def("bitArrayFromBytes", [](const std::vector<std::uint8_t>& pBytes, const std::size_t pBitSize) -> py::array_t<bool>
+                                {
+                                    const boost::dynamic_bitset<> bits = Bytes::bitsetFromBytes(pBytes, pBitSize);
+                                    py::array_t<bool> array(static_cast<py::ssize_t>(bits.size()));
+                                    PyCasilUtils::boolRangeFromBitset(bits, std::span<bool>(array.mutable_data(), bits.size()));
+                                    return array;
+                                },
+                                "Convert a sequence of bytes to a numpy bool array.", py::arg("bytes"), py::arg("bitSize"));
+    pM.def("bytesFromBitArray", [](const py::array_t<bool, py::array::c_style | py::array::forcecast>& pBits,
+                                   const std::size_t pByteSize) -> std::vector<std::uint8_t>
+                                {
+                                    if (pBits.ndim() != 1)
+                                        throw std::invalid_argument("Bits array must be one-dimensional.");
+                                    return Bytes::bytesFromBitset(PyCasilUtils::bitsetFromBoolRange(
+                                                                      std::span<const bool>(pBits.data(), static_cast<std::size_t>(pBits.size()))),
+                                                                  pByteSize);
+                                },
+                                "Convert a numpy bool array to a sequence of bytes.", py::arg("bits"), py::arg("byteSize"));
+
+    //Accept any contiguous byte buffer (bytes, bytearray, memoryview, ...) for bulk word decoding
+    auto decodeBuffer = [](const py::buffer& pBuffer, void (*const pDecode)(std::span<const std::uint8_t>, std::span<std::uint32_t>))
+                        -> std::vector<std::uint32_t>
+    {
+        const py::buffer_info info = pBuffer.request();
+
+        if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1)
+            throw std::invalid_argument("Buffer must be a contiguous sequence of bytes.");
+
+        const std::span<const std::uint8_t> bytes(static_cast<const std::uint8_t*>(info.ptr), static_cast<std::size_t>(info.size));
+
+        std::vector<std::uint32_t> words(bytes.size() / 4);
+        pDecode(bytes, words);
+
+        return words;
+    };
+
+    auto encodeWords = [](const std::vector<std::uint32_t>& pWords,
+                          void (*const pEncode)(std::span<const std::uint32_t>, std::span<std::uint8_t>)) -> py::bytes
+    {
+        std::vector<std::uint8_t> bytes(pWords.size() * 4);
+        pEncode(pWords, bytes);
+
+        return py::bytes(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    };
+
+    pM.def("decodeUInt32LE", [decodeBuffer](const py::buffer& pBytes) -> std::vector<std::uint32_t>
+                             { return decodeBuffer(pBytes, &Bytes::decodeUInt32LE); },
+           "Convert a little endian byte sequence to a sequence of 32 bit unsigned integers.", py::arg("bytes"));
+    pM.def("decodeUInt32BE", [decodeBuffer](const py::buffer& pBytes) -> std::vector<std::uint32_t>
+                             { return decodeBuffer(pBytes, &Bytes::decodeUInt32BE); },
+           "Convert a big endian byte sequence to a sequence of 32 bit unsigned integers.", py::arg("bytes"));
+    pM.def("encodeUInt32LE", [encodeWords](const std::vector<std::uint32_t>& pWords) -> py::bytes
+                             { return encodeWords(pWords, &Bytes::encodeUInt32LE); },
+           "Convert a sequence of 32 bit unsigned integers to a little endian byte sequence.", py::arg("words"));
+    pM.def("encodeUInt32BE", [encodeWords](const std::vector<std::uint32_t>& pWords) -> py::bytes
+                             { return encodeWords(pWords, &Bytes::encodeUInt32BE); },
+           "Convert a sequence of 32 bit unsigned integers to a big endian byte sequence.", py::arg("words"));
+
+    pM.def("findMismatch", [](const std::vector<std::uint8_t>& pLhs, const std::vector<std::uint8_t>& pRhs) -> std::size_t
+                           { return Bytes::findMismatch(pLhs, pRhs); },
+           "Find the first differing byte of two equally long byte sequences.", py::arg("lhs"), py::arg("rhs"));
+    pM.def("simdKernelTarget", &Bytes::simdKernelTarget,
+           "Get the instruction set selected at runtime for the bulk byte conversion/comparison kernels.");
 
     pM.def("byteVecFromStr", &Bytes::byteVecFromStr, "Interpret a character string as a sequence of bytes.", py::arg("str"));
     pM.def("strFromByteVec", &Bytes::strFromByteVec, "Interpret a sequence of bytes as a character string.", py::arg("vec"));
@@ -29,28 +29,45 @@
 
 using casil::ContextualLogger;
 
+namespace
+{
+
+//Select the non-template overloads of the log functions (the others are format string templates)
+using LogFunctionType = void (ContextualLogger::*)(std::string_view) const;
+using LevelLogFunctionType = void (ContextualLogger::*)(std::string_view, casil::Logger::LogLevel) const;
+
+} // namespace
+
 void bind_ContextualLogger(py::module& pM)
 {
     py::class_<ContextualLogger>(pM, "ContextualLogger", "Print log messages with contextual information.")
             .def(py::init<const casil::LayerBase&>(), "Constructor for logging from layer components.", py::arg("component"))
-            .def("log", &ContextualLogger::log, "Print a log message with contextual information.",
+            .def("log", static_cast<LevelLogFunctionType>(&ContextualLogger::log), "Print a log message with contextual information.",
                  py::arg("message"), py::arg("level") = casil::Logger::LogLevel::Info)
-            .def("logCritical", &ContextualLogger::logCritical, "Print a log message with contextual information (LogLevel.Critical).",
-                 py::arg("message"))
-            .def("logError", &ContextualLogger::logError, "Print a log message with contextual information (LogLevel.Error).",
-                 py::arg("message"))
-            .def("logWarning", &ContextualLogger::logWarning, "Print a log message with contextual information (LogLevel.Warning).",
-                 py::arg("message"))
-            .def("logSuccess", &ContextualLogger::logSuccess, "Print a log message with contextual information (LogLevel.Success).",
-                 py::arg("message"))
-            .def("logInfo", &ContextualLogger::logInfo, "Print a log message with contextual information (LogLevel.Info).",
-                 py::arg("message"))
-            .def("logMore", &ContextualLogger::logMore, "Print a log message with contextual information (LogLevel.More).",
-                 py::arg("message"))
-            .def("logVerbose", &ContextualLogger::logVerbose, "Print a log message with contextual information (LogLevel.Verbose).",
-                 py::arg("message"))
-            .def("logDebug", &ContextualLogger::logDebug, "Print a log message with contextual information (LogLevel.Debug).",
-                 py::arg("message"))
-            .def("logDebugDebug", &ContextualLogger::logDebugDebug, "Print a log message with contextual information (LogLevel.DebugDebug).",
-                 py::arg("message"));
+            .def("logCritical", static_cast<LogFunctionType>(&ContextualLogger::logCritical),
+                 "Print a log message with contextual information (LogLevel.Critical).", py::arg("message"))
+            .def("logError", static_cast<LogFunctionType>(&ContextualLogger::logError),
+                 "Print a log message with contextual information (LogLevel.Error).", py::arg("message"))
+            .def("logWarning", static_cast<LogFunctionType>(&ContextualLogger::logWarning),
+                 "Print a log message with contextual information (LogLevel.Warning).", py::arg("message"))
+            .def("logSuccess", static_cast<LogFunctionType>(&ContextualLogger::logSuccess),
+                 "Print a log message with contextual information (LogLevel.Success).", py::arg("message"))
+            .def("logInfo", static_cast<LogFunctionType>(&ContextualLogger::logInfo),
+                 "Print a log message with contextual information (LogLevel.Info).", py::arg("message"))
+            .def("logMore", static_cast<LogFunctionType>(&ContextualLogger::logMore),
+                 "Print a log message with contextual information (LogLevel.More).", py::arg("message"))
+            .def("logVerbose", static_cast<LogFunctionType>(&ContextualLogger::logVerbose),
+                 "Print a log message with contextual information (LogLevel.Verbose).", py::arg("message"))
+            .def("logDebug", static_cast<LogFunctionType>(&ContextualLogger::logDebug),
+                 "Print a log message with contextual information (LogLevel.Debug).", py::arg("message"))
+            .def("logDebugDebug", static_cast<LogFunctionType>(&ContextualLogger::logDebugDebug),
+                 "Print a log message with contextual information (LogLevel.DebugDebug).", py::arg("message"))
+            .def("includeLogLevel", &ContextualLogger::includeLogLevel,
+                 "Check whether a message with a certain log level should be logged by this logger.", py::arg("level"))
+            .def("setLevelOverride", &ContextualLogger::setLevelOverride, "Override the log level for this logger.", py::arg("level"))
+            .def("getLevelOverride", &ContextualLogger::getLevelOverride, "Get the log level override of this logger.")
+            .def_static("setTypeLevelOverride", &ContextualLogger::setTypeLevelOverride, "Override the log level for a component type.",
+                        py::arg("type"), py::arg("level"))
+            .def_static("getTypeLevelOverride", &ContextualLogger::getTypeLevelOverride, "Get the log level override for a component type.",
+                        py::arg("type"));
 }
@@ -24,14 +24,46 @@
 #include <pycasil/pycasil.h>
 
 #include <casil/device.h>
+#include <casil/HL/registerdriver.h>
+#include <casil/RL/standardregister.h>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
 
 using casil::Device;
 
+extern void ensureLayersBound();
+
 void bind_Device(py::module& pM)
 {
     py::class_<Device>(pM, "Device",
                        "Configurable container class for interdependent layer components to interact with an arbitrary DAQ setup.")
-            .def(py::init<const std::string&>(), "Constructor.", py::arg("config"))
+            .def(py::init([](const std::string& pConfig, const bool pLazy)
+                          {
+                              //Components must be returned with their most derived type (layer submodules may be bound lazily)
+                              ensureLayersBound();
+
+                              return std::make_unique<Device>(pConfig, pLazy);
+                          }),
+                 "Constructor.", py::arg("config"), py::arg("lazy") = false)
+            .def(py::init([](const py::dict& pConfig, const bool pLazy)
+                          {
+                              ensureLayersBound();
+
+                              return std::make_unique<Device>(PyCasilUtils::propertyTreeFromPyObject(pConfig), pLazy);
+                          }),
+                 "Constructor (from configuration dict instead of YAML document).", py::arg("config"), py::arg("lazy") = false)
             .def("__getitem__", &Device::operator[], "Access one of the components from any layer.",
                  py::arg("name"), py::return_value_policy::reference, py::is_operator())
             .def("interface", &Device::interface, "Access one of the interface components from the transfer layer.",
@@ -40,10 +72,104 @@ void bind_Device(py::module& pM)
                  py::arg("name"), py::return_value_policy::reference)
             .def("reg", &Device::reg, "Access one of the register components from the register layer.",
                  py::arg("name"), py::return_value_policy::reference)
-            .def("init", &Device::init, "Initialize by initializing all components of all layers.", py::arg("force") = false)
-            .def("close", &Device::close, "Close by closing all components of all layers.", py::arg("force") = false)
+            .def("isConstructed", &Device::isConstructed, "Check if a component has already been constructed.", py::arg("name"))
+            .def("init", &Device::init, "Initialize by initializing all components of all layers.", py::arg("force") = false,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("initParallel", &Device::initParallel,
+                 "Initialize like init() but initialize independent interfaces (with their drivers and registers) concurrently.",
+                 py::arg("force") = false, py::call_guard<py::gil_scoped_release>())
+            .def("close", &Device::close, "Close by closing all components of all layers.", py::arg("force") = false,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("closeParallel", &Device::closeParallel,
+                 "Close like close() but close independent interfaces (with their drivers and registers) concurrently.",
+                 py::arg("force") = false, py::call_guard<py::gil_scoped_release>())
             .def("loadRuntimeConfiguration", &Device::loadRuntimeConfiguration,
                  "Load additional runtime configuration data/values for the components.", py::arg("conf"))
+            .def("loadRuntimeConfiguration", [](const Device& pSelf, const py::dict& pConf) -> bool
+                 {
+                     std::map<std::string, boost::property_tree::ptree> confTrees;
+
+                     for (const auto& [compName, compConf] : pConf)
+                         confTrees.emplace(py::cast<std::string>(compName), PyCasilUtils::propertyTreeFromPyObject(compConf));
+
+                     return pSelf.loadRuntimeConfigurationTrees(confTrees);
+                 },
+                 "Load additional runtime configuration data/values for the components (from configuration dicts/lists "
+                 "instead of YAML documents).", py::arg("conf"))
             .def("dumpRuntimeConfiguration", &Device::dumpRuntimeConfiguration,
-                 "Save current runtime configuration data/values of the components.");
+                 "Save current runtime configuration data/values of the components.")
+            .def("loadRuntimeSnapshot", [](const Device& pSelf, const py::buffer& pSnapshot) -> bool
+                 {
+                     const py::buffer_info info = pSnapshot.request();
+
+                     if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1)
+                         throw std::invalid_argument("Buffer must be a contiguous sequence of bytes.");
+
+                     return pSelf.loadRuntimeSnapshot(std::span<const std::uint8_t>(static_cast<const std::uint8_t*>(info.ptr),
+                                                                                    static_cast<std::size_t>(info.size)));
+                 },
+                 "Load runtime configuration data/values for the components from a binary snapshot.", py::arg("snapshot"))
+            .def("dumpRuntimeSnapshot", [](const Device& pSelf) -> py::bytes
+                 {
+                     const std::vector<std::uint8_t> snapshot = pSelf.dumpRuntimeSnapshot();
+                     return py::bytes(reinterpret_cast<const char*>(snapshot.data()), snapshot.size());
+                 },
+                 "Save current runtime configuration data/values of the components as binary snapshot.")
+            .def("apply", [](const Device& pSelf, const py::dict& pOperations) -> void
+                 {
+                     using casil::HL::RegisterDriver;
+                     using casil::RL::StandardRegister;
+
+                     //Convert all operations first such that invalid input cannot lead to partially applied operations
+
+                     std::vector<std::function<void()>> operations;
+                     operations.reserve(pOperations.size());
+
+                     for (const auto& [compName, compUpdates] : pOperations)
+                     {
+                         const std::string name = py::cast<std::string>(compName);
+                         const py::dict updates = py::cast<py::dict>(compUpdates);
+
+                         casil::LayerBase& component = pSelf[name];
+
+                         if (RegisterDriver *const regDriver = dynamic_cast<RegisterDriver*>(&component))
+                         {
+                             std::vector<std::pair<std::string, std::variant<std::uint64_t, std::vector<std::uint8_t>>>> regUpdates;
+                             regUpdates.reserve(updates.size());
+
+                             for (const auto& [regName, regContent] : updates)
+                             {
+                                 regUpdates.emplace_back(py::cast<std::string>(regName),
+                                                         py::cast<std::variant<std::uint64_t, std::vector<std::uint8_t>>>(regContent));
+                             }
+
+                             operations.emplace_back([regDriver, regUpdates = std::move(regUpdates)]() { regDriver->set(regUpdates); });
+                         }
+                         else if (StandardRegister *const stdReg = dynamic_cast<StandardRegister*>(&component))
+                         {
+                             std::vector<std::pair<std::string, std::uint64_t>> fieldValues;
+                             fieldValues.reserve(updates.size());
+
+                             for (const auto& [fieldPath, value] : updates)
+                                 fieldValues.emplace_back(py::cast<std::string>(fieldPath), py::cast<std::uint64_t>(value));
+
+                             operations.emplace_back([stdReg, fieldValues = std::move(fieldValues)]() { stdReg->update(fieldValues); });
+                         }
+                         else
+                             throw py::type_error("Component \"" + name + "\" does not support batched updates.");
+                     }
+
+                     const py::gil_scoped_release gilRelease;
+                     (void)gilRelease;
+
+                     for (const std::function<void()>& operation : operations)
+                         operation();
+                 },
+                 "Apply register updates ({register name: value}) to register drivers and field updates ({field path: value}) "
+                 "to standard registers, given as dict of component names, in one call.", py::arg("operations"))
+            .def("getTimings", &Device::getTimings, "Get summaries of the timed operations of all components.")
+            .def("getMemoryReport", &Device::getMemoryReport, "Estimate the heap memory used by all components.")
+            .def("reconfigure", py::overload_cast<const std::string&>(&Device::reconfigure),
+                 "Change the configuration of some components and rebuild only those.", py::arg("config"),
+                 py::call_guard<py::gil_scoped_release>());
 }
@@ -0,0 +1,58 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/device.h>
+#include <casil/deviceserver.h>
+
+#include <string>
+
+using casil::DeviceServer;
+
+void bind_DeviceServer(py::module& pM)
+{
+    py::class_<DeviceServer> deviceServer(pM, "DeviceServer", "Shares the interfaces of one Device with other processes "
+                                                              "via a local (Unix domain) socket.");
+
+    py::enum_<DeviceServer::Opcode>(deviceServer, "Opcode", "Request type identifiers of the server protocol.")
+            .value("Read", DeviceServer::Opcode::Read, "Call TL::MuxedInterface::read().")
+            .value("Write", DeviceServer::Opcode::Write, "Call TL::MuxedInterface::write().")
+            .value("Query", DeviceServer::Opcode::Query, "Call TL::MuxedInterface::query().")
+            .value("ReadBufferEmpty", DeviceServer::Opcode::ReadBufferEmpty, "Call TL::Interface::readBufferEmpty().")
+            .value("ClearReadBuffer", DeviceServer::Opcode::ClearReadBuffer, "Call TL::Interface::clearReadBuffer().");
+
+    py::class_<DeviceServer::Statistics>(deviceServer, "Statistics", "Snapshot of the server counters.")
+            .def_readonly("clientsAccepted", &DeviceServer::Statistics::clientsAccepted, "Number of accepted client connections.")
+            .def_readonly("requestsServed", &DeviceServer::Statistics::requestsServed, "Number of successfully handled requests.")
+            .def_readonly("requestsFailed", &DeviceServer::Statistics::requestsFailed, "Number of requests that returned an error.");
+
+    deviceServer
+            .def(py::init<casil::Device&, std::string>(), "Constructor.", py::arg("device"), py::arg("socketPath"), py::keep_alive<1, 2>())
+            .def("getSocketPath", &DeviceServer::getSocketPath, "Get the path of the socket file.")
+            .def("start", &DeviceServer::start, "Start listening for clients.", py::call_guard<py::gil_scoped_release>())
+            .def("stop", &DeviceServer::stop, "Stop the server and disconnect all clients.", py::call_guard<py::gil_scoped_release>())
+            .def("isRunning", &DeviceServer::isRunning, "Check if the server is running.")
+            .def("getStatistics", &DeviceServer::getStatistics, "Get the current server counters.")
+            .def_readonly_static("maxMessageSize", &DeviceServer::maxMessageSize, "Maximum accepted message payload size.");
+}
@@ -39,4 +39,10 @@ void bindEnv(py::module& pM)
            "Get a map of all Casil environment variables.");
     pM.def("getEnv", static_cast<const std::set<std::string>& (*)(std::string_view)>(&Env::getEnv),
            "Get a specific Casil environment variable.", py::arg("varName"));
+    pM.def("findFile", [](const std::string_view pVarName, const std::string_view pFileName) -> std::string
+                       {
+                           return Env::findFile(pVarName, pFileName).string();
+                       },
+           "Find a file in the directories of a path variable.", py::arg("varName"), py::arg("fileName"));
+    pM.def("invalidateFileIndex", &Env::invalidateFileIndex, "Discard the cached directory index used by findFile().");
 }
@@ -0,0 +1,50 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/error.h>
+
+#include <string>
+#include <utility>
+
+using casil::Error;
+
+void bind_Error(py::module& pM)
+{
+    py::class_<Error> error(pM, "Error", "Compact description of a failed operation for non-throwing APIs.");
+
+    py::enum_<Error::Code>(error, "Code", "Category of the failure.")
+            .value("Timeout", Error::Code::Timeout, "The operation timed out (also after possible retries).")
+            .value("Protocol", Error::Code::Protocol, "Invalid, wrong or non-matching response from the other side.")
+            .value("InvalidArgument", Error::Code::InvalidArgument, "The operation was called with invalid arguments.")
+            .value("Failure", Error::Code::Failure, "Any other failure (e.g. failed socket access).");
+
+    error.def(py::init([](const Error::Code pCode, std::string pMessage)
+                       {
+                           return Error(pCode, [tMessage = std::move(pMessage)]() { return tMessage; });
+                       }), "Constructor.", py::arg("code"), py::arg("message"))
+            .def("getCode", &Error::getCode, "Get the error code.")
+            .def("getMessage", &Error::getMessage, "Get the (formatted) context message.")
+            .def("raise_", &Error::raise, "Throw the error as exception.");
+}
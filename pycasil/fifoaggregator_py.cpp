@@ -0,0 +1,72 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/fifoaggregator.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <pybind11/chrono.h>
+#include <pybind11/numpy.h>
+
+#include <chrono>
+#include <cstdint>
+
+using casil::FifoAggregator;
+
+void bind_FifoAggregator(py::module& pM)
+{
+    py::class_<FifoAggregator> fifoAggregator(pM, "FifoAggregator",
+                                              "Merged readout of the FIFOs of multiple SiTCP interfaces from a single thread.");
+
+    py::class_<FifoAggregator::Block>(fifoAggregator, "Block", "Block of FIFO data words from one board.")
+            .def_readonly("board", &FifoAggregator::Block::board, "Index of the board.")
+            .def_readonly("sequenceNumber", &FifoAggregator::Block::sequenceNumber, "Sequence number of the first contained FIFO chunk.")
+            .def_readonly("timestamp", &FifoAggregator::Block::timestamp, "Arrival time of the first contained FIFO chunk.")
+            .def_property_readonly("words", [](const FifoAggregator::Block& pThis) -> py::array_t<std::uint32_t>
+                                            {
+                                                return py::array_t<std::uint32_t>(static_cast<py::ssize_t>(pThis.words.size()),
+                                                                                  pThis.words.data());
+                                            },
+                                   "The FIFO data words (as numpy array).");
+
+    py::class_<FifoAggregator::Statistics>(fifoAggregator, "Statistics", "Snapshot of the aggregator counters.")
+            .def_readonly("blocksQueued", &FifoAggregator::Statistics::blocksQueued, "Number of blocks added to the queue.")
+            .def_readonly("wordsQueued", &FifoAggregator::Statistics::wordsQueued, "Number of data words added to the queue.")
+            .def_readonly("wakeUps", &FifoAggregator::Statistics::wakeUps,
+                          "Number of times the draining thread woke up to serve boards.")
+            .def_readonly("queueStalls", &FifoAggregator::Statistics::queueStalls,
+                          "Number of times the draining thread had to wait for a full queue.");
+
+    fifoAggregator
+            .def(py::init<std::size_t, std::size_t>(), "Constructor.", py::arg("queueCapacity") = 64, py::arg("maxBlockWords") = 65536)
+            .def("addBoard", &FifoAggregator::addBoard, "Add an interface whose FIFO shall be read.",
+                 py::arg("interface"), py::keep_alive<1, 2>())
+            .def("start", &FifoAggregator::start, "Start the draining thread.", py::call_guard<py::gil_scoped_release>())
+            .def("stop", &FifoAggregator::stop, "Stop the draining thread.", py::call_guard<py::gil_scoped_release>())
+            .def("isRunning", &FifoAggregator::isRunning, "Check if the draining thread is running.")
+            .def("getBlock", &FifoAggregator::getBlock, "Take the next block from the queue.",
+                 py::arg("timeout") = std::chrono::milliseconds::zero(), py::call_guard<py::gil_scoped_release>())
+            .def("getBlocks", &FifoAggregator::getBlocks, "Take all currently queued blocks.")
+            .def("getStatistics", &FifoAggregator::getStatistics, "Get the current aggregator counters.");
+}
@@ -0,0 +1,136 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <pycasil/pycasil.h>
+
+#include <casil/fifodecoder.h>
+
+#include <pybind11/numpy.h>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+using casil::FifoDecoder;
+
+namespace
+{
+
+/*
+ * Expose a vector as numpy array without copying by moving it into a capsule that lives as long as the array.
+ */
+template<typename T>
+py::array_t<T> arrayFromVector(std::vector<T>&& pVector)
+{
+    auto vector = std::make_unique<std::vector<T>>(std::move(pVector));
+    const std::vector<T>& values = *vector;
+
+    py::capsule owner(vector.get(), [](void* pOwnedVector) { delete static_cast<std::vector<T>*>(pOwnedVector); });
+    (void)vector.release();
+
+    return py::array_t<T>(static_cast<py::ssize_t>(values.size()), values.data(), owner);
+}
+
+} // namespace
+
+void bind_FifoDecoder(py::module& pM)
+{
+    py::class_<FifoDecoder> fifoDecoder(pM, "FifoDecoder", "Multi-threaded decoder that splits FIFO data words into typed records "
+                                                           "with structure-of-arrays output.");
+
+    py::class_<FifoDecoder::Field>(fifoDecoder, "Field", "Definition of a field extracted from the words of a record type.")
+            .def(py::init<>([](std::string pName, const std::uint32_t pMask, const std::uint32_t pShift) -> FifoDecoder::Field
+                            {
+                                return FifoDecoder::Field{.name = std::move(pName), .mask = pMask, .shift = pShift};
+                            }),
+                 "Constructor.", py::arg("name"), py::arg("mask"), py::arg("shift") = 0)
+            .def_readwrite("name", &FifoDecoder::Field::name, "Field name.")
+            .def_readwrite("mask", &FifoDecoder::Field::mask, "Mask applied after shifting.")
+            .def_readwrite("shift", &FifoDecoder::Field::shift, "Right shift of the word.");
+
+    py::class_<FifoDecoder::Rule>(fifoDecoder, "Rule", "Definition of a record type.")
+            .def(py::init<>([](std::string pName, const std::uint32_t pMask, const std::uint32_t pValue,
+                               std::vector<FifoDecoder::Field> pFields) -> FifoDecoder::Rule
+                            {
+                                return FifoDecoder::Rule{.name = std::move(pName), .mask = pMask, .value = pValue, .fields = std::move(pFields)};
+                            }),
+                 "Constructor.", py::arg("name"), py::arg("mask"), py::arg("value"), py::arg("fields") = std::vector<FifoDecoder::Field>{})
+            .def_readwrite("name", &FifoDecoder::Rule::name, "Record type name.")
+            .def_readwrite("mask", &FifoDecoder::Rule::mask, "Mask selecting the identifying word bits.")
+            .def_readwrite("value", &FifoDecoder::Rule::value, "Required value of the masked word bits.")
+            .def_readwrite("fields", &FifoDecoder::Rule::fields, "Extracted fields.");
+
+    py::class_<FifoDecoder::Statistics>(fifoDecoder, "Statistics", "Snapshot of the decoder counters.")
+            .def_readonly("wordsDecoded", &FifoDecoder::Statistics::wordsDecoded, "Number of decoded words.")
+            .def_readonly("blocksDecoded", &FifoDecoder::Statistics::blocksDecoded, "Number of decoded blocks.")
+            .def_readonly("blocksStolen", &FifoDecoder::Statistics::blocksStolen,
+                          "Number of blocks processed by a worker other than the initially assigned one.");
+
+    fifoDecoder
+            .def(py::init<std::vector<FifoDecoder::Rule>, std::size_t, std::size_t>(), "Constructor.",
+                 py::arg("rules"), py::arg("numThreads") = 0, py::arg("blockSize") = 65536)
+            .def(py::init<>([](const std::string& pYAMLString, const std::size_t pNumThreads, const std::size_t pBlockSize)
+                            {
+                                return std::make_unique<FifoDecoder>(FifoDecoder::parseRules(pYAMLString), pNumThreads, pBlockSize);
+                            }),
+                 "Constructor from YAML rule definitions.", py::arg("yamlString"), py::arg("numThreads") = 0, py::arg("blockSize") = 65536)
+            .def("getRules", &FifoDecoder::getRules, "Get the record type definitions.")
+            .def("getNumThreads", &FifoDecoder::getNumThreads, "Get the number of threads used for decoding.")
+            .def("getBlockSize", &FifoDecoder::getBlockSize, "Get the number of words per block.")
+            .def("decode", [](FifoDecoder& pThis, const py::array_t<std::uint32_t, py::array::c_style | py::array::forcecast>& pWords)
+                           -> py::tuple
+                           {
+                               FifoDecoder::Result result {};
+
+                               {
+                                   const std::span<const std::uint32_t> words(pWords.data(), static_cast<std::size_t>(pWords.size()));
+
+                                   const py::gil_scoped_release release;
+                                   (void)release;
+
+                                   result = pThis.decode(words);
+                               }
+
+                               py::dict records;
+
+                               for (FifoDecoder::RecordArrays& recordArrays : result.records)
+                               {
+                                   py::dict fields;
+
+                                   for (std::size_t i = 0; i < recordArrays.fieldNames.size(); ++i)
+                                       fields[py::str(recordArrays.fieldNames[i])] = arrayFromVector(std::move(recordArrays.columns[i]));
+
+                                   records[py::str(recordArrays.name)] = py::make_tuple(fields, arrayFromVector(std::move(recordArrays.positions)));
+                               }
+
+                               return py::make_tuple(records, result.numUnmatched);
+                           },
+                 "Decode a sequence of data words. Returns a tuple of a dict that maps each record type name to a tuple "
+                 "(dict of field name to numpy array, numpy array of word positions) and the number of unmatched words.",
+                 py::arg("words"))
+            .def("getStatistics", &FifoDecoder::getStatistics, "Get the current decoder counters.")
+            .def_static("parseRules", &FifoDecoder::parseRules, "Parse record type definitions from YAML format.", py::arg("yamlString"));
+}
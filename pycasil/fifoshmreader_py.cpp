@@ -0,0 +1,118 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/fifoshmreader.h>
+
+#include <pybind11/chrono.h>
+#include <pybind11/numpy.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+
+using casil::FifoShmReader;
+
+namespace
+{
+
+/*
+ * Maximum time to wait for a block without the GIL before checking for signals (KeyboardInterrupt) while iterating.
+ */
+constexpr std::chrono::milliseconds signalCheckInterval {100};
+
+/*
+ * Expose a block as (sequence number, read-only numpy array) without copying; the array keeps the reader (i.e. the mapping) alive.
+ */
+py::tuple tupleFromBlock(const FifoShmReader::Block& pBlock, const py::object& pReader)
+{
+    py::array_t<std::uint32_t> array(static_cast<py::ssize_t>(pBlock.words.size()), pBlock.words.data(), pReader);
+    array.attr("setflags")(py::arg("write") = false);
+
+    return py::make_tuple(pBlock.sequence, std::move(array));
+}
+
+} // namespace
+
+void bind_FifoShmReader(py::module& pM)
+{
+    py::class_<FifoShmReader>(pM, "FifoShmReader",
+                              "Reader for FIFO data blocks published to a named shared-memory ring by another process.")
+            .def(py::init<const std::string&, bool>(), "Constructor.", py::arg("name"), py::arg("fromOldest") = false)
+            .def("getName", &FifoShmReader::getName, "Get the name of the shared-memory ring.")
+            .def("getSlotSize", &FifoShmReader::getSlotSize, "Get the slot capacity in bytes.")
+            .def("getNumSlots", &FifoShmReader::getNumSlots, "Get the number of slots.")
+            .def("next", [](const py::object& pSelf, const std::chrono::milliseconds pTimeout) -> std::optional<py::tuple>
+                         {
+                             FifoShmReader& reader = pSelf.cast<FifoShmReader&>();
+
+                             std::optional<FifoShmReader::Block> block;
+                             {
+                                 const py::gil_scoped_release gilRelease;
+                                 (void)gilRelease;
+                                 block = reader.next(pTimeout);
+                             }
+
+                             if (!block)
+                                 return std::nullopt;
+
+                             return ::tupleFromBlock(*block, pSelf);
+                         },
+                 "Get the next published block as (sequence number, read-only numpy array view of the shared memory), "
+                 "or None on timeout or at the end.", py::arg("timeout") = std::chrono::milliseconds::zero())
+            .def("isValid", &FifoShmReader::isValid, "Check if a block is still complete and not overwritten.", py::arg("sequence"))
+            .def("atEnd", &FifoShmReader::atEnd, "Check if the writer was closed and all blocks were taken.")
+            .def("getLostBlocks", &FifoShmReader::getLostBlocks, "Get the number of blocks skipped because they were overwritten.")
+            .def("__iter__", [](FifoShmReader& pThis) -> FifoShmReader& { return pThis; },
+                 "Iterate over the published blocks.", py::return_value_policy::reference_internal)
+            .def("__next__", [](const py::object& pSelf) -> py::tuple
+                             {
+                                 FifoShmReader& reader = pSelf.cast<FifoShmReader&>();
+
+                                 //Wait without the GIL, but regularly check for signals to keep the loop interruptible
+
+                                 while (true)
+                                 {
+                                     std::optional<FifoShmReader::Block> block;
+                                     {
+                                         const py::gil_scoped_release gilRelease;
+                                         (void)gilRelease;
+                                         block = reader.next(::signalCheckInterval);
+                                     }
+
+                                     if (block)
+                                         return ::tupleFromBlock(*block, pSelf);
+
+                                     if (reader.atEnd())
+                                         throw py::stop_iteration();
+
+                                     if (PyErr_CheckSignals() != 0)
+                                         throw py::error_already_set();
+                                 }
+                             },
+                 "Wait for and get the next block as (sequence number, read-only numpy array view of the shared memory); "
+                 "stops after the writer was closed.");
+}
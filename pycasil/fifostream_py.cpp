@@ -0,0 +1,147 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/fifostream.h>
+#include <casil/HL/Muxed/sitcpfifo.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <pybind11/chrono.h>
+#include <pybind11/numpy.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+using casil::FifoStream;
+
+namespace
+{
+
+/*
+ * Maximum time to wait for a block without the GIL before checking for signals (KeyboardInterrupt) while iterating.
+ */
+constexpr std::chrono::milliseconds signalCheckInterval {100};
+
+/*
+ * Expose a pooled block as read-only numpy array without copying; the capsule keeps the block alive as long as the array.
+ */
+py::array_t<std::uint32_t> arrayFromBlock(FifoStream::BlockType pBlock)
+{
+    auto block = std::make_unique<FifoStream::BlockType>(std::move(pBlock));
+    const std::vector<std::uint32_t>& words = **block;
+
+    py::capsule owner(block.get(), [](void* pOwnedBlock) { delete static_cast<FifoStream::BlockType*>(pOwnedBlock); });
+    (void)block.release();
+
+    py::array_t<std::uint32_t> array(static_cast<py::ssize_t>(words.size()), words.data(), owner);
+    array.attr("setflags")(py::arg("write") = false);
+
+    return array;
+}
+
+} // namespace
+
+void bind_FifoStream(py::module& pM)
+{
+    py::class_<FifoStream> fifoStream(pM, "FifoStream",
+                                      "Prefetching readout of the FIFO of a SiTCP interface as a stream (iterator) of fixed-size blocks.");
+
+    py::class_<FifoStream::Statistics>(fifoStream, "Statistics", "Snapshot of the stream counters.")
+            .def_readonly("blocksQueued", &FifoStream::Statistics::blocksQueued, "Number of blocks added to the queue.")
+            .def_readonly("wordsQueued", &FifoStream::Statistics::wordsQueued, "Number of data words added to the queue.")
+            .def_readonly("wakeUps", &FifoStream::Statistics::wakeUps, "Number of times the reading thread woke up to read the FIFO.")
+            .def_readonly("queueStalls", &FifoStream::Statistics::queueStalls,
+                          "Number of times the reading thread had to wait for a full queue.")
+            .def_readonly("blocksAllocated", &FifoStream::Statistics::blocksAllocated,
+                          "Number of blocks that had to be allocated because the pool was empty.");
+
+    fifoStream
+            .def(py::init<casil::TL::SiTCP&, std::size_t, std::size_t>(), "Constructor.",
+                 py::arg("interface"), py::arg("blockWords") = 65536, py::arg("queueCapacity") = 16, py::keep_alive<1, 2>())
+            .def(py::init([](const casil::HL::SiTCPFifo& pFifo, const std::size_t pBlockWords, const std::size_t pQueueCapacity)
+                          { return std::make_unique<FifoStream>(pFifo.getSiTCPInterface(), pBlockWords, pQueueCapacity); }),
+                 "Constructor (for the interface of a SiTCPFifo driver).",
+                 py::arg("fifo"), py::arg("blockWords") = 65536, py::arg("queueCapacity") = 16, py::keep_alive<1, 2>())
+            .def("getBlockWords", &FifoStream::getBlockWords, "Get the number of words per block.")
+            .def("start", &FifoStream::start, "Start the reading thread.", py::call_guard<py::gil_scoped_release>())
+            .def("stop", &FifoStream::stop, "Stop the reading thread.", py::call_guard<py::gil_scoped_release>())
+            .def("isRunning", &FifoStream::isRunning, "Check if the reading thread is running.")
+            .def("atEnd", &FifoStream::atEnd, "Check if the stream is stopped and all blocks were taken.")
+            .def("getBlock", [](FifoStream& pThis, const std::chrono::milliseconds pTimeout) -> std::optional<py::array_t<std::uint32_t>>
+                             {
+                                 FifoStream::BlockType block;
+                                 {
+                                     const py::gil_scoped_release gilRelease;
+                                     (void)gilRelease;
+                                     block = pThis.getBlock(pTimeout);
+                                 }
+
+                                 if (!block)
+                                     return std::nullopt;
+
+                                 return ::arrayFromBlock(std::move(block));
+                             },
+                 "Take the next block from the queue (read-only numpy array without copy, or None on timeout).",
+                 py::arg("timeout") = std::chrono::milliseconds::zero())
+            .def("getStatistics", &FifoStream::getStatistics, "Get the current stream counters.")
+            .def("__iter__", [](FifoStream& pThis) -> FifoStream&
+                             {
+                                 const py::gil_scoped_release gilRelease;
+                                 (void)gilRelease;
+
+                                 pThis.start();
+
+                                 return pThis;
+                             },
+                 "Start the stream (if not running) and iterate over its blocks.", py::return_value_policy::reference_internal)
+            .def("__next__", [](FifoStream& pThis) -> py::array_t<std::uint32_t>
+                             {
+                                 //Wait without the GIL, but regularly check for signals to keep the loop interruptible
+
+                                 while (true)
+                                 {
+                                     FifoStream::BlockType block;
+                                     {
+                                         const py::gil_scoped_release gilRelease;
+                                         (void)gilRelease;
+                                         block = pThis.getBlock(::signalCheckInterval);
+                                     }
+
+                                     if (block)
+                                         return ::arrayFromBlock(std::move(block));
+
+                                     if (pThis.atEnd())
+                                         throw py::stop_iteration();
+
+                                     if (PyErr_CheckSignals() != 0)
+                                         throw py::error_already_set();
+                                 }
+                             },
+                 "Wait for and take the next block (read-only numpy array without copy); stops after the stream was stopped.");
+}
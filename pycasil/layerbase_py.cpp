@@ -25,6 +25,15 @@
 
 #include <casil/layerbase.h>
 
+#include <boost/property_tree/ptree.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 using casil::LayerBase;
 
 void bind_LayerBase(py::module& pM)
@@ -42,10 +51,37 @@ void bind_LayerBase(py::module& pM)
     layerBase.def("getLayer", &LayerBase::getLayer, "Get the layer of this layer component.")
             .def("getType", &LayerBase::getType, "Get the type name of this layer component.")
             .def("getName", &LayerBase::getName, "Get the instance name of this layer component.")
-            .def("init", &LayerBase::init, "Initialize this layer component.", py::arg("force") = false)
-            .def("close", &LayerBase::close, "Close (\"uninitialize\") this layer component.", py::arg("force") = false)
-            .def("loadRuntimeConfiguration", &LayerBase::loadRuntimeConfiguration,
+            .def("init", &LayerBase::init, "Initialize this layer component.", py::arg("force") = false,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("close", &LayerBase::close, "Close (\"uninitialize\") this layer component.", py::arg("force") = false,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("loadRuntimeConfiguration", py::overload_cast<const std::string&>(&LayerBase::loadRuntimeConfiguration),
                  "Load additional, component-specific configuration data/values.", py::arg("conf"))
+            .def("loadRuntimeConfiguration", [](LayerBase& pSelf, const py::object& pConf) -> bool
+                 { return pSelf.loadRuntimeConfiguration(PyCasilUtils::propertyTreeFromPyObject(pConf)); },
+                 "Load additional, component-specific configuration data/values (from a configuration dict/list "
+                 "instead of a YAML document).", py::arg("conf"))
             .def("dumpRuntimeConfiguration", &LayerBase::dumpRuntimeConfiguration,
-                 "Save current state of component-specific configuration data/values.");
+                 "Save current state of component-specific configuration data/values.")
+            .def("loadRuntimeSnapshot", [](LayerBase& pSelf, const py::buffer& pSnapshot) -> bool
+                 {
+                     const py::buffer_info info = pSnapshot.request();
+
+                     if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1)
+                         throw std::invalid_argument("Buffer must be a contiguous sequence of bytes.");
+
+                     return pSelf.loadRuntimeSnapshot(std::span<const std::uint8_t>(static_cast<const std::uint8_t*>(info.ptr),
+                                                                                    static_cast<std::size_t>(info.size)));
+                 },
+                 "Load component-specific configuration data/values from a binary snapshot.", py::arg("snapshot"))
+            .def("dumpRuntimeSnapshot", [](const LayerBase& pSelf) -> py::bytes
+                 {
+                     const std::vector<std::uint8_t> snapshot = pSelf.dumpRuntimeSnapshot();
+                     return py::bytes(reinterpret_cast<const char*>(snapshot.data()), snapshot.size());
+                 },
+                 "Save current state of component-specific configuration data/values as a binary snapshot.")
+            .def("getTimings", &LayerBase::getTimings, "Get summaries of the timed operations of this component.")
+            .def("getMemoryUsage", &LayerBase::getMemoryUsage, "Estimate the heap memory used by this component.")
+            .def("setLogLevel", &LayerBase::setLogLevel, "Override the log level for this component.", py::arg("level"))
+            .def("getLogLevel", &LayerBase::getLogLevel, "Get the log level override of this component.");
 }
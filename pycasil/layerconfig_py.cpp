@@ -25,6 +25,8 @@
 
 #include <casil/layerconfig.h>
 
+#include <boost/property_tree/ptree.hpp>
+
 using casil::LayerConfig;
 
 void bind_LayerConfig(py::module& pM)
@@ -54,5 +56,8 @@ void bind_LayerConfig(py::module& pM)
             .def("getUIntSeq", &LayerConfig::getUIntSeq, "Get a 64 bit unsigned integer sequence from the configuration tree.",
                  py::arg("key"), py::arg("default") = std::vector<std::uint64_t>{})
             .def("toString", &LayerConfig::toString, "Format the configuration tree content as human-readable string.")
-            .def_static("fromYAML", &LayerConfig::fromYAML, "Create a configuration object from YAML format.", py::arg("yamlString"));
+            .def_static("fromYAML", &LayerConfig::fromYAML, "Create a configuration object from YAML format.", py::arg("yamlString"))
+            .def_static("fromDict", [](const py::dict& pConfig) -> LayerConfig
+                                    { return LayerConfig(PyCasilUtils::propertyTreeFromPyObject(pConfig)); },
+                        "Create a configuration object from a configuration dict (without YAML round trip).", py::arg("config"));
 }
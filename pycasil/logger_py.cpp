@@ -44,6 +44,12 @@ void bind_Logger(py::module& pM)
             .value("DebugDebug", Logger::LogLevel::DebugDebug, "Log even more debug messages.")
             .finalize();
 
+    py::native_enum<Logger::OverflowPolicy>(logger, "OverflowPolicy", "enum.Enum",
+                                            "Behavior of the asynchronous backend if its message queue is full.")
+            .value("Drop", Logger::OverflowPolicy::Drop, "Discard the new message.")
+            .value("Block", Logger::OverflowPolicy::Block, "Wait until the logging thread made room for the new message.")
+            .finalize();
+
     logger.def_static("getLogLevel", &Logger::getLogLevel, "Get the log level.")
             .def_static("setLogLevel", &Logger::setLogLevel, "Set the log level.", py::arg("level"))
             .def_static("addOutputCout", &Logger::addOutputCout, "Add stdout to log output streams.")
@@ -53,6 +59,8 @@ void bind_Logger(py::module& pM)
             .def_static("addOutputClog", &Logger::addOutputClog, "Add \"stdlog\" (see C++'s std::clog) to log output streams.")
             .def_static("removeOutputClog", &Logger::removeOutputClog, "Remove \"stdlog\" (see C++'s std::clog) from log output streams.")
             .def_static("addLogFile", &Logger::addLogFile, "Add a log file to log output streams.", py::arg("fileName"))
+            .def_static("addRotatingLogFile", &Logger::addRotatingLogFile, "Add a block-buffered, size-rotated log file to log output streams.",
+                        py::arg("fileName"), py::arg("maxFileSize") = 64*1024*1024, py::arg("maxBackups") = 5, py::arg("bufferSize") = 1024*1024)
             .def_static("removeLogFile", &Logger::removeLogFile, "Remove a log file from log output streams.", py::arg("fileName"))
             .def_static("log", &Logger::log, "Print a log message.", py::arg("message"), py::arg("level") = Logger::LogLevel::Info)
             .def_static("logCritical", &Logger::logCritical, "Print a log message (LogLevel.Critical).", py::arg("message"))
@@ -65,5 +73,13 @@ void bind_Logger(py::module& pM)
             .def_static("logDebug", &Logger::logDebug, "Print a log message (LogLevel.Debug).", py::arg("message"))
             .def_static("logDebugDebug", &Logger::logDebugDebug, "Print a log message (LogLevel.DebugDebug).", py::arg("message"))
             .def_static("includeLogLevel", &Logger::includeLogLevel, "Check whether a message with a certain log level should be logged.",
-                        py::arg("level"));
+                        py::arg("level"))
+            .def_static("isCompiledIn", &Logger::isCompiledIn, "Check whether logging of a certain log level is compiled in.", py::arg("level"))
+            .def_readonly_static("minCompiledLogLevel", &Logger::minCompiledLogLevel, "Least severe log level that is compiled in.")
+            .def_static("enableAsync", &Logger::enableAsync, "Enable the asynchronous logging backend.",
+                        py::arg("queueSize") = 4096, py::arg("policy") = Logger::OverflowPolicy::Drop)
+            .def_static("disableAsync", &Logger::disableAsync, "Disable the asynchronous logging backend.")
+            .def_static("isAsync", &Logger::isAsync, "Check if the asynchronous backend is enabled.")
+            .def_static("flush", &Logger::flush, "Write all pending messages and flush the outputs.")
+            .def_static("getDroppedCount", &Logger::getDroppedCount, "Get the number of dropped messages.");
 }
@@ -0,0 +1,45 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/memoryplacement.h>
+
+using casil::MemoryPlacement;
+
+void bind_MemoryPlacement(py::module& pM)
+{
+    py::class_<MemoryPlacement>(pM, "MemoryPlacement", "Huge page and NUMA node options for large, long-lived buffers.")
+            .def(py::init<>([](const bool pHugePages, const int pNumaNode) -> MemoryPlacement
+                            {
+                                return MemoryPlacement{.hugePages = pHugePages, .numaNode = pNumaNode};
+                            }),
+                 "Constructor.", py::arg("hugePages") = false, py::arg("numaNode") = -1)
+            .def_readwrite("hugePages", &MemoryPlacement::hugePages, "Back the memory by huge pages.")
+            .def_readwrite("numaNode", &MemoryPlacement::numaNode, "NUMA node to allocate the memory on (negative for no binding).")
+            .def("isDefault", &MemoryPlacement::isDefault, "Check if this is the default heap placement.")
+            .def_static("getNetworkDeviceNumaNode", &MemoryPlacement::getNetworkDeviceNumaNode,
+                        "Get the NUMA node of a network interface card.", py::arg("deviceName"))
+            .def_static("getCurrentNumaNode", &MemoryPlacement::getCurrentNumaNode, "Get the NUMA node of the calling thread's CPU.")
+            .def_readonly_static("hugePageSize", &MemoryPlacement::hugePageSize, "Assumed huge page size (2 MiB).");
+}
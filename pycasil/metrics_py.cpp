@@ -0,0 +1,71 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/metrics.h>
+
+using casil::Metrics;
+
+void bind_Metrics(py::module& pM)
+{
+    py::class_<Metrics> metrics(pM, "Metrics", "Registry of counters, gauges and histograms with Prometheus/OpenMetrics exposition.");
+
+    py::native_enum<Metrics::Type>(metrics, "Type", "enum.Enum", "Type of a metric family.")
+            .value("Counter", Metrics::Type::Counter, "Monotonically increasing value.")
+            .value("Gauge", Metrics::Type::Gauge, "Arbitrarily changing value.")
+            .value("Histogram", Metrics::Type::Histogram, "Distribution of observed values in fixed buckets.")
+            .finalize();
+
+    py::class_<Metrics::Counter>(metrics, "Counter", "Monotonically increasing counter.")
+            .def("increment", &Metrics::Counter::increment, "Increase the value.", py::arg("value") = 1)
+            .def("getValue", &Metrics::Counter::getValue, "Get the value.");
+
+    py::class_<Metrics::Gauge>(metrics, "Gauge", "Gauge with arbitrarily changing value.")
+            .def("set", &Metrics::Gauge::set, "Set the value.", py::arg("value"))
+            .def("add", &Metrics::Gauge::add, "Change the value.", py::arg("value"))
+            .def("getValue", &Metrics::Gauge::getValue, "Get the value.");
+
+    py::class_<Metrics::Histogram>(metrics, "Histogram", "Histogram with fixed buckets.")
+            .def("observe", &Metrics::Histogram::observe, "Add an observed value.", py::arg("value"))
+            .def("getUpperBounds", &Metrics::Histogram::getUpperBounds, "Get the bucket upper bounds.")
+            .def("getBucketCounts", &Metrics::Histogram::getBucketCounts, "Get the (non-cumulative) counts of all buckets.")
+            .def("getSum", &Metrics::Histogram::getSum, "Get the sum of all observed values.");
+
+    py::class_<Metrics::CallbackHandle>(metrics, "CallbackHandle", "Removes a callback metric on destruction.")
+            .def("reset", &Metrics::CallbackHandle::reset, "Remove the callback metric.");
+
+    metrics.def_static("counter", &Metrics::counter, "Get or register a counter.", py::return_value_policy::reference,
+                       py::arg("name"), py::arg("help"), py::arg("labels") = Metrics::Labels{})
+            .def_static("gauge", &Metrics::gauge, "Get or register a gauge.", py::return_value_policy::reference,
+                        py::arg("name"), py::arg("help"), py::arg("labels") = Metrics::Labels{})
+            .def_static("histogram", &Metrics::histogram, "Get or register a histogram.", py::return_value_policy::reference,
+                        py::arg("name"), py::arg("help"), py::arg("upperBounds"), py::arg("labels") = Metrics::Labels{})
+            .def_static("addCallback", &Metrics::addCallback, "Register a counter/gauge callback.",
+                        py::arg("name"), py::arg("help"), py::arg("type"), py::arg("labels"), py::arg("callback"))
+            .def_static("expose", &Metrics::expose, "Get all metrics in OpenMetrics text format.")
+            .def_static("startHttpServer", &Metrics::startHttpServer, "Start serving expose() via HTTP.",
+                        py::arg("port"), py::arg("address") = "127.0.0.1")
+            .def_static("stopHttpServer", &Metrics::stopHttpServer, "Stop the HTTP server.")
+            .def_static("getHttpPort", &Metrics::getHttpPort, "Get the port of the running HTTP server.");
+}
@@ -0,0 +1,113 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <pycasil/pycasil.h>
+
+#include <casil/onlinehistograms.h>
+
+#include <pybind11/numpy.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using casil::OnlineHistograms;
+
+namespace
+{
+
+/*
+ * Return a histogram snapshot as numpy array of the histogram's shape without copying the bins.
+ */
+py::array_t<std::uint64_t> snapshotArray(const OnlineHistograms& pHistograms, const std::size_t pIdx)
+{
+    const std::vector<std::size_t> shape = pHistograms.getShape(pIdx);
+
+    auto bins = std::make_unique<std::vector<std::uint64_t>>();
+
+    {
+        const py::gil_scoped_release release;
+        (void)release;
+
+        *bins = pHistograms.getSnapshot(pIdx);
+    }
+
+    const std::uint64_t* const data = bins->data();
+
+    py::capsule owner(bins.get(), [](void* pOwnedBins) { delete static_cast<std::vector<std::uint64_t>*>(pOwnedBins); });
+    (void)bins.release();
+
+    return py::array_t<std::uint64_t>(std::vector<py::ssize_t>(shape.begin(), shape.end()), data, owner);
+}
+
+} // namespace
+
+void bind_OnlineHistograms(py::module& pM)
+{
+    py::class_<OnlineHistograms, std::shared_ptr<OnlineHistograms>> onlineHistograms(pM, "OnlineHistograms",
+                                                                                     "Histograms of decoded FIFO record fields "
+                                                                                     "for live monitoring.");
+
+    py::class_<OnlineHistograms::Definition>(onlineHistograms, "Definition", "Definition of a histogram.")
+            .def(py::init<>([](std::string pName, std::string pXField, std::string pYField) -> OnlineHistograms::Definition
+                            {
+                                return OnlineHistograms::Definition{.name = std::move(pName), .xField = std::move(pXField),
+                                                                    .yField = std::move(pYField)};
+                            }),
+                 "Constructor.", py::arg("name"), py::arg("xField"), py::arg("yField") = "")
+            .def_readwrite("name", &OnlineHistograms::Definition::name, "Histogram name.")
+            .def_readwrite("xField", &OnlineHistograms::Definition::xField, "Name of the field for the first axis.")
+            .def_readwrite("yField", &OnlineHistograms::Definition::yField,
+                           "Name of the field for the second axis (empty for a one-dimensional histogram).");
+
+    onlineHistograms
+            .def(py::init<casil::FifoDecoder::Rule, std::vector<OnlineHistograms::Definition>>(), "Constructor.",
+                 py::arg("rule"), py::arg("definitions"))
+            .def("getRule", &OnlineHistograms::getRule, "Get the definition of the histogrammed record type.")
+            .def("getDefinitions", &OnlineHistograms::getDefinitions, "Get the histogram definitions.")
+            .def("findHistogram", &OnlineHistograms::findHistogram, "Get the index of a histogram.", py::arg("name"))
+            .def("getShape", &OnlineHistograms::getShape, "Get the numbers of bins of a histogram.", py::arg("idx"))
+            .def("fill", [](OnlineHistograms& pThis, const py::array_t<std::uint32_t, py::array::c_style | py::array::forcecast>& pWords) -> void
+                         {
+                             const std::span<const std::uint32_t> words(pWords.data(), static_cast<std::size_t>(pWords.size()));
+
+                             const py::gil_scoped_release release;
+                             (void)release;
+
+                             pThis.fill(words);
+                         },
+                 "Fill the histograms with the matching data words.", py::arg("words"))
+            .def("getSnapshot", &snapshotArray, "Get the current merged bin contents of a histogram as numpy array of its shape.",
+                 py::arg("idx"))
+            .def("getSnapshot", [](const OnlineHistograms& pThis, const std::string& pName) -> py::array_t<std::uint64_t>
+                                { return snapshotArray(pThis, pThis.findHistogram(pName)); },
+                 "Get the current merged bin contents of a histogram as numpy array of its shape.", py::arg("name"))
+            .def("getNumRecords", &OnlineHistograms::getNumRecords, "Get the number of histogrammed records.")
+            .def("getNumAccumulators", &OnlineHistograms::getNumAccumulators, "Get the number of threads that filled the histograms.")
+            .def("reset", &OnlineHistograms::reset, "Start counting from zero again.");
+}
@@ -0,0 +1,64 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/pooledbuffer.h>
+
+#include <cstddef>
+#include <cstdint>
+
+using casil::PooledBuffer;
+
+void bind_PooledBuffer(py::module& pM)
+{
+    py::class_<PooledBuffer> pooledBuffer(pM, "PooledBuffer", py::buffer_protocol(),
+                                          "Reference-counted byte buffer whose memory is taken from and returned to a thread-local pool "
+                                          "(supports the buffer protocol, e.g. memoryview(), without copying).");
+
+    py::class_<PooledBuffer::Statistics>(pooledBuffer, "Statistics", "Snapshot of the process-wide pool counters.")
+            .def_readonly("blocksAcquired", &PooledBuffer::Statistics::blocksAcquired, "Number of blocks handed out for new buffers.")
+            .def_readonly("blocksAllocated", &PooledBuffer::Statistics::blocksAllocated,
+                          "Number of blocks that had to be allocated because the free list was empty.")
+            .def_readonly("blocksRecycled", &PooledBuffer::Statistics::blocksRecycled,
+                          "Number of released blocks that were put back into a free list.");
+
+    pooledBuffer.def(py::init<>(), "Default constructor.")
+            .def(py::init<std::size_t>(), "Constructor.", py::arg("size"))
+            .def_buffer([](PooledBuffer& pSelf) -> py::buffer_info
+                        {
+                            return py::buffer_info(pSelf.data(), static_cast<py::ssize_t>(pSelf.size()), false);
+                        })
+            .def("__len__", &PooledBuffer::size, "Get the buffer size in number of bytes.")
+            .def("size", &PooledBuffer::size, "Get the buffer size in number of bytes.")
+            .def("capacity", &PooledBuffer::capacity, "Get the maximum size without changing the block.")
+            .def("empty", &PooledBuffer::empty, "Check if the buffer size is zero.")
+            .def("useCount", &PooledBuffer::useCount, "Get the number of buffers sharing the block.")
+            .def("resize", &PooledBuffer::resize, "Change the buffer size.", py::arg("size"))
+            .def("toBytes", &PooledBuffer::toVector, "Copy the buffer bytes to a bytes object.")
+            .def_static("getStatistics", &PooledBuffer::getStatistics, "Get the current process-wide pool counters.")
+            .def_static("clearThreadPool", &PooledBuffer::clearThreadPool, "Free all pooled blocks of the calling thread.")
+            .def_readonly_static("sizeClasses", &PooledBuffer::sizeClasses, "Block capacities of the pooled size classes.")
+            .def_readonly_static("maxFreeBlocksPerClass", &PooledBuffer::maxFreeBlocksPerClass,
+                                 "Maximum number of free blocks per size class and thread.");
+}
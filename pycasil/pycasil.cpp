@@ -23,12 +23,35 @@
 
 #include <pycasil/pycasil.h>
 
+#include <atomic>
+#include <mutex>
+#include <string>
+
+extern void bind_Allocations(py::module&);
 extern void bind_ASIO(py::module&);
 extern void bind_ContextualLogger(py::module&);
 extern void bind_Device(py::module&);
+extern void bind_DeviceServer(py::module&);
+extern void bind_Error(py::module&);
+extern void bind_FifoAggregator(py::module&);
+extern void bind_FifoShmReader(py::module&);
+extern void bind_FifoStream(py::module&);
 extern void bind_LayerBase(py::module&);
 extern void bind_LayerConfig(py::module&);
 extern void bind_Logger(py::module&);
+extern void bind_MemoryPlacement(py::module&);
+extern void bind_Metrics(py::module&);
+extern void bind_PooledBuffer(py::module&);
+extern void bind_RawDataFile(py::module&);
+extern void bind_FifoDecoder(py::module&);
+extern void bind_OnlineHistograms(py::module&);
+extern void bind_ReadoutPipeline(py::module&);
+extern void bind_ScanEngine(py::module&);
+extern void bind_Scheduler(py::module&);
+extern void bind_SlowControlArchiver(py::module&);
+extern void bind_SlowControlPoller(py::module&);
+extern void bind_Timing(py::module&);
+extern void bind_Tracer(py::module&);
 
 extern void bindAuxil(py::module&);
 extern void bindBytes(py::module&);
@@ -39,16 +62,92 @@ extern void bindHL(py::module&);
 extern void bindRL(py::module&);
 extern void bindTL(py::module&);
 
+namespace
+{
+
+std::atomic_bool layersBound = false;   //Set once the layer submodules are bound
+std::mutex layersBindMutex;             //Serializes binding the layer submodules (there may be no GIL, see PYBIND11_MODULE below)
+
+/*
+ * Bind the transfer, hardware and register layer submodules into the "Layers" submodule.
+ */
+void bindLayers(py::module& pModLayers)
+{
+    py::module modTL = pModLayers.def_submodule("TL", "Transfer layer: Interfaces that connect the PyCasil host to its devices/components.");
+    bindTL(modTL);
+
+    py::module modHL = pModLayers.def_submodule("HL", "Hardware layer: Drivers that control the connected devices/components.");
+    bindHL(modHL);
+
+    py::module modRL = pModLayers.def_submodule("RL", "Register layer: Abstraction for register(-like) functionalities of the drivers.");
+    bindRL(modRL);
+
+    layersBound.store(true, std::memory_order_release);
+}
+
+} // namespace
+
+/*
+ * Make sure that the layer submodules are bound (needed before returning layer components to Python, such that they
+ * are exposed with their most derived bound type). Only has an effect if the binding was built with lazy layer binding
+ * (see CMake option CASIL_BINDING_LAZY_LAYERS), where the submodules are otherwise only bound on first access.
+ */
+void ensureLayersBound()
+{
+    if (layersBound.load(std::memory_order_acquire))
+        return;
+
+    //Wait for the mutex with detached thread state to avoid a deadlock with a binding thread that (temporarily) needs the GIL
+    std::unique_lock<std::mutex> bindLock(layersBindMutex, std::defer_lock);
+    {
+        const py::gil_scoped_release gilRelease;
+        (void)gilRelease;
+
+        bindLock.lock();
+    }
+
+    if (layersBound.load(std::memory_order_relaxed))
+        return;
+
+    py::module modLayers = py::module::import("PyCasil").attr("Layers");
+    ::bindLayers(modLayers);
+}
+
+/*
+ * The module is not declared free-threading compatible (see py::mod_gil_not_used()), i.e. free-threaded CPython builds
+ * enable the GIL on import: Some bound classes still rely on the GIL for mutual exclusion between Python threads (e.g.
+ * StandardRegister and RegField modify the register bits without locking), while the lazy layer binding (see ensureLayersBound())
+ * and the Logger already synchronize internally.
+ */
 PYBIND11_MODULE(PyCasil, pyCasil)
 {
     pyCasil.doc() = "Python binding of Casil, a reimplementation of the data acquisition framework basil in C++.";
 
+    bind_Allocations(pyCasil);
     bind_ASIO(pyCasil);
     bind_Device(pyCasil);
+    bind_DeviceServer(pyCasil);
+    bind_Error(pyCasil);
+    bind_FifoAggregator(pyCasil);
+    bind_FifoShmReader(pyCasil);
+    bind_FifoStream(pyCasil);
     bind_LayerBase(pyCasil);
     bind_LayerConfig(pyCasil);
     bind_Logger(pyCasil);
     bind_ContextualLogger(pyCasil); //Bind after Logger because it needs bound Logger::LogLevel
+    bind_MemoryPlacement(pyCasil);  //Bind before ReadoutPipeline because it needs bound MemoryPlacement
+    bind_Metrics(pyCasil);
+    bind_PooledBuffer(pyCasil);
+    bind_RawDataFile(pyCasil);
+    bind_FifoDecoder(pyCasil);
+    bind_OnlineHistograms(pyCasil); //Bind after FifoDecoder because it needs bound FifoDecoder::Rule
+    bind_ReadoutPipeline(pyCasil);
+    bind_ScanEngine(pyCasil);
+    bind_Scheduler(pyCasil);
+    bind_SlowControlPoller(pyCasil);
+    bind_SlowControlArchiver(pyCasil);   //Bind after SlowControlPoller because it needs bound SlowControlPoller
+    bind_Timing(pyCasil);
+    bind_Tracer(pyCasil);
 
     //
 
@@ -69,12 +168,18 @@ PYBIND11_MODULE(PyCasil, pyCasil)
     py::module modLayers = pyCasil.def_submodule("Layers", "Starting point for the differentiation into the three layers of "
                                                            "the basil layer structure with their associated layer components.");
 
-    py::module modTL = modLayers.def_submodule("TL", "Transfer layer: Interfaces that connect the PyCasil host to its devices/components.");
-    bindTL(modTL);
+#ifdef PYCASIL_LAZY_LAYERS
+    //Bind the layer submodules only on first access to reduce the import time (see also ensureLayersBound())
+    modLayers.def("__getattr__", [](const std::string& pName) -> py::object
+                                 {
+                                     if (pName != "TL" && pName != "HL" && pName != "RL")
+                                         throw py::attribute_error("module 'PyCasil.Layers' has no attribute '" + pName + "'");
 
-    py::module modHL = modLayers.def_submodule("HL", "Hardware layer: Drivers that control the connected devices/components.");
-    bindHL(modHL);
+                                     ensureLayersBound();
 
-    py::module modRL = modLayers.def_submodule("RL", "Register layer: Abstraction for register(-like) functionalities of the drivers.");
-    bindRL(modRL);
+                                     return py::module::import("PyCasil").attr("Layers").attr(pName.c_str());
+                                 });
+#else
+    ::bindLayers(modLayers);
+#endif
 }
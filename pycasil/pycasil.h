@@ -30,6 +30,7 @@
 #include <pybind11/native_enum.h>
 #include <pybind11/stl.h>
 
+#include <pycasil/pycasil_casters.h>
 #include <pycasil/pycasil_utils.h>
 
 namespace py = pybind11;
@@ -0,0 +1,153 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef PYCASIL_PYCASILASYNCIO_H
+#define PYCASIL_PYCASILASYNCIO_H
+
+#include <pycasil/pycasil.h>
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace PyCasilUtils
+{
+
+/*
+ * Get the Python exception object corresponding to a C++ exception (translated as for any bound function).
+ */
+inline py::object exceptionObject(const std::exception_ptr& pError)
+{
+    try
+    {
+        py::cpp_function([pError]() -> void { std::rethrow_exception(pError); })();
+    }
+    catch (const py::error_already_set& exc)
+    {
+        return exc.value();
+    }
+
+    return py::none();
+}
+
+/*
+ * Set the result or exception of an asyncio future (if it was not cancelled in the meantime).
+ */
+inline void completeFuture(const py::object& pFuture, const py::object& pValue, const bool pIsError)
+{
+    if (pFuture.attr("done")().cast<bool>())
+        return;
+
+    pFuture.attr(pIsError ? "set_exception" : "set_result")(pValue);
+}
+
+/*
+ * Run a (blocking) operation of a component on its asynchronous executor and return an awaitable asyncio future.
+ *
+ * Must be called with the GIL held from within a running asyncio event loop. Queues 'pFunc' via 'pComponent.postAsync()'
+ * (see LayerBase::postAsync()), where it is executed without holding the GIL, i.e. operations
+ * of different interfaces run concurrently and operations of the same interface one after another. The returned future of the
+ * running event loop is then completed with the (converted) result or the (translated) exception of 'pFunc' from within the
+ * event loop thread via 'loop.call_soon_threadsafe()'. The Python object of 'pComponent' is kept alive until then.
+ */
+template<typename ComponentT, typename FuncT>
+py::object awaitAsync(ComponentT& pComponent, FuncT pFunc)
+{
+    using ResultType = std::invoke_result_t<FuncT&>;
+
+    /*
+     * Python objects needed for completing the future; only to be created/destroyed while holding the GIL.
+     */
+    struct PendingFuture
+    {
+        py::object loop;
+        py::object future;
+        py::object component;
+    };
+
+    py::object loop = py::module_::import("asyncio").attr("get_running_loop")();
+    py::object future = loop.attr("create_future")();
+
+    PendingFuture *const pending = new PendingFuture{loop, future, py::cast(pComponent, py::return_value_policy::reference)};
+
+    pComponent.postAsync([pending, func = std::move(pFunc)]() mutable -> void
+                         {
+                             std::conditional_t<std::is_void_v<ResultType>, std::monostate, std::optional<ResultType>> result;
+                             std::exception_ptr error;
+
+                             try
+                             {
+                                 if constexpr (std::is_void_v<ResultType>)
+                                     func();
+                                 else
+                                     result.emplace(func());
+                             }
+                             catch (...)
+                             {
+                                 error = std::current_exception();
+                             }
+
+                             const py::gil_scoped_acquire gilLock;
+                             (void)gilLock;
+
+                             const std::unique_ptr<PendingFuture> tPending(pending);
+
+                             py::object value = py::none();
+
+                             if (!error)
+                             {
+                                 try
+                                 {
+                                     if constexpr (!std::is_void_v<ResultType>)
+                                         value = py::cast(std::move(result.value()));
+                                 }
+                                 catch (...)
+                                 {
+                                     error = std::current_exception();
+                                 }
+                             }
+
+                             if (error)
+                                 value = exceptionObject(error);
+
+                             try
+                             {
+                                 tPending->loop.attr("call_soon_threadsafe")(py::cpp_function(&completeFuture),
+                                                                             tPending->future, value, static_cast<bool>(error));
+                             }
+                             catch (const py::error_already_set&)
+                             {
+                                 //Event loop already closed; nobody can await the future anymore
+                             }
+                         });
+
+    return future;
+}
+
+} // namespace PyCasilUtils
+
+#endif // PYCASIL_PYCASILASYNCIO_H
@@ -0,0 +1,106 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef PYCASIL_PYCASILCASTERS_H
+#define PYCASIL_PYCASILCASTERS_H
+
+#include <pybind11/pybind11.h>
+
+#include <pybind11/stl.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace pybind11::detail
+{
+
+/*
+ * Converts byte sequences to Python 'bytes' (instead of a list of ints) and accepts 'bytes', 'bytearray' and
+ * any other contiguous buffer-protocol object of single-byte items (memoryview, numpy uint8 array, ...) as input.
+ * Any other sequence of integers is still accepted as well (converted element-wise).
+ */
+template <>
+class type_caster<std::vector<std::uint8_t>>
+{
+public:
+    PYBIND11_TYPE_CASTER(std::vector<std::uint8_t>, const_name("bytes"));
+
+    bool load(const handle pSrc, const bool pConvert)
+    {
+        if (!pSrc)
+            return false;
+
+        PyObject *const src = pSrc.ptr();
+
+        if (PyBytes_Check(src))
+        {
+            const auto data = reinterpret_cast<const std::uint8_t*>(PyBytes_AS_STRING(src));
+            value.assign(data, data + PyBytes_GET_SIZE(src));
+            return true;
+        }
+        else if (PyByteArray_Check(src))
+        {
+            const auto data = reinterpret_cast<const std::uint8_t*>(PyByteArray_AS_STRING(src));
+            value.assign(data, data + PyByteArray_GET_SIZE(src));
+            return true;
+        }
+        else if (PyObject_CheckBuffer(src))
+        {
+            Py_buffer view;
+            if (PyObject_GetBuffer(src, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0)
+            {
+                const bool byteItems = (view.itemsize == 1 && view.ndim <= 1 &&
+                                        (view.format == nullptr || std::strcmp(view.format, "B") == 0 ||
+                                         std::strcmp(view.format, "b") == 0 || std::strcmp(view.format, "c") == 0));
+                if (byteItems)
+                {
+                    const auto data = static_cast<const std::uint8_t*>(view.buf);
+                    value.assign(data, data + view.len);
+                }
+                PyBuffer_Release(&view);
+
+                if (byteItems)
+                    return true;
+            }
+            else
+                PyErr_Clear();
+        }
+
+        list_caster<std::vector<std::uint8_t>, std::uint8_t> sequenceCaster;
+
+        if (!sequenceCaster.load(pSrc, pConvert))
+            return false;
+
+        value = std::move(static_cast<std::vector<std::uint8_t>&>(sequenceCaster));
+        return true;
+    }
+    static handle cast(const std::vector<std::uint8_t>& pSrc, return_value_policy, handle)
+    {
+        return bytes(reinterpret_cast<const char*>(pSrc.data()), pSrc.size()).release();
+    }
+};
+
+} // namespace pybind11::detail
+
+#endif // PYCASIL_PYCASILCASTERS_H
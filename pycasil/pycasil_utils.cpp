@@ -23,9 +23,73 @@
 
 #include <pycasil/pycasil_utils.h>
 
+#include <pybind11/pybind11.h>
+
 #include <boost/dynamic_bitset.hpp>
+#include <boost/property_tree/ptree.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace py = pybind11;
+
+namespace
+{
+
+/*
+ * Convert a scalar Python object to the string that casil::Auxil::propertyTreeFromYAML() would obtain for its YAML representation.
+ *
+ * None becomes "null", bools become "true"/"false" and strings are taken as is. Other numbers (including
+ * integer-like objects such as numpy integers) are formatted via str(). Throws pybind11::type_error otherwise.
+ */
+std::string scalarStringFromPyObject(const py::handle pObject)
+{
+    if (pObject.is_none())
+        return "null";
+    else if (py::isinstance<py::bool_>(pObject))
+        return (pObject.cast<bool>() ? "true" : "false");
+    else if (py::isinstance<py::str>(pObject))
+        return pObject.cast<std::string>();
+    else if (py::isinstance<py::float_>(pObject))
+        return py::str(pObject).cast<std::string>();
+    else if (PyIndex_Check(pObject.ptr()))
+        return py::str(py::int_(py::reinterpret_borrow<py::object>(pObject))).cast<std::string>();
+    else
+        throw py::type_error("Unsupported object of type \"" + py::str(py::type::handle_of(pObject)).cast<std::string>() +
+                             "\" in configuration.");
+}
+
+/*
+ * Recursively convert a Python object to a property tree node (see PyCasilUtils::propertyTreeFromPyObject()).
+ */
+boost::property_tree::ptree propertyTreeNodeFromPyObject(const py::handle pObject)
+{
+    using boost::property_tree::ptree;
+
+    if (py::isinstance<py::dict>(pObject))
+    {
+        ptree tree;
+        for (const auto& [key, value] : py::reinterpret_borrow<py::dict>(pObject))
+            tree.add_child(::scalarStringFromPyObject(key), ::propertyTreeNodeFromPyObject(value));
+        return tree;
+    }
+    else if (py::isinstance<py::list>(pObject) || py::isinstance<py::tuple>(pObject))
+    {
+        ptree tree;
+        std::size_t sequenceCtr = 0;
+        for (const py::handle item : pObject)
+            tree.add_child("#" + std::to_string(sequenceCtr++), ::propertyTreeNodeFromPyObject(item));
+        return tree;
+    }
+    else if (pObject.is_none())
+        return ptree();
+    else
+        return ptree(::scalarStringFromPyObject(pObject));
+}
+
+} // namespace
 
 namespace PyCasilUtils
 {
@@ -60,4 +124,57 @@ std::vector<bool> boolVecFromBitset(const boost::dynamic_bitset<>& pBits)
     return boolVec;
 }
 
+/*
+ * Convert a contiguous range of bools to a dynamic bitset.
+ *
+ * Same as bitsetFromBoolVec() but for any contiguous range, such as the data of a numpy bool array.
+ * Only the set bits need to be written, which is fast for sparse masks.
+ */
+boost::dynamic_bitset<> bitsetFromBoolRange(const std::span<const bool> pBits)
+{
+    boost::dynamic_bitset bitset(pBits.size());
+    for (std::size_t i = 0; i < pBits.size(); ++i)
+    {
+        if (pBits[i])
+            bitset.set(pBits.size() - 1 - i);
+    }
+    return bitset;
+}
+
+/*
+ * Convert a dynamic bitset to a contiguous range of bools.
+ *
+ * Same as boolVecFromBitset() but writes to a preallocated range, such as the data of a numpy bool array.
+ * Only the set bits of 'pBits' are visited, which is fast for sparse masks.
+ *
+ * Throws std::invalid_argument if the sizes of 'pBits' and 'pBools' differ.
+ */
+void boolRangeFromBitset(const boost::dynamic_bitset<>& pBits, const std::span<bool> pBools)
+{
+    if (pBools.size() != pBits.size())
+        throw std::invalid_argument("Sizes of bitset and bool range differ.");
+
+    std::ranges::fill(pBools, false);
+
+    for (std::size_t i = pBits.find_first(); i != boost::dynamic_bitset<>::npos; i = pBits.find_next(i))
+        pBools[pBits.size() - 1 - i] = true;
+}
+
+/*
+ * Convert a (nested) Python dict/list structure to a Boost Property Tree.
+ *
+ * Builds the same tree that casil::Auxil::propertyTreeFromYAML() would build from the YAML representation of 'pObject',
+ * i.e. dicts become maps, lists/tuples become sequences (keys "#0", "#1", ...), None becomes an empty node, bools become
+ * "true"/"false" and numbers are formatted via str(). This avoids dumping generated configurations to YAML and parsing them again.
+ *
+ * Throws pybind11::type_error if 'pObject' is not a dict/list/tuple or if it contains unsupported objects.
+ */
+boost::property_tree::ptree propertyTreeFromPyObject(const pybind11::handle pObject)
+{
+    if (!py::isinstance<py::dict>(pObject) && !py::isinstance<py::list>(pObject) && !py::isinstance<py::tuple>(pObject))
+        throw py::type_error("Configuration must be a dict or list.");
+
+    return ::propertyTreeNodeFromPyObject(pObject);
+}
+
 } // namespace PyCasilUtils
@@ -25,14 +25,25 @@
 #define PYCASIL_PYCASILUTILS_PYCASILUTILS_H
 
 #include <boost/dynamic_bitset_fwd.hpp>
+#include <boost/property_tree/ptree_fwd.hpp>
 
+#include <span>
 #include <vector>
 
+namespace pybind11
+{
+class handle;
+} // namespace pybind11
+
 namespace PyCasilUtils
 {
 
 boost::dynamic_bitset<> bitsetFromBoolVec(const std::vector<bool>& pBits);
 std::vector<bool> boolVecFromBitset(const boost::dynamic_bitset<>& pBits);
+boost::dynamic_bitset<> bitsetFromBoolRange(std::span<const bool> pBits);
+void boolRangeFromBitset(const boost::dynamic_bitset<>& pBits, std::span<bool> pBools);
+
+boost::property_tree::ptree propertyTreeFromPyObject(pybind11::handle pObject);
 
 } // namespace PyCasilUtils
 
@@ -0,0 +1,146 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <pycasil/pycasil.h>
+
+#include <casil/rawdatafile.h>
+
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+using casil::RawDataReader;
+using casil::RawDataReceiver;
+using casil::RawDataWriter;
+
+void bind_RawDataFile(py::module& pM)
+{
+    py::class_<RawDataReader> rawDataReader(pM, "RawDataReader", "Memory-mapped reader with chunk index for raw FIFO data files "
+                                                                 "written by RawDataWriter.");
+
+    py::native_enum<RawDataReader::Compression>(rawDataReader, "Compression", "enum.Enum", "Compression of a chunk payload.")
+            .value("None_", RawDataReader::Compression::None, "Uncompressed data words.")
+            .value("LZ4", RawDataReader::Compression::LZ4, "LZ4 block.")
+            .finalize();
+
+    py::class_<RawDataReader::ChunkInfo>(rawDataReader, "ChunkInfo", "Index entry of a chunk.")
+            .def_readonly("boardId", &RawDataReader::ChunkInfo::boardId, "Board ID of the data source.")
+            .def_readonly("sequence", &RawDataReader::ChunkInfo::sequence, "Sequence number.")
+            .def_readonly("timestamp", &RawDataReader::ChunkInfo::timestamp, "Time of writing the chunk (nanoseconds since Unix epoch).")
+            .def_readonly("numWords", &RawDataReader::ChunkInfo::numWords, "Number of data words.")
+            .def_readonly("payloadSize", &RawDataReader::ChunkInfo::payloadSize, "Stored payload length in bytes.")
+            .def_readonly("compression", &RawDataReader::ChunkInfo::compression, "Compression of the payload.")
+            .def_readonly("offset", &RawDataReader::ChunkInfo::offset, "Byte offset of the chunk header in the file.");
+
+    rawDataReader
+            .def(py::init<const std::string&>(), "Constructor.", py::arg("filePath"))
+            .def("getFilePath", &RawDataReader::getFilePath, "Get the path of the file.")
+            .def("getCreationTime", &RawDataReader::getCreationTime, "Get the creation time of the file.")
+            .def("getValidSize", &RawDataReader::getValidSize, "Get the file size covered by the header and complete chunks.")
+            .def("isTruncated", &RawDataReader::isTruncated, "Check if the file ends with an incomplete chunk.")
+            .def("getNumChunks", &RawDataReader::getNumChunks, "Get the number of complete chunks.")
+            .def("getNumWords", &RawDataReader::getNumWords, "Get the total number of data words of all chunks.")
+            .def("getIndex", &RawDataReader::getIndex, "Get the index of all complete chunks.")
+            .def("getChunkInfo", &RawDataReader::getChunkInfo, "Get the index entry of a chunk.", py::arg("idx"))
+            .def("findSequence", [](const RawDataReader& pThis, const std::uint32_t pBoardId, const std::uint64_t pSequence) -> py::object
+                                 {
+                                     const std::size_t idx = pThis.findSequence(pBoardId, pSequence);
+                                     return (idx == RawDataReader::npos ? py::object(py::none()) : py::object(py::int_(idx)));
+                                 },
+                 "Find the chunk with a certain board ID and sequence number (None if there is none).",
+                 py::arg("boardId"), py::arg("sequence"))
+            .def("findTime", [](const RawDataReader& pThis, const std::uint64_t pTimestamp) -> py::object
+                             {
+                                 const std::size_t idx = pThis.findTime(pTimestamp);
+                                 return (idx == RawDataReader::npos ? py::object(py::none()) : py::object(py::int_(idx)));
+                             },
+                 "Find the first chunk written at or after a certain time (None if there is none).", py::arg("timestamp"))
+            .def("getWords", [](const py::object& pSelf, const std::size_t pIdx) -> py::array_t<std::uint32_t>
+                             {
+                                 const std::span<const std::uint32_t> words = pSelf.cast<const RawDataReader&>().getWords(pIdx);
+
+                                 py::array_t<std::uint32_t> array(static_cast<py::ssize_t>(words.size()), words.data(), pSelf);
+                                 array.attr("setflags")(py::arg("write") = false);
+
+                                 return array;
+                             },
+                 "Get the data words of an uncompressed chunk as read-only numpy array view of the mapped file.", py::arg("idx"))
+            .def("decodeWords", [](const RawDataReader& pThis, const std::size_t pIdx) -> py::array_t<std::uint32_t>
+                                {
+                                    const std::vector<std::uint32_t> words = pThis.decodeWords(pIdx);
+                                    return py::array_t<std::uint32_t>(static_cast<py::ssize_t>(words.size()), words.data());
+                                },
+                 "Get a copy of the (decompressed) data words of a chunk as numpy array.", py::arg("idx"));
+
+    py::class_<RawDataWriter> rawDataWriter(pM, "RawDataWriter", "High-throughput writer for raw FIFO data files.");
+
+    py::class_<RawDataWriter::Statistics>(rawDataWriter, "Statistics", "Snapshot of the writer counters.")
+            .def_readonly("chunksWritten", &RawDataWriter::Statistics::chunksWritten, "Number of chunks passed to writeChunk().")
+            .def_readonly("wordsWritten", &RawDataWriter::Statistics::wordsWritten, "Number of data words passed to writeChunk().")
+            .def_readonly("bytesWritten", &RawDataWriter::Statistics::bytesWritten,
+                          "Number of bytes written to the file by the background thread.")
+            .def_readonly("fileWrites", &RawDataWriter::Statistics::fileWrites, "Number of write operations of the background thread.")
+            .def_readonly("bufferStalls", &RawDataWriter::Statistics::bufferStalls,
+                          "Number of times writeChunk() had to wait for a free buffer.");
+
+    rawDataWriter
+            .def(py::init<std::string, std::uint32_t, std::size_t, std::size_t>(), "Constructor.",
+                 py::arg("filePath"), py::arg("boardId"), py::arg("bufferSize") = 4194304, py::arg("numBuffers") = 4)
+            .def("getFilePath", &RawDataWriter::getFilePath, "Get the path of the file.")
+            .def("getBoardId", &RawDataWriter::getBoardId, "Get the board ID written to the chunks.")
+            .def("getNextSequence", &RawDataWriter::getNextSequence, "Get the sequence number of the next chunk.")
+            .def("isOpen", &RawDataWriter::isOpen, "Check if the file is open.")
+            .def("writeChunk", [](RawDataWriter& pThis, const std::vector<std::uint32_t>& pWords) -> void { pThis.writeChunk(pWords); },
+                 "Append a chunk of data words.", py::arg("words"), py::call_guard<py::gil_scoped_release>())
+            .def("writeChunkBytes", [](RawDataWriter& pThis, const std::vector<std::uint8_t>& pBytes) -> void { pThis.writeChunk(pBytes); },
+                 "Append a chunk of data words given as little endian bytes.", py::arg("bytes"), py::call_guard<py::gil_scoped_release>())
+            .def("flush", &RawDataWriter::flush, "Write all appended chunks to the file.", py::call_guard<py::gil_scoped_release>())
+            .def("close", &RawDataWriter::close, "Write all appended chunks and close the file.", py::call_guard<py::gil_scoped_release>())
+            .def("getStatistics", &RawDataWriter::getStatistics, "Get the current writer counters.");
+
+    py::class_<RawDataReceiver> rawDataReceiver(pM, "RawDataReceiver", "Receiver for raw FIFO data streams forwarded via TCP "
+                                                                       "by ReadoutPipeline.NetworkSink.");
+
+    py::class_<RawDataReceiver::Statistics>(rawDataReceiver, "Statistics", "Counters of a received stream.")
+            .def_readonly("chunksReceived", &RawDataReceiver::Statistics::chunksReceived, "Number of received chunks.")
+            .def_readonly("wordsReceived", &RawDataReceiver::Statistics::wordsReceived, "Number of received (decompressed) data words.")
+            .def_readonly("bytesReceived", &RawDataReceiver::Statistics::bytesReceived,
+                          "Number of received stream bytes (including headers and compressed payloads).")
+            .def_readonly("compressedChunks", &RawDataReceiver::Statistics::compressedChunks,
+                          "Number of received chunks with compressed payload.");
+
+    rawDataReceiver
+            .def(py::init<std::uint16_t, const std::string&, std::size_t>(), "Constructor.", py::arg("port"), py::arg("address") = "0.0.0.0",
+                 py::arg("maxChunkSize") = RawDataReceiver::defaultMaxChunkSize)
+            .def_readonly_static("defaultMaxChunkSize", &RawDataReceiver::defaultMaxChunkSize,
+                                 "Default maximum size of a received chunk in bytes.")
+            .def("getPort", &RawDataReceiver::getPort, "Get the listening port.")
+            .def("receiveToFile", &RawDataReceiver::receiveToFile, "Receive a stream and write it to a raw data file.",
+                 py::arg("filePath"), py::call_guard<py::gil_scoped_release>());
+}
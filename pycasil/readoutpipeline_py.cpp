@@ -0,0 +1,111 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/onlinehistograms.h>
+#include <casil/readoutpipeline.h>
+#include <casil/HL/Muxed/sitcpfifo.h>
+#include <casil/TL/Direct/udpring.h>
+
+#include <pybind11/chrono.h>
+#include <pybind11/numpy.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+
+using casil::ReadoutPipeline;
+
+void bind_ReadoutPipeline(py::module& pM)
+{
+    py::class_<ReadoutPipeline> readoutPipeline(pM, "ReadoutPipeline",
+                                                "Multi-threaded readout chain from FIFO sources via an optional decoder to data sinks.");
+
+    py::class_<ReadoutPipeline::Statistics>(readoutPipeline, "Statistics", "Snapshot of the pipeline counters.")
+            .def_readonly("blocksRead", &ReadoutPipeline::Statistics::blocksRead, "Number of non-empty blocks read from all sources.")
+            .def_readonly("wordsRead", &ReadoutPipeline::Statistics::wordsRead, "Number of data words read from all sources.")
+            .def_readonly("blocksDropped", &ReadoutPipeline::Statistics::blocksDropped, "Number of blocks dropped by the decoder.")
+            .def_readonly("sourceStalls", &ReadoutPipeline::Statistics::sourceStalls,
+                          "Number of times a source had to wait for a full queue (back-pressure).")
+            .def_readonly("stageErrors", &ReadoutPipeline::Statistics::stageErrors,
+                          "Number of exceptions thrown (and logged) by sources, decoder and sinks.");
+
+    readoutPipeline
+            .def(py::init<std::size_t, std::chrono::microseconds>(), "Constructor.",
+                 py::arg("queueCapacity") = 16, py::arg("pollInterval") = std::chrono::microseconds(1000))
+            .def("addFifoSource", [](ReadoutPipeline& pThis, casil::HL::SiTCPFifo& pFifo) -> std::size_t
+                                  { return pThis.addSource(std::make_unique<ReadoutPipeline::SiTCPFifoSource>(pFifo)); },
+                 "Add a source that reads the SiTCP FIFO via a SiTCPFifo driver.", py::arg("fifo"), py::keep_alive<1, 2>())
+            .def("addUDPRingSource", [](ReadoutPipeline& pThis, casil::TL::UDPRing& pInterface) -> std::size_t
+                                     { return pThis.addSource(std::make_unique<ReadoutPipeline::UDPRingSource>(pInterface)); },
+                 "Add a source that reads a UDP data stream from the packet ring of a UDPRing interface.",
+                 py::arg("interface"), py::keep_alive<1, 2>())
+            .def("addRawFileSink", [](ReadoutPipeline& pThis, std::string pBasePath, const std::size_t pBlockSize,
+                                      const std::uint64_t pMaxFileSize, const int pSourceIndex, const casil::MemoryPlacement pPlacement) -> void
+                                   {
+                                       pThis.addSink(std::make_unique<ReadoutPipeline::RawFileSink>(std::move(pBasePath), pBlockSize,
+                                                                                                    pMaxFileSize, pSourceIndex, pPlacement));
+                                   },
+                 "Add a sink that writes the raw data words to a sequence of chunked binary files.",
+                 py::arg("basePath"), py::arg("blockSize"), py::arg("maxFileSize") = 0, py::arg("sourceIndex") = -1,
+                 py::arg("placement") = casil::MemoryPlacement{})
+            .def("addNetworkSink", [](ReadoutPipeline& pThis, std::string pHost, const std::uint16_t pPort, const bool pCompress,
+                                      const std::size_t pBatchSize, const int pSourceIndex) -> void
+                                   {
+                                       pThis.addSink(std::make_unique<ReadoutPipeline::NetworkSink>(std::move(pHost), pPort, pCompress,
+                                                                                                    pBatchSize, pSourceIndex));
+                                   },
+                 "Add a sink that forwards the data words via TCP to a remote RawDataReceiver.",
+                 py::arg("host"), py::arg("port"), py::arg("compress") = false, py::arg("batchSize") = 262144, py::arg("sourceIndex") = -1)
+            .def("addHistogramSink", [](ReadoutPipeline& pThis, std::shared_ptr<casil::OnlineHistograms> pHistograms, const int pSourceIndex) -> void
+                                     {
+                                         pThis.addSink(std::make_unique<ReadoutPipeline::HistogramSink>(std::move(pHistograms), pSourceIndex));
+                                     },
+                 "Add a sink that fills online monitoring histograms.", py::arg("histograms"), py::arg("sourceIndex") = -1)
+            .def("addCallbackSink", [](ReadoutPipeline& pThis, py::function pCallback) -> void
+                                    {
+                                        //Called from the sink thread: acquire the GIL only for the Python call
+                                        auto callback = std::make_shared<py::function>(std::move(pCallback));
+
+                                        pThis.addSink(std::make_unique<ReadoutPipeline::CallbackSink>(
+                                            [callback](const std::size_t pSourceIndex, const std::span<const std::uint32_t> pWords) -> void
+                                            {
+                                                const py::gil_scoped_acquire gilLock;
+                                                (void)gilLock;
+
+                                                (*callback)(pSourceIndex, py::array_t<std::uint32_t>(static_cast<py::ssize_t>(pWords.size()),
+                                                                                                     pWords.data()));
+                                            }));
+                                    },
+                 "Add a sink that passes the source index and the data words (as numpy array) to a function.", py::arg("callback"))
+            .def("start", &ReadoutPipeline::start, "Start the stage threads.", py::call_guard<py::gil_scoped_release>())
+            .def("stop", &ReadoutPipeline::stop, "Stop reading, drain all queues and stop the stage threads.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("isRunning", &ReadoutPipeline::isRunning, "Check if the pipeline is running.")
+            .def("getStatistics", &ReadoutPipeline::getStatistics, "Get the current pipeline counters.");
+}
@@ -0,0 +1,138 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/device.h>
+#include <casil/scanengine.h>
+
+#include <pybind11/chrono.h>
+#include <pybind11/numpy.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using casil::ScanEngine;
+
+void bind_ScanEngine(py::module& pM)
+{
+    py::class_<ScanEngine> scanEngine(pM, "ScanEngine", "Executes declarative register programs (\"scans\") on a Device with batched bus accesses.");
+
+    py::native_enum<ScanEngine::Action>(scanEngine, "Action", "enum.Enum", "Kind of a program step.")
+            .value("Set", ScanEngine::Action::Set, "Write a value or byte sequence to a register.")
+            .value("Trigger", ScanEngine::Action::Trigger, "Trigger a write-only register.")
+            .value("Wait", ScanEngine::Action::Wait, "Wait for a driver to finish.")
+            .value("Sleep", ScanEngine::Action::Sleep, "Pause for a fixed duration.")
+            .value("Read", ScanEngine::Action::Read, "Read a register.")
+            .value("ReadFifo", ScanEngine::Action::ReadFifo, "Drain the FIFO of a SiTCPFifo driver.")
+            .finalize();
+
+    py::class_<ScanEngine::Step>(scanEngine, "Step", "Definition of a program step.")
+            .def(py::init<>([](const ScanEngine::Action pAction, std::string pDriver, std::string pReg, ScanEngine::ValueType pValue,
+                               const std::chrono::milliseconds pDuration) -> ScanEngine::Step
+                            {
+                                return ScanEngine::Step{.action = pAction, .driver = std::move(pDriver), .reg = std::move(pReg),
+                                                        .value = std::move(pValue), .duration = pDuration};
+                            }),
+                 "Constructor (value None means the scan parameter).", py::arg("action"), py::arg("driver") = "", py::arg("reg") = "",
+                 py::arg("value") = ScanEngine::ValueType{}, py::arg("duration") = std::chrono::milliseconds::zero())
+            .def_readwrite("action", &ScanEngine::Step::action, "Kind of step.")
+            .def_readwrite("driver", &ScanEngine::Step::driver, "Driver name.")
+            .def_readwrite("reg", &ScanEngine::Step::reg, "Register name.")
+            .def_readwrite("value", &ScanEngine::Step::value, "Written content (None for the scan parameter).")
+            .def_readwrite("duration", &ScanEngine::Step::duration, "Timeout (wait) or pause (sleep).");
+
+    py::class_<ScanEngine::Program>(scanEngine, "Program", "Definition of a complete scan.")
+            .def(py::init<>([](std::string pParameterName, std::vector<std::uint64_t> pParameterValues,
+                               std::vector<ScanEngine::Step> pSteps) -> ScanEngine::Program
+                            {
+                                return ScanEngine::Program{.parameterName = std::move(pParameterName),
+                                                           .parameterValues = std::move(pParameterValues), .steps = std::move(pSteps)};
+                            }),
+                 "Constructor.", py::arg("parameterName"), py::arg("parameterValues"), py::arg("steps"))
+            .def_readwrite("parameterName", &ScanEngine::Program::parameterName, "Scan parameter name.")
+            .def_readwrite("parameterValues", &ScanEngine::Program::parameterValues, "Scan parameter values.")
+            .def_readwrite("steps", &ScanEngine::Program::steps, "Steps executed for each parameter value.");
+
+    py::class_<ScanEngine::Point>(scanEngine, "Point", "Aggregated results for one scan parameter value.")
+            .def_readonly("parameter", &ScanEngine::Point::parameter, "Scan parameter value.")
+            .def_readonly("readValues", &ScanEngine::Point::readValues, "Read register contents (same order as Result.readNames).")
+            .def_readonly("fifoWords", &ScanEngine::Point::fifoWords, "Number of FIFO words drained by read_fifo steps.");
+
+    py::class_<ScanEngine::Result>(scanEngine, "Result", "Output of run().")
+            .def_readonly("parameterName", &ScanEngine::Result::parameterName, "Scan parameter name.")
+            .def_readonly("readNames", &ScanEngine::Result::readNames, "Names (driver.register) of the read registers.")
+            .def_readonly("points", &ScanEngine::Result::points, "Results per completed parameter value.")
+            .def_readonly("aborted", &ScanEngine::Result::aborted, "Whether the scan was stopped early by abort().");
+
+    py::class_<ScanEngine::Statistics>(scanEngine, "Statistics", "Snapshot of the engine counters.")
+            .def_readonly("pointsExecuted", &ScanEngine::Statistics::pointsExecuted, "Number of completed parameter values.")
+            .def_readonly("stepsExecuted", &ScanEngine::Statistics::stepsExecuted, "Number of executed program steps.")
+            .def_readonly("batchesExecuted", &ScanEngine::Statistics::batchesExecuted, "Number of executed merged operations.");
+
+    scanEngine
+            .def(py::init<const casil::Device&, ScanEngine::Program>(), "Constructor.", py::arg("device"), py::arg("program"),
+                 py::keep_alive<1, 2>())
+            .def(py::init<>([](const casil::Device& pDevice, const std::string& pYAMLString)
+                            {
+                                return std::make_unique<ScanEngine>(pDevice, ScanEngine::parseProgram(pYAMLString));
+                            }),
+                 "Constructor from YAML program definition.", py::arg("device"), py::arg("yamlString"), py::keep_alive<1, 2>())
+            .def("getProgram", &ScanEngine::getProgram, "Get the program definition.")
+            .def("getNumOperations", &ScanEngine::getNumOperations, "Get the number of (merged) operations per parameter value.")
+            .def("run", [](ScanEngine& pThis, const py::object& pFifoSink) -> ScanEngine::Result
+                        {
+                            ScanEngine::FifoSinkType fifoSink;
+
+                            if (!pFifoSink.is_none())
+                            {
+                                //Called without the GIL: acquire it only for the Python call
+                                auto callback = std::make_shared<py::function>(pFifoSink.cast<py::function>());
+
+                                fifoSink = [callback](const std::size_t pPointIndex, const std::span<const std::uint32_t> pWords) -> void
+                                           {
+                                               const py::gil_scoped_acquire gilLock;
+                                               (void)gilLock;
+
+                                               (*callback)(pPointIndex, py::array_t<std::uint32_t>(static_cast<py::ssize_t>(pWords.size()),
+                                                                                                   pWords.data()));
+                                           };
+                            }
+
+                            const py::gil_scoped_release release;
+                            (void)release;
+
+                            return pThis.run(fifoSink);
+                        },
+                 "Execute the scan. The optional fifoSink is called with the parameter value index and the drained FIFO words (as numpy array).",
+                 py::arg("fifoSink") = py::none())
+            .def("abort", &ScanEngine::abort, "Request a running scan to stop after the current parameter value.")
+            .def("getStatistics", &ScanEngine::getStatistics, "Get the current engine counters.")
+            .def_static("parseProgram", &ScanEngine::parseProgram, "Parse a program definition from YAML format.", py::arg("yamlString"));
+}
@@ -0,0 +1,129 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/scheduler.h>
+#include <casil/HL/driver.h>
+
+#include <pybind11/chrono.h>
+
+#include <chrono>
+#include <memory>
+#include <utility>
+
+using casil::Scheduler;
+
+namespace
+{
+
+/*
+ * Deletes the scheduler without holding the GIL, such that Python actions executed meanwhile can finish.
+ */
+struct SchedulerDeleter
+{
+    void operator()(Scheduler* const pScheduler) const
+    {
+        const py::gil_scoped_release release;
+        (void)release;
+
+        delete pScheduler;
+    }
+};
+
+/*
+ * Wraps a Python callable as scheduled action. The action and the callable's
+ * destruction acquire the GIL, since both happen on threads that do not hold it.
+ */
+Scheduler::ActionType makePythonAction(py::function pCallable)
+{
+    std::shared_ptr<py::function> callable(new py::function(std::move(pCallable)), [](py::function* const pFunction) -> void
+                                           {
+                                               const py::gil_scoped_acquire gilLock;
+                                               (void)gilLock;
+
+                                               delete pFunction;
+                                           });
+
+    return [callable]() -> void
+           {
+               const py::gil_scoped_acquire gilLock;
+               (void)gilLock;
+
+               (*callable)();
+           };
+}
+
+} // namespace
+
+void bind_Scheduler(py::module& pM)
+{
+    py::class_<Scheduler, std::unique_ptr<Scheduler, SchedulerDeleter>> scheduler(pM, "Scheduler",
+                                                                                   "Low-jitter scheduler for periodic and one-shot actions.");
+
+    py::class_<Scheduler::ActionStatistics>(scheduler, "ActionStatistics", "Snapshot of the counters of a scheduled action.")
+            .def_readonly("executions", &Scheduler::ActionStatistics::executions, "Number of executions.")
+            .def_readonly("overruns", &Scheduler::ActionStatistics::overruns, "Number of skipped periods because an execution took too long.")
+            .def_readonly("failures", &Scheduler::ActionStatistics::failures, "Number of executions that threw an exception.")
+            .def_readonly("maxLateness", &Scheduler::ActionStatistics::maxLateness,
+                          "Largest delay of an execution start with respect to its deadline.")
+            .def_readonly("meanLateness", &Scheduler::ActionStatistics::meanLateness,
+                          "Mean delay of the execution starts with respect to their deadlines.");
+
+    scheduler
+            .def(py::init<>([](const std::chrono::nanoseconds pSpinMargin, const int pCPU)
+                            {
+                                return std::unique_ptr<Scheduler, SchedulerDeleter>(new Scheduler(pSpinMargin, pCPU));
+                            }),
+                 "Constructor.", py::arg("spinMargin") = std::chrono::microseconds(200), py::arg("cpu") = -1)
+            .def("schedulePeriodic", [](Scheduler& pThis, py::function pAction, const std::chrono::nanoseconds pPeriod,
+                                        const std::chrono::nanoseconds pInitialDelay) -> Scheduler::ActionId
+                                     {
+                                         return pThis.schedulePeriodic(::makePythonAction(std::move(pAction)), pPeriod, pInitialDelay);
+                                     },
+                 "Execute a Python callable periodically.", py::arg("action"), py::arg("period"),
+                 py::arg("initialDelay") = std::chrono::nanoseconds::zero())
+            .def("scheduleOnce", [](Scheduler& pThis, py::function pAction, const std::chrono::nanoseconds pDelay) -> Scheduler::ActionId
+                                 {
+                                     return pThis.scheduleOnce(::makePythonAction(std::move(pAction)), pDelay);
+                                 },
+                 "Execute a Python callable once after a delay.", py::arg("action"), py::arg("delay"))
+            .def("schedulePeriodicExec", [](Scheduler& pThis, casil::HL::Driver& pDriver, const std::chrono::nanoseconds pPeriod,
+                                            const std::chrono::nanoseconds pInitialDelay) -> Scheduler::ActionId
+                                         {
+                                             return pThis.schedulePeriodic([&pDriver]() -> void { pDriver.exec(); }, pPeriod, pInitialDelay);
+                                         },
+                 "Execute the driver's exec() periodically (without involving Python).", py::arg("driver"), py::arg("period"),
+                 py::arg("initialDelay") = std::chrono::nanoseconds::zero(), py::keep_alive<1, 2>())
+            .def("scheduleOnceExec", [](Scheduler& pThis, casil::HL::Driver& pDriver, const std::chrono::nanoseconds pDelay) -> Scheduler::ActionId
+                                     {
+                                         return pThis.scheduleOnce([&pDriver]() -> void { pDriver.exec(); }, pDelay);
+                                     },
+                 "Execute the driver's exec() once after a delay (without involving Python).", py::arg("driver"), py::arg("delay"),
+                 py::keep_alive<1, 2>())
+            .def("cancel", &Scheduler::cancel, "Stop executing an action.", py::arg("id"))
+            .def("isScheduled", &Scheduler::isScheduled, "Check if an action is still scheduled.", py::arg("id"))
+            .def("getStatistics", &Scheduler::getStatistics, "Get the current counters of an action.", py::arg("id"))
+            .def("getSpinMargin", &Scheduler::getSpinMargin, "Get the busy-spin duration before each deadline.")
+            .def("isPinned", &Scheduler::isPinned, "Check if the scheduler thread was pinned to the requested CPU core.");
+}
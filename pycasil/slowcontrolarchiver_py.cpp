@@ -0,0 +1,94 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/slowcontrolarchiver.h>
+#include <casil/slowcontrolpoller.h>
+
+#include <pybind11/chrono.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+using casil::SlowControlArchiver;
+using casil::SlowControlPoller;
+
+namespace
+{
+
+/*
+ * Deletes the archiver without holding the GIL, such that Python sinks of the same poller executed meanwhile can finish.
+ */
+struct SlowControlArchiverDeleter
+{
+    void operator()(SlowControlArchiver* const pArchiver) const
+    {
+        const py::gil_scoped_release release;
+        (void)release;
+
+        delete pArchiver;
+    }
+};
+
+} // namespace
+
+void bind_SlowControlArchiver(py::module& pM)
+{
+    py::class_<SlowControlArchiver, std::unique_ptr<SlowControlArchiver, SlowControlArchiverDeleter>> archiver(
+                pM, "SlowControlArchiver", "Sink for SlowControlPoller that archives all polled values with batched time-series writes.");
+
+    py::enum_<SlowControlArchiver::Backend>(archiver, "Backend", "Destination of the archived samples.")
+            .value("UDP", SlowControlArchiver::Backend::UDP, "Line protocol over UDP (target \"HOST:PORT\").")
+            .value("TCP", SlowControlArchiver::Backend::TCP, "Line protocol over TCP (target \"HOST:PORT\").")
+            .value("File", SlowControlArchiver::Backend::File, "Line protocol appended to a local file (target is the file path).");
+
+    py::class_<SlowControlArchiver::Statistics>(archiver, "Statistics", "Snapshot of the archiver counters.")
+            .def_readonly("samples", &SlowControlArchiver::Statistics::samples, "Number of samples received from the poller.")
+            .def_readonly("samplesWritten", &SlowControlArchiver::Statistics::samplesWritten, "Number of samples written to the backend.")
+            .def_readonly("samplesDropped", &SlowControlArchiver::Statistics::samplesDropped,
+                          "Number of samples dropped because the block was full or the flush failed.")
+            .def_readonly("flushes", &SlowControlArchiver::Statistics::flushes, "Number of flushes that wrote samples.")
+            .def_readonly("bytesWritten", &SlowControlArchiver::Statistics::bytesWritten, "Number of bytes written to the backend.")
+            .def_readonly("failures", &SlowControlArchiver::Statistics::failures, "Number of failed flushes.");
+
+    archiver
+            .def(py::init<>([](SlowControlPoller& pPoller, const SlowControlArchiver::Backend pBackend, const std::string& pTarget,
+                               const std::chrono::milliseconds pFlushPeriod, const std::string& pMeasurement, const std::size_t pBlockSize)
+                            {
+                                return std::unique_ptr<SlowControlArchiver, SlowControlArchiverDeleter>(
+                                            new SlowControlArchiver(pPoller, pBackend, pTarget, pFlushPeriod, pMeasurement, pBlockSize));
+                            }),
+                 "Constructor.", py::arg("poller"), py::arg("backend"), py::arg("target"),
+                 py::arg("flushPeriod") = std::chrono::milliseconds(1000), py::arg("measurement") = "casil", py::arg("blockSize") = 65536,
+                 py::keep_alive<1, 2>())
+            .def("flush", &SlowControlArchiver::flush, "Write all collected samples to the backend.", py::call_guard<py::gil_scoped_release>())
+            .def("getBackend", &SlowControlArchiver::getBackend, "Get the destination of the archived samples.")
+            .def("getTarget", &SlowControlArchiver::getTarget, "Get the backend target address or file path.")
+            .def("getPendingSamples", &SlowControlArchiver::getPendingSamples, "Get the number of samples waiting for the next flush.")
+            .def("getStatistics", &SlowControlArchiver::getStatistics, "Get the current counters.")
+            .def_readonly_static("maxDatagramSize", &SlowControlArchiver::maxDatagramSize,
+                                 "Maximum UDP payload (fits into a 1500 byte Ethernet MTU).");
+}
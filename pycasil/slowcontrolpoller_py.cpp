@@ -0,0 +1,168 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/slowcontrolpoller.h>
+#include <casil/HL/registerdriver.h>
+#include <casil/HL/Direct/scpi.h>
+
+#include <pybind11/chrono.h>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using casil::SlowControlPoller;
+
+namespace
+{
+
+/*
+ * Deletes the poller without holding the GIL, such that Python callbacks executed meanwhile can finish.
+ */
+struct SlowControlPollerDeleter
+{
+    void operator()(SlowControlPoller* const pPoller) const
+    {
+        const py::gil_scoped_release release;
+        (void)release;
+
+        delete pPoller;
+    }
+};
+
+/*
+ * Wraps a Python callable as subscriber callback. The callback and the callable's
+ * destruction acquire the GIL, since both happen on threads that do not hold it.
+ */
+SlowControlPoller::CallbackType makePythonCallback(py::function pCallable)
+{
+    std::shared_ptr<py::function> callable(new py::function(std::move(pCallable)), [](py::function* const pFunction) -> void
+                                           {
+                                               const py::gil_scoped_acquire gilLock;
+                                               (void)gilLock;
+
+                                               delete pFunction;
+                                           });
+
+    return [callable](const SlowControlPoller::ValueType& pValue) -> void
+           {
+               const py::gil_scoped_acquire gilLock;
+               (void)gilLock;
+
+               (*callable)(pValue);
+           };
+}
+
+/*
+ * Wraps a Python callable as poller sink, which is called with a list of (path, sample) tuples (see makePythonCallback()).
+ */
+SlowControlPoller::SinkType makePythonSink(py::function pCallable)
+{
+    std::shared_ptr<py::function> callable(new py::function(std::move(pCallable)), [](py::function* const pFunction) -> void
+                                           {
+                                               const py::gil_scoped_acquire gilLock;
+                                               (void)gilLock;
+
+                                               delete pFunction;
+                                           });
+
+    return [callable](const std::vector<SlowControlPoller::UpdateType>& pUpdates) -> void
+           {
+               const py::gil_scoped_acquire gilLock;
+               (void)gilLock;
+
+               py::list updates;
+
+               for (const auto& [path, sample] : pUpdates)
+                   updates.append(py::make_tuple(path, std::const_pointer_cast<SlowControlPoller::Sample>(sample)));
+
+               (*callable)(updates);
+           };
+}
+
+} // namespace
+
+void bind_SlowControlPoller(py::module& pM)
+{
+    py::class_<SlowControlPoller, std::unique_ptr<SlowControlPoller, SlowControlPollerDeleter>> poller(
+                pM, "SlowControlPoller", "Shared polling service for slow-control readings (SCPI queries and RegisterDriver registers).");
+
+    py::class_<SlowControlPoller::Statistics>(poller, "Statistics", "Snapshot of the poller counters.")
+            .def_readonly("batches", &SlowControlPoller::Statistics::batches, "Number of batched driver reads.")
+            .def_readonly("itemReads", &SlowControlPoller::Statistics::itemReads, "Number of item values read by all batches.")
+            .def_readonly("deliveries", &SlowControlPoller::Statistics::deliveries, "Number of values passed to subscriber callbacks.")
+            .def_readonly("failures", &SlowControlPoller::Statistics::failures,
+                          "Number of failed batched reads plus number of throwing callbacks and sinks.");
+
+    py::class_<SlowControlPoller::Sample, std::shared_ptr<SlowControlPoller::Sample>>(poller, "Sample",
+                                                                                     "Immutable published value of an item.")
+            .def_readonly("value", &SlowControlPoller::Sample::value, "Polled value.")
+            .def_readonly("time", &SlowControlPoller::Sample::time, "Time when the value was read.")
+            .def_readonly("sequence", &SlowControlPoller::Sample::sequence,
+                          "Number of the item's update (starts at one; changes with every new value).");
+
+    poller
+            .def(py::init<>([](const std::chrono::milliseconds pTick)
+                            {
+                                return std::unique_ptr<SlowControlPoller, SlowControlPollerDeleter>(new SlowControlPoller(pTick));
+                            }),
+                 "Constructor.", py::arg("tick") = std::chrono::milliseconds(100))
+            .def("subscribe", [](SlowControlPoller& pThis, const casil::HL::SCPI& pSCPI, const std::string& pCmd,
+                                 const std::optional<int> pChannel, const std::chrono::milliseconds pPeriod,
+                                 py::function pCallback) -> SlowControlPoller::SubscriptionId
+                              {
+                                  return pThis.subscribe(pSCPI, pCmd, pChannel, pPeriod, ::makePythonCallback(std::move(pCallback)));
+                              },
+                 "Subscribe to periodic readings of an SCPI query command.", py::arg("scpi"), py::arg("cmd"), py::arg("channel"),
+                 py::arg("period"), py::arg("callback"), py::keep_alive<1, 2>())
+            .def("subscribe", [](SlowControlPoller& pThis, const casil::HL::RegisterDriver& pDriver, const std::string& pRegName,
+                                 const std::chrono::milliseconds pPeriod, py::function pCallback) -> SlowControlPoller::SubscriptionId
+                              {
+                                  return pThis.subscribe(pDriver, pRegName, pPeriod, ::makePythonCallback(std::move(pCallback)));
+                              },
+                 "Subscribe to periodic readings of a register.", py::arg("driver"), py::arg("regName"), py::arg("period"),
+                 py::arg("callback"), py::keep_alive<1, 2>())
+            .def("unsubscribe", &SlowControlPoller::unsubscribe, "Remove a subscription.", py::arg("id"),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("addSink", [](SlowControlPoller& pThis, py::function pSink) -> SlowControlPoller::SinkId
+                            {
+                                return pThis.addSink(::makePythonSink(std::move(pSink)));
+                            },
+                 "Add a sink for all new item values (called with a list of (path, sample) tuples).", py::arg("sink"))
+            .def("removeSink", &SlowControlPoller::removeSink, "Remove a sink.", py::arg("id"), py::call_guard<py::gil_scoped_release>())
+            .def("getCachedValue", &SlowControlPoller::getCachedValue, "Get the last polled value of a subscription's item.", py::arg("id"))
+            .def("getLatest", [](const SlowControlPoller& pThis, const std::string& pPath) -> std::shared_ptr<SlowControlPoller::Sample>
+                              {
+                                  return std::const_pointer_cast<SlowControlPoller::Sample>(pThis.getLatest(pPath));
+                              },
+                 "Get the latest published value of an item without locking.", py::arg("path"))
+            .def("getPaths", &SlowControlPoller::getPaths, "Get the paths of all polled items.")
+            .def("getItemCount", &SlowControlPoller::getItemCount, "Get the number of distinct polled items.")
+            .def("getStatistics", &SlowControlPoller::getStatistics, "Get the current counters.")
+            .def("getTick", &SlowControlPoller::getTick, "Get the tick to which all periods are aligned.");
+}
@@ -0,0 +1,53 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/timing.h>
+
+using casil::Timing;
+
+void bind_Timing(py::module& pM)
+{
+    py::class_<Timing> timing(pM, "Timing", "Scoped timing of layer component operations in latency histograms.");
+
+    py::native_enum<Timing::Operation>(timing, "Operation", "enum.Enum", "Timed layer component operation.")
+            .value("Init", Timing::Operation::Init, "Component initialization.")
+            .value("Close", Timing::Operation::Close, "Component closing.")
+            .value("ApplyDefaults", Timing::Operation::ApplyDefaults, "Writing the configured default register values.")
+            .value("Read", Timing::Operation::Read, "Interface read.")
+            .value("Write", Timing::Operation::Write, "Interface write or register write.")
+            .value("Query", Timing::Operation::Query, "Interface query.")
+            .finalize();
+
+    py::class_<Timing::Summary>(timing, "Summary", "Summary of the timings of one operation.")
+            .def_readonly("count", &Timing::Summary::count, "Number of timed operations.")
+            .def_readonly("totalSeconds", &Timing::Summary::totalSeconds, "Total duration of all timed operations in seconds.")
+            .def_readonly("bucketCounts", &Timing::Summary::bucketCounts, "Non-cumulative histogram bucket counts.");
+
+    timing.def_static("enable", &Timing::enable, "Enable timing of operations.")
+            .def_static("disable", &Timing::disable, "Disable timing of operations.")
+            .def_static("isEnabled", &Timing::isEnabled, "Check if timing is enabled.")
+            .def_static("getBucketUpperBounds", &Timing::getBucketUpperBounds, "Get the histogram bucket upper bounds.")
+            .def_static("operationToLabel", &Timing::operationToLabel, "Get the label for an operation.", py::arg("operation"));
+}
@@ -0,0 +1,68 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <pycasil/pycasil.h>
+
+#include <casil/tracer.h>
+
+using casil::Tracer;
+
+void bind_Tracer(py::module& pM)
+{
+    py::class_<Tracer> tracer(pM, "Tracer", "Record bus transactions into a low-overhead binary trace.");
+
+    py::native_enum<Tracer::Event>(tracer, "Event", "enum.Enum", "Type of a traced transaction.")
+            .value("Read", Tracer::Event::Read, "Interface read.")
+            .value("Write", Tracer::Event::Write, "Interface write.")
+            .value("Query", Tracer::Event::Query, "Interface query (write followed by read).")
+            .value("RBCPRead", Tracer::Event::RBCPRead, "Single SiTCP RBCP read transaction.")
+            .value("RBCPWrite", Tracer::Event::RBCPWrite, "Single SiTCP RBCP write transaction.")
+            .value("RegisterRead", Tracer::Event::RegisterRead, "Register driver read of a register address.")
+            .value("RegisterWrite", Tracer::Event::RegisterWrite, "Register driver write to a register address.")
+            .finalize();
+
+    py::class_<Tracer::Record>(tracer, "Record", "Fixed-size trace record of a single transaction.")
+            .def_readonly("timestamp", &Tracer::Record::timestamp, "Start time in nanoseconds.")
+            .def_readonly("duration", &Tracer::Record::duration, "Duration in nanoseconds.")
+            .def_readonly("address", &Tracer::Record::address, "Bus/register address (zero for direct interfaces).")
+            .def_readonly("size", &Tracer::Record::size, "Number of transferred bytes (requested bytes for reads).")
+            .def_readonly("source", &Tracer::Record::source, "Source ID of the recording component.")
+            .def_readonly("thread", &Tracer::Record::thread, "Index of the recording thread.")
+            .def_readonly("event", &Tracer::Record::event, "Transaction type.")
+            .def_readonly("retries", &Tracer::Record::retries, "Number of retries needed for the transaction.")
+            .def_readonly("transactionId", &Tracer::Record::transactionId, "Protocol-specific transaction ID.")
+            .def_property_readonly("failed", [](const Tracer::Record& pRecord) -> bool { return pRecord.failed != 0; },
+                                   "Transaction failed.");
+
+    tracer.def_static("enable", &Tracer::enable, "Enable recording of transactions.", py::arg("recordsPerThread") = 65536)
+            .def_static("disable", &Tracer::disable, "Disable recording of transactions.")
+            .def_static("isEnabled", &Tracer::isEnabled, "Check if recording is enabled.")
+            .def_static("registerSource", &Tracer::registerSource, "Register a trace source name.", py::arg("name"))
+            .def_static("getSourceName", &Tracer::getSourceName, "Get the name of a trace source.", py::arg("source"))
+            .def_static("collect", &Tracer::collect, "Get all stored records of all threads.")
+            .def_static("clear", &Tracer::clear, "Discard all stored records.")
+            .def_static("dump", &Tracer::dump, "Write all stored records to a binary trace file.", py::arg("fileName"))
+            .def_static("convertToChromeTrace", &Tracer::convertToChromeTrace, "Convert a binary trace file to Chrome's JSON format.",
+                        py::arg("traceFileName"), py::arg("jsonFileName"))
+            .def_static("eventToLabel", &Tracer::eventToLabel, "Get the label for an event type.", py::arg("event"));
+}
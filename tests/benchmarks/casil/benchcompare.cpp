@@ -0,0 +1,318 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using boost::property_tree::ptree;
+
+//Compare two benchmark result files in the common JSON format (see BenchmarkReport; Google Benchmark files work too)
+//and flag performance regressions:
+// - Run "CasilBenchCompare <baseline.json> <contender.json>" to list all metrics that changed by more than 10%
+// - Add "--threshold <percent>" to use a different relative threshold
+// - Add "--all" to list all compared metrics
+// - Add "--ignore <metric>" (repeatable) to skip noisy metrics such as "max_us"
+//Metrics ending with "_per_second" are rates (higher is better), all other numeric metrics (times, latencies, counts)
+//are costs (lower is better). Exits with status 1 if any metric regressed beyond the threshold and 2 on errors.
+
+namespace
+{
+
+/*
+ * Benchmark entry fields that are not compared.
+ */
+bool isIgnoredField(const std::string_view pField)
+{
+    return pField == "name" || pField == "run_name" || pField == "run_type" || pField == "time_unit" ||
+           pField == "iterations" || pField == "repetitions" || pField == "repetition_index" || pField == "threads" ||
+           pField == "family_index" || pField == "per_family_instance_index" || pField == "aggregate_name";
+}
+
+/*
+ * Returns the factor to convert times in unit 'pTimeUnit' to nanoseconds.
+ */
+double toNanosecondsFactor(const std::string& pTimeUnit)
+{
+    if (pTimeUnit == "ns")
+        return 1;
+    else if (pTimeUnit == "us")
+        return 1e3;
+    else if (pTimeUnit == "ms")
+        return 1e6;
+    else if (pTimeUnit == "s")
+        return 1e9;
+    else
+        throw std::runtime_error("Unknown time unit \"" + pTimeUnit + "\".");
+}
+
+/*
+ * Result file contents: context and all (non-aggregate) benchmark entries by name, keeping the file order of the names.
+ */
+struct ResultFile
+{
+    ptree context;
+    std::vector<std::string> names;
+    std::map<std::string, std::map<std::string, double>> metrics;
+};
+
+/*
+ * Reads the result file 'pFileName' and extracts all numeric metrics of each benchmark (with times in nanoseconds).
+ */
+ResultFile readResultFile(const std::string& pFileName)
+{
+    ptree tree;
+
+    try
+    {
+        boost::property_tree::read_json(pFileName, tree);
+    }
+    catch (const boost::property_tree::json_parser_error& exc)
+    {
+        throw std::runtime_error("Could not read result file \"" + pFileName + "\": " + exc.what());
+    }
+
+    ResultFile file;
+
+    file.context = tree.get_child("context", ptree());
+
+    for (const auto& [key, entry] : tree.get_child("benchmarks", ptree()))
+    {
+        (void)key;
+
+        if (entry.get<std::string>("run_type", "iteration") == "aggregate")
+            continue;
+
+        const std::string name = entry.get<std::string>("name", "");
+
+        if (name.empty() || file.metrics.contains(name))
+            throw std::runtime_error("Missing or duplicate benchmark name in result file \"" + pFileName + "\".");
+
+        const double timeFactor = toNanosecondsFactor(entry.get<std::string>("time_unit", "ns"));
+
+        std::map<std::string, double>& metrics = file.metrics[name];
+
+        for (const auto& [field, value] : entry)
+        {
+            if (isIgnoredField(field) || !value.empty())
+                continue;
+
+            const auto number = value.get_value_optional<double>();
+
+            if (!number || !std::isfinite(number.value()))
+                continue;
+
+            metrics[field] = (field == "real_time" || field == "cpu_time") ? (number.value() * timeFactor) : number.value();
+        }
+
+        file.names.push_back(name);
+    }
+
+    return file;
+}
+
+/*
+ * Prints the context values 'pKey' of both files if they differ and returns true if they do.
+ */
+bool printContextChange(const ResultFile& pBaseline, const ResultFile& pContender, const std::string& pKey)
+{
+    const std::string baseline = pBaseline.context.get<std::string>(pKey, "-");
+    const std::string contender = pContender.context.get<std::string>(pKey, "-");
+
+    std::cout << "  " << std::left << std::setw(22) << pKey << baseline;
+
+    if (baseline != contender)
+        std::cout << "  ->  " << contender;
+
+    std::cout << std::endl;
+
+    return baseline != contender;
+}
+
+/*
+ * Parses the threshold command line argument 'pArg' (in percent).
+ */
+double parseThreshold(const std::string_view pArg)
+{
+    double value = 0;
+
+    const auto [ptr, ec] = std::from_chars(pArg.data(), pArg.data() + pArg.size(), value);
+
+    if (ec != std::errc() || ptr != pArg.data() + pArg.size() || !(value >= 0))
+        throw std::invalid_argument("Invalid threshold \"" + std::string(pArg) + "\".");
+
+    return value;
+}
+
+} // namespace
+
+int main(int argc, const char** argv)
+{
+    std::vector<std::string> fileNames;
+    double thresholdPercent = 10;
+    bool listAll = false;
+    std::set<std::string> ignoredMetrics;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+
+            if (arg == "--threshold" && i + 1 < argc)
+                thresholdPercent = parseThreshold(argv[++i]);
+            else if (arg == "--all")
+                listAll = true;
+            else if (arg == "--ignore" && i + 1 < argc)
+                ignoredMetrics.insert(argv[++i]);
+            else if (!arg.starts_with("--") && fileNames.size() < 2)
+                fileNames.emplace_back(arg);
+            else
+            {
+                fileNames.clear();
+                break;
+            }
+        }
+
+        if (fileNames.size() != 2)
+        {
+            std::cerr << "Usage: " << argv[0] << " <baseline.json> <contender.json> [--threshold <percent>] [--all] "
+                                                 "[--ignore <metric>]..." << std::endl;
+            return 2;
+        }
+
+        const ResultFile baseline = readResultFile(fileNames[0]);
+        const ResultFile contender = readResultFile(fileNames[1]);
+
+        std::cout << "Context (baseline -> contender):" << std::endl;
+
+        printContextChange(baseline, contender, "casil_version");
+        printContextChange(baseline, contender, "casil_commit");
+
+        bool environmentChanged = false;
+
+        for (const std::string key : {"host_name", "cpu_model", "os", "compiler", "library_build_type", "simd_kernel_target", "quick"})
+            environmentChanged |= printContextChange(baseline, contender, key);
+
+        if (environmentChanged)
+            std::cout << "WARNING: Results were obtained in different environments and may not be comparable." << std::endl;
+
+        std::cout << std::endl << std::left << std::setw(44) << "Benchmark" << std::setw(22) << "Metric" << std::right
+                  << std::setw(16) << "Baseline" << std::setw(16) << "Contender" << std::setw(10) << "Change"
+                  << "  Status" << std::endl;
+
+        const double threshold = thresholdPercent / 100;
+
+        std::size_t numCompared = 0;
+        std::size_t numRegressions = 0;
+        std::size_t numImprovements = 0;
+        std::size_t numMissing = 0;
+
+        for (const std::string& name : baseline.names)
+        {
+            const auto contenderIt = contender.metrics.find(name);
+
+            if (contenderIt == contender.metrics.end())
+            {
+                std::cout << std::left << std::setw(44) << name << std::setw(22) << "-" << std::right << std::setw(42) << ""
+                          << "  MISSING" << std::endl;
+                ++numMissing;
+                continue;
+            }
+
+            ++numCompared;
+
+            for (const auto& [metric, baselineValue] : baseline.metrics.at(name))
+            {
+                const auto valueIt = contenderIt->second.find(metric);
+
+                if (valueIt == contenderIt->second.end() || ignoredMetrics.contains(metric))
+                    continue;
+
+                const double contenderValue = valueIt->second;
+                const bool higherIsBetter = metric.ends_with("_per_second");
+
+                //Relative deterioration (negative for improvements); a cost that rises from zero always counts as regression
+                double deterioration = 0;
+
+                if (baselineValue != 0)
+                    deterioration = (contenderValue - baselineValue) / std::abs(baselineValue) * (higherIsBetter ? -1 : 1);
+                else if (contenderValue != 0)
+                    deterioration = (higherIsBetter ? -1 : 1) * HUGE_VAL;
+
+                const bool regressed = deterioration > threshold;
+                const bool improved = deterioration < -threshold;
+
+                if (regressed)
+                    ++numRegressions;
+                else if (improved)
+                    ++numImprovements;
+
+                if (!regressed && !improved && !listAll)
+                    continue;
+
+                std::cout << std::left << std::setw(44) << name << std::setw(22) << metric << std::right << std::fixed
+                          << std::setprecision(2) << std::setw(16) << baselineValue << std::setw(16) << contenderValue;
+
+                if (baselineValue != 0)
+                    std::cout << std::showpos << std::setw(9) << (contenderValue - baselineValue) / std::abs(baselineValue) * 100
+                              << std::noshowpos << "%";
+                else
+                    std::cout << std::setw(10) << "-";
+
+                std::cout << (regressed ? "  REGRESSION" : (improved ? "  improved" : "")) << std::endl;
+            }
+        }
+
+        std::size_t numNew = 0;
+
+        for (const std::string& name : contender.names)
+        {
+            if (!baseline.metrics.contains(name))
+                ++numNew;
+        }
+
+        std::cout << std::endl << "Compared " << numCompared << " benchmarks (threshold " << std::defaultfloat << thresholdPercent
+                  << "%): " << numRegressions << " regressions, " << numImprovements << " improvements, "
+                  << numMissing << " missing, " << numNew << " new." << std::endl;
+
+        return (numRegressions > 0) ? 1 : 0;
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << "Comparison failed: " << exc.what() << std::endl;
+        return 2;
+    }
+}
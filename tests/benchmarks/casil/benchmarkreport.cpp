@@ -0,0 +1,292 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "benchmarkreport.h"
+
+#include <casil/bytes.h>
+#include <casil/version.h>
+
+#include <boost/asio/ip/host_name.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/utsname.h>
+#endif
+
+#define CASILBENCHMARKS_XSTR(S) CASILBENCHMARKS_STR(S)
+#define CASILBENCHMARKS_STR(S) #S
+
+namespace
+{
+
+/*
+ * Returns the Git commit of the sources as determined when configuring the build ("unknown" if not available).
+ */
+std::string getCommit()
+{
+#ifdef CASIL_GIT_COMMIT
+    return CASILBENCHMARKS_XSTR(CASIL_GIT_COMMIT);
+#else
+    return "unknown";
+#endif
+}
+
+/*
+ * Returns the operating system name and release.
+ */
+std::string getOperatingSystem()
+{
+#ifdef _WIN32
+    return "Windows";
+#else
+    utsname info {};
+    if (uname(&info) != 0)
+        return "unknown";
+    return std::string(info.sysname) + " " + info.release + " (" + info.machine + ")";
+#endif
+}
+
+std::string getCompiler()
+{
+#if defined(__clang__)
+    return "Clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "GCC " __VERSION__;
+#elif defined(_MSC_VER)
+    return "MSVC " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+/*
+ * Returns the CPU model name from /proc/cpuinfo (Linux only, "unknown" otherwise).
+ */
+std::string getCPUModel()
+{
+    std::ifstream cpuInfo("/proc/cpuinfo");
+    std::string line;
+
+    while (std::getline(cpuInfo, line))
+    {
+        if (line.starts_with("model name") && line.find(':') != std::string::npos)
+            return line.substr(std::min(line.find(':') + 2, line.size()));
+    }
+
+    return "unknown";
+}
+
+/*
+ * Returns the performance relevant instruction set extensions supported by the CPU (only detected on x86 with GCC/Clang).
+ */
+std::vector<std::string> getCPUFeatures()
+{
+    std::vector<std::string> features;
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("sse2"))
+        features.emplace_back("sse2");
+    if (__builtin_cpu_supports("sse4.2"))
+        features.emplace_back("sse4.2");
+    if (__builtin_cpu_supports("popcnt"))
+        features.emplace_back("popcnt");
+    if (__builtin_cpu_supports("avx"))
+        features.emplace_back("avx");
+    if (__builtin_cpu_supports("avx2"))
+        features.emplace_back("avx2");
+    if (__builtin_cpu_supports("bmi2"))
+        features.emplace_back("bmi2");
+    if (__builtin_cpu_supports("avx512f"))
+        features.emplace_back("avx512f");
+    if (__builtin_cpu_supports("avx512bw"))
+        features.emplace_back("avx512bw");
+#endif
+
+    return features;
+}
+
+} // namespace
+
+/*
+ * Creates an empty report for the run of benchmark executable 'pExecutable' in quick mode or not ('pQuick').
+ */
+BenchmarkReport::BenchmarkReport(std::string pExecutable, const bool pQuick) :
+    executable(std::move(pExecutable)),
+    quick(pQuick),
+    results()
+{
+}
+
+//Public
+
+/*
+ * Adds 'pResult' and returns a reference to the stored result (valid until the next call), e.g. to add further counters.
+ */
+BenchmarkReport::Result& BenchmarkReport::add(Result pResult)
+{
+    results.push_back(std::move(pResult));
+    return results.back();
+}
+
+const std::vector<BenchmarkReport::Result>& BenchmarkReport::getResults() const
+{
+    return results;
+}
+
+//
+
+/*
+ * Writes the report to file 'pFileName' (see BenchmarkReport for the format).
+ */
+void BenchmarkReport::writeJSON(const std::string& pFileName) const
+{
+    std::ofstream file(pFileName);
+
+    if (!file.is_open())
+        throw std::runtime_error("Could not open JSON output file \"" + pFileName + "\".");
+
+    std::array<char, 32> dateBuf {};
+    const std::time_t now = std::time(nullptr);
+    std::strftime(dateBuf.data(), dateBuf.size(), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+#ifdef NDEBUG
+    constexpr std::string_view buildType = "release";
+#else
+    constexpr std::string_view buildType = "debug";
+#endif
+
+    boost::system::error_code ec;
+    const std::string hostName = boost::asio::ip::host_name(ec);
+
+    std::string cpuFeatures;
+    for (const std::string& feature : getCPUFeatures())
+        cpuFeatures += (cpuFeatures.empty() ? "\"" : ", \"") + feature + "\"";
+
+    file << "{\n"
+         << "  \"context\": {\n"
+         << "    \"date\": \"" << dateBuf.data() << "\",\n"
+         << "    \"host_name\": \"" << jsonEscape(ec ? "unknown" : hostName) << "\",\n"
+         << "    \"executable\": \"" << jsonEscape(executable) << "\",\n"
+         << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+         << "    \"cpu_model\": \"" << jsonEscape(getCPUModel()) << "\",\n"
+         << "    \"cpu_features\": [" << cpuFeatures << "],\n"
+         << "    \"os\": \"" << jsonEscape(getOperatingSystem()) << "\",\n"
+         << "    \"compiler\": \"" << jsonEscape(getCompiler()) << "\",\n"
+         << "    \"library_build_type\": \"" << buildType << "\",\n"
+         << "    \"casil_version\": \"" << jsonEscape(casil::Version::toString()) << "\",\n"
+         << "    \"casil_commit\": \"" << jsonEscape(getCommit()) << "\",\n"
+         << "    \"simd_kernel_target\": \"" << casil::Bytes::simdKernelTarget() << "\",\n"
+         << "    \"quick\": " << (quick ? "true" : "false") << "\n"
+         << "  },\n"
+         << "  \"benchmarks\": [";
+
+    file << std::setprecision(6) << std::fixed;
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& result = results[i];
+
+        file << (i == 0 ? "\n" : ",\n")
+             << "    {\n"
+             << "      \"name\": \"" << jsonEscape(result.name) << "\",\n"
+             << "      \"run_name\": \"" << jsonEscape(result.name) << "\",\n"
+             << "      \"run_type\": \"iteration\",\n"
+             << "      \"iterations\": " << result.iterations << ",\n"
+             << "      \"real_time\": " << result.realTimeNs << ",\n"
+             << "      \"cpu_time\": " << (result.cpuTimeNs != 0 ? result.cpuTimeNs : result.realTimeNs) << ",\n"
+             << "      \"time_unit\": \"ns\"";
+
+        for (const auto& [counterName, value] : result.counters)
+            file << ",\n      \"" << jsonEscape(counterName) << "\": " << (std::isfinite(value) ? value : 0.);
+
+        file << "\n    }";
+    }
+
+    file << "\n  ]\n}\n";
+
+    if (!file.good())
+        throw std::runtime_error("Could not write JSON output file \"" + pFileName + "\".");
+}
+
+//
+
+/*
+ * Adds the counters "p50_us", "p99_us", "p999_us" and "max_us" for the latencies 'pLatenciesUs' (in microseconds) to 'pResult'.
+ */
+void BenchmarkReport::addLatencyCounters(Result& pResult, std::vector<double> pLatenciesUs)
+{
+    if (pLatenciesUs.empty())
+        return;
+
+    std::sort(pLatenciesUs.begin(), pLatenciesUs.end());
+
+    pResult.counters.emplace_back("p50_us", percentile(pLatenciesUs, 0.5));
+    pResult.counters.emplace_back("p99_us", percentile(pLatenciesUs, 0.99));
+    pResult.counters.emplace_back("p999_us", percentile(pLatenciesUs, 0.999));
+    pResult.counters.emplace_back("max_us", pLatenciesUs.back());
+}
+
+/*
+ * Returns the 'pQuantile' (in [0, 1]) of the ascendingly sorted values 'pSortedValues' (nearest rank).
+ */
+double BenchmarkReport::percentile(const std::vector<double>& pSortedValues, const double pQuantile)
+{
+    if (pSortedValues.empty())
+        return 0;
+
+    const std::size_t rank = static_cast<std::size_t>(std::ceil(pQuantile * static_cast<double>(pSortedValues.size())));
+
+    return pSortedValues[std::max<std::size_t>(rank, 1) - 1];
+}
+
+/*
+ * Escapes 'pStr' for use as JSON string value (control characters are replaced by spaces).
+ */
+std::string BenchmarkReport::jsonEscape(const std::string_view pStr)
+{
+    std::string escaped;
+    escaped.reserve(pStr.size());
+
+    for (const char c : pStr)
+    {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+
+        if (static_cast<unsigned char>(c) < 0x20u)
+            escaped += ' ';
+        else
+            escaped += c;
+    }
+
+    return escaped;
+}
@@ -0,0 +1,81 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASILBENCHMARKS_BENCHMARKREPORT_H
+#define CASILBENCHMARKS_BENCHMARKREPORT_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Common machine-readable result format of all benchmark executables.
+ *
+ * Collects the results of one benchmark executable run and writes them in the JSON format of Google Benchmark
+ * (a "context" object and a "benchmarks" array with one object per result), such that its tooling as well as
+ * \c CasilBenchCompare can be used. The context is extended by the Casil version and Git commit, host/OS/compiler
+ * information and the available CPU features; additional per-result statistics are written as numeric fields
+ * ("user counters") next to the standard fields.
+ *
+ * Counter naming convention (used by \c CasilBenchCompare to decide about regressions): counters ending with
+ * "_per_second" are rates (higher is better), all other counters (e.g. latencies "p99_us", "allocs_per_iter",
+ * error counts) are costs (lower is better).
+ */
+class BenchmarkReport
+{
+public:
+    /*!
+     * \brief Result of a single benchmark.
+     */
+    struct Result
+    {
+        std::string name;                                       ///< Benchmark name (unique within the executable).
+        std::size_t iterations = 0;                             ///< Number of measured iterations/transactions.
+        double realTimeNs = 0;                                  ///< Mean wall-clock time per iteration in nanoseconds.
+        double cpuTimeNs = 0;                                   ///< Mean CPU time per iteration in nanoseconds (zero: same as real time).
+        std::vector<std::pair<std::string, double>> counters;   ///< Additional statistics (see naming convention above).
+    };
+
+public:
+    BenchmarkReport(std::string pExecutable, bool pQuick);  ///< Constructor.
+    //
+    Result& add(Result pResult);                            ///< Add a benchmark result.
+    const std::vector<Result>& getResults() const;          ///< Get all added results.
+    //
+    void writeJSON(const std::string& pFileName) const;     ///< Write the report to a JSON file.
+    //
+    static void addLatencyCounters(Result& pResult, std::vector<double> pLatenciesUs);
+                                                            ///< Add latency percentile counters to a result.
+    static double percentile(const std::vector<double>& pSortedValues, double pQuantile);
+                                                            ///< Get a quantile of sorted values (nearest rank).
+    static std::string jsonEscape(std::string_view pStr);   ///< Escape a string for use as JSON string value.
+
+private:
+    const std::string executable;
+    const bool quick;
+    std::vector<Result> results;
+};
+
+#endif // CASILBENCHMARKS_BENCHMARKREPORT_H
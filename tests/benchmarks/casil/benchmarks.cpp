@@ -0,0 +1,397 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "benchmarkreport.h"
+#include "mocksitcpserver.h"
+
+#include <casil/allocations.h>
+#include <casil/auxil.h>
+#include <casil/device.h>
+#include <casil/logger.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using casil::Allocations;
+using casil::Device;
+using casil::Logger;
+using casil::TL::SiTCP;
+
+namespace Auxil = casil::Auxil;
+
+//Measure SiTCP end to end against an in-process mock SiTCP endpoint (see MockSiTCPServer):
+// - Run "CasilBenchmarks" for the full benchmark set
+// - Run "CasilBenchmarks --quick" for a short smoke run with reduced iteration counts
+// - Add "--json <file>" to additionally write the results in the common JSON format (see BenchmarkReport)
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t mockMemSize = 1 << 20;
+constexpr std::size_t bulkSize = 65536;
+constexpr std::size_t tcpToBusMaxSize = 0xFFF9u;  //Maximum data length of a "tcp_to_bus" message
+constexpr std::uint64_t fifoDrainAllocationBudget = 0;  //Total allowed heap allocations of SiTCP::consumeFifo() calls
+
+double toMicroseconds(const Clock::duration pDuration)
+{
+    return std::chrono::duration<double, std::micro>(pDuration).count();
+}
+
+double toSeconds(const Clock::duration pDuration)
+{
+    return std::chrono::duration<double>(pDuration).count();
+}
+
+void printHeader()
+{
+    std::cout << std::left << std::setw(34) << "Benchmark" << std::right << std::setw(14) << "Rate"
+              << std::setw(10) << "Unit" << std::setw(12) << "p50 [us]" << std::setw(12) << "p99 [us]" << std::endl;
+}
+
+/*
+ * Prints a line for benchmark 'pName' with value 'pValue' in unit 'pUnit' and (if given) the 'pLatencies' percentiles.
+ */
+void printLine(const std::string_view pName, const double pValue, const std::string_view pUnit, std::vector<double> pLatencies = {})
+{
+    std::cout << std::left << std::setw(34) << pName << std::right << std::fixed << std::setprecision(1)
+              << std::setw(14) << pValue << std::setw(10) << pUnit;
+
+    if (!pLatencies.empty())
+    {
+        std::sort(pLatencies.begin(), pLatencies.end());
+
+        std::cout << std::setw(12) << BenchmarkReport::percentile(pLatencies, 0.5)
+                  << std::setw(12) << BenchmarkReport::percentile(pLatencies, 0.99);
+    }
+
+    std::cout << std::endl;
+}
+
+/*
+ * Prints and adds to 'pReport' the result of benchmark 'pName', which took 'pSeconds' for 'pIterations' transactions
+ * of 'pBytesPerIteration' bytes each (rate in MB/s) or of single transactions (rate in trans/s, if 'pBytesPerIteration'
+ * is zero), with optional per-iteration latencies 'pLatencies' in microseconds. Returns the added result.
+ */
+BenchmarkReport::Result& printResult(BenchmarkReport& pReport, const std::string& pName, const std::size_t pIterations,
+                                     const double pSeconds, const std::size_t pBytesPerIteration,
+                                     const std::vector<double>& pLatencies = {})
+{
+    const double iterationsPerSecond = static_cast<double>(pIterations) / pSeconds;
+
+    BenchmarkReport::Result result {pName, pIterations, 1e9 * pSeconds / static_cast<double>(pIterations), 0, {}};
+
+    if (pBytesPerIteration == 0)
+    {
+        printLine(pName, iterationsPerSecond, "trans/s", pLatencies);
+        result.counters.emplace_back("items_per_second", iterationsPerSecond);
+    }
+    else
+    {
+        const double bytesPerSecond = iterationsPerSecond * static_cast<double>(pBytesPerIteration);
+
+        printLine(pName, bytesPerSecond / 1e6, "MB/s", pLatencies);
+        result.counters.emplace_back("bytes_per_second", bytesPerSecond);
+    }
+
+    BenchmarkReport::addLatencyCounters(result, pLatencies);
+
+    return pReport.add(std::move(result));
+}
+
+/*
+ * Starts a fresh mock endpoint, connects a SiTCP interface with additional init options 'pInitOptions' to it
+ * and runs 'pBenchmark' on the initialized interface.
+ */
+void runWithInterface(const std::string& pInitOptions, const std::function<void(SiTCP&, MockSiTCPServer&)>& pBenchmark)
+{
+    MockSiTCPServer server(mockMemSize);
+    server.start();
+
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: " + std::to_string(server.getUdpPort()) +
+                                       ", tcp_port: " + std::to_string(server.getTcpPort()) + pInitOptions + "}}],"
+              "hw_drivers: [], registers: []}");
+
+    Auxil::AsyncIORunner<2> ioRunner;
+    (void)ioRunner;
+
+    if (!d.init())
+        throw std::runtime_error("Could not initialize SiTCP interface.");
+
+    pBenchmark(dynamic_cast<SiTCP&>(d.interface("intf")), server);
+
+    if (!d.close())
+        throw std::runtime_error("Could not close SiTCP interface.");
+}
+
+/*
+ * Measures single-transaction RBCP reads and writes of 4 bytes.
+ */
+void benchRBCPTransactions(BenchmarkReport& pReport, const std::size_t pIterations)
+{
+    runWithInterface("", [&pReport, pIterations](SiTCP& pIntf, MockSiTCPServer&)
+    {
+        std::vector<double> latencies;
+        latencies.reserve(pIterations);
+
+        const std::vector<std::uint8_t> data = {0x01u, 0x02, 0x03, 0x04};
+
+        auto start = Clock::now();
+
+        for (std::size_t i = 0; i < pIterations; ++i)
+        {
+            const auto t0 = Clock::now();
+            pIntf.write(4 * (i % 1024), data);
+            latencies.push_back(toMicroseconds(Clock::now() - t0));
+        }
+
+        printResult(pReport, "RBCP write (4 B)", pIterations, toSeconds(Clock::now() - start), 0, latencies);
+
+        latencies.clear();
+
+        start = Clock::now();
+
+        for (std::size_t i = 0; i < pIterations; ++i)
+        {
+            const auto t0 = Clock::now();
+            if (pIntf.read(4 * (i % 1024), 4) != data)
+                throw std::runtime_error("RBCP read returned wrong data.");
+            latencies.push_back(toMicroseconds(Clock::now() - t0));
+        }
+
+        printResult(pReport, "RBCP read (4 B)", pIterations, toSeconds(Clock::now() - start), 0, latencies);
+    });
+}
+
+/*
+ * Measures bulk RBCP reads and writes of 'bulkSize' bytes with an RBCP window size of 'pWindow'.
+ */
+void benchRBCPBulk(BenchmarkReport& pReport, const std::size_t pIterations, const int pWindow)
+{
+    runWithInterface(", rbcp_window: " + std::to_string(pWindow), [&pReport, pIterations, pWindow](SiTCP& pIntf, MockSiTCPServer&)
+    {
+        std::vector<std::uint8_t> data(bulkSize);
+        std::iota(data.begin(), data.end(), 0);
+
+        std::vector<double> latencies;
+        latencies.reserve(pIterations);
+
+        const std::string suffix = " (64 KiB, window " + std::to_string(pWindow) + ")";
+
+        auto start = Clock::now();
+
+        for (std::size_t i = 0; i < pIterations; ++i)
+        {
+            const auto t0 = Clock::now();
+            pIntf.write(0, data);
+            latencies.push_back(toMicroseconds(Clock::now() - t0));
+        }
+
+        printResult(pReport, "RBCP bulk write" + suffix, pIterations, toSeconds(Clock::now() - start), bulkSize, latencies);
+
+        latencies.clear();
+
+        start = Clock::now();
+
+        for (std::size_t i = 0; i < pIterations; ++i)
+        {
+            const auto t0 = Clock::now();
+            if (pIntf.read(0, bulkSize) != data)
+                throw std::runtime_error("RBCP bulk read returned wrong data.");
+            latencies.push_back(toMicroseconds(Clock::now() - t0));
+        }
+
+        printResult(pReport, "RBCP bulk read" + suffix, pIterations, toSeconds(Clock::now() - start), bulkSize, latencies);
+    });
+}
+
+/*
+ * Measures bulk writes via "tcp_to_bus" messages of maximum length until all data has arrived at the mock endpoint.
+ */
+void benchTcpToBus(BenchmarkReport& pReport, const std::size_t pIterations)
+{
+    runWithInterface(", tcp_connection: true, tcp_to_bus: true", [&pReport, pIterations](SiTCP& pIntf, MockSiTCPServer& pServer)
+    {
+        const std::vector<std::uint8_t> data(tcpToBusMaxSize, 0xA5u);
+
+        std::vector<double> latencies;
+        latencies.reserve(pIterations);
+
+        const auto start = Clock::now();
+
+        for (std::size_t i = 0; i < pIterations; ++i)
+        {
+            const auto t0 = Clock::now();
+            pIntf.write(0, data);
+            latencies.push_back(toMicroseconds(Clock::now() - t0));
+        }
+
+        const std::size_t totalBytes = pIterations * data.size();
+
+        while (pServer.getTcpToBusBytesWritten() < totalBytes)
+            std::this_thread::yield();
+
+        printResult(pReport, "tcp_to_bus write (64 KiB)", pIterations, toSeconds(Clock::now() - start), data.size(), latencies);
+    });
+}
+
+/*
+ * Measures the sustained FIFO readout rate for 'pNumBytes' bytes streamed by the mock endpoint,
+ * consuming the data in place and checking the counter sequence.
+ */
+void benchFifo(BenchmarkReport& pReport, const std::size_t pNumBytes)
+{
+    runWithInterface(", tcp_connection: true", [&pReport, pNumBytes](SiTCP& pIntf, MockSiTCPServer& pServer)
+    {
+        const std::size_t numWords = pNumBytes / 4;
+
+        std::size_t wordsReceived = 0;
+        bool sequenceError = false;
+
+        auto consumer = [&wordsReceived, &sequenceError](const std::span<const std::uint32_t> pFirst,
+                                                         const std::span<const std::uint32_t> pSecond)
+        {
+            for (const std::span<const std::uint32_t> segment : {pFirst, pSecond})
+            {
+                if (!segment.empty() && (segment.front() != static_cast<std::uint32_t>(wordsReceived) ||
+                                         segment.back() != static_cast<std::uint32_t>(wordsReceived + segment.size() - 1)))
+                {
+                    sequenceError = true;
+                }
+
+                wordsReceived += segment.size();
+            }
+        };
+
+        const auto start = Clock::now();
+
+        pServer.streamFifo(numWords * 4);
+
+        std::size_t numDrains = 0;
+        Allocations::Counts drainAllocations {0, 0};
+
+        while (wordsReceived < numWords)
+        {
+            const Allocations::Scope allocations;
+
+            const std::size_t numConsumed = pIntf.consumeFifo(consumer);
+
+            const Allocations::Counts counts = allocations.getCounts();
+            drainAllocations.allocations += counts.allocations;
+            drainAllocations.bytes += counts.bytes;
+
+            if (numConsumed == 0)
+                std::this_thread::yield();
+            else
+                ++numDrains;
+        }
+
+        const double seconds = toSeconds(Clock::now() - start);
+
+        if (sequenceError)
+            throw std::runtime_error("FIFO data sequence is broken.");
+
+        BenchmarkReport::Result& result = printResult(pReport, "FIFO sustained readout", numWords, seconds, 4);
+
+        //Allocation budget of the FIFO drain (consumer side) when built with allocation counting
+        if (Allocations::isAvailable())
+        {
+            const double allocsPerDrain = static_cast<double>(drainAllocations.allocations) /
+                                          static_cast<double>(std::max<std::size_t>(numDrains, 1));
+
+            printLine("FIFO drain allocations", allocsPerDrain, "1/drain");
+            result.counters.emplace_back("allocs_per_drain", allocsPerDrain);
+
+            if (drainAllocations.allocations != fifoDrainAllocationBudget)
+                throw std::runtime_error("FIFO drain exceeded its allocation budget (" + std::to_string(drainAllocations.allocations) +
+                                         " allocations, " + std::to_string(drainAllocations.bytes) + " bytes).");
+        }
+    });
+}
+
+} // namespace
+
+int main(int argc, const char** argv)
+{
+    bool quick = false;
+    std::string jsonFileName;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+
+        if (arg == "--quick")
+            quick = true;
+        else if (arg == "--json" && i + 1 < argc)
+            jsonFileName = argv[++i];
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--quick] [--json <file>]" << std::endl;
+            return 2;
+        }
+    }
+
+    const std::size_t scale = quick ? 10 : 1;
+
+    Logger::setLogLevel(Logger::LogLevel::Warning);
+    Logger::addOutputCout();
+
+    try
+    {
+        BenchmarkReport report(argv[0], quick);
+
+        printHeader();
+
+        benchRBCPTransactions(report, 20000 / scale);
+        benchRBCPBulk(report, 200 / scale, 1);
+        benchRBCPBulk(report, 200 / scale, 16);
+        benchTcpToBus(report, 2000 / scale);
+        benchFifo(report, (std::size_t(1) << 30) / scale);
+
+        if (!jsonFileName.empty())
+            report.writeJSON(jsonFileName);
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << "Benchmark failed: " << exc.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "benchregdriver.h"
+
+#include <utility>
+
+using casil::HL::BenchRegDriver;
+
+CASIL_REGISTER_DRIVER_CPP(BenchRegDriver)
+
+//
+
+BenchRegDriver::BenchRegDriver(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig) :
+    RegisterDriver(typeName, std::move(pName), pInterface, pConfig, LayerConfig(),
+       {{"RESET",       {.type{DataType::Value}, .mode{AccessMode::WriteOnly}, .addr{0},  .size{8},  .offs{0}}},
+        {"VERSION",     {.type{DataType::Value}, .mode{AccessMode::ReadOnly},  .addr{0},  .size{8},  .offs{0}}},
+        //
+        {"ALIGNED_A",   {.type{DataType::Value}, .mode{AccessMode::ReadWrite}, .addr{1},  .size{8},  .offs{0}}},
+        {"ALIGNED_B",   {.type{DataType::Value}, .mode{AccessMode::ReadWrite}, .addr{2},  .size{16}, .offs{0}}},
+        {"UNALIGNED_A", {.type{DataType::Value}, .mode{AccessMode::ReadWrite}, .addr{4},  .size{11}, .offs{5}}},
+        {"ALIGNED_C",   {.type{DataType::Value}, .mode{AccessMode::ReadWrite}, .addr{6},  .size{32}, .offs{0}}},
+        {"UNALIGNED_B", {.type{DataType::Value}, .mode{AccessMode::ReadWrite}, .addr{10}, .size{58}, .offs{3}}},
+        {"UNALIGNED_C", {.type{DataType::Value}, .mode{AccessMode::ReadWrite}, .addr{18}, .size{63}, .offs{3}}},
+        {"ALIGNED_D",   {.type{DataType::Value}, .mode{AccessMode::ReadWrite}, .addr{27}, .size{64}, .offs{0}}}})
+{
+}
+
+//Private
+
+void BenchRegDriver::resetImpl()
+{
+    setValue("RESET", 0);
+}
+
+//
+
+std::uint8_t BenchRegDriver::getModuleSoftwareVersion() const
+{
+    return requireFirmwareVersion;
+}
+
+std::uint8_t BenchRegDriver::getModuleFirmwareVersion()
+{
+    return static_cast<std::uint8_t>(getValue("VERSION"));
+}
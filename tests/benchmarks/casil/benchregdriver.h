@@ -0,0 +1,71 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASILBENCHMARKS_BENCHREGDRIVER_H
+#define CASILBENCHMARKS_BENCHREGDRIVER_H
+
+#include <casil/HL/registerdriver.h>
+
+#include <casil/layerconfig.h>
+#include <casil/layerfactorymacros.h>
+
+#include <cstdint>
+#include <string>
+
+namespace casil
+{
+
+namespace Layers::HL
+{
+
+/*!
+ * \brief Register driver with value registers of various sizes and alignments for benchmarking.
+ *
+ * Defines byte-aligned registers of 8, 16, 32 and 64 bits ("ALIGNED_A" to "ALIGNED_D") as well as registers
+ * with bit offsets that span a partial leading and/or trailing byte ("UNALIGNED_A": 11 bits at offset 5,
+ * "UNALIGNED_B": 58 bits at offset 3, "UNALIGNED_C": 63 bits at offset 3).
+ * Requires 35 bytes of bus memory starting at "base_addr".
+ */
+class BenchRegDriver final : public RegisterDriver
+{
+public:
+    BenchRegDriver(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig);
+    ~BenchRegDriver() override = default;
+
+private:
+    void resetImpl() override;
+    //
+    std::uint8_t getModuleSoftwareVersion() const override;
+    std::uint8_t getModuleFirmwareVersion() override;
+
+private:
+    static constexpr std::uint8_t requireFirmwareVersion = 0;
+
+    CASIL_REGISTER_DRIVER_H("BenchRegDriver")
+};
+
+} // namespace HL
+
+} // namespace casil
+
+#endif // CASILBENCHMARKS_BENCHREGDRIVER_H
@@ -0,0 +1,95 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "memoryinterface.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+using casil::TL::BenchMemoryInterface;
+
+CASIL_REGISTER_INTERFACE_CPP(BenchMemoryInterface)
+
+//
+
+/*
+ * Creates a zero-initialized bus memory of "size" bytes from 'pConfig'.
+ */
+BenchMemoryInterface::BenchMemoryInterface(std::string pName, LayerConfig pConfig) :
+    MuxedInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig::fromYAML("{size: uint}")),
+    memory(config.getUInt("size", 0), 0)
+{
+    if (memory.empty())
+        throw std::runtime_error("Invalid memory size set for \"" + getSelfDescription() + "\".");
+}
+
+//Public
+
+std::vector<std::uint8_t> BenchMemoryInterface::read(const std::uint64_t pAddr, const int pSize)
+{
+    if (pSize <= 0)
+        throw std::invalid_argument("Read size should be positive.");
+
+    if (pAddr > memory.size() || static_cast<std::uint64_t>(pSize) > memory.size() - pAddr)
+        throw std::invalid_argument("Read range exceeds memory size.");
+
+    return std::vector<std::uint8_t>(memory.begin() + pAddr, memory.begin() + pAddr + pSize);
+}
+
+void BenchMemoryInterface::write(const std::uint64_t pAddr, const std::vector<std::uint8_t>& pData)
+{
+    if (pAddr > memory.size() || pData.size() > memory.size() - pAddr)
+        throw std::invalid_argument("Write range exceeds memory size.");
+
+    std::copy(pData.begin(), pData.end(), memory.begin() + pAddr);
+}
+
+std::vector<std::uint8_t> BenchMemoryInterface::query(std::uint64_t, std::uint64_t, const std::vector<std::uint8_t>&, int)
+{
+    return {};
+}
+
+//
+
+bool BenchMemoryInterface::readBufferEmpty() const
+{
+    return true;
+}
+
+void BenchMemoryInterface::clearReadBuffer()
+{
+}
+
+//Private
+
+bool BenchMemoryInterface::initImpl()
+{
+    return true;
+}
+
+bool BenchMemoryInterface::closeImpl()
+{
+    return true;
+}
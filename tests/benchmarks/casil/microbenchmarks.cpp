@@ -0,0 +1,406 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "benchmarkreport.h"
+
+#include <casil/allocations.h>
+#include <casil/bytes.h>
+#include <casil/device.h>
+#include <casil/layerconfig.h>
+#include <casil/logger.h>
+#include <casil/HL/registerdriver.h>
+#include <casil/RL/standardregister.h>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using casil::Allocations;
+using casil::Device;
+using casil::LayerConfig;
+using casil::Logger;
+using casil::HL::RegisterDriver;
+using casil::RL::StandardRegister;
+
+namespace Bytes = casil::Bytes;
+
+//Measure the CPU cost of byte/bit conversions, standard registers and register drivers (no transport overhead,
+//see BenchMemoryInterface):
+// - Run "CasilMicroBenchmarks" for the full benchmark set
+// - Run "CasilMicroBenchmarks --quick" for a short smoke run with reduced measurement times
+// - Add "--json <file>" to additionally write the results in the common JSON format (see BenchmarkReport)
+// - Build with CASIL_ENABLE_ALLOCATION_COUNTING to additionally report heap allocations per iteration (see Allocations)
+// - Set CASIL_SIMD_TARGET (e.g. "sse2") to compare the runtime-dispatched byte kernels (see Bytes::simdKernelTarget())
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::array<std::size_t, 4> bitsetSizes = {64, 1024, 65536, 1048576};
+constexpr std::array<std::size_t, 3> registerSizes = {1024, 65536, 1048576};
+constexpr std::array<std::pair<std::string_view, std::string_view>, 7> driverRegs = {{{"ALIGNED_A", "8"},
+                                                                                     {"ALIGNED_B", "16"},
+                                                                                     {"UNALIGNED_A", "11_offs5"},
+                                                                                     {"ALIGNED_C", "32"},
+                                                                                     {"UNALIGNED_B", "58_offs3"},
+                                                                                     {"UNALIGNED_C", "63_offs3"},
+                                                                                     {"ALIGNED_D", "64"}}};   //Register names and benchmark labels
+
+constexpr std::size_t maxIterations = std::size_t(1) << 30;
+
+volatile std::uint64_t sink = 0;    //Consumes benchmark results to keep them from being optimized away
+
+/*
+ * Runs 'pBody' in batches of doubling iteration counts until a batch takes at least 'pMinTime' seconds
+ * and records the per-iteration times of the final batch as 'pName' in 'pReport'. 'pBytesPerIteration'
+ * (if non-zero) is used to additionally record the throughput.
+ */
+template<typename T>
+void runBenchmark(BenchmarkReport& pReport, const std::string& pName, const double pMinTime,
+                  const std::size_t pBytesPerIteration, T&& pBody)
+{
+    std::size_t iterations = 1;
+
+    for (;;)
+    {
+        const Allocations::Scope allocations;
+        const std::clock_t cpuStart = std::clock();
+        const Clock::time_point start = Clock::now();
+
+        for (std::size_t i = 0; i < iterations; ++i)
+            pBody(i);
+
+        const double realTime = std::chrono::duration<double>(Clock::now() - start).count();
+        const double cpuTime = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+        const Allocations::Counts allocationCounts = allocations.getCounts();
+
+        if (realTime >= pMinTime || iterations >= maxIterations)
+        {
+            const double numIterations = static_cast<double>(iterations);
+
+            BenchmarkReport::Result result {pName, iterations, 1e9 * realTime / numIterations, 1e9 * cpuTime / numIterations, {}};
+
+            const double bytesPerSecond = (pBytesPerIteration != 0 && realTime > 0) ?
+                                              static_cast<double>(pBytesPerIteration) * numIterations / realTime : 0;
+            const double allocsPerIteration = static_cast<double>(allocationCounts.allocations) / numIterations;
+            const double allocBytesPerIteration = static_cast<double>(allocationCounts.bytes) / numIterations;
+
+            std::cout << std::left << std::setw(44) << result.name << std::right << std::fixed << std::setprecision(1)
+                      << std::setw(16) << result.realTimeNs << std::setw(16) << result.cpuTimeNs
+                      << std::setw(14) << result.iterations;
+
+            if (bytesPerSecond != 0)
+                std::cout << std::setw(14) << bytesPerSecond / (1024. * 1024.);
+            else if (Allocations::isAvailable())
+                std::cout << std::setw(14) << "-";
+
+            if (Allocations::isAvailable())
+                std::cout << std::setw(14) << allocsPerIteration << std::setw(16) << allocBytesPerIteration;
+
+            std::cout << std::endl;
+
+            if (bytesPerSecond != 0)
+                result.counters.emplace_back("bytes_per_second", bytesPerSecond);
+
+            if (Allocations::isAvailable())
+            {
+                result.counters.emplace_back("allocs_per_iter", allocsPerIteration);
+                result.counters.emplace_back("alloc_bytes_per_iter", allocBytesPerIteration);
+            }
+
+            pReport.add(std::move(result));
+
+            return;
+        }
+
+        //Aim directly for the minimum time if the batch was long enough to extrapolate, otherwise just double
+        if (realTime > pMinTime / 100)
+            iterations = std::max(2 * iterations, static_cast<std::size_t>(1.2 * pMinTime / realTime * static_cast<double>(iterations)));
+        else
+            iterations *= 2;
+
+        iterations = std::min(iterations, maxIterations);
+    }
+}
+
+void printHeader()
+{
+    std::cout << "Byte kernels: " << Bytes::simdKernelTarget() << "\n" << std::endl;
+
+    std::cout << std::left << std::setw(44) << "Benchmark" << std::right << std::setw(16) << "Time [ns]"
+              << std::setw(16) << "CPU [ns]" << std::setw(14) << "Iterations" << std::setw(14) << "MiB/s";
+
+    if (Allocations::isAvailable())
+        std::cout << std::setw(14) << "Allocs/iter" << std::setw(16) << "Bytes/iter";
+
+    std::cout << std::endl;
+}
+
+//
+
+/*
+ * Measures composition of a byte sequence from mixed-size integers and conversions between byte sequences and bitsets.
+ */
+void benchBytes(BenchmarkReport& pReport, const double pMinTime)
+{
+    runBenchmark(pReport, "Bytes/composeByteVec", pMinTime, 15,
+                 [](const std::size_t pIdx)
+                 {
+                     const std::vector<std::uint8_t> bytes = Bytes::composeByteVec(true, static_cast<std::uint32_t>(pIdx),
+                                                                                   static_cast<std::uint16_t>(pIdx),
+                                                                                   static_cast<std::uint8_t>(pIdx),
+                                                                                   static_cast<std::uint64_t>(pIdx));
+                     sink = bytes[14];
+                 });
+
+    for (const std::size_t bitSize : bitsetSizes)
+    {
+        const std::size_t byteSize = bitSize / 8;
+
+        std::vector<std::uint8_t> bytes(byteSize);
+        for (std::size_t i = 0; i < byteSize; ++i)
+            bytes[i] = static_cast<std::uint8_t>(i * 37);
+
+        const boost::dynamic_bitset<> bits = Bytes::bitsetFromBytes(bytes, bitSize);
+
+        runBenchmark(pReport, "Bytes/bitsetFromBytes/" + std::to_string(bitSize), pMinTime, byteSize,
+                     [&bytes, bitSize](std::size_t)
+                     {
+                         sink = Bytes::bitsetFromBytes(bytes, bitSize).count();
+                     });
+
+        runBenchmark(pReport, "Bytes/bytesFromBitset/" + std::to_string(bitSize), pMinTime, byteSize,
+                     [&bits, byteSize](std::size_t)
+                     {
+                         sink = Bytes::bytesFromBitset(bits, byteSize).back();
+                     });
+
+        std::vector<std::uint32_t> words(byteSize / 4);
+
+        runBenchmark(pReport, "Bytes/decodeUInt32BE/" + std::to_string(bitSize), pMinTime, byteSize,
+                     [&bytes, &words](std::size_t)
+                     {
+                         Bytes::decodeUInt32BE(bytes, words);
+                         sink = words.back();
+                     });
+
+        const std::vector<std::uint8_t> bytesCopy = bytes;
+
+        runBenchmark(pReport, "Bytes/findMismatch/" + std::to_string(bitSize), pMinTime, byteSize,
+                     [&bytes, &bytesCopy](std::size_t)
+                     {
+                         sink = Bytes::findMismatch(bytes, bytesCopy);
+                     });
+    }
+}
+
+/*
+ * Measures construction, field access, byte conversion and writing of standard registers of different sizes
+ * with a three-field layout, driven by a GPIO driver on an in-memory bus.
+ */
+void benchStandardRegister(BenchmarkReport& pReport, const double pMinTime)
+{
+    for (const std::size_t bitSize : registerSizes)
+    {
+        const std::size_t byteSize = bitSize / 8;
+        const std::string sizeStr = std::to_string(bitSize);
+
+        Device d("{transfer_layer: [{name: mem, type: BenchMemoryInterface, size: " + std::to_string(1 + 3 * byteSize) + "}],"
+                  "hw_drivers: [{name: gpio, type: GPIO, interface: mem, base_addr: 0x0, size: " + sizeStr + "}],"
+                  "registers: []}");
+
+        if (!d.init())
+            throw std::runtime_error("Could not initialize device.");
+
+        const LayerConfig regConfig = LayerConfig::fromYAML("{size: " + sizeStr + ", fields: ["
+                                                                "{name: HEAD, size: 16, offset: " + std::to_string(bitSize - 1) + "},"
+                                                                "{name: BODY, size: " + std::to_string(bitSize - 32) + ", "
+                                                                 "offset: " + std::to_string(bitSize - 17) + "},"
+                                                                "{name: TAIL, size: 16, offset: 15}]}");
+
+        runBenchmark(pReport, "StandardRegister/construct/" + sizeStr, pMinTime, 0,
+                     [&d, &regConfig](std::size_t)
+                     {
+                         const StandardRegister reg("reg", d.driver("gpio"), regConfig);
+                         sink = reg.getSize();
+                     });
+
+        StandardRegister reg("reg", d.driver("gpio"), regConfig);
+
+        if (!reg.init())
+            throw std::runtime_error("Could not initialize register.");
+
+        runBenchmark(pReport, "StandardRegister/setField/" + sizeStr, pMinTime, 0,
+                     [&reg](const std::size_t pIdx)
+                     {
+                         reg["HEAD"] = static_cast<std::uint16_t>(pIdx);
+                     });
+
+        runBenchmark(pReport, "StandardRegister/getField/" + sizeStr, pMinTime, 0,
+                     [&reg](std::size_t)
+                     {
+                         sink = reg["HEAD"].toUInt();
+                     });
+
+        runBenchmark(pReport, "StandardRegister/setSlice/" + sizeStr, pMinTime, 0,
+                     [&reg](const std::size_t pIdx)
+                     {
+                         reg["BODY"](11, 4) = static_cast<std::uint8_t>(pIdx);
+                     });
+
+        runBenchmark(pReport, "StandardRegister/setSliceView/" + sizeStr, pMinTime, 0,
+                     [&reg](const std::size_t pIdx)
+                     {
+                         reg["BODY"].view(11, 4) = static_cast<std::uint8_t>(pIdx);
+                     });
+
+        runBenchmark(pReport, "StandardRegister/toBytes/" + sizeStr, pMinTime, byteSize,
+                     [&reg](std::size_t)
+                     {
+                         sink = reg.toBytes().back();
+                     });
+
+        runBenchmark(pReport, "StandardRegister/write/" + sizeStr, pMinTime, byteSize,
+                     [&reg](const std::size_t pIdx)
+                     {
+                         reg["TAIL"] = static_cast<std::uint16_t>(pIdx);
+                         reg.write();
+                     });
+
+        if (!d.close())
+            throw std::runtime_error("Could not close device.");
+    }
+}
+
+/*
+ * Measures value register reads and writes of a register driver on an in-memory bus for different register
+ * sizes and bit alignments (see BenchRegDriver), both by register name and via precomputed register handles.
+ */
+void benchRegisterDriver(BenchmarkReport& pReport, const double pMinTime)
+{
+    Device d("{transfer_layer: [{name: mem, type: BenchMemoryInterface, size: 64}],"
+              "hw_drivers: [{name: drv, type: BenchRegDriver, interface: mem, base_addr: 0x0}],"
+              "registers: []}");
+
+    if (!d.init())
+        throw std::runtime_error("Could not initialize device.");
+
+    RegisterDriver& drv = dynamic_cast<RegisterDriver&>(d.driver("drv"));
+
+    for (const auto& [regName, regLabel] : driverRegs)
+    {
+        const std::string nameStr(regLabel);
+
+        runBenchmark(pReport, "RegisterDriver/setValue/" + nameStr, pMinTime, 0,
+                     [&drv, name = regName](const std::size_t pIdx)
+                     {
+                         drv.setValue(name, pIdx & 0xFFu);
+                     });
+
+        runBenchmark(pReport, "RegisterDriver/getValue/" + nameStr, pMinTime, 0,
+                     [&drv, name = regName](std::size_t)
+                     {
+                         sink = drv.getValue(name);
+                     });
+
+        RegisterDriver::RegisterHandle handle = drv.handle(regName);
+
+        runBenchmark(pReport, "RegisterHandle/setValue/" + nameStr, pMinTime, 0,
+                     [&handle](const std::size_t pIdx)
+                     {
+                         handle.setValue(pIdx & 0xFFu);
+                     });
+
+        runBenchmark(pReport, "RegisterHandle/getValue/" + nameStr, pMinTime, 0,
+                     [&handle](std::size_t)
+                     {
+                         sink = handle.getValue();
+                     });
+    }
+
+    if (!d.close())
+        throw std::runtime_error("Could not close device.");
+}
+
+} // namespace
+
+int main(int argc, const char** argv)
+{
+    bool quick = false;
+    std::string jsonFileName;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+
+        if (arg == "--quick")
+            quick = true;
+        else if (arg == "--json" && i + 1 < argc)
+            jsonFileName = argv[++i];
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--quick] [--json <file>]" << std::endl;
+            return 2;
+        }
+    }
+
+    const double minTime = quick ? 0.02 : 0.5;
+
+    Logger::setLogLevel(Logger::LogLevel::Warning);
+    Logger::addOutputCout();
+
+    try
+    {
+        BenchmarkReport report(argv[0], quick);
+
+        printHeader();
+
+        benchBytes(report, minTime);
+        benchStandardRegister(report, minTime);
+        benchRegisterDriver(report, minTime);
+
+        if (!jsonFileName.empty())
+            report.writeJSON(jsonFileName);
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << "Benchmark failed: " << exc.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "mockechoserver.h"
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+
+/*
+ * Creates the echo server and binds its TCP/UDP sockets to ephemeral localhost ports.
+ */
+MockEchoServer::MockEchoServer() :
+    ioContext(),
+    tcpAcceptor(ioContext, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)),
+    tcpSocket(ioContext),
+    udpSocket(ioContext, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0)),
+    ioThread(),
+    tcpBuffer(),
+    udpBuffer(),
+    udpRemoteEndpoint()
+{
+}
+
+/*
+ * Stops echoing (see stop()).
+ */
+MockEchoServer::~MockEchoServer()
+{
+    stop();
+}
+
+//Public
+
+std::uint16_t MockEchoServer::getTcpPort() const
+{
+    return tcpAcceptor.local_endpoint().port();
+}
+
+std::uint16_t MockEchoServer::getUdpPort() const
+{
+    return udpSocket.local_endpoint().port();
+}
+
+//
+
+/*
+ * Starts accepting a single TCP connection and echoing UDP datagrams on the own IO thread.
+ */
+void MockEchoServer::start()
+{
+    if (ioThread.joinable())
+        return;
+
+    acceptTcp();
+    receiveUdp();
+
+    ioThread = std::thread([this](){ ioContext.run(); });
+}
+
+/*
+ * Stops the IO thread and closes all sockets.
+ */
+void MockEchoServer::stop()
+{
+    if (!ioThread.joinable())
+        return;
+
+    ioContext.stop();
+    ioThread.join();
+
+    boost::system::error_code ec;
+    tcpSocket.close(ec);
+    tcpAcceptor.close(ec);
+    udpSocket.close(ec);
+}
+
+//Private
+
+void MockEchoServer::acceptTcp()
+{
+    tcpAcceptor.async_accept(tcpSocket, [this](const boost::system::error_code& pErrorCode)
+                                        {
+                                            if (pErrorCode)
+                                                return;
+
+                                            boost::system::error_code ec;
+                                            tcpSocket.set_option(boost::asio::ip::tcp::no_delay(true), ec);
+
+                                            receiveTcp();
+                                        });
+}
+
+/*
+ * Receives available TCP data and writes it back completely before receiving again.
+ */
+void MockEchoServer::receiveTcp()
+{
+    tcpSocket.async_read_some(boost::asio::buffer(tcpBuffer),
+                              [this](const boost::system::error_code& pErrorCode, const std::size_t pSize)
+                              {
+                                  if (pErrorCode)
+                                      return;
+
+                                  boost::asio::async_write(tcpSocket, boost::asio::buffer(tcpBuffer.data(), pSize),
+                                                           [this](const boost::system::error_code& pWriteErrorCode, std::size_t)
+                                                           {
+                                                               if (!pWriteErrorCode)
+                                                                   receiveTcp();
+                                                           });
+                              });
+}
+
+//
+
+void MockEchoServer::receiveUdp()
+{
+    udpSocket.async_receive_from(boost::asio::buffer(udpBuffer), udpRemoteEndpoint,
+                                 [this](const boost::system::error_code& pErrorCode, const std::size_t pSize)
+                                 {
+                                     if (pErrorCode)
+                                         return;
+
+                                     boost::system::error_code ec;
+                                     udpSocket.send_to(boost::asio::buffer(udpBuffer.data(), pSize), udpRemoteEndpoint, 0, ec);
+
+                                     receiveUdp();
+                                 });
+}
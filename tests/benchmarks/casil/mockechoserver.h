@@ -0,0 +1,73 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASILBENCHMARKS_MOCKECHOSERVER_H
+#define CASILBENCHMARKS_MOCKECHOSERVER_H
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+/*!
+ * \brief In-process %TCP and %UDP echo server for benchmarking.
+ *
+ * Sends every byte received over the (single) %TCP connection straight back and answers every %UDP datagram
+ * with an identical datagram. Uses an own IO context served by a single own thread and binds to ephemeral
+ * localhost ports, see getTcpPort() and getUdpPort().
+ */
+class MockEchoServer
+{
+public:
+    MockEchoServer();
+    ~MockEchoServer();
+    //
+    std::uint16_t getTcpPort() const;           ///< Get the bound %TCP port.
+    std::uint16_t getUdpPort() const;           ///< Get the bound %UDP port.
+    //
+    void start();                               ///< Start echoing.
+    void stop();                                ///< Stop echoing and close the %TCP connection.
+
+private:
+    void acceptTcp();
+    void receiveTcp();
+    //
+    void receiveUdp();
+
+private:
+    boost::asio::io_context ioContext;
+    boost::asio::ip::tcp::acceptor tcpAcceptor;
+    boost::asio::ip::tcp::socket tcpSocket;
+    boost::asio::ip::udp::socket udpSocket;
+    std::thread ioThread;
+    //
+    std::array<std::uint8_t, 65536> tcpBuffer;
+    std::array<std::uint8_t, 65535> udpBuffer;
+    boost::asio::ip::udp::endpoint udpRemoteEndpoint;
+};
+
+#endif // CASILBENCHMARKS_MOCKECHOSERVER_H
@@ -0,0 +1,318 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "mocksitcpserver.h"
+
+#include <casil/bytes.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+
+#include <algorithm>
+#include <span>
+
+/*
+ * Creates a mock endpoint with a bus memory of 'pMemSize' bytes and binds its UDP/TCP sockets to ephemeral localhost ports.
+ */
+MockSiTCPServer::MockSiTCPServer(const std::size_t pMemSize) :
+    memory(pMemSize, 0),
+    ioContext(),
+    udpSocket(ioContext, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0)),
+    tcpAcceptor(ioContext, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)),
+    tcpSocket(ioContext),
+    ioThread(),
+    udpRecvBuffer(),
+    udpRemoteEndpoint(),
+    udpSendBuffer(),
+    tcpRecvBuffer(),
+    tcpPending(),
+    tcpToBusSkipBytes(0),
+    tcpConnected(false),
+    fifoSending(false),
+    fifoBytesRequested(0),
+    fifoSendBuffer(),
+    fifoCounter(0),
+    fifoBytesSent(0),
+    tcpToBusBytesWritten(0),
+    rbcpRequests(0)
+{
+}
+
+/*
+ * Stops serving requests (see stop()).
+ */
+MockSiTCPServer::~MockSiTCPServer()
+{
+    stop();
+}
+
+//Public
+
+std::uint16_t MockSiTCPServer::getUdpPort() const
+{
+    return udpSocket.local_endpoint().port();
+}
+
+std::uint16_t MockSiTCPServer::getTcpPort() const
+{
+    return tcpAcceptor.local_endpoint().port();
+}
+
+//
+
+/*
+ * Starts accepting a single TCP connection and serving RBCP requests on the own IO thread.
+ */
+void MockSiTCPServer::start()
+{
+    if (ioThread.joinable())
+        return;
+
+    receiveUdp();
+    acceptTcp();
+
+    ioThread = std::thread([this](){ ioContext.run(); });
+}
+
+/*
+ * Stops the IO thread and closes all sockets.
+ */
+void MockSiTCPServer::stop()
+{
+    if (!ioThread.joinable())
+        return;
+
+    ioContext.stop();
+    ioThread.join();
+
+    boost::system::error_code ec;
+    tcpSocket.close(ec);
+    tcpAcceptor.close(ec);
+    udpSocket.close(ec);
+}
+
+//
+
+/*
+ * Requests 'pNumBytes' further FIFO bytes to be sent as soon as the TCP connection is established.
+ */
+void MockSiTCPServer::streamFifo(const std::size_t pNumBytes)
+{
+    boost::asio::post(ioContext, [this, pNumBytes]()
+                                 {
+                                     fifoBytesRequested += pNumBytes;
+
+                                     if (tcpConnected && !fifoSending)
+                                         sendFifoChunk();
+                                 });
+}
+
+std::size_t MockSiTCPServer::getFifoBytesSent() const
+{
+    return fifoBytesSent.load();
+}
+
+std::size_t MockSiTCPServer::getTcpToBusBytesWritten() const
+{
+    return tcpToBusBytesWritten.load();
+}
+
+std::size_t MockSiTCPServer::getRBCPRequests() const
+{
+    return rbcpRequests.load();
+}
+
+//Private
+
+void MockSiTCPServer::receiveUdp()
+{
+    udpSocket.async_receive_from(boost::asio::buffer(udpRecvBuffer), udpRemoteEndpoint,
+                                 [this](const boost::system::error_code& pErrorCode, const std::size_t pSize)
+                                 {
+                                     if (pErrorCode)
+                                         return;
+
+                                     handleRBCPRequest(pSize);
+                                     receiveUdp();
+                                 });
+}
+
+/*
+ * Answers the RBCP request of size 'pSize' in the receive buffer like the SiTCP core does;
+ * accesses outside the memory are answered with the bus error flag set.
+ */
+void MockSiTCPServer::handleRBCPRequest(const std::size_t pSize)
+{
+    if (pSize < 8 || udpRecvBuffer[0] != 0xFFu)
+        return;
+
+    const bool readMode = (udpRecvBuffer[1] == 0xC0u);
+    const std::size_t len = udpRecvBuffer[3];
+    const std::size_t addr = casil::Bytes::composeUInt32(std::span<const std::uint8_t, 4>(udpRecvBuffer.begin() + 4, 4));
+
+    if (!readMode && pSize != len + 8)
+        return;
+
+    udpSendBuffer.assign(udpRecvBuffer.begin(), udpRecvBuffer.begin() + 8);
+    udpSendBuffer[1] |= 0x08u;
+
+    if (addr + len > memory.size())
+    {
+        udpSendBuffer[1] |= 0x01u;
+        udpSendBuffer.resize(8 + len, 0);
+    }
+    else if (readMode)
+        udpSendBuffer.insert(udpSendBuffer.end(), memory.begin() + addr, memory.begin() + addr + len);
+    else
+    {
+        std::copy(udpRecvBuffer.begin() + 8, udpRecvBuffer.begin() + 8 + len, memory.begin() + addr);
+        udpSendBuffer.insert(udpSendBuffer.end(), udpRecvBuffer.begin() + 8, udpRecvBuffer.begin() + 8 + len);
+    }
+
+    boost::system::error_code ec;
+    udpSocket.send_to(boost::asio::buffer(udpSendBuffer), udpRemoteEndpoint, 0, ec);
+
+    ++rbcpRequests;
+}
+
+//
+
+void MockSiTCPServer::acceptTcp()
+{
+    tcpAcceptor.async_accept(tcpSocket, [this](const boost::system::error_code& pErrorCode)
+                                        {
+                                            if (pErrorCode)
+                                                return;
+
+                                            tcpConnected = true;
+
+                                            receiveTcp();
+
+                                            if (fifoBytesRequested > 0 && !fifoSending)
+                                                sendFifoChunk();
+                                        });
+}
+
+void MockSiTCPServer::receiveTcp()
+{
+    tcpSocket.async_read_some(boost::asio::buffer(tcpRecvBuffer),
+                              [this](const boost::system::error_code& pErrorCode, const std::size_t pSize)
+                              {
+                                  if (pErrorCode)
+                                      return;
+
+                                  tcpPending.insert(tcpPending.end(), tcpRecvBuffer.begin(), tcpRecvBuffer.begin() + pSize);
+                                  parseTcpToBus();
+                                  receiveTcp();
+                              });
+}
+
+/*
+ * Consumes all complete "tcp_to_bus" messages (little endian 16 bit length, little endian 32 bit address, data)
+ * from the pending TCP data and writes them to the memory. A length field of 0xFFFF marks the enable sequence.
+ */
+void MockSiTCPServer::parseTcpToBus()
+{
+    std::size_t pos = 0;
+
+    while (true)
+    {
+        if (tcpToBusSkipBytes > 0)
+        {
+            const std::size_t skip = std::min(tcpToBusSkipBytes, tcpPending.size() - pos);
+
+            pos += skip;
+            tcpToBusSkipBytes -= skip;
+
+            if (tcpToBusSkipBytes > 0)
+                break;
+        }
+
+        if (tcpPending.size() - pos < 6)
+            break;
+
+        const std::size_t len = tcpPending[pos] | (static_cast<std::size_t>(tcpPending[pos + 1]) << 8);
+
+        if (len == 0xFFFFu)
+        {
+            tcpToBusSkipBytes = tcpToBusResetLength;
+            continue;
+        }
+
+        if (tcpPending.size() - pos < 6 + len)
+            break;
+
+        const std::size_t addr = casil::Bytes::composeUInt32(std::span<const std::uint8_t, 4>(tcpPending.begin() + pos + 2, 4),
+                                                             false);
+
+        if (addr + len <= memory.size())
+            std::copy(tcpPending.begin() + pos + 6, tcpPending.begin() + pos + 6 + len, memory.begin() + addr);
+
+        pos += 6 + len;
+        tcpToBusBytesWritten += len;
+    }
+
+    tcpPending.erase(tcpPending.begin(), tcpPending.begin() + pos);
+}
+
+//
+
+/*
+ * Sends the next chunk of requested FIFO data (incrementing little endian 32 bit words) and re-arms itself until
+ * all requested bytes have been sent.
+ */
+void MockSiTCPServer::sendFifoChunk()
+{
+    const std::size_t numBytes = std::min(fifoBytesRequested, fifoChunkSize) & ~static_cast<std::size_t>(3);
+
+    if (numBytes == 0)
+    {
+        fifoSending = false;
+        return;
+    }
+
+    fifoSending = true;
+
+    fifoSendBuffer.resize(numBytes);
+
+    for (std::size_t i = 0; i < numBytes; i += 4)
+        casil::Bytes::composeBytesTo(fifoSendBuffer.begin() + i, false, fifoCounter++);
+
+    fifoBytesRequested -= numBytes;
+
+    boost::asio::async_write(tcpSocket, boost::asio::buffer(fifoSendBuffer),
+                             [this](const boost::system::error_code& pErrorCode, const std::size_t pSize)
+                             {
+                                 fifoBytesSent += pSize;
+
+                                 if (pErrorCode)
+                                 {
+                                     fifoSending = false;
+                                     return;
+                                 }
+
+                                 sendFifoChunk();
+                             });
+}
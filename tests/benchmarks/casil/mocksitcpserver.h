@@ -0,0 +1,105 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASILBENCHMARKS_MOCKSITCPSERVER_H
+#define CASILBENCHMARKS_MOCKSITCPSERVER_H
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/*!
+ * \brief In-process emulation of a %SiTCP endpoint for benchmarking.
+ *
+ * Emulates the RBCP protocol over %UDP on a plain byte memory, parses "tcp_to_bus" messages (including the
+ * enable sequence) received over %TCP into the same memory and streams FIFO data (an incrementing 32 bit
+ * counter) over the %TCP connection on request. Uses an own IO context served by a single own thread
+ * and binds to ephemeral localhost ports, see getUdpPort() and getTcpPort().
+ */
+class MockSiTCPServer
+{
+public:
+    explicit MockSiTCPServer(std::size_t pMemSize);
+    ~MockSiTCPServer();
+    //
+    std::uint16_t getUdpPort() const;                       ///< Get the bound %UDP (RBCP) port.
+    std::uint16_t getTcpPort() const;                       ///< Get the bound %TCP port.
+    //
+    void start();                                           ///< Start serving requests.
+    void stop();                                            ///< Stop serving requests and close the %TCP connection.
+    //
+    void streamFifo(std::size_t pNumBytes);                 ///< Send (additional) FIFO data over the %TCP connection.
+    std::size_t getFifoBytesSent() const;                   ///< Get the total number of sent FIFO bytes.
+    std::size_t getTcpToBusBytesWritten() const;            ///< Get the total number of bus bytes written via "tcp_to_bus".
+    std::size_t getRBCPRequests() const;                    ///< Get the number of handled RBCP requests.
+
+private:
+    void receiveUdp();
+    void handleRBCPRequest(std::size_t pSize);
+    //
+    void acceptTcp();
+    void receiveTcp();
+    void parseTcpToBus();
+    //
+    void sendFifoChunk();
+
+private:
+    std::vector<std::uint8_t> memory;
+    //
+    boost::asio::io_context ioContext;
+    boost::asio::ip::udp::socket udpSocket;
+    boost::asio::ip::tcp::acceptor tcpAcceptor;
+    boost::asio::ip::tcp::socket tcpSocket;
+    std::thread ioThread;
+    //
+    std::array<std::uint8_t, 65535> udpRecvBuffer;
+    boost::asio::ip::udp::endpoint udpRemoteEndpoint;
+    std::vector<std::uint8_t> udpSendBuffer;
+    //
+    std::array<std::uint8_t, 65536> tcpRecvBuffer;
+    std::vector<std::uint8_t> tcpPending;
+    std::size_t tcpToBusSkipBytes;
+    //
+    bool tcpConnected;
+    bool fifoSending;
+    std::size_t fifoBytesRequested;
+    std::vector<std::uint8_t> fifoSendBuffer;
+    std::uint32_t fifoCounter;
+    //
+    std::atomic<std::size_t> fifoBytesSent;
+    std::atomic<std::size_t> tcpToBusBytesWritten;
+    std::atomic<std::size_t> rbcpRequests;
+
+private:
+    static constexpr std::size_t tcpToBusResetLength = 65535 + 6;   ///< Length of the "tcp_to_bus" enable sequence.
+    static constexpr std::size_t fifoChunkSize = 65536;             ///< Maximum number of FIFO bytes per %TCP write.
+};
+
+#endif // CASILBENCHMARKS_MOCKSITCPSERVER_H
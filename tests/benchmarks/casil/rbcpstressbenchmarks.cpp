@@ -0,0 +1,281 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "benchmarkreport.h"
+#include "mocksitcpserver.h"
+#include "udpimpairmentproxy.h"
+
+#include <casil/auxil.h>
+#include <casil/device.h>
+#include <casil/logger.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using casil::Device;
+using casil::Logger;
+using casil::TL::SiTCP;
+
+namespace Auxil = casil::Auxil;
+
+//Measure SiTCP RBCP transaction rate and tail latency while the RBCP datagrams pass an impairing UDP proxy
+//(see UDPImpairmentProxy) between SiTCP and an in-process mock SiTCP endpoint (see MockSiTCPServer),
+//for several loss/duplication/delay/reordering profiles and RBCP retransmit policies:
+// - Run "CasilRBCPStressBenchmarks" for the full benchmark set
+// - Run "CasilRBCPStressBenchmarks --quick" for a short smoke run with reduced iteration counts
+// - Add "--json <file>" to additionally write the results in the common JSON format (see BenchmarkReport)
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+constexpr std::size_t mockMemSize = 1 << 20;
+constexpr std::uint64_t proxySeed = 0x5117C9u;      //Fixed seed for reproducible impairment sequences
+
+/*
+ * Named impairment profile applied to both directions of the RBCP traffic.
+ */
+struct Profile
+{
+    std::string_view name;
+    UDPImpairmentProxy::Impairments impairments;
+};
+
+/*
+ * Named set of RBCP related SiTCP init options.
+ */
+struct Policy
+{
+    std::string_view name;
+    std::string_view initOptions;
+};
+
+//Held back ("reordered") datagrams arrive only after the fixed response timeout of 20 ms, i.e. as stray responses
+const std::array<Profile, 7> profiles = {
+    Profile{"clean",              {}},
+    Profile{"loss 1%",            {.lossProbability = 0.01}},
+    Profile{"loss 5%",            {.lossProbability = 0.05}},
+    Profile{"duplicate 5%",       {.duplicateProbability = 0.05}},
+    Profile{"delay 0.2-0.6 ms",   {.delay = microseconds(200), .jitter = microseconds(400)}},
+    Profile{"reorder 2% (+30 ms)", {.reorderProbability = 0.02, .reorderDelay = milliseconds(30)}},
+    Profile{"mixed",              {.lossProbability = 0.02, .duplicateProbability = 0.02, .delay = microseconds(100),
+                                   .jitter = microseconds(200), .reorderProbability = 0.01, .reorderDelay = milliseconds(30)}}
+};
+
+const std::array<Policy, 2> policies = {
+    Policy{"fixed",    ", rbcp_timeout: 0.02, rbcp_retransmits: 3"},
+    Policy{"adaptive", ", rbcp_timeout: 0.02, rbcp_retransmits: 3, rbcp_adaptive_timeout: true, rbcp_min_timeout: 0.001"}
+};
+
+double toMicroseconds(const Clock::duration pDuration)
+{
+    return std::chrono::duration<double, std::micro>(pDuration).count();
+}
+
+void printHeader()
+{
+    std::cout << std::left << std::setw(22) << "Profile" << std::setw(10) << "Policy" << std::right
+              << std::setw(10) << "trans/s" << std::setw(10) << "p50 [us]" << std::setw(10) << "p99 [us]"
+              << std::setw(11) << "p999 [us]" << std::setw(11) << "max [us]" << std::setw(9) << "Retries"
+              << std::setw(9) << "WrongID" << std::setw(8) << "Failed" << std::setw(9) << "Corrupt"
+              << std::setw(9) << "Dropped" << std::endl;
+}
+
+/*
+ * Runs 'pIterations' pairs of 4 byte RBCP writes and verifying read-backs through a proxy with the impairments
+ * of 'pProfile', using the RBCP options of 'pPolicy', and prints rate, latency percentiles (of all transactions)
+ * and error counts (also added to 'pReport'). Failed transactions (exceptions) are counted and skipped;
+ * the read-back of a failed write is skipped.
+ */
+void benchProfile(BenchmarkReport& pReport, const Profile& pProfile, const Policy& pPolicy, const std::size_t pIterations)
+{
+    MockSiTCPServer server(mockMemSize);
+    server.start();
+
+    UDPImpairmentProxy proxy(server.getUdpPort(), pProfile.impairments, proxySeed);
+    proxy.start();
+
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: " + std::to_string(proxy.getPort()) +
+                                       ", tcp_port: " + std::to_string(server.getTcpPort()) +
+                                       std::string(pPolicy.initOptions) + "}}],"
+              "hw_drivers: [], registers: []}");
+
+    Auxil::AsyncIORunner<2> ioRunner;
+    (void)ioRunner;
+
+    if (!d.init())
+        throw std::runtime_error("Could not initialize SiTCP interface.");
+
+    SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+    const SiTCP::Statistics statsBefore = intf.getStatistics();
+
+    std::vector<double> latencies;
+    latencies.reserve(2 * pIterations);
+
+    std::size_t failed = 0;
+    std::size_t corrupt = 0;
+
+    const auto start = Clock::now();
+
+    for (std::size_t i = 0; i < pIterations; ++i)
+    {
+        const std::uint64_t addr = 4 * (i % 1024);
+        const std::vector<std::uint8_t> data = {static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i >> 8),
+                                                static_cast<std::uint8_t>(i >> 16), 0xA5u};
+
+        auto t0 = Clock::now();
+
+        try
+        {
+            intf.write(addr, data);
+            latencies.push_back(toMicroseconds(Clock::now() - t0));
+        }
+        catch (const std::runtime_error&)
+        {
+            latencies.push_back(toMicroseconds(Clock::now() - t0));
+            ++failed;
+            continue;
+        }
+
+        t0 = Clock::now();
+
+        try
+        {
+            const bool match = (intf.read(addr, 4) == data);
+            latencies.push_back(toMicroseconds(Clock::now() - t0));
+
+            if (!match)
+                ++corrupt;
+        }
+        catch (const std::runtime_error&)
+        {
+            latencies.push_back(toMicroseconds(Clock::now() - t0));
+            ++failed;
+        }
+    }
+
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const SiTCP::Statistics statsAfter = intf.getStatistics();
+
+    if (!d.close())
+        throw std::runtime_error("Could not close SiTCP interface.");
+
+    proxy.stop();
+    server.stop();
+
+    const std::uint64_t retries = statsAfter.rbcpRetries - statsBefore.rbcpRetries;
+    const std::uint64_t wrongIdResponses = statsAfter.rbcpWrongIdResponses - statsBefore.rbcpWrongIdResponses;
+    const std::uint64_t lateResponses = statsAfter.rbcpLateResponses - statsBefore.rbcpLateResponses;
+
+    BenchmarkReport::Result result {std::string(pProfile.name) + "/" + std::string(pPolicy.name), latencies.size(),
+                                    1e9 * seconds / static_cast<double>(latencies.size()), 0,
+                                    {{"items_per_second", static_cast<double>(latencies.size()) / seconds}}};
+    BenchmarkReport::addLatencyCounters(result, latencies);
+    result.counters.emplace_back("retries", static_cast<double>(retries));
+    result.counters.emplace_back("wrong_id_responses", static_cast<double>(wrongIdResponses));
+    result.counters.emplace_back("late_responses", static_cast<double>(lateResponses));
+    result.counters.emplace_back("failed", static_cast<double>(failed));
+    result.counters.emplace_back("corrupt", static_cast<double>(corrupt));
+
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << std::left << std::setw(22) << pProfile.name << std::setw(10) << pPolicy.name << std::right
+              << std::fixed << std::setprecision(1)
+              << std::setw(10) << static_cast<double>(latencies.size()) / seconds
+              << std::setw(10) << BenchmarkReport::percentile(latencies, 0.5)
+              << std::setw(10) << BenchmarkReport::percentile(latencies, 0.99)
+              << std::setw(11) << BenchmarkReport::percentile(latencies, 0.999) << std::setw(11) << latencies.back()
+              << std::setw(9) << retries << std::setw(9) << wrongIdResponses
+              << std::setw(8) << failed << std::setw(9) << corrupt
+              << std::setw(9) << proxy.getStatistics().dropped << std::endl;
+
+    pReport.add(std::move(result));
+}
+
+} // namespace
+
+int main(int argc, const char** argv)
+{
+    bool quick = false;
+    std::string jsonFileName;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+
+        if (arg == "--quick")
+            quick = true;
+        else if (arg == "--json" && i + 1 < argc)
+            jsonFileName = argv[++i];
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--quick] [--json <file>]" << std::endl;
+            return 2;
+        }
+    }
+
+    const std::size_t iterations = quick ? 200 : 2000;
+
+    //Suppress the (rate-limited) retry warnings, which are expected here
+    Logger::setLogLevel(Logger::LogLevel::Error);
+    Logger::addOutputCout();
+
+    try
+    {
+        BenchmarkReport report(argv[0], quick);
+
+        printHeader();
+
+        for (const Profile& profile : profiles)
+            for (const Policy& policy : policies)
+                benchProfile(report, profile, policy, iterations);
+
+        if (!jsonFileName.empty())
+            report.writeJSON(jsonFileName);
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << "Benchmark failed: " << exc.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
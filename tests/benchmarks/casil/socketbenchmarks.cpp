@@ -0,0 +1,314 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "benchmarkreport.h"
+#include "mockechoserver.h"
+
+#include <casil/asio.h>
+#include <casil/auxil.h>
+#include <casil/logger.h>
+#include <casil/TL/CommonImpl/socketoptions.h>
+#include <casil/TL/CommonImpl/tcpsocketwrapper.h>
+#include <casil/TL/CommonImpl/udpsocketwrapper.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using casil::ASIO;
+using casil::Logger;
+using casil::Layers::TL::CommonImpl::SocketOptions;
+using casil::Layers::TL::CommonImpl::TCPSocketWrapper;
+using casil::Layers::TL::CommonImpl::UDPSocketWrapper;
+
+namespace Auxil = casil::Auxil;
+
+//Measure round trip latencies and throughput of the TCP/UDP socket wrappers against an in-process echo server
+//(see MockEchoServer), compared to plain blocking Boost ASIO sockets as baseline (the difference is the wrappers' overhead):
+// - Run "CasilSocketBenchmarks" for the full benchmark set
+// - Run "CasilSocketBenchmarks --quick" for a short smoke run with reduced iteration counts
+// - Add "--json <file>" to additionally write the results in the common JSON format (see BenchmarkReport)
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::array<std::size_t, 5> tcpBlockSizes = {1, 64, 1024, 16384, 65536};
+constexpr std::array<std::size_t, 5> udpBlockSizes = {1, 64, 1024, 8192, 32768};
+
+constexpr std::chrono::milliseconds timeout(1000);  //Never reached, only selects the timeout code paths
+
+void printHeader()
+{
+    std::cout << std::left << std::setw(34) << "Benchmark" << std::right << std::setw(12) << "MB/s"
+              << std::setw(12) << "p50 [us]" << std::setw(12) << "p99 [us]" << std::setw(12) << "p999 [us]" << std::endl;
+}
+
+/*
+ * Runs 'pRoundTrip' (write and read back a block of 'pBlockSize' bytes) 'pIterations' times after a short
+ * warm-up and prints (and adds to 'pReport') the echo throughput and round trip latency percentiles as benchmark 'pName'.
+ */
+void measureRoundTrips(BenchmarkReport& pReport, const std::string& pName, const std::size_t pBlockSize,
+                       const std::size_t pIterations, const std::function<void()>& pRoundTrip)
+{
+    for (std::size_t i = 0; i < std::min<std::size_t>(pIterations / 10 + 1, 100); ++i)
+        pRoundTrip();
+
+    std::vector<double> latencies;
+    latencies.reserve(pIterations);
+
+    const Clock::time_point start = Clock::now();
+
+    for (std::size_t i = 0; i < pIterations; ++i)
+    {
+        const Clock::time_point t0 = Clock::now();
+        pRoundTrip();
+        latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+    }
+
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    BenchmarkReport::Result result {pName, pIterations, 1e9 * seconds / static_cast<double>(pIterations), 0,
+                                    {{"bytes_per_second", static_cast<double>(pBlockSize * pIterations) / seconds}}};
+    BenchmarkReport::addLatencyCounters(result, latencies);
+
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << std::left << std::setw(34) << pName << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << static_cast<double>(pBlockSize * pIterations) / seconds / 1e6
+              << std::setw(12) << BenchmarkReport::percentile(latencies, 0.5)
+              << std::setw(12) << BenchmarkReport::percentile(latencies, 0.99)
+              << std::setw(12) << BenchmarkReport::percentile(latencies, 0.999) << std::endl;
+
+    pReport.add(std::move(result));
+}
+
+/*
+ * Returns the number of round trips to measure for block size 'pBlockSize' (fewer for large blocks).
+ */
+std::size_t getIterations(const std::size_t pBaseIterations, const std::size_t pBlockSize)
+{
+    return std::max<std::size_t>(pBaseIterations * 1024 / std::max<std::size_t>(pBlockSize, 1024), 100);
+}
+
+/*
+ * Returns 'pBlockSize' bytes with a simple pattern.
+ */
+std::vector<std::uint8_t> makeBlock(const std::size_t pBlockSize)
+{
+    std::vector<std::uint8_t> block(pBlockSize);
+
+    for (std::size_t i = 0; i < pBlockSize; ++i)
+        block[i] = static_cast<std::uint8_t>(i * 13 + 1);
+
+    return block;
+}
+
+//
+
+/*
+ * Measures TCP round trips via TCPSocketWrapper (with and without timeouts) and via a plain blocking socket.
+ */
+void benchTCP(BenchmarkReport& pReport, const MockEchoServer& pServer, const std::size_t pBaseIterations)
+{
+    SocketOptions socketOptions;
+    socketOptions.noDelay = true;
+
+    TCPSocketWrapper wrapper("127.0.0.1", pServer.getTcpPort(), "", "", ASIO::getIOContext(), socketOptions);
+    wrapper.init(timeout);
+
+    std::vector<std::uint8_t> readBuffer(tcpBlockSizes.back());
+
+    for (const std::size_t blockSize : tcpBlockSizes)
+    {
+        const std::vector<std::uint8_t> block = makeBlock(blockSize);
+        const std::size_t iterations = getIterations(pBaseIterations, blockSize);
+        const std::string sizeStr = std::to_string(blockSize) + " B";
+        const int size = static_cast<int>(blockSize);
+
+        measureRoundTrips(pReport, "TCP wrapper " + sizeStr, blockSize, iterations,
+                          [&wrapper, &block, &readBuffer, size]()
+                          {
+                              wrapper.write(block);
+                              (void)wrapper.readInto(readBuffer, size);
+                          });
+
+        measureRoundTrips(pReport, "TCP wrapper (timeout) " + sizeStr, blockSize, iterations,
+                          [&wrapper, &block, &readBuffer, size]()
+                          {
+                              wrapper.write(block, timeout);
+                              (void)wrapper.readInto(readBuffer, size, timeout);
+                          });
+    }
+
+    wrapper.close();
+
+    //Plain blocking socket as baseline (the echo server serves only one connection at a time, so connect afterwards)
+
+    MockEchoServer baselineServer;
+    baselineServer.start();
+
+    boost::asio::io_context ioContext;
+    boost::asio::ip::tcp::socket socket(ioContext);
+    socket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), baselineServer.getTcpPort()));
+    socket.set_option(boost::asio::ip::tcp::no_delay(true));
+
+    for (const std::size_t blockSize : tcpBlockSizes)
+    {
+        const std::vector<std::uint8_t> block = makeBlock(blockSize);
+
+        measureRoundTrips(pReport, "TCP plain ASIO " + std::to_string(blockSize) + " B", blockSize, getIterations(pBaseIterations, blockSize),
+                          [&socket, &block, &readBuffer, blockSize]()
+                          {
+                              boost::asio::write(socket, boost::asio::buffer(block));
+                              boost::asio::read(socket, boost::asio::buffer(readBuffer.data(), blockSize));
+                          });
+    }
+}
+
+/*
+ * Measures UDP round trips via UDPSocketWrapper (with and without timeouts) and via a plain blocking socket.
+ */
+void benchUDP(BenchmarkReport& pReport, const MockEchoServer& pServer, const std::size_t pBaseIterations)
+{
+    UDPSocketWrapper wrapper("127.0.0.1", pServer.getUdpPort(), ASIO::getIOContext());
+    wrapper.init(timeout);
+
+    std::vector<std::uint8_t> readBuffer(udpBlockSizes.back());
+
+    for (const std::size_t blockSize : udpBlockSizes)
+    {
+        const std::vector<std::uint8_t> block = makeBlock(blockSize);
+        const std::size_t iterations = getIterations(pBaseIterations, blockSize);
+        const std::string sizeStr = std::to_string(blockSize) + " B";
+
+        measureRoundTrips(pReport, "UDP wrapper " + sizeStr, blockSize, iterations,
+                          [&wrapper, &block, &readBuffer]()
+                          {
+                              wrapper.write(block);
+                              (void)wrapper.readInto(readBuffer);
+                          });
+
+        measureRoundTrips(pReport, "UDP wrapper (timeout) " + sizeStr, blockSize, iterations,
+                          [&wrapper, &block, &readBuffer]()
+                          {
+                              wrapper.write(block, timeout);
+                              (void)wrapper.readInto(readBuffer, timeout);
+                          });
+    }
+
+    wrapper.close();
+
+    //Plain blocking socket as baseline
+
+    boost::asio::io_context ioContext;
+    boost::asio::ip::udp::socket socket(ioContext);
+    socket.connect(boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), pServer.getUdpPort()));
+
+    for (const std::size_t blockSize : udpBlockSizes)
+    {
+        const std::vector<std::uint8_t> block = makeBlock(blockSize);
+
+        measureRoundTrips(pReport, "UDP plain ASIO " + std::to_string(blockSize) + " B", blockSize, getIterations(pBaseIterations, blockSize),
+                          [&socket, &block, &readBuffer]()
+                          {
+                              socket.send(boost::asio::buffer(block));
+                              (void)socket.receive(boost::asio::buffer(readBuffer));
+                          });
+    }
+}
+
+} // namespace
+
+int main(int argc, const char** argv)
+{
+    bool quick = false;
+    std::string jsonFileName;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+
+        if (arg == "--quick")
+            quick = true;
+        else if (arg == "--json" && i + 1 < argc)
+            jsonFileName = argv[++i];
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--quick] [--json <file>]" << std::endl;
+            return 2;
+        }
+    }
+
+    const std::size_t baseIterations = quick ? 2000 : 50000;
+
+    Logger::setLogLevel(Logger::LogLevel::Warning);
+    Logger::addOutputCout();
+
+    try
+    {
+        Auxil::AsyncIORunner<1> ioRunner;
+        (void)ioRunner;
+
+        MockEchoServer server;
+        server.start();
+
+        BenchmarkReport report(argv[0], quick);
+
+        printHeader();
+
+        benchTCP(report, server, baseIterations);
+        benchUDP(report, server, baseIterations);
+
+        if (!jsonFileName.empty())
+            report.writeJSON(jsonFileName);
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << "Benchmark failed: " << exc.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,370 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "benchmarkreport.h"
+
+#include <casil/auxil.h>
+#include <casil/device.h>
+#include <casil/layerconfig.h>
+#include <casil/logger.h>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using casil::Device;
+using casil::LayerConfig;
+using casil::Logger;
+
+namespace Auxil = casil::Auxil;
+
+//Measure the startup phases of a device (YAML parsing, component construction, configuration access, initialization)
+//for synthetic configurations with many components and large register field trees (using dummy interfaces):
+// - Run "CasilStartupBenchmarks" for the full set of scenarios
+// - Run "CasilStartupBenchmarks --quick" for a short smoke run with only the smaller scenarios
+// - Run "CasilStartupBenchmarks --interfaces N --drivers M --registers K --fields F" for a single custom scenario
+// - Add "--dump-yaml <file>" to write the (last) generated configuration, e.g. to profile it with an external tool
+// - Add "--json <file>" to additionally write the results in the common JSON format (see BenchmarkReport)
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct Scenario
+{
+    std::string name;
+    std::size_t numInterfaces;
+    std::size_t numDrivers;
+    std::size_t numRegisters;
+    std::size_t numFields;      //Per register; each field has two nested sub-fields
+};
+
+/*
+ * Returns the peak resident set size of the process so far in MiB (zero if unknown).
+ */
+double getPeakMemory()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters {};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return static_cast<double>(counters.PeakWorkingSetSize) / (1024. * 1024.);
+#else
+    rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    return static_cast<double>(usage.ru_maxrss) / (1024. * 1024.);     //Bytes
+#else
+    return static_cast<double>(usage.ru_maxrss) / 1024.;                //KiB
+#endif
+#endif
+}
+
+/*
+ * Runs 'pPhase' and prints its duration and the peak memory usage afterwards as phase 'pName' of scenario 'pScenario'.
+ * Adds the result as benchmark "<scenario>/<phase>" to 'pReport' and returns it.
+ */
+BenchmarkReport::Result& runPhase(BenchmarkReport& pReport, const Scenario& pScenario, const std::string_view pName,
+                                  const std::function<void()>& pPhase)
+{
+    const Clock::time_point start = Clock::now();
+
+    pPhase();
+
+    const double durationMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    const double peakMemory = getPeakMemory();
+
+    std::cout << "  " << std::left << std::setw(30) << pName << std::right << std::fixed << std::setprecision(3)
+              << std::setw(14) << durationMs << std::setprecision(1) << std::setw(16) << peakMemory << std::endl;
+
+    return pReport.add({pScenario.name + "/" + std::string(pName), 1, 1e6 * durationMs, 0, {{"peak_rss_mib", peakMemory}}});
+}
+
+/*
+ * Prints an additional quantity 'pValue' (in unit 'pUnit') of the phase 'pPhaseResult'
+ * and adds it to the latter as counter 'pCounterName'.
+ */
+void printDetail(BenchmarkReport::Result& pPhaseResult, const std::string_view pName, const double pValue,
+                 const std::string_view pUnit, const std::string& pCounterName)
+{
+    std::cout << "    " << std::left << std::setw(28) << pName << std::right << std::fixed << std::setprecision(3)
+              << std::setw(14) << pValue << " " << pUnit << std::endl;
+
+    pPhaseResult.counters.emplace_back(pCounterName, pValue);
+}
+
+/*
+ * Generates a device configuration for 'pScenario': interfaces of type DummyInterface, drivers of type DummyDriver
+ * (distributed round-robin over the interfaces) and standard registers (distributed round-robin over the drivers),
+ * each with a field tree of "numFields" fields of 8 bits with two nested 4 bit sub-fields plus an "init" value.
+ */
+std::string generateYAML(const Scenario& pScenario)
+{
+    std::string yaml;
+    yaml.reserve(pScenario.numRegisters * pScenario.numFields * 150 + 1024);
+
+    yaml += "transfer_layer:\n";
+    for (std::size_t i = 0; i < pScenario.numInterfaces; ++i)
+        yaml += "  - {name: intf" + std::to_string(i) + ", type: DummyInterface}\n";
+
+    yaml += "hw_drivers:\n";
+    for (std::size_t i = 0; i < pScenario.numDrivers; ++i)
+    {
+        yaml += "  - {name: drv" + std::to_string(i) + ", type: DummyDriver, "
+                "interface: intf" + std::to_string(i % pScenario.numInterfaces) + "}\n";
+    }
+
+    yaml += "registers:\n";
+    for (std::size_t i = 0; i < pScenario.numRegisters; ++i)
+    {
+        yaml += "  - name: reg" + std::to_string(i) + "\n"
+                "    type: StandardRegister\n"
+                "    hw_driver: drv" + std::to_string(i % pScenario.numDrivers) + "\n"
+                "    size: " + std::to_string(8 * pScenario.numFields) + "\n"
+                "    init: {FIELD0: 0x5A}\n"
+                "    fields:\n";
+
+        for (std::size_t j = 0; j < pScenario.numFields; ++j)
+        {
+            yaml += "      - name: FIELD" + std::to_string(j) + "\n"
+                    "        size: 8\n"
+                    "        offset: " + std::to_string(8 * j + 7) + "\n"
+                    "        fields:\n"
+                    "          - {name: HIGH, size: 4, offset: 7}\n"
+                    "          - {name: LOW, size: 4, offset: 3}\n";
+        }
+    }
+
+    return yaml;
+}
+
+/*
+ * Measures the startup phases for 'pScenario' (adding the results to 'pReport')
+ * and optionally writes the generated configuration to 'pDumpFileName'.
+ */
+void runScenario(BenchmarkReport& pReport, const Scenario& pScenario, const std::string& pDumpFileName)
+{
+    if (pScenario.numInterfaces == 0 || pScenario.numDrivers == 0 || pScenario.numFields == 0)
+        throw std::invalid_argument("Need at least one interface, driver and register field.");
+
+    std::cout << pScenario.name << " (" << pScenario.numInterfaces << " interfaces, " << pScenario.numDrivers << " drivers, "
+              << pScenario.numRegisters << " registers with " << pScenario.numFields << " fields each):" << std::endl;
+
+    std::string yaml;
+    boost::property_tree::ptree tree;
+    std::optional<Device> device;
+
+    BenchmarkReport::Result& generateResult = runPhase(pReport, pScenario, "generate YAML",
+                                                       [&yaml, &pScenario]() { yaml = generateYAML(pScenario); });
+    printDetail(generateResult, "(size)", static_cast<double>(yaml.size()) / 1024., "KiB", "yaml_kib");
+
+    if (!pDumpFileName.empty())
+    {
+        std::ofstream file(pDumpFileName);
+        file << yaml;
+
+        if (!file.good())
+            throw std::runtime_error("Could not write configuration to \"" + pDumpFileName + "\".");
+    }
+
+    runPhase(pReport, pScenario, "Auxil::propertyTreeFromYAML", [&yaml, &tree]() { tree = Auxil::propertyTreeFromYAML(yaml); });
+
+    //Read each register's name and size and each (top-level) field's name and size, as components do during construction
+
+    std::size_t numAccesses = 0;
+
+    const std::function<void()> configAccess = [&tree, &pScenario, &numAccesses]()
+    {
+        const LayerConfig config(tree);
+
+        std::uint64_t checksum = 0;
+
+        for (std::size_t i = 0; i < pScenario.numRegisters; ++i)
+        {
+            const std::string regKey = "registers.#" + std::to_string(i);
+
+            checksum += config.getStr(regKey + ".name").size() + config.getUInt(regKey + ".size");
+            numAccesses += 2;
+
+            for (std::size_t j = 0; j < pScenario.numFields; ++j)
+            {
+                const std::string fieldKey = regKey + ".fields.#" + std::to_string(j);
+
+                checksum += config.getStr(fieldKey + ".name").size() + config.getUInt(fieldKey + ".size");
+                numAccesses += 2;
+            }
+        }
+
+        if (checksum == 0)
+            throw std::runtime_error("Unexpected configuration content.");
+    };
+
+    const Clock::time_point accessStart = Clock::now();
+    BenchmarkReport::Result& accessResult = runPhase(pReport, pScenario, "LayerConfig accessors", configAccess);
+    const double accessNs = std::chrono::duration<double, std::nano>(Clock::now() - accessStart).count();
+
+    printDetail(accessResult, "(per access)", accessNs / static_cast<double>(std::max<std::size_t>(numAccesses, 1)) * 1e-3, "us",
+                "per_access_us");
+
+    runPhase(pReport, pScenario, "Device::Device()", [&tree, &device]() { device.emplace(tree); });
+
+    runPhase(pReport, pScenario, "Device::init()", [&device]()
+                                                   {
+                                                       if (!device->init())
+                                                           throw std::runtime_error("Could not initialize device.");
+                                                   });
+
+    runPhase(pReport, pScenario, "Device::close()", [&device]()
+                                                    {
+                                                        if (!device->close())
+                                                            throw std::runtime_error("Could not close device.");
+                                                    });
+
+    runPhase(pReport, pScenario, "Device::~Device()", [&device]() { device.reset(); });
+
+    std::cout << std::endl;
+}
+
+/*
+ * Parses the unsigned integer command line argument 'pArg'.
+ */
+std::size_t parseCount(const std::string_view pArg)
+{
+    std::size_t value = 0;
+
+    const auto [ptr, ec] = std::from_chars(pArg.data(), pArg.data() + pArg.size(), value);
+
+    if (ec != std::errc() || ptr != pArg.data() + pArg.size())
+        throw std::invalid_argument("Invalid count \"" + std::string(pArg) + "\".");
+
+    return value;
+}
+
+} // namespace
+
+int main(int argc, const char** argv)
+{
+    bool quick = false;
+    std::string dumpFileName;
+    std::string jsonFileName;
+    std::optional<Scenario> customScenario;
+
+    Logger::setLogLevel(Logger::LogLevel::Warning);
+    Logger::addOutputCout();
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            const bool hasValue = (i + 1 < argc);
+
+            if (arg == "--quick")
+                quick = true;
+            else if (arg == "--dump-yaml" && hasValue)
+                dumpFileName = argv[++i];
+            else if (arg == "--json" && hasValue)
+                jsonFileName = argv[++i];
+            else if ((arg == "--interfaces" || arg == "--drivers" || arg == "--registers" || arg == "--fields") && hasValue)
+            {
+                if (!customScenario)
+                    customScenario = Scenario{"custom", 1, 1, 1, 1};
+
+                const std::size_t count = parseCount(argv[++i]);
+
+                if (arg == "--interfaces")
+                    customScenario->numInterfaces = count;
+                else if (arg == "--drivers")
+                    customScenario->numDrivers = count;
+                else if (arg == "--registers")
+                    customScenario->numRegisters = count;
+                else
+                    customScenario->numFields = count;
+            }
+            else
+            {
+                std::cerr << "Usage: " << argv[0] << " [--quick] [--dump-yaml <file>] [--json <file>] "
+                                                     "[--interfaces N] [--drivers M] [--registers K] [--fields F]" << std::endl;
+                return 2;
+            }
+        }
+
+        std::vector<Scenario> scenarios;
+
+        if (customScenario)
+            scenarios.push_back(customScenario.value());
+        else
+        {
+            scenarios = {{"small",  1,  4,  16, 16},
+                         {"medium", 4, 32, 256, 64}};
+
+            if (!quick)
+            {
+                scenarios.push_back({"wide",   1,   1,    8, 4096});
+                scenarios.push_back({"large", 16, 128, 1024,   64});
+            }
+        }
+
+        //Note: peak memory is process-wide and can only grow, hence scenarios are ordered by (roughly) increasing size
+        std::cout << "  " << std::left << std::setw(30) << "Phase" << std::right << std::setw(14) << "Time [ms]"
+                  << std::setw(16) << "Peak RSS [MiB]" << std::endl << std::endl;
+
+        BenchmarkReport report(argv[0], quick);
+
+        for (const Scenario& scenario : scenarios)
+            runScenario(report, scenario, dumpFileName);
+
+        if (!jsonFileName.empty())
+            report.writeJSON(jsonFileName);
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << "Benchmark failed: " << exc.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,199 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "udpimpairmentproxy.h"
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+
+#include <utility>
+
+/*
+ * Creates the proxy forwarding to localhost port 'pTargetPort' with impairments 'pImpairments' and random seed 'pSeed'
+ * and binds its UDP socket to an ephemeral localhost port.
+ */
+UDPImpairmentProxy::UDPImpairmentProxy(const std::uint16_t pTargetPort, const Impairments& pImpairments, const std::uint64_t pSeed) :
+    impairments(pImpairments),
+    ioContext(),
+    socket(ioContext, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0)),
+    targetEndpoint(boost::asio::ip::address_v4::loopback(), pTargetPort),
+    clientEndpoint(),
+    ioThread(),
+    recvBuffer(),
+    recvEndpoint(),
+    randomGenerator(pSeed),
+    forwardedCnt(0),
+    droppedCnt(0),
+    duplicatedCnt(0),
+    reorderedCnt(0)
+{
+}
+
+/*
+ * Stops forwarding datagrams (see stop()).
+ */
+UDPImpairmentProxy::~UDPImpairmentProxy()
+{
+    stop();
+}
+
+//Public
+
+std::uint16_t UDPImpairmentProxy::getPort() const
+{
+    return socket.local_endpoint().port();
+}
+
+//
+
+/*
+ * Starts forwarding datagrams on the own IO thread.
+ */
+void UDPImpairmentProxy::start()
+{
+    if (ioThread.joinable())
+        return;
+
+    receive();
+
+    ioThread = std::thread([this](){ ioContext.run(); });
+}
+
+/*
+ * Stops the IO thread (discarding all held back datagrams) and closes the socket.
+ */
+void UDPImpairmentProxy::stop()
+{
+    if (!ioThread.joinable())
+        return;
+
+    ioContext.stop();
+    ioThread.join();
+
+    boost::system::error_code ec;
+    socket.close(ec);
+}
+
+//
+
+UDPImpairmentProxy::Statistics UDPImpairmentProxy::getStatistics() const
+{
+    return Statistics{forwardedCnt, droppedCnt, duplicatedCnt, reorderedCnt};
+}
+
+//Private
+
+/*
+ * Receives the next datagram and forwards it to the target or (if coming from the target) back to the client.
+ */
+void UDPImpairmentProxy::receive()
+{
+    socket.async_receive_from(boost::asio::buffer(recvBuffer), recvEndpoint,
+                              [this](const boost::system::error_code& pErrorCode, const std::size_t pSize)
+                              {
+                                  if (pErrorCode == boost::asio::error::operation_aborted)
+                                      return;
+
+                                  if (!pErrorCode)
+                                  {
+                                      const std::vector<std::uint8_t> datagram(recvBuffer.begin(), recvBuffer.begin() + pSize);
+
+                                      if (recvEndpoint == targetEndpoint)
+                                      {
+                                          if (clientEndpoint.port() != 0)
+                                              forward(datagram, clientEndpoint);
+                                      }
+                                      else
+                                      {
+                                          clientEndpoint = recvEndpoint;
+                                          forward(datagram, targetEndpoint);
+                                      }
+                                  }
+
+                                  receive();
+                              });
+}
+
+/*
+ * Applies the configured impairments to 'pDatagram' and sends the (possibly duplicated) datagram to 'pDestination'.
+ */
+void UDPImpairmentProxy::forward(const std::vector<std::uint8_t>& pDatagram, const boost::asio::ip::udp::endpoint& pDestination)
+{
+    std::bernoulli_distribution lossDist(impairments.lossProbability);
+    std::bernoulli_distribution duplicateDist(impairments.duplicateProbability);
+    std::bernoulli_distribution reorderDist(impairments.reorderProbability);
+    std::uniform_int_distribution<std::chrono::microseconds::rep> jitterDist(0, impairments.jitter.count());
+
+    if (lossDist(randomGenerator))
+    {
+        ++droppedCnt;
+        return;
+    }
+
+    const int copies = duplicateDist(randomGenerator) ? 2 : 1;
+
+    if (copies == 2)
+        ++duplicatedCnt;
+
+    const auto datagram = std::make_shared<const std::vector<std::uint8_t>>(pDatagram);
+
+    for (int i = 0; i < copies; ++i)
+    {
+        std::chrono::microseconds delay = impairments.delay + std::chrono::microseconds(jitterDist(randomGenerator));
+
+        if (reorderDist(randomGenerator))
+        {
+            ++reorderedCnt;
+            delay += impairments.reorderDelay;
+        }
+
+        send(datagram, pDestination, delay);
+    }
+}
+
+/*
+ * Sends 'pDatagram' to 'pDestination' immediately or (if positive) after 'pDelay'.
+ */
+void UDPImpairmentProxy::send(std::shared_ptr<const std::vector<std::uint8_t>> pDatagram,
+                              const boost::asio::ip::udp::endpoint& pDestination, const std::chrono::microseconds pDelay)
+{
+    if (pDelay.count() <= 0)
+    {
+        boost::system::error_code ec;
+        socket.send_to(boost::asio::buffer(*pDatagram), pDestination, 0, ec);
+
+        if (!ec)
+            ++forwardedCnt;
+
+        return;
+    }
+
+    auto timer = std::make_shared<boost::asio::steady_timer>(ioContext, pDelay);
+
+    timer->async_wait([this, timer, datagram = std::move(pDatagram), pDestination](const boost::system::error_code& pErrorCode)
+                      {
+                          if (!pErrorCode)
+                              send(datagram, pDestination, std::chrono::microseconds(0));
+                      });
+}
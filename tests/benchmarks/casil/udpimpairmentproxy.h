@@ -0,0 +1,115 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASILBENCHMARKS_UDPIMPAIRMENTPROXY_H
+#define CASILBENCHMARKS_UDPIMPAIRMENTPROXY_H
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+/*!
+ * \brief In-process %UDP proxy that impairs the forwarded datagrams for stress testing.
+ *
+ * Forwards every datagram received from a client to a fixed localhost target port and every datagram received
+ * from the target back to the (last seen) client. Independently for each datagram and direction, the datagram
+ * can be dropped, duplicated, delayed (fixed delay plus uniform jitter) or "reordered" (held back by an additional
+ * delay such that it arrives after later datagrams or only after the receiver already gave up on it), as configured
+ * by an Impairments profile. The random decisions use a seeded generator so that runs are reproducible.
+ *
+ * Uses an own IO context served by a single own thread and binds to an ephemeral localhost port, see getPort().
+ */
+class UDPImpairmentProxy
+{
+public:
+    /*!
+     * \brief Probabilities and delays applied to every forwarded datagram.
+     */
+    struct Impairments
+    {
+        double lossProbability = 0;                             ///< Probability to drop a datagram.
+        double duplicateProbability = 0;                        ///< Probability to forward a datagram twice.
+        std::chrono::microseconds delay {0};                    ///< Fixed forwarding delay.
+        std::chrono::microseconds jitter {0};                   ///< Maximum additional (uniformly distributed) forwarding delay.
+        double reorderProbability = 0;                          ///< Probability to hold back a datagram by \ref reorderDelay.
+        std::chrono::microseconds reorderDelay {0};             ///< Additional delay of held back datagrams.
+    };
+
+    /*!
+     * \brief Counters of the applied impairments.
+     */
+    struct Statistics
+    {
+        std::uint64_t forwarded;                                ///< Number of forwarded datagrams (including duplicates).
+        std::uint64_t dropped;                                  ///< Number of dropped datagrams.
+        std::uint64_t duplicated;                               ///< Number of duplicated datagrams.
+        std::uint64_t reordered;                                ///< Number of held back datagrams.
+    };
+
+public:
+    UDPImpairmentProxy(std::uint16_t pTargetPort, const Impairments& pImpairments, std::uint64_t pSeed);
+    ~UDPImpairmentProxy();
+    //
+    std::uint16_t getPort() const;                          ///< Get the bound %UDP port for the client side.
+    //
+    void start();                                           ///< Start forwarding datagrams.
+    void stop();                                            ///< Stop forwarding datagrams.
+    //
+    Statistics getStatistics() const;                       ///< Get the impairment counters.
+
+private:
+    void receive();
+    void forward(const std::vector<std::uint8_t>& pDatagram, const boost::asio::ip::udp::endpoint& pDestination);
+    void send(std::shared_ptr<const std::vector<std::uint8_t>> pDatagram, const boost::asio::ip::udp::endpoint& pDestination,
+              std::chrono::microseconds pDelay);
+
+private:
+    const Impairments impairments;
+    //
+    boost::asio::io_context ioContext;
+    boost::asio::ip::udp::socket socket;
+    const boost::asio::ip::udp::endpoint targetEndpoint;
+    boost::asio::ip::udp::endpoint clientEndpoint;
+    std::thread ioThread;
+    //
+    std::array<std::uint8_t, 65535> recvBuffer;
+    boost::asio::ip::udp::endpoint recvEndpoint;
+    //
+    std::mt19937_64 randomGenerator;
+    //
+    std::atomic_uint64_t forwardedCnt;
+    std::atomic_uint64_t droppedCnt;
+    std::atomic_uint64_t duplicatedCnt;
+    std::atomic_uint64_t reorderedCnt;
+};
+
+#endif // CASILBENCHMARKS_UDPIMPAIRMENTPROXY_H
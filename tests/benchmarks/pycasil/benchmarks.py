@@ -0,0 +1,387 @@
+##################################################################################################
+#
+# Copyright (C) 2025 M. Frohne
+#
+# This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+#
+# Casil is free software: you can redistribute it and/or modify it
+# under the terms of the GNU Affero General Public License as published
+# by the Free Software Foundation, either version 3 of the License,
+# or (at your option) any later version.
+#
+# Casil is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty
+# of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU Affero General Public License for more details.
+#
+# You should have received a copy of the GNU Affero General Public License
+# along with Casil. If not, see <https://www.gnu.org/licenses/>.
+#
+##################################################################################################
+
+# Measure the cost of driving Casil through PyCasil (binding overhead on top of the C++ benchmarks, i.e. argument/result
+# conversions, attribute dispatch and temporary field objects) against DummyMuxedInterface and SimMuxed:
+# - Run "python3 benchmarks.py" (with PyCasil in the module search path) for the full benchmark set
+# - Run "python3 benchmarks.py --quick" for a short smoke run with reduced measurement times
+# - Add "--json <file>" to additionally write the results in the common JSON format of the C++ benchmarks
+#   (see tests/benchmarks/casil/benchmarkreport.h), such that CasilBenchCompare can be used for the results
+# - Build PyCasil with CASIL_ENABLE_ALLOCATION_COUNTING to additionally report C++ heap allocations per iteration
+
+import datetime
+import json
+import math
+import os
+import platform
+import socket
+import sys
+import time
+
+import PyCasil as pcs
+
+REGISTER_SIZES = [1024, 65536, 1048576]
+TRANSFER_SIZES = [4, 256, 65536]
+FIFO_BLOCK_SIZES = [4096, 65536, 1048576]
+CPU_FEATURES = [("sse2", "sse2"), ("sse4_2", "sse4.2"), ("popcnt", "popcnt"), ("avx", "avx"), ("avx2", "avx2"),
+                ("bmi2", "bmi2"), ("avx512f", "avx512f"), ("avx512bw", "avx512bw")]   # (/proc/cpuinfo flag, report name)
+
+MAX_ITERATIONS = 1 << 30
+
+FIFO_RATE = 1e10    # FIFO fill rate of SimMuxed in words per second (fast enough to always fill the largest FIFO block)
+
+
+class BenchmarkReport:
+    """Collects benchmark results and writes them in the same JSON format as the C++ BenchmarkReport."""
+
+    def __init__(self, executable, quick):
+        self.executable = executable
+        self.quick = quick
+        self.results = []
+
+    def add(self, name, iterations, real_time_ns, cpu_time_ns, counters):
+        self.results.append({"name": name, "iterations": iterations, "real_time": real_time_ns, "cpu_time": cpu_time_ns,
+                             "counters": counters})
+
+    def write_json(self, file_name):
+        context = {"date": datetime.datetime.now().strftime("%Y-%m-%dT%H:%M:%S"),
+                   "host_name": socket.gethostname() or "unknown",
+                   "executable": self.executable,
+                   "num_cpus": os.cpu_count() or 0,
+                   "cpu_model": get_cpu_model(),
+                   "cpu_features": get_cpu_features(),
+                   "os": platform.system() + " " + platform.release() + " (" + platform.machine() + ")",
+                   "compiler": platform.python_implementation() + " " + platform.python_version(),
+                   "library_build_type": "unknown",
+                   "casil_version": pcs.Version.toString(),
+                   "casil_commit": "unknown",
+                   "simd_kernel_target": pcs.Bytes.simdKernelTarget(),
+                   "quick": self.quick}
+
+        benchmarks = []
+
+        for result in self.results:
+            entry = {"name": result["name"],
+                     "run_name": result["name"],
+                     "run_type": "iteration",
+                     "iterations": result["iterations"],
+                     "real_time": result["real_time"],
+                     "cpu_time": result["cpu_time"] if result["cpu_time"] != 0 else result["real_time"],
+                     "time_unit": "ns"}
+
+            for counter_name, value in result["counters"]:
+                entry[counter_name] = value if math.isfinite(value) else 0.
+
+            benchmarks.append(entry)
+
+        with open(file_name, "w") as file:
+            json.dump({"context": context, "benchmarks": benchmarks}, file, indent=2)
+            file.write("\n")
+
+
+def get_cpu_model():
+    """Returns the CPU model name from /proc/cpuinfo (Linux only, "unknown" otherwise)."""
+    try:
+        with open("/proc/cpuinfo") as cpu_info:
+            for line in cpu_info:
+                if line.startswith("model name") and ":" in line:
+                    return line.split(":", 1)[1].strip()
+    except OSError:
+        pass
+    return "unknown"
+
+
+def get_cpu_features():
+    """Returns the performance relevant instruction set extensions from /proc/cpuinfo (same set as the C++ benchmarks)."""
+    try:
+        with open("/proc/cpuinfo") as cpu_info:
+            for line in cpu_info:
+                if line.startswith("flags") and ":" in line:
+                    flags = set(line.split(":", 1)[1].split())
+                    return [name for flag, name in CPU_FEATURES if flag in flags]
+    except OSError:
+        pass
+    return []
+
+
+def run_benchmark(report, name, min_time, bytes_per_iteration, body):
+    """Runs 'body' in batches of growing iteration counts until a batch takes at least 'min_time' seconds and
+    records the per-iteration times of the final batch as 'name' in 'report' (see runBenchmark() of the C++ benchmarks).
+    'bytes_per_iteration' (if non-zero) is used to additionally record the throughput."""
+    iterations = 1
+
+    while True:
+        allocs_start = pcs.Allocations.getThreadCounts()
+        cpu_start = time.process_time()
+        start = time.perf_counter()
+
+        for i in range(iterations):
+            body(i)
+
+        real_time = time.perf_counter() - start
+        cpu_time = time.process_time() - cpu_start
+        allocs_end = pcs.Allocations.getThreadCounts()
+
+        if real_time >= min_time or iterations >= MAX_ITERATIONS:
+            real_time_ns = 1e9 * real_time / iterations
+            cpu_time_ns = 1e9 * cpu_time / iterations
+            bytes_per_second = bytes_per_iteration * iterations / real_time if (bytes_per_iteration != 0 and real_time > 0) else 0
+            allocs_per_iteration = (allocs_end.allocations - allocs_start.allocations) / iterations
+            alloc_bytes_per_iteration = (allocs_end.bytes - allocs_start.bytes) / iterations
+
+            counters = []
+            line = f"{name:<44}{real_time_ns:16.1f}{cpu_time_ns:16.1f}{iterations:14d}"
+
+            if bytes_per_second != 0:
+                counters.append(("bytes_per_second", bytes_per_second))
+                line += f"{bytes_per_second / (1024. * 1024.):14.1f}"
+            elif pcs.Allocations.isAvailable():
+                line += f"{'-':>14}"
+
+            if pcs.Allocations.isAvailable():
+                counters.append(("allocs_per_iter", allocs_per_iteration))
+                counters.append(("alloc_bytes_per_iter", alloc_bytes_per_iteration))
+                line += f"{allocs_per_iteration:14.1f}{alloc_bytes_per_iteration:16.1f}"
+
+            print(line, flush=True)
+
+            report.add(name, iterations, real_time_ns, cpu_time_ns, counters)
+
+            return
+
+        # Aim directly for the minimum time if the batch was long enough to extrapolate, otherwise just double
+        if real_time > min_time / 100:
+            iterations = max(2 * iterations, int(1.2 * min_time / real_time * iterations))
+        else:
+            iterations *= 2
+
+        iterations = min(iterations, MAX_ITERATIONS)
+
+
+def print_header():
+    print("Byte kernels: " + pcs.Bytes.simdKernelTarget() + "\n")
+
+    line = f"{'Benchmark':<44}{'Time [ns]':>16}{'CPU [ns]':>16}{'Iterations':>14}{'MiB/s':>14}"
+
+    if pcs.Allocations.isAvailable():
+        line += f"{'Allocs/iter':>14}{'Bytes/iter':>16}"
+
+    print(line)
+
+
+def init_device(device):
+    if not device.init():
+        raise RuntimeError("Could not initialize device.")
+
+
+def close_device(device):
+    if not device.close():
+        raise RuntimeError("Could not close device.")
+
+#
+
+
+def bench_device(report, min_time):
+    """Measures construction (from YAML and from dict) and initialization of devices with interface, driver and register."""
+    for intf_type in ["DummyMuxedInterface", "SimMuxed"]:
+        yaml_config = ("{transfer_layer: [{name: intf, type: " + intf_type + "}],"
+                       "hw_drivers: [{name: gpio, type: GPIO, interface: intf, base_addr: 0x0, size: 64}],"
+                       "registers: [{name: reg, type: StandardRegister, hw_driver: gpio, size: 64,"
+                                    "fields: [{name: HEAD, size: 16, offset: 63}, {name: TAIL, size: 16, offset: 15}]}]}")
+        dict_config = {"transfer_layer": [{"name": "intf", "type": intf_type}],
+                       "hw_drivers": [{"name": "gpio", "type": "GPIO", "interface": "intf", "base_addr": 0x0, "size": 64}],
+                       "registers": [{"name": "reg", "type": "StandardRegister", "hw_driver": "gpio", "size": 64,
+                                      "fields": [{"name": "HEAD", "size": 16, "offset": 63},
+                                                 {"name": "TAIL", "size": 16, "offset": 15}]}]}
+
+        run_benchmark(report, "Device/constructYAML/" + intf_type, min_time, 0, lambda _: pcs.Device(yaml_config))
+        run_benchmark(report, "Device/constructDict/" + intf_type, min_time, 0, lambda _: pcs.Device(dict_config))
+
+        def construct_and_init(_):
+            device = pcs.Device(yaml_config)
+            init_device(device)
+            close_device(device)
+
+        run_benchmark(report, "Device/constructInit/" + intf_type, min_time, 0, construct_and_init)
+
+
+def bench_interface(report, min_time):
+    """Measures plain bus reads and writes of different sizes (bytes object conversion in both directions)."""
+    for intf_type in ["DummyMuxedInterface", "SimMuxed"]:
+        device = pcs.Device("{transfer_layer: [{name: intf, type: " + intf_type + "}], hw_drivers: [], registers: []}")
+        init_device(device)
+
+        intf = device.interface("intf")
+
+        for size in TRANSFER_SIZES:
+            data = bytes(i % 256 for i in range(size))
+
+            run_benchmark(report, "Interface/write/" + intf_type + "/" + str(size), min_time, size,
+                          lambda _: intf.write(0, data))
+            run_benchmark(report, "Interface/read/" + intf_type + "/" + str(size), min_time, size,
+                          lambda _: intf.read(0, size))
+
+        close_device(device)
+
+
+def bench_fifo(report, min_time):
+    """Measures draining the (always filled) SimMuxed FIFO into bytes objects and into pooled buffers."""
+    device = pcs.Device({"transfer_layer": [{"name": "intf", "type": "SimMuxed", "init": {"fifo_rate": FIFO_RATE}}],
+                         "hw_drivers": [], "registers": []})
+    init_device(device)
+
+    intf = device.interface("intf")
+    fifo_addr = pcs.Layers.TL.SimMuxed.baseAddrDataLimit
+
+    for block_size in FIFO_BLOCK_SIZES:
+        def read(_):
+            if len(intf.read(fifo_addr, block_size)) != block_size:
+                raise RuntimeError("FIFO rate too low for the benchmark.")
+
+        def read_pooled(_):
+            if len(memoryview(intf.readPooled(fifo_addr, block_size))) != block_size:
+                raise RuntimeError("FIFO rate too low for the benchmark.")
+
+        run_benchmark(report, "Fifo/read/" + str(block_size), min_time, block_size, read)
+        run_benchmark(report, "Fifo/readPooled/" + str(block_size), min_time, block_size, read_pooled)
+
+    close_device(device)
+
+
+def bench_register_driver(report, min_time):
+    """Measures value and byte array register access of a GPIO driver by name, via attribute dispatch and via get/set."""
+    for intf_type in ["DummyMuxedInterface", "SimMuxed"]:
+        device = pcs.Device("{transfer_layer: [{name: intf, type: " + intf_type + "}],"
+                            "hw_drivers: [{name: gpio, type: GPIO, interface: intf, base_addr: 0x0, size: 64}],"
+                            "registers: []}")
+        init_device(device)
+
+        gpio = device.driver("gpio")
+        output = bytes(range(8))
+        suffix = "/" + intf_type
+
+        run_benchmark(report, "RegisterDriver/getValue" + suffix, min_time, 0, lambda _: gpio.getValue("VERSION"))
+        run_benchmark(report, "RegisterDriver/getItem" + suffix, min_time, 0, lambda _: gpio["VERSION"])
+        run_benchmark(report, "RegisterDriver/getAttr" + suffix, min_time, 0, lambda _: gpio.VERSION)
+        run_benchmark(report, "RegisterDriver/setBytes" + suffix, min_time, 8, lambda _: gpio.setBytes("OUTPUT", output))
+        run_benchmark(report, "RegisterDriver/setItem" + suffix, min_time, 8, lambda _: gpio.__setitem__("OUTPUT", output))
+        run_benchmark(report, "RegisterDriver/getBytes" + suffix, min_time, 8, lambda _: gpio.getBytes("OUTPUT"))
+
+        close_device(device)
+
+
+def bench_standard_register(report, min_time):
+    """Measures field access, slicing, readback access, conversion and writing of standard registers of different sizes
+    with a three-field layout (see benchStandardRegister() of the C++ micro-benchmarks), driven by a GPIO driver on SimMuxed."""
+    for bit_size in REGISTER_SIZES:
+        byte_size = bit_size // 8
+        size_str = str(bit_size)
+
+        device = pcs.Device("{transfer_layer: [{name: mem, type: SimMuxed, init: {mem_size: " + str(1 + 3 * byte_size) + "}}],"
+                            "hw_drivers: [{name: gpio, type: GPIO, interface: mem, base_addr: 0x0, size: " + size_str + "}],"
+                            "registers: []}")
+        init_device(device)
+
+        reg_config = pcs.LayerConfig.fromYAML("{size: " + size_str + ", fields: ["
+                                                  "{name: HEAD, size: 16, offset: " + str(bit_size - 1) + "},"
+                                                  "{name: BODY, size: " + str(bit_size - 32) + ", offset: " + str(bit_size - 17) + "},"
+                                                  "{name: TAIL, size: 16, offset: 15}]}")
+
+        gpio = device.driver("gpio")
+
+        run_benchmark(report, "StandardRegister/construct/" + size_str, min_time, 0,
+                      lambda _: pcs.Layers.RL.StandardRegister("reg", gpio, reg_config))
+
+        reg = pcs.Layers.RL.StandardRegister("reg", gpio, reg_config)
+
+        if not reg.init():
+            raise RuntimeError("Could not initialize register.")
+
+        body = reg["BODY"]
+
+        def set_field(i):
+            reg["HEAD"] = i & 0xFFFF
+
+        def set_slice(i):
+            body[11:4] = i & 0xFF
+
+        def set_slice_view(i):
+            body.view(11, 4).set(i & 0xFF)
+
+        def write(i):
+            reg["TAIL"] = i & 0xFFFF
+            reg.write()
+
+        run_benchmark(report, "StandardRegister/setField/" + size_str, min_time, 0, set_field)
+        run_benchmark(report, "StandardRegister/getField/" + size_str, min_time, 0, lambda _: reg["HEAD"].toUInt())
+        run_benchmark(report, "StandardRegister/setSlice/" + size_str, min_time, 0, set_slice)
+        run_benchmark(report, "StandardRegister/setSliceView/" + size_str, min_time, 0, set_slice_view)
+        run_benchmark(report, "StandardRegister/readField/" + size_str, min_time, 0, lambda _: reg.readField("HEAD").toUInt())
+        run_benchmark(report, "StandardRegister/toArray/" + size_str, min_time, byte_size, lambda _: reg.getArray())
+        run_benchmark(report, "StandardRegister/write/" + size_str, min_time, byte_size, write)
+        run_benchmark(report, "StandardRegister/read/" + size_str, min_time, byte_size, lambda _: reg.read())
+
+        close_device(device)
+
+
+def main(argv):
+    quick = False
+    json_file_name = ""
+
+    i = 1
+    while i < len(argv):
+        if argv[i] == "--quick":
+            quick = True
+        elif argv[i] == "--json" and i + 1 < len(argv):
+            i += 1
+            json_file_name = argv[i]
+        else:
+            print("Usage: " + argv[0] + " [--quick] [--json <file>]", file=sys.stderr)
+            return 2
+        i += 1
+
+    min_time = 0.02 if quick else 0.5
+
+    pcs.Logger.setLogLevel(pcs.Logger.LogLevel.Warning)
+    pcs.Logger.addOutputCout()
+
+    try:
+        report = BenchmarkReport(argv[0], quick)
+
+        print_header()
+
+        bench_device(report, min_time)
+        bench_interface(report, min_time)
+        bench_fifo(report, min_time)
+        bench_register_driver(report, min_time)
+        bench_standard_register(report, min_time)
+
+        if json_file_name:
+            report.write_json(json_file_name)
+    except Exception as exc:
+        print("Benchmark failed: " + str(exc), file=sys.stderr)
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,153 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASILCOSIMTESTS_COSIMFIXTURE_H
+#define CASILCOSIMTESTS_COSIMFIXTURE_H
+
+#include "simfirmware.h"
+
+#include <casil/auxil.h>
+#include <casil/device.h>
+#include <casil/HL/Muxed/gpio.h>
+#include <casil/HL/Muxed/sitcpfifo.h>
+#include <casil/RL/standardregister.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*!
+ * \brief Test fixture with a started SimFirmware and an initialized Device that controls it with the real components.
+ *
+ * The device consists of the interface "intf" (TL::SiTCP with %TCP connection for FIFO data), the drivers "gpio" and
+ * "daq_ctrl" (HL::GPIO, see SimFirmware for the firmware modules), "fifo" (HL::SiTCPFifo) and the register "GPIO_REG"
+ * (RL::StandardRegister with fields "HIGH" and "LOW" on "gpio").
+ *
+ * The performance limits asserted by the tests can be overridden via environment variables (see getLimit()),
+ * e.g. to tighten them for a dedicated CI machine or to relax them for sanitizer builds.
+ */
+struct CoSimFixture
+{
+    using Clock = std::chrono::steady_clock;
+
+    CoSimFixture() :
+        firmware(),
+        ioRunner(),
+        device(makeDeviceConfig(firmware)),
+        gpio(dynamic_cast<casil::HL::GPIO&>(device.driver("gpio"))),
+        daqCtrl(dynamic_cast<casil::HL::GPIO&>(device.driver("daq_ctrl"))),
+        fifo(dynamic_cast<casil::HL::SiTCPFifo&>(device.driver("fifo"))),
+        reg(dynamic_cast<casil::RL::StandardRegister&>(device.reg("GPIO_REG")))
+    {
+        firmware.start();
+
+        if (!device.init())
+            throw std::runtime_error("Could not initialize co-simulation device.");
+    }
+    ~CoSimFixture()
+    {
+        device.close();
+    }
+    //
+    SimFirmware firmware;
+    casil::Auxil::AsyncIORunner<2> ioRunner;
+    casil::Device device;
+    casil::HL::GPIO& gpio;
+    casil::HL::GPIO& daqCtrl;
+    casil::HL::SiTCPFifo& fifo;
+    casil::RL::StandardRegister& reg;
+
+    /*
+     * Returns the device configuration for 'pFirmware' with additional SiTCP init options 'pInitOptions' (e.g. ", tcp_to_bus: true").
+     */
+    static std::string makeDeviceConfig(const SimFirmware& pFirmware, const std::string_view pInitOptions = "")
+    {
+        return "{transfer_layer: [{name: intf, type: SiTCP,"
+                                  "init: {ip: 127.0.0.1, udp_port: " + std::to_string(pFirmware.getUdpPort()) +
+                                         ", tcp_port: " + std::to_string(pFirmware.getTcpPort()) +
+                                         ", tcp_connection: true" + std::string(pInitOptions) + "}}],"
+                " hw_drivers: [{name: gpio, type: GPIO, interface: intf, base_addr: " + std::to_string(SimFirmware::gpioBaseAddr) +
+                                                                         ", size: " + std::to_string(SimFirmware::gpioSize) + "},"
+                              "{name: daq_ctrl, type: GPIO, interface: intf, base_addr: " + std::to_string(SimFirmware::daqCtrlBaseAddr) +
+                                                                             ", size: " + std::to_string(SimFirmware::daqCtrlSize) + "},"
+                              "{name: fifo, type: SiTCPFifo, interface: intf, base_addr: 0x200000000}],"
+                " registers: [{name: GPIO_REG, type: StandardRegister, hw_driver: gpio, size: 16,"
+                              "fields: [{name: HIGH, size: 8, offset: 15}, {name: LOW, size: 8, offset: 7}]}]}";
+    }
+
+    /*
+     * Returns the value of the environment variable 'pEnvName' as number, or 'pDefault' if it is not set (or not a number).
+     */
+    static double getLimit(const char *const pEnvName, const double pDefault)
+    {
+        const char *const getenvPtr = std::getenv(pEnvName);
+
+        if (getenvPtr == nullptr)
+            return pDefault;
+
+        char* end = nullptr;
+        const double value = std::strtod(getenvPtr, &end);
+
+        return (end != getenvPtr) ? value : pDefault;
+    }
+
+    /*
+     * Returns the 'pQuantile' (in [0, 1]) of the latencies 'pLatencies' (nearest rank).
+     */
+    static double percentile(std::vector<double> pLatencies, const double pQuantile)
+    {
+        if (pLatencies.empty())
+            return 0;
+
+        std::sort(pLatencies.begin(), pLatencies.end());
+
+        const std::size_t rank = static_cast<std::size_t>(std::ceil(pQuantile * static_cast<double>(pLatencies.size())));
+
+        return pLatencies[std::max<std::size_t>(rank, 1) - 1];
+    }
+
+    static double toMicroseconds(const Clock::duration pDuration)
+    {
+        return std::chrono::duration<double, std::micro>(pDuration).count();
+    }
+
+    /*
+     * Reports a measured value next to its limit (visible with "--log_level=message").
+     */
+    static void reportMeasurement(const std::string_view pName, const double pValue, const std::string_view pUnit, const double pLimit)
+    {
+        BOOST_TEST_MESSAGE(std::string(pName) + ": " + std::to_string(pValue) + " " + std::string(pUnit) +
+                           " (limit: " + std::to_string(pLimit) + " " + std::string(pUnit) + ")");
+    }
+};
+
+#endif // CASILCOSIMTESTS_COSIMFIXTURE_H
@@ -0,0 +1,445 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "simfirmware.h"
+
+#include <casil/bytes.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+
+#include <algorithm>
+
+/*
+ * Creates the simulated firmware with an additional delay 'pRBCPLatency' for every RBCP request
+ * and binds its UDP/TCP sockets to ephemeral localhost ports.
+ */
+SimFirmware::SimFirmware(const std::chrono::microseconds pRBCPLatency) :
+    rbcpLatency(pRBCPLatency),
+    gpio(gpioBaseAddr, gpioSize, gpioInputPattern),
+    daqCtrl(daqCtrlBaseAddr, daqCtrlSize, 0),
+    ioContext(),
+    udpSocket(ioContext, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0)),
+    tcpAcceptor(ioContext, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)),
+    tcpSocket(ioContext),
+    ioThread(),
+    udpRecvBuffer(),
+    udpRemoteEndpoint(),
+    udpSendBuffer(),
+    tcpRecvBuffer(),
+    tcpPending(),
+    tcpToBusSkipBytes(0),
+    tcpConnected(false),
+    fifoSending(false),
+    fifoWordsRequested(0),
+    fifoSendBuffer(),
+    fifoCounter(0),
+    fifoWordsSent(0),
+    rbcpRequests(0),
+    tcpToBusMessages(0)
+{
+}
+
+/*
+ * Stops serving requests (see stop()).
+ */
+SimFirmware::~SimFirmware()
+{
+    stop();
+}
+
+//Public
+
+std::uint16_t SimFirmware::getUdpPort() const
+{
+    return udpSocket.local_endpoint().port();
+}
+
+std::uint16_t SimFirmware::getTcpPort() const
+{
+    return tcpAcceptor.local_endpoint().port();
+}
+
+//
+
+/*
+ * Starts accepting a single TCP connection and serving RBCP requests on the own IO thread.
+ */
+void SimFirmware::start()
+{
+    if (ioThread.joinable())
+        return;
+
+    receiveUdp();
+    acceptTcp();
+
+    ioThread = std::thread([this](){ ioContext.run(); });
+}
+
+/*
+ * Stops the IO thread and closes all sockets.
+ */
+void SimFirmware::stop()
+{
+    if (!ioThread.joinable())
+        return;
+
+    ioContext.stop();
+    ioThread.join();
+
+    boost::system::error_code ec;
+    tcpSocket.close(ec);
+    tcpAcceptor.close(ec);
+    udpSocket.close(ec);
+}
+
+//
+
+std::size_t SimFirmware::getFifoWordsSent() const
+{
+    return fifoWordsSent.load();
+}
+
+std::size_t SimFirmware::getRBCPRequests() const
+{
+    return rbcpRequests.load();
+}
+
+std::size_t SimFirmware::getTcpToBusMessages() const
+{
+    return tcpToBusMessages.load();
+}
+
+//Private
+
+/*
+ * Creates a module with 'pSize' IOs at bus address 'pBaseAddr', whose disabled outputs read back as 'pInputPattern'.
+ */
+SimFirmware::GpioModule::GpioModule(const std::uint32_t pBaseAddr, const std::size_t pSize, const std::uint64_t pInputPattern) :
+    baseAddr(pBaseAddr),
+    numBytes((pSize + 7) / 8),
+    inputPattern(pInputPattern),
+    output(numBytes, 0),
+    outputEn(numBytes, 0)
+{
+}
+
+/*
+ * Returns the first bus address after the module's address range.
+ */
+std::uint32_t SimFirmware::GpioModule::endAddr() const
+{
+    return baseAddr + 1 + 3 * static_cast<std::uint32_t>(numBytes);
+}
+
+/*
+ * Reads the registers starting at bus address 'pAddr' into 'pData'; returns false if the range exceeds the module.
+ */
+bool SimFirmware::GpioModule::read(const std::uint32_t pAddr, const std::span<std::uint8_t> pData) const
+{
+    if (pAddr < baseAddr || pAddr + pData.size() > endAddr())
+        return false;
+
+    for (std::size_t i = 0; i < pData.size(); ++i)
+    {
+        const std::size_t regAddr = pAddr - baseAddr + i;
+
+        if (regAddr == 0)
+            pData[i] = 0;   //VERSION
+        else if (regAddr < 1 + numBytes)
+        {
+            //INPUT: enabled outputs looped back, input pattern elsewhere (byte 0 is most significant)
+            const std::size_t byteIdx = regAddr - 1;
+            const auto patternByte = static_cast<std::uint8_t>(inputPattern >> (8 * (numBytes - 1 - byteIdx)));
+            pData[i] = static_cast<std::uint8_t>((output[byteIdx] & outputEn[byteIdx]) | (patternByte & ~outputEn[byteIdx]));
+        }
+        else if (regAddr < 1 + 2 * numBytes)
+            pData[i] = output[regAddr - 1 - numBytes];
+        else
+            pData[i] = outputEn[regAddr - 1 - 2 * numBytes];
+    }
+
+    return true;
+}
+
+/*
+ * Writes 'pData' to the registers starting at bus address 'pAddr'; returns false if the range exceeds the module.
+ * Writing address zero resets the module (clears OUTPUT and OUTPUT_EN), INPUT is read-only.
+ */
+bool SimFirmware::GpioModule::write(const std::uint32_t pAddr, const std::span<const std::uint8_t> pData)
+{
+    if (pAddr < baseAddr || pAddr + pData.size() > endAddr())
+        return false;
+
+    for (std::size_t i = 0; i < pData.size(); ++i)
+    {
+        const std::size_t regAddr = pAddr - baseAddr + i;
+
+        if (regAddr == 0)
+        {
+            std::fill(output.begin(), output.end(), 0);
+            std::fill(outputEn.begin(), outputEn.end(), 0);
+        }
+        else if (regAddr < 1 + numBytes)
+            continue;
+        else if (regAddr < 1 + 2 * numBytes)
+            output[regAddr - 1 - numBytes] = pData[i];
+        else
+            outputEn[regAddr - 1 - 2 * numBytes] = pData[i];
+    }
+
+    return true;
+}
+
+/*
+ * Returns the OUTPUT register as (big endian) unsigned integer.
+ */
+std::uint64_t SimFirmware::GpioModule::outputWord() const
+{
+    std::uint64_t word = 0;
+
+    for (const std::uint8_t byte : output)
+        word = (word << 8) | byte;
+
+    return word;
+}
+
+//
+
+/*
+ * Reads 'pData.size()' bytes from the bus module mapped at 'pAddr'; returns false (bus error) if no module covers the range.
+ */
+bool SimFirmware::busRead(const std::uint32_t pAddr, const std::span<std::uint8_t> pData) const
+{
+    return gpio.read(pAddr, pData) || daqCtrl.read(pAddr, pData);
+}
+
+/*
+ * Writes 'pData' to the bus module mapped at 'pAddr'; returns false (bus error) if no module covers the range.
+ * Resetting "daq_ctrl" restarts the FIFO counter and completing a write of its OUTPUT register starts streaming FIFO data.
+ */
+bool SimFirmware::busWrite(const std::uint32_t pAddr, const std::span<const std::uint8_t> pData)
+{
+    if (gpio.write(pAddr, pData))
+        return true;
+
+    if (!daqCtrl.write(pAddr, pData))
+        return false;
+
+    const std::uint32_t outputEndAddr = daqCtrl.baseAddr + 1 + 2 * static_cast<std::uint32_t>(daqCtrl.numBytes);
+
+    if (pAddr == daqCtrl.baseAddr)
+        fifoCounter = 0;
+    if (pAddr < outputEndAddr && pAddr + pData.size() >= outputEndAddr)
+        streamFifo(daqCtrl.outputWord());
+
+    return true;
+}
+
+//
+
+void SimFirmware::receiveUdp()
+{
+    udpSocket.async_receive_from(boost::asio::buffer(udpRecvBuffer), udpRemoteEndpoint,
+                                 [this](const boost::system::error_code& pErrorCode, const std::size_t pSize)
+                                 {
+                                     if (pErrorCode)
+                                         return;
+
+                                     handleRBCPRequest(pSize);
+                                     receiveUdp();
+                                 });
+}
+
+/*
+ * Answers the RBCP request of size 'pSize' in the receive buffer like the SiTCP core does
+ * (after the configured firmware latency); unmapped accesses are answered with the bus error flag set.
+ */
+void SimFirmware::handleRBCPRequest(const std::size_t pSize)
+{
+    if (pSize < 8 || udpRecvBuffer[0] != 0xFFu)
+        return;
+
+    const bool readMode = (udpRecvBuffer[1] == 0xC0u);
+    const std::size_t len = udpRecvBuffer[3];
+    const std::uint32_t addr = casil::Bytes::composeUInt32(std::span<const std::uint8_t, 4>(udpRecvBuffer.begin() + 4, 4));
+
+    if (!readMode && pSize != len + 8)
+        return;
+
+    if (rbcpLatency.count() > 0)
+        std::this_thread::sleep_for(rbcpLatency);
+
+    udpSendBuffer.assign(udpRecvBuffer.begin(), udpRecvBuffer.begin() + 8);
+    udpSendBuffer[1] |= 0x08u;
+    udpSendBuffer.resize(8 + len, 0);
+
+    bool busOk;
+
+    if (readMode)
+        busOk = busRead(addr, std::span<std::uint8_t>(udpSendBuffer).subspan(8));
+    else
+    {
+        std::copy(udpRecvBuffer.begin() + 8, udpRecvBuffer.begin() + 8 + len, udpSendBuffer.begin() + 8);
+        busOk = busWrite(addr, std::span<const std::uint8_t>(udpSendBuffer).subspan(8));
+    }
+
+    if (!busOk)
+        udpSendBuffer[1] |= 0x01u;
+
+    boost::system::error_code ec;
+    udpSocket.send_to(boost::asio::buffer(udpSendBuffer), udpRemoteEndpoint, 0, ec);
+
+    ++rbcpRequests;
+}
+
+//
+
+void SimFirmware::acceptTcp()
+{
+    tcpAcceptor.async_accept(tcpSocket, [this](const boost::system::error_code& pErrorCode)
+                                        {
+                                            if (pErrorCode)
+                                                return;
+
+                                            tcpConnected = true;
+
+                                            receiveTcp();
+
+                                            if (fifoWordsRequested > 0 && !fifoSending)
+                                                sendFifoChunk();
+                                        });
+}
+
+void SimFirmware::receiveTcp()
+{
+    tcpSocket.async_read_some(boost::asio::buffer(tcpRecvBuffer),
+                              [this](const boost::system::error_code& pErrorCode, const std::size_t pSize)
+                              {
+                                  if (pErrorCode)
+                                      return;
+
+                                  tcpPending.insert(tcpPending.end(), tcpRecvBuffer.begin(), tcpRecvBuffer.begin() + pSize);
+                                  parseTcpToBus();
+                                  receiveTcp();
+                              });
+}
+
+/*
+ * Consumes all complete "tcp_to_bus" messages (little endian 16 bit length, little endian 32 bit address, data)
+ * from the pending TCP data and writes them to the bus. A length field of 0xFFFF marks the enable sequence.
+ */
+void SimFirmware::parseTcpToBus()
+{
+    std::size_t pos = 0;
+
+    while (true)
+    {
+        if (tcpToBusSkipBytes > 0)
+        {
+            const std::size_t skip = std::min(tcpToBusSkipBytes, tcpPending.size() - pos);
+
+            pos += skip;
+            tcpToBusSkipBytes -= skip;
+
+            if (tcpToBusSkipBytes > 0)
+                break;
+        }
+
+        if (tcpPending.size() - pos < 6)
+            break;
+
+        const std::size_t len = tcpPending[pos] | (static_cast<std::size_t>(tcpPending[pos + 1]) << 8);
+
+        if (len == 0xFFFFu)
+        {
+            tcpToBusSkipBytes = tcpToBusResetLength;
+            continue;
+        }
+
+        if (tcpPending.size() - pos < 6 + len)
+            break;
+
+        const std::uint32_t addr = casil::Bytes::composeUInt32(std::span<const std::uint8_t, 4>(tcpPending.begin() + pos + 2, 4),
+                                                               false);
+
+        busWrite(addr, std::span<const std::uint8_t>(tcpPending).subspan(pos + 6, len));
+
+        pos += 6 + len;
+        ++tcpToBusMessages;
+    }
+
+    tcpPending.erase(tcpPending.begin(), tcpPending.begin() + pos);
+}
+
+//
+
+/*
+ * Requests 'pNumWords' further FIFO words to be sent as soon as the TCP connection is established.
+ */
+void SimFirmware::streamFifo(const std::size_t pNumWords)
+{
+    fifoWordsRequested += pNumWords;
+
+    if (tcpConnected && !fifoSending)
+        sendFifoChunk();
+}
+
+/*
+ * Sends the next chunk of requested FIFO data (incrementing little endian 32 bit words) and re-arms itself until
+ * all requested words have been sent.
+ */
+void SimFirmware::sendFifoChunk()
+{
+    const std::size_t numWords = std::min(fifoWordsRequested, fifoChunkWords);
+
+    if (numWords == 0)
+    {
+        fifoSending = false;
+        return;
+    }
+
+    fifoSending = true;
+
+    fifoSendBuffer.resize(4 * numWords);
+
+    for (std::size_t i = 0; i < numWords; ++i)
+        casil::Bytes::composeBytesTo(fifoSendBuffer.begin() + 4 * i, false, fifoCounter++);
+
+    fifoWordsRequested -= numWords;
+
+    boost::asio::async_write(tcpSocket, boost::asio::buffer(fifoSendBuffer),
+                             [this](const boost::system::error_code& pErrorCode, const std::size_t pSize)
+                             {
+                                 fifoWordsSent += pSize / 4;
+
+                                 if (pErrorCode)
+                                 {
+                                     fifoSending = false;
+                                     return;
+                                 }
+
+                                 sendFifoChunk();
+                             });
+}
@@ -0,0 +1,149 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASILCOSIMTESTS_SIMFIRMWARE_H
+#define CASILCOSIMTESTS_SIMFIRMWARE_H
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+/*!
+ * \brief In-process simulation of a %SiTCP based basil firmware for co-simulation tests.
+ *
+ * Simulates the %SiTCP core in front of a basil bus, i.e. RBCP over %UDP, "tcp_to_bus" messages over %TCP
+ * and FIFO data streamed over the same %TCP connection, such that the real TL::SiTCP, HL::GPIO and HL::SiTCPFifo
+ * components can be tested end to end. The bus is populated with the following firmware modules:
+ *
+ * - "gpio" at \ref gpioBaseAddr: basil \e gpio module with \ref gpioSize IOs. Enabled outputs are looped back
+ *   to the inputs, the other inputs read the fixed pattern \ref gpioInputPattern.
+ * - "daq_ctrl" at \ref daqCtrlBaseAddr: basil \e gpio module with \ref daqCtrlSize outputs. Writing its (big endian)
+ *   \c OUTPUT register starts streaming this number of FIFO words (a running 32 bit counter, starting from zero
+ *   after each reset of the module) over the %TCP connection.
+ *
+ * Accesses to unmapped addresses are answered with the RBCP bus error flag set. Every RBCP request can
+ * additionally be delayed by a fixed firmware latency. Uses an own IO context served by a single own thread
+ * and binds to ephemeral localhost ports, see getUdpPort() and getTcpPort().
+ */
+class SimFirmware
+{
+public:
+    explicit SimFirmware(std::chrono::microseconds pRBCPLatency = std::chrono::microseconds(0));
+    ~SimFirmware();
+    //
+    std::uint16_t getUdpPort() const;                       ///< Get the bound %UDP (RBCP) port.
+    std::uint16_t getTcpPort() const;                       ///< Get the bound %TCP port.
+    //
+    void start();                                           ///< Start serving requests.
+    void stop();                                            ///< Stop serving requests and close the %TCP connection.
+    //
+    std::size_t getFifoWordsSent() const;                   ///< Get the total number of sent FIFO words.
+    std::size_t getRBCPRequests() const;                    ///< Get the number of handled RBCP requests.
+    std::size_t getTcpToBusMessages() const;                ///< Get the number of handled "tcp_to_bus" messages.
+
+public:
+    static constexpr std::uint32_t gpioBaseAddr = 0x0000;           ///< Base address of the "gpio" module.
+    static constexpr std::size_t gpioSize = 16;                     ///< Number of IOs of the "gpio" module.
+    static constexpr std::uint16_t gpioInputPattern = 0xA5C3;       ///< Input pattern of the "gpio" module for disabled outputs.
+    static constexpr std::uint32_t daqCtrlBaseAddr = 0x0100;        ///< Base address of the "daq_ctrl" module.
+    static constexpr std::size_t daqCtrlSize = 32;                  ///< Number of outputs of the "daq_ctrl" module.
+
+private:
+    /*!
+     * \brief Register model of a basil \e gpio module (VERSION/RESET, INPUT, OUTPUT, OUTPUT_EN).
+     */
+    struct GpioModule
+    {
+        GpioModule(std::uint32_t pBaseAddr, std::size_t pSize, std::uint64_t pInputPattern);
+        //
+        std::uint32_t endAddr() const;
+        bool read(std::uint32_t pAddr, std::span<std::uint8_t> pData) const;
+        bool write(std::uint32_t pAddr, std::span<const std::uint8_t> pData);
+        std::uint64_t outputWord() const;
+        //
+        const std::uint32_t baseAddr;
+        const std::size_t numBytes;
+        const std::uint64_t inputPattern;
+        std::vector<std::uint8_t> output;
+        std::vector<std::uint8_t> outputEn;
+    };
+
+private:
+    bool busRead(std::uint32_t pAddr, std::span<std::uint8_t> pData) const;
+    bool busWrite(std::uint32_t pAddr, std::span<const std::uint8_t> pData);
+    //
+    void receiveUdp();
+    void handleRBCPRequest(std::size_t pSize);
+    //
+    void acceptTcp();
+    void receiveTcp();
+    void parseTcpToBus();
+    //
+    void streamFifo(std::size_t pNumWords);
+    void sendFifoChunk();
+
+private:
+    const std::chrono::microseconds rbcpLatency;
+    //
+    GpioModule gpio;
+    GpioModule daqCtrl;
+    //
+    boost::asio::io_context ioContext;
+    boost::asio::ip::udp::socket udpSocket;
+    boost::asio::ip::tcp::acceptor tcpAcceptor;
+    boost::asio::ip::tcp::socket tcpSocket;
+    std::thread ioThread;
+    //
+    std::array<std::uint8_t, 65535> udpRecvBuffer;
+    boost::asio::ip::udp::endpoint udpRemoteEndpoint;
+    std::vector<std::uint8_t> udpSendBuffer;
+    //
+    std::array<std::uint8_t, 65536> tcpRecvBuffer;
+    std::vector<std::uint8_t> tcpPending;
+    std::size_t tcpToBusSkipBytes;
+    //
+    bool tcpConnected;
+    bool fifoSending;
+    std::size_t fifoWordsRequested;
+    std::vector<std::uint8_t> fifoSendBuffer;
+    std::uint32_t fifoCounter;
+    //
+    std::atomic<std::size_t> fifoWordsSent;
+    std::atomic<std::size_t> rbcpRequests;
+    std::atomic<std::size_t> tcpToBusMessages;
+
+private:
+    static constexpr std::size_t tcpToBusResetLength = 65535 + 6;   ///< Length of the "tcp_to_bus" enable sequence.
+    static constexpr std::size_t fifoChunkWords = 16384;            ///< Maximum number of FIFO words per %TCP write.
+};
+
+#endif // CASILCOSIMTESTS_SIMFIRMWARE_H
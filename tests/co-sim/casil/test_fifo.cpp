@@ -0,0 +1,197 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "cosimfixture.h"
+
+#include <casil/bytes.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace Bytes = casil::Bytes;
+
+namespace
+{
+
+/*
+ * Starts streaming 'pNumWords' FIFO words by writing the "daq_ctrl" output register.
+ */
+void triggerFifoData(casil::HL::GPIO& pDaqCtrl, const std::uint32_t pNumWords)
+{
+    pDaqCtrl.setData(Bytes::composeByteVec(true, pNumWords));
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(CoSim_Tests)
+
+BOOST_FIXTURE_TEST_SUITE(FIFO_Tests, CoSimFixture)
+
+BOOST_AUTO_TEST_CASE(Test1_dataIntegrity)
+{
+    constexpr std::uint32_t numWords = 100000;
+
+    BOOST_CHECK_EQUAL(fifo.getFifoSize(), 0u);
+
+    triggerFifoData(daqCtrl, numWords);
+
+    std::vector<std::uint32_t> data;
+    data.reserve(numWords);
+
+    const auto deadline = Clock::now() + std::chrono::seconds(10);
+
+    while (data.size() < numWords && Clock::now() < deadline)
+    {
+        const std::vector<std::uint32_t> block = fifo.getFifoData();
+
+        if (block.empty())
+            std::this_thread::yield();
+
+        data.insert(data.end(), block.begin(), block.end());
+    }
+
+    BOOST_REQUIRE_EQUAL(data.size(), numWords);
+
+    bool sequenceOk = true;
+    for (std::uint32_t i = 0; i < numWords; ++i)
+        sequenceOk = sequenceOk && (data[i] == i);
+
+    BOOST_CHECK(sequenceOk);
+    BOOST_CHECK_EQUAL(firmware.getFifoWordsSent(), numWords);
+
+    //Module reset restarts the counter
+    daqCtrl.reset();
+    triggerFifoData(daqCtrl, 4);
+
+    std::vector<std::uint32_t> restarted;
+
+    while (restarted.size() < 4 && Clock::now() < deadline)
+    {
+        const std::vector<std::uint32_t> block = fifo.getFifoData();
+        restarted.insert(restarted.end(), block.begin(), block.end());
+    }
+
+    BOOST_CHECK(restarted == (std::vector<std::uint32_t>{0, 1, 2, 3}));
+}
+
+BOOST_AUTO_TEST_CASE(Test2_sustainedThroughput)
+{
+    constexpr std::uint32_t numWords = 8 * 1024 * 1024;
+    constexpr std::size_t bufferWords = 65536;
+
+    const double minThroughput = getLimit("CASIL_COSIM_MIN_FIFO_MBPS", 100);
+
+    std::vector<std::uint32_t> buffer(bufferWords);
+
+    std::size_t wordsReceived = 0;
+    bool sequenceOk = true;
+
+    const auto start = Clock::now();
+    const auto deadline = start + std::chrono::seconds(60);
+
+    triggerFifoData(daqCtrl, numWords);
+
+    //Drain into a reused buffer and check the running counter at the chunk boundaries
+    while (wordsReceived < numWords && Clock::now() < deadline)
+    {
+        const std::size_t numRead = fifo.getFifoDataInto(buffer);
+
+        if (numRead == 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        sequenceOk = sequenceOk && (buffer[0] == static_cast<std::uint32_t>(wordsReceived)) &&
+                                   (buffer[numRead - 1] == static_cast<std::uint32_t>(wordsReceived + numRead - 1));
+
+        wordsReceived += numRead;
+    }
+
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    const double throughput = static_cast<double>(4 * wordsReceived) / 1e6 / seconds;
+
+    reportMeasurement("FIFO sustained throughput", throughput, "MB/s", minThroughput);
+
+    BOOST_CHECK_EQUAL(wordsReceived, numWords);
+    BOOST_CHECK(sequenceOk);
+    BOOST_CHECK_GE(throughput, minThroughput);
+}
+
+BOOST_AUTO_TEST_CASE(Test3_triggerLatency)
+{
+    constexpr std::size_t numTriggers = 200;
+    constexpr std::uint32_t wordsPerTrigger = 16;
+
+    const double maxLatencyP99 = getLimit("CASIL_COSIM_MAX_FIFO_LATENCY_P99_US", 5000);
+
+    std::vector<double> latencies;
+    latencies.reserve(numTriggers);
+
+    std::vector<std::uint32_t> buffer(wordsPerTrigger);
+
+    std::size_t wordsReceived = 0;
+    bool sequenceOk = true;
+
+    //Time from the trigger (register write) until the complete data block is available in the host FIFO
+    for (std::size_t i = 0; i < numTriggers; ++i)
+    {
+        const auto start = Clock::now();
+        const auto deadline = start + std::chrono::seconds(5);
+
+        triggerFifoData(daqCtrl, wordsPerTrigger);
+
+        while (fifo.getFifoSize() < 4 * wordsPerTrigger && Clock::now() < deadline)
+            std::this_thread::yield();
+
+        latencies.push_back(toMicroseconds(Clock::now() - start));
+
+        const std::size_t numRead = fifo.getFifoDataInto(buffer);
+
+        sequenceOk = sequenceOk && (numRead == wordsPerTrigger) &&
+                                   (buffer.front() == static_cast<std::uint32_t>(wordsReceived)) &&
+                                   (buffer.back() == static_cast<std::uint32_t>(wordsReceived + wordsPerTrigger - 1));
+
+        wordsReceived += numRead;
+    }
+
+    const double latencyP99 = percentile(latencies, 0.99);
+
+    reportMeasurement("FIFO trigger p50 latency", percentile(latencies, 0.5), "us", maxLatencyP99);
+    reportMeasurement("FIFO trigger p99 latency", latencyP99, "us", maxLatencyP99);
+
+    BOOST_CHECK(sequenceOk);
+    BOOST_CHECK_LE(latencyP99, maxLatencyP99);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,210 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "cosimfixture.h"
+
+#include <casil/device.h>
+#include <casil/HL/Muxed/gpio.h>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using casil::Device;
+using casil::HL::GPIO;
+
+//
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(CoSim_Tests)
+
+BOOST_FIXTURE_TEST_SUITE(GPIO_Tests, CoSimFixture)
+
+BOOST_AUTO_TEST_CASE(Test1_loopback)
+{
+    BOOST_CHECK_EQUAL(gpio.getSize(), SimFirmware::gpioSize);
+
+    //Disabled outputs read the input pattern
+    BOOST_CHECK(gpio.getData() == (std::vector<std::uint8_t>{0xA5u, 0xC3u}));
+
+    gpio.setOutputEn({0xFFu, 0x00u});
+    gpio.setData({0x12u, 0x34u});
+
+    BOOST_CHECK(gpio.getData() == (std::vector<std::uint8_t>{0x12u, 0xC3u}));
+    BOOST_CHECK(gpio.getOutputEn() == (std::vector<std::uint8_t>{0xFFu, 0x00u}));
+
+    gpio.setOutputEn({0xFFu, 0xFFu});
+
+    BOOST_CHECK_EQUAL(gpio.readBits(0xFFFFu), 0x1234u);
+
+    gpio.setBits(0x00FFu, 0x0056u);
+    BOOST_CHECK_EQUAL(gpio.readBits(0xFFFFu), 0x1256u);
+
+    gpio.toggleBits(0xF000u);
+    BOOST_CHECK_EQUAL(gpio.readBits(0xFFFFu), 0xE256u);
+
+    gpio.reset();
+    BOOST_CHECK(gpio.getData() == (std::vector<std::uint8_t>{0xA5u, 0xC3u}));
+}
+
+BOOST_AUTO_TEST_CASE(Test2_registerAccessPerformance)
+{
+    constexpr std::size_t numIterations = 2000;
+
+    const double maxLatencyP99 = getLimit("CASIL_COSIM_MAX_REG_LATENCY_P99_US", 1000);
+    const double minRate = getLimit("CASIL_COSIM_MIN_REG_RATE", 2000);
+
+    gpio.setOutputEn({0xFFu, 0xFFu});
+
+    std::vector<double> latencies;
+    latencies.reserve(2 * numIterations);
+
+    bool readbackOk = true;
+
+    const auto start = Clock::now();
+
+    //Alternate single-transaction writes and reads of the whole IO register
+    for (std::size_t i = 0; i < numIterations; ++i)
+    {
+        const std::vector<std::uint8_t> value {static_cast<std::uint8_t>(i >> 8), static_cast<std::uint8_t>(i)};
+
+        const auto writeStart = Clock::now();
+        gpio.setData(value);
+        const auto readStart = Clock::now();
+        const std::vector<std::uint8_t> readback = gpio.getData();
+        const auto readEnd = Clock::now();
+
+        latencies.push_back(toMicroseconds(readStart - writeStart));
+        latencies.push_back(toMicroseconds(readEnd - readStart));
+
+        readbackOk = readbackOk && (readback == value);
+    }
+
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    const double rate = static_cast<double>(2 * numIterations) / seconds;
+    const double latencyP99 = percentile(latencies, 0.99);
+
+    reportMeasurement("Register access p50 latency", percentile(latencies, 0.5), "us", maxLatencyP99);
+    reportMeasurement("Register access p99 latency", latencyP99, "us", maxLatencyP99);
+    reportMeasurement("Register access rate", rate, "1/s", minRate);
+
+    BOOST_CHECK(readbackOk);
+    BOOST_CHECK_LE(latencyP99, maxLatencyP99);
+    BOOST_CHECK_GE(rate, minRate);
+    BOOST_CHECK_GE(firmware.getRBCPRequests(), 2 * numIterations);
+}
+
+BOOST_AUTO_TEST_CASE(Test3_standardRegister)
+{
+    constexpr std::size_t numIterations = 500;
+
+    const double maxLatencyP99 = getLimit("CASIL_COSIM_MAX_REG_LATENCY_P99_US", 1000);
+
+    gpio.setOutputEn({0xFFu, 0xFFu});
+
+    reg["HIGH"] = 0xABu;
+    reg["LOW"] = 0xCDu;
+
+    reg.write();
+    reg.read();
+
+    BOOST_CHECK(reg.compareReadback().empty());
+    BOOST_CHECK_EQUAL(gpio.readBits(0xFFFFu), 0xABCDu);
+
+    //Write/read round trips through the register layer; a write + read pair is one sample
+    std::vector<double> latencies;
+    latencies.reserve(numIterations);
+
+    bool readbackOk = true;
+
+    for (std::size_t i = 0; i < numIterations; ++i)
+    {
+        reg["LOW"] = static_cast<std::uint8_t>(i);
+
+        const auto start = Clock::now();
+        reg.write();
+        reg.read();
+        latencies.push_back(toMicroseconds(Clock::now() - start));
+
+        readbackOk = readbackOk && reg.compareReadback().empty();
+    }
+
+    reportMeasurement("Register round trip p99 latency", percentile(latencies, 0.99), "us", 2 * maxLatencyP99);
+
+    BOOST_CHECK(readbackOk);
+    BOOST_CHECK_LE(percentile(latencies, 0.99), 2 * maxLatencyP99);
+
+    //Readback of the undriven high byte is the input pattern (0xAB vs. 0xA5)
+    gpio.setOutputEn({0x00u, 0xFFu});
+    reg.read();
+
+    BOOST_CHECK(reg.compareReadback() == (std::vector<std::pair<std::size_t, std::size_t>>{{11, 9}}));
+}
+
+BOOST_AUTO_TEST_CASE(Test4_tcpToBusWrites)
+{
+    constexpr std::size_t numWrites = 5000;
+
+    const double minRate = getLimit("CASIL_COSIM_MIN_REG_RATE", 2000);
+
+    SimFirmware tcpFirmware;
+    tcpFirmware.start();
+
+    Device tcpDevice(makeDeviceConfig(tcpFirmware, ", tcp_to_bus: true"));
+
+    BOOST_REQUIRE(tcpDevice.init());
+
+    GPIO& tcpGpio = dynamic_cast<GPIO&>(tcpDevice.driver("gpio"));
+
+    tcpGpio.setOutputEn({0xFFu, 0xFFu});
+
+    const auto start = Clock::now();
+
+    for (std::size_t i = 0; i <= numWrites; ++i)
+        tcpGpio.setData({static_cast<std::uint8_t>(i >> 8), static_cast<std::uint8_t>(i)});
+
+    //Writes go over TCP and reads over UDP (RBCP), so wait for the last write to arrive
+    const auto deadline = start + std::chrono::seconds(10);
+
+    while (tcpGpio.readBits(0xFFFFu) != numWrites && Clock::now() < deadline)
+        std::this_thread::yield();
+
+    const double rate = static_cast<double>(numWrites) / std::chrono::duration<double>(Clock::now() - start).count();
+
+    reportMeasurement("tcp_to_bus write rate", rate, "1/s", minRate);
+
+    BOOST_CHECK_EQUAL(tcpGpio.readBits(0xFFFFu), numWrites);
+    BOOST_CHECK_GE(tcpFirmware.getTcpToBusMessages(), numWrites);
+    BOOST_CHECK_GE(rate, minRate);
+
+    BOOST_CHECK(tcpDevice.close());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,147 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "gpiofakeinterface.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+using casil::TL::GPIOFakeInterface;
+
+CASIL_REGISTER_INTERFACE_CPP(GPIOFakeInterface)
+
+//
+
+GPIOFakeInterface::GPIOFakeInterface(std::string pName, LayerConfig pConfig) :
+    MuxedInterface(typeName, std::move(pName), std::move(pConfig), LayerConfig()),
+    buffer{},
+    readCount(0),
+    writeCount(0),
+    bufferMutex()
+{
+}
+
+//Public
+
+std::vector<std::uint8_t> GPIOFakeInterface::read(const std::uint64_t pAddr, const int pSize)
+{
+    const std::lock_guard<std::mutex> bufferLock(bufferMutex);
+    (void)bufferLock;
+
+    if (pSize <= 0)
+        throw std::invalid_argument("Read size should be positive.");
+
+    if (pAddr + pSize > buffer.size())
+        throw std::invalid_argument("Read range exceeds buffer size.");
+
+    ++readCount;
+
+    return std::vector<std::uint8_t>(buffer.begin()+pAddr, buffer.begin()+pAddr+pSize);
+}
+
+void GPIOFakeInterface::write(const std::uint64_t pAddr, const std::vector<std::uint8_t>& pData)
+{
+    const std::lock_guard<std::mutex> bufferLock(bufferMutex);
+    (void)bufferLock;
+
+    if (pData.size() == 0)
+        throw std::invalid_argument("Write data are empty.");
+
+    if (pAddr + pData.size() > buffer.size())
+        throw std::invalid_argument("Write range exceeds buffer size.");
+
+    ++writeCount;
+
+    if (pAddr == 0 && pData.size() == 1)
+    {
+        //Reset
+        buffer.fill(0x0u);
+        return;
+    }
+
+    for (std::size_t i = 0; i < pData.size(); ++i)
+        buffer[pAddr+i] = pData[i];
+}
+
+std::vector<std::uint8_t> GPIOFakeInterface::query(std::uint64_t, std::uint64_t, const std::vector<std::uint8_t>&, int)
+{
+    return {};
+}
+
+//
+
+bool GPIOFakeInterface::readBufferEmpty() const
+{
+    return true;
+}
+
+void GPIOFakeInterface::clearReadBuffer()
+{
+}
+
+//
+
+std::uint8_t GPIOFakeInterface::getByte(const std::uint64_t pAddr) const
+{
+    const std::lock_guard<std::mutex> bufferLock(bufferMutex);
+    (void)bufferLock;
+
+    return buffer.at(pAddr);
+}
+
+void GPIOFakeInterface::setByte(const std::uint64_t pAddr, const std::uint8_t pValue)
+{
+    const std::lock_guard<std::mutex> bufferLock(bufferMutex);
+    (void)bufferLock;
+
+    buffer.at(pAddr) = pValue;
+}
+
+int GPIOFakeInterface::getReadCount() const
+{
+    const std::lock_guard<std::mutex> bufferLock(bufferMutex);
+    (void)bufferLock;
+
+    return readCount;
+}
+
+int GPIOFakeInterface::getWriteCount() const
+{
+    const std::lock_guard<std::mutex> bufferLock(bufferMutex);
+    (void)bufferLock;
+
+    return writeCount;
+}
+
+//Private
+
+bool GPIOFakeInterface::initImpl()
+{
+    return true;
+}
+
+bool GPIOFakeInterface::closeImpl()
+{
+    return true;
+}
@@ -0,0 +1,80 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef CASILTESTS_GPIOFAKEINTERFACE_H
+#define CASILTESTS_GPIOFAKEINTERFACE_H
+
+#include <casil/TL/muxedinterface.h>
+
+#include <casil/layerconfig.h>
+#include <casil/layerfactorymacros.h>
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace casil
+{
+
+namespace Layers::TL
+{
+
+class GPIOFakeInterface final : public MuxedInterface
+{
+public:
+    GPIOFakeInterface(std::string pName, LayerConfig pConfig);
+    ~GPIOFakeInterface() override = default;
+    //
+    std::vector<std::uint8_t> read(std::uint64_t pAddr, int pSize = -1) override;
+    void write(std::uint64_t pAddr, const std::vector<std::uint8_t>& pData) override;
+    std::vector<std::uint8_t> query(std::uint64_t pWriteAddr, std::uint64_t pReadAddr,
+                                    const std::vector<std::uint8_t>& pData, int pSize = -1) override;
+    //
+    bool readBufferEmpty() const override;
+    void clearReadBuffer() override;
+    //
+    std::uint8_t getByte(std::uint64_t pAddr) const;
+    void setByte(std::uint64_t pAddr, std::uint8_t pValue);
+    int getReadCount() const;
+    int getWriteCount() const;
+
+private:
+    bool initImpl() override;
+    bool closeImpl() override;
+
+private:
+    std::array<std::uint8_t, 16> buffer;
+    int readCount;
+    int writeCount;
+    mutable std::mutex bufferMutex;
+
+    CASIL_REGISTER_INTERFACE_H("GPIOFakeInterface")
+};
+
+} // namespace TL
+
+} // namespace casil
+
+#endif // CASILTESTS_GPIOFAKEINTERFACE_H
@@ -25,15 +25,22 @@
 #include <casil/device.h>
 #include <casil/HL/Muxed/gpio.h>
 
+#include "gpiofakeinterface.h"
+
 #include <boost/dynamic_bitset.hpp>
 
+#include <chrono>
 #include <cstdint>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
 
 using casil::Device;
 using casil::HL::GPIO;
+using casil::TL::GPIOFakeInterface;
 
 namespace boost { using casil::Bytes::operator<<; }
 
@@ -210,6 +217,161 @@ BOOST_AUTO_TEST_CASE(Test5_bytesFromBitset)
     BOOST_CHECK_EQUAL(exceptionCtr, 8);
 }
 
+BOOST_AUTO_TEST_CASE(Test6_bitWords)
+{
+    Device d("{transfer_layer: [{name: intf, type: GPIOFakeInterface}],"
+              "hw_drivers: [{name: drv, type: GPIO, interface: intf, base_addr: 0x0, size: 12}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    GPIO& drv = dynamic_cast<GPIO&>(d.driver("drv"));
+    GPIOFakeInterface& intf = dynamic_cast<GPIOFakeInterface&>(d.interface("intf"));
+
+    //Initial output state is read once, then taken from the written value cache
+
+    intf.setByte(3, 0x0Au);
+    intf.setByte(4, 0xF0u);
+
+    int readCount = intf.getReadCount();
+    int writeCount = intf.getWriteCount();
+
+    drv.setBits(0x00Fu, 0x6F5u);
+    BOOST_CHECK_EQUAL(intf.getByte(3), 0x0Au);
+    BOOST_CHECK_EQUAL(intf.getByte(4), 0xF5u);
+
+    drv.clearBits(0x0F0u);
+    BOOST_CHECK_EQUAL(intf.getByte(3), 0x0Au);
+    BOOST_CHECK_EQUAL(intf.getByte(4), 0x05u);
+
+    drv.toggleBits(0x801u);
+    BOOST_CHECK_EQUAL(intf.getByte(3), 0x02u);
+    BOOST_CHECK_EQUAL(intf.getByte(4), 0x04u);
+
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount + 1);
+    BOOST_CHECK_EQUAL(intf.getWriteCount(), writeCount + 3);
+
+    //Inputs
+
+    intf.setByte(1, 0x03u);
+    intf.setByte(2, 0xC1u);
+
+    BOOST_CHECK_EQUAL(drv.readBits(0xF0Fu), 0x301u);
+    BOOST_CHECK_EQUAL(drv.readBits(0xFFFu), 0x3C1u);
+
+    //Masks beyond IO bit count
+
+    BOOST_CHECK_THROW(drv.setBits(0x1000u, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.clearBits(0x1000u), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.toggleBits(0x1000u), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.readBits(0x1000u), std::invalid_argument);
+
+    //Output state is read again after reset
+
+    drv.reset();
+
+    intf.setByte(3, 0x01u);
+    intf.setByte(4, 0x00u);
+
+    readCount = intf.getReadCount();
+
+    drv.setBits(0x002u, 0x002u);
+    BOOST_CHECK_EQUAL(intf.getByte(3), 0x01u);
+    BOOST_CHECK_EQUAL(intf.getByte(4), 0x02u);
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount + 1);
+
+    //Full writes make the cached output state valid
+
+    drv.reset();
+    drv.setData({0x08u, 0x80u});
+
+    readCount = intf.getReadCount();
+
+    drv.toggleBits(0x880u);
+    BOOST_CHECK_EQUAL(intf.getByte(3), 0x00u);
+    BOOST_CHECK_EQUAL(intf.getByte(4), 0x00u);
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount);
+}
+
+BOOST_AUTO_TEST_CASE(Test7_inputMonitor)
+{
+    Device d("{transfer_layer: [{name: intf, type: GPIOFakeInterface}],"
+              "hw_drivers: [{name: drv, type: GPIO, interface: intf, base_addr: 0x0, size: 12}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    GPIO& drv = dynamic_cast<GPIO&>(d.driver("drv"));
+    GPIOFakeInterface& intf = dynamic_cast<GPIOFakeInterface&>(d.interface("intf"));
+
+    std::mutex eventsMutex;
+    std::vector<std::tuple<int, std::uint64_t, std::uint64_t, std::uint64_t>> events;
+
+    auto getEventCount = [&eventsMutex, &events]() -> std::size_t
+    {
+        const std::lock_guard<std::mutex> eventsLock(eventsMutex);
+        return events.size();
+    };
+
+    auto waitForEvents = [&getEventCount](const std::size_t pCount) -> void
+    {
+        for (int i = 0; i < 2000 && getEventCount() < pCount; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    };
+
+    auto makeCallback = [&eventsMutex, &events](const int pSubscriber) -> GPIO::InputEdgeCallback
+    {
+        return [&eventsMutex, &events, pSubscriber](std::uint64_t pState, std::uint64_t pRising, std::uint64_t pFalling) -> void
+               {
+                   const std::lock_guard<std::mutex> eventsLock(eventsMutex);
+                   events.emplace_back(pSubscriber, pState, pRising, pFalling);
+               };
+    };
+
+    intf.setByte(2, 0x01u);
+
+    drv.subscribeInputEdges(0x00Fu, makeCallback(1));
+    const int id2 = drv.subscribeInputEdges(0xF00u, makeCallback(2));
+
+    BOOST_CHECK_THROW(drv.subscribeInputEdges(0x1000u, makeCallback(3)), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.subscribeInputEdges(0x001u, GPIO::InputEdgeCallback()), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.startInputMonitor(std::chrono::milliseconds(0)), std::invalid_argument);
+
+    BOOST_CHECK(!drv.inputMonitorRunning());
+
+    drv.startInputMonitor(std::chrono::milliseconds(1));
+
+    BOOST_CHECK(drv.inputMonitorRunning());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    BOOST_CHECK_EQUAL(getEventCount(), 0);      //Initial state does not generate edges
+
+    intf.setByte(2, 0x02u);
+    waitForEvents(1);
+
+    intf.setByte(2, 0x12u);     //Not subscribed
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    intf.setByte(1, 0x05u);
+    waitForEvents(2);
+
+    drv.unsubscribeInputEdges(id2);
+
+    intf.setByte(1, 0x00u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    drv.stopInputMonitor();
+
+    BOOST_CHECK(!drv.inputMonitorRunning());
+
+    const std::lock_guard<std::mutex> eventsLock(eventsMutex);
+
+    BOOST_REQUIRE_EQUAL(events.size(), 2);
+    BOOST_CHECK(events[0] == std::make_tuple(1, 0x002u, 0x002u, 0x001u));
+    BOOST_CHECK(events[1] == std::make_tuple(2, 0x500u, 0x500u, 0x000u));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
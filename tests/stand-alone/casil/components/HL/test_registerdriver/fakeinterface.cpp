@@ -23,12 +23,40 @@
 
 #include "fakeinterface.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
 #include <utility>
 
 using casil::TL::FakeInterface;
 
+namespace
+{
+
+//Check if a byte range consists of consecutive (complete) registers (allows merged accesses of multiple registers)
+bool isRegisterSequence(const std::uint64_t pRegAddr, const std::size_t pSize, const bool pWrite)
+{
+    static constexpr std::array<std::pair<std::uint64_t, std::size_t>, 12> regBlocks {{{1, 2}, {4, 3}, {7, 2}, {9, 2}, {11, 2}, {13, 3},
+                                                                                      {16, 2}, {18, 2}, {20, 4}, {24, 5}, {29, 8}, {37, 9}}};
+
+    std::size_t pos = 0;
+
+    while (pos < pSize)
+    {
+        const auto blockIt = std::find_if(regBlocks.begin(), regBlocks.end(),
+                                          [addr = pRegAddr + pos](const auto& pBlock) -> bool { return pBlock.first == addr; });
+
+        if (blockIt == regBlocks.end() || pos + blockIt->second > pSize || (!pWrite && blockIt->first == 7))
+            return false;
+
+        pos += blockIt->second;
+    }
+
+    return true;
+}
+
+} // namespace
+
 CASIL_REGISTER_INTERFACE_CPP(FakeInterface)
 
 //
@@ -39,7 +67,10 @@ FakeInterface::FakeInterface(std::string pName, LayerConfig pConfig) :
             0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u,
             0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u}),
     firmwareVersion(11),
-    triggerRegData({0x00u, 0x00u})
+    triggerRegData({0x00u, 0x00u}),
+    readCount(0),
+    writeCount(0),
+    stuckByte(-1)
 {
 }
 
@@ -58,13 +89,13 @@ std::vector<std::uint8_t> FakeInterface::read(const std::uint64_t pAddr, const i
     if (regAddr + pSize > 46)
         throw std::invalid_argument("Read range exceeds buffer size.");
 
+    ++readCount;
+
     if (regAddr == 0 && pSize == 1)
         return {firmwareVersion};
     else if (regAddr == 3 && pSize == 1)
         return {0b10110001};    //Return 'INPUT'
-    else if ((regAddr == 1 && pSize == 2) || (regAddr == 4 && pSize == 3) || (regAddr == 9 && pSize == 2) || (regAddr == 11 && pSize == 2) ||
-             (regAddr == 13 && pSize == 3) || (regAddr == 16 && pSize == 2) || (regAddr == 18 && pSize == 2) ||
-             (regAddr == 20 && pSize == 4) || (regAddr == 24 && pSize == 5) || (regAddr == 29 && pSize == 8) || (regAddr == 37 && pSize == 9))
+    else if (isRegisterSequence(regAddr, pSize, false))
     {
         return std::vector<std::uint8_t>(buffer.begin()+regAddr, buffer.begin()+regAddr+pSize);
     }
@@ -92,19 +123,21 @@ void FakeInterface::write(const std::uint64_t pAddr, const std::vector<std::uint
                   0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u,
                   0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u};
     }
-    else if ((regAddr == 1 && pData.size() == 2) || (regAddr == 4 && pData.size() == 3) ||
-             (regAddr == 9 && pData.size() == 2) || (regAddr == 11 && pData.size() == 2) ||
-             (regAddr == 13 && pData.size() == 3) || (regAddr == 16 && pData.size() == 2) || (regAddr == 18 && pData.size() == 2) ||
-             (regAddr == 20 && pData.size() == 4) || (regAddr == 24 && pData.size() == 5) ||
-             (regAddr == 29 && pData.size() == 8) || (regAddr == 37 && pData.size() == 9))
+    else
     {
+        if (!isRegisterSequence(regAddr, pData.size(), true))
+            throw std::invalid_argument("Invalid combination of address and write data size.");
+
         for (std::size_t i = 0; i < pData.size(); ++i)
-            buffer[regAddr+i] = pData[i];
+        {
+            if (regAddr + i == 7 || regAddr + i == 8)
+                triggerRegData[regAddr + i - 7] = pData[i];
+            else if (static_cast<int>(regAddr + i) != stuckByte)
+                buffer[regAddr+i] = pData[i];
+        }
     }
-    else if (regAddr == 7 && pData.size() == 2)
-        triggerRegData = pData;
-    else
-        throw std::invalid_argument("Invalid combination of address and write data size.");
+
+    ++writeCount;
 }
 
 std::vector<std::uint8_t> FakeInterface::query(std::uint64_t, std::uint64_t, const std::vector<std::uint8_t>&, int)
@@ -135,6 +168,21 @@ std::vector<std::uint8_t> FakeInterface::getTriggerRegData() const
     return triggerRegData;
 }
 
+int FakeInterface::getReadCount() const
+{
+    return readCount;
+}
+
+int FakeInterface::getWriteCount() const
+{
+    return writeCount;
+}
+
+void FakeInterface::setStuckByte(const int pRegAddr)
+{
+    stuckByte = pRegAddr;
+}
+
 //Private
 
 bool FakeInterface::initImpl()
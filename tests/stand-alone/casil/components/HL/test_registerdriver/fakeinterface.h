@@ -56,6 +56,9 @@ public:
     //
     void fakeFirmwareVersion();
     std::vector<std::uint8_t> getTriggerRegData() const;
+    int getReadCount() const;
+    int getWriteCount() const;
+    void setStuckByte(int pRegAddr);
 
 private:
     bool initImpl() override;
@@ -65,6 +68,9 @@ private:
     std::array<std::uint8_t, 46> buffer;
     std::uint8_t firmwareVersion;
     std::vector<std::uint8_t> triggerRegData;
+    int readCount;
+    int writeCount;
+    int stuckByte;
 
 private:
     static constexpr std::uint64_t drvBaseAddr = 0x135Fu;
@@ -29,10 +29,14 @@
 #include <casil/HL/driver.h>
 #include <casil/HL/registerdriver.h>
 
+#include <chrono>
 #include <cstdint>
+#include <future>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -855,6 +859,532 @@ BOOST_AUTO_TEST_CASE(Test15_loadDumpConf)
     BOOST_CHECK(drv.loadRuntimeConfiguration("{FOOBAR: }") == false);                                   //Empty node
 }
 
+BOOST_AUTO_TEST_CASE(Test16_shadowMemory)
+{
+    Device d("{transfer_layer: [{name: intf, type: FakeInterface}],"
+              "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F, shadow_registers: true}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    RegisterDriver& drv = dynamic_cast<RegisterDriver&>(d.driver("drv"));
+    const FakeInterface& intf = dynamic_cast<const FakeInterface&>(d.interface("intf"));
+
+    BOOST_CHECK_THROW((void)drv.getShadow("FOOBAR"), std::runtime_error);      //Not yet known
+
+    int readCount = intf.getReadCount();
+
+    drv.setValue("FOOBAR", 1023);
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount + 1);                      //Needs read-modify-write
+
+    readCount = intf.getReadCount();
+
+    drv.setValue("FOOBAR", 129);
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount);                          //Merged into shadow memory
+    BOOST_CHECK_EQUAL(std::get<std::uint64_t>(drv.getShadow("FOOBAR")), 129);
+
+    BOOST_CHECK_EQUAL(drv.getValue("FOOBAR"), 129);
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount + 1);                      //Reads not served from shadow memory
+
+    drv.setBytes("TRIGGER", {0x12u, 0x34u});
+    BOOST_CHECK_EQUAL(std::get<std::vector<std::uint8_t>>(drv.getShadow("TRIGGER")), (std::vector<std::uint8_t>{0x12u, 0x34u}));
+
+    BOOST_CHECK_THROW((void)drv.getShadow("VERSION"), std::invalid_argument);   //Read-only
+    BOOST_CHECK_THROW((void)drv.getShadow("BARFOO"), std::invalid_argument);    //Not available
+
+    drv.reset();
+
+    BOOST_CHECK_THROW((void)drv.getShadow("FOOBAR"), std::runtime_error);      //Invalidated
+
+    readCount = intf.getReadCount();
+
+    drv.setValue("FOOBAR", 1023);
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount + 1);
+
+    //Trust shadow memory for reads
+
+    Device d2("{transfer_layer: [{name: intf2, type: FakeInterface}],"
+               "hw_drivers: [{name: drv2, type: TestRegDriver, interface: intf2, base_addr: 0x135F, trust_shadow: true}],"
+               "registers: []}");
+
+    BOOST_REQUIRE(d2.init());
+
+    RegisterDriver& drv2 = dynamic_cast<RegisterDriver&>(d2.driver("drv2"));
+    const FakeInterface& intf2 = dynamic_cast<const FakeInterface&>(d2.interface("intf2"));
+
+    drv2.setValue("FOOBAR", 787);
+    drv2.setBytes("TESTARR", {0x14u, 0x23u});
+
+    readCount = intf2.getReadCount();
+
+    BOOST_CHECK_EQUAL(drv2.getValue("FOOBAR"), 787);
+    BOOST_CHECK_EQUAL(drv2.getBytes("TESTARR"), (std::vector<std::uint8_t>{0x14u, 0x23u}));
+    BOOST_CHECK_EQUAL(intf2.getReadCount(), readCount);
+
+    BOOST_CHECK_EQUAL(drv2.getBytes("INPUT"), (std::vector<std::uint8_t>{0b10110001u}));
+    BOOST_CHECK_EQUAL(intf2.getReadCount(), readCount + 1);                     //Read-only registers always read
+
+    //Shadow memory disabled
+
+    Device d3("{transfer_layer: [{name: intf3, type: FakeInterface}],"
+               "hw_drivers: [{name: drv3, type: TestRegDriver, interface: intf3, base_addr: 0x135F}],"
+               "registers: []}");
+
+    BOOST_REQUIRE(d3.init());
+
+    RegisterDriver& drv3 = dynamic_cast<RegisterDriver&>(d3.driver("drv3"));
+
+    drv3.setValue("FOOBAR", 787);
+
+    BOOST_CHECK_THROW((void)drv3.getShadow("FOOBAR"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Test17_multiRegisterUpdate)
+{
+    Device d("{transfer_layer: [{name: intf, type: FakeInterface}],"
+              "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    RegisterDriver& drv = dynamic_cast<RegisterDriver&>(d.driver("drv"));
+    const FakeInterface& intf = dynamic_cast<const FakeInterface&>(d.interface("intf"));
+
+    int readCount = intf.getReadCount();
+    int writeCount = intf.getWriteCount();
+
+    drv.set({{"TESTARR", std::vector<std::uint8_t>{0x87u, 0x4Eu}}, {"TESTVAL", 0x91A2u}, {"TESTVAL_A", 0x23432u}});
+
+    BOOST_CHECK_EQUAL(intf.getWriteCount(), writeCount + 1);    //Single merged write
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount + 1);      //Read-modify-write for TESTVAL_A
+
+    BOOST_CHECK_EQUAL(drv.getBytes("TESTARR"), (std::vector<std::uint8_t>{0x87u, 0x4Eu}));
+    BOOST_CHECK_EQUAL(drv.getValue("TESTVAL"), 0x91A2u);
+    BOOST_CHECK_EQUAL(drv.getValue("TESTVAL_A"), 0x23432u);
+
+    writeCount = intf.getWriteCount();
+
+    drv.set({{"OUTPUT", std::vector<std::uint8_t>{0x11u, 0x22u, 0x44u}}, {"TRIGGER", std::vector<std::uint8_t>{0x1Fu, 0xB3u}},
+             {"TESTVAL_B", 1465u}, {"TESTVAL_C", 1465u}, {"TESTVAL_B", 0b10110111001u}});
+
+    BOOST_CHECK_EQUAL(intf.getWriteCount(), writeCount + 2);    //Two contiguous ranges
+
+    BOOST_CHECK_EQUAL(drv.getBytes("OUTPUT"), (std::vector<std::uint8_t>{0x11u, 0x22u, 0x44u}));
+    BOOST_CHECK_EQUAL(intf.getTriggerRegData(), (std::vector<std::uint8_t>{0x1Fu, 0xB3u}));
+    BOOST_CHECK_EQUAL(drv.getValue("TESTVAL_B"), 0b10110111001u);
+    BOOST_CHECK_EQUAL(drv.getValue("TESTVAL_C"), 1465u);
+
+    //Invalid updates must not write anything
+
+    writeCount = intf.getWriteCount();
+
+    BOOST_CHECK_THROW(drv.set({{"TESTVAL", 0x1234u}, {"BARFOO", 0x1u}}), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.set({{"TESTVAL", 0x1234u}, {"VERSION", 0x1u}}), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.set({{"TESTVAL", 0x1234u}, {"OUTPUT", 0x1u}}), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.set({{"TESTVAL", std::vector<std::uint8_t>{0x12u, 0x34u}}}), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.set({{"TESTVAL", 0x1234u}, {"OUTPUT", std::vector<std::uint8_t>{0x11u, 0x22u}}}), std::invalid_argument);
+
+    BOOST_CHECK_EQUAL(intf.getWriteCount(), writeCount);
+    BOOST_CHECK_EQUAL(drv.getValue("TESTVAL"), 0x91A2u);
+
+    //Partial bytes from shadow memory
+
+    Device d2("{transfer_layer: [{name: intf2, type: FakeInterface}],"
+               "hw_drivers: [{name: drv2, type: TestRegDriver, interface: intf2, base_addr: 0x135F, shadow_registers: true}],"
+               "registers: []}");
+
+    BOOST_REQUIRE(d2.init());
+
+    RegisterDriver& drv2 = dynamic_cast<RegisterDriver&>(d2.driver("drv2"));
+    const FakeInterface& intf2 = dynamic_cast<const FakeInterface&>(d2.interface("intf2"));
+
+    drv2.set({{"FOOBAR", 1023u}, {"TESTVAL_A", 0x23432u}});
+
+    readCount = intf2.getReadCount();
+    writeCount = intf2.getWriteCount();
+
+    drv2.set({{"FOOBAR", 787u}, {"TESTVAL_A", 144434u}});
+
+    BOOST_CHECK_EQUAL(intf2.getReadCount(), readCount);
+    BOOST_CHECK_EQUAL(intf2.getWriteCount(), writeCount + 2);
+
+    BOOST_CHECK_EQUAL(drv2.getValue("FOOBAR"), 787u);
+    BOOST_CHECK_EQUAL(drv2.getValue("TESTVAL_A"), 144434u);
+}
+
+BOOST_AUTO_TEST_CASE(Test18_registerHandle)
+{
+    Device d("{transfer_layer: [{name: intf, type: FakeInterface}],"
+              "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    RegisterDriver& drv = dynamic_cast<RegisterDriver&>(d.driver("drv"));
+    const FakeInterface& intf = dynamic_cast<const FakeInterface&>(d.interface("intf"));
+
+    BOOST_CHECK_THROW((void)drv.handle("BARFOO"), std::invalid_argument);
+
+    RegisterDriver::RegisterHandle hVersion = drv.handle("VERSION");
+    RegisterDriver::RegisterHandle hFoobar = drv.handle("FOOBAR");
+    RegisterDriver::RegisterHandle hOutput = drv.handle("OUTPUT");
+    RegisterDriver::RegisterHandle hTrigger = drv.handle("TRIGGER");
+
+    BOOST_CHECK_EQUAL(hVersion.getValue(), 11);
+    BOOST_CHECK_EQUAL(hFoobar.getValue(), 582);
+    BOOST_CHECK_EQUAL(hOutput.getBytes(), (std::vector<std::uint8_t>{0x56u, 0x78u, 0x9Au}));
+
+    hFoobar.setValue(787);
+    hOutput.setBytes({0x11u, 0x22u, 0x44u});
+    hTrigger.setBytes({0x1Fu, 0xB3u});
+
+    BOOST_CHECK_EQUAL(drv.getValue("FOOBAR"), 787);
+    BOOST_CHECK_EQUAL(drv.getBytes("OUTPUT"), (std::vector<std::uint8_t>{0x11u, 0x22u, 0x44u}));
+    BOOST_CHECK_EQUAL(intf.getTriggerRegData(), (std::vector<std::uint8_t>{0x1Fu, 0xB3u}));
+
+    //Same results as generic access for all size classes
+
+    const std::vector<std::pair<std::string, std::uint64_t>> testValues = {{"TESTVAL", 0x91A2u}, {"TESTVAL_A", 0x23432u},
+                                                                           {"TESTVAL_B", 0b10110111001u}, {"TESTVAL_C", 0b10110111001u},
+                                                                           {"TESTVAL_D", 0x291083Fu}, {"TESTVAL_E", 0x36630C181u},
+                                                                           {"TESTVAL_F", 0x3B9C70E0E0701FDu},
+                                                                           {"TESTVAL_G", 0x7BCF1E1E0F03C07Fu}};
+
+    for (const auto& [regName, value] : testValues)
+    {
+        RegisterDriver::RegisterHandle h = drv.handle(regName);
+
+        h.setValue(value);
+        BOOST_CHECK_EQUAL(drv.getValue(regName), value);
+
+        drv.setValue(regName, value / 3);
+        BOOST_CHECK_EQUAL(h.getValue(), value / 3);
+    }
+
+    //Invalid accesses
+
+    BOOST_CHECK_THROW(hVersion.setValue(1), std::invalid_argument);
+    BOOST_CHECK_THROW(hFoobar.setBytes({0x11u, 0x22u}), std::invalid_argument);
+    BOOST_CHECK_THROW((void)hFoobar.getBytes(), std::invalid_argument);
+    BOOST_CHECK_THROW(hOutput.setValue(1), std::invalid_argument);
+    BOOST_CHECK_THROW((void)hOutput.getValue(), std::invalid_argument);
+    BOOST_CHECK_THROW(hOutput.setBytes({0x11u, 0x22u}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Test19_snapshotRestore)
+{
+    Device d("{transfer_layer: [{name: intf, type: FakeInterface}],"
+              "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    RegisterDriver& drv = dynamic_cast<RegisterDriver&>(d.driver("drv"));
+    const FakeInterface& intf = dynamic_cast<const FakeInterface&>(d.interface("intf"));
+
+    drv.setValue("FOOBAR", 787);
+    drv.setBytes("OUTPUT", {0x11u, 0x22u, 0x44u});
+    drv.setValue("TESTVAL", 0x91A2u);
+    drv.setValue("TESTVAL_D", 0x291083Fu);
+    drv.setValue("TESTVAL_G", 0x7BCF1E1E0F03C07Fu);
+
+    const int readCount = intf.getReadCount();
+
+    const std::vector<std::uint8_t> snap = drv.snapshot();
+
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount + 3);      //One read per contiguous range of read-write registers
+    BOOST_CHECK_EQUAL(snap.size(), 2 + 3 + 37);
+
+    drv.reset();
+
+    BOOST_REQUIRE_EQUAL(drv.getValue("FOOBAR"), 582);
+    BOOST_REQUIRE_EQUAL(drv.getValue("TESTVAL_G"), 0);
+
+    const int writeCount = intf.getWriteCount();
+
+    drv.restore(snap);
+
+    BOOST_CHECK_EQUAL(intf.getWriteCount(), writeCount + 3);
+
+    BOOST_CHECK_EQUAL(drv.getValue("VERSION"), 11);
+    BOOST_CHECK_EQUAL(drv.getValue("FOOBAR"), 787);
+    BOOST_CHECK_EQUAL(drv.getBytes("OUTPUT"), (std::vector<std::uint8_t>{0x11u, 0x22u, 0x44u}));
+    BOOST_CHECK_EQUAL(drv.getValue("TESTVAL"), 0x91A2u);
+    BOOST_CHECK_EQUAL(drv.getValue("TESTVAL_D"), 0x291083Fu);
+    BOOST_CHECK_EQUAL(drv.getValue("TESTVAL_G"), 0x7BCF1E1E0F03C07Fu);
+
+    BOOST_CHECK_EQUAL(drv.snapshot(), snap);
+
+    BOOST_CHECK_THROW(drv.restore(std::vector<std::uint8_t>(snap.begin(), snap.end() - 1)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Test20_asyncAccess)
+{
+    Device d("{transfer_layer: [{name: intf, type: FakeInterface}, {name: intf2, type: FakeInterface}],"
+              "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F},"
+                           "{name: drv2, type: TestRegDriver, interface: intf2, base_addr: 0x135F}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    RegisterDriver& drv = dynamic_cast<RegisterDriver&>(d.driver("drv"));
+    RegisterDriver& drv2 = dynamic_cast<RegisterDriver&>(d.driver("drv2"));
+
+    std::future<void> setFoobar = drv.setValueAsync("FOOBAR", 787);
+    std::future<void> setOutput = drv.setBytesAsync("OUTPUT", {0x11u, 0x22u, 0x44u});
+    std::future<void> setFoobar2 = drv2.setValueAsync("FOOBAR", 129);
+    std::future<std::uint64_t> getFoobar = drv.getValueAsync("FOOBAR");     //Executed after preceding writes of same interface
+    std::future<std::vector<std::uint8_t>> getOutput = drv.getBytesAsync("OUTPUT");
+    std::future<std::uint64_t> getFoobar2 = drv2.getValueAsync("FOOBAR");
+
+    BOOST_CHECK_NO_THROW(setFoobar.get());
+    BOOST_CHECK_NO_THROW(setOutput.get());
+    BOOST_CHECK_NO_THROW(setFoobar2.get());
+    BOOST_CHECK_EQUAL(getFoobar.get(), 787);
+    BOOST_CHECK_EQUAL(getOutput.get(), (std::vector<std::uint8_t>{0x11u, 0x22u, 0x44u}));
+    BOOST_CHECK_EQUAL(getFoobar2.get(), 129);
+
+    //Exceptions are passed through the futures
+
+    std::future<std::uint64_t> getInvalid = drv.getValueAsync("BARFOO");
+    std::future<void> setInvalid = drv.setValueAsync("VERSION", 1);
+
+    BOOST_CHECK_THROW(getInvalid.get(), std::invalid_argument);
+    BOOST_CHECK_THROW(setInvalid.get(), std::invalid_argument);
+
+    //Pending accesses finish before closing
+
+    std::future<void> setTestval = drv.setValueAsync("TESTVAL", 0x91A2u);
+
+    d.waitAsync();
+
+    BOOST_CHECK(setTestval.wait_for(std::chrono::seconds::zero()) == std::future_status::ready);
+    BOOST_CHECK_EQUAL(drv.getValue("TESTVAL"), 0x91A2u);
+}
+
+BOOST_AUTO_TEST_CASE(Test21_waitUntilDone)
+{
+    using std::chrono::milliseconds;
+    using std::chrono::microseconds;
+    using std::chrono::steady_clock;
+
+    Device d("{transfer_layer: [{name: intf, type: FakeInterface}],"
+              "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    TestRegDriver& drv = dynamic_cast<TestRegDriver&>(d.driver("drv"));
+
+    Driver::WaitPolicy policy;
+    policy.initialInterval = microseconds(1000);
+    policy.maxInterval = microseconds(2000);
+
+    //First wait has no learned duration and polls from the start
+
+    drv.startFakeAction(milliseconds(40));
+    BOOST_CHECK(drv.waitUntilDone(milliseconds(1000), policy));
+
+    const int firstPollCount = drv.getDonePollCount();
+
+    BOOST_CHECK_GT(firstPollCount, 5);
+
+    //Second wait skips most of the learned duration
+
+    drv.startFakeAction(milliseconds(40));
+    BOOST_CHECK(drv.waitUntilDone(milliseconds(1000), policy));
+    BOOST_CHECK_LT(drv.getDonePollCount(), firstPollCount);
+
+    //Timeout via base class (default policy)
+
+    Driver& baseDrv = drv;
+
+    drv.startFakeAction(milliseconds(10000));
+
+    const steady_clock::time_point start = steady_clock::now();
+
+    BOOST_CHECK(!baseDrv.waitUntilDone(milliseconds(20)));
+
+    const steady_clock::duration elapsed = steady_clock::now() - start;
+
+    BOOST_CHECK(elapsed >= milliseconds(20));
+    BOOST_CHECK(elapsed < milliseconds(1000));
+
+    //Invalid policies
+
+    Driver::WaitPolicy invalidPolicy;
+
+    invalidPolicy.backoffFactor = 0.5;
+    BOOST_CHECK_THROW(drv.waitUntilDone(milliseconds(10), invalidPolicy), std::invalid_argument);
+
+    invalidPolicy.backoffFactor = 2.0;
+    invalidPolicy.initialInterval = microseconds(-1);
+    BOOST_CHECK_THROW(drv.waitUntilDone(milliseconds(10), invalidPolicy), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Test22_concurrentAccess)
+{
+    Device d("{transfer_layer: [{name: intf, type: FakeInterface}],"
+              "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F, shadow_registers: true}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    RegisterDriver& drv = dynamic_cast<RegisterDriver&>(d.driver("drv"));
+
+    constexpr int numIterations = 500;
+
+    int foobarMismatches = 0;
+    int outputMismatches = 0;
+
+    //Configuring thread writes/reads a partial-byte value register (read-modify-write), monitoring thread a byte array register
+
+    std::thread configThread([&drv, &foobarMismatches]()
+    {
+        for (int i = 0; i < numIterations; ++i)
+        {
+            drv.setValue("FOOBAR", i % 1024);
+
+            if (drv.getValue("FOOBAR") != static_cast<std::uint64_t>(i % 1024))
+                ++foobarMismatches;
+        }
+    });
+
+    std::thread monitorThread([&drv, &outputMismatches]()
+    {
+        for (int i = 0; i < numIterations; ++i)
+        {
+            const std::vector<std::uint8_t> data {static_cast<std::uint8_t>(i), 0x22u, static_cast<std::uint8_t>(i >> 8)};
+
+            drv.setBytes("OUTPUT", data);
+
+            if (drv.getBytes("OUTPUT") != data)
+                ++outputMismatches;
+        }
+    });
+
+    for (int i = 0; i < numIterations; ++i)
+        (void)drv.getValue("TESTVAL");
+
+    configThread.join();
+    monitorThread.join();
+
+    BOOST_CHECK_EQUAL(foobarMismatches, 0);
+    BOOST_CHECK_EQUAL(outputMismatches, 0);
+
+    BOOST_CHECK_EQUAL(drv.getValue("FOOBAR"), (numIterations - 1) % 1024);
+    BOOST_CHECK_EQUAL(std::get<std::uint64_t>(drv.getShadow("FOOBAR")), (numIterations - 1) % 1024);
+    BOOST_CHECK_EQUAL(drv.getBytes("OUTPUT"), (std::vector<std::uint8_t>{static_cast<std::uint8_t>(numIterations - 1), 0x22u,
+                                                                          static_cast<std::uint8_t>((numIterations - 1) >> 8)}));
+}
+
+BOOST_AUTO_TEST_CASE(Test23_registerLookup)
+{
+    Device d("{transfer_layer: [{name: intf, type: FakeInterface}],"
+              "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F, init: {TESTVAL: 0x1234}}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    RegisterDriver& drv = dynamic_cast<RegisterDriver&>(d.driver("drv"));
+    const RegisterDriver& cDrv = drv;
+
+    for (const std::string_view regName : {"FOOBAR", "INPUT", "OUTPUT", "RESET", "TESTARR", "TESTVAL", "TESTVAL_A", "TESTVAL_G",
+                                           "TRIGGER", "VERSION"})
+    {
+        BOOST_CHECK(drv.testRegisterName(regName));
+    }
+
+    for (const std::string_view regName : {"", "A", "FOOBA", "FOOBARR", "TESTVAL_H", "ZZZ"})
+    {
+        BOOST_CHECK_THROW(drv.testRegisterName(regName), std::invalid_argument);
+        BOOST_CHECK_THROW(drv[regName], std::invalid_argument);
+    }
+
+    //Proxies are created on demand and then reused
+
+    BOOST_CHECK(&drv["FOOBAR"] == &drv["FOOBAR"]);
+    BOOST_CHECK(&drv["FOOBAR"] == &cDrv["FOOBAR"]);
+    BOOST_CHECK(&drv["FOOBAR"] != &drv["TESTVAL"]);
+
+    drv.applyDefaults();
+
+    BOOST_CHECK_EQUAL(std::get<std::uint64_t>(drv["TESTVAL"].get()), 0x1234u);
+    BOOST_CHECK_EQUAL(drv.getBytes("TESTARR"), (std::vector<std::uint8_t>{0xDE, 0xBC}));
+}
+
+BOOST_AUTO_TEST_CASE(Test24_readbackVerification)
+{
+    Device d("{transfer_layer: [{name: intf, type: FakeInterface}],"
+              "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    RegisterDriver& drv = dynamic_cast<RegisterDriver&>(d.driver("drv"));
+    FakeInterface& intf = dynamic_cast<FakeInterface&>(d.interface("intf"));
+
+    int readCount = intf.getReadCount();
+
+    BOOST_CHECK_NO_THROW(drv.applyDefaults(true));
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount + 1);      //TESTARR and TESTVAL verified with single merged read
+
+    readCount = intf.getReadCount();
+
+    BOOST_CHECK_NO_THROW(drv.set({{"TESTARR", std::vector<std::uint8_t>{0x87u, 0x4Eu}}, {"TESTVAL", 0x91A2u}, {"TESTVAL_A", 0x23432u},
+                                  {"TRIGGER", std::vector<std::uint8_t>{0x1Fu, 0xB3u}}}, true));
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount + 2);      //Read-modify-write for TESTVAL_A and single merged verification read
+
+    //Mismatches are reported per register
+
+    intf.write(0x135F + 9, {0x00u, 0x00u});
+
+    BOOST_CHECK(drv.verifyRegisters({"TESTARR", "TESTVAL", "TESTVAL_A"}) == (std::vector<std::string>{"TESTARR"}));
+    BOOST_CHECK(drv.verifyRegisters({"TESTVAL", "TESTVAL_A"}).empty());
+
+    BOOST_CHECK_THROW(drv.verifyRegisters({"BARFOO"}), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.verifyRegisters({"TRIGGER"}), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.verifyRegisters({"VERSION"}), std::invalid_argument);
+
+    intf.setStuckByte(12);
+
+    BOOST_CHECK_THROW(drv.set({{"TESTARR", std::vector<std::uint8_t>{0x01u, 0x02u}}, {"TESTVAL", 0x3456u}}, true), std::runtime_error);
+    BOOST_CHECK_THROW(drv.applyDefaults(true), std::runtime_error);
+    BOOST_CHECK_NO_THROW(drv.applyDefaults());
+
+    BOOST_CHECK(drv.verifyRegisters({"TESTARR", "TESTVAL"}) == (std::vector<std::string>{"TESTVAL"}));
+}
+
+BOOST_AUTO_TEST_CASE(Test25_multiRegisterRead)
+{
+    Device d("{transfer_layer: [{name: intf, type: FakeInterface}],"
+              "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F}],"
+              "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    RegisterDriver& drv = dynamic_cast<RegisterDriver&>(d.driver("drv"));
+    const FakeInterface& intf = dynamic_cast<const FakeInterface&>(d.interface("intf"));
+
+    drv.set({{"TESTARR", std::vector<std::uint8_t>{0x87u, 0x4Eu}}, {"TESTVAL", 0x91A2u}, {"TESTVAL_A", 0x23432u}});
+
+    const int readCount = intf.getReadCount();
+
+    const auto contents = drv.getMultiple({"TESTVAL_A", "TESTARR", "TESTVAL"});
+
+    BOOST_CHECK_EQUAL(intf.getReadCount(), readCount + 1);      //Single merged read
+
+    BOOST_REQUIRE_EQUAL(contents.size(), 3);
+    BOOST_CHECK_EQUAL(std::get<std::uint64_t>(contents[0]), 0x23432u);
+    BOOST_CHECK_EQUAL(std::get<std::vector<std::uint8_t>>(contents[1]), (std::vector<std::uint8_t>{0x87u, 0x4Eu}));
+    BOOST_CHECK_EQUAL(std::get<std::uint64_t>(contents[2]), 0x91A2u);
+
+    BOOST_CHECK(drv.getMultiple({}).empty());
+
+    BOOST_CHECK_THROW(drv.getMultiple({"TESTVAL", "BARFOO"}), std::invalid_argument);
+    BOOST_CHECK_THROW(drv.getMultiple({"TESTVAL", "TRIGGER"}), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
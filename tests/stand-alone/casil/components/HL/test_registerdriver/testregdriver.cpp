@@ -23,6 +23,7 @@
 
 #include "testregdriver.h"
 
+#include <chrono>
 #include <utility>
 
 using casil::HL::TestRegDriver;
@@ -52,10 +53,34 @@ TestRegDriver::TestRegDriver(std::string pName, InterfaceBaseType& pInterface, L
         {"TESTVAL_F", {.type{DataType::Value},     .mode{AccessMode::ReadWrite}, .addr{29}, .size{58}, .offs{3}}},
         {"TESTVAL_G", {.type{DataType::Value},     .mode{AccessMode::ReadWrite}, .addr{37}, .size{63}, .offs{3}}}}),
     initCount(0),
-    closeCount(0)
+    closeCount(0),
+    fakeActionEnd(std::chrono::steady_clock::now()),
+    donePollCount(0)
 {
 }
 
+//Public
+
+bool TestRegDriver::isDone()
+{
+    ++donePollCount;
+    return std::chrono::steady_clock::now() >= fakeActionEnd;
+}
+
+//
+
+void TestRegDriver::startFakeAction(const std::chrono::milliseconds pDuration)
+{
+    trigger("TRIGGER");
+    fakeActionEnd = std::chrono::steady_clock::now() + pDuration;
+    donePollCount = 0;
+}
+
+int TestRegDriver::getDonePollCount() const
+{
+    return donePollCount;
+}
+
 //Private
 
 bool TestRegDriver::initModule()
@@ -29,6 +29,7 @@
 #include <casil/layerconfig.h>
 #include <casil/layerfactorymacros.h>
 
+#include <chrono>
 #include <cstdint>
 #include <string>
 
@@ -43,6 +44,11 @@ class TestRegDriver final : public RegisterDriver
 public:
     TestRegDriver(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig);
     ~TestRegDriver() override = default;
+    //
+    bool isDone() override;
+    //
+    void startFakeAction(std::chrono::milliseconds pDuration);
+    int getDonePollCount() const;
 
 private:
     bool initModule() override;
@@ -56,6 +62,9 @@ private:
 private:
     int initCount;
     int closeCount;
+    //
+    std::chrono::steady_clock::time_point fakeActionEnd;
+    int donePollCount;
 
 private:
     static constexpr std::uint8_t requireFirmwareVersion = 11;
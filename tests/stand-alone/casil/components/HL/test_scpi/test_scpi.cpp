@@ -24,10 +24,14 @@
 #include <casil/device.h>
 #include <casil/HL/Direct/scpi.h>
 
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <variant>
+#include <vector>
 
 using casil::Device;
 using casil::HL::SCPI;
@@ -250,6 +254,189 @@ BOOST_AUTO_TEST_CASE(Test3_commandsWithChannels)
     BOOST_CHECK_EQUAL(exceptionCtr, 1);
 }
 
+BOOST_AUTO_TEST_CASE(Test4_batch)
+{
+    for (const std::string compound : {"false", "true"})
+    {
+        Device d("{transfer_layer: [{name: intf, type: DummyInterface}],"
+                  "hw_drivers: [{name: drv, type: SCPI, interface: intf, init: {device: \"Keithley 2400\", compound_commands: " + compound + "}}],"
+                  "registers: []}");
+
+        const SCPI& scpi = dynamic_cast<SCPI&>(d["drv"]);
+
+        //Command calls that should work
+
+        try
+        {
+            BOOST_CHECK(scpi.batch({}).empty());
+
+            //Expecting empty string response because of DummyInterface
+            const std::vector<SCPI::VariantValueType> results = scpi.batch({{"set_voltage", std::nullopt, 1.5}, {"get_current", -1},
+                                                                            {"off"}});
+
+            BOOST_REQUIRE_EQUAL(results.size(), 3);
+            BOOST_CHECK(std::holds_alternative<std::monostate>(results[0]));
+            BOOST_CHECK(std::holds_alternative<std::string>(results[1]) && std::get<std::string>(results[1]) == "");
+            BOOST_CHECK(std::holds_alternative<std::monostate>(results[2]));
+
+            BOOST_CHECK_EQUAL(scpi.batch({{"off"}, {"set_voltage", std::nullopt, 0}}).size(), 2);
+        }
+        catch (const std::invalid_argument&)
+        {
+            BOOST_CHECK(false);
+        }
+
+        //Command calls that should not work
+
+        int exceptionCtr = 0;
+
+        //Wrong channel
+        try { scpi.batch({{"off"}, {"off", 1}}); }
+        catch (const std::invalid_argument&) { ++exceptionCtr; }
+
+        //Missing value argument
+        try { scpi.batch({{"off"}, {"set_voltage"}}); }
+        catch (const std::invalid_argument&) { ++exceptionCtr; }
+
+        //Unknown command
+        try { scpi.batch({{"get_current"}, {"no_such_command"}}); }
+        catch (const std::invalid_argument&) { ++exceptionCtr; }
+
+        BOOST_CHECK_EQUAL(exceptionCtr, 3);
+
+        //Single empty response (DummyInterface) cannot be split into two for a compound message
+        if (compound == "true")
+            BOOST_CHECK_THROW(scpi.batch({{"get_current"}, {"get_current"}}), std::runtime_error);
+        else
+            BOOST_CHECK_EQUAL(scpi.batch({{"get_current"}, {"get_current"}}).size(), 2);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test5_handles)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyInterface}],"
+              "hw_drivers: [{name: drv, type: SCPI, interface: intf, init: {device: \"Keithley 2400\"}},"
+                           "{name: drv2, type: SCPI, interface: intf, init: {device: TTi QL355TP}}],"
+              "registers: []}");
+
+    const SCPI& scpi = dynamic_cast<SCPI&>(d["drv"]);
+    const SCPI& scpi2 = dynamic_cast<SCPI&>(d["drv2"]);
+
+    //Command calls that should work
+
+    try
+    {
+        const SCPI::CommandHandle setVoltage = scpi.handle("set_voltage");
+        const SCPI::CommandHandle getCurrent = scpi.handle("get_current", -1);
+        const SCPI::CommandHandle off = scpi.handle("off", std::nullopt);
+
+        BOOST_CHECK_EQUAL(setVoltage.getName(), "set_voltage");
+        BOOST_CHECK_EQUAL(setVoltage.getChannel(), -1);
+        BOOST_CHECK(setVoltage.isQuery() == false);
+        BOOST_CHECK(setVoltage.isSetter() == true);
+        BOOST_CHECK(getCurrent.isQuery() == true);
+        BOOST_CHECK(getCurrent.isSetter() == false);
+        BOOST_CHECK(off.isQuery() == false);
+        BOOST_CHECK(off.isSetter() == false);
+
+        scpi.writeCommand(setVoltage, 1.5);
+        scpi.writeCommand(setVoltage, 0);
+        scpi.writeCommand(off);
+
+        //Expecting empty return value because of DummyInterface
+        BOOST_CHECK(scpi.queryCommand(getCurrent) == "");
+
+        BOOST_CHECK(scpi.command(getCurrent).has_value() == true);
+        BOOST_CHECK(scpi.command(setVoltage, "0.0").has_value() == false);
+        BOOST_CHECK(scpi(off).has_value() == false);
+    }
+    catch (const std::invalid_argument&)
+    {
+        BOOST_CHECK(false);
+    }
+
+    //Command calls that should not work
+
+    int exceptionCtr = 0;
+
+    //Unknown command
+    try { (void)scpi.handle("no_such_command"); }
+    catch (const std::invalid_argument&) { ++exceptionCtr; }
+
+    //Wrong channel
+    try { (void)scpi.handle("off", 1); }
+    catch (const std::invalid_argument&) { ++exceptionCtr; }
+
+    //Query command as write command
+    try { scpi.writeCommand(scpi.handle("get_current")); }
+    catch (const std::invalid_argument&) { ++exceptionCtr; }
+
+    //Write command as query command
+    try { (void)scpi.queryCommand(scpi.handle("off")); }
+    catch (const std::invalid_argument&) { ++exceptionCtr; }
+
+    //Missing value argument
+    try { scpi.writeCommand(scpi.handle("set_voltage")); }
+    catch (const std::invalid_argument&) { ++exceptionCtr; }
+
+    //Handle from driver with different device description
+    try { scpi2.writeCommand(scpi.handle("off")); }
+    catch (const std::invalid_argument&) { ++exceptionCtr; }
+
+    BOOST_CHECK_EQUAL(exceptionCtr, 6);
+}
+
+BOOST_AUTO_TEST_CASE(Test6_streaming)
+{
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: DummyInterface}],"
+                             "hw_drivers: [{name: drv, type: SCPI, interface: intf, init: {device: \"Keithley 2400\", stream_buffer_size: 0}}],"
+                             "registers: []}"),
+                      std::runtime_error);
+
+    Device d("{transfer_layer: [{name: intf, type: DummyInterface}],"
+              "hw_drivers: [{name: drv, type: SCPI, interface: intf, init: {device: \"Keithley 2400\", stream_buffer_size: 16}}],"
+              "registers: []}");
+
+    SCPI& scpi = dynamic_cast<SCPI&>(d["drv"]);
+
+    //DummyInterface does not support record streaming
+
+    BOOST_CHECK_THROW(scpi.startStreaming(), std::runtime_error);
+    BOOST_CHECK(scpi.isStreaming() == false);
+
+    BOOST_CHECK_NO_THROW(scpi.stopStreaming());
+
+    BOOST_CHECK(scpi.readStream().empty());
+    BOOST_CHECK(scpi.readStream(5, std::chrono::milliseconds(10)).empty());
+
+    const SCPI::StreamStatistics stats = scpi.getStreamStatistics();
+
+    BOOST_CHECK_EQUAL(stats.records, 0);
+    BOOST_CHECK_EQUAL(stats.values, 0);
+    BOOST_CHECK_EQUAL(stats.droppedValues, 0);
+    BOOST_CHECK_EQUAL(stats.parseErrors, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Test7_binaryQueries)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyInterface}],"
+              "hw_drivers: [{name: drv, type: SCPI, interface: intf, init: {device: \"Keithley 2400\"}}],"
+              "registers: []}");
+
+    const SCPI& scpi = dynamic_cast<SCPI&>(d["drv"]);
+
+    //Empty response (DummyInterface) is no valid block header
+
+    std::array<std::uint8_t, 4> buffer {};
+
+    BOOST_CHECK_THROW(scpi.queryBinary("get_current"), std::runtime_error);
+    BOOST_CHECK_THROW(scpi.queryBinaryInto(buffer, "get_current"), std::runtime_error);
+    BOOST_CHECK_THROW(scpi.queryBinaryAs<std::int16_t>("get_current"), std::runtime_error);
+
+    BOOST_CHECK_THROW(scpi.queryBinary("off"), std::invalid_argument);
+    BOOST_CHECK_THROW(scpi.queryBinaryAs<float>("get_current", 1), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
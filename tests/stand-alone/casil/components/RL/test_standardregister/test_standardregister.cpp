@@ -25,14 +25,20 @@
 
 #include <casil/bytes.h>
 #include <casil/device.h>
+#include <casil/HL/Muxed/gpio.h>
 #include <casil/RL/standardregister.h>
 
 #include <boost/dynamic_bitset.hpp>
 
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <future>
+#include <limits>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 using casil::Device;
@@ -1330,6 +1336,19 @@ BOOST_AUTO_TEST_CASE(Test17_loadDumpConf)
     BOOST_CHECK_EQUAL(reg.root().toBits(), boost::dynamic_bitset(std::string("1011100110111110000011010000000110001000000001110110011"
                                                                              "001101011110111001100001010010010100110010110100101011")));
 
+    const std::vector<std::uint8_t> rsnap = reg.dumpRuntimeSnapshot();
+
+    BOOST_CHECK(rsnap == reg.toBytes());
+
+    reg.setAll(false);
+
+    BOOST_CHECK(reg.loadRuntimeSnapshot(rsnap));
+
+    BOOST_CHECK_EQUAL(reg.root().toBits(), boost::dynamic_bitset(std::string("1011100110111110000011010000000110001000000001110110011"
+                                                                             "001101011110111001100001010010010100110010110100101011")));
+
+    BOOST_CHECK(reg.loadRuntimeSnapshot(std::span(rsnap).first(rsnap.size() - 1)) == false);
+
     reg.setAll(false);
 
     BOOST_CHECK(reg.loadRuntimeConfiguration("["
@@ -1415,6 +1434,689 @@ BOOST_AUTO_TEST_CASE(Test17_loadDumpConf)
                                              "]") == false);            //Multiple child nodes
 }
 
+BOOST_AUTO_TEST_CASE(Test18_largeMatrix)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: GPIO, interface: intf, base_addr: 0x0, size: 131072}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 131072, fields: ["
+                                "{name: PIXEL, offset: 131071, size: 8, repeat: 16384, fields: ["
+                                    "{name: TDAC, offset: 7, size: 4, bit_order: [0, 1, 2, 3]},"
+                                    "{name: EN, offset: 3, size: 1},"
+                                    "{name: INJ, offset: 2, size: 3}"
+                                "]}"
+                            "]}]}");
+
+    BOOST_REQUIRE(d["reg"].init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+
+    BOOST_CHECK_EQUAL(reg["PIXEL"].getSize(), 131072);
+    BOOST_CHECK_EQUAL(reg["PIXEL"].n(16383).getTotalOffset(), 7);
+    BOOST_CHECK_EQUAL(reg["PIXEL"].n(16383)["INJ"].getTotalOffset(), 2);
+
+    reg["PIXEL"].n(0)["TDAC"] = 0b0001u;
+    reg["PIXEL"].n(16383)["TDAC"] = 0b0011u;
+    reg["PIXEL"].n(16383)["EN"][0] = true;
+    reg["PIXEL"].n(8191)["INJ"] = 0b101u;
+
+    BOOST_CHECK_EQUAL(reg["PIXEL"].n(0)["TDAC"].toUInt(), 0b0001u);
+    BOOST_CHECK_EQUAL(reg["PIXEL"].n(16383)["TDAC"].toUInt(), 0b0011u);
+    BOOST_CHECK_EQUAL(reg["PIXEL"].n(8191)["INJ"].toUInt(), 0b101u);
+
+    //Reversed bit order of TDAC
+    BOOST_CHECK_EQUAL(reg[131071].get(), true);
+    BOOST_CHECK_EQUAL(reg[131068].get(), false);
+    BOOST_CHECK_EQUAL(reg[7].get(), true);
+    BOOST_CHECK_EQUAL(reg[6].get(), true);
+    BOOST_CHECK_EQUAL(reg[5].get(), false);
+    BOOST_CHECK_EQUAL(reg[3].get(), true);
+    BOOST_CHECK_EQUAL(reg[65538].get(), true);
+    BOOST_CHECK_EQUAL(reg[65537].get(), false);
+    BOOST_CHECK_EQUAL(reg[65536].get(), true);
+    BOOST_CHECK_EQUAL(reg.get().count(), 6);
+
+    //Bit proxies of on-demand fields directly reference the register bits
+    reg.setAll(false);
+    {
+        const StandardRegister::BoolRef bit = reg["PIXEL"].n(1)["TDAC"](1, 3)[0];
+        BOOST_CHECK_EQUAL(bit.get(), false);
+        reg[131060] = true;
+        BOOST_CHECK_EQUAL(bit.get(), true);
+    }
+
+    //Strided selection across many repetitions
+    std::vector<std::size_t> enIdxs;
+    for (std::size_t i = 0; i < 16384; i += 2)
+        enIdxs.push_back(131072 - 5 - 8 * i);
+
+    StandardRegister::RegField enField = reg.root()[enIdxs];
+    enField.setAll(true);
+
+    BOOST_CHECK_EQUAL(reg.get().count(), 8192 + 1);
+    BOOST_CHECK_EQUAL(reg["PIXEL"].n(0)["EN"].toUInt(), 1u);
+    BOOST_CHECK_EQUAL(reg["PIXEL"].n(1)["EN"].toUInt(), 0u);
+    BOOST_CHECK_EQUAL(reg["PIXEL"].n(16382)["EN"].toUInt(), 1u);
+    BOOST_CHECK_EQUAL(enField.toBits().count(), 8192);
+
+    //Large registers dump their runtime configuration as binary blob
+
+    const std::string rconf = reg.dumpRuntimeConfiguration();
+
+    BOOST_CHECK(rconf.starts_with("- !!binary "));
+    BOOST_CHECK_LT(rconf.size(), 131072 / 4);
+
+    const boost::dynamic_bitset<> bits = reg.get();
+
+    reg.setAll(false);
+
+    BOOST_CHECK(reg.loadRuntimeConfiguration(rconf));
+    BOOST_CHECK_EQUAL(reg.get(), bits);
+
+    BOOST_CHECK(reg.loadRuntimeConfiguration("[!!binary AAAA]") == false);
+    BOOST_CHECK(reg.loadRuntimeConfiguration("[!!binary A*AA]") == false);
+    BOOST_CHECK_EQUAL(reg.get(), bits);
+}
+
+BOOST_AUTO_TEST_CASE(Test19_wideFieldUIntAssignConvert)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: GPIO, interface: intf, base_addr: 0x0, size: 170}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 170, "
+                           "fields: ["
+                            "{name: Wide, offset: 169, size: 100},"
+                            "{name: Rev, offset: 69, size: 70, bit_order: [" +
+                                []()
+                                {
+                                    std::string order;
+                                    for (int i = 0; i < 70; ++i)
+                                        order += std::to_string(i) + (i < 69 ? ", " : "");
+                                    return order;
+                                }() + "]}"
+                           "]}"
+                         "]}");
+
+    BOOST_REQUIRE(d["reg"].init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+
+    reg.setAll(true);
+
+    //Only the 64 least significant bits are assigned from and converted to integers, remaining bits are cleared
+    reg["Wide"] = std::uint64_t{0x8000000000000001u};
+
+    BOOST_CHECK_EQUAL(reg["Wide"].toUInt(), std::uint64_t{0x8000000000000001u});
+    BOOST_CHECK_EQUAL(reg["Wide"].toBits().count(), 2u);
+    BOOST_CHECK_EQUAL(reg[70].get(), true);
+    BOOST_CHECK_EQUAL(reg[133].get(), true);
+    BOOST_CHECK_EQUAL(reg[69].get(), true);
+
+    reg["Wide"][80] = true;
+
+    BOOST_CHECK_EQUAL(reg["Wide"].toUInt(), std::uint64_t{0x8000000000000001u});
+
+    reg["Wide"].setAll(false);
+
+    BOOST_CHECK_EQUAL(reg["Wide"].toUInt(), std::uint64_t{0u});
+    BOOST_CHECK_EQUAL(reg.get().count(), 70u);
+
+    //Reversed bit order
+    reg["Rev"] = std::uint64_t{0x3u};
+
+    BOOST_CHECK_EQUAL(reg["Rev"].toUInt(), std::uint64_t{0x3u});
+    BOOST_CHECK_EQUAL(reg[69].get(), true);
+    BOOST_CHECK_EQUAL(reg[68].get(), true);
+    BOOST_CHECK_EQUAL(reg[67].get(), false);
+    BOOST_CHECK_EQUAL(reg[0].get(), false);
+    BOOST_CHECK_EQUAL(reg.get().count(), 2u);
+
+    reg["Rev"].setAll(true);
+
+    BOOST_CHECK_EQUAL(reg.get().count(), 70u);
+    BOOST_CHECK_EQUAL(reg["Rev"].toUInt(), std::numeric_limits<std::uint64_t>::max());
+
+    reg["Rev"] = std::uint64_t{0xF0E1D2C3B4A59687u};
+
+    BOOST_CHECK_EQUAL(reg["Rev"].toUInt(), std::uint64_t{0xF0E1D2C3B4A59687u});
+    BOOST_CHECK_EQUAL(reg[69].get(), true);
+    BOOST_CHECK_EQUAL(reg[66].get(), false);
+    BOOST_CHECK_EQUAL(reg[6].get(), true);
+    BOOST_CHECK_EQUAL(reg[5].get(), false);
+    BOOST_CHECK_EQUAL(reg.get().count(), static_cast<std::size_t>(std::popcount(std::uint64_t{0xF0E1D2C3B4A59687u})));
+
+    boost::dynamic_bitset<> wideBits(100);
+    wideBits[0] = true;
+    wideBits[99] = true;
+
+    reg["Wide"] = wideBits;
+
+    BOOST_CHECK(reg["Wide"].toBits() == wideBits);
+    BOOST_CHECK_EQUAL(reg[169].get(), true);
+    BOOST_CHECK_EQUAL(reg[71].get(), false);
+}
+
+BOOST_AUTO_TEST_CASE(Test20_writeDirty)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: TestReadbackDriver, interface: intf, base_addr: 0x0, size: 200},"
+                           "{name: GPIO2, type: TestReadbackDriver, interface: intf, base_addr: 0x0, size: 200}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 200},"
+                          "{name: reg2, type: StandardRegister, hw_driver: GPIO2, size: 200}]}");
+
+    BOOST_REQUIRE(d.init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+    StandardRegister& reg2 = dynamic_cast<StandardRegister&>(d.reg("reg2"));
+
+    auto& drv = dynamic_cast<casil::Layers::HL::TestReadbackDriver&>(d["GPIO"]);
+    auto& drv2 = dynamic_cast<casil::Layers::HL::TestReadbackDriver&>(d["GPIO2"]);
+
+    using CallsType = std::vector<std::pair<std::uint32_t, std::size_t>>;
+
+    //Without previous full write falls back to full write
+    reg2.writeDirty();
+    BOOST_CHECK(drv2.getSetDataCalls() == (CallsType{{0, 25}}));
+
+    reg.write();
+    BOOST_CHECK(drv.getSetDataCalls() == (CallsType{{0, 25}}));
+
+    //Nothing changed
+    reg.writeDirty();
+    BOOST_CHECK(drv.getSetDataCalls() == (CallsType{{0, 25}}));
+
+    //Far apart changes (least and most significant bytes)
+    reg[0] = true;
+    reg[199] = true;
+    reg.writeDirty();
+    BOOST_CHECK(drv.getSetDataCalls() == (CallsType{{0, 25}, {0, 1}, {24, 1}}));
+    BOOST_CHECK(drv.getData(25) == reg.toBytes());
+
+    //Close changes (bytes 10 and 14) are merged into one span
+    reg[112] = true;
+    reg[80] = true;
+    reg.writeDirty();
+    BOOST_CHECK(drv.getSetDataCalls() == (CallsType{{0, 25}, {0, 1}, {24, 1}, {10, 5}}));
+    BOOST_CHECK(drv.getData(25) == reg.toBytes());
+
+    //Truncated write updates the reference as well
+    reg[199] = false;
+    reg.write(1);
+    reg.writeDirty();
+    BOOST_CHECK(drv.getSetDataCalls() == (CallsType{{0, 25}, {0, 1}, {24, 1}, {10, 5}, {0, 1}}));
+}
+
+BOOST_AUTO_TEST_CASE(Test21_repeatedFieldBulkAccess)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: GPIO, interface: intf, base_addr: 0x0, size: 8192}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 8192, fields: ["
+                                "{name: PIXEL, offset: 8191, size: 8, repeat: 1024, fields: ["
+                                    "{name: TDAC, offset: 7, size: 4, bit_order: [0, 1, 2, 3]},"
+                                    "{name: EN, offset: 3, size: 1}"
+                                "]}"
+                            "]}]}");
+
+    BOOST_REQUIRE(d["reg"].init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+
+    std::vector<std::uint64_t> tdacs(1024);
+    for (std::size_t i = 0; i < tdacs.size(); ++i)
+        tdacs[i] = i % 16;
+
+    reg["PIXEL"].setRepeated(tdacs, "TDAC");
+
+    for (std::size_t i = 0; i < tdacs.size(); i += 97)
+        BOOST_CHECK_EQUAL(reg["PIXEL"].n(i)["TDAC"].toUInt(), tdacs[i]);
+
+    BOOST_CHECK(reg["PIXEL"].getRepeated("TDAC") == tdacs);
+    BOOST_CHECK(reg["PIXEL"].getRepeated("EN") == std::vector<std::uint64_t>(1024, 0u));
+
+    //Whole repetitions
+    reg["PIXEL"].setRepeated(std::vector<std::uint64_t>(1024, 0xFFu));
+    BOOST_CHECK_EQUAL(reg.get().count(), 8192u);
+    BOOST_CHECK(reg["PIXEL"].getRepeated() == std::vector<std::uint64_t>(1024, 0xFFu));
+
+    bool wrongCountThrown = false;
+    try { reg["PIXEL"].setRepeated(std::vector<std::uint64_t>(1023, 0u), "TDAC"); }
+    catch (const std::invalid_argument&) { wrongCountThrown = true; }
+    BOOST_CHECK(wrongCountThrown);
+
+    bool wrongNameThrown = false;
+    try { (void)reg["PIXEL"].getRepeated("INJ"); }
+    catch (const std::invalid_argument&) { wrongNameThrown = true; }
+    BOOST_CHECK(wrongNameThrown);
+
+    bool noRepsThrown = false;
+    try { (void)reg["PIXEL"].n(0).getRepeated(); }
+    catch (const std::runtime_error&) { noRepsThrown = true; }
+    BOOST_CHECK(noRepsThrown);
+}
+
+BOOST_AUTO_TEST_CASE(Test22_sharedFieldLayout)
+{
+    const std::string fieldsConf = "fields: [{name: PIXEL, offset: 63, size: 8, repeat: 8, fields: ["
+                                                "{name: TDAC, offset: 7, size: 4, bit_order: [0, 1, 2, 3]},"
+                                                "{name: EN, offset: 3, size: 1}"
+                                           "]}]";
+
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: GPIO, interface: intf, base_addr: 0x0, size: 64},"
+                           "{name: GPIO2, type: GPIO, interface: intf, base_addr: 0x10, size: 72}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 64, " + fieldsConf + "},"
+                          "{name: reg2, type: StandardRegister, hw_driver: GPIO, size: 64, " + fieldsConf + "},"
+                          "{name: reg3, type: StandardRegister, hw_driver: GPIO2, size: 72, " + fieldsConf + "}]}");
+
+    BOOST_REQUIRE(d["reg"].init());
+    BOOST_REQUIRE(d["reg2"].init());
+    BOOST_REQUIRE(d["reg3"].init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+    StandardRegister& reg2 = dynamic_cast<StandardRegister&>(d.reg("reg2"));
+    StandardRegister& reg3 = dynamic_cast<StandardRegister&>(d.reg("reg3"));
+
+    //Registers with identical field configuration still have separate data
+    reg["PIXEL"].n(0)["TDAC"] = 0b0001u;
+    reg2["PIXEL"].n(7)["EN"] = 1u;
+
+    BOOST_CHECK_EQUAL(reg.get(), boost::dynamic_bitset(std::string("1000") + std::string(60, '0')));
+    BOOST_CHECK_EQUAL(reg2.get(), boost::dynamic_bitset(std::string(60, '0') + std::string("1000")));
+    BOOST_CHECK_EQUAL(reg3.get().count(), 0u);
+
+    BOOST_CHECK_EQUAL(reg3["PIXEL"].getTotalOffset(), 63u);
+    BOOST_CHECK_EQUAL(reg3.getSize(), 72u);
+
+    //Field configuration is still validated for every register size
+    bool extentThrown = false;
+    try
+    {
+        Device d2("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+                   "hw_drivers: [{name: GPIO, type: GPIO, interface: intf, base_addr: 0x0, size: 64}],"
+                   "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 64, " + fieldsConf + "},"
+                               "{name: reg2, type: StandardRegister, hw_driver: GPIO, size: 63, " + fieldsConf + "}]}");
+        (void)d2;
+    }
+    catch (const std::runtime_error&) { extentThrown = true; }
+    BOOST_CHECK(extentThrown);
+}
+
+BOOST_AUTO_TEST_CASE(Test23_compareReadback)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: TestReadbackDriver, interface: intf, base_addr: 0x0, size: 200},"
+                           "{name: GPIO2, type: TestReadbackDriver, interface: intf, base_addr: 0x0, size: 197}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 200},"
+                          "{name: reg2, type: StandardRegister, hw_driver: GPIO2, size: 197}]}");
+
+    BOOST_REQUIRE(d.init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+    StandardRegister& reg2 = dynamic_cast<StandardRegister&>(d.reg("reg2"));
+
+    using RangesType = std::vector<std::pair<std::size_t, std::size_t>>;
+
+    BOOST_CHECK(reg.compareReadback().empty());
+
+    for (std::size_t i = 0; i < 200; i += 3)
+        reg[i] = true;
+
+    reg.write();
+    reg.read();
+
+    BOOST_CHECK(reg.getRead() == reg.get());
+    BOOST_CHECK(reg.compareReadback().empty());
+
+    //Mismatches at block boundaries and at the most significant bit
+    reg[0] = false;
+    reg[1] = true;
+    reg[2] = true;
+    reg[63] = false;
+    reg[64] = true;
+    reg[65] = true;
+    reg[128] = true;
+    reg[199] = !reg[199].get();
+
+    BOOST_CHECK(reg.compareReadback() == (RangesType{{2, 0}, {65, 63}, {128, 128}, {199, 199}}));
+
+    //Whole register mismatching
+    reg.set(~reg.getRead());
+    BOOST_CHECK(reg.compareReadback() == (RangesType{{199, 0}}));
+
+    //Mismatch range ending at a block boundary, followed by matching blocks
+    reg.set(reg.getRead());
+    for (std::size_t i = 64; i < 128; ++i)
+        reg[i] = !reg[i].get();
+    BOOST_CHECK(reg.compareReadback() == (RangesType{{127, 64}}));
+
+    //LSB-side padding is removed from the driver data when reading
+    reg2.set(boost::dynamic_bitset<>(197, 0).flip());
+    reg2.write();
+    reg2.read();
+    BOOST_CHECK(reg2.compareReadback().empty());
+
+    reg2.setAll(false);
+    BOOST_CHECK(reg2.compareReadback() == (RangesType{{196, 0}}));
+}
+
+BOOST_AUTO_TEST_CASE(Test24_bitRangeAccess)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: TestReadbackDriver, interface: intf, base_addr: 0x0, size: 100}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 100, "
+                           "fields: [{name: A, offset: 99, size: 70}, {name: B, offset: 20, size: 8}]}]}");
+
+    BOOST_REQUIRE(d.init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+
+    reg.setBitRange(20, 8, 0x1A5);
+    BOOST_CHECK_EQUAL(reg["B"].toUInt(), 0xA5);
+    BOOST_CHECK_EQUAL(reg.getBitRange(20, 8), 0xA5);
+    BOOST_CHECK_EQUAL(reg.getBitRange(16, 4), 0x5);
+
+    reg["A"] = 0xFEDCBA9876543210u;
+    BOOST_CHECK_EQUAL(reg.getBitRange(99, 70), 0xFEDCBA9876543210u);
+    BOOST_CHECK_EQUAL(reg.getBitRange(93, 64), 0xFEDCBA9876543210u);
+
+    reg.setBitRange(99, 70, 0);
+    BOOST_CHECK_EQUAL(reg["A"].toUInt(), 0);
+    BOOST_CHECK_EQUAL(reg["B"].toUInt(), 0xA5);
+
+    BOOST_CHECK_EQUAL(reg.getReadBitRange(20, 8), 0);
+    reg.write();
+    reg.read();
+    BOOST_CHECK_EQUAL(reg.getReadBitRange(20, 8), 0xA5);
+
+    BOOST_CHECK_THROW(reg.setBitRange(100, 1, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(reg.setBitRange(5, 7, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(reg.getBitRange(5, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(reg.getReadBitRange(100, 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Test25_asyncAccess)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: TestReadbackDriver, interface: intf, base_addr: 0x0, size: 16}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 16, "
+                           "fields: [{name: A, offset: 15, size: 16}]}]}");
+
+    BOOST_REQUIRE(d.init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+
+    reg["A"] = 0xBEEF;
+
+    std::future<void> writeFuture = reg.writeAsync();
+    std::future<void> readFuture = reg.readAsync();
+
+    //Operations of interface, driver and register share the interface's executor and hence run in order
+
+    std::vector<int> order;
+
+    std::future<void> intfFuture = d.interface("intf").runAsync([&order]() { order.push_back(1); });
+    std::future<void> driverFuture = d.driver("GPIO").runAsync([&order]() { order.push_back(2); });
+    std::future<std::uint64_t> regFuture = reg.runAsync([&order, &reg]() { order.push_back(3); return reg.getReadBitRange(15, 16); });
+
+    BOOST_CHECK_NO_THROW(writeFuture.get());
+    BOOST_CHECK_NO_THROW(readFuture.get());
+    intfFuture.get();
+    driverFuture.get();
+
+    BOOST_CHECK_EQUAL(regFuture.get(), 0xBEEF);
+    BOOST_CHECK(order == (std::vector<int>{1, 2, 3}));
+
+    BOOST_CHECK_THROW(reg.readAsync(3).get(), std::invalid_argument);
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test26_writeGroup)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: TestReadbackDriver, interface: intf, base_addr: 0x0, size: 8},"
+                           "{name: GPIO2, type: TestReadbackDriver, interface: intf, base_addr: 0x0, size: 8}],"
+              "registers: [{name: glob, type: StandardRegister, hw_driver: GPIO, size: 16},"
+                          "{name: pix, type: StandardRegister, hw_driver: GPIO, size: 8, data_offset: 2},"
+                          "{name: col, type: StandardRegister, hw_driver: GPIO, size: 8, data_offset: 4},"
+                          "{name: other, type: StandardRegister, hw_driver: GPIO2, size: 8},"
+                          "{name: overlap, type: StandardRegister, hw_driver: GPIO, size: 8, data_offset: 1}]}");
+
+    BOOST_REQUIRE(d.init());
+
+    StandardRegister& glob = dynamic_cast<StandardRegister&>(d.reg("glob"));
+    StandardRegister& pix = dynamic_cast<StandardRegister&>(d.reg("pix"));
+    StandardRegister& col = dynamic_cast<StandardRegister&>(d.reg("col"));
+    StandardRegister& other = dynamic_cast<StandardRegister&>(d.reg("other"));
+    StandardRegister& overlap = dynamic_cast<StandardRegister&>(d.reg("overlap"));
+
+    auto& drv = dynamic_cast<casil::Layers::HL::TestReadbackDriver&>(d["GPIO"]);
+    auto& drv2 = dynamic_cast<casil::Layers::HL::TestReadbackDriver&>(d["GPIO2"]);
+
+    using CallsType = std::vector<std::pair<std::uint32_t, std::size_t>>;
+
+    glob.set(0x1234);
+    pix.set(0x56);
+    col.set(0x78);
+    other.set(0x9A);
+
+    //Overlapping register data is rejected before anything is written
+    BOOST_CHECK_THROW(StandardRegister::writeGroup({glob, overlap}), std::invalid_argument);
+
+    //A data offset requires a driver that supports address offsets
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+                             "hw_drivers: [{name: GPIO, type: GPIO, interface: intf, base_addr: 0x0, size: 8}],"
+                             "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 8, data_offset: 2}]}"),
+                      std::runtime_error);
+    BOOST_CHECK(drv.getSetDataCalls().empty());
+
+    //Adjacent registers of one driver are combined, non-adjacent ones written separately
+    StandardRegister::writeGroup({col, other, pix, glob});
+
+    BOOST_CHECK(drv.getSetDataCalls() == (CallsType{{0, 3}, {4, 1}}));
+    BOOST_CHECK(drv2.getSetDataCalls() == (CallsType{{0, 1}}));
+
+    pix.read();
+    col.read();
+
+    BOOST_CHECK_EQUAL(pix.getReadBitRange(7, 8), 0x56);
+    BOOST_CHECK_EQUAL(col.getReadBitRange(7, 8), 0x78);
+
+    //Written data is tracked for writeDirty()
+    pix.writeDirty();
+
+    BOOST_CHECK_EQUAL(drv.getSetDataCalls().size(), 2);
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test27_commitAsync)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: TestReadbackDriver, interface: intf, base_addr: 0x0, size: 16}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 16, "
+                           "fields: [{name: A, offset: 15, size: 16}]}]}");
+
+    BOOST_REQUIRE(d.init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+
+    auto& drv = dynamic_cast<casil::Layers::HL::TestReadbackDriver&>(d["GPIO"]);
+
+    using CallsType = std::vector<std::pair<std::uint32_t, std::size_t>>;
+
+    //Register data can be changed right after committing without affecting the committed data
+
+    reg["A"] = 0x1234;
+
+    std::future<void> firstFuture = reg.commitAsync();
+
+    reg["A"] = 0xBEEF;
+
+    std::future<void> secondFuture = reg.commitAsync();
+
+    BOOST_CHECK_EQUAL(reg.getBitRange(15, 16), 0xBEEF);
+
+    BOOST_CHECK_NO_THROW(firstFuture.get());
+    BOOST_CHECK_NO_THROW(secondFuture.get());
+
+    BOOST_CHECK(drv.getSetDataCalls() == (CallsType{{0, 2}, {0, 2}}));
+    BOOST_CHECK(drv.getData(2) == (std::vector<std::uint8_t>{0xBE, 0xEF}));
+
+    //Written data is tracked for writeDirty()
+    reg["A"] = 0xBE00;
+    reg.writeDirty();
+
+    BOOST_CHECK(drv.getSetDataCalls() == (CallsType{{0, 2}, {0, 2}, {1, 1}}));
+
+    BOOST_CHECK_THROW(reg.commitAsync(3), std::invalid_argument);
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test28_fieldViews)
+{
+    Device d("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+              "hw_drivers: [{name: GPIO, type: GPIO, interface: intf, base_addr: 0x0, size: 120}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 120, "
+                           "fields: [{name: Wide, offset: 119, size: 80},"
+                                    "{name: Mixed, offset: 39, size: 12, bit_order: [8, 9, 10, 11, 7, 6, 5, 4, 0, 2, 1, 3]}]}]}");
+
+    BOOST_REQUIRE(d["reg"].init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+
+    //Views behave like equivalent (allocating) slice fields, also for fields with custom bit order
+
+    for (const char* const fieldName : {"Wide", "Mixed"})
+    {
+        StandardRegister::RegField& field = reg[fieldName];
+
+        for (std::size_t lsbIdx = 0; lsbIdx < field.getSize(); lsbIdx += 3)
+        {
+            for (std::size_t msbIdx = lsbIdx; msbIdx < field.getSize(); msbIdx += 5)
+            {
+                const std::uint64_t value = 0x9E3779B97F4A7C15u * (lsbIdx + 1) + msbIdx;
+
+                StandardRegister::FieldView view = field.view(msbIdx, lsbIdx);
+
+                BOOST_CHECK_EQUAL(view.getSize(), msbIdx - lsbIdx + 1);
+                BOOST_CHECK_EQUAL(view.getOffset(), lsbIdx);
+
+                reg.setAll(true);
+                view = value;
+                const boost::dynamic_bitset<> viewData = reg.get();
+
+                BOOST_CHECK_EQUAL(view.toUInt(), field(msbIdx, lsbIdx).toUInt());
+
+                reg.setAll(true);
+                field(msbIdx, lsbIdx) = value;
+
+                BOOST_CHECK(reg.get() == viewData);
+                BOOST_CHECK(view.toBits() == field(msbIdx, lsbIdx).toBits());
+            }
+        }
+    }
+
+    reg.setAll(false);
+
+    StandardRegister::FieldView mixedView = reg["Mixed"].view(7, 2);
+
+    mixedView = boost::dynamic_bitset<>(std::string("101101"));
+
+    BOOST_CHECK_EQUAL(mixedView.toUInt(), 0x2Du);
+    BOOST_CHECK_EQUAL(reg["Mixed"].toUInt(), 0x2Du << 2);
+
+    mixedView(3, 1).setAll(false);
+
+    BOOST_CHECK_EQUAL(mixedView.toUInt(), 0x21u);
+    BOOST_CHECK_EQUAL(mixedView(5, 5).toUInt(), 1u);
+
+    mixedView.setAll();
+
+    BOOST_CHECK_EQUAL(reg["Mixed"].toUInt(), 0x3Fu << 2);
+    BOOST_CHECK_EQUAL(reg.get().count(), 6u);
+
+    BOOST_CHECK_THROW((void)reg["Mixed"].view(12, 0), std::invalid_argument);
+    BOOST_CHECK_THROW((void)reg["Mixed"].view(2, 3), std::invalid_argument);
+    BOOST_CHECK_THROW((void)mixedView(6, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(mixedView = boost::dynamic_bitset<>(5), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Test29_noAddressOffsetSupport)
+{
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed}],"
+              "hw_drivers: [{name: GPIO, type: GPIO, interface: intf, base_addr: 0x0, size: 24}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 24},"
+                          "{name: reg2, type: StandardRegister, hw_driver: GPIO, size: 24}]}");
+
+    BOOST_REQUIRE(d.init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+    StandardRegister& reg2 = dynamic_cast<StandardRegister&>(d.reg("reg2"));
+
+    auto& gpio = dynamic_cast<casil::HL::GPIO&>(d["GPIO"]);
+
+    BOOST_CHECK(!gpio.supportsAddressOffset());
+
+    reg.set(0x123456);
+    reg.write();
+
+    BOOST_CHECK(gpio.getBytes("OUTPUT") == (std::vector<std::uint8_t>{0x12, 0x34, 0x56}));
+
+    //Partial writes fall back to full writes if the driver ignores the address offset
+
+    reg.set(0x123457);
+
+    BOOST_CHECK_NO_THROW(reg.writeDirty());
+    BOOST_CHECK(gpio.getBytes("OUTPUT") == (std::vector<std::uint8_t>{0x12, 0x34, 0x57}));
+
+    gpio.setData({0, 0, 0});
+
+    BOOST_CHECK_NO_THROW(reg.writeDirty());
+    BOOST_CHECK(gpio.getBytes("OUTPUT") == (std::vector<std::uint8_t>{0, 0, 0}));
+
+    //Registers are not combined either
+
+    reg2.set(0xABCDEF);
+
+    BOOST_CHECK_NO_THROW(StandardRegister::writeGroup({reg2}));
+    BOOST_CHECK(gpio.getBytes("OUTPUT") == (std::vector<std::uint8_t>{0xAB, 0xCD, 0xEF}));
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test30_update)
+{
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed}],"
+              "hw_drivers: [{name: GPIO, type: GPIO, interface: intf, base_addr: 0x0, size: 24}],"
+              "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 24, fields: ["
+                              "{name: HIGH, size: 8, offset: 23}, {name: MID, size: 8, offset: 15}, {name: LOW, size: 8, offset: 7}]}]}");
+
+    BOOST_REQUIRE(d.init());
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(d.reg("reg"));
+
+    auto& gpio = dynamic_cast<casil::HL::GPIO&>(d["GPIO"]);
+
+    reg.update({{"HIGH", 0x12}, {"MID", 0x34}, {"LOW", 0x56}});
+
+    BOOST_CHECK(gpio.getBytes("OUTPUT") == (std::vector<std::uint8_t>{0x12, 0x34, 0x56}));
+
+    //Repeated updates with single changed bytes are written completely to drivers without address offset support
+
+    BOOST_CHECK_NO_THROW(reg.update({{"LOW", 0x57}}));
+    BOOST_CHECK(gpio.getBytes("OUTPUT") == (std::vector<std::uint8_t>{0x12, 0x34, 0x57}));
+
+    BOOST_CHECK_NO_THROW(reg.update({{"HIGH", 0x13}}));
+    BOOST_CHECK(gpio.getBytes("OUTPUT") == (std::vector<std::uint8_t>{0x13, 0x34, 0x57}));
+
+    //Invalid field paths leave the register unchanged
+
+    BOOST_CHECK_THROW(reg.update({{"MID", 0xAB}, {"NONE", 1}}), std::invalid_argument);
+    BOOST_CHECK_EQUAL(reg["MID"].toUInt(), 0x34);
+
+    BOOST_CHECK(d.close());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -23,6 +23,7 @@
 
 #include "testreadbackdriver.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
 #include <utility>
@@ -37,13 +38,14 @@ TestReadbackDriver::TestReadbackDriver(std::string pName, InterfaceBaseType& pIn
     MuxedDriver(typeName, std::move(pName), pInterface, std::move(pConfig), LayerConfig()),
     data(),
     executed(false),
-    failGetData(false)
+    failGetData(false),
+    setDataCalls()
 {
 }
 
 //Public
 
-std::vector<std::uint8_t> TestReadbackDriver::getData(const int pSize, std::uint32_t)
+std::vector<std::uint8_t> TestReadbackDriver::getData(const int pSize, const std::uint32_t pAddrOffs)
 {
     if (failGetData)
         return {};
@@ -53,18 +55,35 @@ std::vector<std::uint8_t> TestReadbackDriver::getData(const int pSize, std::uint
 
     const std::size_t tSize = static_cast<std::size_t>(pSize);
 
-    if (tSize > data.size())
+    if (pAddrOffs + tSize > data.size())
         throw std::invalid_argument("Invalid size argument.");
 
-    return std::vector<std::uint8_t>(data.begin(), data.begin()+tSize);
+    return std::vector<std::uint8_t>(data.begin()+pAddrOffs, data.begin()+pAddrOffs+tSize);
 }
 
-void TestReadbackDriver::setData(const std::vector<std::uint8_t>& pData, std::uint32_t)
+void TestReadbackDriver::setData(const std::vector<std::uint8_t>& pData, const std::uint32_t pAddrOffs)
 {
     if (pData == std::vector<std::uint8_t>{0b10101010u, 0b10101010u})   //Trigger unexpected behavior of getData() for test
         failGetData = true;
 
-    data = pData;
+    setDataCalls.emplace_back(pAddrOffs, pData.size());
+
+    if (pAddrOffs == 0)
+    {
+        data = pData;
+        return;
+    }
+
+    //Partial write at byte offset
+    if (data.size() < pAddrOffs + pData.size())
+        data.resize(pAddrOffs + pData.size(), 0u);
+
+    std::copy(pData.begin(), pData.end(), data.begin() + pAddrOffs);
+}
+
+bool TestReadbackDriver::supportsAddressOffset() const
+{
+    return true;
 }
 
 void TestReadbackDriver::exec()
@@ -78,6 +97,13 @@ bool TestReadbackDriver::isDone()
     return executed;
 }
 
+//
+
+const std::vector<std::pair<std::uint32_t, std::size_t>>& TestReadbackDriver::getSetDataCalls() const
+{
+    return setDataCalls;
+}
+
 //Private
 
 bool TestReadbackDriver::initImpl()
@@ -29,8 +29,10 @@
 #include <casil/layerconfig.h>
 #include <casil/layerfactorymacros.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace casil
@@ -47,8 +49,11 @@ public:
     //
     std::vector<std::uint8_t> getData(int pSize = -1, std::uint32_t pAddrOffs = 0) override;
     void setData(const std::vector<std::uint8_t>& pData, std::uint32_t pAddrOffs = 0) override;
+    bool supportsAddressOffset() const override;
     void exec() override;
     bool isDone() override;
+    //
+    const std::vector<std::pair<std::uint32_t, std::size_t>>& getSetDataCalls() const;
 
 private:
     bool initImpl() override;
@@ -58,6 +63,7 @@ private:
     std::vector<std::uint8_t> data;
     bool executed;
     bool failGetData;
+    std::vector<std::pair<std::uint32_t, std::size_t>> setDataCalls;
 
     CASIL_REGISTER_DRIVER_H("TestReadbackDriver")
 };
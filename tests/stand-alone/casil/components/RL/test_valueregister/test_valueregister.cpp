@@ -0,0 +1,185 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/device.h>
+#include <casil/RL/valueregister.h>
+
+#include "../../HL/test_registerdriver/fakeinterface.h"
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using casil::Device;
+using casil::RL::ValueRegister;
+using casil::TL::FakeInterface;
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../../datadirfixture.h"
+
+namespace
+{
+
+//Using TestRegDriver and FakeInterface from RegisterDriver test
+std::string makeConfig(const std::string& pRegisterConfig)
+{
+    return "{transfer_layer: [{name: intf, type: FakeInterface}],"
+           " hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F}],"
+           " registers: [{name: reg, type: ValueRegister, hw_driver: drv, register: TESTVAL" + pRegisterConfig + "}]}";
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(Components_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(ValueRegister_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_configuration)
+{
+    {
+        Device d(makeConfig(""));
+
+        const ValueRegister& reg = dynamic_cast<const ValueRegister&>(d.reg("reg"));
+
+        BOOST_CHECK(reg.getCachePolicy() == ValueRegister::CachePolicy::WriteThrough);
+        BOOST_CHECK_EQUAL(reg.getRegisterName(), "TESTVAL");
+        BOOST_CHECK_EQUAL(reg.getTTL().count(), 0);
+    }
+
+    BOOST_CHECK_EQUAL(dynamic_cast<const ValueRegister&>(Device(makeConfig(", cache_policy: read_cache, ttl: 50")).reg("reg")).getTTL().count(),
+                      50);
+
+    BOOST_CHECK_THROW(Device(makeConfig(", cache_policy: lazy")), std::runtime_error);
+    BOOST_CHECK_THROW(Device(makeConfig(", cache_policy: read_cache")), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: FakeInterface}],"
+                             " hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F}],"
+                             " registers: [{name: reg, type: ValueRegister, hw_driver: drv, register: NOREG}]}"), std::invalid_argument);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+                             " hw_drivers: [{name: drv, type: DummyMuxedDriver, interface: intf, base_addr: 0x0}],"
+                             " registers: [{name: reg, type: ValueRegister, hw_driver: drv, register: TESTVAL}]}"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_cachePolicies)
+{
+    //Write-through: writes go to the driver, subsequent reads are served from the cache
+
+    {
+        Device d(makeConfig(""));
+
+        BOOST_REQUIRE(d.init());
+
+        ValueRegister& reg = dynamic_cast<ValueRegister&>(d.reg("reg"));
+        const FakeInterface& intf = dynamic_cast<const FakeInterface&>(d.interface("intf"));
+
+        reg.set(0x1234);
+
+        const int readsBefore = intf.getReadCount();
+
+        BOOST_CHECK_EQUAL(reg.get(), 0x1234);
+        BOOST_CHECK_EQUAL(reg.get(), 0x1234);
+        BOOST_CHECK_EQUAL(intf.getReadCount(), readsBefore);
+
+        BOOST_CHECK_EQUAL(reg.fetch(), 0x1234);
+        BOOST_CHECK_EQUAL(intf.getReadCount(), readsBefore + 1);
+
+        const ValueRegister::Statistics stats = reg.getStatistics();
+
+        BOOST_CHECK_EQUAL(stats.cacheHits, 2);
+        BOOST_CHECK_EQUAL(stats.driverReads, 1);
+        BOOST_CHECK_EQUAL(stats.driverWrites, 1);
+
+        BOOST_CHECK(d.close());
+    }
+
+    //Write-back: writes are deferred until flush() or close()
+
+    {
+        Device d(makeConfig(", cache_policy: write_back"));
+
+        BOOST_REQUIRE(d.init());
+
+        ValueRegister& reg = dynamic_cast<ValueRegister&>(d.reg("reg"));
+        casil::HL::RegisterDriver& drv = dynamic_cast<casil::HL::RegisterDriver&>(d.driver("drv"));
+
+        drv.setValue("TESTVAL", 0x1111);
+
+        reg.set(0x2222);
+        reg.set(0x3333);
+
+        BOOST_CHECK(reg.isDirty());
+        BOOST_CHECK_EQUAL(reg.get(), 0x3333);
+        BOOST_CHECK_EQUAL(drv.getValue("TESTVAL"), 0x1111);
+        BOOST_CHECK_EQUAL(reg.getStatistics().driverWrites, 0);
+
+        reg.flush();
+
+        BOOST_CHECK(!reg.isDirty());
+        BOOST_CHECK_EQUAL(drv.getValue("TESTVAL"), 0x3333);
+        BOOST_CHECK_EQUAL(reg.getStatistics().driverWrites, 1);
+
+        reg.set(0x4444);
+
+        BOOST_CHECK(d.close());
+        BOOST_CHECK_EQUAL(reg.getStatistics().driverWrites, 2);
+    }
+
+    //Read cache: read values expire after the TTL and writes discard the cache
+
+    {
+        Device d(makeConfig(", cache_policy: read_cache, ttl: 20"));
+
+        BOOST_REQUIRE(d.init());
+
+        ValueRegister& reg = dynamic_cast<ValueRegister&>(d.reg("reg"));
+
+        reg.set(0x5555);
+
+        BOOST_CHECK(!reg.isCached());
+        BOOST_CHECK_EQUAL(reg.get(), 0x5555);
+        BOOST_CHECK(reg.isCached());
+        BOOST_CHECK_EQUAL(reg.get(), 0x5555);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+
+        BOOST_CHECK(!reg.isCached());
+        BOOST_CHECK_EQUAL(reg.get(), 0x5555);
+
+        const ValueRegister::Statistics stats = reg.getStatistics();
+
+        BOOST_CHECK_EQUAL(stats.cacheHits, 1);
+        BOOST_CHECK_EQUAL(stats.driverReads, 2);
+
+        reg.invalidate();
+
+        BOOST_CHECK(!reg.isCached());
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
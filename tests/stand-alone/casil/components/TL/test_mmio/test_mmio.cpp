@@ -0,0 +1,217 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <casil/bytes.h>
+#include <casil/device.h>
+#include <casil/TL/Muxed/mmio.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using casil::Device;
+using casil::TL::MMIO;
+
+namespace boost { using casil::Bytes::operator<<; }
+
+namespace
+{
+
+/*
+ * Creates (or overwrites) a zero-filled file of 'pSize' bytes that stands in for a device file.
+ */
+std::filesystem::path makeDeviceFile(const std::string& pName, const std::size_t pSize)
+{
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / pName;
+
+    std::ofstream file(filePath, std::ios_base::binary | std::ios_base::trunc);
+    const std::vector<char> zeros(pSize, 0);
+    file.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+
+    return filePath;
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Components_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(MMIO_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_config)
+{
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: MMIO, init: {device: \"\"}}], hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: MMIO, init: {device: /dev/null, access_width: 3}}], "
+                             "hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: MMIO, init: {device: /dev/null, fifo_device: /dev/null, fifo_size: 6, "
+                             "fifo_write_pointer: 0, fifo_read_pointer: 4}}], hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: MMIO, init: {device: /dev/null, fifo_device: /dev/null, fifo_size: 64}}], "
+                             "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    Device d("{transfer_layer: [{name: intf, type: MMIO, init: {device: /nonexistent/casil_mmio}}], hw_drivers: [], registers: []}");
+
+    BOOST_CHECK(!d.init());
+    BOOST_CHECK_THROW(dynamic_cast<MMIO&>(d.interface("intf")).read(0, 1), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_busAccess)
+{
+    const std::filesystem::path devicePath = makeDeviceFile("casil_test_mmio_bus", 4096);
+
+    for (const int accessWidth : {1, 2, 4, 8})
+    {
+        Device d("{transfer_layer: [{name: intf, type: MMIO, init: {device: \"" + devicePath.string() + "\", offset: 1024, size: 64, "
+                 "access_width: " + std::to_string(accessWidth) + "}}], hw_drivers: [], registers: []}");
+
+        BOOST_REQUIRE(d.init());
+
+        MMIO& intf = dynamic_cast<MMIO&>(d.interface("intf"));
+
+        BOOST_CHECK(!intf.hasFifo());
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+        //Unaligned transfers mix byte and wide accesses
+
+        const std::vector<std::uint8_t> data = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+
+        intf.write(3, data);
+        BOOST_CHECK_EQUAL(intf.read(2, 21), (std::vector<std::uint8_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                                                                        18, 19, 0}));
+
+        std::vector<std::uint8_t> buffer(4);
+        BOOST_CHECK_EQUAL(intf.readInto(60, buffer), 4);
+
+        BOOST_CHECK_THROW(intf.read(61, 4), std::runtime_error);
+        BOOST_CHECK_THROW(intf.write(64, {1}), std::runtime_error);
+        BOOST_CHECK_THROW(intf.write(MMIO::baseAddrDataLimit, {1}), std::runtime_error);
+
+        intf.write(3, std::vector<std::uint8_t>(data.size(), 0));
+
+        BOOST_CHECK(d.close());
+    }
+
+    //Bus address zero is at the configured offset of the device file
+
+    {
+        Device d("{transfer_layer: [{name: intf, type: MMIO, init: {device: \"" + devicePath.string() + "\", offset: 1024}}], "
+                 "hw_drivers: [], registers: []}");
+
+        BOOST_REQUIRE(d.init());
+        dynamic_cast<MMIO&>(d.interface("intf")).write(0, {0xAB});
+        BOOST_CHECK(d.close());
+    }
+
+    std::ifstream file(devicePath, std::ios_base::binary);
+    file.seekg(1024);
+    BOOST_CHECK_EQUAL(file.get(), 0xAB);
+    file.close();
+
+    std::filesystem::remove(devicePath);
+}
+
+BOOST_AUTO_TEST_CASE(Test3_dmaFifo)
+{
+    const std::filesystem::path devicePath = makeDeviceFile("casil_test_mmio_regs", 256);
+    const std::filesystem::path ringPath = makeDeviceFile("casil_test_mmio_ring", 4096);
+
+    Device d("{transfer_layer: [{name: intf, type: MMIO, init: {device: \"" + devicePath.string() + "\", access_width: 4, "
+             "fifo_device: \"" + ringPath.string() + "\", fifo_offset: 0, fifo_size: 32, "
+             "fifo_write_pointer: 0x10, fifo_read_pointer: 0x14}}], hw_drivers: [], registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    MMIO& intf = dynamic_cast<MMIO&>(d.interface("intf"));
+
+    BOOST_CHECK(intf.hasFifo());
+    BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+    //Emulate the device: fill the ring (wrapping around) and advance the write pointer
+
+    {
+        std::fstream ring(ringPath, std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+
+        const std::vector<std::uint8_t> words = casil::Bytes::composeByteVec(false, std::uint32_t{7}, std::uint32_t{8}, std::uint32_t{1},
+                                                                             std::uint32_t{2}, std::uint32_t{3}, std::uint32_t{4},
+                                                                             std::uint32_t{5}, std::uint32_t{6});
+        ring.write(reinterpret_cast<const char*>(words.data()), static_cast<std::streamsize>(words.size()));
+    }
+
+    intf.write(0x14, casil::Bytes::composeByteVec(false, std::uint32_t{8}));   //Read pointer
+    intf.write(0x10, casil::Bytes::composeByteVec(false, std::uint32_t{8}));   //Write pointer (ring is empty)
+
+    BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+    intf.write(0x10, casil::Bytes::composeByteVec(false, std::uint32_t{4}));   //Write pointer after wrap-around
+
+    BOOST_CHECK_EQUAL(intf.getFifoSize(), 28);
+    BOOST_CHECK_EQUAL(casil::Bytes::composeUInt32(intf.read(MMIO::baseAddrFIFOLimit, 4), false), 28);
+
+    BOOST_CHECK_EQUAL(intf.getFifoData(9), casil::Bytes::composeByteVec(false, std::uint32_t{1}, std::uint32_t{2}));
+    BOOST_CHECK_EQUAL(casil::Bytes::composeUInt32(intf.read(0x14, 4), false), 16);
+
+    std::vector<std::uint32_t> consumed;
+
+    const std::size_t numConsumed = intf.consumeFifo([&consumed](const std::span<const std::uint32_t> pFirst,
+                                                                 const std::span<const std::uint32_t> pSecond) -> void
+                                                     {
+                                                         BOOST_CHECK_EQUAL(pFirst.size(), 4);
+                                                         BOOST_CHECK_EQUAL(pSecond.size(), 1);
+                                                         consumed.insert(consumed.end(), pFirst.begin(), pFirst.end());
+                                                         consumed.insert(consumed.end(), pSecond.begin(), pSecond.end());
+                                                     });
+
+    BOOST_CHECK_EQUAL(numConsumed, 20);
+    BOOST_CHECK(consumed == (std::vector<std::uint32_t>{3, 4, 5, 6, 7}));
+    BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+    intf.write(0x10, casil::Bytes::composeByteVec(false, std::uint32_t{12}));
+
+    BOOST_CHECK_EQUAL(intf.getFifoSize(), 8);
+
+    intf.resetFifo();
+
+    BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+    intf.write(0x10, casil::Bytes::composeByteVec(false, std::uint32_t{6}));
+
+    BOOST_CHECK_THROW(static_cast<void>(intf.getFifoSize()), std::runtime_error);
+
+    BOOST_CHECK(d.close());
+
+    std::filesystem::remove(devicePath);
+    std::filesystem::remove(ringPath);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,303 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/bytes.h>
+#include <casil/device.h>
+#include <casil/TL/Muxed/replaymuxedinterface.h>
+#include <casil/TL/Muxed/simmuxed.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using casil::Device;
+using casil::TL::MuxedInterface;
+using casil::TL::ReplayMuxedInterface;
+using casil::TL::SimMuxed;
+
+namespace boost { using casil::Bytes::operator<<; }
+
+namespace
+{
+
+/*
+ * Returns a device configuration string for a SimMuxed interface recording to 'pSessionPath'.
+ */
+std::string makeRecordConfig(const std::filesystem::path& pSessionPath, const std::string& pExtraInit = "")
+{
+    return "{transfer_layer: [{name: intf, type: SimMuxed, init: {mem_size: 64, fifo_rate: 1000000.0, record_session: \"" +
+           pSessionPath.generic_string() + "\"" + pExtraInit + "}}], hw_drivers: [], registers: []}";
+}
+
+/*
+ * Returns a device configuration string for a ReplayMuxedInterface playing back 'pSessionPath'.
+ */
+std::string makeReplayConfig(const std::filesystem::path& pSessionPath, const std::string& pExtraInit = "")
+{
+    return "{transfer_layer: [{name: intf, type: ReplayMuxedInterface, init: {session_file: \"" +
+           pSessionPath.generic_string() + "\"" + pExtraInit + "}}], hw_drivers: [], registers: []}";
+}
+
+/*
+ * Runs a fixed sequence of bus and FIFO accesses on 'pIntf' and returns all read bytes.
+ */
+std::vector<std::vector<std::uint8_t>> runWorkload(MuxedInterface& pIntf)
+{
+    std::vector<std::vector<std::uint8_t>> results;
+
+    pIntf.write(10, {1, 2, 3});
+    results.push_back(pIntf.read(9, 5));
+
+    const std::vector<MuxedInterface::WriteOp> ops = {{.addr = 60, .data = {4, 5, 6, 7}}, {.addr = 0, .data = {8}}};
+    pIntf.writeBatch(ops);
+    results.push_back(pIntf.query(1, 0, {9}, 2));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    results.push_back(pIntf.read(SimMuxed::baseAddrFIFOLimit + 4, 4));
+    results.push_back(pIntf.read(SimMuxed::baseAddrDataLimit, 64));
+    results.push_back(pIntf.read(SimMuxed::baseAddrDataLimit, -1));
+
+    return results;
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Components_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(ReplayMuxedInterface_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_config)
+{
+    const std::filesystem::path sessionPath = std::filesystem::temp_directory_path() / "casil_test_replay_config.session";
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: ReplayMuxedInterface}], hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device(makeReplayConfig(sessionPath, ", time_scale: -1.0")), std::runtime_error);
+
+    //Missing or malformed session file lets init() fail
+
+    std::filesystem::remove(sessionPath);
+
+    Device d(makeReplayConfig(sessionPath));
+
+    BOOST_CHECK(!d.init());
+
+    {
+        std::ofstream file(sessionPath, std::ios_base::binary);
+        file << "NOTASESSIONFILE";
+    }
+
+    BOOST_CHECK(!d.init());
+
+    std::filesystem::remove(sessionPath);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_recordReplay)
+{
+    const std::filesystem::path sessionPath = std::filesystem::temp_directory_path() / "casil_test_replay_record.session";
+
+    std::vector<std::vector<std::uint8_t>> recordedResults;
+
+    {
+        Device d(makeRecordConfig(sessionPath));
+
+        BOOST_REQUIRE(d.init());
+
+        recordedResults = runWorkload(dynamic_cast<MuxedInterface&>(d.interface("intf")));
+
+        BOOST_CHECK(d.close());
+    }
+
+    BOOST_REQUIRE_EQUAL(recordedResults.size(), 5);
+    BOOST_CHECK_EQUAL(recordedResults[0], (std::vector<std::uint8_t>{0, 1, 2, 3, 0}));
+    BOOST_CHECK_EQUAL(recordedResults[1], (std::vector<std::uint8_t>{8, 9}));
+    BOOST_CHECK_EQUAL(recordedResults[3].size(), 64);
+    BOOST_CHECK_EQUAL(recordedResults[3][4], 1);
+
+    const std::vector<ReplayMuxedInterface::Transaction> session = ReplayMuxedInterface::loadSession(sessionPath.string());
+
+    BOOST_REQUIRE_EQUAL(session.size(), 9);
+    BOOST_CHECK(session[0].type == ReplayMuxedInterface::Transaction::Type::Write);
+    BOOST_CHECK_EQUAL(session[0].addr, 10);
+    BOOST_CHECK_EQUAL(session[0].data, (std::vector<std::uint8_t>{1, 2, 3}));
+    BOOST_CHECK(session[1].type == ReplayMuxedInterface::Transaction::Type::Read);
+    BOOST_CHECK_EQUAL(session[1].size, 5);
+    BOOST_CHECK_EQUAL(session[8].addr, SimMuxed::baseAddrDataLimit);
+    BOOST_CHECK_EQUAL(session[8].size, -1);
+
+    for (std::size_t i = 1; i < session.size(); ++i)
+        BOOST_CHECK(session[i].startTime >= session[i-1].startTime);
+
+    //Replay through the same code path must give identical results
+
+    Device d(makeReplayConfig(sessionPath, ", time_scale: 0.0"));
+
+    BOOST_REQUIRE(d.init());
+
+    ReplayMuxedInterface& intf = dynamic_cast<ReplayMuxedInterface&>(d.interface("intf"));
+
+    BOOST_CHECK_EQUAL(intf.getSessionLength(), 9);
+    BOOST_CHECK_EQUAL(intf.getPosition(), 0);
+    BOOST_CHECK(!intf.isFinished());
+
+    const std::vector<std::vector<std::uint8_t>> replayedResults = runWorkload(intf);
+
+    BOOST_REQUIRE_EQUAL(replayedResults.size(), recordedResults.size());
+    for (std::size_t i = 0; i < replayedResults.size(); ++i)
+        BOOST_CHECK_EQUAL(replayedResults[i], recordedResults[i]);
+
+    BOOST_CHECK(intf.isFinished());
+    BOOST_CHECK_THROW(intf.read(0, 1), std::runtime_error);
+
+    const ReplayMuxedInterface::Statistics stats = intf.getStatistics();
+
+    BOOST_CHECK_EQUAL(stats.transactions, 9);
+    BOOST_CHECK_EQUAL(stats.mismatches, 0);
+    BOOST_CHECK_EQUAL(stats.loops, 0);
+    BOOST_CHECK(stats.replayDelay == std::chrono::nanoseconds::zero());
+
+    //Re-init restarts the replay
+
+    BOOST_CHECK(d.close());
+    BOOST_REQUIRE(d.init());
+    BOOST_CHECK_EQUAL(intf.getPosition(), 0);
+    BOOST_CHECK_EQUAL(intf.getStatistics().transactions, 0);
+    BOOST_CHECK(d.close());
+
+    std::filesystem::remove(sessionPath);
+}
+
+BOOST_AUTO_TEST_CASE(Test3_matching)
+{
+    const std::filesystem::path sessionPath = std::filesystem::temp_directory_path() / "casil_test_replay_matching.session";
+
+    {
+        Device d(makeRecordConfig(sessionPath));
+
+        BOOST_REQUIRE(d.init());
+
+        MuxedInterface& intf = dynamic_cast<MuxedInterface&>(d.interface("intf"));
+
+        intf.write(0, {1, 2});
+        (void)intf.read(0, 2);
+
+        BOOST_CHECK(d.close());
+    }
+
+    {
+        Device d(makeReplayConfig(sessionPath, ", time_scale: 0.0"));
+
+        BOOST_REQUIRE(d.init());
+
+        ReplayMuxedInterface& intf = dynamic_cast<ReplayMuxedInterface&>(d.interface("intf"));
+
+        BOOST_CHECK_THROW(intf.write(0, {1, 3}), std::runtime_error);
+        BOOST_CHECK_THROW(intf.read(1, 2), std::runtime_error);
+
+        //Failing transactions are not consumed
+        BOOST_CHECK_EQUAL(intf.getStatistics().mismatches, 2);
+        BOOST_CHECK_EQUAL(intf.getPosition(), 0);
+
+        BOOST_CHECK(d.close());
+    }
+
+    {
+        Device d(makeReplayConfig(sessionPath, ", time_scale: 0.0, strict: false, loop: true"));
+
+        BOOST_REQUIRE(d.init());
+
+        ReplayMuxedInterface& intf = dynamic_cast<ReplayMuxedInterface&>(d.interface("intf"));
+
+        intf.write(4, {1, 2});
+        BOOST_CHECK_EQUAL(intf.read(0, 1), (std::vector<std::uint8_t>{1, 2}));
+        intf.write(0, {1, 2});
+        BOOST_CHECK_EQUAL(intf.read(0, 2), (std::vector<std::uint8_t>{1, 2}));
+
+        const ReplayMuxedInterface::Statistics stats = intf.getStatistics();
+
+        BOOST_CHECK_EQUAL(stats.transactions, 4);
+        BOOST_CHECK_EQUAL(stats.mismatches, 2);
+        BOOST_CHECK_EQUAL(stats.loops, 1);
+        BOOST_CHECK(!intf.isFinished());
+
+        BOOST_CHECK(d.close());
+    }
+
+    std::filesystem::remove(sessionPath);
+}
+
+BOOST_AUTO_TEST_CASE(Test4_timing)
+{
+    const std::filesystem::path sessionPath = std::filesystem::temp_directory_path() / "casil_test_replay_timing.session";
+
+    {
+        Device d(makeRecordConfig(sessionPath, ", latency: 0.005"));
+
+        BOOST_REQUIRE(d.init());
+
+        MuxedInterface& intf = dynamic_cast<MuxedInterface&>(d.interface("intf"));
+
+        for (int i = 0; i < 4; ++i)
+            (void)intf.read(0, 4);
+
+        BOOST_CHECK(d.close());
+    }
+
+    for (const ReplayMuxedInterface::Transaction& transaction : ReplayMuxedInterface::loadSession(sessionPath.string()))
+        BOOST_CHECK(transaction.duration >= std::chrono::milliseconds(5));
+
+    //Recorded durations are reproduced (scaled)
+
+    Device d(makeReplayConfig(sessionPath, ", time_scale: 2.0"));
+
+    BOOST_REQUIRE(d.init());
+
+    ReplayMuxedInterface& intf = dynamic_cast<ReplayMuxedInterface&>(d.interface("intf"));
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < 4; ++i)
+        (void)intf.read(0, 4);
+
+    BOOST_CHECK(std::chrono::steady_clock::now() - startTime >= std::chrono::milliseconds(40));
+    BOOST_CHECK(intf.getStatistics().replayDelay > std::chrono::milliseconds(35));
+
+    BOOST_CHECK(d.close());
+
+    std::filesystem::remove(sessionPath);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
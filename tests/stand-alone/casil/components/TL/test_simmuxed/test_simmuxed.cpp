@@ -0,0 +1,201 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/bytes.h>
+#include <casil/device.h>
+#include <casil/TL/Muxed/simmuxed.h>
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using casil::Device;
+using casil::TL::MuxedInterface;
+using casil::TL::SimMuxed;
+
+namespace boost { using casil::Bytes::operator<<; }
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Components_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(SimMuxed_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_config)
+{
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SimMuxed, init: {mem_size: 0}}], hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SimMuxed, init: {latency: -0.1}}], hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SimMuxed, init: {loss_rate: 1.0}}], hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SimMuxed, init: {max_retransmits: -1}}], hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SimMuxed, init: {fifo_rate: -1.0}}], hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+
+    BOOST_CHECK_NO_THROW(Device("{transfer_layer: [{name: intf, type: SimMuxed}], hw_drivers: [], registers: []}"));
+}
+
+BOOST_AUTO_TEST_CASE(Test2_memory)
+{
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed, init: {mem_size: 64}}], hw_drivers: [], registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    SimMuxed& intf = dynamic_cast<SimMuxed&>(d.interface("intf"));
+
+    BOOST_CHECK_EQUAL(intf.read(0, 4), (std::vector<std::uint8_t>{0, 0, 0, 0}));
+
+    intf.write(10, {1, 2, 3});
+    BOOST_CHECK_EQUAL(intf.read(9, 5), (std::vector<std::uint8_t>{0, 1, 2, 3, 0}));
+
+    const std::vector<MuxedInterface::WriteOp> ops = {{.addr = 60, .data = {4, 5, 6, 7}}, {.addr = 0, .data = {8}}};
+    intf.writeBatch(ops);
+    BOOST_CHECK_EQUAL(intf.read(60, 4), (std::vector<std::uint8_t>{4, 5, 6, 7}));
+    BOOST_CHECK_EQUAL(intf.query(1, 0, {9}, 2), (std::vector<std::uint8_t>{8, 9}));
+
+    const std::vector<MuxedInterface::ReadOp> readOps = {{.addr = 61, .size = 2}, {.addr = 10, .size = 3}};
+    BOOST_CHECK(intf.readBatch(readOps) == (std::vector<std::vector<std::uint8_t>>{{5, 6}, {1, 2, 3}}));
+
+    BOOST_CHECK_THROW(intf.read(62, 4), std::runtime_error);
+    BOOST_CHECK_THROW(intf.read(0, -1), std::runtime_error);
+    BOOST_CHECK_THROW(intf.write(64, {1}), std::runtime_error);
+    BOOST_CHECK_THROW(intf.write(SimMuxed::baseAddrDataLimit, {1}), std::runtime_error);
+
+    //Invalid batch must not write anything
+    BOOST_CHECK_THROW(intf.writeBatch(std::vector<MuxedInterface::WriteOp>{{.addr = 20, .data = {1}}, {.addr = 100, .data = {1}}}),
+                      std::runtime_error);
+    BOOST_CHECK_EQUAL(intf.read(20, 1), (std::vector<std::uint8_t>{0}));
+
+    const SimMuxed::Statistics stats = intf.getStatistics();
+
+    BOOST_CHECK_EQUAL(stats.transactions, 9);
+    BOOST_CHECK_EQUAL(stats.bytesWritten, 9);
+    BOOST_CHECK_EQUAL(stats.bytesRead, 21);
+    BOOST_CHECK_EQUAL(stats.packetsLost, 0);
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test3_linkModel)
+{
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed, init: {latency: 0.002, bandwidth: 100000.0}}], hw_drivers: [], registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    SimMuxed& intf = dynamic_cast<SimMuxed&>(d.interface("intf"));
+
+    //Latency applies per transaction, transfer time per byte (1000 bytes take 10ms)
+
+    auto startTime = std::chrono::steady_clock::now();
+    intf.write(0, std::vector<std::uint8_t>(1000, 1));
+    BOOST_CHECK(std::chrono::steady_clock::now() - startTime >= std::chrono::milliseconds(12));
+
+    const std::vector<MuxedInterface::WriteOp> ops(5, {.addr = 0, .data = {1}});
+
+    startTime = std::chrono::steady_clock::now();
+    intf.writeBatch(ops);
+    const auto batchDuration = std::chrono::steady_clock::now() - startTime;
+
+    BOOST_CHECK(batchDuration >= std::chrono::milliseconds(2));
+    BOOST_CHECK(intf.getStatistics().simulatedDelay >= std::chrono::milliseconds(14));
+
+    BOOST_CHECK(d.close());
+
+    //Same seed must give the same losses
+
+    auto countLosses = []() -> std::uint64_t
+    {
+        Device dLossy("{transfer_layer: [{name: intf, type: SimMuxed,"
+                                         "init: {loss_rate: 0.3, retransmit_timeout: 0.0, max_retransmits: 100, seed: 42}}],"
+                       "hw_drivers: [], registers: []}");
+
+        BOOST_REQUIRE(dLossy.init());
+
+        SimMuxed& intfLossy = dynamic_cast<SimMuxed&>(dLossy.interface("intf"));
+
+        for (int i = 0; i < 100; ++i)
+            (void)intfLossy.read(0, 1);
+
+        return intfLossy.getStatistics().packetsLost;
+    };
+
+    const std::uint64_t numLosses = countLosses();
+
+    BOOST_CHECK(numLosses > 10 && numLosses < 100);
+    BOOST_CHECK_EQUAL(countLosses(), numLosses);
+
+    Device dFailing("{transfer_layer: [{name: intf, type: SimMuxed,"
+                                       "init: {loss_rate: 0.999999, retransmit_timeout: 0.0, max_retransmits: 2}}],"
+                     "hw_drivers: [], registers: []}");
+
+    BOOST_REQUIRE(dFailing.init());
+
+    SimMuxed& intfFailing = dynamic_cast<SimMuxed&>(dFailing.interface("intf"));
+
+    BOOST_CHECK_THROW(intfFailing.read(0, 1), std::runtime_error);
+    BOOST_CHECK_EQUAL(intfFailing.getStatistics().packetsLost, 3);
+    BOOST_CHECK_EQUAL(intfFailing.getStatistics().transactions, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Test4_fifo)
+{
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed, init: {fifo_rate: 100000.0}}], hw_drivers: [], registers: []}");
+
+    SimMuxed& intf = dynamic_cast<SimMuxed&>(d.interface("intf"));
+
+    BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+    BOOST_REQUIRE(d.init());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    BOOST_CHECK(intf.getFifoSize() >= 8000);
+    BOOST_CHECK_EQUAL(intf.read(SimMuxed::baseAddrFIFOLimit, 2), (std::vector<std::uint8_t>{0, 0}));
+
+    BOOST_CHECK_EQUAL(intf.getFifoData(10), (std::vector<std::uint8_t>{0, 0, 0, 0, 1, 0, 0, 0}));
+    BOOST_CHECK_EQUAL(intf.read(SimMuxed::baseAddrDataLimit, 4), (std::vector<std::uint8_t>{2, 0, 0, 0}));
+
+    std::vector<std::uint8_t> data = intf.getFifoData();
+    BOOST_REQUIRE(data.size() >= 8);
+    BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(data.begin(), data.begin() + 8), (std::vector<std::uint8_t>{3, 0, 0, 0, 4, 0, 0, 0}));
+
+    BOOST_CHECK(d.close());
+
+    //Generation must stop on close
+
+    (void)intf.getFifoData();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+    BOOST_CHECK_EQUAL(intf.read(SimMuxed::baseAddrFIFOLimit, 4), (std::vector<std::uint8_t>{0, 0, 0, 0}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
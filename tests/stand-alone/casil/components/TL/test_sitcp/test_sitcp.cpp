@@ -0,0 +1,2076 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/asio.h>
+#include <casil/auxil.h>
+#include <casil/bytes.h>
+#include <casil/device.h>
+#include <casil/fifoshmreader.h>
+#include <casil/HL/Muxed/sitcpfifo.h>
+#include <casil/TL/Muxed/replaymuxedinterface.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/system/errc.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using casil::Device;
+using casil::FifoShmReader;
+using casil::TL::SiTCP;
+
+namespace boost { using casil::Bytes::operator<<; }
+
+namespace
+{
+
+/*
+ * Waits until the FIFO of 'pIntf' contains at least 'pSize' bytes or a timeout of 2 seconds occurs.
+ */
+bool waitForFifoSize(const SiTCP& pIntf, const std::size_t pSize)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    while (pIntf.getFifoSize() < pSize)
+    {
+        if (std::chrono::steady_clock::now() - startTime > std::chrono::seconds(2))
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    return true;
+}
+
+/*
+ * Performs the bus access of the RBCP request 'pRequest' on 'pMemory' like the SiTCP core and sends the response to 'pEndpoint'.
+ * Requests with extended RBCP header (version/type 0xFE) are answered with extended RBCP header as well.
+ */
+void respondRBCP(boost::asio::ip::udp::socket& pSocket, std::vector<std::uint8_t>& pMemory,
+                 const std::vector<std::uint8_t>& pRequest, const boost::asio::ip::udp::endpoint& pEndpoint)
+{
+    const bool extended = (pRequest[0] == 0xFEu);
+    const std::size_t headerSize = (extended ? 10 : 8);
+
+    std::vector<std::uint8_t> response(pRequest.begin(), pRequest.begin() + headerSize);
+
+    response[1] |= 0x08u;
+
+    const std::size_t len = (extended ? ((static_cast<std::size_t>(pRequest[8]) << 8) | pRequest[9]) : pRequest[3]);
+    const std::size_t addr = casil::Bytes::composeUInt32(std::span<const std::uint8_t, 4>(pRequest.begin() + 4, 4));
+
+    if (pRequest[1] == 0xC0u)
+        response.insert(response.end(), pMemory.begin() + addr, pMemory.begin() + addr + len);
+    else
+    {
+        std::copy(pRequest.begin() + headerSize, pRequest.end(), pMemory.begin() + addr);
+        response.insert(response.end(), pRequest.begin() + headerSize, pRequest.end());
+    }
+
+    pSocket.send_to(boost::asio::buffer(response), pEndpoint);
+}
+
+/*
+ * Emulates the RBCP part of the SiTCP core on 'pSocket' for 'pNumRequests' received requests, reading from/writing to 'pMemory'
+ * (see respondRBCP()). Requests with an index contained in 'pDrop' are ignored. Responses to successive pairs of requests are
+ * sent in reversed order (a request is answered directly if the next one is the last or gets ignored).
+ */
+void serveRBCP(boost::asio::ip::udp::socket& pSocket, std::vector<std::uint8_t>& pMemory,
+               const std::size_t pNumRequests, const std::set<std::size_t>& pDrop = {})
+{
+    using boost::asio::ip::udp;
+
+    auto respond = [&pSocket, &pMemory](const std::vector<std::uint8_t>& pRequest, const udp::endpoint& pEndpoint)
+    {
+        respondRBCP(pSocket, pMemory, pRequest, pEndpoint);
+    };
+
+    std::array<std::uint8_t, 65527> buffer;
+
+    std::vector<std::pair<std::vector<std::uint8_t>, udp::endpoint>> heldRequests;
+
+    for (std::size_t i = 0; i < pNumRequests; ++i)
+    {
+        udp::endpoint remoteEndpoint;
+
+        const std::size_t n = pSocket.receive_from(boost::asio::buffer(buffer), remoteEndpoint);
+
+        if (pDrop.contains(i))
+            continue;
+
+        std::vector<std::uint8_t> request(buffer.begin(), buffer.begin() + n);
+
+        if (heldRequests.empty() && i + 1 < pNumRequests && !pDrop.contains(i + 1))
+            heldRequests.emplace_back(std::move(request), remoteEndpoint);
+        else
+        {
+            respond(request, remoteEndpoint);
+
+            for (const auto& [heldRequest, heldEndpoint] : heldRequests)
+                respond(heldRequest, heldEndpoint);
+
+            heldRequests.clear();
+        }
+    }
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Components_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(SiTCP_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_config)
+{
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, fifo_capacity: 0}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    BOOST_CHECK_NO_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                   "init: {ip: 127.0.0.1, udp_port: 10356, fifo_capacity: 5}}],"
+                                 "hw_drivers: [], registers: []}"));
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, rbcp_retransmits: -1}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, rbcp_timeout: 0.0}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, rbcp_timeout: 0.1, rbcp_min_timeout: 0.2}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, rbcp_extended_size: 65498}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    BOOST_CHECK_NO_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                   "init: {ip: 127.0.0.1, udp_port: 10356, rbcp_timeout: 0.5, rbcp_retransmits: 0,"
+                                                          "rbcp_adaptive_timeout: true, rbcp_min_timeout: 0.005}}],"
+                                 "hw_drivers: [], registers: []}"));
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_read_buffer_size: 16, fifo_max_size: 16}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, fifo_max_size: 1048576, fifo_lock_free: true}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, fifo_overflow_policy: drop_newest}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, fifo_max_size: 1048576, fifo_overflow_policy: drop_oldest}}],"
+              "hw_drivers: [], registers: []}");
+
+    BOOST_CHECK_EQUAL(dynamic_cast<SiTCP&>(d.interface("intf")).getFifoMaxSize(), 1048576);
+    BOOST_CHECK_EQUAL(dynamic_cast<SiTCP&>(d.interface("intf")).getFifoFillLevel(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_fifo)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true, fifo_capacity: 8}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+        BOOST_CHECK_EQUAL(intf.getFifoData(), (std::vector<std::uint8_t>{}));
+
+        //Incomplete words must be held back until completed
+
+        std::vector<std::uint8_t> writeBuffer = {0x01u, 0x02, 0x03, 0x04, 0x05, 0x06};
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 6));
+
+        BOOST_CHECK_EQUAL(intf.getFifoData(3), (std::vector<std::uint8_t>{}));
+        BOOST_CHECK_EQUAL(intf.getFifoData(7), (std::vector<std::uint8_t>{0x01u, 0x02, 0x03, 0x04}));
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 2);
+        BOOST_CHECK_EQUAL(intf.getFifoData(), (std::vector<std::uint8_t>{}));
+
+        writeBuffer = {0x07u, 0x08};
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 4));
+
+        BOOST_CHECK_EQUAL(intf.getFifoData(), (std::vector<std::uint8_t>{0x05u, 0x06, 0x07, 0x08}));
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+        //Exceeding the configured capacity must grow the buffer without losing data
+
+        writeBuffer.resize(1000);
+        for (std::size_t i = 0; i < writeBuffer.size(); ++i)
+            writeBuffer[i] = static_cast<std::uint8_t>(i);
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 1000));
+
+        BOOST_CHECK_EQUAL(intf.getFifoHighWaterMark(), 1000);
+        BOOST_CHECK_EQUAL(intf.getFifoData(-1), writeBuffer);
+
+        //In place access via consumeFifo()
+
+        writeBuffer = {0x01u, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D};
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 13));
+
+        std::vector<std::uint32_t> words;
+
+        auto consumer = [&words](const std::span<const std::uint32_t> pFirst, const std::span<const std::uint32_t> pSecond)
+        {
+            words.insert(words.end(), pFirst.begin(), pFirst.end());
+            words.insert(words.end(), pSecond.begin(), pSecond.end());
+        };
+
+        BOOST_CHECK_EQUAL(intf.consumeFifo(consumer, 0), 0);
+        BOOST_CHECK_EQUAL(intf.consumeFifo(consumer, 7), 4);
+        BOOST_CHECK_EQUAL(intf.consumeFifo(consumer), 8);
+        BOOST_CHECK_EQUAL(intf.consumeFifo(consumer), 0);
+        BOOST_CHECK_EQUAL(words, (std::vector<std::uint32_t>{0x04030201u, 0x08070605u, 0x0C0B0A09u}));
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 1);
+
+        //Non-allocating access via readInto()
+
+        writeBuffer = {0x0Eu, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14};
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 8));
+
+        std::array<std::uint8_t, 6> readBuffer {};
+
+        BOOST_CHECK_EQUAL(intf.readInto(0x100000000, readBuffer), 4);
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + 4), (std::vector<std::uint8_t>{0x0Du, 0x0E, 0x0F, 0x10}));
+        BOOST_CHECK_EQUAL(intf.readInto(0x100000000, std::span<std::uint8_t>(readBuffer).first(3)), 0);
+        BOOST_CHECK_EQUAL(intf.readInto(0x100000000, readBuffer), 4);
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + 4), (std::vector<std::uint8_t>{0x11u, 0x12, 0x13, 0x14}));
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+        intf.resetFifo();
+
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+        BOOST_CHECK_EQUAL(intf.getFifoHighWaterMark(), 1000);
+
+        BOOST_CHECK_EQUAL(intf.getStatistics().fifoHighWaterMark, 1000);
+        BOOST_CHECK(intf.getStatistics().fifoBytesReceived >= 1013);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test3_fifoLockFree)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                       "fifo_capacity: 16, fifo_lock_free: true}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        std::vector<std::uint8_t> writeBuffer(102);
+        for (std::size_t i = 0; i < writeBuffer.size(); ++i)
+            writeBuffer[i] = static_cast<std::uint8_t>(i);
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        //Fixed capacity must not be exceeded (at most 3 bytes of an incomplete word on top) and no data must be lost
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 16));
+
+        BOOST_CHECK(intf.getFifoSize() <= 19);
+
+        std::vector<std::uint8_t> readData;
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        while (readData.size() < 100 && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(5))
+        {
+            const std::vector<std::uint8_t> data = intf.getFifoData();
+            readData.insert(readData.end(), data.begin(), data.end());
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        BOOST_CHECK_EQUAL(readData, (std::vector<std::uint8_t>(writeBuffer.begin(), writeBuffer.begin() + 100)));
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 2);
+        BOOST_CHECK(intf.getFifoHighWaterMark() <= 19);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test4_rbcpPipelined)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 10356, rbcp_window: 4}}],"
+              "hw_drivers: [], registers: []}");
+
+    using boost::asio::ip::udp;
+    udp::endpoint endpoint(udp::v4(), 10356);
+    udp::socket socket(casil::ASIO::getIOContext(), endpoint);
+
+    std::vector<std::uint8_t> memory(2048);
+    for (std::size_t i = 0; i < memory.size(); ++i)
+        memory[i] = static_cast<std::uint8_t>(i * 7);
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(d.init());
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        //Four chunks; last request gets lost and needs to be retransmitted
+
+        std::thread responder(serveRBCP, std::ref(socket), std::ref(memory), 5, std::set<std::size_t>{3});
+
+        std::vector<std::uint8_t> readData;
+
+        BOOST_CHECK_NO_THROW(readData = intf.read(0x100, 1000));
+
+        responder.join();
+
+        BOOST_CHECK(readData == std::vector<std::uint8_t>(memory.begin() + 0x100, memory.begin() + 0x100 + 1000));
+
+        //Three chunks
+
+        std::vector<std::uint8_t> writeData(600);
+        for (std::size_t i = 0; i < writeData.size(); ++i)
+            writeData[i] = static_cast<std::uint8_t>(255 - i);
+
+        responder = std::thread(serveRBCP, std::ref(socket), std::ref(memory), 3, std::set<std::size_t>{});
+
+        BOOST_CHECK_NO_THROW(intf.write(0x200, writeData));
+
+        responder.join();
+
+        BOOST_CHECK(std::vector<std::uint8_t>(memory.begin() + 0x200, memory.begin() + 0x200 + 600) == writeData);
+
+        //Single request
+
+        responder = std::thread(serveRBCP, std::ref(socket), std::ref(memory), 1, std::set<std::size_t>{});
+
+        BOOST_CHECK_NO_THROW(intf.write(0x10, {0x01u, 0x02, 0x03}));
+
+        responder.join();
+
+        BOOST_CHECK_EQUAL((std::vector<std::uint8_t>(memory.begin() + 0x10, memory.begin() + 0x13)), (std::vector<std::uint8_t>{0x01u, 0x02, 0x03}));
+
+        //Statistics must count every chunk as transaction and the retransmission as retry
+
+        const SiTCP::Statistics statistics = intf.getStatistics();
+
+        BOOST_CHECK_EQUAL(statistics.rbcpTransactions, 8);
+        BOOST_CHECK_EQUAL(statistics.rbcpRetries, 1);
+        BOOST_CHECK_EQUAL(std::accumulate(statistics.rbcpLatencyHistogram.begin(), statistics.rbcpLatencyHistogram.end(), std::uint64_t{0}), 8);
+        BOOST_CHECK_EQUAL(statistics.fifoBytesReceived, 0);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test5_writeBatch)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true, tcp_to_bus: true}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        //Skip "tcp_to_bus" reset sequence
+
+        std::vector<std::uint8_t> readBuffer(65535 + 6);
+
+        boost::asio::read(socket, boost::asio::buffer(readBuffer, readBuffer.size()));
+
+        //Adjoining operations must be merged into a single message
+
+        const std::vector<SiTCP::WriteOp> ops = {{0x10, {0x01u, 0x02}}, {0x12, {0x03u}}, {0x20, {0x04u}}};
+
+        BOOST_CHECK_NO_THROW(intf.writeBatch(ops));
+
+        readBuffer.resize(16);
+
+        boost::asio::read(socket, boost::asio::buffer(readBuffer, readBuffer.size()));
+
+        BOOST_CHECK_EQUAL(readBuffer, (std::vector<std::uint8_t>{0x03u, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
+                                                                 0x01u, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04}));
+
+        //Oversized writes must be split into consecutive messages of maximum length
+
+        std::vector<std::uint8_t> largeData(0xFFF9u + 3);
+        for (std::size_t i = 0; i < largeData.size(); ++i)
+            largeData[i] = static_cast<std::uint8_t>(i * 7);
+
+        auto readMessage = [&socket](const std::uint16_t pExpectedSize, const std::uint32_t pExpectedAddr) -> std::vector<std::uint8_t>
+        {
+            std::vector<std::uint8_t> header(6);
+            boost::asio::read(socket, boost::asio::buffer(header, header.size()));
+
+            BOOST_CHECK_EQUAL(header, casil::Bytes::composeByteVec(false, pExpectedSize, pExpectedAddr));
+
+            std::vector<std::uint8_t> data(pExpectedSize);
+            boost::asio::read(socket, boost::asio::buffer(data, data.size()));
+
+            return data;
+        };
+
+        BOOST_CHECK_NO_THROW(intf.write(0x100, largeData));
+
+        BOOST_CHECK(readMessage(0xFFF9u, 0x100) == std::vector<std::uint8_t>(largeData.begin(), largeData.begin() + 0xFFF9u));
+        BOOST_CHECK(readMessage(3, 0x100 + 0xFFF9u) == std::vector<std::uint8_t>(largeData.begin() + 0xFFF9u, largeData.end()));
+
+        const std::vector<SiTCP::WriteOp> largeOps = {{0x10, {0x01u}}, {0x11, largeData}};
+
+        BOOST_CHECK_NO_THROW(intf.writeBatch(largeOps));
+
+        std::vector<std::uint8_t> expectedData = {0x01u};
+        expectedData.insert(expectedData.end(), largeData.begin(), largeData.begin() + 0xFFF8u);
+
+        BOOST_CHECK(readMessage(0xFFF9u, 0x10) == expectedData);
+        BOOST_CHECK(readMessage(4, 0x10 + 0xFFF9u) == std::vector<std::uint8_t>(largeData.begin() + 0xFFF8u, largeData.end()));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        BOOST_CHECK_EQUAL(socket.available(), 0);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test6_rbcpAdaptiveTimeout)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, rbcp_timeout: 2.0, rbcp_adaptive_timeout: true}}],"
+              "hw_drivers: [], registers: []}");
+
+    using boost::asio::ip::udp;
+    udp::endpoint endpoint(udp::v4(), 10356);
+    udp::socket socket(casil::ASIO::getIOContext(), endpoint);
+
+    std::vector<std::uint8_t> memory(256, 0x5Au);
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(d.init());
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        //Measure round-trip times
+
+        for (int i = 0; i < 10; ++i)
+        {
+            std::thread responder(serveRBCP, std::ref(socket), std::ref(memory), 1, std::set<std::size_t>{});
+
+            BOOST_CHECK_NO_THROW(intf.read(0x10, 4));
+
+            responder.join();
+        }
+
+        //Lost request must be retransmitted well before the configured (maximum) timeout
+
+        std::thread responder(serveRBCP, std::ref(socket), std::ref(memory), 2, std::set<std::size_t>{0});
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        std::vector<std::uint8_t> readData;
+
+        BOOST_CHECK_NO_THROW(readData = intf.read(0x10, 4));
+
+        const auto duration = std::chrono::steady_clock::now() - startTime;
+
+        responder.join();
+
+        BOOST_CHECK_EQUAL(readData, (std::vector<std::uint8_t>(4, 0x5Au)));
+        BOOST_CHECK(duration < std::chrono::milliseconds(500));
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test7_fifoDumpFile)
+{
+    const std::filesystem::path dumpPath = std::filesystem::temp_directory_path() / "casil_test_sitcp_fifo_dump";
+
+    for (int i = 0; i < 10; ++i)
+        std::filesystem::remove(dumpPath.string() + ".000" + std::to_string(i));
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: false,"
+                                                       "fifo_dump_file: " + dumpPath.string() + "}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                       "fifo_dump_file: " + dumpPath.string() + ", fifo_dump_block_size: 8, fifo_dump_max_file_size: 40}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    std::vector<std::uint8_t> writeBuffer(13);
+    for (std::size_t i = 0; i < writeBuffer.size(); ++i)
+        writeBuffer[i] = static_cast<std::uint8_t>(i + 1);
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        while (intf.getStatistics().fifoBytesReceived < 13 && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(2))
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        BOOST_CHECK_EQUAL(intf.getStatistics().fifoBytesReceived, 13);
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+        BOOST_CHECK(d.close());
+    }
+
+    //Complete words must be split into chunks of at most 8 bytes and distributed over files of at most 40 bytes
+
+    std::vector<std::uint8_t> payloads;
+    int numFiles = 0;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        const std::string filePath = dumpPath.string() + ".000" + std::to_string(i);
+
+        if (!std::filesystem::exists(filePath))
+            break;
+
+        ++numFiles;
+
+        std::ifstream file(filePath, std::ios::binary);
+        const std::vector<std::uint8_t> content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+        BOOST_CHECK(content.size() <= 40);
+
+        std::size_t pos = 0;
+        while (pos + 16 <= content.size())
+        {
+            const std::span<const std::uint8_t> header(content.begin() + pos, 16);
+
+            BOOST_CHECK_EQUAL(casil::Bytes::composeUInt32(header.first<4>(), false), 0x43444643u);
+
+            const std::uint32_t len = casil::Bytes::composeUInt32(header.subspan<4, 4>(), false);
+
+            BOOST_CHECK(len > 0 && len <= 8 && len % 4 == 0);
+            BOOST_REQUIRE(pos + 16 + len <= content.size());
+
+            payloads.insert(payloads.end(), content.begin() + pos + 16, content.begin() + pos + 16 + len);
+
+            pos += 16 + len;
+        }
+
+        BOOST_CHECK_EQUAL(pos, content.size());
+
+        std::filesystem::remove(filePath);
+    }
+
+    BOOST_CHECK(numFiles >= 2);
+    BOOST_CHECK_EQUAL(payloads, (std::vector<std::uint8_t>(writeBuffer.begin(), writeBuffer.begin() + 12)));
+}
+
+BOOST_AUTO_TEST_CASE(Test8_fifoChunks)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true, fifo_capacity: 8}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        std::vector<std::chrono::steady_clock::time_point> timestamps;
+        std::vector<std::uint64_t> sequenceNumbers;
+        std::vector<std::vector<std::uint32_t>> chunks;
+
+        auto consumer = [&timestamps, &sequenceNumbers, &chunks](const std::chrono::steady_clock::time_point pTimestamp,
+                                                                 const std::uint64_t pSequenceNumber,
+                                                                 const std::span<const std::uint32_t> pWords)
+        {
+            timestamps.push_back(pTimestamp);
+            sequenceNumbers.push_back(pSequenceNumber);
+            chunks.emplace_back(pWords.begin(), pWords.end());
+        };
+
+        BOOST_CHECK_EQUAL(intf.consumeFifoChunks(consumer), 0);
+        BOOST_CHECK(chunks.empty());
+
+        //Each receive forms its own chunk; incomplete words are attributed to the chunk completing them
+
+        const auto timeBefore = std::chrono::steady_clock::now();
+
+        std::vector<std::uint8_t> writeBuffer = {0x01u, 0x02, 0x03, 0x04, 0x05, 0x06};
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+        BOOST_REQUIRE(waitForFifoSize(intf, 6));
+
+        writeBuffer = {0x07u, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10};
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+        BOOST_REQUIRE(waitForFifoSize(intf, 16));
+
+        //Growing the buffer must not break the chunk boundaries
+
+        writeBuffer.resize(40);
+        for (std::size_t i = 0; i < writeBuffer.size(); ++i)
+            writeBuffer[i] = static_cast<std::uint8_t>(0x11u + i);
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+        BOOST_REQUIRE(waitForFifoSize(intf, 56));
+
+        const auto timeAfter = std::chrono::steady_clock::now();
+
+        BOOST_CHECK_EQUAL(intf.consumeFifoChunks(consumer, 0), 0);
+        BOOST_CHECK(chunks.empty());
+
+        //Partial consumption must split a chunk but keep its metadata for the remainder
+
+        BOOST_CHECK_EQUAL(intf.consumeFifoChunks(consumer, 11), 8);
+        BOOST_CHECK_EQUAL(intf.consumeFifoChunks(consumer), 48);
+        BOOST_CHECK_EQUAL(intf.consumeFifoChunks(consumer), 0);
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+        BOOST_REQUIRE_EQUAL(chunks.size(), 4);
+        BOOST_CHECK_EQUAL(chunks[0], (std::vector<std::uint32_t>{0x04030201u}));
+        BOOST_CHECK_EQUAL(chunks[1], (std::vector<std::uint32_t>{0x08070605u}));
+        BOOST_CHECK_EQUAL(chunks[2], (std::vector<std::uint32_t>{0x0C0B0A09u, 0x100F0E0Du}));
+        BOOST_REQUIRE_EQUAL(chunks[3].size(), 10);
+        BOOST_CHECK_EQUAL(chunks[3].front(), 0x14131211u);
+        BOOST_CHECK_EQUAL(chunks[3].back(), 0x38373635u);
+
+        BOOST_CHECK_EQUAL(sequenceNumbers[0] + 1, sequenceNumbers[1]);
+        BOOST_CHECK_EQUAL(sequenceNumbers[1], sequenceNumbers[2]);
+        BOOST_CHECK_EQUAL(sequenceNumbers[2] + 1, sequenceNumbers[3]);
+
+        BOOST_CHECK(timestamps.front() >= timeBefore);
+        BOOST_CHECK(timestamps.back() <= timeAfter);
+        BOOST_CHECK(std::is_sorted(timestamps.begin(), timestamps.end()));
+
+        //Resetting the FIFO must drop pending chunks
+
+        writeBuffer = {0x01u, 0x02, 0x03, 0x04};
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+        BOOST_REQUIRE(waitForFifoSize(intf, 4));
+
+        intf.resetFifo();
+
+        chunks.clear();
+        BOOST_CHECK_EQUAL(intf.consumeFifoChunks(consumer), 0);
+        BOOST_CHECK(chunks.empty());
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test9_fifoSizeLimit)
+{
+    auto runWithPolicy = [](const std::string& pPolicy, const std::function<void(SiTCP&, const std::vector<std::uint8_t>&)>& pCheck)
+    {
+        Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                    "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                           "tcp_read_buffer_size: 16, fifo_max_size: 24, fifo_overflow_policy: " + pPolicy + "}}],"
+                  "hw_drivers: [], registers: []}");
+
+        std::atomic_bool handlerCompleted(false);
+        std::atomic_bool handlerError(false);
+
+        auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+        {
+            if (pErrorCode.value() != boost::system::errc::success)
+                handlerError.store(true);
+
+            handlerCompleted.store(true);
+            handlerCompleted.notify_one();
+        };
+
+        using boost::asio::ip::tcp;
+        tcp::endpoint endpoint(tcp::v4(), 10357);
+        tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+        tcp::socket socket(casil::ASIO::getIOContext());
+
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        BOOST_CHECK_EQUAL(intf.getFifoMaxSize(), 24);
+
+        std::vector<std::uint8_t> writeBuffer(40);
+        std::iota(writeBuffer.begin(), writeBuffer.end(), 1);
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 24));
+
+        pCheck(intf, writeBuffer);
+
+        BOOST_CHECK(d.close());
+    };
+
+    //Blocking must keep the FIFO at the limit and deliver the remaining data later without loss
+
+    runWithPolicy("block", [](SiTCP& pIntf, const std::vector<std::uint8_t>& pWritten)
+                           {
+                               std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+                               BOOST_CHECK_EQUAL(pIntf.getFifoSize(), 24);
+                               BOOST_CHECK_EQUAL(pIntf.getFifoFillLevel(), 1.0);
+                               BOOST_CHECK(pIntf.getStatistics().fifoOverflows >= 1);
+
+                               std::vector<std::uint8_t> data = pIntf.getFifoData();
+
+                               BOOST_REQUIRE(waitForFifoSize(pIntf, 16));
+
+                               const std::vector<std::uint8_t> rest = pIntf.getFifoData();
+                               data.insert(data.end(), rest.begin(), rest.end());
+
+                               BOOST_CHECK_EQUAL(data, pWritten);
+                               BOOST_CHECK_EQUAL(pIntf.getStatistics().fifoBytesDropped, 0);
+                           });
+
+    //Dropping must keep the newest data below the limit
+
+    runWithPolicy("drop_oldest", [](SiTCP& pIntf, const std::vector<std::uint8_t>& pWritten)
+                                 {
+                                     const auto startTime = std::chrono::steady_clock::now();
+
+                                     while (pIntf.getStatistics().fifoBytesReceived < pWritten.size() &&
+                                            std::chrono::steady_clock::now() - startTime < std::chrono::seconds(2))
+                                     {
+                                         std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                                     }
+
+                                     BOOST_CHECK_EQUAL(pIntf.getFifoSize(), 24);
+                                     BOOST_CHECK_EQUAL(pIntf.getStatistics().fifoBytesDropped, 16);
+                                     BOOST_CHECK(pIntf.getStatistics().fifoOverflows >= 1);
+                                     BOOST_CHECK_EQUAL(pIntf.getFifoData(), (std::vector<std::uint8_t>(pWritten.begin() + 16, pWritten.end())));
+                                 });
+}
+
+BOOST_AUTO_TEST_CASE(Test10_fifoMmapFile)
+{
+    const std::filesystem::path mmapPath = std::filesystem::temp_directory_path() / "casil_test_sitcp_fifo_mmap";
+
+    std::filesystem::remove(mmapPath);
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                                       "fifo_mmap_file: " + mmapPath.string() + ", fifo_dump_file: " + mmapPath.string() + "_dump}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK(!std::filesystem::exists(mmapPath));
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356,"
+                                                       "fifo_mmap_file: " + (mmapPath / "missing_dir" / "file").string() + "}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    {
+        Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                    "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                           "fifo_capacity: 32, tcp_read_buffer_size: 16, fifo_mmap_file: " + mmapPath.string() + "}}],"
+                  "hw_drivers: [], registers: []}");
+
+        BOOST_REQUIRE(std::filesystem::exists(mmapPath));
+        BOOST_CHECK_EQUAL(std::filesystem::file_size(mmapPath), 32);
+
+        std::atomic_bool handlerCompleted(false);
+        std::atomic_bool handlerError(false);
+
+        auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+        {
+            if (pErrorCode.value() != boost::system::errc::success)
+                handlerError.store(true);
+
+            handlerCompleted.store(true);
+            handlerCompleted.notify_one();
+        };
+
+        using boost::asio::ip::tcp;
+        tcp::endpoint endpoint(tcp::v4(), 10357);
+        tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+        tcp::socket socket(casil::ASIO::getIOContext());
+
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        BOOST_CHECK_EQUAL(intf.getFifoMaxSize(), 32);
+
+        //Fixed capacity must hold back data that does not fit and pass it later
+
+        std::vector<std::uint8_t> writeBuffer(48);
+        std::iota(writeBuffer.begin(), writeBuffer.end(), 1);
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 32));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        BOOST_CHECK(intf.getFifoSize() < 36);   //Up to three bytes of an incomplete word can be held back in addition
+        BOOST_CHECK(intf.getFifoFillLevel() >= 1.0);
+
+        std::vector<std::uint32_t> words;
+
+        auto consumer = [&words](const std::span<const std::uint32_t> pFirst, const std::span<const std::uint32_t> pSecond)
+        {
+            words.insert(words.end(), pFirst.begin(), pFirst.end());
+            words.insert(words.end(), pSecond.begin(), pSecond.end());
+        };
+
+        BOOST_CHECK_EQUAL(intf.consumeFifo(consumer), 32);
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 16));
+
+        BOOST_CHECK_EQUAL(intf.consumeFifo(consumer), 16);
+
+        std::vector<std::uint32_t> expectedWords(12);
+        casil::Bytes::decodeUInt32LE(writeBuffer, expectedWords);
+
+        BOOST_CHECK_EQUAL(words, expectedWords);
+
+        BOOST_CHECK(d.close());
+    }
+
+    BOOST_CHECK(!std::filesystem::exists(mmapPath));
+}
+
+BOOST_AUTO_TEST_CASE(Test11_fifoShmRing)
+{
+    const std::string shmName = "casil_test_sitcp_fifo_shm";
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: false,"
+                                                       "fifo_shm_name: " + shmName + "}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                                       "fifo_shm_name: " + shmName + ", fifo_dump_file: /tmp/" + shmName + "}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                                       "fifo_shm_name: " + shmName + ", fifo_shm_slots: 1}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                       "fifo_shm_name: " + shmName + ", fifo_shm_slot_size: 8, fifo_shm_slots: 4}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    casil::Auxil::AsyncIORunner<2> ioRunner;
+    (void)ioRunner;
+
+    acceptor.async_accept(socket, handleAccept);
+
+    BOOST_REQUIRE(d.init());
+
+    handlerCompleted.wait(false);
+
+    BOOST_CHECK(handlerError.load() == false);
+
+    SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+    std::optional<FifoShmReader> reader;
+    BOOST_REQUIRE_NO_THROW(reader.emplace(shmName));
+
+    BOOST_CHECK_EQUAL(reader->getSlotSize(), 8);
+    BOOST_CHECK_EQUAL(reader->getNumSlots(), 4);
+    BOOST_CHECK(!reader->next().has_value());
+    BOOST_CHECK(!reader->atEnd());
+
+    auto waitForBytesReceived = [&intf](const std::uint64_t pNumBytes) -> bool
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        while (intf.getStatistics().fifoBytesReceived < pNumBytes && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(2))
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        return (intf.getStatistics().fifoBytesReceived == pNumBytes);
+    };
+
+    //Complete words must be published in blocks of at most 8 bytes, holding back the incomplete word
+
+    std::vector<std::uint8_t> writeBuffer(13);
+    std::iota(writeBuffer.begin(), writeBuffer.end(), 1);
+
+    boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+    BOOST_REQUIRE(waitForBytesReceived(13));
+    BOOST_CHECK_EQUAL(intf.getFifoSize(), 0);
+
+    std::vector<std::uint32_t> words;
+    std::uint64_t expectedSequence = 0;
+
+    while (const std::optional<FifoShmReader::Block> block = reader->next())
+    {
+        BOOST_CHECK_EQUAL(block->sequence, expectedSequence++);
+        BOOST_CHECK(!block->words.empty() && block->words.size() <= 2);
+
+        words.insert(words.end(), block->words.begin(), block->words.end());
+
+        BOOST_CHECK(reader->isValid(block->sequence));
+    }
+
+    std::vector<std::uint32_t> expectedWords(3);
+    casil::Bytes::decodeUInt32LE(std::span<const std::uint8_t>(writeBuffer.begin(), 12), expectedWords);
+
+    BOOST_CHECK_EQUAL(words, expectedWords);
+    BOOST_CHECK_EQUAL(reader->getLostBlocks(), 0);
+
+    //Reader falling behind by more than the number of slots must lose the overwritten blocks only
+
+    std::vector<std::uint8_t> writeBuffer2(67);
+    std::iota(writeBuffer2.begin(), writeBuffer2.end(), 14);
+
+    boost::asio::write(socket, boost::asio::buffer(writeBuffer2, writeBuffer2.size()));
+
+    BOOST_REQUIRE(waitForBytesReceived(80));
+
+    words.clear();
+
+    while (const std::optional<FifoShmReader::Block> block = reader->next())
+        words.insert(words.end(), block->words.begin(), block->words.end());
+
+    BOOST_CHECK(reader->getLostBlocks() > 0);
+
+    std::vector<std::uint8_t> allBytes = writeBuffer;
+    allBytes.insert(allBytes.end(), writeBuffer2.begin(), writeBuffer2.end());
+
+    expectedWords.resize(20);
+    casil::Bytes::decodeUInt32LE(allBytes, expectedWords);
+
+    BOOST_REQUIRE(!words.empty() && words.size() <= 8);
+    BOOST_CHECK(std::equal(words.begin(), words.end(), expectedWords.end() - static_cast<std::ptrdiff_t>(words.size())));
+
+    //Closing must end the stream of open readers and remove the ring
+
+    BOOST_CHECK(d.close());
+
+    BOOST_CHECK(reader->atEnd());
+    BOOST_CHECK(!reader->next(std::chrono::milliseconds(10)).has_value());
+
+    BOOST_CHECK_THROW(FifoShmReader{shmName}, std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Test12_recordSession)
+{
+    using casil::TL::ReplayMuxedInterface;
+
+    const std::filesystem::path sessionPath = std::filesystem::temp_directory_path() / "casil_test_sitcp_record.session";
+
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                       "record_session: \"" + sessionPath.generic_string() + "\"}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    std::vector<std::uint8_t> writeBuffer(12);
+    std::iota(writeBuffer.begin(), writeBuffer.end(), 1);
+
+    std::vector<std::uint8_t> fifoData;
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        while (intf.getFifoSize() < 12 && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(2))
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        BOOST_CHECK_EQUAL(intf.read(SiTCP::baseAddrFIFOLimit + 1, 4), (std::vector<std::uint8_t>{12, 0, 0, 0}));
+
+        fifoData = intf.read(SiTCP::baseAddrDataLimit, 8);
+
+        std::array<std::uint8_t, 8> buffer {};
+        BOOST_CHECK_EQUAL(intf.readInto(SiTCP::baseAddrDataLimit, buffer), 4);
+
+        intf.write(SiTCP::baseAddrDataLimit, {0xAB, 0xCD});
+
+        BOOST_CHECK(d.close());
+    }
+
+    //All FIFO accesses must be recorded in order, with responses and written data
+
+    const std::vector<ReplayMuxedInterface::Transaction> session = ReplayMuxedInterface::loadSession(sessionPath.string());
+
+    BOOST_REQUIRE_EQUAL(session.size(), 4);
+
+    BOOST_CHECK(session[0].type == ReplayMuxedInterface::Transaction::Type::Read);
+    BOOST_CHECK_EQUAL(session[0].addr, SiTCP::baseAddrFIFOLimit + 1);
+    BOOST_CHECK_EQUAL(session[0].data, (std::vector<std::uint8_t>{12, 0, 0, 0}));
+
+    BOOST_CHECK_EQUAL(session[1].size, 8);
+    BOOST_CHECK_EQUAL(session[1].data, (std::vector<std::uint8_t>(writeBuffer.begin(), writeBuffer.begin() + 8)));
+    BOOST_CHECK_EQUAL(fifoData, session[1].data);
+
+    BOOST_CHECK_EQUAL(session[2].size, 8);
+    BOOST_CHECK_EQUAL(session[2].data, (std::vector<std::uint8_t>(writeBuffer.begin() + 8, writeBuffer.end())));
+
+    BOOST_CHECK(session[3].type == ReplayMuxedInterface::Transaction::Type::Write);
+    BOOST_CHECK_EQUAL(session[3].data, (std::vector<std::uint8_t>{0xAB, 0xCD}));
+
+    std::filesystem::remove(sessionPath);
+}
+
+BOOST_AUTO_TEST_CASE(Test13_rbcpChunked)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 10356}}], hw_drivers: [], registers: []}");
+
+    using boost::asio::ip::udp;
+    udp::endpoint endpoint(udp::v4(), 10356);
+    udp::socket socket(casil::ASIO::getIOContext(), endpoint);
+
+    std::vector<std::uint8_t> memory(2048);
+    for (std::size_t i = 0; i < memory.size(); ++i)
+        memory[i] = static_cast<std::uint8_t>(i * 3);
+
+    //Answer each of 'pNumRequests' requests directly (no pipelining without window)
+    auto serveSequentially = [&socket, &memory](const std::size_t pNumRequests) -> std::thread
+    {
+        return std::thread([&socket, &memory, pNumRequests]()
+        {
+            for (std::size_t i = 0; i < pNumRequests; ++i)
+                serveRBCP(socket, memory, 1);
+        });
+    };
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(d.init());
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        //Three chunks each
+
+        std::thread responder = serveSequentially(3);
+
+        std::vector<std::uint8_t> readData;
+
+        BOOST_CHECK_NO_THROW(readData = intf.read(0x100, 600));
+
+        responder.join();
+
+        BOOST_CHECK(readData == std::vector<std::uint8_t>(memory.begin() + 0x100, memory.begin() + 0x100 + 600));
+
+        std::vector<std::uint8_t> writeData(600);
+        for (std::size_t i = 0; i < writeData.size(); ++i)
+            writeData[i] = static_cast<std::uint8_t>(255 - i);
+
+        responder = serveSequentially(3);
+
+        BOOST_CHECK_NO_THROW(intf.write(0x400, writeData));
+
+        responder.join();
+
+        BOOST_CHECK(std::vector<std::uint8_t>(memory.begin() + 0x400, memory.begin() + 0x400 + 600) == writeData);
+
+        BOOST_CHECK_EQUAL(intf.getStatistics().rbcpTransactions, 6);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test14_resetFifoWhileStreaming)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true, tcp_read_buffer_size: 256}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        //Resetting must not interrupt the continuous reading of a running stream
+
+        std::atomic_bool streaming(true);
+
+        std::thread streamer([&socket, &streaming]()
+        {
+            const std::vector<std::uint8_t> chunk(1024, 0xAAu);
+
+            while (streaming.load())
+            {
+                boost::asio::write(socket, boost::asio::buffer(chunk));
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+
+        for (int i = 0; i < 20; ++i)
+        {
+            BOOST_REQUIRE(waitForFifoSize(intf, 1024));
+            BOOST_CHECK_NO_THROW(intf.resetFifo());
+        }
+
+        BOOST_CHECK(waitForFifoSize(intf, 1024));
+
+        streaming.store(false);
+        streamer.join();
+
+        //Only data sent after the reset must show up
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        intf.resetFifo();
+
+        const std::vector<std::uint8_t> writeBuffer = {0x01u, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer));
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 8));
+
+        BOOST_CHECK_EQUAL(intf.getFifoData(), writeBuffer);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test15_rbcpExtended)
+{
+    using boost::asio::ip::udp;
+    udp::endpoint endpoint(udp::v4(), 10356);
+    udp::socket socket(casil::ASIO::getIOContext(), endpoint);
+
+    std::vector<std::uint8_t> memory(32768);
+    for (std::size_t i = 0; i < memory.size(); ++i)
+        memory[i] = static_cast<std::uint8_t>(i * 5);
+
+    std::vector<std::uint8_t> writeData(5000);
+    for (std::size_t i = 0; i < writeData.size(); ++i)
+        writeData[i] = static_cast<std::uint8_t>(i ^ 0x5Au);
+
+    //Answer each of 'pNumRequests' requests directly (no pipelining without window)
+    auto serveSequentially = [&socket, &memory](const std::size_t pNumRequests) -> std::thread
+    {
+        return std::thread([&socket, &memory, pNumRequests]()
+        {
+            for (std::size_t i = 0; i < pNumRequests; ++i)
+                serveRBCP(socket, memory, 1);
+        });
+    };
+
+    for (const int window : {1, 4})
+    {
+        Device d("{transfer_layer: [{name: intf, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 10356, rbcp_extended_size: 4096,"
+                                                                   "rbcp_window: " + std::to_string(window) + "}}],"
+                  "hw_drivers: [], registers: []}");
+
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(d.init());
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        //Three and two chunks instead of 40 and 20 for standard RBCP
+
+        std::thread responder = (window == 1 ? serveSequentially(3) : std::thread(serveRBCP, std::ref(socket), std::ref(memory), 3,
+                                                                                  std::set<std::size_t>{}));
+
+        std::vector<std::uint8_t> readData;
+
+        BOOST_CHECK_NO_THROW(readData = intf.read(0x100, 10000));
+
+        responder.join();
+
+        BOOST_CHECK(readData == std::vector<std::uint8_t>(memory.begin() + 0x100, memory.begin() + 0x100 + 10000));
+
+        responder = serveSequentially(2);   //Only one full chunk, hence never pipelined
+
+        BOOST_CHECK_NO_THROW(intf.write(0x4000, writeData));
+
+        responder.join();
+
+        BOOST_CHECK(std::vector<std::uint8_t>(memory.begin() + 0x4000, memory.begin() + 0x4000 + 5000) == writeData);
+
+        BOOST_CHECK_EQUAL(intf.getStatistics().rbcpTransactions, 5);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test16_readBatch)
+{
+    using boost::asio::ip::udp;
+    udp::endpoint endpoint(udp::v4(), 10356);
+    udp::socket socket(casil::ASIO::getIOContext(), endpoint);
+
+    std::vector<std::uint8_t> memory(8192);
+    for (std::size_t i = 0; i < memory.size(); ++i)
+        memory[i] = static_cast<std::uint8_t>(i * 7);
+
+    //Four chunks in total (second operation needs two standard RBCP chunks, last operation none)
+    const std::vector<SiTCP::ReadOp> ops = {{.addr = 0x10, .size = 4}, {.addr = 0x200, .size = 300},
+                                            {.addr = 0x50, .size = 1}, {.addr = 0x1000, .size = 0}};
+
+    for (const int window : {1, 4})
+    {
+        Device d("{transfer_layer: [{name: intf, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 10356, "
+                                                                   "rbcp_window: " + std::to_string(window) + "}}],"
+                  "hw_drivers: [], registers: []}");
+
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(d.init());
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        //Without window the operations are read one after another, otherwise all requests are kept in flight together
+        std::thread responder = (window == 1 ? std::thread([&socket, &memory]()
+                                                           {
+                                                               for (int i = 0; i < 4; ++i)
+                                                                   serveRBCP(socket, memory, 1);
+                                                           }) :
+                                               std::thread(serveRBCP, std::ref(socket), std::ref(memory), 4, std::set<std::size_t>{}));
+
+        std::vector<std::vector<std::uint8_t>> readData;
+
+        BOOST_CHECK_NO_THROW(readData = intf.readBatch(ops));
+
+        responder.join();
+
+        BOOST_REQUIRE_EQUAL(readData.size(), ops.size());
+
+        for (std::size_t i = 0; i < ops.size(); ++i)
+            BOOST_CHECK(readData[i] == std::vector<std::uint8_t>(memory.begin() + ops[i].addr,
+                                                                 memory.begin() + ops[i].addr + ops[i].size));
+
+        BOOST_CHECK_EQUAL(intf.getStatistics().rbcpTransactions, 4);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test17_rbcpLateResponses)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 10356, rbcp_timeout: 0.05, rbcp_retransmits: 1}}],"
+              "hw_drivers: [], registers: []}");
+
+    using boost::asio::ip::udp;
+    udp::endpoint endpoint(udp::v4(), 10356);
+    udp::socket socket(casil::ASIO::getIOContext(), endpoint);
+
+    std::vector<std::uint8_t> memory(256);
+    for (std::size_t i = 0; i < memory.size(); ++i)
+        memory[i] = static_cast<std::uint8_t>(i * 7);
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(d.init());
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        //Original request is answered only after its retransmission (and after the retransmission's response)
+
+        std::thread responder(serveRBCP, std::ref(socket), std::ref(memory), 2, std::set<std::size_t>{});
+
+        std::vector<std::uint8_t> readData;
+
+        BOOST_CHECK_NO_THROW(readData = intf.read(0x10, 4));
+
+        responder.join();
+
+        BOOST_CHECK(readData == std::vector<std::uint8_t>(memory.begin() + 0x10, memory.begin() + 0x14));
+
+        //Stray datagram with an ID that was never used arrives before the next response
+
+        responder = std::thread([&socket, &memory]()
+                                {
+                                    std::array<std::uint8_t, 64> buffer;
+                                    udp::endpoint remoteEndpoint;
+
+                                    socket.receive_from(boost::asio::buffer(buffer), remoteEndpoint, udp::socket::message_peek);
+                                    socket.send_to(boost::asio::buffer(std::vector<std::uint8_t>{0xFFu, 0xC8u, 0x80u, 0x01u}), remoteEndpoint);
+
+                                    serveRBCP(socket, memory, 1);
+                                });
+
+        BOOST_CHECK_NO_THROW(readData = intf.read(0x20, 4));
+
+        responder.join();
+
+        BOOST_CHECK(readData == std::vector<std::uint8_t>(memory.begin() + 0x20, memory.begin() + 0x24));
+
+        //Late response is consumed during the second transaction at the latest
+
+        const SiTCP::Statistics statistics = intf.getStatistics();
+
+        BOOST_CHECK_EQUAL(statistics.rbcpTransactions, 2);
+        BOOST_CHECK_EQUAL(statistics.rbcpRetries, 2);
+        BOOST_CHECK_EQUAL(statistics.rbcpLateResponses, 1);
+        BOOST_CHECK_EQUAL(statistics.rbcpWrongIdResponses, 1);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test18_eventNotifications)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 10356, event_port: 10357}}],"
+              "hw_drivers: [{name: drv, type: DummyMuxedDriver, interface: intf, base_addr: 0x1200, event_wait: true, silent: true}],"
+              "registers: []}");
+
+    using boost::asio::ip::udp;
+    udp::socket socket(casil::ASIO::getIOContext(), udp::endpoint(udp::v4(), 0));
+    const udp::endpoint eventEndpoint(boost::asio::ip::make_address("127.0.0.1"), 10357);
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(d.init());
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        BOOST_CHECK(intf.supportsEvents());
+
+        std::atomic_int handlerCalls = 0;
+        std::vector<std::uint8_t> lastPayload;
+
+        const std::uint64_t subscriptionId = intf.subscribeEvents(0x1200, [&handlerCalls, &lastPayload](const std::uint64_t pSourceAddr,
+                                                                                                       const std::span<const std::uint8_t> pPayload)
+                                                                  {
+                                                                      if (pSourceAddr == 0x1200)
+                                                                          lastPayload.assign(pPayload.begin(), pPayload.end());
+                                                                      ++handlerCalls;
+                                                                  });
+
+        //Too short datagram is discarded, notification of other module is counted separately
+
+        socket.send_to(boost::asio::buffer(std::vector<std::uint8_t>{0x00u, 0x00u}), eventEndpoint);
+        socket.send_to(boost::asio::buffer(std::vector<std::uint8_t>{0x00u, 0x00u, 0x13u, 0x00u}), eventEndpoint);
+
+        BOOST_CHECK(intf.waitForEvent(0x1300, 0, std::chrono::seconds(2)));
+        BOOST_CHECK_EQUAL(intf.getEventCount(0x1300), 1);
+        BOOST_CHECK_EQUAL(intf.getEventCount(0x1200), 0);
+        BOOST_CHECK(!intf.waitForEvent(0x1200, 0, std::chrono::milliseconds(20)));
+
+        socket.send_to(boost::asio::buffer(std::vector<std::uint8_t>{0x00u, 0x00u, 0x12u, 0x00u, 0xABu, 0xCDu}), eventEndpoint);
+
+        BOOST_CHECK(intf.waitForEvent(0x1200, 0, std::chrono::seconds(2)));
+        BOOST_CHECK_EQUAL(intf.getEventCount(0x1200), 1);
+        BOOST_CHECK_EQUAL(handlerCalls.load(), 1);
+        BOOST_CHECK(lastPayload == (std::vector<std::uint8_t>{0xABu, 0xCDu}));
+
+        intf.unsubscribeEvents(subscriptionId);
+
+        socket.send_to(boost::asio::buffer(std::vector<std::uint8_t>{0x00u, 0x00u, 0x12u, 0x00u}), eventEndpoint);
+
+        BOOST_CHECK(intf.waitForEvent(0x1200, 1, std::chrono::seconds(2)));
+        BOOST_CHECK_EQUAL(handlerCalls.load(), 1);
+
+        //Event-driven wait returns at the timeout (dummy driver is never done) without polling in between
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        BOOST_CHECK(!d.driver("drv").waitUntilDone(std::chrono::milliseconds(50)));
+        BOOST_CHECK(std::chrono::steady_clock::now() - startTime >= std::chrono::milliseconds(50));
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test19_query)
+{
+    using boost::asio::ip::udp;
+    udp::endpoint endpoint(udp::v4(), 10356);
+    udp::socket socket(casil::ASIO::getIOContext(), endpoint);
+
+    std::vector<std::uint8_t> memory(256);
+    for (std::size_t i = 0; i < memory.size(); ++i)
+        memory[i] = static_cast<std::uint8_t>(i * 7);
+
+    //Receives the write and the read request (i.e. without answering the write first) and then answers both in order
+    std::vector<std::chrono::steady_clock::time_point> arrivalTimes;
+
+    auto serveQuery = [&socket, &memory, &arrivalTimes]()
+    {
+        std::vector<std::pair<std::vector<std::uint8_t>, udp::endpoint>> requests;
+        std::array<std::uint8_t, 1024> buffer;
+
+        for (int i = 0; i < 2; ++i)
+        {
+            udp::endpoint remoteEndpoint;
+            const std::size_t n = socket.receive_from(boost::asio::buffer(buffer), remoteEndpoint);
+
+            arrivalTimes.push_back(std::chrono::steady_clock::now());
+            requests.emplace_back(std::vector<std::uint8_t>(buffer.begin(), buffer.begin() + n), remoteEndpoint);
+        }
+
+        for (const auto& [request, remoteEndpoint] : requests)
+            respondRBCP(socket, memory, request, remoteEndpoint);
+    };
+
+    for (const double queryDelay : {0.0, 30.0})
+    {
+        Device d("{transfer_layer: [{name: intf, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 10356, rbcp_window: 4, "
+                                                                   "rbcp_timeout: 0.05, rbcp_retransmits: 2, "
+                                                                   "query_delay: " + std::to_string(queryDelay) + "}}],"
+                  "hw_drivers: [], registers: []}");
+
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(d.init());
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        //Read request follows the write request without waiting for the write response (but after the query delay)
+
+        arrivalTimes.clear();
+
+        std::thread responder(serveQuery);
+
+        std::vector<std::uint8_t> readData;
+
+        BOOST_CHECK_NO_THROW(readData = intf.query(0x40, 0x3F, {0xA5u, 0x5Au}, 4));
+
+        responder.join();
+
+        BOOST_CHECK(readData == (std::vector<std::uint8_t>{memory[0x3F], 0xA5u, 0x5Au, memory[0x42]}));
+
+        BOOST_REQUIRE_EQUAL(arrivalTimes.size(), 2);
+        BOOST_CHECK(arrivalTimes[1] - arrivalTimes[0] >= std::chrono::microseconds(static_cast<int>(queryDelay * 800)));
+
+        BOOST_CHECK_EQUAL(intf.getStatistics().rbcpTransactions, 2);
+
+        if (queryDelay == 0.0)
+        {
+            //Lost write request gets overtaken by the read request, which must hence be repeated after the retransmitted write
+
+            responder = std::thread([&socket, &memory]()
+                                    {
+                                        serveRBCP(socket, memory, 1, {0});
+                                        for (int i = 0; i < 3; ++i)
+                                            serveRBCP(socket, memory, 1);
+                                    });
+
+            BOOST_CHECK_NO_THROW(readData = intf.query(0x40, 0x3F, {0x11u, 0x22u}, 4));
+
+            responder.join();
+
+            BOOST_CHECK(readData == (std::vector<std::uint8_t>{memory[0x3F], 0x11u, 0x22u, memory[0x42]}));
+
+            const SiTCP::Statistics statistics = intf.getStatistics();
+
+            BOOST_CHECK_EQUAL(statistics.rbcpTransactions, 5);
+            BOOST_CHECK_EQUAL(statistics.rbcpRetries, 1);
+        }
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test20_sharedFifoSubscriptions)
+{
+    using casil::HL::SiTCPFifo;
+
+    const std::string config = "{transfer_layer: [{name: intf, type: SiTCP, shared: test20_sitcp,"
+                                                  "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                                        "tcp_read_buffer_size: 8, fifo_max_size: 12}}],"
+                               "hw_drivers: [{name: fifo, type: SiTCPFifo, interface: intf, base_addr: 0x200000000, subscribe: true}],"
+                               "registers: []}";
+
+    Device d1(config);
+    Device d2(config);
+
+    SiTCP& intf = dynamic_cast<SiTCP&>(d1.interface("intf"));
+
+    BOOST_REQUIRE(&intf == &d2.interface("intf"));
+
+    SiTCPFifo& fifo1 = dynamic_cast<SiTCPFifo&>(d1.driver("fifo"));
+    SiTCPFifo& fifo2 = dynamic_cast<SiTCPFifo&>(d2.driver("fifo"));
+
+    auto waitForSize = [](const std::function<std::size_t()>& pGetSize, const std::size_t pSize) -> bool
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        while (pGetSize() < pSize)
+        {
+            if (std::chrono::steady_clock::now() - startTime > std::chrono::seconds(2))
+                return false;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        return true;
+    };
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        //Only the first device actually connects
+
+        BOOST_REQUIRE(d1.init());
+        BOOST_REQUIRE(d2.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        //Every subscriber gets the full data stream, a late subscriber starts at the next word boundary
+
+        boost::asio::write(socket, boost::asio::buffer(std::vector<std::uint8_t>{0x01, 0x02, 0x03, 0x04, 0x05, 0x06}));
+
+        BOOST_REQUIRE(waitForSize([&fifo2]() { return fifo2.getFifoSize(); }, 6));
+
+        const std::shared_ptr<casil::TL::SiTCPFifoSubscription> lateSubscription = intf.subscribeFifo();
+
+        boost::asio::write(socket, boost::asio::buffer(std::vector<std::uint8_t>{0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C}));
+
+        BOOST_REQUIRE(waitForSize([&fifo1]() { return fifo1.getFifoSize(); }, 12));
+        BOOST_REQUIRE(waitForSize([&lateSubscription]() { return lateSubscription->getFifoSize(); }, 4));
+
+        const std::vector<std::uint32_t> expectedWords = {0x04030201u, 0x08070605u, 0x0C0B0A09u};
+
+        BOOST_CHECK(fifo1.getFifoData() == expectedWords);
+        BOOST_CHECK_EQUAL(fifo1.getFifoSize(), 0);
+        BOOST_CHECK_EQUAL(fifo2.getFifoSize(), 12);
+        BOOST_CHECK(lateSubscription->getFifoData() == (std::vector<std::uint8_t>{0x09, 0x0A, 0x0B, 0x0C}));
+
+        //Reading the FIFO of the interface itself is rejected, since it does not receive the data
+
+        BOOST_CHECK_THROW(intf.getFifoSize(), std::runtime_error);
+        BOOST_CHECK_THROW(intf.getFifoData(), std::runtime_error);
+
+        //Resetting one subscriber does not affect the others
+
+        fifo2.reset();
+
+        BOOST_CHECK_EQUAL(fifo2.getFifoSize(), 0);
+
+        boost::asio::write(socket, boost::asio::buffer(std::vector<std::uint8_t>{0x0D, 0x0E, 0x0F, 0x10}));
+
+        BOOST_REQUIRE(waitForSize([&fifo1]() { return fifo1.getFifoSize(); }, 4));
+        BOOST_REQUIRE(waitForSize([&fifo2]() { return fifo2.getFifoSize(); }, 4));
+
+        BOOST_CHECK(fifo2.getFifoData() == std::vector<std::uint32_t>{0x100F0E0Du});
+
+        //Closing one device keeps the connection open for the other
+
+        BOOST_CHECK(d1.close());
+
+        boost::asio::write(socket, boost::asio::buffer(std::vector<std::uint8_t>{0x11, 0x12, 0x13, 0x14}));
+
+        BOOST_REQUIRE(waitForSize([&fifo2]() { return fifo2.getFifoSize(); }, 4));
+
+        BOOST_CHECK(fifo2.getFifoData() == std::vector<std::uint32_t>{0x14131211u});
+
+        //Data exceeding the size limit is dropped from the front in complete words
+
+        const std::uint64_t numBytesReceived = intf.getStatistics().fifoBytesReceived;
+
+        boost::asio::write(socket, boost::asio::buffer(std::vector<std::uint8_t>{0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+                                                                                 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28}));
+
+        BOOST_REQUIRE(waitForSize([&intf]() { return intf.getStatistics().fifoBytesReceived; }, numBytesReceived + 20));
+
+        BOOST_CHECK_EQUAL(fifo2.getFifoSize(), 12);
+        BOOST_CHECK(fifo2.getFifoData() == (std::vector<std::uint32_t>{0x201F1E1Du, 0x24232221u, 0x28272625u}));
+
+        BOOST_CHECK(d2.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test21_fifoChunkedWrite)
+{
+    using casil::HL::SiTCPFifo;
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357}}],"
+                             "hw_drivers: [{name: fifo, type: SiTCPFifo, interface: intf, base_addr: 0x200000000, write_chunk_size: 6}],"
+                             "registers: []}"), std::runtime_error);
+
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true}}],"
+              "hw_drivers: [{name: fifo, type: SiTCPFifo, interface: intf, base_addr: 0x200000000, write_chunk_size: 64}],"
+              "registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCPFifo& fifo = dynamic_cast<SiTCPFifo&>(d.driver("fifo"));
+
+        //Data spanning multiple chunks (including an incomplete last chunk) must arrive complete and in order
+
+        std::vector<std::uint32_t> words(1001);
+        std::iota(words.begin(), words.end(), 0xA0000000u);
+
+        fifo.setFifoData(std::span<const std::uint32_t>(words));
+
+        std::vector<std::uint8_t> received(words.size() * 4);
+
+        boost::asio::read(socket, boost::asio::buffer(received));
+
+        std::vector<std::uint8_t> expected(words.size() * 4);
+        casil::Bytes::encodeUInt32LE(words, expected);
+
+        BOOST_CHECK(received == expected);
+
+        //Vector overload and empty data
+
+        fifo.setFifoData(std::span<const std::uint32_t>());
+        fifo.setFifoData(std::vector<std::uint32_t>{0x04030201u});
+
+        received.resize(4);
+
+        boost::asio::read(socket, boost::asio::buffer(received));
+
+        BOOST_CHECK(received == (std::vector<std::uint8_t>{0x01, 0x02, 0x03, 0x04}));
+
+        //Chunks of concurrent calls must not interleave
+
+        std::vector<std::uint32_t> otherWords(1001);
+        std::iota(otherWords.begin(), otherWords.end(), 0xB0000000u);
+
+        std::thread otherWriter([&fifo, &otherWords]() { fifo.setFifoData(std::span<const std::uint32_t>(otherWords)); });
+
+        fifo.setFifoData(std::span<const std::uint32_t>(words));
+
+        otherWriter.join();
+
+        received.resize((words.size() + otherWords.size()) * 4);
+
+        boost::asio::read(socket, boost::asio::buffer(received));
+
+        std::vector<std::uint8_t> otherExpected(otherWords.size() * 4);
+        casil::Bytes::encodeUInt32LE(otherWords, otherExpected);
+
+        std::vector<std::uint8_t> expectedOrder1 = expected;
+        expectedOrder1.insert(expectedOrder1.end(), otherExpected.begin(), otherExpected.end());
+
+        std::vector<std::uint8_t> expectedOrder2 = otherExpected;
+        expectedOrder2.insert(expectedOrder2.end(), expected.begin(), expected.end());
+
+        BOOST_CHECK(received == expectedOrder1 || received == expectedOrder2);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test22_fifoSpill)
+{
+    const std::filesystem::path spillPath = std::filesystem::temp_directory_path() / "casil_test_sitcp_fifo_spill";
+
+    std::filesystem::remove(spillPath);
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, fifo_overflow_policy: spill}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: SiTCP,"
+                                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_read_buffer_size: 16, fifo_max_size: 24,"
+                                                       "fifo_overflow_policy: spill, fifo_spill_file: " + spillPath.string() + ","
+                                                       "fifo_spill_size: 24}}],"
+                              "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true,"
+                                       "tcp_read_buffer_size: 16, fifo_max_size: 24, fifo_overflow_policy: spill,"
+                                       "fifo_spill_file: " + spillPath.string() + ", fifo_spill_size: 64}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10357);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        BOOST_CHECK_EQUAL(intf.getFifoMaxSize(), 24);
+        BOOST_CHECK(!intf.isFifoSpilled());
+
+        std::vector<std::uint8_t> writeBuffer(80);
+        std::iota(writeBuffer.begin(), writeBuffer.end(), 1);
+
+        //Data beyond the memory limit must be spilled to file and buffered up to the spill size limit
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 64));
+
+        BOOST_CHECK(intf.isFifoSpilled());
+        BOOST_CHECK(std::filesystem::exists(spillPath));
+        BOOST_CHECK_EQUAL(intf.getFifoMaxSize(), 64);
+        BOOST_CHECK_EQUAL(intf.getStatistics().fifoBytesDropped, 0);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 64);
+
+        std::vector<std::uint8_t> data = intf.getFifoData();
+
+        BOOST_REQUIRE(waitForFifoSize(intf, 16));
+
+        const std::vector<std::uint8_t> rest = intf.getFifoData();
+        data.insert(data.end(), rest.begin(), rest.end());
+
+        BOOST_CHECK_EQUAL(data, writeBuffer);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,28 +25,72 @@
 #include <casil/auxil.h>
 #include <casil/bytes.h>
 #include <casil/device.h>
+#include <casil/HL/Direct/virtecho.h>
 #include <casil/TL/directinterface.h>
+#include <casil/TL/CommonImpl/endpointcache.h>
+#include <casil/TL/CommonImpl/tcpsocketwrapper.h>
 
+#include <utility>  //Missing include in boost/asio/awaitable.hpp of some Boost versions
+#include <boost/asio/awaitable.hpp>
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/co_spawn.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/read.hpp>
 #include <boost/asio/read_until.hpp>
+#include <boost/asio/socket_base.hpp>
+#include <boost/asio/use_future.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/system/errc.hpp>
 #include <boost/system/error_code.hpp>
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <span>
+#include <stdexcept>
 #include <thread>
 #include <vector>
 
 using casil::Device;
+using casil::HL::VirtEcho;
 using casil::TL::DirectInterface;
 
 namespace boost { using casil::Bytes::operator<<; }
 
+namespace
+{
+
+using casil::Layers::TL::CommonImpl::EndpointCache;
+using casil::Layers::TL::CommonImpl::TCPSocketWrapper;
+
+/*
+ * Performs a sequence of coroutine reads and writes on 'pSocketWrapper' and returns the read data.
+ */
+boost::asio::awaitable<std::vector<std::vector<std::uint8_t>>> performCoroutineTransfers(TCPSocketWrapper& pSocketWrapper, bool& pTimedOut)
+{
+    std::vector<std::vector<std::uint8_t>> readData;
+
+    readData.push_back(co_await pSocketWrapper.coRead(-1, std::chrono::milliseconds(1000)));
+    readData.push_back(co_await pSocketWrapper.coRead(3));
+    readData.push_back(co_await pSocketWrapper.coReadMax(10, std::chrono::milliseconds(1000)));
+    readData.push_back(co_await pSocketWrapper.coReadMax(10, std::chrono::milliseconds(100), std::ref(pTimedOut)));
+
+    const std::vector<std::uint8_t> writeData = {0x40u, 0x41};
+
+    co_await pSocketWrapper.coWrite(writeData, std::chrono::milliseconds(1000));
+
+    co_return readData;
+}
+
+} // namespace
+
 //
 
 #include <boost/test/unit_test.hpp>
@@ -248,6 +292,39 @@ BOOST_AUTO_TEST_CASE(Test3_query)
 
         BOOST_CHECK_EQUAL(result, (std::vector<std::uint8_t>{0xFFu, 0x00u, 0xAAu, 0x23u, 0x24u}));
 
+        //Multiple queries at once (remaining termination from above gets cleared)
+
+        std::thread thrd2(
+                    [&socket, &readBuffer, &boostException]()
+                    {
+                        try
+                        {
+                            readBuffer.resize(5);
+
+                            (void)boost::asio::read(socket, boost::asio::buffer(readBuffer));
+
+                            (void)boost::asio::write(socket, boost::asio::buffer(std::vector<std::uint8_t>{0x41u, '\n', 0x42u, 0x43u, '\n'}));
+                        }
+                        catch (const boost::system::system_error&)
+                        {
+                            boostException = true;
+                        }
+                    });
+
+        const std::vector<std::vector<std::uint8_t>> queries = {{0x51u}, {0x52u, 0x53u}};
+
+        const std::vector<std::vector<std::uint8_t>> results = intf.queryMany(queries);
+
+        thrd2.join();
+
+        BOOST_REQUIRE(boostException == false);
+
+        BOOST_CHECK_EQUAL(readBuffer, (std::vector<std::uint8_t>{0x51u, '\n', 0x52u, 0x53u, '\n'}));
+
+        BOOST_REQUIRE_EQUAL(results.size(), 2);
+        BOOST_CHECK_EQUAL(results[0], (std::vector<std::uint8_t>{0x41u}));
+        BOOST_CHECK_EQUAL(results[1], (std::vector<std::uint8_t>{0x42u, 0x43u}));
+
         BOOST_CHECK(d.close());
     }
 }
@@ -314,6 +391,52 @@ BOOST_AUTO_TEST_CASE(Test4_readBufferFunctions)
 
         BOOST_CHECK(intf.readBufferEmpty());
 
+        //Reading into a provided buffer
+
+        writeBuffer = {0x41u, 0x42, '\n', 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, '\n'};
+        n = boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE_EQUAL(n, 10);
+
+        std::array<std::uint8_t, 4> readBuffer {};
+
+        BOOST_CHECK_EQUAL(intf.readInto(readBuffer), 2);
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + 2), (std::vector<std::uint8_t>{0x41u, 0x42}));
+        BOOST_CHECK_THROW(intf.readInto(readBuffer, 5), std::runtime_error);
+        BOOST_CHECK_EQUAL(intf.readInto(readBuffer, 3), 3);
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + 3), (std::vector<std::uint8_t>{0x43u, 0x44, 0x45}));
+        BOOST_CHECK_THROW(intf.readInto(std::span<std::uint8_t>(readBuffer).first(2)), std::runtime_error);
+        BOOST_CHECK_EQUAL(intf.readInto(readBuffer), 3);
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + 3), (std::vector<std::uint8_t>{0x46u, 0x47, 0x48}));
+
+        BOOST_CHECK(intf.readBufferEmpty());
+
+        //Many buffered short lines followed by an incomplete one
+
+        writeBuffer.clear();
+        for (int i = 0; i < 1000; ++i)
+        {
+            writeBuffer.push_back(static_cast<std::uint8_t>('a' + i % 26));
+            writeBuffer.push_back('\n');
+        }
+        writeBuffer.push_back(0x55u);
+
+        n = boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE_EQUAL(n, 2001);
+
+        for (int i = 0; i < 1000; ++i)
+            BOOST_REQUIRE_EQUAL(intf.read(), (std::vector<std::uint8_t>{static_cast<std::uint8_t>('a' + i % 26)}));
+
+        writeBuffer = {0x56u, '\n'};
+        n = boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        BOOST_REQUIRE_EQUAL(n, 2);
+
+        BOOST_CHECK_EQUAL(intf.read(), (std::vector<std::uint8_t>{0x55u, 0x56u}));
+
+        BOOST_CHECK(intf.readBufferEmpty());
+
         BOOST_CHECK(d.close());
     }
 }
@@ -369,6 +492,585 @@ BOOST_AUTO_TEST_CASE(Test5_requireIOContextThreads)
     BOOST_CHECK(handlerCalled.load() == true);
 }
 
+BOOST_AUTO_TEST_CASE(Test6_coroutines)
+{
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10354);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        TCPSocketWrapper socketWrapper("127.0.0.1", 10354, "\n", "\r\n", casil::ASIO::getIOContext());
+
+        BOOST_REQUIRE_NO_THROW(socketWrapper.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        const std::vector<std::uint8_t> writeBuffer = {0x30u, 0x31, 0x32, '\n', 0x33, 0x34, 0x35, 0x36, 0x37};
+
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer, writeBuffer.size()));
+
+        bool timedOut = false;
+
+        std::future<std::vector<std::vector<std::uint8_t>>> readData = boost::asio::co_spawn(casil::ASIO::getIOContext(),
+                                                                                             performCoroutineTransfers(socketWrapper, timedOut),
+                                                                                             boost::asio::use_future);
+
+        std::vector<std::uint8_t> readBuffer(4);
+
+        BOOST_CHECK_EQUAL(boost::asio::read(socket, boost::asio::buffer(readBuffer, readBuffer.size())), 4);
+        BOOST_CHECK_EQUAL(readBuffer, (std::vector<std::uint8_t>{0x40u, 0x41, '\r', '\n'}));
+
+        std::vector<std::vector<std::uint8_t>> data;
+
+        BOOST_REQUIRE_NO_THROW(data = readData.get());
+        BOOST_REQUIRE_EQUAL(data.size(), 4);
+
+        BOOST_CHECK_EQUAL(data[0], (std::vector<std::uint8_t>{0x30u, 0x31, 0x32}));
+        BOOST_CHECK_EQUAL(data[1], (std::vector<std::uint8_t>{0x33, 0x34, 0x35}));
+        BOOST_CHECK_EQUAL(data[2], (std::vector<std::uint8_t>{0x36, 0x37}));
+        BOOST_CHECK_EQUAL(data[3], (std::vector<std::uint8_t>{}));
+        BOOST_CHECK(timedOut == true);
+
+        BOOST_CHECK_NO_THROW(socketWrapper.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test7_socketOptions)
+{
+    Device d("{transfer_layer: [{name: intf, type: TCP,"
+                                "init: {address: 127.0.0.1, port: 10354, read_termination: \"\\n\","
+                                        " recv_buffer_size: 65536, send_buffer_size: 65536, tcp_no_delay: true}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10354);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        DirectInterface& intf = dynamic_cast<DirectInterface&>(d.interface("intf"));
+
+        intf.write({0x30u, 0x31});
+
+        std::vector<std::uint8_t> readBuffer;
+
+        std::size_t n = boost::asio::read_until(socket, boost::asio::dynamic_buffer(readBuffer), "\n");
+
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + n), (std::vector<std::uint8_t>{0x30u, 0x31, '\n'}));
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test8_reconnect)
+{
+    Device d("{transfer_layer: [{name: intf, type: TCP,"
+                                "init: {address: 127.0.0.1, port: 10354, read_termination: \"\\n\","
+                                        " reconnect_attempts: 5, reconnect_backoff: 0.01}}],"
+              "hw_drivers: [], registers: []}");
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10354);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        std::future<tcp::socket> socketFuture = acceptor.async_accept(boost::asio::use_future);
+
+        BOOST_REQUIRE(d.init());
+
+        tcp::socket socket = socketFuture.get();
+
+        DirectInterface& intf = dynamic_cast<DirectInterface&>(d.interface("intf"));
+
+        boost::asio::write(socket, boost::asio::buffer(std::vector<std::uint8_t>{0x30u, '\n'}));
+
+        BOOST_CHECK_EQUAL(intf.read(), (std::vector<std::uint8_t>{0x30u}));
+
+        //Drop the connection; the failing read re-establishes it without re-initializing the device
+
+        socketFuture = acceptor.async_accept(boost::asio::use_future);
+
+        socket.set_option(boost::asio::socket_base::linger(true, 0));   //Reset connection to avoid TIME_WAIT on the listening port
+        socket.close();
+
+        BOOST_CHECK_THROW(intf.read(), std::runtime_error);
+
+        socket = socketFuture.get();
+
+        boost::asio::write(socket, boost::asio::buffer(std::vector<std::uint8_t>{0x31u, '\n'}));
+
+        BOOST_CHECK_EQUAL(intf.read(), (std::vector<std::uint8_t>{0x31u}));
+
+        intf.write({0x32u});
+
+        std::vector<std::uint8_t> readBuffer;
+
+        std::size_t n = boost::asio::read_until(socket, boost::asio::dynamic_buffer(readBuffer), "\n");
+
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + n), (std::vector<std::uint8_t>{0x32u, '\n'}));
+
+        BOOST_CHECK(d.close());
+    }
+
+    //Standby connection replaces the lost connection
+
+    Device d2("{transfer_layer: [{name: intf, type: TCP,"
+                                 "init: {address: 127.0.0.1, port: 10354, read_termination: \"\\n\","
+                                         " reconnect_attempts: 1, reconnect_standby: true}}],"
+               "hw_drivers: [], registers: []}");
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        std::future<tcp::socket> socketFuture = acceptor.async_accept(boost::asio::use_future);
+
+        BOOST_REQUIRE(d2.init());
+
+        tcp::socket socket = socketFuture.get();
+        tcp::socket standbySocket = acceptor.async_accept(boost::asio::use_future).get();
+
+        DirectInterface& intf = dynamic_cast<DirectInterface&>(d2.interface("intf"));
+
+        socket.set_option(boost::asio::socket_base::linger(true, 0));
+        socket.close();
+
+        BOOST_CHECK_THROW(intf.read(), std::runtime_error);
+
+        boost::asio::write(standbySocket, boost::asio::buffer(std::vector<std::uint8_t>{0x33u, '\n'}));
+
+        BOOST_CHECK_EQUAL(intf.read(), (std::vector<std::uint8_t>{0x33u}));
+
+        BOOST_CHECK(d2.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test9_recordStream)
+{
+    Device d("{transfer_layer: [{name: intf, type: TCP,"
+                                "init: {address: 127.0.0.1, port: 10354, read_termination: \"\\r\\n\"}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10354);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    std::vector<std::vector<std::uint8_t>> records;
+    std::mutex recordsMutex;
+    std::condition_variable recordsCondVar;
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        DirectInterface& intf = dynamic_cast<DirectInterface&>(d.interface("intf"));
+
+        BOOST_REQUIRE(intf.supportsRecordStreaming());
+
+        //Data already received before starting the stream gets discarded
+
+        std::vector<std::uint8_t> writeBuffer = {0x20u, 0x21u};
+        (void)boost::asio::write(socket, boost::asio::buffer(writeBuffer));
+
+        BOOST_CHECK(intf.readBufferEmpty() == false);
+
+        intf.startRecordStream([&records, &recordsMutex, &recordsCondVar](const std::span<const std::uint8_t> pRecord)
+                               {
+                                   {
+                                       const std::lock_guard<std::mutex> recordsLock(recordsMutex);
+                                       records.emplace_back(pRecord.begin(), pRecord.end());
+                                   }
+                                   recordsCondVar.notify_one();
+                               });
+
+        BOOST_CHECK_THROW(intf.startRecordStream([](std::span<const std::uint8_t>){}), std::runtime_error);
+
+        //Records and terminations split across multiple transfers
+
+        const std::vector<std::vector<std::uint8_t>> chunks = {{0x30u, 0x31u, '\r'}, {'\n', 0x32u, '\r', '\n', '\r', '\n', 0x33u},
+                                                                {0x34u, '\r'}, {'\n', 0x35u}};
+
+        for (const std::vector<std::uint8_t>& chunk : chunks)
+        {
+            (void)boost::asio::write(socket, boost::asio::buffer(chunk));
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+
+        {
+            std::unique_lock<std::mutex> recordsLock(recordsMutex);
+            BOOST_CHECK(recordsCondVar.wait_for(recordsLock, std::chrono::milliseconds(1000), [&records](){ return records.size() >= 4; }));
+        }
+
+        intf.stopRecordStream();
+        intf.stopRecordStream();
+
+        BOOST_REQUIRE_EQUAL(records.size(), 4);
+        BOOST_CHECK_EQUAL(records[0], (std::vector<std::uint8_t>{0x30u, 0x31u}));
+        BOOST_CHECK_EQUAL(records[1], (std::vector<std::uint8_t>{0x32u}));
+        BOOST_CHECK_EQUAL(records[2], (std::vector<std::uint8_t>{}));
+        BOOST_CHECK_EQUAL(records[3], (std::vector<std::uint8_t>{0x33u, 0x34u}));
+
+        //Normal reads possible again after stopping the stream
+
+        writeBuffer = {0x36u, '\r', '\n'};
+        (void)boost::asio::write(socket, boost::asio::buffer(writeBuffer));
+
+        BOOST_CHECK_EQUAL(intf.read(), (std::vector<std::uint8_t>{0x36u}));
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test10_binaryBlocks)
+{
+    Device d("{transfer_layer: [{name: intf, type: TCP,"
+                                "init: {address: 127.0.0.1, port: 10354, read_termination: \"\\n\"}}],"
+              "hw_drivers: [], registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10354);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        DirectInterface& intf = dynamic_cast<DirectInterface&>(d.interface("intf"));
+
+        //Block data containing the read termination
+
+        std::vector<std::uint8_t> writeBuffer = {'#', '1', '5', 0x00u, '\n', 0xFFu, '\n', 0x12u, '\n'};
+        (void)boost::asio::write(socket, boost::asio::buffer(writeBuffer));
+
+        BOOST_CHECK_EQUAL(intf.readBlock(), (std::vector<std::uint8_t>{0x00u, '\n', 0xFFu, '\n', 0x12u}));
+
+        BOOST_CHECK(intf.readBufferEmpty());
+
+        //Into buffer, with multi-digit length and empty block
+
+        writeBuffer = {'#', '2', '0', '3', 0x41u, 0x42u, 0x43u, '\n', '#', '1', '0', '\n'};
+        (void)boost::asio::write(socket, boost::asio::buffer(writeBuffer));
+
+        std::array<std::uint8_t, 4> readBuffer {};
+
+        BOOST_CHECK_EQUAL(intf.readBlockInto(readBuffer), 3);
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + 3), (std::vector<std::uint8_t>{0x41u, 0x42u, 0x43u}));
+        BOOST_CHECK_EQUAL(intf.readBlockInto(readBuffer), 0);
+
+        //Block too large for buffer gets discarded
+
+        writeBuffer = {'#', '1', '6', 1, 2, 3, 4, 5, 6, '\n', '#', '1', '1', 0x07u, '\n'};
+        (void)boost::asio::write(socket, boost::asio::buffer(writeBuffer));
+
+        BOOST_CHECK_THROW(intf.readBlockInto(readBuffer), std::runtime_error);
+        BOOST_CHECK_EQUAL(intf.readBlock(), (std::vector<std::uint8_t>{0x07u}));
+
+        //Invalid headers
+
+        writeBuffer = {'#', '0', '\n'};
+        (void)boost::asio::write(socket, boost::asio::buffer(writeBuffer));
+
+        BOOST_CHECK_THROW(intf.readBlock(), std::runtime_error);
+        intf.clearReadBuffer();
+
+        writeBuffer = {'A', 'B', '\n'};
+        (void)boost::asio::write(socket, boost::asio::buffer(writeBuffer));
+
+        BOOST_CHECK_THROW(intf.readBlock(), std::runtime_error);
+        intf.clearReadBuffer();
+
+        //Query
+
+        std::vector<std::uint8_t> queryBuffer;
+        bool boostException = false;
+
+        std::thread thrd(
+                    [&socket, &queryBuffer, &boostException]()
+                    {
+                        try
+                        {
+                            (void)boost::asio::read_until(socket, boost::asio::dynamic_buffer(queryBuffer), "\n");
+                            (void)boost::asio::write(socket, boost::asio::buffer(std::vector<std::uint8_t>{'#', '1', '2', 0x34u, 0x12u, '\n'}));
+                        }
+                        catch (const boost::system::system_error&)
+                        {
+                            boostException = true;
+                        }
+                    });
+
+        const std::vector<std::uint8_t> result = intf.queryBlock({0x57u, 0x3Fu});
+
+        thrd.join();
+
+        BOOST_REQUIRE(boostException == false);
+
+        BOOST_CHECK_EQUAL(queryBuffer, (std::vector<std::uint8_t>{0x57u, 0x3Fu, '\n'}));
+        BOOST_CHECK_EQUAL(result, (std::vector<std::uint8_t>{0x34u, 0x12u}));
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test11_echoBenchmark)
+{
+    Device d("{transfer_layer: [{name: intf, type: TCP,"
+                                "init: {address: 127.0.0.1, port: 10354, read_termination: \"\\n\", write_termination: \"\"}}],"
+              "hw_drivers: [{name: echo, type: VirtEcho, interface: intf, init: {block_sizes: [16, 256], num_blocks: 20}}],"
+              "registers: []}");
+
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    auto handleAccept = [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+    {
+        if (pErrorCode.value() != boost::system::errc::success)
+            handlerError.store(true);
+
+        handlerCompleted.store(true);
+        handlerCompleted.notify_one();
+    };
+
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10354);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, handleAccept);
+
+        BOOST_REQUIRE(d.init());
+
+        handlerCompleted.wait(false);
+
+        BOOST_CHECK(handlerError.load() == false);
+
+        const VirtEcho& echoDrv = dynamic_cast<const VirtEcho&>(d.driver("echo"));
+
+        //Echo with reused buffer
+
+        std::vector<std::uint8_t> writeBuffer = {0x01u, 0x02u, 0x03u, 0x04u};
+
+        for (int i = 0; i < 2; ++i)
+        {
+            (void)boost::asio::write(socket, boost::asio::buffer(writeBuffer));
+
+            echoDrv(4);
+
+            std::vector<std::uint8_t> readBuffer(4);
+            (void)boost::asio::read(socket, boost::asio::buffer(readBuffer));
+
+            BOOST_CHECK_EQUAL(readBuffer, writeBuffer);
+        }
+
+        //Benchmark against transparent echo server
+
+        bool boostException = false;
+
+        std::thread thrd(
+                    [&socket, &boostException]()
+                    {
+                        try
+                        {
+                            std::array<std::uint8_t, 512> buffer {};
+                            std::size_t remaining = 20 * (16 + 256);
+
+                            while (remaining > 0)
+                            {
+                                const std::size_t numBytes = socket.read_some(boost::asio::buffer(buffer));
+                                (void)boost::asio::write(socket, boost::asio::buffer(buffer.data(), numBytes));
+                                remaining -= numBytes;
+                            }
+                        }
+                        catch (const boost::system::system_error&)
+                        {
+                            boostException = true;
+                        }
+                    });
+
+        const std::vector<VirtEcho::BenchmarkResult> results = echoDrv.benchmark();
+
+        thrd.join();
+
+        BOOST_REQUIRE(boostException == false);
+        BOOST_REQUIRE_EQUAL(results.size(), 2);
+
+        BOOST_CHECK_EQUAL(results[0].interfaceType, "TCP");
+        BOOST_CHECK_EQUAL(results[0].blockSize, 16);
+        BOOST_CHECK_EQUAL(results[1].blockSize, 256);
+
+        for (const VirtEcho::BenchmarkResult& result : results)
+        {
+            BOOST_CHECK_EQUAL(result.numBlocks, 20);
+            BOOST_CHECK(result.throughputMBps > 0.0);
+            BOOST_CHECK(result.latencyMinMicroSecs <= result.latencyP50MicroSecs);
+            BOOST_CHECK(result.latencyP50MicroSecs <= result.latencyP90MicroSecs);
+            BOOST_CHECK(result.latencyP90MicroSecs <= result.latencyP99MicroSecs);
+            BOOST_CHECK(result.latencyP99MicroSecs <= result.latencyMaxMicroSecs);
+        }
+
+        BOOST_CHECK_THROW(echoDrv.benchmark(0, 1), std::invalid_argument);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test12_endpointCache)
+{
+    using boost::asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), 10354);
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), endpoint, false);
+
+    EndpointCache::clear();
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        const EndpointCache::Statistics statsBefore = EndpointCache::getStatistics();
+
+        //Second connection to the same host/port must not resolve again
+
+        for (int i = 0; i < 2; ++i)
+        {
+            tcp::socket socket(casil::ASIO::getIOContext());
+            std::future<void> accepted = acceptor.async_accept(socket, boost::asio::use_future);
+
+            TCPSocketWrapper socketWrapper("localhost", 10354, "\n", "\r\n", casil::ASIO::getIOContext());
+
+            BOOST_REQUIRE_NO_THROW(socketWrapper.init(std::chrono::milliseconds(1000)));
+            BOOST_CHECK_NO_THROW(accepted.get());
+            BOOST_CHECK_NO_THROW(socketWrapper.close());
+        }
+
+        EndpointCache::Statistics statsAfter = EndpointCache::getStatistics();
+
+        BOOST_CHECK_EQUAL(statsAfter.misses - statsBefore.misses, 1);
+        BOOST_CHECK_EQUAL(statsAfter.hits - statsBefore.hits, 1);
+
+        //Failed connection invalidates the cached endpoints
+
+        acceptor.close();
+
+        {
+            TCPSocketWrapper socketWrapper("localhost", 10354, "\n", "\r\n", casil::ASIO::getIOContext());
+
+            BOOST_CHECK_THROW(socketWrapper.init(std::chrono::milliseconds(1000)), std::runtime_error);
+            BOOST_CHECK_THROW(socketWrapper.init(std::chrono::milliseconds(1000)), std::runtime_error);
+        }
+
+        const EndpointCache::Statistics statsFailed = EndpointCache::getStatistics();
+
+        BOOST_CHECK_EQUAL(statsFailed.misses - statsAfter.misses, 1);
+        BOOST_CHECK_EQUAL(statsFailed.hits - statsAfter.hits, 1);
+
+        //Zero time to live disables caching
+
+        const std::chrono::milliseconds timeToLive = EndpointCache::getTimeToLive();
+
+        EndpointCache::setTimeToLive(std::chrono::milliseconds::zero());
+
+        statsAfter = EndpointCache::getStatistics();
+
+        (void)EndpointCache::resolveTCP(casil::ASIO::getIOContext(), "localhost", 10354);
+        (void)EndpointCache::resolveTCP(casil::ASIO::getIOContext(), "localhost", 10354);
+
+        BOOST_CHECK_EQUAL(EndpointCache::getStatistics().misses - statsAfter.misses, 2);
+
+        EndpointCache::setTimeToLive(timeToLive);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,7 @@
 #include <casil/bytes.h>
 #include <casil/device.h>
 #include <casil/TL/directinterface.h>
+#include <casil/TL/CommonImpl/udpsocketwrapper.h>
 
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/io_context.hpp>
@@ -35,13 +36,17 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <span>
 #include <thread>
 #include <vector>
 
 using casil::Device;
 using casil::TL::DirectInterface;
+using casil::Layers::TL::CommonImpl::UDPSocketWrapper;
 
 using UDPBufferT = std::array<std::uint8_t, 65527>;
 
@@ -276,6 +281,118 @@ BOOST_AUTO_TEST_CASE(Test5_requireIOContextThreads)
     BOOST_CHECK(d.init() == false);
 }
 
+BOOST_AUTO_TEST_CASE(Test6_timeoutsWithoutIOContextThreads)
+{
+    using boost::asio::ip::udp;
+    udp::endpoint endpoint(udp::v4(), 10355);
+    udp::socket socket(casil::ASIO::getIOContext(), endpoint);
+
+    UDPSocketWrapper socketWrapper("127.0.0.1", 10355, casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<1> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE_NO_THROW(socketWrapper.init());
+    }
+
+    BOOST_REQUIRE(casil::ASIO::ioContextThreadsRunning() == false);
+
+    //Transfers with timeout must not depend on running IO context threads
+
+    bool timedOut = false;
+
+    BOOST_CHECK_EQUAL(socketWrapper.read(std::chrono::milliseconds(100), std::ref(timedOut)), (std::vector<std::uint8_t>{}));
+    BOOST_CHECK(timedOut == true);
+
+    BOOST_CHECK_NO_THROW(socketWrapper.write({0x99u}, std::chrono::milliseconds(1000), std::ref(timedOut)));
+    BOOST_CHECK(timedOut == false);
+
+    udp::endpoint remoteEndpoint(udp::v4(), 10355);
+
+    UDPBufferT readBuffer;
+    BOOST_CHECK_EQUAL(socket.receive_from(boost::asio::buffer(readBuffer, 1), remoteEndpoint), 1);
+    BOOST_CHECK_EQUAL(readBuffer[0], 0x99u);
+
+    const std::vector<std::uint8_t> writeData = {0x30u, 0x31, 0x32};
+    socket.send_to(boost::asio::buffer(writeData, writeData.size()), remoteEndpoint);
+
+    BOOST_CHECK_EQUAL(socketWrapper.readMax(2, std::chrono::milliseconds(1000), std::ref(timedOut)), (std::vector<std::uint8_t>{0x30u, 0x31}));
+    BOOST_CHECK(timedOut == false);
+
+    BOOST_CHECK_NO_THROW(socketWrapper.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test7_batchedTransfers)
+{
+    using boost::asio::ip::udp;
+    udp::endpoint endpoint(udp::v4(), 10355);
+    udp::socket socket(casil::ASIO::getIOContext(), endpoint);
+
+    UDPSocketWrapper socketWrapper("127.0.0.1", 10355, casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<1> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE_NO_THROW(socketWrapper.init());
+
+        //Write batch
+
+        const std::vector<std::uint8_t> data0 = {0x30u, 0x31};
+        const std::vector<std::uint8_t> data1 = {0x32u};
+        const std::vector<std::uint8_t> data2 = {0x33u, 0x34, 0x35};
+
+        const std::array<std::span<const std::uint8_t>, 3> writeDatagrams = {data0, data1, data2};
+
+        BOOST_CHECK_NO_THROW(socketWrapper.writeBatch(writeDatagrams, std::chrono::milliseconds(1000)));
+
+        udp::endpoint remoteEndpoint(udp::v4(), 10355);
+
+        UDPBufferT readBuffer;
+        BOOST_CHECK_EQUAL(socket.receive_from(boost::asio::buffer(readBuffer, readBuffer.size()), remoteEndpoint), 2);
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + 2), data0);
+        BOOST_CHECK_EQUAL(socket.receive_from(boost::asio::buffer(readBuffer, readBuffer.size()), remoteEndpoint), 1);
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + 1), data1);
+        BOOST_CHECK_EQUAL(socket.receive_from(boost::asio::buffer(readBuffer, readBuffer.size()), remoteEndpoint), 3);
+        BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(readBuffer.begin(), readBuffer.begin() + 3), data2);
+
+        //Read batch
+
+        for (std::uint8_t i = 0; i < 5; ++i)
+        {
+            const std::array<std::uint8_t, 3> writeData = {i, i, i};
+            socket.send_to(boost::asio::buffer(writeData, i % 2 == 0 ? 3 : 2), remoteEndpoint);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        std::array<std::array<std::uint8_t, 3>, 8> buffers {};
+        std::array<std::span<std::uint8_t>, 8> bufferSpans;
+        std::array<std::size_t, 8> sizes {};
+
+        for (std::size_t i = 0; i < buffers.size(); ++i)
+            bufferSpans[i] = buffers[i];
+
+        bool timedOut = true;
+
+        BOOST_REQUIRE_EQUAL(socketWrapper.readBatch(bufferSpans, sizes, std::chrono::milliseconds(1000), std::ref(timedOut)), 5);
+        BOOST_CHECK(timedOut == false);
+
+        for (std::uint8_t i = 0; i < 5; ++i)
+        {
+            BOOST_CHECK_EQUAL(sizes[i], (i % 2 == 0 ? 3 : 2));
+            BOOST_CHECK_EQUAL(buffers[i][0], i);
+            BOOST_CHECK_EQUAL(buffers[i][1], i);
+        }
+
+        BOOST_CHECK_EQUAL(socketWrapper.readBatch(bufferSpans, sizes, std::chrono::milliseconds(100), std::ref(timedOut)), 0);
+        BOOST_CHECK(timedOut == true);
+
+        BOOST_CHECK_NO_THROW(socketWrapper.close());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
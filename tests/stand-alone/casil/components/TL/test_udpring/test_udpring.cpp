@@ -0,0 +1,191 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <casil/asio.h>
+#include <casil/device.h>
+#include <casil/readoutpipeline.h>
+#include <casil/TL/Direct/udpring.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using casil::Device;
+using casil::ReadoutPipeline;
+using casil::TL::UDPRing;
+
+namespace
+{
+
+/*
+ * Sends 'pData' as single datagram to 'pPort' on the loopback interface.
+ */
+void sendDatagram(const std::uint16_t pPort, const std::vector<std::uint8_t>& pData)
+{
+    using boost::asio::ip::udp;
+
+    boost::asio::io_context ioContext;
+    udp::socket socket(ioContext, udp::endpoint(udp::v4(), 0));
+
+    (void)socket.send_to(boost::asio::buffer(pData), udp::endpoint(boost::asio::ip::address_v4::loopback(), pPort));
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Components_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(UDPRing_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_configuration)
+{
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: UDPRing, init: {network_interface: lo, port: 0}}], "
+                             "hw_drivers: [], registers: []}"), std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: UDPRing, init: {network_interface: lo, port: 10360, block_count: 0}}], "
+                             "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    Device d("{transfer_layer: [{name: intf, type: UDPRing, init: {network_interface: no_such_interface, port: 10360}}], "
+             "hw_drivers: [], registers: []}");
+
+    BOOST_CHECK(!d.init());
+
+    UDPRing& intf = dynamic_cast<UDPRing&>(d.interface("intf"));
+
+    BOOST_CHECK_THROW((void)intf.readBufferEmpty(), std::runtime_error);
+    BOOST_CHECK_THROW(intf.write({1, 2}), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_receive)
+{
+    Device d("{transfer_layer: [{name: intf, type: UDPRing, init: {network_interface: lo, port: 10361, block_size: 65536, "
+             "block_count: 4}}], hw_drivers: [], registers: []}");
+
+    if (!d.init())
+    {
+        BOOST_TEST_MESSAGE("Skipping UDPRing receive test (packet sockets not permitted).");
+        return;
+    }
+
+    UDPRing& intf = dynamic_cast<UDPRing&>(d.interface("intf"));
+
+    sendDatagram(10362, {9, 9, 9});     //Filtered out
+    sendDatagram(10361, {1, 2, 3});
+    sendDatagram(10361, {4, 5, 6, 7});
+    sendDatagram(10361, {8});
+
+    BOOST_CHECK(intf.read() == (std::vector<std::uint8_t>{1, 2, 3}));
+
+    std::vector<std::uint8_t> buffer(2);
+
+    BOOST_CHECK_EQUAL(intf.readInto(buffer), 2);
+    BOOST_CHECK(buffer == (std::vector<std::uint8_t>{4, 5}));
+
+    std::vector<std::vector<std::uint8_t>> payloads;
+
+    BOOST_CHECK_EQUAL(intf.consumeDatagrams([&payloads](const std::span<const std::uint8_t> pPayload) -> void
+                                            { payloads.emplace_back(pPayload.begin(), pPayload.end()); },
+                                            std::chrono::milliseconds(100)), 1);
+    BOOST_CHECK(payloads == (std::vector<std::vector<std::uint8_t>>{{8}}));
+
+    BOOST_CHECK_EQUAL(intf.consumeDatagrams([](std::span<const std::uint8_t>) -> void {}, std::chrono::milliseconds(20)), 0);
+    BOOST_CHECK(intf.readBufferEmpty());
+
+    sendDatagram(10361, {1});
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    BOOST_CHECK(!intf.readBufferEmpty());
+    intf.clearReadBuffer();
+    BOOST_CHECK(intf.readBufferEmpty());
+
+    const UDPRing::RingStatistics stats = intf.getRingStatistics();
+
+    BOOST_CHECK_EQUAL(stats.packetsReceived, 4);
+    BOOST_CHECK_EQUAL(stats.packetsDropped, 0);
+
+    BOOST_CHECK_THROW(intf.query({1}), std::runtime_error);
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test3_pipelineSource)
+{
+    Device d("{transfer_layer: [{name: intf, type: UDPRing, init: {network_interface: lo, port: 10363, block_size: 65536, "
+             "block_count: 4}}], hw_drivers: [], registers: []}");
+
+    if (!d.init())
+    {
+        BOOST_TEST_MESSAGE("Skipping UDPRing pipeline test (packet sockets not permitted).");
+        return;
+    }
+
+    UDPRing& intf = dynamic_cast<UDPRing&>(d.interface("intf"));
+
+    std::mutex wordsMutex;
+    std::vector<std::uint32_t> words;
+
+    ReadoutPipeline pipeline;
+
+    pipeline.addSource(std::make_unique<ReadoutPipeline::UDPRingSource>(intf));
+    pipeline.addSink(std::make_unique<ReadoutPipeline::CallbackSink>(
+                         [&wordsMutex, &words](std::size_t, const std::span<const std::uint32_t> pWords) -> void
+                         {
+                             const std::lock_guard<std::mutex> wordsLock(wordsMutex);
+                             (void)wordsLock;
+                             words.insert(words.end(), pWords.begin(), pWords.end());
+                         }));
+
+    pipeline.start();
+
+    //Words split across datagrams are reassembled
+    sendDatagram(10363, {0x01, 0x00, 0x00, 0x00, 0x02, 0x00});
+    sendDatagram(10363, {0x00, 0x00});
+    sendDatagram(10363, {0x03, 0x00, 0x00, 0x80});
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    pipeline.stop();
+
+    BOOST_CHECK(words == (std::vector<std::uint32_t>{1, 2, 0x80000003}));
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/allocations.h>
+#include <casil/metrics.h>
+#include <casil/timing.h>
+
+#include <new>
+#include <thread>
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(Allocations_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_scope)
+{
+    using casil::Allocations;
+
+    const Allocations::Counts processStart = Allocations::getProcessCounts();
+
+    const Allocations::Scope scope;
+
+    BOOST_CHECK_EQUAL(scope.getCounts().allocations, 0u);
+    BOOST_CHECK_EQUAL(scope.getCounts().bytes, 0u);
+
+    //Call allocation functions directly (allocations of new-expressions may be elided)
+    ::operator delete(::operator new(128));
+
+    const Allocations::Counts counts = scope.getCounts();
+
+    //Allocations of other threads must not count for the scope of this thread
+    std::thread([]() { ::operator delete(::operator new(1000)); }).join();
+
+    const Allocations::Counts processCounts = Allocations::getProcessCounts();
+
+    if (Allocations::isAvailable())
+    {
+        BOOST_CHECK_EQUAL(counts.allocations, 1u);
+        BOOST_CHECK_EQUAL(counts.bytes, 128u);
+
+        BOOST_CHECK(processCounts.allocations >= processStart.allocations + 2);
+        BOOST_CHECK(processCounts.bytes >= processStart.bytes + 128 + 1000);
+    }
+    else
+    {
+        BOOST_CHECK_EQUAL(counts.allocations, 0u);
+        BOOST_CHECK_EQUAL(counts.bytes, 0u);
+        BOOST_CHECK_EQUAL(processCounts.allocations, 0u);
+        BOOST_CHECK_EQUAL(processCounts.bytes, 0u);
+    }
+
+    BOOST_CHECK(scope.getCounts().bytes < counts.bytes + 1000);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_operationCounters)
+{
+    using casil::Allocations;
+    using casil::Timing;
+
+    casil::Metrics::Counter& allocations = Timing::getAllocationsCounter("test_span", {{"test", "Allocations_Tests"}});
+    casil::Metrics::Counter& bytes = Timing::getAllocatedBytesCounter("test_span", {{"test", "Allocations_Tests"}});
+
+    BOOST_CHECK(&allocations == &Timing::getAllocationsCounter("test_span", {{"test", "Allocations_Tests"}}));
+    BOOST_CHECK(&allocations != &bytes);
+
+    {
+        const Timing::Scope timing(nullptr, &allocations, &bytes);
+
+        ::operator delete(::operator new(100));
+    }
+
+    {
+        const Timing::Scope timing(nullptr);
+
+        ::operator delete(::operator new(100));
+    }
+
+#ifndef CASIL_DISABLE_TIMING
+    if (Allocations::isAvailable())
+    {
+        BOOST_CHECK_EQUAL(allocations.getValue(), 1u);
+        BOOST_CHECK_EQUAL(bytes.getValue(), 100u);
+    }
+    else
+#endif
+    {
+        BOOST_CHECK_EQUAL(allocations.getValue(), 0u);
+        BOOST_CHECK_EQUAL(bytes.getValue(), 0u);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,11 +25,15 @@
 
 #include <boost/asio/connect.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/system/error_code.hpp>
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
 #include <thread>
 
 //
@@ -88,6 +92,177 @@ BOOST_AUTO_TEST_CASE(Test1_asyncIOContext)
     ASIO::stopRunIOContext();
 }
 
+BOOST_AUTO_TEST_CASE(Test2_ioContextPool)
+{
+    using casil::ASIO;
+
+    BOOST_CHECK(ASIO::setIOContextPoolSize(0) == false);
+    BOOST_REQUIRE(ASIO::setIOContextPoolSize(2) == true);
+    BOOST_CHECK(ASIO::setIOContextPoolSize(1) == false);
+    BOOST_CHECK_EQUAL(ASIO::getIOContextPoolSize(), 2);
+
+    BOOST_CHECK(&ASIO::getIOContext(0) == &ASIO::getIOContext());
+    BOOST_CHECK(&ASIO::getIOContext(1) != &ASIO::getIOContext());
+    BOOST_CHECK_THROW(ASIO::getIOContext(2), std::runtime_error);
+
+    //Round-robin assignment must alternate between the contexts
+    BOOST_CHECK(&ASIO::getIOContext(-1) != &ASIO::getIOContext(-1));
+
+    BOOST_REQUIRE(ASIO::startRunIOContext(1, {0}) == true);
+
+    BOOST_CHECK(ASIO::setIOContextPoolSize(3) == false);
+
+    //All contexts must be run
+
+    std::atomic_int numHandlersCalled(0);
+
+    boost::asio::post(ASIO::getIOContext(0), [&numHandlersCalled]() { ++numHandlersCalled; });
+    boost::asio::post(ASIO::getIOContext(1), [&numHandlersCalled]() { ++numHandlersCalled; });
+
+    for (int i = 0; i < 20; ++i)
+    {
+        if (numHandlersCalled.load() == 2)
+            break;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    BOOST_CHECK_EQUAL(numHandlersCalled.load(), 2);
+
+    ASIO::stopRunIOContext();
+}
+
+BOOST_AUTO_TEST_CASE(Test3_adaptiveIOContext)
+{
+    using casil::ASIO;
+
+    ASIO::AdaptiveSettings settings;
+    settings.minThreads = 1;
+    settings.maxThreads = 3;
+    settings.probeInterval = std::chrono::milliseconds(10);
+    settings.scaleUpDelay = std::chrono::microseconds(5000);
+    settings.scaleDownDelay = std::chrono::microseconds(4000);
+    settings.scaleDownProbes = 5;
+
+    ASIO::AdaptiveSettings invalidSettings = settings;
+    invalidSettings.maxThreads = 0;
+
+    BOOST_CHECK(ASIO::startRunIOContextAdaptive(invalidSettings) == false);
+
+    BOOST_REQUIRE(ASIO::startRunIOContextAdaptive(settings) == true);
+
+    BOOST_CHECK(ASIO::startRunIOContext(1) == false);
+    BOOST_CHECK(ASIO::ioContextThreadsRunning());
+    BOOST_CHECK(ASIO::ioContextThreadsAdaptive());
+    BOOST_CHECK_EQUAL(ASIO::getNumIOContextThreads(0), 1);
+
+    auto waitFor = [](const std::function<bool()>& pCondition) -> bool
+    {
+        for (int i = 0; i < 300; ++i)
+        {
+            if (pCondition())
+                return true;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        return false;
+    };
+
+    //Blocked handlers delay the queue, so threads must be added up to the maximum
+
+    std::atomic_bool release(false);
+    std::atomic_int numHandlersCalled(0);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        boost::asio::post(ASIO::getIOContext(0), [&release, &numHandlersCalled]()
+                                                 {
+                                                     ++numHandlersCalled;
+
+                                                     while (!release.load())
+                                                         std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                                                 });
+    }
+
+    BOOST_CHECK(waitFor([]() { return ASIO::getNumIOContextThreads(0) == 3; }));
+    BOOST_CHECK(waitFor([&numHandlersCalled]() { return numHandlersCalled.load() == 3; }));
+
+    release.store(true);
+
+    //Idle threads must be removed down to the minimum again
+
+    BOOST_CHECK(waitFor([]() { return ASIO::getNumIOContextThreads(0) == 1; }));
+
+    //Dedicated threads must be started immediately and be removed again when released
+
+    boost::asio::io_context foreignIOContext;
+
+    BOOST_CHECK(ASIO::requestDedicatedThreads(foreignIOContext, 1) == false);
+    BOOST_CHECK(ASIO::requestDedicatedThreads(ASIO::getIOContext(0), 2) == true);
+    BOOST_CHECK_EQUAL(ASIO::getNumIOContextThreads(0), 2);
+
+    ASIO::releaseDedicatedThreads(ASIO::getIOContext(0), 2);
+
+    BOOST_CHECK(waitFor([]() { return ASIO::getNumIOContextThreads(0) == 1; }));
+
+    ASIO::stopRunIOContext();
+
+    BOOST_CHECK(ASIO::ioContextThreadsRunning() == false);
+    BOOST_CHECK(ASIO::ioContextThreadsAdaptive() == false);
+    BOOST_CHECK_EQUAL(ASIO::getNumIOContextThreads(), 0);
+
+    //Dedicated threads must be started in fixed mode as well
+
+    BOOST_CHECK(ASIO::requestDedicatedThreads(ASIO::getIOContext(0), 2) == true);
+
+    BOOST_REQUIRE(ASIO::startRunIOContext(1) == true);
+
+    BOOST_CHECK_EQUAL(ASIO::getNumIOContextThreads(0), 2);
+    BOOST_CHECK_EQUAL(ASIO::getNumIOContextThreads(), ASIO::getIOContextPoolSize() + 1);
+
+    ASIO::releaseDedicatedThreads(ASIO::getIOContext(0), 2);
+
+    ASIO::stopRunIOContext();
+}
+
+BOOST_AUTO_TEST_CASE(Test4_stopWithRunningHandler)
+{
+    using casil::ASIO;
+
+    BOOST_REQUIRE(ASIO::startRunIOContext(1) == true);
+
+    //A handler that is still running while stopping must be able to use the thread functions (no deadlock)
+
+    std::atomic_bool handlerStarted(false);
+    std::atomic_bool handlerFinished(false);
+    std::atomic<std::size_t> numThreadsWhileStopping(1);
+
+    boost::asio::post(ASIO::getIOContext(0), [&handlerStarted, &handlerFinished, &numThreadsWhileStopping]()
+                                             {
+                                                 handlerStarted.store(true);
+
+                                                 std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+                                                 numThreadsWhileStopping.store(ASIO::getNumIOContextThreads());
+
+                                                 ASIO::requestDedicatedThreads(ASIO::getIOContext(0), 1);
+                                                 ASIO::releaseDedicatedThreads(ASIO::getIOContext(0), 1);
+
+                                                 handlerFinished.store(true);
+                                             });
+
+    while (!handlerStarted.load())
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    ASIO::stopRunIOContext();
+
+    BOOST_CHECK(handlerFinished.load());
+    BOOST_CHECK_EQUAL(numThreadsWhileStopping.load(), 0);
+    BOOST_CHECK(ASIO::ioContextThreadsRunning() == false);
+    BOOST_CHECK_EQUAL(ASIO::getNumIOContextThreads(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -32,9 +32,11 @@
 #include <fstream>
 #include <ios>
 #include <ostream>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace Auxil = casil::Auxil;
@@ -232,6 +234,242 @@ BOOST_AUTO_TEST_CASE(Test6_asioRunner)
     BOOST_CHECK(secondRunnerFailed);
 }
 
+BOOST_AUTO_TEST_CASE(Test7_sleepUntil)
+{
+    using namespace std::chrono_literals;
+
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    Auxil::sleepUntil(startTime + 2500us);
+
+    BOOST_CHECK(std::chrono::steady_clock::now() - startTime >= 2500us);
+
+    const std::chrono::steady_clock::time_point startTime2 = std::chrono::steady_clock::now();
+
+    Auxil::sleepUntil(startTime2 - 1s);
+
+    BOOST_CHECK(std::chrono::steady_clock::now() - startTime2 < 100ms);
+}
+
+BOOST_AUTO_TEST_CASE(Test8_ptreeFromYAMLStream)
+{
+    using boost::property_tree::ptree;
+
+    const std::string yamlStr = "base: &b {x: 1, y: [1, 2]}\nuse: *b\nscalar: &s hello\nref: *s\nnothing: ~\nempty:\n";
+
+    std::istringstream yamlStream(yamlStr);
+
+    const ptree tree = Auxil::propertyTreeFromYAML(yamlStream);
+
+    BOOST_CHECK(tree == Auxil::propertyTreeFromYAML(yamlStr));
+
+    BOOST_CHECK(tree.get_child("use") == tree.get_child("base"));
+    BOOST_CHECK_EQUAL(tree.get_child("use.y.#1").data(), "2");
+    BOOST_CHECK_EQUAL(tree.get_child("ref").data(), "hello");
+    BOOST_CHECK(tree.get_child("nothing") == ptree());
+    BOOST_CHECK(tree.get_child("empty") == ptree());
+
+    BOOST_CHECK_THROW(Auxil::propertyTreeFromYAML("? [1, 2]\n: v\n"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Test9_ptreeBinary)
+{
+    using boost::property_tree::ptree;
+
+    ptree tree = Auxil::propertyTreeFromYAML("{foo: [1, {bar: baz}], empty: ~, x: 42}");
+    tree.data() = "root";
+    tree.add("dup", "a");
+    tree.add("dup", "b");
+    tree.push_back({"key.with.periods", ptree("v")});
+
+    const std::vector<std::uint8_t> bytes = Auxil::propertyTreeToBinary(tree);
+
+    BOOST_CHECK(Auxil::propertyTreeFromBinary(bytes) == tree);
+
+    BOOST_CHECK(Auxil::propertyTreeToBinary(ptree()).empty());
+    BOOST_CHECK(Auxil::propertyTreeFromBinary({}) == ptree());
+
+    BOOST_CHECK_THROW(Auxil::propertyTreeFromBinary(std::span(bytes).first(bytes.size() - 1)), std::runtime_error);
+
+    std::vector<std::uint8_t> trailingBytes = bytes;
+    trailingBytes.push_back(0);
+    BOOST_CHECK_THROW(Auxil::propertyTreeFromBinary(trailingBytes), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Test10_ptreeToYAMLStreaming)
+{
+    using boost::property_tree::ptree;
+
+    //Block style output
+
+    const ptree tree1 = Auxil::propertyTreeFromYAML("{a: 1, b: [x, {c: 2, d: [3]}, [4, 5]], e: {f: g}}");
+
+    std::string yamlStr;
+
+    Auxil::propertyTreeToYAML(tree1, yamlStr);
+
+    BOOST_CHECK_EQUAL(yamlStr, "a: 1\nb:\n  - x\n  - c: 2\n    d:\n      - 3\n  - - 4\n    - 5\ne:\n  f: g");
+    BOOST_CHECK_EQUAL(Auxil::propertyTreeToYAML(tree1), yamlStr);
+
+    //Buffer is replaced and keeps its capacity
+
+    const std::size_t capacity = yamlStr.capacity();
+
+    Auxil::propertyTreeToYAML(Auxil::propertyTreeFromYAML("{z: 0}"), yamlStr);
+
+    BOOST_CHECK_EQUAL(yamlStr, "z: 0");
+    BOOST_CHECK_EQUAL(yamlStr.capacity(), capacity);
+
+    Auxil::propertyTreeToYAML(ptree(), yamlStr);
+
+    BOOST_CHECK_EQUAL(yamlStr, "");
+
+    //Scalars that need quoting
+
+    ptree tree2;
+    for (const std::string value : {"plain text", "with: colon", "#hash", "- dash", "-1", "'quoted'", "\"dq\"", "tab\tand\nnewline",
+                                    "", "null", "~", " lead", "trail ", "end:", "a #b", "[flow]", "{flow}", "*alias", "&anchor",
+                                    "!tag", "%directive", "@at", "`tick", "?", ":", "x,y", "\\back"})
+    {
+        tree2.add_child("#" + std::to_string(tree2.size()), ptree(value));
+    }
+    tree2.add_child("#" + std::to_string(tree2.size()), Auxil::propertyTreeFromYAML("{\"key: with colon\": 1, \"#key\": 2}"));
+
+    BOOST_CHECK(Auxil::propertyTreeFromYAML(Auxil::propertyTreeToYAML(tree2)) == tree2);
+
+    //Binary blobs
+
+    BOOST_CHECK_EQUAL(Auxil::encodeBinaryBlob(std::vector<std::uint8_t>{'M', 'a', 'n'}), "!!binary TWFu");
+    BOOST_CHECK_EQUAL(Auxil::encodeBinaryBlob(std::vector<std::uint8_t>{'M', 'a'}), "!!binary TWE=");
+    BOOST_CHECK_EQUAL(Auxil::encodeBinaryBlob(std::vector<std::uint8_t>{0xFF}), "!!binary /w==");
+    BOOST_CHECK_EQUAL(Auxil::encodeBinaryBlob(std::vector<std::uint8_t>{}), "!!binary ");
+
+    std::vector<std::uint8_t> bytes(1000);
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<std::uint8_t>(i * 7);
+
+    const std::string blob = Auxil::encodeBinaryBlob(bytes);
+
+    BOOST_CHECK(Auxil::isBinaryBlob(blob));
+    BOOST_CHECK(!Auxil::isBinaryBlob("0b1010"));
+    BOOST_CHECK_EQUAL(Auxil::decodeBinaryBlob(blob), bytes);
+    BOOST_CHECK_EQUAL(Auxil::decodeBinaryBlob("!!binary TW\nFu"), (std::vector<std::uint8_t>{'M', 'a', 'n'}));
+    BOOST_CHECK_THROW(Auxil::decodeBinaryBlob("TWFu"), std::invalid_argument);
+    BOOST_CHECK_THROW(Auxil::decodeBinaryBlob("!!binary TWF"), std::invalid_argument);
+    BOOST_CHECK_THROW(Auxil::decodeBinaryBlob("!!binary TW!u"), std::invalid_argument);
+    BOOST_CHECK_THROW(Auxil::decodeBinaryBlob("!!binary T===A"), std::invalid_argument);
+
+    ptree tree3;
+    tree3.put("image", blob);
+    tree3.put("name", "reg");
+
+    Auxil::propertyTreeToYAML(tree3, yamlStr);
+
+    BOOST_CHECK(yamlStr.starts_with("image: !!binary "));
+    BOOST_CHECK(Auxil::propertyTreeFromYAML(yamlStr) == tree3);
+}
+
+BOOST_AUTO_TEST_CASE(Test11_threadScheduling)
+{
+    using Policy = Auxil::ThreadScheduling::Policy;
+
+    const Auxil::ThreadScheduling sched1 = Auxil::ThreadScheduling::fromString("fifo:80@2");
+
+    BOOST_CHECK(sched1.policy == Policy::FIFO);
+    BOOST_CHECK_EQUAL(sched1.priority, 80);
+    BOOST_CHECK_EQUAL(sched1.cpu, 2);
+
+    const Auxil::ThreadScheduling sched2 = Auxil::ThreadScheduling::fromString("rr:10");
+
+    BOOST_CHECK(sched2.policy == Policy::RoundRobin);
+    BOOST_CHECK_EQUAL(sched2.priority, 10);
+    BOOST_CHECK_EQUAL(sched2.cpu, -1);
+
+    const Auxil::ThreadScheduling sched3 = Auxil::ThreadScheduling::fromString("@0");
+
+    BOOST_CHECK(sched3.policy == Policy::Default);
+    BOOST_CHECK_EQUAL(sched3.cpu, 0);
+
+    BOOST_CHECK(Auxil::ThreadScheduling::fromString("").policy == Policy::Default);
+    BOOST_CHECK(Auxil::ThreadScheduling::fromString("default").policy == Policy::Default);
+
+    BOOST_CHECK_THROW(Auxil::ThreadScheduling::fromString("idle"), std::invalid_argument);
+    BOOST_CHECK_THROW(Auxil::ThreadScheduling::fromString("fifo:"), std::invalid_argument);
+    BOOST_CHECK_THROW(Auxil::ThreadScheduling::fromString("fifo:x"), std::invalid_argument);
+    BOOST_CHECK_THROW(Auxil::ThreadScheduling::fromString("rr@1x"), std::invalid_argument);
+    BOOST_CHECK_THROW(Auxil::ThreadScheduling::fromString("default:5"), std::invalid_argument);
+
+    //Threads run even if the settings cannot be applied (e.g. missing privileges for real-time scheduling)
+
+    bool ran = false;
+
+    std::thread thread1 = Auxil::startThread(Auxil::ThreadScheduling{}, "test thread", [&ran]() -> void { ran = true; });
+    thread1.join();
+
+    BOOST_CHECK(ran);
+
+    ran = false;
+
+    std::thread thread2 = Auxil::startThread(Auxil::ThreadScheduling{.policy = Policy::FIFO, .priority = 1, .cpu = 100000},
+                                             "test thread", [&ran]() -> void { ran = true; });
+    BOOST_CHECK(!Auxil::applyThreadScheduling(thread2, Auxil::ThreadScheduling{.cpu = 100000}, "test thread"));
+    thread2.join();
+
+    BOOST_CHECK(ran);
+}
+
+BOOST_AUTO_TEST_CASE(Test12_lz4Block)
+{
+    const auto roundTrip = [](const std::vector<std::uint8_t>& pBytes) -> std::vector<std::uint8_t>
+    {
+        std::vector<std::uint8_t> compressed;
+        Auxil::compressLZ4Block(pBytes, compressed);
+
+        BOOST_CHECK_LE(compressed.size(), pBytes.size() + pBytes.size() / 255 + 16);
+
+        std::vector<std::uint8_t> decompressed(pBytes.size());
+        Auxil::decompressLZ4Block(compressed, decompressed);
+
+        BOOST_CHECK_EQUAL(decompressed, pBytes);
+
+        return compressed;
+    };
+
+    roundTrip({});
+    roundTrip({1, 2, 3});
+
+    std::vector<std::uint8_t> repetitive(100000);
+    for (std::size_t i = 0; i < repetitive.size(); ++i)
+        repetitive[i] = static_cast<std::uint8_t>(i % 13 == 0 ? 0xAA : i % 5);
+
+    BOOST_CHECK_LT(roundTrip(repetitive).size(), repetitive.size() / 10);
+
+    std::vector<std::uint8_t> noisy(70000);
+    std::uint32_t state = 12345;
+    for (std::uint8_t& byte : noisy)
+    {
+        state = state * 1103515245u + 12345u;
+        byte = static_cast<std::uint8_t>(state >> 24);
+    }
+
+    roundTrip(noisy);
+
+    //Known block of the reference implementation ("abcabcabcabc...": 3 literals, match of 27 bytes with offset 3, 5 final literals)
+    const std::vector<std::uint8_t> reference {0x3F, 'a', 'b', 'c', 0x03, 0x00, 0x08, 0x50, 'a', 'b', 'c', 'a', 'b'};
+    std::vector<std::uint8_t> decoded(35);
+    Auxil::decompressLZ4Block(reference, decoded);
+
+    std::string decodedStr(decoded.begin(), decoded.end());
+    BOOST_CHECK_EQUAL(decodedStr, "abcabcabcabcabcabcabcabcabcabcabcab");
+
+    std::vector<std::uint8_t> output(35);
+    BOOST_CHECK_THROW(Auxil::decompressLZ4Block(std::vector<std::uint8_t>(reference.begin(), reference.begin() + 5), output),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(Auxil::decompressLZ4Block(std::vector<std::uint8_t>{0x10, 'a', 0x05, 0x00}, output), std::invalid_argument);
+    output.resize(100);
+    BOOST_CHECK_THROW(Auxil::decompressLZ4Block(reference, output), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -25,12 +25,17 @@
 
 #include <boost/dynamic_bitset.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <iterator>
 #include <limits>
 #include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace Bytes = casil::Bytes;
@@ -286,6 +291,320 @@ BOOST_AUTO_TEST_CASE(Test6_toStringFormatting)
     BOOST_CHECK_EQUAL(testStr4, "TESTBEGIN-{0xFFFFFFFFFFFFFFFF, 0x0, 0x1, 0x3E8, 0x800, 0x40, 0xFB}-TESTEND");
 }
 
+BOOST_AUTO_TEST_CASE(Test8_bitsetBytesLargeRoundTrip)
+{
+    using Bytes::bitsetFromBytes;
+    using Bytes::bytesFromBitset;
+    using boost::dynamic_bitset;
+
+    //Sizes spanning several blocks and not aligned to block or byte boundaries
+    for (const std::size_t bitSize : {std::size_t{63}, std::size_t{64}, std::size_t{65}, std::size_t{1000}, std::size_t{100003}})
+    {
+        const std::size_t byteSize = (bitSize + 7) / 8;
+
+        std::vector<std::uint8_t> bytes(byteSize);
+        for (std::size_t i = 0; i < byteSize; ++i)
+            bytes[i] = static_cast<std::uint8_t>((i * 37u + 11u) ^ (i >> 3));
+
+        //Clear MSB-side padding bits, which would be lost in the round trip
+        if (bitSize % 8 != 0)
+            bytes[0] &= static_cast<std::uint8_t>((1u << (bitSize % 8)) - 1);
+
+        const dynamic_bitset<> bits = bitsetFromBytes(bytes, bitSize);
+
+        BOOST_REQUIRE_EQUAL(bits.size(), bitSize);
+
+        bool bitsOk = true;
+        for (std::size_t i = 0; i < bitSize; ++i)
+            bitsOk = bitsOk && (bits[i] == (((bytes[byteSize-1-i/8] >> (i%8)) & 1u) == 1u));
+
+        BOOST_CHECK(bitsOk);
+        BOOST_CHECK(bytesFromBitset(bits, byteSize) == bytes);
+
+        //Zero-padding on the MSB side for a larger byte size
+        std::vector<std::uint8_t> paddedBytes(3, 0);
+        paddedBytes.insert(paddedBytes.end(), bytes.begin(), bytes.end());
+        BOOST_CHECK(bytesFromBitset(bits, byteSize + 3) == paddedBytes);
+        BOOST_CHECK(bitsetFromBytes(paddedBytes, bitSize) == bits);
+
+        //Truncation to fewer bytes keeps the least significant ones
+        BOOST_CHECK(bytesFromBitset(bits, byteSize / 2) == std::vector<std::uint8_t>(bytes.end() - byteSize / 2, bytes.end()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test9_composeBytesToBuffers)
+{
+    using Bytes::composeByteArray;
+    using Bytes::composeBytesInto;
+    using Bytes::composeBytesTo;
+
+    static_assert(composeByteArray(true, std::uint16_t(0x3456u), std::uint8_t(0x12u)) == std::array<std::uint8_t, 3>{0x34u, 0x56u, 0x12u});
+    static_assert(composeByteArray(false, std::uint16_t(0x3456u), std::uint8_t(0x12u)) == std::array<std::uint8_t, 3>{0x56u, 0x34u, 0x12u});
+
+    BOOST_CHECK((composeByteArray(false, std::uint8_t(0x12u), std::uint16_t(0x3456u), std::uint32_t(0x789ABCDEu),
+                                         std::uint64_t(0xF0E1D2C3B4A59687u)) ==
+                 std::array<std::uint8_t, 15>{0x12u,
+                                              0x56u, 0x34u,
+                                              0xDEu, 0xBCu, 0x9Au, 0x78u,
+                                              0x87u, 0x96u, 0xA5u, 0xB4u, 0xC3u, 0xD2u, 0xE1u, 0xF0u}));
+
+    std::vector<std::uint8_t> vec {0xAAu};
+    composeBytesTo(std::back_inserter(vec), true, std::uint32_t(0x789ABCDEu), std::uint8_t(0x12u));
+
+    BOOST_CHECK_EQUAL(vec, (std::vector<std::uint8_t>{0xAAu, 0x78u, 0x9Au, 0xBCu, 0xDEu, 0x12u}));
+
+    std::array<std::uint8_t, 4> buffer {0xFFu, 0xFFu, 0xFFu, 0xFFu};
+
+    BOOST_CHECK_EQUAL(composeBytesInto(buffer, true, std::uint16_t(0x3456u)), 2u);
+    BOOST_CHECK((buffer == std::array<std::uint8_t, 4>{0x34u, 0x56u, 0xFFu, 0xFFu}));
+
+    BOOST_CHECK_EQUAL(composeBytesInto(buffer, false, std::uint32_t(0x789ABCDEu)), 4u);
+    BOOST_CHECK((buffer == std::array<std::uint8_t, 4>{0xDEu, 0xBCu, 0x9Au, 0x78u}));
+
+    BOOST_CHECK_THROW(composeBytesInto(buffer, true, std::uint64_t(0)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Test10_bulkUInt32Conversion)
+{
+    using Bytes::decodeUInt32BE;
+    using Bytes::decodeUInt32LE;
+    using Bytes::encodeUInt32BE;
+    using Bytes::encodeUInt32LE;
+
+    const std::vector<std::uint8_t> bytes {0x78u, 0x9Au, 0xBCu, 0xDEu, 0x12u, 0x34u, 0x56u, 0x78u, 0x00u, 0x00u, 0x00u, 0xFFu};
+
+    std::vector<std::uint32_t> words(3);
+
+    decodeUInt32LE(bytes, words);
+    BOOST_CHECK_EQUAL(words, (std::vector<std::uint32_t>{0xDEBC9A78u, 0x78563412u, 0xFF000000u}));
+
+    std::vector<std::uint8_t> encoded(12);
+
+    encodeUInt32LE(words, encoded);
+    BOOST_CHECK_EQUAL(encoded, bytes);
+
+    decodeUInt32BE(bytes, words);
+    BOOST_CHECK_EQUAL(words, (std::vector<std::uint32_t>{0x789ABCDEu, 0x12345678u, 0x000000FFu}));
+
+    encodeUInt32BE(words, encoded);
+    BOOST_CHECK_EQUAL(encoded, bytes);
+
+    std::vector<std::uint32_t> tooFewWords(2);
+    std::vector<std::uint8_t> tooFewBytes(11);
+
+    BOOST_CHECK_THROW(decodeUInt32LE(bytes, tooFewWords), std::invalid_argument);
+    BOOST_CHECK_THROW(decodeUInt32BE(tooFewBytes, words), std::invalid_argument);
+    BOOST_CHECK_THROW(encodeUInt32LE(words, tooFewBytes), std::invalid_argument);
+    BOOST_CHECK_THROW(encodeUInt32BE(tooFewWords, encoded), std::invalid_argument);
+
+    BOOST_CHECK_NO_THROW(decodeUInt32LE(std::span<const std::uint8_t>(), std::span<std::uint32_t>()));
+}
+
+BOOST_AUTO_TEST_CASE(Test11_bitsetFromBytesInto)
+{
+    using Bytes::bitsetFromBytes;
+    using Bytes::bitsetFromBytesInto;
+    using boost::dynamic_bitset;
+
+    std::vector<std::uint8_t> bytes(40);
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<std::uint8_t>(i * 53u + 7u);
+
+    const dynamic_bitset<> allBits = bitsetFromBytes(bytes, bytes.size() * 8);
+
+    for (const std::size_t bitSize : {std::size_t{1}, std::size_t{63}, std::size_t{64}, std::size_t{200}, std::size_t{320}, std::size_t{400}})
+    {
+        for (const std::size_t skipBits : {std::size_t{0}, std::size_t{3}, std::size_t{64}, std::size_t{71}})
+        {
+            dynamic_bitset<> bits(bitSize);
+            bits.set();
+
+            bitsetFromBytesInto(bytes, bits, skipBits);
+
+            BOOST_REQUIRE_EQUAL(bits.size(), bitSize);
+
+            dynamic_bitset<> expected = allBits >> skipBits;
+            expected.resize(bitSize);
+
+            BOOST_CHECK(bits == expected);
+        }
+    }
+
+    dynamic_bitset<> bits(11);
+    bitsetFromBytesInto(std::vector<std::uint8_t>{0b10110111u, 0b00100000u}, bits, 5);
+    BOOST_CHECK_EQUAL(bits, dynamic_bitset<>(std::string("10110111001")));
+}
+
+BOOST_AUTO_TEST_CASE(Test12_bitFieldExtractInsert)
+{
+    using Bytes::extractBitField;
+    using Bytes::insertBitField;
+
+    std::vector<std::uint8_t> bytes(11);
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<std::uint8_t>(i * 89u + 13u);
+
+    const auto getBit = [](const std::vector<std::uint8_t>& pBytes, const std::size_t pIdx) -> bool
+                        { return ((pBytes[pIdx / 8] >> (7 - pIdx % 8)) & 1u) != 0; };
+
+    for (std::size_t offs = 0; offs < 16; ++offs)
+    {
+        for (std::size_t size = 1; size <= 64; ++size)
+        {
+            //Compare with bit-by-bit reference
+
+            std::uint64_t expected = 0;
+            for (std::size_t i = offs; i < offs + size; ++i)
+                expected = (expected << 1) | (getBit(bytes, i) ? 1u : 0u);
+
+            BOOST_REQUIRE_EQUAL(extractBitField(bytes, offs, size), expected);
+
+            const std::uint64_t newValue = 0xA5C3F00F0FF05A3Cu;
+
+            std::vector<std::uint8_t> modBytes = bytes;
+            insertBitField(modBytes, offs, size, newValue);
+
+            for (std::size_t i = 0; i < 8 * bytes.size(); ++i)
+            {
+                if (i >= offs && i < offs + size)
+                    BOOST_REQUIRE_EQUAL(getBit(modBytes, i), ((newValue >> (offs + size - 1 - i)) & 1u) != 0);
+                else
+                    BOOST_REQUIRE_EQUAL(getBit(modBytes, i), getBit(bytes, i));
+            }
+        }
+    }
+
+    static_assert(extractBitField(std::array<std::uint8_t, 2>{0b00010110u, 0b11100000u}, 3, 8) == 0b10110111u);
+
+    BOOST_CHECK_THROW((void)extractBitField(bytes, 0, 0), std::invalid_argument);
+    BOOST_CHECK_THROW((void)extractBitField(bytes, 0, 65), std::invalid_argument);
+    BOOST_CHECK_THROW((void)extractBitField(bytes, 8 * bytes.size() - 3, 4), std::invalid_argument);
+    BOOST_CHECK_THROW(insertBitField(bytes, 8 * bytes.size() - 3, 4, 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Test13_simdKernels)
+{
+    using Bytes::bitsetFromBytes;
+    using Bytes::bytesFromBitset;
+    using Bytes::decodeUInt32BE;
+    using Bytes::encodeUInt32BE;
+    using Bytes::findMismatch;
+
+    const std::string_view target = Bytes::simdKernelTarget();
+
+    BOOST_CHECK(target == "avx512bw" || target == "avx2" || target == "sse2" || target == "generic");
+
+    //Cover all vector widths plus remainders handled by the narrower kernels
+
+    for (std::size_t numBytes = 0; numBytes <= 200; ++numBytes)
+    {
+        std::vector<std::uint8_t> bytes(numBytes);
+        for (std::size_t i = 0; i < numBytes; ++i)
+            bytes[i] = static_cast<std::uint8_t>(37 * i + 11);
+
+        const boost::dynamic_bitset<> bits = bitsetFromBytes(bytes, 8 * numBytes);
+
+        bool bitsMatch = true;
+        for (std::size_t i = 0; i < 8 * numBytes; ++i)
+            bitsMatch = bitsMatch && (bits[i] == (((bytes[numBytes - 1 - i / 8] >> (i % 8)) & 1u) != 0));
+
+        BOOST_CHECK(bitsMatch);
+        BOOST_CHECK_EQUAL(bytesFromBitset(bits, numBytes), bytes);
+
+        BOOST_CHECK_EQUAL(findMismatch(bytes, bytes), numBytes);
+
+        for (std::size_t i = 0; i < numBytes; ++i)
+        {
+            std::vector<std::uint8_t> changed = bytes;
+            changed[i] ^= 0x80u;
+            changed.back() ^= 0x01u;
+
+            BOOST_CHECK_EQUAL(findMismatch(bytes, changed), i);
+        }
+
+        const std::size_t numWords = numBytes / 4;
+
+        std::vector<std::uint32_t> words(numWords);
+        decodeUInt32BE(std::span<const std::uint8_t>(bytes).first(4 * numWords), words);
+
+        bool wordsMatch = true;
+        for (std::size_t i = 0; i < numWords; ++i)
+            wordsMatch = wordsMatch && (words[i] == Bytes::composeUInt32(std::span<const std::uint8_t, 4>(bytes.data() + 4 * i, 4)));
+
+        BOOST_CHECK(wordsMatch);
+
+        std::vector<std::uint8_t> encoded(4 * numWords);
+        encodeUInt32BE(words, encoded);
+        BOOST_CHECK_EQUAL(encoded, std::vector<std::uint8_t>(bytes.begin(), bytes.begin() + 4 * numWords));
+    }
+
+    BOOST_CHECK_THROW(findMismatch(std::vector<std::uint8_t>(3), std::vector<std::uint8_t>(4)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Test14_smallByteVec)
+{
+    using Bytes::SmallByteVec;
+
+    const SmallByteVec empty;
+
+    BOOST_CHECK(empty.empty());
+    BOOST_CHECK(empty.isInline());
+    BOOST_CHECK_EQUAL(empty.capacity(), SmallByteVec::inlineCapacity);
+
+    //Short sequences are stored inline and can be used as spans
+
+    SmallByteVec bytes {0x12, 0x34, 0x56};
+
+    BOOST_CHECK(bytes.isInline());
+    BOOST_CHECK_EQUAL(bytes.size(), 3);
+    BOOST_CHECK_EQUAL(Bytes::extractBitField(bytes, 4, 16), 0x2345u);
+
+    Bytes::insertBitField(bytes, 4, 16, 0xABCDu);
+
+    BOOST_CHECK(bytes == (SmallByteVec{0x1A, 0xBC, 0xD6}));
+    BOOST_CHECK_EQUAL(bytes.toVector(), (std::vector<std::uint8_t>{0x1A, 0xBC, 0xD6}));
+
+    bytes.resize(5, 0xFF);
+
+    BOOST_CHECK_EQUAL(bytes.toVector(), (std::vector<std::uint8_t>{0x1A, 0xBC, 0xD6, 0xFF, 0xFF}));
+
+    //Growing beyond the inline capacity moves the bytes to the heap
+
+    std::vector<std::uint8_t> longBytes(SmallByteVec::inlineCapacity + 1);
+    for (std::size_t i = 0; i < longBytes.size(); ++i)
+        longBytes[i] = static_cast<std::uint8_t>(i);
+
+    SmallByteVec grown(std::span<const std::uint8_t>(longBytes).first(4));
+    grown.resize(longBytes.size());
+    std::copy(longBytes.begin(), longBytes.end(), grown.begin());
+
+    BOOST_CHECK(!grown.isInline());
+    BOOST_CHECK(grown.capacity() >= longBytes.size());
+    BOOST_CHECK_EQUAL(grown.toVector(), longBytes);
+
+    //Copies are independent, moves take over the heap memory
+
+    SmallByteVec copy = grown;
+    copy[0] = 0xAA;
+
+    BOOST_CHECK_EQUAL(grown[0], 0x00);
+    BOOST_CHECK_EQUAL(copy[0], 0xAA);
+
+    const std::uint8_t* const grownData = grown.data();
+
+    const SmallByteVec moved = std::move(grown);
+
+    BOOST_CHECK(moved.data() == grownData);
+    BOOST_CHECK(grown.empty());     // cppcheck-suppress accessMoved
+    BOOST_CHECK(grown.isInline());
+
+    SmallByteVec movedInline;
+    movedInline = SmallByteVec(3, 0x42);
+
+    BOOST_CHECK(movedInline.isInline());
+    BOOST_CHECK(movedInline == (SmallByteVec{0x42, 0x42, 0x42}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -25,6 +25,8 @@
 
 #include <casil/logger.h>
 
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 using casil::HL::LoggingDriver;
@@ -38,6 +40,14 @@ LoggingDriver::LoggingDriver(std::string pName, InterfaceBaseType& pInterface, L
 {
 }
 
+//Public
+
+void LoggingDriver::logRepeatedly(const int pCount) const
+{
+    for (int i = 0; i < pCount; ++i)
+        logger.logRateLimited(Logger::LogLevel::Warning, "This is a rate-limited test message! ({})", i);
+}
+
 //Private
 
 bool LoggingDriver::initImpl()
@@ -53,6 +63,9 @@ bool LoggingDriver::initImpl()
     logger.logDebugDebug("This is not a regular log but just a test message! (9)");
     logger.log("This is not a regular log but just a test message! (10)", Logger::LogLevel::Info);
     logger.log("This is not a regular log but just a test message! (11)", Logger::LogLevel::None);
+    logger.logInfo("This is a formatted test message! ({}, {})", 12, std::string("twelve"));
+    logger.log(Logger::LogLevel::Debug, "This is a formatted test message! ({})", 13);
+    logger.logLazy(Logger::LogLevel::Verbose, []() -> std::string { return "This is a lazy test message! (14)"; });
     return true;
 }
 
@@ -61,5 +74,7 @@ bool LoggingDriver::closeImpl()
     logger.log("This is not an error but yet another a test message! (0)", Logger::LogLevel::Error);
     logger.logError("This is not an error but yet another a test message! (1)");
     logger.logCritical("This is not an error but yet another a test message! (2)");
+    logger.logLazy(Logger::LogLevel::Error, []() -> std::string { throw std::runtime_error("Filtered message was generated."); });
+    logger.logError("This is not an error but yet another formatted test message! ({})", 3);
     return true;
 }
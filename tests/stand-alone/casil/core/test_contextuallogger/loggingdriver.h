@@ -42,6 +42,8 @@ class LoggingDriver final : public DirectDriver
 public:
     LoggingDriver(std::string pName, InterfaceBaseType& pInterface, LayerConfig pConfig);
     ~LoggingDriver() override = default;
+    //
+    void logRepeatedly(int pCount) const;
 
 private:
     bool initImpl() override;
@@ -21,11 +21,22 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////
 */
 
+#include "loggingdriver.h"
+
+#include <casil/contextuallogger.h>
 #include <casil/device.h>
 #include <casil/logger.h>
+#include <casil/TL/directinterface.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 
 //
 
@@ -69,10 +80,170 @@ BOOST_AUTO_TEST_CASE(Test1_context)
     BOOST_CHECK(testStr.find("HL/Logging-Driver/\"someDriverName\": This is not a regular log but just a test message! (9)") != testStr.npos);
     BOOST_CHECK(testStr.find("HL/Logging-Driver/\"someDriverName\": This is not a regular log but just a test message! (10)") != testStr.npos);
     BOOST_CHECK(testStr.find("HL/Logging-Driver/\"someDriverName\": This is not a regular log but just a test message! (11)") == testStr.npos);
+    BOOST_CHECK(testStr.find("HL/Logging-Driver/\"someDriverName\": This is a formatted test message! (12, twelve)") != testStr.npos);
+    BOOST_CHECK(testStr.find("HL/Logging-Driver/\"someDriverName\": This is a formatted test message! (13)") != testStr.npos);
+    BOOST_CHECK(testStr.find("HL/Logging-Driver/\"someDriverName\": This is a lazy test message! (14)") != testStr.npos);
 
     BOOST_CHECK(testStr.find("HL/Logging-Driver/\"someDriverName\": This is not an error but yet another a test message! (0)") == testStr.npos);
     BOOST_CHECK(testStr.find("HL/Logging-Driver/\"someDriverName\": This is not an error but yet another a test message! (1)") == testStr.npos);
     BOOST_CHECK(testStr.find("HL/Logging-Driver/\"someDriverName\": This is not an error but yet another a test message! (2)") != testStr.npos);
+    BOOST_CHECK(testStr.find("HL/Logging-Driver/\"someDriverName\": This is not an error but yet another formatted test message! (3)") == testStr.npos);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_rateLimited)
+{
+    std::ostringstream logOutputStrm;
+
+    using casil::Logger;
+    Logger::addOutput(logOutputStrm);
+    Logger::setLogLevel(Logger::LogLevel::Warning);
+
+    casil::Device exampleDev("{transfer_layer: [{name: intf, type: DummyInterface}],"
+                              "hw_drivers: [{name: someDriverName, type: Logging-Driver, interface: intf}],"
+                              "registers: []}");
+
+    const casil::HL::LoggingDriver& driver = dynamic_cast<const casil::HL::LoggingDriver&>(exampleDev.driver("someDriverName"));
+
+    driver.logRepeatedly(5);
+
+    std::this_thread::sleep_for(casil::ContextualLogger::rateLimitInterval + std::chrono::milliseconds(100));
+
+    driver.logRepeatedly(1);
+
+    Logger::setLogLevel(Logger::LogLevel::Critical);
+    Logger::removeOutput(logOutputStrm);
+
+    const std::string testStr = logOutputStrm.str();
+
+    BOOST_CHECK(testStr.find("This is a rate-limited test message! (0)\n") != testStr.npos);
+    BOOST_CHECK(testStr.find("This is a rate-limited test message! (1)") == testStr.npos);
+    BOOST_CHECK(testStr.find("This is a rate-limited test message! (4)") == testStr.npos);
+    BOOST_CHECK(testStr.find("This is a rate-limited test message! (0) (4 similar messages suppressed)\n") != testStr.npos);
+    BOOST_CHECK_EQUAL(std::count(testStr.begin(), testStr.end(), '\n'), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Test3_levelOverrides)
+{
+    std::ostringstream logOutputStrm;
+
+    using casil::ContextualLogger;
+    using casil::Logger;
+
+    Logger::addOutput(logOutputStrm);
+    Logger::setLogLevel(Logger::LogLevel::Info);
+
+    BOOST_CHECK_THROW(casil::Device("{transfer_layer: [{name: intf, type: DummyInterface, log_level: Loud}],"
+                                    "hw_drivers: [], registers: []}"), std::runtime_error);
+
+    casil::Device dev("{transfer_layer: [{name: intf1, type: DummyInterface, log_level: Debug},"
+                                        "{name: intf2, type: DummyInterface}],"
+                       "hw_drivers: [], registers: []}");
+
+    BOOST_CHECK(dev.interface("intf1").getLogLevel() == Logger::LogLevel::Debug);
+    BOOST_CHECK(!dev.interface("intf2").getLogLevel().has_value());
+
+    auto countWrites = [&logOutputStrm](const std::string& pName) -> std::size_t
+    {
+        const std::string output = logOutputStrm.str();
+        const std::string pattern = "TL/DummyInterface/\"" + pName + "\": write()";
+
+        std::size_t count = 0;
+        for (std::size_t pos = output.find(pattern); pos != std::string::npos; pos = output.find(pattern, pos + 1))
+            ++count;
+
+        return count;
+    };
+
+    dynamic_cast<casil::TL::DirectInterface&>(dev.interface("intf1")).write({0x01});
+    dynamic_cast<casil::TL::DirectInterface&>(dev.interface("intf2")).write({0x02});
+
+    BOOST_CHECK_EQUAL(countWrites("intf1"), 1u);
+    BOOST_CHECK_EQUAL(countWrites("intf2"), 0u);
+
+    //Type override applies to components without own override
+
+    ContextualLogger::setTypeLevelOverride("DummyInterface", Logger::LogLevel::Debug);
+    dev.interface("intf1").setLogLevel(Logger::LogLevel::Error);
+
+    BOOST_CHECK(ContextualLogger::getTypeLevelOverride("DummyInterface") == Logger::LogLevel::Debug);
+
+    dynamic_cast<casil::TL::DirectInterface&>(dev.interface("intf1")).write({0x01});
+    dynamic_cast<casil::TL::DirectInterface&>(dev.interface("intf2")).write({0x02});
+
+    BOOST_CHECK_EQUAL(countWrites("intf1"), 1u);
+    BOOST_CHECK_EQUAL(countWrites("intf2"), 1u);
+
+    //Removing overrides restores the global log level
+
+    ContextualLogger::setTypeLevelOverride("DummyInterface", std::nullopt);
+    dev.interface("intf1").setLogLevel(std::nullopt);
+
+    BOOST_CHECK(!ContextualLogger::getTypeLevelOverride("DummyInterface").has_value());
+
+    dynamic_cast<casil::TL::DirectInterface&>(dev.interface("intf1")).write({0x01});
+    dynamic_cast<casil::TL::DirectInterface&>(dev.interface("intf2")).write({0x02});
+
+    BOOST_CHECK_EQUAL(countWrites("intf1"), 1u);
+    BOOST_CHECK_EQUAL(countWrites("intf2"), 1u);
+
+    //Silent dummy components never log but can simulate transfer latency
+
+    casil::Device silentDev("{transfer_layer: [{name: intf3, type: DummyInterface, log_level: Debug, silent: true, latency: 2000}],"
+                             "hw_drivers: [], registers: []}");
+
+    const auto writeStart = std::chrono::steady_clock::now();
+
+    dynamic_cast<casil::TL::DirectInterface&>(silentDev.interface("intf3")).write({0x03});
+
+    BOOST_CHECK(std::chrono::steady_clock::now() - writeStart >= std::chrono::microseconds(2000));
+    BOOST_CHECK_EQUAL(countWrites("intf3"), 0u);
+
+    Logger::removeOutput(logOutputStrm);
+}
+
+BOOST_AUTO_TEST_CASE(Test4_separatePrefix)
+{
+    std::ostringstream logOutputStrm;
+
+    using casil::ContextualLogger;
+    using casil::Logger;
+
+    Logger::addOutput(logOutputStrm);
+    Logger::setLogLevel(Logger::LogLevel::Info);
+
+    casil::Device dev("{transfer_layer: [{name: intf, type: DummyInterface}], hw_drivers: [], registers: []}");
+
+    const ContextualLogger logger(dev.interface("intf"));
+
+    //Messages need not be null-terminated
+
+    const std::string text = "First message|Second message";
+    const std::string_view message(text.data(), 13);
+
+    logger.logInfo(message);
+    logger.logWarning("Formatted message {}", 1);
+    logger.logDebug("Filtered message");
+
+    //Prefix must also be prepended for the asynchronous backend
+
+    Logger::enableAsync(16, Logger::OverflowPolicy::Block);
+
+    logger.logInfo(std::string_view(text).substr(14));
+    logger.logError("Formatted message {}", 2);
+
+    Logger::disableAsync();
+
+    Logger::setLogLevel(Logger::LogLevel::Critical);
+    Logger::removeOutput(logOutputStrm);
+
+    const std::string testStr = logOutputStrm.str();
+
+    BOOST_CHECK(testStr.find("TL/DummyInterface/\"intf\": First message\n") != testStr.npos);
+    BOOST_CHECK(testStr.find("TL/DummyInterface/\"intf\": Formatted message 1\n") != testStr.npos);
+    BOOST_CHECK(testStr.find("TL/DummyInterface/\"intf\": Second message\n") != testStr.npos);
+    BOOST_CHECK(testStr.find("TL/DummyInterface/\"intf\": Formatted message 2\n") != testStr.npos);
+    BOOST_CHECK(testStr.find("Filtered message") == testStr.npos);
+    BOOST_CHECK_EQUAL(std::count(testStr.begin(), testStr.end(), '\n'), 4);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -22,16 +22,31 @@
 */
 
 #include <casil/device.h>
+#include <casil/interfaceregistry.h>
 #include <casil/layerbase.h>
+#include <casil/HL/registerdriver.h>
+#include <casil/RL/standardregister.h>
 #include <casil/TL/directinterface.h>
+#include <casil/TL/muxedinterface.h>
+#include <casil/TL/Muxed/simmuxed.h>
 
+#include <boost/property_tree/ptree.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 using casil::Device;
+using casil::TL::MuxedInterface;
 
 //
 
@@ -134,6 +149,12 @@ BOOST_AUTO_TEST_CASE(Test3_subscriptOperator)
     BOOST_CHECK(&(exampleDev.reg("reg1")) == &(exampleDev["reg1"]));
     BOOST_CHECK(&(exampleDev.reg("reg2")) == &(exampleDev["reg2"]));
 
+    //Existing components from the wrong layer
+    BOOST_CHECK_THROW(exampleDev.interface("drv1"), std::invalid_argument);
+    BOOST_CHECK_THROW(exampleDev.driver("reg1"), std::invalid_argument);
+    BOOST_CHECK_THROW(exampleDev.reg("intf1"), std::invalid_argument);
+    BOOST_CHECK_THROW(exampleDev["intf"], std::invalid_argument);
+
     exampleDev.close();
 }
 
@@ -360,6 +381,545 @@ BOOST_AUTO_TEST_CASE(Test7_runtimeConfiguration)
     BOOST_CHECK(exampleDev.loadRuntimeConfiguration({{"runtimeDrv", "{some_number: 0}"},
                                                      {"reg2", "{init: "}        //Fails because of invalid YAML code for existing component
                                                     }) == false);
+
+    //Configuration trees skip the YAML round trip
+
+    boost::property_tree::ptree numberTree;
+    numberTree.put("some_number", 42);
+
+    BOOST_CHECK(exampleDev.loadRuntimeConfigurationTrees({{"runtimeDrv", numberTree}, {"notAValidComponent", {}}}) == true);
+    BOOST_CHECK_EQUAL(exampleDev.dumpRuntimeConfiguration().at("runtimeDrv"), "some_number: 42");
+
+    numberTree.put("some_number", "abc");
+
+    BOOST_CHECK(exampleDev.loadRuntimeConfigurationTrees({{"runtimeDrv", numberTree}}) == false);     //Conversion error
+    BOOST_CHECK(exampleDev["reg2"].loadRuntimeConfiguration(boost::property_tree::ptree()) == true);
+}
+
+BOOST_AUTO_TEST_CASE(Test8_runParallel)
+{
+    Device exampleDev("{transfer_layer: [{name: intf1, type: DummyInterface},"
+                                        "{name: intf2, type: DummyInterface}],"
+                       "hw_drivers: [{name: drv1, type: DummyDriver, interface: intf1},"
+                                    "{name: drv2, type: DummyDriver, interface: intf1},"
+                                    "{name: drv3, type: DummyDriver, interface: intf2}],"
+                       "registers: []}");
+
+    std::map<std::string, std::thread::id> threadIds;
+    std::mutex threadIdsMutex;
+
+    std::atomic_bool drv3Running(false);
+    std::atomic_bool drv1SawDrv3(false);
+
+    auto recordThread = [&threadIds, &threadIdsMutex](const casil::HL::Driver& pDriver)
+    {
+        const std::lock_guard<std::mutex> threadIdsLock(threadIdsMutex);
+        threadIds[pDriver.getName()] = std::this_thread::get_id();
+    };
+
+    exampleDev.runParallel({{"drv1", [&](casil::HL::Driver& pDriver)
+                                     {
+                                         recordThread(pDriver);
+
+                                         //Operation on other interface must be able to run concurrently
+                                         const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+                                         while (!drv3Running.load() && std::chrono::steady_clock::now() < deadline)
+                                             std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+                                         drv1SawDrv3.store(drv3Running.load());
+                                     }},
+                            {"drv2", recordThread},
+                            {"drv3", [&](casil::HL::Driver& pDriver)
+                                     {
+                                         recordThread(pDriver);
+                                         drv3Running.store(true);
+                                     }}});
+
+    BOOST_CHECK(drv1SawDrv3.load());
+
+    BOOST_REQUIRE_EQUAL(threadIds.size(), 3);
+    BOOST_CHECK(threadIds["drv1"] == threadIds["drv2"]);
+    BOOST_CHECK(threadIds["drv1"] != threadIds["drv3"]);
+
+    BOOST_CHECK_NO_THROW(exampleDev.runParallel({}));
+
+    //Unknown driver: nothing is run
+
+    bool ran = false;
+
+    BOOST_CHECK_THROW(exampleDev.runParallel({{"drv1", [&ran](casil::HL::Driver&){ ran = true; }},
+                                              {"intf1", [&ran](casil::HL::Driver&){ ran = true; }}}),
+                      std::invalid_argument);
+    BOOST_CHECK(ran == false);
+
+    //Failing operations do not stop the others
+
+    std::atomic_int numRun(0);
+
+    BOOST_CHECK_THROW(exampleDev.runParallel({{"drv1", [&numRun](casil::HL::Driver&){ ++numRun; throw std::runtime_error("fail"); }},
+                                              {"drv2", [&numRun](casil::HL::Driver&){ ++numRun; }},
+                                              {"drv3", [&numRun](casil::HL::Driver&){ ++numRun; throw std::runtime_error("fail"); }}}),
+                      std::runtime_error);
+    BOOST_CHECK_EQUAL(numRun.load(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(Test9_initParallel)
+{
+    Device exampleDev("{transfer_layer: [{name: intf1, type: DummyInterface},"
+                                        "{name: intf2, type: DummyInterface}],"
+                       "hw_drivers: [{name: drv1, type: DummyDriver, interface: intf1},"
+                                    "{name: drv2, type: test_driver, interface: intf2}],"   //Using TestDriver from TemplateDevice test
+                       "registers: [{name: reg1, type: DummyRegister, hw_driver: drv1},"
+                                   "{name: reg2, type: DummyRegister, hw_driver: drv2}]}");
+
+    BOOST_CHECK(exampleDev.initParallel());
+    BOOST_CHECK(exampleDev.initParallel(false));
+    BOOST_CHECK(exampleDev.initParallel(true));
+    BOOST_CHECK(exampleDev.init());
+
+    BOOST_CHECK(exampleDev.closeParallel());
+    BOOST_CHECK(exampleDev.closeParallel(false));
+    BOOST_CHECK(exampleDev.closeParallel(true));
+
+    BOOST_CHECK(exampleDev.initParallel());
+    BOOST_CHECK(exampleDev.close());
+
+    Device emptyDev("{transfer_layer: [], hw_drivers: [], registers: []}");
+
+    BOOST_CHECK(emptyDev.initParallel());
+    BOOST_CHECK(emptyDev.closeParallel());
+
+    //Failing branch: other branch gets rolled back
+
+    Device failingDev("{transfer_layer: [{name: intf1, type: DummyInterface},"
+                                        "{name: intf2, type: TCP, init: {address: 127.0.0.1, port: 10355, read_termination: \"\\n\"}}],"
+                      "hw_drivers: [{name: drv1, type: DummyDriver, interface: intf1}],"
+                      "registers: [{name: reg1, type: DummyRegister, hw_driver: drv1}]}");
+
+    BOOST_CHECK(failingDev.initParallel() == false);
+    BOOST_CHECK(failingDev.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test10_runtimeSnapshot)
+{
+    Device exampleDev("{transfer_layer: [{name: intf1, type: DummyInterface}],"
+                       "hw_drivers: [{name: drv1, type: DummyDriver, interface: intf1},"
+                                    "{name: runtimeDrv, type: RTConfDrv, interface: intf1}],"
+                       "registers: [{name: reg1, type: DummyRegister, hw_driver: drv1},"
+                                   "{name: reg2, type: DummyRegister, hw_driver: runtimeDrv}]}");
+
+    BOOST_REQUIRE(exampleDev.init());
+
+    BOOST_CHECK(exampleDev.loadRuntimeConfiguration({{"runtimeDrv", "{some_number: 54156}"}}) == true);
+
+    const std::vector<std::uint8_t> snapshot = exampleDev.dumpRuntimeSnapshot();
+
+    BOOST_REQUIRE_GE(snapshot.size(), 16u);
+    BOOST_CHECK_EQUAL(snapshot.size() % 8, 0u);
+    BOOST_CHECK_EQUAL(std::string(snapshot.begin(), snapshot.begin() + 8), "CASILSNP");
+    BOOST_CHECK_EQUAL(snapshot[8], 1);      //Version
+    BOOST_CHECK_EQUAL(snapshot[12], 1);     //Only one non-empty component section
+
+    BOOST_CHECK(exampleDev.loadRuntimeConfiguration({{"runtimeDrv", "{some_number: 0}"}}) == true);
+    BOOST_CHECK_EQUAL(exampleDev.dumpRuntimeConfiguration().at("runtimeDrv"), "some_number: 0");
+
+    BOOST_CHECK(exampleDev.loadRuntimeSnapshot(snapshot) == true);
+    BOOST_CHECK_EQUAL(exampleDev.dumpRuntimeConfiguration().at("runtimeDrv"), "some_number: 54156");
+
+    //Malformed snapshots are rejected as a whole
+
+    std::vector<std::uint8_t> badSnapshot = snapshot;
+    badSnapshot[0] = 'X';
+    BOOST_CHECK(exampleDev.loadRuntimeSnapshot(badSnapshot) == false);
+
+    badSnapshot = snapshot;
+    badSnapshot[8] = 2;
+    BOOST_CHECK(exampleDev.loadRuntimeSnapshot(badSnapshot) == false);
+
+    BOOST_CHECK(exampleDev.loadRuntimeSnapshot(std::span(snapshot).first(snapshot.size() - 9)) == false);
+    BOOST_CHECK(exampleDev.loadRuntimeSnapshot({}) == false);
+
+    BOOST_CHECK_EQUAL(exampleDev.dumpRuntimeConfiguration().at("runtimeDrv"), "some_number: 54156");
+
+    //Single components
+
+    const std::vector<std::uint8_t> drvSnapshot = exampleDev["runtimeDrv"].dumpRuntimeSnapshot();
+
+    BOOST_CHECK(exampleDev["runtimeDrv"].loadRuntimeConfiguration("{some_number: 1}") == true);
+    BOOST_CHECK(exampleDev["runtimeDrv"].loadRuntimeSnapshot(drvSnapshot) == true);
+    BOOST_CHECK_EQUAL(exampleDev["runtimeDrv"].dumpRuntimeConfiguration(), "some_number: 54156");
+
+    BOOST_CHECK(exampleDev["runtimeDrv"].loadRuntimeSnapshot(std::span(drvSnapshot).first(drvSnapshot.size() - 1)) == false);
+
+    BOOST_CHECK(exampleDev["reg1"].dumpRuntimeSnapshot().empty());
+    BOOST_CHECK(exampleDev["reg1"].loadRuntimeSnapshot({}) == true);
+}
+
+BOOST_AUTO_TEST_CASE(Test11_lazyConstruction)
+{
+    const std::string conf = "{transfer_layer: [{name: intf1, type: DummyInterface},"
+                                               "{name: intf2, type: DummyInterface}],"
+                              "hw_drivers: [{name: drv1, type: DummyDriver, interface: intf1},"
+                                           "{name: drv2, type: DummyDriver, interface: intf2},"
+                                           "{name: runtimeDrv, type: RTConfDrv, interface: intf2}],"
+                              "registers: [{name: reg1, type: DummyRegister, hw_driver: drv1},"
+                                          "{name: reg2, type: DummyRegister, hw_driver: drv2}]}";
+
+    Device eagerDev(conf);
+
+    BOOST_CHECK(eagerDev.isConstructed("reg1"));
+    BOOST_CHECK(eagerDev.isConstructed("intf2"));
+    BOOST_CHECK(eagerDev.isConstructed("foo") == false);
+
+    Device lazyDev(conf, true);
+
+    BOOST_CHECK(lazyDev.isConstructed("intf1") == false);
+    BOOST_CHECK(lazyDev.isConstructed("reg1") == false);
+
+    BOOST_REQUIRE(lazyDev.init());
+
+    //Accessing a register constructs (and initializes) it together with its driver and interface
+
+    BOOST_CHECK_EQUAL(lazyDev.reg("reg1").getName(), "reg1");
+
+    BOOST_CHECK(lazyDev.isConstructed("reg1"));
+    BOOST_CHECK(lazyDev.isConstructed("drv1"));
+    BOOST_CHECK(lazyDev.isConstructed("intf1"));
+    BOOST_CHECK(lazyDev.isConstructed("intf2") == false);
+    BOOST_CHECK(lazyDev.isConstructed("drv2") == false);
+    BOOST_CHECK(lazyDev.isConstructed("reg2") == false);
+
+    BOOST_CHECK(&(lazyDev["drv1"]) == &(lazyDev.driver("drv1")));
+
+    BOOST_CHECK_THROW(lazyDev.driver("reg2"), std::invalid_argument);  //Constructed, but wrong layer
+    BOOST_CHECK(lazyDev.isConstructed("reg2"));
+    BOOST_CHECK_THROW(lazyDev["foo"], std::invalid_argument);
+
+    //Runtime configuration constructs referred components
+
+    BOOST_CHECK(lazyDev.dumpRuntimeConfiguration().empty());
+    BOOST_CHECK(lazyDev.loadRuntimeConfiguration({{"runtimeDrv", "{some_number: 7}"}}) == true);
+    BOOST_CHECK(lazyDev.isConstructed("runtimeDrv"));
+    BOOST_CHECK_EQUAL(lazyDev.dumpRuntimeConfiguration().at("runtimeDrv"), "some_number: 7");
+
+    BOOST_CHECK(lazyDev.close());
+
+    //Configuration errors are still detected on construction
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf1, type: DummyInterface}],"
+                             "hw_drivers: [{name: drv1, type: DummyDriver, interface: intf2}], registers: []}", true),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf1, type: DummyInterface}],"
+                             "hw_drivers: [{name: drv1, type: DummyDriver, interface: intf1}],"
+                             "registers: [{name: reg1, type: DummyRegister, hw_driver: intf1}]}", true),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf1, type: DummyInterface}],"
+                             "hw_drivers: [{name: intf1, type: DummyDriver, interface: intf1}], registers: []}", true),
+                      std::runtime_error);
+
+    //Construction errors are reported on access
+
+    Device badDev("{transfer_layer: [{name: intf1, type: NoSuchInterfaceType}], hw_drivers: [], registers: []}", true);
+
+    BOOST_CHECK_THROW(badDev.interface("intf1"), std::runtime_error);
+    BOOST_CHECK(badDev.isConstructed("intf1") == false);
+}
+
+BOOST_AUTO_TEST_CASE(Test12_reconfigure)
+{
+    Device dev("{transfer_layer: [{name: intf1, type: DummyInterface},"
+                                 "{name: intf2, type: DummyInterface},"
+                                 "{name: sim, type: SimMuxed, init: {mem_size: 16, seed: 3}}],"
+               "hw_drivers: [{name: drv1, type: RTConfDrv, interface: intf1},"
+                            "{name: drv2, type: RTConfDrv, interface: intf2}],"
+               "registers: [{name: reg1, type: DummyRegister, hw_driver: drv1},"
+                           "{name: reg2, type: DummyRegister, hw_driver: drv2}]}");
+
+    BOOST_REQUIRE(dev.init());
+
+    auto setMarkers = [&dev]() -> void
+    {
+        BOOST_REQUIRE(dev.loadRuntimeConfiguration({{"drv1", "{some_number: 1}"}, {"drv2", "{some_number: 2}"}}));
+    };
+
+    //Rebuilt drivers lose their runtime configuration, which is used to detect rebuilt components
+    auto rebuilt = [&dev](const std::string& pDriverName) -> bool
+    {
+        return dev.dumpRuntimeConfiguration().at(pDriverName) == "some_number: 123";
+    };
+
+    setMarkers();
+
+    const casil::TL::Interface* const intf2 = &dev.interface("intf2");
+    const casil::RL::Register* const reg2 = &dev.reg("reg2");
+
+    //Unchanged configuration does not rebuild anything
+
+    BOOST_CHECK(dev.reconfigure("{hw_drivers: [{name: drv1, interface: intf1}], registers: []}"));
+    BOOST_CHECK(!rebuilt("drv1"));
+    BOOST_CHECK(!rebuilt("drv2"));
+
+    //Changing an interface rebuilds its drivers (and their registers) but nothing else
+
+    BOOST_CHECK(dev.reconfigure("{transfer_layer: [{name: intf1, init: {foo: bar}}]}"));
+    BOOST_CHECK(rebuilt("drv1"));
+    BOOST_CHECK(!rebuilt("drv2"));
+    BOOST_CHECK(&dev.interface("intf2") == intf2);
+    BOOST_CHECK(&dev.reg("reg2") == reg2);
+    BOOST_CHECK_EQUAL(dev.reg("reg1").getName(), "reg1");
+
+    //Moving a driver to another interface and adding components
+
+    setMarkers();
+
+    BOOST_CHECK(dev.reconfigure("{hw_drivers: [{name: drv2, interface: intf1}],"
+                                "registers: [{name: reg3, type: DummyRegister, hw_driver: drv1}]}"));
+    BOOST_CHECK(!rebuilt("drv1"));
+    BOOST_CHECK(rebuilt("drv2"));
+    BOOST_CHECK_EQUAL(dev.reg("reg3").getName(), "reg3");
+    BOOST_CHECK_EQUAL(dev["reg2"].getName(), "reg2");
+
+    //Nested configuration maps are merged
+
+    BOOST_CHECK_THROW((void)dynamic_cast<MuxedInterface&>(dev.interface("sim")).read(32, 4), std::runtime_error);
+    BOOST_CHECK(dev.reconfigure("{transfer_layer: [{name: sim, init: {mem_size: 64}}]}"));
+    BOOST_CHECK(dynamic_cast<MuxedInterface&>(dev.interface("sim")).read(32, 4) == (std::vector<std::uint8_t>{0, 0, 0, 0}));
+
+    //Invalid configurations change nothing
+
+    setMarkers();
+
+    BOOST_CHECK_THROW(dev.reconfigure("{registers: [{type: DummyRegister, hw_driver: drv1}]}"), std::runtime_error);
+    BOOST_CHECK_THROW(dev.reconfigure("{registers: [{name: intf1, type: DummyRegister}]}"), std::runtime_error);
+    BOOST_CHECK_THROW(dev.reconfigure("{registers: [{name: reg9, type: DummyRegister}]}"), std::runtime_error);
+    BOOST_CHECK_THROW(dev.reconfigure("{registers: [{name: reg1, hw_driver: intf2}]}"), std::runtime_error);
+    BOOST_CHECK_THROW(dev.reconfigure("{hw_drivers: [{name: drv1, interface: intf2}, {name: drv1}]}"), std::runtime_error);
+
+    BOOST_CHECK(!rebuilt("drv1"));
+    BOOST_CHECK(!rebuilt("drv2"));
+
+    //Failed construction restores the previous configuration
+
+    BOOST_CHECK_THROW(dev.reconfigure("{transfer_layer: [{name: sim, init: {mem_size: 0}}]}"), std::runtime_error);
+    BOOST_CHECK(dynamic_cast<MuxedInterface&>(dev.interface("sim")).read(32, 4) == (std::vector<std::uint8_t>{0, 0, 0, 0}));
+
+    BOOST_CHECK_THROW(dev.reconfigure("{transfer_layer: [{name: intf3, type: DummyInterface}],"
+                                      "hw_drivers: [{name: drv2, type: FooDriver}]}"), std::runtime_error);
+    BOOST_CHECK_THROW(dev["intf3"], std::invalid_argument);
+    BOOST_CHECK_EQUAL(dev.driver("drv2").getType(), "RTConfDrv");
+    BOOST_CHECK_EQUAL(dev.reg("reg2").getName(), "reg2");
+
+    BOOST_CHECK(dev.close());
+
+    //Lazy construction defers rebuilding until the next access
+
+    Device lazyDev("{transfer_layer: [{name: intf1, type: DummyInterface}],"
+                   "hw_drivers: [{name: drv1, type: RTConfDrv, interface: intf1}],"
+                   "registers: [{name: reg1, type: DummyRegister, hw_driver: drv1}]}", true);
+
+    BOOST_CHECK_EQUAL(lazyDev.reg("reg1").getName(), "reg1");
+    BOOST_CHECK(lazyDev.isConstructed("drv1"));
+
+    BOOST_CHECK(lazyDev.reconfigure("{hw_drivers: [{name: drv1, init: {foo: 1}}]}"));
+    BOOST_CHECK(lazyDev.isConstructed("intf1"));
+    BOOST_CHECK(!lazyDev.isConstructed("drv1"));
+    BOOST_CHECK(!lazyDev.isConstructed("reg1"));
+    BOOST_CHECK_EQUAL(lazyDev.reg("reg1").getName(), "reg1");
+    BOOST_CHECK(lazyDev.isConstructed("drv1"));
+}
+
+BOOST_AUTO_TEST_CASE(Test13_postAsync)
+{
+    Device dev("{transfer_layer: [{name: intf1, type: DummyInterface},"
+                                 "{name: intf2, type: DummyInterface}],"
+                "hw_drivers: [{name: drv1, type: DummyDriver, interface: intf1},"
+                             "{name: drv2, type: DummyDriver, interface: intf2}],"
+                "registers: []}");
+
+    std::vector<int> order;
+    std::mutex orderMutex;
+    std::map<std::string, std::thread::id> threadIds;
+
+    auto append = [&order, &orderMutex](const int pValue)
+    {
+        const std::lock_guard<std::mutex> orderLock(orderMutex);
+        order.push_back(pValue);
+    };
+
+    //Tasks on the same interface run in submission order, whether posted via interface or driver
+
+    auto recordThread = [&threadIds, &orderMutex](const std::string& pName)
+    {
+        const std::lock_guard<std::mutex> orderLock(orderMutex);
+        threadIds[pName] = std::this_thread::get_id();
+    };
+
+    dev.interface("intf1").postAsync([&](){ recordThread("intf1"); append(1); });
+    dev.driver("drv1").postAsync([&append](){ append(2); });
+    dev.interface("intf1").postAsync([&append](){ append(3); });
+    dev.driver("drv2").postAsync([&recordThread](){ recordThread("intf2"); });
+
+    dev.waitAsync();
+
+    BOOST_CHECK(order == (std::vector<int>{1, 2, 3}));
+    BOOST_REQUIRE_EQUAL(threadIds.size(), 2);
+    BOOST_CHECK(threadIds["intf1"] != threadIds["intf2"]);
+    BOOST_CHECK(threadIds["intf1"] != std::this_thread::get_id());
+
+    //Executor stays usable after waiting
+
+    dev.driver("drv1").postAsync([&append](){ append(4); });
+    dev.interface("intf1").waitAsync();
+
+    BOOST_CHECK(order == (std::vector<int>{1, 2, 3, 4}));
+}
+
+BOOST_AUTO_TEST_CASE(Test14_groupInit)
+{
+    using casil::TL::SimMuxed;
+
+    Device dev("{transfer_layer: [{name: sim, type: SimMuxed, init: {mem_size: 256}}],"
+                "hw_drivers: [{name: gpio0, type: GPIO, interface: sim, base_addr: 0x00, size: 8},"
+                             "{name: gpio1, type: GPIO, interface: sim, base_addr: 0x20, size: 8},"
+                             "{name: gpio2, type: GPIO, interface: sim, base_addr: 0x40, size: 8},"
+                             "{name: gpio3, type: GPIO, interface: sim, base_addr: 0x60, size: 8}],"
+                "registers: []}");
+
+    const SimMuxed& sim = dynamic_cast<const SimMuxed&>(dev.interface("sim"));
+
+    BOOST_REQUIRE(dev.init());
+
+    //Resets and version reads of all four drivers are combined into one write and one read transaction
+
+    std::uint64_t transactions = sim.getStatistics().transactions;
+
+    BOOST_REQUIRE(dev.init(true));
+
+    const std::uint64_t groupTransactions = sim.getStatistics().transactions - transactions;
+
+    transactions = sim.getStatistics().transactions;
+
+    for (const std::string name : {"gpio0", "gpio1", "gpio2", "gpio3"})
+        BOOST_REQUIRE(dev.driver(name).init(true));
+
+    const std::uint64_t separateTransactions = sim.getStatistics().transactions - transactions;
+
+    BOOST_CHECK_EQUAL(separateTransactions - groupTransactions, 2 * 4 - 2);
+
+    BOOST_CHECK(dev.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test15_memoryReport)
+{
+    using casil::RL::StandardRegister;
+
+    Device dev("{transfer_layer: [{name: sim, type: SimMuxed, init: {mem_size: 256}}],"
+                "hw_drivers: [{name: gpio, type: GPIO, interface: sim, base_addr: 0x00, size: 16}],"
+                "registers: [{name: reg, type: StandardRegister, hw_driver: gpio, size: 16, fields: ["
+                                "{name: HIGH, offset: 15, size: 8},"
+                                "{name: LOW, offset: 7, size: 8}"
+                            "]}]}");
+
+    BOOST_REQUIRE(dev.init());
+
+    const std::map<std::string, std::map<std::string, std::size_t>> report = dev.getMemoryReport();
+
+    BOOST_REQUIRE(report.contains("sim"));
+    BOOST_REQUIRE(report.contains("gpio"));
+    BOOST_REQUIRE(report.contains("reg"));
+
+    for (const auto& [name, usage] : report)
+    {
+        BOOST_CHECK(usage.at("config") > 0);
+        BOOST_CHECK(usage.contains("strings"));
+    }
+
+    BOOST_CHECK(report.at("gpio").at("registers") > 0);
+    BOOST_CHECK(report.at("gpio").contains("shadow"));
+    BOOST_CHECK(report.at("reg").at("data") > 0);
+    BOOST_CHECK(report.at("reg").at("fields") > 0);
+    BOOST_CHECK(report.at("reg").at("field_layout") > 0);
+    BOOST_CHECK_EQUAL(report.at("reg").at("bit_proxies"), 0);
+
+    //Bit proxy references are created on first access
+
+    StandardRegister& reg = dynamic_cast<StandardRegister&>(dev.reg("reg"));
+
+    for (std::size_t i = 0; i < 8; ++i)
+        reg["HIGH"][i] = true;
+
+    BOOST_CHECK(reg.getMemoryUsage().at("bit_proxies") > 0);
+    BOOST_CHECK(reg.getMemoryUsage().at("fields") == report.at("reg").at("fields"));
+
+    //Proxy class instances of the driver likewise
+
+    const std::size_t proxyBytes = dev.driver("gpio").getMemoryUsage().at("proxies");
+
+    const std::vector<std::uint8_t> input = dynamic_cast<casil::HL::RegisterDriver&>(dev.driver("gpio"))["INPUT"];
+
+    BOOST_CHECK_EQUAL(input.size(), 2);
+
+    BOOST_CHECK(dev.driver("gpio").getMemoryUsage().at("proxies") > proxyBytes);
+
+    BOOST_CHECK(dev.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test16_sharedInterfaces)
+{
+    using casil::InterfaceRegistry;
+
+    const std::string intfConf = "{name: sim, type: SimMuxed, shared: test16_board, init: {mem_size: 256}}";
+
+    std::unique_ptr<Device> dev1 = std::make_unique<Device>("{transfer_layer: [" + intfConf + "],"
+                                                            "hw_drivers: [{name: gpio1, type: GPIO, interface: sim, base_addr: 0x00, size: 8}],"
+                                                            "registers: []}");
+    Device dev2("{transfer_layer: [" + intfConf + "],"
+                "hw_drivers: [{name: gpio2, type: GPIO, interface: sim, base_addr: 0x10, size: 8}],"
+                "registers: []}");
+
+    //Both devices use the same interface instance
+
+    BOOST_CHECK(&dev1->interface("sim") == &dev2.interface("sim"));
+    BOOST_CHECK_EQUAL(InterfaceRegistry::getNumLeases("test16_board"), 2);
+
+    //A different configuration for the same share key is rejected
+
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: sim, type: SimMuxed, shared: test16_board, init: {mem_size: 128}}],"
+                             "hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+
+    //Initializations are counted and the interface is only closed by the last device
+
+    BOOST_REQUIRE(dev1->init());
+    BOOST_REQUIRE(dev2.init());
+
+    BOOST_CHECK_EQUAL(InterfaceRegistry::getNumInitialized("test16_board"), 2);
+
+    dev1->driver("gpio1").setData({0x12});
+
+    BOOST_CHECK(dynamic_cast<MuxedInterface&>(dev2.interface("sim")).read(0x00 + 2, 1) == std::vector<std::uint8_t>{0x12});
+
+    BOOST_CHECK(dev1->close());
+
+    BOOST_CHECK_EQUAL(InterfaceRegistry::getNumInitialized("test16_board"), 1);
+
+    BOOST_CHECK(dev1->close(true));     //Forced close must not close the interface still used by dev2
+
+    BOOST_CHECK_EQUAL(InterfaceRegistry::getNumInitialized("test16_board"), 1);
+
+    dev2.driver("gpio2").setData({0x34});
+
+    BOOST_CHECK(dynamic_cast<MuxedInterface&>(dev2.interface("sim")).read(0x10 + 2, 1) == std::vector<std::uint8_t>{0x34});
+
+    //Interface stays alive until the last device is destroyed
+
+    dev1.reset();
+
+    BOOST_CHECK_EQUAL(InterfaceRegistry::getNumLeases("test16_board"), 1);
+
+    BOOST_CHECK(dev2.close());
+
+    BOOST_CHECK_EQUAL(InterfaceRegistry::getNumInitialized("test16_board"), 0);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,263 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/bytes.h>
+#include <casil/device.h>
+#include <casil/deviceserver.h>
+#include <casil/TL/muxedinterface.h>
+#include <casil/TL/CommonImpl/fifoshmwriter.h>
+#include <casil/TL/Muxed/remote.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using casil::Device;
+using casil::DeviceServer;
+using casil::TL::MuxedInterface;
+using casil::TL::Remote;
+using casil::TL::SiTCP;
+
+namespace boost { using casil::Bytes::operator<<; }
+
+namespace
+{
+
+std::string getSocketPath()
+{
+    return "/tmp/casil_test_deviceserver_" + std::to_string(::getpid()) + ".sock";
+}
+
+Device makeClientDevice(const std::string& pSocketPath, const std::string& pRemoteName)
+{
+    return Device("{transfer_layer: [{name: intf, type: Remote, init: {socket: \"" + pSocketPath + "\", interface: " + pRemoteName + "}}],"
+                  "hw_drivers: [], registers: []}");
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(DeviceServer_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_config)
+{
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: Remote, init: {socket: \"\", interface: intf}}], hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: Remote, init: {socket: /tmp/x, interface: \"\"}}], hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: Remote, init: {socket: /tmp/x}}], hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+    BOOST_CHECK_THROW(Device("{transfer_layer: [{name: intf, type: Remote, init: {socket: /tmp/x, interface: intf, timeout: -1}}],"
+                             "hw_drivers: [], registers: []}"),
+                      std::runtime_error);
+
+    BOOST_CHECK_NO_THROW(makeClientDevice("/tmp/x", "intf"));
+
+    //Connecting fails without server
+    Device client = makeClientDevice(getSocketPath() + ".none", "intf");
+    BOOST_CHECK(!client.init());
+}
+
+BOOST_AUTO_TEST_CASE(Test2_remoteAccess)
+{
+    Device server("{transfer_layer: [{name: sim, type: SimMuxed, init: {mem_size: 64}}, {name: direct, type: DummyInterface}],"
+                  "hw_drivers: [], registers: []}");
+
+    BOOST_REQUIRE(server.init());
+
+    DeviceServer deviceServer(server, getSocketPath());
+
+    BOOST_CHECK(!deviceServer.isRunning());
+    BOOST_REQUIRE(deviceServer.start());
+    BOOST_CHECK(deviceServer.isRunning());
+    BOOST_CHECK(deviceServer.start());
+
+    Device client1 = makeClientDevice(deviceServer.getSocketPath(), "sim");
+    Device client2 = makeClientDevice(deviceServer.getSocketPath(), "sim");
+
+    BOOST_REQUIRE(client1.init());
+    BOOST_REQUIRE(client2.init());
+
+    MuxedInterface& intf1 = dynamic_cast<MuxedInterface&>(client1.interface("intf"));
+    MuxedInterface& intf2 = dynamic_cast<MuxedInterface&>(client2.interface("intf"));
+
+    intf1.write(10, {1, 2, 3});
+    BOOST_CHECK_EQUAL(intf2.read(9, 5), (std::vector<std::uint8_t>{0, 1, 2, 3, 0}));
+    BOOST_CHECK_EQUAL(dynamic_cast<MuxedInterface&>(server.interface("sim")).read(10, 3), (std::vector<std::uint8_t>{1, 2, 3}));
+
+    BOOST_CHECK_EQUAL(intf2.query(20, 19, {4, 5}, 3), (std::vector<std::uint8_t>{0, 4, 5}));
+    BOOST_CHECK(intf1.readBufferEmpty());
+    BOOST_CHECK_NO_THROW(intf1.clearReadBuffer());
+
+    //Errors of the served interface are passed on to the client
+    BOOST_CHECK_THROW(intf1.read(62, 4), std::runtime_error);
+    BOOST_CHECK_THROW(intf1.write(64, {1}), std::runtime_error);
+
+    //Connection stays usable after errors
+    BOOST_CHECK_EQUAL(intf1.read(10, 1), (std::vector<std::uint8_t>{1}));
+
+    Device client3 = makeClientDevice(deviceServer.getSocketPath(), "none");
+    Device client4 = makeClientDevice(deviceServer.getSocketPath(), "direct");
+
+    BOOST_REQUIRE(client3.init());
+    BOOST_REQUIRE(client4.init());
+
+    BOOST_CHECK_THROW(dynamic_cast<MuxedInterface&>(client3.interface("intf")).read(0, 1), std::runtime_error);
+    BOOST_CHECK_THROW(dynamic_cast<MuxedInterface&>(client4.interface("intf")).read(0, 1), std::runtime_error);
+
+    //Metrics requests do not depend on the remote interface
+    const std::string metricsText = dynamic_cast<Remote&>(client3.interface("intf")).getServerMetrics();
+
+    BOOST_CHECK(metricsText.find("# TYPE casil_interface_written_bytes counter\n") != std::string::npos);
+    BOOST_CHECK(metricsText.ends_with("# EOF\n"));
+
+    const DeviceServer::Statistics stats = deviceServer.getStatistics();
+
+    BOOST_CHECK_EQUAL(stats.clientsAccepted, 4);
+    BOOST_CHECK_EQUAL(stats.requestsServed, 7);
+    BOOST_CHECK_EQUAL(stats.requestsFailed, 4);
+
+    deviceServer.stop();
+    BOOST_CHECK(!deviceServer.isRunning());
+
+    BOOST_CHECK_THROW(intf1.read(10, 1), std::runtime_error);
+
+    BOOST_CHECK(client1.close());
+    BOOST_CHECK_THROW(intf1.read(10, 1), std::runtime_error);
+
+    //Restarting the server and reconnecting works
+    BOOST_REQUIRE(deviceServer.start());
+    BOOST_REQUIRE(client1.init());
+    BOOST_CHECK_EQUAL(intf1.read(10, 3), (std::vector<std::uint8_t>{1, 2, 3}));
+
+    BOOST_CHECK(client2.close());
+    BOOST_CHECK(client3.close());
+    BOOST_CHECK(client4.close());
+    BOOST_CHECK(server.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test3_timeout)
+{
+    const std::string socketPath = getSocketPath() + ".stalled";
+
+    std::filesystem::remove(socketPath);
+
+    //Server socket that accepts connections (via the listen backlog) but never responds
+    boost::asio::io_context ioContext;
+    boost::asio::local::stream_protocol::acceptor acceptor(ioContext, boost::asio::local::stream_protocol::endpoint(socketPath));
+
+    Device client("{transfer_layer: [{name: intf, type: Remote, init: {socket: \"" + socketPath + "\", interface: sim, timeout: 0.2}}],"
+                  "hw_drivers: [], registers: []}");
+
+    BOOST_REQUIRE(client.init());
+
+    MuxedInterface& intf = dynamic_cast<MuxedInterface&>(client.interface("intf"));
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    BOOST_CHECK_THROW(intf.read(0, 1), std::runtime_error);
+
+    const auto duration = std::chrono::steady_clock::now() - startTime;
+
+    BOOST_CHECK(duration >= std::chrono::milliseconds(150));
+    BOOST_CHECK(duration < std::chrono::seconds(3));
+
+    //Connection is closed after a timeout
+    BOOST_CHECK_THROW(intf.read(0, 1), std::runtime_error);
+
+    BOOST_CHECK(client.close());
+
+    acceptor.close();
+    std::filesystem::remove(socketPath);
+}
+
+BOOST_AUTO_TEST_CASE(Test4_fifoShmRing)
+{
+    const std::string shmName = "casil_test_deviceserver_fifo_" + std::to_string(::getpid());
+
+    Device server("{transfer_layer: [{name: sim, type: SimMuxed, init: {mem_size: 64}}], hw_drivers: [], registers: []}");
+
+    BOOST_REQUIRE(server.init());
+
+    DeviceServer deviceServer(server, getSocketPath());
+
+    BOOST_REQUIRE(deviceServer.start());
+
+    Device client("{transfer_layer: [{name: intf, type: Remote, init: {socket: \"" + deviceServer.getSocketPath() + "\", interface: sim,"
+                                                                     "fifo_shm_name: " + shmName + "}}],"
+                  "hw_drivers: [], registers: []}");
+
+    MuxedInterface& intf = dynamic_cast<MuxedInterface&>(client.interface("intf"));
+
+    //Ring does not exist yet
+    BOOST_CHECK(!client.init());
+    BOOST_CHECK_THROW(intf.read(SiTCP::baseAddrDataLimit, -1), std::runtime_error);
+
+    //Publish like a served SiTCP interface with "init.fifo_shm_name"
+    casil::Layers::TL::CommonImpl::FIFOShmWriter writer(shmName, 8, 4);
+    writer.open();
+
+    BOOST_REQUIRE(client.init());
+
+    writer.write(std::vector<std::uint8_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13});
+
+    BOOST_CHECK_EQUAL(intf.read(SiTCP::baseAddrFIFOLimit + 1, 4), (std::vector<std::uint8_t>{12, 0, 0, 0}));
+    BOOST_CHECK_EQUAL(intf.read(SiTCP::baseAddrFIFOLimit + 1, 2), (std::vector<std::uint8_t>{0, 0}));
+    BOOST_CHECK_EQUAL(intf.read(SiTCP::baseAddrDataLimit, 7), (std::vector<std::uint8_t>{1, 2, 3, 4}));
+
+    writer.write(std::vector<std::uint8_t>{14, 15, 16});
+
+    BOOST_CHECK_EQUAL(intf.read(SiTCP::baseAddrDataLimit, -1), (std::vector<std::uint8_t>{5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}));
+    BOOST_CHECK_EQUAL(intf.read(SiTCP::baseAddrFIFOLimit + 1, 4), (std::vector<std::uint8_t>{0, 0, 0, 0}));
+
+    //FIFO reads do not involve the server, other reads are still forwarded
+    BOOST_CHECK_EQUAL(deviceServer.getStatistics().requestsServed, 0);
+    BOOST_CHECK_EQUAL(intf.read(0, 2), (std::vector<std::uint8_t>{0, 0}));
+    BOOST_CHECK_EQUAL(deviceServer.getStatistics().requestsServed, 1);
+
+    BOOST_CHECK(client.close());
+    BOOST_CHECK_THROW(intf.read(SiTCP::baseAddrDataLimit, -1), std::runtime_error);
+
+    writer.close();
+
+    BOOST_CHECK(server.close());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
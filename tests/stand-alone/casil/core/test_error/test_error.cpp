@@ -0,0 +1,127 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/device.h>
+#include <casil/error.h>
+#include <casil/TL/Muxed/simmuxed.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using casil::Error;
+using casil::Expected;
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(Error_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_expected)
+{
+    //Message is only formatted when requested
+
+    int formatCnt = 0;
+
+    const Error error(Error::Code::Timeout, [&formatCnt]() -> std::string { ++formatCnt; return "Formatted."; });
+
+    BOOST_CHECK(error.getCode() == Error::Code::Timeout);
+    BOOST_CHECK_EQUAL(formatCnt, 0);
+    BOOST_CHECK_EQUAL(error.getMessage(), "Formatted.");
+    BOOST_CHECK_EQUAL(formatCnt, 1);
+
+    BOOST_CHECK_EQUAL(Error(Error::Code::Protocol, "Static.").getMessage(), "Static.");
+
+    //Errors are raised as the exceptions of the corresponding throwing APIs
+
+    BOOST_CHECK_THROW(error.raise(), std::runtime_error);
+    BOOST_CHECK_THROW(Error(Error::Code::InvalidArgument, "Invalid.").raise(), std::invalid_argument);
+
+    const Expected<int> value = 42;
+    const Expected<int> failed = Error(Error::Code::Failure, "Failed.");
+
+    BOOST_CHECK(value.hasValue());
+    BOOST_CHECK_EQUAL(value.value(), 42);
+    BOOST_CHECK(!failed);
+    BOOST_CHECK(failed.error().getCode() == Error::Code::Failure);
+    BOOST_CHECK_THROW((void)failed.value(), std::runtime_error);
+
+    const Expected<void> done;
+    const Expected<void> notDone = Error(Error::Code::Timeout, "Timeout.");
+
+    BOOST_CHECK(done.hasValue());
+    BOOST_CHECK_NO_THROW(done.value());
+    BOOST_CHECK(!notDone);
+    BOOST_CHECK_THROW(notDone.value(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_tryInterfaceAccess)
+{
+    using casil::Device;
+    using casil::TL::SimMuxed;
+
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed, init: {mem_size: 16}}], hw_drivers: [], registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    SimMuxed& intf = dynamic_cast<SimMuxed&>(d.interface("intf"));
+
+    const std::vector<std::uint8_t> data = {1, 2, 3};
+
+    BOOST_CHECK(intf.tryWriteFrom(4, data).hasValue());
+
+    std::array<std::uint8_t, 3> buffer {};
+
+    const Expected<std::size_t> readBytes = intf.tryReadInto(4, buffer);
+
+    BOOST_REQUIRE(readBytes.hasValue());
+    BOOST_CHECK_EQUAL(readBytes.value(), 3);
+    BOOST_CHECK(std::vector<std::uint8_t>(buffer.begin(), buffer.end()) == data);
+
+    //Failures are returned instead of thrown
+
+    std::array<std::uint8_t, 8> largeBuffer {};
+
+    Expected<std::size_t> readFailed = 0;
+    BOOST_CHECK_NO_THROW(readFailed = intf.tryReadInto(12, largeBuffer));
+    BOOST_REQUIRE(!readFailed);
+    BOOST_CHECK(readFailed.error().getCode() == Error::Code::Failure);
+    BOOST_CHECK(!readFailed.error().getMessage().empty());
+
+    Expected<void> writeFailed;
+    BOOST_CHECK_NO_THROW(writeFailed = intf.tryWriteFrom(12, largeBuffer));
+    BOOST_CHECK(!writeFailed);
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
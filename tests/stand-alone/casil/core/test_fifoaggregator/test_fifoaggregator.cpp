@@ -0,0 +1,292 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/asio.h>
+#include <casil/auxil.h>
+#include <casil/bytes.h>
+#include <casil/device.h>
+#include <casil/fifoaggregator.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/system/errc.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using casil::Device;
+using casil::FifoAggregator;
+using casil::TL::SiTCP;
+
+namespace boost { using casil::Bytes::operator<<; }
+
+namespace
+{
+
+//Accepts a TCP connection for a SiTCP interface while initializing the device
+bool initWithConnection(Device& pDevice, boost::asio::ip::tcp::acceptor& pAcceptor, boost::asio::ip::tcp::socket& pSocket)
+{
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    pAcceptor.async_accept(pSocket, [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+                                    {
+                                        if (pErrorCode.value() != boost::system::errc::success)
+                                            handlerError.store(true);
+
+                                        handlerCompleted.store(true);
+                                        handlerCompleted.notify_one();
+                                    });
+
+    if (!pDevice.init())
+        return false;
+
+    handlerCompleted.wait(false);
+
+    return !handlerError.load();
+}
+
+//Writes consecutive little endian words to the socket
+void writeWords(boost::asio::ip::tcp::socket& pSocket, const std::uint32_t pFirstWord, const std::size_t pNumWords)
+{
+    std::vector<std::uint8_t> buffer;
+
+    for (std::size_t i = 0; i < pNumWords; ++i)
+    {
+        const std::uint32_t word = pFirstWord + static_cast<std::uint32_t>(i);
+
+        for (int j = 0; j < 4; ++j)
+            buffer.push_back(static_cast<std::uint8_t>(word >> (8 * j)));
+    }
+
+    boost::asio::write(pSocket, boost::asio::buffer(buffer));
+}
+
+std::vector<std::uint32_t> makeWords(const std::uint32_t pFirstWord, const std::size_t pNumWords)
+{
+    std::vector<std::uint32_t> words(pNumWords);
+
+    for (std::size_t i = 0; i < pNumWords; ++i)
+        words[i] = pFirstWord + static_cast<std::uint32_t>(i);
+
+    return words;
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(FifoAggregator_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_config)
+{
+    BOOST_CHECK_THROW(FifoAggregator(0, 16), std::invalid_argument);
+    BOOST_CHECK_THROW(FifoAggregator(16, 0), std::invalid_argument);
+
+    Device d("{transfer_layer: [{name: intf, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 10356}}],"
+              "hw_drivers: [], registers: []}");
+
+    SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+    FifoAggregator aggregator;
+
+    BOOST_CHECK_EQUAL(aggregator.addBoard(intf), 0);
+    BOOST_CHECK_THROW(aggregator.addBoard(intf), std::invalid_argument);
+
+    BOOST_CHECK(!aggregator.isRunning());
+    aggregator.start();
+    BOOST_CHECK(aggregator.isRunning());
+    BOOST_CHECK_THROW(aggregator.addBoard(intf), std::runtime_error);
+    BOOST_CHECK(!aggregator.getBlock().has_value());
+    aggregator.stop();
+    BOOST_CHECK(!aggregator.isRunning());
+    aggregator.stop();
+}
+
+BOOST_AUTO_TEST_CASE(Test2_fanIn)
+{
+    Device d0("{transfer_layer: [{name: intf, type: SiTCP,"
+                                 "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true}}],"
+               "hw_drivers: [], registers: []}");
+    Device d1("{transfer_layer: [{name: intf, type: SiTCP,"
+                                 "init: {ip: 127.0.0.1, udp_port: 10358, tcp_port: 10359, tcp_connection: true}}],"
+               "hw_drivers: [], registers: []}");
+
+    using boost::asio::ip::tcp;
+    tcp::acceptor acceptor0(casil::ASIO::getIOContext(), tcp::endpoint(tcp::v4(), 10357), false);
+    tcp::acceptor acceptor1(casil::ASIO::getIOContext(), tcp::endpoint(tcp::v4(), 10359), false);
+    tcp::socket socket0(casil::ASIO::getIOContext());
+    tcp::socket socket1(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(initWithConnection(d0, acceptor0, socket0));
+        BOOST_REQUIRE(initWithConnection(d1, acceptor1, socket1));
+
+        SiTCP& intf0 = dynamic_cast<SiTCP&>(d0.interface("intf"));
+        SiTCP& intf1 = dynamic_cast<SiTCP&>(d1.interface("intf"));
+
+        FifoAggregator aggregator(64, 4);
+
+        BOOST_CHECK_EQUAL(aggregator.addBoard(intf0), 0);
+        BOOST_CHECK_EQUAL(aggregator.addBoard(intf1), 1);
+
+        //Data received before starting must be read as well
+
+        writeWords(socket0, 0x1000, 10);
+
+        const auto startTime = std::chrono::steady_clock::now();
+        while (intf0.getFifoSize() < 40 && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(2))
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        BOOST_REQUIRE_EQUAL(intf0.getFifoSize(), 40);
+
+        aggregator.start();
+
+        writeWords(socket1, 0x2000, 7);
+        writeWords(socket0, 0x100A, 3);
+
+        std::array<std::vector<std::uint32_t>, 2> words;
+        std::array<std::optional<std::uint64_t>, 2> lastSequenceNumbers;
+
+        while (words[0].size() < 13 || words[1].size() < 7)
+        {
+            std::optional<FifoAggregator::Block> block = aggregator.getBlock(std::chrono::milliseconds(2000));
+
+            BOOST_REQUIRE(block.has_value());
+            BOOST_REQUIRE(block->board < 2);
+            BOOST_CHECK(!block->words.empty() && block->words.size() <= 4);
+
+            if (lastSequenceNumbers[block->board].has_value())
+                BOOST_CHECK(block->sequenceNumber >= *lastSequenceNumbers[block->board]);
+
+            lastSequenceNumbers[block->board] = block->sequenceNumber;
+
+            words[block->board].insert(words[block->board].end(), block->words.begin(), block->words.end());
+        }
+
+        BOOST_CHECK_EQUAL(words[0], makeWords(0x1000, 13));
+        BOOST_CHECK_EQUAL(words[1], makeWords(0x2000, 7));
+        BOOST_CHECK_EQUAL(intf0.getFifoSize(), 0);
+        BOOST_CHECK_EQUAL(intf1.getFifoSize(), 0);
+
+        const FifoAggregator::Statistics stats = aggregator.getStatistics();
+
+        BOOST_CHECK(stats.blocksQueued >= 6);
+        BOOST_CHECK_EQUAL(stats.wordsQueued, 20);
+        BOOST_CHECK(stats.wakeUps >= 1);
+
+        //After stopping, the FIFOs must not be read anymore
+
+        aggregator.stop();
+
+        BOOST_CHECK(aggregator.getBlocks().empty());
+
+        writeWords(socket1, 0x3000, 2);
+
+        const auto stopTime = std::chrono::steady_clock::now();
+        while (intf1.getFifoSize() < 8 && std::chrono::steady_clock::now() - stopTime < std::chrono::seconds(2))
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        BOOST_CHECK_EQUAL(intf1.getFifoSize(), 8);
+        BOOST_CHECK(!aggregator.getBlock(std::chrono::milliseconds(50)).has_value());
+
+        BOOST_CHECK(d0.close());
+        BOOST_CHECK(d1.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test3_backPressure)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true}}],"
+              "hw_drivers: [], registers: []}");
+
+    using boost::asio::ip::tcp;
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), tcp::endpoint(tcp::v4(), 10357), false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(initWithConnection(d, acceptor, socket));
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        FifoAggregator aggregator(2, 1);
+
+        aggregator.addBoard(intf);
+        aggregator.start();
+
+        writeWords(socket, 0, 6);
+
+        //Full queue must leave the remaining data in the FIFO
+
+        const auto startTime = std::chrono::steady_clock::now();
+        while (intf.getFifoSize() != 16 && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(2))
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 16);
+
+        std::vector<std::uint32_t> words;
+
+        while (words.size() < 6)
+        {
+            std::optional<FifoAggregator::Block> block = aggregator.getBlock(std::chrono::milliseconds(2000));
+
+            BOOST_REQUIRE(block.has_value());
+
+            words.insert(words.end(), block->words.begin(), block->words.end());
+        }
+
+        BOOST_CHECK_EQUAL(words, makeWords(0, 6));
+        BOOST_CHECK(aggregator.getStatistics().queueStalls >= 1);
+
+        aggregator.stop();
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,163 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <casil/fifodecoder.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using casil::FifoDecoder;
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(FifoDecoder_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_parseRules)
+{
+    const std::vector<FifoDecoder::Rule> rules = FifoDecoder::parseRules(
+                "{rules: [{name: hit, mask: 0x80000000, value: 0x80000000, "
+                "fields: [{name: column, shift: 24, mask: 0x7F}, {name: row, shift: 12, mask: 0xFFF}, {name: tot, mask: 0xFF}]}, "
+                "{name: trigger, mask: 0xF0000000, value: 0x10000000}]}");
+
+    BOOST_REQUIRE_EQUAL(rules.size(), 2);
+    BOOST_CHECK_EQUAL(rules[0].name, "hit");
+    BOOST_CHECK_EQUAL(rules[0].mask, 0x80000000u);
+    BOOST_CHECK_EQUAL(rules[0].value, 0x80000000u);
+    BOOST_REQUIRE_EQUAL(rules[0].fields.size(), 3);
+    BOOST_CHECK_EQUAL(rules[0].fields[1].name, "row");
+    BOOST_CHECK_EQUAL(rules[0].fields[1].shift, 12);
+    BOOST_CHECK_EQUAL(rules[0].fields[1].mask, 0xFFFu);
+    BOOST_CHECK_EQUAL(rules[0].fields[2].shift, 0);
+    BOOST_CHECK(rules[1].fields.empty());
+
+    BOOST_CHECK_THROW(FifoDecoder::parseRules("{foo: 1}"), std::runtime_error);
+    BOOST_CHECK_THROW(FifoDecoder::parseRules("{rules: [{name: a, value: 1}]}"), std::runtime_error);
+    BOOST_CHECK_THROW(FifoDecoder::parseRules("{rules: [{name: a, mask: 0x100000000, value: 0}]}"), std::runtime_error);
+    BOOST_CHECK_THROW(FifoDecoder::parseRules("{rules: [{name: a, mask: 1, value: 1, fields: [{name: b, shift: 2}]}]}"), std::runtime_error);
+
+    using Rule = FifoDecoder::Rule;
+    using Field = FifoDecoder::Field;
+
+    BOOST_CHECK_THROW(FifoDecoder({Rule{"a", 1, 1, {}}}, 1, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(FifoDecoder({Rule{"a", 1, 1, {}}, Rule{"a", 2, 2, {}}}), std::invalid_argument);
+    BOOST_CHECK_THROW(FifoDecoder({Rule{"a", 1, 3, {}}}), std::invalid_argument);
+    BOOST_CHECK_THROW(FifoDecoder({Rule{"a", 1, 1, {Field{"b", 1, 32}}}}), std::invalid_argument);
+    BOOST_CHECK_THROW(FifoDecoder({Rule{"a", 1, 1, {Field{"b", 0, 0}}}}), std::invalid_argument);
+    BOOST_CHECK_THROW(FifoDecoder({Rule{"a", 1, 1, {Field{"b", 1, 0}, Field{"b", 1, 1}}}}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_decode)
+{
+    //Small blocks and several threads to spread the words over many blocks and workers
+
+    FifoDecoder decoder(FifoDecoder::parseRules(
+                            "{rules: [{name: hit, mask: 0x80000000, value: 0x80000000, "
+                            "fields: [{name: column, shift: 24, mask: 0x7F}, {name: row, shift: 12, mask: 0xFFF}, {name: tot, mask: 0xFF}]}, "
+                            "{name: trigger, mask: 0xF0000000, value: 0x10000000, fields: [{name: number, mask: 0xFFFFFFF}]}]}"),
+                        4, 100);
+
+    BOOST_CHECK_EQUAL(decoder.getNumThreads(), 4);
+    BOOST_CHECK_EQUAL(decoder.getBlockSize(), 100);
+
+    std::vector<std::uint32_t> words;
+    std::vector<std::uint64_t> expHitPositions;
+    std::vector<std::uint32_t> expColumns, expRows, expTots;
+    std::vector<std::uint32_t> expTriggers;
+    std::uint64_t expUnmatched = 0;
+
+    for (std::uint32_t i = 0; i < 100003; ++i)
+    {
+        if (i % 10 == 0)
+        {
+            expTriggers.push_back(i);
+            words.push_back(0x10000000u | i);
+        }
+        else if (i % 10 == 5)
+        {
+            ++expUnmatched;
+            words.push_back(0x20000000u | i);
+        }
+        else
+        {
+            const std::uint32_t column = i % 128;
+            const std::uint32_t row = i % 4096;
+            const std::uint32_t tot = i % 256;
+
+            expHitPositions.push_back(i);
+            expColumns.push_back(column);
+            expRows.push_back(row);
+            expTots.push_back(tot);
+            words.push_back(0x80000000u | (column << 24) | (row << 12) | tot);
+        }
+    }
+
+    for (int run = 0; run < 3; ++run)
+    {
+        const FifoDecoder::Result result = decoder.decode(words);
+
+        BOOST_REQUIRE_EQUAL(result.records.size(), 2);
+        BOOST_CHECK_EQUAL(result.numUnmatched, expUnmatched);
+
+        const FifoDecoder::RecordArrays& hits = result.records[0];
+
+        BOOST_CHECK_EQUAL(hits.name, "hit");
+        BOOST_CHECK(hits.fieldNames == (std::vector<std::string>{"column", "row", "tot"}));
+        BOOST_REQUIRE_EQUAL(hits.columns.size(), 3);
+        BOOST_CHECK(hits.positions == expHitPositions);
+        BOOST_CHECK(hits.columns[0] == expColumns);
+        BOOST_CHECK(hits.columns[1] == expRows);
+        BOOST_CHECK(hits.columns[2] == expTots);
+
+        const FifoDecoder::RecordArrays& triggers = result.records[1];
+
+        BOOST_CHECK_EQUAL(triggers.name, "trigger");
+        BOOST_REQUIRE_EQUAL(triggers.columns.size(), 1);
+        BOOST_CHECK(triggers.columns[0] == expTriggers);
+        BOOST_CHECK_EQUAL(triggers.positions.size(), expTriggers.size());
+    }
+
+    const FifoDecoder::Statistics stats = decoder.getStatistics();
+
+    BOOST_CHECK_EQUAL(stats.wordsDecoded, 3 * words.size());
+    BOOST_CHECK_EQUAL(stats.blocksDecoded, 3 * 1001);
+
+    //Empty input
+
+    const FifoDecoder::Result emptyResult = decoder.decode({});
+
+    BOOST_CHECK_EQUAL(emptyResult.numUnmatched, 0);
+    BOOST_REQUIRE_EQUAL(emptyResult.records.size(), 2);
+    BOOST_CHECK(emptyResult.records[0].positions.empty());
+    BOOST_CHECK(emptyResult.records[0].columns[0].empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,291 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/asio.h>
+#include <casil/auxil.h>
+#include <casil/bytes.h>
+#include <casil/device.h>
+#include <casil/fifostream.h>
+#include <casil/TL/Muxed/sitcp.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/system/errc.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using casil::Device;
+using casil::FifoStream;
+using casil::TL::SiTCP;
+
+namespace boost { using casil::Bytes::operator<<; }
+
+namespace
+{
+
+//Accepts a TCP connection for a SiTCP interface while initializing the device
+bool initWithConnection(Device& pDevice, boost::asio::ip::tcp::acceptor& pAcceptor, boost::asio::ip::tcp::socket& pSocket)
+{
+    std::atomic_bool handlerCompleted(false);
+    std::atomic_bool handlerError(false);
+
+    pAcceptor.async_accept(pSocket, [&handlerCompleted, &handlerError](const boost::system::error_code& pErrorCode)
+                                    {
+                                        if (pErrorCode.value() != boost::system::errc::success)
+                                            handlerError.store(true);
+
+                                        handlerCompleted.store(true);
+                                        handlerCompleted.notify_one();
+                                    });
+
+    if (!pDevice.init())
+        return false;
+
+    handlerCompleted.wait(false);
+
+    return !handlerError.load();
+}
+
+//Writes consecutive little endian words to the socket
+void writeWords(boost::asio::ip::tcp::socket& pSocket, const std::uint32_t pFirstWord, const std::size_t pNumWords)
+{
+    std::vector<std::uint8_t> buffer;
+
+    for (std::size_t i = 0; i < pNumWords; ++i)
+    {
+        const std::uint32_t word = pFirstWord + static_cast<std::uint32_t>(i);
+
+        for (int j = 0; j < 4; ++j)
+            buffer.push_back(static_cast<std::uint8_t>(word >> (8 * j)));
+    }
+
+    boost::asio::write(pSocket, boost::asio::buffer(buffer));
+}
+
+std::vector<std::uint32_t> makeWords(const std::uint32_t pFirstWord, const std::size_t pNumWords)
+{
+    std::vector<std::uint32_t> words(pNumWords);
+
+    for (std::size_t i = 0; i < pNumWords; ++i)
+        words[i] = pFirstWord + static_cast<std::uint32_t>(i);
+
+    return words;
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(FifoStream_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_config)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 10356}}],"
+              "hw_drivers: [], registers: []}");
+
+    SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+    BOOST_CHECK_THROW(FifoStream(intf, 0, 16), std::invalid_argument);
+    BOOST_CHECK_THROW(FifoStream(intf, 16, 0), std::invalid_argument);
+
+    FifoStream stream(intf, 16);
+
+    BOOST_CHECK_EQUAL(stream.getBlockWords(), 16);
+
+    //Not started: no waiting for blocks that cannot arrive
+
+    BOOST_CHECK(stream.atEnd());
+    BOOST_CHECK(stream.getBlock(std::chrono::milliseconds(5000)) == nullptr);
+
+    BOOST_CHECK(!stream.isRunning());
+    stream.start();
+    BOOST_CHECK(stream.isRunning());
+    BOOST_CHECK(!stream.atEnd());
+    BOOST_CHECK(stream.getBlock() == nullptr);
+    stream.stop();
+    BOOST_CHECK(!stream.isRunning());
+    BOOST_CHECK(stream.atEnd());
+    stream.stop();
+}
+
+BOOST_AUTO_TEST_CASE(Test2_blocks)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true}}],"
+              "hw_drivers: [], registers: []}");
+
+    using boost::asio::ip::tcp;
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), tcp::endpoint(tcp::v4(), 10357), false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(initWithConnection(d, acceptor, socket));
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        FifoStream stream(intf, 4);
+
+        //Data received before starting must be read as well
+
+        writeWords(socket, 0x1000, 10);
+
+        const auto startTime = std::chrono::steady_clock::now();
+        while (intf.getFifoSize() < 40 && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(2))
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        BOOST_REQUIRE_EQUAL(intf.getFifoSize(), 40);
+
+        stream.start();
+
+        writeWords(socket, 0x100A, 5);
+
+        std::vector<std::uint32_t> words;
+
+        while (words.size() < 12)
+        {
+            const FifoStream::BlockType block = stream.getBlock(std::chrono::milliseconds(2000));
+
+            BOOST_REQUIRE(block != nullptr);
+            BOOST_CHECK_EQUAL(block->size(), 4);
+
+            words.insert(words.end(), block->begin(), block->end());
+        }
+
+        //Incomplete block only delivered when stopping
+
+        BOOST_CHECK(stream.getBlock(std::chrono::milliseconds(50)) == nullptr);
+        BOOST_CHECK(!stream.atEnd());
+
+        stream.stop();
+
+        const FifoStream::BlockType lastBlock = stream.getBlock();
+
+        BOOST_REQUIRE(lastBlock != nullptr);
+        BOOST_CHECK_EQUAL(lastBlock->size(), 3);
+
+        words.insert(words.end(), lastBlock->begin(), lastBlock->end());
+
+        BOOST_CHECK_EQUAL(words, makeWords(0x1000, 15));
+        BOOST_CHECK(stream.atEnd());
+        BOOST_CHECK(stream.getBlock(std::chrono::milliseconds(5000)) == nullptr);
+
+        const FifoStream::Statistics stats = stream.getStatistics();
+
+        BOOST_CHECK_EQUAL(stats.blocksQueued, 4);
+        BOOST_CHECK_EQUAL(stats.wordsQueued, 15);
+        BOOST_CHECK(stats.wakeUps >= 1);
+        BOOST_CHECK(stats.blocksAllocated <= 5);
+
+        //Released blocks are reused
+
+        stream.start();
+
+        writeWords(socket, 0x2000, 8);
+
+        for (int i = 0; i < 2; ++i)
+        {
+            const FifoStream::BlockType block = stream.getBlock(std::chrono::milliseconds(2000));
+
+            BOOST_REQUIRE(block != nullptr);
+            BOOST_CHECK_EQUAL(*block, makeWords(0x2000 + 4 * i, 4));
+        }
+
+        stream.stop();
+
+        BOOST_CHECK_EQUAL(stream.getStatistics().blocksAllocated, stats.blocksAllocated);
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test3_backPressure)
+{
+    Device d("{transfer_layer: [{name: intf, type: SiTCP,"
+                                "init: {ip: 127.0.0.1, udp_port: 10356, tcp_port: 10357, tcp_connection: true}}],"
+              "hw_drivers: [], registers: []}");
+
+    using boost::asio::ip::tcp;
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), tcp::endpoint(tcp::v4(), 10357), false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        BOOST_REQUIRE(initWithConnection(d, acceptor, socket));
+
+        SiTCP& intf = dynamic_cast<SiTCP&>(d.interface("intf"));
+
+        FifoStream stream(intf, 1, 2);
+
+        stream.start();
+
+        writeWords(socket, 0, 6);
+
+        //Full queue must leave the remaining data in the FIFO
+
+        const auto startTime = std::chrono::steady_clock::now();
+        while (intf.getFifoSize() != 16 && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(2))
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        BOOST_CHECK_EQUAL(intf.getFifoSize(), 16);
+
+        std::vector<std::uint32_t> words;
+
+        while (words.size() < 6)
+        {
+            const FifoStream::BlockType block = stream.getBlock(std::chrono::milliseconds(2000));
+
+            BOOST_REQUIRE(block != nullptr);
+
+            words.insert(words.end(), block->begin(), block->end());
+        }
+
+        BOOST_CHECK_EQUAL(words, makeWords(0, 6));
+        BOOST_CHECK(stream.getStatistics().queueStalls >= 1);
+
+        stream.stop();
+
+        BOOST_CHECK(d.close());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
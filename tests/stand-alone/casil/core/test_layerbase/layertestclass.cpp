@@ -44,3 +44,10 @@ bool LayerTestClass::closeImpl()
 {
     return !failClose;
 }
+
+//
+
+void LayerTestClass::postAsync(std::function<void()> pTask) const
+{
+    pTask();
+}
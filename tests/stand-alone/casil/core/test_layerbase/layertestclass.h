@@ -28,12 +28,16 @@
 
 #include <casil/layerconfig.h>
 
+#include <functional>
+
 class LayerTestClass final : public casil::LayerBase
 {
 public:
     LayerTestClass(const casil::LayerConfig& pConfig, const casil::LayerConfig& pRequiredConfig,
                    bool pFailInit = false, bool pFailClose = false);
     ~LayerTestClass() override = default;
+    //
+    void postAsync(std::function<void()> pTask) const override;
 
 private:
     bool initImpl() override;
@@ -51,6 +51,13 @@ bool RTConfTestClass::closeImpl()
 
 //
 
+void RTConfTestClass::postAsync(std::function<void()> pTask) const
+{
+    pTask();
+}
+
+//
+
 void RTConfTestClass::loadRuntimeConfImpl(boost::property_tree::ptree&& pConf)
 {
     try
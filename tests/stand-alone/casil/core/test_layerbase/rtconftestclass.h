@@ -30,11 +30,15 @@
 
 #include <boost/property_tree/ptree_fwd.hpp>
 
+#include <functional>
+
 class RTConfTestClass final : public casil::LayerBase
 {
 public:
     RTConfTestClass(const casil::LayerConfig& pConfig, const casil::LayerConfig& pRequiredConfig);
     ~RTConfTestClass() override = default;
+    //
+    void postAsync(std::function<void()> pTask) const override;
 
 private:
     bool initImpl() override;
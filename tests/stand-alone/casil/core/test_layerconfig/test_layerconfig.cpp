@@ -28,6 +28,7 @@
 #include <boost/property_tree/ptree.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -198,6 +199,103 @@ BOOST_AUTO_TEST_CASE(Test7_rawTree)
     BOOST_CHECK_EQUAL(subConfStr, subConfRefStr);
 }
 
+BOOST_AUTO_TEST_CASE(Test8_compiledValues)
+{
+    const LayerConfig conf = LayerConfig::fromYAML("{init: {addr: 0x10, nested: [{one: 1.3}, {two: 2a, three: True}]},"
+                                                    "s1: [1, 2, 3], s5: {z: 74, a: 300}}");
+
+    BOOST_CHECK_EQUAL(conf.getUInt("init.addr"), 16);
+    BOOST_CHECK_EQUAL(conf.getDbl("init.nested.#0.one"), 1.3);
+    BOOST_CHECK_EQUAL(conf.getStr("init.nested.#1.two"), "2a");
+    BOOST_CHECK(conf.getBool("init.nested.#1.three") == true);
+    BOOST_CHECK(conf.getStrOpt("init.nested.#2") == std::nullopt);
+    BOOST_CHECK(conf.getStrOpt("init.nested") == "");
+    BOOST_CHECK(conf.getIntOpt("init.nested") == std::nullopt);
+    BOOST_CHECK(conf.getByteSeqOpt("init.nested") == std::nullopt);
+    BOOST_CHECK(conf.getUIntSeq("s1") == (std::vector<std::uint64_t>{1, 2, 3}));
+    BOOST_CHECK(conf.getUIntSeq("s5") == (std::vector<std::uint64_t>{74, 300}));
+    BOOST_CHECK(conf.getByteSeqOpt("s5") == std::nullopt);
+    BOOST_CHECK(conf.getStrOpt("") == "");
+
+    //Copies keep the pre-converted values
+
+    const LayerConfig confCopy(conf);
+
+    BOOST_CHECK(confCopy == conf);
+    BOOST_CHECK_EQUAL(confCopy.getDbl("init.nested.#0.one"), 1.3);
+
+    //Empty configuration
+
+    const LayerConfig emptyConf;
+
+    BOOST_CHECK(emptyConf.getStrOpt("") == "");
+    BOOST_CHECK(emptyConf.getStrOpt("init") == std::nullopt);
+    BOOST_CHECK_EQUAL(emptyConf.getInt("init", 5), 5);
+}
+
+BOOST_AUTO_TEST_CASE(Test9_sharedTree)
+{
+    const std::shared_ptr<boost::property_tree::ptree> tree =
+            std::make_shared<boost::property_tree::ptree>(casil::Auxil::propertyTreeFromYAML("{init: {port: 42}}"));
+
+    //Tree is shared with its owner and all copies/moves
+
+    const LayerConfig conf(tree);
+
+    BOOST_CHECK(&conf.getTree() == tree.get());
+    BOOST_CHECK_EQUAL(conf.getInt("init.port"), 42);
+
+    LayerConfig confCopy(conf);
+    const LayerConfig confMoved(std::move(confCopy));
+
+    BOOST_CHECK(&confMoved.getTree() == tree.get());
+    BOOST_CHECK(confMoved == conf);
+
+    //Equal but separate trees still compare equal
+
+    BOOST_CHECK(LayerConfig(*tree) == conf);
+    BOOST_CHECK(&LayerConfig(*tree).getTree() != tree.get());
+
+    //Repeatedly parsed documents are reused
+
+    BOOST_CHECK(&LayerConfig::fromYAML("{size: uint}").getTree() == &LayerConfig::fromYAML("{size: uint}").getTree());
+    BOOST_CHECK(LayerConfig::fromYAML("{size: uint}") == LayerConfig::fromYAML("{size: uint}"));
+
+    //Null tree is treated as empty tree
+
+    const LayerConfig nullConf(std::shared_ptr<const boost::property_tree::ptree>{});
+
+    BOOST_CHECK(nullConf == LayerConfig());
+}
+
+BOOST_AUTO_TEST_CASE(Test10_containsNonUniquePaths)
+{
+    //Sub-trees never match scalar type descriptions
+
+    const LayerConfig nestedConf = LayerConfig::fromYAML("{init: {port: {number: 1}, seq: [1, 2]}}");
+
+    BOOST_CHECK(nestedConf.contains(LayerConfig::fromYAML("{init: {port: string}}"), true) == false);
+    BOOST_CHECK(nestedConf.contains(LayerConfig::fromYAML("{init: {port: {number: uint}, seq: byteSeq}}"), true) == true);
+    BOOST_CHECK(nestedConf.contains(LayerConfig::fromYAML("{init: {seq: int}}"), true) == false);
+
+    //Keys containing periods cannot be addressed by paths but are still checked
+
+    const LayerConfig dottedConf = LayerConfig::fromYAML("{init: {a.b: 5, port: x}}");
+
+    BOOST_CHECK(dottedConf.contains(LayerConfig::fromYAML("{init: {a.b: int, port: string}}"), true) == true);
+    BOOST_CHECK(dottedConf.contains(LayerConfig::fromYAML("{init: {a.b: bool}}"), true) == false);
+    BOOST_CHECK(dottedConf.contains(LayerConfig::fromYAML("{init: {a.c: }}"), false) == false);
+
+    //Duplicate keys in the reference are all checked (against the first matching node)
+
+    boost::property_tree::ptree dupTree;
+    dupTree.put("init.port", "int");
+    dupTree.add("init.port", "uint");
+
+    BOOST_CHECK(LayerConfig::fromYAML("{init: {port: -1}}").contains(LayerConfig(dupTree), true) == false);
+    BOOST_CHECK(LayerConfig::fromYAML("{init: {port: 1}}").contains(LayerConfig(dupTree), true) == true);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
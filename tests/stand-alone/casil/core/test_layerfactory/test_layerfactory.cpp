@@ -24,28 +24,40 @@
 #include <casil/layerbase.h>
 #include <casil/layerconfig.h>
 #include <casil/layerfactory.h>
+#include <casil/staticlayerfactory.h>
 #include <casil/HL/directdriver.h>
 #include <casil/HL/driver.h>
 #include <casil/HL/Direct/dummydriver.h>
+#include <casil/HL/Muxed/gpio.h>
 #include <casil/RL/register.h>
 #include <casil/RL/dummyregister.h>
 #include <casil/TL/interface.h>
 #include <casil/TL/directinterface.h>
 #include <casil/TL/Direct/dummyinterface.h>
+#include <casil/TL/Muxed/dummymuxedinterface.h>
 
+#include <atomic>
+#include <filesystem>
+#include <fstream>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 using casil::LayerBase;
 using casil::LayerConfig;
 using casil::LayerFactory;
+using casil::StaticLayerFactory;
 using casil::TL::Interface;
 using casil::TL::DirectInterface;
 using casil::TL::DummyInterface;
+using casil::TL::DummyMuxedInterface;
 using casil::HL::Driver;
 using casil::HL::DirectDriver;
 using casil::HL::DummyDriver;
+using casil::HL::GPIO;
 using casil::RL::Register;
 using casil::RL::DummyRegister;
 
@@ -184,6 +196,132 @@ BOOST_AUTO_TEST_CASE(Test4_register)
     BOOST_CHECK_EQUAL(testReg3->getType(), testReg2->getType());
 }
 
+BOOST_AUTO_TEST_CASE(Test5_staticRegistry)
+{
+    using Registry = StaticLayerFactory<DummyRegister, GPIO, DummyInterface, DummyDriver, DummyMuxedInterface>;
+
+    std::unique_ptr<Interface> tInterface = Registry::createInterface("DummyInterface", "tInterface", LayerConfig());
+    std::unique_ptr<Interface> tMuxedInterface = Registry::createInterface("DummyMuxedInterface", "tMuxedInterface", LayerConfig());
+
+    BOOST_REQUIRE(tInterface != nullptr);
+    BOOST_REQUIRE(tMuxedInterface != nullptr);
+    BOOST_CHECK_EQUAL(tInterface->getType(), "DummyInterface");
+    BOOST_CHECK_EQUAL(tInterface->getName(), "tInterface");
+    BOOST_CHECK_EQUAL(tMuxedInterface->getType(), "DummyMuxedInterface");
+
+    //Unknown names and names of other layers' types are not found and arguments are not moved from
+    std::string name = "tName";
+    LayerConfig config = LayerConfig::fromYAML("{foo: bar}");
+
+    BOOST_CHECK(Registry::createInterface("DummyDriver", std::move(name), std::move(config)) == nullptr);
+    BOOST_CHECK(Registry::createInterface("Dummy", std::move(name), std::move(config)) == nullptr);
+    BOOST_CHECK(Registry::createInterface("TCP", std::move(name), std::move(config)) == nullptr);
+    BOOST_CHECK_EQUAL(name, "tName");
+    BOOST_CHECK(config.contains(LayerConfig::fromYAML("{foo: string}"), true));
+
+    std::unique_ptr<Driver> tDriver = Registry::createDriver("DummyDriver", "tDriver", *tInterface, LayerConfig());
+
+    BOOST_REQUIRE(tDriver != nullptr);
+    BOOST_CHECK_EQUAL(tDriver->getType(), "DummyDriver");
+
+    BOOST_CHECK(Registry::createDriver("DummyInterface", "tDriver2", *tInterface, LayerConfig()) == nullptr);
+
+    //Wrong interface base type
+    BOOST_CHECK_THROW((void)Registry::createDriver("DummyDriver", "tDriver3", *tMuxedInterface, LayerConfig()), std::runtime_error);
+    BOOST_CHECK_THROW((void)Registry::createDriver("GPIO", "tDriver4", *tInterface, LayerConfig::fromYAML("{base_addr: 0, size: 8}")),
+                      std::runtime_error);
+
+    std::unique_ptr<Register> tRegister = Registry::createRegister("DummyRegister", "tRegister", *tDriver, LayerConfig());
+
+    BOOST_REQUIRE(tRegister != nullptr);
+    BOOST_CHECK_EQUAL(tRegister->getType(), "DummyRegister");
+
+    //Installed registry is used by the factory before the registered generators
+
+    Registry::install();
+
+    BOOST_CHECK(LayerFactory::createInterface("DummyInterface", "tInterface2", LayerConfig()) != nullptr);
+    BOOST_CHECK(LayerFactory::createInterface("SimMuxed", "tInterface3", LayerConfig()) != nullptr);
+    BOOST_CHECK(LayerFactory::createInterface("foobar-unknown", "tInterface4", LayerConfig()) == nullptr);
+    BOOST_CHECK(LayerFactory::createDriver("DummyDriver", "tDriver5", *tInterface, LayerConfig()) != nullptr);
+    BOOST_CHECK_THROW((void)LayerFactory::createDriver("DummyDriver", "tDriver6", *tMuxedInterface, LayerConfig()), std::runtime_error);
+    BOOST_CHECK(LayerFactory::createRegister("DummyRegister", "tRegister2", *tDriver, LayerConfig()) != nullptr);
+
+    LayerFactory::useStaticRegistry(nullptr, nullptr, nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Test6_plugins)
+{
+    const std::filesystem::path pluginDir = std::filesystem::temp_directory_path() / "casil_test_layerfactory_plugins";
+    const std::filesystem::path invalidPluginDir = std::filesystem::temp_directory_path() / "casil_test_layerfactory_plugins_invalid";
+
+    std::filesystem::create_directories(pluginDir);
+    std::filesystem::create_directories(invalidPluginDir);
+
+    std::ofstream(pluginDir / LayerFactory::pluginIndexFileName) << "{interfaces: {MissingPluginInterface: libcasil_missing_plugin.so},"
+                                                                     " drivers: {}}";
+    std::ofstream(invalidPluginDir / LayerFactory::pluginIndexFileName) << "{interfaces: [";
+
+    LayerFactory::addPluginDirectory(invalidPluginDir);
+    LayerFactory::addPluginDirectory(pluginDir);
+
+    std::unique_ptr<Interface> tInterface = LayerFactory::createInterface("DummyInterface", "tInterface", LayerConfig());
+
+    BOOST_REQUIRE(tInterface != nullptr);
+
+    //Indexed type of a missing library vs. types not provided by any plugin (or only for another layer)
+
+    BOOST_CHECK_THROW((void)LayerFactory::createInterface("MissingPluginInterface", "tInterface2", LayerConfig()), std::runtime_error);
+    BOOST_CHECK(LayerFactory::createInterface("foobar-unknown", "tInterface3", LayerConfig()) == nullptr);
+    BOOST_CHECK(LayerFactory::createDriver("MissingPluginInterface", "tDriver", *tInterface, LayerConfig()) == nullptr);
+
+    //Registered types are never looked up in the plugin index
+
+    BOOST_CHECK(LayerFactory::createDriver("DummyDriver", "tDriver2", *tInterface, LayerConfig()) != nullptr);
+
+    std::filesystem::remove_all(pluginDir);
+    std::filesystem::remove_all(invalidPluginDir);
+}
+
+BOOST_AUTO_TEST_CASE(Test7_concurrentRegistration)
+{
+    auto createInterface = [](std::string pName, LayerConfig pConfig) -> std::unique_ptr<Interface>
+    {
+        return std::make_unique<DummyInterface>(std::move(pName), std::move(pConfig));
+    };
+
+    std::atomic_int failures(0);
+
+    //Register new types (like a plugin library being loaded) while other threads construct components
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([t, &createInterface, &failures]() -> void
+                             {
+                                 for (int i = 0; i < 200; ++i)
+                                 {
+                                     const std::string typeName = "foobar-concurrent-" + std::to_string(t) + "-" + std::to_string(i);
+
+                                     LayerFactory::registerInterfaceType(typeName, createInterface);
+                                     LayerFactory::registerInterfaceAlias(typeName, typeName + "-alias");
+
+                                     if (LayerFactory::createInterface(typeName + "-alias", "tInterface", LayerConfig()) == nullptr ||
+                                         LayerFactory::createInterface("DummyInterface", "tInterface2", LayerConfig()) == nullptr)
+                                     {
+                                         ++failures;
+                                     }
+                                 }
+                             });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    BOOST_CHECK_EQUAL(failures.load(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
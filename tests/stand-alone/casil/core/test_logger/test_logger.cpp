@@ -23,12 +23,18 @@
 
 #include <casil/logger.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <ios>
+#include <iterator>
+#include <regex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 //
 
@@ -132,6 +138,226 @@ BOOST_AUTO_TEST_CASE(Test2_logFile)
     BOOST_CHECK(logStr.find("This is the second test message.") == logStr.npos);
 }
 
+BOOST_AUTO_TEST_CASE(Test3_asyncBackend)
+{
+    using casil::Logger;
+
+    std::ostringstream logOutputStrm;
+
+    Logger::addOutput(logOutputStrm);
+
+    Logger::setLogLevel(Logger::LogLevel::Info);
+
+    BOOST_CHECK_THROW(Logger::enableAsync(0), std::invalid_argument);
+    BOOST_CHECK(!Logger::isAsync());
+
+    Logger::enableAsync(8, Logger::OverflowPolicy::Block);
+
+    BOOST_CHECK(Logger::isAsync());
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([i]() -> void
+                             {
+                                 for (int j = 0; j < 50; ++j)
+                                     Logger::logInfo("Message-" + std::to_string(i) + "-" + std::to_string(j) + "-End");
+                             });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    Logger::logCritical("CriticalMessage");
+
+    //Critical messages are written synchronously
+    BOOST_CHECK(logOutputStrm.str().find("CriticalMessage") != std::string::npos);
+
+    Logger::logInfo("LastMessage");
+    Logger::flush();
+
+    const std::string testStr = logOutputStrm.str();
+
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 50; ++j)
+            BOOST_CHECK(testStr.find("Message-" + std::to_string(i) + "-" + std::to_string(j) + "-End") != testStr.npos);
+    }
+
+    BOOST_CHECK(testStr.find("LastMessage") != testStr.npos);
+    BOOST_CHECK_EQUAL(std::count(testStr.begin(), testStr.end(), '\n'), 202);
+    BOOST_CHECK_EQUAL(Logger::getDroppedCount(), 0);
+
+    //Pending messages are written before removing an output
+    Logger::logInfo("BeforeRemoval");
+    Logger::removeOutput(logOutputStrm);
+    Logger::logInfo("AfterRemoval");
+
+    Logger::disableAsync();
+
+    BOOST_CHECK(!Logger::isAsync());
+    BOOST_CHECK(logOutputStrm.str().find("BeforeRemoval") != std::string::npos);
+    BOOST_CHECK(logOutputStrm.str().find("AfterRemoval") == std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(Test4_messageFormat)
+{
+    using casil::Logger;
+
+    std::ostringstream logOutputStrm;
+
+    Logger::addOutput(logOutputStrm);
+
+    Logger::setLogLevel(Logger::LogLevel::Info);
+
+    Logger::logInfo("FormatTest-1");
+    Logger::logError("FormatTest-2");
+    std::thread([]() -> void { Logger::logInfo("FormatTest-3"); }).join();
+
+    Logger::removeOutput(logOutputStrm);
+
+    std::istringstream logInputStrm(logOutputStrm.str());
+    std::vector<std::string> lines;
+
+    for (std::string line; std::getline(logInputStrm, line);)
+        lines.push_back(line);
+
+    BOOST_REQUIRE_EQUAL(lines.size(), 3u);
+
+    const std::regex lineRegex(R"(^\[\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{6}GMT, ( INFO|ERROR)\|([^\]]+)\] FormatTest-\d$)");
+
+    std::vector<std::string> threadIds;
+
+    for (const std::string& line : lines)
+    {
+        std::smatch match;
+        BOOST_REQUIRE(std::regex_match(line, match, lineRegex));
+        threadIds.push_back(match[2].str());
+    }
+
+    BOOST_CHECK(lines[0].find(" INFO|") != std::string::npos);
+    BOOST_CHECK(lines[1].find("ERROR|") != std::string::npos);
+
+    std::ostringstream threadIdStrm;
+    threadIdStrm<<std::this_thread::get_id();
+
+    BOOST_CHECK_EQUAL(threadIds[0], threadIdStrm.str());
+    BOOST_CHECK_EQUAL(threadIds[1], threadIdStrm.str());
+    BOOST_CHECK(threadIds[2] != threadIdStrm.str());
+
+    BOOST_CHECK(lines[0].substr(0, 28) <= lines[1].substr(0, 28));
+}
+
+BOOST_AUTO_TEST_CASE(Test5_logMacros)
+{
+    using casil::Logger;
+
+    static_assert(Logger::isCompiledIn(Logger::LogLevel::None));
+    static_assert(Logger::isCompiledIn(Logger::LogLevel::Critical));
+    static_assert(Logger::isCompiledIn(Logger::minCompiledLogLevel));
+
+    std::ostringstream logOutputStrm;
+
+    Logger::addOutput(logOutputStrm);
+
+    Logger::setLogLevel(Logger::LogLevel::Info);
+
+    int evalCount = 0;
+
+    auto message = [&evalCount](const std::string& pText) -> std::string
+    {
+        ++evalCount;
+        return pText;
+    };
+
+    CASIL_LOG(Logger::LogLevel::Info, message("MacroTest-Info"));
+    CASIL_LOG_DEBUG(message("MacroTest-Debug"));
+
+    BOOST_CHECK_EQUAL(evalCount, 1);
+
+    Logger::setLogLevel(Logger::LogLevel::DebugDebug);
+
+    CASIL_LOG_DEBUG(message("MacroTest-Debug2"));
+    CASIL_LOG_DEBUGDEBUG(message("MacroTest-DebugDebug"));
+
+    Logger::removeOutput(logOutputStrm);
+
+    const std::string testStr = logOutputStrm.str();
+
+    BOOST_CHECK(testStr.find("MacroTest-Info") != testStr.npos);
+    BOOST_CHECK(testStr.find("MacroTest-Debug]") == testStr.npos);
+    BOOST_CHECK(testStr.find("MacroTest-Debug\n") == testStr.npos);
+
+    if constexpr (Logger::isCompiledIn(Logger::LogLevel::DebugDebug))
+    {
+        BOOST_CHECK_EQUAL(evalCount, 3);
+        BOOST_CHECK(testStr.find("MacroTest-Debug2") != testStr.npos);
+        BOOST_CHECK(testStr.find("MacroTest-DebugDebug") != testStr.npos);
+    }
+    else
+    {
+        BOOST_CHECK(!Logger::includeLogLevel(Logger::LogLevel::DebugDebug));
+        BOOST_CHECK(testStr.find("MacroTest-DebugDebug") == testStr.npos);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Test6_rotatingLogFile)
+{
+    using casil::Logger;
+
+    const std::filesystem::path tmpPath = std::filesystem::temp_directory_path();
+    const std::string logFileName = tmpPath / ("tmp" + std::to_string(std::rand()) + "_rot.log");
+
+    auto readFile = [](const std::string& pFileName) -> std::string
+    {
+        std::ifstream file(pFileName);
+        return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    };
+
+    BOOST_REQUIRE(Logger::addRotatingLogFile(logFileName, 1000, 2, 256));
+    BOOST_CHECK(!Logger::addRotatingLogFile(logFileName));
+    BOOST_CHECK(!Logger::addLogFile(logFileName));
+
+    Logger::setLogLevel(Logger::LogLevel::Info);
+
+    Logger::logInfo("Buffered message.");
+
+    //Buffered until flushed
+    BOOST_CHECK(readFile(logFileName).find("Buffered message.") == std::string::npos);
+
+    Logger::flush();
+
+    BOOST_CHECK(readFile(logFileName).find("Buffered message.") != std::string::npos);
+
+    for (int i = 0; i < 100; ++i)
+        Logger::logInfo("Rotation test message " + std::to_string(i) + ".");
+
+    Logger::removeLogFile(logFileName);
+
+    BOOST_CHECK(std::filesystem::exists(logFileName + ".1"));
+    BOOST_CHECK(std::filesystem::exists(logFileName + ".2"));
+    BOOST_CHECK(!std::filesystem::exists(logFileName + ".3"));
+
+    const std::string current = readFile(logFileName);
+    const std::string backup1 = readFile(logFileName + ".1");
+    const std::string backup2 = readFile(logFileName + ".2");
+
+    BOOST_CHECK(current.find("Rotation test message 99.") != std::string::npos);
+
+    for (const std::string* const content : {&current, &backup1, &backup2})
+    {
+        BOOST_CHECK(!content->empty());
+        BOOST_CHECK(content->size() <= 1000 + 256);
+        BOOST_CHECK(content->front() == '[');
+        BOOST_CHECK(content->back() == '\n');
+    }
+
+    std::filesystem::remove(logFileName);
+    std::filesystem::remove(logFileName + ".1");
+    std::filesystem::remove(logFileName + ".2");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
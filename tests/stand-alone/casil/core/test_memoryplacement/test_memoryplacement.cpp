@@ -0,0 +1,115 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/layerconfig.h>
+#include <casil/memoryplacement.h>
+#include <casil/TL/CommonImpl/fiforingbuffer.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+using casil::LayerConfig;
+using casil::MemoryPlacement;
+using casil::PlacedAllocator;
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(MemoryPlacement_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_allocation)
+{
+    BOOST_CHECK(MemoryPlacement{}.isDefault());
+    BOOST_CHECK(!(MemoryPlacement{.hugePages = true, .numaNode = -1}.isDefault()));
+    BOOST_CHECK(!(MemoryPlacement{.hugePages = false, .numaNode = 0}.isDefault()));
+
+    BOOST_CHECK(PlacedAllocator<std::uint32_t>() == PlacedAllocator<std::uint8_t>());
+    BOOST_CHECK(PlacedAllocator<std::uint32_t>(MemoryPlacement{.hugePages = true}) != PlacedAllocator<std::uint32_t>());
+
+    //All placements must fall back to working memory, whatever the host supports
+
+    for (const MemoryPlacement& placement : {MemoryPlacement{}, MemoryPlacement{.hugePages = true, .numaNode = -1},
+                                             MemoryPlacement{.hugePages = false, .numaNode = 0}, MemoryPlacement{.hugePages = true, .numaNode = 0}})
+    {
+        std::vector<std::uint32_t, PlacedAllocator<std::uint32_t>> words(1000, PlacedAllocator<std::uint32_t>(placement));
+
+        std::iota(words.begin(), words.end(), 0u);
+
+        words.resize(1000000);
+
+        BOOST_CHECK_EQUAL(words[999], 999);
+        BOOST_CHECK_EQUAL(words.back(), 0);
+        BOOST_CHECK(words.get_allocator().getPlacement() == placement);
+    }
+
+    BOOST_CHECK(MemoryPlacement::getCurrentNumaNode() >= -1);
+    BOOST_CHECK_EQUAL(MemoryPlacement::getNetworkDeviceNumaNode(""), -1);
+    BOOST_CHECK_EQUAL(MemoryPlacement::getNetworkDeviceNumaNode("../lo"), -1);
+    BOOST_CHECK_EQUAL(MemoryPlacement::getNetworkDeviceNumaNode("casil_nonexistent0"), -1);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_config)
+{
+    const MemoryPlacement defaultPlacement = MemoryPlacement::fromConfig(LayerConfig::fromYAML("{init: {}}"), "init.fifo_");
+
+    BOOST_CHECK(defaultPlacement.isDefault());
+
+    const MemoryPlacement placement = MemoryPlacement::fromConfig(LayerConfig::fromYAML("{init: {fifo_huge_pages: true, fifo_numa_node: 1}}"),
+                                                                  "init.fifo_");
+
+    BOOST_CHECK(placement == (MemoryPlacement{.hugePages = true, .numaNode = 1}));
+
+    //Unknown network interfaces disable the NUMA binding
+
+    const MemoryPlacement devicePlacement = MemoryPlacement::fromConfig(
+                                                LayerConfig::fromYAML("{init: {fifo_numa_node: 1, fifo_numa_device: casil_nonexistent0}}"),
+                                                "init.fifo_");
+
+    BOOST_CHECK_EQUAL(devicePlacement.numaNode, -1);
+}
+
+BOOST_AUTO_TEST_CASE(Test3_fifoRingBuffer)
+{
+    using casil::Layers::TL::CommonImpl::FIFORingBuffer;
+
+    FIFORingBuffer ringBuffer(4, false, "", MemoryPlacement{.hugePages = true, .numaNode = -1});
+
+    const std::vector<std::uint8_t> bytes(4096, 0xA5);
+
+    //Growing keeps the placement of the storage
+
+    for (int i = 0; i < 1000; ++i)
+        ringBuffer.pushBytes(bytes);
+
+    BOOST_CHECK_EQUAL(ringBuffer.getSize(), 4096000);
+    BOOST_CHECK(ringBuffer.popBytes(1024) == bytes);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
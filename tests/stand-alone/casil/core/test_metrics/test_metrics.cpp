@@ -0,0 +1,224 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/metrics.h>
+#include <casil/asio.h>
+#include <casil/auxil.h>
+#include <casil/device.h>
+#include <casil/TL/directinterface.h>
+
+#include <utility>  //Missing include in boost/asio/awaitable.hpp of some Boost versions
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(Metrics_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_registryAndExposition)
+{
+    using casil::Metrics;
+
+    Metrics::Counter& counter = Metrics::counter("test_metrics_events", "Test \"events\".\nSecond line.", {{"kind", "a\"b"}});
+
+    counter.increment();
+    counter.increment(4);
+
+    BOOST_CHECK_EQUAL(counter.getValue(), 5u);
+    BOOST_CHECK_EQUAL(&Metrics::counter("test_metrics_events", "", {{"kind", "a\"b"}}), &counter);
+    BOOST_CHECK_NE(&Metrics::counter("test_metrics_events", "", {{"kind", "c"}}), &counter);
+
+    Metrics::Gauge& gauge = Metrics::gauge("test_metrics_level", "Test level.");
+
+    gauge.set(2.5);
+    gauge.add(-1.0);
+
+    BOOST_CHECK_EQUAL(gauge.getValue(), 1.5);
+
+    Metrics::Histogram& histogram = Metrics::histogram("test_metrics_latency_seconds", "Test latency.", {0.1, 1.0});
+
+    histogram.observe(0.05);
+    histogram.observe(0.1);
+    histogram.observe(0.5);
+    histogram.observe(2.0);
+
+    BOOST_CHECK(histogram.getBucketCounts() == (std::vector<std::uint64_t>{2, 1, 1}));
+    BOOST_CHECK_EQUAL(histogram.getSum(), 2.65);
+
+    BOOST_CHECK_THROW((void)Metrics::gauge("test_metrics_events", ""), std::invalid_argument);
+    BOOST_CHECK_THROW((void)Metrics::histogram("test_metrics_latency_seconds", "", {0.2}), std::invalid_argument);
+    BOOST_CHECK_THROW((void)Metrics::histogram("test_metrics_unsorted", "", {1.0, 0.5}), std::invalid_argument);
+    BOOST_CHECK_THROW((void)Metrics::counter("0invalid-name", ""), std::invalid_argument);
+    BOOST_CHECK_THROW((void)Metrics::addCallback("test_metrics_callback_hist", "", Metrics::Type::Histogram, {}, []() -> double { return 0; }),
+                      std::invalid_argument);
+
+    std::string text;
+
+    {
+        const Metrics::CallbackHandle handle = Metrics::addCallback("test_metrics_callback", "Test callback.", Metrics::Type::Gauge,
+                                                                    {{"name", "cb"}}, []() -> double { return 42; });
+        (void)handle;
+
+        text = Metrics::expose();
+
+        BOOST_CHECK(text.find("test_metrics_callback{name=\"cb\"} 42\n") != std::string::npos);
+    }
+
+    BOOST_CHECK(Metrics::expose().find("test_metrics_callback{") == std::string::npos);
+
+    BOOST_CHECK(text.find("# TYPE test_metrics_events counter\n") != std::string::npos);
+    BOOST_CHECK(text.find("# HELP test_metrics_events Test \"events\".\\nSecond line.\n") != std::string::npos);
+    BOOST_CHECK(text.find("test_metrics_events_total{kind=\"a\\\"b\"} 5\n") != std::string::npos);
+    BOOST_CHECK(text.find("test_metrics_level 1.5\n") != std::string::npos);
+    BOOST_CHECK(text.find("test_metrics_latency_seconds_bucket{le=\"0.1\"} 2\n") != std::string::npos);
+    BOOST_CHECK(text.find("test_metrics_latency_seconds_bucket{le=\"1\"} 3\n") != std::string::npos);
+    BOOST_CHECK(text.find("test_metrics_latency_seconds_bucket{le=\"+Inf\"} 4\n") != std::string::npos);
+    BOOST_CHECK(text.find("test_metrics_latency_seconds_count 4\n") != std::string::npos);
+    BOOST_CHECK(text.ends_with("# EOF\n"));
+}
+
+BOOST_AUTO_TEST_CASE(Test2_componentMetrics)
+{
+    using casil::Device;
+    using casil::Metrics;
+    using casil::TL::DirectInterface;
+
+    Device d("{transfer_layer: [{name: intf, type: TCP, init: {address: 127.0.0.1, port: 10354, read_termination: \"\\n\"}},"
+                               "{name: board, type: SiTCP, init: {ip: 127.0.0.1, udp_port: 4660}}],"
+              "hw_drivers: [], registers: []}");
+
+    const Metrics::Labels labels = {{"layer", "TL"}, {"type", "TCP"}, {"name", "intf"}};
+
+    const std::uint64_t bytesReadBefore = Metrics::counter("casil_interface_read_bytes", "", labels).getValue();
+    const std::uint64_t bytesWrittenBefore = Metrics::counter("casil_interface_written_bytes", "", labels).getValue();
+    const std::uint64_t transactionsBefore = Metrics::counter("casil_interface_transactions", "", labels).getValue();
+
+    std::atomic_bool handlerCompleted(false);
+
+    using boost::asio::ip::tcp;
+    tcp::acceptor acceptor(casil::ASIO::getIOContext(), tcp::endpoint(tcp::v4(), 10354), false);
+    tcp::socket socket(casil::ASIO::getIOContext());
+
+    {
+        casil::Auxil::AsyncIORunner<2> ioRunner;
+        (void)ioRunner;
+
+        acceptor.async_accept(socket, [&handlerCompleted](const boost::system::error_code&) -> void
+                                      {
+                                          handlerCompleted.store(true);
+                                          handlerCompleted.notify_one();
+                                      });
+
+        DirectInterface& intf = dynamic_cast<DirectInterface&>(d.interface("intf"));
+
+        BOOST_REQUIRE(intf.init());
+
+        handlerCompleted.wait(false);
+
+        const std::vector<std::uint8_t> writeBuffer = {0x30u, 0x31, 0x32, '\n'};
+        boost::asio::write(socket, boost::asio::buffer(writeBuffer));
+
+        BOOST_CHECK(intf.read(-1) == (std::vector<std::uint8_t>{0x30u, 0x31, 0x32}));
+
+        intf.write({0x41, 0x42});
+
+        BOOST_CHECK(intf.close());
+    }
+
+    BOOST_CHECK_EQUAL(Metrics::counter("casil_interface_read_bytes", "", labels).getValue() - bytesReadBefore, 3u);
+    BOOST_CHECK_EQUAL(Metrics::counter("casil_interface_written_bytes", "", labels).getValue() - bytesWrittenBefore, 2u);
+    BOOST_CHECK_EQUAL(Metrics::counter("casil_interface_transactions", "", labels).getValue() - transactionsBefore, 2u);
+
+    const std::string text = Metrics::expose();
+
+    BOOST_CHECK(text.find("casil_interface_read_bytes_total{layer=\"TL\",type=\"TCP\",name=\"intf\"}") != std::string::npos);
+    BOOST_CHECK(text.find("casil_fifo_size_bytes{layer=\"TL\",type=\"SiTCP\",name=\"board\"} 0\n") != std::string::npos);
+    BOOST_CHECK(text.find("casil_rbcp_latency_seconds_bucket{layer=\"TL\",type=\"SiTCP\",name=\"board\",le=\"+Inf\"} 0\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(Test3_httpEndpoint)
+{
+    using casil::Metrics;
+
+    Metrics::gauge("test_metrics_http", "Test HTTP.").set(7);
+
+    casil::Auxil::AsyncIORunner<1> ioRunner;
+    (void)ioRunner;
+
+    BOOST_REQUIRE(Metrics::startHttpServer(0));
+
+    const std::uint16_t port = Metrics::getHttpPort();
+
+    BOOST_REQUIRE(port != 0);
+
+    auto httpGet = [port](const std::string& pPath) -> std::string
+    {
+        using boost::asio::ip::tcp;
+
+        boost::asio::io_context ioContext;
+        tcp::socket socket(ioContext);
+        socket.connect(tcp::endpoint(boost::asio::ip::make_address("127.0.0.1"), port));
+
+        const std::string request = "GET " + pPath + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+        boost::asio::write(socket, boost::asio::buffer(request));
+
+        std::string response;
+        boost::system::error_code ec;
+        boost::asio::read(socket, boost::asio::dynamic_buffer(response), ec);
+
+        return response;
+    };
+
+    const std::string response = httpGet("/metrics");
+
+    BOOST_CHECK(response.starts_with("HTTP/1.1 200 OK\r\n"));
+    BOOST_CHECK(response.find(std::string("Content-Type: ") + Metrics::contentType) != std::string::npos);
+    BOOST_CHECK(response.find("test_metrics_http 7\n") != std::string::npos);
+    BOOST_CHECK(response.ends_with("# EOF\n"));
+
+    BOOST_CHECK(httpGet("/other").starts_with("HTTP/1.1 404"));
+
+    Metrics::stopHttpServer();
+
+    BOOST_CHECK_EQUAL(Metrics::getHttpPort(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
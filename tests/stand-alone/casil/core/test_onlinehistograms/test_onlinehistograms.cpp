@@ -0,0 +1,147 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <casil/onlinehistograms.h>
+#include <casil/readoutpipeline.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using casil::FifoDecoder;
+using casil::OnlineHistograms;
+
+namespace
+{
+
+/*
+ * Record type with 2 bit "column" (bits 4-5), 2 bit "row" (bits 2-3) and 2 bit "tot" (bits 0-1).
+ */
+FifoDecoder::Rule makeHitRule()
+{
+    return FifoDecoder::Rule{.name = "hit", .mask = 0x80000000u, .value = 0x80000000u,
+                             .fields = {{.name = "column", .mask = 0x3, .shift = 4}, {.name = "row", .mask = 0x3, .shift = 2},
+                                        {.name = "tot", .mask = 0x3, .shift = 0}}};
+}
+
+std::uint32_t makeHit(const std::uint32_t pColumn, const std::uint32_t pRow, const std::uint32_t pTot)
+{
+    return 0x80000000u | (pColumn << 4) | (pRow << 2) | pTot;
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(OnlineHistograms_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_setup)
+{
+    const OnlineHistograms histograms(makeHitRule(), {{.name = "occupancy", .xField = "column", .yField = "row"},
+                                                      {.name = "tot", .xField = "tot", .yField = ""}});
+
+    BOOST_CHECK_EQUAL(histograms.findHistogram("tot"), 1);
+    BOOST_CHECK(histograms.getShape(0) == (std::vector<std::size_t>{4, 4}));
+    BOOST_CHECK(histograms.getShape(1) == (std::vector<std::size_t>{4}));
+    BOOST_CHECK(histograms.getSnapshot(0) == std::vector<std::uint64_t>(16, 0));
+    BOOST_CHECK_EQUAL(histograms.getNumRecords(), 0);
+    BOOST_CHECK_EQUAL(histograms.getNumAccumulators(), 0);
+
+    BOOST_CHECK_THROW(static_cast<void>(histograms.findHistogram("foo")), std::invalid_argument);
+    BOOST_CHECK_THROW(static_cast<void>(histograms.getShape(2)), std::invalid_argument);
+    BOOST_CHECK_THROW(static_cast<void>(histograms.getSnapshot(2)), std::invalid_argument);
+
+    BOOST_CHECK_THROW(OnlineHistograms(makeHitRule(), {{.name = "a", .xField = "foo", .yField = ""}}), std::invalid_argument);
+    BOOST_CHECK_THROW(OnlineHistograms(makeHitRule(), {{.name = "a", .xField = "tot", .yField = ""},
+                                                       {.name = "a", .xField = "row", .yField = ""}}), std::invalid_argument);
+
+    FifoDecoder::Rule largeRule = makeHitRule();
+    largeRule.fields[0].mask = 0x1FFFFF;
+
+    BOOST_CHECK_THROW(OnlineHistograms(largeRule, {{.name = "a", .xField = "column", .yField = "row"}}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_fillAndReset)
+{
+    auto histograms = std::make_shared<OnlineHistograms>(makeHitRule(),
+                                                         std::vector<OnlineHistograms::Definition>{
+                                                             {.name = "occupancy", .xField = "column", .yField = "row"},
+                                                             {.name = "tot", .xField = "tot", .yField = ""}});
+
+    const std::vector<std::uint32_t> words = {makeHit(1, 2, 3), 0x12345678u, makeHit(1, 2, 0), makeHit(3, 0, 3)};
+
+    //Fill concurrently from several threads, each with its own accumulator
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&histograms, &words]() -> void
+                             {
+                                 for (int j = 0; j < 1000; ++j)
+                                     histograms->fill(words);
+                             });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    BOOST_CHECK_EQUAL(histograms->getNumAccumulators(), 4);
+    BOOST_CHECK_EQUAL(histograms->getNumRecords(), 12000);
+
+    std::vector<std::uint64_t> expOccupancy(16, 0);
+    expOccupancy[1 * 4 + 2] = 8000;
+    expOccupancy[3 * 4 + 0] = 4000;
+
+    BOOST_CHECK(histograms->getSnapshot(0) == expOccupancy);
+    BOOST_CHECK(histograms->getSnapshot(1) == (std::vector<std::uint64_t>{4000, 0, 0, 8000}));
+
+    //Reset and fill via pipeline sink (only from source 1)
+
+    histograms->reset();
+
+    BOOST_CHECK(histograms->getSnapshot(1) == (std::vector<std::uint64_t>{0, 0, 0, 0}));
+
+    casil::ReadoutPipeline::HistogramSink sink(histograms, 1);
+
+    sink.consume(0, words);
+    sink.consume(1, words);
+
+    BOOST_CHECK_EQUAL(histograms->getNumAccumulators(), 5);
+    BOOST_CHECK_EQUAL(histograms->getNumRecords(), 3);
+    BOOST_CHECK(histograms->getSnapshot(1) == (std::vector<std::uint64_t>{1, 0, 0, 2}));
+
+    BOOST_CHECK_THROW(casil::ReadoutPipeline::HistogramSink(nullptr), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,156 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/device.h>
+#include <casil/pooledbuffer.h>
+#include <casil/TL/Muxed/simmuxed.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using casil::PooledBuffer;
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(PooledBuffer_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_recycling)
+{
+    PooledBuffer::clearThreadPool();
+
+    const PooledBuffer empty;
+
+    BOOST_CHECK(empty.empty());
+    BOOST_CHECK(empty.data() == nullptr);
+    BOOST_CHECK_EQUAL(empty.useCount(), 0);
+
+    const PooledBuffer::Statistics statsBefore = PooledBuffer::getStatistics();
+
+    const std::uint8_t* firstData = nullptr;
+
+    {
+        PooledBuffer buffer(100);
+
+        BOOST_CHECK_EQUAL(buffer.size(), 100);
+        BOOST_CHECK_EQUAL(buffer.capacity(), 512);
+
+        std::fill(buffer.span().begin(), buffer.span().end(), 7);
+
+        firstData = buffer.data();
+
+        //Copies share the block, moves take it over
+
+        PooledBuffer copy = buffer;
+
+        BOOST_CHECK_EQUAL(buffer.useCount(), 2);
+        BOOST_CHECK(copy.data() == firstData);
+
+        const PooledBuffer moved = std::move(copy);
+
+        BOOST_CHECK_EQUAL(moved.useCount(), 2);
+        BOOST_CHECK(copy.data() == nullptr);    // cppcheck-suppress accessMoved
+        BOOST_CHECK(moved.toVector() == std::vector<std::uint8_t>(100, 7));
+    }
+
+    //Block was returned to the free list and is reused for the same size class
+
+    {
+        PooledBuffer buffer(300);
+
+        BOOST_CHECK(buffer.data() == firstData);
+        BOOST_CHECK_EQUAL(buffer.useCount(), 1);
+
+        //Growing beyond the capacity moves the bytes into a block of a larger size class
+
+        buffer.span()[0] = 42;
+        buffer.resize(1000);
+
+        BOOST_CHECK(buffer.data() != firstData);
+        BOOST_CHECK_EQUAL(buffer.capacity(), 4096);
+        BOOST_CHECK_EQUAL(buffer.span()[0], 42);
+    }
+
+    //Buffers larger than the largest size class are not pooled
+
+    {
+        const PooledBuffer buffer(PooledBuffer::sizeClasses.back() + 1);
+
+        BOOST_CHECK_EQUAL(buffer.capacity(), PooledBuffer::sizeClasses.back() + 1);
+    }
+
+    const PooledBuffer::Statistics statsAfter = PooledBuffer::getStatistics();
+
+    BOOST_CHECK_EQUAL(statsAfter.blocksAcquired - statsBefore.blocksAcquired, 4);
+    BOOST_CHECK_EQUAL(statsAfter.blocksAllocated - statsBefore.blocksAllocated, 3);
+    BOOST_CHECK_EQUAL(statsAfter.blocksRecycled - statsBefore.blocksRecycled, 3);
+
+    //Buffers released by another thread go to the pool of that thread
+
+    PooledBuffer buffer(10);
+
+    std::thread([tBuffer = std::move(buffer)]() mutable { tBuffer = PooledBuffer(); }).join();
+
+    BOOST_CHECK_EQUAL(PooledBuffer::getStatistics().blocksRecycled - statsAfter.blocksRecycled, 1);
+
+    PooledBuffer::clearThreadPool();
+}
+
+BOOST_AUTO_TEST_CASE(Test2_readPooled)
+{
+    using casil::Device;
+    using casil::TL::SimMuxed;
+
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed, init: {mem_size: 64, fifo_rate: 1000000.0}}], hw_drivers: [], registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    SimMuxed& intf = dynamic_cast<SimMuxed&>(d.interface("intf"));
+
+    intf.write(10, {1, 2, 3});
+
+    const PooledBuffer buffer = intf.readPooled(9, 5);
+
+    BOOST_CHECK(buffer.toVector() == (std::vector<std::uint8_t>{0, 1, 2, 3, 0}));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    const PooledBuffer fifoData = intf.readPooled(SimMuxed::baseAddrDataLimit);
+
+    BOOST_CHECK(!fifoData.empty());
+    BOOST_CHECK_EQUAL(fifoData.size() % 4, 0);
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,319 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+
+#include <casil/bytes.h>
+#include <casil/rawdatafile.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using casil::RawDataReader;
+using casil::RawDataReceiver;
+using casil::RawDataWriter;
+
+namespace
+{
+
+/*
+ * Assemble a raw data stream/file with a single chunk with 'pNumWords' zero words, stored with 'pPayloadSize' zero bytes.
+ */
+std::vector<std::uint8_t> makeSingleChunkStream(const std::uint32_t pNumWords, const std::uint32_t pPayloadSize,
+                                                const RawDataReader::Compression pCompression)
+{
+    std::vector<std::uint8_t> stream;
+
+    casil::Bytes::composeBytesTo(std::back_inserter(stream), false, RawDataReader::fileMagic, RawDataReader::formatVersion,
+                                 std::uint64_t{0}, std::uint64_t{0}, std::uint64_t{0});
+    casil::Bytes::composeBytesTo(std::back_inserter(stream), false, RawDataReader::chunkMagic, std::uint32_t{0}, std::uint64_t{0},
+                                 std::uint64_t{0}, pNumWords, pPayloadSize, static_cast<std::uint16_t>(pCompression),
+                                 std::uint16_t{0}, std::uint32_t{0});
+
+    stream.resize(stream.size() + pPayloadSize, 0);
+
+    return stream;
+}
+
+/*
+ * Send 'pStream' to 'pReceiver' and return whether receiving it failed with an exception.
+ */
+bool receiveFails(RawDataReceiver& pReceiver, const std::vector<std::uint8_t>& pStream)
+{
+    std::exception_ptr receiveException;
+
+    std::thread receiveThread([&pReceiver, &receiveException]() -> void
+                              {
+                                  try
+                                  {
+                                      (void)pReceiver.receive([](const RawDataReader::ChunkInfo&, std::span<const std::uint32_t>) -> void {});
+                                  }
+                                  catch (const std::runtime_error&)
+                                  {
+                                      receiveException = std::current_exception();
+                                  }
+                              });
+
+    {
+        boost::asio::io_context ioContext;
+        boost::asio::ip::tcp::socket socket(ioContext);
+
+        socket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address("127.0.0.1"), pReceiver.getPort()));
+        boost::system::error_code ec;
+        boost::asio::write(socket, boost::asio::buffer(pStream), ec);
+    }
+
+    receiveThread.join();
+
+    return receiveException != nullptr;
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(RawDataFile_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_writeRead)
+{
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "casil_test_rawdatafile_1.crd";
+
+    std::filesystem::remove(filePath);
+
+    const std::uint64_t startTime = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                                   std::chrono::system_clock::now().time_since_epoch()).count());
+
+    //Use small buffers to exercise the aligned buffer hand-over
+
+    {
+        RawDataWriter writer(filePath.string(), 7, RawDataWriter::writeAlignment, 2);
+
+        BOOST_CHECK(writer.isOpen());
+        BOOST_CHECK_EQUAL(writer.getNextSequence(), 0);
+
+        for (std::uint32_t i = 0; i < 20; ++i)
+        {
+            std::vector<std::uint32_t> words(100 * i);
+            std::iota(words.begin(), words.end(), 1000 * i);
+            writer.writeChunk(words);
+        }
+
+        writer.writeChunk(std::vector<std::uint8_t>{0x01, 0x02, 0x03, 0x04});
+
+        BOOST_CHECK_THROW(writer.writeChunk(std::vector<std::uint8_t>{0x01, 0x02, 0x03}), std::invalid_argument);
+
+        writer.close();
+
+        BOOST_CHECK(!writer.isOpen());
+        BOOST_CHECK_THROW(writer.writeChunk(std::vector<std::uint32_t>{1}), std::runtime_error);
+
+        const RawDataWriter::Statistics stats = writer.getStatistics();
+
+        BOOST_CHECK_EQUAL(stats.chunksWritten, 21);
+        BOOST_CHECK_EQUAL(stats.wordsWritten, 19001);
+        BOOST_CHECK_EQUAL(stats.bytesWritten, std::filesystem::file_size(filePath));
+        BOOST_CHECK_GT(stats.fileWrites, 1);
+    }
+
+    const RawDataReader reader(filePath.string());
+
+    BOOST_CHECK(!reader.isTruncated());
+    BOOST_CHECK_EQUAL(reader.getValidSize(), std::filesystem::file_size(filePath));
+    BOOST_CHECK_GE(reader.getCreationTime(), startTime);
+    BOOST_REQUIRE_EQUAL(reader.getNumChunks(), 21);
+    BOOST_CHECK_EQUAL(reader.getNumWords(), 19001);
+
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        const RawDataReader::ChunkInfo& info = reader.getChunkInfo(i);
+
+        BOOST_CHECK_EQUAL(info.boardId, 7);
+        BOOST_CHECK_EQUAL(info.sequence, i);
+        BOOST_CHECK_EQUAL(info.numWords, 100 * i);
+        BOOST_CHECK_EQUAL(info.payloadSize, 400 * i);
+        BOOST_CHECK(info.compression == RawDataReader::Compression::None);
+        BOOST_CHECK_GE(info.timestamp, startTime);
+
+        std::vector<std::uint32_t> expWords(100 * i);
+        std::iota(expWords.begin(), expWords.end(), 1000 * i);
+
+        const std::span<const std::uint32_t> words = reader.getWords(i);
+
+        BOOST_CHECK(std::vector<std::uint32_t>(words.begin(), words.end()) == expWords);
+    }
+
+    BOOST_CHECK_EQUAL(reader.getWords(20)[0], 0x04030201u);
+
+    BOOST_CHECK_EQUAL(reader.findSequence(7, 12), 12);
+    BOOST_CHECK_EQUAL(reader.findSequence(7, 21), RawDataReader::npos);
+    BOOST_CHECK_EQUAL(reader.findSequence(8, 0), RawDataReader::npos);
+    BOOST_CHECK_EQUAL(reader.findTime(0), 0);
+    BOOST_CHECK_EQUAL(reader.findTime(reader.getChunkInfo(20).timestamp + 1), RawDataReader::npos);
+
+    BOOST_CHECK_THROW(static_cast<void>(reader.getChunkInfo(21)), std::invalid_argument);
+    BOOST_CHECK_THROW(static_cast<void>(reader.getWords(21)), std::invalid_argument);
+
+    std::filesystem::remove(filePath);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_appendTruncated)
+{
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "casil_test_rawdatafile_2.crd";
+
+    std::filesystem::remove(filePath);
+
+    {
+        RawDataWriter writer(filePath.string(), 1);
+        writer.writeChunk(std::vector<std::uint32_t>{1, 2, 3});
+        writer.writeChunk(std::vector<std::uint32_t>{4, 5});
+        writer.close();
+    }
+
+    //Simulate an incomplete chunk left by a crashed writer
+
+    const std::uint64_t validSize = std::filesystem::file_size(filePath);
+
+    {
+        std::ofstream file(filePath, std::ios_base::binary | std::ios_base::app);
+        file.write("CRDC0123456789", 14);
+    }
+
+    {
+        const RawDataReader reader(filePath.string());
+
+        BOOST_CHECK(reader.isTruncated());
+        BOOST_CHECK_EQUAL(reader.getValidSize(), validSize);
+        BOOST_CHECK_EQUAL(reader.getNumChunks(), 2);
+    }
+
+    //Continuing cuts off the incomplete chunk and continues the sequence numbers per board ID
+
+    {
+        RawDataWriter writer(filePath.string(), 1);
+
+        BOOST_CHECK_EQUAL(writer.getNextSequence(), 2);
+
+        writer.writeChunk(std::vector<std::uint32_t>{6});
+        writer.flush();
+
+        BOOST_CHECK_EQUAL(writer.getNextSequence(), 3);
+    }
+
+    {
+        RawDataWriter writer(filePath.string(), 2);
+
+        BOOST_CHECK_EQUAL(writer.getNextSequence(), 0);
+
+        writer.writeChunk(std::vector<std::uint32_t>{7, 8});
+    }
+
+    const RawDataReader reader(filePath.string());
+
+    BOOST_CHECK(!reader.isTruncated());
+    BOOST_REQUIRE_EQUAL(reader.getNumChunks(), 4);
+    BOOST_CHECK_EQUAL(reader.getNumWords(), 8);
+    BOOST_CHECK_EQUAL(reader.findSequence(1, 2), 2);
+    BOOST_CHECK_EQUAL(reader.findSequence(2, 0), 3);
+    BOOST_CHECK_EQUAL(reader.getWords(2)[0], 6);
+    BOOST_CHECK_EQUAL(reader.getWords(3)[1], 8);
+
+    std::filesystem::remove(filePath);
+}
+
+BOOST_AUTO_TEST_CASE(Test3_invalid)
+{
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "casil_test_rawdatafile_3.crd";
+
+    BOOST_CHECK_THROW(RawDataWriter("", 0), std::invalid_argument);
+    BOOST_CHECK_THROW(RawDataWriter(filePath.string(), 0, 100), std::invalid_argument);
+    BOOST_CHECK_THROW(RawDataWriter(filePath.string(), 0, RawDataWriter::writeAlignment, 1), std::invalid_argument);
+
+    {
+        std::ofstream file(filePath, std::ios_base::binary | std::ios_base::trunc);
+        file << "not a raw data file, but long enough for a header";
+    }
+
+    BOOST_CHECK_THROW(RawDataReader(filePath.string()), std::runtime_error);
+    BOOST_CHECK_THROW(RawDataWriter(filePath.string(), 0), std::runtime_error);
+
+    std::filesystem::remove(filePath);
+
+    BOOST_CHECK_THROW(RawDataReader(filePath.string()), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Test4_chunkSizeLimits)
+{
+    using Compression = RawDataReader::Compression;
+
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "casil_test_rawdatafile_4.crd";
+
+    //Word count that an LZ4 payload of the stated length cannot expand to
+
+    const std::vector<std::uint8_t> hugeLZ4Stream = makeSingleChunkStream(0xFFFFFFFF, 4, Compression::LZ4);
+
+    {
+        std::ofstream file(filePath, std::ios_base::binary | std::ios_base::trunc);
+        file.write(reinterpret_cast<const char*>(hugeLZ4Stream.data()), static_cast<std::streamsize>(hugeLZ4Stream.size()));
+    }
+
+    BOOST_CHECK_THROW(RawDataReader(filePath.string()), std::runtime_error);
+
+    std::filesystem::remove(filePath);
+
+    BOOST_CHECK_THROW(RawDataReceiver(0, "127.0.0.1", 0), std::invalid_argument);
+
+    RawDataReceiver receiver(0, "127.0.0.1");
+
+    BOOST_CHECK(receiveFails(receiver, hugeLZ4Stream));
+    BOOST_CHECK(!receiveFails(receiver, makeSingleChunkStream(16, 64, Compression::None)));
+
+    //Configurable maximum chunk size
+
+    RawDataReceiver limitedReceiver(0, "127.0.0.1", 64);
+
+    BOOST_CHECK(!receiveFails(limitedReceiver, makeSingleChunkStream(16, 64, Compression::None)));
+    BOOST_CHECK(receiveFails(limitedReceiver, makeSingleChunkStream(17, 68, Compression::None)));
+    BOOST_CHECK(receiveFails(limitedReceiver, makeSingleChunkStream(17, 4, Compression::LZ4)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
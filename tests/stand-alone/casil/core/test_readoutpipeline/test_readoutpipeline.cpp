@@ -0,0 +1,370 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/bytes.h>
+#include <casil/rawdatafile.h>
+#include <casil/readoutpipeline.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using casil::ReadoutPipeline;
+
+namespace boost { using casil::Bytes::operator<<; }
+
+namespace
+{
+
+//Produces a fixed number of blocks with consecutive words, then no more data
+class CountingSource final : public ReadoutPipeline::Source
+{
+public:
+    CountingSource(const std::uint32_t pFirstWord, const int pNumBlocks, const std::size_t pBlockSize) :
+        nextWord(pFirstWord),
+        remainingBlocks(pNumBlocks),
+        blockSize(pBlockSize)
+    {
+    }
+    //
+    ReadoutPipeline::BlockType read() override
+    {
+        if (remainingBlocks == 0)
+            return nullptr;
+
+        --remainingBlocks;
+
+        auto block = std::make_shared<std::vector<std::uint32_t>>(blockSize);
+
+        for (std::uint32_t& word : *block)
+            word = nextWord++;
+
+        return block;
+    }
+
+private:
+    std::uint32_t nextWord;
+    int remainingBlocks;
+    const std::size_t blockSize;
+};
+
+//Produces a fixed number of blocks that repeat a short word pattern (compressible), then no more data
+class PatternSource final : public ReadoutPipeline::Source
+{
+public:
+    PatternSource(const int pNumBlocks, const std::size_t pBlockSize) :
+        remainingBlocks(pNumBlocks),
+        blockSize(pBlockSize)
+    {
+    }
+    //
+    ReadoutPipeline::BlockType read() override
+    {
+        if (remainingBlocks == 0)
+            return nullptr;
+
+        --remainingBlocks;
+
+        auto block = std::make_shared<std::vector<std::uint32_t>>(blockSize);
+
+        for (std::size_t i = 0; i < blockSize; ++i)
+            (*block)[i] = 0x80000000u | static_cast<std::uint32_t>(i % 8);
+
+        return block;
+    }
+
+private:
+    int remainingBlocks;
+    const std::size_t blockSize;
+};
+
+//Doubles all words and drops blocks starting with a multiple of 100
+class DoublingDecoder final : public ReadoutPipeline::Decoder
+{
+public:
+    ReadoutPipeline::BlockType decode(std::size_t, ReadoutPipeline::BlockType pBlock) override
+    {
+        if (pBlock->front() % 100 == 0)
+            return nullptr;
+
+        auto block = std::make_shared<std::vector<std::uint32_t>>(*pBlock);
+
+        for (std::uint32_t& word : *block)
+            word *= 2;
+
+        return block;
+    }
+};
+
+void waitForBlocks(const ReadoutPipeline& pPipeline, const std::uint64_t pNumBlocks)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    while (pPipeline.getStatistics().blocksRead < pNumBlocks && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(2))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(ReadoutPipeline_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_setup)
+{
+    BOOST_CHECK_THROW(ReadoutPipeline(0), std::invalid_argument);
+    BOOST_CHECK_THROW(ReadoutPipeline(4, std::chrono::microseconds(0)), std::invalid_argument);
+
+    ReadoutPipeline pipeline;
+
+    BOOST_CHECK_THROW(pipeline.addSource(nullptr), std::invalid_argument);
+    BOOST_CHECK_THROW(pipeline.addSink(nullptr), std::invalid_argument);
+    BOOST_CHECK_THROW(ReadoutPipeline::CallbackSink(ReadoutPipeline::CallbackSink::CallbackType()), std::invalid_argument);
+
+    BOOST_CHECK_THROW(pipeline.start(), std::runtime_error);
+
+    BOOST_CHECK_EQUAL(pipeline.addSource(std::make_unique<CountingSource>(0, 1, 1)), 0);
+    BOOST_CHECK_EQUAL(pipeline.addSource(std::make_unique<CountingSource>(0, 1, 1)), 1);
+
+    BOOST_CHECK_THROW(pipeline.start(), std::runtime_error);
+
+    pipeline.addSink(std::make_unique<ReadoutPipeline::CallbackSink>([](std::size_t, std::span<const std::uint32_t>) -> void {}));
+
+    BOOST_CHECK(!pipeline.isRunning());
+    pipeline.start();
+    BOOST_CHECK(pipeline.isRunning());
+
+    BOOST_CHECK_THROW(pipeline.addSource(std::make_unique<CountingSource>(0, 1, 1)), std::runtime_error);
+    BOOST_CHECK_THROW(pipeline.setDecoder(nullptr), std::runtime_error);
+
+    pipeline.stop();
+    BOOST_CHECK(!pipeline.isRunning());
+}
+
+BOOST_AUTO_TEST_CASE(Test2_dataFlow)
+{
+    ReadoutPipeline pipeline(4, std::chrono::microseconds(100));
+
+    pipeline.addSource(std::make_unique<CountingSource>(1, 50, 10));       //Words 1...500
+    pipeline.addSource(std::make_unique<CountingSource>(1001, 50, 10));    //Words 1001...1500
+    pipeline.setDecoder(std::make_unique<DoublingDecoder>());
+
+    std::mutex dataMutex;
+    std::vector<std::vector<std::uint32_t>> sink1Data(2);
+    std::vector<std::vector<std::uint32_t>> sink2Data(2);
+
+    auto makeSink = [&dataMutex](std::vector<std::vector<std::uint32_t>>& pData) -> std::unique_ptr<ReadoutPipeline::Sink>
+    {
+        return std::make_unique<ReadoutPipeline::CallbackSink>(
+                    [&dataMutex, &pData](const std::size_t pSourceIndex, const std::span<const std::uint32_t> pWords) -> void
+                    {
+                        const std::lock_guard<std::mutex> dataLock(dataMutex);
+                        pData.at(pSourceIndex).insert(pData.at(pSourceIndex).end(), pWords.begin(), pWords.end());
+                    });
+    };
+
+    pipeline.addSink(makeSink(sink1Data));
+    pipeline.addSink(makeSink(sink2Data));
+
+    pipeline.start();
+    waitForBlocks(pipeline, 100);
+    pipeline.stop();
+
+    const ReadoutPipeline::Statistics stats = pipeline.getStatistics();
+
+    BOOST_CHECK_EQUAL(stats.blocksRead, 100);
+    BOOST_CHECK_EQUAL(stats.wordsRead, 1000);
+    BOOST_CHECK_EQUAL(stats.blocksDropped, 0);
+    BOOST_CHECK_EQUAL(stats.stageErrors, 0);
+
+    //All blocks arrive at all sinks in order per source
+
+    std::vector<std::uint32_t> expected0;
+    std::vector<std::uint32_t> expected1;
+
+    for (std::uint32_t i = 1; i <= 500; ++i)
+    {
+        expected0.push_back(2 * i);
+        expected1.push_back(2 * (i + 1000));
+    }
+
+    BOOST_CHECK(sink1Data[0] == expected0);
+    BOOST_CHECK(sink1Data[1] == expected1);
+    BOOST_CHECK(sink2Data == sink1Data);
+}
+
+BOOST_AUTO_TEST_CASE(Test3_dropAndBackPressure)
+{
+    ReadoutPipeline pipeline(1, std::chrono::microseconds(100));
+
+    pipeline.addSource(std::make_unique<CountingSource>(0, 20, 50));       //Every second block starts with multiple of 100
+    pipeline.setDecoder(std::make_unique<DoublingDecoder>());
+
+    std::atomic_int numBlocks(0);
+
+    pipeline.addSink(std::make_unique<ReadoutPipeline::CallbackSink>(
+                         [&numBlocks](std::size_t, std::span<const std::uint32_t>) -> void
+                         {
+                             std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                             ++numBlocks;
+                         }));
+
+    pipeline.start();
+    waitForBlocks(pipeline, 20);
+    pipeline.stop();
+
+    const ReadoutPipeline::Statistics stats = pipeline.getStatistics();
+
+    BOOST_CHECK_EQUAL(stats.blocksRead, 20);
+    BOOST_CHECK_EQUAL(stats.blocksDropped, 10);
+    BOOST_CHECK(stats.sourceStalls > 0);
+    BOOST_CHECK_EQUAL(numBlocks.load(), 10);    //Queues drained on stop
+}
+
+BOOST_AUTO_TEST_CASE(Test4_rawFileSink)
+{
+    const std::filesystem::path basePath = std::filesystem::temp_directory_path() / "casil_test_readoutpipeline";
+
+    std::filesystem::remove(basePath.string() + ".0000");
+    std::filesystem::remove(basePath.string() + ".0001");
+
+    ReadoutPipeline pipeline(4, std::chrono::microseconds(100));
+
+    pipeline.addSource(std::make_unique<CountingSource>(0x01020304u, 2, 2));
+    pipeline.addSource(std::make_unique<CountingSource>(0xAABBCCDDu, 2, 2));
+    pipeline.addSink(std::make_unique<ReadoutPipeline::RawFileSink>(basePath.string(), 1024, 0, 0));
+
+    pipeline.start();
+    waitForBlocks(pipeline, 4);
+    pipeline.stop();
+
+    BOOST_REQUIRE(std::filesystem::exists(basePath.string() + ".0000"));
+    BOOST_CHECK(!std::filesystem::exists(basePath.string() + ".0001"));
+
+    std::ifstream file(basePath.string() + ".0000", std::ios::binary);
+    const std::vector<std::uint8_t> content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+    BOOST_REQUIRE_EQUAL(content.size(), 16 + 16);
+
+    BOOST_CHECK_EQUAL(casil::Bytes::composeUInt32(std::span<const std::uint8_t>(content).first<4>(), false), 0x43444643u);
+    BOOST_CHECK_EQUAL(casil::Bytes::composeUInt32(std::span<const std::uint8_t>(content).subspan<4, 4>(), false), 16u);
+
+    //Only words of source 0, little endian
+    BOOST_CHECK_EQUAL(std::vector<std::uint8_t>(content.begin() + 16, content.end()),
+                      (std::vector<std::uint8_t>{0x04, 0x03, 0x02, 0x01, 0x05, 0x03, 0x02, 0x01,
+                                                 0x06, 0x03, 0x02, 0x01, 0x07, 0x03, 0x02, 0x01}));
+
+    file.close();
+
+    std::filesystem::remove(basePath.string() + ".0000");
+}
+
+BOOST_AUTO_TEST_CASE(Test5_networkSink)
+{
+    using casil::RawDataReader;
+    using casil::RawDataReceiver;
+
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "casil_test_readoutpipeline_network.crd";
+
+    std::filesystem::remove(filePath);
+
+    BOOST_CHECK_THROW(ReadoutPipeline::NetworkSink("", 1234), std::invalid_argument);
+    BOOST_CHECK_THROW(ReadoutPipeline::NetworkSink("127.0.0.1", 0), std::invalid_argument);
+
+    RawDataReceiver receiver(0, "127.0.0.1");
+
+    RawDataReceiver::Statistics receiverStats {};
+
+    std::thread receiveThread([&receiver, &receiverStats, &filePath]() -> void { receiverStats = receiver.receiveToFile(filePath.string()); });
+
+    ReadoutPipeline pipeline(4, std::chrono::microseconds(100));
+
+    pipeline.addSource(std::make_unique<CountingSource>(0, 20, 500));
+    pipeline.addSource(std::make_unique<PatternSource>(20, 500));
+    pipeline.addSource(std::make_unique<CountingSource>(7, 20, 3));
+    pipeline.addSink(std::make_unique<ReadoutPipeline::NetworkSink>("127.0.0.1", receiver.getPort(), true, 4096));
+
+    pipeline.start();
+    waitForBlocks(pipeline, 60);
+    pipeline.stop();
+
+    receiveThread.join();
+
+    BOOST_CHECK_EQUAL(pipeline.getStatistics().stageErrors, 0);
+
+    BOOST_CHECK_EQUAL(receiverStats.chunksReceived, 60);
+    BOOST_CHECK_EQUAL(receiverStats.wordsReceived, 20 * (500 + 500 + 3));
+    BOOST_CHECK_EQUAL(receiverStats.compressedChunks, 20);
+    BOOST_CHECK_LT(receiverStats.bytesReceived, 4 * receiverStats.wordsReceived);
+
+    const RawDataReader reader(filePath.string());
+
+    BOOST_REQUIRE_EQUAL(reader.getNumChunks(), 60);
+    BOOST_CHECK_EQUAL(reader.getNumWords(), receiverStats.wordsReceived);
+    BOOST_CHECK(!reader.isTruncated());
+
+    std::vector<std::vector<std::uint32_t>> words(3);
+
+    for (std::size_t i = 0; i < reader.getNumChunks(); ++i)
+    {
+        const RawDataReader::ChunkInfo& info = reader.getChunkInfo(i);
+
+        BOOST_REQUIRE_LT(info.boardId, 3);
+        BOOST_CHECK(info.compression == RawDataReader::Compression::None);
+        BOOST_CHECK_EQUAL(reader.findSequence(info.boardId, info.sequence), i);
+
+        const std::vector<std::uint32_t> chunkWords = reader.decodeWords(i);
+        words[info.boardId].insert(words[info.boardId].end(), chunkWords.begin(), chunkWords.end());
+    }
+
+    for (std::size_t i = 0; i < words[0].size(); ++i)
+        BOOST_REQUIRE_EQUAL(words[0][i], i);
+
+    BOOST_CHECK_EQUAL(words[0].size(), 20 * 500);
+    BOOST_CHECK_EQUAL(words[1].size(), 20 * 500);
+    BOOST_CHECK_EQUAL(words[1][9], 0x80000001u);
+    BOOST_CHECK_EQUAL(words[2].size(), 20 * 3);
+    BOOST_CHECK_EQUAL(words[2].back(), 7u + 20 * 3 - 1);
+
+    std::filesystem::remove(filePath);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
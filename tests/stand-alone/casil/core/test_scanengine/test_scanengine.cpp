@@ -0,0 +1,152 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/device.h>
+#include <casil/scanengine.h>
+
+#include "../../components/HL/test_registerdriver/fakeinterface.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+using casil::ScanEngine;
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(ScanEngine_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_parseProgram)
+{
+    const ScanEngine::Program program = ScanEngine::parseProgram("{parameter: {name: thr, start: 2, stop: 11, step: 3},"
+                                                                 " steps: [{action: set, driver: drv, register: TESTVAL, value: $scan},"
+                                                                 "         {action: set, driver: drv, register: TESTARR, value: [1, 2]},"
+                                                                 "         {action: wait, driver: drv},"
+                                                                 "         {action: sleep, duration: 5},"
+                                                                 "         {action: read_fifo, driver: fifo}]}");
+
+    BOOST_CHECK_EQUAL(program.parameterName, "thr");
+    BOOST_CHECK(program.parameterValues == (std::vector<std::uint64_t>{2, 5, 8}));
+
+    BOOST_REQUIRE_EQUAL(program.steps.size(), 5);
+    BOOST_CHECK(program.steps[0].action == ScanEngine::Action::Set);
+    BOOST_CHECK(std::holds_alternative<std::monostate>(program.steps[0].value));
+    BOOST_CHECK(std::get<std::vector<std::uint8_t>>(program.steps[1].value) == (std::vector<std::uint8_t>{1, 2}));
+    BOOST_CHECK(program.steps[2].action == ScanEngine::Action::Wait);
+    BOOST_CHECK_EQUAL(program.steps[2].duration.count(), 1000);
+    BOOST_CHECK(program.steps[3].action == ScanEngine::Action::Sleep);
+    BOOST_CHECK_EQUAL(program.steps[3].duration.count(), 5);
+    BOOST_CHECK(program.steps[4].action == ScanEngine::Action::ReadFifo);
+
+    BOOST_CHECK(ScanEngine::parseProgram("{parameter: {name: x, values: [7, 3]}, steps: [{action: sleep, duration: 0}]}").parameterValues ==
+                (std::vector<std::uint64_t>{7, 3}));
+
+    BOOST_CHECK_THROW(ScanEngine::parseProgram("{parameter: {name: x, values: [1]}}"), std::runtime_error);
+    BOOST_CHECK_THROW(ScanEngine::parseProgram("{steps: [{action: jump, driver: drv}]}"), std::runtime_error);
+    BOOST_CHECK_THROW(ScanEngine::parseProgram("{steps: [{action: set, driver: drv, register: TESTVAL}]}"), std::runtime_error);
+    BOOST_CHECK_THROW(ScanEngine::parseProgram("{steps: [{action: read, driver: drv}]}"), std::runtime_error);
+    BOOST_CHECK_THROW(ScanEngine::parseProgram("{parameter: {name: x, start: 3, stop: 3}, steps: [{action: sleep, duration: 0}]}"),
+                      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_run)
+{
+    using casil::TL::FakeInterface;
+
+    //Using TestRegDriver and FakeInterface from RegisterDriver test
+    casil::Device d("{transfer_layer: [{name: intf, type: FakeInterface}],"
+                    "hw_drivers: [{name: drv, type: TestRegDriver, interface: intf, base_addr: 0x135F}],"
+                    "registers: []}");
+
+    BOOST_REQUIRE(d.init());
+
+    //Unknown drivers/registers and wrong driver types are rejected up front
+
+    BOOST_CHECK_THROW(ScanEngine(d, ScanEngine::parseProgram("{steps: [{action: trigger, driver: nodrv, register: TRIGGER}]}")),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(ScanEngine(d, ScanEngine::parseProgram("{steps: [{action: read, driver: drv, register: NOREG}]}")),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(ScanEngine(d, ScanEngine::parseProgram("{steps: [{action: read_fifo, driver: drv}]}")), std::invalid_argument);
+
+    ScanEngine engine(d, ScanEngine::parseProgram("{parameter: {name: val, start: 0x100, stop: 0x105},"
+                                                  " steps: [{action: set, driver: drv, register: TESTVAL, value: $scan},"
+                                                  "         {action: set, driver: drv, register: TESTARR, value: [0x11, 0x22]},"
+                                                  "         {action: trigger, driver: drv, register: TRIGGER},"
+                                                  "         {action: wait, driver: drv, timeout: 100},"
+                                                  "         {action: read, driver: drv, register: TESTARR},"
+                                                  "         {action: read, driver: drv, register: TESTVAL}]}"));
+
+    BOOST_CHECK_EQUAL(engine.getNumOperations(), 4);
+
+    const FakeInterface& intf = dynamic_cast<const FakeInterface&>(d.interface("intf"));
+
+    const int readsBefore = intf.getReadCount();
+    const int writesBefore = intf.getWriteCount();
+
+    const ScanEngine::Result result = engine.run();
+
+    //Merged set and trigger are one write each, merged read is a single read per parameter value
+    BOOST_CHECK_EQUAL(intf.getWriteCount() - writesBefore, 5 * 2);
+    BOOST_CHECK_EQUAL(intf.getReadCount() - readsBefore, 5 * 1);
+
+    BOOST_CHECK(!result.aborted);
+    BOOST_CHECK_EQUAL(result.parameterName, "val");
+    BOOST_CHECK(result.readNames == (std::vector<std::string>{"drv.TESTARR", "drv.TESTVAL"}));
+
+    BOOST_REQUIRE_EQUAL(result.points.size(), 5);
+
+    for (std::uint64_t i = 0; i < 5; ++i)
+    {
+        const ScanEngine::Point& point = result.points[i];
+
+        BOOST_CHECK_EQUAL(point.parameter, 0x100 + i);
+        BOOST_REQUIRE_EQUAL(point.readValues.size(), 2);
+        BOOST_CHECK(std::get<std::vector<std::uint8_t>>(point.readValues[0]) == (std::vector<std::uint8_t>{0x11, 0x22}));
+        BOOST_CHECK_EQUAL(std::get<std::uint64_t>(point.readValues[1]), 0x100 + i);
+        BOOST_CHECK_EQUAL(point.fifoWords, 0);
+    }
+
+    const ScanEngine::Statistics stats = engine.getStatistics();
+
+    BOOST_CHECK_EQUAL(stats.pointsExecuted, 5);
+    BOOST_CHECK_EQUAL(stats.stepsExecuted, 5 * 6);
+    BOOST_CHECK_EQUAL(stats.batchesExecuted, 5 * 4);
+
+    //Scan parameter cannot be written to a byte array register
+
+    ScanEngine wrongEngine(d, ScanEngine::parseProgram("{steps: [{action: set, driver: drv, register: TESTARR, value: $scan}]}"));
+
+    BOOST_CHECK_THROW(wrongEngine.run(), std::invalid_argument);
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,114 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/scheduler.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using casil::Scheduler;
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(Scheduler_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_periodicAndOnce)
+{
+    using namespace std::chrono_literals;
+
+    Scheduler scheduler(100us);
+
+    BOOST_CHECK(!scheduler.isPinned());
+    BOOST_CHECK(scheduler.getSpinMargin() == 100us);
+
+    BOOST_CHECK_THROW(scheduler.schedulePeriodic([]() -> void {}, 0ms), std::invalid_argument);
+    BOOST_CHECK_THROW(scheduler.scheduleOnce([]() -> void {}, -1ms), std::invalid_argument);
+
+    std::atomic_int periodicCount = 0;
+    std::atomic_int onceCount = 0;
+
+    const Scheduler::ActionId periodicId = scheduler.schedulePeriodic([&periodicCount]() -> void { ++periodicCount; }, 2ms);
+    const Scheduler::ActionId onceId = scheduler.scheduleOnce([&onceCount]() -> void { ++onceCount; }, 5ms);
+
+    BOOST_CHECK(periodicId != onceId);
+
+    std::this_thread::sleep_for(100ms);
+
+    //One-shot action is removed after its execution
+
+    BOOST_CHECK_EQUAL(onceCount.load(), 1);
+    BOOST_CHECK(!scheduler.isScheduled(onceId));
+    BOOST_CHECK_THROW((void)scheduler.getStatistics(onceId), std::invalid_argument);
+
+    const Scheduler::ActionStatistics stats = scheduler.getStatistics(periodicId);
+
+    BOOST_CHECK(stats.executions >= 20 && stats.executions <= 51);
+    BOOST_CHECK_EQUAL(stats.failures, 0);
+    BOOST_CHECK(stats.meanLateness <= stats.maxLateness);
+
+    //No further executions after cancelling
+
+    BOOST_CHECK(scheduler.cancel(periodicId));
+    BOOST_CHECK(!scheduler.cancel(periodicId));
+
+    std::this_thread::sleep_for(10ms);
+
+    const int countAfterCancel = periodicCount.load();
+
+    std::this_thread::sleep_for(20ms);
+
+    BOOST_CHECK_EQUAL(periodicCount.load(), countAfterCancel);
+}
+
+BOOST_AUTO_TEST_CASE(Test2_overrunsAndFailures)
+{
+    using namespace std::chrono_literals;
+
+    Scheduler scheduler(0us);
+
+    const Scheduler::ActionId slowId = scheduler.schedulePeriodic([]() -> void { std::this_thread::sleep_for(5ms); }, 1ms);
+    const Scheduler::ActionId failingId = scheduler.schedulePeriodic([]() -> void { throw std::runtime_error("Fails."); }, 10ms);
+
+    std::this_thread::sleep_for(50ms);
+
+    const Scheduler::ActionStatistics slowStats = scheduler.getStatistics(slowId);
+
+    BOOST_CHECK(slowStats.executions >= 1);
+    BOOST_CHECK(slowStats.overruns >= 3 * slowStats.executions - 3);
+
+    const Scheduler::ActionStatistics failingStats = scheduler.getStatistics(failingId);
+
+    BOOST_CHECK(failingStats.executions >= 1);
+    BOOST_CHECK_EQUAL(failingStats.failures, failingStats.executions);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,205 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/device.h>
+#include <casil/slowcontrolarchiver.h>
+#include <casil/slowcontrolpoller.h>
+#include <casil/HL/Muxed/gpio.h>
+#include <casil/TL/Muxed/simmuxed.h>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using casil::Device;
+using casil::SlowControlArchiver;
+using casil::SlowControlPoller;
+
+namespace
+{
+
+std::string getArchivePath()
+{
+    return "/tmp/casil_test_slowcontrolarchiver_" + std::to_string(::getpid()) + ".lp";
+}
+
+} // namespace
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(SlowControlArchiver_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_file)
+{
+    using casil::HL::GPIO;
+    using casil::TL::SimMuxed;
+
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed, init: {mem_size: 64}}],"
+             " hw_drivers: [{name: gpio, type: GPIO, interface: intf, base_addr: 16, size: 8}], registers: []}");
+
+    BOOST_REQUIRE(d["intf"].init());
+
+    dynamic_cast<SimMuxed&>(d.interface("intf")).write(16, {0x00, 0xAB, 0x00, 0xCD});
+
+    const GPIO& gpio = dynamic_cast<GPIO&>(d["gpio"]);
+
+    SlowControlPoller poller(std::chrono::milliseconds(10));
+
+    BOOST_CHECK_THROW(SlowControlArchiver(poller, SlowControlArchiver::Backend::File, getArchivePath(), std::chrono::milliseconds::zero()),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(SlowControlArchiver(poller, SlowControlArchiver::Backend::UDP, "localhost"), std::invalid_argument);
+    BOOST_CHECK_THROW(SlowControlArchiver(poller, SlowControlArchiver::Backend::File, "/nonexistent/dir/archive.lp"), std::runtime_error);
+
+    std::remove(getArchivePath().c_str());
+
+    {
+        SlowControlArchiver archiver(poller, SlowControlArchiver::Backend::File, getArchivePath(), std::chrono::milliseconds(50), "daq");
+
+        const auto inputId = poller.subscribe(gpio, "INPUT", std::chrono::milliseconds(20), [](const SlowControlPoller::ValueType&) {});
+        const auto outputId = poller.subscribe(gpio, "OUTPUT_EN", std::chrono::milliseconds(20), [](const SlowControlPoller::ValueType&) {});
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+        BOOST_CHECK(poller.unsubscribe(inputId));
+        BOOST_CHECK(poller.unsubscribe(outputId));
+
+        BOOST_CHECK(archiver.flush());
+
+        const SlowControlArchiver::Statistics stats = archiver.getStatistics();
+
+        BOOST_CHECK(stats.samples > 4);
+        BOOST_CHECK_EQUAL(stats.samplesWritten, stats.samples);
+        BOOST_CHECK_EQUAL(stats.samplesDropped, 0);
+        BOOST_CHECK(stats.flushes > 1);
+        BOOST_CHECK_EQUAL(stats.failures, 0);
+        BOOST_CHECK_EQUAL(archiver.getPendingSamples(), 0);
+    }
+
+    //One line per sample with the item path as channel tag
+
+    std::ifstream file(getArchivePath());
+    std::string line;
+
+    int inputLines = 0;
+    int outputLines = 0;
+
+    while (std::getline(file, line))
+    {
+        if (line.starts_with("daq,channel=gpio.INPUT value=\"ab\" "))
+            ++inputLines;
+        else if (line.starts_with("daq,channel=gpio.OUTPUT_EN value=\"cd\" "))
+            ++outputLines;
+        else
+            BOOST_ERROR("Unexpected line: " + line);
+    }
+
+    BOOST_CHECK(inputLines > 2);
+    BOOST_CHECK_EQUAL(inputLines, outputLines);
+
+    std::remove(getArchivePath().c_str());
+
+    //Full blocks drop samples
+
+    {
+        SlowControlArchiver archiver(poller, SlowControlArchiver::Backend::File, getArchivePath(), std::chrono::milliseconds(10000),
+                                     "daq", 1);
+
+        const auto inputId = poller.subscribe(gpio, "INPUT", std::chrono::milliseconds(20), [](const SlowControlPoller::ValueType&) {});
+        const auto outputId = poller.subscribe(gpio, "OUTPUT_EN", std::chrono::milliseconds(20), [](const SlowControlPoller::ValueType&) {});
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        BOOST_CHECK(poller.unsubscribe(inputId));
+        BOOST_CHECK(poller.unsubscribe(outputId));
+
+        BOOST_CHECK(archiver.flush());
+
+        const SlowControlArchiver::Statistics stats = archiver.getStatistics();
+
+        BOOST_CHECK(stats.samplesDropped > 0);
+        BOOST_CHECK(stats.samplesWritten > 0);
+        BOOST_CHECK_EQUAL(stats.samplesWritten + stats.samplesDropped, stats.samples);
+    }
+
+    std::remove(getArchivePath().c_str());
+}
+
+BOOST_AUTO_TEST_CASE(Test2_udp)
+{
+    using casil::HL::GPIO;
+    using casil::TL::SimMuxed;
+    using boost::asio::ip::udp;
+
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed, init: {mem_size: 64}}],"
+             " hw_drivers: [{name: gpio, type: GPIO, interface: intf, base_addr: 16, size: 8}], registers: []}");
+
+    BOOST_REQUIRE(d["intf"].init());
+
+    dynamic_cast<SimMuxed&>(d.interface("intf")).write(16, {0x00, 0x12});
+
+    boost::asio::io_context ioContext;
+    udp::socket receiver(ioContext, udp::endpoint(boost::asio::ip::make_address("127.0.0.1"), 0));
+
+    SlowControlPoller poller(std::chrono::milliseconds(10));
+
+    {
+        SlowControlArchiver archiver(poller, SlowControlArchiver::Backend::UDP,
+                                     "127.0.0.1:" + std::to_string(receiver.local_endpoint().port()), std::chrono::milliseconds(20));
+
+        BOOST_CHECK(archiver.getBackend() == SlowControlArchiver::Backend::UDP);
+
+        const auto id = poller.subscribe(dynamic_cast<GPIO&>(d["gpio"]), "INPUT", std::chrono::milliseconds(10),
+                                         [](const SlowControlPoller::ValueType&) {});
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        BOOST_CHECK(poller.unsubscribe(id));
+    }
+
+    std::vector<char> datagram(SlowControlArchiver::maxDatagramSize);
+
+    const std::size_t size = receiver.receive(boost::asio::buffer(datagram));
+
+    BOOST_CHECK(size <= SlowControlArchiver::maxDatagramSize);
+    BOOST_CHECK(std::string(datagram.data(), size).starts_with("casil,channel=gpio.INPUT value=\"12\" "));
+    BOOST_CHECK(std::string(datagram.data(), size).ends_with("\n"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,241 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/device.h>
+#include <casil/slowcontrolpoller.h>
+#include <casil/HL/Direct/scpi.h>
+#include <casil/HL/Muxed/gpio.h>
+#include <casil/TL/Muxed/simmuxed.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+using casil::Device;
+using casil::SlowControlPoller;
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(SlowControlPoller_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_coalescing)
+{
+    using casil::HL::GPIO;
+    using casil::TL::SimMuxed;
+
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed, init: {mem_size: 64}}],"
+             " hw_drivers: [{name: gpio, type: GPIO, interface: intf, base_addr: 16, size: 8}], registers: []}");
+
+    BOOST_REQUIRE(d["intf"].init());
+
+    dynamic_cast<SimMuxed&>(d.interface("intf")).write(16, {0x00, 0xAB, 0x00, 0xCD});
+
+    const GPIO& gpio = dynamic_cast<GPIO&>(d["gpio"]);
+
+    BOOST_CHECK_THROW(SlowControlPoller(std::chrono::milliseconds::zero()), std::invalid_argument);
+
+    SlowControlPoller poller(std::chrono::milliseconds(10));
+
+    BOOST_CHECK(poller.getTick() == std::chrono::milliseconds(10));
+
+    BOOST_CHECK_THROW(poller.subscribe(gpio, "NONEXISTENT", std::chrono::milliseconds(20), [](const SlowControlPoller::ValueType&) {}),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(poller.subscribe(gpio, "INPUT", std::chrono::milliseconds::zero(), [](const SlowControlPoller::ValueType&) {}),
+                      std::invalid_argument);
+
+    std::atomic_int fastCount = 0;
+    std::atomic_int slowCount = 0;
+    std::atomic_int otherCount = 0;
+
+    const std::vector<std::uint8_t> expectedInput = {0xAB};
+
+    const auto fastId = poller.subscribe(gpio, "INPUT", std::chrono::milliseconds(20),
+                                         [&fastCount, &expectedInput](const SlowControlPoller::ValueType& pValue)
+                                         {
+                                             if (std::get<std::vector<std::uint8_t>>(pValue) == expectedInput)
+                                                 ++fastCount;
+                                         });
+    const auto slowId = poller.subscribe(gpio, "INPUT", std::chrono::milliseconds(80),
+                                         [&slowCount](const SlowControlPoller::ValueType&) { ++slowCount; });
+    const auto otherId = poller.subscribe(gpio, "OUTPUT_EN", std::chrono::milliseconds(20),
+                                          [&otherCount](const SlowControlPoller::ValueType&) { ++otherCount; });
+
+    //Identical readings are merged into a single item
+
+    BOOST_CHECK_EQUAL(poller.getItemCount(), 2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+
+    BOOST_CHECK(fastCount > 0);
+    BOOST_CHECK(slowCount > 0);
+    BOOST_CHECK(fastCount > slowCount);
+    BOOST_CHECK(otherCount > 0);
+
+    BOOST_CHECK(std::get<std::vector<std::uint8_t>>(poller.getCachedValue(slowId)) == expectedInput);
+    BOOST_CHECK(std::get<std::vector<std::uint8_t>>(poller.getCachedValue(otherId)) == std::vector<std::uint8_t>{0xCD});
+
+    //Items with the same aligned period are read with a single batched read
+
+    const SlowControlPoller::Statistics stats = poller.getStatistics();
+
+    BOOST_CHECK(stats.batches > 0);
+    BOOST_CHECK(stats.itemReads <= 2 * stats.batches);
+    BOOST_CHECK(stats.itemReads > stats.batches);
+    BOOST_CHECK_EQUAL(stats.failures, 0);
+
+    BOOST_CHECK(poller.unsubscribe(fastId));
+    BOOST_CHECK(poller.unsubscribe(slowId));
+    BOOST_CHECK(!poller.unsubscribe(slowId));
+
+    BOOST_CHECK_EQUAL(poller.getItemCount(), 1);
+    BOOST_CHECK(std::holds_alternative<std::monostate>(poller.getCachedValue(fastId)));
+
+    BOOST_CHECK(poller.unsubscribe(otherId));
+
+    BOOST_CHECK_EQUAL(poller.getItemCount(), 0);
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_CASE(Test2_scpiQueriesOnly)
+{
+    using casil::HL::SCPI;
+
+    Device d("{transfer_layer: [{name: intf, type: DummyInterface}],"
+             " hw_drivers: [{name: drv, type: SCPI, interface: intf, init: {device: \"Keithley 2400\"}}], registers: []}");
+
+    const SCPI& scpi = dynamic_cast<SCPI&>(d["drv"]);
+
+    SlowControlPoller poller(std::chrono::milliseconds(10));
+
+    BOOST_CHECK_THROW(poller.subscribe(scpi, "off", std::nullopt, std::chrono::milliseconds(20), [](const SlowControlPoller::ValueType&) {}),
+                      std::invalid_argument);
+
+    std::atomic_int count = 0;
+
+    const auto id = poller.subscribe(scpi, "get_current", std::nullopt, std::chrono::milliseconds(20),
+                                     [&count](const SlowControlPoller::ValueType&) { ++count; });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    BOOST_CHECK(count > 0);
+    BOOST_CHECK(poller.unsubscribe(id));
+}
+
+BOOST_AUTO_TEST_CASE(Test3_snapshotCache)
+{
+    using casil::HL::GPIO;
+    using casil::TL::SimMuxed;
+
+    Device d("{transfer_layer: [{name: intf, type: SimMuxed, init: {mem_size: 64}}],"
+             " hw_drivers: [{name: gpio, type: GPIO, interface: intf, base_addr: 16, size: 8}], registers: []}");
+
+    BOOST_REQUIRE(d["intf"].init());
+
+    SimMuxed& intf = dynamic_cast<SimMuxed&>(d.interface("intf"));
+    intf.write(16, {0x00, 0x12});
+
+    SlowControlPoller poller(std::chrono::milliseconds(10));
+
+    BOOST_CHECK(poller.getPaths().empty());
+    BOOST_CHECK(poller.getLatest("gpio.INPUT") == nullptr);
+
+    const auto id = poller.subscribe(dynamic_cast<GPIO&>(d["gpio"]), "INPUT", std::chrono::milliseconds(10),
+                                     [](const SlowControlPoller::ValueType&) {});
+
+    BOOST_CHECK(poller.getPaths() == std::vector<std::string>{"gpio.INPUT"});
+
+    //Concurrent readers only see complete samples with increasing sequence numbers
+
+    std::atomic_bool stop = false;
+    std::atomic_int errors = 0;
+
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&poller, &stop, &errors]()
+                             {
+                                 std::uint64_t lastSequence = 0;
+
+                                 while (!stop)
+                                 {
+                                     const auto sample = poller.getLatest("gpio.INPUT");
+
+                                     if (!sample)
+                                         continue;
+
+                                     const auto& bytes = std::get<std::vector<std::uint8_t>>(sample->value);
+
+                                     if (sample->sequence < lastSequence || bytes.size() != 1 || (bytes[0] != 0x12 && bytes[0] != 0x34))
+                                         ++errors;
+
+                                     lastSequence = sample->sequence;
+                                 }
+                             });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    intf.write(17, {0x34});
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    stop = true;
+
+    for (std::thread& reader : readers)
+        reader.join();
+
+    BOOST_CHECK_EQUAL(errors, 0);
+
+    const auto sample = poller.getLatest("gpio.INPUT");
+
+    BOOST_REQUIRE(sample != nullptr);
+    BOOST_CHECK(sample->sequence > 1);
+    BOOST_CHECK(std::get<std::vector<std::uint8_t>>(sample->value) == std::vector<std::uint8_t>{0x34});
+
+    BOOST_CHECK(poller.unsubscribe(id));
+
+    BOOST_CHECK(poller.getPaths().empty());
+    BOOST_CHECK(poller.getLatest("gpio.INPUT") == nullptr);
+
+    //Samples remain valid after removal of their item
+
+    BOOST_CHECK(std::get<std::vector<std::uint8_t>>(sample->value) == std::vector<std::uint8_t>{0x34});
+
+    BOOST_CHECK(d.close());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
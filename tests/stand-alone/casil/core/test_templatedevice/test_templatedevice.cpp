@@ -116,6 +116,18 @@ BOOST_AUTO_TEST_CASE(Test4_dynamicCastToPlainDevice)
     exampleDev.close();
 }
 
+BOOST_AUTO_TEST_CASE(Test5_resolvedComponentPointers)
+{
+    ExampleDevice exampleDev;
+
+    casil::Device& plainDev = exampleDev;
+
+    BOOST_CHECK(&(exampleDev.interface<TLDummyInterface1>()) == &(plainDev.interface(TLDummyInterface1::name)));
+    BOOST_CHECK(&(exampleDev.driver<HLDummyDriver1>()) == &(plainDev.driver(HLDummyDriver1::name)));
+    BOOST_CHECK(&(exampleDev.driver<HLDriver2>()) == &(plainDev.driver(HLDriver2::name)));
+    BOOST_CHECK(&(exampleDev.reg<RLDummyRegister1>()) == &(plainDev.reg(RLDummyRegister1::name)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
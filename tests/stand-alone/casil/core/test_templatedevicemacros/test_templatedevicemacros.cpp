@@ -26,8 +26,11 @@
 #include <casil/templatedevice.h>
 #include <casil/templatedevicemacros.h>
 #include <casil/HL/Direct/dummydriver.h>
+#include <casil/HL/Muxed/gpio.h>
 #include <casil/RL/dummyregister.h>
+#include <casil/RL/standardregister.h>
 #include <casil/TL/Direct/dummyinterface.h>
+#include <casil/TL/Muxed/dummymuxedinterface.h>
 
 #include <cstdint>
 #include <vector>
@@ -55,6 +58,35 @@ typedef casil::TemplateDevice<
                 casil::TmplDev::RegistersConf<RLDummyRegister1>
             > ExampleDevice;
 
+CASIL_DEFINE_INTERFACE(casil::TL::DummyMuxedInterface,
+                       TLDummyMuxedInterface1,
+                       "DummyMuxedInterface1",
+                       "")
+
+CASIL_DEFINE_DRIVER(casil::HL::GPIO,
+                    HLGPIO1,
+                    "GPIO1",
+                    "DummyMuxedInterface1",
+                    "base_addr: 0x0, size: 16")
+
+typedef casil::TmplDev::RegLayoutConf<16,
+                                      casil::TmplDev::RegFieldConf<"A", 12, 15,
+                                                                   casil::TmplDev::RegFieldConf<"B", 4, 7>>,
+                                      casil::TmplDev::RegFieldConf<"C", 3, 2>> ExampleLayout;
+
+CASIL_DEFINE_REGISTER_WITH_LAYOUT(casil::RL::StandardRegister,
+                                  RLStandardRegister1,
+                                  "StandardRegister1",
+                                  "GPIO1",
+                                  "auto_start: false",
+                                  ExampleLayout)
+
+typedef casil::TemplateDevice<
+                casil::TmplDev::InterfacesConf<TLDummyMuxedInterface1>,
+                casil::TmplDev::DriversConf<HLGPIO1>,
+                casil::TmplDev::RegistersConf<RLStandardRegister1>
+            > ExampleLayoutDevice;
+
 //
 
 #include <boost/test/unit_test.hpp>
@@ -110,6 +142,40 @@ BOOST_AUTO_TEST_CASE(Test2_layerTypeNameMatching)
     exampleDev.close();
 }
 
+BOOST_AUTO_TEST_CASE(Test3_registerLayout)
+{
+    using AField = ExampleLayout::Field<"A">;
+    using BField = ExampleLayout::Field<"A", "B">;
+    using CField = ExampleLayout::Field<"C">;
+
+    static_assert(AField::totalOffs == 15 && AField::size == 12);
+    static_assert(BField::totalOffs == 11 && BField::size == 4);
+    static_assert(CField::totalOffs == 2 && CField::size == 3);
+    static_assert(ExampleLayout::Field<>::totalOffs == 15 && ExampleLayout::Field<>::size == 16);
+
+    ExampleLayoutDevice exampleDev;
+
+    casil::RL::StandardRegister& reg = exampleDev.reg<RLStandardRegister1>();
+
+    BOOST_REQUIRE(reg.init());
+
+    BOOST_CHECK_EQUAL(reg.getSize(), 16);
+    BOOST_CHECK_EQUAL(reg["A.B"].getTotalOffset(), BField::totalOffs);
+    BOOST_CHECK_EQUAL(reg["A.B"].getSize(), BField::size);
+    BOOST_CHECK_EQUAL(reg["C"].getTotalOffset(), CField::totalOffs);
+
+    BField::set(reg, 0b1001);
+    CField::set(reg, 0b1111);
+
+    BOOST_CHECK_EQUAL(reg["A"]["B"].toUInt(), 0b1001);
+    BOOST_CHECK_EQUAL(reg["C"].toUInt(), 0b111);
+    BOOST_CHECK_EQUAL(AField::get(reg), 0b000010010000);
+    BOOST_CHECK_EQUAL(ExampleLayout::Field<>::get(reg), 0b0000100100000111);
+
+    reg["A"] = 0xABC;
+    BOOST_CHECK_EQUAL(BField::get(reg), 0xB);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
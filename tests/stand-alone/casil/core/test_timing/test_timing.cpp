@@ -0,0 +1,148 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/device.h>
+#include <casil/metrics.h>
+#include <casil/timing.h>
+#include <casil/RL/standardregister.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(Timing_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_scopeAndSummary)
+{
+    using casil::Timing;
+
+    BOOST_CHECK_EQUAL(Timing::operationToLabel(Timing::Operation::ApplyDefaults), "apply_defaults");
+    BOOST_CHECK_EQUAL(Timing::operationToLabel(Timing::Operation::Query), "query");
+
+    const std::vector<double>& bounds = Timing::getBucketUpperBounds();
+
+    BOOST_REQUIRE(!bounds.empty());
+    BOOST_CHECK_EQUAL(bounds.front(), 1e-6);
+    BOOST_CHECK_EQUAL(bounds.back(), 10.);
+
+    for (std::size_t i = 1; i < bounds.size(); ++i)
+        BOOST_CHECK(bounds[i] > bounds[i - 1]);
+
+    casil::Metrics::Histogram& histogram = Timing::getHistogram("test_span", {{"test", "Timing_Tests"}});
+
+    BOOST_CHECK(&histogram == &Timing::getHistogram("test_span", {{"test", "Timing_Tests"}}));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const Timing::Scope timing(&histogram);
+        (void)timing;
+    }
+
+    {
+        const Timing::Scope timing(nullptr);
+        (void)timing;
+    }
+
+    const Timing::Summary summary = Timing::getSummary(histogram);
+
+    BOOST_CHECK_EQUAL(summary.bucketCounts.size(), bounds.size() + 1);
+
+#ifndef CASIL_DISABLE_TIMING
+    BOOST_CHECK_EQUAL(summary.count, 3u);
+    BOOST_CHECK_EQUAL(std::accumulate(summary.bucketCounts.begin(), summary.bucketCounts.end(), std::uint64_t{0}), 3u);
+    BOOST_CHECK(summary.totalSeconds >= 0.);
+#else
+    BOOST_CHECK_EQUAL(summary.count, 0u);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(Test2_componentTimings)
+{
+    using casil::Device;
+    using casil::Timing;
+
+    Device dev("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+                "hw_drivers: [{name: GPIO, type: GPIO, interface: intf, base_addr: 0x0, size: 8}],"
+                "registers: [{name: reg, type: StandardRegister, hw_driver: GPIO, size: 8}]}");
+
+    Timing::disable();
+
+    BOOST_REQUIRE(dev.interface("intf").init());
+    BOOST_REQUIRE(dev.reg("reg").init());
+
+    BOOST_CHECK(!Timing::isEnabled());
+    BOOST_CHECK(dev.getTimings().empty());
+
+    Timing::enable();
+
+    BOOST_REQUIRE(dev.interface("intf").init(true));
+    BOOST_REQUIRE(dev.reg("reg").init(true));
+
+    casil::RL::StandardRegister& reg = dynamic_cast<casil::RL::StandardRegister&>(dev.reg("reg"));
+
+    reg.applyDefaults();
+    reg.write();
+    reg.write();
+
+    Timing::disable();
+
+    reg.write();
+
+    const std::map<std::string, std::map<std::string, Timing::Summary>> timings = dev.getTimings();
+
+#ifndef CASIL_DISABLE_TIMING
+    BOOST_REQUIRE(timings.contains("reg"));
+    BOOST_REQUIRE(timings.contains("intf"));
+
+    const std::map<std::string, Timing::Summary>& regTimings = timings.at("reg");
+
+    BOOST_REQUIRE(regTimings.contains("init"));
+    BOOST_REQUIRE(regTimings.contains("apply_defaults"));
+    BOOST_REQUIRE(regTimings.contains("write"));
+
+    BOOST_CHECK_EQUAL(regTimings.at("init").count, 1u);
+    BOOST_CHECK(regTimings.at("apply_defaults").count >= 1u);
+    BOOST_CHECK(regTimings.at("write").count >= 2u);
+    BOOST_CHECK(!regTimings.contains("close"));
+
+    BOOST_CHECK(dev.reg("reg").getTimings().at("write").count == regTimings.at("write").count);
+
+    BOOST_CHECK_EQUAL(timings.at("intf").at("init").count, 1u);
+#else
+    BOOST_CHECK(timings.empty());
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,189 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/device.h>
+#include <casil/tracer.h>
+#include <casil/HL/Muxed/gpio.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../../datadirfixture.h"
+
+BOOST_FIXTURE_TEST_SUITE(Core_Tests, DataDirFixture)
+
+BOOST_AUTO_TEST_SUITE(Tracer_Tests)
+
+BOOST_AUTO_TEST_CASE(Test1_scopeRecording)
+{
+    using casil::Tracer;
+
+    BOOST_CHECK_THROW(Tracer::enable(0), std::invalid_argument);
+
+    const std::uint32_t source = Tracer::registerSource("TestSource");
+
+    BOOST_CHECK_EQUAL(Tracer::getSourceName(source), "TestSource");
+
+    Tracer::disable();
+
+    {
+        const Tracer::Scope trace(source, Tracer::Event::Read, 0x10, 4);
+        (void)trace;
+    }
+
+    BOOST_CHECK(Tracer::collect().empty());
+
+    Tracer::enable(4);
+
+    {
+        Tracer::Scope trace(source, Tracer::Event::RBCPWrite, 0x1000, 8);
+        trace.setRetries(2);
+        trace.setTransactionId(0x42);
+    }
+
+    try
+    {
+        const Tracer::Scope trace(source, Tracer::Event::Query, 0, 3);
+        (void)trace;
+        throw std::runtime_error("Transaction failed.");
+    }
+    catch (const std::runtime_error&) {}
+
+    std::thread([source]() -> void
+                {
+                    const Tracer::Scope trace(source, Tracer::Event::Write, 0x20, 1);
+                    (void)trace;
+                }).join();
+
+    std::vector<Tracer::Record> records = Tracer::collect();
+
+    BOOST_REQUIRE_EQUAL(records.size(), 3u);
+
+    BOOST_CHECK(records[0].event == Tracer::Event::RBCPWrite);
+    BOOST_CHECK_EQUAL(records[0].address, 0x1000u);
+    BOOST_CHECK_EQUAL(records[0].size, 8u);
+    BOOST_CHECK_EQUAL(records[0].retries, 2);
+    BOOST_CHECK_EQUAL(records[0].transactionId, 0x42);
+    BOOST_CHECK_EQUAL(records[0].failed, 0);
+
+    BOOST_CHECK(records[1].event == Tracer::Event::Query);
+    BOOST_CHECK_EQUAL(records[1].failed, 1);
+
+    BOOST_CHECK(records[2].event == Tracer::Event::Write);
+    BOOST_CHECK(records[2].thread != records[0].thread);
+
+    BOOST_CHECK(records[0].timestamp <= records[1].timestamp && records[1].timestamp <= records[2].timestamp);
+
+    //Ring buffer keeps only the newest records
+
+    for (int i = 0; i < 10; ++i)
+    {
+        const Tracer::Scope trace(source, Tracer::Event::Read, i, 1);
+        (void)trace;
+    }
+
+    records = Tracer::collect();
+
+    BOOST_REQUIRE_EQUAL(records.size(), 5u);
+    BOOST_CHECK(records[0].event == Tracer::Event::Write);
+    BOOST_CHECK_EQUAL(records[1].address, 6u);
+    BOOST_CHECK_EQUAL(records[4].address, 9u);
+
+    Tracer::clear();
+
+    BOOST_CHECK(Tracer::collect().empty());
+
+    Tracer::disable();
+}
+
+BOOST_AUTO_TEST_CASE(Test2_componentHooksAndChromeTrace)
+{
+    using casil::Device;
+    using casil::Tracer;
+
+    Device dev("{transfer_layer: [{name: intf, type: DummyMuxedInterface}],"
+                "hw_drivers: [{name: gpio, type: GPIO, interface: intf, base_addr: 0x100, size: 8}],"
+                "registers: []}");
+
+    Tracer::enable();
+
+    dev.driver("gpio").setData({0x12});
+    BOOST_CHECK_THROW((void)dev.driver("gpio").getData(), std::runtime_error);   //Dummy interface returns no data
+
+    Tracer::disable();
+
+    const std::vector<Tracer::Record> records = Tracer::collect();
+
+    bool foundRegWrite = false;
+    bool foundRegRead = false;
+
+    for (const Tracer::Record& record : records)
+    {
+        const std::string sourceName = Tracer::getSourceName(record.source);
+
+        if (record.event == Tracer::Event::RegisterWrite && sourceName == "HL/GPIO/\"gpio\"")
+            foundRegWrite = true;
+        else if (record.event == Tracer::Event::RegisterRead && sourceName == "HL/GPIO/\"gpio\"" && record.failed != 0)
+            foundRegRead = true;
+    }
+
+    BOOST_CHECK(foundRegWrite);
+    BOOST_CHECK(foundRegRead);
+
+    //Dump and convert
+
+    const std::filesystem::path tmpPath = std::filesystem::temp_directory_path();
+    const std::string traceFileName = (tmpPath / "casil_test_tracer.trc").string();
+    const std::string jsonFileName = (tmpPath / "casil_test_tracer.json").string();
+
+    Tracer::dump(traceFileName);
+    Tracer::convertToChromeTrace(traceFileName, jsonFileName);
+
+    std::ifstream jsonFile(jsonFileName);
+    const std::string json((std::istreambuf_iterator<char>(jsonFile)), std::istreambuf_iterator<char>());
+    jsonFile.close();
+
+    BOOST_CHECK(json.find("\"traceEvents\"") != std::string::npos);
+    BOOST_CHECK(json.find("\"name\": \"" + Tracer::eventToLabel(Tracer::Event::RegisterWrite) + "\"") != std::string::npos);
+    BOOST_CHECK(json.find("HL/GPIO/\\\"gpio\\\"") != std::string::npos);
+
+    std::filesystem::remove(traceFileName);
+    std::filesystem::remove(jsonFileName);
+
+    BOOST_CHECK_THROW(Tracer::convertToChromeTrace(traceFileName, jsonFileName), std::runtime_error);
+
+    Tracer::clear();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
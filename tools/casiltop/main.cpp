@@ -0,0 +1,605 @@
+/*
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2025 M. Frohne
+//
+//  This file is part of Casil, a reimplementation of the data acquisition framework basil in C++.
+//
+//  Casil is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  Casil is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty
+//  of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with Casil. If not, see <https://www.gnu.org/licenses/>.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include <casil/device.h>
+#include <casil/logger.h>
+#include <casil/TL/Muxed/remote.h>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using casil::Device;
+using casil::Logger;
+
+using casil::TL::Remote;
+
+//Live monitoring of the interface/driver activity of a running Casil process (similar to "top"):
+// - Either start a casil::DeviceServer in the monitored process and pass its socket path via "--socket <path>"
+// - Or start the metrics HTTP endpoint (casil::Metrics::startHttpServer()) and pass "--http <host:port>"
+// Rates and latency percentiles are calculated from the differences between two consecutive metrics snapshots.
+
+namespace
+{
+
+using Labels = std::map<std::string, std::string>;  //Label names and values of a sample
+using Series = std::pair<std::string, Labels>;      //Sample name and labels (identifies a time series)
+using Snapshot = std::map<Series, double>;          //Values of all time series at one point in time
+
+/*
+ * Command line options.
+ */
+struct Options
+{
+    std::string socketPath;     //DeviceServer socket path ("--socket")
+    std::string httpHost;       //Host of the metrics HTTP endpoint ("--http")
+    std::string httpPort;       //Port of the metrics HTTP endpoint ("--http")
+    double interval = 1.0;      //Refresh interval in seconds ("--interval")
+    int count = 0;              //Number of refreshes or zero for unlimited ("--count")
+    bool plain = false;         //Print snapshots one after another instead of clearing the terminal ("--plain")
+};
+
+/*
+ * Prints the command line usage of the program with name 'pProgram'.
+ */
+void printUsage(const std::string& pProgram)
+{
+    std::cout << "Usage: " << pProgram << " (--socket <path> | --http <host:port>) [--interval <seconds>] [--count <n>] [--plain]\n"
+              << "\n"
+              << "  --socket <path>       Fetch metrics from the casil::DeviceServer listening on socket file <path>.\n"
+              << "  --http <host:port>    Fetch metrics from the metrics HTTP endpoint at <host:port>.\n"
+              << "  --interval <seconds>  Refresh interval (default: 1).\n"
+              << "  --count <n>           Exit after <n> refreshes (default: run until interrupted).\n"
+              << "  --plain               Do not clear the terminal between refreshes.\n";
+}
+
+/*
+ * Parses the command line arguments 'pArgv' into 'pOptions'. Returns false if the arguments are invalid.
+ */
+bool parseOptions(const int pArgc, const char** const pArgv, Options& pOptions)
+{
+    try
+    {
+        for (int i = 1; i < pArgc; ++i)
+        {
+            const std::string_view arg = pArgv[i];
+
+            const auto nextArg = [pArgc, pArgv, &i]() -> std::string
+            {
+                if (++i >= pArgc)
+                    throw std::invalid_argument("Missing option value.");
+                return pArgv[i];
+            };
+
+            if (arg == "--socket")
+                pOptions.socketPath = nextArg();
+            else if (arg == "--http")
+            {
+                const std::string hostPort = nextArg();
+                const std::size_t colonPos = hostPort.rfind(':');
+
+                if (colonPos == std::string::npos || colonPos == 0 || colonPos + 1 == hostPort.size())
+                    return false;
+
+                pOptions.httpHost = hostPort.substr(0, colonPos);
+                pOptions.httpPort = hostPort.substr(colonPos + 1);
+            }
+            else if (arg == "--interval")
+                pOptions.interval = std::stod(nextArg());
+            else if (arg == "--count")
+                pOptions.count = std::stoi(nextArg());
+            else if (arg == "--plain")
+                pOptions.plain = true;
+            else
+                return false;
+        }
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    return ((pOptions.socketPath == "") != (pOptions.httpHost == "")) && pOptions.interval > 0 && pOptions.count >= 0;
+}
+
+//
+
+/*
+ * Fetches the exposition text from the metrics HTTP endpoint at 'pHost':'pPort'. Throws std::runtime_error on failure.
+ */
+std::string fetchHttp(const std::string& pHost, const std::string& pPort)
+{
+    using boost::asio::ip::tcp;
+
+    try
+    {
+        boost::asio::io_context ioContext;
+        tcp::socket socket(ioContext);
+
+        boost::asio::connect(socket, tcp::resolver(ioContext).resolve(pHost, pPort));
+
+        const std::string request = "GET /metrics HTTP/1.1\r\nHost: " + pHost + "\r\nConnection: close\r\n\r\n";
+        boost::asio::write(socket, boost::asio::buffer(request));
+
+        std::string response;
+        boost::system::error_code ec;
+        boost::asio::read(socket, boost::asio::dynamic_buffer(response), ec);
+
+        if (ec && ec != boost::asio::error::eof)
+            throw boost::system::system_error(ec);
+
+        const std::size_t bodyPos = response.find("\r\n\r\n");
+
+        if (!response.starts_with("HTTP/1.1 200") || bodyPos == std::string::npos)
+            throw std::runtime_error("Unexpected HTTP response: \"" + response.substr(0, response.find("\r\n")) + "\".");
+
+        return response.substr(bodyPos + 4);
+    }
+    catch (const boost::system::system_error& exc)
+    {
+        throw std::runtime_error(std::string("Could not fetch metrics via HTTP: ") + exc.what());
+    }
+}
+
+/*
+ * Parses the exposition text 'pText' (OpenMetrics text format as generated by casil::Metrics::expose()) into a snapshot.
+ */
+Snapshot parseMetrics(const std::string& pText)
+{
+    Snapshot snapshot;
+
+    std::istringstream stream(pText);
+    std::string line;
+
+    while (std::getline(stream, line))
+    {
+        if (line.empty() || line.starts_with('#'))
+            continue;
+
+        std::size_t pos = line.find_first_of("{ ");
+
+        if (pos == std::string::npos)
+            continue;
+
+        const std::string name = line.substr(0, pos);
+        Labels labels;
+
+        if (line[pos] == '{')
+        {
+            ++pos;
+
+            while (pos < line.size() && line[pos] != '}')
+            {
+                const std::size_t eqPos = line.find("=\"", pos);
+
+                if (eqPos == std::string::npos)
+                    break;
+
+                const std::string labelName = line.substr(pos, eqPos - pos);
+                std::string labelValue;
+
+                for (pos = eqPos + 2; pos < line.size() && line[pos] != '"'; ++pos)
+                {
+                    if (line[pos] == '\\' && pos + 1 < line.size())
+                    {
+                        ++pos;
+                        labelValue += (line[pos] == 'n' ? '\n' : line[pos]);
+                    }
+                    else
+                        labelValue += line[pos];
+                }
+
+                labels[labelName] = std::move(labelValue);
+
+                pos += 1;               //Closing quote
+                if (pos < line.size() && line[pos] == ',')
+                    ++pos;
+            }
+
+            ++pos;                      //Closing brace
+        }
+
+        try
+        {
+            snapshot[Series{name, std::move(labels)}] = std::stod(line.substr(pos));
+        }
+        catch (const std::exception&)
+        {
+            //Skip malformed sample
+        }
+    }
+
+    return snapshot;
+}
+
+//
+
+/*
+ * Returns the increase per second of the sample 'pName' with labels 'pLabels' between 'pPrev' and 'pCurr'
+ * over 'pSeconds' or nullopt if the sample does not exist.
+ */
+std::optional<double> getRate(const Snapshot& pPrev, const Snapshot& pCurr, const std::string& pName, const Labels& pLabels,
+                              const double pSeconds)
+{
+    const auto currIt = pCurr.find(Series{pName, pLabels});
+
+    if (currIt == pCurr.end())
+        return std::nullopt;
+
+    const auto prevIt = pPrev.find(Series{pName, pLabels});
+
+    return (currIt->second - (prevIt != pPrev.end() ? prevIt->second : 0)) / pSeconds;
+}
+
+/*
+ * Returns the current value of the sample 'pName' with labels 'pLabels' in 'pCurr' or nullopt if it does not exist.
+ */
+std::optional<double> getValue(const Snapshot& pCurr, const std::string& pName, const Labels& pLabels)
+{
+    const auto it = pCurr.find(Series{pName, pLabels});
+
+    if (it == pCurr.end())
+        return std::nullopt;
+
+    return it->second;
+}
+
+/*
+ * Estimates the quantile 'pQuantile' of the observations of histogram 'pFamily' with labels 'pLabels' made between 'pPrev'
+ * and 'pCurr' from the bucket count differences (linear interpolation within the bucket, like Prometheus' histogram_quantile()).
+ * Returns nullopt if there were no observations.
+ */
+std::optional<double> getQuantile(const Snapshot& pPrev, const Snapshot& pCurr, const std::string& pFamily, const Labels& pLabels,
+                                  const double pQuantile)
+{
+    std::vector<std::pair<double, double>> buckets;     //Upper bound and cumulative count difference
+
+    const std::string bucketName = pFamily + "_bucket";
+
+    for (auto it = pCurr.lower_bound(Series{bucketName, {}}); it != pCurr.end() && it->first.first == bucketName; ++it)
+    {
+        Labels labels = it->first.second;
+
+        const auto leIt = labels.find("le");
+
+        if (leIt == labels.end())
+            continue;
+
+        const double upperBound = (leIt->second == "+Inf" ? std::numeric_limits<double>::infinity() : std::stod(leIt->second));
+
+        labels.erase(leIt);
+
+        if (labels != pLabels)
+            continue;
+
+        const auto prevIt = pPrev.find(it->first);
+
+        buckets.emplace_back(upperBound, it->second - (prevIt != pPrev.end() ? prevIt->second : 0));
+    }
+
+    std::sort(buckets.begin(), buckets.end());
+
+    if (buckets.empty() || buckets.back().second <= 0)
+        return std::nullopt;
+
+    const double rank = pQuantile * buckets.back().second;
+
+    double lowerBound = 0;
+    double lowerCount = 0;
+
+    for (const auto& [upperBound, count] : buckets)
+    {
+        if (count >= rank)
+        {
+            if (std::isinf(upperBound))
+                return lowerBound;
+
+            if (count <= lowerCount)
+                return upperBound;
+
+            return lowerBound + (upperBound - lowerBound) * (rank - lowerCount) / (count - lowerCount);
+        }
+
+        lowerBound = upperBound;
+        lowerCount = count;
+    }
+
+    return lowerBound;
+}
+
+/*
+ * Returns the label sets (without "le") of all samples in 'pCurr' whose name equals one of 'pNames'.
+ */
+std::set<Labels> collectLabels(const Snapshot& pCurr, const std::vector<std::string>& pNames)
+{
+    std::set<Labels> labelSets;
+
+    for (const auto& [series, value] : pCurr)
+    {
+        (void)value;
+
+        if (std::find(pNames.begin(), pNames.end(), series.first) == pNames.end())
+            continue;
+
+        Labels labels = series.second;
+        labels.erase("le");
+        labelSets.insert(std::move(labels));
+    }
+
+    return labelSets;
+}
+
+//
+
+/*
+ * Formats 'pValue' with SI prefix and unit 'pUnit' or as "-" if no value.
+ */
+std::string formatSI(const std::optional<double> pValue, const std::string& pUnit)
+{
+    if (!pValue.has_value())
+        return "-";
+
+    static constexpr std::string_view prefixes = " kMGTP";
+
+    double value = *pValue;
+    std::size_t prefix = 0;
+
+    while (std::abs(value) >= 1000 && prefix + 1 < prefixes.size())
+    {
+        value /= 1000;
+        ++prefix;
+    }
+
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.1f %s%s", value, (prefix == 0 ? "" : std::string(1, prefixes[prefix]).c_str()), pUnit.c_str());
+
+    return buffer;
+}
+
+/*
+ * Formats the duration 'pSeconds' in milliseconds or as "-" if no value.
+ */
+std::string formatMs(const std::optional<double> pSeconds)
+{
+    if (!pSeconds.has_value())
+        return "-";
+
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.3f ms", *pSeconds * 1000);
+
+    return buffer;
+}
+
+/*
+ * Formats the fraction 'pNumerator'/'pDenominator' as percentage or as "-" if not available.
+ */
+std::string formatPercent(const std::optional<double> pNumerator, const std::optional<double> pDenominator)
+{
+    if (!pNumerator.has_value() || !pDenominator.has_value() || *pDenominator <= 0)
+        return "-";
+
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.1f %%", 100 * *pNumerator / *pDenominator);
+
+    return buffer;
+}
+
+/*
+ * Prints a table with header 'pHeader' and rows 'pRows', adjusting the column widths to the contents.
+ */
+void printTable(std::ostream& pStream, const std::vector<std::string>& pHeader, const std::vector<std::vector<std::string>>& pRows)
+{
+    std::vector<std::size_t> widths(pHeader.size(), 0);
+
+    for (std::size_t i = 0; i < pHeader.size(); ++i)
+        widths[i] = pHeader[i].size();
+
+    for (const std::vector<std::string>& row : pRows)
+        for (std::size_t i = 0; i < row.size() && i < widths.size(); ++i)
+            widths[i] = std::max(widths[i], row[i].size());
+
+    const auto printRow = [&pStream, &widths](const std::vector<std::string>& pRow)
+    {
+        for (std::size_t i = 0; i < pRow.size() && i < widths.size(); ++i)
+        {
+            //Left-align the identifying columns, right-align the values
+            if (i < 2)
+                pStream << pRow[i] << std::string(widths[i] - pRow[i].size(), ' ');
+            else
+                pStream << std::string(widths[i] - pRow[i].size(), ' ') << pRow[i];
+
+            pStream << (i + 1 < pRow.size() ? "  " : "\n");
+        }
+    };
+
+    printRow(pHeader);
+
+    for (const std::vector<std::string>& row : pRows)
+        printRow(row);
+}
+
+/*
+ * Prints the activity between the snapshots 'pPrev' and 'pCurr', which were taken 'pSeconds' apart.
+ */
+void printActivity(std::ostream& pStream, const Snapshot& pPrev, const Snapshot& pCurr, const double pSeconds)
+{
+    //Interface throughput, SiTCP RBCP/FIFO activity
+
+    std::vector<std::vector<std::string>> intfRows;
+
+    for (const Labels& labels : collectLabels(pCurr, {"casil_interface_transactions_total", "casil_rbcp_transactions_total",
+                                                      "casil_fifo_size_bytes"}))
+    {
+        const auto rate = [&pPrev, &pCurr, &labels, pSeconds](const std::string& pName)
+        {
+            return getRate(pPrev, pCurr, pName, labels, pSeconds);
+        };
+
+        const auto labelIt = labels.find("name");
+        const auto typeIt = labels.find("type");
+
+        intfRows.push_back({labelIt != labels.end() ? labelIt->second : "?",
+                            typeIt != labels.end() ? typeIt->second : "?",
+                            formatSI(rate("casil_interface_read_bytes_total"), "B/s"),
+                            formatSI(rate("casil_interface_written_bytes_total"), "B/s"),
+                            formatSI(rate("casil_interface_transactions_total"), "/s"),
+                            formatSI(rate("casil_interface_errors_total"), "/s"),
+                            formatSI(rate("casil_rbcp_transactions_total"), "/s"),
+                            formatPercent(rate("casil_rbcp_retries_total"), rate("casil_rbcp_transactions_total")),
+                            formatMs(getQuantile(pPrev, pCurr, "casil_rbcp_latency_seconds", labels, 0.5)),
+                            formatMs(getQuantile(pPrev, pCurr, "casil_rbcp_latency_seconds", labels, 0.99)),
+                            formatSI(getValue(pCurr, "casil_fifo_size_bytes", labels), "B"),
+                            formatSI(getValue(pCurr, "casil_fifo_high_water_mark_bytes", labels), "B"),
+                            formatSI(rate("casil_fifo_received_bytes_total"), "B/s"),
+                            formatSI(rate("casil_fifo_dropped_bytes_total"), "B/s")});
+    }
+
+    pStream << "Interfaces:\n";
+
+    printTable(pStream, {"NAME", "TYPE", "READ", "WRITTEN", "TRANS", "ERRORS", "RBCP", "RETRY", "RBCP P50", "RBCP P99",
+                         "FIFO", "FIFO HWM", "FIFO RX", "FIFO DROP"}, intfRows);
+
+    //Timed operations (drivers, registers and interfaces)
+
+    std::vector<std::vector<std::string>> opRows;
+
+    for (const Labels& labels : collectLabels(pCurr, {"casil_operation_duration_seconds_count"}))
+    {
+        const auto labelIt = labels.find("name");
+        const auto layerIt = labels.find("layer");
+        const auto opIt = labels.find("operation");
+
+        opRows.push_back({labelIt != labels.end() ? labelIt->second : "?",
+                          (layerIt != labels.end() ? layerIt->second : "?") + " " + (opIt != labels.end() ? opIt->second : "?"),
+                          formatSI(getRate(pPrev, pCurr, "casil_operation_duration_seconds_count", labels, pSeconds), "/s"),
+                          formatMs(getQuantile(pPrev, pCurr, "casil_operation_duration_seconds", labels, 0.5)),
+                          formatMs(getQuantile(pPrev, pCurr, "casil_operation_duration_seconds", labels, 0.99)),
+                          formatSI(getRate(pPrev, pCurr, "casil_operation_allocations_total", labels, pSeconds), "/s")});
+    }
+
+    if (!opRows.empty())
+    {
+        pStream << "\nOperations:\n";
+
+        printTable(pStream, {"NAME", "OPERATION", "CALLS", "P50", "P99", "ALLOCS"}, opRows);
+    }
+}
+
+} // namespace
+
+int main(int argc, const char** argv)
+{
+    Options options;
+
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argc > 0 ? argv[0] : "CasilTop");
+        return 2;
+    }
+
+    Logger::setLogLevel(Logger::LogLevel::Warning);
+    Logger::addOutputCerr();
+
+    //Connect to the DeviceServer via a Remote interface; the interface name is ignored for metrics requests
+
+    std::unique_ptr<Device> remoteDevice;
+    std::function<std::string()> fetchMetrics;
+
+    if (options.socketPath != "")
+    {
+        remoteDevice = std::make_unique<Device>("{transfer_layer: [{name: intf, type: Remote, init: {socket: \"" + options.socketPath +
+                                                "\", interface: metrics}}], hw_drivers: [], registers: []}");
+
+        if (!remoteDevice->init())
+        {
+            std::cerr << "Could not connect to \"" << options.socketPath << "\".\n";
+            return 1;
+        }
+
+        Remote& remote = dynamic_cast<Remote&>(remoteDevice->interface("intf"));
+
+        fetchMetrics = [&remote]() { return remote.getServerMetrics(); };
+    }
+    else
+        fetchMetrics = [&options]() { return fetchHttp(options.httpHost, options.httpPort); };
+
+    try
+    {
+        Snapshot prevSnapshot = parseMetrics(fetchMetrics());
+        auto prevTime = std::chrono::steady_clock::now();
+
+        for (int i = 0; options.count == 0 || i < options.count; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::duration<double>(options.interval));
+
+            Snapshot currSnapshot = parseMetrics(fetchMetrics());
+            const auto currTime = std::chrono::steady_clock::now();
+
+            std::ostringstream stream;
+
+            if (!options.plain)
+                stream << "\033[H\033[2J";
+
+            stream << "Casil activity (" << (options.socketPath != "" ? options.socketPath : options.httpHost + ":" + options.httpPort)
+                   << ", interval " << options.interval << " s):\n\n";
+
+            printActivity(stream, prevSnapshot, currSnapshot, std::chrono::duration<double>(currTime - prevTime).count());
+
+            std::cout << stream.str() << std::endl;
+
+            prevSnapshot = std::move(currSnapshot);
+            prevTime = currTime;
+        }
+    }
+    catch (const std::runtime_error& exc)
+    {
+        std::cerr << exc.what() << "\n";
+        return 1;
+    }
+
+    if (remoteDevice)
+        (void)remoteDevice->close();
+
+    return 0;
+}